@@ -0,0 +1,154 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+/*
+ A small LZSS codec for the resources that are embedded in the tools.
+
+ The compressed stream is a sequence of groups. Every group starts with a
+ flags byte, followed by up to eight items, lowest bit first. A set bit is a
+ literal byte. A cleared bit is a back reference of two bytes: the high 12
+ bits are the distance minus one, the low 4 bits are the length minus three.
+ A length nibble of 15 is followed by another byte that is added to the
+ length.
+ */
+
+#include "compress.h"
+
+#include <string.h>
+
+
+static const uint32_t kWindowSize = 4096;
+static const uint32_t kMinMatch = 3;
+static const uint32_t kMaxMatch = kMinMatch + 15 + 255;
+static const uint32_t kHashSize = 1<<13;
+static const int kMaxChain = 256;
+
+
+static inline uint32_t hash3(const uint8_t *p)
+{
+    return ((p[0]<<8) ^ (p[1]<<4) ^ p[2]) & (kHashSize-1);
+}
+
+
+/**
+ * Compress a block of memory.
+ *
+ * \param src the uncompressed data
+ * \param srcSize number of bytes in src
+ * \param dst the compressed data is appended here
+ */
+void mosCompress(const uint8_t *src, uint32_t srcSize, std::vector<uint8_t> &dst)
+{
+    std::vector<int32_t> head(kHashSize, -1);
+    std::vector<int32_t> prev(srcSize, -1);
+    size_t flagsPos = 0;
+    int nItems = 8;
+    uint32_t i = 0;
+    while (i<srcSize) {
+        if (nItems==8) {
+            flagsPos = dst.size();
+            dst.push_back(0);
+            nItems = 0;
+        }
+        uint32_t bestLen = 0, bestDist = 0;
+        if (i+kMinMatch<=srcSize) {
+            uint32_t maxLen = srcSize-i;
+            if (maxLen>kMaxMatch) maxLen = kMaxMatch;
+            int chain = kMaxChain;
+            for (int32_t j = head[hash3(src+i)]; j>=0 && i-j<=kWindowSize && chain>0; j = prev[j], chain--) {
+                uint32_t n = 0;
+                while (n<maxLen && src[j+n]==src[i+n]) n++;
+                if (n>bestLen) {
+                    bestLen = n;
+                    bestDist = i-j;
+                    if (n==maxLen) break;
+                }
+            }
+        }
+        if (bestLen>=kMinMatch) {
+            uint32_t len = bestLen-kMinMatch;
+            uint32_t nibble = len<15 ? len : 15;
+            uint32_t token = ((bestDist-1)<<4) | nibble;
+            dst.push_back((uint8_t)(token>>8));
+            dst.push_back((uint8_t)token);
+            if (nibble==15)
+                dst.push_back((uint8_t)(len-15));
+        } else {
+            bestLen = 1;
+            dst[flagsPos] |= (uint8_t)(1<<nItems);
+            dst.push_back(src[i]);
+        }
+        nItems++;
+        // add all covered positions to the hash chains
+        for (uint32_t n=0; n<bestLen; n++, i++) {
+            if (i+kMinMatch<=srcSize) {
+                uint32_t h = hash3(src+i);
+                prev[i] = head[h];
+                head[h] = (int32_t)i;
+            }
+        }
+    }
+}
+
+
+/**
+ * Decompress a block of memory.
+ *
+ * \param src the compressed data
+ * \param srcSize number of bytes in src
+ * \param dst write the uncompressed data here
+ * \param dstSize the expected number of uncompressed bytes
+ * \return 0 on success, -1 if the data is corrupt
+ */
+int mosDecompress(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    const uint8_t *srcEnd = src + srcSize;
+    uint32_t o = 0;
+    while (o<dstSize) {
+        if (src>=srcEnd) return -1;
+        uint8_t flags = *src++;
+        for (int n=0; n<8 && o<dstSize; n++, flags>>=1) {
+            if (flags & 1) {
+                if (src>=srcEnd) return -1;
+                dst[o++] = *src++;
+            } else {
+                if (src+2>srcEnd) return -1;
+                uint32_t token = (src[0]<<8) | src[1];
+                src += 2;
+                uint32_t dist = (token>>4) + 1;
+                uint32_t len = (token & 15) + kMinMatch;
+                if ((token & 15)==15) {
+                    if (src>=srcEnd) return -1;
+                    len += *src++;
+                }
+                if (dist>o || len>dstSize-o) return -1;
+                const uint8_t *s = dst + o - dist;
+                if (dist>=len) {
+                    memcpy(dst+o, s, len);
+                } else {
+                    for (uint32_t k=0; k<len; k++) dst[o+k] = s[k];
+                }
+                o += len;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+#ifndef __mosrun__compress__
+#define __mosrun__compress__
+
+
+#include <stdint.h>
+
+#include <vector>
+
+
+void mosCompress(const uint8_t *src, uint32_t srcSize, std::vector<uint8_t> &dst);
+int mosDecompress(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize);
+
+
+#endif /* defined(__mosrun__compress__) */
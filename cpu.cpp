@@ -34,6 +34,8 @@
 #include "resourcefork.h"
 #include "breakpoints.h"
 #include "traps.h"
+#include "fileio.h"
+#include "snapshot.h"
 
 // Inlcude Musahi's m68k emulator
 
@@ -46,6 +48,13 @@ extern "C" {
 
 bool findFunctionName(mosPtr pc, char* outFunName);
 
+// if set, the end of the emulation returns to the caller of runApp() instead of quitting mosrun
+bool gMosReturnOnExit = false;
+// set when the emulated app quit
+bool gMosAppDone = false;
+// result code of the emulated app when it quit
+unsigned int gMosAppResult = 0;
+
 /**
  * Run a single 68020 command.
  *
@@ -96,7 +105,15 @@ void m68k_instruction_hook()
                     unsigned int mpwMem = m68k_read_memory_32(mpwHandle+4);
                     unsigned int resultCode = m68k_read_memory_32(mpwMem+0x000E);
                     mosDebug("End Of Emulation (returns %d)\n", resultCode);
-                    exit(resultCode); }
+                    if (gMosSaveSnapshotPath)
+                        mosWarning("The app quit before a snapshot was saved\n");
+                    mosFlushAllFiles();
+                    if (!gMosReturnOnExit)
+                        exit(resultCode);
+                    gMosAppResult = resultCode;
+                    gMosAppDone = true;
+                    m68k_end_timeslice();
+                    return; }
                 case 0xaffd: trapDispatch(instr); break;
                 case 0xaffe: trapBreakpoint(instr); goto afterBreakpoint;
                 case 0xafff: trapGoNative(instr); break; // TODO: unverified
@@ -26,6 +26,10 @@
 #include "main.h"
 
 
+extern bool gMosReturnOnExit;
+extern bool gMosAppDone;
+extern unsigned int gMosAppResult;
+
 extern "C" {
 void m68k_instruction_hook();
 }
@@ -24,6 +24,9 @@
 #include "filename.h"
 #include "memory.h"
 #include "log.h"
+#include "vfs.h"
+#include "traps.h"
+#include "filter.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -35,15 +38,26 @@
 #define STDOUT_FILENO 1
 #define STDERR_FILENO 2
 #define O_NOFOLLOW 0
+// files are never positioned on Windows, so these just read and write
+#define pread(fd, buf, n, offset) read(fd, buf, n)
+#define pwrite(fd, buf, n, offset) write(fd, buf, n)
 #else
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include <sys/xattr.h>
+#include <sys/mman.h>
 #define O_BINARY 0
 #endif
 #include <fcntl.h>
 #include <sys/stat.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 extern "C" {
@@ -51,12 +65,1048 @@ extern "C" {
 }
 
 
+/**
+ * Create a new file record with empty buffers.
+ */
+static MosFile *mosNewFile(int fd, const char *filename, bool allocated)
+{
+    MosFile *mosFile = new MosFile();
+    mosFile->fd = fd;
+    mosFile->filename = filename;
+    mosFile->open = true;
+    mosFile->allocated = allocated;
+    return mosFile;
+}
+
+
 std::vector<MosFile*> mosFileRegistry = {
-    new MosFile{ STDIN_FILENO,  "/dev/stdin", true, false },
-    new MosFile{ STDOUT_FILENO, "/dev/stdout", true, false },
-    new MosFile{ STDERR_FILENO, "/dev/stderr", true, false }
+    mosNewFile(STDIN_FILENO,  "/dev/stdin", false),
+    mosNewFile(STDOUT_FILENO, "/dev/stdout", false),
+    mosNewFile(STDERR_FILENO, "/dev/stderr", false)
 };
 
+// the buffer size that we report to the MPW runtime in FIOBUFSIZE
+unsigned int gMosFioBufSize = 8192;
+
+// size of the host side output buffer of every file
+static const unsigned int kMosOutBufferSize = 64*1024;
+
+// size of the buffer for reading and decoding UTF-8 files
+static const unsigned int kMosInBufferSize = 64*1024;
+
+// result of stat() for a file name, see mosStat()
+typedef struct {
+    int err;
+    struct stat st;
+} MosStatEntry;
+
+static std::unordered_map<std::string, MosStatEntry> gMosStatCache;
+
+// number of file names in gMosStatCache
+static const size_t kMosStatCacheSize = 4096;
+
+
+/**
+ * Get the status of a file, remembering the result.
+ *
+ * Compilers look for the same include files over and over again, so we
+ * also remember which files don't exist. Files that we create, write,
+ * truncate, or delete ourselves are removed from the cache with
+ * mosForgetStat(). The cache is cleared between batch jobs.
+ *
+ * \return 0, or -1 and errno
+ */
+static int mosStat(const char *path, struct stat *st)
+{
+    if (mosVfsContains(path))
+        return mosVfsStat(path, st);
+    auto it = gMosStatCache.find(path);
+    if (it==gMosStatCache.end()) {
+        MosStatEntry entry;
+        entry.err = (stat(path, &entry.st)==-1) ? errno : 0;
+        if (gMosStatCache.size()>=kMosStatCacheSize)
+            gMosStatCache.clear();
+        it = gMosStatCache.emplace(path, entry).first;
+    }
+    if (it->second.err) {
+        errno = it->second.err;
+        return -1;
+    }
+    *st = it->second.st;
+    return 0;
+}
+
+
+/**
+ * Remove a file from the status cache after we changed it.
+ */
+static void mosForgetStat(const char *path)
+{
+    if (path)
+        gMosStatCache.erase(path);
+}
+
+
+static void mosWriteBehind(MosFile *mosFile, char *data, unsigned int size, unsigned int offset);
+
+
+/**
+ * Write all buffered output of a file.
+ *
+ * In write-behind mode, the buffer of a regular file is handed to the I/O
+ * thread as it is, and the file gets a new buffer.
+ *
+ * \return -1 and errno if the data could not be written
+ */
+static int mosFlushFile(MosFile *mosFile)
+{
+    if (mosFile->outSize)
+        mosForgetStat(mosFile->filename);
+    if (gMosWriteBehind && mosFile->positioned && !mosFile->map && mosFile->outSize) {
+        mosWriteBehind(mosFile, mosFile->outBuffer, mosFile->outSize, mosFile->pos-mosFile->outSize);
+        mosFile->outBuffer = (char*)malloc(kMosOutBufferSize);
+        mosFile->outSize = 0;
+        return 0;
+    }
+    unsigned int done = 0;
+    while (done<mosFile->outSize) {
+        ssize_t ret;
+        if (mosFile->positioned)
+            ret = pwrite(mosFile->fd, mosFile->outBuffer+done, mosFile->outSize-done,
+                         mosFile->pos-mosFile->outSize+done);
+        else
+            ret = write(mosFile->fd, mosFile->outBuffer+done, mosFile->outSize-done);
+        if (ret==-1) {
+            if (errno==EINTR) continue;
+            mosDebug("Can't write to file %s: %s\n", mosFile->filename, strerror(errno));
+            mosFile->outSize = 0;
+            return -1;
+        }
+        done += (unsigned int)ret;
+    }
+    mosFile->outSize = 0;
+    return 0;
+}
+
+
+/**
+ * Stop reading a file through its mapping and use pread() instead.
+ */
+static void mosUnmapFile(MosFile *mosFile)
+{
+#ifndef WIN32
+    if (mosFile->map)
+        munmap((void*)mosFile->map, mosFile->mapSize);
+#endif
+    mosFile->map = nullptr;
+    mosFile->mapSize = 0;
+}
+
+
+/**
+ * Check that a mapped file is still as long as the mapping.
+ *
+ * Reading a mapping beyond the end of the file raises SIGBUS, so the mapping
+ * is dropped if the file was made shorter by someone else. This is only
+ * called on the main thread while no I/O is in flight for the file.
+ *
+ * \return true if the mapping can be read
+ */
+static bool mosCheckMap(MosFile *mosFile)
+{
+    struct stat st;
+    if (fstat(mosFile->fd, &st)==0 && st.st_size>=(off_t)mosFile->mapSize)
+        return true;
+    mosDebug("File %s was truncated while it was mapped\n", mosFile->filename);
+    mosUnmapFile(mosFile);
+    return false;
+}
+
+
+/**
+ * Read from a file at its mark.
+ *
+ * \return number of bytes read, 0 at the end of the file, or -1 and errno
+ */
+static int mosReadFile(MosFile *mosFile, void *dst, unsigned int size)
+{
+    if (mosFile->vfs) {
+        unsigned int n = mosVfsRead(mosFile->vfs, mosFile->pos, dst, size);
+        mosFile->pos += n;
+        return (int)n;
+    }
+    if (mosFile->map && mosCheckMap(mosFile)) {
+        if (mosFile->pos>=mosFile->mapSize)
+            return 0;
+        unsigned int avail = mosFile->mapSize-mosFile->pos;
+        if (size>avail)
+            size = avail;
+        memcpy(dst, mosFile->map+mosFile->pos, size);
+        mosFile->pos += size;
+        return (int)size;
+    }
+    if (!mosFile->positioned)
+        return (int)::read(mosFile->fd, dst, size);
+    ssize_t ret = pread(mosFile->fd, dst, size, mosFile->pos);
+    if (ret>0)
+        mosFile->pos += (unsigned int)ret;
+    return (int)ret;
+}
+
+
+/**
+ * Write to a file at its mark, bypassing the output buffer.
+ *
+ * \return number of bytes written, or -1 and errno
+ */
+static int mosWriteFile(MosFile *mosFile, const void *src, unsigned int size)
+{
+    mosForgetStat(mosFile->filename);
+    if (mosFile->vfs) {
+        unsigned int n = mosVfsWrite(mosFile->vfs, mosFile->pos, src, size);
+        mosFile->pos += n;
+        return (int)n;
+    }
+    if (!mosFile->positioned)
+        return (int)::write(mosFile->fd, src, size);
+    if (gMosWriteBehind && !mosFile->map) {
+        char *data = (char*)malloc(size);
+        memcpy(data, src, size);
+        mosWriteBehind(mosFile, data, size, mosFile->pos);
+        mosFile->pos += size;
+        return (int)size;
+    }
+    ssize_t ret = pwrite(mosFile->fd, src, size, mosFile->pos);
+    if (ret>0)
+        mosFile->pos += (unsigned int)ret;
+    return (int)ret;
+}
+
+
+/**
+ * Forget UTF-8 data that was read ahead.
+ *
+ * The file mark moves back to where the app stopped reading.
+ */
+static void mosDropReadAhead(MosFile *mosFile)
+{
+    unsigned int ahead = mosFile->inSize-mosFile->inPos;
+    if (ahead) {
+        if (mosFile->positioned)
+            mosFile->pos -= ahead;
+        else
+            lseek(mosFile->fd, -(off_t)ahead, SEEK_CUR);
+    }
+    mosFile->inPos = mosFile->inSize = 0;
+}
+
+
+/**
+ * Move the mark of a file.
+ *
+ * \param mosFile the file
+ * \param offset offset in bytes
+ * \param whence SEEK_SET, SEEK_CUR, or SEEK_END
+ * \return the new position, or -1 and errno
+ */
+static int mosSeekFile(MosFile *mosFile, int offset, int whence)
+{
+    if (mosFile->outSize)
+        mosFlushFile(mosFile);
+    mosDropReadAhead(mosFile);
+    if (!mosFile->map && !mosFile->positioned && !mosFile->vfs)
+        return (int)lseek(mosFile->fd, offset, whence);
+    int pos = offset;
+    if (whence==SEEK_CUR) {
+        pos += (int)mosFile->pos;
+    } else if (whence==SEEK_END) {
+        struct stat st;
+        if (mosFile->vfs) {
+            pos += (int)mosFile->vfs->data.size();
+        } else if (mosFile->map) {
+            pos += (int)mosFile->mapSize;
+        } else if (fstat(mosFile->fd, &st)==0) {
+            pos += (int)st.st_size;
+        } else {
+            return -1;
+        }
+    }
+    if (pos<0) {
+        errno = EINVAL;
+        return -1;
+    }
+    // like lseek(), seeking past the end is fine, but there is nothing to read
+    mosFile->pos = (unsigned int)pos;
+    return pos;
+}
+
+
+/**
+ * Return the mark of a file.
+ */
+static unsigned int mosTellFile(MosFile *mosFile)
+{
+    if (mosFile->map || mosFile->positioned || mosFile->vfs)
+        return mosFile->pos;
+    return (unsigned int)lseek(mosFile->fd, 0, SEEK_CUR);
+}
+
+
+/**
+ * Write data to a file through its output buffer.
+ *
+ * Output to interactive devices is not buffered. Writing to stdout flushes
+ * stderr and vice versa, so that both keep their order if they go to the
+ * same place.
+ *
+ * \return the number of bytes written, or -1 and errno
+ */
+static int mosBufferedWrite(MosFile *mosFile, const void *data, unsigned int size)
+{
+    // continue writing where the app stopped reading
+    mosDropReadAhead(mosFile);
+    // files in memory need no buffer
+    if (mosFile->vfs)
+        return mosWriteFile(mosFile, data, size);
+    if (!mosFile->outChecked) {
+        mosFile->outChecked = true;
+        if (!isatty(mosFile->fd))
+            mosFile->outBuffer = (char*)malloc(kMosOutBufferSize);
+    }
+    if (mosFile->fd==STDOUT_FILENO || mosFile->fd==STDERR_FILENO) {
+        MosFile *other = mosFileRegistry.at(mosFile->fd==STDOUT_FILENO ? 2 : 1);
+        if (other && other->outSize)
+            mosFlushFile(other);
+    }
+    if (!mosFile->outBuffer)
+        return mosWriteFile(mosFile, data, size);
+    if (mosFile->outSize+size>kMosOutBufferSize) {
+        if (mosFlushFile(mosFile)==-1)
+            return -1;
+        if (size>kMosOutBufferSize)
+            return mosWriteFile(mosFile, data, size);
+    }
+    memcpy(mosFile->outBuffer+mosFile->outSize, data, size);
+    mosFile->outSize += size;
+    if (mosFile->positioned)
+        mosFile->pos += size;
+    return (int)size;
+}
+
+
+/**
+ * Write MacRoman text to a file as UTF-8.
+ *
+ * Text is converted in small blocks that stay in the cache.
+ *
+ * \return the number of MacRoman bytes written, or -1 and errno
+ */
+static int mosWriteMacAsUTF8(MosFile *mosFile, const char *data, unsigned int size)
+{
+    char utf8[3*1024];
+    unsigned int done = 0;
+    while (done<size) {
+        unsigned int n = size-done;
+        if (n>1024) n = 1024;
+        unsigned int m = mosMacToUTF8(data+done, n, utf8);
+        for (unsigned int i=0; i<m; ) {
+            int ret = mosBufferedWrite(mosFile, utf8+i, m-i);
+            if (ret==-1)
+                return -1;
+            i += (unsigned int)ret;
+        }
+        done += n;
+    }
+    return (int)size;
+}
+
+
+/**
+ * Decide how the data of a file is converted, see mosFilterData().
+ */
+static void mosCheckFilter(MosFile *mosFile)
+{
+    int stream = mosFile->allocated ? MOS_STREAM_FILE : mosFile->fd;
+    mosFilterData(mosFile->filename, stream, mosFile->convertIn, mosFile->convertOut);
+    mosFile->filterChecked = true;
+}
+
+
+/**
+ * Release a file that was opened by the app.
+ */
+static void mosReleaseFile(MosFile *mosFile)
+{
+    if (mosFile->filename) {
+        free((char*)mosFile->filename);
+    }
+    free(mosFile->outBuffer);
+    free(mosFile->inBuffer);
+    mosUnmapFile(mosFile);
+    delete mosFile;
+}
+
+
+/**
+ * Close the Unix file of a record.
+ *
+ * \return 0, or -1 and errno
+ */
+static int mosCloseFile(MosFile *mosFile)
+{
+    if (mosFile->fd==-1) // in-memory file
+        return 0;
+    return close(mosFile->fd);
+}
+
+
+/**
+ * Open a file in the in-memory file system.
+ *
+ * \param filename name of the file
+ * \param flags Unix flags as in open()
+ * \return a new file record, or nullptr and errno
+ */
+static MosFile *mosOpenVfsFile(const char *filename, int flags)
+{
+    MosVfsNodeRef node = mosVfsOpen(filename, flags);
+    if (!node)
+        return nullptr;
+    MosFile *mosFile = mosNewFile(-1, strdup(filename), true);
+    mosFile->vfs = node;
+    if (flags & O_APPEND)
+        mosFile->pos = (unsigned int)node->data.size();
+    return mosFile;
+}
+
+
+/**
+ * Set up how we access a file that was just opened by the app.
+ *
+ * Regular files are read and written with pread() and pwrite() at a file
+ * mark that we keep ourselves, so moving the mark costs no system call.
+ * Files that are opened for reading only are also mapped into host memory,
+ * and reads are copied straight from the mapping. The mapping keeps the
+ * size that the file had when it was opened, and is dropped if the file gets
+ * shorter, see mosCheckMap() and mosUnmapSameFile(). Pipes, devices, and files
+ * that are opened for appending use the kernel file position as before.
+ *
+ * \param mosFile the new file
+ * \param flags Unix flags that were used to open the file
+ */
+static void mosPrepareFile(MosFile *mosFile, int flags)
+{
+#ifndef WIN32
+    struct stat st;
+    if (fstat(mosFile->fd, &st)==-1 || !S_ISREG(st.st_mode) || st.st_size>0x7fffffff)
+        return;
+    mosFile->pos = 0;
+    if ((flags&O_APPEND)==0)
+        mosFile->positioned = true;
+    if ((flags&O_ACCMODE)==O_RDONLY && st.st_size>0) {
+        void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, mosFile->fd, 0);
+        if (map!=MAP_FAILED) {
+            madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+            mosFile->map = (const char*)map;
+            mosFile->mapSize = (unsigned int)st.st_size;
+        }
+    }
+#else
+    (void)mosFile; (void)flags;
+#endif
+}
+
+
+/**
+ * Move the file mark as requested in a parameter block.
+ *
+ * \param mosFile the file
+ * \param ioPosMode 1 = fsFromStart, 2 = fsFromLEOF, 3 = fsFromMark, all other
+ *        modes keep the mark
+ * \param ioPosOffset offset in bytes
+ * \return the new position, or -1 and errno
+ */
+static int mosPBSeek(MosFile *mosFile, uint16_t ioPosMode, uint32_t ioPosOffset)
+{
+    switch (ioPosMode) {
+        case 1: return mosSeekFile(mosFile, (int)ioPosOffset, SEEK_SET);
+        case 2: return mosSeekFile(mosFile, (int)ioPosOffset, SEEK_END);
+        case 3: return mosSeekFile(mosFile, (int)ioPosOffset, SEEK_CUR);
+    }
+    return (int)mosTellFile(mosFile);
+}
+
+
+// an asynchronous parameter block call, see mosQueueIO(), or a write that
+// is done behind the back of the app, see mosWriteBehind()
+typedef struct {
+    mosPtr paramBlock;
+    mosPtr ioCompletion;
+    MosFile *file;      // nullptr if the call was done right away
+    bool write;
+    char *buffer;       // ioBuffer in host memory
+    char *data;         // our own copy of the data for write-behind
+    uint32_t offset;    // write-behind data goes here
+    uint32_t reqCount;
+    uint16_t posMode;
+    uint32_t posOffset;
+    int result;         // Classic error code when done
+    int err;            // errno if the transfer failed
+    uint32_t actCount;
+    uint32_t pos;
+} MosIORequest;
+
+// requests for the I/O thread
+typedef struct {
+    std::mutex mutex;
+    std::condition_variable queued, done;
+    std::deque<MosIORequest*> todo;     // the first request is in progress
+    std::deque<MosIORequest*> finished;
+    std::atomic<bool> ready;            // set if finished is not empty
+    unsigned int behindSize;            // bytes that wait to be written behind
+} MosIOQueue;
+
+// created with the I/O thread and never destroyed, because the thread may
+// still wait on it when we exit
+static MosIOQueue *gMosIO = nullptr;
+
+// requests that are done, but whose completion routine did not run yet
+static std::deque<MosIORequest*> gMosIOCompleted;
+
+// number of requests that are in flight or wait for their completion routine
+unsigned int gMosIOPending = 0;
+
+// if set, regular files are written by the I/O thread, see ---write-behind
+bool gMosWriteBehind = false;
+
+// number of writes that the I/O thread did not do yet
+static unsigned int gMosWritesBehind = 0;
+
+// the app waits for the I/O thread if it falls this many bytes behind
+static const unsigned int kMosWriteBehindLimit = 16*1024*1024;
+
+
+/**
+ * Run asynchronous reads and writes, one after the other.
+ *
+ * Like the File Manager, we work on a single queue, so requests finish in
+ * the order that the app made them, and every request finds the file mark
+ * where the previous request left it. The main thread does not touch a file
+ * while it is busy, and the I/O thread touches nothing else.
+ */
+static void mosIOThread()
+{
+    std::unique_lock<std::mutex> lock(gMosIO->mutex);
+    for (;;) {
+        if (gMosIO->todo.empty()) {
+            gMosIO->queued.wait(lock);
+            continue;
+        }
+        MosIORequest *rq = gMosIO->todo.front();
+        lock.unlock();
+        MosFile *mosFile = rq->file;
+        int ret;
+        if (rq->data) {
+            // written behind: only the data and the offset are ours
+            unsigned int done = 0;
+            ret = 0;
+            while (done<rq->reqCount) {
+                ssize_t n = pwrite(mosFile->fd, rq->data+done, rq->reqCount-done, rq->offset+done);
+                if (n==-1) {
+                    if (errno==EINTR) continue;
+                    ret = -1;
+                    break;
+                }
+                done += (unsigned int)n;
+            }
+            rq->err = (ret==-1) ? errno : 0;
+            rq->result = (ret==-1) ? mosFnfErr : mosNoErr;
+            lock.lock();
+            gMosIO->behindSize -= rq->reqCount;
+            gMosIO->todo.pop_front();
+            gMosIO->finished.push_back(rq);
+            gMosIO->ready = true;
+            gMosIO->done.notify_all();
+            continue;
+        }
+        mosPBSeek(mosFile, rq->posMode, rq->posOffset);
+        if (rq->write) {
+            ret = (int)pwrite(mosFile->fd, rq->buffer, rq->reqCount, mosFile->pos);
+        } else {
+            // mapped files are read with pread() as well, because only the
+            // main thread may check and drop the mapping
+            ret = (int)pread(mosFile->fd, rq->buffer, rq->reqCount, mosFile->pos);
+        }
+        if (ret>0)
+            mosFile->pos += (unsigned int)ret;
+        rq->err = (ret==-1) ? errno : 0;
+        rq->result = (ret==-1) ? mosFnfErr : mosNoErr;
+        rq->actCount = (ret==-1) ? 0 : (uint32_t)ret;
+        rq->pos = mosTellFile(mosFile);
+        lock.lock();
+        gMosIO->todo.pop_front();
+        gMosIO->finished.push_back(rq);
+        gMosIO->ready = true;
+        gMosIO->done.notify_all();
+    }
+}
+
+
+/**
+ * Remember to call the completion routine of a request that is done.
+ */
+static void mosCompleteIO(MosIORequest *rq)
+{
+    if (rq->ioCompletion) {
+        gMosIOCompleted.push_back(rq);
+    } else {
+        delete rq;
+        gMosIOPending--;
+    }
+}
+
+
+/**
+ * Write the results of finished asynchronous requests into their parameter
+ * blocks.
+ */
+static void mosFinishIO()
+{
+    std::deque<MosIORequest*> finished;
+    {
+        std::lock_guard<std::mutex> lock(gMosIO->mutex);
+        finished.swap(gMosIO->finished);
+        gMosIO->ready = false;
+    }
+    for (MosIORequest *rq: finished) {
+        MosFile *mosFile = rq->file;
+        if (rq->data) {
+            if (rq->result!=mosNoErr) {
+                mosError("Can't write to file %s: %s\n", mosFile->filename, strerror(rq->err));
+                mosFile->writeErr = rq->err;
+            }
+            mosForgetStat(mosFile->filename);
+            mosFile->behind--;
+            gMosWritesBehind--;
+            gMosIOPending--;
+            free(rq->data);
+            delete rq;
+            continue;
+        }
+        mosFile->busy--;
+        if (rq->write)
+            mosForgetStat(mosFile->filename);
+        if (rq->result!=mosNoErr)
+            mosDebug("Asynchronous %s of %s failed: %s\n", rq->write ? "write" : "read",
+                     mosFile->filename, strerror(rq->err));
+        else
+            m68k_write_memory_32(rq->paramBlock+40, rq->actCount);
+        m68k_write_memory_32(rq->paramBlock+46, rq->pos);
+        m68k_write_memory_16(rq->paramBlock+16, rq->result);
+        mosCompleteIO(rq);
+    }
+}
+
+
+/**
+ * Wait until the I/O thread has finished all requests.
+ *
+ * Completion routines are not called here, but at the next safe point.
+ */
+static void mosWaitForIO()
+{
+    if (!gMosIO)
+        return;
+    {
+        std::unique_lock<std::mutex> lock(gMosIO->mutex);
+        while (!gMosIO->todo.empty())
+            gMosIO->done.wait(lock);
+    }
+    mosFinishIO();
+}
+
+
+/**
+ * Wait until all data that was written behind is on disk.
+ *
+ * Call this before a file is opened, created, deleted, or checked by name.
+ */
+static void mosWaitForWrites()
+{
+    if (gMosWritesBehind)
+        mosWaitForIO();
+}
+
+
+/**
+ * Drop the mappings of all open files that are the same Unix file as st.
+ *
+ * Call this before we truncate a file, so that no mapping reaches beyond
+ * the new end of the file.
+ */
+static void mosUnmapSameFile(const struct stat &st)
+{
+    for (MosFile *mosFile: mosFileRegistry) {
+        struct stat fst;
+        if (!mosFile)
+            continue;
+        // the I/O thread may still use the file
+        if (mosFile->busy)
+            mosWaitForIO();
+        if (!mosFile->map || fstat(mosFile->fd, &fst)==-1)
+            continue;
+        if (fst.st_dev==st.st_dev && fst.st_ino==st.st_ino)
+            mosUnmapFile(mosFile);
+    }
+}
+
+
+/**
+ * Write all output of a file and wait until the I/O thread is done with it.
+ *
+ * This is needed before the app reads a file, closes it, changes its size,
+ * or asks for its size.
+ *
+ * \return -1 and errno if any data could not be written
+ */
+static int mosSyncFile(MosFile *mosFile)
+{
+    int ret = 0;
+    if (mosFile->outSize)
+        ret = mosFlushFile(mosFile);
+    if (mosFile->busy || mosFile->behind)
+        mosWaitForIO();
+    if (mosFile->writeErr) {
+        errno = mosFile->writeErr;
+        mosFile->writeErr = 0;
+        ret = -1;
+    }
+    return ret;
+}
+
+
+/**
+ * Start the I/O thread if it is not running yet.
+ */
+static void mosStartIOThread()
+{
+    if (!gMosIO) {
+        gMosIO = new MosIOQueue();
+        gMosIO->ready = false;
+        gMosIO->behindSize = 0;
+        std::thread(mosIOThread).detach();
+    }
+}
+
+
+/**
+ * Let the I/O thread write data to a regular file.
+ *
+ * Requests are done in order, so the data of a file lands on disk in the
+ * order that the app wrote it.
+ *
+ * \param mosFile the file
+ * \param data the data, allocated with malloc(); the I/O thread frees it
+ * \param size number of bytes
+ * \param offset the position in the file
+ */
+static void mosWriteBehind(MosFile *mosFile, char *data, unsigned int size, unsigned int offset)
+{
+    mosStartIOThread();
+    MosIORequest *rq = new MosIORequest();
+    rq->file = mosFile;
+    rq->write = true;
+    rq->data = data;
+    rq->reqCount = size;
+    rq->offset = offset;
+    mosFile->behind++;
+    gMosWritesBehind++;
+    gMosIOPending++;
+    {
+        std::unique_lock<std::mutex> lock(gMosIO->mutex);
+        // don't let the app run too far ahead of the disk
+        while (gMosIO->behindSize>kMosWriteBehindLimit)
+            gMosIO->done.wait(lock);
+        gMosIO->behindSize += size;
+        gMosIO->todo.push_back(rq);
+    }
+    gMosIO->queued.notify_one();
+}
+
+
+/**
+ * Hand a read or write to the I/O thread.
+ *
+ * ioResult stays positive until the request is done. The app must not
+ * touch the buffer until then.
+ *
+ * \return noErr, the result of queuing the request
+ */
+static int mosQueueIO(mosPtr paramBlock, MosFile *mosFile, bool write, mosPtr ioBuffer,
+                      uint32_t ioReqCount, uint16_t ioPosMode, uint32_t ioPosOffset)
+{
+    mosStartIOThread();
+    // the I/O thread must not find buffered data
+    if (mosFile->outSize)
+        mosFlushFile(mosFile);
+    mosDropReadAhead(mosFile);
+    if (!write)
+        mosMarkDirty(ioBuffer, ioReqCount);
+
+    MosIORequest *rq = new MosIORequest();
+    rq->paramBlock = paramBlock;
+    rq->ioCompletion = m68k_read_memory_32(paramBlock+12);
+    rq->file = mosFile;
+    rq->write = write;
+    rq->buffer = (char*)mosToHost(ioBuffer);
+    rq->reqCount = ioReqCount;
+    rq->posMode = ioPosMode;
+    rq->posOffset = ioPosOffset;
+    mosFile->busy++;
+    gMosIOPending++;
+    m68k_write_memory_16(paramBlock+16, 1);
+    {
+        std::lock_guard<std::mutex> lock(gMosIO->mutex);
+        gMosIO->todo.push_back(rq);
+    }
+    gMosIO->queued.notify_one();
+    return mosNoErr;
+}
+
+
+/**
+ * Set the result of a parameter block call that was done right away.
+ *
+ * If the app made an asynchronous call, its completion routine still runs,
+ * but not before the next safe point.
+ *
+ * \return err
+ */
+static int mosPBReturn(mosPtr paramBlock, bool async, int err)
+{
+    m68k_write_memory_16(paramBlock+16, err);
+    mosPtr ioCompletion = async ? m68k_read_memory_32(paramBlock+12) : 0;
+    if (ioCompletion) {
+        MosIORequest *rq = new MosIORequest();
+        rq->paramBlock = paramBlock;
+        rq->ioCompletion = ioCompletion;
+        rq->result = err;
+        gMosIOCompleted.push_back(rq);
+        gMosIOPending++;
+    }
+    return err;
+}
+
+
+/**
+ * Deliver the results of asynchronous file calls.
+ *
+ * This is called between two instructions while gMosIOPending is set.
+ * Completion routines run one at a time, and the next one is called after
+ * the previous one returned.
+ */
+void mosPollIO()
+{
+    if (gMosIO && gMosIO->ready)
+        mosFinishIO();
+    if (!gMosIOCompleted.empty()) {
+        MosIORequest *rq = gMosIOCompleted.front();
+        if (mosCallCompletion(rq->ioCompletion, rq->paramBlock, rq->result)) {
+            gMosIOCompleted.pop_front();
+            delete rq;
+            gMosIOPending--;
+        }
+    }
+}
+
+
+/**
+ * Write all buffered output of all files.
+ *
+ * This must be called before the app quits, and before the app waits for
+ * input, so that the user sees all prompts. We also wait for the I/O thread
+ * to finish all asynchronous and write-behind requests.
+ */
+void mosFlushAllFiles()
+{
+    for (MosFile *mosFile: mosFileRegistry) {
+        if (mosFile && mosFile->outSize)
+            mosFlushFile(mosFile);
+    }
+    if (gMosIOPending)
+        mosWaitForIO();
+}
+
+
+/**
+ * Add a file to the registry.
+ *
+ * Slots of closed files are reused, so reference numbers stay small.
+ *
+ * \return the reference number of the file
+ */
+static uint32_t mosAddFile(MosFile *mosFile)
+{
+    for (size_t ix=3; ix<mosFileRegistry.size(); ix++) {
+        if (!mosFileRegistry[ix]) {
+            mosFileRegistry[ix] = mosFile;
+            return (uint32_t)ix;
+        }
+    }
+    mosFileRegistry.push_back(mosFile);
+    return (uint32_t)(mosFileRegistry.size()-1);
+}
+
+
+/**
+ * Find an open file by its reference number.
+ *
+ * \param ix the reference number
+ * \param wait if set, wait for asynchronous calls on the file to finish
+ * \return nullptr if the reference number is not valid
+ */
+static MosFile *mosFindFile(uint32_t ix, bool wait=true)
+{
+    if (ix>=mosFileRegistry.size())
+        return nullptr;
+    MosFile *mosFile = mosFileRegistry[ix];
+    // asynchronous reads and writes must be done before the app uses the file again
+    if (wait && mosFile && mosFile->busy)
+        mosWaitForIO();
+    return mosFile;
+}
+
+
+/**
+ * Read UTF-8 text from a file and convert it to MacRoman.
+ *
+ * Data is read from the file in large blocks. Characters that are split
+ * between two blocks are kept in the buffer until the next block is read.
+ * We only wait for more data if nothing was decoded yet, so reading from a
+ * terminal returns after every line.
+ *
+ * \param mosFile read from this file
+ * \param dst write MacRoman text here
+ * \param size maximum number of bytes in dst
+ * \return number of bytes in dst, 0 at the end of the file, or -1 and errno
+ */
+static int mosReadUTF8AsMac(MosFile *mosFile, char *dst, unsigned int size)
+{
+    if (mosFile->map && mosCheckMap(mosFile)) {
+        if (mosFile->pos>=mosFile->mapSize)
+            return 0;
+        unsigned int used = 0;
+        unsigned int avail = mosFile->mapSize-mosFile->pos;
+        unsigned int n = mosUTF8ToMac(mosFile->map+mosFile->pos, avail, dst, size, used);
+        mosFile->pos += used;
+        if (n<size && used<avail) {
+            dst[n++] = '$'; // a partial character at the end of the file
+            mosFile->pos = mosFile->mapSize;
+        }
+        return (int)n;
+    }
+    if (!mosFile->inBuffer)
+        mosFile->inBuffer = (char*)malloc(kMosInBufferSize);
+    unsigned int n = 0;
+    bool eof = false;
+    while (n<size) {
+        unsigned int used = 0;
+        n += mosUTF8ToMac(mosFile->inBuffer+mosFile->inPos, mosFile->inSize-mosFile->inPos,
+                          dst+n, size-n, used);
+        mosFile->inPos += used;
+        unsigned int avail = mosFile->inSize-mosFile->inPos;
+        if (n==size)
+            break;
+        if (eof) {
+            if (avail>0) {
+                dst[n++] = '$'; // a partial character at the end of the file
+                mosFile->inPos = mosFile->inSize;
+            }
+            break;
+        }
+        if (n>0)
+            break;
+        // move the partial character to the start and read more data
+        memmove(mosFile->inBuffer, mosFile->inBuffer+mosFile->inPos, avail);
+        mosFile->inPos = 0;
+        mosFile->inSize = avail;
+        int ret = mosReadFile(mosFile, mosFile->inBuffer+avail, kMosInBufferSize-avail);
+        if (ret==-1) {
+            if (errno==EINTR) continue;
+            return -1;
+        }
+        if (ret==0)
+            eof = true;
+        mosFile->inSize += (unsigned int)ret;
+    }
+    return (int)n;
+}
+
+
+/**
+ * Close all files that the app left open.
+ *
+ * This is used between batch jobs, so that every job starts with only
+ * stdin, stdout, and stderr open.
+ */
+void mosCloseAppFiles()
+{
+    mosFlushAllFiles();
+    for (MosIORequest *rq: gMosIOCompleted)
+        delete rq;
+    gMosIOCompleted.clear();
+    gMosIOPending = 0;
+    for (size_t ix=3; ix<mosFileRegistry.size(); ix++) {
+        MosFile *mosFile = mosFileRegistry.at(ix);
+        if (mosFile && mosFile->allocated) {
+            mosCloseFile(mosFile);
+            mosReleaseFile(mosFile);
+        }
+    }
+    mosFileRegistry.resize(3);
+    gMosStatCache.clear();
+    // the next job may have other rules for stdin, stdout, and stderr
+    for (MosFile *mosFile: mosFileRegistry)
+        mosFile->filterChecked = false;
+}
+
+
+/**
+ * Check if the app has files open or file calls in flight.
+ *
+ * Snapshots can only be taken when it has not.
+ */
+bool mosAppFilesBusy()
+{
+    if (gMosIOPending || !gMosIOCompleted.empty())
+        return true;
+    for (size_t ix=0; ix<mosFileRegistry.size(); ix++) {
+        MosFile *mosFile = mosFileRegistry.at(ix);
+        if (mosFile && (mosFile->busy || mosFile->behind || (ix>=3 && mosFile->allocated)))
+            return true;
+    }
+    return false;
+}
+
+
+/**
+ * Forget what we know about stdin, stdout, and stderr.
+ *
+ * The server calls this when a job is done, because the next job brings
+ * its own streams. Output must have been flushed before.
+ */
+void mosResetStdFiles()
+{
+    for (MosFile *mosFile: mosFileRegistry) {
+        free(mosFile->outBuffer);
+        mosFile->outBuffer = NULL;
+        mosFile->outSize = 0;
+        mosFile->outChecked = false;
+        mosFile->inPos = mosFile->inSize = 0;
+        mosFile->filterChecked = false;
+    }
+}
+
 
 ///* 'd' => "directory" ops */
 //#define F_DELETE        (('d'<<8)|0x01)
@@ -95,24 +1145,30 @@ void trapSyFAccess(uint16_t) {
     unsigned int file = m68k_read_memory_32(sp+12);
     unsigned short flags = m68k_read_memory_16(file);
     mosTrace("Accessing file '%s', cmd=0x%08X, arg=0x%08X, flags=0x%04X\n", filename, cmd, file, flags);
+    char uxFilename[2048];
+    strcpy(uxFilename, mosFilenameConvertTo(filename, MOS_TYPE_UNIX));
+    mosWaitForWrites();
     if (cmd==0x00006401) { // Delete file
-        char *uxFilename = strdup(mosFilenameConvertTo(filename, MOS_TYPE_UNIX));
-        ::remove(uxFilename);
+        if (mosVfsContains(uxFilename))
+            mosVfsRemove(uxFilename);
+        else
+            ::remove(uxFilename);
+        mosForgetStat(uxFilename);
         m68k_set_reg(M68K_REG_D0, 0); // no error
-        free(uxFilename);
         return;
     } else if (cmd!=0x00006400) { // '..d.'
         mosError("trapSyFAccess: Unknown file access command 0x%08X\n", cmd);
         m68k_set_reg(M68K_REG_D0, EINVAL); // no error
         return;
     }
-    char *uxFilename = strdup(mosFilenameConvertTo(filename, MOS_TYPE_UNIX));
     // TODO: add our MosFile reference for internal data management
     // TODO: find the actual file and open it
     // open the file
     // TODO: what if the file is already open?
     // FIXME: do we need to convert the flags?
     int fd = -1;
+    MosFile *mosFile = nullptr;
+    struct stat st;
     unsigned short mode = ((flags&3)-1);  // convert O_RDRW, O_RDONLY and O_WRONLY
 	mode |= O_BINARY; // WIN32
     if ( flags & MOS_O_APPEND ) mode |= O_APPEND;
@@ -128,16 +1184,26 @@ void trapSyFAccess(uint16_t) {
     } else if ( flags & MOS_O_ALIAS ) {
         mosError("Open File %s: no alias support yet!\n", uxFilename);
         errno = 2;
+    } else if (mosVfsContains(uxFilename)) {
+        mosFile = mosOpenVfsFile(uxFilename, mode);
+    } else if ((mode&(O_CREAT|O_ACCMODE))==O_RDONLY && mosStat(uxFilename, &st)==-1) {
+        // we know already that the file does not exist
     } else {
+        if ((mode&O_TRUNC) && ::stat(uxFilename, &st)==0)
+            mosUnmapSameFile(st);
         fd = ::open(uxFilename, mode, 0644);
+        if ((mode&(O_CREAT|O_ACCMODE))!=O_RDONLY)
+            mosForgetStat(uxFilename);
+        if (fd!=-1) {
+            mosFile = mosNewFile(fd, strdup(uxFilename), true);
+            mosPrepareFile(mosFile, mode);
+        }
     }
-    if (fd==-1) { // error
+    if (!mosFile) { // error
         mosDebug("Can't open file %s (mode 0x%04X): %s\n", uxFilename, mode, strerror(errno));
         m68k_set_reg(M68K_REG_D0, errno); // just return the error code
-        free(uxFilename);
     } else {
-        m68k_write_memory_32(file+8, mosFileRegistry.size());
-        mosFileRegistry.push_back(new MosFile{fd, uxFilename, true, true});
+        m68k_write_memory_32(file+8, mosAddFile(mosFile));
         m68k_set_reg(M68K_REG_D0, 0); // no error
     }
 }
@@ -150,20 +1216,24 @@ void trapSyClose(uint16_t) {
     unsigned int sp = m68k_get_reg(0L, M68K_REG_SP);
     unsigned int file = m68k_read_memory_32(sp+4);
     uint32_t ix = m68k_read_memory_32(file+8);
-    MosFile *mosFile = mosFileRegistry.at(ix);
-    int ret = close(mosFile->fd);
+    MosFile *mosFile = mosFindFile(ix);
+    if (!mosFile) {
+        m68k_set_reg(M68K_REG_D0, EBADF);
+        return;
+    }
+    int ret = mosSyncFile(mosFile);
+    // stdin, stdout, and stderr belong to mosrun and stay open for the next batch job
+    if (mosFile->allocated && mosCloseFile(mosFile)==-1)
+        ret = -1;
     if (ret==-1) {
         m68k_set_reg(M68K_REG_D0, errno);
     } else {
         m68k_set_reg(M68K_REG_D0, 0);
     }
     if (mosFile->allocated) {
-        mosFileRegistry.at(ix) = nullptr;
+        mosFileRegistry[ix] = nullptr;
         m68k_write_memory_32(file+8, 0);
-        if (mosFile->filename) {
-            free((char*)mosFile->filename);
-        }
-        free(mosFile);
+        mosReleaseFile(mosFile);
     }
 }
 
@@ -176,40 +1246,27 @@ void trapSyRead(uint16_t) {
     unsigned int sp = m68k_get_reg(0L, M68K_REG_SP);
     unsigned int file = m68k_read_memory_32(sp+4);
     uint32_t ix = m68k_read_memory_32(file+8);
-    MosFile *mosFile = mosFileRegistry.at(ix);
+    MosFile *mosFile = mosFindFile(ix);
+    if (!mosFile) {
+        m68k_set_reg(M68K_REG_D0, EBADF);
+        return;
+    }
     void *buffer = mosToHost(m68k_read_memory_32(file+16));
     unsigned int size = m68k_read_memory_32(file+12);
-    int ret = 0;
-    if (allin_data_utf8_to_mac) {
-      // TODO: this is fishi because the file length is not calculated correctly
-      char ubuf[8];
-      unsigned int usize = 0;
-      unsigned int uindex = 0;
-      for (unsigned int i=0; i<size; i++) {
-        ret = (int)::read(mosFile->fd, ubuf, 1);
-        if (ret<1) break;
-        usize = 1;
-        int c = ubuf[0];
-        if ( (c&0xe0)==0xc0) {
-          ret = (int)::read(mosFile->fd, ubuf+1, 1);
-          if (ret<1) break;
-          usize = 2;
-        } else if ( (c&0xf0)==0xe0) {
-          ret = (int)::read(mosFile->fd, ubuf+1, 2);
-          if (ret<1) break;
-          usize = 3;
-        }
-        if (usize > 0) {
-          char *d = mosDataUnixToMac(ubuf, usize);
-          memcpy((char*)buffer+uindex, d, usize);
-          uindex += usize;
-        }
-      }
-      if (ret!=-1 && uindex>0)
-        ret = uindex;
-    } else {
-      ret = (int)::read(mosFile->fd, buffer, size);
-    }
+    mosMarkDirty(m68k_read_memory_32(file+16), size);
+    // show all pending output before we wait for the user, and make sure
+    // that we read what was written before
+    if (mosFile->fd==STDIN_FILENO)
+        mosFlushAllFiles();
+    else
+        mosSyncFile(mosFile);
+    if (!mosFile->filterChecked)
+        mosCheckFilter(mosFile);
+    int ret;
+    if (mosFile->convertIn)
+        ret = mosReadUTF8AsMac(mosFile, (char*)buffer, size);
+    else
+        ret = mosReadFile(mosFile, buffer, size);
     if (ret==-1) {
         m68k_set_reg(M68K_REG_D0, errno);
     } else {
@@ -226,21 +1283,21 @@ void trapSyWrite(uint16_t) {
     unsigned int sp = m68k_get_reg(0L, M68K_REG_SP);
     unsigned int file = m68k_read_memory_32(sp+4);
     uint32_t ix = m68k_read_memory_32(file+8);
-    MosFile *mosFile = mosFileRegistry.at(ix);
+    MosFile *mosFile = mosFindFile(ix);
+    if (!mosFile) {
+        m68k_set_reg(M68K_REG_D0, EBADF);
+        return;
+    }
     void *buffer = mosToHost(m68k_read_memory_32(file+16));
     unsigned int size = m68k_read_memory_32(file+12);
 
-    // convert buffer if it is not binary // FIXME: this needs a lot more work!
-    if (mosFile->fd==1) { // stdout
-        if (gFilterStdoutDataFrom==MOS_TYPE_MAC && gFilterStdoutDataTo==MOS_TYPE_UNIX)
-            buffer = (void*)mosDataMacToUnix((char*)buffer, size);
-    } else if (mosFile->fd==2) { // stderr
-        buffer = (void*)mosDataMacToUnix((char*)buffer, size);
-    } else if (allout_data_mac_to_utf8) {
-      buffer = (void*)mosDataMacToUnix((char*)buffer, size);
-    }
-
-    int ret = write(mosFile->fd, buffer, size);
+    if (!mosFile->filterChecked)
+        mosCheckFilter(mosFile);
+    int ret;
+    if (mosFile->convertOut)
+        ret = mosWriteMacAsUTF8(mosFile, (const char*)buffer, size);
+    else
+        ret = mosBufferedWrite(mosFile, buffer, size);
     if (ret==-1) {
         m68k_set_reg(M68K_REG_D0, errno);
     } else {
@@ -281,7 +1338,11 @@ void trapSyIoctl(uint16_t) {
     unsigned int cmd = m68k_read_memory_32(sp+8);
     unsigned int param = m68k_read_memory_32(sp+12);
     uint32_t ix = m68k_read_memory_32(file+8);
-    MosFile *mosFile = mosFileRegistry.at(ix);
+    MosFile *mosFile = mosFindFile(ix);
+    if (!mosFile) {
+        m68k_set_reg(M68K_REG_D0, EBADF);
+        return;
+    }
     mosTrace("IOCTL of file at 0x%08X, cmd=0x%04X = '%c'<<8+%d, param=%d (0x%08X)\n",
              file, cmd, (cmd>>8)&0xff, cmd&0xff, param, param);
     switch (cmd) {
@@ -298,7 +1359,10 @@ void trapSyIoctl(uint16_t) {
                 case MOS_SEEK_CUR: whence = SEEK_CUR; break;
                 case MOS_SEEK_END: whence = SEEK_END; break;
             }
-            int ret = (unsigned int)lseek(mosFile->fd, offset, whence);
+            // we need the real size of the file
+            if (whence==SEEK_END)
+                mosSyncFile(mosFile);
+            int ret = mosSeekFile(mosFile, (int)offset, whence);
             if (ret==-1) {
                 m68k_write_memory_32(param+4, -1);
                 m68k_set_reg(M68K_REG_D0, errno);
@@ -319,8 +1383,8 @@ void trapSyIoctl(uint16_t) {
             break;
         case 0x6603: // FIOBUFSIZE, Return optimal buffer size (MPW buffers 1024 bytes)
             if (param)
-                m68k_write_memory_16(param+2, 1024); // random value
-            m68k_set_reg(M68K_REG_D0, 1024); // no error
+                m68k_write_memory_16(param+2, gMosFioBufSize); // set with ---fiobufsize
+            m68k_set_reg(M68K_REG_D0, gMosFioBufSize); // no error
             break;
         case 0x6604: // FIOFNAME, Return filename
         case 0x6605: // FIOREFNUM, Return fs refnum
@@ -339,9 +1403,10 @@ void trapSyIoctl(uint16_t) {
  \param paramBlock more information for this call
  \return Classic error code
  */
-int mosPBGetFInfo(mosPtr paramBlock, bool)
+int mosPBGetFInfo(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBGetFInfo called\n");
+    mosWaitForWrites();
 
     //mosPtr ioCompletion = m68k_read_memory_32(paramBlock+12);
     mosPtr ioNamePtr = m68k_read_memory_32(paramBlock+18);
@@ -352,15 +1417,13 @@ int mosPBGetFInfo(mosPtr paramBlock, bool)
     // do we have a file name
     if (!ioNamePtr) {
         mosDebug("mosPBGetFInfo: no file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     unsigned int fnLen = m68k_read_memory_8(ioNamePtr);
     if (fnLen==0) {
         mosDebug("mosPBGetFInfo: zero length file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     char cFilename[2048];
@@ -369,11 +1432,10 @@ int mosPBGetFInfo(mosPtr paramBlock, bool)
     mosDebug("mosPBGetFInfo: get info for '%s'\n", cFilename);
 
     struct stat st;
-    int ret = stat(cFilename, &st);
+    int ret = mosStat(cFilename, &st);
     if (ret==-1) {
         mosDebug("mosPBGetFInfo: can't get status, return 'file not found'\n");
-        m68k_write_memory_16(paramBlock+16, mosFnfErr);
-        return mosFnfErr; // TODO: we could differentiate here a lot more!
+        return mosPBReturn(paramBlock, async, mosFnfErr); // TODO: we could differentiate here a lot more!
     }
 
     // FIXME: ioDirIndex must be 0 or less!
@@ -413,8 +1475,7 @@ int mosPBGetFInfo(mosPtr paramBlock, bool)
 	m68k_write_memory_32(paramBlock + 76, st.st_mtimespec.tv_sec + 2082844800);
 #endif
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 
@@ -424,50 +1485,61 @@ int mosPBGetFInfo(mosPtr paramBlock, bool)
  \param paramBlock more information for this call
  \return Classic error code
  */
-int mosPBSetFInfo(mosPtr paramBlock, bool)
+int mosPBSetFInfo(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBSetFInfo called\n");
     // FIXME: what can the user set here?
     // "the application should call PBSetFInfo (after PBCreate) to fill in the information needed by the Finder"
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 /**
  Classic Trap subfunction to set the size of a file.
 
  \param paramBlock more information for this call
- * +24.s ioRef, Unix file descriptor // FIXME: which may not fit into 16 bits!
+ * +24.s ioRef, file reference number
  * +28.l requested size of file
  * +16.s [out] more error information
  \return Classic error code
  */
-int mosPBSetEOF(mosPtr paramBlock, bool)
+int mosPBSetEOF(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBSetEOF called\n");
     int ioRefNum = m68k_read_memory_16(paramBlock+24);
     uint32_t ioMisc = m68k_read_memory_32(paramBlock+28);
+    MosFile *mosFile = mosFindFile(ioRefNum);
+    if (!mosFile) {
+        mosDebug("mosPBSetEOF: invalid reference number %d\n", ioRefNum);
+        return mosPBReturn(paramBlock, async, mosRfNumErr);
+    }
+    mosSyncFile(mosFile);
 
+    int ret = 0;
+    struct stat st;
+    if (!mosFile->vfs && fstat(mosFile->fd, &st)==0 && (off_t)ioMisc<st.st_size)
+        mosUnmapSameFile(st);
+    if (mosFile->vfs)
+        mosVfsTruncate(mosFile->vfs, ioMisc);
+    else
 #ifdef WIN32
-	int ret = _chsize(ioRefNum, ioMisc);
+	ret = _chsize(mosFile->fd, ioMisc);
 #else
-    int ret = ftruncate(ioRefNum, ioMisc);
+    ret = ftruncate(mosFile->fd, ioMisc);
 #endif
+    mosForgetStat(mosFile->filename);
     if (ret==-1) {
         mosDebug("mosPBSetEOF %d %d failed: %s\n", ioRefNum, ioMisc, strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosFnfErr);
-        return mosFnfErr; // TODO: get more detailed here?
+        return mosPBReturn(paramBlock, async, mosFnfErr); // TODO: get more detailed here?
     }
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 /**
  Classic Trap subfunction to seek a position within a file.
 
  \param paramBlock more information for this call
- * +24.s ioRef, Unix file descriptor // FIXME: which may not fit into 16 bits!
+ * +24.s ioRef, file reference number
  * +44.s position mode as in lseek()
  * +46.l offset into file
  * +40.l [out] return code
@@ -475,37 +1547,38 @@ int mosPBSetEOF(mosPtr paramBlock, bool)
  * +16.s [out] more error information
  \return Classic error code
  */
-int mosPBSetFPos(mosPtr paramBlock, bool)
+int mosPBSetFPos(mosPtr paramBlock, bool async)
 {
     int ioRefNum = m68k_read_memory_16(paramBlock+24);
     uint16_t ioPosMode = m68k_read_memory_16(paramBlock+44);
     uint32_t ioPosOffset = m68k_read_memory_32(paramBlock+46); // FIXME: this should probably be signed
     mosDebug("mosPBSetFPos called: RefNum=%d, PosMode=%d, PosOffset=%d\n",
              ioRefNum, ioPosMode, ioPosOffset);
-
-    int ret = 0;
-    switch (ioPosMode) {
-        case 0: break; // fsAtMark
-        case 1: ret = (int)lseek(ioRefNum, ioPosOffset, SEEK_SET); break; // fsFromStart
-        case 2: ret = (int)lseek(ioRefNum, ioPosOffset, SEEK_END); break; // fsFromLEOF
-        case 3: ret = (int)lseek(ioRefNum, ioPosOffset, SEEK_CUR); break; // fsFromMark
+    MosFile *mosFile = mosFindFile(ioRefNum);
+    if (!mosFile) {
+        mosDebug("mosPBSetFPos: invalid reference number %d\n", ioRefNum);
+        return mosPBReturn(paramBlock, async, mosRfNumErr);
     }
+    // we need the real size of the file
+    if (ioPosMode==2)
+        mosSyncFile(mosFile);
+
+    int ret = mosPBSeek(mosFile, ioPosMode, ioPosOffset);
     // FIXME: is the position we found not written back?
     if (ret==-1) {
         mosDebug("mosPBSetFPos failed: %s\n", strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosEofErr);
-        return mosEofErr; // TODO: get more detailed here?
+        return mosPBReturn(paramBlock, async, mosEofErr); // TODO: get more detailed here?
     }
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 /**
  Classic Trap subfunction to read bytes from a file.
 
  \param paramBlock more information for this call
- * +24.s ioRef, Unix file descriptor // FIXME: which may not fit into 16 bits! See: getdtablesize
+ * +12.l for async calls, call this when complete
+ * +24.s ioRef, file reference number
  * +32.l pointer to bytes to be read
  * +36.l number of bytes to read
  * +44.s position mode as in lseek()
@@ -515,7 +1588,7 @@ int mosPBSetFPos(mosPtr paramBlock, bool)
  * +16.s [out] more error information
  \return Classic error code
  */
-int mosPBRead(mosPtr paramBlock, bool)
+int mosPBRead(mosPtr paramBlock, bool async)
 {
     int ioRefNum = m68k_read_memory_16(paramBlock+24);
     mosPtr ioBuffer = m68k_read_memory_32(paramBlock+32);
@@ -525,30 +1598,35 @@ int mosPBRead(mosPtr paramBlock, bool)
     mosDebug("mosPBRead called: RefNum=%d, Buffer=0x%08X, ReqCount=%d, POsMode=%d, PosOffset=%d\n",
              ioRefNum, ioBuffer, ioReqCount, ioPosMode, ioPosOffset);
 
-    switch (ioPosMode) {
-        case 0: break;
-        case 1: lseek(ioRefNum, ioPosOffset, SEEK_SET); break;
-        case 2: lseek(ioRefNum, ioPosOffset, SEEK_END); break;
-        case 3: lseek(ioRefNum, ioPosOffset, SEEK_CUR); break;
+    MosFile *mosFile = mosFindFile(ioRefNum, false);
+    if (!mosFile) {
+        mosDebug("mosPBRead: invalid reference number %d\n", ioRefNum);
+        return mosPBReturn(paramBlock, async, mosRfNumErr);
     }
-    int ret = read(ioRefNum, mosToHost(ioBuffer), ioReqCount);
-    m68k_write_memory_32(paramBlock+46, (unsigned int)lseek(ioRefNum, 0, SEEK_CUR));
+    // only regular files go to the I/O thread, all others are done right away
+    if (async && mosFile->positioned)
+        return mosQueueIO(paramBlock, mosFile, false, ioBuffer, ioReqCount, ioPosMode, ioPosOffset);
+    mosSyncFile(mosFile);
+
+    mosPBSeek(mosFile, ioPosMode, ioPosOffset);
+    mosMarkDirty(ioBuffer, ioReqCount);
+    int ret = mosReadFile(mosFile, mosToHost(ioBuffer), ioReqCount);
+    m68k_write_memory_32(paramBlock+46, mosTellFile(mosFile));
     if (ret==-1) {
         mosDebug("mosPBRead failed: %s\n", strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosFnfErr);
-        return mosFnfErr; // TODO: get more detailed here?
+        return mosPBReturn(paramBlock, async, mosFnfErr); // TODO: get more detailed here?
     }
 
     m68k_write_memory_32(paramBlock+40, ret);
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 /**
  Classic Trap subfunction to write bytes to a file.
 
  \param paramBlock more information for this call
- * +24.s ioRef, Unix file descriptor // FIXME: which may not fit into 16 bits!
+ * +12.l for async calls, call this when complete
+ * +24.s ioRef, file reference number
  * +32.l pointer to bytes to be written
  * +36.l number of bytes to write
  * +44.s position mode as in lseek()
@@ -558,7 +1636,7 @@ int mosPBRead(mosPtr paramBlock, bool)
  * +16.s [out] more error information
  \return Classic error code
  */
-int mosPBWrite(mosPtr paramBlock, bool)
+int mosPBWrite(mosPtr paramBlock, bool async)
 {
     int ioRefNum = m68k_read_memory_16(paramBlock+24);
     mosPtr ioBuffer = m68k_read_memory_32(paramBlock+32);
@@ -568,23 +1646,29 @@ int mosPBWrite(mosPtr paramBlock, bool)
     mosDebug("mosPBWrite called: RefNum=%d, Buffer=0x%08X, ReqCount=%d, POsMode=%d, PosOffset=%d\n",
              ioRefNum, ioBuffer, ioReqCount, ioPosMode, ioPosOffset);
 
-    switch (ioPosMode) {
-        case 0: break;
-        case 1: lseek(ioRefNum, ioPosOffset, SEEK_SET); break;
-        case 2: lseek(ioRefNum, ioPosOffset, SEEK_END); break;
-        case 3: lseek(ioRefNum, ioPosOffset, SEEK_CUR); break;
+    MosFile *mosFile = mosFindFile(ioRefNum, false);
+    if (!mosFile) {
+        mosDebug("mosPBWrite: invalid reference number %d\n", ioRefNum);
+        return mosPBReturn(paramBlock, async, mosRfNumErr);
     }
-    int ret = write(ioRefNum, mosToHost(ioBuffer), ioReqCount);
-    m68k_write_memory_32(paramBlock+46, (uint32_t)lseek(ioRefNum, 0, SEEK_CUR));
+    // only regular files go to the I/O thread, all others are done right away
+    if (async && mosFile->positioned)
+        return mosQueueIO(paramBlock, mosFile, true, ioBuffer, ioReqCount, ioPosMode, ioPosOffset);
+    if (ioPosMode==2) // we need the real size of the file
+        mosSyncFile(mosFile);
+    else if (mosFile->busy)
+        mosWaitForIO();
+
+    mosPBSeek(mosFile, ioPosMode, ioPosOffset);
+    int ret = mosWriteFile(mosFile, mosToHost(ioBuffer), ioReqCount);
+    m68k_write_memory_32(paramBlock+46, mosTellFile(mosFile));
     if (ret==-1) {
         mosDebug("mosPBWrite failed: %s\n", strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosFnfErr);
-        return mosFnfErr; // TODO: get more detailed here?
+        return mosPBReturn(paramBlock, async, mosFnfErr); // TODO: get more detailed here?
     }
 
     m68k_write_memory_32(paramBlock+40, ret);
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 
@@ -592,24 +1676,34 @@ int mosPBWrite(mosPtr paramBlock, bool)
  Classic Trap subfunction to close a file on disk.
 
  \param paramBlock more information for this call
- * +24.s ioRef, Unix file descriptor // FIXME: which may not fit into 16 bits!
+ * +24.s ioRef, file reference number
  * +16.s [out] more error codes
  \return Classic error code
  */
-int mosPBClose(mosPtr paramBlock, bool)
+int mosPBClose(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBClose called\n");
     int ioRefNum = m68k_read_memory_16(paramBlock+24);
+    MosFile *mosFile = mosFindFile(ioRefNum);
+    if (!mosFile) {
+        mosDebug("mosPBClose: invalid reference number %d\n", ioRefNum);
+        return mosPBReturn(paramBlock, async, mosRfNumErr);
+    }
 
-    int ret = close(ioRefNum);
+    int ret = mosSyncFile(mosFile);
+    // stdin, stdout, and stderr belong to mosrun and stay open
+    if (mosFile->allocated) {
+        if (mosCloseFile(mosFile)==-1)
+            ret = -1;
+        mosFileRegistry[ioRefNum] = nullptr;
+        mosReleaseFile(mosFile);
+    }
     if (ret==-1) {
         mosDebug("mosPBClose failed: %s\n", strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosFnfErr);
-        return mosFnfErr; // TODO: get more detailed here?
+        return mosPBReturn(paramBlock, async, mosFnfErr); // TODO: get more detailed here?
     }
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr; // .. and check which fields are read
+    return mosPBReturn(paramBlock, async, mosNoErr); // .. and check which fields are read
 }
 
 /**
@@ -618,16 +1712,17 @@ int mosPBClose(mosPtr paramBlock, bool)
  This does not keep the file open!
 
  \param paramBlock more information for this call
- * +12.w for async calls, call this when complete (not supported)
+ * +12.l for async calls, call this when complete
  * +18.w pointer to PStr filename of file to be deleted
  * +22.s VRef (not supported)
  * +26.b FVers (not supported)
  * +16.s [out] more error codes
  \return Classic error code
  */
-int mosPBCreate(mosPtr paramBlock, bool)
+int mosPBCreate(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBCreate called\n");
+    mosWaitForWrites();
 
     //mosPtr ioCompletion = m68k_read_memory_32(paramBlock+12);
     mosPtr ioNamePtr = m68k_read_memory_32(paramBlock+18);
@@ -637,15 +1732,13 @@ int mosPBCreate(mosPtr paramBlock, bool)
     // do we have a file name
     if (!ioNamePtr) {
         mosDebug("mosPBCreate: no file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     uint8_t fnLen = m68k_read_memory_8(ioNamePtr);
     if (fnLen==0) {
         mosDebug("mosPBCreate: zero length file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     char cFilename[1024];
@@ -653,32 +1746,35 @@ int mosPBCreate(mosPtr paramBlock, bool)
     cFilename[fnLen] = 0;
     mosDebug("mosPBCreate: create file '%s'\n", cFilename);
 
+    if (mosVfsContains(cFilename)) {
+        mosVfsOpen(cFilename, O_CREAT|O_WRONLY);
+        return mosPBReturn(paramBlock, async, mosNoErr);
+    }
     int ret = open(cFilename, O_CREAT|O_WRONLY, 0644);
+    mosForgetStat(cFilename);
     if (ret==-1) {
         mosDebug("mosPBCreate: can't create file\n");
-        m68k_write_memory_16(paramBlock+16, mosDupFNErr);
-        return mosDupFNErr; // TODO: we could differentiate here a lot more!
+        return mosPBReturn(paramBlock, async, mosDupFNErr); // TODO: we could differentiate here a lot more!
     }
     close(ret);
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr;
+    return mosPBReturn(paramBlock, async, mosNoErr);
 }
 
 /**
  Classic Trap subfunction to open a file on disk.
 
  \param paramBlock more information for this call
- * +12.w for async calls, call this when complete (not supported)
+ * +12.l for async calls, call this when complete
  * +18.w pointer to PStr filename of file to be deleted
  * +22.s VRef (not supported)
  * +26.b FVers (not supported)
  * +27.b mode
  * +16.s [out] more error codes
- * +24.s [out] file descriptor   FIXME: Unix file descriptor may not fit into 16 bit!
+ * +24.s [out] file reference number
  \return Classic error code
  */
-int mosPBHOpen(mosPtr paramBlock, bool)
+int mosPBHOpen(mosPtr paramBlock, bool async)
 {
     /*
     QElemPtr qLink; // 0
@@ -693,6 +1789,7 @@ struct IOParam { ...
 struct FileParam { ...
      */
     mosDebug("mosPBHOpen called\n");
+    mosWaitForWrites();
 
     //mosPtr ioCompletion = m68k_read_memory_32(paramBlock+12);
     mosPtr ioNamePtr = m68k_read_memory_32(paramBlock+18);
@@ -702,15 +1799,13 @@ struct FileParam { ...
     // do we have a file name
     if (!ioNamePtr) {
         mosDebug("mosPBHOpen: no file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     uint8_t fnLen = m68k_read_memory_8(ioNamePtr);
     if (fnLen==0) {
         mosDebug("mosPBHOpen: zero length file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     char cFilename[1024];
@@ -720,6 +1815,15 @@ struct FileParam { ...
 
     int file = -1;
     uint8_t mode = m68k_read_memory_8(paramBlock+27); // ioPermssn
+    if (mosVfsContains(cFilename)) {
+        MosFile *mosFile = mosOpenVfsFile(cFilename, (mode==1) ? O_RDONLY : O_RDWR);
+        if (!mosFile) {
+            mosDebug("mosPBHOpen: can't open file '%s', %s\n", cFilename, strerror(errno));
+            return mosPBReturn(paramBlock, async, mosFnfErr);
+        }
+        m68k_write_memory_16(paramBlock+24, mosAddFile(mosFile)); // ioRefNum
+        return mosPBReturn(paramBlock, async, mosNoErr);
+    }
     switch (mode) {
         case 1: file = open(cFilename, O_RDONLY); break;  // fsRdPerm = 1
         case 2: file = open(cFilename, O_WRONLY); break;  // fsWrPern = 2
@@ -729,12 +1833,12 @@ struct FileParam { ...
     mosDebug("mosPBHOpen: open file '%s' mode=%d => %d\n", cFilename, mode, file);
     if (file==-1) {
         mosError("mosPBHOpen: can't open file '%s', %s\n", cFilename, strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosDupFNErr);
-        return mosDupFNErr; // TODO: we could differentiate here a lot more!
+        return mosPBReturn(paramBlock, async, mosDupFNErr); // TODO: we could differentiate here a lot more!
     }
-    m68k_write_memory_16(paramBlock+24, file); // FIXME: it's not guaranteed that 'file' will fit into 16 bits! ioRefNum
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr;
+    MosFile *mosFile = mosNewFile(file, strdup(cFilename), true);
+    mosPrepareFile(mosFile, (mode==1) ? O_RDONLY : O_RDWR);
+    m68k_write_memory_16(paramBlock+24, mosAddFile(mosFile)); // ioRefNum
+    return mosPBReturn(paramBlock, async, mosNoErr);
 }
 
 
@@ -742,16 +1846,17 @@ struct FileParam { ...
  Classic Trap subfunction to delete a file from disk.
 
  \param paramBlock more information for this call
-    * +12.w for async calls, call this when complete (not supported)
+    * +12.l for async calls, call this when complete
     * +18.w pointer to PStr filename of file to be deleted
     * +22.s VRef (not supported)
     * +26.b FVers (not supported)
     * +16.s [out] more error codes
  \return Classic error code
  */
-int mosPBDelete(mosPtr paramBlock, bool)
+int mosPBDelete(mosPtr paramBlock, bool async)
 {
     mosDebug("mosPBDelete called\n");
+    mosWaitForWrites();
 
     //mosPtr ioCompletion = m68k_read_memory_32(paramBlock+12);
     mosPtr ioNamePtr = m68k_read_memory_32(paramBlock+18);
@@ -761,15 +1866,13 @@ int mosPBDelete(mosPtr paramBlock, bool)
     // do we have a file name
     if (!ioNamePtr) {
         mosDebug("mosPBDelete: no file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     uint8_t fnLen = m68k_read_memory_8(ioNamePtr);
     if (fnLen==0) {
         mosDebug("mosPBDelete: zero length file name\n");
-        m68k_write_memory_16(paramBlock+16, mosBdNamErr);
-        return mosBdNamErr;
+        return mosPBReturn(paramBlock, async, mosBdNamErr);
     }
 
     char cFilename[1024];
@@ -777,15 +1880,18 @@ int mosPBDelete(mosPtr paramBlock, bool)
     cFilename[fnLen] = 0;
 
     mosDebug("mosPBDelete: deleteing file '%s'\n", cFilename);
-    int ret = ::remove(cFilename);
+    int ret;
+    if (mosVfsContains(cFilename))
+        ret = mosVfsRemove(cFilename);
+    else
+        ret = ::remove(cFilename);
+    mosForgetStat(cFilename);
     if (ret==-1) {
         mosError("mosPBDelete: can't remove file '%s', %s\n", cFilename, strerror(errno));
-        m68k_write_memory_16(paramBlock+16, mosDupFNErr);
-        return mosDupFNErr; // TODO: we could differentiate here a lot more!
+        return mosPBReturn(paramBlock, async, mosDupFNErr); // TODO: we could differentiate here a lot more!
     }
 
-    m68k_write_memory_16(paramBlock+16, mosNoErr);
-    return mosNoErr;
+    return mosPBReturn(paramBlock, async, mosNoErr);
 }
 
 
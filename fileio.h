@@ -24,6 +24,7 @@
 #define __mosrun__fileio__
 
 #include "main.h"
+#include "vfs.h"
 
 
 // FIXME: MosFile must be a mos object
@@ -33,10 +34,29 @@ typedef struct
     const char *filename;
     bool open;
     bool allocated;
+    char *outBuffer;    // data written by the app and not yet written to fd
+    unsigned int outSize;
+    bool outChecked;    // set when we decided if output to fd is buffered
+    bool filterChecked; // set when we decided how the data is converted
+    bool convertIn;     // convert UTF-8 input to MacRoman
+    bool convertOut;    // convert MacRoman output to UTF-8
+    char *inBuffer;     // UTF-8 data that was read from fd, but not decoded yet
+    unsigned int inPos, inSize;
+    const char *map;    // read-only files are mapped into host memory
+    unsigned int mapSize;
+    unsigned int pos;   // file mark of mapped and positioned files, including buffered output
+    bool positioned;    // set if we read and write at pos with pread() and pwrite()
+    MosVfsNodeRef vfs;  // files in the in-memory file system have no fd
+    unsigned int busy;  // number of asynchronous reads and writes in flight
+    unsigned int behind;// number of writes that the I/O thread did not do yet
+    int writeErr;       // errno of a write that failed in the I/O thread
 } MosFile;
 
 
 extern MosFile stdFiles[];
+extern unsigned int gMosFioBufSize;
+extern unsigned int gMosIOPending;
+extern bool gMosWriteBehind;
 
 
 void trapSyFAccess(uint16_t);
@@ -57,4 +77,10 @@ int mosPBHOpen(mosPtr paramBlock, bool async);
 int mosPBDelete(mosPtr paramBlock, bool async);
 int mosFSDispatch(mosPtr paramBlock, uint32_t func);
 
+void mosCloseAppFiles();
+void mosResetStdFiles();
+bool mosAppFilesBusy();
+void mosFlushAllFiles();
+void mosPollIO();
+
 #endif /* defined(__mosrun__fileio__) */
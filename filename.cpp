@@ -48,9 +48,22 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+# define MOS_USE_SSE2 1
+# include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+# define MOS_USE_AVX2 1
+# include <immintrin.h>
+#endif
 
 
-// TODO: not yet used. 
 static const unsigned short ucLUT[] = {
     0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1,
     0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
@@ -70,10 +83,43 @@ static const unsigned short ucLUT[] = {
     0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7,
 };
 
+// MacRoman character for every Unicode character in ucLUT, 0 for all others
+static byte macLUT[0x10000];
+
+// UTF-8 sequence for every MacRoman character, '\r' becomes '\n'
+static struct { byte len; byte c[3]; } utf8LUT[256];
+
+// fill the lookup tables above when mosrun starts
+static struct LUTInit {
+    LUTInit() {
+        for (int i=0; i<128; i++) {
+            utf8LUT[i].len = 1;
+            utf8LUT[i].c[0] = (i=='\r') ? '\n' : i;
+        }
+        for (int i=128; i<256; i++) {
+            unsigned short uc = ucLUT[i-128];
+            macLUT[uc] = i;
+            if (uc<0x0800) {
+                utf8LUT[i].len = 2;
+                utf8LUT[i].c[0] = ((uc>>6) & 0x1f) | 0xc0;
+                utf8LUT[i].c[1] = (uc & 0x3f) | 0x80;
+            } else {
+                utf8LUT[i].len = 3;
+                utf8LUT[i].c[0] = ((uc>>12) & 0x0f) | 0xe0;
+                utf8LUT[i].c[1] = ((uc>>6) & 0x3f) | 0x80;
+                utf8LUT[i].c[2] = (uc & 0x3f) | 0x80;
+            }
+        }
+    }
+} gLUTInit;
+
 
 static char *buffer = 0;
 static int NBuffer = 0;
 
+// number of file names that mosFilenameConvertTo remembers
+static const size_t kMosFilenameCacheSize = 4096;
+
 
 /**
  * Make sure that at least size bytes fit into the buffer.
@@ -90,115 +136,199 @@ static void allocateBuffer(int size)
 
 
 /**
- * Convert a text block in Unix/UTF-8 encoding to MacRoman.
+ * Copy a run of ASCII text, replacing one line ending with another.
  *
- * This will fail if there is a partial UTF-8 character at the end of the 
- * text block!
+ * Text is copied in blocks. Copying stops at the first block that contains
+ * a non-ASCII character, so the caller must convert the remaining
+ * characters one by one until the next run of ASCII text.
  *
- * \return pointer to a static buffer
+ * \return number of bytes copied
  */
-char *mosDataUnixToMac(const char *text, unsigned int &size)
+static unsigned int copyASCII(const byte *s, byte *d, unsigned int n, byte from, byte to)
 {
-    // The Mac string can nevr be longer than the Unix string
-    const char *s = text;
-    unsigned int i, count = size;
-    // now we have the size. Make sure we have space
-    allocateBuffer(count+1);
-    // copy and convert characters
-    byte *d = (byte*)buffer;
-    for (i=0;i<size;i++) {
-        byte c = (byte)*s++;
-        if (c=='\n') {
-            *d++ = '\r';
-        } else if (c<128) {
-            *d++ = c;
-        } else {
-            // UTF8 character
-            unsigned short uc = 0;
-            if ( (c&0xe0)==0xc0) {
-                uc =  ((((unsigned short)c)&0x1f)<<6);
-                uc |=  (((unsigned short)(byte)s[0])&0x3f);
-                s++; size--;
-            } else if ( (c&0xf0)==0xe0) {
-                uc =  ((((unsigned short)c)&0x1f)<<12);
-                uc |= ((((unsigned short)(byte)s[0])&0x3f)<<6);
-                uc |=  (((unsigned short)(byte)s[1])&0x3f);
-                s+=2; size-=2;
-            }
-            if (uc) {
-                int j;
-                for (j=0; j<128; j++) {
-                    if (ucLUT[j]==uc) {
-                        *d++ = j+128;
-                        break;
-                    }
-                }
-                if (j==128)
-                    *d++ = '$';
-            } else {
-                *d++ = '$';
-            }
+    unsigned int i = 0;
+#ifdef MOS_USE_AVX2
+    const __m256i from32 = _mm256_set1_epi8((char)from);
+    const __m256i to32 = _mm256_set1_epi8((char)to);
+    for ( ; i+32<=n; i+=32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(s+i));
+        if (_mm256_movemask_epi8(v))
+            return i;
+        __m256i eol = _mm256_cmpeq_epi8(v, from32);
+        _mm256_storeu_si256((__m256i*)(d+i), _mm256_blendv_epi8(v, to32, eol));
+    }
+#endif
+#ifdef MOS_USE_SSE2
+    const __m128i from16 = _mm_set1_epi8((char)from);
+    const __m128i to16 = _mm_set1_epi8((char)to);
+    for ( ; i+16<=n; i+=16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s+i));
+        if (_mm_movemask_epi8(v))
+            return i;
+        __m128i eol = _mm_cmpeq_epi8(v, from16);
+        v = _mm_or_si128(_mm_andnot_si128(eol, v), _mm_and_si128(eol, to16));
+        _mm_storeu_si128((__m128i*)(d+i), v);
+    }
+#else
+    for ( ; i+8<=n; i+=8) {
+        uint64_t v;
+        memcpy(&v, s+i, 8);
+        if (v & 0x8080808080808080ULL)
+            return i;
+        for (int j=0; j<8; j++) {
+            byte c = s[i+j];
+            d[i+j] = (c==from) ? to : c;
         }
     }
-    *d = 0;
-    size = ((char*)d)-buffer;
-    return buffer;
+#endif
+    return i;
 }
 
 
+/**
+ * Convert a single Unix/UTF-8 character to MacRoman.
+ *
+ * Characters that do not exist in MacRoman are replaced with a '$'.
+ *
+ * \param src UTF-8 text
+ * \param n number of bytes available in src
+ * \param dst write the MacRoman character here
+ * \return number of bytes used from src, or 0 if src ends in the middle of
+ *         the character
+ */
+int mosUTF8CharToMac(const char *src, unsigned int n, char *dst)
+{
+    byte c = (byte)src[0];
+    if (c=='\n') {
+        *dst = '\r';
+        return 1;
+    } else if (c<128) {
+        *dst = c;
+        return 1;
+    }
+    unsigned int len = 1;
+    unsigned int uc = 0;
+    if ((c&0xe0)==0xc0) {
+        len = 2; uc = c&0x1f;
+    } else if ((c&0xf0)==0xe0) {
+        len = 3; uc = c&0x0f;
+    } else if ((c&0xf8)==0xf0) {
+        len = 4; uc = c&0x07;
+    }
+    if (n<len)
+        return 0;
+    for (unsigned int i=1; i<len; i++)
+        uc = (uc<<6) | (((byte)src[i])&0x3f);
+    byte mac = (len>1 && uc<0x10000) ? macLUT[uc] : 0;
+    *dst = mac ? mac : '$';
+    return (int)len;
+}
+
 
 /**
- * Convert a text block in MacRoman encoding to Unix/UTF-8.
+ * Convert Unix/UTF-8 text to MacRoman until either side is used up.
  *
- * \return pointer to a static buffer
+ * A partial UTF-8 character at the end of src is not converted.
+ *
+ * \param src UTF-8 text
+ * \param srcSize number of bytes in src
+ * \param dst write MacRoman text here
+ * \param dstSize maximum number of bytes in dst
+ * \param[out] srcUsed number of bytes used from src
+ * \return number of bytes written to dst
  */
-char *mosDataMacToUnix(const char *text, unsigned int &size)
+unsigned int mosUTF8ToMac(const char *src, unsigned int srcSize,
+                          char *dst, unsigned int dstSize, unsigned int &srcUsed)
 {
-    // the Unix string is potentialy longer than the Mac string, so start counting
-    const char *s = text;
-    unsigned int i, count = 0;
-    for (i=0;i<size;i++) {
-        byte c = (byte)*s++;
-        if (c<128) {
-            count++;
-        } else {
-            unsigned short uc = ucLUT[c-128];
-            if (uc<128) {
-                count++;
-            } else if (uc<0x07ff) {
-                count+=2;
-            } else if (uc<0x07ff) {
-                count+=3;
+    const byte *s = (const byte*)src;
+    byte *d = (byte*)dst;
+    unsigned int i = 0, n = 0;
+    while (i<srcSize && n<dstSize) {
+        unsigned int run = srcSize-i;
+        if (dstSize-n<run) run = dstSize-n;
+        run = copyASCII(s+i, d+n, run, '\n', '\r');
+        i += run; n += run;
+        // convert the next block one character at a time
+        unsigned int end = (srcSize-i>16) ? i+16 : srcSize;
+        while (i<end && n<dstSize) {
+            int used = mosUTF8CharToMac(src+i, srcSize-i, dst+n);
+            if (used==0) {
+                srcUsed = i;
+                return n;
             }
+            i += used; n++;
         }
     }
-    // now we have the size. Make sure we have space
-    allocateBuffer(count+1);
-    // copy and convert characters
-    byte *d = (byte*)buffer;
-    s = text;
-    for (i=0;i<size;i++) {
-        byte c = (byte)*s++;
-        if (c=='\r') {
-            *d++ = '\n';
-        } else if (c<128) {
-            *d++ = c;
-        } else {
-            unsigned short uc = ucLUT[c-128];
-            if (uc<128) {
-                *d++ = uc;
-            } else if (uc<0x07ff) {
-                *d++ = ((uc>>6) & 0x1f) | 0xc0;
-                *d++ = (uc & 0x3f) | 0x80;
-            } else if (uc<0x07ff) {
-                *d++ = ((uc>>12) & 0x0f) | 0xe0;
-                *d++ = ((uc>>6) & 0x3f) | 0x80;
-                *d++ = (uc & 0x3f) | 0x80;
-            }
+    srcUsed = i;
+    return n;
+}
+
+
+/**
+ * Convert a text block in Unix/UTF-8 encoding to MacRoman.
+ *
+ * A partial UTF-8 character at the end of the text block is replaced
+ * with a '$'.
+ *
+ * \return pointer to a static buffer
+ */
+char *mosDataUnixToMac(const char *text, unsigned int &size)
+{
+    // The Mac string can never be longer than the Unix string
+    allocateBuffer(size+1);
+    unsigned int used = 0;
+    unsigned int n = mosUTF8ToMac(text, size, buffer, size, used);
+    if (used<size)
+        buffer[n++] = '$';
+    buffer[n] = 0;
+    size = n;
+    return buffer;
+}
+
+
+
+/**
+ * Convert MacRoman text to Unix/UTF-8.
+ *
+ * \param src MacRoman text
+ * \param size number of bytes in src
+ * \param dst write UTF-8 text here, must have room for 3*size bytes
+ * \return number of bytes written to dst
+ */
+unsigned int mosMacToUTF8(const char *src, unsigned int size, char *dst)
+{
+    const byte *s = (const byte*)src;
+    byte *d = (byte*)dst;
+    unsigned int i = 0;
+    while (i<size) {
+        unsigned int run = copyASCII(s+i, d, size-i, '\r', '\n');
+        i += run; d += run;
+        // convert the next block one character at a time; always writing
+        // three bytes avoids branching on the character type
+        unsigned int end = (size-i>16) ? i+16 : size;
+        for ( ; i<end; i++) {
+            byte c = s[i];
+            d[0] = utf8LUT[c].c[0];
+            d[1] = utf8LUT[c].c[1];
+            d[2] = utf8LUT[c].c[2];
+            d += utf8LUT[c].len;
         }
     }
-    *d = 0;
-    size = count;
+    return (unsigned int)(((char*)d)-dst);
+}
+
+
+/**
+ * Convert a text block in MacRoman encoding to Unix/UTF-8.
+ *
+ * \return pointer to a static buffer
+ */
+char *mosDataMacToUnix(const char *text, unsigned int &size)
+{
+    // every MacRoman character needs at most three bytes in UTF-8
+    allocateBuffer(3*size+1);
+    size = mosMacToUTF8(text, size, buffer);
+    buffer[size] = 0;
     return buffer;
 }
 
@@ -422,10 +552,25 @@ static void convertToMac(const char *filename, char *buffer)
 char *mosFilenameConvertTo(const char *filename, int dstType)
 {
     static char buffer[2048];
+    // the result only depends on the name, so remember it for the next call
+    static std::unordered_map<std::string, std::string> cache[2];
+    std::unordered_map<std::string, std::string> *known = nullptr;
+    if (dstType==MOS_TYPE_UNIX || dstType==MOS_TYPE_MAC) {
+        known = &cache[dstType==MOS_TYPE_MAC];
+        auto it = known->find(filename);
+        if (it!=known->end()) {
+            strcpy(buffer, it->second.c_str());
+            return buffer;
+        }
+        if (known->size()>=kMosFilenameCacheSize)
+            known->clear();
+    }
     char *tmpname;
     int srcType = mosFilenameGuessType(filename);
     if (srcType==dstType || srcType==MOS_TYPE_UNKNOWN) {
         strcpy(buffer, filename);
+        if (known)
+            known->emplace(filename, buffer);
         return buffer;
     }
     switch (srcType) {
@@ -437,6 +582,8 @@ char *mosFilenameConvertTo(const char *filename, int dstType)
         default: break; // nothing to do, Unix type filename is in the buffer
             // TODO: actually, OS X expects another UTF-8 encoding than standard Unix, so, yes, there might be work to do
     }
+    if (known)
+        known->emplace(filename, buffer);
     return buffer;
 }
 
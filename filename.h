@@ -38,6 +38,10 @@ const char *mosFilenameName(const char *filename);
 const char *mosFilenameNameUnix(const char *filename);
 
 char *mosDataUnixToMac(const char *text, unsigned int &size);
+int mosUTF8CharToMac(const char *src, unsigned int n, char *dst);
+unsigned int mosUTF8ToMac(const char *src, unsigned int srcSize,
+                          char *dst, unsigned int dstSize, unsigned int &srcUsed);
+unsigned int mosMacToUTF8(const char *src, unsigned int size, char *dst);
 char *mosDataMacToUnix(const char *text, unsigned int &size);
 
 
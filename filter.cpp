@@ -0,0 +1,334 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+/** \file filter.cpp
+ Rules for converting file names and file data between Mac and Unix.
+
+ Rules are given as triple-dash options in the form
+ ---scope-what-from-to-to=pattern, see the comment at the top of main.cpp.
+ For example, "---allin-data-unix-to-mac" converts all text that the tool
+ reads from UTF-8 to MacRoman, and "---next-raw" leaves the name and the
+ data of the next file on the command line alone.
+
+ MPW tools read and write MacRoman text, so input can only be converted
+ from Unix to Mac, and output from Mac to Unix. A rule for a file that is
+ read and written, like "---next-file-unix-to-mac", converts both ways.
+
+ If several rules match a stream, the most specific one wins: next, then a
+ regular expression, then stdin, stdout, stderr, or conout, then all, and
+ finally allin and allout. Of two rules of the same kind, the later one
+ wins. Without a rule, stdout and stderr are converted to Unix, and
+ everything else is left alone.
+ */
+
+#include "filter.h"
+
+#include "filename.h"
+
+#include <string.h>
+
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+
+// the streams that a rule applies to, ordered by priority
+enum {
+    kMosScopeAllIn = 1,     // all input streams
+    kMosScopeAllOut,        // all output streams
+    kMosScopeAll,           // all files on the command line
+    kMosScopeStdIn,
+    kMosScopeStdOut,
+    kMosScopeStdErr,
+    kMosScopeConOut,        // stdout and stderr
+    kMosScopeRegex,         // all files whose name matches a pattern
+    kMosScopeNext           // the next file on the command line
+};
+
+// what a rule converts
+const int kMosFilterName = 1;
+const int kMosFilterData = 2;
+
+typedef struct {
+    int scope;
+    int what;               // kMosFilterName and/or kMosFilterData
+    bool raw;               // if set, don't convert at all
+    std::string name;       // file name in Unix format for kMosScopeNext
+    std::regex pattern;     // for kMosScopeRegex
+} MosFilterRule;
+
+// all rules in the order they were given
+static std::vector<MosFilterRule> gMosFilterRules;
+
+// a ---next rule that waits for the next file name
+static bool gMosFilterNextPending = false;
+static MosFilterRule gMosFilterNext;
+
+// all file names on the command line in Unix format
+static std::set<std::string> gMosFilterArgs;
+
+// number of rules and arguments when mosFilterTakeSnapshot() was called
+static size_t gMosFilterSavedRules = 0;
+static std::set<std::string> gMosFilterSavedArgs;
+
+
+/**
+ * Return the priority of a rule; rules with a higher priority win.
+ */
+static int mosFilterPriority(const MosFilterRule &rule)
+{
+    switch (rule.scope) {
+        case kMosScopeAllIn:
+        case kMosScopeAllOut: return 1;
+        case kMosScopeAll:    return 2;
+        case kMosScopeRegex:  return 4;
+        case kMosScopeNext:   return 5;
+    }
+    return 3; // stdin, stdout, stderr, conout
+}
+
+
+/**
+ * Parse the name of an encoding.
+ *
+ * \return MOS_TYPE_MAC, MOS_TYPE_UNIX, or MOS_TYPE_UNKNOWN
+ */
+static int mosFilterEncoding(const std::string &word)
+{
+    if (word=="mac")
+        return MOS_TYPE_MAC;
+    if (word=="unix" || word=="utf8" || word=="host")
+        return MOS_TYPE_UNIX;
+    return MOS_TYPE_UNKNOWN;
+}
+
+
+/**
+ * Add a conversion rule from a triple-dash command line option.
+ *
+ * \param arg the option, for example "---allout-data-mac-to-unix"
+ * \return false if this is not a valid conversion rule
+ */
+bool mosFilterOption(const char *arg)
+{
+    if (strncmp(arg, "---", 3)!=0)
+        return false;
+    std::string opt(arg+3), pattern;
+    size_t eq = opt.find('=');
+    bool hasPattern = (eq!=std::string::npos);
+    if (hasPattern) {
+        pattern = opt.substr(eq+1);
+        opt.resize(eq);
+    }
+    std::vector<std::string> words;
+    size_t start = 0;
+    for (;;) {
+        size_t dash = opt.find('-', start);
+        words.push_back(opt.substr(start, dash==std::string::npos ? dash : dash-start));
+        if (dash==std::string::npos) break;
+        start = dash+1;
+    }
+
+    MosFilterRule rule;
+    size_t i = 0;
+    const std::string &scope = words[i];
+    if (scope=="all") rule.scope = kMosScopeAll;
+    else if (scope=="allin") rule.scope = kMosScopeAllIn;
+    else if (scope=="allout") rule.scope = kMosScopeAllOut;
+    else if (scope=="next") rule.scope = kMosScopeNext;
+    else if (scope=="regex") rule.scope = kMosScopeRegex;
+    else if (scope=="stdin" || scope=="in") rule.scope = kMosScopeStdIn;
+    else if (scope=="stdout") rule.scope = kMosScopeStdOut;
+    else if (scope=="stderr") rule.scope = kMosScopeStdErr;
+    else if (scope=="conout") rule.scope = kMosScopeConOut;
+    else rule.scope = 0;
+    if (rule.scope) i++;
+    else rule.scope = hasPattern ? kMosScopeRegex : kMosScopeNext;
+    if ((rule.scope==kMosScopeRegex)!=hasPattern)
+        return false;
+
+    rule.what = kMosFilterName|kMosFilterData;
+    if (i<words.size()) {
+        if (words[i]=="name") { rule.what = kMosFilterName; i++; }
+        else if (words[i]=="data") { rule.what = kMosFilterData; i++; }
+        else if (words[i]=="file") { i++; }
+    }
+
+    int from = MOS_TYPE_UNKNOWN, to = MOS_TYPE_UNKNOWN;
+    if (i+1==words.size() && words[i]=="raw") {
+        rule.raw = true;
+    } else if (i+3==words.size() && words[i+1]=="to") {
+        from = mosFilterEncoding(words[i]);
+        to = mosFilterEncoding(words[i+2]);
+        if (from==MOS_TYPE_UNKNOWN || to==MOS_TYPE_UNKNOWN)
+            return false;
+        rule.raw = (from==to);
+    } else {
+        return false;
+    }
+
+    // tools read and write MacRoman, so there is only one useful direction
+    bool input = (rule.scope==kMosScopeAllIn || rule.scope==kMosScopeStdIn);
+    bool output = (rule.scope==kMosScopeAllOut || rule.scope==kMosScopeStdOut
+                   || rule.scope==kMosScopeStdErr || rule.scope==kMosScopeConOut);
+    if (!rule.raw && ((input && from!=MOS_TYPE_UNIX) || (output && from!=MOS_TYPE_MAC)))
+        return false;
+    // only file names on the command line can be converted, always to Mac
+    if (rule.scope!=kMosScopeAll && rule.scope!=kMosScopeNext && rule.scope!=kMosScopeRegex)
+        rule.what &= ~kMosFilterName;
+    if (!rule.raw && (rule.what&kMosFilterName) && to!=MOS_TYPE_MAC)
+        return false;
+    if (rule.what==0)
+        return false;
+
+    if (rule.scope==kMosScopeRegex) {
+        try {
+            rule.pattern = std::regex(pattern);
+        } catch (const std::regex_error &) {
+            return false;
+        }
+    }
+    if (rule.scope==kMosScopeNext) {
+        gMosFilterNext = rule;
+        gMosFilterNextPending = true;
+    } else {
+        gMosFilterRules.push_back(rule);
+    }
+    return true;
+}
+
+
+/**
+ * Convert a file name on the command line for the tool.
+ *
+ * File names are converted to Mac format, unless a rule says otherwise.
+ * A waiting ---next rule is applied to this file.
+ *
+ * \param arg the argument from the host command line
+ * \return the argument for the tool, may point to a static buffer
+ */
+const char *mosFilterArgument(const char *arg)
+{
+    std::string key(mosFilenameConvertTo(arg, MOS_TYPE_UNIX));
+    gMosFilterArgs.insert(key);
+
+    const MosFilterRule *nameRule = nullptr;
+    for (const MosFilterRule &rule: gMosFilterRules) {
+        if ((rule.what&kMosFilterName)==0)
+            continue;
+        if (rule.scope==kMosScopeRegex && !std::regex_search(key, rule.pattern))
+            continue;
+        if (!nameRule || mosFilterPriority(rule)>=mosFilterPriority(*nameRule))
+            nameRule = &rule;
+    }
+    if (gMosFilterNextPending) {
+        gMosFilterNextPending = false;
+        gMosFilterNext.name = key;
+        if (gMosFilterNext.what&kMosFilterName)
+            nameRule = &gMosFilterNext;
+        if (gMosFilterNext.what&kMosFilterData) {
+            gMosFilterRules.push_back(gMosFilterNext);
+            gMosFilterRules.back().what = kMosFilterData;
+        }
+    }
+
+    if (nameRule && nameRule->raw)
+        return arg;
+    return mosFilenameConvertTo(arg, MOS_TYPE_MAC);
+}
+
+
+/**
+ * Find out how the data of a stream is converted.
+ *
+ * \param filename name of the file
+ * \param stream MOS_STREAM_FILE for files that the tool opened, or one of
+ *        the standard streams
+ * \param[out] convertIn set if UTF-8 input is converted to MacRoman
+ * \param[out] convertOut set if MacRoman output is converted to UTF-8
+ */
+void mosFilterData(const char *filename, int stream, bool &convertIn, bool &convertOut)
+{
+    convertIn = false;
+    convertOut = (stream==MOS_STREAM_STDOUT || stream==MOS_STREAM_STDERR);
+    int inPriority = 0, outPriority = 0;
+    std::string key;
+    if (stream==MOS_STREAM_FILE)
+        key = mosFilenameConvertTo(filename, MOS_TYPE_UNIX);
+
+    for (const MosFilterRule &rule: gMosFilterRules) {
+        if ((rule.what&kMosFilterData)==0)
+            continue;
+        bool in = false, out = false;
+        switch (rule.scope) {
+            case kMosScopeAllIn: in = true; break;
+            case kMosScopeAllOut: out = true; break;
+            case kMosScopeStdIn: in = (stream==MOS_STREAM_STDIN); break;
+            case kMosScopeStdOut: out = (stream==MOS_STREAM_STDOUT); break;
+            case kMosScopeStdErr: out = (stream==MOS_STREAM_STDERR); break;
+            case kMosScopeConOut:
+                out = (stream==MOS_STREAM_STDOUT || stream==MOS_STREAM_STDERR);
+                break;
+            case kMosScopeAll:
+                in = out = (stream==MOS_STREAM_FILE && gMosFilterArgs.count(key));
+                break;
+            case kMosScopeRegex:
+                in = out = (stream==MOS_STREAM_FILE && std::regex_search(key, rule.pattern));
+                break;
+            case kMosScopeNext:
+                in = out = (stream==MOS_STREAM_FILE && rule.name==key);
+                break;
+        }
+        int priority = mosFilterPriority(rule);
+        if (in && priority>=inPriority) {
+            convertIn = !rule.raw;
+            inPriority = priority;
+        }
+        if (out && priority>=outPriority) {
+            convertOut = !rule.raw;
+            outPriority = priority;
+        }
+    }
+}
+
+
+/**
+ * Remember the rules from the mosrun command line.
+ */
+void mosFilterTakeSnapshot()
+{
+    gMosFilterSavedRules = gMosFilterRules.size();
+    gMosFilterSavedArgs = gMosFilterArgs;
+}
+
+
+/**
+ * Forget the rules and file names of the last batch job.
+ */
+void mosFilterRestoreSnapshot()
+{
+    gMosFilterRules.resize(gMosFilterSavedRules);
+    gMosFilterArgs = gMosFilterSavedArgs;
+    gMosFilterNextPending = false;
+}
@@ -20,8 +20,8 @@
  */
 
 //
-// This is a proposal for possible flags that may make life easier when using
-// mosrun in a Unix environment.
+// These flags make life easier when using mosrun in a Unix environment. The
+// conversion rules are implemented in filter.cpp.
 //
 // ---help
 // ---run
@@ -41,15 +41,19 @@
 //    ccc is "unix":  convert from utf-8, '\n', '/'
 //           "mac":   convert from MacRom, '\r', ':'
 //    to is  "to":    indicates format conversion
-//           "raw":   overrides default filters with absolutely no conversion
 //    ddd    as ccc   convert ot format
+//    "raw" instead of ccc-to-ddd overrides default filters with absolutely no
+//           conversion, e.g. ---stdout-raw
 //    eee    "..."    optional name pattern for "regex" attribute
 //                    if regex is set, eee must be filled
 //                    if eee is set, regex is implied and no other option must be chosen
 //
-// Implied rules are ---stdin-to-mac ---conout-mac-to-host
+// Tools only read and write MacRoman text, so input can only be converted
+// from unix to mac, and output from mac to unix.
 //
-// example: ARM6asm ---unix-to-mac test.s -o ---keep test.s.o
+// Implied rule is ---conout-data-mac-to-unix
+//
+// example: ARM6asm ---unix-to-mac test.s -o ---next-raw test.s.o
 //
 
 //
@@ -99,12 +103,19 @@
 #include <sys/xattr.h>
 #include <unistd.h>
 #include <libgen.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <signal.h>
+extern char **environ;
 #endif
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <limits.h>
 #include <assert.h>
 
+#include <string>
+#include <vector>
+
 // Include our own interfaces
 
 #include "main.h"
@@ -119,6 +130,10 @@
 #include "traps.h"
 #include "cpu.h"
 #include "systemram.h"
+#include "vfs.h"
+#include "filter.h"
+#include "server.h"
+#include "snapshot.h"
 
 // Inlcude Musahi's m68k emulator
 
@@ -140,26 +155,59 @@ const char *gMosHelpText =
 "  ---log=filename : log all messages to a file\n"
 "  ---checkmem : enable memory access checking\n"
 "  ---checkmemstrict : check memory and exit on fault\n"
+"  ---batch=filename : run the tool once for every line of arguments in a file\n"
+"  ---server=socket : keep the tool loaded and run jobs from mosrun-client\n"
+"  ---fork-server=socket : like ---server, but run every job in a forked process\n"
+"  ---save-snapshot=filename : save the emulator after the tool initialized itself\n"
+"  ---snapshot=filename : resume from a snapshot instead of initializing the tool\n"
+"  ---record-alloc=filename : write all memory manager calls to a file for AllocBench\n"
+"  ---preload-segments : load all code segments and resolve the jump table at launch\n"
+"  ---fiobufsize=n : buffer size that the tool should use for its files (default 8192)\n"
+"  ---vfs-mount=path : keep all files below path in memory, for example :Temp:\n"
+"  ---write-behind : write files on a separate thread while the tool keeps running\n"
 "  ---allout-data-mac-to-utf8 : convert all file output from Mac encoding to Unicode\n"
 "  ---allin-data-utf8-to-mac : EXPERIMENTAL! convert all file input from Unicode to Mac encoding\n"
+"  ---scope-what-from-to-to=pattern : convert names and data of some files, see README\n"
 ;
 
 // application global variables
 
-mosPtr theApp = 0;
+const byte *theApp = nullptr;
 unsigned int theAppSize = 0;
+bool theAppCompressed = false;
+const MosEmbeddedTool *gMosEmbeddedTools = nullptr;
 mosPtr theRsrc = 0;
 unsigned int theRsrcSize = 0;
 mosPtr theJumpTable = 0;
 byte gCheckMemory = 0;
 
-byte gFilterStdoutDataFrom = MOS_TYPE_MAC;
-byte gFilterStdoutDataTo   = MOS_TYPE_UNIX;
+char *gRsrcFileBaseName = nullptr;
+bool gPreloadSegments = false;
 
-bool allout_data_mac_to_utf8 = false;
-bool allin_data_utf8_to_mac = false;
+// if set, run the app once for every line in this file
+char *gBatchFileName = nullptr;
 
-char *gRsrcFileBaseName = nullptr;
+// if set, run the app for every job that arrives at this socket
+char *gServerPath = nullptr;
+
+// if set, the server runs every job in a new process
+bool gForkServer = false;
+
+// result of a batch or server job that ended while reading its arguments
+static int gArgvResult = -1;
+
+// if set, every run of the app resumes from this snapshot file
+char *gSnapshotPath = nullptr;
+
+// the arguments that the app gets, after conversion
+static std::vector<std::string> gAppArgs;
+
+// the first command line argument that is passed to the app
+const char *gAppArgv0 = nullptr;
+
+// how the tool image in theApp was loaded, so that unloadApp() can release it
+enum { kAppStatic, kAppAllocated, kAppMapped };
+static int gAppStorage = kAppStatic;
 
 /**
  * Find native tools in load path
@@ -194,14 +242,16 @@ int loadCodeFromResourceFork(const char *path)
 #if defined (__APPLE__) && defined (__MACH__)
     ssize_t size = getxattr(path, "com.apple.ResourceFork", 0L, 0, 0, 0);
     if (size!=-1) {
-        theAppSize = size;
-        theApp = mosNewPtr(size);
-        ssize_t ret = getxattr(path, "com.apple.ResourceFork", mosToHost(theApp), size, 0, 0);
+        byte *data = (byte*)malloc(size);
+        ssize_t ret = getxattr(path, "com.apple.ResourceFork", data, size, 0, 0);
         if (ret!=-1) {
             mosTrace("%s has a %ld byte resource fork\n", path, size);
+            theApp = data;
+            theAppSize = size;
+            gAppStorage = kAppAllocated;
             return 1;
         } else {
-            mosDisposePtr((mosPtr)theApp);
+            free(data);
         }
     }
 #endif  
@@ -213,18 +263,60 @@ int loadCodeFromFile(const char *path)
     FILE *f;
     struct stat st;
     mosTrace("Loading from %s\n", path);
+#ifndef _WIN32
+    // Map the tool read-only, so that all processes running the same tool
+    // share the same physical pages. Resources are copied out on demand.
+    int fd = open(path, O_RDONLY);
+    if (fd != -1) {
+        if (fstat(fd, &st)==0 && st.st_size>0) {
+            void *data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (data != MAP_FAILED) {
+                close(fd);
+                theApp = (const byte*)data;
+                theAppSize = (unsigned int)st.st_size;
+                gAppStorage = kAppMapped;
+                return 1;
+            }
+        }
+        close(fd);
+    }
+#endif
     f = fopen(path, "rb");
     if (f != NULL) {
         stat(path, &st);
-        theAppSize = (unsigned int)st.st_size;
-        theApp = mosNewPtr(theAppSize);
-        fread(mosToHost(theApp), 1, theAppSize, f);
+        unsigned int size = (unsigned int)st.st_size;
+        byte *data = (byte*)malloc(size);
+        size_t n = data ? fread(data, 1, size, f) : 0;
         fclose(f);
+        if (n!=size) {
+            mosError("Can't read %s\n", path);
+            free(data);
+            return 0;
+        }
+        theApp = data;
+        theAppSize = size;
+        gAppStorage = kAppAllocated;
         return 1;
     }
     return 0;
 }
 
+/**
+ * Release a tool image that turned out to be unusable.
+ */
+static void unloadApp()
+{
+    if (gAppStorage==kAppAllocated)
+        free((void*)theApp);
+#ifndef _WIN32
+    else if (gAppStorage==kAppMapped)
+        munmap((void*)theApp, theAppSize);
+#endif
+    theApp = nullptr;
+    theAppSize = 0;
+    gAppStorage = kAppStatic;
+}
+
 int loadCodeFromDotFile(const char *path)
 {
 #if WIN32
@@ -261,10 +353,14 @@ int loadCodeFromDotFile(const char *path)
 int loadExternalApp(const char *path)
 {
     if (loadCodeFromResourceFork(path) || loadCodeFromDotFile(path) || loadCodeFromFile(path)) {
-        readResourceMap();
+        if (!readResourceMap()) {
+            unloadApp();
+            return 0;
+        }
         mosHandle code0 = GetResource('CODE', 0);
         if (code0==0) {
             mosError("loadExternalApp: CODE 0 not found in external app\n");
+            unloadApp();
             return 0;
         }
         gMosCurrentA5 = createA5World(code0);
@@ -283,16 +379,44 @@ int loadAliasedApp(const char *aName)
 }
 
 
+/**
+ * Find a tool by name in a multi-call binary.
+ *
+ * \return 0 if the tool is not embedded
+ */
+static int selectEmbeddedTool(const char *aName)
+{
+    const MosEmbeddedTool *tool;
+    for (tool = gMosEmbeddedTools; tool->name; tool++) {
+        if (strcmp(tool->name, aName)==0) {
+            gAppResource = tool->start;
+            gAppResourceSize = (unsigned int)(tool->end - tool->start);
+            gAppResourceCompressed = tool->compressed;
+            return 1;
+        }
+    }
+    std::string names;
+    for (tool = gMosEmbeddedTools; tool->name; tool++)
+        names = names + "  " + tool->name + "\n";
+    mosError("'%s' is not embedded in this executable. Embedded tools are:\n%s", aName, names.c_str());
+    return 0;
+}
+
+
 /**
  * Load the executable part of a file from internal memory.
  */
-int loadEmbeddedApp(const char*)
+int loadEmbeddedApp(const char *aName)
 {
+    if (gMosEmbeddedTools && !selectEmbeddedTool(aName))
+        return 0;
     if (gAppResource) {
+        // resources are copied straight from the embedded data when they are loaded
         theAppSize = gAppResourceSize;
-        theApp = mosNewPtr(theAppSize);
-        mosMemcpy(theApp, gAppResource, gAppResourceSize);
-        readResourceMap();
+        theApp = gAppResource;
+        theAppCompressed = (gAppResourceCompressed!=0);
+        if (!readResourceMap())
+            return 0;
         mosHandle code0 = GetResource('CODE', 0);
         if (code0==0) {
             mosError("loadEmbeddedApp: CODE 0 not found in embedded data\n");
@@ -306,6 +430,27 @@ int loadEmbeddedApp(const char*)
 }
 
 
+/**
+ * Load the snapshot and give the app the arguments of this run.
+ *
+ * \return false if the snapshot is damaged
+ */
+static bool resumeSnapshot()
+{
+    if (!mosLoadSnapshot()) {
+        mosError("Snapshot '%s' is damaged\n", gSnapshotPath);
+        return false;
+    }
+    mosPtr vArgv = mosNewPtr((unsigned int)(gAppArgs.size()+1)*4);
+    for (size_t i=0; i<gAppArgs.size(); i++)
+        mosWrite32(vArgv+4*(unsigned int)i, mosNewPtr(gAppArgs[i].c_str()));
+    mosPtr mpwMem = mosRead32(gMosMPWHandle+0x0004);
+    mosWrite32(mpwMem+0x0002, (unsigned int)gAppArgs.size()); // argc
+    mosWrite32(mpwMem+0x0006, vArgv); // argv
+    return true;
+}
+
+
 /**
  * Initialize the CPU and loop through each instruction using the m68k emulator.
  */
@@ -320,13 +465,178 @@ int runApp()
     m68k_set_reg(M68K_REG_A5, gMosCurrentA5);
     m68k_set_instr_hook_callback(m68k_instruction_hook);
 
+    // skip the initialization of the app
+    if (gSnapshotPath && !resumeSnapshot()) {
+        if (!gMosReturnOnExit)
+            exit(3);
+        return 3;
+    }
+
     //MosGetResource...
 
-    char done = 0;
-    while(!done) {
+    gMosAppDone = false;
+    while(!gMosAppDone) {
         m68k_execute(1);
+        // deliver asynchronous file calls between two instructions
+        if (gMosIOPending)
+            mosPollIO();
+        if (gMosSnapshotDue)
+            mosSaveSnapshot(gMosSaveSnapshotPath);
     }
-    return 0;
+    return gMosAppResult;
+}
+
+
+// options that configure the whole process, and can't be changed by a job
+static const char *gProcessOptions[] = {
+    "---checkmem", "---verbosity=", "---log=", "---batch=", "---server=",
+    "---fork-server=", "---record-alloc=", "---fiobufsize=", "---vfs-mount=",
+    "---write-behind", "---preload-segments", "---dumprsrc=", "---snapshot=",
+    "---save-snapshot=", nullptr
+};
+
+
+/**
+ * Check if an option may only be used on the command line of mosrun.
+ */
+static bool isProcessOption(const char *arg)
+{
+    for (const char **opt = gProcessOptions; *opt; opt++)
+        if (strncmp(arg, *opt, strlen(*opt))==0)
+            return true;
+    return false;
+}
+
+
+/**
+ * Quit mosrun, or only end the current job when running batch or server jobs.
+ */
+static void quitArgv(int result)
+{
+    if (!gMosReturnOnExit)
+        exit(result);
+    if (gArgvResult==-1)
+        gArgvResult = result;
+}
+
+
+/**
+ * Create the argv array in emulated memory and handle triple-dash options.
+ *
+ * \param srcArgc number of arguments, including the app name
+ * \param srcArgv arguments from the host command line
+ * \param vArgvPtr receives the address of the argv array in mos memory
+ * \return the number of arguments that were passed on to the app
+ */
+static unsigned int setupArgv(int srcArgc, const char **srcArgv, mosPtr *vArgvPtr)
+{
+    mosPtr vArgv = mosNewPtr((srcArgc+1)*4);
+    unsigned int di = 0;
+    gAppArgs.clear();
+    for (int i=0; i<srcArgc; i++) {
+        const char *arg = srcArgv[i];
+        // TODO: spot tripple-dash commands and take them off the list
+        // TODO: argv[0] should only be the filename (MacOS has a 32 byte limt here!
+        if (i==0) {
+            // FIXME: 0x0910 CurApName (Str32)
+            arg = mosFilenameName(arg);
+            arg = mosFilenameConvertTo(arg, MOS_TYPE_MAC);
+            mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
+            gAppArgs.push_back(arg);
+        } else {
+            if (strcmp(arg, "---help")==0) {
+                puts(gMosHelpText);
+                quitArgv(0);
+            } else if (gMosReturnOnExit && isProcessOption(arg)) {
+                // batch and server jobs only run with gMosReturnOnExit set
+                mosError("'%s' can only be used on the command line, not in a job\n", arg);
+                quitArgv(1);
+            } else if (strcmp(arg, "---checkmem")==0) {
+                gCheckMemory = 1;
+            } else if (strcmp(arg, "---checkmemstrict")==0) {
+                gCheckMemory = 2;
+            } else if (strcmp(arg, "---verbosity=trace")==0) {
+                mosLogVerbosity(MOS_VERBOSITY_TRACE);
+                mosDebug("Setting verbosity to TRACE\n");
+            } else if (strcmp(arg, "---verbosity=debug")==0) {
+                mosLogVerbosity(MOS_VERBOSITY_DEBUG);
+                mosDebug("Setting verbosity to DEBUG\n");
+            } else if (strcmp(arg, "---verbosity=log")==0) {
+                mosLogVerbosity(MOS_VERBOSITY_LOG);
+                mosDebug("Setting verbosity to LOG\n");
+            } else if (strcmp(arg, "---verbosity=warn")==0) {
+                mosLogVerbosity(MOS_VERBOSITY_WARN);
+                mosDebug("Setting verbosity to WARN\n");
+            } else if (strcmp(arg, "---verbosity=err")==0) {
+                mosLogVerbosity(MOS_VERBOSITY_ERR);
+                mosDebug("Setting verbosity to ERR\n");
+            } else if (strncmp(arg, "---log=", 7)==0) {
+                mosDebug("Setting log file to '%s'\n", arg+7);
+                FILE *f = fopen(arg+7, "wb");
+                if (f) {
+                    mosLogTo(f);
+                    mosDebug("Starting log file '%s'\n", arg+7);
+                } else {
+                    mosDebug("   failed: %s\n", strerror(errno));
+                }
+            } else if (strncmp(arg, "---batch=", 9)==0) {
+                mosDebug("Running batch jobs from '%s'\n", arg+9);
+                gBatchFileName = strdup(arg+9);
+            } else if (strncmp(arg, "---server=", 10)==0) {
+                mosDebug("Waiting for jobs at '%s'\n", arg+10);
+                gServerPath = strdup(arg+10);
+            } else if (strncmp(arg, "---save-snapshot=", 17)==0) {
+                mosDebug("Saving a snapshot to '%s'\n", arg+17);
+                gMosSaveSnapshotPath = strdup(arg+17);
+            } else if (strncmp(arg, "---snapshot=", 12)==0) {
+                mosDebug("Resuming from snapshot '%s'\n", arg+12);
+                gSnapshotPath = strdup(arg+12);
+            } else if (strncmp(arg, "---fork-server=", 15)==0) {
+                mosDebug("Forking jobs from '%s'\n", arg+15);
+                gServerPath = strdup(arg+15);
+                gForkServer = true;
+            } else if (strncmp(arg, "---record-alloc=", 16)==0) {
+                // already handled in main() before the first allocation
+            } else if (strncmp(arg, "---fiobufsize=", 14)==0) {
+                int size = atoi(arg+14);
+                if (size<1 || size>32768) {
+                    mosError("---fiobufsize must be between 1 and 32768\n");
+                    quitArgv(1);
+                } else {
+                    gMosFioBufSize = (unsigned int)size;
+                }
+            } else if (strncmp(arg, "---vfs-mount=", 13)==0) {
+                mosDebug("Keeping files below '%s' in memory\n", arg+13);
+                mosVfsMount(arg+13);
+            } else if (strcmp(arg, "---write-behind")==0) {
+                gMosWriteBehind = true;
+            } else if (strcmp(arg, "---preload-segments")==0) {
+                gPreloadSegments = true;
+            } else if (strncmp(arg, "---dumprsrc=", 12)==0) {
+              mosDebug("Dumping resource fork content to files '%s.bin', '%s.cpp', and '%s.h'\n", arg+12, arg+12, arg+12);
+              gRsrcFileBaseName = strdup(arg+12);
+            } else if (mosFilterOption(arg)) {
+                mosDebug("Converting files as set by '%s'\n", arg);
+            } else if (strncmp(arg, "---", 3)==0) {
+                mosError("Unknown command line argument '%s'\n", arg);
+                quitArgv(1);
+            } else if (arg[0]!='-') {
+                mosDebug("Converting argv[%d] from '%s'\n", i, arg);
+                arg = mosFilterArgument(arg);
+                mosDebug("    to '%s'\n", arg);
+                // copy the arg over
+                mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
+                gAppArgs.push_back(arg);
+            } else {
+                mosDebug("Plain copy of argv[%d] = '%s'\n", i, arg);
+                mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
+                gAppArgs.push_back(arg);
+            }
+        }
+    }
+
+    *vArgvPtr = vArgv;
+    return di;
 }
 
 
@@ -340,7 +650,6 @@ int runApp()
 int setupSystem(int argc, const char **argv, const char**)
 {
     int runExternal = 0;
-    int i;
 
     // allocate a stack
     gMosCurrentStackBase = mosNewPtr(MOS_STACK_SIZE) + MOS_STACK_SIZE;
@@ -416,79 +725,14 @@ int setupSystem(int argc, const char **argv, const char**)
         runExternal = 1;
         srcArgv+=2;
         srcArgc-=2;
-    } else if (!gAppResource) {
+    } else if (!gAppResource && !gMosEmbeddedTools) {
         srcArgv++;
         srcArgc--;
     }
 
-    mosPtr vArgv = mosNewPtr((srcArgc+1)*4);
-    unsigned int di = 0;
-    for (i=0; i<srcArgc; i++) {
-        const char *arg = srcArgv[i];
-        // TODO: spot tripple-dash commands and take them off the list
-        // TODO: argv[0] should only be the filename (MacOS has a 32 byte limt here!
-        if (i==0) {
-            // FIXME: 0x0910 CurApName (Str32)
-            arg = mosFilenameName(arg);
-            arg = mosFilenameConvertTo(arg, MOS_TYPE_MAC);
-            mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
-        } else {
-            if (strcmp(argv[i], "---help")==0) {
-                puts(gMosHelpText);
-                exit(0);
-            } else if (strcmp(arg, "---checkmem")==0) {
-                gCheckMemory = 1;
-            } else if (strcmp(arg, "---checkmemstrict")==0) {
-                gCheckMemory = 2;
-            } else if (strcmp(arg, "---verbosity=trace")==0) {
-                mosLogVerbosity(MOS_VERBOSITY_TRACE);
-                mosDebug("Setting verbosity to TRACE\n");
-            } else if (strcmp(arg, "---verbosity=debug")==0) {
-                mosLogVerbosity(MOS_VERBOSITY_DEBUG);
-                mosDebug("Setting verbosity to DEBUG\n");
-            } else if (strcmp(arg, "---verbosity=log")==0) {
-                mosLogVerbosity(MOS_VERBOSITY_LOG);
-                mosDebug("Setting verbosity to LOG\n");
-            } else if (strcmp(arg, "---verbosity=warn")==0) {
-                mosLogVerbosity(MOS_VERBOSITY_WARN);
-                mosDebug("Setting verbosity to WARN\n");
-            } else if (strcmp(arg, "---verbosity=err")==0) {
-                mosLogVerbosity(MOS_VERBOSITY_ERR);
-                mosDebug("Setting verbosity to ERR\n");
-            } else if (strcmp(arg, "---stdout-raw")==0) {
-                gFilterStdoutDataTo = MOS_TYPE_RAW;
-                mosDebug("Setting stdout filter to RAW\n");
-            } else if (strncmp(arg, "---log=", 7)==0) {
-                mosDebug("Setting log file to '%s'\n", arg+7);
-                FILE *f = fopen(arg+7, "wb");
-                if (f) {
-                    mosLogTo(f);
-                    mosDebug("Starting log file '%s'\n", arg+7);
-                } else {
-                    mosDebug("   failed: %s\n", strerror(errno));
-                }
-            } else if (strncmp(arg, "---dumprsrc=", 12)==0) {
-              mosDebug("Dumping resource fork content to files '%s.cpp' and '%s.h'\n", arg+12, arg+12);
-              gRsrcFileBaseName = strdup(arg+12);
-            } else if (strcmp(arg, "---allout-data-mac-to-utf8")==0) {
-              allout_data_mac_to_utf8 = true;
-            } else if (strcmp(arg, "---allin-data-utf8-to-mac")==0) {
-              allin_data_utf8_to_mac = true;
-            } else if (strncmp(arg, "---", 3)==0) {
-                mosError("Unknown command line argument '%s'\n", arg);
-                exit(1);
-            } else if (arg[0]!='-') {
-                mosDebug("Converting argv[%d] from '%s'\n", i, arg);
-                arg = mosFilenameConvertTo(arg, MOS_TYPE_MAC);
-                mosDebug("    to '%s'\n", arg);
-                // copy the arg over
-                mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
-            } else {
-                mosDebug("Plain copy of argv[%d] = '%s'\n", i, arg);
-                mosWrite32(vArgv+4*di, mosNewPtr(arg)); di++;
-            }
-        }
-    }
+    gAppArgv0 = srcArgv[0];
+    mosPtr vArgv = 0;
+    unsigned int di = setupArgv(srcArgc, srcArgv, &vArgv);
 
     // TODO: envp support
 
@@ -517,33 +761,286 @@ int setupSystem(int argc, const char **argv, const char**)
 }
 
 
+/**
+ * Save everything that a run of the app may change.
+ */
+static void takeSnapshot()
+{
+    mosTakeSnapshot();
+    mosSaveTrapTable();
+    mosFilterTakeSnapshot();
+}
+
+
+/**
+ * Reset the emulator to the state of the last snapshot.
+ */
+static void restoreSnapshot()
+{
+    mosCloseAppFiles();
+    mosRestoreTrapTable();
+    mosFilterRestoreSnapshot();
+    uint32_t n = mosRestoreSnapshot();
+    mosDebug("Restored %d pages of RAM\n", n);
+    gMosResLoad = 1;
+    gMosResErr = 0;
+    gMosMemErr = 0;
+}
+
+
+/**
+ * Split a line from a batch file into arguments.
+ *
+ * Arguments are separated by spaces and tabs. Arguments in double quotes
+ * may contain spaces.
+ */
+static std::vector<std::string> splitBatchLine(const char *line)
+{
+    std::vector<std::string> args;
+    const char *s = line;
+    for (;;) {
+        while (*s==' ' || *s=='\t') s++;
+        if (*s==0) break;
+        std::string arg;
+        if (*s=='"') {
+            s++;
+            while (*s && *s!='"') arg += *s++;
+            if (*s=='"') s++;
+        } else {
+            while (*s && *s!=' ' && *s!='\t') arg += *s++;
+        }
+        args.push_back(arg);
+    }
+    return args;
+}
+
+
+/**
+ * Run the app once more with new arguments.
+ *
+ * \param args the arguments without the app name
+ * \return the result code of the app
+ */
+static int runJob(const std::vector<std::string> &args)
+{
+    std::vector<const char*> jobArgv;
+    jobArgv.push_back(gAppArgv0);
+    for (auto &arg: args)
+        jobArgv.push_back(arg.c_str());
+    gArgvResult = -1;
+    mosPtr vArgv = 0;
+    unsigned int vArgc = setupArgv((int)jobArgv.size(), jobArgv.data(), &vArgv);
+    if (gArgvResult!=-1)
+        return gArgvResult;
+    // resumeSnapshot() hands the arguments to the app in its own heap
+    if (gSnapshotPath)
+        return (int)runApp();
+    mosPtr mpwMem = mosRead32(gMosMPWHandle+0x0004);
+    mosWrite32(mpwMem+0x0002, vArgc); // argc
+    mosWrite32(mpwMem+0x0006, vArgv); // argv
+    return (int)runApp();
+}
+
+
+/**
+ * Run the app once for every line in a batch file.
+ *
+ * Every line holds the arguments for one run. Empty lines and lines starting
+ * with a '#' are skipped. The emulator state is saved after the app was
+ * loaded, and restored between jobs by copying back only the pages of RAM
+ * that were written.
+ *
+ * \return the highest result code of all jobs
+ */
+int runBatch(const char *filename)
+{
+    FILE *f = fopen(filename, "rb");
+    if (!f) {
+        mosError("Can't open batch file '%s': %s\n", filename, strerror(errno));
+        return 3;
+    }
+    std::vector<std::string> jobs;
+    char line[4096];
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\r\n")] = 0;
+        if (line[0]==0 || line[0]=='#') continue;
+        jobs.push_back(line);
+    }
+    fclose(f);
+
+    gMosReturnOnExit = true;
+    takeSnapshot();
+    int result = 0;
+    for (size_t j=0; j<jobs.size(); j++) {
+        if (j>0)
+            restoreSnapshot();
+        mosDebug("Batch job %d: %s\n", (int)j+1, jobs[j].c_str());
+        int ret = runJob(splitBatchLine(jobs[j].c_str()));
+        if (ret!=0)
+            mosDebug("Batch job %d returned %d\n", (int)j+1, ret);
+        if (ret>result)
+            result = ret;
+    }
+    return result;
+}
+
+
+#ifndef _WIN32
+
+/**
+ * Run a job with the standard streams, directory, and environment of the client.
+ *
+ * \return the result code of the app
+ */
+static int runServerJob(MosServerJob &job)
+{
+    for (int i=0; i<3; i++)
+        dup2(job.stdio[i], i);
+    if (chdir(job.cwd.c_str())==-1) {
+        mosError("Can't change directory to '%s': %s\n", job.cwd.c_str(), strerror(errno));
+        return 3;
+    }
+    char **hostEnv = environ;
+    std::vector<char*> jobEnv;
+    for (auto &var: job.env)
+        jobEnv.push_back((char*)var.c_str());
+    jobEnv.push_back(nullptr);
+    environ = jobEnv.data();
+    int ret = runJob(job.args);
+    environ = hostEnv;
+    // everything must be written before the client learns that we are done
+    fflush(stdout);
+    fflush(stderr);
+    return ret;
+}
+
+
+/**
+ * Run the app for every job that mosrun-client sends to a socket.
+ *
+ * Without forkJobs, jobs run one after the other. For the time of a job,
+ * mosrun takes over the standard streams, the working directory, and the
+ * environment of the client, and the client gets the result code of the
+ * app when it is done. Between jobs, the emulator is reset just like in
+ * batch mode.
+ *
+ * With forkJobs, mosrun stays in the state right after loading the app and
+ * forks a new process for every job. Jobs run in parallel, and all
+ * processes share the pages of the emulator that the jobs don't write.
+ *
+ * \return 3 if the socket can't be created, otherwise the server runs
+ *         until it is killed
+ */
+int runServer(const char *path, bool forkJobs)
+{
+    int sock = mosServerListen(path);
+    if (sock==-1) {
+        mosError("Can't create server socket '%s': %s\n", path, strerror(errno));
+        return 3;
+    }
+    const char *appName = mosFilenameNameUnix(gAppArgv0);
+    mosLog("Serving %s at '%s'\n", appName, path);
+
+    int hostStdio[3] = { dup(0), dup(1), dup(2) };
+    int hostCwd = open(".", O_RDONLY);
+
+    gMosReturnOnExit = true;
+    if (forkJobs)
+        signal(SIGCHLD, SIG_IGN); // no zombies, please
+    else
+        takeSnapshot();
+    for (;;) {
+        MosServerJob job;
+        if (!mosServerAccept(sock, job))
+            continue;
+        if (job.tool!=appName) {
+            dprintf(job.stdio[2], "This server runs %s, not %s\n", appName, job.tool.c_str());
+            mosServerReply(job, 3);
+            continue;
+        }
+        if (forkJobs) {
+            fflush(NULL);
+            pid_t pid = fork();
+            if (pid==-1) {
+                mosError("Can't fork a job: %s\n", strerror(errno));
+                mosServerReply(job, 3);
+            } else if (pid==0) {
+                close(sock);
+                signal(SIGCHLD, SIG_DFL);
+                int ret = runServerJob(job);
+                mosFlushAllFiles();
+                mosServerReply(job, ret);
+                mosLogClose();
+                exit(ret);
+            } else {
+                mosServerClose(job);
+            }
+            continue;
+        }
+        int ret = runServerJob(job);
+        restoreSnapshot();
+        mosResetStdFiles();
+        for (int i=0; i<3; i++)
+            dup2(hostStdio[i], i);
+        if (fchdir(hostCwd)==-1)
+            mosWarning("Can't return to the working directory of the server\n");
+        mosServerReply(job, ret);
+    }
+    return 0;
+}
+
+#else
+
+int runServer(const char*, bool)
+{
+    mosError("---server is not supported on this platform\n");
+    return 3;
+}
+
+#endif
+
+
+/**
+ * Write the resource fork of the current tool so it can be embedded in mosrun.
+ *
+ * This writes the resource fork into basename.bin and a short basename.cpp
+ * that includes the .bin file at assembly time, plus the matching rsrc.h.
+ * Compiling that is much faster than compiling a C array with a few hundred
+ * thousand elements.
+ */
 void writeRsrcFiles(const char *basename)
 {
-    byte *app = (byte*)mosToHost(theApp);
+    // embedded resources are stored compressed, see compressResourceFork()
+    std::vector<byte> compressed;
+    const byte *app = theApp;
     uint32_t appSize = theAppSize;
-    uint32_t i;
+    bool isCompressed = theAppCompressed;
+    if (!isCompressed) {
+        isCompressed = compressResourceFork(theApp, theAppSize, compressed);
+        app = compressed.data();
+        appSize = (uint32_t)compressed.size();
+    }
     char filename[PATH_MAX];
 
+    snprintf(filename, PATH_MAX, "%s.bin", basename);
+    FILE *bin_file = fopen(filename, "wb");
+    if (!bin_file) {
+        mosError("Can't write resource file '%s': %s\n", filename, strerror(errno));
+        return;
+    }
+    fwrite(app, 1, appSize, bin_file);
+    fclose(bin_file);
+
     snprintf(filename, PATH_MAX, "%s.cpp", basename);
     FILE *c_file = fopen(filename, "wb");
-    fputs(
-          "\n"
-          "#include \"rsrc.h\"\n"
-          "\n"
-          "unsigned char rsrc[] = {\n",
-          c_file);
-    for (i=0; i<appSize; i++) {
-        if ((i&15)==0) fprintf(c_file, "    ");
-        fprintf(c_file, "0x%02X, ", app[i]);
-        if ((i&15)==15) fprintf(c_file, "\n");
-    }
-    fputs(
-          "\n};\n"
-          "\n"
-          "unsigned char *gAppResource = rsrc;\n"
-          "unsigned int gAppResourceSize = sizeof(rsrc);\n"
-          "\n",
-          c_file);
+    fprintf(c_file,
+            "\n"
+            "#include \"rsrc.h\"\n"
+            "\n"
+            "MOS_INCBIN(\"%s.bin\")\n"
+            "unsigned int gAppResourceCompressed = %d;\n"
+            "\n",
+            mosFilenameNameUnix(basename), isCompressed ? 1 : 0);
     fclose(c_file);
 
     snprintf(filename, PATH_MAX, "%s.h", basename);
@@ -553,11 +1050,59 @@ void writeRsrcFiles(const char *basename)
           "#ifndef __mosrun__rsrc__\n"
           "#define __mosrun__rsrc__\n"
           "\n"
-          "extern unsigned char *gAppResource;\n"
+          "extern const unsigned char *gAppResource;\n"
           "extern unsigned int gAppResourceSize;\n"
+          "extern unsigned int gAppResourceCompressed;\n"
+          "\n"
+          "// A multi-call binary embeds a list of tools and picks one by its name.\n"
+          "struct MosEmbeddedTool {\n"
+          "    const char *name;\n"
+          "    const unsigned char *start, *end;\n"
+          "    unsigned int compressed;\n"
+          "};\n"
+          "extern const MosEmbeddedTool *gMosEmbeddedTools;\n"
+          "\n"
+          "// MOS_INCBIN() lets the assembler include a resource fork written by\n"
+          "// ---dumprsrc. MOS_RSRC_DIR is the directory that contains the .bin file.\n"
+          "#ifndef MOS_RSRC_DIR\n"
+          "#define MOS_RSRC_DIR \".\"\n"
+          "#endif\n"
+          "\n"
+          "#if defined(__APPLE__)\n"
+          "#define MOS_RSRC_SECTION \".const_data\\n\"\n"
+          "#define MOS_RSRC_SYMBOL(name) \"_\" #name\n"
+          "#elif defined(_WIN32) && !defined(_WIN64)\n"
+          "#define MOS_RSRC_SECTION \".section .rdata\\n\"\n"
+          "#define MOS_RSRC_SYMBOL(name) \"_\" #name\n"
+          "#elif defined(_WIN32)\n"
+          "#define MOS_RSRC_SECTION \".section .rdata\\n\"\n"
+          "#define MOS_RSRC_SYMBOL(name) #name\n"
+          "#else\n"
+          "#define MOS_RSRC_SECTION \".section .rodata\\n\"\n"
+          "#define MOS_RSRC_SYMBOL(name) #name\n"
+          "#endif\n"
           "\n"
-          "#endif /* defined(__mosrun__rsrc__) */\n"
-          "\n",
+          "#define MOS_INCBIN_DATA(start, end, file) \\\n"
+          "    extern \"C\" const unsigned char start[]; \\\n"
+          "    extern \"C\" const unsigned char end[]; \\\n"
+          "    __asm__( \\\n"
+          "        MOS_RSRC_SECTION \\\n"
+          "        \".globl \" MOS_RSRC_SYMBOL(start) \"\\n\" \\\n"
+          "        \".balign 16\\n\" \\\n"
+          "        MOS_RSRC_SYMBOL(start) \":\\n\" \\\n"
+          "        \".incbin \\\"\" MOS_RSRC_DIR \"/\" file \"\\\"\\n\" \\\n"
+          "        \".globl \" MOS_RSRC_SYMBOL(end) \"\\n\" \\\n"
+          "        MOS_RSRC_SYMBOL(end) \":\\n\" \\\n"
+          "        \".byte 0\\n\" \\\n"
+          "        \".text\\n\" \\\n"
+          "    );\n"
+          "\n"
+          "#define MOS_INCBIN(file) \\\n"
+          "    MOS_INCBIN_DATA(mosRsrcStart, mosRsrcEnd, file) \\\n"
+          "    const unsigned char *gAppResource = mosRsrcStart; \\\n"
+          "    unsigned int gAppResourceSize = (unsigned int)(mosRsrcEnd - mosRsrcStart);\n"
+          "\n"
+          "#endif /* defined(__mosrun__rsrc__) */\n",
           h_file);
     fclose(h_file);
 }
@@ -614,9 +1159,30 @@ int main(int argc, const char **argv, const char **envp)
 
     setBreakpoints();
 
+    // `mosrun-all ARMCpp ...` runs the embedded tool named by the first argument
+    if (gMosEmbeddedTools && argc>1 && strcmp(mosFilenameNameUnix(argv[0]), "mosrun-all")==0) {
+        argv++;
+        argc--;
+    }
+
+    // the allocation trace must start before the first allocation to be of any use
+    for (int i=1; i<argc; i++) {
+        if (strncmp(argv[i], "---record-alloc=", 16)==0) {
+            FILE *f = fopen(argv[i]+16, "wb");
+            if (f) {
+                mosRecordAllocTo(f);
+            } else {
+                mosError("Can't record allocations to '%s': %s\n", argv[i]+16, strerror(errno));
+            }
+        }
+    }
+
     // run External is set if the ---run option was found. This has top priority
     int runExternal = setupSystem(argc, argv, envp);
 
+    // don't lose buffered output if we quit early
+    atexit(mosFlushAllFiles);
+
     // set this if the emulated app loaded
     int appLoaded = 0;
 
@@ -636,10 +1202,30 @@ int main(int argc, const char **argv, const char **envp)
         exit(9);
     }
 
+    if (gPreloadSegments) {
+        preloadSegments();
+    }
+
     if (gRsrcFileBaseName) {
         writeRsrcFiles(gRsrcFileBaseName);
     }
 
+    if (gSnapshotPath && !mosOpenSnapshot(gSnapshotPath)) {
+        exit(3);
+    }
+
+    if (gBatchFileName) {
+        int ret = runBatch(gBatchFileName);
+        mosLogClose();
+        return ret;
+    }
+
+    if (gServerPath) {
+        int ret = runServer(gServerPath, gForkServer);
+        mosLogClose();
+        return ret;
+    }
+
     runApp();
 
     mosWarning("main: we should never reach tis code\nexit(");
@@ -57,6 +57,12 @@ const int mosEofErr =      -39; // error setting position beyon EOF
 const int mosFnfErr =      -43; // file not found
 const int mosDupFNErr =    -48; // duplicate filename (rename)
 const int mosParamErr =    -50; // bad parameter passed
+const int mosRfNumErr =    -51; // reference number invalid
+const int mosMemFullErr =  -108; // not enough memory in heap
+const int mosNilHandleErr = -109; // handle argument is NULL
+const int mosMemPurErr =   -112; // attempt to purge a locked or unpurgeable block
+const int mosMemLockedErr = -117; // block is locked
+const int mosResNotFound = -192; // resource not found
 
 typedef unsigned int mosPtr;
 typedef unsigned int mosHandle;
@@ -66,20 +72,16 @@ typedef unsigned int mosResType;
 
 typedef void (*mosTrap)(unsigned short);
 
-extern mosPtr theApp;
+extern const byte *theApp; // the tool image in host memory
 extern unsigned int theAppSize;
+extern bool theAppCompressed; // resources in theApp are compressed
 extern mosPtr theRsrc;
 extern unsigned int theRsrcSize;
 extern mosPtr theJumpTable;
 
-extern bool allout_data_mac_to_utf8;
-extern bool allin_data_utf8_to_mac;
-
 extern char *gRsrcFileBaseName;
 void writeRsrcFiles(const char *basename);
 
-extern byte gFilterStdoutDataFrom;
-extern byte gFilterStdoutDataTo;
 extern byte gCheckMemory; // 0=don't check, 1=check, 2=check and exit
 
 const unsigned int kMosMemMax        = 16*1024*1024;  // Size of emulated RAM
@@ -24,9 +24,11 @@
 #define MOS_CHECK_MEMORY_COHERENCE
 //#define MOS_TRACE_MEMORY(a) a
 #define MOS_TRACE_MEMORY(a)
+#define MOS_RECORD_ALLOC(...) if (gMosAllocRecord) fprintf(gMosAllocRecord, __VA_ARGS__);
 
 #include "memory.h"
 #include "log.h"
+#include "snapshot.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -35,6 +37,8 @@
 #endif
 #include <assert.h>
 
+#include <set>
+
 // This is the emulated RAM.
 byte *MosMem;
 
@@ -66,10 +70,13 @@ const mosPtr mosMemBlockPrev    = 0;
 const mosPtr mosMemBlockNext    = 4;
 const mosPtr mosMemBlockSize    = 8;
 const mosPtr mosMemBlockFlags   = 12;
-const mosPtr mosSizeofMemBlock  = 16;
+const mosPtr mosMemBlockMaster  = 16; // master pointer of a relocatable block, or 0
+const mosPtr mosSizeofMemBlock  = 20;
 
 const uint32_t mosMemFlagMagic      = 0xbeef0000;
 const uint32_t mosMemFlagMagicMask  = 0xffff0000;
+const uint32_t mosMemFlagTypeMask   = 0xffff00ff;
+const uint32_t mosMemFlagStateMask  = 0x0000ff00; // HGetState() flags of relocatable blocks
 const uint32_t mosMemFlagFree       = mosMemFlagMagic | 0;
 const uint32_t mosMemFlagUsed       = mosMemFlagMagic | 1;
 const uint32_t mosMemFlagHandles    = mosMemFlagMagic | 2;
@@ -77,6 +84,91 @@ const uint32_t mosMemFlagLast       = mosMemFlagMagic | 3;
 
 const mosPtr mosMemBlockStart = kSystemHeapStart;
 
+// number of master pointers that are allocated in one nonrelocatable block
+const uint32_t kMosMastersPerBlock = 64;
+
+// linked list of unused master pointers, the link is stored in the master pointer itself
+static mosPtr gMosFreeMasters = 0;
+
+// total number of bytes in free blocks, not counting the block headers
+static uint32_t gMosFreeBytes = 0;
+
+// sizes of all free blocks, so that the largest free block is always known
+static std::multiset<uint32_t> gMosFreeBlockSizes;
+
+// if set, all calls to the memory manager are written to this file
+static FILE *gMosAllocRecord = 0;
+
+// emulated RAM is tracked in pages of 4kB for fast snapshot restore
+const uint32_t kMosPageShift = 12;
+const uint32_t kMosNumPages  = kMosMemMax>>kMosPageShift;
+
+// one flag per page that was written since the last snapshot
+static byte gMosDirtyPages[kMosNumPages];
+
+// copy of emulated RAM and the memory manager state at the last snapshot
+static byte *gMosSnapshotMem = 0;
+static mosPtr gMosSnapshotFreeMasters = 0;
+static uint32_t gMosSnapshotFreeBytes = 0;
+static std::multiset<uint32_t> gMosSnapshotFreeBlockSizes;
+
+
+static uint32_t mosCompactHeap(uint32_t needed);
+static int mosPurgeHeap(uint32_t needed);
+
+
+/**
+ * Remember that a range of emulated RAM was written.
+ *
+ * Every write into emulated RAM must go through here, so that
+ * mosRestoreSnapshot() knows which pages to copy back.
+ */
+void mosMarkDirty(mosPtr addr, uint32_t n)
+{
+    if (n==0) return;
+    uint32_t first = addr>>kMosPageShift;
+    uint32_t last = (addr+n-1)>>kMosPageShift;
+    if (last>=kMosNumPages) last = kMosNumPages-1;
+    for (uint32_t p=first; p<=last; p++)
+        gMosDirtyPages[p] = 1;
+}
+
+
+/**
+ * Return the block type (free, used, etc.) without the handle state.
+ */
+static uint32_t mosBlockType(mosPtr b)
+{
+    return mosReadUnsafe32(b+mosMemBlockFlags) & mosMemFlagTypeMask;
+}
+
+
+/**
+ * Keep track of a new free block.
+ */
+static void mosFreeListAdd(uint32_t size)
+{
+    gMosFreeBlockSizes.insert(size);
+    gMosFreeBytes += size;
+}
+
+
+/**
+ * Forget about a free block that was allocated or joined.
+ */
+static void mosFreeListRemove(uint32_t size)
+{
+    auto it = gMosFreeBlockSizes.find(size);
+    if (it==gMosFreeBlockSizes.end()) {
+        mosError("mosFreeListRemove: no free block of %d bytes\n", size);
+        assert(0);
+        return;
+    }
+    gMosFreeBlockSizes.erase(it);
+    gMosFreeBytes -= size;
+}
+
+
 void mosMemoryInit()
 {
     MosMem = (byte*)calloc(kMosMemMax, 1);
@@ -88,51 +180,84 @@ void mosMemoryInit()
     mosWriteUnsafe32(firstBlock+mosMemBlockNext, lastBlock); // next block is the last block
     mosWriteUnsafe32(firstBlock+mosMemBlockSize, lastBlock-firstBlock-mosSizeofMemBlock); // available bytes in this block
     mosWriteUnsafe32(firstBlock+mosMemBlockFlags, mosMemFlagFree); // this space for rent
+    mosWriteUnsafe32(firstBlock+mosMemBlockMaster, 0);
     // the last block marks the end of managed space
     mosWriteUnsafe32(lastBlock+mosMemBlockPrev, firstBlock);
     mosWriteUnsafe32(lastBlock+mosMemBlockNext, 0);
     mosWriteUnsafe32(lastBlock+mosMemBlockSize, 0);
     mosWriteUnsafe32(lastBlock+mosMemBlockFlags, mosMemFlagLast);
+    mosWriteUnsafe32(lastBlock+mosMemBlockMaster, 0);
+
+    gMosFreeMasters = 0;
+    gMosFreeBytes = 0;
+    gMosFreeBlockSizes.clear();
+    memset(gMosDirtyPages, 1, sizeof(gMosDirtyPages));
+    mosFreeListAdd(lastBlock-firstBlock-mosSizeofMemBlock);
 
     mosCheckMemoryCoherence();
 }
 
-mosPtr mosMalloc(uint size)
+/**
+ * Write a line for every call to the memory manager into a file.
+ *
+ * The trace can be replayed with the AllocBench tool.
+ *
+ * \param f write to this file, or NULL to stop recording
+ */
+void mosRecordAllocTo(FILE *f)
+{
+    if (gMosAllocRecord)
+        fflush(gMosAllocRecord);
+    gMosAllocRecord = f;
+    MOS_RECORD_ALLOC("# mosrun allocation trace\n")
+}
+
+/**
+ * Find the first free block that can hold size bytes and mark it used.
+ *
+ * \return the address of the new block, or 0 if there is no free block big enough
+ */
+static mosPtr mosMallocFirstFit(uint size)
 {
-    // calculate the minimal block size we need to find
-    if (size==0) return 0;
-    MOS_CHECK_MEMORY_COHERENCE
     // align with 4 bytes
     uint32_t minimumBlockSize = ((size + 3) & ~0x00000003);
+    // don't bother searching if there is no free block that is big enough
+    if (gMosFreeBlockSizes.empty() || *gMosFreeBlockSizes.rbegin()<minimumBlockSize)
+        return 0;
     // now run the list of blocks (could be otimized for speed)
     mosPtr b = mosMemBlockStart;
     for (;;) {
         mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
         if (next==0) {
-            fprintf(stderr, "MOSMalloc failed: out of memory\n");
-            assert(0);
+            return 0;
         }
         uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
         if (flags==mosMemFlagFree) { // a free block
             uint32_t availableBlockSize = mosReadUnsafe32(b+mosMemBlockSize);
             if (availableBlockSize==minimumBlockSize) {
                 // the size matches; just mark it used and return its address
+                mosFreeListRemove(availableBlockSize);
                 mosWriteUnsafe32(b+mosMemBlockFlags, mosMemFlagUsed);
+                mosWriteUnsafe32(b+mosMemBlockMaster, 0);
                 MOS_TRACE_MEMORY( printf("-- malloc match at 0x%08X, n=%d\n", b+mosSizeofMemBlock, size); )
                 MOS_CHECK_MEMORY_COHERENCE
                 return b+mosSizeofMemBlock;
             } else if (availableBlockSize>minimumBlockSize+mosSizeofMemBlock) {
                 // size is bigger than needed plus room for a new block: split this block
                 mosPtr c = b + mosSizeofMemBlock + minimumBlockSize;
+                mosFreeListRemove(availableBlockSize);
                 // creaste the splitting new mem block
                 mosWriteUnsafe32(c+mosMemBlockPrev, b);
                 mosWriteUnsafe32(c+mosMemBlockNext, next);
                 mosWriteUnsafe32(c+mosMemBlockSize, next - c - mosSizeofMemBlock );
                 mosWriteUnsafe32(c+mosMemBlockFlags, mosMemFlagFree);
+                mosWriteUnsafe32(c+mosMemBlockMaster, 0);
+                mosFreeListAdd(next - c - mosSizeofMemBlock);
                 // update the current mem block
                 mosWriteUnsafe32(b+mosMemBlockNext, c);
                 mosWriteUnsafe32(b+mosMemBlockSize, size);
                 mosWriteUnsafe32(b+mosMemBlockFlags, mosMemFlagUsed);
+                mosWriteUnsafe32(b+mosMemBlockMaster, 0);
                 // update the block after the splitting block
                 mosWriteUnsafe32(next+mosMemBlockPrev, c);
                 MOS_TRACE_MEMORY( printf("-- malloc split at 0x%08X, n=%d\n", b+mosSizeofMemBlock, size); )
@@ -146,6 +271,45 @@ mosPtr mosMalloc(uint size)
     }
 }
 
+/**
+ * Allocate a block, compacting and purging the heap if needed.
+ *
+ * Like on the original Macintosh, any allocation may move unlocked relocatable
+ * blocks around.
+ *
+ * \return the address of the new block, or 0 if we are out of memory
+ */
+static mosPtr mosAllocBlock(uint size)
+{
+    if (size==0) return 0;
+    MOS_CHECK_MEMORY_COHERENCE
+    mosPtr p = mosMallocFirstFit(size);
+    if (p==0 && gMosFreeBytes>=size) {
+        mosCompactHeap(size);
+        p = mosMallocFirstFit(size);
+    }
+    if (p==0) {
+        mosPurgeHeap(size);
+        mosCompactHeap(size);
+        p = mosMallocFirstFit(size);
+    }
+    return p;
+}
+
+/**
+ * Allocate a block of memory.
+ *
+ * \return the address of the new block, or 0 if there is no memory left
+ */
+mosPtr mosMalloc(uint size)
+{
+    mosPtr p = mosAllocBlock(size);
+    if (p==0)
+        return 0;
+    MOS_RECORD_ALLOC("malloc %u 0x%08X\n", size, p)
+    return p;
+}
+
 void mosJoinBlocks(mosPtr b)
 {
     if (!b) return;
@@ -174,23 +338,46 @@ void mosJoinBlocks(mosPtr b)
     }
 
     // ok, so both blocks exist, are connected, and are free, so joint them
+    mosFreeListRemove(mosReadUnsafe32(b+mosMemBlockSize));
+    mosFreeListRemove(mosReadUnsafe32(c+mosMemBlockSize));
     mosWriteUnsafe32(d+mosMemBlockPrev, b);
     mosWriteUnsafe32(b+mosMemBlockNext, d);
     mosWriteUnsafe32(b+mosMemBlockSize, d-b-mosSizeofMemBlock);
+    mosFreeListAdd(d-b-mosSizeofMemBlock);
     // clear remainders of the memory block that we removed
     mosWriteUnsafe32(c+mosMemBlockPrev, 0);
     mosWriteUnsafe32(c+mosMemBlockNext, 0);
     mosWriteUnsafe32(c+mosMemBlockSize, 0);
     mosWriteUnsafe32(c+mosMemBlockFlags, 0);
+    mosWriteUnsafe32(c+mosMemBlockMaster, 0);
     MOS_TRACE_MEMORY( printf("-- malloc join 0x%08X - 0x%08X - 0x%08X\n", b+mosSizeofMemBlock, c+mosSizeofMemBlock, d+mosSizeofMemBlock); )
 }
 
-void mosFree(mosPtr addr)
+/**
+ * Mark a block free and join it with its free neighbours.
+ */
+static void mosReleaseBlock(mosPtr b)
+{
+    mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
+    mosWriteUnsafe32(b+mosMemBlockFlags, mosMemFlagFree);
+    mosWriteUnsafe32(b+mosMemBlockSize, next-b-mosSizeofMemBlock);
+    mosWriteUnsafe32(b+mosMemBlockMaster, 0);
+    mosFreeListAdd(next-b-mosSizeofMemBlock);
+    // optimize: if the next block is free, join both blocks
+    mosJoinBlocks(b);
+    // optimize: if the previous block is free, join both blocks
+    mosPtr prev = mosReadUnsafe32(b+mosMemBlockPrev);
+    mosJoinBlocks(prev);
+}
+
+/**
+ * Verify that addr was allocated and release it.
+ */
+static void mosFreeBlock(mosPtr addr)
 {
     MOS_TRACE_MEMORY( printf("-- malloc free at 0x%08X\n", addr); )
     MOS_CHECK_MEMORY_COHERENCE
     mosPtr b = addr - mosSizeofMemBlock;
-    mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
     uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
     if ( (flags&mosMemFlagMagicMask) != mosMemFlagMagic) {
         mosError("mosFree is trying to free a block at an invalid address 0x%08X\n", addr);
@@ -200,20 +387,21 @@ void mosFree(mosPtr addr)
         mosError("mosFree is trying to free a block a second time at address 0x%08X\n", addr);
         assert(0);
     }
-    if (flags!=mosMemFlagUsed && flags!=mosMemFlagHandles) {
+    uint32_t type = flags & mosMemFlagTypeMask;
+    if (type!=mosMemFlagUsed && type!=mosMemFlagHandles) {
         mosError("mosFree is trying to free a block that was not allocated at 0x%08X\n", addr);
         assert(0);
     }
-    mosWriteUnsafe32(b+mosMemBlockFlags, mosMemFlagFree);
-    mosWriteUnsafe32(b+mosMemBlockSize, next-b-mosSizeofMemBlock);
-    // optimize: if the next block is free, join both blocks
-    mosJoinBlocks(b);
-    // optimize: if the previous block is free, join both blocks
-    mosPtr prev = mosReadUnsafe32(b+mosMemBlockPrev);
-    mosJoinBlocks(prev);
+    mosReleaseBlock(b);
     MOS_CHECK_MEMORY_COHERENCE
 }
 
+void mosFree(mosPtr addr)
+{
+    MOS_RECORD_ALLOC("free 0x%08X\n", addr)
+    mosFreeBlock(addr);
+}
+
 /**
  Check if it is leagal to access the given range of memory.
 
@@ -237,8 +425,8 @@ bool mosCheckMemoryAccess(mosPtr address, uint32_t size)
     for (;;) {
         mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
         if (next>=last) {
-            uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
-            if (flags==mosMemFlagHandles || flags==mosMemFlagUsed) {
+            uint32_t type = mosBlockType(b);
+            if (type==mosMemFlagHandles || type==mosMemFlagUsed) {
                 uint32_t bSize = mosReadUnsafe32(b+mosMemBlockSize);
                 mosPtr bFirst = b+mosSizeofMemBlock, bLast = bFirst+bSize-1;
                 if (bFirst<=first && bLast>=last)
@@ -271,6 +459,7 @@ bool mosCheckMemoryAccess(mosPtr address, uint32_t size)
  */
 bool mosCheckMemoryCoherence()
 {
+    uint32_t freeBytes = 0, freeBlocks = 0;
     mosPtr b = mosMemBlockStart;
     if (mosReadUnsafe32(b+mosMemBlockPrev)!=0)
         mosError("mosCheckMemoryCoherency: firstBlock.prev is not NULL!\n");
@@ -284,22 +473,33 @@ bool mosCheckMemoryCoherence()
         uint32_t bFlags = mosReadUnsafe32(b+mosMemBlockFlags);
         if ( (bFlags&mosMemFlagMagicMask) != mosMemFlagMagic)
             mosError("mosCheckMemoryCoherency: missing magic value at 0x%08X\n", b+mosSizeofMemBlock);
+        uint32_t bType = bFlags & mosMemFlagTypeMask;
         uint32_t nFlags = mosReadUnsafe32(next+mosMemBlockFlags);
         if (bFlags==mosMemFlagFree && nFlags==mosMemFlagFree)
             mosError("mosCheckMemoryCoherency: a free block must not be followed by another free block!\n");
         uint32_t bSize = mosReadUnsafe32(b+mosMemBlockSize);
+        if (bFlags==mosMemFlagFree) {
+            freeBytes += bSize;
+            freeBlocks++;
+        }
         if (bFlags==mosMemFlagFree && b+mosSizeofMemBlock+bSize!=next)
             mosError("mosCheckMemoryCoherency: free block has illegal block size!\n");
-        if (bFlags==mosMemFlagUsed && b+mosSizeofMemBlock+bSize>next)
+        if (bType==mosMemFlagUsed && b+mosSizeofMemBlock+bSize>next)
             mosError("mosCheckMemoryCoherency: used block has illegal block size!\n");
-        if (bFlags==mosMemFlagHandles && (b+mosSizeofMemBlock+bSize!=next || bSize!=4))
+        if (bType==mosMemFlagHandles && (b+mosSizeofMemBlock+bSize!=next || (bSize&3)!=0))
             mosError("mosCheckMemoryCoherency: handle block has illegal block size!\n");
+        mosPtr master = mosReadUnsafe32(b+mosMemBlockMaster);
+        if (bType==mosMemFlagUsed && master && mosReadUnsafe32(master)!=b+mosSizeofMemBlock)
+            mosError("mosCheckMemoryCoherency: master pointer of relocatable block at 0x%08X does not point back\n", b+mosSizeofMemBlock);
         b = next;
     }
     if (mosReadUnsafe32(b+mosMemBlockFlags)!=mosMemFlagLast)
         mosError("mosCheckMemoryCoherency: lastBlock.flagsa must indicate last block\n");
     if (b!=kMosMemMax-mosSizeofMemBlock)
         mosError("mosCheckMemoryCoherency: lastBlock at unexpected address\n");
+    if (freeBytes!=gMosFreeBytes || freeBlocks!=gMosFreeBlockSizes.size())
+        mosError("mosCheckMemoryCoherency: free block accounting is off (%d bytes in %d blocks, expected %d in %d)\n",
+                 gMosFreeBytes, (int)gMosFreeBlockSizes.size(), freeBytes, freeBlocks);
     return true;
 }
 
@@ -317,6 +517,7 @@ void mosMemcpy(mosPtr dst, mosPtr src, uint32_t n)
     }
     void *hostDst = mosToHost(dst);
 
+    mosMarkDirty(dst, n);
     memcpy(hostDst, hostSrc, n);
 }
 
@@ -339,6 +540,7 @@ void mosMemcpy(mosPtr dst, const void *hostSrc, uint32_t n)
     }
     void *hostDst = mosToHost(dst);
 
+    mosMarkDirty(dst, n);
     memcpy(hostDst, hostSrc, n);
 }
 
@@ -349,16 +551,21 @@ mosPtr mosNewPtr(const char *text)
 {
     uint32_t size = strlen(text)+1;
     mosPtr mp = mosMalloc(size);
+    if (!mp) return 0;
     mosMemcpy(mp, text, size);
     return mp;
 }
 
 /**
  * Allocate and clear memory in the memory list.
+ *
+ * \return the new block, or 0 if there is not enough memory
  */
 mosPtr mosNewPtr(unsigned int size)
 {
     mosPtr mp = mosMalloc(size);
+    if (!mp) return 0;
+    mosMarkDirty(mp, size);
     memset(mosToHost(mp), 0, size);
     return mp;
 }
@@ -382,45 +589,237 @@ unsigned int mosPtrSize(mosPtr mp)
 }
 
 
+/**
+ * Allocate another block of master pointers.
+ *
+ * Master pointers never move, so we keep them together in nonrelocatable
+ * blocks instead of scattering them across the heap where they would get
+ * in the way of compaction.
+ */
+static void mosAllocMasters()
+{
+    mosPtr p = mosAllocBlock(4*kMosMastersPerBlock);
+    if (!p) return;
+    mosWriteUnsafe32(p-mosSizeofMemBlock+mosMemBlockFlags, mosMemFlagHandles);
+    for (uint32_t i=0; i<kMosMastersPerBlock; i++) {
+        mosPtr next = (i+1<kMosMastersPerBlock) ? p+4*(i+1) : gMosFreeMasters;
+        mosWriteUnsafe32(p+4*i, next);
+    }
+    gMosFreeMasters = p;
+}
+
+void mosMoreMasters()
+{
+    MOS_RECORD_ALLOC("moremasters\n")
+    mosAllocMasters();
+}
+
+
+/**
+ * Get an unused master pointer.
+ *
+ * \return the master pointer, or 0 if there is no memory for more masters
+ */
+static mosPtr mosNewMaster()
+{
+    if (!gMosFreeMasters)
+        mosAllocMasters();
+    if (!gMosFreeMasters)
+        return 0;
+    mosPtr mh = gMosFreeMasters;
+    gMosFreeMasters = mosReadUnsafe32(mh);
+    mosWriteUnsafe32(mh, 0);
+    return mh;
+}
+
+
+/**
+ * Make a block relocatable by linking it to its master pointer.
+ */
+static void mosAttachMaster(mosHandle hdl, mosPtr ptr, byte state)
+{
+    mosPtr b = ptr-mosSizeofMemBlock;
+    mosWriteUnsafe32(b+mosMemBlockFlags, mosMemFlagUsed | (((uint32_t)state)<<8));
+    mosWriteUnsafe32(b+mosMemBlockMaster, hdl);
+    mosWriteUnsafe32(hdl, ptr);
+}
+
+
 /**
  * Allocate memory and a master pointer and link them into the lists.
- * \note We could manage handles in blocks to make this more efficient.
+ *
+ * \return the new handle, or 0 if there is not enough memory
  */
 mosHandle mosNewHandle(unsigned int size)
 {
     if (size==0)
         return 0;
-    mosPtr mp = mosNewPtr(size);
-    mosPtr mh = mosMalloc(4);
-    mosWriteUnsafe32(mh-mosSizeofMemBlock+mosMemBlockFlags, mosMemFlagHandles);
-    mosWrite32(mh, mp);
+    mosPtr mh = mosNewMaster();
+    if (!mh)
+        return 0;
+    mosPtr mp = mosAllocBlock(size);
+    if (!mp) {
+        mosWriteUnsafe32(mh, gMosFreeMasters);
+        gMosFreeMasters = mh;
+        return 0;
+    }
+    mosMarkDirty(mp, size);
+    memset(mosToHost(mp), 0, size);
+    mosAttachMaster(mh, mp, 0);
+    MOS_RECORD_ALLOC("newhandle %u 0x%08X\n", size, mh)
     return (mosHandle)mh;
 }
 
 
+/**
+ * Return the memory block header of a relocatable block, or 0 for an empty handle.
+ */
+static mosPtr mosHandleBlock(mosHandle hdl)
+{
+    if (!hdl) return 0;
+    mosPtr ptr = mosReadUnsafe32(hdl);
+    if (!ptr) return 0;
+    return ptr-mosSizeofMemBlock;
+}
+
+
+/**
+ * Resize a block without moving it.
+ *
+ * A block can always shrink. It can grow if it is followed by a free block
+ * that is large enough.
+ *
+ * \return true, if the block now has the requested size
+ */
+static bool mosResizeBlock(mosPtr b, unsigned int newSize)
+{
+    mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
+    uint32_t needed = mosSizeofMemBlock + ((newSize + 3) & ~0x00000003);
+    uint32_t available = next - b;
+    if (needed<=available) {
+        // shrink the block and return the tail to the heap if it's worth it
+        if (available-needed>mosSizeofMemBlock) {
+            mosPtr c = b + needed;
+            mosWriteUnsafe32(c+mosMemBlockPrev, b);
+            mosWriteUnsafe32(c+mosMemBlockNext, next);
+            mosWriteUnsafe32(c+mosMemBlockFlags, mosMemFlagUsed);
+            mosWriteUnsafe32(c+mosMemBlockMaster, 0);
+            mosWriteUnsafe32(b+mosMemBlockNext, c);
+            mosWriteUnsafe32(next+mosMemBlockPrev, c);
+            mosReleaseBlock(c);
+        }
+        mosWriteUnsafe32(b+mosMemBlockSize, newSize);
+        return true;
+    }
+    if (mosReadUnsafe32(next+mosMemBlockFlags)!=mosMemFlagFree)
+        return false;
+    mosPtr nextNext = mosReadUnsafe32(next+mosMemBlockNext);
+    available = nextNext - b;
+    if (needed>available)
+        return false;
+    // grow into the following free block
+    mosFreeListRemove(mosReadUnsafe32(next+mosMemBlockSize));
+    mosWriteUnsafe32(next+mosMemBlockPrev, 0);
+    mosWriteUnsafe32(next+mosMemBlockNext, 0);
+    mosWriteUnsafe32(next+mosMemBlockSize, 0);
+    mosWriteUnsafe32(next+mosMemBlockFlags, 0);
+    mosWriteUnsafe32(next+mosMemBlockMaster, 0);
+    if (available-needed>mosSizeofMemBlock) {
+        mosPtr c = b + needed;
+        mosWriteUnsafe32(c+mosMemBlockPrev, b);
+        mosWriteUnsafe32(c+mosMemBlockNext, nextNext);
+        mosWriteUnsafe32(c+mosMemBlockSize, nextNext-c-mosSizeofMemBlock);
+        mosWriteUnsafe32(c+mosMemBlockFlags, mosMemFlagFree);
+        mosWriteUnsafe32(c+mosMemBlockMaster, 0);
+        mosFreeListAdd(nextNext-c-mosSizeofMemBlock);
+        mosWriteUnsafe32(b+mosMemBlockNext, c);
+        mosWriteUnsafe32(nextNext+mosMemBlockPrev, c);
+    } else {
+        mosWriteUnsafe32(b+mosMemBlockNext, nextNext);
+        mosWriteUnsafe32(nextNext+mosMemBlockPrev, b);
+    }
+    mosWriteUnsafe32(b+mosMemBlockSize, newSize);
+    return true;
+}
+
+
 /**
  * Reallocate the memory block with a new size.
+ *
+ * The block is resized in place if possible. Otherwise, unlocked blocks are
+ * moved to a new location.
+ *
+ * \return 0, or mosMemFullErr or mosNilHandleErr
  */
-int mosSetHandleSize(mosHandle hdl, unsigned int newSize)
+static int mosResizeHandle(mosHandle hdl, unsigned int newSize)
 {
     // get the old allocation data
     mosPtr oldPtr = mosRead32(hdl);
+    if (!oldPtr)
+        return mosNilHandleErr;
     unsigned int oldSize = mosPtrSize(oldPtr);
 
     if (newSize==oldSize)
         return 0;
 
-    // allocate a new block
-    mosPtr newPtr = mosMalloc(newSize);
-    mosWrite32(hdl, newPtr);
+    mosPtr b = oldPtr-mosSizeofMemBlock;
+    if (mosResizeBlock(b, newSize))
+        return 0;
+
+    uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
+    if (flags & (kMosHandleLocked<<8))
+        return mosMemFullErr;
+
+    // allocate a new block, and make sure that compaction does not move the old one meanwhile
+    mosWriteUnsafe32(b+mosMemBlockFlags, flags | (kMosHandleLocked<<8));
+    mosPtr newPtr = mosAllocBlock(newSize);
+    mosWriteUnsafe32(b+mosMemBlockFlags, flags);
+    if (!newPtr)
+        return mosMemFullErr;
 
     // copy the old contents over
     unsigned int size = (newSize<oldSize)?newSize:oldSize;
     mosMemcpy(newPtr, oldPtr, size);
+    mosAttachMaster(hdl, newPtr, (flags & mosMemFlagStateMask)>>8);
 
     // free the old allocation
-    mosFree(oldPtr);
+    mosWriteUnsafe32(b+mosMemBlockMaster, 0);
+    mosFreeBlock(oldPtr);
+
+    return 0;
+}
+
+int mosSetHandleSize(mosHandle hdl, unsigned int newSize)
+{
+    int err = mosResizeHandle(hdl, newSize);
+    MOS_RECORD_ALLOC("sethandlesize 0x%08X %u %d\n", hdl, newSize, err)
+    return err;
+}
 
+
+/**
+ * Allocate a new block of memory for an existing, possibly empty, handle.
+ *
+ * The previous content of the handle is lost.
+ *
+ * \return 0, or mosMemFullErr
+ */
+int mosReallocHandle(mosHandle hdl, unsigned int size)
+{
+    mosPtr b = mosHandleBlock(hdl);
+    byte state = 0;
+    if (b) {
+        state = (mosReadUnsafe32(b+mosMemBlockFlags) & mosMemFlagStateMask)>>8;
+        mosFreeBlock(b+mosSizeofMemBlock);
+        mosWriteUnsafe32(hdl, 0);
+    }
+    MOS_RECORD_ALLOC("reallochandle 0x%08X %u\n", hdl, size)
+    mosPtr ptr = mosAllocBlock(size);
+    if (!ptr)
+        return mosMemFullErr;
+    mosMarkDirty(ptr, size);
+    memset(mosToHost(ptr), 0, size);
+    mosAttachMaster(hdl, ptr, state & ~kMosHandleLocked);
     return 0;
 }
 
@@ -431,13 +830,35 @@ int mosSetHandleSize(mosHandle hdl, unsigned int newSize)
 void mosDisposeHandle(mosHandle hdl)
 {
     if (!hdl) return;
+    MOS_RECORD_ALLOC("disposehandle 0x%08X\n", hdl)
 
     mosPtr ptr = mosRead32(hdl);
     if (ptr) {
-        mosFree(ptr);
+        mosFreeBlock(ptr);
     }
 
-    mosFree(hdl);
+    // return the master pointer to the pool
+    mosWriteUnsafe32(hdl, gMosFreeMasters);
+    gMosFreeMasters = hdl;
+}
+
+
+/**
+ * Free the memory of a relocatable block, but keep the master pointer.
+ *
+ * \return 0, or mosMemPurErr if the block is locked
+ */
+int mosEmptyHandle(mosHandle hdl)
+{
+    mosPtr b = mosHandleBlock(hdl);
+    if (!b)
+        return 0;
+    if (mosReadUnsafe32(b+mosMemBlockFlags) & (kMosHandleLocked<<8))
+        return mosMemPurErr;
+    MOS_RECORD_ALLOC("emptyhandle 0x%08X\n", hdl)
+    mosFreeBlock(b+mosSizeofMemBlock);
+    mosWriteUnsafe32(hdl, 0);
+    return 0;
 }
 
 
@@ -449,24 +870,361 @@ void mosDisposeHandle(mosHandle hdl)
  */
 mosHandle mosRecoverHandle(mosPtr addr)
 {
+    if (addr<mosMemBlockStart+mosSizeofMemBlock || addr>=kMosMemMax)
+        return 0;
+    mosPtr b = addr-mosSizeofMemBlock;
+    if (mosBlockType(b)!=mosMemFlagUsed)
+        return 0;
+    mosPtr master = mosReadUnsafe32(b+mosMemBlockMaster);
+    if (master && mosReadUnsafe32(master)==addr)
+        return master;
+    return 0;
+}
+
+
+/**
+ Get the state of a relocatable block.
+
+ \param hdl handle to the block
+ \return a combination of kMosHandleLocked, kMosHandlePurgeable, and kMosHandleResource,
+    or mosNilHandleErr if the handle is empty
+ */
+int mosHGetState(mosHandle hdl)
+{
+    mosPtr b = mosHandleBlock(hdl);
+    if (!b)
+        return mosNilHandleErr;
+    return (mosReadUnsafe32(b+mosMemBlockFlags) & mosMemFlagStateMask)>>8;
+}
+
+
+/**
+ Set the state of a relocatable block.
+
+ \param hdl handle to the block
+ \param state a combination of kMosHandleLocked, kMosHandlePurgeable, and kMosHandleResource
+ \return 0, or mosNilHandleErr if the handle is empty
+ */
+int mosHSetState(mosHandle hdl, byte state)
+{
+    mosPtr b = mosHandleBlock(hdl);
+    if (!b)
+        return mosNilHandleErr;
+    MOS_RECORD_ALLOC("hsetstate 0x%08X %u\n", hdl, state)
+    uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags) & ~mosMemFlagStateMask;
+    mosWriteUnsafe32(b+mosMemBlockFlags, flags | (((uint32_t)state)<<8));
+    return 0;
+}
+
+
+/**
+ * Return the total number of free bytes in the heap.
+ */
+uint32_t mosFreeMem()
+{
+    return gMosFreeBytes;
+}
+
+
+/**
+ * Return the number of bytes from the start of the heap to the end of the
+ * highest block that is in use.
+ *
+ * \param freeInside if not NULL, receives the number of free bytes in that range
+ */
+uint32_t mosHeapFootprint(uint32_t *freeInside)
+{
+    mosPtr lastBlock = kMosMemMax - mosSizeofMemBlock;
+    mosPtr top = lastBlock;
+    uint32_t freeAtTop = 0;
+    mosPtr prev = mosReadUnsafe32(lastBlock+mosMemBlockPrev);
+    if (mosReadUnsafe32(prev+mosMemBlockFlags)==mosMemFlagFree) {
+        top = prev;
+        freeAtTop = mosReadUnsafe32(prev+mosMemBlockSize);
+    }
+    if (freeInside)
+        *freeInside = gMosFreeBytes - freeAtTop;
+    return top - mosMemBlockStart;
+}
+
+
+/**
+ * Return the size of the largest free block in the heap.
+ */
+uint32_t mosMaxBlock()
+{
+    if (gMosFreeBlockSizes.empty())
+        return 0;
+    return *gMosFreeBlockSizes.rbegin();
+}
+
+
+/**
+ * Move a relocatable block down into the free block right before it.
+ *
+ * \param f a free block
+ * \param b the unlocked relocatable block following f
+ */
+static void mosSlideBlockDown(mosPtr f, mosPtr b)
+{
+    mosPtr prev = mosReadUnsafe32(f+mosMemBlockPrev);
+    mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
+    uint32_t freeSize = mosReadUnsafe32(f+mosMemBlockSize);
+    uint32_t blockSize = next-b;
+    mosPtr master = mosReadUnsafe32(b+mosMemBlockMaster);
+    MOS_TRACE_MEMORY( printf("-- compact 0x%08X to 0x%08X, n=%d\n", b+mosSizeofMemBlock, f+mosSizeofMemBlock, blockSize); )
+    // move header and data, the free block now follows the moved block
+    mosMarkDirty(f, blockSize);
+    memmove(mosToHost(f), mosToHost(b), blockSize);
+    mosPtr g = f + blockSize;
+    mosWriteUnsafe32(f+mosMemBlockPrev, prev);
+    mosWriteUnsafe32(f+mosMemBlockNext, g);
+    mosWriteUnsafe32(g+mosMemBlockPrev, f);
+    mosWriteUnsafe32(g+mosMemBlockNext, next);
+    mosWriteUnsafe32(g+mosMemBlockSize, freeSize);
+    mosWriteUnsafe32(g+mosMemBlockFlags, mosMemFlagFree);
+    mosWriteUnsafe32(g+mosMemBlockMaster, 0);
+    mosWriteUnsafe32(next+mosMemBlockPrev, g);
+    mosWriteUnsafe32(master, f+mosSizeofMemBlock);
+    mosJoinBlocks(g);
+}
+
+
+/**
+ Compact the heap by sliding unlocked relocatable blocks down.
+
+ Blocks move until they hit a nonrelocatable or locked block. Compaction stops
+ early as soon as a free block of the requested size is available.
+
+ \param needed stop compacting when a free block of this size was found
+ \return size of the largest free block
+ */
+static uint32_t mosCompactHeap(uint32_t needed)
+{
+    MOS_CHECK_MEMORY_COHERENCE
     mosPtr b = mosMemBlockStart;
     for (;;) {
         mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
+        if (next==0) break;
+        if (mosReadUnsafe32(b+mosMemBlockFlags)==mosMemFlagFree) {
+            uint32_t nextFlags = mosReadUnsafe32(next+mosMemBlockFlags);
+            if ((nextFlags&mosMemFlagTypeMask)==mosMemFlagUsed
+                && mosReadUnsafe32(next+mosMemBlockMaster)
+                && !(nextFlags & (kMosHandleLocked<<8)))
+            {
+                mosSlideBlockDown(b, next);
+                // continue with the free block that now follows the moved block
+                b = mosReadUnsafe32(b+mosMemBlockNext);
+                continue;
+            }
+            if (mosReadUnsafe32(b+mosMemBlockSize)>=needed)
+                break;
+        }
+        b = next;
+    }
+    MOS_CHECK_MEMORY_COHERENCE
+    return mosMaxBlock();
+}
+
+uint32_t mosCompactMem(uint32_t needed)
+{
+    MOS_RECORD_ALLOC("compactmem %u\n", needed)
+    return mosCompactHeap(needed);
+}
+
+
+/**
+ Free all unlocked, purgeable blocks.
+
+ The master pointers of purged blocks are set to NULL, but stay allocated.
+
+ \param needed stop purging when a free block of this size was found
+ \return 0, or mosMemFullErr if there is still no free block of the requested size
+ */
+static int mosPurgeHeap(uint32_t needed)
+{
+    MOS_CHECK_MEMORY_COHERENCE
+    mosPtr b = mosMemBlockStart;
+    while (mosMaxBlock()<needed) {
+        mosPtr next = mosReadUnsafe32(b+mosMemBlockNext);
+        if (next==0) break;
         uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
-        if (flags==mosMemFlagHandles) {
-            mosPtr ptr = mosRead32(b+mosSizeofMemBlock);
-            if (ptr==addr)
-                return b+mosSizeofMemBlock;
+        mosPtr master = mosReadUnsafe32(b+mosMemBlockMaster);
+        if ((flags&mosMemFlagTypeMask)==mosMemFlagUsed && master
+            && (flags & (kMosHandlePurgeable<<8))
+            && !(flags & (kMosHandleLocked<<8)))
+        {
+            MOS_TRACE_MEMORY( printf("-- purge 0x%08X\n", b+mosSizeofMemBlock); )
+            mosPtr prev = mosReadUnsafe32(b+mosMemBlockPrev);
+            mosWriteUnsafe32(master, 0);
+            mosReleaseBlock(b);
+            // if the previous block was free, our block was merged into it
+            if (mosReadUnsafe32(b+mosMemBlockFlags)==0)
+                b = prev;
+            next = mosReadUnsafe32(b+mosMemBlockNext);
         }
         b = next;
-        if (b==0)
-            return 0;
     }
+    MOS_CHECK_MEMORY_COHERENCE
+    return (mosMaxBlock()<needed) ? mosMemFullErr : 0;
+}
+
+int mosPurgeMem(uint32_t needed)
+{
+    MOS_RECORD_ALLOC("purgemem %u\n", needed)
+    return mosPurgeHeap(needed);
+}
+
+
+/**
+ Purge and compact the heap and return the largest free block.
+ */
+uint32_t mosMaxMem()
+{
+    MOS_RECORD_ALLOC("maxmem\n")
+    mosPurgeHeap(0xffffffff);
+    return mosCompactHeap(0xffffffff);
 }
 
+
+/**
+ Move a relocatable block as high up in the heap as possible.
+
+ This keeps long lived blocks from fragmenting the heap.
+
+ \param hdl handle to the block
+ \return 0, mosNilHandleErr, or mosMemLockedErr
+ */
+int mosMoveHHi(mosHandle hdl)
+{
+    mosPtr b = mosHandleBlock(hdl);
+    if (!b)
+        return mosNilHandleErr;
+    uint32_t flags = mosReadUnsafe32(b+mosMemBlockFlags);
+    if (flags & (kMosHandleLocked<<8))
+        return mosMemLockedErr;
+    MOS_RECORD_ALLOC("movehhi 0x%08X\n", hdl)
+    uint32_t blockSize = mosReadUnsafe32(b+mosMemBlockNext) - b;
+    // find the highest free block above our block that can hold it
+    mosPtr f = mosReadUnsafe32(kMosMemMax-mosSizeofMemBlock+mosMemBlockPrev);
+    for (;;) {
+        if (f<=b)
+            return 0; // nothing to do, the block is already as high as it gets
+        if (mosReadUnsafe32(f+mosMemBlockFlags)==mosMemFlagFree) {
+            uint32_t freeSize = mosReadUnsafe32(f+mosMemBlockSize);
+            if (freeSize+mosSizeofMemBlock==blockSize || freeSize>blockSize)
+                break;
+        }
+        f = mosReadUnsafe32(f+mosMemBlockPrev);
+    }
+    MOS_CHECK_MEMORY_COHERENCE
+    // use the top end of the free block
+    mosPtr next = mosReadUnsafe32(f+mosMemBlockNext);
+    uint32_t freeSize = mosReadUnsafe32(f+mosMemBlockSize);
+    mosPtr prev = f;
+    mosPtr t = next - blockSize;
+    mosFreeListRemove(freeSize);
+    if (t==f) {
+        prev = mosReadUnsafe32(f+mosMemBlockPrev);
+    } else {
+        mosWriteUnsafe32(f+mosMemBlockSize, t-f-mosSizeofMemBlock);
+        mosWriteUnsafe32(f+mosMemBlockNext, t);
+        mosFreeListAdd(t-f-mosSizeofMemBlock);
+    }
+    mosMarkDirty(t, blockSize);
+    memcpy(mosToHost(t), mosToHost(b), blockSize);
+    mosWriteUnsafe32(t+mosMemBlockPrev, prev);
+    mosWriteUnsafe32(t+mosMemBlockNext, next);
+    mosWriteUnsafe32(prev+mosMemBlockNext, t);
+    mosWriteUnsafe32(next+mosMemBlockPrev, t);
+    mosWriteUnsafe32(hdl, t+mosSizeofMemBlock);
+    // and release the original block
+    mosReleaseBlock(b);
+    MOS_CHECK_MEMORY_COHERENCE
+    return 0;
+}
+
+/**
+ Take a snapshot of emulated RAM and the memory manager state.
+
+ From here on, all writes into RAM are tracked, so that mosRestoreSnapshot()
+ only needs to copy the pages that changed.
+ */
+void mosTakeSnapshot()
+{
+    if (!gMosSnapshotMem)
+        gMosSnapshotMem = (byte*)malloc(kMosMemMax);
+    memcpy(gMosSnapshotMem, MosMem, kMosMemMax);
+    memset(gMosDirtyPages, 0, sizeof(gMosDirtyPages));
+    gMosSnapshotFreeMasters = gMosFreeMasters;
+    gMosSnapshotFreeBytes = gMosFreeBytes;
+    gMosSnapshotFreeBlockSizes = gMosFreeBlockSizes;
+}
+
+
+/**
+ Reset emulated RAM and the memory manager to the last snapshot.
+
+ \return the number of pages that were copied
+ */
+uint32_t mosRestoreSnapshot()
+{
+    uint32_t n = 0;
+    if (!gMosSnapshotMem)
+        return 0;
+    for (uint32_t p=0; p<kMosNumPages; p++) {
+        if (gMosDirtyPages[p]) {
+            uint32_t offset = p<<kMosPageShift;
+            memcpy(MosMem+offset, gMosSnapshotMem+offset, 1<<kMosPageShift);
+            gMosDirtyPages[p] = 0;
+            n++;
+        }
+    }
+    gMosFreeMasters = gMosSnapshotFreeMasters;
+    gMosFreeBytes = gMosSnapshotFreeBytes;
+    gMosFreeBlockSizes = gMosSnapshotFreeBlockSizes;
+    MOS_CHECK_MEMORY_COHERENCE
+    return n;
+}
+
+
+/**
+ Add the memory manager state to a snapshot file.
+
+ The RAM itself is saved page by page by mosSaveSnapshot().
+ */
+void mosSaveHeapState(MosSnapshotState &state)
+{
+    mosSnapshotWrite(state, gMosFreeMasters);
+    mosSnapshotWrite(state, gMosFreeBytes);
+    mosSnapshotWrite(state, (uint32_t)gMosFreeBlockSizes.size());
+    for (uint32_t size: gMosFreeBlockSizes)
+        mosSnapshotWrite(state, size);
+}
+
+
+/**
+ Read the memory manager state from a snapshot file.
+
+ \return false if the state is incomplete
+ */
+bool mosLoadHeapState(MosSnapshotReader &reader)
+{
+    gMosFreeMasters = mosSnapshotRead(reader);
+    gMosFreeBytes = mosSnapshotRead(reader);
+    uint32_t n = mosSnapshotRead(reader);
+    gMosFreeBlockSizes.clear();
+    for (uint32_t i=0; i<n && !reader.failed; i++)
+        gMosFreeBlockSizes.insert(mosSnapshotRead(reader));
+    MOS_CHECK_MEMORY_COHERENCE
+    return !reader.failed;
+}
+
+
 void mosWriteUnsafe64(mosPtr addr, uintptr_t value)
 {
     byte *d = (byte*)mosToHost(addr);
+    mosMarkDirty(addr, 8);
     *d++ = value>>56;
     *d++ = value>>48;
     *d++ = value>>40;
@@ -484,6 +1242,7 @@ void mosWriteUnsafe64(mosPtr addr, uintptr_t value)
 void mosWriteUnsafe32(mosPtr addr, unsigned int value)
 {
     byte *d = (byte*)mosToHost(addr);
+    mosMarkDirty(addr, 4);
     *d++ = value>>24;
     *d++ = value>>16;
     *d++ = value>>8;
@@ -510,6 +1269,7 @@ void mosWrite32(mosPtr addr, unsigned int value)
 void mosWriteUnsafe16(mosPtr addr, unsigned short value)
 {
     byte *d = (byte*)mosToHost(addr);
+    mosMarkDirty(addr, 2);
     *d++ = value>>8;
     *d++ = value>>0;
 //    *((unsigned short*)(addr)) = htons(value);
@@ -535,6 +1295,7 @@ void mosWrite16(mosPtr addr, unsigned short value)
 void mosWriteUnsafe8(mosPtr addr, unsigned char value)
 {
     byte *d = (byte*)mosToHost(addr);
+    mosMarkDirty(addr, 1);
     *d++ = value>>0;
 //    *((unsigned char*)(addr)) = value;
 }
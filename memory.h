@@ -25,11 +25,26 @@
 
 
 #include "main.h"
+#include "snapshot.h"
+
+#include <stdio.h>
 
 extern byte *MosMem;
 
+// state flags of relocatable blocks as returned by HGetState()
+const byte kMosHandleResource  = 0x20;
+const byte kMosHandlePurgeable = 0x40;
+const byte kMosHandleLocked    = 0x80;
+
 void mosMemoryInit();
 bool mosCheckMemoryCoherence();
+void mosRecordAllocTo(FILE *f);
+
+void mosMarkDirty(mosPtr addr, uint32_t n);
+void mosTakeSnapshot();
+uint32_t mosRestoreSnapshot();
+void mosSaveHeapState(MosSnapshotState &state);
+bool mosLoadHeapState(MosSnapshotReader &reader);
 
 void *mosToHost(mosPtr);
 mosPtr hostToMos(void*);
@@ -65,6 +80,20 @@ mosHandle mosNewHandle(unsigned int size);
 void mosDisposeHandle(mosHandle);
 mosHandle mosRecoverHandle(mosPtr);
 int mosSetHandleSize(mosHandle, unsigned int);
+int mosReallocHandle(mosHandle, unsigned int);
+int mosEmptyHandle(mosHandle);
+void mosMoreMasters();
+
+int mosHGetState(mosHandle);
+int mosHSetState(mosHandle, byte state);
+int mosMoveHHi(mosHandle);
+
+uint32_t mosFreeMem();
+uint32_t mosMaxBlock();
+uint32_t mosMaxMem();
+uint32_t mosHeapFootprint(uint32_t *freeInside);
+uint32_t mosCompactMem(uint32_t needed);
+int mosPurgeMem(uint32_t needed);
 
 unsigned int mosCheckBounds(mosPtr, unsigned int size);
 
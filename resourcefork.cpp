@@ -25,12 +25,132 @@
 #include "breakpoints.h"
 #include "log.h"
 #include "systemram.h"
+#include "compress.h"
 
 #include <string.h>
 
+#include <iterator>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
-unsigned int gResourceStart[20] = { 0 };
-unsigned int gResourceEnd[20] = { 0 };
+
+// All code segments that are currently loaded, sorted by their start address,
+// and the start address of every segment by its segment ID.
+static std::map<unsigned int, MosSegment> gSegments;
+static std::unordered_map<int, unsigned int> gSegmentStart;
+
+// the entries of the jump table, set up by createA5World()
+static mosPtr gJumpTableStart = 0;
+static mosPtr gJumpTableEnd = 0;
+
+// Host side index of the resource map, built by readResourceMap(). All entries
+// point to the reference list entry of a resource in the resource map.
+static std::unordered_map<uint64_t, mosPtr> gRsrcIdIndex;
+static std::unordered_map<std::string, mosPtr> gRsrcNameIndex;
+static std::unordered_map<uint32_t, std::vector<mosPtr> > gRsrcTypeIndex; // in the order of the map
+
+// The reference list entry and the type of every resource that has a handle.
+// Entries are added when a handle is created, and checked against the map
+// when they are used, so entries from before a batch job reset do no harm.
+typedef struct {
+    mosPtr refEntry;
+    unsigned int resType;
+} MosRsrcHandleEntry;
+static std::unordered_map<mosHandle, MosRsrcHandleEntry> gRsrcHandleIndex;
+
+
+/**
+ * Check if a range of bytes is inside the tool image.
+ */
+static bool appContains(unsigned int offset, unsigned int size)
+{
+    return offset<=theAppSize && size<=theAppSize-offset;
+}
+
+
+/**
+ * Read a big endian value from the tool image in host memory.
+ *
+ * \return the value, or 0 if the offset is outside of the image
+ */
+static unsigned int appRead32(unsigned int offset)
+{
+    if (!appContains(offset, 4))
+        return 0;
+    const byte *p = theApp+offset;
+    return (p[0]<<24) | (p[1]<<16) | (p[2]<<8) | p[3];
+}
+
+
+/**
+ * Create the index key for a resource type and ID.
+ */
+static uint64_t rsrcIdKey(unsigned int resType, unsigned short id)
+{
+    return (((uint64_t)resType)<<16) | id;
+}
+
+
+/**
+ * Create the index key for a resource type and a Pascal string name.
+ */
+static std::string rsrcNameKey(unsigned int resType, const byte *pName)
+{
+    std::string key((const char*)pName, pName[0]+1);
+    key.append(1, (char)(resType>>24)).append(1, (char)(resType>>16));
+    key.append(1, (char)(resType>>8)).append(1, (char)resType);
+    return key;
+}
+
+
+/**
+ * Add a code segment to the segment registry.
+ *
+ * A segment that is already registered with the same ID is replaced.
+ *
+ * \param id the resource ID of the CODE resource, or kMosJumpTableSegment
+ * \param start address of the first instruction
+ * \param end address after the last byte of the segment
+ * \param name name of the segment, may be empty
+ */
+void registerSegment(int id, unsigned int start, unsigned int end, const std::string &name)
+{
+    auto it = gSegmentStart.find(id);
+    if (it!=gSegmentStart.end()) {
+        gSegments.erase(it->second);
+        gSegmentStart.erase(it);
+    }
+    // remove segments that were overwritten by this one
+    auto ov = gSegments.lower_bound(start);
+    if (ov!=gSegments.begin() && std::prev(ov)->second.end>start)
+        ov = std::prev(ov);
+    while (ov!=gSegments.end() && ov->first<end) {
+        gSegmentStart.erase(ov->second.id);
+        ov = gSegments.erase(ov);
+    }
+    MosSegment seg = { id, start, end, name };
+    gSegments[start] = seg;
+    gSegmentStart[id] = start;
+}
+
+
+/**
+ * Find the code segment that contains an address.
+ *
+ * \return the segment, or nullptr if the address is not inside a segment
+ */
+const MosSegment *findSegment(unsigned int addr)
+{
+    auto it = gSegments.upper_bound(addr);
+    if (it==gSegments.begin())
+        return nullptr;
+    --it;
+    if (addr>=it->second.end)
+        return nullptr;
+    return &it->second;
+}
 
 
 /**
@@ -45,14 +165,14 @@ const char *printAddr(unsigned int addr)
     currBuf = (currBuf+1) & 7;
     char *dst = buf[currBuf];
 
-    int i = 0;
-    for (i=0; i<20; i++) {
-        if (addr>=gResourceStart[i] && addr<gResourceEnd[i]) {
-            sprintf(dst, "%02d.%05X", i, addr-gResourceStart[i]);
-            return dst;
-        }
+    const MosSegment *seg = findSegment(addr);
+    if (!seg) {
+        sprintf(dst, "%08X", addr);
+    } else if (seg->id==kMosJumpTableSegment) {
+        sprintf(dst, "JT.%05X", addr-seg->start);
+    } else {
+        sprintf(dst, "%02d.%05X", seg->id, addr-seg->start);
     }
-    sprintf(dst, "%08X", addr);
     return dst;
 }
 
@@ -65,7 +185,7 @@ const char *printAddr(unsigned int addr)
 void dumpResourceMap()
 {
     unsigned int i = 0, j = 0;
-    unsigned int rsrcData = m68k_read_memory_32((unsigned int)(theApp));
+    unsigned int rsrcData = appRead32(0);
     // ---- read the map
     unsigned int rsrcMapTypeList = m68k_read_memory_16((unsigned int)(theRsrc+24));
     unsigned int rsrcMapNameList = m68k_read_memory_16((unsigned int)(theRsrc+26));
@@ -92,7 +212,7 @@ void dumpResourceMap()
                      data,
                      m68k_read_memory_32((unsigned int)(theRsrc+resTable+12*j+8)),
                      m68k_read_memory_8((unsigned int)(theRsrc+resTable+12*j+4)),
-                     m68k_read_memory_32((unsigned int)(theApp+rsrcData+data))
+                     appRead32(rsrcData+data)
                      );
             if (name!=0xffff) {
                 unsigned short rsrcNameOffset = m68k_read_memory_16((unsigned int)(theRsrc+resTable+12*j+2));
@@ -110,7 +230,6 @@ void dumpResourceMap()
             // 0x10: locked
             // 0x20: purgeable
             // 0x40: system heap
-            m68k_write_memory_32((unsigned int)(theRsrc+resTable+12*j+8), 0); // FIXME: ugly hack!
         }
     }
     //unsigned int rsrcMapNameList = m68k_read_memory_16(rsrcMap + 26);
@@ -118,6 +237,118 @@ void dumpResourceMap()
 }
 
 
+/**
+ * Return the name of a resource as listed in the resource map.
+ */
+static std::string resourceName(mosPtr refEntry)
+{
+    unsigned int nameOffset = mosRead16(refEntry+2);
+    if (nameOffset==0xffff)
+        return std::string();
+    mosPtr name = theRsrc + mosRead16(theRsrc+26) + nameOffset;
+    return std::string((const char*)mosToHost(name+1), mosRead8(name));
+}
+
+
+/**
+ * Copy the data of a resource from the file image into a handle.
+ *
+ * If hdl is 0, a new handle is allocated. Otherwise, the resource was purged
+ * and is reloaded into the existing master pointer.
+ *
+ * \param refEntry address of the reference list entry in the resource map
+ * \param myResType type of the resource
+ * \param myId ID of the resource
+ * \param hdl 0, or the empty handle of a purged resource
+ * \return the handle of the resource, or 0 if we are out of memory
+ */
+static mosHandle loadResourceData(mosPtr refEntry, unsigned int myResType, unsigned short myId, mosHandle hdl)
+{
+    // resource must be copied from the file into memory
+    if (gMosResLoad==0) {
+        mosDebug("WARNING: Automatic Resource loading is disabled!\n");
+    }
+    mosTrace("Resource found, loading...\n");
+    unsigned int rsrcOffset = (m68k_read_memory_32((unsigned int)(refEntry+4)) & 0xffffff);
+    unsigned int rsrcAttr = m68k_read_memory_8((unsigned int)(refEntry+4));
+    unsigned int rsrcData = appRead32(0);
+    unsigned int rsrcSize = appRead32(rsrcData+rsrcOffset);
+    unsigned int packedSize = theAppCompressed ? appRead32(rsrcData+rsrcOffset+4) : rsrcSize;
+    unsigned int header = theAppCompressed ? 8 : 4;
+    if (!appContains(rsrcData+rsrcOffset, header)
+        || !appContains(rsrcData+rsrcOffset+header, packedSize)) {
+        mosError("Resource '%c%c%c%c', ID %d is outside of the resource fork!\n",
+                 myResType>>24, myResType>>16, myResType>>8, myResType, myId);
+        return 0;
+    }
+
+    bool reload = (hdl!=0);
+    if (reload) {
+        if (mosReallocHandle(hdl, rsrcSize)!=0)
+            return 0;
+    } else {
+        hdl = mosNewHandle(rsrcSize);
+        if (!hdl)
+            return 0;
+    }
+    mosPtr ptr = mosRead32(hdl);
+    if (theAppCompressed) {
+        // see compressResourceFork() for the layout
+        if (packedSize==rsrcSize) {
+            mosMemcpy(ptr, theApp+rsrcData+rsrcOffset+8, rsrcSize);
+        } else {
+            mosMarkDirty(ptr, rsrcSize);
+            if (mosDecompress(theApp+rsrcData+rsrcOffset+8, packedSize, (byte*)mosToHost(ptr), rsrcSize)==-1) {
+                mosError("Resource '%c%c%c%c', ID %d is corrupt!\n",
+                         myResType>>24, myResType>>16, myResType>>8, myResType, myId);
+                // a purged resource stays purged, a new handle is not needed
+                if (reload)
+                    mosEmptyHandle(hdl);
+                else
+                    mosDisposeHandle(hdl);
+                return 0;
+            }
+        }
+    } else {
+        mosMemcpy(ptr, theApp+rsrcData+rsrcOffset+4, rsrcSize);
+    }
+    // make the resource map point to the resource handle
+    m68k_write_memory_32((unsigned int)(refEntry+8), hdl);
+    gRsrcHandleIndex[hdl] = { refEntry, myResType };
+    // apply the resource attributes to the handle; code segments never move
+    byte state = kMosHandleResource;
+    if (rsrcAttr & 0x20) state |= kMosHandlePurgeable;
+    if ((rsrcAttr & 0x10) || myResType=='CODE') state |= kMosHandleLocked;
+    mosHSetState(hdl, state);
+    // set breakpoints
+    if (myResType=='CODE') {
+        unsigned int start = (unsigned int)(ptr+4);
+        if (mosRead16(ptr)==0xffff)
+            start += 0x24;
+        installBreakpoints(myId, start);
+        std::string name = resourceName(refEntry);
+        registerSegment(myId, start, (unsigned int)(ptr+4) + rsrcSize, name);
+        mosTrace("Resource %d '%s' from 0x%08X to 0x%08X\n", myId, name.c_str(), start, (unsigned int)(ptr+4) + rsrcSize);
+    }
+    return hdl;
+}
+
+
+/**
+ * Return the handle of a resource, loading it if needed.
+ */
+static mosHandle getResourceHandle(mosPtr refEntry, unsigned int resType)
+{
+    mosHandle handle = mosRead32(refEntry+8);
+    if (handle && mosRead32(handle)) {
+        // resource is already in RAM
+        mosTrace("Resource already loaded\n");
+        return handle;
+    }
+    return loadResourceData(refEntry, resType, mosRead16(refEntry), handle);
+}
+
+
 /**
  * Finds and loads the given resource, and returns a handle to it
  * Resource Data in Memory:
@@ -125,140 +356,130 @@ void dumpResourceMap()
  * Size: 4 bytes
  * Content: n bytes
  *
- * \todo This function urgently needs refactoring.
  * \todo this ignores the "do not load" flag in system memory
  */
 mosHandle GetResource(unsigned int myResType, unsigned short myId)
 {
-    unsigned int i = 0, j = 0;
-    // ---- read the map
-    unsigned int rsrcMapTypeList = m68k_read_memory_16((unsigned int)(theRsrc+24));
-    // ------ resource map type list
-    unsigned int rsrcMapTypeListSize = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList)) + 1;
-    for (i=0; i<rsrcMapTypeListSize; i++) {
-        unsigned int nRes = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList+8*i+6)) + 1;
-        unsigned int resTable = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList+8*i+8)) + rsrcMapTypeList;
-        unsigned int resType = m68k_read_memory_32((unsigned int)(theRsrc+rsrcMapTypeList+8*i+2));
-        if (resType==myResType) {
-            for (j=0; j<nRes; j++) {
-                unsigned int id = m68k_read_memory_16((unsigned int)(theRsrc+resTable+12*j+0));
-                if (id==myId) {
-                    unsigned int handle = m68k_read_memory_32((unsigned int)(theRsrc+resTable+12*j+8));
-                    if (handle) {
-                        // resource is already in RAM
-                        mosTrace("Resource already loaded\n");
-                        return handle;
-                    } else {
-                        // resource must be copied from the file into memory
-                        if (gMosResLoad==0) {
-                            mosDebug("WARNING: Automatic Resource loading is disabled!\n");
-                        }
-                        mosTrace("Resource found, loading...\n");
-                        unsigned int rsrcOffset = (m68k_read_memory_32((unsigned int)(theRsrc+resTable+12*j+4)) & 0xffffff);
-                        unsigned int rsrcData = m68k_read_memory_32((unsigned int)(theApp));
-                        unsigned int rsrcSize = m68k_read_memory_32((unsigned int)(theApp+rsrcData+rsrcOffset));
-
-                        mosHandle hdl = mosNewHandle(rsrcSize);
-                        mosPtr ptr = mosRead32(hdl);
-                        mosMemcpy(ptr, theApp+rsrcData+rsrcOffset+4, rsrcSize);
-                        // make the resource map point to the resource handle
-                        m68k_write_memory_32((unsigned int)(theRsrc+resTable+12*j+8), hdl);
-                        // set breakpoints
-                        if (myResType=='CODE') {
-                            if (m68k_read_memory_16((unsigned int)(theApp+rsrcData+rsrcOffset+4))==0xffff) {
-                                installBreakpoints(myId, (unsigned int)(ptr+4+0x24)); // 0x24
-                                gResourceStart[myId] = (unsigned int)(ptr+4+0x24);
-                                gResourceEnd[myId] = (unsigned int)(ptr+4) + rsrcSize;
-                            } else {
-                                installBreakpoints(myId, (unsigned int)(ptr+4)); // 0x24
-                                gResourceStart[myId] = (unsigned int)(ptr+4);
-                                gResourceEnd[myId] = (unsigned int)(ptr+4) + rsrcSize;
-                            }
-                            mosTrace("Resource %d from 0x%08X to 0x%08X\n", myId, gResourceStart[myId], gResourceEnd[myId]);
-                        }
-                        return hdl;
-                    }
-                }
-            }
-        }
+    auto it = gRsrcIdIndex.find(rsrcIdKey(myResType, myId));
+    if (it==gRsrcIdIndex.end()) {
+        mosDebug("ERROR: Resource '%c%c%c%c', ID %d not found!\n",
+                 myResType>>24, myResType>>16, myResType>>8, myResType, myId);
+        return 0;
     }
-    mosDebug("ERROR: Resource '%c%c%c%c', ID %d not found!\n",
-             myResType>>24, myResType>>16, myResType>>8, myResType, myId);
-    return 0;
+    return getResourceHandle(it->second, myResType);
 }
 
 
 /**
  * Finds and loads the given resource, and returns a handle to it
  *
- * \todo This function urgently needs refactoring.
  * \todo this ignores the "do not load" flag in system memory
  */
 mosHandle GetNamedResource(unsigned int myResType, const byte *pName)
 {
-    unsigned int i = 0, j = 0;
-    // ---- read the map
-    unsigned int rsrcMapTypeList = m68k_read_memory_16((unsigned int)(theRsrc+24));
-    unsigned int rsrcMapNameList = m68k_read_memory_16((unsigned int)(theRsrc+26));
-    // ------ resource map type list
-    unsigned int rsrcMapTypeListSize = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList)) + 1;
-    for (i=0; i<rsrcMapTypeListSize; i++) {
-        unsigned int nRes = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList+8*i+6)) + 1;
-        unsigned int resTable = m68k_read_memory_16((unsigned int)(theRsrc+rsrcMapTypeList+8*i+8)) + rsrcMapTypeList;
-        unsigned int resType = m68k_read_memory_32((unsigned int)(theRsrc+rsrcMapTypeList+8*i+2));
-        if (resType==myResType) {
-            for (j=0; j<nRes; j++) {
-                unsigned short rsrcNameOffset = m68k_read_memory_16((unsigned int)(theRsrc+resTable+12*j+2));
-                if (rsrcNameOffset==0xffff) continue; // unnamed resource
-                byte* rsrcName = (byte*)mosToHost(theRsrc+rsrcMapNameList+rsrcNameOffset);
-                mosTrace("%*s\n", rsrcName[0], rsrcName+1);
-                if (memcmp(pName, rsrcName, pName[0]+1)==0) {
-                    unsigned int handle = m68k_read_memory_32((unsigned int)(theRsrc+resTable+12*j+8));
-                    unsigned int id = m68k_read_memory_16((unsigned int)(theRsrc+resTable+12*j+0));
-                    if (handle) {
-                        // resource is already in RAM
-                        mosTrace("Resource already loaded\n");
-                        return handle;
-                    } else {
-                        // resource must be copied from the file into memory
-                        if (gMosResLoad==0) {
-                            mosDebug("WARNING: Automatic Resource loading is disabled!\n");
-                        }
-                        mosTrace("Resource found, loading...\n");
-                        unsigned int rsrcOffset = (m68k_read_memory_32((unsigned int)(theRsrc+resTable+12*j+4)) & 0xffffff);
-                        unsigned int rsrcData = m68k_read_memory_32((unsigned int)(theApp));
-                        unsigned int rsrcSize = m68k_read_memory_32((unsigned int)(theApp+rsrcData+rsrcOffset));
-
-                        mosHandle hdl = mosNewHandle(rsrcSize);
-                        mosPtr ptr = mosRead32(hdl);
-                        mosMemcpy(ptr, theApp+rsrcData+rsrcOffset+4, rsrcSize);
-                        // make the resource map point to the resource handle
-                        m68k_write_memory_32((unsigned int)(theRsrc+resTable+12*j+8), hdl);
-                        // set breakpoints
-                        if (myResType=='CODE') {
-                            if (m68k_read_memory_16((unsigned int)(theApp+rsrcData+rsrcOffset+4))==0xffff) {
-                                installBreakpoints(id, (unsigned int)(ptr+4+0x24)); // 0x24
-                                gResourceStart[id] = (unsigned int)(ptr+4+0x24);
-                                gResourceEnd[id] = (unsigned int)(ptr+4) + rsrcSize;
-                            } else {
-                                installBreakpoints(id, (unsigned int)(ptr+4)); // 0x24
-                                gResourceStart[id] = (unsigned int)(ptr+4);
-                                gResourceEnd[id] = (unsigned int)(ptr+4) + rsrcSize;
-                            }
-                            mosTrace("Resource %d from 0x%08X to 0x%08X\n", id, gResourceStart[id], gResourceEnd[id]);
-                        }
-                        return hdl;
-                    }
-                }
-            }
-        }
+    auto it = gRsrcNameIndex.find(rsrcNameKey(myResType, pName));
+    if (it==gRsrcNameIndex.end()) {
+        mosDebug("ERROR: Resource '%c%c%c%c', name '%.*s' not found!\n",
+                 myResType>>24, myResType>>16, myResType>>8, myResType, pName[0], pName+1);
+        return 0;
     }
-    mosDebug("ERROR: Resource '%c%c%c%c', name '%s' not found!\n",
-             myResType>>24, myResType>>16, myResType>>8, myResType, pName);
+    return getResourceHandle(it->second, myResType);
+}
+
+
+/**
+ * Return the number of resources of the given type.
+ */
+unsigned int Count1Resources(unsigned int myResType)
+{
+    auto it = gRsrcTypeIndex.find(myResType);
+    if (it==gRsrcTypeIndex.end())
+        return 0;
+    return (unsigned int)it->second.size();
+}
+
+
+/**
+ * Finds and loads a resource by its position in the resource map.
+ *
+ * \param myResType type of the resource
+ * \param index index of the resource, starting at 1
+ * \return the handle of the resource, or 0 if there is no such resource
+ */
+mosHandle Get1IxResource(unsigned int myResType, unsigned short index)
+{
+    auto it = gRsrcTypeIndex.find(myResType);
+    if (it==gRsrcTypeIndex.end() || index<1 || index>it->second.size()) {
+        mosDebug("ERROR: Resource '%c%c%c%c', index %d not found!\n",
+                 myResType>>24, myResType>>16, myResType>>8, myResType, index);
+        return 0;
+    }
+    return getResourceHandle(it->second[index-1], myResType);
+}
+
+
+/**
+ * Find the reference list entry for a resource handle.
+ *
+ * \param hdl handle that was returned by GetResource
+ * \param resTypePtr if not NULL, receives the resource type
+ * \return the address of the entry in the resource map, or 0 if not found
+ */
+static mosPtr findResourceEntry(mosHandle hdl, unsigned int *resTypePtr)
+{
+    if (!hdl) return 0;
+    auto it = gRsrcHandleIndex.find(hdl);
+    if (it==gRsrcHandleIndex.end())
+        return 0;
+    if (mosRead32(it->second.refEntry+8)!=hdl) {
+        // the map was reset since this handle was created
+        gRsrcHandleIndex.erase(it);
+        return 0;
+    }
+    if (resTypePtr)
+        *resTypePtr = it->second.resType;
+    return it->second.refEntry;
+}
+
+
+/**
+ * Reload a resource that may have been purged.
+ *
+ * \param hdl handle that was returned by GetResource
+ * \return 0 if the resource is in memory, or mosResNotFound
+ */
+int LoadResource(mosHandle hdl)
+{
+    unsigned int resType = 0;
+    mosPtr refEntry = findResourceEntry(hdl, &resType);
+    if (!refEntry)
+        return mosResNotFound;
+    if (mosRead32(hdl))
+        return 0; // still in memory
+    unsigned short id = m68k_read_memory_16((unsigned int)(refEntry+0));
+    if (!loadResourceData(refEntry, resType, id, hdl))
+        return mosMemFullErr;
     return 0;
 }
 
 
+/**
+ * Return the size of a resource in the file, even if it was purged.
+ *
+ * \param hdl handle that was returned by GetResource
+ * \return the size of the resource data, or 0xffffffff if not found
+ */
+unsigned int SizeResource(mosHandle hdl)
+{
+    mosPtr refEntry = findResourceEntry(hdl, 0L);
+    if (!refEntry)
+        return 0xffffffff;
+    unsigned int rsrcOffset = (m68k_read_memory_32((unsigned int)(refEntry+4)) & 0xffffff);
+    unsigned int rsrcData = appRead32(0);
+    return appRead32(rsrcData+rsrcOffset);
+}
+
+
 /**
  * Create a segment of memory that hold global variables and jump tables.
  *
@@ -277,27 +498,283 @@ unsigned int createA5World(mosHandle hCode0)
     theJumpTable = mosNewPtr(aboveA5+belowA5);
     gMosCurJTOffset = offset;
     mosMemcpy(theJumpTable+belowA5+offset, code0+16, length);
-    gResourceStart[19] = (unsigned int)(theJumpTable + belowA5);
-    gResourceEnd[19] = (unsigned int)(theJumpTable + belowA5 + length);
+    registerSegment(kMosJumpTableSegment, (unsigned int)(theJumpTable + belowA5),
+                    (unsigned int)(theJumpTable + belowA5 + length), "Jump Table");
+    gJumpTableStart = theJumpTable+belowA5+offset;
+    gJumpTableEnd = gJumpTableStart+length;
     return (unsigned int)(theJumpTable + belowA5);
 }
 
 
+/**
+ * Make all jump table entries of a loaded code segment jump into the segment.
+ *
+ * An entry of an unloaded segment contains the offset of the function in the
+ * segment, followed by 'move.w #id,-(sp)' and '_LoadSeg'. A resolved entry
+ * contains the segment id, followed by 'jmp address'.
+ *
+ * \param id resource ID of the code segment
+ * \param hCode handle of the loaded segment
+ * \return number of entries that were resolved
+ */
+unsigned int resolveJumpTable(unsigned short id, mosHandle hCode)
+{
+    mosPtr code = mosRead32(hCode);
+    unsigned int n = 0;
+    for (mosPtr entry = gJumpTableStart; entry+8<=gJumpTableEnd; entry += 8) {
+        if (mosRead16(entry+2)==0x3F3C && mosRead16(entry+4)==id && mosRead16(entry+6)==0xA9F0) {
+            unsigned int offset = mosRead16(entry);
+            mosWrite16(entry, id);
+            mosWrite16(entry+2, 0x4EF9);
+            mosWrite32(entry+4, code+offset+4);
+            n++;
+        }
+    }
+    return n;
+}
+
+
+/**
+ * Load all code segments and resolve the entire jump table.
+ *
+ * After this, the app will not call _LoadSeg anymore.
+ */
+void preloadSegments()
+{
+    auto it = gRsrcTypeIndex.find('CODE');
+    if (it==gRsrcTypeIndex.end())
+        return;
+    for (mosPtr refEntry: it->second) {
+        unsigned short id = mosRead16(refEntry);
+        if (id==0) continue; // CODE 0 is the jump table itself
+        mosHandle hCode = getResourceHandle(refEntry, 'CODE');
+        if (!hCode) {
+            mosDebug("Code Resource %d not found!\n", id);
+            continue;
+        }
+        unsigned int n = resolveJumpTable(id, hCode);
+        mosDebug("Preloaded code segment %d, %d jump table entries\n", id, n);
+    }
+}
+
+
+/**
+ * Index all resources in the map by type and ID, by type and name, and by handle.
+ */
+static void buildResourceIndex()
+{
+    gRsrcIdIndex.clear();
+    gRsrcNameIndex.clear();
+    gRsrcTypeIndex.clear();
+    gRsrcHandleIndex.clear();
+    unsigned int rsrcMapTypeList = mosRead16(theRsrc+24);
+    unsigned int rsrcMapNameList = mosRead16(theRsrc+26);
+    unsigned int rsrcMapTypeListSize = mosRead16(theRsrc+rsrcMapTypeList) + 1;
+    for (unsigned int i=0; i<rsrcMapTypeListSize; i++) {
+        unsigned int resType = mosRead32(theRsrc+rsrcMapTypeList+8*i+2);
+        unsigned int nRes = mosRead16(theRsrc+rsrcMapTypeList+8*i+6) + 1;
+        unsigned int resTable = mosRead16(theRsrc+rsrcMapTypeList+8*i+8) + rsrcMapTypeList;
+        std::vector<mosPtr> &typeList = gRsrcTypeIndex[resType];
+        for (unsigned int j=0; j<nRes; j++) {
+            mosPtr refEntry = theRsrc+resTable+12*j;
+            typeList.push_back(refEntry);
+            gRsrcIdIndex.insert(std::make_pair(rsrcIdKey(resType, mosRead16(refEntry)), refEntry));
+            mosHandle hdl = mosRead32(refEntry+8);
+            if (hdl)
+                gRsrcHandleIndex[hdl] = { refEntry, resType };
+            unsigned short rsrcNameOffset = mosRead16(refEntry+2);
+            if (rsrcNameOffset!=0xffff) {
+                const byte *rsrcName = (const byte*)mosToHost(theRsrc+rsrcMapNameList+rsrcNameOffset);
+                gRsrcNameIndex.insert(std::make_pair(rsrcNameKey(resType, rsrcName), refEntry));
+            }
+        }
+    }
+}
+
+
+/**
+ * Create a copy of a resource fork with all resources compressed.
+ *
+ * The header and the resource map keep their layout, so the map can be read
+ * as usual. Every entry in the data section starts with the uncompressed size
+ * as in an ordinary fork, followed by the size of the compressed data and the
+ * data itself. If a resource does not get any smaller, both sizes are the
+ * same and the data is stored as is.
+ *
+ * \param src a resource fork
+ * \param srcSize size of the fork
+ * \param dst receives the compressed fork
+ * \return false if src is not a resource fork; dst is a plain copy then
+ */
+bool compressResourceFork(const byte *src, unsigned int srcSize, std::vector<byte> &dst)
+{
+    auto read32 = [src](unsigned int o) { return (unsigned int)((src[o]<<24) | (src[o+1]<<16) | (src[o+2]<<8) | src[o+3]); };
+    auto read16 = [src](unsigned int o) { return (unsigned int)((src[o]<<8) | src[o+1]); };
+    auto write32 = [&dst](unsigned int o, unsigned int v) {
+        dst[o] = (byte)(v>>24); dst[o+1] = (byte)(v>>16); dst[o+2] = (byte)(v>>8); dst[o+3] = (byte)v;
+    };
+    if (srcSize<16 || read32(0)>srcSize || read32(4)+read32(12)>srcSize) {
+        dst.assign(src, src+srcSize);
+        return false;
+    }
+    unsigned int rsrcData = read32(0), rsrcMap = read32(4), rsrcMapSize = read32(12);
+    std::vector<byte> map(src+rsrcMap, src+rsrcMap+rsrcMapSize);
+    std::unordered_map<unsigned int, unsigned int> newOffset; // resources may share their data
+    dst.assign(src, src+rsrcData);
+
+    unsigned int typeList = read16(rsrcMap+24);
+    unsigned int nTypes = read16(rsrcMap+typeList) + 1;
+    for (unsigned int i=0; i<nTypes; i++) {
+        unsigned int nRes = read16(rsrcMap+typeList+8*i+6) + 1;
+        unsigned int refList = read16(rsrcMap+typeList+8*i+8) + typeList;
+        for (unsigned int j=0; j<nRes; j++) {
+            unsigned int ref = refList+12*j;
+            unsigned int offset = read32(rsrcMap+ref+4) & 0x00ffffff;
+            auto it = newOffset.find(offset);
+            if (it==newOffset.end()) {
+                unsigned int size = read32(rsrcData+offset);
+                const byte *data = src+rsrcData+offset+4;
+                unsigned int pos = (unsigned int)dst.size();
+                it = newOffset.insert(std::make_pair(offset, pos-rsrcData)).first;
+                dst.resize(pos+8);
+                mosCompress(data, size, dst);
+                unsigned int packedSize = (unsigned int)dst.size()-pos-8;
+                if (packedSize>=size) {
+                    dst.resize(pos+8);
+                    dst.insert(dst.end(), data, data+size);
+                    packedSize = size;
+                }
+                write32(pos, size);
+                write32(pos+4, packedSize);
+            }
+            map[ref+5] = (byte)(it->second>>16);
+            map[ref+6] = (byte)(it->second>>8);
+            map[ref+7] = (byte)(it->second);
+        }
+    }
+
+    unsigned int newMap = (unsigned int)dst.size();
+    dst.insert(dst.end(), map.begin(), map.end());
+    write32(4, newMap);
+    write32(8, newMap-rsrcData);
+    if (memcmp(src, src+rsrcMap, 16)==0)
+        memcpy(dst.data()+newMap, dst.data(), 16);
+    return true;
+}
+
+
+/**
+ * Check that the type list and all reference lists are inside the map.
+ */
+static bool checkResourceMap(const byte *map, unsigned int mapSize)
+{
+    auto read16 = [map](unsigned int o) { return (unsigned int)((map[o]<<8) | map[o+1]); };
+    unsigned int typeList = read16(24), nameList = read16(26);
+    if (typeList+2>mapSize || nameList>mapSize)
+        return false;
+    unsigned int nTypes = read16(typeList) + 1;
+    if (typeList+2+8*nTypes>mapSize)
+        return false;
+    for (unsigned int i=0; i<nTypes; i++) {
+        unsigned int nRes = read16(typeList+8*i+6) + 1;
+        unsigned int refList = read16(typeList+8*i+8) + typeList;
+        if (refList+12*nRes>mapSize)
+            return false;
+        for (unsigned int j=0; j<nRes; j++) {
+            unsigned int nameOffset = read16(refList+12*j+2);
+            if (nameOffset!=0xffff && (nameList+nameOffset>=mapSize
+                || nameList+nameOffset+1+map[nameList+nameOffset]>mapSize))
+                return false;
+        }
+    }
+    return true;
+}
+
+
 /**
  * Copy the resource map into a different place in RAM.
  *
+ * \return false if the tool image is not a valid resource fork
+ *
  * \todo This function urgently needs refactoring.
  * \todo Resource maps are set up to be manipulated "in situ". Kick this out.
  */
-void readResourceMap()
+bool readResourceMap()
 {
-    unsigned int rsrcMap = m68k_read_memory_32((unsigned int)(theApp+4));
-    unsigned int rsrcMapSize = m68k_read_memory_32((unsigned int)(theApp+12));
+    unsigned int rsrcData = appRead32(0);
+    unsigned int rsrcMap = appRead32(4);
+    unsigned int rsrcMapSize = appRead32(12);
     mosTrace("Rsrc Map %d bytes at 0x%08X\n", rsrcMapSize, rsrcMap);
+    if (theAppSize<16 || rsrcData>theAppSize || rsrcMapSize<28 || !appContains(rsrcMap, rsrcMapSize)
+        || !checkResourceMap(theApp+rsrcMap, rsrcMapSize)) {
+        mosError("The resource fork is damaged or truncated\n");
+        return false;
+    }
     theRsrc = mosNewPtr(rsrcMapSize);
+    if (!theRsrc)
+        return false;
     theRsrcSize = rsrcMapSize;
     mosMemcpy(theRsrc, theApp+rsrcMap, rsrcMapSize);
-    dumpResourceMap();
+    buildResourceIndex();
+    // the handles in the map hold garbage in the file
+    for (auto &type: gRsrcTypeIndex)
+        for (mosPtr refEntry: type.second)
+            mosWrite32(refEntry+8, 0);
+    gRsrcHandleIndex.clear();
+    if (mosLogVerbosity()>=MOS_VERBOSITY_TRACE)
+        dumpResourceMap();
+    return true;
 }
 
 
+/**
+ * Add the resource map and the code segments to a snapshot file.
+ */
+void mosSaveResourceState(MosSnapshotState &state)
+{
+    mosSnapshotWrite(state, theRsrc);
+    mosSnapshotWrite(state, theRsrcSize);
+    mosSnapshotWrite(state, theJumpTable);
+    mosSnapshotWrite(state, gJumpTableStart);
+    mosSnapshotWrite(state, gJumpTableEnd);
+    mosSnapshotWrite(state, (uint32_t)gSegments.size());
+    for (auto &it: gSegments) {
+        const MosSegment &seg = it.second;
+        mosSnapshotWrite(state, (uint32_t)seg.id);
+        mosSnapshotWrite(state, seg.start);
+        mosSnapshotWrite(state, seg.end);
+        mosSnapshotWriteString(state, seg.name);
+    }
+}
+
+
+/**
+ * Read the resource map and the code segments from a snapshot file.
+ *
+ * The map itself is in the RAM of the snapshot, and only the index is
+ * built again.
+ *
+ * \return false if the state is incomplete
+ */
+bool mosLoadResourceState(MosSnapshotReader &reader)
+{
+    theRsrc = mosSnapshotRead(reader);
+    theRsrcSize = mosSnapshotRead(reader);
+    theJumpTable = mosSnapshotRead(reader);
+    gJumpTableStart = mosSnapshotRead(reader);
+    gJumpTableEnd = mosSnapshotRead(reader);
+    uint32_t n = mosSnapshotRead(reader);
+    if (reader.failed)
+        return false;
+    buildResourceIndex();
+    gSegments.clear();
+    gSegmentStart.clear();
+    for (uint32_t i=0; i<n && !reader.failed; i++) {
+        int id = (int)mosSnapshotRead(reader);
+        unsigned int start = mosSnapshotRead(reader);
+        unsigned int end = mosSnapshotRead(reader);
+        std::string name = mosSnapshotReadString(reader);
+        registerSegment(id, start, end, name);
+    }
+    return !reader.failed;
+}
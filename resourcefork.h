@@ -25,18 +25,39 @@
 
 
 #include "main.h"
+#include "snapshot.h"
 
+#include <string>
+#include <vector>
 
-extern unsigned int gResourceStart[];
-extern unsigned int gResourceEnd[];
+
+// a loaded code segment, see registerSegment()
+struct MosSegment {
+    int id;
+    unsigned int start, end;
+    std::string name;
+};
+
+const int kMosJumpTableSegment = -1;
 
 
 void dumpResourceMap();
 mosHandle GetResource(unsigned int myResType, unsigned short myId);
 mosHandle GetNamedResource(unsigned int myResType, const byte *pName);
+int LoadResource(mosHandle hdl);
+unsigned int Count1Resources(unsigned int myResType);
+mosHandle Get1IxResource(unsigned int myResType, unsigned short index);
+unsigned int SizeResource(mosHandle hdl);
 unsigned int createA5World(mosHandle hCode0);
-void readResourceMap();
+unsigned int resolveJumpTable(unsigned short id, mosHandle hCode);
+void preloadSegments();
+bool readResourceMap();
+bool compressResourceFork(const byte *src, unsigned int srcSize, std::vector<byte> &dst);
+void registerSegment(int id, unsigned int start, unsigned int end, const std::string &name);
+const MosSegment *findSegment(unsigned int addr);
 const char *printAddr(unsigned int addr);
+void mosSaveResourceState(MosSnapshotState &state);
+bool mosLoadResourceState(MosSnapshotReader &reader);
 
 
 #endif /* defined(__mosrun__resourcefork__) */
@@ -21,8 +21,9 @@
 
 #include "rsrc.h"
 
-unsigned char *rsrc = nullptr;
+const unsigned char *rsrc = nullptr;
 
-unsigned char *gAppResource = rsrc;
+const unsigned char *gAppResource = rsrc;
 unsigned int gAppResourceSize = 0;
+unsigned int gAppResourceCompressed = 0;
 
@@ -22,8 +22,17 @@
 #ifndef __mosrun__rsrc__
 #define __mosrun__rsrc__
 
-extern unsigned char *gAppResource;
+extern const unsigned char *gAppResource;
 extern unsigned int gAppResourceSize;
+extern unsigned int gAppResourceCompressed;
+
+// A multi-call binary embeds a list of tools and picks one by its name.
+struct MosEmbeddedTool {
+    const char *name;
+    const unsigned char *start, *end;
+    unsigned int compressed;
+};
+extern const MosEmbeddedTool *gMosEmbeddedTools;
 
 #endif /* defined(__mosrun__rsrc__) */
 
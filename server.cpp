@@ -0,0 +1,347 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+/** \file server.cpp
+ Pass jobs from mosrun-client to a resident mosrun over a Unix socket.
+
+ The client sends a header of four 32 bit words: the magic number 'MOSJ',
+ the size of the text that follows, the number of arguments, and the number
+ of environment variables. stdin, stdout, and stderr of the client travel
+ with the header as SCM_RIGHTS. The text holds the tool name, the working
+ directory, the arguments, and the environment, each ending in a 0 byte.
+ When the job is done, the server answers with the 32 bit result code.
+
+ Both ends run on the same machine, so all words are in host byte order.
+ */
+
+#include "server.h"
+
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#ifndef _WIN32
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+
+const uint32_t kMosJobMagic = 0x4D4F534A; // 'MOSJ'
+
+// refuse jobs with more text than this
+const uint32_t kMosJobMaxSize = 1024*1024;
+
+
+#ifndef _WIN32
+
+
+/**
+ * Fill in the address of a socket in the file system.
+ *
+ * \return false if the path is too long
+ */
+static bool mosSocketAddress(const char *path, struct sockaddr_un &addr)
+{
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path)>=sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+    strcpy(addr.sun_path, path);
+    return true;
+}
+
+
+/**
+ * Read exactly size bytes.
+ */
+static bool mosReadAll(int fd, void *dst, size_t size)
+{
+    char *d = (char*)dst;
+    while (size>0) {
+        ssize_t ret = read(fd, d, size);
+        if (ret==-1 && errno==EINTR) continue;
+        if (ret<=0) return false;
+        d += ret;
+        size -= (size_t)ret;
+    }
+    return true;
+}
+
+
+/**
+ * Write exactly size bytes.
+ */
+static bool mosWriteAll(int fd, const void *src, size_t size)
+{
+    const char *s = (const char*)src;
+    while (size>0) {
+        ssize_t ret = write(fd, s, size);
+        if (ret==-1 && errno==EINTR) continue;
+        if (ret<=0) return false;
+        s += ret;
+        size -= (size_t)ret;
+    }
+    return true;
+}
+
+
+/**
+ * Take the next 0-terminated string from the job text.
+ */
+static bool mosNextString(const std::vector<char> &text, size_t &pos, std::string &dst)
+{
+    if (pos>=text.size()) return false;
+    const char *s = text.data()+pos;
+    size_t len = strnlen(s, text.size()-pos);
+    if (pos+len==text.size()) return false;
+    dst.assign(s, len);
+    pos += len+1;
+    return true;
+}
+
+
+/**
+ * Create the socket that clients connect to.
+ *
+ * A socket file that was left behind by an earlier server is replaced.
+ *
+ * \return the listening socket, or -1 and errno
+ */
+int mosServerListen(const char *path)
+{
+    struct sockaddr_un addr;
+    if (!mosSocketAddress(path, addr))
+        return -1;
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock==-1)
+        return -1;
+    unlink(path);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr))==-1 || listen(sock, 16)==-1) {
+        int err = errno;
+        close(sock);
+        errno = err;
+        return -1;
+    }
+    // a client that goes away must not take the server with it
+    signal(SIGPIPE, SIG_IGN);
+    return sock;
+}
+
+
+/**
+ * Wait for the next client and read its job.
+ *
+ * \return false if the client did not send a complete job
+ */
+bool mosServerAccept(int sock, MosServerJob &job)
+{
+    job.fd = accept(sock, NULL, NULL);
+    job.stdio[0] = job.stdio[1] = job.stdio[2] = -1;
+    if (job.fd==-1)
+        return false;
+
+    uint32_t header[4];
+    struct iovec iov = { header, sizeof(header) };
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(3*sizeof(int))];
+    } control;
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    ssize_t ret;
+    do {
+        ret = recvmsg(job.fd, &msg, 0);
+    } while (ret==-1 && errno==EINTR);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg && cmsg->cmsg_level==SOL_SOCKET && cmsg->cmsg_type==SCM_RIGHTS
+        && cmsg->cmsg_len==CMSG_LEN(3*sizeof(int)))
+        memcpy(job.stdio, CMSG_DATA(cmsg), 3*sizeof(int));
+    if (ret<=0 || job.stdio[0]==-1
+        || ((size_t)ret<sizeof(header) && !mosReadAll(job.fd, (char*)header+ret, sizeof(header)-(size_t)ret))
+        || header[0]!=kMosJobMagic || header[1]>kMosJobMaxSize
+        || (uint64_t)header[2]+header[3]>header[1]) {
+        mosServerReply(job, 3);
+        return false;
+    }
+
+    std::vector<char> text(header[1]);
+    size_t pos = 0;
+    bool ok = mosReadAll(job.fd, text.data(), text.size())
+        && mosNextString(text, pos, job.tool)
+        && mosNextString(text, pos, job.cwd);
+    job.args.resize(ok ? header[2] : 0);
+    for (auto &arg: job.args)
+        ok = ok && mosNextString(text, pos, arg);
+    job.env.resize(ok ? header[3] : 0);
+    for (auto &var: job.env)
+        ok = ok && mosNextString(text, pos, var);
+    if (!ok) {
+        mosServerReply(job, 3);
+        return false;
+    }
+    return true;
+}
+
+
+/**
+ * Send the result of a job to the client and close the connection.
+ */
+void mosServerReply(MosServerJob &job, int result)
+{
+    int32_t value = result;
+    mosWriteAll(job.fd, &value, sizeof(value));
+    mosServerClose(job);
+}
+
+
+/**
+ * Close the connection to the client without an answer.
+ *
+ * The fork server does this after handing the job to a new process.
+ */
+void mosServerClose(MosServerJob &job)
+{
+    close(job.fd);
+    job.fd = -1;
+    for (int i=0; i<3; i++) {
+        if (job.stdio[i]!=-1)
+            close(job.stdio[i]);
+        job.stdio[i] = -1;
+    }
+}
+
+
+/**
+ * Run a job on the server and wait for it to finish.
+ *
+ * \param path socket of the server
+ * \param tool the name of the tool to run
+ * \param argc, argv the arguments without the tool name
+ * \param env the environment, ending in NULL
+ * \param result receives the result code of the tool
+ * \return false and errno if the server could not be reached
+ */
+bool mosServerSendJob(const char *path, const char *tool, int argc, const char **argv, char **env, int &result)
+{
+    struct sockaddr_un addr;
+    if (!mosSocketAddress(path, addr))
+        return false;
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd)))
+        return false;
+
+    std::vector<char> text;
+    auto addString = [&text](const char *s) { text.insert(text.end(), s, s+strlen(s)+1); };
+    addString(tool);
+    addString(cwd);
+    for (int i=0; i<argc; i++)
+        addString(argv[i]);
+    uint32_t envc = 0;
+    for (char **e = env; e && *e; e++, envc++)
+        addString(*e);
+    uint32_t header[4] = { kMosJobMagic, (uint32_t)text.size(), (uint32_t)argc, envc };
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock==-1)
+        return false;
+    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr))==-1) {
+        int err = errno;
+        close(sock);
+        errno = err;
+        return false;
+    }
+
+    int fds[3] = { 0, 1, 2 };
+    struct iovec iov = { header, sizeof(header) };
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(fds))];
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    ssize_t ret;
+    do {
+        ret = sendmsg(sock, &msg, 0);
+    } while (ret==-1 && errno==EINTR);
+
+    int32_t value = 0;
+    if (ret!=(ssize_t)sizeof(header)
+        || !mosWriteAll(sock, text.data(), text.size())
+        || !mosReadAll(sock, &value, sizeof(value))) {
+        close(sock);
+        errno = EPIPE;
+        return false;
+    }
+    close(sock);
+    result = value;
+    return true;
+}
+
+
+#else
+
+
+int mosServerListen(const char*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+bool mosServerAccept(int, MosServerJob&)
+{
+    return false;
+}
+
+void mosServerReply(MosServerJob&, int)
+{
+}
+
+void mosServerClose(MosServerJob&)
+{
+}
+
+bool mosServerSendJob(const char*, const char*, int, const char**, char**, int&)
+{
+    errno = ENOSYS;
+    return false;
+}
+
+
+#endif
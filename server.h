@@ -0,0 +1,54 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+#ifndef __mosrun__server__
+#define __mosrun__server__
+
+
+#include <string>
+#include <vector>
+
+
+/**
+ * A job that a client sent to the server.
+ */
+typedef struct
+{
+    int fd;                         // connection to the client
+    int stdio[3];                   // stdin, stdout, and stderr of the client
+    std::string tool;               // name of the tool the client was called as
+    std::string cwd;                // working directory of the client
+    std::vector<std::string> args;  // arguments without the tool name
+    std::vector<std::string> env;   // environment of the client
+} MosServerJob;
+
+
+int mosServerListen(const char *path);
+bool mosServerAccept(int sock, MosServerJob &job);
+void mosServerReply(MosServerJob &job, int result);
+void mosServerClose(MosServerJob &job);
+
+bool mosServerSendJob(const char *path, const char *tool, int argc, const char **argv, char **env, int &result);
+
+
+#endif /* defined(__mosrun__server__) */
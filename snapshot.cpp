@@ -0,0 +1,330 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+/** \file snapshot.cpp
+ Save the emulator to a file after the app initialized itself, and resume
+ from there in later runs.
+
+ MPW tools spend a good part of their run time setting up the runtime
+ library and reading their resources before they even look at the command
+ line. A snapshot is taken at the first time the app reads the MPW globals
+ at 0x0316, which is where the runtime finds argc and argv. When resuming,
+ the arguments of the new run are written into the restored RAM, and the
+ app continues as if it had just started up.
+
+ The file holds a header, the host side state as 32 bit words, a list of
+ the RAM pages that are not all zero, and then the page contents, aligned
+ so that the file can be mapped and copied page by page. Snapshots contain
+ host pointers and only work with the very same mosrun executable.
+ */
+
+#include "snapshot.h"
+
+#include "main.h"
+#include "log.h"
+#include "memory.h"
+#include "traps.h"
+#include "resourcefork.h"
+#include "systemram.h"
+#include "fileio.h"
+#include "filter.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+extern "C" {
+#include "musashi331/m68k.h"
+}
+
+
+/**
+ * The start of a snapshot file.
+ */
+typedef struct
+{
+    uint32_t magic;         // kMosSnapshotMagic
+    uint32_t version;       // kMosSnapshotVersion
+    uint32_t pageSize;      // size of a page of emulated RAM
+    uint32_t numPages;      // number of pages in the file
+    uint32_t stateSize;     // number of 32 bit words of host side state
+    uint32_t indexOffset;   // page numbers, one 32 bit word per page in the file
+    uint32_t dataOffset;    // contents of the pages in the order of the index
+    uint32_t reserved;
+} MosSnapshotHeader;
+
+const uint32_t kMosSnapshotMagic = 0x4D4F5353; // 'MOSS'
+const uint32_t kMosSnapshotVersion = 1;
+
+// page size in the file, same as the dirty page tracking in memory.cpp
+const uint32_t kMosSnapshotPageSize = 4096;
+const uint32_t kMosSnapshotNumPages = kMosMemMax/kMosSnapshotPageSize;
+
+// page contents start at a multiple of this, which fits all host page sizes
+const uint32_t kMosSnapshotAlign = 65536;
+
+// save a snapshot here when the app reaches the MPW globals
+const char *gMosSaveSnapshotPath = nullptr;
+
+// set when the app read the MPW globals; the snapshot is saved after the instruction
+bool gMosSnapshotDue = false;
+
+// the snapshot file that we resume from
+static const byte *gMosSnapshot = nullptr;
+static size_t gMosSnapshotSize = 0;
+
+// registers in the order in which they must be restored
+static const m68k_register_t kMosSnapshotRegs[] = {
+    M68K_REG_D0, M68K_REG_D1, M68K_REG_D2, M68K_REG_D3,
+    M68K_REG_D4, M68K_REG_D5, M68K_REG_D6, M68K_REG_D7,
+    M68K_REG_A0, M68K_REG_A1, M68K_REG_A2, M68K_REG_A3,
+    M68K_REG_A4, M68K_REG_A5, M68K_REG_A6,
+    M68K_REG_SR, M68K_REG_USP, M68K_REG_ISP, M68K_REG_MSP, M68K_REG_A7,
+    M68K_REG_SFC, M68K_REG_DFC, M68K_REG_VBR, M68K_REG_CACR, M68K_REG_CAAR,
+    M68K_REG_PC
+};
+const int kMosSnapshotNumRegs = sizeof(kMosSnapshotRegs)/sizeof(kMosSnapshotRegs[0]);
+
+
+/**
+ * Describe the tool image and the mosrun executable.
+ *
+ * A snapshot can only be used by the executable that wrote it, for the same
+ * tool. The distances between a few functions in different parts of mosrun
+ * change with nearly every build.
+ */
+static const MosSnapshotState &mosSnapshotIdentity()
+{
+    static MosSnapshotState state;
+    if (!state.empty())
+        return state;
+    uint32_t hash = 2166136261u;
+    for (unsigned int i=0; i<theAppSize; i++)
+        hash = (hash ^ theApp[i]) * 16777619u;
+    mosSnapshotWrite(state, theAppSize);
+    mosSnapshotWrite(state, hash);
+    uintptr_t base = (uintptr_t)trapGoNative;
+    mosSnapshotWritePtr(state, (uintptr_t)trapSyRead - base);
+    mosSnapshotWritePtr(state, (uintptr_t)readResourceMap - base);
+    mosSnapshotWritePtr(state, (uintptr_t)mosFilterData - base);
+    mosSnapshotWritePtr(state, (uintptr_t)mosSaveSnapshot - base);
+    mosSnapshotWritePtr(state, (uintptr_t)m68k_execute - base);
+    return state;
+}
+
+
+/**
+ * Save the emulator to a file.
+ *
+ * This is called between two instructions when gMosSnapshotDue is set, and
+ * only once per run.
+ *
+ * \return false if the snapshot could not be saved
+ */
+bool mosSaveSnapshot(const char *path)
+{
+    gMosSnapshotDue = false;
+    gMosSaveSnapshotPath = nullptr;
+    if (mosAppFilesBusy()) {
+        mosError("Can't save a snapshot while the app has files open\n");
+        return false;
+    }
+
+    MosSnapshotState state = mosSnapshotIdentity();
+    mosSnapshotWrite(state, gMosCurrentA5);
+    mosSnapshotWrite(state, gMosCurrentStackBase);
+    mosSnapshotWrite(state, gMosCurJTOffset);
+    mosSnapshotWrite(state, gMosResLoad);
+    mosSnapshotWrite(state, gMosResErr);
+    mosSnapshotWrite(state, gMosMemErr);
+    mosSnapshotWrite(state, gMosMPWHandle);
+    for (int i=0; i<kMosSnapshotNumRegs; i++)
+        mosSnapshotWrite(state, m68k_get_reg(0L, kMosSnapshotRegs[i]));
+    mosSaveHeapState(state);
+    if (!mosSaveTrapState(state)) {
+        mosError("Can't save a snapshot inside a completion routine\n");
+        return false;
+    }
+    mosSaveResourceState(state);
+
+    static const byte zeroPage[kMosSnapshotPageSize] = { 0 };
+    std::vector<uint32_t> pages;
+    for (uint32_t p=0; p<kMosSnapshotNumPages; p++) {
+        if (memcmp(MosMem+p*kMosSnapshotPageSize, zeroPage, kMosSnapshotPageSize)!=0)
+            pages.push_back(p);
+    }
+
+    MosSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = kMosSnapshotMagic;
+    header.version = kMosSnapshotVersion;
+    header.pageSize = kMosSnapshotPageSize;
+    header.numPages = (uint32_t)pages.size();
+    header.stateSize = (uint32_t)state.size();
+    header.indexOffset = (uint32_t)(sizeof(header) + state.size()*4);
+    header.dataOffset = (header.indexOffset + header.numPages*4 + kMosSnapshotAlign-1) & ~(kMosSnapshotAlign-1);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        mosError("Can't save snapshot '%s': %s\n", path, strerror(errno));
+        return false;
+    }
+    static const byte padding[kMosSnapshotAlign] = { 0 };
+    bool ok = fwrite(&header, sizeof(header), 1, f)==1
+        && fwrite(state.data(), 4, state.size(), f)==state.size()
+        && fwrite(pages.data(), 4, pages.size(), f)==pages.size()
+        && fwrite(padding, 1, header.dataOffset-header.indexOffset-header.numPages*4, f)
+            ==header.dataOffset-header.indexOffset-header.numPages*4;
+    for (size_t i=0; ok && i<pages.size(); i++)
+        ok = fwrite(MosMem+pages[i]*kMosSnapshotPageSize, kMosSnapshotPageSize, 1, f)==1;
+    if (fclose(f)!=0)
+        ok = false;
+    if (!ok) {
+        mosError("Can't write snapshot '%s': %s\n", path, strerror(errno));
+        remove(path);
+        return false;
+    }
+    mosDebug("Saved snapshot '%s' with %d pages of RAM\n", path, (int)pages.size());
+    return true;
+}
+
+
+/**
+ * Map a snapshot file into memory and check if it fits this run.
+ *
+ * \return false if the file can't be used
+ */
+bool mosOpenSnapshot(const char *path)
+{
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd==-1 || fstat(fd, &st)==-1) {
+        mosError("Can't open snapshot '%s': %s\n", path, strerror(errno));
+        if (fd!=-1) close(fd);
+        return false;
+    }
+    void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map==MAP_FAILED) {
+        mosError("Can't map snapshot '%s': %s\n", path, strerror(errno));
+        return false;
+    }
+    gMosSnapshot = (const byte*)map;
+    gMosSnapshotSize = (size_t)st.st_size;
+#else
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        mosError("Can't open snapshot '%s': %s\n", path, strerror(errno));
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    gMosSnapshotSize = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    byte *data = (byte*)malloc(gMosSnapshotSize);
+    if (fread(data, 1, gMosSnapshotSize, f)!=gMosSnapshotSize)
+        gMosSnapshotSize = 0;
+    fclose(f);
+    gMosSnapshot = data;
+#endif
+
+    MosSnapshotHeader header;
+    if (gMosSnapshotSize>=sizeof(header))
+        memcpy(&header, gMosSnapshot, sizeof(header));
+    if (gMosSnapshotSize<sizeof(header)
+        || header.magic!=kMosSnapshotMagic || header.version!=kMosSnapshotVersion
+        || header.pageSize!=kMosSnapshotPageSize || header.numPages>kMosSnapshotNumPages
+        || header.indexOffset!=sizeof(header)+(uint64_t)header.stateSize*4
+        || header.dataOffset<header.indexOffset+(uint64_t)header.numPages*4
+        || gMosSnapshotSize<header.dataOffset+(uint64_t)header.numPages*kMosSnapshotPageSize) {
+        mosError("'%s' is not a mosrun snapshot\n", path);
+        return false;
+    }
+
+    const MosSnapshotState &identity = mosSnapshotIdentity();
+    if (header.stateSize<identity.size()
+        || memcmp(gMosSnapshot+sizeof(header), identity.data(), identity.size()*4)!=0) {
+        mosError("Snapshot '%s' was saved by a different tool or build of mosrun\n", path);
+        return false;
+    }
+    return true;
+}
+
+
+/**
+ * Reset the emulator to the snapshot that was opened with mosOpenSnapshot().
+ *
+ * The CPU must have been set up already, so that only the registers need to
+ * be loaded. Pages are marked dirty, so that batch jobs can undo this just
+ * like any other change to RAM.
+ *
+ * \return false if no snapshot was opened, or if the snapshot is damaged
+ */
+bool mosLoadSnapshot()
+{
+    if (!gMosSnapshot)
+        return false;
+    MosSnapshotHeader header;
+    memcpy(&header, gMosSnapshot, sizeof(header));
+    const uint32_t *index = (const uint32_t*)(gMosSnapshot+header.indexOffset);
+    std::vector<bool> saved(kMosSnapshotNumPages, false);
+    for (uint32_t i=0; i<header.numPages; i++) {
+        uint32_t p = index[i];
+        if (p>=kMosSnapshotNumPages)
+            return false;
+        memcpy(MosMem+p*kMosSnapshotPageSize, gMosSnapshot+header.dataOffset+i*kMosSnapshotPageSize, kMosSnapshotPageSize);
+        mosMarkDirty(p*kMosSnapshotPageSize, kMosSnapshotPageSize);
+        saved[p] = true;
+    }
+    static const byte zeroPage[kMosSnapshotPageSize] = { 0 };
+    for (uint32_t p=0; p<kMosSnapshotNumPages; p++) {
+        byte *page = MosMem+p*kMosSnapshotPageSize;
+        if (!saved[p] && memcmp(page, zeroPage, kMosSnapshotPageSize)!=0) {
+            memset(page, 0, kMosSnapshotPageSize);
+            mosMarkDirty(p*kMosSnapshotPageSize, kMosSnapshotPageSize);
+        }
+    }
+
+    MosSnapshotReader reader = { (const uint32_t*)(gMosSnapshot+sizeof(header)), header.stateSize, 0, false };
+    reader.pos = mosSnapshotIdentity().size();
+    gMosCurrentA5 = mosSnapshotRead(reader);
+    gMosCurrentStackBase = mosSnapshotRead(reader);
+    gMosCurJTOffset = mosSnapshotRead(reader);
+    gMosResLoad = mosSnapshotRead(reader);
+    gMosResErr = mosSnapshotRead(reader);
+    gMosMemErr = mosSnapshotRead(reader);
+    gMosMPWHandle = mosSnapshotRead(reader);
+    for (int i=0; i<kMosSnapshotNumRegs; i++)
+        m68k_set_reg(kMosSnapshotRegs[i], mosSnapshotRead(reader));
+    return mosLoadHeapState(reader)
+        && mosLoadTrapState(reader)
+        && mosLoadResourceState(reader)
+        && !reader.failed;
+}
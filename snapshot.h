@@ -0,0 +1,113 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+#ifndef __mosrun__snapshot__
+#define __mosrun__snapshot__
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+
+/**
+ * The host side state of the emulator is saved as a list of 32 bit words.
+ */
+typedef std::vector<uint32_t> MosSnapshotState;
+
+/**
+ * Read the saved state word by word.
+ */
+typedef struct
+{
+    const uint32_t *data;
+    size_t size, pos;
+    bool failed;    // set if we read past the end
+} MosSnapshotReader;
+
+
+extern const char *gMosSaveSnapshotPath;
+extern bool gMosSnapshotDue;
+
+bool mosSaveSnapshot(const char *path);
+bool mosOpenSnapshot(const char *path);
+bool mosLoadSnapshot();
+
+
+inline void mosSnapshotWrite(MosSnapshotState &state, uint32_t value)
+{
+    state.push_back(value);
+}
+
+inline void mosSnapshotWritePtr(MosSnapshotState &state, uint64_t value)
+{
+    state.push_back((uint32_t)value);
+    state.push_back((uint32_t)(value>>32));
+}
+
+inline uint32_t mosSnapshotRead(MosSnapshotReader &reader)
+{
+    if (reader.pos>=reader.size) {
+        reader.failed = true;
+        return 0;
+    }
+    return reader.data[reader.pos++];
+}
+
+inline uint64_t mosSnapshotReadPtr(MosSnapshotReader &reader)
+{
+    uint64_t lo = mosSnapshotRead(reader);
+    uint64_t hi = mosSnapshotRead(reader);
+    return lo | (hi<<32);
+}
+
+inline void mosSnapshotWriteString(MosSnapshotState &state, const std::string &text)
+{
+    state.push_back((uint32_t)text.size());
+    for (size_t i=0; i<text.size(); i+=4) {
+        uint32_t word = 0;
+        memcpy(&word, text.data()+i, text.size()-i<4 ? text.size()-i : 4);
+        state.push_back(word);
+    }
+}
+
+inline std::string mosSnapshotReadString(MosSnapshotReader &reader)
+{
+    uint32_t size = mosSnapshotRead(reader);
+    if (size/4>reader.size-reader.pos) {
+        reader.failed = true;
+        return std::string();
+    }
+    std::string text(size, 0);
+    for (uint32_t i=0; i<size; i+=4) {
+        uint32_t word = mosSnapshotRead(reader);
+        memcpy(&text[i], &word, size-i<4 ? size-i : 4);
+    }
+    return text;
+}
+
+
+#endif /* defined(__mosrun__snapshot__) */
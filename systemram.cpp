@@ -28,6 +28,7 @@
 #include "memory.h"
 #include "breakpoints.h"
 #include "traps.h"
+#include "snapshot.h"
 
 
 unsigned int gMosCurrentA5 = 0;
@@ -146,7 +147,10 @@ unsigned int m68k_read_memory_32(unsigned int address)
         case 4: return 0;
         case 0x0028: return trapDispatchTrap;
         case 0x020C: return mosTickCount(); /* Time */
-        case 0x0316: return gMosMPWHandle;
+        case 0x0316: // the runtime is about to read argv: save a snapshot if we were asked to
+            if (gMosSaveSnapshotPath)
+                gMosSnapshotDue = true;
+            return gMosMPWHandle;
         case 0x0910: // CurApName [GLOBAL VAR] Name of current application (length byte followed by up to 31 characters) name of application [STRING[31]]
         case 0x0914:
         case 0x0918:
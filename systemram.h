@@ -35,6 +35,9 @@ extern unsigned int gMosResErr;
 extern unsigned int gMosMemErr;
 extern unsigned int gMosMPWHandle;
 
+void mosSetMemError(unsigned int err);
+unsigned int mosGetMemError();
+
 extern "C" {
 unsigned int m68k_read_memory_8(unsigned int address);
 unsigned int m68k_read_memory_16(unsigned int address);
@@ -0,0 +1,232 @@
+/*
+ allocbench - Replay memory manager traces recorded by mosrun.
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+/*
+ Record a trace with `ARMLink ---record-alloc=armlink.trace ...` and replay
+ it with `AllocBench armlink.trace`. The trace is replayed against the
+ memory manager in memory.cpp, so different allocator strategies can be
+ compared without running the emulator.
+ */
+
+
+#include "../memory.h"
+#include "../log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+
+// memory.cpp needs these from main.cpp and log.cpp
+byte gCheckMemory = 0;
+
+void mosWarning(const char *format, ...)
+{
+    va_list va;
+    va_start(va, format);
+    vfprintf(stderr, format, va);
+    va_end(va);
+}
+
+void mosError(const char *format, ...)
+{
+    va_list va;
+    va_start(va, format);
+    vfprintf(stderr, format, va);
+    va_end(va);
+}
+
+
+enum AllocOpType {
+    kMalloc, kFree, kNewHandle, kDisposeHandle, kSetHandleSize, kReallocHandle,
+    kEmptyHandle, kHSetState, kMoreMasters, kCompactMem, kPurgeMem, kMaxMem, kMoveHHi
+};
+
+struct AllocOp {
+    AllocOpType type;
+    uint32_t addr;  // pointer or handle as it was recorded
+    uint32_t size;  // size, state, or number of bytes needed
+};
+
+static const struct { const char *name; AllocOpType type; int nAddr; int nSize; } gOpNames[] = {
+    { "malloc",        kMalloc,        1, 1 }, // size first, then address
+    { "free",          kFree,          1, 0 },
+    { "newhandle",     kNewHandle,     1, 1 }, // size first, then handle
+    { "disposehandle", kDisposeHandle, 1, 0 },
+    { "sethandlesize", kSetHandleSize, 1, 1 },
+    { "reallochandle", kReallocHandle, 1, 1 },
+    { "emptyhandle",   kEmptyHandle,   1, 0 },
+    { "hsetstate",     kHSetState,     1, 1 },
+    { "moremasters",   kMoreMasters,   0, 0 },
+    { "compactmem",    kCompactMem,    0, 1 },
+    { "purgemem",      kPurgeMem,      0, 1 },
+    { "maxmem",        kMaxMem,        0, 0 },
+    { "movehhi",       kMoveHHi,       1, 0 },
+};
+
+
+/**
+ * Read all operations from a trace file.
+ */
+static int readTrace(const char *filename, std::vector<AllocOp> &ops)
+{
+    FILE *f = fopen(filename, "rb");
+    if (!f) {
+        printf("AllocBench: can't open trace file \"%s\":\n%s\n", filename, strerror(errno));
+        return -1;
+    }
+    char line[256], name[32];
+    int a = 0, b = 0;
+    int lineNo = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineNo++;
+        if (line[0]=='#' || line[0]=='\n')
+            continue;
+        int n = sscanf(line, "%31s %i %i", name, &a, &b);
+        unsigned int i;
+        for (i=0; i<sizeof(gOpNames)/sizeof(gOpNames[0]); i++) {
+            if (strcmp(name, gOpNames[i].name)==0) break;
+        }
+        if (i==sizeof(gOpNames)/sizeof(gOpNames[0]) || n<1+gOpNames[i].nAddr+gOpNames[i].nSize) {
+            printf("AllocBench: %s:%d: can't read \"%s\"\n", filename, lineNo, strtok(line, "\n"));
+            fclose(f);
+            return -1;
+        }
+        AllocOp op = { gOpNames[i].type, 0, 0 };
+        if (op.type==kMalloc || op.type==kNewHandle) {
+            op.size = (uint32_t)a; op.addr = (uint32_t)b;
+        } else if (gOpNames[i].nAddr) {
+            op.addr = (uint32_t)a; op.size = (uint32_t)b;
+        } else {
+            op.size = (uint32_t)a;
+        }
+        ops.push_back(op);
+    }
+    fclose(f);
+    return 0;
+}
+
+
+/**
+ * Replay the trace once and print the statistics.
+ */
+static void replayTrace(const std::vector<AllocOp> &ops)
+{
+    std::unordered_map<uint32_t, mosPtr> ptrs;
+    std::unordered_map<uint32_t, mosHandle> hdls;
+    uint32_t peakFootprint = 0, peakFree = 0, unknown = 0;
+    double fragmentationSum = 0.0;
+
+    mosMemoryInit();
+    auto start = std::chrono::steady_clock::now();
+    for (const AllocOp &op: ops) {
+        switch (op.type) {
+            case kMalloc:
+                ptrs[op.addr] = mosNewPtr(op.size);
+                break;
+            case kFree: {
+                auto it = ptrs.find(op.addr);
+                if (it==ptrs.end()) { unknown++; break; }
+                mosDisposePtr(it->second);
+                ptrs.erase(it);
+                break; }
+            case kNewHandle:
+                hdls[op.addr] = mosNewHandle(op.size);
+                break;
+            case kDisposeHandle: {
+                auto it = hdls.find(op.addr);
+                if (it==hdls.end()) { unknown++; break; }
+                mosDisposeHandle(it->second);
+                hdls.erase(it);
+                break; }
+            case kMoreMasters:
+                mosMoreMasters();
+                break;
+            case kCompactMem:
+                mosCompactMem(op.size);
+                break;
+            case kPurgeMem:
+                mosPurgeMem(op.size);
+                break;
+            case kMaxMem:
+                mosMaxMem();
+                break;
+            default: {
+                auto it = hdls.find(op.addr);
+                if (it==hdls.end()) { unknown++; break; }
+                mosHandle h = it->second;
+                if (op.type==kSetHandleSize) mosSetHandleSize(h, op.size);
+                else if (op.type==kReallocHandle) mosReallocHandle(h, op.size);
+                else if (op.type==kEmptyHandle) mosEmptyHandle(h);
+                else if (op.type==kHSetState) mosHSetState(h, (byte)op.size);
+                else if (op.type==kMoveHHi) mosMoveHHi(h);
+                break; }
+        }
+        uint32_t freeInside = 0;
+        uint32_t footprint = mosHeapFootprint(&freeInside);
+        if (footprint>peakFootprint) {
+            peakFootprint = footprint;
+            peakFree = freeInside;
+        }
+        if (footprint)
+            fragmentationSum += (double)freeInside / footprint;
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end-start).count();
+
+    printf("operations:         %lu\n", (unsigned long)ops.size());
+    if (unknown)
+        printf("unknown addresses:  %u\n", unknown);
+    printf("time:               %.3f ms\n", seconds*1000.0);
+    printf("ops/sec:            %.0f\n", seconds>0.0 ? ops.size()/seconds : 0.0);
+    printf("peak footprint:     %u bytes\n", peakFootprint);
+    printf("free at peak:       %u bytes (%.1f%%)\n", peakFree,
+           peakFootprint ? 100.0*peakFree/peakFootprint : 0.0);
+    printf("mean fragmentation: %.1f%%\n", ops.empty() ? 0.0 : 100.0*fragmentationSum/ops.size());
+    printf("largest free block: %u of %u free bytes\n", mosMaxBlock(), mosFreeMem());
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc<2 || argc>3) {
+        printf("Usage: AllocBench trace.txt [repeat]\n");
+        return 30;
+    }
+    std::vector<AllocOp> ops;
+    if (readTrace(argv[1], ops)==-1)
+        return 30;
+    int repeat = (argc==3) ? atoi(argv[2]) : 1;
+    for (int i=0; i<repeat; i++) {
+        if (repeat>1)
+            printf("-- run %d of %d\n", i+1, repeat);
+        replayTrace(ops);
+        free(MosMem);
+    }
+    return 0;
+}
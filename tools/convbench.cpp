@@ -0,0 +1,113 @@
+/*
+ convbench - Measure the throughput of the MacRoman/UTF-8 text converters.
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+/*
+ `ConvBench [megabytes]` converts generated MacRoman text to UTF-8 and back
+ using the converters in filename.cpp, checks that the text survives the
+ round trip, and prints the throughput for pure ASCII text, source code
+ with a few Mac characters, and text that is mostly Mac characters.
+ */
+
+
+#include "../filename.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+
+/**
+ * Create MacRoman text with lines of 72 characters.
+ *
+ * \param size number of bytes to create
+ * \param macPerMille number of characters above 127 per 1000 characters
+ */
+static std::vector<char> createText(unsigned int size, unsigned int macPerMille)
+{
+    std::vector<char> text(size);
+    unsigned int seed = 12345;
+    for (unsigned int i=0; i<size; i++) {
+        seed = seed*1103515245 + 12345;
+        unsigned int r = (seed>>16) & 0x7fff;
+        if (i%73==72)
+            text[i] = '\r';
+        else if (r%1000<macPerMille)
+            text[i] = (char)(128 + r%128);
+        else
+            text[i] = (char)(' ' + r%95);
+    }
+    return text;
+}
+
+
+/**
+ * Convert the text back and forth and print the throughput.
+ *
+ * \return 0, or -1 if the text changed during the round trip
+ */
+static int runBench(const char *name, const std::vector<char> &mac, int repeat)
+{
+    double toUnix = 0.0, toMac = 0.0;
+    unsigned int unixSize = 0;
+    std::vector<char> utf8;
+    for (int i=0; i<repeat; i++) {
+        unsigned int size = (unsigned int)mac.size();
+        auto t0 = std::chrono::steady_clock::now();
+        char *u = mosDataMacToUnix(mac.data(), size);
+        auto t1 = std::chrono::steady_clock::now();
+        utf8.assign(u, u+size);
+        unixSize = size;
+        auto t2 = std::chrono::steady_clock::now();
+        char *m = mosDataUnixToMac(utf8.data(), size);
+        auto t3 = std::chrono::steady_clock::now();
+        if (size!=mac.size() || memcmp(m, mac.data(), size)!=0) {
+            printf("%-10s round trip FAILED\n", name);
+            return -1;
+        }
+        toUnix += std::chrono::duration<double>(t1-t0).count();
+        toMac += std::chrono::duration<double>(t3-t2).count();
+    }
+    double mb = (double)mac.size()*repeat/(1024.0*1024.0);
+    printf("%-10s Mac to UTF-8: %8.1f MB/s   UTF-8 to Mac: %8.1f MB/s   (%u -> %u bytes)\n",
+           name, toUnix>0.0 ? mb/toUnix : 0.0, toMac>0.0 ? mb/toMac : 0.0,
+           (unsigned int)mac.size(), unixSize);
+    return 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc>2) {
+        printf("Usage: ConvBench [megabytes]\n");
+        return 30;
+    }
+    int mb = (argc==2) ? atoi(argv[1]) : 16;
+    if (mb<1) mb = 1;
+    unsigned int size = 1024*1024;
+    int err = 0;
+    err |= runBench("ascii", createText(size, 0), mb);
+    err |= runBench("source", createText(size, 5), mb);
+    err |= runBench("mac", createText(size, 600), mb);
+    return err ? 30 : 0;
+}
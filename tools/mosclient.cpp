@@ -0,0 +1,70 @@
+/*
+ mosrun-client - Run a job on a resident mosrun server.
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+/*
+ Create a symbolic link with the name of a tool that points to mosrun-client,
+ e.g. `ln -s mosrun-client ARM6asm`, and start the server for that tool with
+ `ARM6asm ---server=$MOSRUN_SERVER/ARM6asm.sock`. Calling the link then
+ sends the arguments, the working directory, the environment, and stdin,
+ stdout, and stderr to the server, and returns the result of the tool.
+ `mosrun-client ARM6asm ...` does the same without a link.
+ */
+
+
+#include "../server.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+extern char **environ;
+
+
+int main(int argc, const char **argv)
+{
+    const char *tool = strrchr(argv[0], '/');
+    tool = tool ? tool+1 : argv[0];
+    if (strcmp(tool, "mosrun-client")==0) {
+        if (argc<2) {
+            fprintf(stderr, "Usage: mosrun-client tool [arguments ...]\n");
+            return 1;
+        }
+        tool = argv[1];
+        argv++;
+        argc--;
+    }
+    const char *dir = getenv("MOSRUN_SERVER");
+    if (!dir || !*dir) {
+        fprintf(stderr, "mosrun-client: MOSRUN_SERVER must name the directory of the server sockets\n");
+        return 3;
+    }
+    std::string path = std::string(dir) + "/" + tool + ".sock";
+    int result = 0;
+    if (!mosServerSendJob(path.c_str(), tool, argc-1, argv+1, environ, result)) {
+        fprintf(stderr, "mosrun-client: can't run %s on the server at '%s': %s\n",
+                tool, path.c_str(), strerror(errno));
+        return 3;
+    }
+    return result;
+}
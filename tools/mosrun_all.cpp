@@ -0,0 +1,66 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+/*
+ All embedded tools in a single executable. Create symbolic links with the
+ name of a tool that point to mosrun-all, e.g. `ln -s mosrun-all ARMCpp`, and
+ mosrun-all will run the tool that matches the name it was called by.
+ `mosrun-all ARMCpp ...` does the same without a link.
+ */
+
+#include "rsrc.h"
+
+
+MOS_INCBIN_DATA(mosRsrcAIFtoNTK, mosRsrcAIFtoNTKEnd, "rsrc_aiftontk.bin")
+MOS_INCBIN_DATA(mosRsrcARM6asm, mosRsrcARM6asmEnd, "rsrc_arm6asm.bin")
+MOS_INCBIN_DATA(mosRsrcARM6c, mosRsrcARM6cEnd, "rsrc_arm6c.bin")
+MOS_INCBIN_DATA(mosRsrcARMCpp, mosRsrcARMCppEnd, "rsrc_armcpp.bin")
+MOS_INCBIN_DATA(mosRsrcARMLink, mosRsrcARMLinkEnd, "rsrc_armlink.bin")
+MOS_INCBIN_DATA(mosRsrcDumpAIF, mosRsrcDumpAIFEnd, "rsrc_dumpaif.bin")
+MOS_INCBIN_DATA(mosRsrcDumpAOF, mosRsrcDumpAOFEnd, "rsrc_dumpaof.bin")
+MOS_INCBIN_DATA(mosRsrcProtocolGenTool, mosRsrcProtocolGenToolEnd, "rsrc_protocolgentool.bin")
+MOS_INCBIN_DATA(mosRsrcRex, mosRsrcRexEnd, "rsrc_rex.bin")
+MOS_INCBIN_DATA(mosRsrcPacker, mosRsrcPackerEnd, "rsrc_packer.bin")
+
+static const MosEmbeddedTool gTools[] = {
+    { "AIFtoNTK",        mosRsrcAIFtoNTK,        mosRsrcAIFtoNTKEnd,        1 },
+    { "ARM6asm",         mosRsrcARM6asm,         mosRsrcARM6asmEnd,         1 },
+    { "ARM6c",           mosRsrcARM6c,           mosRsrcARM6cEnd,           1 },
+    { "ARMCpp",          mosRsrcARMCpp,          mosRsrcARMCppEnd,          1 },
+    { "ARMLink",         mosRsrcARMLink,         mosRsrcARMLinkEnd,         1 },
+    { "DumpAIF",         mosRsrcDumpAIF,         mosRsrcDumpAIFEnd,         1 },
+    { "DumpAOF",         mosRsrcDumpAOF,         mosRsrcDumpAOFEnd,         1 },
+    { "ProtocolGenTool", mosRsrcProtocolGenTool, mosRsrcProtocolGenToolEnd, 1 },
+    { "Rex",             mosRsrcRex,             mosRsrcRexEnd,             1 },
+    { "Packer",          mosRsrcPacker,          mosRsrcPackerEnd,          1 },
+    { nullptr,           nullptr,                nullptr,                   0 }
+};
+
+// filled in by loadEmbeddedApp() from the list above
+const unsigned char *gAppResource = nullptr;
+unsigned int gAppResourceSize = 0;
+unsigned int gAppResourceCompressed = 0;
+
+// gMosEmbeddedTools is a constant initialized pointer in main.cpp, so it is
+// safe to set it from a static initializer
+static struct MosRegisterTools {
+    MosRegisterTools() { gMosEmbeddedTools = gTools; }
+} gRegisterTools;
@@ -2,8 +2,56 @@
 #ifndef __mosrun__rsrc__
 #define __mosrun__rsrc__
 
-extern unsigned char *gAppResource;
+extern const unsigned char *gAppResource;
 extern unsigned int gAppResourceSize;
+extern unsigned int gAppResourceCompressed;
 
-#endif /* defined(__mosrun__rsrc__) */
+// A multi-call binary embeds a list of tools and picks one by its name.
+struct MosEmbeddedTool {
+    const char *name;
+    const unsigned char *start, *end;
+    unsigned int compressed;
+};
+extern const MosEmbeddedTool *gMosEmbeddedTools;
+
+// MOS_INCBIN() lets the assembler include a resource fork written by
+// ---dumprsrc. MOS_RSRC_DIR is the directory that contains the .bin file.
+#ifndef MOS_RSRC_DIR
+#define MOS_RSRC_DIR "."
+#endif
+
+#if defined(__APPLE__)
+#define MOS_RSRC_SECTION ".const_data\n"
+#define MOS_RSRC_SYMBOL(name) "_" #name
+#elif defined(_WIN32) && !defined(_WIN64)
+#define MOS_RSRC_SECTION ".section .rdata\n"
+#define MOS_RSRC_SYMBOL(name) "_" #name
+#elif defined(_WIN32)
+#define MOS_RSRC_SECTION ".section .rdata\n"
+#define MOS_RSRC_SYMBOL(name) #name
+#else
+#define MOS_RSRC_SECTION ".section .rodata\n"
+#define MOS_RSRC_SYMBOL(name) #name
+#endif
 
+#define MOS_INCBIN_DATA(start, end, file) \
+    extern "C" const unsigned char start[]; \
+    extern "C" const unsigned char end[]; \
+    __asm__( \
+        MOS_RSRC_SECTION \
+        ".globl " MOS_RSRC_SYMBOL(start) "\n" \
+        ".balign 16\n" \
+        MOS_RSRC_SYMBOL(start) ":\n" \
+        ".incbin \"" MOS_RSRC_DIR "/" file "\"\n" \
+        ".globl " MOS_RSRC_SYMBOL(end) "\n" \
+        MOS_RSRC_SYMBOL(end) ":\n" \
+        ".byte 0\n" \
+        ".text\n" \
+    );
+
+#define MOS_INCBIN(file) \
+    MOS_INCBIN_DATA(mosRsrcStart, mosRsrcEnd, file) \
+    const unsigned char *gAppResource = mosRsrcStart; \
+    unsigned int gAppResourceSize = (unsigned int)(mosRsrcEnd - mosRsrcStart);
+
+#endif /* defined(__mosrun__rsrc__) */
@@ -1,2965 +1,6 @@
 
 #include "rsrc.h"
 
-unsigned char rsrc[] = {
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x33, 0x00, 0x00, 0xB7, 0x33, 0x00, 0x00, 0x00, 0x8B, 
-    0x4E, 0xD0, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x76, 0x00, 0x20, 0x2B, 0x00, 0x12, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x67, 0x06, 
-    0x08, 0x41, 0x49, 0x46, 0x74, 0x6F, 0x4E, 0x54, 0x4B, 0x46, 0x02, 0x00, 0x00, 0x00, 0x4D, 0x50, 
-    0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAF, 0x7A, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xBE, 0xB0, 0x81, 
-    0x67, 0x00, 0x00, 0x90, 0x72, 0x21, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x88, 0x72, 0x22, 0xB0, 0x81, 
-    0x67, 0x00, 0x00, 0x80, 0x72, 0x23, 0xB0, 0x81, 0x67, 0x78, 0x72, 0x24, 0xB0, 0x81, 0x67, 0x72, 
-    0x72, 0x25, 0xB0, 0x81, 0x67, 0x6C, 0x72, 0x57, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xB6, 0x72, 0x58, 
-    0xB0, 0x81, 0x67, 0x00, 0x00, 0xAE, 0x72, 0x5A, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xA6, 0x72, 0x5F, 
-    0xB0, 0x81, 0x67, 0x00, 0x00, 0xA6, 0x72, 0x13, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xBE, 0x60, 0x00, 
-    0x00, 0xC0, 0x24, 0x6B, 0x00, 0x02, 0x10, 0x12, 0x72, 0x13, 0xB0, 0x01, 0x67, 0x10, 0x20, 0x6A, 
-    0x00, 0x02, 0x20, 0x28, 0x00, 0x20, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x66, 0x08, 0x00, 0x83, 
-    0x00, 0x00, 0x00, 0x04, 0x60, 0x5A, 0x20, 0x6B, 0x00, 0x02, 0x20, 0x68, 0x00, 0x02, 0xB1, 0xCC, 
-    0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x98, 0x00, 0x00, 0x2E, 0x34, 0x00, 0x00, 0x02, 0x78, 
-    0x00, 0x00, 0x00, 0x20, 0x55, 0xCE, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x05, 0xB0, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x07, 0x4E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x0A, 0xD0, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x49, 0x68, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x49, 0xE8, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4B, 0x60, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4B, 0xA6, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4B, 0xAC, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4B, 0xB2, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4C, 0x1E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4D, 0x7A, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4D, 0xC8, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x16, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x18, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x1A, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x1C, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x1E, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x22, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x24, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x26, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x28, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x2A, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x2C, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x2E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x30, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x32, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x4F, 0x34, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x54, 0x2E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x54, 0x64, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x55, 0x4C, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x56, 0x74, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x56, 0xA4, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x56, 0xD2, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x57, 0x00, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x57, 0x5A, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x5A, 0x76, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x5A, 0xEE, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x5B, 0x5E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x5B, 0xE2, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x5C, 0x66, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x5F, 0xAA, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x61, 0x5C, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x62, 0x26, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x65, 0x1E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x65, 0xB4, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x66, 0x1E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x67, 0xA2, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x69, 0xE0, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x6A, 0x16, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x6A, 0x62, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x6A, 0xE2, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x6C, 0x74, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x6E, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x01, 0x02, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x03, 0x68, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x05, 0xFA, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x06, 0xE8, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x07, 0x14, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x07, 0x2C, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x07, 0x4C, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x08, 0x16, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x09, 0x22, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x09, 0x60, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x0A, 0xEE, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x0C, 0x9C, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x0C, 0xD8, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x0D, 0x18, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x0D, 0x5A, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x0D, 0xAE, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x1A, 0x3C, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x25, 0xB0, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x27, 0x2A, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x27, 0xCC, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x2D, 0x0C, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x2D, 0x2E, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x2D, 0x9E, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x40, 0x22, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x6C, 0x98, 
-    0x00, 0x00, 0x00, 0x35, 0x4E, 0x56, 0x00, 0x00, 0x10, 0x2D, 0xD7, 0x14, 0x67, 0x30, 0x48, 0x6D, 
-    0xF3, 0xA2, 0x48, 0x7A, 0x00, 0x44, 0x4E, 0xAD, 0x02, 0x0A, 0x50, 0x4F, 0x48, 0x6E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x3A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x48, 0x6D, 0xF3, 0xA2, 0x48, 0x7A, 0x00, 0x1E, 0x4E, 0xAD, 0x02, 0x0A, 0x50, 0x4F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5F, 0x5F, 0x44, 0x50, 0x63, 
-    0x65, 0x00, 0x00, 0x08, 0x2E, 0x0D, 0x00, 0x00, 0x23, 0x20, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x6A, 0x58, 0x4F, 0x2F, 0x2D, 0xD7, 0x0C, 0x48, 0x7A, 
-    0x00, 0x62, 0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 
-    0x00, 0x0C, 0x67, 0x14, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x7A, 0x00, 0x52, 0x48, 0x6D, 0xF3, 0xA2, 
-    0x4E, 0xAD, 0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 
-    0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x3A, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x6D, 0xF3, 0xA2, 
-    0x48, 0x7A, 0x00, 0x30, 0x4E, 0xAD, 0x02, 0x0A, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x0C, 0x90, 0x76, 
-    0x5F, 0x67, 0x6F, 0x6F, 0x66, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x54, 0x31, 0x50, 0x63, 0x00, 
-    0x00, 0x14, 0x23, 0x23, 0x23, 0x20, 0x25, 0x73, 0x20, 0x2D, 0x20, 0x00, 0x25, 0x73, 0x20, 0x2D, 
-    0x20, 0x00, 0x2E, 0x0D, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x7A, 
-    0x00, 0x26, 0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 0xFF, 0x64, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x77, 
-    0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x5F, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 
-    0x44, 0x50, 0x63, 0x65, 0x00, 0x08, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x7A, 0x00, 0x2A, 0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 
-    0xFF, 0x2C, 0x70, 0x02, 0x2B, 0x40, 0xD7, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x65, 0x72, 0x72, 
-    0x6F, 0x72, 0x5F, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x44, 0x50, 0x63, 0x65, 
-    0x00, 0x06, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 
-    0x00, 0x08, 0x4A, 0x12, 0x67, 0x0E, 0x2F, 0x0A, 0x48, 0x7A, 0x00, 0x6C, 0x48, 0x6E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0xFE, 0xEA, 0x2F, 0x2D, 0xD7, 0x0C, 0x48, 0x6D, 0xD6, 0x80, 0x48, 0x6D, 0xF3, 0xA2, 
-    0x4E, 0xAD, 0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x45, 0xED, 0xD6, 0xE8, 0x60, 0x14, 0x2F, 0x12, 
-    0x48, 0x7A, 0x00, 0x4E, 0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x58, 0x4A, 0x4A, 0x92, 0x66, 0xE8, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x64, 0x5E, 0x58, 0x4F, 
-    0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x75, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x65, 0x78, 0x69, 
-    0x74, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x5F, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 
-    0x44, 0x50, 0x63, 0x65, 0x00, 0x0E, 0x62, 0x61, 0x64, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x00, 
-    0x25, 0x73, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x7A, 0x00, 0x4A, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x66, 0x48, 0x6E, 0xFF, 0x00, 0x3F, 0x2E, 0x00, 0x10, 
-    0x4E, 0xAD, 0x02, 0x8A, 0x5C, 0x4F, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x26, 0x48, 0x6D, 0xF3, 0xA2, 
-    0x4E, 0xAD, 0x02, 0x32, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x0A, 0x92, 0x76, 0x5F, 0x65, 0x72, 0x72, 
-    0x5F, 0x67, 0x6F, 0x6F, 0x66, 0x5F, 0x5F, 0x46, 0x73, 0x50, 0x63, 0x50, 0x63, 0x00, 0x00, 0x0E, 
-    0x23, 0x20, 0x25, 0x73, 0x2E, 0x0D, 0x00, 0x00, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x30, 0x2D, 0xF6, 0xF6, 0x67, 0x12, 0x3F, 0x2D, 0xF6, 0xF6, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 0xFF, 0x8E, 0x60, 0x10, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x7A, 
-    0x00, 0x30, 0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 0xFD, 0xF4, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x63, 0x9A, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x65, 0x78, 0x69, 0x74, 0x5F, 0x77, 0x69, 0x74, 0x68, 
-    0x5F, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x44, 0x50, 0x63, 0x65, 0x00, 0x06, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x30, 0x2E, 0x00, 0x08, 0x67, 0x1A, 
-    0x3F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0A, 0x48, 0x6E, 0x00, 0x0E, 0x4E, 0xBA, 0xFF, 0x36, 
-    0x70, 0x02, 0x2B, 0x40, 0xD7, 0x10, 0x70, 0x01, 0x60, 0x02, 0x42, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x92, 0x52, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x4F, 0x53, 0x45, 0x72, 0x72, 0x5F, 0x5F, 0x44, 0x73, 
-    0x50, 0x63, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x30, 0x2E, 0x00, 0x08, 0x67, 0x1A, 
-    0x3F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0A, 0x48, 0x6E, 0x00, 0x0E, 0x4E, 0xBA, 0xFE, 0xF6, 
-    0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x63, 0x14, 0x58, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x65, 
-    0x78, 0x69, 0x74, 0x5F, 0x69, 0x66, 0x5F, 0x4F, 0x53, 0x45, 0x72, 0x72, 0x5F, 0x5F, 0x44, 0x73, 
-    0x50, 0x63, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x10, 
-    0x58, 0x4A, 0xB5, 0xEE, 0x00, 0x0C, 0x65, 0x16, 0x20, 0x6E, 0x00, 0x10, 0x2F, 0x10, 0x2F, 0x2E, 
-    0x00, 0x08, 0x48, 0x7A, 0x00, 0x2E, 0x4E, 0xBA, 0xFE, 0x20, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x5F, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x0C, 0x98, 0x61, 0x73, 0x73, 0x75, 0x72, 0x65, 0x4E, 0x65, 0x78, 
-    0x74, 0x41, 0x72, 0x67, 0x5F, 0x5F, 0x46, 0x50, 0x50, 0x43, 0x63, 0x54, 0x31, 0x50, 0x63, 0x00, 
-    0x00, 0x14, 0x6E, 0x6F, 0x20, 0x25, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 
-    0xD2, 0x25, 0x73, 0xD3, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x24, 0x6E, 
-    0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x10, 0x1B, 0x76, 0x00, 0x16, 0x00, 0x2F, 0x03, 0x4E, 0xAD, 
-    0x01, 0xCA, 0x58, 0x4F, 0x28, 0x00, 0x12, 0x1A, 0x70, 0x00, 0x10, 0x01, 0x98, 0x80, 0x66, 0x04, 
-    0x4A, 0x83, 0x66, 0xE2, 0x20, 0x04, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 
-    0x91, 0x68, 0x63, 0x69, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 
-    0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x26, 0x6E, 0x00, 0x0C, 0x2D, 0x4B, 0xFF, 0xFC, 0x60, 0x00, 0x01, 0x16, 0x24, 0x53, 0x2F, 0x0A, 
-    0x48, 0x7A, 0x01, 0x3A, 0x4E, 0xBA, 0xFF, 0x90, 0x4A, 0x80, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 
-    0xD7, 0x14, 0x60, 0x00, 0x00, 0xFA, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x26, 0x4E, 0xBA, 0xFF, 0x78, 
-    0x4A, 0x80, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xD7, 0x1C, 0x60, 0x00, 0x00, 0xE2, 0x2F, 0x0A, 
-    0x48, 0x7A, 0x01, 0x12, 0x4E, 0xBA, 0xFF, 0x60, 0x4A, 0x80, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 
-    0xD7, 0x16, 0x60, 0x00, 0x00, 0xCA, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x00, 0x4E, 0xBA, 0xFF, 0x48, 
-    0x4A, 0x80, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xD7, 0x18, 0x60, 0x00, 0x00, 0xB2, 0x2F, 0x0A, 
-    0x48, 0x7A, 0x00, 0xEE, 0x4E, 0xBA, 0xFF, 0x30, 0x4A, 0x80, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 
-    0xD7, 0x1A, 0x60, 0x00, 0x00, 0x9A, 0x2F, 0x0A, 0x48, 0x7A, 0x00, 0xDA, 0x4E, 0xBA, 0xFF, 0x18, 
-    0x4A, 0x80, 0x66, 0x42, 0x1B, 0x7C, 0x00, 0x01, 0xD7, 0x1E, 0x2F, 0x0B, 0x2F, 0x0C, 0x48, 0x7A, 
-    0x00, 0xCA, 0x4E, 0xBA, 0xFE, 0xA2, 0x58, 0x4B, 0x20, 0x4B, 0x20, 0x10, 0x22, 0x2D, 0xD7, 0x2A, 
-    0x76, 0x02, 0xE7, 0xA1, 0x41, 0xED, 0xD7, 0x22, 0x21, 0x80, 0x10, 0x00, 0x52, 0xAD, 0xD7, 0x2A, 
-    0x20, 0x2D, 0xD7, 0x2A, 0xB0, 0x83, 0x6F, 0x56, 0x2F, 0x03, 0x48, 0x7A, 0x00, 0xB2, 0x4E, 0xBA, 
-    0xFD, 0x9E, 0x50, 0x4F, 0x60, 0x48, 0x2F, 0x0A, 0x48, 0x7A, 0x00, 0xDC, 0x4E, 0xBA, 0xFE, 0xC8, 
-    0x4A, 0x80, 0x66, 0x18, 0x2F, 0x0B, 0x2F, 0x0C, 0x48, 0x7A, 0x00, 0xD0, 0x4E, 0xBA, 0xFE, 0x58, 
-    0x58, 0x4B, 0x20, 0x4B, 0x20, 0x10, 0x2B, 0x40, 0xD7, 0x2E, 0x60, 0x22, 0x10, 0x12, 0x72, 0x2D, 
-    0xB0, 0x01, 0x67, 0x0E, 0x20, 0x13, 0x20, 0x6E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x80, 
-    0x60, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 0x00, 0xB8, 0x4E, 0xBA, 0xFC, 0x6E, 0x50, 0x4F, 0x58, 0x4B, 
-    0xB7, 0xCC, 0x65, 0x00, 0xFE, 0xE8, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x74, 0x00, 0x08, 0x95, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 
-    0x73, 0x5F, 0x5F, 0x46, 0x50, 0x50, 0x43, 0x63, 0x54, 0x31, 0x00, 0x98, 0x2D, 0x70, 0x00, 0x00, 
-    0x2D, 0x73, 0x00, 0x00, 0x2D, 0x64, 0x75, 0x6D, 0x70, 0x00, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x00, 
-    0x2D, 0x73, 0x6C, 0x00, 0x2D, 0x76, 0x69, 0x61, 0x00, 0x00, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x00, 0x00, 0x25, 0x64, 
-    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 
-    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6C, 
-    0x6C, 0x6F, 0x77, 0x65, 0x64, 0x00, 0x2D, 0x6F, 0x00, 0x00, 0x4E, 0x54, 0x4B, 0x20, 0x6F, 0x75, 
-    0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0xD2, 0x25, 
-    0x73, 0xD3, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 
-    0x69, 0x6F, 0x6E, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x20, 0x2D, 0xD7, 0xBC, 0x67, 0x22, 0x2F, 0x2D, 
-    0xD7, 0xBC, 0x48, 0x6E, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x48, 0x7A, 0x00, 0xD4, 
-    0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xFC, 0xC0, 0x5C, 0x4F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xBC, 
-    0x20, 0x2D, 0xD7, 0xC8, 0x67, 0x22, 0x2F, 0x2D, 0xD7, 0xC8, 0x48, 0x6E, 0xFF, 0xFA, 0x3F, 0x3C, 
-    0x00, 0x20, 0xA8, 0x8F, 0x48, 0x7A, 0x00, 0xD2, 0x3F, 0x2E, 0xFF, 0xFA, 0x4E, 0xBA, 0xFC, 0x98, 
-    0x5C, 0x4F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xC8, 0x20, 0x2D, 0xD7, 0xC0, 0x67, 0x22, 0x2F, 0x2D, 
-    0xD7, 0xC0, 0x48, 0x6E, 0xFF, 0xFC, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x48, 0x7A, 0x00, 0xD0, 
-    0x3F, 0x2E, 0xFF, 0xFC, 0x4E, 0xBA, 0xFC, 0x70, 0x5C, 0x4F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xC0, 
-    0x20, 0x2D, 0xD7, 0xC4, 0x67, 0x22, 0x2F, 0x2D, 0xD7, 0xC4, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 
-    0x00, 0x20, 0xA8, 0x8F, 0x48, 0x7A, 0x00, 0xCE, 0x3F, 0x2E, 0xFF, 0xFE, 0x4E, 0xBA, 0xFC, 0x48, 
-    0x5C, 0x4F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xC4, 0x20, 0x2D, 0xD7, 0xDC, 0x67, 0x20, 0x20, 0x6D, 
-    0xD7, 0xDC, 0xA0, 0x1F, 0x48, 0x7A, 0x00, 0xCC, 0x55, 0x4F, 0x3E, 0xB8, 0x02, 0x20, 0x30, 0x1F, 
-    0x3F, 0x00, 0x4E, 0xBA, 0xFC, 0x22, 0x5C, 0x4F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xDC, 0x20, 0x2D, 
-    0xD7, 0x36, 0x67, 0x10, 0x2F, 0x2D, 0xD7, 0x36, 0x4E, 0xAD, 0x02, 0x62, 0x58, 0x4F, 0x70, 0x00, 
-    0x2B, 0x40, 0xD7, 0x36, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x6D, 0x79, 0x65, 0x78, 0x69, 0x74, 0x00, 
-    0x00, 0xB0, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 
-    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x54, 0x4D, 0x20, 
-    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 
-    0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x64, 
-    0x61, 0x74, 0x61, 0x20, 0x54, 0x4D, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x54, 0x4D, 0x20, 0x68, 0x61, 0x6E, 0x64, 
-    0x6C, 0x65, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 
-    0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x54, 0x4D, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 
-    0x72, 0x65, 0x6C, 0x6F, 0x63, 0x5F, 0x74, 0x62, 0x6C, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 
-    0x72, 0x00, 0x2F, 0x2D, 0xD7, 0x0C, 0x48, 0x7A, 0x00, 0x1C, 0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 
-    0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x5E, 0x9E, 0x58, 0x4F, 
-    0x4E, 0x75, 0x00, 0x18, 0x23, 0x23, 0x23, 0x20, 0x25, 0x73, 0x3A, 0x20, 0x75, 0x73, 0x65, 0x72, 
-    0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x72, 0x75, 0x70, 0x74, 0x0D, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x18, 0x00, 0x26, 0x2E, 0x00, 0x08, 0x70, 0x02, 0xB6, 0x80, 0x6F, 0x06, 0x70, 0x09, 
-    0xB6, 0x80, 0x6D, 0x06, 0x70, 0x0A, 0xB6, 0x80, 0x6F, 0x08, 0x28, 0x2D, 0xD7, 0xE4, 0x52, 0xAD, 
-    0xD7, 0xE4, 0x2F, 0x2E, 0x00, 0x0C, 0x10, 0x2E, 0x00, 0x0B, 0x49, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x02, 0x12, 0x50, 0x4F, 0x20, 0x04, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 
-    0x93, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x4F, 0x62, 0x6A, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 
-    0x49, 0x4C, 0x45, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x26, 0x2E, 0x00, 0x08, 
-    0x6B, 0x1C, 0x0C, 0x83, 0x00, 0x00, 0x00, 0xFE, 0x6E, 0x14, 0x2F, 0x2E, 0x00, 0x0C, 0x10, 0x2E, 
-    0x00, 0x0B, 0x49, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x12, 0x50, 0x4F, 0x60, 0x28, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0x4E, 0xAD, 0x02, 0x12, 0x50, 0x4F, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xAD, 
-    0x02, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x94, 0x53, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x4C, 0x6F, 0x6E, 0x67, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 
-    0x4C, 0x45, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x42, 0xA7, 
-    0x4E, 0xAD, 0x02, 0x12, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x2E, 0x00, 0x08, 0xE5, 0x80, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x72, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x95, 0x53, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x49, 0x6D, 0x6D, 0x65, 0x64, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1C, 0x38, 0x24, 0x6E, 0x00, 0x08, 
-    0x2F, 0x0A, 0x4E, 0xAD, 0x01, 0xFA, 0x58, 0x4F, 0x2A, 0x00, 0x0C, 0x85, 0x00, 0x00, 0x00, 0xFE, 
-    0x6F, 0x0A, 0x48, 0x7A, 0x01, 0x48, 0x4E, 0xBA, 0xF9, 0x86, 0x58, 0x4F, 0x78, 0x00, 0x60, 0x34, 
-    0x20, 0x04, 0xD0, 0x8A, 0x20, 0x40, 0x10, 0x10, 0x1D, 0x40, 0xFF, 0xFC, 0x72, 0x20, 0xB0, 0x01, 
-    0x65, 0x0C, 0x72, 0x7C, 0xB0, 0x01, 0x67, 0x06, 0x72, 0x5C, 0xB0, 0x01, 0x66, 0x14, 0x2F, 0x0A, 
-    0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x48, 0x7A, 0x01, 0x48, 0x4E, 0xBA, 0xF9, 0x52, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x52, 0x84, 0xB8, 0x85, 0x6D, 0xC8, 0x78, 0x00, 0x47, 0xED, 0xD7, 0xEE, 0x49, 0xED, 
-    0xD7, 0xF2, 0x60, 0x4C, 0x20, 0x14, 0xB0, 0x85, 0x66, 0x3E, 0x2F, 0x05, 0x2F, 0x13, 0x2F, 0x0A, 
-    0x4E, 0xAD, 0x01, 0xE2, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x66, 0x2C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x70, 0x09, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x12, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x04, 
-    0x4C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x41, 0xED, 0xD7, 0xF6, 0x2F, 0x30, 0x00, 0x00, 
-    0x4E, 0xBA, 0xFE, 0xA4, 0x4E, 0xFA, 0x00, 0x8C, 0x76, 0x0C, 0xD7, 0xC3, 0xD9, 0xC3, 0x52, 0x84, 
-    0xB8, 0xAD, 0xD7, 0xEA, 0x6D, 0xAE, 0x2F, 0x2E, 0x00, 0x0C, 0x70, 0x07, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x02, 0x12, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x05, 0x4E, 0xBA, 0xFE, 0x7A, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x05, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0A, 0x4E, 0xAD, 0x02, 0x22, 0x4F, 0xEF, 
-    0x00, 0x10, 0x26, 0x2D, 0xD7, 0xEA, 0x0C, 0x83, 0x00, 0x00, 0x01, 0xF4, 0x6C, 0x44, 0x4C, 0x3C, 
-    0x30, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x41, 0xED, 0xD7, 0xEE, 0x21, 0x8A, 0x30, 0x00, 0x20, 0x2D, 
-    0xD7, 0xEA, 0x4C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x41, 0xED, 0xD7, 0xF2, 0x21, 0x85, 
-    0x00, 0x00, 0x20, 0x2D, 0xD7, 0xE4, 0x52, 0xAD, 0xD7, 0xE4, 0x22, 0x2D, 0xD7, 0xEA, 0x4C, 0x3C, 
-    0x10, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x41, 0xED, 0xD7, 0xF6, 0x21, 0x80, 0x10, 0x00, 0x52, 0xAD, 
-    0xD7, 0xEA, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x9D, 0x53, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x43, 0x73, 0x74, 0x72, 0x67, 0x32, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x5F, 
-    0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x63, 0x00, 0x6C, 0x20, 0x66, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x65, 0x78, 0x63, 0x65, 0x65, 
-    0x64, 0x73, 0x20, 0x6D, 0x61, 0x78, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x68, 0x20, 0x6F, 0x66, 0x20, 
-    0x61, 0x20, 0x4E, 0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 
-    0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
-    0x65, 0x72, 0x20, 0x28, 0x30, 0x78, 0x25, 0x32, 0x78, 0x29, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 
-    0x20, 0x69, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 
-    0x24, 0x6E, 0x00, 0x14, 0x2F, 0x0A, 0x70, 0x03, 0x2F, 0x00, 0x4E, 0xBA, 0xFD, 0x10, 0x26, 0x00, 
-    0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFD, 0x5E, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x10, 
-    0x4E, 0xBA, 0xFE, 0x02, 0x2F, 0x0A, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xAD, 0x02, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x03, 0x4C, 0xDF, 0x04, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x10, 0x9B, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x42, 0x69, 0x6E, 
-    0x61, 0x72, 0x79, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x63, 0x50, 0x55, 
-    0x63, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x10, 0x20, 0x6E, 
-    0x00, 0x0C, 0x90, 0x90, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x53, 0x6F, 0x72, 0x74, 0x52, 0x65, 0x6C, 
-    0x6F, 0x63, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x30, 0x26, 0x6E, 
-    0x00, 0x08, 0x2A, 0x2D, 0xD7, 0xE0, 0x76, 0x02, 0xE7, 0xA5, 0x2F, 0x0B, 0x70, 0x03, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xFC, 0x7A, 0x2F, 0x0B, 0x20, 0x05, 0x58, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0xC8, 
-    0x2F, 0x0B, 0x48, 0x7A, 0x00, 0x9A, 0x4E, 0xBA, 0xFD, 0x6C, 0x2F, 0x0B, 0x70, 0x01, 0x2F, 0x00, 
-    0x70, 0x04, 0x2F, 0x00, 0x48, 0x6D, 0xD7, 0xE0, 0x4E, 0xAD, 0x02, 0x22, 0x4F, 0xEF, 0x00, 0x10, 
-    0x28, 0x2D, 0xD7, 0xE0, 0x6F, 0x56, 0xB8, 0x83, 0x66, 0x1C, 0x24, 0x6D, 0xD7, 0xDC, 0x26, 0x2A, 
-    0x00, 0x04, 0x20, 0x12, 0xB6, 0x80, 0x64, 0x30, 0x28, 0x12, 0x24, 0x83, 0x20, 0x6D, 0xD7, 0xDC, 
-    0x21, 0x44, 0x00, 0x04, 0x60, 0x22, 0x0C, 0xAD, 0x00, 0x00, 0x00, 0x02, 0xD7, 0xE0, 0x6F, 0x18, 
-    0x48, 0x6D, 0x00, 0x3A, 0x70, 0x04, 0x2F, 0x00, 0x2F, 0x2D, 0xD7, 0xE0, 0x2F, 0x2D, 0xD7, 0xDC, 
-    0x4E, 0xAD, 0x01, 0xDA, 0x4F, 0xEF, 0x00, 0x10, 0x2F, 0x0B, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x05, 
-    0x2F, 0x2D, 0xD7, 0xDC, 0x4E, 0xAD, 0x02, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xDF, 0x0C, 0x38, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x95, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x52, 0x65, 0x6C, 
-    0x6F, 0x63, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x08, 0x72, 0x65, 
-    0x6C, 0x6F, 0x63, 0x73, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 
-    0x00, 0x10, 0x76, 0x00, 0x28, 0x6E, 0x00, 0x08, 0x60, 0x02, 0x52, 0x83, 0x28, 0x6C, 0x00, 0x04, 
-    0x20, 0x0C, 0x66, 0xF6, 0x2F, 0x0B, 0x70, 0x05, 0x2F, 0x00, 0x4E, 0xBA, 0xFB, 0xA0, 0x2F, 0x0B, 
-    0x2F, 0x03, 0x4E, 0xBA, 0xFB, 0xF2, 0x28, 0x6E, 0x00, 0x08, 0x60, 0x54, 0x2F, 0x0B, 0x70, 0x06, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFB, 0x88, 0x2F, 0x0B, 0x70, 0x03, 0x2F, 0x00, 0x4E, 0xBA, 0xFB, 0xD8, 
-    0x2F, 0x0B, 0x48, 0x7A, 0x00, 0x9A, 0x4E, 0xBA, 0xFC, 0x7C, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0x88, 
-    0x4E, 0xBA, 0xFC, 0x72, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0x76, 0x4E, 0xBA, 0xFC, 0x68, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x14, 0x4E, 0xBA, 0xFC, 0x5E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xBA, 
-    0xFC, 0x16, 0x2F, 0x0B, 0x30, 0x2C, 0x00, 0x10, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0x08, 
-    0x28, 0x6C, 0x00, 0x04, 0x20, 0x0C, 0x66, 0xA4, 0x4C, 0xDF, 0x18, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x0C, 0x80, 0x37, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x53, 0x65, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 
-    0x49, 0x4C, 0x45, 0x50, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 
-    0x6C, 0x65, 0x50, 0x37, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x00, 0x16, 0x6E, 0x75, 
-    0x6D, 0x41, 0x72, 0x67, 0x73, 0x00, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x00, 0x00, 0x6E, 0x61, 
-    0x6D, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x28, 0x2D, 0xD7, 0x4E, 
-    0x48, 0x7A, 0x01, 0xAC, 0x2F, 0x2D, 0xD7, 0x2E, 0x4E, 0xAD, 0x02, 0x72, 0x50, 0x4F, 0x24, 0x40, 
-    0x20, 0x0A, 0x66, 0x0E, 0x2F, 0x2D, 0xD7, 0x2E, 0x48, 0x7A, 0x01, 0x96, 0x4E, 0xBA, 0xF5, 0x60, 
-    0x50, 0x4F, 0x2F, 0x0A, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x12, 0x50, 0x4F, 0x2F, 0x0A, 
-    0x70, 0x06, 0x2F, 0x00, 0x4E, 0xBA, 0xFA, 0x96, 0x2F, 0x0A, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xFA, 0xE6, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0xE4, 0x4E, 0xBA, 0xFB, 0x8A, 0x2F, 0x0A, 0x48, 0x7A, 
-    0x01, 0xD4, 0x4E, 0xBA, 0xFB, 0x80, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0xC2, 0x4E, 0xBA, 0xFB, 0x76, 
-    0x2F, 0x0A, 0x48, 0x7A, 0x01, 0xB0, 0x4E, 0xBA, 0xFB, 0x6C, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0xA0, 
-    0x4E, 0xBA, 0xFB, 0x62, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x8A, 0x4E, 0xBA, 0xFB, 0x58, 0x2F, 0x0A, 
-    0x48, 0x7A, 0x01, 0x76, 0x4E, 0xBA, 0xFB, 0x4E, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x60, 0x4E, 0xBA, 
-    0xFB, 0x44, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x48, 0x4E, 0xBA, 0xFB, 0x3A, 0x2F, 0x0A, 0x20, 0x6E, 
-    0x00, 0x08, 0x2F, 0x28, 0x00, 0x14, 0x4E, 0xBA, 0xFB, 0x2C, 0x2F, 0x0A, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xFA, 0xE4, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x1E, 0x4E, 0xBA, 0xFB, 0x18, 0x42, 0xA7, 
-    0x2F, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x2F, 0x2D, 0xD7, 0x36, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4A, 0x80, 0x67, 0x0E, 0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 0x01, 0x54, 0x4E, 0xBA, 
-    0xF4, 0x9E, 0x50, 0x4F, 0x20, 0x04, 0x50, 0x80, 0xA1, 0x1E, 0x26, 0x48, 0x20, 0x0B, 0x66, 0x0C, 
-    0x2F, 0x04, 0x48, 0x7A, 0x01, 0x68, 0x4E, 0xBA, 0xF4, 0x86, 0x50, 0x4F, 0x2F, 0x2D, 0xD7, 0x36, 
-    0x76, 0x01, 0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 
-    0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2D, 0xD7, 0x32, 0x2F, 0x04, 0x48, 0x7A, 0x01, 0x70, 0x4E, 0xBA, 
-    0xF4, 0x5E, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x98, 0x2F, 0x0B, 0x2F, 0x04, 
-    0x4E, 0xBA, 0xFC, 0x76, 0x2F, 0x0A, 0x4E, 0xBA, 0xFC, 0xFE, 0x2F, 0x0A, 0x2F, 0x2D, 0xD7, 0x32, 
-    0x4E, 0xBA, 0xFA, 0x92, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xFD, 0xB6, 0x2F, 0x0A, 0x4E, 0xAD, 0x02, 0x62, 0x58, 0x4F, 0x2F, 0x3C, 0x6E, 0x74, 0x6B, 0x63, 
-    0x2F, 0x3C, 0x4E, 0x54, 0x50, 0x31, 0x2F, 0x2D, 0xD7, 0x2E, 0x4E, 0xAD, 0x02, 0x7A, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x80, 0x2E, 0x65, 0x6D, 
-    0x69, 0x74, 0x5F, 0x4E, 0x43, 0x4D, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x69, 0x6C, 
-    0x65, 0x5F, 0x5F, 0x46, 0x50, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 
-    0x62, 0x6C, 0x65, 0x50, 0x37, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x01, 0x1A, 0x77, 0x00, 
-    0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 
-    0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x66, 0x6F, 0x72, 0x20, 
-    0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x41, 0x52, 0x4D, 0x36, 0x31, 0x30, 0x00, 0x00, 0x4E, 0x61, 
-    0x74, 0x69, 0x76, 0x65, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x00, 0x00, 0x65, 0x6E, 0x74, 0x72, 
-    0x79, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x73, 0x00, 0x64, 0x65, 0x62, 0x75, 0x67, 0x66, 0x69, 0x6C, 
-    0x65, 0x00, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x63, 0x6F, 
-    0x64, 0x65, 0x00, 0x00, 0x43, 0x50, 0x55, 0x54, 0x79, 0x70, 0x65, 0x00, 0x76, 0x65, 0x72, 0x73, 
-    0x69, 0x6F, 0x6E, 0x00, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x00, 
-    0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x72, 
-    0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x20, 0x63, 0x61, 0x6E, 
-    0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 
-    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x4F, 
-    0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x00, 0x20, 0x63, 0x61, 0x6E, 
-    0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x6F, 0x66, 0x20, 0x52, 0x4F, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x64, 0x61, 
-    0x74, 0x61, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x63, 0x6F, 0x64, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE0, 0x48, 0xE7, 0x1C, 0x38, 
-    0x24, 0x6E, 0x00, 0x0C, 0x4A, 0x2A, 0x00, 0x05, 0x66, 0x06, 0x4A, 0xAA, 0x00, 0x18, 0x67, 0x1A, 
-    0x2F, 0x2A, 0x00, 0x18, 0x12, 0x2A, 0x00, 0x05, 0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x48, 0x7A, 
-    0x03, 0x72, 0x4E, 0xBA, 0xF2, 0x8A, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x28, 
-    0x00, 0x1C, 0x70, 0xDC, 0x2D, 0x43, 0xFF, 0xEC, 0xD6, 0x80, 0x20, 0x6E, 0x00, 0x08, 0x28, 0x10, 
-    0xB6, 0x84, 0x67, 0x14, 0x2F, 0x04, 0x20, 0x2E, 0xFF, 0xEC, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x80, 
-    0x4E, 0xBA, 0xF2, 0x5C, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x14, 
-    0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x10, 0x2F, 0x2A, 0x00, 0x08, 0x48, 0x7A, 0x03, 0x9E, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x14, 0x2A, 0x2A, 0x00, 0x20, 0xE7, 0x8D, 0x20, 0x6E, 
-    0x00, 0x08, 0x26, 0x10, 0xB6, 0x85, 0x64, 0x14, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x03, 0x2F, 0x05, 
-    0x48, 0x7A, 0x03, 0xFE, 0x4E, 0xBA, 0xF2, 0x18, 0x4F, 0xEF, 0x00, 0x10, 0x24, 0x6E, 0x00, 0x0C, 
-    0x70, 0x20, 0xD5, 0xC0, 0x10, 0x2D, 0xD7, 0x1C, 0x67, 0x00, 0x02, 0x4E, 0x59, 0x4F, 0x2F, 0x05, 
-    0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 0x2B, 0x40, 0xD7, 0xBC, 
-    0x2F, 0x05, 0x48, 0x7A, 0x04, 0x2A, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF2, 0x7A, 0x4F, 0xEF, 
-    0x00, 0x0A, 0x2F, 0x2D, 0xD7, 0xBC, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 
-    0x48, 0x7A, 0x03, 0xF0, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF2, 0x5C, 0x5C, 0x4F, 0x20, 0x6D, 
-    0xD7, 0xBC, 0x26, 0x50, 0x26, 0x12, 0x2D, 0x43, 0xFF, 0xFC, 0xE7, 0x8B, 0xD6, 0x8B, 0x2D, 0x43, 
-    0xFF, 0xE4, 0x2F, 0x2E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 0x2F, 0x00, 0x70, 0x08, 0x2F, 0x00, 
-    0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0x22, 0x12, 0xB0, 0x81, 0x67, 0x12, 
-    0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x05, 0x48, 0x7A, 0x03, 0xF4, 0x4E, 0xBA, 0xF1, 0x82, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x9B, 0x90, 0x2F, 0x2E, 0x00, 0x10, 0x76, 0x01, 0x2F, 0x03, 
-    0x78, 0x04, 0x2F, 0x04, 0x48, 0x6E, 0xFF, 0xE8, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 
-    0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x04, 0x48, 0x7A, 0x03, 0xF6, 0x4E, 0xBA, 
-    0xF1, 0x4E, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x10, 0x26, 0x2E, 0xFF, 0xE8, 
-    0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x03, 0x48, 0x7A, 0x04, 0x12, 0x4E, 0xBA, 
-    0xF1, 0x2E, 0x4F, 0xEF, 0x00, 0x0C, 0x59, 0x4F, 0x2F, 0x2E, 0xFF, 0xE8, 0x48, 0x6E, 0xFF, 0xE0, 
-    0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 0x2B, 0x40, 0xD7, 0xC0, 0x2F, 0x2E, 0xFF, 0xE8, 
-    0x48, 0x7A, 0x04, 0x3A, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF1, 0x9C, 0x4F, 0xEF, 0x00, 0x0A, 
-    0x2F, 0x2D, 0xD7, 0xC0, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x7A, 
-    0x04, 0x00, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF1, 0x7E, 0x5C, 0x4F, 0x20, 0x6D, 0xD7, 0xC0, 
-    0x28, 0x50, 0x2F, 0x2E, 0x00, 0x10, 0x76, 0x01, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xE8, 0x59, 0x80, 
-    0x2F, 0x00, 0x20, 0x4C, 0x58, 0x48, 0x2F, 0x08, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 
-    0xB0, 0x83, 0x67, 0x14, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x2E, 0xFF, 0xE8, 0x48, 0x7A, 0x04, 0x0C, 
-    0x4E, 0xBA, 0xF0, 0xAC, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x2E, 0xFF, 0xE8, 0x20, 0x6E, 0x00, 0x0C, 
-    0x26, 0x28, 0x00, 0x20, 0x70, 0x01, 0xB6, 0x80, 0x66, 0x06, 0x41, 0xFA, 0x04, 0x54, 0x60, 0x04, 
-    0x41, 0xFA, 0x04, 0x4C, 0x2F, 0x08, 0x2F, 0x03, 0x48, 0x7A, 0x04, 0x16, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x2E, 0xFF, 0xE8, 0x91, 0x90, 0x60, 0x54, 
-    0x70, 0x01, 0x3F, 0x00, 0x4E, 0xBA, 0x55, 0xAC, 0x26, 0x13, 0x20, 0x03, 0x02, 0x80, 0x06, 0x00, 
-    0x00, 0x00, 0x72, 0x19, 0xE2, 0xA8, 0xE5, 0x88, 0x41, 0xED, 0xEF, 0x5E, 0x2F, 0x30, 0x00, 0x00, 
-    0x20, 0x03, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x67, 0x06, 0x41, 0xFA, 0x04, 0x22, 0x60, 0x04, 
-    0x41, 0xFA, 0x04, 0x16, 0x2F, 0x08, 0x2F, 0x2B, 0x00, 0x04, 0x20, 0x03, 0x02, 0x80, 0x00, 0xFF, 
-    0xFF, 0xFF, 0xD0, 0x8C, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0xEA, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 
-    0x00, 0x14, 0x50, 0x4B, 0xB7, 0xEE, 0xFF, 0xE4, 0x65, 0xA6, 0x2F, 0x2D, 0xD7, 0xC0, 0x48, 0x6E, 
-    0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x76, 0x00, 0x2B, 0x43, 0xD7, 0xC0, 0x48, 0x7A, 
-    0x04, 0x06, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF0, 0x4E, 0x5C, 0x4F, 0x2F, 0x2D, 0xD7, 0xBC, 
-    0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x2B, 0x43, 0xD7, 0xBC, 0x48, 0x7A, 
-    0x03, 0xC6, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xF0, 0x2E, 0x5C, 0x4F, 0x20, 0x6E, 0x00, 0x08, 
-    0x26, 0x10, 0x67, 0x68, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x03, 0x48, 0x7A, 0x03, 0xEA, 0x4E, 0xBA, 
-    0xEF, 0xBE, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x54, 0x24, 0x6E, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x20, 
-    0x48, 0x7A, 0x04, 0x18, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x70, 0x01, 0x2F, 0x00, 0x20, 0x2A, 
-    0x00, 0x1C, 0x76, 0xDC, 0xD0, 0x83, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x4E, 0xAD, 0x02, 0x82, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x67, 0x12, 0x20, 0x2A, 0x00, 0x1C, 0xD0, 0x83, 0x2F, 0x00, 
-    0x48, 0x7A, 0x04, 0x00, 0x4E, 0xBA, 0xEF, 0x78, 0x50, 0x4F, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x6E, 
-    0x00, 0x0C, 0x20, 0x29, 0x00, 0x1C, 0x72, 0xDC, 0xD0, 0x81, 0x91, 0x90, 0x4C, 0xDF, 0x1C, 0x38, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x10, 0x80, 0x37, 0x64, 0x75, 0x6D, 0x70, 0x5F, 0x6C, 0x6F, 0x77, 
-    0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5F, 0x69, 0x6E, 0x66, 
-    0x6F, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x52, 0x43, 0x31, 
-    0x31, 0x49, 0x74, 0x65, 0x6D, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x50, 0x55, 0x6C, 0x00, 
-    0x03, 0xD2, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x77, 
-    0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x30, 
-    0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 
-    0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x00, 0x75, 0x6E, 
-    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 
-    0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x20, 
-    0x21, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x00, 0x6C, 0x6F, 0x77, 0x2D, 
-    0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 
-    0x3A, 0x20, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x74, 0x61, 
-    0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 
-    0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 
-    0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 
-    0x74, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 
-    0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 
-    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x0D, 0x00, 0x00, 
-    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 
-    0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 
-    0x20, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 
-    0x6C, 0x64, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 
-    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 
-    0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x66, 
-    0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x75, 0x6E, 
-    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 
-    0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
-    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 
-    0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 
-    0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 
-    0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 
-    0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 
-    0x25, 0x6C, 0x75, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x25, 0x73, 0x2C, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x0D, 0x00, 0x73, 0x00, 
-    0x00, 0x00, 0x25, 0x73, 0x20, 0x2A, 0x20, 0x26, 0x25, 0x30, 0x38, 0x78, 0x09, 0x3B, 0x20, 0x25, 
-    0x73, 0x2C, 0x20, 0x25, 0x73, 0x0D, 0x00, 0x00, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x00, 0x67, 0x6C, 
-    0x6F, 0x62, 0x61, 0x6C, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 
-    0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 
-    0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x25, 0x6C, 0x64, 0x20, 0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 
-    0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 
-    0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 
-    0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x00, 0x00, 0x25, 0x6C, 0x75, 0x20, 0x6C, 0x6F, 
-    0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x0D, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x70, 0x61, 0x73, 
-    0x74, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6C, 
-    0x6F, 0x77, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 
-    0x6E, 0x66, 0x6F, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x7A, 0x01, 0x08, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x58, 0x4F, 0x20, 0x2E, 0x00, 0x08, 0x67, 0x42, 0x72, 0x01, 0xB0, 0x81, 0x67, 0x4A, 0x72, 0x02, 
-    0xB0, 0x81, 0x67, 0x50, 0x72, 0x03, 0xB0, 0x81, 0x67, 0x56, 0x72, 0x04, 0xB0, 0x81, 0x67, 0x5C, 
-    0x72, 0x05, 0xB0, 0x81, 0x67, 0x62, 0x72, 0x06, 0xB0, 0x81, 0x67, 0x68, 0x72, 0x07, 0xB0, 0x81, 
-    0x67, 0x6E, 0x72, 0x08, 0xB0, 0x81, 0x67, 0x74, 0x72, 0x09, 0xB0, 0x81, 0x67, 0x7A, 0x72, 0x0A, 
-    0xB0, 0x81, 0x67, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x88, 0x48, 0x7A, 0x00, 0xCA, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x84, 0x48, 0x7A, 0x00, 0xC2, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x58, 0x4F, 0x60, 0x76, 0x48, 0x7A, 0x00, 0xC0, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x6A, 
-    0x48, 0x7A, 0x00, 0xBC, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x5E, 0x48, 0x7A, 0x00, 0xBC, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x52, 0x48, 0x7A, 0x00, 0xBA, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x58, 0x4F, 0x60, 0x46, 0x48, 0x7A, 0x00, 0xBE, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x3A, 
-    0x48, 0x7A, 0x00, 0xC4, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x2E, 0x48, 0x7A, 0x00, 0xD0, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x22, 0x48, 0x7A, 0x00, 0xCC, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x58, 0x4F, 0x60, 0x16, 0x48, 0x7A, 0x00, 0xCA, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x0A, 
-    0x48, 0x7A, 0x00, 0xCA, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x48, 0x7A, 0x00, 0xCA, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x97, 0x64, 0x75, 0x6D, 0x70, 0x5F, 0x73, 0x74, 
-    0x6F, 0x72, 0x61, 0x67, 0x65, 0x5F, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x5F, 0x46, 0x55, 0x6C, 
-    0x00, 0xA8, 0x20, 0x20, 0x20, 0x53, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x43, 0x6C, 0x61, 
-    0x73, 0x73, 0x20, 0x69, 0x73, 0x00, 0x20, 0x4E, 0x4F, 0x4E, 0x45, 0x00, 0x20, 0x45, 0x78, 0x74, 
-    0x65, 0x72, 0x6E, 0x61, 0x6C, 0x00, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x00, 0x20, 0x41, 
-    0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x00, 0x00, 0x20, 0x52, 0x65, 0x67, 0x69, 0x73, 
-    0x74, 0x65, 0x72, 0x00, 0x20, 0x27, 0x56, 0x61, 0x72, 0x27, 0x20, 0x41, 0x72, 0x67, 0x75, 0x6D, 
-    0x65, 0x6E, 0x74, 0x00, 0x20, 0x46, 0x4F, 0x52, 0x54, 0x52, 0x41, 0x4E, 0x20, 0x41, 0x72, 0x67, 
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x20, 0x46, 0x4F, 0x52, 0x54, 0x52, 0x41, 0x4E, 0x20, 0x43, 
-    0x68, 0x61, 0x72, 0x20, 0x41, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x00, 0x20, 0x4C, 
-    0x4F, 0x43, 0x41, 0x4C, 0x00, 0x00, 0x20, 0x46, 0x49, 0x4C, 0x54, 0x45, 0x52, 0x45, 0x44, 0x00, 
-    0x20, 0x47, 0x4C, 0x4F, 0x42, 0x41, 0x4C, 0x52, 0x45, 0x47, 0x00, 0x00, 0x20, 0x55, 0x4E, 0x4B, 
-    0x4E, 0x4F, 0x57, 0x4E, 0x00, 0x00, 0x20, 0x2C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xBC, 0x48, 0xE7, 
-    0x10, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x0B, 0x90, 0xAD, 0xD7, 0xCC, 0x2F, 0x00, 0x48, 0x7A, 
-    0x04, 0x48, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xBC, 0x02, 0x83, 
-    0x00, 0x00, 0xFF, 0xFF, 0x4A, 0x83, 0x67, 0x74, 0x70, 0x02, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x96, 
-    0x70, 0x03, 0xB6, 0x80, 0x67, 0x00, 0x01, 0x0E, 0x70, 0x04, 0xB6, 0x80, 0x67, 0x00, 0x01, 0x34, 
-    0x70, 0x05, 0xB6, 0x80, 0x67, 0x00, 0x01, 0xB2, 0x70, 0x06, 0xB6, 0x80, 0x67, 0x00, 0x01, 0xFC, 
-    0x70, 0x07, 0xB6, 0x80, 0x67, 0x00, 0x02, 0x42, 0x70, 0x08, 0xB6, 0x80, 0x67, 0x00, 0x02, 0x84, 
-    0x70, 0x09, 0xB6, 0x80, 0x67, 0x00, 0x02, 0xA4, 0x70, 0x0B, 0xB6, 0x80, 0x67, 0x00, 0x02, 0xC4, 
-    0x70, 0x0C, 0xB6, 0x80, 0x67, 0x00, 0x02, 0xE4, 0x70, 0x0D, 0xB6, 0x80, 0x67, 0x00, 0x03, 0x04, 
-    0x70, 0x0E, 0xB6, 0x80, 0x67, 0x00, 0x03, 0x24, 0x70, 0x0F, 0xB6, 0x80, 0x67, 0x00, 0x03, 0x42, 
-    0x70, 0x0A, 0xB6, 0x80, 0x67, 0x00, 0x03, 0x60, 0x60, 0x00, 0x03, 0x76, 0x26, 0x13, 0x2D, 0x43, 
-    0xFF, 0xF8, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xF8, 0x02, 0x80, 0x00, 0x00, 
-    0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0xAA, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x03, 0x72, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xF4, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 
-    0x20, 0x2E, 0xFF, 0xF4, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0xFC, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x14, 0x2F, 0x2B, 0x00, 0x10, 
-    0x48, 0x7A, 0x03, 0xBE, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2B, 0x00, 0x08, 
-    0x2B, 0x40, 0xEF, 0x6E, 0x72, 0x01, 0x2B, 0x41, 0xEF, 0x72, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x90, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x20, 0x4B, 0x70, 0x21, 0xD1, 0xC0, 0x2F, 0x08, 0x48, 0x7A, 
-    0x03, 0x6E, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x48, 0x7A, 0x03, 0x58, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x58, 0x4F, 0x2F, 0x2B, 0x00, 0x04, 0x4E, 0xBA, 0x06, 0x4A, 0x4A, 0x00, 0x67, 0x00, 0x02, 0xF6, 
-    0x60, 0x00, 0x01, 0x92, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xF0, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 
-    0x20, 0x2E, 0xFF, 0xF0, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x9E, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x2B, 0x40, 0xEF, 0x6E, 0x60, 0x00, 
-    0x02, 0xC4, 0x0C, 0xAD, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x6E, 0x6F, 0x22, 0x20, 0x13, 0x72, 0x10, 
-    0xE2, 0xA8, 0x2F, 0x00, 0x2F, 0x2D, 0xEF, 0x72, 0x48, 0x7A, 0x03, 0x94, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x53, 0xAD, 0xEF, 0x6E, 0x52, 0xAD, 0xEF, 0x72, 0x60, 0x24, 0x26, 0x13, 
-    0x2D, 0x43, 0xFF, 0xEC, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xEC, 0x02, 0x80, 
-    0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x84, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x24, 0x4B, 0x70, 0x15, 0xD5, 0xC0, 0x2F, 0x0A, 0x48, 0x7A, 0x03, 0x9E, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x50, 0x4F, 0x2F, 0x2B, 0x00, 0x0C, 0x4E, 0xBA, 0xFC, 0x6A, 0x48, 0x7A, 0x03, 0x7E, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x2F, 0x2B, 0x00, 0x04, 0x4E, 0xBA, 0x05, 0x96, 0x4A, 0x00, 
-    0x67, 0x00, 0x02, 0x42, 0x60, 0x00, 0x00, 0xDE, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xE8, 0x70, 0x10, 
-    0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xE8, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 
-    0x48, 0x7A, 0x03, 0x86, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x4B, 0x70, 0x09, 
-    0xD1, 0xC0, 0x2F, 0x08, 0x48, 0x7A, 0x03, 0x62, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x48, 0x7A, 
-    0x03, 0x4A, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x2F, 0x2B, 0x00, 0x04, 0x4E, 0xBA, 0x05, 0x44, 
-    0x4A, 0x00, 0x67, 0x00, 0x01, 0xF0, 0x60, 0x00, 0x00, 0x8C, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xE0, 
-    0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xE0, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
-    0x2F, 0x00, 0x48, 0x7A, 0x03, 0x56, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x2B, 
-    0x00, 0x04, 0x67, 0x16, 0x2F, 0x2B, 0x00, 0x08, 0x2F, 0x03, 0x48, 0x7A, 0x03, 0x5C, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0xAC, 0x48, 0x7A, 0x03, 0x7C, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 0x01, 0x9E, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xDC, 0x70, 0x10, 
-    0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xDC, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 
-    0x48, 0x7A, 0x03, 0x7A, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x7A, 0x03, 0x5E, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x2F, 0x2B, 0x00, 0x0C, 0x4E, 0xBA, 0x04, 0xB6, 0x4A, 0x00, 
-    0x67, 0x00, 0x01, 0x62, 0x48, 0x7A, 0x03, 0x74, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 
-    0x01, 0x54, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xD8, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 
-    0xFF, 0xD8, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x50, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x2C, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xD4, 
-    0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xD4, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
-    0x2F, 0x00, 0x48, 0x7A, 0x03, 0x4A, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x01, 0x04, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xD0, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 
-    0xFF, 0xD0, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x3E, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xDC, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xCC, 
-    0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xCC, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
-    0x2F, 0x00, 0x48, 0x7A, 0x03, 0x3A, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x00, 0xB4, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xC8, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 
-    0xFF, 0xC8, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x34, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x8C, 0x26, 0x13, 0x2D, 0x43, 0xFF, 0xC4, 
-    0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xC4, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
-    0x2F, 0x00, 0x48, 0x7A, 0x03, 0x2E, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x64, 
-    0x26, 0x13, 0x2D, 0x43, 0xFF, 0xC0, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xC0, 
-    0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x2C, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x3E, 0x20, 0x2E, 0xFF, 0xBC, 0x72, 0x10, 0xE2, 0xA8, 0x2F, 0x00, 
-    0x2F, 0x03, 0x48, 0x7A, 0x03, 0x34, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x24, 
-    0x26, 0x13, 0x2D, 0x43, 0xFF, 0xFC, 0x70, 0x10, 0xE0, 0xAB, 0x2F, 0x03, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x32, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x96, 0x64, 
-    0x75, 0x6D, 0x70, 0x5F, 0x53, 0x79, 0x6D, 0x5F, 0x49, 0x74, 0x65, 0x6D, 0x5F, 0x5F, 0x46, 0x50, 
-    0x34, 0x49, 0x74, 0x65, 0x6D, 0x00, 0x03, 0x2A, 0x20, 0x25, 0x30, 0x36, 0x6C, 0x64, 0x3A, 0x00, 
-    0x20, 0x42, 0x41, 0x44, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 
-    0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 
-    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3A, 0x00, 0x20, 0x20, 
-    0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x0D, 0x00, 0x20, 0x20, 
-    0x20, 0x61, 0x72, 0x67, 0x63, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x2C, 0x00, 
-    0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 
-    0x25, 0x30, 0x38, 0x58, 0x2C, 0x20, 0x42, 0x6F, 0x64, 0x79, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x20, 0x3D, 0x20, 0x25, 0x30, 0x38, 0x58, 0x2C, 0x00, 0x00, 0x20, 0x42, 0x65, 0x67, 0x69, 0x6E, 
-    0x20, 0x50, 0x52, 0x4F, 0x43, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 
-    0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x00, 0x20, 0x45, 0x6E, 0x64, 
-    0x20, 0x50, 0x52, 0x4F, 0x43, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 
-    0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x00, 0x20, 0x50, 
-    0x72, 0x6F, 0x63, 0x20, 0x41, 0x72, 0x67, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 
-    0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x00, 0x20, 0x56, 0x41, 0x52, 
-    0x49, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 
-    0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x00, 0x20, 0x20, 0x20, 0x56, 
-    0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x00, 0x00, 0x20, 0x20, 0x20, 0x6E, 0x61, 0x6D, 
-    0x65, 0x64, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x0D, 0x00, 0x20, 0x20, 0x20, 0x20, 0x54, 0x79, 
-    0x70, 0x65, 0x44, 0x65, 0x66, 0x3A, 0x00, 0x00, 0x20, 0x20, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 
-    0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x0D, 0x00, 0x20, 0x54, 0x59, 0x50, 0x45, 0x20, 0x69, 0x74, 
-    0x65, 0x6D, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 
-    0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x00, 0x00, 0x20, 0x53, 0x54, 0x52, 0x55, 0x43, 
-    0x54, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 
-    0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x00, 0x20, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
-    0x25, 0x6C, 0x64, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x75, 
-    0x63, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x73, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 
-    0x79, 0x74, 0x65, 0x73, 0x20, 0x0D, 0x00, 0x00, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 
-    0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x0D, 0x00, 0x20, 0x20, 0x20, 0x20, 
-    0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x20, 0x41, 0x52, 0x52, 
-    0x41, 0x59, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 
-    0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x0D, 0x00, 0x20, 0x53, 0x55, 0x42, 
-    0x52, 0x41, 0x4E, 0x47, 0x45, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 
-    0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x00, 0x20, 0x53, 
-    0x45, 0x54, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 
-    0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x20, 0x45, 0x4E, 0x55, 0x4D, 0x20, 
-    0x43, 0x4F, 0x4E, 0x54, 0x49, 0x47, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 
-    0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x20, 0x45, 
-    0x4E, 0x55, 0x4D, 0x20, 0x44, 0x49, 0x53, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 
-    0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x00, 
-    0x20, 0x46, 0x75, 0x6E, 0x63, 0x20, 0x44, 0x45, 0x43, 0x4C, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 
-    0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 
-    0x0D, 0x00, 0x20, 0x42, 0x65, 0x67, 0x69, 0x6E, 0x20, 0x53, 0x43, 0x4F, 0x50, 0x45, 0x20, 0x3D, 
-    0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 
-    0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x20, 0x45, 0x6E, 0x64, 0x20, 0x53, 0x43, 0x4F, 0x50, 0x45, 
-    0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 
-    0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x4E, 0x41, 
-    0x4D, 0x45, 0x53, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 
-    0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 0x00, 0x00, 0x20, 0x55, 0x4E, 0x4B, 
-    0x4E, 0x4F, 0x57, 0x4E, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 
-    0x20, 0x69, 0x74, 0x65, 0x6D, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x0D, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x48, 0x7A, 0x01, 0xC4, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x20, 0x2E, 0x00, 0x08, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x72, 0x02, 
-    0xB0, 0x81, 0x67, 0x0C, 0x72, 0x01, 0xB0, 0x81, 0x67, 0x10, 0x4A, 0x80, 0x67, 0x22, 0x60, 0x16, 
-    0x48, 0x7A, 0x01, 0xAE, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x48, 0x7A, 0x01, 0xAE, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x0A, 0x48, 0x7A, 0x01, 0xAC, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 
-    0x26, 0x2E, 0x00, 0x08, 0xE0, 0x83, 0x4A, 0x83, 0x6A, 0x30, 0x44, 0x83, 0x20, 0x2D, 0xD7, 0xD8, 
-    0x96, 0x80, 0x2F, 0x03, 0x48, 0x7A, 0x01, 0xB8, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x48, 0x7A, 
-    0x01, 0xA0, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x24, 0x6D, 0xD7, 0xCC, 0xD5, 0xC3, 0x2F, 0x0A, 
-    0x4E, 0xBA, 0xF7, 0xF8, 0x42, 0x00, 0x4E, 0xFA, 0x01, 0x2A, 0x4A, 0x83, 0x67, 0x68, 0x70, 0x0A, 
-    0xB6, 0x80, 0x67, 0x70, 0x70, 0x0B, 0xB6, 0x80, 0x67, 0x78, 0x70, 0x0C, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0x80, 0x70, 0x14, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x86, 0x70, 0x15, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0x8A, 0x70, 0x16, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x8E, 0x70, 0x1E, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0x92, 0x70, 0x1F, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x96, 0x70, 0x20, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0x9A, 0x70, 0x28, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x9E, 0x70, 0x29, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0xA2, 0x70, 0x32, 0xB6, 0x80, 0x67, 0x00, 0x00, 0xA6, 0x70, 0x64, 0xB6, 0x80, 0x67, 0x00, 
-    0x00, 0xAA, 0x60, 0x00, 0x00, 0xB2, 0x48, 0x7A, 0x01, 0x3E, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 
-    0x60, 0x00, 0x00, 0xAE, 0x48, 0x7A, 0x01, 0x36, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 
-    0x00, 0xA0, 0x48, 0x7A, 0x01, 0x36, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x92, 
-    0x48, 0x7A, 0x01, 0x36, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x84, 0x48, 0x7A, 
-    0x01, 0x36, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x76, 0x48, 0x7A, 0x01, 0x3A, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x6A, 0x48, 0x7A, 0x01, 0x40, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 
-    0x60, 0x5E, 0x48, 0x7A, 0x01, 0x44, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x52, 0x48, 0x7A, 
-    0x01, 0x40, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x46, 0x48, 0x7A, 0x01, 0x3C, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x3A, 0x48, 0x7A, 0x01, 0x3E, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 
-    0x60, 0x2E, 0x48, 0x7A, 0x01, 0x3C, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x22, 0x48, 0x7A, 
-    0x01, 0x40, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 0x60, 0x16, 0x48, 0x7A, 0x01, 0x3C, 0x4E, 0xAD, 
-    0x02, 0x2A, 0x58, 0x4F, 0x60, 0x0A, 0x48, 0x7A, 0x01, 0x3A, 0x4E, 0xAD, 0x02, 0x2A, 0x58, 0x4F, 
-    0x70, 0x01, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x91, 0x64, 0x75, 0x6D, 
-    0x70, 0x5F, 0x61, 0x73, 0x64, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x5F, 0x46, 0x6C, 0x01, 0x2A, 
-    0x20, 0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x00, 0x00, 
-    0x20, 0x50, 0x74, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x00, 0x20, 0x50, 0x74, 0x72, 0x20, 0x74, 
-    0x6F, 0x20, 0x61, 0x00, 0x69, 0x73, 0x20, 0x3E, 0x20, 0x32, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 
-    0x73, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x74, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x00, 0x00, 
-    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x0D, 0x20, 0x20, 0x00, 0x6E, 0x20, 
-    0x49, 0x74, 0x65, 0x6D, 0x20, 0x61, 0x74, 0x20, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x00, 0x20, 0x56, 0x4F, 0x49, 0x44, 0x00, 0x20, 0x53, 0x69, 0x67, 
-    0x6E, 0x65, 0x64, 0x20, 0x42, 0x79, 0x74, 0x65, 0x00, 0x00, 0x20, 0x53, 0x69, 0x67, 0x6E, 0x65, 
-    0x64, 0x20, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x00, 0x20, 0x53, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 
-    0x4C, 0x6F, 0x6E, 0x67, 0x00, 0x00, 0x6E, 0x20, 0x55, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 
-    0x20, 0x42, 0x79, 0x74, 0x65, 0x00, 0x6E, 0x20, 0x55, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 
-    0x20, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x6E, 0x20, 0x55, 0x6E, 0x73, 0x69, 0x67, 0x6E, 
-    0x65, 0x64, 0x20, 0x4C, 0x6F, 0x6E, 0x67, 0x00, 0x20, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x00, 0x00, 
-    0x20, 0x44, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x00, 0x20, 0x4C, 0x6F, 0x6E, 0x67, 0x20, 0x44, 0x6F, 
-    0x75, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x78, 0x00, 0x00, 
-    0x20, 0x44, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x78, 0x00, 
-    0x20, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x00, 0x6E, 0x20, 0x55, 0x4E, 0x44, 0x45, 0x46, 0x49, 0x4E, 0x45, 0x44, 0x20, 0x54, 0x59, 
-    0x50, 0x45, 0x20, 0x43, 0x4F, 0x44, 0x45, 0x3F, 0x21, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x18, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x10, 0x20, 0x12, 0x72, 0x10, 0xE2, 0xA8, 
-    0x2B, 0x40, 0xD7, 0xD8, 0x4A, 0x2A, 0x00, 0x05, 0x67, 0x06, 0x4A, 0xAA, 0x00, 0x18, 0x66, 0x1A, 
-    0x2F, 0x2A, 0x00, 0x18, 0x12, 0x2A, 0x00, 0x05, 0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x48, 0x7A, 
-    0x01, 0x98, 0x4E, 0xBA, 0xDE, 0xDA, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x10, 0x26, 0x28, 
-    0x00, 0x1C, 0x70, 0xDC, 0x2D, 0x43, 0xFF, 0xFC, 0xD6, 0x80, 0x28, 0x13, 0xB6, 0x84, 0x63, 0x14, 
-    0x2F, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x2F, 0x00, 0x48, 0x7A, 0x01, 0xAA, 0x4E, 0xBA, 0xDE, 0xB0, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x2F, 0x2A, 0x00, 0x14, 0x2F, 0x2A, 0x00, 0x0C, 
-    0x2F, 0x2A, 0x00, 0x10, 0x2F, 0x2A, 0x00, 0x08, 0x48, 0x7A, 0x02, 0x0E, 0x4E, 0xAD, 0x02, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x14, 0x28, 0x2A, 0x00, 0x1C, 0x98, 0xAD, 0xD7, 0xD8, 0x59, 0x4F, 0x2F, 0x04, 
-    0x48, 0x6E, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 0x2B, 0x40, 0xD7, 0xC8, 
-    0x2F, 0x04, 0x48, 0x7A, 0x01, 0xBA, 0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xDE, 0xFA, 0x4F, 0xEF, 
-    0x00, 0x0A, 0x2F, 0x2D, 0xD7, 0xC8, 0x48, 0x6E, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 
-    0x48, 0x7A, 0x01, 0x7E, 0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xDE, 0xDC, 0x5C, 0x4F, 0x20, 0x6D, 
-    0xD7, 0xC8, 0x20, 0x10, 0x2B, 0x40, 0xD7, 0xCC, 0x20, 0x40, 0x91, 0xED, 0xD7, 0xD8, 0x2B, 0x48, 
-    0xD7, 0xD0, 0x20, 0x40, 0xD1, 0xC4, 0x2B, 0x48, 0xD7, 0xD4, 0x2F, 0x2E, 0x00, 0x14, 0x76, 0x01, 
-    0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 
-    0x67, 0x12, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x04, 0x48, 0x7A, 0x02, 0x02, 0x4E, 0xBA, 0xDE, 0x00, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x99, 0x93, 0x20, 0x13, 0x2F, 0x2D, 0xD7, 0xD8, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x00, 0x2F, 0x04, 0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x1C, 0x48, 0x7A, 0x02, 0x14, 
-    0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x18, 0x24, 0x6D, 0xD7, 0xCC, 0x60, 0x16, 0x70, 0x01, 
-    0x3F, 0x00, 0x4E, 0xBA, 0x43, 0x0E, 0x2F, 0x0A, 0x4E, 0xBA, 0xF4, 0x30, 0x20, 0x12, 0x72, 0x10, 
-    0xE2, 0xA8, 0xD5, 0xC0, 0xB5, 0xED, 0xD7, 0xD4, 0x65, 0xE4, 0x2F, 0x2D, 0xD7, 0xC8, 0x48, 0x6E, 
-    0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xC8, 0x48, 0x7A, 
-    0x02, 0x66, 0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xDD, 0xEE, 0x5C, 0x4F, 0x42, 0x2D, 0xD7, 0x20, 
-    0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x14, 0x80, 0x39, 0x64, 0x75, 0x6D, 0x70, 
-    0x5F, 0x73, 0x72, 0x63, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x52, 0x43, 0x31, 0x31, 0x49, 0x74, 0x65, 0x6D, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x55, 0x6C, 0x50, 0x55, 0x6C, 0x00, 0x02, 0x34, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
-    0x65, 0x64, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x66, 0x6C, 0x61, 
-    0x67, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x6F, 0x72, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 
-    0x6C, 0x78, 0x00, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 
-    0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 
-    0x25, 0x30, 0x38, 0x6C, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 
-    0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
-    0x79, 0x6D, 0x64, 0x61, 0x74, 0x61, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
-    0x79, 0x6D, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x73, 0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 0x65, 
-    0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x20, 0x72, 
-    0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 
-    0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 
-    0x6E, 0x6C, 0x79, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 
-    0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 
-    0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 
-    0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
-    0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x0D, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 
-    0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
-    0x20, 0x6F, 0x66, 0x20, 0x73, 0x72, 0x63, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x64, 0x61, 
-    0x74, 0x61, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x73, 0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 
-    0x6F, 0x6C, 0x69, 0x63, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 
-    0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x64, 0x65, 0x62, 0x75, 0x67, 0x73, 0x69, 
-    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x44, 0x61, 0x74, 
-    0x61, 0x53, 0x69, 0x7A, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 
-    0x2C, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65, 0x62, 0x75, 
-    0x67, 0x53, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x73, 
-    0x79, 0x6D, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x41, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x3D, 
-    0x20, 0x25, 0x6C, 0x64, 0x0D, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 
-    0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x64, 0x61, 0x74, 0x61, 
-    0x20, 0x54, 0x65, 0x6D, 0x70, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x4E, 0x56, 0xFF, 0xE0, 
-    0x48, 0xE7, 0x1C, 0x38, 0x26, 0x6E, 0x00, 0x18, 0x24, 0x6E, 0x00, 0x14, 0x4A, 0x2A, 0x00, 0x05, 
-    0x66, 0x06, 0x4A, 0xAA, 0x00, 0x18, 0x67, 0x1A, 0x2F, 0x2A, 0x00, 0x18, 0x12, 0x2A, 0x00, 0x05, 
-    0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0xE4, 0x4E, 0xBA, 0xDA, 0xE2, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x14, 0x26, 0x28, 0x00, 0x1C, 0x70, 0xDC, 0x2D, 0x43, 0xFF, 0xF0, 
-    0xD6, 0x80, 0x20, 0x6E, 0x00, 0x0C, 0x28, 0x10, 0xB6, 0x84, 0x67, 0x14, 0x2F, 0x04, 0x20, 0x2E, 
-    0xFF, 0xF0, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0xF2, 0x4E, 0xBA, 0xDA, 0xB4, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x20, 0x6E, 0x00, 0x14, 0x2A, 0x28, 0x00, 0x20, 0xE7, 0x8D, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x10, 
-    0xB6, 0x85, 0x64, 0x14, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x03, 0x2F, 0x05, 0x48, 0x7A, 0x03, 0x08, 
-    0x4E, 0xBA, 0xDA, 0x8C, 0x4F, 0xEF, 0x00, 0x10, 0x59, 0x4F, 0x26, 0x05, 0x50, 0x83, 0x2F, 0x03, 
-    0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 0x2B, 0x40, 0xD7, 0xBC, 
-    0x2F, 0x05, 0x48, 0x7A, 0x03, 0x40, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xDA, 0xFA, 0x4F, 0xEF, 
-    0x00, 0x0A, 0x2F, 0x2D, 0xD7, 0xBC, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 
-    0x48, 0x7A, 0x03, 0x06, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 0xDA, 0xDC, 0x5C, 0x4F, 0x20, 0x6D, 
-    0xD7, 0xBC, 0x28, 0x50, 0x24, 0x6E, 0x00, 0x14, 0x26, 0x2A, 0x00, 0x20, 0x2D, 0x43, 0xFF, 0xFC, 
-    0xE7, 0x8B, 0xD6, 0x8C, 0x2D, 0x43, 0xFF, 0xE4, 0x2F, 0x0B, 0x20, 0x2E, 0xFF, 0xFC, 0x2F, 0x00, 
-    0x70, 0x08, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0x22, 0x2A, 
-    0x00, 0x20, 0xB0, 0x81, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x05, 0x48, 0x7A, 0x03, 0x04, 
-    0x4E, 0xBA, 0xD9, 0xFC, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x9B, 0x90, 0x2F, 0x0B, 
-    0x76, 0x01, 0x2F, 0x03, 0x78, 0x04, 0x2F, 0x04, 0x48, 0x6E, 0xFF, 0xE8, 0x4E, 0xAD, 0x02, 0x1A, 
-    0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x04, 0x48, 0x7A, 
-    0x03, 0x08, 0x4E, 0xBA, 0xD9, 0xCA, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x10, 
-    0x26, 0x2E, 0xFF, 0xE8, 0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x03, 0x48, 0x7A, 
-    0x03, 0x24, 0x4E, 0xBA, 0xD9, 0xAA, 0x4F, 0xEF, 0x00, 0x0C, 0x59, 0x4F, 0x20, 0x2E, 0xFF, 0xE8, 
-    0x50, 0x80, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 
-    0x2B, 0x40, 0xD7, 0xC0, 0x2F, 0x2E, 0xFF, 0xE8, 0x48, 0x7A, 0x03, 0x48, 0x3F, 0x2E, 0xFF, 0xE0, 
-    0x4E, 0xBA, 0xDA, 0x14, 0x4F, 0xEF, 0x00, 0x0A, 0x2F, 0x2D, 0xD7, 0xC0, 0x48, 0x6E, 0xFF, 0xE0, 
-    0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x7A, 0x03, 0x0E, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 
-    0xD9, 0xF6, 0x5C, 0x4F, 0x20, 0x6D, 0xD7, 0xC0, 0x20, 0x10, 0x2D, 0x40, 0xFF, 0xEC, 0x2F, 0x0B, 
-    0x76, 0x01, 0x2F, 0x03, 0x22, 0x2E, 0xFF, 0xE8, 0x59, 0x81, 0x2F, 0x01, 0x20, 0x40, 0x58, 0x48, 
-    0x2F, 0x08, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x14, 0x2F, 0x2E, 
-    0x00, 0x1C, 0x2F, 0x2E, 0xFF, 0xE8, 0x48, 0x7A, 0x03, 0x18, 0x4E, 0xBA, 0xD9, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xE8, 0x91, 0x90, 0x60, 0x5E, 0x70, 0x01, 
-    0x3F, 0x00, 0x4E, 0xBA, 0x3E, 0x4E, 0x26, 0x14, 0x20, 0x03, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 
-    0x67, 0x48, 0x20, 0x03, 0x02, 0x80, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x02, 0x00, 0x00, 0x00, 
-    0x66, 0x38, 0x20, 0x03, 0x02, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0xAE, 0xFF, 0xEC, 0x24, 0x40, 
-    0x52, 0x4A, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0x23, 0xD0, 0x26, 0x40, 0x20, 0x0B, 
-    0x67, 0x18, 0x20, 0x2C, 0x00, 0x04, 0x27, 0x40, 0x00, 0x0C, 0x2F, 0x00, 0x2F, 0x0A, 0x48, 0x7A, 
-    0x02, 0xE6, 0x4E, 0xBA, 0xD6, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x50, 0x4C, 0xB9, 0xEE, 0xFF, 0xE4, 
-    0x65, 0x9C, 0x2F, 0x2D, 0xD7, 0xC0, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 
-    0x76, 0x00, 0x2B, 0x43, 0xD7, 0xC0, 0x48, 0x7A, 0x03, 0x0A, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 
-    0xD8, 0xE6, 0x5C, 0x4F, 0x2F, 0x2D, 0xD7, 0xBC, 0x48, 0x6E, 0xFF, 0xE0, 0x3F, 0x3C, 0x00, 0x20, 
-    0xA8, 0x8F, 0x2B, 0x43, 0xD7, 0xBC, 0x48, 0x7A, 0x02, 0xC6, 0x3F, 0x2E, 0xFF, 0xE0, 0x4E, 0xBA, 
-    0xD8, 0xC6, 0x5C, 0x4F, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x10, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x1C, 
-    0x2F, 0x03, 0x48, 0x7A, 0x02, 0xEE, 0x4E, 0xBA, 0xD8, 0x56, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 
-    0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x18, 0x80, 0x3F, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x50, 
-    0x72, 0x6F, 0x63, 0x5F, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x43, 
-    0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x52, 0x43, 0x31, 0x31, 0x49, 0x74, 0x65, 0x6D, 0x53, 
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x6C, 0x50, 0x55, 0x6C, 0x50, 0x31, 0x32, 0x54, 0x53, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x02, 0xDA, 0x75, 0x6E, 0x65, 0x78, 
-    0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 
-    0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 
-    0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 
-    0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
-    0x65, 0x64, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
-    0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x78, 0x25, 
-    0x30, 0x38, 0x6C, 0x78, 0x00, 0x00, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 
-    0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x74, 0x6F, 
-    0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 
-    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 
-    0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 
-    0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 
-    0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x65, 
-    0x6E, 0x67, 0x74, 0x68, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 
-    0x25, 0x73, 0x22, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 
-    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 
-    0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 
-    0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 
-    0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 
-    0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 
-    0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x20, 0x23, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 
-    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x3B, 0x20, 0x4F, 0x66, 
-    0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x25, 0x30, 0x38, 0x58, 0x20, 0x00, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
-    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x61, 0x72, 0x72, 0x61, 
-    0x79, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
-    0x00, 0x00, 0x25, 0x6C, 0x64, 0x20, 0x65, 0x78, 0x63, 0x65, 0x73, 0x73, 0x20, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 
-    0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 
-    0x69, 0x6E, 0x66, 0x6F, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x10, 0x42, 0x2E, 
-    0xFF, 0xFC, 0x26, 0x6E, 0x00, 0x08, 0x60, 0x24, 0x20, 0x2B, 0x00, 0x0C, 0x72, 0xFF, 0xB0, 0x81, 
-    0x66, 0x1A, 0x26, 0x2B, 0x00, 0x14, 0x2F, 0x03, 0x2F, 0x03, 0x48, 0x7A, 0x00, 0x4C, 0x4E, 0xBA, 
-    0xD3, 0xDE, 0x4F, 0xEF, 0x00, 0x0C, 0x1D, 0x7C, 0x00, 0x01, 0xFF, 0xFC, 0x26, 0x6B, 0x00, 0x04, 
-    0x20, 0x0B, 0x66, 0xD4, 0x10, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x04, 0x80, 0x21, 0x41, 0x6E, 0x79, 0x5F, 0x55, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x5F, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x37, 0x54, 0x53, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x00, 0x6C, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 
-    0x6F, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 
-    0x6D, 0x65, 0x64, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x0D, 0x23, 0x09, 0x09, 0x20, 0x64, 0x69, 0x64, 
-    0x20, 0x79, 0x6F, 0x75, 0x20, 0x66, 0x6F, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 
-    0x73, 0x65, 0x20, 0xD2, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x22, 0x43, 0x22, 0x20, 0x25, 
-    0x73, 0xD3, 0x3F, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x0C, 
-    0x24, 0x6E, 0x00, 0x14, 0x20, 0x12, 0x72, 0x10, 0xE2, 0xA8, 0x2B, 0x40, 0xD7, 0xD8, 0x4A, 0x2A, 
-    0x00, 0x05, 0x67, 0x06, 0x4A, 0xAA, 0x00, 0x18, 0x66, 0x1A, 0x2F, 0x2A, 0x00, 0x18, 0x12, 0x2A, 
-    0x00, 0x05, 0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x48, 0x7A, 0x01, 0x98, 0x4E, 0xBA, 0xD4, 0x10, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x14, 0x26, 0x28, 0x00, 0x1C, 0x70, 0xDC, 0x2D, 0x43, 
-    0xFF, 0xFC, 0xD6, 0x80, 0x28, 0x14, 0xB6, 0x84, 0x63, 0x14, 0x2F, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x2F, 0x00, 0x48, 0x7A, 0x01, 0xAA, 0x4E, 0xBA, 0xD3, 0xE6, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 
-    0x00, 0x14, 0x28, 0x28, 0x00, 0x1C, 0x98, 0xAD, 0xD7, 0xD8, 0x59, 0x4F, 0x2F, 0x04, 0x48, 0x6E, 
-    0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x1F, 0x2B, 0x40, 0xD7, 0xC8, 0x2F, 0x04, 
-    0x48, 0x7A, 0x01, 0xD6, 0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xD4, 0x4C, 0x4F, 0xEF, 0x00, 0x0A, 
-    0x2F, 0x2D, 0xD7, 0xC8, 0x48, 0x6E, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x7A, 
-    0x01, 0x9A, 0x3F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xD4, 0x2E, 0x5C, 0x4F, 0x20, 0x6D, 0xD7, 0xC8, 
-    0x20, 0x10, 0x2B, 0x40, 0xD7, 0xCC, 0x20, 0x40, 0x91, 0xED, 0xD7, 0xD8, 0x2B, 0x48, 0xD7, 0xD0, 
-    0x20, 0x40, 0xD1, 0xC4, 0x2B, 0x48, 0xD7, 0xD4, 0x2F, 0x2E, 0x00, 0x18, 0x76, 0x01, 0x2F, 0x03, 
-    0x2F, 0x04, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x12, 
-    0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x04, 0x48, 0x7A, 0x01, 0x9A, 0x4E, 0xBA, 0xD3, 0x52, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x99, 0x94, 0x26, 0x6D, 0xD7, 0xCC, 0x60, 0x56, 0x20, 0x13, 0x72, 0x02, 0xB0, 0x41, 
-    0x66, 0x3E, 0x20, 0x4B, 0x70, 0x21, 0xD1, 0xC0, 0x2F, 0x08, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0x1E, 0x2A, 0x28, 0x40, 0x20, 0x0C, 0x67, 0x30, 0x20, 0x2B, 0x00, 0x08, 0x36, 0x00, 0x70, 0x01, 
-    0xB6, 0x40, 0x6C, 0x12, 0x20, 0x4B, 0x70, 0x20, 0xD1, 0xC0, 0x2F, 0x08, 0x48, 0x7A, 0x01, 0x90, 
-    0x4E, 0xBA, 0xD1, 0xEC, 0x50, 0x4F, 0x30, 0x03, 0x53, 0x40, 0x39, 0x40, 0x00, 0x10, 0x60, 0x08, 
-    0x70, 0x01, 0x3F, 0x00, 0x4E, 0xBA, 0x38, 0x3C, 0x20, 0x13, 0x72, 0x10, 0xE2, 0xA8, 0xD7, 0xC0, 
-    0xB7, 0xED, 0xD7, 0xD4, 0x65, 0xA4, 0x2F, 0x2D, 0xD7, 0xC8, 0x48, 0x6E, 0xFF, 0xF8, 0x3F, 0x3C, 
-    0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xD7, 0xC8, 0x48, 0x7A, 0x01, 0xA8, 0x3F, 0x2E, 
-    0xFF, 0xF8, 0x4E, 0xBA, 0xD3, 0x22, 0x5C, 0x4F, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x18, 0x80, 0x3C, 0x66, 0x69, 0x6E, 0x64, 0x5F, 0x73, 0x72, 0x63, 0x5F, 0x50, 0x72, 0x6F, 
-    0x63, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x52, 0x43, 
-    0x31, 0x31, 0x49, 0x74, 0x65, 0x6D, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x6C, 0x50, 0x55, 
-    0x6C, 0x50, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x01, 0x74, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x72, 0x63, 
-    0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x30, 
-    0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 
-    0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x00, 0x75, 0x6E, 
-    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 
-    0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x20, 
-    0x3E, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x64, 0x61, 0x74, 0x61, 
-    0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 
-    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x64, 0x61, 0x74, 0x61, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x69, 0x63, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66, 
-    0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x20, 0x79, 
-    0x6F, 0x75, 0x72, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0xD2, 0x25, 0x73, 
-    0xD3, 0x2C, 0x20, 0x69, 0x73, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x20, 0x61, 0x73, 0x20, 0x68, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x6C, 
-    0x65, 0x61, 0x73, 0x74, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 
-    0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0xD2, 0x52, 0x65, 0x66, 0x41, 0x72, 
-    0x67, 0xD3, 0x2E, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 
-    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x64, 0x61, 0x74, 0x61, 0x20, 0x68, 0x61, 
-    0x6E, 0x64, 0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x10, 0x76, 0x00, 
-    0x10, 0x2D, 0xD7, 0xE8, 0x66, 0x60, 0x26, 0x6E, 0x00, 0x0A, 0x60, 0x46, 0x10, 0x2E, 0x00, 0x08, 
-    0x67, 0x1E, 0x30, 0x2B, 0x00, 0x10, 0x6B, 0x18, 0x30, 0x2B, 0x00, 0x10, 0x48, 0xC0, 0x2F, 0x00, 
-    0x2F, 0x2B, 0x00, 0x14, 0x48, 0x7A, 0x00, 0x72, 0x4E, 0xBA, 0xCE, 0x9A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x30, 0x2B, 0x00, 0x10, 0x6A, 0x1C, 0x10, 0x2E, 0x00, 0x08, 0x67, 0x14, 0x26, 0x2B, 0x00, 0x14, 
-    0x2F, 0x03, 0x2F, 0x03, 0x48, 0x7A, 0x00, 0x70, 0x4E, 0xBA, 0xCF, 0x94, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x76, 0x01, 0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 0x66, 0xB2, 0x20, 0x03, 0x44, 0x80, 0x91, 0x80, 
-    0x52, 0x80, 0x1B, 0x40, 0xD7, 0xE8, 0x20, 0x03, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x06, 0x80, 0x21, 0x41, 0x72, 0x67, 0x43, 0x6E, 0x74, 0x73, 0x5F, 0x4E, 0x6F, 0x74, 0x5F, 
-    0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x5F, 0x5F, 0x46, 0x50, 0x37, 0x54, 0x53, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x55, 0x63, 0x00, 0x00, 0x86, 0x23, 0x20, 0x20, 0x20, 0x73, 0x79, 0x6D, 0x62, 
-    0x6F, 0x6C, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x43, 0x6E, 0x74, 0x20, 
-    0x3D, 0x20, 0x25, 0x69, 0x00, 0x00, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 
-    0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x73, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x69, 0x63, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 0x20, 0xD2, 0x25, 
-    0x73, 0xD3, 0x0D, 0x23, 0x09, 0x09, 0x20, 0x64, 0x69, 0x64, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x66, 
-    0x6F, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0xD2, 0x65, 0x78, 
-    0x74, 0x65, 0x72, 0x6E, 0x20, 0x22, 0x43, 0x22, 0x20, 0x25, 0x73, 0xD3, 0x3F, 0x00, 0x4E, 0x56, 
-    0xFE, 0xDC, 0x48, 0xE7, 0x1E, 0x00, 0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x2E, 0x00, 0x18, 
-    0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x67, 0x0A, 0x48, 0x7A, 0x01, 0xFA, 
-    0x4E, 0xBA, 0xCF, 0xBC, 0x58, 0x4F, 0x7A, 0x00, 0x7C, 0x00, 0x60, 0x00, 0x01, 0x82, 0x2F, 0x2E, 
-    0x00, 0x18, 0x76, 0x01, 0x2F, 0x03, 0x78, 0x24, 0x2F, 0x04, 0x48, 0x6E, 0xFE, 0xDC, 0x4E, 0xAD, 
-    0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x04, 
-    0x48, 0x7A, 0x01, 0xE0, 0x4E, 0xBA, 0xCF, 0x88, 0x4F, 0xEF, 0x00, 0x0C, 0x04, 0xAE, 0x00, 0x00, 
-    0x00, 0x24, 0x00, 0x10, 0x26, 0x2E, 0xFE, 0xDC, 0x70, 0x10, 0xE0, 0xAB, 0x20, 0x2E, 0x00, 0x10, 
-    0xB0, 0x83, 0x64, 0x10, 0x2F, 0x00, 0x2F, 0x03, 0x48, 0x7A, 0x01, 0xF4, 0x4E, 0xBA, 0xCF, 0x60, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x0C, 0x6E, 0x00, 0x01, 0xFE, 0xDE, 0x66, 0x00, 0x01, 0x08, 0x10, 0x2E, 
-    0xFE, 0xE0, 0x66, 0x50, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x01, 0x66, 0x0E, 0x2F, 0x2E, 0x00, 0x1C, 
-    0x48, 0x7A, 0x01, 0xFC, 0x4E, 0xBA, 0xCE, 0x18, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x2E, 
-    0x00, 0x18, 0x48, 0x6E, 0xFE, 0xDC, 0x2F, 0x2E, 0x00, 0x14, 0x48, 0x6E, 0x00, 0x10, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xBA, 0xF4, 0x08, 0x52, 0x85, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xF9, 0xE8, 
-    0x4A, 0x00, 0x67, 0x00, 0x00, 0xDA, 0x48, 0x7A, 0x01, 0xF4, 0x4E, 0xBA, 0xCF, 0x02, 0x58, 0x4F, 
-    0x60, 0x00, 0x00, 0xCC, 0x20, 0x2E, 0xFE, 0xFC, 0xE1, 0x88, 0x2D, 0x40, 0xFF, 0x00, 0x28, 0x03, 
-    0x70, 0xDC, 0xD8, 0x80, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x04, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x03, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x84, 0x67, 0x12, 0x2F, 0x2E, 
-    0x00, 0x1C, 0x2F, 0x04, 0x48, 0x7A, 0x01, 0xF8, 0x4E, 0xBA, 0xCE, 0xC4, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x99, 0xAE, 0x00, 0x10, 0x48, 0x6E, 0xFF, 0x00, 0x48, 0x7A, 0x02, 0x18, 0x4E, 0xBA, 0xCC, 0x76, 
-    0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x08, 0x42, 0x27, 0x4E, 0xBA, 0xFD, 0x9C, 0x4A, 0x80, 0x67, 0x20, 
-    0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x2E, 0x00, 0x18, 0x48, 0x6E, 0xFE, 0xDC, 0x2F, 0x2E, 0x00, 0x14, 
-    0x48, 0x6E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0xFA, 0x3A, 0x52, 0x86, 0x60, 0x4E, 
-    0x26, 0x2E, 0xFE, 0xF8, 0x20, 0x2E, 0xFE, 0xDC, 0x72, 0x10, 0xE2, 0xA8, 0x96, 0x80, 0x70, 0x01, 
-    0x2F, 0x00, 0x2F, 0x03, 0x2F, 0x2E, 0x00, 0x18, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4A, 0x80, 0x67, 0x0A, 0x48, 0x7A, 0x01, 0xFE, 0x4E, 0xBA, 0xCE, 0x54, 0x58, 0x4F, 0x97, 0xAE, 
-    0x00, 0x10, 0x60, 0x1A, 0x2F, 0x03, 0x20, 0x2E, 0xFE, 0xDC, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 
-    0x2F, 0x00, 0x48, 0x7A, 0x02, 0x06, 0x4E, 0xBA, 0xCE, 0x36, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 
-    0x00, 0x10, 0x66, 0x00, 0xFE, 0x7A, 0x2F, 0x2E, 0x00, 0x08, 0x70, 0x01, 0x1F, 0x00, 0x4E, 0xBA, 
-    0xFD, 0x16, 0x4A, 0x80, 0x67, 0x0A, 0x48, 0x7A, 0x02, 0x1A, 0x4E, 0xBA, 0xCE, 0x12, 0x58, 0x4F, 
-    0x4C, 0xDF, 0x00, 0x78, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x18, 0x80, 0x39, 0x66, 0x69, 0x6E, 0x64, 
-    0x5F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 
-    0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x6C, 0x55, 0x6C, 0x50, 0x31, 0x32, 
-    0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x50, 0x37, 0x54, 0x53, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x02, 0x08, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x65, 
-    0x65, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 
-    0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 
-    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66, 
-    0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x69, 0x74, 
-    0x65, 0x6D, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x25, 0x64, 0x20, 0x65, 0x78, 0x63, 
-    0x65, 0x65, 0x64, 0x73, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x64, 
-    0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 0x00, 0x00, 0x6D, 0x6F, 
-    0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 
-    0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x6F, 0x6E, 0x65, 0x20, 
-    0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 
-    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x6E, 
-    0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 
-    0x63, 0x6F, 0x64, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x00, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 
-    0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x23, 0x20, 0x20, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 
-    0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x66, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
-    0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 
-    0x73, 0xD3, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x6F, 
-    0x76, 0x65, 0x72, 0x20, 0x73, 0x72, 0x63, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 
-    0x62, 0x75, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x45, 0x78, 0x70, 0x65, 0x63, 0x74, 
-    0x65, 0x64, 0x20, 0x53, 0x45, 0x43, 0x54, 0x49, 0x4F, 0x4E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 
-    0x69, 0x6E, 0x20, 0x44, 0x65, 0x62, 0x75, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x25, 0x64, 
-    0x3A, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x20, 0x20, 
-    0x0D, 0x00, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 
-    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 
-    0x61, 0x6C, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x00, 
-    0x4E, 0x56, 0xFD, 0xBC, 0x48, 0xE7, 0x1C, 0x38, 0x70, 0x00, 0x28, 0x40, 0x1D, 0x7C, 0x00, 0x01, 
-    0xFD, 0xBC, 0x78, 0x00, 0x7A, 0x00, 0x60, 0x00, 0x01, 0x9C, 0x48, 0x7A, 0x01, 0xEC, 0x20, 0x05, 
-    0xE5, 0x80, 0x45, 0xED, 0xD7, 0x22, 0x45, 0xF2, 0x00, 0x00, 0x2F, 0x12, 0x4E, 0xAD, 0x02, 0x72, 
-    0x50, 0x4F, 0x2D, 0x40, 0xFD, 0xC0, 0x4A, 0x80, 0x66, 0x00, 0x01, 0x18, 0x2F, 0x12, 0x48, 0x7A, 
-    0x01, 0xCA, 0x4E, 0xBA, 0xCB, 0x7A, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x5E, 0x20, 0x6E, 0xFD, 0xC0, 
-    0x36, 0x28, 0x00, 0x12, 0x70, 0x10, 0x3D, 0x43, 0xFF, 0xFC, 0xC6, 0x40, 0x66, 0x00, 0x01, 0x2E, 
-    0x30, 0x2E, 0xFF, 0xFC, 0x72, 0x20, 0xC0, 0x41, 0x67, 0x00, 0x01, 0x22, 0x20, 0x05, 0xE5, 0x80, 
-    0x41, 0xED, 0xD7, 0x22, 0x2F, 0x30, 0x00, 0x00, 0x48, 0x7A, 0x01, 0xAA, 0x4E, 0xBA, 0xCB, 0x40, 
-    0x50, 0x4F, 0x60, 0x00, 0x01, 0x08, 0x0C, 0x2E, 0x00, 0x0D, 0xFD, 0xCC, 0x67, 0x00, 0x00, 0xD0, 
-    0x48, 0x6E, 0xFD, 0xC8, 0x48, 0x6E, 0xFD, 0xC4, 0x48, 0x6E, 0xFE, 0xF8, 0x48, 0x7A, 0x01, 0x9E, 
-    0x48, 0x6E, 0xFD, 0xCC, 0x4E, 0xAD, 0x02, 0x52, 0x4F, 0xEF, 0x00, 0x14, 0x26, 0x00, 0x0C, 0xAE, 
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0xC4, 0x66, 0x0C, 0x2F, 0x13, 0x48, 0x7A, 0x01, 0x8C, 0x4E, 0xBA, 
-    0xCA, 0xFE, 0x50, 0x4F, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x92, 0x0C, 0x2E, 
-    0x00, 0x3B, 0xFE, 0xF8, 0x67, 0x00, 0x00, 0x88, 0x48, 0x6E, 0xFE, 0xF8, 0x4E, 0xAD, 0x01, 0xFA, 
-    0x58, 0x4F, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x63, 0x0C, 0x2F, 0x13, 0x48, 0x7A, 0x01, 0x7C, 
-    0x4E, 0xBA, 0xCA, 0xCC, 0x50, 0x4F, 0x70, 0x18, 0x2F, 0x00, 0x4E, 0xBA, 0x17, 0xBE, 0x24, 0x40, 
-    0x20, 0x0A, 0x67, 0x0C, 0x48, 0x6E, 0xFE, 0xF8, 0x2F, 0x0C, 0x2F, 0x0A, 0x4E, 0xBA, 0x15, 0x40, 
-    0x28, 0x4A, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0x20, 0x68, 
-    0x00, 0x0C, 0x4E, 0x90, 0x10, 0x2E, 0xFD, 0xBC, 0x67, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x8A, 
-    0x42, 0x2E, 0xFD, 0xBC, 0x60, 0x02, 0x52, 0x84, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x02, 0x66, 0x1E, 
-    0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xC8, 0x6F, 0x14, 0x35, 0x6E, 0xFD, 0xCA, 0x00, 0x10, 
-    0x60, 0x0C, 0x20, 0x05, 0xE5, 0x80, 0x41, 0xED, 0xD7, 0x22, 0xD0, 0x88, 0x26, 0x40, 0x76, 0x00, 
-    0x2D, 0x43, 0xFD, 0xC8, 0x2D, 0x43, 0xFD, 0xC4, 0x42, 0x2E, 0xFD, 0xCC, 0x2F, 0x2E, 0xFD, 0xC0, 
-    0x2F, 0x3C, 0x00, 0x00, 0x01, 0x2C, 0x48, 0x6E, 0xFD, 0xCC, 0x4E, 0xAD, 0x02, 0x02, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4A, 0x80, 0x66, 0x00, 0xFF, 0x00, 0x60, 0x00, 0xFE, 0xC2, 0x10, 0x2E, 0xFD, 0xBC, 
-    0x67, 0x16, 0x20, 0x05, 0xE5, 0x80, 0x41, 0xED, 0xD7, 0x22, 0x2F, 0x30, 0x00, 0x00, 0x48, 0x7A, 
-    0x01, 0x0C, 0x4E, 0xBA, 0xC8, 0xC2, 0x50, 0x4F, 0x2F, 0x2E, 0xFD, 0xC0, 0x4E, 0xAD, 0x02, 0x62, 
-    0x58, 0x4F, 0x52, 0x85, 0xBA, 0xAD, 0xD7, 0x2A, 0x6D, 0x00, 0xFE, 0x60, 0x4A, 0x84, 0x66, 0x0A, 
-    0x10, 0x2E, 0xFD, 0xBC, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 0x42, 0x00, 0x4C, 0xDF, 0x1C, 0x38, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x80, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x5F, 0x73, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x31, 0x32, 0x54, 
-    0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x50, 0x50, 0x37, 0x54, 0x53, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x00, 0xD4, 0x72, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x6F, 0x70, 0x65, 0x6E, 0x20, 0x2D, 0x76, 0x69, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 
-    0x25, 0x73, 0x22, 0x00, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 
-    0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x25, 0x32, 0x35, 0x35, 
-    0x73, 0x25, 0x6C, 0x6E, 0x25, 0x6C, 0x69, 0x00, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x6C, 
-    0x69, 0x6E, 0x65, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x00, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x75, 
-    0x6E, 0x74, 0x65, 0x72, 0x64, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
-    0x61, 0x6D, 0x65, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 
-    0x32, 0x35, 0x34, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 
-    0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x00, 0x20, 0x4E, 0x6F, 0x20, 
-    0x6E, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 
-    0x68, 0x65, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4E, 0x61, 0x6D, 0x65, 
-    0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x1F, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x7E, 0x00, 0x70, 0x00, 
-    0x2B, 0x40, 0xD7, 0xDC, 0x0C, 0x2D, 0x00, 0xEB, 0xD7, 0x3E, 0x66, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 
-    0x01, 0x44, 0x4E, 0xBA, 0xC8, 0xBA, 0x50, 0x4F, 0x20, 0x2D, 0xD7, 0x3E, 0x67, 0x00, 0x01, 0x0C, 
-    0x42, 0xA7, 0x2F, 0x2D, 0xD7, 0x3E, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4A, 0x80, 0x67, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x60, 0x4E, 0xBA, 0xC8, 0x92, 0x50, 0x4F, 
-    0x2F, 0x0B, 0x76, 0x01, 0x2F, 0x03, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xAD, 
-    0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x6C, 
-    0x4E, 0xBA, 0xC8, 0x6C, 0x50, 0x4F, 0x26, 0x2E, 0xFF, 0xFC, 0x6F, 0x00, 0x00, 0xA6, 0x28, 0x03, 
-    0xE5, 0x84, 0x20, 0x04, 0xA1, 0x1E, 0x2B, 0x48, 0xD7, 0xDC, 0x20, 0x08, 0x66, 0x0C, 0x2F, 0x04, 
-    0x48, 0x7A, 0x01, 0x74, 0x4E, 0xBA, 0xC8, 0x48, 0x50, 0x4F, 0x2F, 0x0B, 0x76, 0x01, 0x2F, 0x03, 
-    0x2F, 0x04, 0x2F, 0x2D, 0xD7, 0xDC, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 
-    0x67, 0x0C, 0x2F, 0x0A, 0x48, 0x7A, 0x01, 0x80, 0x4E, 0xBA, 0xC8, 0x24, 0x50, 0x4F, 0x2C, 0x2E, 
-    0xFF, 0xFC, 0x7A, 0x00, 0x60, 0x1A, 0x26, 0x05, 0xE5, 0x83, 0xD6, 0xAD, 0xD7, 0xDC, 0x20, 0x43, 
-    0x20, 0x10, 0xB0, 0xAD, 0xD7, 0x4E, 0x63, 0x04, 0x2C, 0x05, 0x60, 0x0A, 0x52, 0x87, 0x52, 0x85, 
-    0xBA, 0xAE, 0xFF, 0xFC, 0x6D, 0xE0, 0xBC, 0xAE, 0xFF, 0xFC, 0x6C, 0x32, 0x2A, 0x06, 0x52, 0x85, 
-    0x60, 0x26, 0x26, 0x05, 0x78, 0x02, 0xE9, 0xA3, 0xD6, 0xAD, 0xD7, 0xDC, 0x20, 0x43, 0x26, 0x10, 
-    0xB6, 0xAD, 0xD7, 0x4E, 0x64, 0x10, 0x20, 0x06, 0xE9, 0xA0, 0xD0, 0xAD, 0xD7, 0xDC, 0x20, 0x40, 
-    0x20, 0x83, 0x52, 0x86, 0x52, 0x87, 0x52, 0x85, 0xBA, 0xAE, 0xFF, 0xFC, 0x6D, 0xD4, 0x20, 0x07, 
-    0x60, 0x1A, 0x20, 0x2E, 0xFF, 0xFC, 0x67, 0x12, 0x2F, 0x0A, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x7A, 
-    0x01, 0x30, 0x4E, 0xBA, 0xC7, 0xAA, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x9A, 0x67, 0x65, 0x74, 0x5F, 0x61, 0x69, 0x66, 0x5F, 0x72, 
-    0x65, 0x6C, 0x6F, 0x63, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x00, 0x01, 0x30, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 
-    0x73, 0x22, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 
-    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x20, 0x6F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0xD2, 0x2D, 0x61, 0x69, 0x66, 0x20, 0x2D, 0x62, 0x69, 0x6E, 
-    0x20, 0x2D, 0x72, 0x65, 0x6C, 0xD3, 0x2E, 0x00, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x73, 
-    0x65, 0x65, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x69, 0x66, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x72, 0x65, 0x61, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
-    0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 
-    0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 
-    0x6F, 0x72, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x20, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 
-    0x20, 0x61, 0x69, 0x66, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 
-    0x20, 0x42, 0x4F, 0x47, 0x55, 0x53, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 
-    0x6E, 0x73, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x28, 0x25, 0x30, 0x38, 0x58, 0x29, 0x20, 
-    0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 
-    0x73, 0x22, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x0A, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x70, 0x0E, 0x2F, 0x00, 0x4E, 0xBA, 0x13, 0x34, 0x24, 0x40, 0x20, 0x0A, 0x67, 0x0C, 0x2F, 0x3C, 
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x0A, 0x4E, 0xBA, 0x12, 0x34, 0x2F, 0x0A, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0xBA, 0xFA, 0x5E, 0x4A, 0x00, 0x67, 0x0A, 0x48, 0x7A, 0x00, 0x62, 0x4E, 0xBA, 0xC6, 0x10, 
-    0x58, 0x4F, 0x2F, 0x2D, 0xD7, 0x32, 0x2F, 0x2D, 0xD7, 0x36, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x2E, 
-    0x00, 0x10, 0x2F, 0x0A, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xBA, 0xF6, 0x14, 0x2F, 0x2D, 0xD7, 0x32, 
-    0x2F, 0x2D, 0xD7, 0x36, 0x4E, 0xBA, 0xFD, 0x06, 0x2B, 0x40, 0xD7, 0xE0, 0x2F, 0x0A, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xBA, 0xD0, 0x50, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x10, 0x9B, 0x65, 
-    0x6D, 0x69, 0x74, 0x5F, 0x4E, 0x54, 0x4B, 0x5F, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 
-    0x65, 0x5F, 0x5F, 0x46, 0x6C, 0x55, 0x6C, 0x6C, 0x55, 0x6C, 0x00, 0x2C, 0x75, 0x6E, 0x61, 0x62, 
-    0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x61, 0x20, 0x76, 0x61, 
-    0x6C, 0x69, 0x64, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 
-    0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x4E, 0x56, 0xFE, 0xDC, 0x48, 0xE7, 0x1E, 0x00, 
-    0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x14, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4A, 0x80, 0x67, 0x0A, 0x48, 0x7A, 0x02, 0x92, 0x4E, 0xBA, 0xC5, 0x62, 0x58, 0x4F, 
-    0x7A, 0x00, 0x7C, 0x00, 0x60, 0x00, 0x01, 0xCC, 0x2F, 0x2E, 0x00, 0x14, 0x76, 0x01, 0x2F, 0x03, 
-    0x78, 0x24, 0x2F, 0x04, 0x48, 0x6E, 0xFE, 0xDC, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 
-    0xB0, 0x83, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x04, 0x48, 0x7A, 0x02, 0x78, 0x4E, 0xBA, 
-    0xC5, 0x2E, 0x4F, 0xEF, 0x00, 0x0C, 0x04, 0xAE, 0x00, 0x00, 0x00, 0x24, 0x00, 0x0C, 0x26, 0x2E, 
-    0xFE, 0xDC, 0x70, 0x10, 0xE0, 0xAB, 0x20, 0x2E, 0x00, 0x0C, 0xB0, 0x83, 0x64, 0x10, 0x2F, 0x00, 
-    0x2F, 0x03, 0x48, 0x7A, 0x02, 0x8C, 0x4E, 0xBA, 0xC5, 0x06, 0x4F, 0xEF, 0x00, 0x0C, 0x0C, 0x6E, 
-    0x00, 0x01, 0xFE, 0xDE, 0x66, 0x00, 0x01, 0x52, 0x10, 0x2E, 0xFE, 0xE0, 0x66, 0x30, 0x0C, 0x85, 
-    0x00, 0x00, 0x00, 0x01, 0x66, 0x0E, 0x2F, 0x2E, 0x00, 0x18, 0x48, 0x7A, 0x02, 0x94, 0x4E, 0xBA, 
-    0xC3, 0xBE, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x2E, 0x00, 0x14, 0x48, 0x6E, 0xFE, 0xDC, 
-    0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 0xD2, 0x12, 0x52, 0x85, 0x60, 0x00, 0x01, 0x36, 0x10, 0x2D, 
-    0xD7, 0x1A, 0x67, 0x00, 0x00, 0xCE, 0x20, 0x2E, 0xFE, 0xFC, 0xE1, 0x88, 0x2D, 0x40, 0xFF, 0x00, 
-    0x28, 0x03, 0x70, 0xDC, 0xD8, 0x80, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x04, 0x70, 0x01, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0x03, 0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x84, 0x67, 0x12, 
-    0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x04, 0x48, 0x7A, 0x02, 0x66, 0x4E, 0xBA, 0xC4, 0x82, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x99, 0xAE, 0x00, 0x0C, 0x48, 0x6E, 0xFF, 0x00, 0x2F, 0x2E, 0xFE, 0xF8, 0x2F, 0x2E, 
-    0xFE, 0xF4, 0x12, 0x2E, 0xFE, 0xE1, 0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x12, 0x2E, 0xFE, 0xE0, 
-    0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0x6A, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 
-    0x00, 0x18, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x2E, 0x00, 0x14, 0x48, 0x6E, 0xFE, 0xDC, 0x2F, 0x2E, 
-    0x00, 0x10, 0x48, 0x6E, 0x00, 0x0C, 0x4E, 0xBA, 0xE5, 0x22, 0x10, 0x2D, 0xD7, 0x20, 0x67, 0x00, 
-    0x00, 0x84, 0x70, 0x01, 0x2F, 0x00, 0x20, 0x2E, 0xFE, 0xF8, 0x90, 0x83, 0x2F, 0x00, 0x2F, 0x2E, 
-    0x00, 0x14, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x67, 0x18, 0x2F, 0x2E, 
-    0x00, 0x18, 0x20, 0x2E, 0xFE, 0xF8, 0x90, 0x83, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0x7A, 0x4E, 0xBA, 
-    0xC3, 0xFE, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFE, 0xF8, 0x90, 0x83, 0x91, 0xAE, 0x00, 0x0C, 
-    0x60, 0x42, 0x70, 0x01, 0x2F, 0x00, 0x20, 0x2E, 0xFE, 0xF8, 0x76, 0xDC, 0xD0, 0x83, 0x2F, 0x00, 
-    0x2F, 0x2E, 0x00, 0x14, 0x4E, 0xAD, 0x02, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x67, 0x18, 
-    0x2F, 0x2E, 0x00, 0x18, 0x20, 0x2E, 0xFE, 0xF8, 0xD0, 0x83, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0x6E, 
-    0x4E, 0xBA, 0xC3, 0xBC, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFE, 0xF8, 0x72, 0xDC, 0xD0, 0x81, 
-    0x91, 0xAE, 0x00, 0x0C, 0x52, 0x86, 0x60, 0x1A, 0x2F, 0x03, 0x20, 0x2E, 0xFE, 0xDC, 0x02, 0x80, 
-    0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x48, 0x7A, 0x02, 0x7A, 0x4E, 0xBA, 0xC3, 0x92, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x05, 0x72, 0x01, 0x24, 0x2E, 0x00, 0x0C, 0x66, 0x00, 0xFE, 0x2C, 0xBC, 0x81, 
-    0x66, 0x06, 0x41, 0xFA, 0x02, 0xCE, 0x60, 0x04, 0x41, 0xFA, 0x02, 0xC6, 0x2F, 0x08, 0x2F, 0x06, 
-    0xBA, 0x81, 0x66, 0x06, 0x41, 0xFA, 0x02, 0xB8, 0x60, 0x04, 0x41, 0xFA, 0x02, 0xB0, 0x2F, 0x08, 
-    0x2F, 0x00, 0x48, 0x7A, 0x02, 0x68, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x14, 0x0C, 0x85, 
-    0x00, 0x00, 0x00, 0x01, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x20, 0x00, 0x14, 0x2E, 
-    0x00, 0x0A, 0x72, 0x00, 0x12, 0x02, 0xB0, 0x81, 0x67, 0x0E, 0x2F, 0x2E, 0x00, 0x18, 0x48, 0x7A, 
-    0x02, 0x84, 0x4E, 0xBA, 0xC2, 0x0A, 0x50, 0x4F, 0x20, 0x06, 0x44, 0x80, 0x91, 0x80, 0x44, 0x80, 
-    0x14, 0x2E, 0x00, 0x08, 0x72, 0x00, 0x12, 0x02, 0xB0, 0x81, 0x67, 0x0E, 0x2F, 0x2E, 0x00, 0x18, 
-    0x48, 0x7A, 0x02, 0x9E, 0x4E, 0xBA, 0xC1, 0xE8, 0x50, 0x4F, 0x4C, 0xDF, 0x00, 0x78, 0x4E, 0x5E, 
-    0x4E, 0x74, 0x00, 0x14, 0x80, 0x22, 0x64, 0x75, 0x6D, 0x70, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x6C, 0x55, 0x6C, 0x55, 0x63, 0x55, 0x63, 0x02, 0xA4, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x73, 0x65, 0x65, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 
-    0x66, 0x6F, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 
-    0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 
-    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 
-    0x69, 0x74, 0x65, 0x6D, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x25, 0x64, 0x20, 0x65, 
-    0x78, 0x63, 0x65, 0x65, 0x64, 0x73, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 
-    0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 0x00, 0x00, 
-    0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6C, 0x6F, 
-    0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
-    0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 
-    0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x3A, 0x20, 
-    0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x2C, 0x20, 
-    0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 
-    0x6C, 0x78, 0x2C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
-    0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 
-    0x22, 0x25, 0x73, 0x22, 0x0D, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x6B, 0x69, 0x70, 
-    0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x63, 0x61, 0x6E, 0xD5, 
-    0x74, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 
-    0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 
-    0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 
-    0x00, 0x00, 0x45, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x53, 0x45, 0x43, 0x54, 0x49, 
-    0x4F, 0x4E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x25, 0x64, 0x3A, 0x20, 0x20, 0x6C, 0x65, 0x6E, 
-    0x67, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x20, 0x20, 0x0D, 0x00, 0x25, 0x64, 0x20, 0x6C, 
-    0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x25, 0x73, 0x2C, 0x20, 0x25, 0x64, 0x20, 0x73, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 
-    0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x25, 0x73, 0x0D, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 
-    0x73, 0x00, 0x00, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6E, 
-    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 
-    0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 
-    0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 
-    0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 
-    0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
-    0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x4E, 0x56, 
-    0xFF, 0xEC, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x0C, 0x48, 0x6D, 0x00, 0x2A, 0x4E, 0xBA, 
-    0x16, 0x56, 0x58, 0x4F, 0x48, 0x6D, 0x00, 0x32, 0x76, 0x02, 0x2F, 0x03, 0x4E, 0xBA, 0x21, 0xEC, 
-    0x50, 0x4F, 0x42, 0xA7, 0x4E, 0xBA, 0x24, 0x2A, 0x20, 0x14, 0x2B, 0x40, 0xD7, 0x0C, 0x26, 0x4C, 
-    0x58, 0x4B, 0x20, 0x2E, 0x00, 0x08, 0xE7, 0xA0, 0xD0, 0x8C, 0x24, 0x40, 0x2F, 0x0B, 0x2F, 0x0A, 
-    0x4E, 0xBA, 0xC1, 0x72, 0x2D, 0x40, 0xFF, 0xEC, 0x10, 0x2D, 0xD7, 0x18, 0x67, 0x0A, 0x48, 0x7A, 
-    0x02, 0xBE, 0x4E, 0xBA, 0xBE, 0xF4, 0x58, 0x4F, 0x10, 0x2D, 0xD7, 0x16, 0x66, 0x20, 0x20, 0x2D, 
-    0xD7, 0x2E, 0x66, 0x0A, 0x48, 0x7A, 0x02, 0xAA, 0x4E, 0xBA, 0xBE, 0xDE, 0x58, 0x4F, 0x10, 0x2D, 
-    0xD7, 0x1E, 0x66, 0x0A, 0x48, 0x7A, 0x02, 0xBA, 0x4E, 0xBA, 0xBE, 0xCE, 0x58, 0x4F, 0xB7, 0xEE, 
-    0xFF, 0xEC, 0x64, 0x00, 0x02, 0x6C, 0x20, 0x13, 0x2B, 0x40, 0xD7, 0x32, 0x48, 0x7A, 0x02, 0xC8, 
-    0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x72, 0x50, 0x4F, 0x2B, 0x40, 0xD7, 0x36, 0x4A, 0x80, 0x66, 0x0E, 
-    0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 0x02, 0xB2, 0x4E, 0xBA, 0xBF, 0x84, 0x50, 0x4F, 0x2F, 0x2D, 
-    0xD7, 0x36, 0x76, 0x01, 0x2F, 0x03, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x48, 0x6D, 0xD7, 0x3A, 
-    0x4E, 0xAD, 0x02, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0xB0, 0x83, 0x67, 0x16, 0x2F, 0x2D, 0xD7, 0x32, 
-    0x2F, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x48, 0x7A, 0x02, 0x96, 0x4E, 0xBA, 0xBF, 0x52, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x0C, 0xAD, 0xEF, 0x00, 0x00, 0x11, 0xD7, 0x4A, 0x67, 0x0E, 0x2F, 0x2D, 0xD7, 0x32, 
-    0x48, 0x7A, 0x02, 0xB0, 0x4E, 0xBA, 0xBF, 0x38, 0x50, 0x4F, 0x0C, 0x2D, 0x00, 0xEB, 0xD7, 0x46, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x20, 0x00, 0x1B, 0x40, 0xD7, 0xBA, 0x0C, 0xAD, 
-    0x00, 0x00, 0x00, 0x04, 0xD7, 0x4E, 0x64, 0x0A, 0x48, 0x7A, 0x02, 0xB4, 0x4E, 0xBA, 0xBF, 0x10, 
-    0x58, 0x4F, 0x41, 0xEE, 0xFF, 0xF0, 0x20, 0x38, 0x02, 0x0C, 0xA9, 0xC6, 0x10, 0x2D, 0xD7, 0xBA, 
-    0x67, 0x0E, 0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 0x03, 0x04, 0x4E, 0xBA, 0xBE, 0xF2, 0x50, 0x4F, 
-    0x20, 0x2D, 0xD7, 0x62, 0x67, 0x0E, 0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 0x03, 0x4C, 0x4E, 0xBA, 
-    0xBE, 0xDE, 0x50, 0x4F, 0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 0x03, 0xCC, 0x4E, 0xBA, 0xBC, 0x96, 
-    0x50, 0x4F, 0x30, 0x2E, 0xFF, 0xF8, 0x48, 0xC0, 0x2F, 0x00, 0x30, 0x2E, 0xFF, 0xF6, 0x48, 0xC0, 
-    0x2F, 0x00, 0x30, 0x2E, 0xFF, 0xF0, 0x48, 0xC0, 0x2F, 0x00, 0x30, 0x2E, 0xFF, 0xF4, 0x48, 0xC0, 
-    0x2F, 0x00, 0x30, 0x2E, 0xFF, 0xF2, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x7A, 0x03, 0x6C, 0x4E, 0xBA, 
-    0xBC, 0x64, 0x4F, 0xEF, 0x00, 0x18, 0x2F, 0x2D, 0xD7, 0x4E, 0x48, 0x7A, 0x03, 0x3A, 0x4E, 0xBA, 
-    0xBC, 0x54, 0x50, 0x4F, 0x36, 0x2D, 0xD7, 0x60, 0x70, 0x01, 0xC6, 0x40, 0x56, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x1D, 0x43, 0xFF, 0xFE, 0x30, 0x2D, 0xD7, 0x60, 0x72, 0x02, 0xC0, 0x41, 
-    0x56, 0xC0, 0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x1D, 0x40, 0xFF, 0xFF, 0x10, 0x2D, 0xD7, 0x16, 
-    0x66, 0x00, 0x00, 0x8E, 0x20, 0x2D, 0xD7, 0x52, 0x67, 0x0E, 0x2F, 0x2D, 0xD7, 0x32, 0x48, 0x7A, 
-    0x03, 0x70, 0x4E, 0xBA, 0xBE, 0x4A, 0x50, 0x4F, 0x20, 0x2D, 0xD7, 0x5E, 0x67, 0x48, 0x10, 0x2E, 
-    0xFF, 0xFE, 0x67, 0x48, 0x10, 0x2E, 0xFF, 0xFF, 0x67, 0x42, 0x26, 0x2D, 0xD7, 0x4E, 0xD6, 0xAD, 
-    0xD7, 0x52, 0x18, 0x2D, 0xD7, 0xBA, 0x67, 0x04, 0x70, 0x00, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0x80, 0xD6, 0x80, 0x2F, 0x03, 0x2F, 0x2D, 0xD7, 0x56, 0x4A, 0x04, 0x67, 0x04, 0x70, 0x00, 
-    0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x2F, 0x00, 0x2F, 0x2D, 0xD7, 0x4E, 0x4E, 0xBA, 
-    0xF7, 0xB4, 0x60, 0x00, 0x00, 0xB0, 0x20, 0x2D, 0xD7, 0x56, 0x66, 0x12, 0x2F, 0x2D, 0xD7, 0x32, 
-    0x48, 0x7A, 0x03, 0xA2, 0x4E, 0xBA, 0xBD, 0xE8, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x98, 0x2F, 0x2D, 
-    0xD7, 0x56, 0x48, 0x7A, 0x04, 0x06, 0x4E, 0xAD, 0x02, 0x2A, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x86, 
-    0x16, 0x2E, 0xFF, 0xFF, 0x67, 0x06, 0x41, 0xFA, 0x04, 0x86, 0x60, 0x04, 0x41, 0xFA, 0x04, 0x7E, 
-    0x2F, 0x08, 0x10, 0x2E, 0xFF, 0xFE, 0x67, 0x0A, 0x4A, 0x03, 0x67, 0x06, 0x41, 0xFA, 0x04, 0x68, 
-    0x60, 0x04, 0x41, 0xFA, 0x04, 0x60, 0x2F, 0x08, 0x18, 0x2E, 0xFF, 0xFE, 0x67, 0x06, 0x41, 0xFA, 
-    0x04, 0x4A, 0x60, 0x04, 0x41, 0xFA, 0x04, 0x42, 0x2F, 0x08, 0x2F, 0x2D, 0xD7, 0x56, 0x48, 0x7A, 
-    0x03, 0xFA, 0x4E, 0xAD, 0x02, 0x2A, 0x4F, 0xEF, 0x00, 0x14, 0x10, 0x2D, 0xD7, 0x1A, 0x80, 0x2D, 
-    0xD7, 0x1C, 0x67, 0x30, 0x2F, 0x2D, 0xD7, 0x32, 0x2F, 0x2D, 0xD7, 0x36, 0x20, 0x2D, 0xD7, 0x4E, 
-    0xD0, 0xAD, 0xD7, 0x52, 0x12, 0x2D, 0xD7, 0xBA, 0x67, 0x04, 0x72, 0x00, 0x60, 0x06, 0x22, 0x3C, 
-    0x00, 0x00, 0x00, 0x80, 0xD0, 0x81, 0x2F, 0x00, 0x2F, 0x2D, 0xD7, 0x56, 0x1F, 0x04, 0x1F, 0x03, 
-    0x4E, 0xBA, 0xF7, 0xC6, 0x2F, 0x2D, 0xD7, 0x36, 0x4E, 0xAD, 0x02, 0x62, 0x58, 0x4F, 0x60, 0x0A, 
-    0x48, 0x7A, 0x04, 0x0A, 0x4E, 0xBA, 0xBC, 0x52, 0x58, 0x4F, 0x20, 0x2D, 0xD7, 0x10, 0x4C, 0xDF, 
-    0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6D, 0x61, 0x69, 0x6E, 0x00, 0x04, 0x0C, 0x00, 0x00, 
-    0x27, 0x2D, 0x6F, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x27, 0x20, 
-    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x00, 
-    0xD2, 0x2D, 0x76, 0x69, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x2F, 0x70, 
-    0x61, 0x74, 0x68, 0xD3, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6D, 0x69, 0x73, 
-    0x73, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x72, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6F, 0x70, 
-    0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 
-    0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x69, 0x66, 0x5F, 0x68, 0x65, 0x61, 0x64, 0x65, 
-    0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 
-    0x00, 0x00, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x64, 0x6F, 0x65, 0x73, 
-    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 
-    0x69, 0x6E, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x20, 0x52, 
-    0x65, 0x61, 0x64, 0x2D, 0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6D, 
-    0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x21, 0x20, 0x41, 0x6C, 0x6C, 0x20, 0x63, 0x6F, 0x64, 0x65, 
-    0x20, 0x77, 0x61, 0x73, 0x20, 0x64, 0x65, 0x61, 0x64, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x70, 
-    0x65, 0x64, 0x21, 0x70, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x79, 0x20, 0x64, 0x75, 0x65, 0x20, 
-    0x74, 0x6F, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x2F, 0x69, 0x6E, 0x76, 0x61, 0x6C, 
-    0x69, 0x64, 0x20, 0xD2, 0x6D, 0x61, 0x69, 0x6E, 0xD3, 0x2E, 0x00, 0x00, 0x20, 0x74, 0x68, 0x65, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6C, 
-    0x69, 0x6E, 0x6B, 0x65, 0x64, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x6C, 0x79, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x4E, 0x54, 
-    0x4B, 0x3B, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x70, 0x74, 
-    0x69, 0x6F, 0x6E, 0x73, 0x20, 0xD2, 0x2D, 0x61, 0x69, 0x66, 0x20, 0x2D, 0x62, 0x69, 0x6E, 0x20, 
-    0x2D, 0x72, 0x65, 0x6C, 0xD3, 0x20, 0x00, 0x00, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x62, 
-    0x65, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 
-    0x6E, 0x6F, 0x6E, 0x2D, 0x7A, 0x65, 0x72, 0x6F, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 0x64, 
-    0x64, 0x72, 0x65, 0x73, 0x73, 0x00, 0x20, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 
-    0x79, 0x20, 0x28, 0x63, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
-    0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x20, 0x20, 0x62, 0x79, 0x20, 0x41, 0x49, 0x46, 
-    0x74, 0x6F, 0x4E, 0x54, 0x4B, 0x20, 0x6F, 0x6E, 0x20, 0x25, 0x30, 0x32, 0x69, 0x2F, 0x25, 0x30, 
-    0x32, 0x69, 0x2F, 0x25, 0x30, 0x32, 0x69, 0x20, 0x61, 0x74, 0x20, 0x25, 0x30, 0x32, 0x69, 0x3A, 
-    0x25, 0x30, 0x32, 0x69, 0x20, 0x00, 0x20, 0x4E, 0x54, 0x4B, 0x20, 0x43, 0x20, 0x46, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 
-    0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x20, 0x68, 
-    0x61, 0x73, 0x20, 0x61, 0x20, 0x52, 0x2F, 0x57, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 
-    0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 
-    0x69, 0x73, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 
-    0x20, 0x69, 0x6E, 0x20, 0x4E, 0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 
-    0x67, 0x65, 0x73, 0x2E, 0x0D, 0x23, 0x20, 0x20, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x63, 0x61, 
-    0x6E, 0x20, 0x75, 0x73, 0x65, 0x20, 0xD2, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0xD3, 0x20, 0x67, 0x6C, 
-    0x6F, 0x62, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x26, 
-    0x20, 0xD2, 0x2A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0xD3, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 
-    0x72, 0x73, 0x20, 0x00, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0xD2, 0x25, 
-    0x73, 0xD3, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 
-    0x64, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
-    0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x4E, 0x54, 
-    0x4B, 0x3B, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0xD2, 0x2D, 0x64, 0x65, 
-    0x62, 0x75, 0x67, 0xD3, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x77, 
-    0x69, 0x74, 0x68, 0x20, 0xD2, 0x2D, 0x67, 0x66, 0xD3, 0x00, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 
-    0x78, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x75, 0x6E, 0x65, 0x78, 0x70, 
-    0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x20, 
-    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 
-    0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x0D, 0x00, 0x00, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 
-    0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x3A, 0x20, 
-    0x20, 0x25, 0x73, 0x25, 0x73, 0x25, 0x73, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 
-    0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 
-    0x65, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x0D, 0x00, 0x00, 0x00, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 
-    0x76, 0x65, 0x6C, 0x00, 0x00, 0x00, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x00, 0x00, 0x00, 0x73, 0x6F, 
-    0x75, 0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x00, 0x00, 0x20, 0x69, 0x6E, 0x70, 
-    0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 
-    0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xAD, 0x01, 0xFA, 0x58, 0x4F, 0x52, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x05, 0xFA, 0x24, 0x40, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0A, 0x4E, 0xAD, 0x01, 0xF2, 0x50, 0x4F, 
-    0x20, 0x0A, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x8F, 0x43, 0x6F, 0x70, 0x79, 0x53, 
-    0x74, 0x72, 0x69, 0x6E, 0x67, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x20, 0x53, 0x20, 0x50, 0x4E, 0x90, 0x26, 0x00, 0x20, 0x03, 0xE5, 0x80, 0xD0, 0xAB, 0x00, 0x08, 
-    0x20, 0x40, 0x24, 0x50, 0x20, 0x0A, 0x66, 0x18, 0x70, 0x00, 0x60, 0x1A, 0x2F, 0x0A, 0x2F, 0x0C, 
-    0x2F, 0x0B, 0x20, 0x53, 0x20, 0x68, 0x00, 0x04, 0x4E, 0x90, 0x4A, 0x80, 0x67, 0x06, 0x24, 0x52, 
-    0x20, 0x0A, 0x66, 0xE8, 0x20, 0x0A, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 
-    0x80, 0x27, 0x4C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 
-    0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 
-    0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x76, 0x00, 0x24, 0x4B, 
-    0x58, 0x4A, 0x2D, 0x4A, 0xFF, 0xF8, 0x20, 0x4B, 0x50, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 0x60, 0x2E, 
-    0x20, 0x03, 0xE5, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 0xD0, 0x90, 0x20, 0x40, 0x24, 0x50, 0x60, 0x18, 
-    0x2F, 0x0A, 0x2F, 0x0C, 0x2F, 0x0B, 0x20, 0x53, 0x20, 0x68, 0x00, 0x08, 0x4E, 0x90, 0x4A, 0x80, 
-    0x66, 0x04, 0x20, 0x0A, 0x60, 0x14, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xE4, 0x52, 0x83, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x20, 0x10, 0xB0, 0x83, 0x6E, 0xC8, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x74, 0x00, 0x08, 0x80, 0x27, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5F, 0x5F, 0x31, 0x30, 
-    0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 
-    0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x6D, 0xEF, 0x76, 
-    0x26, 0x88, 0x17, 0x6E, 0x00, 0x0C, 0x00, 0x0C, 0x24, 0x4B, 0x58, 0x4A, 0x24, 0xAE, 0x00, 0x0E, 
-    0x20, 0x12, 0x76, 0x02, 0xE7, 0xA8, 0xA3, 0x1E, 0x27, 0x48, 0x00, 0x08, 0x20, 0x08, 0x66, 0x38, 
-    0x20, 0x12, 0xE7, 0xA8, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x72, 0x4E, 0xBA, 0x03, 0xD0, 0x50, 0x4F, 
-    0x48, 0x7A, 0x00, 0x60, 0x70, 0x45, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0xF6, 0x2F, 0x00, 0x48, 0x7A, 
-    0x00, 0x3E, 0x48, 0x6D, 0xF3, 0xA2, 0x4E, 0xAD, 0x02, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x01, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x1B, 0x26, 0x58, 0x4F, 0x20, 0x0B, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x74, 0x00, 0x0A, 0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 
-    0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x55, 0x63, 0x00, 0x00, 0x56, 0x23, 0x23, 
-    0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 0x0D, 
-    0x00, 0x00, 0x48, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x70, 0x00, 0x75, 0x6E, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x65, 0x6E, 0x6F, 
-    0x75, 0x67, 0x68, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x25, 0x6C, 0x64, 0x20, 
-    0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x42, 0x75, 0x63, 0x6B, 
-    0x65, 0x74, 0x73, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x2E, 0x00, 0x0C, 0xE0, 0x80, 0x20, 0x6E, 
-    0x00, 0x08, 0x22, 0x28, 0x00, 0x04, 0x53, 0x81, 0xC0, 0x81, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 
-    0x80, 0x25, 0x48, 0x61, 0x73, 0x68, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 
-    0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x70, 0x01, 0x4E, 0x74, 0x00, 0x0C, 
-    0x70, 0x01, 0x4E, 0x74, 0x00, 0x0C, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x30, 0x24, 0x6E, 
-    0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x2F, 0x0B, 0x2F, 0x0A, 0x20, 0x52, 0x20, 0x50, 0x4E, 0x90, 
-    0x28, 0x00, 0x26, 0x04, 0xE5, 0x83, 0x2D, 0x43, 0xFF, 0xFC, 0xD6, 0xAA, 0x00, 0x08, 0x20, 0x43, 
-    0x20, 0x10, 0x26, 0x80, 0x20, 0x2E, 0xFF, 0xFC, 0xD0, 0xAA, 0x00, 0x08, 0x20, 0x40, 0x20, 0x8B, 
-    0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x80, 0x24, 0x41, 0x64, 0x64, 0x5F, 
-    0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 
-    0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x50, 0x22, 0x51, 0x4E, 0x91, 0x28, 0x00, 
-    0x20, 0x04, 0xE5, 0x80, 0x20, 0x6E, 0x00, 0x08, 0xD0, 0xA8, 0x00, 0x08, 0x20, 0x40, 0x4A, 0x90, 
-    0x66, 0x02, 0xA9, 0xFF, 0x26, 0x04, 0xE5, 0x83, 0x20, 0x6E, 0x00, 0x08, 0xD6, 0xA8, 0x00, 0x08, 
-    0x24, 0x43, 0x20, 0x52, 0xB1, 0xCC, 0x66, 0x06, 0x20, 0x14, 0x24, 0x80, 0x60, 0x2A, 0x20, 0x04, 
-    0xE5, 0x80, 0x20, 0x6E, 0x00, 0x08, 0xD0, 0xA8, 0x00, 0x08, 0x20, 0x40, 0x26, 0x50, 0x24, 0x53, 
-    0x60, 0x08, 0xB5, 0xCC, 0x67, 0x08, 0x26, 0x4A, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xF4, 0x20, 0x0A, 
-    0x67, 0x02, 0xA9, 0xFF, 0x20, 0x14, 0x26, 0x80, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x08, 0x80, 0x27, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 
-    0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 
-    0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x76, 0x00, 
-    0x26, 0x83, 0x27, 0x43, 0x00, 0x04, 0x27, 0x4C, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x04, 0x29, 0x4B, 
-    0x00, 0x04, 0x2F, 0x2E, 0x00, 0x10, 0x4E, 0xBA, 0xFC, 0x32, 0x27, 0x40, 0x00, 0x14, 0x70, 0xFF, 
-    0x27, 0x40, 0x00, 0x0C, 0x70, 0xFF, 0x37, 0x40, 0x00, 0x10, 0x42, 0x40, 0x37, 0x40, 0x00, 0x12, 
-    0x20, 0x0B, 0x4C, 0xDF, 0x18, 0x08, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x0C, 0x9A, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x37, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x46, 0x50, 0x63, 0x50, 0x37, 
-    0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE8, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xE8, 0x2F, 0x2E, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x50, 0x20, 0x68, 0x00, 0x14, 0x4E, 0x90, 0x4E, 0x5E, 
-    0x4E, 0x74, 0x00, 0x08, 0x97, 0x46, 0x69, 0x6E, 0x64, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x20, 0x6E, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x14, 0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 
-    0x00, 0x14, 0x4E, 0xAD, 0x01, 0xEA, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x0C, 0x80, 0x2C, 0x43, 0x6F, 
-    0x6D, 0x70, 0x61, 0x72, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 
-    0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x18, 0x20, 0x76, 0x00, 0x78, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x24, 0x68, 0x00, 0x14, 
-    0x60, 0x1C, 0x10, 0x12, 0x49, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xCA, 0x58, 0x4F, 0x22, 0x03, 
-    0x4C, 0x3C, 0x18, 0x01, 0x00, 0x00, 0x00, 0x25, 0xD0, 0x81, 0x26, 0x00, 0x52, 0x4A, 0x4A, 0x12, 
-    0x67, 0x08, 0x20, 0x04, 0x53, 0x84, 0x4A, 0x80, 0x66, 0xD8, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x28, 
-    0x00, 0x04, 0x53, 0x80, 0xC0, 0x83, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 
-    0x80, 0x27, 0x48, 0x61, 0x73, 0x68, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x42, 0x27, 0x2F, 0x0A, 0x4E, 0xBA, 
-    0xFC, 0x20, 0x20, 0x6D, 0xEF, 0x7A, 0x24, 0x88, 0x20, 0x0A, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x74, 
-    0x00, 0x08, 0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 
-    0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0x6E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 0xEF, 0x7E, 0x4E, 0xAD, 0x02, 0x4A, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x44, 0x62, 0x67, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x50, 0x72, 
-    0x69, 0x6E, 0x74, 0x53, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x5F, 0x44, 0x50, 0x63, 0x65, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x6D, 0xEF, 0x7E, 
-    0x48, 0x7A, 0x00, 0x2E, 0x48, 0x6D, 0xF0, 0x7E, 0x4E, 0xAD, 0x02, 0x42, 0x4F, 0xEF, 0x00, 0x14, 
-    0x48, 0x6D, 0xF0, 0x7E, 0x4E, 0xBA, 0x1B, 0x80, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x08, 0x8E, 0x44, 
-    0x62, 0x67, 0x53, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x1A, 
-    0x25, 0x73, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x2D, 
-    0x2D, 0x20, 0x4C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x64, 0x00, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 
-    0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 
-    0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x20, 0x26, 0x2E, 0x00, 0x08, 0x4A, 0x83, 0x66, 0x0A, 0x76, 0x02, 0x60, 0x06, 0x20, 0x6D, 
-    0xF2, 0x7E, 0x4E, 0x90, 0x2F, 0x03, 0x4E, 0xAD, 0x01, 0xD2, 0x58, 0x4F, 0x24, 0x40, 0x20, 0x0A, 
-    0x66, 0x06, 0x20, 0x2D, 0xF2, 0x7E, 0x66, 0xE6, 0x20, 0x0A, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 
-    0x20, 0x5F, 0x58, 0x4F, 0x4E, 0xD0, 0x89, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x46, 0x55, 0x69, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x28, 0x20, 0x2D, 0xF2, 0xB4, 0x66, 0x00, 
-    0x00, 0x86, 0x42, 0xA7, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 0x00, 0xF8, 0xA8, 0x20, 
-    0x28, 0x5F, 0x20, 0x0C, 0x67, 0x70, 0x42, 0x67, 0x2F, 0x0C, 0xA9, 0xA4, 0x3B, 0x5F, 0xF2, 0xB2, 
-    0x41, 0xFA, 0x00, 0x6C, 0x22, 0x6D, 0xF2, 0xAE, 0x22, 0x69, 0x00, 0x16, 0x23, 0x48, 0x00, 0x0C, 
-    0x24, 0x54, 0x78, 0x04, 0x0C, 0x52, 0xFF, 0xFF, 0x67, 0x06, 0x0C, 0x52, 0xFF, 0xFD, 0x66, 0x06, 
-    0x06, 0x84, 0x00, 0x00, 0x00, 0x24, 0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xBA, 0x19, 0xE6, 0x26, 0x1F, 
-    0x96, 0x84, 0xE4, 0x83, 0x2B, 0x43, 0xF2, 0xB4, 0x4A, 0x83, 0x67, 0x26, 0x2F, 0x0C, 0xA9, 0xA2, 
-    0x24, 0x54, 0xD5, 0xC4, 0x58, 0x44, 0x30, 0x12, 0x0C, 0x40, 0x4E, 0xAD, 0x66, 0x0A, 0x30, 0x2A, 
-    0x00, 0x02, 0x4E, 0xB5, 0x00, 0x00, 0x60, 0x06, 0x0C, 0x52, 0x41, 0xED, 0x66, 0x04, 0x53, 0x83, 
-    0x60, 0xD6, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xDF, 0x14, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x18, 0x28, 0x30, 0x2D, 0xF2, 0xB2, 0x67, 0x60, 0x3F, 0x00, 0xA9, 0x98, 
-    0x42, 0xA7, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 0x00, 0x5A, 0xA8, 0x20, 0x28, 0x5F, 
-    0x20, 0x0C, 0x67, 0x48, 0x24, 0x54, 0x78, 0x04, 0x0C, 0x52, 0xFF, 0xFF, 0x67, 0x06, 0x0C, 0x52, 
-    0xFF, 0xFD, 0x66, 0x06, 0x06, 0x84, 0x00, 0x00, 0x00, 0x24, 0x26, 0x2D, 0xF2, 0xB4, 0x20, 0x03, 
-    0xE5, 0x80, 0xD8, 0x80, 0x52, 0x43, 0x4A, 0x83, 0x67, 0x1E, 0x2F, 0x0C, 0xA9, 0xA2, 0x24, 0x54, 
-    0xD5, 0xC4, 0x59, 0x44, 0x30, 0x12, 0x0C, 0x40, 0x41, 0xED, 0x66, 0x08, 0x30, 0x2A, 0x00, 0x02, 
-    0x4E, 0xB5, 0x00, 0x00, 0x53, 0x83, 0x60, 0xDE, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xDF, 0x14, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 
-    0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-    0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x00, 0x4E, 0x56, 
-    0xFF, 0x78, 0x48, 0xE7, 0x18, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x55, 0x4F, 0x3F, 0x3C, 0xA1, 0xAD, 
-    0x4E, 0xBA, 0x04, 0x7E, 0x10, 0x1F, 0x67, 0x50, 0x55, 0x4F, 0x2F, 0x3C, 0x73, 0x79, 0x73, 0x76, 
-    0x48, 0x6E, 0xFF, 0x78, 0x4E, 0xBA, 0x16, 0xC0, 0x38, 0x1F, 0x66, 0x3C, 0x0C, 0x6E, 0x07, 0x00, 
-    0xFF, 0x7A, 0x65, 0x34, 0x70, 0x3C, 0x2D, 0x40, 0xFF, 0x84, 0x2D, 0x4A, 0xFF, 0x88, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xBC, 0x55, 0x4F, 0x48, 0x6E, 0xFF, 0x7C, 0x3F, 0x3C, 0x00, 0x37, 0xA8, 0x8F, 
-    0x38, 0x1F, 0x66, 0x18, 0x55, 0x4F, 0x48, 0x6E, 0xFF, 0x7C, 0x48, 0x6E, 0xFF, 0x84, 0x3F, 0x3C, 
-    0x00, 0x3A, 0xA8, 0x8F, 0x38, 0x1F, 0x60, 0x04, 0x38, 0x3C, 0xFD, 0xA8, 0x4A, 0x44, 0x67, 0x28, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xCC, 0x2D, 0x4A, 0xFF, 0xD2, 0x42, 0x43, 0x3D, 0x43, 0xFF, 0xD6, 
-    0x55, 0x4F, 0xA9, 0x94, 0x30, 0x1F, 0x3D, 0x40, 0xFF, 0xD8, 0x3D, 0x43, 0xFF, 0xDC, 0x41, 0xEE, 
-    0xFF, 0xC0, 0x70, 0x08, 0xA2, 0x60, 0x38, 0x00, 0x4A, 0x44, 0x67, 0x2E, 0x20, 0x7C, 0x00, 0x00, 
-    0x09, 0x10, 0x10, 0x10, 0x76, 0x00, 0x16, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x20, 0x63, 0x02, 
-    0x76, 0x20, 0x20, 0x03, 0x52, 0x80, 0x2F, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x09, 0x10, 0x2F, 0x0A, 
-    0x4E, 0xBA, 0x02, 0xE6, 0x4F, 0xEF, 0x00, 0x0C, 0x42, 0x44, 0x30, 0x04, 0x4C, 0xDF, 0x04, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x47, 0x65, 0x74, 0x41, 0x70, 0x70, 0x4E, 0x61, 0x6D, 0x65, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x26, 0x6E, 0x00, 0x10, 0x28, 0x6E, 
-    0x00, 0x14, 0x55, 0x4F, 0x3F, 0x3C, 0xA1, 0xAD, 0x4E, 0xBA, 0x03, 0x96, 0x10, 0x1F, 0x20, 0x6E, 
-    0x00, 0x08, 0x10, 0x80, 0x20, 0x7C, 0x00, 0x00, 0x03, 0x16, 0x20, 0x10, 0x2B, 0x40, 0xF2, 0xEA, 
-    0x4A, 0x80, 0x57, 0xC0, 0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2B, 0x40, 0xF2, 0xE6, 0x4A, 0x80, 
-    0x66, 0x2E, 0x30, 0x2D, 0xF2, 0xEC, 0x72, 0x01, 0xC0, 0x41, 0x66, 0x1E, 0x20, 0x6D, 0xF2, 0xEA, 
-    0x20, 0x10, 0x0C, 0x80, 0x4D, 0x50, 0x47, 0x4D, 0x66, 0x10, 0x24, 0x68, 0x00, 0x04, 0x20, 0x0A, 
-    0x67, 0x08, 0x4A, 0x52, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x2B, 0x40, 0xF2, 0xE6, 
-    0x20, 0x2D, 0xF2, 0xE6, 0x67, 0x3A, 0x70, 0x00, 0x2B, 0x40, 0xF2, 0xEA, 0x20, 0x0B, 0x67, 0x04, 
-    0x70, 0x01, 0x26, 0x80, 0x48, 0x6D, 0xF2, 0xC4, 0x4E, 0xBA, 0xFE, 0x94, 0x58, 0x4F, 0x41, 0xED, 
-    0xF2, 0xC4, 0x2B, 0x48, 0xF2, 0xB8, 0x20, 0x0C, 0x67, 0x06, 0x41, 0xED, 0xF2, 0xB8, 0x28, 0x88, 
-    0x20, 0x2E, 0x00, 0x18, 0x67, 0x5E, 0x70, 0x00, 0x20, 0x6E, 0x00, 0x18, 0x20, 0x80, 0x60, 0x54, 
-    0x20, 0x6D, 0xF2, 0xEA, 0x20, 0x68, 0x00, 0x04, 0x30, 0x10, 0x0C, 0x40, 0x53, 0x48, 0x67, 0x08, 
-    0x20, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x60, 0x4C, 0x20, 0x0B, 0x67, 0x0E, 0x20, 0x6D, 0xF2, 0xEA, 
-    0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x02, 0x26, 0x80, 0x20, 0x0C, 0x67, 0x0E, 0x20, 0x6D, 
-    0xF2, 0xEA, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x06, 0x28, 0x80, 0x20, 0x2E, 0x00, 0x18, 
-    0x67, 0x12, 0x20, 0x6D, 0xF2, 0xEA, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x0A, 0x20, 0x6E, 
-    0x00, 0x18, 0x20, 0x80, 0x20, 0x2E, 0x00, 0x0C, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0xAD, 
-    0xF2, 0xE6, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x47, 0x65, 
-    0x74, 0x50, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x73, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x30, 0x4E, 0xAD, 0x02, 0x92, 0x4A, 0x80, 
-    0x66, 0x00, 0x00, 0xC8, 0x26, 0x2E, 0x00, 0x08, 0x2B, 0x43, 0xF3, 0x2E, 0x20, 0x6D, 0xF3, 0x54, 
-    0x20, 0x83, 0x48, 0x6D, 0xF3, 0x3A, 0x48, 0x6D, 0xF3, 0x36, 0x48, 0x6D, 0xF3, 0x32, 0x48, 0x6D, 
-    0xF2, 0xE6, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0xFE, 0x9A, 0x4F, 0xEF, 0x00, 0x14, 0x38, 0x00, 
-    0x66, 0x00, 0x00, 0x98, 0x55, 0x4F, 0x42, 0xA7, 0x4E, 0xBA, 0x06, 0x48, 0x38, 0x1F, 0x66, 0x00, 
-    0x00, 0x8A, 0x20, 0x2D, 0xF2, 0xE6, 0x67, 0x16, 0x20, 0x2E, 0x00, 0x18, 0x66, 0x44, 0x59, 0x4F, 
-    0x20, 0x6D, 0xF3, 0x36, 0x2F, 0x10, 0x4E, 0xBA, 0x17, 0x92, 0x58, 0x4F, 0x60, 0x34, 0x20, 0x2E, 
-    0x00, 0x18, 0x67, 0x2E, 0x26, 0x6D, 0xF3, 0x36, 0x60, 0x0C, 0x59, 0x4F, 0x2F, 0x13, 0x4E, 0xBA, 
-    0x17, 0x44, 0x58, 0x4F, 0x58, 0x4B, 0x4A, 0x93, 0x66, 0xF0, 0x26, 0x6D, 0xF3, 0x3A, 0x60, 0x0C, 
-    0x59, 0x4F, 0x2F, 0x0A, 0x4E, 0xBA, 0x17, 0x2E, 0x58, 0x4F, 0x58, 0x4B, 0x24, 0x53, 0x20, 0x0A, 
-    0x66, 0xEE, 0x20, 0x2E, 0x00, 0x0C, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0xAD, 0xF3, 0x32, 
-    0x20, 0x2E, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0xAD, 0xF3, 0x36, 0x20, 0x2E, 
-    0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 0xF3, 0x3A, 0x48, 0x6D, 0xF2, 0xEE, 
-    0x4E, 0xBA, 0x04, 0x36, 0x58, 0x4F, 0x4A, 0x80, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x0E, 0x4E, 0xBA, 
-    0xFB, 0xD2, 0x70, 0x00, 0x2B, 0x40, 0xF3, 0x06, 0x20, 0x2D, 0xF2, 0xE6, 0x4C, 0xDF, 0x0C, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x49, 0x6E, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xC0, 0x20, 0x2D, 0xF2, 0xE6, 0x66, 0x16, 0x20, 0x2E, 0x00, 0x08, 0x02, 0x80, 0x00, 0xFF, 
-    0xFF, 0xFF, 0x20, 0x6D, 0xF2, 0xEA, 0x20, 0x68, 0x00, 0x04, 0x21, 0x40, 0x00, 0x0E, 0x70, 0x40, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF2, 0xEE, 0x48, 0x6E, 0xFF, 0xC0, 0x4E, 0xBA, 0x00, 0x6C, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4E, 0xBA, 0x06, 0x24, 0x20, 0x2E, 0xFF, 0xD8, 0x66, 0x0A, 0x20, 0x6D, 0xF3, 0x54, 
-    0x20, 0x50, 0x4E, 0x90, 0x60, 0x0E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xC0, 0x4E, 0xBA, 
-    0x03, 0xDE, 0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x45, 0x78, 0x69, 0x74, 
-    0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 0x10, 0x2F, 0x00, 0x0B, 0x22, 0x2F, 0x00, 0x0C, 0x44, 0xFC, 
-    0x00, 0x00, 0x60, 0x04, 0x48, 0x41, 0xB0, 0x18, 0x57, 0xC9, 0xFF, 0xFC, 0x67, 0x0A, 0x48, 0x41, 
-    0x51, 0xC9, 0xFF, 0xF2, 0x30, 0x7C, 0x00, 0x01, 0x20, 0x08, 0x53, 0x80, 0x4E, 0x75, 0x87, 0x5F, 
-    0x6D, 0x65, 0x6D, 0x63, 0x68, 0x72, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 
-    0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 
-    0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 
-    0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 
-    0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 
-    0x24, 0x1F, 0x4E, 0x75, 0x87, 0x5F, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x59, 0x4F, 0x3F, 0x3C, 0xA8, 0x6E, 0x76, 0x01, 0x1F, 0x03, 
-    0x4E, 0xBA, 0x14, 0xFE, 0x20, 0x5F, 0x24, 0x48, 0x59, 0x4F, 0x3F, 0x3C, 0xAA, 0x6E, 0x1F, 0x03, 
-    0x4E, 0xBA, 0x14, 0xEE, 0x22, 0x5F, 0x20, 0x4A, 0xB1, 0xC9, 0x66, 0x0A, 0x30, 0x3C, 0x02, 0x00, 
-    0x3D, 0x40, 0x00, 0x08, 0x60, 0x08, 0x30, 0x3C, 0x04, 0x00, 0x3D, 0x40, 0x00, 0x08, 0x4C, 0xDF, 
-    0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x4E, 0x55, 0x4D, 0x54, 0x4F, 0x4F, 0x4C, 
-    0x42, 0x4F, 0x58, 0x54, 0x52, 0x41, 0x50, 0x53, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x30, 0x2E, 
-    0x00, 0x08, 0x02, 0x40, 0x08, 0x00, 0x4A, 0x40, 0x6F, 0x08, 0x70, 0x01, 0x1D, 0x40, 0x00, 0x0A, 
-    0x60, 0x06, 0x42, 0x00, 0x1D, 0x40, 0x00, 0x0A, 0x4E, 0x5E, 0x20, 0x5F, 0x54, 0x4F, 0x4E, 0xD0, 
-    0x8D, 0x5F, 0x5F, 0x47, 0x45, 0x54, 0x54, 0x52, 0x41, 0x50, 0x54, 0x59, 0x50, 0x45, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x20, 0x36, 0x2E, 0x00, 0x08, 0x55, 0x4F, 0x3F, 0x03, 
-    0x4E, 0xBA, 0xFF, 0xB8, 0x10, 0x1F, 0x1D, 0x40, 0xFF, 0xFC, 0x72, 0x01, 0xB0, 0x01, 0x66, 0x14, 
-    0x02, 0x43, 0x07, 0xFF, 0x55, 0x4F, 0x4E, 0xBA, 0xFF, 0x46, 0x30, 0x1F, 0xB0, 0x43, 0x6E, 0x04, 
-    0x36, 0x3C, 0xA8, 0x9F, 0x59, 0x4F, 0x3F, 0x03, 0x1F, 0x2E, 0xFF, 0xFC, 0x4E, 0xBA, 0x14, 0x42, 
-    0x20, 0x5F, 0x24, 0x48, 0x59, 0x4F, 0x3F, 0x3C, 0xA8, 0x9F, 0x70, 0x01, 0x1F, 0x00, 0x4E, 0xBA, 
-    0x14, 0x30, 0x22, 0x5F, 0x20, 0x4A, 0xB1, 0xC9, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 
-    0x20, 0x00, 0x1D, 0x40, 0x00, 0x0A, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x20, 0x5F, 0x54, 0x4F, 
-    0x4E, 0xD0, 0x8D, 0x54, 0x52, 0x41, 0x50, 0x41, 0x56, 0x41, 0x49, 0x4C, 0x41, 0x42, 0x4C, 0x45, 
-    0x00, 0x00, 0x20, 0x5F, 0x4E, 0x56, 0x00, 0x00, 0x2B, 0x48, 0xF3, 0x2E, 0x20, 0x0F, 0x72, 0xF8, 
-    0xC0, 0x81, 0x2E, 0x40, 0x4E, 0xBA, 0x00, 0x12, 0x20, 0x6D, 0xF3, 0x2E, 0x4E, 0x5E, 0x4E, 0xD0, 
-    0x87, 0x25, 0x5F, 0x5F, 0x4D, 0x41, 0x49, 0x4E, 0x2F, 0x03, 0x42, 0xA7, 0x42, 0xA7, 0x42, 0xA7, 
-    0x42, 0xA7, 0x2F, 0x2D, 0xF3, 0x2E, 0x4E, 0xBA, 0xFC, 0xCA, 0x4F, 0xEF, 0x00, 0x14, 0x72, 0xFF, 
-    0xB0, 0x81, 0x66, 0x0C, 0x48, 0x7A, 0x00, 0x3C, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x60, 0x2C, 
-    0x48, 0x6D, 0xF2, 0xEE, 0x4E, 0xBA, 0x01, 0xB2, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x1E, 0x2F, 0x2D, 
-    0xF3, 0x3A, 0x2F, 0x2D, 0xF3, 0x36, 0x2F, 0x2D, 0xF3, 0x32, 0x4E, 0xBA, 0xEB, 0xD2, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x26, 0x00, 0x2F, 0x03, 0x4E, 0xBA, 0xFD, 0x86, 0x58, 0x4F, 0x26, 0x1F, 0x4E, 0x75, 
-    0x00, 0x1E, 0x1B, 0x44, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 
-    0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x21, 0x00, 0x00, 
-    0x20, 0x2F, 0x00, 0x04, 0x22, 0x2F, 0x00, 0x08, 0x2F, 0x00, 0xC0, 0xC1, 0x20, 0x40, 0x20, 0x01, 
-    0xC2, 0xDF, 0x42, 0x40, 0x48, 0x40, 0x67, 0x02, 0xC0, 0xD7, 0x54, 0x8F, 0xD0, 0x41, 0x48, 0x40, 
-    0x42, 0x40, 0xD0, 0x88, 0x4E, 0x75, 0x86, 0x06, 0x55, 0x4C, 0x4D, 0x55, 0x4C, 0x54, 0x00, 0x00, 
-    0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 
-    0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x08, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x5C, 
-    0x20, 0x01, 0x4E, 0x75, 0x85, 0x05, 0x4C, 0x44, 0x49, 0x56, 0x54, 0x00, 0x00, 0x00, 0x22, 0x2F, 
-    0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 
-    0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x00, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x88, 0x20, 0x01, 
-    0x4E, 0x75, 0x86, 0x06, 0x55, 0x4C, 0x44, 0x49, 0x56, 0x54, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 
-    0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 
-    0x60, 0x08, 0x4C, 0x41, 0x08, 0x01, 0xC3, 0x40, 0x4E, 0x75, 0x4A, 0x80, 0x6B, 0x14, 0x4A, 0x81, 
-    0x6B, 0x06, 0x4E, 0xBA, 0x00, 0x50, 0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x48, 0x44, 0x81, 
-    0x4E, 0x75, 0x44, 0x80, 0x4A, 0x81, 0x6B, 0x0A, 0x4E, 0xBA, 0x00, 0x3A, 0x44, 0x80, 0x44, 0x81, 
-    0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x2E, 0x44, 0x80, 0x4E, 0x75, 0x85, 0x05, 0x4C, 0x4D, 
-    0x4F, 0x44, 0x54, 0x00, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 
-    0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x00, 0x01, 
-    0xC3, 0x40, 0x4E, 0x75, 0x3F, 0x01, 0x48, 0x41, 0x4A, 0x41, 0x66, 0x1C, 0x22, 0x00, 0x42, 0x41, 
-    0x48, 0x41, 0x67, 0x0A, 0x82, 0xD7, 0x48, 0x41, 0x48, 0x40, 0x30, 0x01, 0x48, 0x40, 0x80, 0xDF, 
-    0x32, 0x00, 0x42, 0x40, 0x48, 0x40, 0x4E, 0x75, 0x48, 0x41, 0x3E, 0x82, 0x2F, 0x03, 0x34, 0x00, 
-    0x26, 0x01, 0x72, 0x01, 0x42, 0x40, 0x48, 0x40, 0x66, 0x0C, 0x48, 0x40, 0x30, 0x02, 0x72, 0x00, 
-    0x60, 0x16, 0xD2, 0x41, 0x65, 0x12, 0xD4, 0x42, 0xD1, 0x80, 0xB0, 0x83, 0x65, 0xF4, 0x90, 0x83, 
-    0xD2, 0x41, 0x08, 0xC1, 0x00, 0x00, 0x64, 0xEE, 0x26, 0x1F, 0x34, 0x1F, 0x4E, 0x75, 0x86, 0x06, 
-    0x55, 0x4C, 0x4D, 0x4F, 0x44, 0x54, 0x00, 0x00, 0x22, 0x5F, 0x20, 0x57, 0x21, 0x7C, 0xFF, 0x16, 
-    0xB0, 0xBF, 0x00, 0x30, 0x21, 0x4D, 0x00, 0x34, 0x48, 0xD0, 0xDE, 0xFC, 0x70, 0x00, 0x4E, 0xD1, 
-    0x4E, 0x75, 0x88, 0x08, 0x5F, 0x5F, 0x73, 0x65, 0x74, 0x6A, 0x6D, 0x70, 0x00, 0x00, 0x20, 0x2F, 
-    0x00, 0x08, 0x66, 0x02, 0x70, 0x01, 0x20, 0x6F, 0x00, 0x04, 0x22, 0x28, 0x00, 0x30, 0x0C, 0x81, 
-    0xFF, 0xD0, 0x68, 0xCF, 0x67, 0x08, 0x0C, 0x81, 0xFF, 0x16, 0xB0, 0xBF, 0x66, 0x04, 0x2A, 0x68, 
-    0x00, 0x34, 0x4C, 0xD0, 0xDE, 0xFC, 0x4E, 0xD1, 0x4E, 0x75, 0x87, 0x07, 0x6C, 0x6F, 0x6E, 0x67, 
-    0x6A, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x26, 0x2E, 
-    0x00, 0x08, 0xE5, 0x83, 0xD6, 0xAD, 0xF3, 0x54, 0x24, 0x43, 0x4A, 0x92, 0x66, 0x08, 0x24, 0xAE, 
-    0x00, 0x0C, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x93, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x4C, 0x69, 0x62, 0x45, 0x78, 0x69, 0x74, 
-    0x50, 0x72, 0x6F, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0B, 0x26, 0x6D, 0xF3, 0x54, 
-    0x70, 0x10, 0xD7, 0xC0, 0x60, 0x0E, 0x4A, 0x93, 0x66, 0x08, 0x26, 0xAE, 0x00, 0x08, 0x70, 0x00, 
-    0x60, 0x10, 0x58, 0x4B, 0x20, 0x6D, 0xF3, 0x54, 0x41, 0xE8, 0x00, 0xB0, 0xB1, 0xCB, 0x62, 0xE6, 
-    0x70, 0x01, 0x26, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x61, 0x74, 0x65, 0x78, 0x69, 0x74, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x28, 0x20, 0x2D, 0xF3, 0x54, 0x67, 0x2E, 
-    0x20, 0x2E, 0x00, 0x08, 0x76, 0x02, 0xE7, 0xA0, 0xD0, 0xAD, 0xF3, 0x54, 0x28, 0x40, 0x28, 0x2E, 
-    0x00, 0x0C, 0xE7, 0xA4, 0x60, 0x0E, 0x24, 0x54, 0x20, 0x0A, 0x67, 0x06, 0x4E, 0x92, 0x70, 0x00, 
-    0x28, 0x80, 0x59, 0x4C, 0x20, 0x6D, 0xF3, 0x54, 0xD1, 0xC4, 0xB1, 0xCC, 0x63, 0xE8, 0x4C, 0xDF, 
-    0x14, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x5F, 0x44, 0x6F, 0x45, 0x78, 0x69, 0x74, 0x50, 0x72, 
-    0x6F, 0x63, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x38, 0x2C, 0x2E, 
-    0x00, 0x0C, 0xE4, 0x8E, 0x7E, 0x00, 0x24, 0x6E, 0x00, 0x08, 0x60, 0x08, 0x70, 0x00, 0x24, 0x80, 
-    0x58, 0x4A, 0x52, 0x87, 0xBE, 0x86, 0x6D, 0xF4, 0x26, 0x06, 0x78, 0x02, 0xE9, 0xAB, 0x2A, 0x2E, 
-    0x00, 0x0C, 0xB6, 0x85, 0x67, 0x1C, 0x20, 0x2E, 0x00, 0x08, 0xD0, 0x87, 0xE9, 0xA0, 0x24, 0x40, 
-    0x26, 0x4A, 0x9A, 0x83, 0xDA, 0x8A, 0x28, 0x45, 0x60, 0x04, 0x42, 0x13, 0x52, 0x4B, 0xB9, 0xCB, 
-    0x62, 0xF8, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x5F, 0x7A, 0x65, 0x72, 0x6F, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x20, 0x48, 0x6D, 0xF3, 0x48, 0x48, 0x6D, 
-    0xF3, 0x44, 0x48, 0x6D, 0xF3, 0x40, 0x48, 0x6D, 0xF3, 0x72, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 
-    0xF8, 0x22, 0x4F, 0xEF, 0x00, 0x14, 0x36, 0x00, 0x66, 0x44, 0x20, 0x2D, 0xF2, 0xEA, 0x67, 0x78, 
-    0x20, 0x6D, 0xF2, 0xEA, 0x24, 0x68, 0x00, 0x04, 0x20, 0x0A, 0x67, 0x32, 0x30, 0x12, 0xB0, 0x6D, 
-    0xF3, 0x3E, 0x66, 0x2A, 0x41, 0xED, 0xF3, 0x3E, 0x25, 0x48, 0x00, 0x24, 0x24, 0x6D, 0xF2, 0xEA, 
-    0x20, 0x2A, 0x00, 0x04, 0x2B, 0x40, 0xF3, 0x62, 0x20, 0x6A, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x20, 
-    0x67, 0x46, 0x70, 0x78, 0xA1, 0x1E, 0x2B, 0x48, 0xF3, 0x5E, 0x20, 0x08, 0x66, 0x0A, 0x30, 0x3C, 
-    0xF4, 0xFB, 0x3D, 0x40, 0x00, 0x0C, 0x60, 0x36, 0x20, 0x6D, 0xF2, 0xEA, 0x20, 0x68, 0x00, 0x04, 
-    0x24, 0x68, 0x00, 0x20, 0x78, 0x00, 0x60, 0x18, 0x20, 0x4A, 0x20, 0x04, 0xD0, 0xAD, 0xF3, 0x5E, 
-    0x22, 0x40, 0x70, 0x05, 0x22, 0xD8, 0x51, 0xC8, 0xFF, 0xFC, 0x76, 0x18, 0xD5, 0xC3, 0xD8, 0x83, 
-    0x0C, 0x84, 0x00, 0x00, 0x00, 0x78, 0x65, 0xE0, 0x42, 0x40, 0x3D, 0x40, 0x00, 0x0C, 0x4C, 0xDF, 
-    0x04, 0x18, 0x4E, 0x5E, 0x20, 0x5F, 0x58, 0x4F, 0x4E, 0xD0, 0x8B, 0x5F, 0x49, 0x4E, 0x54, 0x45, 
-    0x4E, 0x56, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xF2, 0xEE, 
-    0x4E, 0xBA, 0xFD, 0xA6, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x2E, 0x70, 0x01, 0x2F, 0x00, 0x70, 0x2B, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0x6E, 0x50, 0x4F, 0x20, 0x2D, 0xF3, 0x72, 0x66, 0x0C, 0x20, 0x2D, 
-    0xF3, 0x5E, 0x67, 0x06, 0x20, 0x6D, 0xF3, 0x5E, 0xA0, 0x1F, 0x70, 0x40, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF2, 0xEE, 0x4E, 0xBA, 0xFE, 0xA2, 0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x49, 0x4E, 
-    0x54, 0x45, 0x4E, 0x56, 0x54, 0x45, 0x52, 0x4D, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x18, 0x10, 0x76, 0xFF, 0x2D, 0x43, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x02, 0xE4, 
-    0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x04, 0x20, 0x03, 0x60, 0x46, 0x30, 0x2E, 0x00, 0x0E, 
-    0x52, 0x40, 0x36, 0x80, 0x42, 0x43, 0x37, 0x43, 0x00, 0x02, 0x70, 0x00, 0x27, 0x40, 0x00, 0x04, 
-    0x2F, 0x0B, 0x2F, 0x3C, 0x00, 0x00, 0x64, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF8, 
-    0x4E, 0xBA, 0x08, 0x02, 0x4F, 0xEF, 0x00, 0x10, 0x28, 0x00, 0x67, 0x06, 0x36, 0x83, 0x70, 0xFF, 
-    0x60, 0x10, 0x4A, 0xAB, 0x00, 0x04, 0x66, 0x06, 0x27, 0x6E, 0xFF, 0xF8, 0x00, 0x04, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xDF, 0x08, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6F, 0x70, 0x65, 0x6E, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x6A, 0x10, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x20, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x60, 0x3E, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0x58, 0x58, 0x4F, 0x24, 0x40, 
-    0x20, 0x0A, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2A, 0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 
-    0x00, 0x08, 0x4E, 0x90, 0x58, 0x4F, 0x26, 0x00, 0x42, 0x40, 0x34, 0x80, 0x4A, 0x83, 0x67, 0x10, 
-    0x3F, 0x2A, 0x00, 0x02, 0x2F, 0x03, 0x4E, 0xBA, 0x05, 0xE4, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x02, 
-    0x70, 0x00, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 0x6C, 0x6F, 0x73, 0x65, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x10, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x6B, 0x1C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x01, 0xF8, 0x58, 0x4F, 0x26, 0x40, 
-    0x20, 0x0B, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x30, 0x13, 0x72, 0x01, 0xC0, 0x41, 0x66, 0x10, 
-    0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x94, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x36, 
-    0x27, 0x6E, 0x00, 0x10, 0x00, 0x0C, 0x27, 0x6E, 0x00, 0x0C, 0x00, 0x10, 0x2F, 0x0B, 0x20, 0x6B, 
-    0x00, 0x04, 0x20, 0x68, 0x00, 0x0C, 0x4E, 0x90, 0x58, 0x4F, 0x26, 0x00, 0x67, 0x10, 0x3F, 0x2B, 
-    0x00, 0x02, 0x2F, 0x03, 0x4E, 0xBA, 0x05, 0x66, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x08, 0x20, 0x2E, 
-    0x00, 0x10, 0x90, 0xAB, 0x00, 0x0C, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x72, 
-    0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x10, 0x0C, 0xAE, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6B, 0x1C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x01, 0x74, 
-    0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x30, 0x13, 0x72, 0x02, 
-    0xC0, 0x41, 0x66, 0x10, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x10, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x60, 0x36, 0x27, 0x6E, 0x00, 0x10, 0x00, 0x0C, 0x27, 0x6E, 0x00, 0x0C, 0x00, 0x10, 
-    0x2F, 0x0B, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x68, 0x00, 0x10, 0x4E, 0x90, 0x58, 0x4F, 0x26, 0x00, 
-    0x67, 0x10, 0x3F, 0x2B, 0x00, 0x02, 0x2F, 0x03, 0x4E, 0xBA, 0x04, 0xE2, 0x5C, 0x4F, 0x70, 0xFF, 
-    0x60, 0x08, 0x20, 0x2E, 0x00, 0x10, 0x90, 0xAB, 0x00, 0x0C, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x10, 0x30, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6A, 0x12, 0x42, 0x67, 0x70, 0x09, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x04, 0xA8, 0x5C, 0x4F, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0xD6, 0x48, 0x6E, 
-    0x00, 0x08, 0x4E, 0xBA, 0x00, 0xDE, 0x58, 0x4F, 0x24, 0x40, 0x20, 0x0A, 0x67, 0x74, 0x20, 0x2E, 
-    0x00, 0x0C, 0x0C, 0x80, 0x00, 0x00, 0x66, 0x01, 0x67, 0x34, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x14, 0x4E, 0x90, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x26, 0x00, 0x66, 0x06, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0x98, 0x3F, 0x2A, 0x00, 0x02, 
-    0x2F, 0x03, 0x4E, 0xBA, 0x04, 0x58, 0x5C, 0x4F, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0x86, 0x0C, 0xAE, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6A, 0x10, 0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x04, 0x3C, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x6A, 0x76, 0xFF, 0x96, 0xAE, 0x00, 0x10, 0x2D, 0x43, 
-    0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x00, 0x6A, 0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x4C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0x56, 0x58, 0x4F, 
-    0x24, 0x40, 0x20, 0x4A, 0x22, 0x4B, 0x70, 0x04, 0x22, 0xD8, 0x51, 0xC8, 0xFF, 0xFC, 0x42, 0xA7, 
-    0x2F, 0x3C, 0x00, 0x00, 0x66, 0x01, 0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x14, 
-    0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x67, 0x14, 0x42, 0x40, 0x36, 0x80, 0x3F, 0x2A, 
-    0x00, 0x02, 0x2F, 0x03, 0x4E, 0xBA, 0x03, 0xD6, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x04, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x69, 0x6F, 0x63, 0x74, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x2D, 
-    0xF3, 0x58, 0x66, 0x04, 0x4E, 0xBA, 0x01, 0x5A, 0x38, 0x2D, 0xF3, 0x58, 0x42, 0x80, 0x30, 0x04, 
-    0x28, 0x00, 0x88, 0xFC, 0x00, 0x14, 0x48, 0xC4, 0x53, 0x84, 0x26, 0x14, 0x6B, 0x16, 0xB6, 0x84, 
-    0x6F, 0x2C, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0x82, 0x5C, 0x4F, 0x70, 0x00, 
-    0x4E, 0xFA, 0x01, 0x18, 0x70, 0xFF, 0x90, 0x94, 0xB0, 0x84, 0x6F, 0x12, 0x42, 0x67, 0x70, 0x16, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x03, 0x68, 0x5C, 0x4F, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xFE, 0x26, 0x14, 
-    0x6B, 0x32, 0x20, 0x03, 0xC6, 0xFC, 0x00, 0x14, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x40, 
-    0x42, 0x40, 0xD6, 0x80, 0xD6, 0xAD, 0xF3, 0x5A, 0x26, 0x43, 0x4A, 0x53, 0x66, 0x00, 0x00, 0xDA, 
-    0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0x34, 0x5C, 0x4F, 0x70, 0x00, 0x26, 0x40, 
-    0x60, 0x00, 0x00, 0xC6, 0x70, 0xFF, 0x90, 0x94, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 
-    0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAD, 0xF3, 0x5A, 0x26, 0x40, 
-    0x26, 0x04, 0x20, 0x03, 0xC6, 0xFC, 0x00, 0x14, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x40, 
-    0x42, 0x40, 0xD6, 0x80, 0x60, 0x08, 0x4A, 0x53, 0x67, 0x0E, 0x70, 0x14, 0xD7, 0xC0, 0x20, 0x6D, 
-    0xF3, 0x5A, 0xD1, 0xC3, 0xB1, 0xCB, 0x64, 0xEE, 0x20, 0x04, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x14, 
-    0x48, 0x41, 0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAD, 0xF3, 0x5A, 
-    0x20, 0x40, 0xB1, 0xCB, 0x64, 0x54, 0x30, 0x2D, 0xF3, 0x58, 0x48, 0xC0, 0x06, 0x80, 0x00, 0x00, 
-    0x01, 0x90, 0x2F, 0x00, 0x2F, 0x2D, 0xF3, 0x5A, 0x4E, 0xBA, 0x03, 0x28, 0x50, 0x4F, 0x24, 0x40, 
-    0x20, 0x0A, 0x66, 0x10, 0x42, 0x67, 0x70, 0x18, 0x2F, 0x00, 0x4E, 0xBA, 0x02, 0xA0, 0x5C, 0x4F, 
-    0x70, 0x00, 0x60, 0x36, 0x20, 0x04, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 0xC2, 0xFC, 
-    0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0x8A, 0x26, 0x40, 0x70, 0x14, 0xD7, 0xC0, 
-    0x06, 0x6D, 0x01, 0x90, 0xF3, 0x58, 0x2B, 0x4A, 0xF3, 0x5A, 0x20, 0x0B, 0x90, 0xAD, 0xF3, 0x5A, 
-    0x72, 0x14, 0x4E, 0xBA, 0xF7, 0xE4, 0x28, 0x80, 0x20, 0x0B, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8A, 0x5F, 0x67, 0x65, 0x74, 0x49, 0x4F, 0x50, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x10, 0x3B, 0x7C, 0x01, 0x90, 0xF3, 0x58, 0x2F, 0x3C, 0x00, 0x00, 0x01, 0x90, 
-    0x42, 0xA7, 0x4E, 0xBA, 0x02, 0xAE, 0x50, 0x4F, 0x2B, 0x40, 0xF3, 0x5A, 0x22, 0x2D, 0xF3, 0x62, 
-    0x67, 0x42, 0x20, 0x6D, 0xF3, 0x62, 0x20, 0x68, 0x00, 0x1C, 0x22, 0x40, 0x70, 0x3C, 0xA0, 0x2E, 
-    0x26, 0x6D, 0xF3, 0x5A, 0x60, 0x20, 0x4A, 0x53, 0x67, 0x18, 0x42, 0xA7, 0x2F, 0x3C, 0x00, 0x00, 
-    0x66, 0x01, 0x2F, 0x0B, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x68, 0x00, 0x14, 0x4E, 0x90, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x70, 0x14, 0xD7, 0xC0, 0x20, 0x6D, 0xF3, 0x5A, 0x70, 0x28, 0xD1, 0xC0, 0xB1, 0xCB, 
-    0x65, 0x28, 0x60, 0xD2, 0x42, 0xA7, 0x48, 0x7A, 0x00, 0x5A, 0x4E, 0xBA, 0xFB, 0x2E, 0x50, 0x4F, 
-    0x76, 0x01, 0x2F, 0x03, 0x48, 0x7A, 0x00, 0x40, 0x4E, 0xBA, 0xFB, 0x20, 0x50, 0x4F, 0x2F, 0x03, 
-    0x48, 0x7A, 0x00, 0x28, 0x4E, 0xBA, 0xFB, 0x14, 0x50, 0x4F, 0x48, 0x6D, 0x01, 0x6A, 0x70, 0x01, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xF8, 0xC2, 0x50, 0x4F, 0x20, 0x2D, 0xF3, 0x50, 0x66, 0x04, 0x4E, 0xBA, 
-    0x04, 0x4E, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x75, 0x00, 0x24, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 
-    0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 
-    0x65, 0x00, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x48, 0xE7, 
-    0x18, 0x00, 0x38, 0x2D, 0xF3, 0x58, 0x42, 0x80, 0x30, 0x04, 0x28, 0x00, 0x88, 0xFC, 0x00, 0x14, 
-    0x48, 0xC4, 0x53, 0x84, 0x76, 0x00, 0x60, 0x0A, 0x2F, 0x03, 0x4E, 0xBA, 0xFB, 0x26, 0x58, 0x4F, 
-    0x52, 0x83, 0xB6, 0x84, 0x6F, 0xF2, 0x20, 0x2D, 0xF3, 0x72, 0x67, 0x04, 0x4E, 0xBA, 0xEF, 0x46, 
-    0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x76, 0x00, 0x30, 0x2E, 
-    0x00, 0x08, 0x48, 0xC0, 0x67, 0x00, 0x01, 0x22, 0x72, 0xC4, 0xB0, 0x81, 0x67, 0x00, 0x01, 0x18, 
-    0x72, 0xDB, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xCC, 0x72, 0xDF, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xC8, 
-    0x72, 0xDE, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xC0, 0x72, 0xD0, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xBC, 
-    0x72, 0xD9, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xE0, 0x72, 0xC6, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xE8, 
-    0x72, 0xD1, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xA8, 0x72, 0xD3, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xCC, 
-    0x72, 0xD5, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x9C, 0x72, 0xDA, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xB0, 
-    0x72, 0xC5, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x90, 0x72, 0xDC, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x8C, 
-    0x72, 0x94, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x88, 0x72, 0xC8, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x98, 
-    0x72, 0xC7, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xA0, 0x72, 0xDD, 0xB0, 0x81, 0x67, 0x00, 0x00, 0x88, 
-    0x72, 0xCF, 0xB0, 0x81, 0x67, 0x6C, 0x72, 0xCE, 0xB0, 0x81, 0x67, 0x6A, 0x72, 0xCA, 0xB0, 0x81, 
-    0x67, 0x7C, 0x72, 0xD8, 0xB0, 0x81, 0x67, 0x62, 0x72, 0xCD, 0xB0, 0x81, 0x67, 0x60, 0x72, 0xD6, 
-    0xB0, 0x81, 0x67, 0x5E, 0x72, 0xCB, 0xB0, 0x81, 0x67, 0x5C, 0x72, 0xC9, 0xB0, 0x81, 0x67, 0x5A, 
-    0x72, 0xD2, 0xB0, 0x81, 0x67, 0x5C, 0x72, 0xC3, 0xB0, 0x81, 0x67, 0x52, 0x0C, 0x80, 0xFF, 0xFF, 
-    0xEC, 0x78, 0x67, 0x4A, 0x72, 0xD4, 0xB0, 0x81, 0x67, 0x48, 0x72, 0x88, 0xB0, 0x81, 0x67, 0x46, 
-    0x60, 0x46, 0x76, 0x0E, 0x60, 0x42, 0x76, 0x1C, 0x60, 0x3E, 0x76, 0x11, 0x60, 0x3A, 0x76, 0x1F, 
-    0x60, 0x36, 0x76, 0x02, 0x60, 0x32, 0x76, 0x04, 0x60, 0x2E, 0x76, 0x05, 0x60, 0x2A, 0x76, 0x0C, 
-    0x60, 0x26, 0x76, 0x1A, 0x60, 0x22, 0x76, 0x16, 0x60, 0x1E, 0x76, 0x1D, 0x60, 0x1A, 0x76, 0x09, 
-    0x60, 0x16, 0x76, 0x17, 0x60, 0x12, 0x76, 0x06, 0x60, 0x0E, 0x76, 0x10, 0x60, 0x0A, 0x76, 0x0D, 
-    0x60, 0x06, 0x76, 0x1E, 0x60, 0x02, 0x76, 0x14, 0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x89, 0x5F, 0x6D, 0x61, 0x70, 0x4F, 0x53, 0x65, 0x72, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x04, 0x38, 0x2E, 0x00, 0x0C, 0x3B, 0x44, 0xF6, 0xF6, 0x4A, 0x44, 0x66, 0x06, 0x20, 0x2E, 
-    0x00, 0x08, 0x60, 0x08, 0x3F, 0x04, 0x4E, 0xBA, 0xFE, 0x9E, 0x54, 0x4F, 0x2B, 0x40, 0xF6, 0xF2, 
-    0x28, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x75, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xF8, 0x2F, 0x03, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xF8, 0x2D, 0x6E, 0x00, 0x0C, 
-    0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xF8, 0x2F, 0x3C, 0x00, 0x00, 0x66, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x4E, 0xBA, 0xFA, 0xE8, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x66, 0x06, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x60, 0x02, 0x70, 0xFF, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x6C, 0x73, 0x65, 0x65, 0x6B, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x0C, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x78, 0x00, 0x20, 0x0A, 0x67, 0x18, 0x59, 0x4F, 0x2F, 0x0A, 0x4E, 0xBA, 0x07, 0xF6, 
-    0x28, 0x1F, 0xBA, 0x84, 0x6C, 0x0A, 0x20, 0x4A, 0x20, 0x05, 0xA0, 0x20, 0x20, 0x0A, 0x60, 0x40, 
-    0x20, 0x05, 0xA1, 0x1E, 0x2D, 0x48, 0xFF, 0xFC, 0x55, 0x4F, 0x3E, 0xB8, 0x02, 0x20, 0x30, 0x1F, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x2A, 0x20, 0x0A, 0x67, 0x0E, 0x20, 0x4A, 0x22, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x04, 0xA0, 0x2E, 0x20, 0x4A, 0xA0, 0x1F, 0x26, 0x6E, 0xFF, 0xFC, 0xD7, 0xC4, 0x28, 0x6E, 
-    0xFF, 0xFC, 0xD9, 0xC5, 0x60, 0x02, 0x42, 0x1B, 0xB7, 0xCC, 0x65, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x4C, 0xDF, 0x1C, 0x30, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x67, 0x72, 0x6F, 0x77, 0x46, 
-    0x69, 0x6C, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x08, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x28, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x26, 0x4C, 0x52, 0x4B, 
-    0x24, 0x6E, 0x00, 0x0C, 0x53, 0x84, 0x0C, 0x84, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x04, 0x16, 0xDA, 
-    0x66, 0xF2, 0x4A, 0x84, 0x6E, 0x04, 0x4A, 0x12, 0x66, 0x12, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0x90, 0x84, 0x2D, 0x40, 0xFF, 0xFC, 0x18, 0xAE, 0xFF, 0xFF, 0x60, 0x08, 0x42, 0x14, 0x70, 0xFF, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 0x1C, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8D, 0x5F, 0x5F, 0x53, 0x6D, 0x61, 0x72, 0x74, 0x43, 0x32, 0x50, 0x73, 0x74, 0x72, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x4B, 0x20, 0x0B, 
-    0x67, 0x06, 0x4A, 0x1A, 0x66, 0xFC, 0x53, 0x4A, 0x20, 0x0A, 0x90, 0x8B, 0x4C, 0xDF, 0x0C, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x5F, 0x6C, 0x69, 0x62, 0x5F, 0x43, 0x73, 0x74, 0x72, 0x6C, 
-    0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x0C, 
-    0x26, 0x2E, 0x00, 0x10, 0x20, 0x0C, 0x67, 0x14, 0x4A, 0x14, 0x67, 0x10, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFF, 0xB0, 0x58, 0x4F, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x63, 0x12, 0x42, 0x67, 0x70, 0x16, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0x38, 0x5C, 0x4F, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0xBE, 0x20, 0x2D, 
-    0xF3, 0x5E, 0x66, 0x08, 0x41, 0xED, 0xF6, 0xF8, 0x2B, 0x48, 0xF3, 0x5E, 0x26, 0x6D, 0xF3, 0x5E, 
-    0x58, 0x4B, 0x60, 0x08, 0x4A, 0x93, 0x67, 0x10, 0x70, 0x18, 0xD7, 0xC0, 0x20, 0x6D, 0xF3, 0x5E, 
-    0x70, 0x7C, 0xD1, 0xC0, 0xB1, 0xCB, 0x62, 0xEC, 0x20, 0x4B, 0x59, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 
-    0x2D, 0x7C, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x24, 0x48, 0x58, 0x4A, 0x70, 0x18, 0x95, 0xC0, 
-    0x20, 0x6D, 0xF3, 0x5E, 0x58, 0x48, 0xB1, 0xCA, 0x62, 0x18, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x03, 
-    0x2F, 0x0C, 0x20, 0x52, 0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x2D, 0x40, 0xFF, 0xF8, 0x4A, 0x80, 
-    0x6B, 0xDA, 0x20, 0x4A, 0x59, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 0x20, 0x2E, 0x00, 0x08, 0x67, 0x0C, 
-    0xB1, 0xED, 0xF3, 0x5E, 0x65, 0x06, 0x22, 0x6E, 0x00, 0x08, 0x22, 0x88, 0x26, 0x2E, 0xFF, 0xF8, 
-    0x02, 0x83, 0x40, 0x00, 0x00, 0x00, 0x66, 0x06, 0x20, 0x2E, 0xFF, 0xF8, 0x60, 0x2C, 0x38, 0x2E, 
-    0xFF, 0xFA, 0x0C, 0x6E, 0x00, 0x00, 0xFF, 0xFA, 0x6A, 0x08, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x60, 0x0A, 0x02, 0xAE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x42, 0x44, 0x3F, 0x04, 0x2F, 0x2E, 
-    0xFF, 0xF8, 0x4E, 0xBA, 0xFD, 0x78, 0x5C, 0x4F, 0x70, 0xFF, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x88, 0x5F, 0x66, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x30, 0x41, 0xED, 0x01, 0x8A, 0x2B, 0x48, 0xF7, 0xB4, 0x41, 0xED, 0x01, 0x82, 0x2B, 0x48, 
-    0xF7, 0xB8, 0x47, 0xED, 0xF7, 0x74, 0x45, 0xED, 0xF7, 0xBC, 0x60, 0x0C, 0x24, 0xAD, 0xF7, 0xB4, 
-    0x26, 0xAD, 0xF7, 0xB8, 0x58, 0x4B, 0x58, 0x4A, 0x41, 0xED, 0xF7, 0xFC, 0xB5, 0xC8, 0x65, 0xEC, 
-    0x42, 0x40, 0x3B, 0x40, 0xF7, 0x70, 0x70, 0xFF, 0x3B, 0x40, 0xF7, 0x72, 0x41, 0xED, 0xF7, 0x70, 
-    0x2B, 0x48, 0xF3, 0x50, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x10, 0x38, 0x26, 0x6E, 0x00, 0x0C, 0x20, 0x2D, 0xF3, 0x50, 0x66, 0x04, 0x4E, 0xBA, 0xFF, 0xA0, 
-    0x76, 0x00, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xFC, 0x60, 0x20, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x10, 
-    0x65, 0x0C, 0x70, 0x16, 0x2B, 0x40, 0xF6, 0xF2, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0xC4, 0x52, 0x83, 
-    0x20, 0x2E, 0xFF, 0xFC, 0xE2, 0x80, 0x2D, 0x40, 0xFF, 0xFC, 0x30, 0x2E, 0xFF, 0xFE, 0x72, 0x01, 
-    0xC0, 0x41, 0x67, 0xD6, 0x20, 0x03, 0xE5, 0x80, 0x41, 0xED, 0xF7, 0xBC, 0xD0, 0x88, 0x28, 0x40, 
-    0x20, 0x6D, 0xF3, 0x50, 0x32, 0x28, 0x00, 0x02, 0x70, 0x00, 0x30, 0x01, 0xC0, 0xAE, 0x00, 0x08, 
-    0x66, 0x08, 0x70, 0x03, 0x2D, 0x40, 0xFF, 0xF8, 0x60, 0x12, 0x24, 0x54, 0xB5, 0xED, 0xF7, 0xB4, 
-    0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 0x20, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 0xB6, 0xFC, 0x00, 0x03, 
-    0x66, 0x10, 0x20, 0x6D, 0xF3, 0x50, 0x30, 0x2E, 0x00, 0x0A, 0x46, 0x40, 0xC1, 0x68, 0x00, 0x02, 
-    0x60, 0x5A, 0xB6, 0xFC, 0x00, 0x05, 0x66, 0x44, 0x20, 0x6D, 0xF3, 0x50, 0x30, 0x2E, 0x00, 0x0A, 
-    0x81, 0x68, 0x00, 0x02, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x66, 0x12, 0x20, 0x6D, 
-    0xF3, 0x50, 0x32, 0x10, 0x70, 0x00, 0x30, 0x01, 0xC0, 0xAE, 0x00, 0x08, 0x67, 0x2E, 0x60, 0xEE, 
-    0x24, 0x6D, 0xF3, 0x50, 0x4A, 0x52, 0x67, 0x24, 0x30, 0x2E, 0x00, 0x0A, 0x46, 0x40, 0xC1, 0x52, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0x2C, 0x58, 0x4F, 0x60, 0x10, 0x70, 0x01, 0xB7, 0xC0, 
-    0x66, 0x06, 0x41, 0xED, 0x01, 0x8A, 0x60, 0x02, 0x20, 0x4B, 0x28, 0x88, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x30, 0x20, 0x2D, 0xF3, 0x50, 0x66, 0x04, 
-    0x4E, 0xBA, 0xFE, 0x9C, 0x76, 0x00, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xFC, 0x60, 0x18, 0x0C, 0x83, 
-    0x00, 0x00, 0x00, 0x10, 0x65, 0x04, 0x70, 0xFF, 0x60, 0x5E, 0x52, 0x83, 0x20, 0x2E, 0xFF, 0xFC, 
-    0xE2, 0x80, 0x2D, 0x40, 0xFF, 0xFC, 0x30, 0x2E, 0xFF, 0xFE, 0x72, 0x01, 0xC0, 0x41, 0x67, 0xDE, 
-    0x20, 0x03, 0xE5, 0x80, 0x41, 0xED, 0xF7, 0xBC, 0x26, 0x70, 0x00, 0x00, 0x20, 0x0B, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x34, 0x24, 0x6D, 0xF3, 0x50, 0x32, 0x2A, 0x00, 0x02, 0x70, 0x00, 0x30, 0x01, 
-    0xC0, 0xAE, 0x00, 0x08, 0x66, 0x0A, 0x30, 0x2E, 0x00, 0x0A, 0x81, 0x52, 0x70, 0xFF, 0x60, 0x18, 
-    0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x80, 0x50, 0x4F, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0x93, 0x58, 0x4F, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x85, 0x72, 0x61, 0x69, 0x73, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x20, 0x2D, 
-    0xF3, 0x50, 0x66, 0x04, 0x4E, 0xBA, 0xFE, 0x08, 0x42, 0x40, 0x20, 0x6D, 0xF3, 0x50, 0x31, 0x40, 
-    0x00, 0x02, 0x76, 0x01, 0x60, 0x0C, 0x20, 0x2E, 0x00, 0x08, 0xE2, 0x80, 0x2D, 0x40, 0x00, 0x08, 
-    0x52, 0x83, 0x30, 0x2E, 0x00, 0x0A, 0x72, 0x01, 0xC0, 0x41, 0x67, 0xEA, 0x20, 0x03, 0x72, 0x18, 
-    0xE3, 0xA8, 0x2F, 0x00, 0x4E, 0xBA, 0x00, 0x14, 0x58, 0x4F, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x73, 0x69, 0x67, 0x5F, 0x64, 0x66, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xED, 0xBA, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x65, 0x78, 0x69, 0x74, 0x00, 
-    0x00, 0x00, 0x20, 0x1F, 0x22, 0x5F, 0x20, 0x5F, 0x2F, 0x00, 0x70, 0x00, 0x72, 0x00, 0x10, 0x18, 
-    0x12, 0x19, 0x90, 0x41, 0x6C, 0x02, 0xD2, 0x40, 0xB0, 0x00, 0x60, 0x02, 0xB1, 0x09, 0x56, 0xC9, 
-    0xFF, 0xFC, 0x67, 0x0A, 0x6D, 0x04, 0x70, 0x01, 0x60, 0x04, 0x70, 0x01, 0x44, 0x40, 0x3F, 0x40, 
-    0x00, 0x04, 0x4E, 0x75, 0x88, 0x50, 0x4C, 0x53, 0x74, 0x72, 0x43, 0x6D, 0x70, 0x00, 0x00, 0x00, 
-    0x22, 0x1F, 0x20, 0x17, 0x2E, 0x81, 0x2F, 0x0B, 0x3F, 0x03, 0x4A, 0x80, 0x66, 0x00, 0x00, 0x80, 
-    0x42, 0x38, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x42, 0x67, 0xA9, 0xA0, 
-    0x20, 0x1F, 0x67, 0x12, 0x26, 0x40, 0x42, 0x43, 0x55, 0x4F, 0xA9, 0x94, 0x55, 0x4F, 0x2F, 0x0B, 
-    0xA9, 0xA4, 0xBF, 0x4F, 0x67, 0x3C, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x0A, 0x50, 0xF8, 0x0A, 0x5E, 0x2B, 0x40, 0xF7, 0xFC, 
-    0x60, 0x74, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xA0, 
-    0x20, 0x1F, 0x67, 0x08, 0x26, 0x40, 0x36, 0x3C, 0x00, 0x02, 0x60, 0x06, 0x50, 0xF8, 0x0A, 0x5E, 
-    0x60, 0x54, 0x50, 0xF8, 0x0A, 0x5E, 0x22, 0x13, 0x67, 0x04, 0x2F, 0x0B, 0xA9, 0xA3, 0x59, 0x4F, 
-    0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x03, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x38, 0x2B, 0x40, 
-    0xF7, 0xFC, 0x20, 0x40, 0xA0, 0x29, 0x26, 0x6D, 0xF7, 0xFC, 0x26, 0x53, 0x36, 0x13, 0x6F, 0x26, 
-    0x30, 0x03, 0xD0, 0x40, 0xD0, 0x40, 0x36, 0xC0, 0x58, 0x40, 0x36, 0xC0, 0x53, 0x43, 0x59, 0x4F, 
-    0x2F, 0x3C, 0x43, 0x55, 0x52, 0x53, 0x3F, 0x13, 0xA9, 0xA0, 0x26, 0xDF, 0x57, 0xCB, 0xFF, 0xF0, 
-    0x66, 0x04, 0x42, 0xAD, 0xF7, 0xFC, 0x36, 0x1F, 0x26, 0x5F, 0x4E, 0x75, 0x20, 0x5F, 0x24, 0x1F, 
-    0x6A, 0x0C, 0x02, 0x42, 0x00, 0x1F, 0x66, 0x04, 0x72, 0xFC, 0x60, 0x0A, 0x4E, 0xD0, 0x02, 0x42, 
-    0x00, 0x1F, 0x66, 0xF8, 0x72, 0x04, 0x2F, 0x08, 0x20, 0x2D, 0xF7, 0xFC, 0x66, 0x10, 0x3F, 0x01, 
-    0x42, 0xA7, 0x4E, 0xBA, 0xFF, 0x0C, 0x32, 0x1F, 0x20, 0x2D, 0xF7, 0xFC, 0x67, 0x22, 0x22, 0x40, 
-    0x22, 0x51, 0x34, 0x29, 0x00, 0x02, 0xD4, 0x41, 0x66, 0x04, 0x34, 0x11, 0x60, 0x06, 0xB4, 0x51, 
-    0x6F, 0x02, 0x74, 0x04, 0x33, 0x42, 0x00, 0x02, 0x22, 0x71, 0x20, 0x00, 0x2F, 0x11, 0xA8, 0x51, 
-    0x4E, 0x75, 0x24, 0x2D, 0xF8, 0x00, 0x20, 0x5F, 0x30, 0x1F, 0x48, 0xC0, 0x6E, 0x04, 0x6D, 0x0C, 
-    0x74, 0x00, 0xD4, 0x80, 0x2B, 0x42, 0xF8, 0x00, 0x4E, 0xFA, 0xFF, 0xA4, 0xD4, 0x80, 0x2B, 0x42, 
-    0xF8, 0x00, 0x4E, 0xFA, 0xFF, 0x8E, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x3C, 0x00, 0x00, 0xA8, 0x9F, 
-    0xA7, 0x46, 0x2F, 0x08, 0x20, 0x3C, 0x00, 0x00, 0xA0, 0xAD, 0xA3, 0x46, 0xB1, 0xDF, 0x67, 0x0E, 
-    0x20, 0x2E, 0x00, 0x0C, 0xA1, 0xAD, 0x22, 0x6E, 0x00, 0x08, 0x22, 0x88, 0x60, 0x26, 0x41, 0xFA, 
-    0x00, 0x36, 0x30, 0x3C, 0xEA, 0x51, 0x22, 0x2E, 0x00, 0x0C, 0xB2, 0x98, 0x67, 0x06, 0x4A, 0x98, 
-    0x67, 0x12, 0x60, 0xF6, 0x43, 0xFA, 0x00, 0x20, 0xD3, 0xD0, 0x4E, 0xD1, 0x22, 0x6E, 0x00, 0x08, 
-    0x22, 0x80, 0x42, 0x40, 0x3D, 0x40, 0x00, 0x10, 0x4E, 0x5E, 0x20, 0x5F, 0x50, 0x8F, 0x4E, 0xD0, 
-    0x30, 0x3C, 0xEA, 0x52, 0x60, 0xEE, 0x76, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x60, 0x6D, 0x61, 
-    0x63, 0x68, 0x00, 0x00, 0x00, 0x64, 0x73, 0x79, 0x73, 0x76, 0x00, 0x00, 0x00, 0x88, 0x70, 0x72, 
-    0x6F, 0x63, 0x00, 0x00, 0x00, 0x92, 0x66, 0x70, 0x75, 0x20, 0x00, 0x00, 0x00, 0x9E, 0x71, 0x64, 
-    0x20, 0x20, 0x00, 0x00, 0x00, 0xE8, 0x6B, 0x62, 0x64, 0x20, 0x00, 0x00, 0x01, 0x1A, 0x61, 0x74, 
-    0x6C, 0x6B, 0x00, 0x00, 0x01, 0x42, 0x6D, 0x6D, 0x75, 0x20, 0x00, 0x00, 0x01, 0x64, 0x72, 0x61, 
-    0x6D, 0x20, 0x00, 0x00, 0x01, 0x88, 0x6C, 0x72, 0x61, 0x6D, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0x60, 0x82, 0x22, 0x78, 0x02, 0xAE, 0x70, 0x04, 
-    0x0C, 0x69, 0x00, 0x75, 0x00, 0x08, 0x67, 0x12, 0x0C, 0x69, 0x02, 0x76, 0x00, 0x08, 0x66, 0x04, 
-    0x52, 0x40, 0x60, 0x06, 0x10, 0x38, 0x0C, 0xB3, 0x5C, 0x80, 0x60, 0x00, 0xFF, 0x60, 0x70, 0x00, 
-    0x30, 0x38, 0x01, 0x5A, 0x60, 0x00, 0xFF, 0x56, 0x70, 0x00, 0x10, 0x38, 0x01, 0x2F, 0x52, 0x40, 
-    0x60, 0x00, 0xFF, 0x4A, 0x0C, 0x38, 0x00, 0x04, 0x01, 0x2F, 0x67, 0x38, 0x08, 0x38, 0x00, 0x04, 
-    0x0B, 0x22, 0x67, 0x34, 0x20, 0x4F, 0xF2, 0x80, 0x00, 0x00, 0xF3, 0x27, 0x30, 0x17, 0x2E, 0x48, 
-    0x0C, 0x40, 0x1F, 0x18, 0x67, 0x16, 0x0C, 0x40, 0x3F, 0x18, 0x67, 0x10, 0x0C, 0x40, 0x3F, 0x38, 
-    0x67, 0x0E, 0x0C, 0x40, 0x1F, 0x38, 0x67, 0x08, 0x70, 0x00, 0x60, 0x0E, 0x70, 0x01, 0x60, 0x0A, 
-    0x70, 0x02, 0x60, 0x06, 0x70, 0x03, 0x60, 0x02, 0x70, 0x00, 0x60, 0x00, 0xFF, 0x00, 0x0C, 0x78, 
-    0x3F, 0xFF, 0x02, 0x8E, 0x6E, 0x1C, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0x24, 0x08, 0x20, 0x3C, 
-    0x00, 0x00, 0xAB, 0x03, 0xA7, 0x46, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 0xB4, 0x88, 0x66, 0x06, 
-    0x60, 0x0A, 0x70, 0x00, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0xFE, 0xCE, 
-    0x10, 0x38, 0x02, 0x1E, 0x41, 0xFA, 0x00, 0x16, 0x22, 0x48, 0x12, 0x18, 0x67, 0x00, 0xFE, 0xD2, 
-    0xB2, 0x00, 0x66, 0xF6, 0x91, 0xC9, 0x20, 0x08, 0x60, 0x00, 0xFE, 0xB2, 0x03, 0x13, 0x0B, 0x02, 
-    0x01, 0x06, 0x07, 0x04, 0x05, 0x08, 0x09, 0x00, 0x70, 0x00, 0x4A, 0x38, 0x02, 0x91, 0x6B, 0x16, 
-    0x12, 0x38, 0x01, 0xFB, 0x02, 0x01, 0x00, 0x0F, 0x0C, 0x01, 0x00, 0x01, 0x66, 0x08, 0x20, 0x78, 
-    0x02, 0xDC, 0x10, 0x28, 0x00, 0x07, 0x60, 0x00, 0xFE, 0x84, 0x0C, 0x38, 0x00, 0x02, 0x01, 0x2F, 
-    0x6D, 0x16, 0x70, 0x00, 0x10, 0x38, 0x0C, 0xB1, 0x0C, 0x00, 0x00, 0x01, 0x67, 0x0C, 0x0C, 0x00, 
-    0x00, 0x03, 0x6D, 0x04, 0x53, 0x40, 0x60, 0x02, 0x70, 0x00, 0x60, 0x00, 0xFE, 0x60, 0x30, 0x3C, 
-    0xA8, 0x9F, 0xA7, 0x46, 0x24, 0x08, 0x20, 0x3C, 0x00, 0x00, 0xA8, 0x8F, 0xA7, 0x46, 0x20, 0x38, 
-    0x01, 0x08, 0xB4, 0x88, 0x67, 0x0A, 0x59, 0x8F, 0x3F, 0x3C, 0x00, 0x16, 0xA8, 0x8F, 0x20, 0x1F, 
-    0x60, 0x00, 0xFE, 0x3A, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x21, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 
-    0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x25, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 
-    0x22, 0x5F, 0x12, 0x1F, 0x30, 0x1F, 0x4A, 0x01, 0x67, 0x04, 0xA7, 0x46, 0x60, 0x02, 0xA3, 0x46, 
-    0x2E, 0x88, 0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xB0, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x0E, 0x00, 0x12, 
-    0x31, 0x6E, 0x00, 0x0C, 0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 0x42, 0x68, 0x00, 0x1C, 0xA0, 0x0C, 
-    0x3D, 0x40, 0x00, 0x12, 0x41, 0xE8, 0x00, 0x20, 0x22, 0x6E, 0x00, 0x08, 0x70, 0x10, 0xA0, 0x2E, 
-    0x4E, 0x5E, 0x22, 0x5F, 0x4F, 0xEF, 0x00, 0x0A, 0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xB0, 0x20, 0x4F, 
-    0x21, 0x6E, 0x00, 0x0E, 0x00, 0x12, 0x31, 0x6E, 0x00, 0x0C, 0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 
-    0x42, 0x68, 0x00, 0x1C, 0xA0, 0x0C, 0x43, 0xE8, 0x00, 0x20, 0x20, 0x6E, 0x00, 0x08, 0x70, 0x10, 
-    0xA0, 0x2E, 0x20, 0x4F, 0xA0, 0x0D, 0x3D, 0x40, 0x00, 0x12, 0x4E, 0x5E, 0x22, 0x5F, 0x4F, 0xEF, 
-    0x00, 0x0A, 0x4E, 0xD1, 0x20, 0x6F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x42, 0x67, 0xA9, 0xEE, 
-    0x20, 0x5F, 0x50, 0x4F, 0x4E, 0xD0, 0x20, 0x2F, 0x00, 0x04, 0x67, 0x1C, 0x20, 0x40, 0x22, 0x40, 
-    0x34, 0x3C, 0x00, 0xFF, 0x12, 0x10, 0x10, 0xC0, 0x10, 0x01, 0x57, 0xCA, 0xFF, 0xF8, 0x22, 0x08, 
-    0x20, 0x09, 0x92, 0x80, 0x53, 0x01, 0x12, 0x81, 0x4E, 0x75, 0x86, 0x63, 0x32, 0x70, 0x73, 0x74, 
-    0x72, 0x00, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x04, 0x2F, 0x40, 0x00, 0x08, 0x67, 0x26, 0x20, 0x40, 
-    0x22, 0x48, 0x10, 0x19, 0x67, 0x1E, 0x12, 0x11, 0x12, 0xC0, 0x10, 0x01, 0x66, 0xF8, 0x93, 0xC8, 
-    0x20, 0x09, 0x53, 0x40, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0x10, 0x80, 0x22, 0x5F, 0x58, 0x4F, 0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x1F, 0x2E, 0x80, 
-    0x67, 0x12, 0x20, 0x40, 0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 0x00, 0x01, 0x51, 0xC8, 
-    0xFF, 0xFA, 0x42, 0x10, 0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0x74, 0x48, 0xE7, 0x1C, 0x00, 0x28, 0x2E, 
-    0x00, 0x12, 0x3A, 0x2E, 0x00, 0x16, 0x42, 0x2E, 0xFF, 0x78, 0x55, 0x4F, 0x2F, 0x3C, 0x66, 0x6F, 
-    0x6C, 0x64, 0x48, 0x6E, 0xFF, 0x74, 0x4E, 0xBA, 0xFC, 0x9E, 0x30, 0x1F, 0x66, 0x10, 0x20, 0x2E, 
-    0xFF, 0x74, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x06, 0x1D, 0x7C, 0x00, 0x01, 0xFF, 0x78, 0x10, 0x2E, 
-    0xFF, 0x78, 0x67, 0x20, 0x55, 0x4F, 0x3F, 0x05, 0x2F, 0x04, 0x1F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 0xA8, 0x23, 0x30, 0x1F, 0x3D, 0x40, 0x00, 0x18, 
-    0x4E, 0xFA, 0x00, 0xF8, 0x0C, 0x84, 0x6D, 0x61, 0x63, 0x73, 0x67, 0x42, 0x0C, 0x84, 0x74, 0x65, 
-    0x6D, 0x70, 0x67, 0x3A, 0x0C, 0x84, 0x70, 0x72, 0x65, 0x66, 0x67, 0x32, 0x0C, 0x84, 0x65, 0x78, 
-    0x74, 0x6E, 0x67, 0x2A, 0x0C, 0x84, 0x63, 0x74, 0x72, 0x6C, 0x67, 0x22, 0x0C, 0x84, 0x61, 0x6D, 
-    0x6E, 0x75, 0x67, 0x1A, 0x0C, 0x84, 0x73, 0x74, 0x72, 0x74, 0x67, 0x12, 0x0C, 0x84, 0x70, 0x72, 
-    0x6E, 0x74, 0x67, 0x0A, 0x70, 0xCE, 0x3D, 0x40, 0x00, 0x18, 0x4E, 0xFA, 0x00, 0xAE, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x8E, 0x0C, 0x45, 0x80, 0x00, 0x66, 0x2C, 0x55, 0x4F, 0x3E, 0xB8, 0x0A, 0x58, 
-    0x30, 0x1F, 0x3D, 0x40, 0xFF, 0x94, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0x98, 0x70, 0x02, 0x2D, 0x40, 
-    0xFF, 0xB6, 0x41, 0xEE, 0xFF, 0x7C, 0x70, 0x08, 0xA2, 0x60, 0x38, 0x00, 0x66, 0x76, 0x3D, 0x6E, 
-    0xFF, 0xB0, 0xFF, 0x92, 0x60, 0x04, 0x3D, 0x45, 0xFF, 0x92, 0x70, 0x06, 0x2D, 0x40, 0xFF, 0xA0, 
-    0x41, 0xEE, 0xFF, 0xF8, 0x2D, 0x48, 0xFF, 0x9C, 0x41, 0xEE, 0xFF, 0x7C, 0x70, 0x30, 0xA2, 0x60, 
-    0x38, 0x00, 0x70, 0xCE, 0xB8, 0x40, 0x67, 0x10, 0x4A, 0x44, 0x66, 0x42, 0x20, 0x2E, 0xFF, 0xFA, 
-    0x02, 0x80, 0x00, 0x02, 0x00, 0x00, 0x66, 0x36, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0x98, 0x76, 0x00, 
-    0x2D, 0x43, 0xFF, 0xD6, 0x2D, 0x43, 0xFF, 0xAC, 0x41, 0xEE, 0xFF, 0x7C, 0xA2, 0x07, 0x38, 0x00, 
-    0x66, 0x22, 0x20, 0x2E, 0xFF, 0xD6, 0x67, 0x12, 0x20, 0x6E, 0x00, 0x0C, 0x30, 0xAE, 0xFF, 0x92, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0xAE, 0xFF, 0xD6, 0x60, 0x0A, 0x78, 0xD5, 0x60, 0x06, 0x4A, 0x44, 
-    0x66, 0x02, 0x78, 0xD5, 0x30, 0x04, 0x3D, 0x40, 0x00, 0x18, 0x4C, 0xDF, 0x00, 0x38, 0x4E, 0x5E, 
-    0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x10, 0x4E, 0xD0, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 
-    0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x20, 0x0A, 0x67, 0x12, 0x10, 0x1A, 0x76, 0x00, 
-    0x16, 0x00, 0x60, 0x04, 0x16, 0xDA, 0x53, 0x43, 0x0C, 0x43, 0x00, 0x00, 0x6E, 0xF6, 0x42, 0x13, 
-    0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xBA, 0xFD, 0xCE, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x6E, 0xFF, 0x00, 
-    0x4E, 0xBA, 0xFF, 0xB6, 0x4E, 0x5E, 0x4E, 0x75, 0x00, 0x00, 0x40, 0x50, 0x01, 0xA8, 0x00, 0x19, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 
-    0x2F, 0x03, 0x70, 0x30, 0x2F, 0x00, 0x2F, 0x0A, 0x4E, 0xBA, 0x06, 0x6E, 0x4F, 0xEF, 0x00, 0x0C, 
-    0xD5, 0xC3, 0x60, 0x2A, 0x10, 0x2E, 0x00, 0x0B, 0x72, 0x0F, 0xC0, 0x01, 0x53, 0x4A, 0x20, 0x4A, 
-    0x10, 0x80, 0x10, 0x12, 0x72, 0x09, 0xB0, 0x01, 0x6F, 0x04, 0x70, 0x37, 0x60, 0x02, 0x70, 0x30, 
-    0xD1, 0x12, 0x53, 0x83, 0x20, 0x2E, 0x00, 0x08, 0xE8, 0x88, 0x2D, 0x40, 0x00, 0x08, 0x20, 0x2E, 
-    0x00, 0x08, 0x67, 0x08, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xC8, 0x4C, 0xDF, 0x04, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x62, 0x69, 0x6E, 0x68, 0x65, 0x78, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x04, 0x28, 0x2E, 0x00, 0x08, 0x70, 0x41, 0xB8, 0x80, 0x6D, 0x0C, 0x70, 0x5A, 
-    0xB8, 0x80, 0x6E, 0x06, 0x06, 0x84, 0x00, 0x00, 0x00, 0x20, 0x20, 0x04, 0x28, 0x1F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x74, 0x6F, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x00, 
-    0x2F, 0x03, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xBA, 0x06, 0x68, 0x50, 0x4F, 
-    0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xBA, 0x06, 0x76, 0x58, 0x4F, 0x26, 0x00, 0x70, 0x08, 0x2F, 0x00, 
-    0x20, 0x03, 0x41, 0xEE, 0xFF, 0x00, 0xD0, 0x88, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 
-    0xFF, 0x30, 0x4F, 0xEF, 0x00, 0x0C, 0x41, 0xEE, 0xFF, 0x08, 0x42, 0x30, 0x30, 0x00, 0x48, 0x6E, 
-    0xFF, 0x00, 0x4E, 0xAD, 0x01, 0xB2, 0x58, 0x4F, 0x48, 0x6E, 0xFF, 0x00, 0x30, 0x3C, 0xFE, 0x15, 
-    0xA9, 0xC9, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x62, 0x61, 0x64, 0x50, 0x74, 0x72, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x16, 0x30, 0x2C, 0x2E, 0x00, 0x08, 0x7A, 0x00, 
-    0x0C, 0x86, 0x00, 0x80, 0x00, 0x00, 0x62, 0x48, 0x76, 0x08, 0xBC, 0x83, 0x64, 0x02, 0x2C, 0x03, 
-    0x20, 0x06, 0x56, 0x80, 0x72, 0xFC, 0xC0, 0x81, 0x2C, 0x00, 0x26, 0x00, 0x53, 0x83, 0xE4, 0x8B, 
-    0x60, 0x02, 0x52, 0x85, 0x20, 0x03, 0xE2, 0x88, 0x26, 0x00, 0x66, 0xF6, 0x70, 0x08, 0xBA, 0x80, 
-    0x62, 0x0E, 0x26, 0x05, 0xE5, 0x83, 0x41, 0xED, 0xF2, 0x86, 0x4A, 0xB0, 0x30, 0x00, 0x66, 0x14, 
-    0x2F, 0x06, 0x2F, 0x05, 0x4E, 0xBA, 0x00, 0xB4, 0x50, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x2C, 
-    0x70, 0x00, 0x60, 0x5C, 0x20, 0x05, 0xE5, 0x80, 0x45, 0xED, 0xF2, 0x86, 0x45, 0xF2, 0x00, 0x00, 
-    0x26, 0x52, 0x2D, 0x4B, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x10, 0x24, 0x80, 0x10, 0x2B, 
-    0x00, 0x04, 0x16, 0x80, 0x10, 0x2B, 0x00, 0x05, 0x17, 0x40, 0x00, 0x01, 0x16, 0x13, 0x70, 0x5A, 
-    0xB6, 0x00, 0x67, 0x06, 0x70, 0x55, 0xB6, 0x00, 0x66, 0x10, 0x16, 0x2B, 0x00, 0x01, 0x70, 0x08, 
-    0xB6, 0x00, 0x63, 0x16, 0x0C, 0x03, 0x00, 0xFF, 0x67, 0x10, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0x24, 
-    0x4E, 0xBA, 0xFE, 0xEA, 0x50, 0x4F, 0x70, 0x00, 0x60, 0x06, 0x20, 0x4B, 0x58, 0x48, 0x20, 0x08, 
-    0x4C, 0xDF, 0x0C, 0x68, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 
-    0x00, 0x38, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 
-    0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x43, 0x6F, 0x72, 0x72, 0x75, 
-    0x70, 0x74, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x46, 0x72, 
-    0x65, 0x65, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x40, 0x20, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x1F, 0x30, 0x2C, 0x2E, 0x00, 0x0C, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x6F, 0x1E, 
-    0x20, 0x06, 0x58, 0x80, 0xA1, 0x1E, 0x26, 0x48, 0x20, 0x0B, 0x67, 0x00, 0x00, 0x84, 0x16, 0xBC, 
-    0x00, 0x5A, 0x17, 0x7C, 0x00, 0xFF, 0x00, 0x01, 0x20, 0x0B, 0x4E, 0xFA, 0x00, 0xEA, 0x20, 0x2E, 
-    0x00, 0x08, 0xE5, 0x80, 0x41, 0xED, 0xF2, 0x86, 0x4A, 0xB0, 0x00, 0x00, 0x67, 0x10, 0x48, 0x7A, 
-    0x00, 0xEA, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xCA, 0x26, 0x2E, 
-    0x00, 0x08, 0x78, 0x08, 0xB6, 0x84, 0x6E, 0x04, 0x2E, 0x04, 0x60, 0x02, 0x2E, 0x03, 0x56, 0x87, 
-    0x7A, 0x01, 0x20, 0x07, 0x56, 0x83, 0x90, 0x83, 0xE1, 0xA5, 0xBE, 0xAE, 0x00, 0x08, 0x6C, 0x14, 
-    0x2E, 0x2E, 0x00, 0x08, 0x60, 0x0E, 0x76, 0x01, 0xBA, 0x83, 0x67, 0x24, 0x2E, 0x2E, 0x00, 0x08, 
-    0x56, 0x87, 0x2A, 0x03, 0x7C, 0x01, 0xEF, 0xA6, 0x20, 0x05, 0x76, 0x02, 0xE7, 0xA8, 0xDC, 0x80, 
-    0x58, 0x86, 0x20, 0x06, 0xA1, 0x1E, 0x24, 0x48, 0x20, 0x0A, 0x67, 0xDA, 0x4A, 0x85, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x72, 0x24, 0xAD, 0xF2, 0xAA, 0x2B, 0x4A, 0xF2, 0xAA, 0x26, 0x4A, 0x58, 0x4B, 
-    0x28, 0x2E, 0x00, 0x08, 0xE7, 0xA4, 0x41, 0xED, 0xF2, 0x86, 0x21, 0x8B, 0x40, 0x00, 0x7C, 0x01, 
-    0x20, 0x2E, 0x00, 0x08, 0x56, 0x80, 0xE1, 0xA6, 0x58, 0x86, 0x60, 0x14, 0x24, 0x4B, 0xD5, 0xC6, 
-    0x26, 0x8A, 0x26, 0x4A, 0x17, 0x7C, 0x00, 0x55, 0x00, 0x04, 0x17, 0x6E, 0x00, 0x0B, 0x00, 0x05, 
-    0x53, 0x85, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xE2, 0x70, 0x00, 0x26, 0x80, 0x20, 0x2E, 
-    0x00, 0x08, 0xE5, 0x80, 0x45, 0xED, 0xF2, 0x86, 0x45, 0xF2, 0x00, 0x00, 0x26, 0x52, 0x2D, 0x4B, 
-    0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x10, 0x24, 0x80, 0x16, 0xBC, 0x00, 0x5A, 0x17, 0x6E, 
-    0x00, 0x0B, 0x00, 0x01, 0x20, 0x0B, 0x4C, 0xDF, 0x0C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 
-    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x4D, 0x65, 0x6D, 0x00, 0x2E, 0x2B, 0x49, 0x6E, 0x74, 0x65, 0x72, 
-    0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 
-    0x20, 0x2D, 0x2D, 0x20, 0x46, 0x72, 0x65, 0x65, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 
-    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x14, 
-    0x2F, 0x2E, 0x00, 0x10, 0x20, 0x2E, 0x00, 0x0C, 0x22, 0x2E, 0x00, 0x10, 0x4E, 0xAD, 0x01, 0x1A, 
-    0xD0, 0xAE, 0x00, 0x08, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0x0E, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x71, 0x73, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF4, 0x48, 0xE7, 
-    0x1E, 0x38, 0x28, 0x2E, 0x00, 0x10, 0x2C, 0x04, 0xDC, 0x86, 0x60, 0x00, 0x01, 0x56, 0x20, 0x05, 
-    0x22, 0x06, 0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x04, 0x4E, 0xAD, 0x01, 0x1A, 0x2A, 0x00, 0x24, 0x6E, 
-    0x00, 0x08, 0xD5, 0xC5, 0x2D, 0x4A, 0xFF, 0xF8, 0x2D, 0x4A, 0xFF, 0xFC, 0x2D, 0x6E, 0x00, 0x08, 
-    0xFF, 0xF4, 0x28, 0x6E, 0x00, 0x0C, 0x99, 0xC4, 0x24, 0x6E, 0xFF, 0xF4, 0x26, 0x6E, 0xFF, 0xF8, 
-    0xB5, 0xCB, 0x64, 0x00, 0x00, 0xB8, 0x2F, 0x0B, 0x2F, 0x0A, 0x20, 0x6E, 0x00, 0x14, 0x4E, 0x90, 
-    0x50, 0x4F, 0x26, 0x00, 0x66, 0x18, 0x2F, 0x04, 0x99, 0xAE, 0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x2F, 0x00, 0x2F, 0x0A, 0x4E, 0xBA, 0x01, 0x40, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0xCA, 0x0C, 0x83, 
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x86, 0xD9, 0xAE, 0xFF, 0xF4, 0x60, 0xBA, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x6E, 0x00, 0x14, 0x4E, 0x90, 0x50, 0x4F, 0x26, 0x00, 0x66, 0x18, 
-    0x2F, 0x04, 0x2F, 0x0C, 0xD9, 0xAE, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x01, 0x06, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x54, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x4A, 
-    0x24, 0x6E, 0xFF, 0xF4, 0xB5, 0xEE, 0xFF, 0xF8, 0x66, 0x26, 0x2F, 0x04, 0x2F, 0x0C, 0xD9, 0xAE, 
-    0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x2F, 0x00, 0x2F, 0x0A, 0x4E, 0xBA, 0x01, 0x0E, 0x4F, 0xEF, 
-    0x00, 0x10, 0xD9, 0xAE, 0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xF4, 0x60, 0x1C, 
-    0x2F, 0x04, 0x2F, 0x0C, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xBA, 0x00, 0xBC, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x99, 0xC4, 0xD9, 0xAE, 0xFF, 0xF4, 0x60, 0x00, 0xFF, 0x40, 0x99, 0xC4, 0x24, 0x6E, 0xFF, 0xFC, 
-    0xB9, 0xCA, 0x62, 0x00, 0xFF, 0x7A, 0x20, 0x6E, 0xFF, 0xF4, 0xB1, 0xEE, 0xFF, 0xF8, 0x66, 0x62, 
-    0xD5, 0xC4, 0x20, 0x2E, 0xFF, 0xF8, 0x90, 0xAE, 0x00, 0x08, 0x22, 0x2E, 0x00, 0x0C, 0x92, 0xAE, 
-    0xFF, 0xFC, 0xB0, 0x81, 0x6D, 0x1C, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x04, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x0A, 0x4E, 0xBA, 0xFE, 0xC6, 0x4F, 0xEF, 0x00, 0x10, 0x2D, 0x6E, 0xFF, 0xF8, 0x00, 0x0C, 
-    0x60, 0x20, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x04, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x08, 
-    0x4E, 0xBA, 0xFE, 0xA8, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xFC, 0xD1, 0xC4, 0x2D, 0x48, 
-    0x00, 0x08, 0x2A, 0x2E, 0x00, 0x0C, 0x9A, 0xAE, 0x00, 0x08, 0xBA, 0x84, 0x63, 0x2A, 0x60, 0x00, 
-    0xFE, 0x9E, 0x2F, 0x04, 0x2F, 0x2E, 0xFF, 0xF4, 0x99, 0xAE, 0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x54, 0x4F, 0xEF, 0x00, 0x10, 0x99, 0xAE, 0xFF, 0xFC, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x60, 0x00, 0xFE, 0xA2, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x83, 0x71, 0x73, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x2E, 
-    0x00, 0x10, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x10, 0x12, 0x1D, 0x40, 0xFF, 0xFC, 
-    0x12, 0x13, 0x14, 0xC1, 0x16, 0xC0, 0x53, 0x83, 0x66, 0xF0, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x71, 0x73, 0x65, 0x78, 0x63, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x10, 0x38, 0x26, 0x2E, 0x00, 0x14, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x10, 0x10, 0x12, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0xFC, 0x10, 0x14, 0x14, 0xC0, 
-    0x10, 0x13, 0x18, 0xC0, 0x16, 0xEE, 0xFF, 0xFF, 0x53, 0x83, 0x66, 0xE6, 0x4C, 0xDF, 0x1C, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x71, 0x73, 0x74, 0x65, 0x78, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x2E, 0x00, 0x14, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x52, 0x83, 0x53, 0x83, 0x67, 0x0E, 0x10, 0x1B, 0x14, 0xC0, 0xB0, 0x2E, 0x00, 0x13, 
-    0x66, 0xF2, 0x20, 0x0A, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x6D, 0x65, 0x6D, 0x63, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 
-    0x22, 0x2F, 0x00, 0x0C, 0xB0, 0x00, 0x60, 0x04, 0x48, 0x41, 0xB1, 0x09, 0x56, 0xC9, 0xFF, 0xFC, 
-    0x66, 0x0A, 0x48, 0x41, 0x51, 0xC9, 0xFF, 0xF2, 0x70, 0x00, 0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 
-    0x70, 0x00, 0x10, 0x20, 0x90, 0x81, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x63, 0x6D, 0x70, 0x00, 
-    0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 
-    0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 
-    0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 
-    0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 
-    0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 0x86, 0x6D, 
-    0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 0x4C, 0xEF, 0x00, 0x03, 
-    0x00, 0x08, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x13, 0x6D, 0x3A, 0x74, 0x00, 0x14, 0x00, 0xE1, 0x48, 
-    0x84, 0x40, 0x20, 0x02, 0x48, 0x42, 0x80, 0x82, 0x24, 0x08, 0xE2, 0x0A, 0x64, 0x04, 0x10, 0xC0, 
-    0x53, 0x81, 0xE2, 0x0A, 0x64, 0x04, 0x30, 0xC0, 0x55, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 
-    0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x41, 0x00, 0x0F, 
-    0x60, 0x02, 0x10, 0xC0, 0x51, 0xC9, 0xFF, 0xFC, 0x20, 0x2F, 0x00, 0x04, 0x4E, 0x75, 0x86, 0x6D, 
-    0x65, 0x6D, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x70, 0x00, 
-    0xB3, 0xC8, 0x67, 0x0A, 0x10, 0x18, 0xB0, 0x19, 0x66, 0x08, 0x4A, 0x00, 0x66, 0xF6, 0x70, 0x00, 
-    0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 0x90, 0x81, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x6D, 
-    0x70, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 
-    0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 
-    0x20, 0x08, 0x67, 0x0C, 0x22, 0x48, 0x4A, 0x18, 0x66, 0xFC, 0x91, 0xC9, 0x20, 0x08, 0x53, 0x80, 
-    0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x6C, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF4, 
-    0x48, 0xE7, 0x1E, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 
-    0x2D, 0x4A, 0xFF, 0xF8, 0x53, 0x86, 0x26, 0x4C, 0x58, 0x4B, 0x20, 0x4C, 0x70, 0x0C, 0xD1, 0xC0, 
-    0x2D, 0x48, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x82, 0x20, 0x14, 0xB0, 0x83, 0x6E, 0x1E, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x1D, 0x30, 0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x66, 0x0C, 0x20, 0x6E, 0xFF, 0xF8, 
-    0xB1, 0xCA, 0x66, 0x6C, 0x70, 0x00, 0x60, 0x6E, 0x53, 0x93, 0x52, 0x94, 0x26, 0x14, 0xB6, 0x86, 
-    0x6F, 0x04, 0x2A, 0x06, 0x60, 0x02, 0x2A, 0x03, 0x2F, 0x05, 0x70, 0x0D, 0x2F, 0x00, 0x2F, 0x13, 
-    0x2F, 0x0A, 0x4E, 0xBA, 0xFE, 0x0A, 0x4F, 0xEF, 0x00, 0x10, 0x2D, 0x40, 0xFF, 0xF4, 0x4A, 0x80, 
-    0x67, 0x06, 0x2A, 0x2E, 0xFF, 0xF4, 0x9A, 0x8A, 0xD5, 0xC5, 0x9B, 0x94, 0xDB, 0x93, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x10, 0x90, 0x93, 0x26, 0x14, 0x78, 0x00, 0xB6, 0x84, 0x6A, 0x04, 0x22, 0x04, 
-    0x60, 0x02, 0x22, 0x03, 0xB0, 0x81, 0x6C, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x23, 0x5A, 0x58, 0x4F, 
-    0x20, 0x2E, 0xFF, 0xF4, 0x66, 0x0A, 0x9C, 0x85, 0x76, 0x00, 0xBC, 0x83, 0x6E, 0x00, 0xFF, 0x7A, 
-    0x42, 0x12, 0x20, 0x2E, 0xFF, 0xF8, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 
-    0x67, 0x65, 0x74, 0x73, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x1E, 0x38, 0x28, 0x6E, 
-    0x00, 0x0C, 0x7C, 0x00, 0x36, 0x2C, 0x00, 0x12, 0x70, 0x12, 0x3D, 0x43, 0xFF, 0xFC, 0xC6, 0x40, 
-    0x70, 0x02, 0xB6, 0x40, 0x66, 0x1E, 0x24, 0x6C, 0x00, 0x08, 0x20, 0x0A, 0x67, 0x16, 0x20, 0x6C, 
-    0x00, 0x04, 0xB1, 0xCA, 0x66, 0x1E, 0x4A, 0x94, 0x66, 0x1A, 0x30, 0x2E, 0xFF, 0xFC, 0x72, 0x44, 
-    0xC0, 0x41, 0x66, 0x10, 0x2F, 0x0C, 0x4E, 0xBA, 0x22, 0x4A, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x00, 
-    0x00, 0xA2, 0x60, 0x06, 0x70, 0x00, 0x66, 0x00, 0x00, 0x9A, 0x20, 0x2C, 0x00, 0x0C, 0x2D, 0x40, 
-    0xFF, 0xF0, 0x26, 0x4C, 0x58, 0x4B, 0x20, 0x4C, 0x70, 0x0C, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xF8, 
-    0x2A, 0x2E, 0xFF, 0xF0, 0x24, 0x53, 0x9A, 0x8A, 0x6E, 0x10, 0x2F, 0x0C, 0x4E, 0xBA, 0x21, 0x40, 
-    0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x66, 0xE8, 0x60, 0x68, 0x2F, 0x05, 0x42, 0xA7, 0x2F, 0x2E, 
-    0x00, 0x08, 0x2F, 0x0A, 0x4E, 0xBA, 0xFD, 0x18, 0x4F, 0xEF, 0x00, 0x10, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x4A, 0x80, 0x67, 0x08, 0x2A, 0x2E, 0xFF, 0xF4, 0x9A, 0x8A, 0x53, 0x85, 0x9B, 0x94, 0xDB, 0x93, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x10, 0x90, 0x93, 0x26, 0x14, 0x78, 0x00, 0xB6, 0x84, 0x6A, 0x04, 
-    0x22, 0x04, 0x60, 0x02, 0x22, 0x03, 0xB0, 0x81, 0x6C, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x22, 0x68, 
-    0x58, 0x4F, 0xDC, 0x85, 0x20, 0x2E, 0xFF, 0xF4, 0x67, 0x20, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 
-    0xC0, 0x41, 0x67, 0x12, 0x2F, 0x0C, 0x4E, 0xBA, 0x20, 0xD6, 0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x0C, 0x20, 0x06, 0x60, 0x08, 0xDB, 0xAE, 0x00, 0x08, 0x60, 0x00, 
-    0xFF, 0x70, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x70, 0x75, 0x74, 0x73, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0B, 0x26, 0x6E, 0x00, 0x0C, 0x53, 0x93, 0x20, 0x13, 
-    0x6B, 0x14, 0x12, 0x2E, 0x00, 0x0B, 0x20, 0x6B, 0x00, 0x04, 0x52, 0xAB, 0x00, 0x04, 0x10, 0x81, 
-    0x70, 0x00, 0x10, 0x01, 0x60, 0x0C, 0x2F, 0x0B, 0x1F, 0x2E, 0x00, 0x0B, 0x4E, 0xBA, 0x1F, 0x44, 
-    0x5C, 0x4F, 0x26, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x70, 0x75, 0x74, 0x63, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x14, 0x4A, 0x87, 0x67, 0x06, 0x20, 0x2E, 0x00, 0x10, 0x66, 0x06, 0x70, 0x00, 
-    0x4E, 0xFA, 0x01, 0x5C, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC0, 0x41, 0x67, 0x00, 0x00, 0xB8, 
-    0x20, 0x07, 0x22, 0x2E, 0x00, 0x10, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 0x2F, 0x06, 0x2F, 0x0A, 
-    0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x52, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2A, 0x00, 0x66, 0x08, 0x00, 0x6C, 0x00, 0x10, 0x00, 0x12, 0x60, 0x72, 0x76, 0x00, 
-    0xBA, 0x83, 0x6A, 0x04, 0x2A, 0x03, 0x60, 0x68, 0xBA, 0x86, 0x64, 0x64, 0x20, 0x05, 0x22, 0x07, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x28, 0x00, 0xD5, 0xC6, 0x9C, 0x85, 0x2F, 0x06, 0x2F, 0x0A, 0x32, 0x2C, 
-    0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x52, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2A, 0x00, 0x66, 0x0C, 0x00, 0x6C, 0x00, 0x10, 0x00, 0x12, 0x20, 0x04, 0x4E, 0xFA, 0x00, 0xE0, 
-    0xBA, 0x86, 0x67, 0x00, 0x00, 0xD6, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0xCC, 
-    0x20, 0x2D, 0xF6, 0xF2, 0x66, 0x06, 0x30, 0x2D, 0xF6, 0xF6, 0x67, 0x06, 0x00, 0x6C, 0x00, 0x20, 
-    0x00, 0x12, 0x20, 0x05, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x2A, 0xD0, 0x84, 0x4E, 0xFA, 0x00, 0xB0, 
-    0xBA, 0x86, 0x66, 0x06, 0x20, 0x2E, 0x00, 0x10, 0x60, 0x08, 0x20, 0x05, 0x22, 0x07, 0x4E, 0xAD, 
-    0x01, 0x2A, 0x4E, 0xFA, 0x00, 0x9A, 0x20, 0x2E, 0x00, 0x10, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x1A, 
-    0x2C, 0x00, 0x26, 0x4C, 0x58, 0x4B, 0x20, 0x4C, 0x70, 0x0C, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xFC, 
-    0x20, 0x14, 0x6E, 0x2C, 0x2F, 0x0C, 0x4E, 0xBA, 0x1A, 0x4A, 0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 
-    0x66, 0x1A, 0x20, 0x2E, 0x00, 0x10, 0x24, 0x40, 0x20, 0x06, 0xD0, 0x87, 0x53, 0x80, 0x22, 0x07, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x00, 0x20, 0x0A, 0x90, 0x81, 0x60, 0x52, 0x53, 0x93, 0x52, 0x94, 
-    0x26, 0x14, 0xB6, 0x86, 0x63, 0x04, 0x2A, 0x06, 0x60, 0x02, 0x2A, 0x03, 0x2F, 0x05, 0x2F, 0x13, 
-    0x2F, 0x0A, 0x4E, 0xBA, 0xFB, 0x8E, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x40, 0xD1, 0xC5, 0x24, 0x48, 
-    0x9B, 0x94, 0xDB, 0x93, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x10, 0x90, 0x93, 0x26, 0x14, 0x78, 0x00, 
-    0xB6, 0x84, 0x6A, 0x04, 0x22, 0x04, 0x60, 0x02, 0x22, 0x03, 0xB0, 0x81, 0x6C, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x20, 0x74, 0x58, 0x4F, 0x9C, 0x85, 0x66, 0x86, 0x20, 0x2E, 0x00, 0x10, 0x4C, 0xDF, 
-    0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xE4, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x14, 0x4A, 0x87, 0x67, 0x00, 0x00, 0xC2, 0x20, 0x2E, 0x00, 0x10, 0x67, 0x00, 0x00, 0xBA, 
-    0x36, 0x2C, 0x00, 0x12, 0x70, 0x12, 0x3D, 0x43, 0xFF, 0xF4, 0xC6, 0x40, 0x70, 0x02, 0xB6, 0x40, 
-    0x66, 0x1E, 0x24, 0x6C, 0x00, 0x08, 0x20, 0x0A, 0x67, 0x16, 0x20, 0x6C, 0x00, 0x04, 0xB1, 0xCA, 
-    0x66, 0x1C, 0x4A, 0x94, 0x66, 0x18, 0x30, 0x2E, 0xFF, 0xF4, 0x72, 0x44, 0xC0, 0x41, 0x66, 0x0E, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x1F, 0x5E, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x7C, 0x60, 0x04, 0x70, 0x00, 
-    0x66, 0x76, 0x20, 0x2E, 0x00, 0x10, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 0x36, 0x2C, 
-    0x00, 0x12, 0x70, 0x44, 0x3D, 0x43, 0xFF, 0xFC, 0xC6, 0x40, 0x67, 0x74, 0x30, 0x2E, 0xFF, 0xFC, 
-    0x72, 0x04, 0xC0, 0x41, 0x67, 0x30, 0x2F, 0x06, 0x2F, 0x0B, 0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 
-    0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x5A, 0x4F, 0xEF, 0x00, 0x0C, 0x2A, 0x00, 0xBA, 0x86, 
-    0x67, 0x2E, 0x20, 0x2D, 0xF6, 0xF2, 0x66, 0x06, 0x30, 0x2D, 0xF6, 0xF6, 0x67, 0x22, 0x00, 0x6C, 
-    0x00, 0x20, 0x00, 0x12, 0x60, 0x1A, 0x7A, 0x00, 0x60, 0x12, 0x2F, 0x0C, 0x1F, 0x1B, 0x4E, 0xBA, 
-    0x1C, 0xE2, 0x5C, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x67, 0x06, 0x52, 0x85, 0xBA, 0x86, 0x65, 0xEA, 
-    0x0C, 0x85, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x06, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xBE, 0xBA, 0x86, 
-    0x67, 0x00, 0x00, 0xAC, 0x20, 0x05, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x2A, 0x4E, 0xFA, 0x00, 0xAC, 
-    0x20, 0x2C, 0x00, 0x0C, 0x2D, 0x40, 0xFF, 0xE8, 0x20, 0x4C, 0x58, 0x48, 0x2D, 0x48, 0xFF, 0xEC, 
-    0x20, 0x4C, 0x70, 0x0C, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xF0, 0x2A, 0x2E, 0xFF, 0xE8, 0x20, 0x6E, 
-    0xFF, 0xEC, 0x20, 0x10, 0x2D, 0x40, 0xFF, 0xE4, 0x9A, 0x80, 0x6E, 0x28, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x1D, 0xBE, 0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x66, 0xE0, 0x20, 0x2E, 0x00, 0x10, 0x24, 0x40, 
-    0x20, 0x06, 0xD0, 0x87, 0x53, 0x80, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x00, 0x20, 0x0A, 
-    0x90, 0x81, 0x60, 0x56, 0xBC, 0x85, 0x64, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x05, 0x2A, 0x00, 
-    0x2F, 0x05, 0x2F, 0x0B, 0x2F, 0x2E, 0xFF, 0xE4, 0x4E, 0xBA, 0xF9, 0xE8, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x9B, 0x94, 0x24, 0x6E, 0xFF, 0xEC, 0xDB, 0x92, 0x20, 0x6E, 0xFF, 0xF0, 0x20, 0x10, 0x90, 0x92, 
-    0x26, 0x14, 0x78, 0x00, 0xB6, 0x84, 0x6A, 0x04, 0x22, 0x04, 0x60, 0x02, 0x22, 0x03, 0xB0, 0x81, 
-    0x6C, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x1E, 0xD0, 0x58, 0x4F, 0x9C, 0x85, 0x66, 0x06, 0x20, 0x2E, 
-    0x00, 0x10, 0x60, 0x06, 0xD7, 0xC5, 0x60, 0x00, 0xFF, 0x72, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x66, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x03, 0x48, 0x6D, 0xF3, 0x8C, 0x48, 0x6E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0x01, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x30, 0x2D, 0xF3, 0x9E, 0x72, 0x20, 0xC0, 0x41, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x70, 
-    0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x2F, 0x2E, 
-    0x00, 0x08, 0x48, 0x6E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x01, 0x54, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x26, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x30, 0x28, 0x00, 0x12, 0x72, 0x20, 0xC0, 0x41, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x66, 
-    0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x2F, 0x2E, 
-    0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x01, 0x14, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x26, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x30, 0x28, 0x00, 0x12, 0x72, 0x20, 0xC0, 0x41, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x76, 
-    0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE8, 0x2F, 0x03, 
-    0x2D, 0x7C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x20, 0x2E, 0x00, 0x08, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x70, 0x02, 0x3D, 0x40, 0xFF, 0xFA, 0x70, 0x28, 0x3D, 0x40, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0xE8, 0x48, 0x6E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x00, 0xB2, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x20, 0x6E, 0xFF, 0xEC, 0x42, 0x10, 0x20, 0x03, 0x26, 0x1F, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xE8, 0x2F, 0x03, 0x2D, 0x7C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x20, 0x2E, 0x00, 0x08, 
-    0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x70, 0x02, 0x3D, 0x40, 0xFF, 0xFA, 0x70, 0x28, 
-    0x3D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xE8, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0x00, 0x5E, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x20, 0x6E, 0xFF, 0xEC, 0x42, 0x10, 
-    0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x76, 0x73, 0x70, 0x72, 0x69, 0x6E, 0x74, 
-    0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x04, 0x28, 0x2E, 0x00, 0x08, 0x70, 0x61, 
-    0xB8, 0x80, 0x6D, 0x08, 0x20, 0x04, 0x72, 0xA9, 0xD0, 0x81, 0x60, 0x16, 0x0C, 0x84, 0x00, 0x00, 
-    0x00, 0x41, 0x6D, 0x08, 0x20, 0x04, 0x72, 0xC9, 0xD0, 0x81, 0x60, 0x06, 0x20, 0x04, 0x72, 0xD0, 
-    0xD0, 0x81, 0x28, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x74, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0x28, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x28, 0x24, 0x4C, 0x70, 0x14, 0xD5, 0xC0, 0x2D, 0x4A, 0xFF, 0xE4, 0x20, 0x4C, 0x58, 0x48, 
-    0x2D, 0x48, 0xFF, 0xE8, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0x2C, 0x60, 0x04, 0x52, 0xAE, 0x00, 0x08, 
-    0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x34, 0x4A, 0x80, 
-    0x67, 0x06, 0x72, 0x25, 0xB0, 0x81, 0x66, 0xE4, 0x2A, 0x2E, 0x00, 0x08, 0x9A, 0xAE, 0xFF, 0x2C, 
-    0x67, 0x6E, 0xDB, 0xAE, 0xFF, 0x28, 0x76, 0x01, 0xBA, 0x83, 0x66, 0x28, 0x53, 0x94, 0x20, 0x14, 
-    0x6B, 0x12, 0x20, 0x6E, 0xFF, 0x2C, 0x10, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x10, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x2C, 0x1F, 0x10, 0x4E, 0xBA, 0x19, 0xD4, 
-    0x5C, 0x4F, 0x60, 0x3C, 0x20, 0x6E, 0xFF, 0xE4, 0x30, 0x10, 0x72, 0x28, 0xB0, 0x41, 0x66, 0x1C, 
-    0x2F, 0x05, 0x2F, 0x2E, 0xFF, 0x2C, 0x24, 0x6E, 0xFF, 0xE8, 0x2F, 0x12, 0x4E, 0xBA, 0xF7, 0x54, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x40, 0xD1, 0xC5, 0x24, 0x88, 0x60, 0x14, 0x2F, 0x0C, 0x2F, 0x05, 
-    0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0x2C, 0x4E, 0xBA, 0xFB, 0xF4, 0x4F, 0xEF, 0x00, 0x10, 
-    0x20, 0x2E, 0xFF, 0x34, 0x66, 0x16, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC0, 0x41, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x04, 0x20, 0x2E, 0xFF, 0x28, 0x4E, 0xFA, 0x0A, 0xC2, 0x42, 0x40, 0x3D, 0x40, 
-    0xFF, 0x48, 0x3D, 0x40, 0xFF, 0x46, 0x3D, 0x40, 0xFF, 0x44, 0x3D, 0x40, 0xFF, 0x42, 0x3D, 0x40, 
-    0xFF, 0x40, 0x60, 0x04, 0x52, 0x6E, 0xFF, 0x40, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x34, 0x72, 0x2B, 0xB0, 0x81, 0x67, 0xE4, 
-    0x72, 0x2D, 0xB0, 0x81, 0x67, 0x14, 0x72, 0x20, 0xB0, 0x81, 0x67, 0x14, 0x72, 0x23, 0xB0, 0x81, 
-    0x67, 0x14, 0x72, 0x30, 0xB0, 0x81, 0x67, 0x14, 0x60, 0x18, 0x52, 0x6E, 0xFF, 0x42, 0x60, 0xC8, 
-    0x52, 0x6E, 0xFF, 0x44, 0x60, 0xC2, 0x52, 0x6E, 0xFF, 0x46, 0x60, 0xBC, 0x52, 0x6E, 0xFF, 0x48, 
-    0x60, 0xB6, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0x34, 0x66, 0x22, 0x58, 0xAE, 0x00, 0x0C, 
-    0x20, 0x6E, 0x00, 0x0C, 0x20, 0x28, 0xFF, 0xFC, 0x2D, 0x40, 0xFF, 0x30, 0x4A, 0x80, 0x6A, 0x08, 
-    0x44, 0xAE, 0xFF, 0x30, 0x52, 0x6E, 0xFF, 0x42, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x48, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x30, 0x60, 0x26, 0x20, 0x2E, 0xFF, 0x30, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0A, 
-    0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0A, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAE, 0xFF, 0x34, 
-    0x72, 0xD0, 0xD0, 0x81, 0x2D, 0x40, 0xFF, 0x30, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x34, 0x72, 0x30, 0xB0, 0x81, 0x6D, 0x06, 
-    0x72, 0x39, 0xB0, 0x81, 0x6F, 0xC0, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x72, 0x2E, 0xB0, 0x01, 
-    0x67, 0x04, 0x7C, 0xFF, 0x60, 0x66, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 
-    0x72, 0x2A, 0xB0, 0x01, 0x66, 0x16, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2C, 0x28, 
-    0xFF, 0xFC, 0x6A, 0x02, 0x7C, 0xFF, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x40, 0x7C, 0x00, 0x60, 0x22, 
-    0x20, 0x06, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0A, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0A, 0x48, 0x41, 
-    0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAE, 0xFF, 0x34, 0x72, 0xD0, 0xD0, 0x81, 0x2C, 0x00, 0x52, 0xAE, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x34, 
-    0x72, 0x30, 0xB0, 0x81, 0x6D, 0x06, 0x72, 0x39, 0xB0, 0x81, 0x6F, 0xC4, 0x42, 0x43, 0x20, 0x6E, 
-    0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x72, 0x4C, 0xB0, 0x81, 0x67, 0x0E, 0x72, 0x68, 
-    0xB0, 0x81, 0x67, 0x08, 0x72, 0x6C, 0xB0, 0x81, 0x67, 0x04, 0x60, 0x08, 0x76, 0xFE, 0x52, 0x43, 
-    0x52, 0xAE, 0x00, 0x08, 0x41, 0xFA, 0x09, 0x58, 0x2D, 0x48, 0xFF, 0x4C, 0x42, 0x2E, 0xFF, 0xC6, 
-    0x41, 0xEE, 0xFF, 0xC6, 0x2D, 0x48, 0xFF, 0x50, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x3C, 0x2D, 0x40, 
-    0xFF, 0x38, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 
-    0x2D, 0x40, 0xFF, 0x34, 0x72, 0x64, 0xB0, 0x81, 0x67, 0x76, 0x72, 0x69, 0xB0, 0x81, 0x67, 0x70, 
-    0x72, 0x75, 0xB0, 0x81, 0x67, 0x6A, 0x72, 0x6F, 0xB0, 0x81, 0x67, 0x68, 0x72, 0x70, 0xB0, 0x81, 
-    0x67, 0x66, 0x72, 0x58, 0xB0, 0x81, 0x67, 0x64, 0x72, 0x78, 0xB0, 0x81, 0x67, 0x5E, 0x72, 0x45, 
-    0xB0, 0x81, 0x67, 0x00, 0x01, 0xC6, 0x72, 0x65, 0xB0, 0x81, 0x67, 0x00, 0x01, 0xBE, 0x72, 0x66, 
-    0xB0, 0x81, 0x67, 0x00, 0x03, 0xD4, 0x72, 0x47, 0xB0, 0x81, 0x67, 0x00, 0x05, 0x22, 0x72, 0x67, 
-    0xB0, 0x81, 0x67, 0x00, 0x05, 0x1A, 0x72, 0x63, 0xB0, 0x81, 0x67, 0x00, 0x05, 0xE0, 0x72, 0x73, 
-    0xB0, 0x81, 0x67, 0x00, 0x05, 0xF6, 0x72, 0x50, 0xB0, 0x81, 0x67, 0x00, 0x06, 0x26, 0x72, 0x6E, 
-    0xB0, 0x81, 0x67, 0x00, 0x06, 0x58, 0x4A, 0x80, 0x67, 0x00, 0x06, 0x78, 0x60, 0x00, 0x05, 0xB6, 
-    0x78, 0x0A, 0x60, 0x0A, 0x78, 0x08, 0x60, 0x06, 0x52, 0x6E, 0xFF, 0x46, 0x78, 0x10, 0x0C, 0x86, 
-    0x00, 0x00, 0x00, 0x00, 0x6B, 0x06, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0x48, 0x0C, 0x43, 0x00, 0x00, 
-    0x6F, 0x12, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x28, 0xFF, 0xFC, 0x2D, 0x40, 
-    0xFF, 0x54, 0x60, 0x3E, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x28, 0xFF, 0xFC, 
-    0x2D, 0x40, 0xFF, 0x54, 0x0C, 0x43, 0x00, 0x00, 0x6A, 0x28, 0x26, 0x2E, 0xFF, 0x34, 0x70, 0x64, 
-    0xB6, 0x80, 0x67, 0x06, 0x70, 0x69, 0xB6, 0x80, 0x66, 0x0C, 0x30, 0x2E, 0xFF, 0x56, 0x48, 0xC0, 
-    0x2D, 0x40, 0xFF, 0x54, 0x60, 0x0C, 0x32, 0x2E, 0xFF, 0x56, 0x70, 0x00, 0x30, 0x01, 0x2D, 0x40, 
-    0xFF, 0x54, 0x26, 0x2E, 0xFF, 0x34, 0x70, 0x64, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x69, 0xB6, 0x80, 
-    0x66, 0x36, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x6A, 0x0E, 0x41, 0xFA, 0x08, 0x22, 
-    0x2D, 0x48, 0xFF, 0x4C, 0x44, 0xAE, 0xFF, 0x54, 0x60, 0x1E, 0x30, 0x2E, 0xFF, 0x40, 0x67, 0x0A, 
-    0x41, 0xFA, 0x08, 0x10, 0x2D, 0x48, 0xFF, 0x4C, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x44, 0x67, 0x08, 
-    0x41, 0xFA, 0x08, 0x02, 0x2D, 0x48, 0xFF, 0x4C, 0x26, 0x2E, 0xFF, 0x34, 0x70, 0x58, 0xB6, 0x80, 
-    0x67, 0x06, 0x70, 0x70, 0xB6, 0x80, 0x66, 0x06, 0x45, 0xFA, 0x07, 0xFE, 0x60, 0x04, 0x45, 0xFA, 
-    0x07, 0xE6, 0x47, 0xEE, 0xFF, 0x77, 0x2D, 0x4B, 0xFF, 0x2C, 0x60, 0x28, 0x20, 0x2E, 0xFF, 0x54, 
-    0x22, 0x04, 0x4E, 0xAD, 0x01, 0x3A, 0xD0, 0x8A, 0x20, 0x40, 0x10, 0x10, 0x53, 0xAE, 0xFF, 0x2C, 
-    0x20, 0x6E, 0xFF, 0x2C, 0x10, 0x80, 0x22, 0x04, 0x20, 0x2E, 0xFF, 0x54, 0x4E, 0xAD, 0x01, 0x2A, 
-    0x2D, 0x40, 0xFF, 0x54, 0x20, 0x2E, 0xFF, 0x54, 0x66, 0xD2, 0x2A, 0x0B, 0x9A, 0xAE, 0xFF, 0x2C, 
-    0x30, 0x2E, 0xFF, 0x46, 0x67, 0x4E, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x34, 0x66, 0x16, 
-    0x4A, 0x86, 0x6B, 0x0C, 0x26, 0x05, 0x52, 0x83, 0xB6, 0x86, 0x6F, 0x38, 0x2C, 0x03, 0x60, 0x34, 
-    0x7C, 0xFF, 0x9C, 0x85, 0x60, 0x2E, 0x4A, 0x85, 0x67, 0x2A, 0x20, 0x2E, 0xFF, 0x34, 0x72, 0x78, 
-    0xB0, 0x81, 0x67, 0x0E, 0x72, 0x70, 0xB0, 0x81, 0x67, 0x08, 0x72, 0x58, 0xB0, 0x81, 0x67, 0x0C, 
-    0x60, 0x12, 0x41, 0xFA, 0x07, 0x86, 0x2D, 0x48, 0xFF, 0x4C, 0x60, 0x08, 0x41, 0xFA, 0x07, 0x80, 
-    0x2D, 0x48, 0xFF, 0x4C, 0x4A, 0x86, 0x6A, 0x06, 0x26, 0x06, 0x44, 0x83, 0x60, 0x02, 0x26, 0x06, 
-    0x96, 0x85, 0x2D, 0x43, 0xFF, 0x38, 0x60, 0x00, 0x05, 0x00, 0x0C, 0x86, 0x00, 0x00, 0x00, 0x00, 
-    0x6A, 0x02, 0x7C, 0x06, 0x70, 0x0A, 0xD1, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xE8, 
-    0xFF, 0xF6, 0x45, 0xEE, 0xFF, 0xEC, 0x24, 0xD9, 0x24, 0xD9, 0x34, 0x91, 0x2D, 0x6E, 0xFF, 0xEC, 
-    0xFF, 0x58, 0x2D, 0x6E, 0xFF, 0xF0, 0xFF, 0x5C, 0x3D, 0x6E, 0xFF, 0xF4, 0xFF, 0x60, 0x42, 0xA7, 
-    0x48, 0x6E, 0xFF, 0x68, 0x48, 0x6E, 0xFF, 0x64, 0x26, 0x06, 0x52, 0x83, 0x78, 0x13, 0xB6, 0x84, 
-    0x6C, 0x04, 0x20, 0x03, 0x60, 0x02, 0x20, 0x04, 0x2F, 0x00, 0x41, 0xEE, 0xFF, 0x62, 0x2F, 0x20, 
-    0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xC8, 0x4E, 0xBA, 0x10, 0x5A, 0x4F, 0xEF, 0x00, 0x1E, 
-    0x2D, 0x40, 0xFF, 0x2C, 0x20, 0x2E, 0xFF, 0x68, 0x67, 0x0A, 0x41, 0xFA, 0x06, 0xF6, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x60, 0x1E, 0x30, 0x2E, 0xFF, 0x40, 0x67, 0x0A, 0x41, 0xFA, 0x06, 0xE8, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x44, 0x67, 0x08, 0x41, 0xFA, 0x06, 0xDA, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x47, 0xEE, 0xFF, 0x6C, 0x20, 0x6E, 0xFF, 0x2C, 0x16, 0x10, 0x70, 0x49, 0xB6, 0x00, 
-    0x67, 0x00, 0x00, 0xD4, 0x70, 0x4E, 0xB6, 0x00, 0x67, 0x00, 0x00, 0xCC, 0x4A, 0x03, 0x67, 0x10, 
-    0x20, 0x6E, 0xFF, 0x2C, 0x52, 0xAE, 0xFF, 0x2C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x60, 0x02, 
-    0x70, 0x30, 0x16, 0xC0, 0x4A, 0x86, 0x66, 0x06, 0x30, 0x2E, 0xFF, 0x46, 0x67, 0x04, 0x16, 0xFC, 
-    0x00, 0x2E, 0x2D, 0x46, 0xFF, 0x3C, 0x60, 0x10, 0x20, 0x6E, 0xFF, 0x2C, 0x52, 0xAE, 0xFF, 0x2C, 
-    0x10, 0x10, 0x16, 0xC0, 0x53, 0xAE, 0xFF, 0x3C, 0x20, 0x2E, 0xFF, 0x3C, 0x76, 0x00, 0xB0, 0x83, 
-    0x6F, 0x08, 0x20, 0x6E, 0xFF, 0x2C, 0x4A, 0x10, 0x66, 0xDE, 0x2A, 0x2E, 0xFF, 0x64, 0x53, 0x85, 
-    0xBA, 0x83, 0x6A, 0x02, 0x44, 0x85, 0x20, 0x05, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x32, 0x72, 0x30, 
-    0xD0, 0x01, 0x53, 0xAE, 0xFF, 0x50, 0x20, 0x6E, 0xFF, 0x50, 0x10, 0x80, 0x72, 0x0A, 0x20, 0x05, 
-    0x4E, 0xAD, 0x01, 0x22, 0x2A, 0x00, 0x4A, 0x80, 0x66, 0xDC, 0x20, 0x6E, 0xFF, 0x50, 0x43, 0xEE, 
-    0xFF, 0xC4, 0xB1, 0xC9, 0x62, 0xD0, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x64, 0x6F, 0x04, 
-    0x70, 0x2B, 0x60, 0x02, 0x70, 0x2D, 0x53, 0xAE, 0xFF, 0x50, 0x20, 0x6E, 0xFF, 0x50, 0x10, 0x80, 
-    0x0C, 0xAE, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0x34, 0x6E, 0x04, 0x70, 0x45, 0x60, 0x02, 0x70, 0x65, 
-    0x53, 0xAE, 0xFF, 0x50, 0x20, 0x6E, 0xFF, 0x50, 0x10, 0x80, 0x41, 0xEE, 0xFF, 0x6C, 0x2D, 0x48, 
-    0xFF, 0x2C, 0x60, 0x00, 0x03, 0x84, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0x48, 0x20, 0x6E, 0xFF, 0x2C, 
-    0x10, 0x10, 0x72, 0x49, 0xB0, 0x01, 0x66, 0x10, 0x48, 0x7A, 0x05, 0xDE, 0x48, 0x6E, 0xFF, 0x6C, 
-    0x4E, 0xBA, 0xF2, 0xC2, 0x50, 0x4F, 0x60, 0x66, 0x48, 0x7A, 0x05, 0xD2, 0x48, 0x6E, 0xFF, 0x6C, 
-    0x4E, 0xBA, 0xF2, 0xB2, 0x50, 0x4F, 0x24, 0x6E, 0xFF, 0x2C, 0x10, 0x2A, 0x00, 0x04, 0x48, 0x80, 
-    0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0x8E, 0x58, 0x4F, 0x2A, 0x00, 0x10, 0x2A, 0x00, 0x03, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0x7C, 0x58, 0x4F, 0xE9, 0x80, 0xDA, 0x80, 
-    0x7E, 0x06, 0x60, 0x22, 0x20, 0x05, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x32, 0x72, 0x30, 0xD0, 0x01, 
-    0x22, 0x07, 0x53, 0x87, 0x41, 0xEE, 0xFF, 0x6C, 0x11, 0x80, 0x10, 0x00, 0x72, 0x0A, 0x20, 0x05, 
-    0x4E, 0xAD, 0x01, 0x22, 0x2A, 0x00, 0x0C, 0x87, 0x00, 0x00, 0x00, 0x04, 0x64, 0xD6, 0x45, 0xEE, 
-    0xFF, 0x6C, 0x2D, 0x4A, 0xFF, 0x2C, 0x48, 0x6E, 0xFF, 0x6C, 0x4E, 0xBA, 0xF2, 0x60, 0x58, 0x4F, 
-    0xD0, 0x8A, 0x26, 0x40, 0x60, 0x00, 0x02, 0xE2, 0x0C, 0x86, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x02, 
-    0x7C, 0x06, 0x70, 0x0A, 0xD1, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xE8, 0xFF, 0xF6, 
-    0x45, 0xEE, 0xFF, 0xF6, 0x24, 0xD9, 0x24, 0xD9, 0x34, 0x91, 0x2D, 0x6E, 0xFF, 0xF6, 0xFF, 0x58, 
-    0x2D, 0x6E, 0xFF, 0xFA, 0xFF, 0x5C, 0x3D, 0x6E, 0xFF, 0xFE, 0xFF, 0x60, 0x70, 0x01, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0x68, 0x48, 0x6E, 0xFF, 0x64, 0x2F, 0x06, 0x41, 0xEE, 0xFF, 0x62, 0x2F, 0x20, 
-    0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xC8, 0x4E, 0xBA, 0x0E, 0x4A, 0x4F, 0xEF, 0x00, 0x1E, 
-    0x2D, 0x40, 0xFF, 0x2C, 0x20, 0x2E, 0xFF, 0x68, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xFA, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x60, 0x1E, 0x30, 0x2E, 0xFF, 0x40, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xEC, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x44, 0x67, 0x08, 0x41, 0xFA, 0x04, 0xDE, 0x2D, 0x48, 
-    0xFF, 0x4C, 0x47, 0xEE, 0xFF, 0x6C, 0x20, 0x6E, 0xFF, 0x2C, 0x16, 0x10, 0x70, 0x49, 0xB6, 0x00, 
-    0x67, 0x00, 0xFE, 0xC4, 0x70, 0x4E, 0xB6, 0x00, 0x67, 0x00, 0xFE, 0xBC, 0x20, 0x6E, 0xFF, 0x4C, 
-    0x4A, 0x10, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0xD0, 0xAE, 0xFF, 0x64, 0x76, 0x00, 
-    0xBC, 0x83, 0x6E, 0x06, 0x32, 0x2E, 0xFF, 0x46, 0x67, 0x06, 0x28, 0x06, 0x52, 0x84, 0x60, 0x02, 
-    0x28, 0x03, 0xD0, 0x84, 0x72, 0x50, 0xB0, 0x81, 0x6F, 0x06, 0x7C, 0x12, 0x60, 0x00, 0xFD, 0x40, 
-    0x2A, 0x2E, 0xFF, 0x64, 0x76, 0x00, 0xBA, 0x83, 0x6F, 0x08, 0x20, 0x6E, 0xFF, 0x2C, 0x4A, 0x10, 
-    0x66, 0x04, 0x70, 0x30, 0x60, 0x0E, 0x20, 0x6E, 0xFF, 0x2C, 0x52, 0xAE, 0xFF, 0x2C, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x16, 0xC0, 0x53, 0x85, 0xBA, 0x83, 0x6E, 0xD8, 0x30, 0x2E, 0xFF, 0x46, 
-    0x66, 0x04, 0xBC, 0x83, 0x6F, 0x04, 0x16, 0xFC, 0x00, 0x2E, 0x2A, 0x06, 0x60, 0x2A, 0x52, 0xAE, 
-    0xFF, 0x64, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x64, 0x6F, 0x08, 0x20, 0x6E, 0xFF, 0x2C, 
-    0x4A, 0x10, 0x66, 0x04, 0x70, 0x30, 0x60, 0x0E, 0x20, 0x6E, 0xFF, 0x2C, 0x52, 0xAE, 0xFF, 0x2C, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x16, 0xC0, 0x53, 0x85, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x00, 
-    0x6A, 0xCC, 0x41, 0xEE, 0xFF, 0x6C, 0x2D, 0x48, 0xFF, 0x2C, 0x60, 0x00, 0x01, 0x8C, 0x0C, 0x86, 
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x04, 0x7C, 0x06, 0x60, 0x06, 0x4A, 0x86, 0x66, 0x02, 0x7C, 0x01, 
-    0x70, 0x0A, 0xD1, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xE8, 0xFF, 0xF6, 0x45, 0xEE, 
-    0xFF, 0xF6, 0x24, 0xD9, 0x24, 0xD9, 0x34, 0x91, 0x2D, 0x6E, 0xFF, 0xF6, 0xFF, 0x58, 0x2D, 0x6E, 
-    0xFF, 0xFA, 0xFF, 0x5C, 0x3D, 0x6E, 0xFF, 0xFE, 0xFF, 0x60, 0x42, 0xA7, 0x48, 0x6E, 0xFF, 0x68, 
-    0x48, 0x6E, 0xFF, 0x64, 0x76, 0x13, 0xBC, 0x83, 0x6C, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x03, 
-    0x2F, 0x00, 0x41, 0xEE, 0xFF, 0x62, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xC8, 
-    0x4E, 0xBA, 0x0C, 0xE2, 0x4F, 0xEF, 0x00, 0x1E, 0x2D, 0x40, 0xFF, 0x2C, 0x2E, 0x06, 0x32, 0x2E, 
-    0xFF, 0x46, 0x66, 0x30, 0x2F, 0x00, 0x4E, 0xBA, 0xF0, 0x84, 0x58, 0x4F, 0x2A, 0x00, 0xBA, 0x86, 
-    0x6C, 0x0A, 0x2E, 0x05, 0x60, 0x06, 0x53, 0x4A, 0x53, 0x87, 0x60, 0x0A, 0x20, 0x07, 0xD0, 0xAE, 
-    0xFF, 0x2C, 0x24, 0x40, 0x53, 0x4A, 0x76, 0x01, 0xBE, 0x83, 0x6D, 0x08, 0x10, 0x12, 0x72, 0x30, 
-    0xB0, 0x01, 0x67, 0xE2, 0x26, 0x2E, 0xFF, 0x64, 0x70, 0xFD, 0xB6, 0x80, 0x6D, 0x04, 0xB6, 0x86, 
-    0x6F, 0x08, 0x2C, 0x07, 0x53, 0x86, 0x60, 0x00, 0xFC, 0x3C, 0x2C, 0x07, 0x9C, 0xAE, 0xFF, 0x64, 
-    0x60, 0x00, 0xFE, 0x42, 0x1D, 0x6E, 0xFF, 0x37, 0xFF, 0x6C, 0x60, 0x10, 0x58, 0xAE, 0x00, 0x0C, 
-    0x20, 0x6E, 0x00, 0x0C, 0x20, 0x28, 0xFF, 0xFC, 0x1D, 0x40, 0xFF, 0x6C, 0x47, 0xEE, 0xFF, 0x6C, 
-    0x2D, 0x4B, 0xFF, 0x2C, 0x52, 0x4B, 0x60, 0x00, 0x00, 0xA0, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 
-    0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 0x2D, 0x4B, 0xFF, 0x2C, 0x0C, 0x86, 0x00, 0x00, 0x00, 0x00, 
-    0x6A, 0x0E, 0x2F, 0x2E, 0xFF, 0x2C, 0x4E, 0xBA, 0xEF, 0xF4, 0x58, 0x4F, 0xD7, 0xC0, 0x60, 0x78, 
-    0x4A, 0x1B, 0x67, 0x0A, 0x53, 0x86, 0x0C, 0x86, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xF2, 0x53, 0x4B, 
-    0x60, 0x66, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 0x52, 0x4B, 
-    0x2D, 0x4B, 0xFF, 0x2C, 0x4A, 0x86, 0x6B, 0x10, 0x20, 0x6E, 0xFF, 0x2C, 0x12, 0x28, 0xFF, 0xFF, 
-    0x70, 0x00, 0x10, 0x01, 0xB0, 0x86, 0x6C, 0x0E, 0x20, 0x6E, 0xFF, 0x2C, 0x12, 0x28, 0xFF, 0xFF, 
-    0x70, 0x00, 0x10, 0x01, 0x60, 0x02, 0x20, 0x06, 0xD7, 0xC0, 0x60, 0x2C, 0x26, 0x6E, 0xFF, 0x2C, 
-    0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x24, 0x68, 0xFF, 0xFC, 0x4A, 0x43, 0x67, 0x06, 
-    0x0C, 0x43, 0x00, 0x00, 0x6F, 0x06, 0x24, 0xAE, 0xFF, 0x28, 0x60, 0x0C, 0x34, 0xAE, 0xFF, 0x2A, 
-    0x60, 0x06, 0x70, 0xFF, 0x4E, 0xFA, 0x02, 0x26, 0x20, 0x2E, 0xFF, 0x3C, 0x76, 0x00, 0xB0, 0x83, 
-    0x6A, 0x04, 0x2D, 0x43, 0xFF, 0x3C, 0x20, 0x2E, 0xFF, 0x38, 0x76, 0x00, 0xB0, 0x83, 0x6A, 0x04, 
-    0x2D, 0x43, 0xFF, 0x38, 0x2F, 0x2E, 0xFF, 0x4C, 0x4E, 0xBA, 0xEF, 0x52, 0x58, 0x4F, 0x41, 0xEE, 
-    0xFF, 0xC0, 0xD0, 0x88, 0x20, 0x40, 0xD1, 0xEE, 0xFF, 0x38, 0xD1, 0xEE, 0xFF, 0x3C, 0x2A, 0x0B, 
-    0x9A, 0xAE, 0xFF, 0x2C, 0xD1, 0xC5, 0x5C, 0x48, 0x2E, 0x08, 0x9E, 0xAE, 0xFF, 0x50, 0x30, 0x2E, 
-    0xFF, 0x48, 0x67, 0x1C, 0x30, 0x2E, 0xFF, 0x42, 0x66, 0x16, 0x20, 0x2E, 0xFF, 0x30, 0xB0, 0x87, 
-    0x6F, 0x0E, 0x26, 0x2E, 0xFF, 0x30, 0x96, 0x87, 0xD7, 0xAE, 0xFF, 0x38, 0x2E, 0x2E, 0xFF, 0x30, 
-    0x26, 0x2E, 0xFF, 0x30, 0xB6, 0x87, 0x6F, 0x04, 0x20, 0x03, 0x60, 0x02, 0x20, 0x07, 0xD1, 0xAE, 
-    0xFF, 0x28, 0x30, 0x2E, 0xFF, 0x42, 0x66, 0x5E, 0x60, 0x20, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x0E, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x20, 0x60, 0x0C, 0x2F, 0x0C, 
-    0x70, 0x20, 0x1F, 0x00, 0x4E, 0xBA, 0x10, 0x3C, 0x5C, 0x4F, 0x53, 0xAE, 0xFF, 0x30, 0x20, 0x2E, 
-    0xFF, 0x30, 0xB0, 0x87, 0x6D, 0x30, 0x60, 0xD2, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x16, 0x20, 0x6E, 
-    0xFF, 0x4C, 0x52, 0xAE, 0xFF, 0x4C, 0x10, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x10, 0x80, 0x60, 0x12, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x4C, 0x52, 0xAE, 0xFF, 0x4C, 0x1F, 0x10, 
-    0x4E, 0xBA, 0x10, 0x00, 0x5C, 0x4F, 0x20, 0x6E, 0xFF, 0x4C, 0x4A, 0x10, 0x67, 0x22, 0x60, 0xC8, 
-    0x53, 0x94, 0x20, 0x14, 0x6B, 0x0E, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 
-    0x00, 0x30, 0x60, 0x0C, 0x2F, 0x0C, 0x70, 0x30, 0x1F, 0x00, 0x4E, 0xBA, 0x0F, 0xD6, 0x5C, 0x4F, 
-    0x53, 0xAE, 0xFF, 0x38, 0x20, 0x2E, 0xFF, 0x38, 0x76, 0x00, 0xB0, 0x83, 0x6A, 0xD2, 0xBA, 0x83, 
-    0x6F, 0x00, 0x00, 0x92, 0x70, 0x01, 0xBA, 0x80, 0x66, 0x2A, 0x53, 0x94, 0x20, 0x14, 0xB0, 0x83, 
-    0x6B, 0x12, 0x20, 0x6E, 0xFF, 0x2C, 0x10, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x10, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x2C, 0x1F, 0x10, 0x4E, 0xBA, 0x0F, 0x94, 
-    0x5C, 0x4F, 0x60, 0x60, 0x20, 0x6E, 0xFF, 0xE4, 0x30, 0x10, 0x72, 0x28, 0xB0, 0x41, 0x66, 0x1C, 
-    0x2F, 0x05, 0x2F, 0x2E, 0xFF, 0x2C, 0x24, 0x6E, 0xFF, 0xE8, 0x2F, 0x12, 0x4E, 0xBA, 0xED, 0x14, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x40, 0xD1, 0xC5, 0x24, 0x88, 0x60, 0x38, 0x2F, 0x0C, 0x2F, 0x05, 
-    0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0x2C, 0x4E, 0xBA, 0xF1, 0xB4, 0x4F, 0xEF, 0x00, 0x10, 
-    0x60, 0x22, 0x53, 0x94, 0x20, 0x14, 0xB0, 0x83, 0x6B, 0x0E, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 0x60, 0x0C, 0x2F, 0x0C, 0x70, 0x30, 0x1F, 0x00, 0x4E, 0xBA, 
-    0x0F, 0x32, 0x5C, 0x4F, 0x53, 0xAE, 0xFF, 0x3C, 0x20, 0x2E, 0xFF, 0x3C, 0x76, 0x00, 0xB0, 0x83, 
-    0x6B, 0x30, 0x60, 0xCE, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x16, 0x20, 0x6E, 0xFF, 0x50, 0x52, 0xAE, 
-    0xFF, 0x50, 0x10, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x80, 0x60, 0x12, 
-    0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x50, 0x52, 0xAE, 0xFF, 0x50, 0x1F, 0x10, 0x4E, 0xBA, 0x0E, 0xF4, 
-    0x5C, 0x4F, 0x20, 0x6E, 0xFF, 0x50, 0x4A, 0x10, 0x67, 0x22, 0x60, 0xC8, 0x53, 0x94, 0x20, 0x14, 
-    0x6B, 0x0E, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x20, 0x60, 0x0C, 
-    0x2F, 0x0C, 0x70, 0x20, 0x1F, 0x00, 0x4E, 0xBA, 0x0E, 0xCA, 0x5C, 0x4F, 0x53, 0xAE, 0xFF, 0x30, 
-    0x20, 0x2E, 0xFF, 0x30, 0xB0, 0x87, 0x6D, 0x00, 0xF4, 0x8C, 0x60, 0xD0, 0x4C, 0xDF, 0x1C, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x64, 0x6F, 0x70, 0x72, 0x6E, 0x74, 0x00, 0x4E, 0x00, 0x00, 
-    0x2D, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 
-    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 
-    0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x00, 0x30, 0x78, 0x00, 0x00, 0x30, 0x58, 
-    0x00, 0x00, 0x2D, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x49, 0x4E, 0x46, 0x00, 0x4E, 0x41, 0x4E, 0x28, 
-    0x30, 0x30, 0x30, 0x29, 0x00, 0x00, 0x2D, 0x00, 0x2B, 0x00, 0x20, 0x00, 0x4E, 0x56, 0xFF, 0xE8, 
-    0x48, 0xE7, 0x1C, 0x00, 0x2A, 0x2D, 0xF6, 0xF2, 0x70, 0x01, 0x3D, 0x40, 0xFF, 0xFA, 0x26, 0x2E, 
-    0x00, 0x08, 0x2D, 0x43, 0xFF, 0xF0, 0x2D, 0x43, 0xFF, 0xEC, 0x2F, 0x03, 0x4E, 0xBA, 0xEC, 0xCE, 
-    0x58, 0x4F, 0x2D, 0x40, 0xFF, 0xE8, 0x70, 0x28, 0x3D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0x00, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x6E, 0xFF, 0xE8, 0x4E, 0xBA, 0x00, 0x2A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x28, 0x00, 0x0C, 0xAD, 0x00, 0x00, 0x00, 0x09, 0xF6, 0xF2, 0x66, 0x04, 0x2B, 0x45, 0xF6, 0xF2, 
-    0x20, 0x04, 0x4C, 0xDF, 0x00, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x73, 0x63, 0x61, 0x6E, 
-    0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFE, 0x38, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x76, 0x00, 0x2D, 0x43, 0xFE, 0x3C, 0x2D, 0x43, 0xFE, 0x40, 0x2D, 0x43, 0xFE, 0x44, 0x20, 0x6E, 
-    0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x38, 
-    0x4A, 0x80, 0x67, 0x00, 0x08, 0x7A, 0x12, 0x2E, 0xFE, 0x3B, 0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 
-    0xF2, 0x82, 0x20, 0x40, 0x10, 0x10, 0x72, 0x08, 0xC0, 0x01, 0x67, 0x58, 0x24, 0x40, 0x52, 0xAE, 
-    0xFE, 0x40, 0x53, 0x94, 0x22, 0x14, 0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x14, 0x10, 0x72, 0x00, 0x12, 0x02, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x09, 0xA6, 0x58, 0x4F, 
-    0x22, 0x00, 0x2D, 0x41, 0xFE, 0x48, 0x20, 0x0A, 0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 0xF2, 0x82, 
-    0x20, 0x40, 0x10, 0x10, 0x74, 0x08, 0xC0, 0x02, 0x66, 0xC2, 0x53, 0xAE, 0xFE, 0x40, 0x2F, 0x0C, 
-    0x2F, 0x01, 0x4E, 0xBA, 0x13, 0x9C, 0x50, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x67, 0x00, 0x08, 0x16, 
-    0x60, 0x00, 0xFF, 0x7C, 0x20, 0x2E, 0xFE, 0x38, 0x76, 0x25, 0xB0, 0x83, 0x66, 0x16, 0x20, 0x6E, 
-    0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x38, 
-    0xB0, 0x83, 0x66, 0x44, 0x52, 0xAE, 0xFE, 0x40, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x10, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x09, 0x30, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0xB0, 0xAE, 0xFE, 0x38, 0x67, 0x00, 
-    0xFF, 0x2E, 0x2F, 0x0C, 0x2F, 0x00, 0x4E, 0xBA, 0x13, 0x38, 0x50, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 
-    0x67, 0x00, 0x07, 0xB2, 0x60, 0x00, 0x07, 0xA8, 0x76, 0x01, 0x2D, 0x43, 0xFE, 0x4C, 0x0C, 0xAE, 
-    0x00, 0x00, 0x00, 0x2A, 0xFE, 0x38, 0x66, 0x16, 0x53, 0xAE, 0xFE, 0x4C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x38, 0x7A, 0x00, 
-    0x60, 0x30, 0x20, 0x05, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0A, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0A, 
-    0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAE, 0xFE, 0x38, 0x72, 0xD0, 0xD0, 0x81, 0x2A, 0x00, 
-    0x20, 0x6E, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 
-    0xFE, 0x38, 0x12, 0x2E, 0xFE, 0x3B, 0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 0xF2, 0x82, 0x20, 0x40, 
-    0x10, 0x10, 0x72, 0x04, 0xC0, 0x01, 0x66, 0xBA, 0x4A, 0x85, 0x66, 0x06, 0x2A, 0x3C, 0x7F, 0xFF, 
-    0xFF, 0xFF, 0x26, 0x2E, 0xFE, 0x38, 0x2D, 0x43, 0xFE, 0x50, 0x70, 0x6C, 0xB6, 0x80, 0x67, 0x12, 
-    0x70, 0x68, 0xB6, 0x80, 0x67, 0x0C, 0x70, 0x4C, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x4D, 0xB6, 0x80, 
-    0x66, 0x12, 0x20, 0x6E, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 
-    0x2D, 0x40, 0xFE, 0x38, 0x26, 0x2E, 0xFE, 0x38, 0x70, 0x63, 0xB6, 0x80, 0x67, 0x60, 0x70, 0x5B, 
-    0xB6, 0x80, 0x67, 0x5A, 0x70, 0x6E, 0xB6, 0x80, 0x67, 0x54, 0x24, 0x40, 0x52, 0xAE, 0xFE, 0x40, 
-    0x53, 0x94, 0x22, 0x14, 0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x14, 0x10, 
-    0x72, 0x00, 0x12, 0x02, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x08, 0x28, 0x58, 0x4F, 0x22, 0x00, 
-    0x2D, 0x41, 0xFE, 0x48, 0x20, 0x0A, 0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 0xF2, 0x82, 0x20, 0x40, 
-    0x10, 0x10, 0x74, 0x08, 0xC0, 0x02, 0x66, 0xC2, 0x53, 0xAE, 0xFE, 0x40, 0x2F, 0x0C, 0x2F, 0x01, 
-    0x4E, 0xBA, 0x12, 0x1E, 0x50, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x67, 0x00, 0x06, 0x98, 0x12, 0x2E, 
-    0xFE, 0x3B, 0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 0xF2, 0x82, 0x20, 0x40, 0x10, 0x10, 0x72, 0x01, 
-    0xC0, 0x01, 0x67, 0x12, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x50, 0xFE, 0x38, 0x67, 0x08, 0x06, 0xAE, 
-    0x00, 0x00, 0x00, 0x20, 0xFE, 0x38, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x58, 0x20, 0x2E, 0xFE, 0x38, 
-    0x72, 0x5B, 0xB0, 0x81, 0x67, 0x6C, 0x72, 0x50, 0xB0, 0x81, 0x67, 0x00, 0x01, 0x30, 0x72, 0x63, 
-    0xB0, 0x81, 0x67, 0x00, 0x01, 0x34, 0x72, 0x73, 0xB0, 0x81, 0x67, 0x00, 0x01, 0x36, 0x72, 0x6E, 
-    0xB0, 0x81, 0x67, 0x00, 0x01, 0xE6, 0x72, 0x6F, 0xB0, 0x81, 0x67, 0x00, 0x02, 0x32, 0x72, 0x78, 
-    0xB0, 0x81, 0x67, 0x00, 0x02, 0x2E, 0x72, 0x64, 0xB0, 0x81, 0x67, 0x00, 0x02, 0x2A, 0x72, 0x75, 
-    0xB0, 0x81, 0x67, 0x00, 0x02, 0x22, 0x72, 0x69, 0xB0, 0x81, 0x67, 0x00, 0x02, 0x1A, 0x72, 0x70, 
-    0xB0, 0x81, 0x67, 0x00, 0x02, 0x12, 0x72, 0x65, 0xB0, 0x81, 0x67, 0x00, 0x04, 0x1C, 0x72, 0x66, 
-    0xB0, 0x81, 0x67, 0x00, 0x04, 0x14, 0x72, 0x67, 0xB0, 0x81, 0x67, 0x00, 0x04, 0x0C, 0x60, 0x00, 
-    0x05, 0xEE, 0x20, 0x6E, 0x00, 0x0C, 0x10, 0x10, 0x72, 0x5E, 0xB0, 0x01, 0x66, 0x0C, 0x76, 0x01, 
-    0x2D, 0x43, 0xFE, 0x60, 0x52, 0xAE, 0x00, 0x0C, 0x60, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x60, 
-    0x2F, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x20, 0x2E, 0xFE, 0x60, 0x44, 0x80, 0x91, 0x80, 0x52, 0x80, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFE, 0x64, 0x4E, 0xBA, 0xE8, 0xF0, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 
-    0x00, 0x0C, 0x18, 0x10, 0x48, 0x84, 0x48, 0xC4, 0x70, 0x5D, 0xB8, 0x80, 0x67, 0x06, 0x70, 0x2D, 
-    0xB8, 0x80, 0x66, 0x62, 0x41, 0xEE, 0xFE, 0x64, 0x11, 0xAE, 0xFE, 0x63, 0x40, 0x00, 0x52, 0xAE, 
-    0x00, 0x0C, 0x60, 0x52, 0x4A, 0x84, 0x67, 0x00, 0x05, 0x86, 0x70, 0x2D, 0xB8, 0x80, 0x66, 0x3C, 
-    0x24, 0x6E, 0x00, 0x0C, 0x1E, 0x12, 0x48, 0x87, 0x48, 0xC7, 0xBE, 0x83, 0x67, 0x2E, 0x1C, 0x2A, 
-    0xFF, 0xFE, 0x48, 0x86, 0x48, 0xC6, 0xBC, 0x87, 0x6E, 0x22, 0x20, 0x07, 0x90, 0x86, 0x2F, 0x00, 
-    0x2F, 0x2E, 0xFE, 0x60, 0x20, 0x06, 0x41, 0xEE, 0xFE, 0x65, 0xD0, 0x88, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xE8, 0x88, 0x4F, 0xEF, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x60, 0x0A, 0x41, 0xEE, 0xFE, 0x64, 
-    0x11, 0xAE, 0xFE, 0x63, 0x40, 0x00, 0x20, 0x6E, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x18, 0x10, 
-    0x48, 0x84, 0x48, 0xC4, 0x76, 0x5D, 0xB8, 0x83, 0x67, 0x18, 0x60, 0x98, 0x26, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0xBA, 0x83, 0x6F, 0x02, 0x2A, 0x03, 0x0C, 0x85, 0x7F, 0xFF, 0xFF, 0xFF, 0x66, 0x02, 
-    0x7A, 0x01, 0x20, 0x2E, 0xFE, 0x4C, 0x67, 0x0E, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 
-    0x26, 0x68, 0xFF, 0xFC, 0x60, 0x04, 0x70, 0x00, 0x26, 0x40, 0x24, 0x4B, 0x52, 0xAE, 0xFE, 0x3C, 
-    0x53, 0x94, 0x20, 0x14, 0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 
-    0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x38, 0x58, 0x4F, 0x2D, 0x40, 
-    0xFE, 0x48, 0x72, 0xFF, 0xB0, 0x81, 0x67, 0x46, 0x26, 0x2E, 0xFE, 0x38, 0x72, 0x73, 0xB6, 0x81, 
-    0x67, 0x06, 0x72, 0x50, 0xB6, 0x81, 0x66, 0x16, 0x14, 0x2E, 0xFE, 0x4B, 0x72, 0x00, 0x12, 0x02, 
-    0xD2, 0xAD, 0xF2, 0x82, 0x20, 0x41, 0x12, 0x10, 0x74, 0x08, 0xC2, 0x02, 0x66, 0x20, 0x72, 0x5B, 
-    0xB6, 0x81, 0x66, 0x0A, 0x41, 0xEE, 0xFE, 0x64, 0x4A, 0x30, 0x00, 0x00, 0x66, 0x10, 0x20, 0x2E, 
-    0xFE, 0x4C, 0x67, 0x04, 0x16, 0xAE, 0xFE, 0x4B, 0x52, 0x4B, 0x53, 0x85, 0x66, 0x8E, 0xB7, 0xCA, 
-    0x67, 0x00, 0x03, 0xA6, 0x20, 0x2E, 0xFE, 0x4C, 0x67, 0x6C, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x63, 
-    0xFE, 0x38, 0x67, 0x02, 0x42, 0x13, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x50, 0xFE, 0x38, 0x66, 0x56, 
-    0x2F, 0x0A, 0x4E, 0xAD, 0x01, 0xB2, 0x58, 0x4F, 0x60, 0x4C, 0x20, 0x2E, 0xFE, 0x4C, 0x67, 0x46, 
-    0x70, 0x00, 0x2D, 0x40, 0xFE, 0x4C, 0x20, 0x2E, 0xFE, 0x50, 0x72, 0x6C, 0xB0, 0x81, 0x67, 0x20, 
-    0x72, 0x68, 0xB0, 0x81, 0x67, 0x02, 0x60, 0x18, 0x30, 0x2E, 0xFE, 0x3E, 0xD0, 0x6E, 0xFE, 0x42, 
-    0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x30, 0x80, 0x60, 0x16, 
-    0x20, 0x2E, 0xFE, 0x3C, 0xD0, 0xAE, 0xFE, 0x40, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0x68, 0xFF, 0xFC, 0x20, 0x80, 0x52, 0xAE, 0xFE, 0x58, 0x60, 0x00, 0x03, 0x2C, 0x78, 0x08, 
-    0x60, 0x06, 0x78, 0x10, 0x60, 0x02, 0x78, 0x0A, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x5C, 0x76, 0x00, 
-    0x2D, 0x43, 0xFE, 0x54, 0x52, 0xAE, 0xFE, 0x3C, 0x53, 0x94, 0x20, 0x14, 0xB0, 0x83, 0x6B, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x2E, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0x76, 0x2D, 0xB0, 0x83, 
-    0x67, 0x06, 0x72, 0x2B, 0xB0, 0x81, 0x66, 0x34, 0xB0, 0x83, 0x66, 0x04, 0x52, 0xAE, 0xFE, 0x54, 
-    0x53, 0x85, 0x67, 0x00, 0x02, 0xD4, 0x52, 0xAE, 0xFE, 0x3C, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0xEE, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0x26, 0x2E, 0xFE, 0x38, 
-    0x70, 0x78, 0xB6, 0x80, 0x67, 0x0E, 0x70, 0x69, 0xB6, 0x80, 0x67, 0x08, 0x70, 0x70, 0xB6, 0x80, 
-    0x66, 0x00, 0x00, 0xFA, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x48, 0x66, 0x00, 0x00, 0xEE, 
-    0x53, 0x85, 0x66, 0x08, 0x52, 0xAE, 0xFE, 0x58, 0x60, 0x00, 0x01, 0x1A, 0x52, 0xAE, 0xFE, 0x3C, 
-    0x53, 0x94, 0x20, 0x14, 0x76, 0x00, 0xB0, 0x83, 0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x94, 
-    0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0x72, 0x58, 0xB0, 0x81, 0x67, 0x06, 0x72, 0x78, 0xB0, 0x81, 
-    0x66, 0x32, 0x53, 0x85, 0x67, 0x00, 0x02, 0x42, 0x52, 0xAE, 0xFE, 0x3C, 0x53, 0x94, 0x20, 0x14, 
-    0xB0, 0x83, 0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 
-    0x10, 0x01, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x5A, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 
-    0x78, 0x10, 0x60, 0x78, 0x52, 0xAE, 0xFE, 0x58, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x78, 0xFE, 0x38, 
-    0x67, 0x6A, 0x78, 0x08, 0x60, 0x66, 0x20, 0x2E, 0xFE, 0x48, 0x4A, 0x83, 0x67, 0x04, 0x72, 0x30, 
-    0x60, 0x10, 0x32, 0x2E, 0xFF, 0xE8, 0x74, 0x01, 0xC2, 0x02, 0x67, 0x04, 0x72, 0x37, 0x60, 0x02, 
-    0x72, 0x57, 0x90, 0x81, 0x2D, 0x40, 0xFF, 0xE4, 0xB0, 0x84, 0x6C, 0x78, 0x20, 0x04, 0x22, 0x2E, 
-    0xFE, 0x5C, 0x4E, 0xAD, 0x01, 0x1A, 0xD0, 0xAE, 0xFF, 0xE4, 0x2D, 0x40, 0xFE, 0x5C, 0x52, 0xAE, 
-    0xFE, 0x58, 0x53, 0x85, 0x67, 0x5E, 0x52, 0xAE, 0xFE, 0x3C, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x03, 0xDE, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0x12, 0x2E, 0xFE, 0x4B, 
-    0x70, 0x00, 0x10, 0x01, 0xD0, 0xAD, 0xF2, 0x82, 0x20, 0x40, 0x16, 0x10, 0x70, 0x04, 0x3D, 0x43, 
-    0xFF, 0xE8, 0xC6, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x66, 0x00, 0xFF, 0x7C, 0x0C, 0x84, 0x00, 0x00, 
-    0x00, 0x10, 0x66, 0x10, 0x30, 0x2E, 0xFF, 0xE8, 0x12, 0x00, 0x48, 0x81, 0x02, 0x41, 0x00, 0x80, 
-    0x66, 0x00, 0xFF, 0x64, 0x20, 0x2E, 0xFE, 0x4C, 0x67, 0x00, 0x01, 0x5E, 0x20, 0x2E, 0xFE, 0x58, 
-    0x67, 0x00, 0x01, 0x56, 0x20, 0x2E, 0xFE, 0x54, 0x67, 0x04, 0x44, 0xAE, 0xFE, 0x5C, 0x20, 0x2E, 
-    0xFE, 0x50, 0x72, 0x6C, 0xB0, 0x81, 0x67, 0x1C, 0x72, 0x68, 0xB0, 0x81, 0x67, 0x02, 0x60, 0x14, 
-    0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x30, 0xAE, 0xFE, 0x5E, 
-    0x60, 0x00, 0x01, 0x26, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 
-    0x20, 0xAE, 0xFE, 0x5C, 0x60, 0x00, 0x01, 0x12, 0x28, 0x05, 0x76, 0x50, 0xBA, 0x83, 0x6F, 0x02, 
-    0x2A, 0x03, 0x47, 0xEE, 0xFF, 0x74, 0x52, 0xAE, 0xFE, 0x3C, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x60, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x03, 0x1E, 0x58, 0x4F, 0x2D, 0x40, 0xFE, 0x48, 0x16, 0xC0, 0x42, 0x13, 
-    0x42, 0x40, 0x3D, 0x40, 0xFF, 0x6E, 0x48, 0x6E, 0xFF, 0x70, 0x48, 0x6E, 0xFF, 0xC8, 0x48, 0x6E, 
-    0xFF, 0x6E, 0x48, 0x6E, 0xFF, 0x74, 0x4E, 0xBA, 0x02, 0x84, 0x4F, 0xEF, 0x00, 0x10, 0x53, 0x85, 
-    0x67, 0x06, 0x30, 0x2E, 0xFF, 0x70, 0x66, 0xAE, 0x30, 0x2E, 0xFF, 0x6E, 0x67, 0x14, 0x0C, 0x85, 
-    0x00, 0x00, 0x00, 0x00, 0x6E, 0x08, 0x0C, 0x84, 0x00, 0x00, 0x00, 0x50, 0x6E, 0x04, 0x52, 0xAE, 
-    0xFE, 0x58, 0x20, 0x2E, 0xFE, 0x58, 0x67, 0x00, 0x00, 0x90, 0x20, 0x2E, 0xFE, 0x4C, 0x67, 0x00, 
-    0x00, 0x88, 0x48, 0x6E, 0xFF, 0xC8, 0x4E, 0xBA, 0x02, 0x92, 0x58, 0x4F, 0x3D, 0x40, 0xFF, 0x64, 
-    0x2D, 0x41, 0xFF, 0x66, 0x2D, 0x48, 0xFF, 0x6A, 0x20, 0x2E, 0xFE, 0x50, 0x72, 0x6C, 0xB0, 0x81, 
-    0x67, 0x08, 0x72, 0x4C, 0xB0, 0x81, 0x67, 0x28, 0x60, 0x40, 0x48, 0x6E, 0xFF, 0x64, 0x48, 0x6E, 
-    0xFF, 0xEE, 0x3F, 0x3C, 0x08, 0x10, 0xA9, 0xEB, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAE, 0xFF, 0xEE, 0x21, 0x6E, 0xFF, 0xF2, 0x00, 0x04, 0x60, 0x38, 
-    0x41, 0xEE, 0xFF, 0x64, 0x58, 0xAE, 0x00, 0x10, 0x24, 0x6E, 0x00, 0x10, 0x24, 0x6A, 0xFF, 0xFC, 
-    0x43, 0xD2, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0x90, 0x60, 0x1E, 0x48, 0x6E, 0xFF, 0x64, 0x48, 0x6E, 
-    0xFF, 0xF2, 0x3F, 0x3C, 0x10, 0x10, 0xA9, 0xEB, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAE, 0xFF, 0xF2, 0x20, 0x2E, 0xFE, 0x58, 0x67, 0x08, 0x20, 0x2E, 
-    0xFE, 0x4C, 0xD1, 0xAE, 0xFE, 0x44, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0xB8, 
-    0x0C, 0xAE, 0x00, 0x00, 0x00, 0x6E, 0xFE, 0x38, 0x67, 0x00, 0x00, 0xAC, 0x53, 0xAE, 0xFE, 0x3C, 
-    0x2F, 0x0C, 0x2F, 0x2E, 0xFE, 0x48, 0x4E, 0xBA, 0x0C, 0x28, 0x50, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 
-    0x66, 0x00, 0x00, 0x94, 0x20, 0x6E, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 0x72, 0x25, 
-    0xB0, 0x01, 0x66, 0x00, 0x00, 0x90, 0x20, 0x6E, 0x00, 0x0C, 0x52, 0xAE, 0x00, 0x0C, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xDD, 0x96, 0x58, 0x4F, 0x72, 0x6C, 0xB0, 0x81, 
-    0x67, 0x0E, 0x72, 0x68, 0xB0, 0x81, 0x67, 0x22, 0x72, 0x6E, 0xB0, 0x81, 0x67, 0x46, 0x60, 0x64, 
-    0x20, 0x6E, 0x00, 0x0C, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xDD, 0x70, 
-    0x58, 0x4F, 0x72, 0x6E, 0xB0, 0x81, 0x66, 0x4C, 0x60, 0x2A, 0x20, 0x6E, 0x00, 0x0C, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xDD, 0x56, 0x58, 0x4F, 0x72, 0x6E, 0xB0, 0x81, 
-    0x66, 0x32, 0x30, 0x2E, 0xFE, 0x3E, 0xD0, 0x6E, 0xFE, 0x42, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x50, 
-    0x30, 0x80, 0x60, 0x20, 0x20, 0x2E, 0xFE, 0x3C, 0xD0, 0xAE, 0xFE, 0x40, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0x50, 0x20, 0x80, 0x60, 0x0E, 0x20, 0x2E, 0xFE, 0x58, 0x66, 0x00, 0xF7, 0x72, 0x20, 0x2E, 
-    0xFE, 0x44, 0x60, 0x0E, 0x20, 0x2E, 0xFE, 0x3C, 0x67, 0x06, 0x20, 0x2E, 0xFE, 0x44, 0x60, 0x02, 
-    0x70, 0xFF, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x64, 0x6F, 0x73, 0x63, 
-    0x61, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x30, 0x26, 0x6E, 0x00, 0x08, 
-    0x1D, 0x6E, 0x00, 0x25, 0xFF, 0xF8, 0x3D, 0x6E, 0x00, 0x18, 0xFF, 0xFA, 0x2F, 0x0B, 0x41, 0xEE, 
-    0x00, 0x16, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xF8, 0x4E, 0xBA, 0x00, 0xCC, 
-    0x4F, 0xEF, 0x00, 0x12, 0x12, 0x2B, 0x00, 0x05, 0x70, 0x00, 0x10, 0x01, 0x72, 0x49, 0xB0, 0x81, 
-    0x67, 0x54, 0x72, 0x4E, 0xB0, 0x81, 0x67, 0x4E, 0x72, 0x3F, 0xB0, 0x81, 0x67, 0x08, 0x72, 0x30, 
-    0xB0, 0x81, 0x67, 0x26, 0x60, 0x2A, 0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x1E, 0x2F, 0x2E, 0x00, 0x1A, 
-    0x70, 0x13, 0x2F, 0x00, 0x41, 0xEE, 0x00, 0x16, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x2F, 0x0B, 
-    0x4E, 0xBA, 0xFF, 0x92, 0x4F, 0xEF, 0x00, 0x1E, 0x60, 0x42, 0x42, 0x40, 0x37, 0x40, 0x00, 0x02, 
-    0x12, 0x2B, 0x00, 0x04, 0x70, 0x00, 0x10, 0x01, 0x32, 0x2B, 0x00, 0x02, 0x48, 0xC1, 0xD0, 0x81, 
-    0x20, 0x6E, 0x00, 0x1A, 0x20, 0x80, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x20, 0x6E, 0x00, 0x1E, 
-    0x20, 0x80, 0x24, 0x4B, 0x5A, 0x4A, 0x12, 0x2B, 0x00, 0x04, 0x70, 0x00, 0x10, 0x01, 0x2D, 0x4A, 
-    0xFF, 0xFC, 0xD5, 0xC0, 0x42, 0x12, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x08, 0x4C, 0xDF, 0x0C, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x5F, 0x63, 0x76, 0x74, 0x00, 0x00, 0x00, 0x42, 0x67, 0x4C, 0xEF, 
-    0x01, 0x03, 0x00, 0x06, 0xC1, 0x88, 0x48, 0xE7, 0xC0, 0x80, 0x48, 0x6F, 0x00, 0x0C, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xEE, 0x70, 0x00, 0x10, 0x1F, 0x20, 0x6F, 0x00, 0x10, 0x30, 0x80, 0x4E, 0x75, 
-    0x87, 0x73, 0x74, 0x72, 0x32, 0x64, 0x65, 0x63, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x04, 0x48, 0x6F, 
-    0x00, 0x0C, 0x2F, 0x2F, 0x00, 0x1A, 0x3F, 0x3C, 0x00, 0x0B, 0xA9, 0xEB, 0x4E, 0x75, 0x88, 0x5F, 
-    0x6E, 0x75, 0x6D, 0x32, 0x64, 0x65, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF4, 0x2F, 0x2E, 
-    0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF6, 0x3F, 0x3C, 0x00, 0x09, 0xA9, 0xEB, 0x4C, 0xEE, 0x01, 0x03, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x64, 0x65, 0x63, 0x32, 0x6E, 0x75, 0x6D, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x2C, 
-    0x00, 0x12, 0x02, 0x40, 0x00, 0x81, 0x67, 0x4C, 0x00, 0x6C, 0x00, 0x01, 0x00, 0x12, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x10, 0xC0, 0x41, 0x66, 0x3C, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x00, 0xEC, 0x58, 0x4F, 0x30, 0x2C, 0x00, 0x12, 0x02, 0x40, 0x01, 0x00, 0x67, 0x34, 
-    0x47, 0xED, 0xF3, 0x76, 0x60, 0x28, 0x30, 0x2B, 0x00, 0x12, 0x02, 0x40, 0x01, 0x02, 0x32, 0x3C, 
-    0x01, 0x02, 0xB0, 0x41, 0x66, 0x14, 0x2F, 0x0B, 0x4E, 0xBA, 0x02, 0xC2, 0x58, 0x4F, 0x72, 0xFF, 
-    0xB0, 0x81, 0x66, 0x06, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0x86, 0x70, 0x16, 0xD7, 0xC0, 0xB7, 0xED, 
-    0xF6, 0xE6, 0x65, 0xD2, 0x20, 0x2C, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x04, 0xC0, 0x41, 0x67, 0x04, 0x70, 0x01, 0x60, 0x08, 0x32, 0x2C, 0x00, 0x10, 0x70, 0x00, 
-    0x30, 0x01, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x08, 0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 
-    0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x52, 0x4F, 0xEF, 0x00, 0x0C, 0x28, 0x80, 0x53, 0x94, 0x20, 0x14, 
-    0x6B, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 
-    0x60, 0x2C, 0x20, 0x14, 0x72, 0xFF, 0xB0, 0x81, 0x66, 0x18, 0x00, 0x6C, 0x00, 0x10, 0x00, 0x12, 
-    0x30, 0x2C, 0x00, 0x12, 0x02, 0x40, 0x00, 0x80, 0x67, 0x0E, 0x02, 0x6C, 0xFF, 0xFE, 0x00, 0x12, 
-    0x60, 0x06, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0x00, 0x28, 0x80, 0x70, 0xFF, 0x4C, 0xDF, 
-    0x18, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x69, 0x6C, 0x62, 0x75, 0x66, 0x00, 0x00, 
-    0x2F, 0x0A, 0x45, 0xED, 0xF3, 0x76, 0x60, 0x0C, 0x2F, 0x0A, 0x4E, 0xBA, 0x01, 0x6E, 0x58, 0x4F, 
-    0x70, 0x16, 0xD5, 0xC0, 0xB5, 0xED, 0xF6, 0xE6, 0x65, 0xEE, 0x24, 0x5F, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xF0, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2D, 0xF6, 0xEA, 0x66, 0x12, 
-    0x41, 0xED, 0x02, 0x5A, 0x22, 0x6D, 0xF3, 0x54, 0x23, 0x48, 0x00, 0x08, 0x70, 0x01, 0x2B, 0x40, 
-    0xF6, 0xEA, 0x26, 0x2D, 0xF6, 0xF2, 0x38, 0x2D, 0xF6, 0xF6, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 
-    0xC0, 0x41, 0x67, 0x12, 0x42, 0x40, 0x39, 0x40, 0x00, 0x10, 0x41, 0xED, 0xF6, 0xEE, 0x29, 0x48, 
-    0x00, 0x08, 0x60, 0x00, 0x00, 0xBC, 0x4A, 0x6C, 0x00, 0x10, 0x66, 0x46, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x08, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x40, 0xC0, 0x41, 0x67, 0x08, 0x39, 0x7C, 0x00, 0xFE, 
-    0x00, 0x10, 0x60, 0x2E, 0x48, 0x6E, 0xFF, 0xF0, 0x2F, 0x3C, 0x00, 0x00, 0x66, 0x03, 0x32, 0x2C, 
-    0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x62, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4A, 0x80, 0x6B, 0x08, 0x39, 0x6E, 0xFF, 0xF2, 0x00, 0x10, 0x60, 0x06, 0x39, 0x7C, 0x04, 0x00, 
-    0x00, 0x10, 0x24, 0x4C, 0x50, 0x4A, 0x4A, 0x92, 0x66, 0x66, 0x26, 0x4C, 0x72, 0x10, 0xD7, 0xC1, 
-    0x32, 0x13, 0x70, 0x00, 0x30, 0x01, 0xA1, 0x1E, 0x24, 0x88, 0x20, 0x08, 0x66, 0x30, 0x30, 0x13, 
-    0x0C, 0x40, 0x00, 0xFE, 0x63, 0x28, 0x30, 0x13, 0x0C, 0x40, 0x04, 0x00, 0x63, 0x08, 0x20, 0x3C, 
-    0x00, 0x00, 0x04, 0x00, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFE, 0x36, 0x80, 0x3D, 0x40, 
-    0xFF, 0xFC, 0x32, 0x2E, 0xFF, 0xFC, 0x70, 0x00, 0x30, 0x01, 0xA1, 0x1E, 0x24, 0x88, 0x4A, 0xAC, 
-    0x00, 0x08, 0x67, 0x08, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x12, 0x60, 0x14, 0x00, 0x6C, 0x00, 0x04, 
-    0x00, 0x12, 0x42, 0x40, 0x39, 0x40, 0x00, 0x10, 0x41, 0xED, 0xF6, 0xEE, 0x29, 0x48, 0x00, 0x08, 
-    0x20, 0x6C, 0x00, 0x08, 0x32, 0x2C, 0x00, 0x10, 0x70, 0x00, 0x30, 0x01, 0xD1, 0xC0, 0x29, 0x48, 
-    0x00, 0x0C, 0x20, 0x2C, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 0x42, 0xA7, 0x2F, 0x3C, 0x00, 0x00, 
-    0x66, 0x02, 0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x62, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x80, 0x6B, 0x06, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x12, 0x2B, 0x43, 
-    0xF6, 0xF2, 0x3B, 0x44, 0xF6, 0xF6, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x66, 0x69, 0x6E, 0x64, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x18, 0x10, 0x26, 0x6E, 0x00, 0x08, 0x78, 0xFF, 0x20, 0x0B, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x7A, 
-    0x36, 0x2B, 0x00, 0x12, 0x3D, 0x43, 0xFF, 0xFC, 0x02, 0x43, 0x00, 0x83, 0x67, 0x36, 0x30, 0x2E, 
-    0xFF, 0xFC, 0x72, 0x04, 0xC0, 0x41, 0x67, 0x04, 0x78, 0x00, 0x60, 0x0A, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0x00, 0x6C, 0x58, 0x4F, 0x28, 0x00, 0x32, 0x2B, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 
-    0x4E, 0xAD, 0x01, 0x4A, 0x58, 0x4F, 0x4A, 0x80, 0x6A, 0x16, 0x78, 0xFF, 0x70, 0x02, 0x2B, 0x40, 
-    0xF6, 0xF2, 0x60, 0x0C, 0x4A, 0x6B, 0x00, 0x12, 0x66, 0x06, 0x70, 0x02, 0x2B, 0x40, 0xF6, 0xF2, 
-    0x30, 0x2B, 0x00, 0x12, 0x72, 0x08, 0xC0, 0x41, 0x67, 0x0C, 0x20, 0x6B, 0x00, 0x08, 0xA0, 0x1F, 
-    0x70, 0x00, 0x27, 0x40, 0x00, 0x08, 0x42, 0x40, 0x37, 0x40, 0x00, 0x12, 0x70, 0x00, 0x26, 0x80, 
-    0x20, 0x2B, 0x00, 0x08, 0x27, 0x40, 0x00, 0x04, 0x20, 0x04, 0x4C, 0xDF, 0x08, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x66, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x76, 0x00, 0x20, 0x0C, 0x66, 0x34, 0x47, 0xED, 
-    0xF3, 0x76, 0x60, 0x1C, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x02, 0xC0, 0x41, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x4E, 0xBA, 0xFF, 0xDA, 0x58, 0x4F, 0x4A, 0x80, 0x67, 0x02, 0x76, 0x01, 0x70, 0x16, 0xD7, 0xC0, 
-    0xB7, 0xED, 0xF6, 0xE6, 0x65, 0xDE, 0x4A, 0x83, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0xFF, 
-    0x60, 0x6E, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC0, 0x41, 0x66, 0x08, 0x76, 0x00, 0x28, 0x83, 
-    0x20, 0x03, 0x60, 0x5C, 0x26, 0x4C, 0x70, 0x12, 0xD7, 0xC0, 0x20, 0x4C, 0x58, 0x48, 0x2D, 0x48, 
-    0xFF, 0xFC, 0x30, 0x13, 0x72, 0x04, 0xC0, 0x41, 0x66, 0x36, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 
-    0xC0, 0x41, 0x67, 0x2C, 0x24, 0x6C, 0x00, 0x08, 0x20, 0x0A, 0x67, 0x24, 0x20, 0x6C, 0x00, 0x04, 
-    0xB1, 0xCA, 0x63, 0x1C, 0x20, 0x6E, 0xFF, 0xFC, 0x24, 0x50, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x70, 
-    0x58, 0x4F, 0x72, 0xFF, 0xB0, 0x81, 0x66, 0xCA, 0x20, 0x6C, 0x00, 0x04, 0xB1, 0xCA, 0x66, 0xC2, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC0, 0x41, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 
-    0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x18, 0x28, 0x28, 0x6E, 0x00, 0x0A, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x52, 0xC0, 0x41, 0x72, 0x42, 0xB0, 0x41, 0x66, 0x3A, 0x20, 0x6C, 0x00, 0x04, 
-    0x22, 0x6C, 0x00, 0x0C, 0xB1, 0xC9, 0x64, 0x7A, 0x16, 0x2E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x10, 0x83, 0x70, 0x0D, 0xB6, 0x00, 0x66, 0x4E, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x00, 0xFE, 0x58, 0x4F, 0x78, 0xFF, 0xB0, 0x84, 0x66, 0x04, 0x20, 0x04, 0x60, 0x04, 0x70, 0x00, 
-    0x10, 0x03, 0x4E, 0xFA, 0x00, 0xD8, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x16, 0xC0, 0x41, 0x72, 0x06, 
-    0xB0, 0x41, 0x66, 0x3E, 0x1D, 0x6E, 0x00, 0x08, 0xFF, 0xF8, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xF8, 0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x5A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x72, 0x01, 0xB0, 0x81, 0x66, 0x0C, 0x12, 0x2E, 0x00, 0x08, 0x70, 0x00, 
-    0x10, 0x01, 0x4E, 0xFA, 0x00, 0x98, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x4E, 0xFA, 
-    0x00, 0x8C, 0x36, 0x2C, 0x00, 0x12, 0x70, 0x12, 0x3D, 0x43, 0xFF, 0xFC, 0xC6, 0x40, 0x70, 0x02, 
-    0xB6, 0x40, 0x66, 0x1E, 0x24, 0x6C, 0x00, 0x08, 0x20, 0x0A, 0x67, 0x16, 0x20, 0x6C, 0x00, 0x04, 
-    0xB1, 0xCA, 0x66, 0x1C, 0x4A, 0x94, 0x66, 0x18, 0x30, 0x2E, 0xFF, 0xFC, 0x72, 0x44, 0xC0, 0x41, 
-    0x66, 0x0E, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x3C, 0x58, 0x4F, 0x4A, 0x80, 0x67, 0x0A, 0x60, 0x04, 
-    0x70, 0x00, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x44, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x52, 0x58, 0x4F, 
-    0x72, 0xFF, 0xB0, 0x81, 0x67, 0x20, 0x53, 0x94, 0x20, 0x14, 0x6B, 0x0E, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x10, 0xAE, 0x00, 0x08, 0x60, 0x0C, 0x2F, 0x0C, 0x1F, 0x2E, 0x00, 0x08, 
-    0x4E, 0xBA, 0xFE, 0xF0, 0x5C, 0x4F, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC0, 0x41, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x08, 0x12, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x10, 0x01, 0x4C, 0xDF, 0x14, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF0, 0x48, 0xE7, 0x17, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x4B, 0x58, 0x4A, 0x20, 0x12, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2E, 0x13, 0x2A, 0x12, 0x28, 0x6B, 0x00, 0x08, 0x9A, 0x8C, 0x24, 0x8C, 
-    0x30, 0x2B, 0x00, 0x12, 0x72, 0x44, 0xC0, 0x41, 0x67, 0x04, 0x70, 0x00, 0x60, 0x08, 0x32, 0x2B, 
-    0x00, 0x10, 0x70, 0x00, 0x30, 0x01, 0x26, 0x80, 0x22, 0x2B, 0x00, 0x0C, 0x92, 0x92, 0x76, 0x00, 
-    0xB0, 0x83, 0x6A, 0x04, 0x24, 0x03, 0x60, 0x02, 0x24, 0x00, 0xB2, 0x82, 0x6C, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xBA, 0x01, 0x24, 0x58, 0x4F, 0x76, 0x00, 0xBA, 0x83, 0x6F, 0x60, 0x2F, 0x05, 0x2F, 0x0C, 
-    0x32, 0x2B, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x5A, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2C, 0x00, 0xBC, 0x85, 0x67, 0x44, 0x00, 0x6B, 0x00, 0x20, 0x00, 0x12, 0xBC, 0x83, 
-    0x6E, 0x0A, 0x27, 0x6E, 0xFF, 0xF0, 0x00, 0x04, 0x26, 0x87, 0x60, 0x2C, 0x20, 0x05, 0x90, 0x86, 
-    0x26, 0x80, 0x20, 0x6B, 0x00, 0x08, 0xD1, 0xC0, 0x27, 0x48, 0x00, 0x04, 0x2F, 0x13, 0x24, 0x6B, 
-    0x00, 0x08, 0x2D, 0x4A, 0xFF, 0xFC, 0xD5, 0xC6, 0x2F, 0x0A, 0x20, 0x6E, 0xFF, 0xFC, 0x2F, 0x08, 
-    0x4E, 0xAD, 0x01, 0x0A, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 
-    0x1C, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x78, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x10, 0x26, 0x6E, 0x00, 0x08, 0x36, 0x2B, 
-    0x00, 0x12, 0x70, 0x12, 0x3D, 0x43, 0xFF, 0xFC, 0xC6, 0x40, 0x70, 0x02, 0xB6, 0x40, 0x67, 0x24, 
-    0x30, 0x2E, 0xFF, 0xFC, 0x02, 0x40, 0x00, 0x82, 0x66, 0x0A, 0x00, 0x6B, 0x00, 0x20, 0x00, 0x12, 
-    0x70, 0xFF, 0x60, 0x60, 0x30, 0x2B, 0x00, 0x12, 0x72, 0xEF, 0xC0, 0x41, 0x72, 0x02, 0x80, 0x41, 
-    0x37, 0x40, 0x00, 0x12, 0x4A, 0xAB, 0x00, 0x04, 0x66, 0x08, 0x2F, 0x0B, 0x4E, 0xBA, 0xFA, 0xE0, 
-    0x58, 0x4F, 0x20, 0x6B, 0x00, 0x04, 0x22, 0x6B, 0x00, 0x08, 0xB1, 0xC9, 0x66, 0x34, 0x30, 0x2B, 
-    0x00, 0x12, 0x72, 0x44, 0xC0, 0x41, 0x66, 0x2A, 0x32, 0x2B, 0x00, 0x10, 0x70, 0x00, 0x30, 0x01, 
-    0x26, 0x80, 0x22, 0x2B, 0x00, 0x0C, 0x92, 0xAB, 0x00, 0x04, 0x76, 0x00, 0xB0, 0x83, 0x6A, 0x04, 
-    0x24, 0x03, 0x60, 0x02, 0x24, 0x00, 0xB2, 0x82, 0x6C, 0x08, 0x2F, 0x0B, 0x4E, 0xBA, 0x00, 0x18, 
-    0x58, 0x4F, 0x70, 0x00, 0x4C, 0xDF, 0x08, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x77, 0x72, 
-    0x74, 0x63, 0x68, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x08, 0x10, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x2B, 0x00, 0x0C, 0x98, 0xAB, 0x00, 0x04, 0x6A, 0x0A, 0x20, 0x2B, 0x00, 0x0C, 
-    0x27, 0x40, 0x00, 0x04, 0x60, 0x08, 0x20, 0x13, 0xB0, 0x84, 0x6F, 0x02, 0x26, 0x84, 0x4C, 0xDF, 
-    0x08, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x62, 0x75, 0x66, 0x73, 0x79, 0x6E, 0x63, 0x00, 
-    0x00, 0x00, 0x2F, 0x0B, 0x47, 0xED, 0xF3, 0x88, 0x60, 0x16, 0x30, 0x13, 0x02, 0x40, 0x00, 0x83, 
-    0x66, 0x0A, 0x20, 0x4B, 0x70, 0xEE, 0xD1, 0xC0, 0x20, 0x08, 0x60, 0x12, 0x70, 0x16, 0xD7, 0xC0, 
-    0x20, 0x6D, 0xF6, 0xE6, 0x70, 0x12, 0xD1, 0xC0, 0xB1, 0xCB, 0x62, 0xDE, 0x70, 0x00, 0x26, 0x5F, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x20, 0x0C, 0x66, 0x0C, 0x70, 0x17, 0x2B, 0x40, 0xF6, 0xF2, 
-    0x70, 0x00, 0x4E, 0xFA, 0x01, 0x24, 0x20, 0x0A, 0x67, 0x00, 0x00, 0xAC, 0x4A, 0x12, 0x67, 0x00, 
-    0x00, 0xA6, 0x16, 0x2B, 0x00, 0x01, 0x78, 0x2B, 0xB6, 0x04, 0x67, 0x10, 0x4A, 0x03, 0x67, 0x08, 
-    0x10, 0x2B, 0x00, 0x02, 0xB0, 0x04, 0x67, 0x04, 0x7A, 0x00, 0x60, 0x02, 0x7A, 0x01, 0x78, 0x62, 
-    0xB6, 0x04, 0x67, 0x10, 0x4A, 0x03, 0x67, 0x08, 0x10, 0x2B, 0x00, 0x02, 0xB0, 0x04, 0x67, 0x04, 
-    0x7C, 0x00, 0x60, 0x02, 0x7C, 0x01, 0x78, 0x70, 0xB6, 0x04, 0x67, 0x1E, 0x4A, 0x03, 0x67, 0x08, 
-    0x10, 0x2B, 0x00, 0x02, 0xB0, 0x04, 0x67, 0x12, 0x4A, 0x2B, 0x00, 0x02, 0x67, 0x08, 0x10, 0x2B, 
-    0x00, 0x03, 0xB0, 0x04, 0x67, 0x04, 0x7E, 0x00, 0x60, 0x02, 0x7E, 0x01, 0x10, 0x13, 0x48, 0x80, 
-    0x48, 0xC0, 0x72, 0x77, 0xB0, 0x81, 0x67, 0x0E, 0x72, 0x61, 0xB0, 0x81, 0x67, 0x1A, 0x72, 0x72, 
-    0xB0, 0x81, 0x67, 0x26, 0x60, 0x30, 0x4A, 0x85, 0x67, 0x04, 0x76, 0x02, 0x60, 0x02, 0x76, 0x01, 
-    0x00, 0x83, 0x00, 0x00, 0x03, 0x00, 0x60, 0x28, 0x4A, 0x85, 0x67, 0x04, 0x76, 0x02, 0x60, 0x02, 
-    0x76, 0x01, 0x00, 0x83, 0x00, 0x00, 0x01, 0x08, 0x60, 0x16, 0x4A, 0x85, 0x67, 0x04, 0x76, 0x02, 
-    0x60, 0x02, 0x76, 0x00, 0x60, 0x0A, 0x70, 0x16, 0x2B, 0x40, 0xF6, 0xF2, 0x70, 0x00, 0x60, 0x68, 
-    0x4A, 0x86, 0x67, 0x06, 0x00, 0x83, 0x00, 0x00, 0x08, 0x00, 0x4A, 0x87, 0x67, 0x06, 0x00, 0x83, 
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x03, 0x2F, 0x0A, 0x4E, 0xAD, 0x01, 0x42, 0x50, 0x4F, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x4A, 0x80, 0x6A, 0x04, 0x70, 0x00, 0x60, 0x3E, 0x70, 0x00, 0x28, 0x80, 0x39, 0x6E, 
-    0xFF, 0xFE, 0x00, 0x14, 0x4A, 0x85, 0x67, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x60, 0x0E, 
-    0x10, 0x13, 0x72, 0x72, 0xB0, 0x01, 0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x02, 0x39, 0x40, 
-    0x00, 0x12, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x08, 
-    0x42, 0x40, 0x39, 0x40, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x88, 0x5F, 0x65, 0x6E, 0x64, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0xBA, 0xFE, 0x70, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xFE, 0x92, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 
-    0xFE, 0xF0, 0x2F, 0x03, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xAD, 0x01, 0x7A, 
-    0x50, 0x4F, 0x26, 0x00, 0x6A, 0x08, 0x70, 0x16, 0x2B, 0x40, 0xF6, 0xF2, 0x60, 0x3A, 0x55, 0x4F, 
-    0x48, 0x6E, 0xFF, 0x00, 0x42, 0x67, 0x48, 0x6E, 0xFE, 0xF0, 0x4E, 0xAD, 0x01, 0xA2, 0x30, 0x1F, 
-    0x66, 0x20, 0x2D, 0x6E, 0x00, 0x0C, 0xFE, 0xF4, 0x2D, 0x6E, 0x00, 0x10, 0xFE, 0xF0, 0x55, 0x4F, 
-    0x48, 0x6E, 0xFF, 0x00, 0x42, 0x67, 0x48, 0x6E, 0xFE, 0xF0, 0x4E, 0xAD, 0x01, 0xAA, 0x54, 0x4F, 
-    0x60, 0x06, 0x70, 0x05, 0x2B, 0x40, 0xF6, 0xF2, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x66, 
-    0x73, 0x65, 0x74, 0x66, 0x69, 0x6C, 0x65, 0x69, 0x6E, 0x66, 0x6F, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x28, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x2E, 
-    0x00, 0x10, 0x02, 0x6C, 0xFF, 0xEF, 0x00, 0x12, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x01, 0x3D, 0x40, 
-    0xFF, 0xFC, 0xC0, 0x41, 0x67, 0x00, 0x00, 0xA8, 0x70, 0x02, 0xB8, 0x80, 0x6C, 0x6A, 0x4A, 0xAC, 
-    0x00, 0x08, 0x67, 0x64, 0x30, 0x2E, 0xFF, 0xFC, 0x72, 0x04, 0xC0, 0x41, 0x66, 0x5A, 0x2C, 0x14, 
-    0x2A, 0x07, 0x4A, 0x84, 0x66, 0x26, 0x20, 0x06, 0x24, 0x40, 0x72, 0x01, 0x2F, 0x01, 0x42, 0xA7, 
-    0x34, 0x2C, 0x00, 0x14, 0x72, 0x00, 0x32, 0x02, 0x2F, 0x01, 0x4E, 0xAD, 0x01, 0x72, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x22, 0x00, 0x20, 0x0A, 0x90, 0x81, 0xDA, 0x80, 0x60, 0x02, 0x9E, 0x86, 0x30, 0x2C, 
-    0x00, 0x12, 0x02, 0x40, 0x00, 0x80, 0x66, 0x20, 0x4A, 0x86, 0x6F, 0x1C, 0xBA, 0x86, 0x6E, 0x18, 
-    0x20, 0x2C, 0x00, 0x08, 0x90, 0xAC, 0x00, 0x04, 0xB0, 0x85, 0x6E, 0x0C, 0xDB, 0xAC, 0x00, 0x04, 
-    0x9B, 0x94, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0x8A, 0x30, 0x2C, 0x00, 0x12, 0x02, 0x40, 0x00, 0x80, 
-    0x67, 0x0E, 0x20, 0x2C, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 0x02, 0x6C, 0xFF, 0xFE, 0x00, 0x12, 
-    0x2F, 0x04, 0x2F, 0x07, 0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x01, 0x72, 0x4F, 0xEF, 0x00, 0x0C, 0x2A, 0x00, 0x70, 0x00, 0x28, 0x80, 0x60, 0x46, 0x24, 0x4C, 
-    0x70, 0x12, 0xD5, 0xC0, 0x30, 0x12, 0x02, 0x40, 0x00, 0x82, 0x67, 0x38, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xF9, 0x4C, 0x58, 0x4F, 0x30, 0x12, 0x02, 0x40, 0x00, 0x80, 0x67, 0x10, 0x70, 0x00, 0x28, 0x80, 
-    0x02, 0x52, 0xFF, 0xFD, 0x20, 0x2C, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 0x2F, 0x04, 0x2F, 0x07, 
-    0x32, 0x2C, 0x00, 0x14, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0x72, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2A, 0x00, 0x76, 0xFF, 0xBA, 0x83, 0x66, 0x04, 0x20, 0x03, 0x60, 0x02, 0x70, 0x00, 
-    0x4C, 0xDF, 0x14, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x73, 0x65, 0x65, 0x6B, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0B, 0x26, 0x6E, 0x00, 0x0C, 0x0C, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x08, 0x67, 0x2C, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x01, 0xC0, 0x41, 0x67, 0x0C, 0x20, 0x6B, 
-    0x00, 0x04, 0x22, 0x6B, 0x00, 0x08, 0xB1, 0xC9, 0x62, 0x1A, 0x20, 0x6B, 0x00, 0x04, 0x22, 0x6B, 
-    0x00, 0x08, 0xB1, 0xC9, 0x66, 0x0A, 0x4A, 0x93, 0x66, 0x06, 0x52, 0xAB, 0x00, 0x04, 0x60, 0x04, 
-    0x70, 0xFF, 0x60, 0x12, 0x53, 0xAB, 0x00, 0x04, 0x20, 0x6B, 0x00, 0x04, 0x10, 0xAE, 0x00, 0x0B, 
-    0x52, 0x93, 0x20, 0x2E, 0x00, 0x08, 0x26, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x75, 0x6E, 0x67, 
-    0x65, 0x74, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x94, 0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0E, 0x24, 0x6E, 0x00, 0x12, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xA0, 
-    0x30, 0x13, 0x3D, 0x40, 0xFF, 0xAA, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0xB0, 0x20, 0x2B, 0x00, 0x02, 
-    0x2D, 0x40, 0xFF, 0xC4, 0x20, 0x4B, 0x5C, 0x48, 0x2D, 0x48, 0xFF, 0xA6, 0x41, 0xEE, 0xFF, 0x94, 
-    0x70, 0x09, 0xA2, 0x60, 0x36, 0x00, 0x10, 0x2E, 0xFF, 0xB2, 0x72, 0x10, 0xC0, 0x01, 0x56, 0xC0, 
-    0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x18, 0x80, 0x4A, 0x00, 0x67, 0x04, 0x42, 0x12, 0x60, 0x14, 
-    0x30, 0x2E, 0xFF, 0xBC, 0x02, 0x40, 0x80, 0x00, 0x4A, 0x40, 0x56, 0xC0, 0x44, 0x00, 0x48, 0x80, 
-    0x48, 0xC0, 0x14, 0x80, 0x10, 0x2E, 0x00, 0x0C, 0x67, 0x00, 0x00, 0xAA, 0x4A, 0x12, 0x67, 0x00, 
-    0x00, 0xA4, 0x20, 0x2E, 0xFF, 0xB4, 0x0C, 0x80, 0x66, 0x61, 0x61, 0x6D, 0x67, 0x00, 0x00, 0x8E, 
-    0x0C, 0x80, 0x66, 0x61, 0x64, 0x72, 0x67, 0x00, 0x00, 0x84, 0x0C, 0x80, 0x66, 0x61, 0x63, 0x74, 
-    0x67, 0x7A, 0x0C, 0x80, 0x66, 0x61, 0x65, 0x74, 0x67, 0x72, 0x0C, 0x80, 0x66, 0x61, 0x65, 0x78, 
-    0x67, 0x6A, 0x0C, 0x80, 0x73, 0x72, 0x76, 0x72, 0x67, 0x62, 0x0C, 0x80, 0x66, 0x6C, 0x70, 0x79, 
-    0x67, 0x5A, 0x0C, 0x80, 0x66, 0x64, 0x72, 0x70, 0x67, 0x52, 0x0C, 0x80, 0x68, 0x64, 0x73, 0x6B, 
-    0x67, 0x4A, 0x0C, 0x80, 0x66, 0x61, 0x6D, 0x6E, 0x67, 0x42, 0x0C, 0x80, 0x64, 0x72, 0x6F, 0x70, 
-    0x67, 0x3A, 0x0C, 0x80, 0x66, 0x61, 0x70, 0x66, 0x67, 0x32, 0x0C, 0x80, 0x66, 0x61, 0x70, 0x6E, 
-    0x67, 0x2A, 0x0C, 0x80, 0x66, 0x61, 0x73, 0x68, 0x67, 0x22, 0x0C, 0x80, 0x66, 0x61, 0x73, 0x74, 
-    0x67, 0x1A, 0x0C, 0x80, 0x66, 0x61, 0x73, 0x79, 0x67, 0x12, 0x0C, 0x80, 0x74, 0x72, 0x73, 0x68, 
-    0x67, 0x0A, 0x0C, 0x80, 0x66, 0x6C, 0x64, 0x72, 0x67, 0x02, 0x60, 0x06, 0x18, 0xBC, 0x00, 0x01, 
-    0x60, 0x02, 0x42, 0x14, 0x30, 0x03, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 
-    0x47, 0x65, 0x74, 0x41, 0x6C, 0x69, 0x61, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xB8, 0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 0x00, 0x16, 0x28, 0x6E, 0x00, 0x22, 0x55, 0x4F, 
-    0x3F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0A, 0x2F, 0x2E, 0x00, 0x0E, 0x2F, 0x0B, 0x70, 0x01, 
-    0xAA, 0x52, 0x36, 0x1F, 0x67, 0x08, 0x70, 0xD5, 0xB6, 0x40, 0x66, 0x00, 0x00, 0x86, 0x10, 0x2E, 
-    0x00, 0x12, 0x66, 0x1E, 0x10, 0x2E, 0x00, 0x14, 0x67, 0x18, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x1A, 
-    0x70, 0x01, 0x1F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0x7E, 0x4F, 0xEF, 0x00, 0x0E, 0x36, 0x00, 
-    0x60, 0x56, 0x24, 0x4B, 0x41, 0xEE, 0xFF, 0xB8, 0x70, 0x10, 0x20, 0xDA, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0x92, 0x55, 0x4F, 0x2F, 0x0B, 0x70, 0x01, 0x1F, 0x00, 0x2F, 0x2E, 0x00, 0x1A, 0x2F, 0x0C, 
-    0x70, 0x0C, 0xA8, 0x23, 0x36, 0x1F, 0x4A, 0x14, 0x67, 0x2E, 0x70, 0xD5, 0xB6, 0x40, 0x66, 0x28, 
-    0x30, 0x13, 0xB0, 0x6E, 0xFF, 0xB8, 0x66, 0x20, 0x20, 0x2B, 0x00, 0x02, 0xB0, 0xAE, 0xFF, 0xBA, 
-    0x66, 0x16, 0x55, 0x4F, 0x48, 0x6E, 0xFF, 0xBE, 0x20, 0x4B, 0x5C, 0x48, 0x2F, 0x08, 0x4E, 0xAD, 
-    0x01, 0x92, 0x30, 0x1F, 0x66, 0x02, 0x76, 0xF7, 0x4A, 0x43, 0x67, 0x0A, 0x0C, 0x43, 0xFF, 0xD5, 
-    0x67, 0x04, 0x30, 0x03, 0x60, 0x3C, 0x0C, 0x43, 0xFF, 0xD5, 0x66, 0x0A, 0x10, 0x2E, 0x00, 0x14, 
-    0x66, 0x04, 0x70, 0x88, 0x60, 0x2C, 0x10, 0x2E, 0x00, 0x12, 0x66, 0x10, 0x10, 0x2E, 0x00, 0x14, 
-    0x67, 0x0A, 0x4A, 0x14, 0x67, 0x06, 0x20, 0x6E, 0x00, 0x1A, 0x42, 0x10, 0x24, 0x6E, 0x00, 0x1E, 
-    0x4A, 0x12, 0x66, 0x08, 0x4A, 0x14, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x14, 0x80, 
-    0x30, 0x03, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x52, 0x65, 0x73, 0x6F, 
-    0x6C, 0x76, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x6C, 0x69, 0x61, 0x73, 0x00, 0x00, 0x4E, 0x56, 
-    0xFE, 0xE4, 0x48, 0xE7, 0x1E, 0x38, 0x3A, 0x2E, 0x00, 0x08, 0x2C, 0x2E, 0x00, 0x0A, 0x20, 0x2E, 
-    0x00, 0x0E, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x0E, 0x4A, 0x10, 0x66, 0x44, 0x42, 0x03, 0x24, 0x6E, 
-    0x00, 0x18, 0x14, 0x83, 0x20, 0x6E, 0x00, 0x1C, 0x10, 0x83, 0x26, 0x6E, 0x00, 0x20, 0x16, 0x83, 
-    0x55, 0x4F, 0x3F, 0x05, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0E, 0x2F, 0x2E, 0x00, 0x14, 0x70, 0x01, 
-    0xAA, 0x52, 0x38, 0x1F, 0x66, 0x14, 0x2F, 0x0B, 0x2F, 0x0A, 0x42, 0x27, 0x2F, 0x2E, 0x00, 0x14, 
-    0x4E, 0xBA, 0xFD, 0x64, 0x4F, 0xEF, 0x00, 0x0E, 0x38, 0x00, 0x30, 0x04, 0x4E, 0xFA, 0x02, 0x88, 
-    0x42, 0x44, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0xEC, 0x24, 0x6E, 0x00, 0x0E, 0x10, 0x12, 0x1D, 0x40, 
-    0xFE, 0xF2, 0x2D, 0x4A, 0xFE, 0xE8, 0x49, 0xEE, 0xFE, 0xF4, 0x42, 0x03, 0x1D, 0x43, 0xFE, 0xF4, 
-    0x20, 0x6E, 0x00, 0x1C, 0x10, 0x83, 0x1D, 0x43, 0xFE, 0xF3, 0x72, 0x00, 0x12, 0x00, 0xD2, 0x8A, 
-    0x2D, 0x41, 0xFF, 0xF4, 0x24, 0x6E, 0x00, 0x14, 0x54, 0x4A, 0x2D, 0x4A, 0xFF, 0xF8, 0x20, 0x6E, 
-    0x00, 0x14, 0x5C, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 0x60, 0x00, 0x02, 0x18, 0x20, 0x6E, 0xFE, 0xE8, 
-    0x52, 0x48, 0x2D, 0x48, 0xFE, 0xE4, 0x60, 0x04, 0x52, 0xAE, 0xFE, 0xE4, 0x24, 0x6E, 0xFE, 0xE8, 
-    0x12, 0x12, 0x70, 0x00, 0x10, 0x01, 0xD0, 0x8A, 0x20, 0x40, 0x26, 0x6E, 0xFE, 0xE4, 0xB1, 0xCB, 
-    0x63, 0x08, 0x10, 0x13, 0x72, 0x3A, 0xB0, 0x01, 0x67, 0xDE, 0x53, 0xAE, 0xFE, 0xE4, 0x20, 0x6E, 
-    0xFE, 0xE4, 0xB1, 0xCA, 0x67, 0x14, 0x10, 0x10, 0x1D, 0x40, 0xFE, 0xF0, 0x10, 0x12, 0x12, 0x2E, 
-    0xFE, 0xE7, 0x92, 0x2E, 0xFE, 0xEB, 0x90, 0x01, 0x10, 0x80, 0x24, 0x6E, 0xFE, 0xE4, 0x16, 0x12, 
-    0x70, 0x01, 0xB6, 0x00, 0x62, 0x04, 0x70, 0x00, 0x60, 0x16, 0x70, 0x00, 0x10, 0x03, 0x2F, 0x00, 
-    0x70, 0x3A, 0x2F, 0x00, 0x52, 0x4A, 0x2F, 0x0A, 0x4E, 0xAD, 0x01, 0x02, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2D, 0x40, 0xFE, 0xEC, 0x20, 0x6E, 0xFE, 0xE4, 0xB1, 0xEE, 0xFE, 0xE8, 0x67, 0x06, 0x10, 0xAE, 
-    0xFE, 0xF0, 0x60, 0x48, 0x10, 0x2E, 0xFE, 0xF3, 0x66, 0x42, 0x20, 0x6E, 0xFF, 0xF4, 0xB1, 0xEE, 
-    0xFE, 0xEC, 0x66, 0x38, 0x55, 0x4F, 0x3F, 0x05, 0x2F, 0x06, 0x2F, 0x2E, 0xFE, 0xE8, 0x2F, 0x2E, 
-    0x00, 0x14, 0x70, 0x01, 0xAA, 0x52, 0x38, 0x1F, 0x30, 0x04, 0x57, 0xC0, 0x44, 0x00, 0x48, 0x80, 
-    0x48, 0xC0, 0x20, 0x6E, 0x00, 0x18, 0x10, 0x80, 0x42, 0x00, 0x20, 0x6E, 0x00, 0x20, 0x10, 0x80, 
-    0x20, 0x6E, 0x00, 0x1C, 0x10, 0x80, 0x30, 0x04, 0x4E, 0xFA, 0x01, 0x6C, 0x26, 0x2E, 0xFE, 0xEC, 
-    0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x67, 0x24, 0x24, 0x6E, 0xFE, 0xE8, 0x10, 0x12, 
-    0x1D, 0x40, 0xFE, 0xF1, 0x10, 0x2E, 0xFE, 0xEF, 0x90, 0x2E, 0xFE, 0xEB, 0x53, 0x00, 0x14, 0x80, 
-    0x10, 0x2E, 0xFE, 0xF1, 0x90, 0x12, 0x53, 0x00, 0x20, 0x6E, 0xFE, 0xEC, 0x10, 0x80, 0x10, 0x2E, 
-    0xFE, 0xF3, 0x66, 0x44, 0x20, 0x6E, 0xFE, 0xE4, 0xB1, 0xEE, 0xFE, 0xE8, 0x66, 0x3A, 0x20, 0x2E, 
-    0xFE, 0xEC, 0x67, 0x34, 0x24, 0x6E, 0xFE, 0xE8, 0x12, 0x12, 0x70, 0x00, 0x10, 0x01, 0x52, 0x80, 
-    0x2F, 0x00, 0x2F, 0x0A, 0x48, 0x6E, 0xFE, 0xF4, 0x4E, 0xAD, 0x01, 0x0A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x52, 0x2E, 0xFE, 0xF4, 0x12, 0x2E, 0xFE, 0xF4, 0x70, 0x00, 0x10, 0x01, 0x41, 0xEE, 0xFE, 0xF4, 
-    0x11, 0xBC, 0x00, 0x3A, 0x00, 0x00, 0x60, 0x2E, 0x24, 0x6E, 0xFE, 0xE8, 0x12, 0x12, 0x70, 0x00, 
-    0x10, 0x01, 0x52, 0x80, 0x2F, 0x00, 0x2F, 0x0A, 0x2F, 0x0C, 0x4E, 0xAD, 0x01, 0x0A, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x41, 0xEE, 0xFE, 0xF4, 0xB9, 0xC8, 0x67, 0x0C, 0x10, 0x14, 0x52, 0x00, 0xD1, 0x2E, 
-    0xFE, 0xF4, 0x18, 0xBC, 0x00, 0x3A, 0x2F, 0x2E, 0x00, 0x20, 0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x2E, 
-    0x00, 0x18, 0x2F, 0x2E, 0x00, 0x14, 0x26, 0x2E, 0xFE, 0xEC, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x1F, 0x03, 0x1F, 0x2E, 0x00, 0x12, 0x48, 0x6E, 0xFE, 0xF4, 0x2F, 0x06, 0x3F, 0x05, 
-    0x4E, 0xBA, 0xFC, 0x9C, 0x4F, 0xEF, 0x00, 0x1E, 0x38, 0x00, 0x76, 0x3A, 0x20, 0x6E, 0xFE, 0xE8, 
-    0x10, 0x83, 0x4A, 0x44, 0x67, 0x06, 0x70, 0xD5, 0xB8, 0x40, 0x66, 0x5E, 0x2D, 0x6E, 0xFE, 0xEC, 
-    0xFE, 0xE8, 0x20, 0x2E, 0xFE, 0xEC, 0x67, 0x46, 0x20, 0x6E, 0x00, 0x14, 0x3A, 0x10, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x2C, 0x10, 0x24, 0x6E, 0xFF, 0xFC, 0x12, 0x12, 0x70, 0x00, 0x10, 0x01, 0x52, 0x80, 
-    0x2F, 0x00, 0x2F, 0x0A, 0x48, 0x6E, 0xFE, 0xF5, 0x4E, 0xAD, 0x01, 0x0A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x10, 0x2E, 0xFE, 0xF5, 0x52, 0x00, 0x1D, 0x40, 0xFE, 0xF4, 0x1D, 0x43, 0xFE, 0xF5, 0x12, 0x2E, 
-    0xFE, 0xF4, 0x70, 0x00, 0x10, 0x01, 0x41, 0xEE, 0xFE, 0xF5, 0xD0, 0x88, 0x28, 0x40, 0x52, 0x2E, 
-    0xFE, 0xF3, 0x20, 0x2E, 0xFE, 0xE8, 0x66, 0x00, 0xFD, 0xE4, 0x4A, 0x44, 0x67, 0x0E, 0x20, 0x2E, 
-    0xFE, 0xEC, 0x67, 0x08, 0x20, 0x6E, 0xFE, 0xEC, 0x10, 0xBC, 0x00, 0x3A, 0x20, 0x6E, 0x00, 0x0E, 
-    0x10, 0xAE, 0xFE, 0xF2, 0x30, 0x04, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x52, 
-    0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x41, 0x6C, 0x69, 0x61, 
-    0x73, 0x65, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xB8, 0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 
-    0x00, 0x12, 0x28, 0x6E, 0x00, 0x1E, 0x55, 0x4F, 0x3F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0A, 
-    0x2F, 0x2E, 0x00, 0x0E, 0x2F, 0x0B, 0x70, 0x01, 0xAA, 0x52, 0x36, 0x1F, 0x30, 0x03, 0x32, 0x00, 
-    0x48, 0xC1, 0x67, 0x08, 0x70, 0xD5, 0xB2, 0x80, 0x67, 0x62, 0x60, 0x72, 0x24, 0x4B, 0x41, 0xEE, 
-    0xFF, 0xB8, 0x70, 0x10, 0x20, 0xDA, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0x92, 0x55, 0x4F, 0x2F, 0x0B, 
-    0x70, 0x01, 0x1F, 0x00, 0x2F, 0x2E, 0x00, 0x16, 0x2F, 0x0C, 0x70, 0x0C, 0xA8, 0x23, 0x36, 0x1F, 
-    0x4A, 0x14, 0x67, 0x2E, 0x70, 0xD5, 0xB6, 0x40, 0x66, 0x28, 0x30, 0x13, 0xB0, 0x6E, 0xFF, 0xB8, 
-    0x66, 0x20, 0x20, 0x2B, 0x00, 0x02, 0xB0, 0xAE, 0xFF, 0xBA, 0x66, 0x16, 0x55, 0x4F, 0x48, 0x6E, 
-    0xFF, 0xBE, 0x20, 0x4B, 0x5C, 0x48, 0x2F, 0x08, 0x4E, 0xAD, 0x01, 0x92, 0x30, 0x1F, 0x66, 0x02, 
-    0x76, 0xF7, 0x10, 0x14, 0x20, 0x6E, 0x00, 0x1A, 0x10, 0x80, 0x60, 0x38, 0x42, 0x00, 0x18, 0x80, 
-    0x20, 0x6E, 0x00, 0x1A, 0x10, 0x80, 0x20, 0x6E, 0x00, 0x16, 0x10, 0x80, 0x60, 0x26, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x1A, 0x2F, 0x2E, 0x00, 0x16, 0x2F, 0x0B, 0x70, 0x01, 0x1F, 0x00, 0x2F, 0x2E, 
-    0x00, 0x0E, 0x2F, 0x2E, 0x00, 0x0A, 0x3F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFC, 0x32, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x36, 0x00, 0x30, 0x03, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x4D, 
-    0x61, 0x6B, 0x65, 0x52, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x46, 0x53, 0x53, 0x70, 0x65, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xAC, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x10, 0x2D, 0xF8, 0x08, 0x67, 0x00, 0x00, 0x8C, 0x48, 0x6E, 0xFF, 0xAE, 0x48, 0x6E, 0xFF, 0xAD, 
-    0x48, 0x6E, 0xFF, 0xAC, 0x48, 0x6E, 0xFF, 0xB8, 0x24, 0x4C, 0x2F, 0x2A, 0x00, 0x12, 0x2F, 0x2A, 
-    0x00, 0x30, 0x3F, 0x2A, 0x00, 0x16, 0x4E, 0xBA, 0xFE, 0xDE, 0x4F, 0xEF, 0x00, 0x1A, 0x36, 0x00, 
-    0x10, 0x2E, 0xFF, 0xAC, 0x67, 0x06, 0x30, 0x3C, 0xFA, 0xEA, 0x60, 0x5A, 0x30, 0x03, 0x66, 0x4E, 
-    0x10, 0x2E, 0xFF, 0xAD, 0x67, 0x4C, 0x24, 0x4C, 0x35, 0x6E, 0xFF, 0xB8, 0x00, 0x16, 0x25, 0x6E, 
-    0xFF, 0xBA, 0x00, 0x30, 0x12, 0x2E, 0xFF, 0xBE, 0x70, 0x00, 0x10, 0x01, 0x47, 0xEE, 0xFF, 0xBE, 
-    0xD0, 0x8B, 0x20, 0x40, 0x42, 0x28, 0x00, 0x01, 0x20, 0x2A, 0x00, 0x12, 0x2D, 0x40, 0xFF, 0xB0, 
-    0x2D, 0x4B, 0xFF, 0xB4, 0x20, 0x6E, 0xFF, 0xB4, 0x52, 0xAE, 0xFF, 0xB4, 0x10, 0x10, 0x20, 0x6E, 
-    0xFF, 0xB0, 0x52, 0xAE, 0xFF, 0xB0, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x06, 0x60, 0xE6, 0x30, 0x03, 
-    0x60, 0x04, 0x20, 0x4C, 0xA2, 0x00, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x20, 0x6E, 0x00, 0x0C, 0x53, 0x48, 0x28, 0x48, 0x52, 0x4C, 
-    0x20, 0x4C, 0x4A, 0x10, 0x67, 0x02, 0x60, 0xF6, 0x41, 0xEE, 0x00, 0x10, 0x24, 0x48, 0x20, 0x6E, 
-    0x00, 0x08, 0x4A, 0x50, 0x67, 0x30, 0x58, 0x4A, 0x20, 0x4A, 0x20, 0x28, 0xFF, 0xFC, 0x26, 0x40, 
-    0x4A, 0x80, 0x67, 0x22, 0x53, 0x4C, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0x50, 0x67, 0xE0, 0x20, 0x4B, 
-    0x52, 0x4B, 0x10, 0x10, 0x52, 0x4C, 0x20, 0x4C, 0x10, 0x80, 0x4A, 0x00, 0x67, 0xD0, 0x20, 0x6E, 
-    0x00, 0x08, 0x53, 0x50, 0x60, 0xE0, 0x20, 0x2E, 0x00, 0x0C, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x20, 0x0B, 0x67, 0x62, 0x20, 0x4B, 0x4A, 0x10, 0x67, 0x5C, 0x28, 0x4A, 0x10, 0x2D, 
-    0xF8, 0x04, 0x67, 0x2A, 0x20, 0x4B, 0x10, 0x10, 0x52, 0x00, 0x1D, 0x40, 0xFF, 0xFC, 0x10, 0x2E, 
-    0xFF, 0xFC, 0x53, 0x2E, 0xFF, 0xFC, 0x4A, 0x00, 0x67, 0x0E, 0x20, 0x4B, 0x52, 0x4B, 0x10, 0x10, 
-    0x20, 0x4C, 0x52, 0x4C, 0x10, 0x80, 0x60, 0xE6, 0x20, 0x4C, 0x42, 0x10, 0x60, 0x2E, 0x2D, 0x4B, 
-    0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x52, 0x4C, 0x20, 0x4C, 
-    0x10, 0x80, 0x4A, 0x00, 0x67, 0x02, 0x60, 0xEA, 0x20, 0x2E, 0xFF, 0xF8, 0x22, 0x0B, 0x90, 0x01, 
-    0x53, 0x00, 0x20, 0x4A, 0x10, 0x80, 0x60, 0x04, 0x20, 0x4A, 0x42, 0x10, 0x20, 0x0A, 0x4C, 0xDF, 
-    0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x32, 0x2D, 0xFC, 0xFE, 0x70, 0x00, 0x30, 0x01, 0x72, 0x10, 
-    0xC0, 0x81, 0x67, 0x04, 0x4E, 0xBA, 0x00, 0xF6, 0x55, 0x4F, 0x3F, 0x3C, 0xA1, 0xAD, 0x4E, 0xAD, 
-    0x01, 0x12, 0x10, 0x1F, 0x67, 0x48, 0x55, 0x4F, 0x2F, 0x3C, 0x66, 0x6F, 0x6C, 0x64, 0x48, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0xAD, 0x01, 0x9A, 0x30, 0x1F, 0x38, 0x00, 0x20, 0x2E, 0xFF, 0xFC, 0x72, 0x01, 
-    0xC0, 0x81, 0x67, 0x06, 0x1B, 0x7C, 0x00, 0x01, 0xF8, 0x06, 0x55, 0x4F, 0x2F, 0x3C, 0x61, 0x6C, 
-    0x69, 0x73, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xAD, 0x01, 0x9A, 0x30, 0x1F, 0x38, 0x00, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x06, 0x1B, 0x7C, 0x00, 0x01, 0xF8, 0x08, 0x10, 0x2E, 
-    0x00, 0x10, 0x67, 0x06, 0x00, 0x6D, 0x00, 0x08, 0xFE, 0x10, 0x00, 0x6D, 0x00, 0x10, 0xFC, 0xFE, 
-    0x00, 0x6D, 0x00, 0x10, 0xFE, 0x10, 0x2F, 0x0B, 0x48, 0x6D, 0xFE, 0x22, 0x4E, 0xBA, 0xFE, 0xE4, 
-    0x50, 0x4F, 0x2B, 0x40, 0xFC, 0x1C, 0x70, 0x00, 0x2B, 0x40, 0xFC, 0x16, 0x42, 0x40, 0x3B, 0x40, 
-    0xFC, 0x20, 0x42, 0x2D, 0xFC, 0x24, 0x1B, 0x7C, 0x00, 0x01, 0xFC, 0x25, 0x70, 0x00, 0x2B, 0x40, 
-    0xFC, 0x26, 0x45, 0xED, 0xF8, 0x0A, 0x2B, 0x4A, 0xFC, 0x2A, 0x26, 0x3C, 0x00, 0x00, 0x04, 0x00, 
-    0x2B, 0x43, 0xFC, 0x2E, 0x70, 0x01, 0x3B, 0x40, 0xFC, 0x36, 0x2F, 0x0C, 0x48, 0x6D, 0xFD, 0x10, 
-    0x4E, 0xBA, 0xFE, 0xA0, 0x50, 0x4F, 0x2B, 0x40, 0xFC, 0x96, 0x70, 0x00, 0x2B, 0x40, 0xFC, 0x90, 
-    0x42, 0x40, 0x3B, 0x40, 0xFC, 0x9A, 0x42, 0x2D, 0xFC, 0x9E, 0x1B, 0x7C, 0x00, 0x01, 0xFC, 0x9F, 
-    0x70, 0x00, 0x2B, 0x40, 0xFC, 0xA0, 0x2B, 0x4A, 0xFC, 0xA4, 0x2B, 0x43, 0xFC, 0xA8, 0x70, 0x01, 
-    0x3B, 0x40, 0xFC, 0xB0, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x32, 0x2D, 0xFE, 0x10, 
-    0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xC0, 0x81, 0x67, 0x06, 0x20, 0x6D, 0xFE, 0x12, 0xA0, 0x01, 
-    0x32, 0x2D, 0xFC, 0xFE, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xC0, 0x81, 0x67, 0x06, 0x20, 0x6D, 
-    0xFD, 0x00, 0xA0, 0x01, 0x70, 0x09, 0x3B, 0x40, 0xFC, 0xFE, 0x42, 0x40, 0x3B, 0x40, 0xFE, 0x10, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xE8, 0x2F, 0x03, 0x36, 0x2E, 0x00, 0x08, 0x70, 0x1E, 0x3D, 0x40, 
-    0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xE8, 0x30, 0x03, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xC2, 
-    0x50, 0x4F, 0x42, 0x2D, 0xFF, 0x26, 0x42, 0xA7, 0x48, 0x6E, 0xFF, 0xE8, 0x10, 0x2E, 0x00, 0x0A, 
-    0x67, 0x06, 0x41, 0xED, 0xFF, 0x44, 0x60, 0x04, 0x41, 0xED, 0xFF, 0x4E, 0x2F, 0x08, 0x48, 0x6D, 
-    0xFF, 0x26, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0xFD, 0x86, 0x4F, 0xEF, 0x00, 0x14, 0x26, 0x1F, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x24, 0x6E, 0x00, 0x08, 
-    0x26, 0x6E, 0x00, 0x0C, 0x36, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x12, 0x42, 0xA7, 0x2F, 0x0C, 
-    0x48, 0x6D, 0xFF, 0x56, 0x1F, 0x2E, 0x00, 0x16, 0x3F, 0x03, 0x4E, 0xBA, 0xFF, 0x86, 0x58, 0x4F, 
-    0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x0A, 0x4E, 0xBA, 0xFD, 0x46, 0x4F, 0xEF, 0x00, 0x18, 0x4C, 0xDF, 
-    0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x36, 0x2E, 0x00, 0x10, 0x24, 0x6E, 0x00, 0x12, 0x20, 0x6A, 
-    0x00, 0x02, 0xA0, 0x02, 0x38, 0x00, 0x72, 0xD9, 0xB0, 0x41, 0x66, 0x28, 0x20, 0x6A, 0x00, 0x02, 
-    0x4A, 0xA8, 0x00, 0x28, 0x66, 0x44, 0x30, 0x12, 0x72, 0x01, 0xC0, 0x01, 0x1F, 0x00, 0x48, 0x6D, 
-    0xFF, 0x58, 0x3F, 0x03, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0x7A, 0x4F, 0xEF, 0x00, 0x10, 
-    0x42, 0x00, 0x60, 0x28, 0x30, 0x04, 0x67, 0x22, 0x20, 0x6E, 0x00, 0x12, 0x30, 0x10, 0x72, 0x01, 
-    0xC0, 0x01, 0x1F, 0x00, 0x48, 0x6D, 0xFF, 0x7A, 0x3F, 0x03, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xFF, 0x54, 0x4F, 0xEF, 0x00, 0x10, 0x42, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4C, 0xDF, 0x1C, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x36, 0x2E, 0x00, 0x10, 0x70, 0x00, 0x24, 0x6E, 0x00, 0x12, 0x20, 0x6A, 
-    0x00, 0x02, 0x21, 0x40, 0x00, 0x2E, 0x2F, 0x0A, 0x3F, 0x03, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xFF, 0x56, 0x4F, 0xEF, 0x00, 0x0E, 0x4A, 0x00, 0x66, 0x06, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xFA, 
-    0x30, 0x2D, 0xF8, 0x0A, 0x38, 0x00, 0x4A, 0x40, 0x6E, 0x06, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xEA, 
-    0x41, 0xED, 0xF8, 0x0E, 0x2D, 0x48, 0xFF, 0xF8, 0x0C, 0x44, 0x00, 0xFF, 0x64, 0x06, 0x30, 0x04, 
-    0x48, 0xC0, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x88, 0xD0, 0x88, 0x20, 0x40, 
-    0x59, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 0x04, 0x44, 0x00, 0xFF, 0x20, 0x6E, 0xFF, 0xFC, 0x30, 0x10, 
-    0xB0, 0x43, 0x6D, 0x62, 0x20, 0x6E, 0xFF, 0xF8, 0x30, 0x10, 0xB0, 0x43, 0x6C, 0x06, 0x58, 0xAE, 
-    0xFF, 0xF8, 0x60, 0xF0, 0x20, 0x6E, 0xFF, 0xF8, 0x30, 0x10, 0xB0, 0x43, 0x6F, 0x06, 0x70, 0x00, 
-    0x4E, 0xFA, 0x00, 0x96, 0x20, 0x6E, 0xFF, 0xF8, 0x30, 0x28, 0x00, 0x02, 0x48, 0xC0, 0x24, 0x6E, 
-    0x00, 0x12, 0x20, 0x6A, 0x00, 0x02, 0x21, 0x40, 0x00, 0x2E, 0x2F, 0x0A, 0x3F, 0x03, 0x2F, 0x0C, 
-    0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0xC2, 0x4F, 0xEF, 0x00, 0x0E, 0x4A, 0x00, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x66, 0x42, 0xA7, 0x48, 0x6D, 0xF8, 0x0A, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0xFB, 0xE0, 
-    0x4F, 0xEF, 0x00, 0x10, 0x60, 0x52, 0x0C, 0x44, 0x00, 0x00, 0x6E, 0x04, 0x70, 0x00, 0x60, 0x48, 
-    0x2F, 0x2E, 0x00, 0x12, 0x3F, 0x03, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0x8A, 0x4F, 0xEF, 
-    0x00, 0x0E, 0x4A, 0x00, 0x66, 0x04, 0x70, 0x00, 0x60, 0x2E, 0x41, 0xED, 0xF8, 0x0A, 0x2D, 0x48, 
-    0xFF, 0xF8, 0x0C, 0x44, 0x01, 0x00, 0x64, 0x06, 0x30, 0x04, 0x48, 0xC0, 0x60, 0x06, 0x20, 0x3C, 
-    0x00, 0x00, 0x01, 0x00, 0xE5, 0x88, 0xD0, 0x88, 0x20, 0x40, 0x59, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 
-    0x04, 0x44, 0x01, 0x00, 0x60, 0x00, 0xFF, 0x44, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x1C, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x26, 0x2D, 0xF3, 0x3A, 
-    0x2D, 0x43, 0xFF, 0xFC, 0x4A, 0x83, 0x67, 0x04, 0x20, 0x0B, 0x66, 0x06, 0x70, 0x00, 0x4E, 0xFA, 
-    0x01, 0x10, 0x10, 0x2E, 0x00, 0x0C, 0x67, 0x00, 0x00, 0x8C, 0x20, 0x6E, 0xFF, 0xFC, 0x24, 0x50, 
-    0x20, 0x0A, 0x67, 0x00, 0x00, 0xFA, 0x28, 0x4A, 0x2D, 0x4B, 0xFF, 0xF8, 0x20, 0x4C, 0x52, 0x4C, 
-    0x12, 0x10, 0x70, 0x00, 0x10, 0x01, 0x2A, 0x00, 0x20, 0x05, 0x67, 0x56, 0x20, 0x4C, 0x16, 0x10, 
-    0x70, 0x61, 0xB6, 0x00, 0x65, 0x10, 0x70, 0x7A, 0xB6, 0x00, 0x62, 0x0A, 0x70, 0x00, 0x10, 0x03, 
-    0x72, 0xE0, 0xD0, 0x81, 0x60, 0x04, 0x70, 0x00, 0x10, 0x03, 0x20, 0x6E, 0xFF, 0xF8, 0x16, 0x10, 
-    0x72, 0x61, 0xB6, 0x01, 0x65, 0x10, 0x72, 0x7A, 0xB6, 0x01, 0x62, 0x0A, 0x72, 0x00, 0x12, 0x03, 
-    0x74, 0xE0, 0xD2, 0x82, 0x60, 0x04, 0x72, 0x00, 0x12, 0x03, 0xB0, 0x81, 0x66, 0x14, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x4A, 0x10, 0x66, 0x02, 0x60, 0x0A, 0x53, 0x85, 0x52, 0x4C, 0x52, 0xAE, 0xFF, 0xF8, 
-    0x60, 0xA6, 0x20, 0x05, 0x66, 0x06, 0x20, 0x0C, 0x4E, 0xFA, 0x00, 0x86, 0x58, 0xAE, 0xFF, 0xFC, 
-    0x60, 0x00, 0xFF, 0x78, 0x20, 0x6E, 0xFF, 0xFC, 0x24, 0x50, 0x20, 0x0A, 0x67, 0x70, 0x28, 0x4A, 
-    0x2D, 0x4B, 0xFF, 0xF8, 0x20, 0x4C, 0x16, 0x10, 0x70, 0x61, 0xB6, 0x00, 0x65, 0x10, 0x70, 0x7A, 
-    0xB6, 0x00, 0x62, 0x0A, 0x70, 0x00, 0x10, 0x03, 0x72, 0xE0, 0xD0, 0x81, 0x60, 0x04, 0x70, 0x00, 
-    0x10, 0x03, 0x20, 0x6E, 0xFF, 0xF8, 0x18, 0x10, 0x72, 0x61, 0xB8, 0x01, 0x65, 0x10, 0x72, 0x7A, 
-    0xB8, 0x01, 0x62, 0x0A, 0x72, 0x00, 0x12, 0x04, 0x74, 0xE0, 0xD2, 0x82, 0x60, 0x04, 0x72, 0x00, 
-    0x12, 0x04, 0xB0, 0x81, 0x66, 0x0E, 0x4A, 0x03, 0x66, 0x02, 0x60, 0x08, 0x52, 0x4C, 0x52, 0xAE, 
-    0xFF, 0xF8, 0x60, 0xB0, 0x20, 0x4C, 0x10, 0x10, 0x20, 0x6E, 0xFF, 0xF8, 0x12, 0x10, 0xB0, 0x01, 
-    0x66, 0x06, 0x52, 0x4C, 0x20, 0x0C, 0x60, 0x08, 0x58, 0xAE, 0xFF, 0xFC, 0x60, 0x86, 0x70, 0x00, 
-    0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x1C, 0x38, 
-    0x26, 0x6E, 0x00, 0x08, 0x38, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x0E, 0x42, 0x40, 0x3A, 0x00, 
-    0x3D, 0x7C, 0x00, 0xFE, 0xFF, 0xEC, 0x24, 0x4C, 0x30, 0x12, 0x72, 0x01, 0xC0, 0x01, 0x1D, 0x40, 
-    0xFF, 0xFC, 0x32, 0x12, 0x70, 0x00, 0x30, 0x01, 0x72, 0x10, 0xC0, 0x81, 0x66, 0x10, 0x70, 0x01, 
-    0x1F, 0x00, 0x42, 0xA7, 0x42, 0xA7, 0x4E, 0xBA, 0xFA, 0xEE, 0x4F, 0xEF, 0x00, 0x0A, 0x2D, 0x4B, 
-    0xFF, 0xF0, 0x10, 0x2D, 0xF8, 0x04, 0x67, 0x0C, 0x20, 0x6E, 0xFF, 0xF0, 0x52, 0xAE, 0xFF, 0xF0, 
-    0x10, 0xBC, 0x00, 0x01, 0x20, 0x6E, 0xFF, 0xF0, 0x42, 0x10, 0x24, 0x4C, 0x32, 0x12, 0x70, 0x00, 
-    0x30, 0x01, 0x72, 0x04, 0xC0, 0x81, 0x66, 0x00, 0x03, 0x2E, 0x70, 0x00, 0x20, 0x6A, 0x00, 0x02, 
-    0x21, 0x40, 0x00, 0x30, 0x10, 0x2A, 0x00, 0x12, 0x57, 0xC0, 0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 
-    0x1D, 0x40, 0xFF, 0xFD, 0x4A, 0x00, 0x67, 0x00, 0x00, 0xD0, 0x70, 0x13, 0xD5, 0xC0, 0x2D, 0x4A, 
-    0xFF, 0xF4, 0x20, 0x4C, 0x20, 0x28, 0x00, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x20, 0x6E, 0xFF, 0xF4, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x06, 
-    0x52, 0xAE, 0xFF, 0xF4, 0x60, 0xE6, 0x20, 0x2E, 0xFF, 0xF4, 0x26, 0x0C, 0x72, 0x13, 0xD6, 0x01, 
-    0x90, 0x03, 0x20, 0x4C, 0x11, 0x40, 0x00, 0x12, 0x2F, 0x28, 0x00, 0x02, 0x4E, 0xBA, 0xF8, 0xC6, 
-    0x58, 0x4F, 0x3A, 0x00, 0x4A, 0x40, 0x66, 0x08, 0x20, 0x4C, 0x00, 0x50, 0x00, 0x02, 0x60, 0x78, 
-    0x20, 0x2D, 0xF3, 0x72, 0x66, 0x72, 0x24, 0x4C, 0x70, 0x13, 0xD5, 0xC0, 0x2D, 0x4A, 0xFF, 0xF4, 
-    0x1F, 0x2D, 0xFF, 0x25, 0x20, 0x4C, 0x2F, 0x28, 0x00, 0x06, 0x4E, 0xBA, 0xFD, 0xC4, 0x5C, 0x4F, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x4A, 0x80, 0x67, 0x1A, 0x20, 0x6E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 
-    0x10, 0x10, 0x20, 0x6E, 0xFF, 0xF4, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x06, 0x52, 0xAE, 0xFF, 0xF4, 
-    0x60, 0xE6, 0x20, 0x4C, 0x20, 0x28, 0x00, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x20, 0x6E, 0xFF, 0xF4, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x06, 
-    0x52, 0xAE, 0xFF, 0xF4, 0x60, 0xE6, 0x20, 0x2E, 0xFF, 0xF4, 0x26, 0x0C, 0x72, 0x13, 0xD6, 0x01, 
-    0x90, 0x03, 0x20, 0x4C, 0x11, 0x40, 0x00, 0x12, 0x24, 0x4C, 0x4A, 0x2A, 0x00, 0x12, 0x67, 0x00, 
-    0x01, 0xC0, 0x2F, 0x2A, 0x00, 0x02, 0x4E, 0xBA, 0xF8, 0x2C, 0x58, 0x4F, 0x3A, 0x00, 0x4A, 0x40, 
-    0x66, 0x08, 0x00, 0x52, 0x00, 0x02, 0x60, 0x00, 0x01, 0xA8, 0x10, 0x2E, 0xFF, 0xFD, 0x67, 0x00, 
-    0x01, 0xA0, 0x10, 0x2E, 0xFF, 0xFC, 0x67, 0x00, 0x01, 0x98, 0x24, 0x4C, 0x70, 0x12, 0xD5, 0xC0, 
-    0x2D, 0x4A, 0xFF, 0xF4, 0x20, 0x4C, 0x20, 0x28, 0x00, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x52, 0xAE, 0xFF, 0xF4, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x10, 0x80, 0x4A, 0x00, 0x67, 0x02, 0x60, 0xE6, 0x20, 0x2E, 0xFF, 0xF4, 0x26, 0x0C, 0x72, 0x12, 
-    0xD6, 0x01, 0x90, 0x03, 0x53, 0x00, 0x20, 0x4C, 0x11, 0x40, 0x00, 0x12, 0x55, 0x4F, 0x3E, 0xB8, 
-    0x02, 0x10, 0x30, 0x1F, 0x20, 0x4C, 0x22, 0x68, 0x00, 0x02, 0x33, 0x40, 0x00, 0x16, 0x2F, 0x28, 
-    0x00, 0x02, 0x4E, 0xBA, 0xF7, 0xB0, 0x58, 0x4F, 0x3A, 0x00, 0x4A, 0x40, 0x66, 0x0A, 0x20, 0x4C, 
-    0x00, 0x50, 0x00, 0x02, 0x60, 0x00, 0x01, 0x2A, 0x10, 0x2D, 0xF8, 0x06, 0x67, 0x00, 0x01, 0x22, 
-    0x55, 0x4F, 0x3F, 0x3C, 0x80, 0x00, 0x2F, 0x3C, 0x70, 0x72, 0x65, 0x66, 0x42, 0x27, 0x24, 0x4C, 
-    0x20, 0x6A, 0x00, 0x02, 0x70, 0x16, 0xD1, 0xC0, 0x2F, 0x08, 0x20, 0x6A, 0x00, 0x02, 0x70, 0x30, 
-    0xD1, 0xC0, 0x2F, 0x08, 0x4E, 0xAD, 0x01, 0xBA, 0x30, 0x1F, 0x3A, 0x00, 0x4A, 0x40, 0x66, 0x00, 
-    0x00, 0xF0, 0x70, 0x12, 0xD5, 0xC0, 0x2D, 0x4A, 0xFF, 0xF4, 0x52, 0xAE, 0xFF, 0xF4, 0x20, 0x6E, 
-    0xFF, 0xF4, 0x10, 0xBC, 0x00, 0x3A, 0x20, 0x4C, 0x20, 0x28, 0x00, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x52, 0xAE, 0xFF, 0xF4, 0x20, 0x6E, 
-    0xFF, 0xF4, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x02, 0x60, 0xE6, 0x20, 0x2E, 0xFF, 0xF4, 0x26, 0x0C, 
-    0x72, 0x12, 0xD6, 0x01, 0x90, 0x03, 0x53, 0x00, 0x20, 0x4C, 0x11, 0x40, 0x00, 0x12, 0x2F, 0x28, 
-    0x00, 0x02, 0x4E, 0xBA, 0xF7, 0x10, 0x58, 0x4F, 0x3A, 0x00, 0x4A, 0x40, 0x66, 0x0A, 0x20, 0x4C, 
-    0x00, 0x50, 0x00, 0x02, 0x60, 0x00, 0x00, 0x8A, 0x20, 0x2D, 0xF3, 0x72, 0x66, 0x00, 0x00, 0x82, 
-    0x24, 0x4C, 0x70, 0x12, 0xD5, 0xC0, 0x2D, 0x4A, 0xFF, 0xF4, 0x20, 0x4C, 0x20, 0x28, 0x00, 0x0E, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x52, 0xAE, 
-    0xFF, 0xF4, 0x20, 0x6E, 0xFF, 0xF4, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x02, 0x60, 0xE6, 0x20, 0x4C, 
-    0x20, 0x28, 0x00, 0x0A, 0x2D, 0x40, 0xFF, 0xF8, 0x53, 0xAE, 0xFF, 0xF4, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x52, 0xAE, 0xFF, 0xF4, 0x20, 0x6E, 0xFF, 0xF4, 0x10, 0x80, 
-    0x4A, 0x00, 0x67, 0x02, 0x60, 0xE6, 0x20, 0x2E, 0xFF, 0xF4, 0x26, 0x0C, 0x72, 0x12, 0xD6, 0x01, 
-    0x90, 0x03, 0x53, 0x00, 0x20, 0x4C, 0x11, 0x40, 0x00, 0x12, 0x2F, 0x28, 0x00, 0x02, 0x4E, 0xBA, 
-    0xF6, 0x84, 0x58, 0x4F, 0x3A, 0x00, 0x4A, 0x40, 0x66, 0x06, 0x20, 0x4C, 0x00, 0x50, 0x00, 0x02, 
-    0x24, 0x4C, 0x32, 0x12, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xC0, 0x81, 0x66, 0x62, 0x10, 0x2E, 
-    0xFF, 0xFC, 0x67, 0x5C, 0x30, 0x05, 0xB0, 0x44, 0x66, 0x56, 0x0C, 0x44, 0xFF, 0xD6, 0x66, 0x50, 
-    0x42, 0xA7, 0x48, 0x6D, 0xFF, 0x9E, 0x2F, 0x2E, 0xFF, 0xF0, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xBA, 
-    0xF6, 0xEE, 0x4F, 0xEF, 0x00, 0x10, 0x32, 0x12, 0x70, 0x00, 0x30, 0x01, 0x72, 0x08, 0xC0, 0x81, 
-    0x67, 0x00, 0x00, 0xC6, 0x42, 0xA7, 0x48, 0x6D, 0xFF, 0xB2, 0x1F, 0x2E, 0xFF, 0xFC, 0x3F, 0x04, 
-    0x4E, 0xBA, 0xF9, 0x00, 0x58, 0x4F, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0xB4, 0x2F, 0x2E, 0xFF, 0xF0, 
-    0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xBA, 0xF6, 0xB8, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0x00, 0x9A, 
-    0x20, 0x4C, 0x00, 0x50, 0x00, 0x04, 0x24, 0x4C, 0x32, 0x12, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 
-    0xC0, 0x81, 0x67, 0x6A, 0x2F, 0x0A, 0x3F, 0x04, 0x2F, 0x2E, 0xFF, 0xF0, 0x48, 0x6E, 0xFF, 0xEC, 
-    0x4E, 0xBA, 0xF9, 0xD2, 0x4F, 0xEF, 0x00, 0x0E, 0x4A, 0x80, 0x67, 0x36, 0x32, 0x12, 0x70, 0x00, 
-    0x30, 0x01, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x60, 0x42, 0xA7, 0x48, 0x6D, 0xFF, 0xB2, 0x1F, 0x2E, 
-    0xFF, 0xFC, 0x3F, 0x04, 0x4E, 0xBA, 0xF8, 0x9C, 0x58, 0x4F, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0xB4, 
-    0x2F, 0x2E, 0xFF, 0xF0, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xBA, 0xF6, 0x54, 0x4F, 0xEF, 0x00, 0x18, 
-    0x60, 0x36, 0x1F, 0x2E, 0xFF, 0xFC, 0x48, 0x6D, 0xFF, 0xB8, 0x3F, 0x04, 0x2F, 0x2E, 0xFF, 0xF0, 
-    0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xBA, 0xF8, 0xBE, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x1A, 0x1F, 0x2E, 
-    0xFF, 0xFC, 0x48, 0x6D, 0xFF, 0xDC, 0x3F, 0x04, 0x2F, 0x2E, 0xFF, 0xF0, 0x48, 0x6E, 0xFF, 0xEC, 
-    0x4E, 0xBA, 0xF8, 0xA2, 0x4F, 0xEF, 0x00, 0x10, 0x10, 0x2D, 0xF8, 0x04, 0x67, 0x0C, 0x10, 0x3C, 
-    0x00, 0xFE, 0x90, 0x2E, 0xFF, 0xED, 0x20, 0x4B, 0x10, 0x80, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x36, 0x2E, 0x00, 0x08, 0x24, 0x6E, 
-    0x00, 0x0A, 0x48, 0x6D, 0xFC, 0xFE, 0x3F, 0x03, 0x2F, 0x0A, 0x4E, 0xBA, 0xFB, 0x9C, 0x4F, 0xEF, 
-    0x00, 0x0A, 0x20, 0x0A, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x00, 0x00, 0x07, 0x68, 
-    0x02, 0x70, 0x00, 0x01, 0x48, 0xE7, 0x7F, 0xF8, 0x49, 0xFA, 0x01, 0xA8, 0x30, 0x2C, 0x00, 0x04, 
-    0x53, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x32, 0x26, 0x4D, 0x97, 0xD4, 0x2F, 0x0B, 0x2F, 0x14, 
-    0x61, 0x00, 0x01, 0x4C, 0x20, 0x2C, 0x00, 0x08, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 0x61, 0x00, 
-    0x00, 0x2E, 0x50, 0x4F, 0x20, 0x2C, 0x00, 0x0C, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 0x2F, 0x0D, 
-    0x61, 0x00, 0x00, 0xD0, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xDF, 0x1F, 0xFE, 0x4E, 0x75, 
-    0x80, 0x09, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x00, 0x00, 0x22, 0x6F, 
-    0x00, 0x04, 0x20, 0x6F, 0x00, 0x08, 0x48, 0xE7, 0x18, 0x00, 0x76, 0x01, 0x72, 0x00, 0x12, 0x18, 
-    0x24, 0x01, 0x02, 0x41, 0x00, 0x0F, 0x66, 0x0A, 0x61, 0x00, 0x00, 0x44, 0x22, 0x00, 0x67, 0x24, 
-    0x60, 0x02, 0xD2, 0x41, 0x02, 0x42, 0x00, 0xF0, 0x66, 0x08, 0x61, 0x00, 0x00, 0x32, 0x24, 0x00, 
-    0x60, 0x02, 0xE6, 0x4A, 0xD3, 0xC2, 0x28, 0x01, 0x12, 0xD8, 0x53, 0x84, 0x66, 0xFA, 0x53, 0x83, 
-    0x66, 0xF2, 0x60, 0xC6, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x80, 0x10, 0x75, 0x6E, 0x63, 0x6F, 
-    0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 0x70, 0x00, 
-    0x10, 0x18, 0x6A, 0x42, 0x08, 0x00, 0x00, 0x06, 0x67, 0x34, 0x08, 0x00, 0x00, 0x05, 0x67, 0x20, 
-    0x08, 0x00, 0x00, 0x04, 0x67, 0x0A, 0x61, 0xE6, 0x26, 0x00, 0x61, 0xE2, 0xC1, 0x43, 0x4E, 0x75, 
-    0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 
-    0x02, 0x00, 0x00, 0x1F, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x02, 0x00, 
-    0x00, 0x3F, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x80, 0x06, 0x67, 0x65, 0x74, 0x5F, 0x72, 0x6C, 
-    0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x20, 0x6F, 0x00, 0x0C, 0x74, 0x01, 
-    0x70, 0x00, 0x10, 0x18, 0x67, 0x0C, 0x6A, 0x26, 0x08, 0x80, 0x00, 0x07, 0xE1, 0x88, 0x10, 0x18, 
-    0x60, 0x1C, 0x10, 0x18, 0x67, 0x24, 0x6A, 0x0E, 0xE1, 0x88, 0x10, 0x18, 0xE1, 0x88, 0x10, 0x18, 
-    0xE1, 0x88, 0x10, 0x18, 0x60, 0x08, 0x24, 0x00, 0x61, 0x00, 0xFF, 0x74, 0xC1, 0x42, 0xD0, 0x80, 
-    0xD3, 0xC0, 0xD3, 0x91, 0x53, 0x82, 0x66, 0xF8, 0x60, 0xC4, 0x4E, 0x75, 0x80, 0x0E, 0x72, 0x65, 
-    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 0x74, 0x00, 
-    0x20, 0x5F, 0x20, 0x1F, 0x22, 0x5F, 0x67, 0x28, 0x32, 0x09, 0x02, 0x41, 0x00, 0x03, 0x67, 0x08, 
-    0x12, 0xC2, 0x53, 0x80, 0x66, 0xF2, 0x60, 0x18, 0x22, 0x00, 0xE4, 0x89, 0x67, 0x06, 0x22, 0xC2, 
-    0x53, 0x81, 0x66, 0xFA, 0x02, 0x40, 0x00, 0x03, 0x60, 0x02, 0x12, 0xC2, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x4E, 0xD0, 0x80, 0x0A, 0x5A, 0x45, 0x52, 0x4F, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 
-    0x05, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x40, 0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x77, 
-    0x68, 0x65, 0x72, 0x65, 0x20, 0x20, 0x20, 0x2D, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 
-    0x65, 0x73, 0x73, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x65, 
-    0x72, 0x72, 0x0D, 0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x2D, 0x76, 0x69, 0x61, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 0x20, 0x20, 0x61, 0x20, 
-    0x74, 0x65, 0x78, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6F, 
-    0x6E, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6C, 
-    0x69, 0x6E, 0x65, 0x20, 0x28, 0x31, 0x73, 0x74, 0x20, 0x3A, 0x3D, 0x20, 0x6D, 0x6F, 0x64, 0x75, 
-    0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0D, 0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x6F, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x4E, 
-    0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 
-    0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x4E, 
-    0x54, 0x4B, 0x0D, 0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x2D, 0x64, 0x75, 0x6D, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 
-    0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x73, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x69, 0x6E, 
-    0x66, 0x6F, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x69, 0x66, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x20, 0x28, 0x20, 0x2D, 0x6F, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x64, 
-    0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x29, 0x20, 0x0D, 0x10, 0x80, 0xC0, 0x23, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x64, 0x75, 0x6D, 0x70, 0x20, 
-    0x2D, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x69, 0x66, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x28, 0x6C, 0x69, 
-    0x6B, 0x65, 0x20, 0x44, 0x75, 0x6D, 0x70, 0x41, 0x49, 0x46, 0x29, 0x0D, 0x00, 0x23, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x64, 0x75, 0x6D, 0x70, 0x20, 
-    0x2D, 0x73, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x28, 0x41, 0x4C, 0x4C, 0x29, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 
-    0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 
-    0x68, 0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x69, 0x66, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x0D, 0x10, 0x44, 0x23, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x68, 0x65, 0x6C, 
-    0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 
-    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6F, 
-    0x20, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x0D, 0x00, 0x0D, 0x00, 0x61, 0x62, 0x73, 0x6F, 0x6C, 
-    0x75, 0x74, 0x65, 0x1A, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x72, 0x65, 
-    0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x10, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x69, 
-    0x6E, 0x69, 0x74, 0x20, 0x01, 0x52, 0x00, 0xF0, 0x01, 0x0C, 0x03, 0x5A, 0x62, 0x6A, 0x72, 0x42, 
-    0x4A, 0x82, 0x7A, 0x62, 0x6A, 0x72, 0x42, 0x00, 0x80, 0x81, 0x03, 0x4A, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x10, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 0x10, 0x10, 0x20, 0x07, 0x81, 0x64, 0x53, 
-    0x68, 0x65, 0x6C, 0x6C, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x10, 0x19, 0x53, 
-    0x79, 0x73, 0x45, 0x72, 0x72, 0x73, 0x2E, 0x45, 0x72, 0x72, 0x00, 0x3A, 0x4D, 0x50, 0x57, 0x3A, 
-    0x00, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x00, 0x66, 0x05, 0x23, 0x20, 0x55, 0x73, 0x61, 
-    0x67, 0x65, 0x3A, 0x20, 0x20, 0x20, 0x25, 0x73, 0x20, 0x5B, 0x2D, 0x70, 0x5D, 0x20, 0x5B, 0x2D, 
-    0x64, 0x75, 0x6D, 0x70, 0x20, 0x5B, 0x2D, 0x73, 0x5D, 0x20, 0x5B, 0x2D, 0x73, 0x6C, 0x5D, 0x20, 
-    0x5D, 0x20, 0x7C, 0x20, 0x2D, 0x76, 0x69, 0x61, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x73, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x20, 0x2D, 
-    0x6F, 0x20, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 
-    0x20, 0x5D, 0x20, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 
-    0x0D, 0x10, 0x20, 0xFF, 0xFF, 0xD1, 0xCC, 0xFF, 0xFF, 0xD2, 0x06, 0xFF, 0xFF, 0xD2, 0x6C, 0xFF, 
-    0xFF, 0xD2, 0xB6, 0xFF, 0xFF, 0xD3, 0x0E, 0xFF, 0xFF, 0xD3, 0x6E, 0xFF, 0xFF, 0xD3, 0xD0, 0xFF, 
-    0xFF, 0xD4, 0x0A, 0xC0, 0x01, 0x01, 0x06, 0x80, 0xAB, 0xDE, 0xAD, 0xBE, 0xEF, 0xDE, 0xAD, 0xBE, 
-    0xEF, 0xDE, 0xAD, 0xBE, 0xEF, 0x08, 0x97, 0x86, 0xFF, 0xFF, 0xD4, 0x0C, 0xFF, 0xFF, 0xD4, 0x16, 
-    0xFF, 0xFF, 0xD4, 0x20, 0xFF, 0xFF, 0xD4, 0x2C, 0x44, 0xFF, 0xFF, 0xD4, 0x36, 0xFF, 0xFF, 0xD4, 
-    0x52, 0x02, 0x83, 0x04, 0xFF, 0xFF, 0xD4, 0x6E, 0x02, 0x28, 0xFF, 0xFF, 0xF3, 0x3E, 0x01, 0x80, 
-    0x8C, 0x53, 0x48, 0x22, 0xFF, 0xFF, 0xD5, 0x70, 0x20, 0x01, 0x81, 0x02, 0x07, 0xFF, 0xFF, 0xD5, 
-    0x80, 0x00, 0x01, 0x1D, 0x01, 0x00, 0x01, 0x13, 0x01, 0x00, 0x03, 0x15, 0x02, 0x00, 0x01, 0x00, 
-    0x03, 0x13, 0x42, 0x00, 0x02, 0x02, 0x83, 0x2E, 0xFF, 0xFF, 0xF6, 0xE6, 0x72, 0x46, 0x53, 0x59, 
-    0x53, 0x00, 0xF0, 0x01, 0x04, 0x03, 0xB2, 0xBA, 0xC2, 0xCA, 0x00, 0x05, 0x03, 0xD2, 0x43, 0x4F, 
-    0x4E, 0x53, 0x00, 0xF0, 0x01, 0x04, 0x03, 0x8A, 0x92, 0x9A, 0xA2, 0x00, 0x05, 0x03, 0xAA, 0x53, 
-    0x59, 0x53, 0x54, 0x00, 0xF0, 0x01, 0x05, 0x03, 0xDA, 0xE2, 0xEA, 0xF2, 0xFA, 0x01, 0x32, 0xFF, 
-    0xFF, 0x10, 0xF0, 0x02, 0x10, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 
-    0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 
-    0x82, 0x01, 0x82, 0x01, 0x82, 0x00, 0x11, 0x85, 0x4B, 0x09, 0xFF, 0xFF, 0xFC, 0x84, 0xFF, 0xFF, 
-    0xD6, 0x52, 0xFF, 0xFF, 0xD6, 0x62, 0xFF, 0xFF, 0xD6, 0x6E, 0x08, 0x81, 0x02, 0xFF, 0xFF, 0xFC, 
-    0x0A, 0xFF, 0xFF, 0xD6, 0x74, 0xFF, 0xFF, 0xD6, 0x7C, 0xFF, 0xFF, 0xD6, 0x7E, 0x08, 0x81, 0x22, 
-    0x4F, 0x53, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x00, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 
-    0x10, 0x46, 0x20, 0x00, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 
-    0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 
-    0x70, 0x74, 0x65, 0x64, 0x29, 0x00, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 
-    0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x61, 
-    0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x1C, 0x54, 0x6F, 0x6F, 0x20, 0x6D, 0x61, 0x6E, 
-    0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x29, 0x00, 0x20, 
-    0x28, 0x10, 0xF0, 0x22, 0x02, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 
-    0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x76, 0x61, 
-    0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 
-    0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 
-    0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x10, 0x00, 0x81, 0x35, 0x00, 0x02, 0x0D, 
-    0x81, 0x3F, 0x00, 0x02, 0x07, 0x8C, 0x2D, 0x02, 0x02, 0x02, 0x06, 0x02, 0x81, 0x84, 0x16, 0x4B, 
-    0x08, 0x81, 0xC9, 0x0B, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x04, 0x1C, 
-    0x00, 0x02, 0x0F, 0x82, 0xA8, 0x02, 0x02, 0x02, 0x80, 0x83, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0xB2, 0x6D, 0x70, 0x77, 0x64, 0x00, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x80, 0x00, 
-    0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0xA9, 0x20, 0x41, 0x70, 
-    0x70, 0x6C, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x49, 0x6E, 
-    0x63, 0x2E, 0x20, 0x31, 0x39, 0x39, 0x37, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x80, 0x00, 0x00, 
-    0x00, 0x03, 0x31, 0x2E, 0x30, 0x0D, 0x43, 0x2B, 0x2B, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x20, 
-    0x31, 0x2E, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x33, 0x00, 0x00, 0xB7, 0x33, 0x00, 
-    0x00, 0x00, 0x8B, 0x01, 0x76, 0xA1, 0x8C, 0x18, 0xFA, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x76, 0x00, 
-    0x01, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x03, 0x00, 0x12, 0x76, 0x65, 0x72, 0x73, 0x00, 0x01, 0x00, 
-    0x42, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x00, 0x20, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x20, 0x00, 0x6F, 
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0D, 0x20, 0x00, 0xAF, 0x7C, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0xB6, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 
-    0xFF, 0x20, 0x00, 0xB7, 0x17, 0x01, 0x76, 0xA5, 0x88, 0x04, 0x4D, 0x61, 0x69, 0x6E, 0x07, 0x4C, 
-    0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x07, 0x25, 0x41, 0x35, 0x49, 0x6E, 0x69, 0x74, 
-};
-
-unsigned char *gAppResource = rsrc;
-unsigned int gAppResourceSize = sizeof(rsrc);
+MOS_INCBIN("rsrc_aiftontk.bin")
+unsigned int gAppResourceCompressed = 1;
 
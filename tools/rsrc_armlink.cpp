@@ -1,6418 +1,6 @@
 
 #include "rsrc.h"
 
-unsigned char rsrc[] = {
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8B, 
-    0x02, 0x00, 0x04, 0x21, 0x00, 0x00, 0x26, 0x34, 0x00, 0x01, 0x02, 0x00, 0x03, 0xF9, 0x00, 0x00, 
-    0x25, 0xD4, 0x00, 0x01, 0x02, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x01, 0x02, 0x00, 
-    0x07, 0x41, 0x52, 0x4D, 0x4C, 0x69, 0x6E, 0x6B, 0x65, 0x20, 0x4E, 0x61, 0x76, 0x69, 0x67, 0x61, 
-    0x74, 0x6F, 0x72, 0xAA, 0x20, 0x33, 0x2E, 0x30, 0x32, 0x6F, 0x6F, 0x6C, 0x73, 0x73, 0x61, 0x6E, 
-    0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xB1, 0x00, 0xAB, 0xC0, 0x00, 0x01, 0xDC, 0x0F, 0x00, 0x01, 0x90, 0x8B, 0x02, 0x00, 
-    0x03, 0xD9, 0x00, 0x00, 0x25, 0x8C, 0x00, 0x01, 0x02, 0x00, 0x03, 0xAB, 0x00, 0x00, 0x25, 0x38, 
-    0x00, 0x01, 0x02, 0x00, 0x02, 0x5A, 0x00, 0x00, 0x22, 0x80, 0x00, 0x01, 0x02, 0x00, 0x02, 0x46, 
-    0x00, 0x00, 0x22, 0x68, 0x00, 0x01, 0x02, 0x00, 0x01, 0xB7, 0x00, 0x00, 0x21, 0x9C, 0x00, 0x01, 
-    0x02, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x21, 0x30, 0x00, 0x01, 0x02, 0x00, 0x01, 0x28, 0x00, 0x00, 
-    0x20, 0xD0, 0x00, 0x01, 0x02, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x02, 0x00, 
-    0x00, 0x9F, 0x00, 0x00, 0x1F, 0x8C, 0x00, 0x01, 0x02, 0x00, 0x04, 0x24, 0x00, 0x00, 0x26, 0x40, 
-    0x00, 0x01, 0x02, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x25, 0xC8, 0x00, 0x01, 0x02, 0x00, 0x03, 0x6A, 
-    0x00, 0x00, 0x24, 0xB4, 0x00, 0x01, 0x02, 0x00, 0x03, 0x34, 0x00, 0x00, 0x24, 0x60, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x70, 0x77, 0x70, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x07, 0x61, 
-    0x72, 0x6D, 0x6C, 0x69, 0x6E, 0x6B, 0x00, 0x00, 0x00, 0x01, 0x48, 0x94, 0x00, 0x00, 0x00, 0x01, 
-    0x9D, 0xCE, 0x59, 0x8F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x42, 0x67, 0xA9, 0xA0, 0x20, 0x17, 
-    0x67, 0x00, 0x01, 0x00, 0x20, 0x40, 0x20, 0x50, 0x2E, 0x18, 0x2C, 0x10, 0x20, 0x5F, 0xA0, 0x49, 
-    0x70, 0x00, 0x20, 0x4D, 0x91, 0xC6, 0x60, 0x02, 0x10, 0xC0, 0xB1, 0xCD, 0x6D, 0xFA, 0x41, 0xED, 
-    0x00, 0x28, 0x43, 0xF5, 0x78, 0x00, 0x60, 0x02, 0x10, 0xC0, 0xB1, 0xC9, 0x6D, 0xFA, 0x59, 0x8F, 
-    0x2F, 0x3C, 0x44, 0x41, 0x54, 0x41, 0x42, 0x67, 0xA9, 0xA0, 0x20, 0x57, 0x20, 0x08, 0x67, 0x00, 
-    0x00, 0xC2, 0x2F, 0x0D, 0x20, 0x50, 0x48, 0x68, 0x00, 0x04, 0x4E, 0xBA, 0x00, 0xBC, 0x50, 0x8F, 
-    0x43, 0xFA, 0xFF, 0x9A, 0x2B, 0x49, 0xE6, 0x5A, 0x22, 0x4D, 0x4E, 0xBA, 0x02, 0x28, 0x22, 0x6D, 
-    0xE6, 0x5A, 0x4E, 0xBA, 0x02, 0x20, 0xA9, 0xA3, 0x42, 0x2D, 0xE6, 0x5F, 0x30, 0x3C, 0xA8, 0x9F, 
-    0xA7, 0x46, 0x2F, 0x08, 0x30, 0x3C, 0xA1, 0x98, 0xA3, 0x46, 0xB1, 0xDF, 0x67, 0x0A, 0x1B, 0x7C, 
-    0x00, 0x01, 0xE6, 0x5F, 0x70, 0x01, 0xA1, 0x98, 0x2B, 0x57, 0xE6, 0x46, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xF6, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x94, 0x20, 0x57, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0x00, 
-    0x48, 0x6D, 0xE6, 0x56, 0x48, 0x6D, 0xE6, 0x52, 0x48, 0x6D, 0xE6, 0x4E, 0x2F, 0x08, 0x4E, 0xBA, 
-    0x07, 0x44, 0x2B, 0x40, 0xE6, 0x4A, 0x4F, 0xEF, 0x00, 0x14, 0x48, 0x6D, 0xE6, 0xF0, 0x4E, 0xBA, 
-    0x0B, 0x3E, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x3A, 0x48, 0x7A, 0x03, 0xB8, 0x4E, 0xBA, 0x0B, 0xDC, 
-    0x58, 0x4F, 0x4A, 0x80, 0x66, 0x2C, 0x48, 0x7A, 0x02, 0x38, 0x4E, 0xBA, 0x0B, 0xCE, 0x58, 0x4F, 
-    0x4A, 0x80, 0x66, 0x1E, 0x2F, 0x2D, 0xE6, 0x56, 0x2F, 0x2D, 0xE6, 0x52, 0x2F, 0x2D, 0xE6, 0x4E, 
-    0x4E, 0xB9, 0x00, 0x00, 0xFE, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x4E, 0xBA, 0x1A, 0xBC, 
-    0x58, 0x4F, 0x4E, 0xBA, 0x01, 0xE0, 0x4E, 0x75, 0x48, 0xE7, 0x1C, 0x30, 0x59, 0x4F, 0x26, 0x6F, 
-    0x00, 0x1C, 0x78, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x1E, 0x9B, 0x1F, 0x5B, 0x00, 0x01, 0x1F, 0x5B, 
-    0x00, 0x02, 0x1F, 0x5B, 0x00, 0x03, 0x24, 0x6F, 0x00, 0x20, 0xD5, 0xD7, 0x16, 0x1B, 0x48, 0x83, 
-    0x48, 0xC3, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x67, 0x0E, 0x70, 0x7F, 0xC6, 0x80, 
-    0x14, 0xDB, 0x53, 0x83, 0x4A, 0x83, 0x6C, 0xF8, 0x60, 0xE2, 0x70, 0x40, 0xC0, 0x83, 0x67, 0x0A, 
-    0x70, 0x3F, 0xC0, 0x83, 0x52, 0x80, 0xD5, 0xC0, 0x60, 0xD2, 0x70, 0x20, 0xC0, 0x83, 0x67, 0x0C, 
-    0x70, 0x1F, 0xC0, 0x83, 0x52, 0x80, 0x26, 0x00, 0x1A, 0x1B, 0x60, 0x0C, 0x70, 0x10, 0xC0, 0x83, 
-    0x67, 0x10, 0x70, 0x0F, 0xC6, 0x80, 0x7A, 0xFF, 0x14, 0xC5, 0x53, 0x83, 0x4A, 0x83, 0x6C, 0xF8, 
-    0x60, 0xAA, 0x20, 0x03, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x04, 0x62, 0x64, 0xD0, 0x40, 0x30, 0x3B, 
-    0x00, 0x06, 0x4E, 0xFB, 0x00, 0x02, 0x00, 0x5E, 0x00, 0x0A, 0x00, 0x1C, 0x00, 0x2C, 0x00, 0x42, 
-    0x58, 0x8A, 0x14, 0xFC, 0xFF, 0xFF, 0x14, 0xFC, 0xFF, 0xFF, 0x14, 0xDB, 0x14, 0xDB, 0x60, 0x00, 
-    0xFF, 0x7C, 0x58, 0x8A, 0x14, 0xFC, 0xFF, 0xFF, 0x14, 0xDB, 0x14, 0xDB, 0x14, 0xDB, 0x60, 0x00, 
-    0xFF, 0x6C, 0x14, 0xFC, 0xFF, 0xA9, 0x14, 0xFC, 0xFF, 0xF0, 0x54, 0x8A, 0x14, 0xDB, 0x14, 0xDB, 
-    0x52, 0x8A, 0x14, 0xDB, 0x60, 0x00, 0xFF, 0x56, 0x14, 0xFC, 0xFF, 0xA9, 0x14, 0xFC, 0xFF, 0xF0, 
-    0x52, 0x8A, 0x14, 0xDB, 0x14, 0xDB, 0x14, 0xDB, 0x52, 0x8A, 0x14, 0xDB, 0x60, 0x00, 0xFF, 0x3E, 
-    0x70, 0x0F, 0xA9, 0xC9, 0x52, 0x84, 0x70, 0x03, 0xB8, 0x80, 0x6D, 0x00, 0xFF, 0x1C, 0x20, 0x4B, 
-    0x58, 0x4F, 0x4C, 0xDF, 0x0C, 0x38, 0x4E, 0x75, 0x48, 0xE7, 0x0C, 0x00, 0x59, 0x4F, 0x22, 0x6F, 
-    0x00, 0x10, 0x1E, 0x99, 0x1F, 0x59, 0x00, 0x01, 0x1F, 0x59, 0x00, 0x02, 0x1F, 0x59, 0x00, 0x03, 
-    0x2A, 0x17, 0x78, 0x00, 0x60, 0x50, 0x14, 0x19, 0x10, 0x02, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 
-    0x67, 0x0C, 0xD4, 0x02, 0x10, 0x02, 0x48, 0x80, 0x48, 0xC0, 0xD8, 0x80, 0x60, 0x2A, 0x1E, 0x82, 
-    0x1F, 0x59, 0x00, 0x01, 0x10, 0x02, 0x72, 0x40, 0xC0, 0x81, 0x67, 0x0E, 0x30, 0x17, 0x48, 0xC0, 
-    0xE5, 0x88, 0x48, 0xC0, 0xE2, 0x80, 0xD8, 0x80, 0x60, 0x0E, 0x1F, 0x59, 0x00, 0x02, 0x1F, 0x59, 
-    0x00, 0x03, 0x28, 0x17, 0xE5, 0x8C, 0xE2, 0x84, 0x20, 0x6F, 0x00, 0x14, 0x20, 0x2F, 0x00, 0x18, 
-    0xD1, 0xB0, 0x48, 0x00, 0x53, 0x85, 0x4A, 0x85, 0x6E, 0xAC, 0x20, 0x49, 0x58, 0x4F, 0x4C, 0xDF, 
-    0x00, 0x30, 0x4E, 0x75, 0x2F, 0x0A, 0x24, 0x49, 0x2F, 0x0D, 0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 
-    0xFF, 0x78, 0x2F, 0x2D, 0xE6, 0x5A, 0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 0xFF, 0x6C, 0x2F, 0x0A, 
-    0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 0xFF, 0x62, 0x4F, 0xEF, 0x00, 0x24, 0x24, 0x5F, 0x4E, 0x75, 
-    0x2F, 0x0A, 0x24, 0x49, 0x2F, 0x0D, 0x44, 0x97, 0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 0xFF, 0x4A, 
-    0x2F, 0x2D, 0xE6, 0x5A, 0x44, 0x97, 0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 0xFF, 0x3C, 0x2F, 0x0A, 
-    0x44, 0x97, 0x2F, 0x0A, 0x2F, 0x08, 0x4E, 0xBA, 0xFF, 0x30, 0x4F, 0xEF, 0x00, 0x24, 0x24, 0x5F, 
-    0x4E, 0x75, 0x4E, 0x75, 0x59, 0x8F, 0x2F, 0x3C, 0x44, 0x41, 0x54, 0x41, 0x42, 0x67, 0xA9, 0xA0, 
-    0x20, 0x57, 0x20, 0x08, 0x66, 0x04, 0x58, 0x8F, 0x60, 0x0E, 0x20, 0x50, 0xD1, 0xD0, 0x22, 0x6D, 
-    0xE6, 0x5A, 0x4E, 0xBA, 0xFF, 0xAC, 0xA9, 0xA3, 0x4E, 0x75, 0x70, 0x00, 0x4E, 0x75, 0x4E, 0x75, 
-    0x2F, 0x0A, 0x60, 0x14, 0x2B, 0x52, 0xE6, 0x64, 0x3F, 0x3C, 0xFF, 0xFF, 0x2F, 0x2A, 0x00, 0x08, 
-    0x20, 0x6A, 0x00, 0x04, 0x4E, 0x90, 0x5C, 0x4F, 0x24, 0x6D, 0xE6, 0x64, 0x20, 0x0A, 0x4A, 0x80, 
-    0x66, 0xE2, 0x24, 0x5F, 0x4E, 0x75, 0x48, 0xE7, 0x30, 0x00, 0x74, 0x02, 0x4E, 0xFB, 0x22, 0x00, 
-    0x60, 0x0A, 0x4C, 0x01, 0x00, 0x00, 0x4C, 0xDF, 0x00, 0x0C, 0x4E, 0x75, 0x24, 0x00, 0x48, 0x42, 
-    0xC4, 0xC1, 0x26, 0x01, 0x48, 0x43, 0xC6, 0xC0, 0xD4, 0x43, 0x48, 0x42, 0x42, 0x42, 0xC0, 0xC1, 
-    0xD0, 0x82, 0x4C, 0xDF, 0x00, 0x0C, 0x4E, 0x75, 0x48, 0xE7, 0x30, 0x00, 0x74, 0x02, 0x4E, 0xFB, 
-    0x22, 0x00, 0x60, 0x0A, 0x4C, 0x41, 0x00, 0x00, 0x4C, 0xDF, 0x00, 0x0C, 0x4E, 0x75, 0x24, 0x01, 
-    0x42, 0x42, 0x48, 0x42, 0x66, 0x1C, 0x36, 0x00, 0x42, 0x40, 0x48, 0x40, 0x67, 0x06, 0x80, 0xC1, 
-    0x34, 0x00, 0x48, 0x42, 0x30, 0x03, 0x80, 0xC1, 0x34, 0x00, 0x20, 0x02, 0x4C, 0xDF, 0x00, 0x0C, 
-    0x4E, 0x75, 0x34, 0x00, 0x42, 0x40, 0x48, 0x40, 0x48, 0x42, 0x26, 0x01, 0x72, 0x0F, 0xD4, 0x82, 
-    0xD1, 0x80, 0xB0, 0x83, 0x65, 0x04, 0x90, 0x83, 0x52, 0x02, 0x51, 0xC9, 0xFF, 0xF2, 0x20, 0x02, 
-    0x4C, 0xDF, 0x00, 0x0C, 0x4E, 0x75, 0x4A, 0x80, 0x6C, 0x0C, 0x44, 0x80, 0x4A, 0x81, 0x6C, 0x10, 
-    0x44, 0x81, 0x4E, 0xFA, 0xFF, 0x94, 0x4A, 0x81, 0x6D, 0x04, 0x4E, 0xFA, 0xFF, 0x8C, 0x44, 0x81, 
-    0x4E, 0xBA, 0xFF, 0x86, 0x44, 0x80, 0x4E, 0x75, 0x48, 0xE7, 0x30, 0x00, 0x74, 0x02, 0x4E, 0xFB, 
-    0x22, 0x00, 0x60, 0x0C, 0x4C, 0x41, 0x00, 0x01, 0x20, 0x01, 0x4C, 0xDF, 0x00, 0x0C, 0x4E, 0x75, 
-    0x24, 0x01, 0x42, 0x42, 0x48, 0x42, 0x66, 0x1C, 0x36, 0x00, 0x42, 0x40, 0x48, 0x40, 0x67, 0x06, 
-    0x80, 0xC1, 0x34, 0x00, 0x48, 0x42, 0x30, 0x03, 0x80, 0xC1, 0x42, 0x40, 0x48, 0x40, 0x4C, 0xDF, 
-    0x00, 0x0C, 0x4E, 0x75, 0x34, 0x00, 0x42, 0x40, 0x48, 0x40, 0x48, 0x42, 0x26, 0x01, 0x72, 0x0F, 
-    0xD4, 0x82, 0xD1, 0x80, 0xB0, 0x83, 0x65, 0x02, 0x90, 0x83, 0x51, 0xC9, 0xFF, 0xF4, 0x4C, 0xDF, 
-    0x00, 0x0C, 0x4E, 0x75, 0x4A, 0x81, 0x6C, 0x02, 0x44, 0x81, 0x4A, 0x80, 0x6D, 0x04, 0x4E, 0xFA, 
-    0xFF, 0x98, 0x44, 0x80, 0x4E, 0xBA, 0xFF, 0x92, 0x44, 0x80, 0x4E, 0x75, 0x20, 0x5F, 0x22, 0x48, 
-    0xD2, 0xD8, 0xB0, 0x98, 0x6C, 0x02, 0x4E, 0xD1, 0xB0, 0x98, 0x6F, 0x02, 0x4E, 0xD1, 0x32, 0x18, 
-    0xB0, 0x98, 0x66, 0x04, 0xD0, 0xD0, 0x4E, 0xD0, 0x54, 0x48, 0x51, 0xC9, 0xFF, 0xF4, 0x4E, 0xD1, 
-    0x4E, 0x75, 0x60, 0x14, 0x20, 0x2D, 0xEF, 0xC2, 0x52, 0xAD, 0xEF, 0xC2, 0xE5, 0x88, 0x41, 0xED, 
-    0xE6, 0x68, 0x20, 0x70, 0x08, 0x00, 0x4E, 0x90, 0x70, 0x20, 0xB0, 0xAD, 0xEF, 0xC2, 0x62, 0xE4, 
-    0x4E, 0x75, 0x4A, 0xAD, 0xEF, 0xC2, 0x66, 0x04, 0x70, 0xFF, 0x4E, 0x75, 0x4E, 0xB9, 0x00, 0x01, 
-    0x18, 0xC4, 0x53, 0xAD, 0xEF, 0xC2, 0x20, 0x2D, 0xEF, 0xC2, 0xE5, 0x88, 0x41, 0xED, 0xE6, 0x68, 
-    0x21, 0xAF, 0x00, 0x04, 0x08, 0x00, 0x70, 0x00, 0x4E, 0x75, 0x2F, 0x2F, 0x00, 0x04, 0x4E, 0xB9, 
-    0x00, 0x00, 0x1C, 0xA2, 0x20, 0x40, 0x58, 0x4F, 0x4E, 0x75, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x2F, 
-    0x00, 0x10, 0x24, 0x6F, 0x00, 0x14, 0x20, 0x03, 0x55, 0x80, 0x67, 0x0A, 0x59, 0x80, 0x67, 0x02, 
-    0x60, 0x06, 0x76, 0x01, 0x60, 0x02, 0x76, 0x02, 0xB4, 0xFC, 0x00, 0x00, 0x66, 0x06, 0x70, 0x01, 
-    0x24, 0x40, 0x60, 0x14, 0x70, 0xFF, 0xB5, 0xC0, 0x66, 0x06, 0x70, 0xFF, 0x24, 0x40, 0x60, 0x08, 
-    0x70, 0x01, 0xB5, 0xC0, 0x66, 0x02, 0x95, 0xCA, 0x2F, 0x0A, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x00, 
-    0x1A, 0x44, 0x26, 0x48, 0x2B, 0x6D, 0xF0, 0x12, 0xEF, 0x7C, 0x20, 0x4B, 0x50, 0x4F, 0x4C, 0xDF, 
-    0x0C, 0x08, 0x4E, 0x75, 0x2F, 0x2F, 0x00, 0x0C, 0x2F, 0x2F, 0x00, 0x0C, 0x20, 0x6F, 0x00, 0x0C, 
-    0x32, 0x68, 0x00, 0x02, 0x2F, 0x09, 0x4E, 0xB9, 0x00, 0x00, 0x12, 0x14, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4E, 0x75, 0x59, 0x4F, 0x2F, 0x2F, 0x00, 0x10, 0x2F, 0x2F, 0x00, 0x10, 0x20, 0x6F, 0x00, 0x10, 
-    0x32, 0x68, 0x00, 0x02, 0x2F, 0x09, 0x4E, 0xB9, 0x00, 0x00, 0x11, 0x76, 0x2F, 0x40, 0x00, 0x0C, 
-    0x20, 0x2F, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x10, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xB8, 0x48, 0xE7, 
-    0x18, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x42, 0x40, 0x36, 0x00, 0x55, 0x4F, 0x3F, 0x3C, 0xA1, 0xAD, 
-    0x4E, 0xBA, 0x04, 0xD0, 0x10, 0x1F, 0x67, 0x5E, 0x20, 0x3C, 0x6F, 0x73, 0x20, 0x20, 0x43, 0xEE, 
-    0xFF, 0xB8, 0xA1, 0xAD, 0x22, 0x88, 0x36, 0x00, 0x4A, 0x40, 0x66, 0x44, 0x20, 0x2E, 0xFF, 0xB8, 
-    0x72, 0x03, 0xC0, 0x81, 0x67, 0x3A, 0x70, 0x3C, 0x2D, 0x40, 0xFF, 0xC4, 0x2D, 0x4A, 0xFF, 0xC8, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x55, 0x4F, 0x48, 0x6E, 0xFF, 0xBC, 0x3F, 0x3C, 0x00, 0x37, 
-    0xA8, 0x8F, 0x30, 0x1F, 0x36, 0x00, 0x4A, 0x40, 0x66, 0x20, 0x55, 0x4F, 0x48, 0x6E, 0xFF, 0xBC, 
-    0x48, 0x6E, 0xFF, 0xC4, 0x3F, 0x3C, 0x00, 0x3A, 0xA8, 0x8F, 0x30, 0x1F, 0x36, 0x00, 0x60, 0x0A, 
-    0x36, 0x3C, 0xFD, 0xA8, 0x60, 0x04, 0x36, 0x3C, 0xFD, 0xA8, 0x30, 0x03, 0x67, 0x2A, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xC4, 0x2D, 0x4A, 0xFF, 0xCA, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0xCE, 0x55, 0x4F, 
-    0xA9, 0x94, 0x30, 0x1F, 0x3D, 0x40, 0xFF, 0xD0, 0x42, 0x40, 0x3D, 0x40, 0xFF, 0xD4, 0x41, 0xEE, 
-    0xFF, 0xB8, 0x70, 0x08, 0xA2, 0x60, 0x36, 0x00, 0x30, 0x03, 0x67, 0x34, 0x20, 0x3C, 0x00, 0x00, 
-    0x09, 0x10, 0x26, 0x40, 0x20, 0x40, 0x10, 0x10, 0x72, 0x00, 0x12, 0x00, 0x28, 0x01, 0x0C, 0x84, 
-    0x00, 0x00, 0x00, 0x20, 0x63, 0x04, 0x70, 0x20, 0x28, 0x00, 0x20, 0x04, 0x52, 0x80, 0x2F, 0x00, 
-    0x2F, 0x0B, 0x2F, 0x0A, 0x4E, 0xBA, 0x03, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x42, 0x40, 0x36, 0x00, 
-    0x30, 0x03, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x47, 0x65, 0x74, 0x41, 0x70, 
-    0x70, 0x4E, 0x61, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 
-    0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x55, 0x4F, 0x3F, 0x3C, 
-    0xA1, 0xAD, 0x4E, 0xBA, 0x03, 0xCE, 0x10, 0x1F, 0x20, 0x4A, 0x10, 0x80, 0x20, 0x7C, 0x00, 0x00, 
-    0x03, 0x16, 0x20, 0x10, 0x2B, 0x40, 0xE6, 0xEC, 0x4A, 0x80, 0x57, 0xC0, 0x44, 0x00, 0x48, 0x80, 
-    0x48, 0xC0, 0x2B, 0x40, 0xE6, 0xE8, 0x4A, 0x80, 0x66, 0x38, 0x20, 0x2D, 0xE6, 0xEC, 0x72, 0x01, 
-    0xC0, 0x81, 0x66, 0x28, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x10, 0x0C, 0x80, 0x4D, 0x50, 0x47, 0x4D, 
-    0x66, 0x1A, 0x20, 0x6D, 0xE6, 0xEC, 0x4A, 0xA8, 0x00, 0x04, 0x67, 0x10, 0x20, 0x6D, 0xE6, 0xEC, 
-    0x20, 0x68, 0x00, 0x04, 0x4A, 0x50, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x2B, 0x40, 
-    0xE6, 0xE8, 0x20, 0x2D, 0xE6, 0xE8, 0x67, 0x60, 0x70, 0x00, 0x2B, 0x40, 0xE6, 0xEC, 0x20, 0x0C, 
-    0x67, 0x06, 0x70, 0x01, 0x20, 0x4C, 0x20, 0x80, 0x48, 0x6D, 0xE7, 0xEC, 0x4E, 0xBA, 0xFE, 0x6C, 
-    0x58, 0x4F, 0x4A, 0x40, 0x67, 0x1A, 0x1B, 0x7C, 0x00, 0x14, 0xE7, 0xEC, 0x70, 0x15, 0x2F, 0x00, 
-    0x48, 0x7A, 0x00, 0xBC, 0x48, 0x6D, 0xE7, 0xED, 0x4E, 0xBA, 0x02, 0x5E, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x41, 0xED, 0xE7, 0xEC, 0x2B, 0x48, 0xE7, 0x30, 0x20, 0x2E, 0x00, 0x14, 0x67, 0x0A, 0x41, 0xED, 
-    0xE7, 0x30, 0x22, 0x6E, 0x00, 0x14, 0x22, 0x88, 0x20, 0x2E, 0x00, 0x18, 0x67, 0x66, 0x70, 0x00, 
-    0x20, 0x6E, 0x00, 0x18, 0x20, 0x80, 0x60, 0x5C, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 
-    0x30, 0x10, 0x0C, 0x40, 0x53, 0x48, 0x67, 0x08, 0x20, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x60, 0x50, 
-    0x20, 0x0C, 0x67, 0x10, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x02, 
-    0x20, 0x4C, 0x20, 0x80, 0x20, 0x2E, 0x00, 0x14, 0x67, 0x12, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 
-    0x00, 0x04, 0x20, 0x28, 0x00, 0x06, 0x20, 0x6E, 0x00, 0x14, 0x20, 0x80, 0x20, 0x2E, 0x00, 0x18, 
-    0x67, 0x12, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x0A, 0x20, 0x6E, 
-    0x00, 0x18, 0x20, 0x80, 0x20, 0x0B, 0x67, 0x06, 0x20, 0x4B, 0x20, 0xAD, 0xE6, 0xE8, 0x70, 0x00, 
-    0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x47, 0x65, 0x74, 0x50, 0x72, 0x6F, 
-    0x67, 0x72, 0x61, 0x6D, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x73, 0x00, 0x00, 0x16, 0x41, 0x70, 
-    0x70, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x55, 0x6E, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 
-    0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xB8, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x18, 0x4E, 0xBA, 0xFB, 0x00, 0x4A, 0x80, 0x67, 0x06, 
-    0x70, 0xFF, 0x4E, 0xFA, 0x01, 0x02, 0x2B, 0x4B, 0xEF, 0xC6, 0x48, 0x6D, 0xEF, 0xD2, 0x48, 0x6D, 
-    0xEF, 0xCE, 0x48, 0x6D, 0xEF, 0xCA, 0x48, 0x6D, 0xE6, 0xE8, 0x48, 0x6E, 0xFF, 0xB8, 0x4E, 0xBA, 
-    0xFE, 0x48, 0x4F, 0xEF, 0x00, 0x14, 0x38, 0x00, 0x4A, 0x40, 0x67, 0x0C, 0x32, 0x00, 0x48, 0xC1, 
-    0x2F, 0x01, 0x4E, 0xBA, 0x00, 0xE4, 0x58, 0x4F, 0x70, 0x40, 0x2F, 0x00, 0x48, 0x6D, 0xE6, 0xF0, 
-    0x48, 0x6E, 0xFF, 0xBC, 0x4E, 0xBA, 0x01, 0x32, 0x4F, 0xEF, 0x00, 0x0A, 0x42, 0xA7, 0x4E, 0xBA, 
-    0x05, 0x4E, 0x30, 0x1F, 0x38, 0x00, 0x72, 0x40, 0x2F, 0x01, 0x48, 0x6E, 0xFF, 0xBC, 0x48, 0x6D, 
-    0xE6, 0xF0, 0x4E, 0xBA, 0x01, 0x14, 0x4F, 0xEF, 0x00, 0x0C, 0x30, 0x04, 0x67, 0x0C, 0x2F, 0x3C, 
-    0x80, 0x00, 0x00, 0x00, 0x4E, 0xBA, 0x00, 0xA2, 0x58, 0x4F, 0x20, 0x2D, 0xE6, 0xE8, 0x67, 0x14, 
-    0x20, 0x03, 0x66, 0x54, 0x59, 0x4F, 0x20, 0x6D, 0xEF, 0xCE, 0x2F, 0x10, 0x4E, 0xBA, 0x07, 0x7A, 
-    0x58, 0x4F, 0x60, 0x44, 0x20, 0x03, 0x67, 0x40, 0x2D, 0x6D, 0xEF, 0xCE, 0xFF, 0xFC, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x24, 0x50, 0x20, 0x0A, 0x67, 0x10, 0x59, 0x4F, 0x2F, 0x0A, 0x4E, 0xBA, 0x07, 0x24, 
-    0x58, 0x4F, 0x58, 0xAE, 0xFF, 0xFC, 0x60, 0xE6, 0x2D, 0x6D, 0xEF, 0xD2, 0xFF, 0xFC, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x24, 0x50, 0x20, 0x0A, 0x67, 0x10, 0x59, 0x4F, 0x2F, 0x0A, 0x4E, 0xBA, 0x07, 0x04, 
-    0x58, 0x4F, 0x58, 0xAE, 0xFF, 0xFC, 0x60, 0xE6, 0x20, 0x0C, 0x67, 0x06, 0x20, 0x4C, 0x20, 0xAD, 
-    0xEF, 0xCA, 0x20, 0x2E, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0xAD, 0xEF, 0xCE, 
-    0x20, 0x2E, 0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 0xEF, 0xD2, 0x4E, 0xBA, 
-    0xF9, 0xFE, 0x20, 0x2D, 0xE6, 0xE8, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x52, 0x54, 0x49, 0x6E, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xC0, 0x48, 0xE7, 0x18, 0x00, 
-    0x26, 0x2E, 0x00, 0x08, 0x20, 0x2D, 0xE6, 0xE8, 0x66, 0x16, 0x20, 0x03, 0x02, 0x80, 0x00, 0xFF, 
-    0xFF, 0xFF, 0x28, 0x00, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 0x21, 0x40, 0x00, 0x0E, 
-    0x70, 0x40, 0x2F, 0x00, 0x48, 0x6D, 0xE6, 0xF0, 0x48, 0x6E, 0xFF, 0xC0, 0x4E, 0xBA, 0x00, 0x2A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4E, 0xBA, 0x05, 0xA4, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xC0, 
-    0x4E, 0xBA, 0x02, 0xB2, 0x50, 0x4F, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x52, 0x54, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 
-    0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 
-    0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 
-    0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 
-    0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 
-    0x24, 0x1F, 0x4E, 0x75, 0x87, 0x5F, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x42, 0xA7, 0x3F, 0x3C, 0xA8, 0x6E, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 0x13, 0x16, 
-    0x42, 0xA7, 0x3F, 0x3C, 0xAA, 0x6E, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 0x13, 0x08, 0x20, 0x1F, 
-    0xB0, 0x9F, 0x66, 0x08, 0x3D, 0x7C, 0x02, 0x00, 0x00, 0x08, 0x60, 0x06, 0x3D, 0x7C, 0x04, 0x00, 
-    0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x4E, 0x55, 0x4D, 0x54, 0x4F, 0x4F, 0x4C, 
-    0x42, 0x4F, 0x58, 0x54, 0x52, 0x41, 0x50, 0x53, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x00, 
-    0x30, 0x2E, 0x00, 0x08, 0xC0, 0xBC, 0x00, 0x00, 0x08, 0x00, 0x4A, 0x80, 0x6F, 0x08, 0x1D, 0x7C, 
-    0x00, 0x01, 0x00, 0x0A, 0x60, 0x04, 0x42, 0x2E, 0x00, 0x0A, 0x4E, 0x5E, 0x20, 0x5F, 0x54, 0x4F, 
-    0x4E, 0xD0, 0x8D, 0x5F, 0x5F, 0x47, 0x45, 0x54, 0x54, 0x52, 0x41, 0x50, 0x54, 0x59, 0x50, 0x45, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 0x48, 0xE7, 0x03, 0x00, 0x3E, 0x2E, 0x00, 0x08, 0x42, 0x67, 
-    0x3F, 0x07, 0x4E, 0xBA, 0xFF, 0xB6, 0x10, 0x1F, 0x48, 0x80, 0x32, 0x00, 0x04, 0x41, 0xFF, 0x80, 
-    0x43, 0xBC, 0x00, 0xFF, 0x1C, 0x00, 0x70, 0x01, 0xB0, 0x06, 0x66, 0x1A, 0x70, 0x00, 0x30, 0x07, 
-    0xC0, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0x3E, 0x00, 0x42, 0x67, 0x4E, 0xBA, 0xFF, 0x42, 0xBE, 0x5F, 
-    0x6D, 0x04, 0x3E, 0x3C, 0xA8, 0x9F, 0x42, 0xA7, 0x3F, 0x07, 0x10, 0x06, 0x48, 0x80, 0x32, 0x00, 
-    0x04, 0x41, 0xFF, 0x80, 0x43, 0xBC, 0x00, 0xFF, 0x1F, 0x00, 0x4E, 0xBA, 0x12, 0x48, 0x42, 0xA7, 
-    0x3F, 0x3C, 0xA8, 0x9F, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 0x12, 0x3A, 0x20, 0x1F, 0xB0, 0x9F, 
-    0x56, 0xC0, 0x44, 0x00, 0x1D, 0x40, 0x00, 0x0A, 0x4C, 0xDF, 0x00, 0xC0, 0x4E, 0x5E, 0x20, 0x5F, 
-    0x54, 0x4F, 0x4E, 0xD0, 0x8D, 0x54, 0x52, 0x41, 0x50, 0x41, 0x56, 0x41, 0x49, 0x4C, 0x41, 0x42, 
-    0x4C, 0x45, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 
-    0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x08, 0x01, 0x4E, 0x75, 
-    0x4E, 0xBA, 0x00, 0x2E, 0x20, 0x01, 0x4E, 0x75, 0x85, 0x05, 0x4C, 0x44, 0x49, 0x56, 0x54, 0x00, 
-    0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 
-    0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x08, 0x01, 0xC3, 0x40, 0x4E, 0x75, 
-    0x4A, 0x80, 0x6B, 0x14, 0x4A, 0x81, 0x6B, 0x06, 0x4E, 0xBA, 0x00, 0x50, 0x4E, 0x75, 0x44, 0x81, 
-    0x4E, 0xBA, 0x00, 0x48, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x80, 0x4A, 0x81, 0x6B, 0x0A, 0x4E, 0xBA, 
-    0x00, 0x3A, 0x44, 0x80, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x2E, 0x44, 0x80, 
-    0x4E, 0x75, 0x85, 0x05, 0x4C, 0x4D, 0x4F, 0x44, 0x54, 0x00, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 
-    0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 
-    0x60, 0x08, 0x4C, 0x41, 0x00, 0x01, 0xC3, 0x40, 0x4E, 0x75, 0x3F, 0x01, 0x48, 0x41, 0x4A, 0x41, 
-    0x66, 0x1C, 0x22, 0x00, 0x42, 0x41, 0x48, 0x41, 0x67, 0x0A, 0x82, 0xD7, 0x48, 0x41, 0x48, 0x40, 
-    0x30, 0x01, 0x48, 0x40, 0x80, 0xDF, 0x32, 0x00, 0x42, 0x40, 0x48, 0x40, 0x4E, 0x75, 0x48, 0x41, 
-    0x3E, 0x82, 0x2F, 0x03, 0x34, 0x00, 0x26, 0x01, 0x72, 0x01, 0x42, 0x40, 0x48, 0x40, 0x66, 0x0C, 
-    0x48, 0x40, 0x30, 0x02, 0x72, 0x00, 0x60, 0x16, 0xD2, 0x41, 0x65, 0x12, 0xD4, 0x42, 0xD1, 0x80, 
-    0xB0, 0x83, 0x65, 0xF4, 0x90, 0x83, 0xD2, 0x41, 0x08, 0xC1, 0x00, 0x00, 0x64, 0xEE, 0x26, 0x1F, 
-    0x34, 0x1F, 0x4E, 0x75, 0x86, 0x06, 0x55, 0x4C, 0x4D, 0x4F, 0x44, 0x54, 0x00, 0x00, 0x22, 0x5F, 
-    0x20, 0x57, 0x21, 0x7C, 0xFF, 0x16, 0xB0, 0xBF, 0x00, 0x30, 0x21, 0x4D, 0x00, 0x34, 0x48, 0xD0, 
-    0xDE, 0xFC, 0x70, 0x00, 0x4E, 0xD1, 0x4E, 0x75, 0x88, 0x08, 0x5F, 0x5F, 0x73, 0x65, 0x74, 0x6A, 
-    0x6D, 0x70, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x08, 0x66, 0x02, 0x70, 0x01, 0x20, 0x6F, 0x00, 0x04, 
-    0x22, 0x28, 0x00, 0x30, 0x0C, 0x81, 0xFF, 0xD0, 0x68, 0xCF, 0x67, 0x08, 0x0C, 0x81, 0xFF, 0x16, 
-    0xB0, 0xBF, 0x66, 0x04, 0x2A, 0x68, 0x00, 0x34, 0x4C, 0xD0, 0xDE, 0xFC, 0x4E, 0xD1, 0x4E, 0x75, 
-    0x87, 0x07, 0x6C, 0x6F, 0x6E, 0x67, 0x6A, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x18, 0x20, 0x28, 0x2E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x04, 0xE5, 0x83, 
-    0xD6, 0xAD, 0xEF, 0xF0, 0x20, 0x43, 0x4A, 0x90, 0x66, 0x10, 0x20, 0x04, 0xE5, 0x80, 0xD0, 0xAD, 
-    0xEF, 0xF0, 0x20, 0x40, 0x20, 0x8A, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4C, 0xDF, 0x04, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x5F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x4C, 0x69, 0x62, 
-    0x45, 0x78, 0x69, 0x74, 0x50, 0x72, 0x6F, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x6D, 0xEF, 0xF0, 0x70, 0x10, 0xD1, 0xC0, 0x28, 0x48, 
-    0x20, 0x6D, 0xEF, 0xF0, 0x41, 0xE8, 0x00, 0xB0, 0x24, 0x4C, 0xB1, 0xCA, 0x63, 0x0E, 0x4A, 0x92, 
-    0x66, 0x06, 0x24, 0x8B, 0x70, 0x00, 0x60, 0x06, 0x58, 0x4C, 0x60, 0xE4, 0x70, 0x01, 0x4C, 0xDF, 
-    0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x61, 0x74, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x2E, 0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 
-    0x20, 0x03, 0xE5, 0x80, 0xD0, 0xAD, 0xEF, 0xF0, 0x28, 0x40, 0x20, 0x04, 0xE5, 0x80, 0xD0, 0xAD, 
-    0xEF, 0xF0, 0x20, 0x40, 0x24, 0x4C, 0xB1, 0xCA, 0x62, 0x10, 0x26, 0x52, 0x20, 0x0B, 0x67, 0x06, 
-    0x4E, 0x93, 0x70, 0x00, 0x24, 0x80, 0x59, 0x4C, 0x60, 0xE0, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x5F, 0x44, 0x6F, 0x45, 0x78, 0x69, 0x74, 0x50, 0x72, 0x6F, 0x63, 0x73, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x2E, 
-    0x00, 0x0C, 0x26, 0x4A, 0x20, 0x03, 0xE4, 0x88, 0x2A, 0x00, 0x70, 0x00, 0x28, 0x00, 0x20, 0x04, 
-    0xB0, 0x85, 0x6C, 0x10, 0x70, 0x00, 0x22, 0x04, 0xE5, 0x81, 0xD2, 0x8B, 0x20, 0x41, 0x20, 0x80, 
-    0x52, 0x84, 0x60, 0xEA, 0x20, 0x05, 0xE5, 0x88, 0xB0, 0x83, 0x67, 0x22, 0x20, 0x04, 0xE5, 0x80, 
-    0xD0, 0x8B, 0x28, 0x40, 0x70, 0x00, 0x28, 0x00, 0x20, 0x03, 0x22, 0x05, 0xE5, 0x89, 0x90, 0x81, 
-    0xB0, 0x84, 0x63, 0x0A, 0x20, 0x4C, 0xD1, 0xC4, 0x42, 0x10, 0x52, 0x84, 0x60, 0xEA, 0x4C, 0xDF, 
-    0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x5F, 0x7A, 0x65, 0x72, 0x6F, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x1C, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x48, 0x6D, 0xE6, 0xF0, 0x4E, 0xBA, 
-    0xFE, 0x3E, 0x58, 0x4F, 0x4A, 0x80, 0x67, 0x0C, 0x30, 0x3C, 0xF4, 0xFB, 0x3D, 0x40, 0x00, 0x0C, 
-    0x4E, 0xFA, 0x01, 0x1E, 0x70, 0x34, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0xDA, 0x4E, 0xBA, 0xFF, 0x64, 
-    0x50, 0x4F, 0x3B, 0x7C, 0x53, 0x48, 0xEF, 0xDA, 0x2B, 0x7C, 0x81, 0x00, 0x00, 0x00, 0xEF, 0xE8, 
-    0x41, 0xED, 0xE7, 0x3C, 0x2B, 0x48, 0xEF, 0xF0, 0x48, 0x6D, 0xEF, 0xE4, 0x48, 0x6D, 0xEF, 0xE0, 
-    0x48, 0x6D, 0xEF, 0xDC, 0x48, 0x6D, 0xF0, 0x0E, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0xF8, 0x6A, 
-    0x4F, 0xEF, 0x00, 0x14, 0x38, 0x00, 0x4A, 0x40, 0x67, 0x0C, 0x30, 0x3C, 0xF4, 0xFB, 0x3D, 0x40, 
-    0x00, 0x0C, 0x4E, 0xFA, 0x00, 0xCC, 0x20, 0x2D, 0xE6, 0xEC, 0x67, 0x00, 0x00, 0xB0, 0x20, 0x6D, 
-    0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 0x30, 0x10, 0xB0, 0x6D, 0xEF, 0xDA, 0x67, 0x0C, 0x2F, 0x3C, 
-    0x80, 0x00, 0x00, 0x00, 0x4E, 0xBA, 0xFA, 0xE2, 0x58, 0x4F, 0x41, 0xED, 0xEF, 0xDA, 0x22, 0x6D, 
-    0xE6, 0xEC, 0x22, 0x69, 0x00, 0x04, 0x23, 0x48, 0x00, 0x24, 0x24, 0x6D, 0xE6, 0xEC, 0x20, 0x2A, 
-    0x00, 0x04, 0x2B, 0x40, 0xEF, 0xFE, 0x20, 0x6A, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x20, 0x67, 0x6C, 
-    0x70, 0x78, 0xA1, 0x1E, 0x2B, 0x48, 0xEF, 0xFA, 0x20, 0x08, 0x66, 0x0A, 0x70, 0x02, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xFA, 0xA6, 0x58, 0x4F, 0x20, 0x6D, 0xE6, 0xEC, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 
-    0x00, 0x20, 0x28, 0x40, 0x70, 0x00, 0x2A, 0x00, 0x26, 0x05, 0x70, 0x05, 0xB6, 0x80, 0x6C, 0x3C, 
-    0x20, 0x03, 0xC6, 0xFC, 0x00, 0x18, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x18, 0x48, 0x40, 0x42, 0x40, 
-    0xD6, 0x80, 0xD6, 0x8C, 0x20, 0x43, 0x20, 0x05, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x18, 0x48, 0x41, 
-    0xC2, 0xFC, 0x00, 0x18, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAD, 0xEF, 0xFA, 0x22, 0x40, 
-    0x70, 0x05, 0x22, 0xD8, 0x51, 0xC8, 0xFF, 0xFC, 0x52, 0x85, 0x60, 0xBC, 0x70, 0x40, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE6, 0xF0, 0x4E, 0xBA, 0xFE, 0x5C, 0x50, 0x4F, 0x42, 0x40, 0x3D, 0x40, 0x00, 0x0C, 
-    0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x20, 0x5F, 0x58, 0x4F, 0x4E, 0xD0, 0x8B, 0x5F, 0x49, 0x4E, 
-    0x54, 0x45, 0x4E, 0x56, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 
-    0xE6, 0xF0, 0x4E, 0xBA, 0xFC, 0xEA, 0x58, 0x4F, 0x4A, 0x80, 0x67, 0x02, 0x60, 0x2E, 0x70, 0x01, 
-    0x2F, 0x00, 0x70, 0x2B, 0x2F, 0x00, 0x4E, 0xBA, 0xFD, 0xC8, 0x50, 0x4F, 0x20, 0x2D, 0xF0, 0x0E, 
-    0x66, 0x0C, 0x20, 0x2D, 0xEF, 0xFA, 0x67, 0x06, 0x20, 0x6D, 0xEF, 0xFA, 0xA0, 0x1F, 0x70, 0x40, 
-    0x2F, 0x00, 0x48, 0x6D, 0xE6, 0xF0, 0x4E, 0xBA, 0xFD, 0xFA, 0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8B, 0x5F, 0x49, 0x4E, 0x54, 0x45, 0x4E, 0x56, 0x54, 0x45, 0x52, 0x4D, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x18, 0x00, 0x26, 0x2E, 0x00, 0x08, 0x20, 0x2D, 0xEF, 0xEC, 0x66, 0x04, 
-    0x4E, 0xBA, 0x0A, 0xB4, 0x42, 0x40, 0x20, 0x6D, 0xEF, 0xEC, 0x31, 0x40, 0x00, 0x02, 0x70, 0x01, 
-    0x28, 0x00, 0x20, 0x03, 0x72, 0x01, 0xC0, 0x81, 0x66, 0x0A, 0x20, 0x03, 0xE2, 0x80, 0x26, 0x00, 
-    0x52, 0x84, 0x60, 0xEE, 0x20, 0x04, 0x72, 0x18, 0xE3, 0xA8, 0x2F, 0x00, 0x4E, 0xBA, 0x0C, 0x1C, 
-    0x58, 0x4F, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x69, 0x67, 0x5F, 0x64, 
-    0x66, 0x6C, 0x00, 0x00, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 
-    0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 0x4E, 0x75, 
-    0x4E, 0x75, 0x4E, 0x75, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x21, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 
-    0x4E, 0xD1, 0x20, 0x2F, 0x00, 0x04, 0x2F, 0x40, 0x00, 0x08, 0x67, 0x26, 0x20, 0x40, 0x22, 0x48, 
-    0x10, 0x19, 0x67, 0x1E, 0x12, 0x11, 0x12, 0xC0, 0x10, 0x01, 0x66, 0xF8, 0x93, 0xC8, 0x20, 0x09, 
-    0x53, 0x40, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0x10, 0x80, 0x22, 0x5F, 0x58, 0x4F, 0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x1F, 0x2E, 0x80, 0x67, 0x12, 
-    0x20, 0x40, 0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 0x00, 0x01, 0x51, 0xC8, 0xFF, 0xFA, 
-    0x42, 0x10, 0x4E, 0xD1, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x24, 0x6E, 0x00, 0x08, 
-    0x26, 0x2E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x2F, 0x0B, 0x2F, 0x03, 0x2F, 0x0A, 0x42, 0xA7, 
-    0x4E, 0xBA, 0x09, 0x04, 0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x66, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 0x70, 0xFF, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x03, 0x34, 0x58, 0x4F, 0x28, 0x40, 0x4A, 0x80, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x4A, 0x30, 0x03, 0x52, 0x40, 0x24, 0x4C, 0x34, 0x80, 0x42, 0x40, 0x35, 0x40, 
-    0x00, 0x02, 0x70, 0x00, 0x25, 0x40, 0x00, 0x04, 0x2F, 0x0A, 0x2F, 0x3C, 0x00, 0x00, 0x64, 0x00, 
-    0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xF8, 0x4E, 0xBA, 0x08, 0x9E, 0x4F, 0xEF, 0x00, 0x10, 0x28, 0x00, 
-    0x4A, 0x80, 0x67, 0x08, 0x42, 0x40, 0x34, 0x80, 0x70, 0xFF, 0x60, 0x12, 0x24, 0x4C, 0x4A, 0xAA, 
-    0x00, 0x04, 0x66, 0x06, 0x25, 0x6E, 0xFF, 0xF8, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 
-    0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6A, 0x10, 
-    0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0xFE, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x42, 
-    0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0xA4, 0x58, 0x4F, 0x24, 0x40, 0x4A, 0x80, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x2E, 0x2F, 0x0A, 0x20, 0x4A, 0x22, 0x68, 0x00, 0x04, 0x22, 0x69, 0x00, 0x08, 
-    0x4E, 0x91, 0x58, 0x4F, 0x26, 0x00, 0x42, 0x41, 0x20, 0x4A, 0x30, 0x81, 0x4A, 0x80, 0x67, 0x10, 
-    0x3F, 0x28, 0x00, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0xBE, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x02, 
-    0x70, 0x00, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 0x6C, 0x6F, 0x73, 0x65, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x6A, 0x10, 0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x8A, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x60, 0x6C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0x30, 0x58, 0x4F, 0x26, 0x40, 
-    0x4A, 0x80, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x58, 0x20, 0x4B, 0x30, 0x10, 0x48, 0xC0, 0x72, 0x01, 
-    0xC0, 0x81, 0x66, 0x10, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x5A, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x60, 0x3C, 0x24, 0x4B, 0x25, 0x6E, 0x00, 0x10, 0x00, 0x0C, 0x25, 0x6E, 0x00, 0x0C, 
-    0x00, 0x10, 0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x0C, 0x4E, 0x90, 0x58, 0x4F, 
-    0x26, 0x00, 0x4A, 0x80, 0x67, 0x10, 0x3F, 0x2A, 0x00, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x28, 
-    0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x0A, 0x20, 0x2E, 0x00, 0x10, 0x20, 0x4B, 0x90, 0xA8, 0x00, 0x0C, 
-    0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x6A, 0x10, 0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0xEC, 0x5C, 0x4F, 0x70, 0xFF, 
-    0x60, 0x6C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x01, 0x92, 0x58, 0x4F, 0x26, 0x40, 0x4A, 0x80, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x58, 0x20, 0x4B, 0x30, 0x10, 0x48, 0xC0, 0x72, 0x02, 0xC0, 0x81, 
-    0x66, 0x10, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0xBC, 0x5C, 0x4F, 0x70, 0xFF, 
-    0x60, 0x3C, 0x24, 0x4B, 0x25, 0x6E, 0x00, 0x10, 0x00, 0x0C, 0x25, 0x6E, 0x00, 0x0C, 0x00, 0x10, 
-    0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x10, 0x4E, 0x90, 0x58, 0x4F, 0x26, 0x00, 
-    0x4A, 0x80, 0x67, 0x10, 0x3F, 0x2A, 0x00, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x8A, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x60, 0x0A, 0x20, 0x2E, 0x00, 0x10, 0x20, 0x4B, 0x90, 0xA8, 0x00, 0x0C, 0x4C, 0xDF, 
-    0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x38, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6A, 0x12, 
-    0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x4E, 0x5C, 0x4F, 0x70, 0xFF, 0x4E, 0xFA, 
-    0x00, 0xEA, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0xF2, 0x58, 0x4F, 0x26, 0x40, 0x4A, 0x80, 
-    0x66, 0x06, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0xD4, 0x20, 0x2E, 0x00, 0x0C, 0x0C, 0x80, 0x00, 0x00, 
-    0x66, 0x01, 0x67, 0x3A, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x20, 0x4B, 
-    0x20, 0x68, 0x00, 0x04, 0x20, 0x68, 0x00, 0x14, 0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 
-    0x4A, 0x80, 0x66, 0x06, 0x70, 0x00, 0x4E, 0xFA, 0x00, 0xA2, 0x20, 0x4B, 0x3F, 0x28, 0x00, 0x02, 
-    0x2F, 0x03, 0x4E, 0xBA, 0x04, 0xF2, 0x5C, 0x4F, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0x8E, 0x0C, 0xAE, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6A, 0x10, 0x42, 0x67, 0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x04, 0xD6, 0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x72, 0x70, 0xFF, 0x90, 0xAE, 0x00, 0x10, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x00, 0x72, 0x58, 0x4F, 0x28, 0x40, 0x4A, 0x80, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x54, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0x5E, 0x58, 0x4F, 
-    0x26, 0x40, 0x20, 0x40, 0x24, 0x4C, 0x72, 0x04, 0x24, 0xD8, 0x51, 0xC9, 0xFF, 0xFC, 0x42, 0xA7, 
-    0x2F, 0x3C, 0x00, 0x00, 0x66, 0x01, 0x2F, 0x00, 0x20, 0x40, 0x22, 0x68, 0x00, 0x04, 0x22, 0x69, 
-    0x00, 0x14, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x00, 0x4A, 0x80, 0x67, 0x18, 0x42, 0x41, 
-    0x20, 0x4C, 0x30, 0x81, 0x20, 0x4B, 0x3F, 0x28, 0x00, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x68, 
-    0x5C, 0x4F, 0x70, 0xFF, 0x60, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x69, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x30, 0x2D, 0xEF, 0xF4, 0x66, 0x04, 0x4E, 0xBA, 0x01, 0x5E, 
-    0x30, 0x2D, 0xEF, 0xF4, 0x42, 0x81, 0x32, 0x00, 0x20, 0x01, 0x80, 0xFC, 0x00, 0x14, 0x48, 0xC0, 
-    0x53, 0x80, 0x28, 0x00, 0x20, 0x4B, 0x26, 0x10, 0x6B, 0x04, 0x22, 0x03, 0x60, 0x04, 0x72, 0xFF, 
-    0x92, 0x83, 0xB2, 0x80, 0x6F, 0x12, 0x42, 0x67, 0x70, 0x16, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x08, 
-    0x5C, 0x4F, 0x70, 0x00, 0x4E, 0xFA, 0x01, 0x10, 0x20, 0x4B, 0x26, 0x10, 0x6B, 0x34, 0x20, 0x03, 
-    0xC6, 0xFC, 0x00, 0x14, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x40, 0x42, 0x40, 0xD6, 0x80, 
-    0xD6, 0xAD, 0xEF, 0xF6, 0x28, 0x43, 0x20, 0x43, 0x4A, 0x50, 0x66, 0x00, 0x00, 0xE8, 0x42, 0x67, 
-    0x70, 0x09, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0xD0, 0x5C, 0x4F, 0x70, 0x00, 0x28, 0x40, 0x60, 0x00, 
-    0x00, 0xD4, 0x70, 0xFF, 0x20, 0x4B, 0x90, 0x90, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 
-    0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAD, 0xEF, 0xF6, 0x28, 0x40, 
-    0x20, 0x04, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 
-    0x42, 0x41, 0xD0, 0x81, 0xD0, 0xAD, 0xEF, 0xF6, 0x20, 0x40, 0x24, 0x4C, 0xB1, 0xCA, 0x65, 0x0C, 
-    0x4A, 0x52, 0x66, 0x02, 0x60, 0x06, 0x70, 0x14, 0xD9, 0xC0, 0x60, 0xD4, 0x20, 0x04, 0x22, 0x00, 
-    0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 
-    0xD0, 0xAD, 0xEF, 0xF6, 0x20, 0x40, 0xB1, 0xCC, 0x64, 0x58, 0x30, 0x2D, 0xEF, 0xF4, 0x48, 0xC0, 
-    0x06, 0x80, 0x00, 0x00, 0x01, 0x90, 0x2F, 0x00, 0x2F, 0x2D, 0xEF, 0xF6, 0x4E, 0xBA, 0x03, 0xFE, 
-    0x50, 0x4F, 0x2D, 0x40, 0xFF, 0xFC, 0x4A, 0x80, 0x66, 0x10, 0x42, 0x67, 0x70, 0x18, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x03, 0x34, 0x5C, 0x4F, 0x70, 0x00, 0x60, 0x3C, 0x20, 0x04, 0x52, 0x80, 0x22, 0x00, 
-    0xC0, 0xFC, 0x00, 0x14, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x14, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 
-    0xD0, 0xAE, 0xFF, 0xFC, 0x28, 0x40, 0x06, 0x6D, 0x01, 0x90, 0xEF, 0xF4, 0x2B, 0x6E, 0xFF, 0xFC, 
-    0xEF, 0xF6, 0x20, 0x4C, 0x91, 0xED, 0xEF, 0xF6, 0x20, 0x08, 0x72, 0x14, 0x4E, 0xBA, 0xF5, 0xEE, 
-    0x20, 0x4B, 0x20, 0x80, 0x20, 0x0C, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 
-    0x67, 0x65, 0x74, 0x49, 0x4F, 0x50, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 
-    0x3B, 0x7C, 0x01, 0x90, 0xEF, 0xF4, 0x2F, 0x3C, 0x00, 0x00, 0x01, 0x90, 0x42, 0xA7, 0x4E, 0xBA, 
-    0x03, 0x7C, 0x50, 0x4F, 0x2B, 0x40, 0xEF, 0xF6, 0x22, 0x2D, 0xEF, 0xFE, 0x67, 0x42, 0x20, 0x6D, 
-    0xEF, 0xFE, 0x20, 0x68, 0x00, 0x1C, 0x22, 0x40, 0x70, 0x3C, 0xA0, 0x2E, 0x26, 0x6D, 0xEF, 0xF6, 
-    0x20, 0x6D, 0xEF, 0xF6, 0x70, 0x28, 0xD1, 0xC0, 0x24, 0x4B, 0xB1, 0xCA, 0x65, 0x4A, 0x4A, 0x52, 
-    0x67, 0x18, 0x42, 0xA7, 0x2F, 0x3C, 0x00, 0x00, 0x66, 0x01, 0x2F, 0x0A, 0x20, 0x6A, 0x00, 0x04, 
-    0x20, 0x68, 0x00, 0x14, 0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x14, 0xD7, 0xC0, 0x60, 0xD0, 
-    0x42, 0xA7, 0x48, 0x7A, 0x00, 0x44, 0x4E, 0xBA, 0xFA, 0xD2, 0x50, 0x4F, 0x70, 0x01, 0x2F, 0x00, 
-    0x48, 0x7A, 0x00, 0x42, 0x4E, 0xBA, 0xFA, 0xC4, 0x50, 0x4F, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x7A, 
-    0x00, 0x40, 0x4E, 0xBA, 0xFA, 0xB6, 0x50, 0x4F, 0x48, 0x7A, 0x00, 0x42, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF6, 0x9A, 0x50, 0x4F, 0x20, 0x2D, 0xEF, 0xEC, 0x66, 0x04, 0x4E, 0xBA, 0x04, 0x58, 
-    0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x75, 0x00, 0x24, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 
-    0x6F, 0x6C, 0x65, 0x00, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 
-    0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x48, 0xE7, 0x1C, 0x00, 
-    0x30, 0x2D, 0xEF, 0xF4, 0x42, 0x81, 0x32, 0x00, 0x20, 0x01, 0x80, 0xFC, 0x00, 0x14, 0x48, 0xC0, 
-    0x53, 0x80, 0x2A, 0x00, 0x70, 0x00, 0x28, 0x00, 0x26, 0x04, 0xB6, 0x85, 0x6E, 0x0C, 0x2F, 0x03, 
-    0x4E, 0xBA, 0xFA, 0xCC, 0x58, 0x4F, 0x52, 0x84, 0x60, 0xEE, 0x20, 0x2D, 0xF0, 0x0E, 0x67, 0x04, 
-    0x4E, 0xBA, 0xF9, 0x8C, 0x4C, 0xDF, 0x00, 0x38, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x18, 0x00, 0x36, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x28, 0x00, 0x30, 0x03, 0x48, 0xC0, 0x67, 0x00, 
-    0x01, 0xA0, 0x72, 0xC4, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xE6, 0x72, 0xDB, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xE6, 0x72, 0xDF, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xE6, 0x72, 0xDE, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xDE, 0x72, 0xD0, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xDE, 0x72, 0xD9, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xDE, 0x72, 0xC6, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xDE, 0x72, 0xD1, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xDE, 0x72, 0xD3, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xDC, 0x72, 0xD5, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xDA, 0x72, 0xDA, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xD8, 0x72, 0xC5, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xD6, 0x72, 0xDC, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xD4, 0x72, 0x94, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xD2, 0x72, 0xC8, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xD0, 0x72, 0xC7, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xCE, 0x72, 0xDD, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xCC, 0x72, 0xCF, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xCA, 0x72, 0xCE, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xC8, 0x72, 0xCA, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xC6, 0x72, 0xD8, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xC4, 0x72, 0xCD, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xC2, 0x72, 0xD6, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xC0, 0x72, 0xCB, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xBE, 0x72, 0xC9, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xBC, 0x72, 0xD2, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xBA, 0x72, 0xC3, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xB8, 0x72, 0xD4, 0xB0, 0x81, 0x67, 0x00, 
-    0x00, 0xB6, 0x72, 0x88, 0xB0, 0x81, 0x67, 0x00, 0x00, 0xB4, 0x60, 0x00, 0x00, 0xB4, 0x70, 0x14, 
-    0x28, 0x00, 0x60, 0x00, 0x00, 0xAC, 0x70, 0x0E, 0x28, 0x00, 0x60, 0x00, 0x00, 0xA4, 0x70, 0x1C, 
-    0x28, 0x00, 0x60, 0x00, 0x00, 0x9C, 0x70, 0x11, 0x28, 0x00, 0x60, 0x00, 0x00, 0x94, 0x70, 0x06, 
-    0x28, 0x00, 0x60, 0x00, 0x00, 0x8C, 0x70, 0x14, 0x28, 0x00, 0x60, 0x00, 0x00, 0x84, 0x70, 0x1F, 
-    0x28, 0x00, 0x60, 0x7C, 0x70, 0x10, 0x28, 0x00, 0x60, 0x76, 0x70, 0x02, 0x28, 0x00, 0x60, 0x70, 
-    0x70, 0x09, 0x28, 0x00, 0x60, 0x6A, 0x70, 0x04, 0x28, 0x00, 0x60, 0x64, 0x70, 0x05, 0x28, 0x00, 
-    0x60, 0x5E, 0x70, 0x0C, 0x28, 0x00, 0x60, 0x58, 0x70, 0x06, 0x28, 0x00, 0x60, 0x52, 0x70, 0x14, 
-    0x28, 0x00, 0x60, 0x4C, 0x70, 0x06, 0x28, 0x00, 0x60, 0x46, 0x70, 0x1A, 0x28, 0x00, 0x60, 0x40, 
-    0x70, 0x16, 0x28, 0x00, 0x60, 0x3A, 0x70, 0x0D, 0x28, 0x00, 0x60, 0x34, 0x70, 0x1D, 0x28, 0x00, 
-    0x60, 0x2E, 0x70, 0x09, 0x28, 0x00, 0x60, 0x28, 0x70, 0x17, 0x28, 0x00, 0x60, 0x22, 0x70, 0x06, 
-    0x28, 0x00, 0x60, 0x1C, 0x70, 0x10, 0x28, 0x00, 0x60, 0x16, 0x70, 0x1E, 0x28, 0x00, 0x60, 0x10, 
-    0x70, 0x0D, 0x28, 0x00, 0x60, 0x0A, 0x70, 0x1E, 0x28, 0x00, 0x60, 0x04, 0x70, 0x14, 0x28, 0x00, 
-    0x20, 0x04, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x6D, 0x61, 0x70, 0x4F, 
-    0x53, 0x65, 0x72, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x00, 0x28, 0x2E, 
-    0x00, 0x08, 0x3A, 0x2E, 0x00, 0x0C, 0x36, 0x05, 0x3B, 0x43, 0xF0, 0x16, 0x4A, 0x43, 0x66, 0x04, 
-    0x20, 0x04, 0x60, 0x08, 0x3F, 0x03, 0x4E, 0xBA, 0xFE, 0x12, 0x54, 0x4F, 0x2B, 0x40, 0xF0, 0x12, 
-    0x4C, 0xDF, 0x00, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x75, 0x65, 0x72, 0x72, 0x6F, 0x72, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x1E, 0x00, 0x26, 0x2E, 0x00, 0x08, 0x28, 0x2E, 
-    0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x10, 0x2D, 0x45, 0xFF, 0xF8, 0x2D, 0x44, 0xFF, 0xFC, 0x48, 0x6E, 
-    0xFF, 0xF8, 0x2F, 0x3C, 0x00, 0x00, 0x66, 0x00, 0x2F, 0x03, 0x4E, 0xBA, 0xFA, 0x32, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2C, 0x00, 0x4A, 0x80, 0x66, 0x06, 0x20, 0x2E, 0xFF, 0xFC, 0x60, 0x02, 0x70, 0xFF, 
-    0x4C, 0xDF, 0x00, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x6C, 0x73, 0x65, 0x65, 0x6B, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x42, 0xA7, 0x2F, 0x3C, 0x00, 0x00, 
-    0x64, 0x01, 0x2F, 0x0A, 0x4E, 0xBA, 0xF7, 0x8E, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x75, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 
-    0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 0x70, 0x00, 0x28, 0x00, 
-    0x20, 0x0B, 0x67, 0x1C, 0x59, 0x4F, 0x2F, 0x0B, 0x4E, 0xBA, 0xF6, 0xFA, 0x20, 0x1F, 0x28, 0x00, 
-    0x22, 0x03, 0xB2, 0x80, 0x6C, 0x0A, 0x20, 0x4B, 0x20, 0x03, 0xA0, 0x20, 0x20, 0x0B, 0x60, 0x4C, 
-    0x20, 0x03, 0xA1, 0x1E, 0x28, 0x48, 0x55, 0x4F, 0x3E, 0xB8, 0x02, 0x20, 0x30, 0x1F, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x38, 0x20, 0x0B, 0x67, 0x0C, 0x20, 0x4B, 0x22, 0x4C, 0x20, 0x04, 0xA0, 0x2E, 
-    0x20, 0x4B, 0xA0, 0x1F, 0x24, 0x4C, 0xD5, 0xC4, 0x2D, 0x4A, 0xFF, 0xF8, 0x20, 0x4C, 0xD1, 0xC3, 
-    0x2D, 0x48, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xF8, 0xB1, 0xEE, 0xFF, 0xFC, 0x64, 0x0C, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x42, 0x10, 0x60, 0xEA, 0x20, 0x0C, 0x4C, 0xDF, 0x1C, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x67, 0x72, 0x6F, 0x77, 0x46, 0x69, 0x6C, 0x65, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1E, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x28, 0x2E, 0x00, 0x10, 0x20, 0x2D, 0xEF, 0xFA, 0x66, 0x08, 
-    0x41, 0xED, 0xF0, 0x18, 0x2B, 0x48, 0xEF, 0xFA, 0x2D, 0x6D, 0xEF, 0xFA, 0xFF, 0xFC, 0x20, 0x6D, 
-    0xEF, 0xFA, 0x70, 0x78, 0xD1, 0xC0, 0x24, 0x6E, 0xFF, 0xFC, 0xB1, 0xCA, 0x63, 0x10, 0x4A, 0xAA, 
-    0x00, 0x04, 0x66, 0x02, 0x60, 0x08, 0x70, 0x18, 0xD1, 0xAE, 0xFF, 0xFC, 0x60, 0xE0, 0x2A, 0x3C, 
-    0x40, 0x00, 0x00, 0x06, 0x70, 0x18, 0x91, 0xAE, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0xB1, 0xED, 
-    0xEF, 0xFA, 0x65, 0x18, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x04, 0x2F, 0x0C, 0x20, 0x68, 0x00, 0x04, 
-    0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x0C, 0x2A, 0x00, 0x4A, 0x80, 0x6B, 0xD8, 0x20, 0x0B, 0x67, 0x10, 
-    0x20, 0x6E, 0xFF, 0xFC, 0xB1, 0xED, 0xEF, 0xFA, 0x65, 0x06, 0x20, 0x4B, 0x20, 0xAE, 0xFF, 0xFC, 
-    0x26, 0x05, 0x02, 0x83, 0x40, 0x00, 0x00, 0x00, 0x66, 0x04, 0x20, 0x05, 0x60, 0x24, 0x30, 0x05, 
-    0x3C, 0x00, 0x4A, 0x40, 0x6A, 0x06, 0x70, 0x00, 0x2A, 0x00, 0x60, 0x0A, 0x02, 0x85, 0xBF, 0xFF, 
-    0xFF, 0xFF, 0x42, 0x40, 0x3C, 0x00, 0x3F, 0x06, 0x2F, 0x05, 0x4E, 0xBA, 0xFD, 0xFA, 0x5C, 0x4F, 
-    0x70, 0xFF, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x61, 0x63, 0x63, 
-    0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x41, 0xED, 0xF0, 0x90, 0x2B, 0x48, 0xEF, 0xEC, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1C, 0x38, 0x26, 0x2E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 
-    0x20, 0x2D, 0xEF, 0xEC, 0x66, 0x04, 0x4E, 0xBA, 0xFF, 0xDE, 0x70, 0x00, 0x2A, 0x00, 0x28, 0x03, 
-    0x20, 0x04, 0x72, 0x01, 0xC0, 0x81, 0x66, 0x1E, 0x0C, 0x85, 0x00, 0x00, 0x00, 0x10, 0x65, 0x0C, 
-    0x70, 0x16, 0x2B, 0x40, 0xF0, 0x12, 0x70, 0xFF, 0x4E, 0xFA, 0x00, 0xB0, 0x52, 0x85, 0x20, 0x04, 
-    0xE2, 0x80, 0x28, 0x00, 0x60, 0xDA, 0x20, 0x05, 0xE5, 0x80, 0x41, 0xED, 0xF0, 0xD8, 0xD0, 0x88, 
-    0x28, 0x40, 0x20, 0x6D, 0xEF, 0xEC, 0x32, 0x28, 0x00, 0x02, 0x70, 0x00, 0x30, 0x01, 0xC0, 0x83, 
-    0x66, 0x08, 0x70, 0x03, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x14, 0x20, 0x4C, 0x24, 0x50, 0xB5, 0xED, 
-    0xF0, 0xD4, 0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 0x20, 0x0A, 0x2D, 0x40, 0xFF, 0xFC, 0xB6, 0xFC, 
-    0x00, 0x03, 0x66, 0x0E, 0x20, 0x6D, 0xEF, 0xEC, 0x30, 0x03, 0x46, 0x40, 0xC1, 0x68, 0x00, 0x02, 
-    0x60, 0x54, 0xB6, 0xFC, 0x00, 0x05, 0x66, 0x3A, 0x20, 0x6D, 0xEF, 0xEC, 0x30, 0x03, 0x81, 0x68, 
-    0x00, 0x02, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x02, 0x66, 0x10, 0x20, 0x6D, 0xEF, 0xEC, 0x32, 0x10, 
-    0x70, 0x00, 0x30, 0x01, 0xC0, 0x83, 0x67, 0x2E, 0x60, 0xF0, 0x24, 0x6D, 0xEF, 0xEC, 0x4A, 0x52, 
-    0x67, 0x24, 0x30, 0x03, 0x46, 0x40, 0xC1, 0x52, 0x2F, 0x03, 0x4E, 0xBA, 0x00, 0x30, 0x58, 0x4F, 
-    0x60, 0x14, 0x24, 0x4B, 0x70, 0x01, 0xB5, 0xC0, 0x66, 0x06, 0x41, 0xFA, 0xF4, 0x52, 0x60, 0x02, 
-    0x20, 0x4A, 0x22, 0x4C, 0x22, 0x88, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1C, 0x30, 0x26, 0x2E, 0x00, 0x08, 0x20, 0x2D, 0xEF, 0xEC, 0x66, 0x04, 0x4E, 0xBA, 
-    0xFE, 0xE6, 0x70, 0x00, 0x2A, 0x00, 0x28, 0x03, 0x20, 0x04, 0x72, 0x01, 0xC0, 0x81, 0x66, 0x16, 
-    0x0C, 0x85, 0x00, 0x00, 0x00, 0x10, 0x65, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x52, 0x85, 0x20, 0x04, 
-    0xE2, 0x80, 0x28, 0x00, 0x60, 0xE2, 0x20, 0x05, 0xE5, 0x80, 0x41, 0xED, 0xF0, 0xD8, 0x20, 0x30, 
-    0x00, 0x00, 0x26, 0x40, 0x4A, 0x80, 0x66, 0x04, 0x70, 0x00, 0x60, 0x2E, 0x24, 0x6D, 0xEF, 0xEC, 
-    0x32, 0x2A, 0x00, 0x02, 0x70, 0x00, 0x30, 0x01, 0xC0, 0x83, 0x66, 0x08, 0x30, 0x03, 0x81, 0x52, 
-    0x70, 0xFF, 0x60, 0x16, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xBA, 0xFE, 0x94, 0x50, 0x4F, 
-    0x2F, 0x03, 0x20, 0x4B, 0x4E, 0x90, 0x58, 0x4F, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x72, 0x61, 0x69, 0x73, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 
-    0x26, 0x2E, 0x00, 0x08, 0x2F, 0x03, 0x4E, 0xBA, 0xED, 0x60, 0x58, 0x4F, 0x26, 0x1F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x84, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFD, 0xF8, 0x48, 0xE7, 
-    0x10, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x2D, 0x4A, 0xFF, 0xF8, 0x41, 0xEE, 
-    0xFD, 0xF9, 0x28, 0x48, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0xFF, 
-    0xFF, 0xFC, 0x6C, 0x1A, 0x20, 0x6E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x20, 0x4C, 
-    0x52, 0x4C, 0x10, 0x80, 0x4A, 0x00, 0x67, 0x06, 0x52, 0xAE, 0xFF, 0xFC, 0x60, 0xDC, 0x1D, 0x6E, 
-    0xFF, 0xFF, 0xFD, 0xF8, 0x2D, 0x4B, 0xFF, 0xF8, 0x41, 0xEE, 0xFE, 0xF9, 0x28, 0x48, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x0C, 0xAE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x6C, 0x1A, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x10, 0x10, 0x20, 0x4C, 0x52, 0x4C, 0x10, 0x80, 0x4A, 0x00, 
-    0x67, 0x06, 0x52, 0xAE, 0xFF, 0xFC, 0x60, 0xDC, 0x1D, 0x6E, 0xFF, 0xFF, 0xFE, 0xF8, 0x55, 0x4F, 
-    0x48, 0x6E, 0xFD, 0xF8, 0x48, 0x6E, 0xFE, 0xF8, 0x1F, 0x2E, 0x00, 0x10, 0x1F, 0x2E, 0x00, 0x12, 
-    0x4E, 0xBA, 0x00, 0xA6, 0x10, 0x1F, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x5F, 
-    0x65, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2D, 0xEF, 0xE4, 0x67, 0x04, 
-    0x20, 0x0C, 0x66, 0x04, 0x70, 0x00, 0x60, 0x4A, 0x2D, 0x6D, 0xEF, 0xE4, 0xFF, 0xF8, 0x24, 0x6E, 
-    0xFF, 0xF8, 0x26, 0x52, 0x20, 0x0B, 0x67, 0x38, 0x42, 0x27, 0x42, 0x27, 0x2F, 0x0B, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFF, 0x18, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x00, 0x67, 0x1E, 0x20, 0x12, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x4A, 0x10, 0x67, 0x06, 0x52, 0xAE, 0xFF, 0xFC, 0x60, 0xF2, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x52, 0x48, 0x20, 0x08, 0x60, 0x08, 0x58, 0xAE, 0xFF, 0xF8, 0x60, 0xBE, 
-    0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x67, 0x65, 0x74, 0x65, 0x6E, 
-    0x76, 0x00, 0x00, 0x00, 0x22, 0x5F, 0x12, 0x1F, 0x30, 0x1F, 0x4A, 0x01, 0x67, 0x04, 0xA7, 0x46, 
-    0x60, 0x02, 0xA3, 0x46, 0x2E, 0x88, 0x4E, 0xD1, 0x20, 0x6F, 0x00, 0x0C, 0x22, 0x6F, 0x00, 0x08, 
-    0x70, 0x00, 0x10, 0x18, 0x48, 0x40, 0x10, 0x19, 0x4A, 0x2F, 0x00, 0x04, 0x67, 0x0E, 0x4A, 0x2F, 
-    0x00, 0x06, 0x67, 0x04, 0xA4, 0x3C, 0x60, 0x10, 0xA0, 0x3C, 0x60, 0x0C, 0x4A, 0x2F, 0x00, 0x06, 
-    0x67, 0x04, 0xA6, 0x3C, 0x60, 0x02, 0xA2, 0x3C, 0x0A, 0x00, 0x00, 0x01, 0x1F, 0x40, 0x00, 0x10, 
-    0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0C, 0x4E, 0xD0, 0x22, 0x5F, 0x20, 0x1F, 0x2E, 0x80, 0x67, 0x12, 
-    0x20, 0x40, 0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 0x00, 0x01, 0x51, 0xC8, 0xFF, 0xFA, 
-    0x42, 0x10, 0x4E, 0xD1, 0x59, 0x4F, 0x2F, 0x2F, 0x00, 0x08, 0x4E, 0xBA, 0xFF, 0xDC, 0x20, 0x5F, 
-    0x20, 0x08, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0x00, 0x00, 0x35, 0x8B, 0x48, 0x6D, 
-    0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0xFE, 0x3A, 0x48, 0x78, 0x00, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0x1C, 0x70, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x18, 0x00, 0x26, 0x2F, 0x00, 0x0C, 
-    0x4A, 0xAD, 0xEC, 0x4C, 0x67, 0x30, 0x28, 0x03, 0x72, 0x10, 0xE2, 0xAC, 0x22, 0x03, 0x74, 0x10, 
-    0xE5, 0xA9, 0x82, 0x84, 0x28, 0x03, 0xB3, 0x84, 0x02, 0x84, 0xFF, 0x00, 0xFF, 0xFF, 0x20, 0x03, 
-    0xE0, 0x88, 0x22, 0x03, 0x74, 0x18, 0xE5, 0xA9, 0x82, 0x80, 0x26, 0x01, 0x20, 0x04, 0xE0, 0x88, 
-    0x22, 0x03, 0xB1, 0x81, 0x26, 0x01, 0x20, 0x03, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x24, 0x2F, 
-    0x00, 0x04, 0x4A, 0xAD, 0xEC, 0x4C, 0x67, 0x18, 0x20, 0x02, 0xE1, 0x88, 0x02, 0x80, 0x00, 0x00, 
-    0xFF, 0x00, 0x22, 0x02, 0xE0, 0x81, 0x02, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x80, 0x24, 0x01, 
-    0x20, 0x02, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0x8A, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xBE, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x26, 0x2E, 
-    0x00, 0x08, 0x4A, 0xAD, 0xEC, 0x48, 0x66, 0x56, 0x2B, 0x43, 0xEC, 0x48, 0x0C, 0x2D, 0x00, 0xC5, 
-    0xEC, 0x48, 0x57, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0x2B, 0x40, 0xF2, 0xF6, 0x0C, 0x83, 0xC3, 0xCB, 
-    0xC6, 0xC5, 0x66, 0x04, 0x70, 0x01, 0x60, 0x42, 0x70, 0x01, 0x2B, 0x40, 0xEC, 0x4C, 0x48, 0x78, 
-    0x00, 0x01, 0x61, 0xFF, 0x00, 0x00, 0xE0, 0x14, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 
-    0x0C, 0x80, 0xC3, 0xCB, 0xC6, 0xC5, 0x50, 0x4F, 0x66, 0x04, 0x70, 0x01, 0x60, 0x1C, 0x42, 0xAD, 
-    0xEC, 0x4C, 0x42, 0xA7, 0x61, 0xFF, 0x00, 0x00, 0xDF, 0xF2, 0x58, 0x4F, 0x60, 0x0A, 0xB6, 0xAD, 
-    0xEC, 0x48, 0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x03, 0x2D, 0x6D, 0xEC, 0x4C, 0xFF, 0xFC, 0x76, 0x00, 0x70, 0x01, 
-    0x2B, 0x40, 0xEC, 0x4C, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xDE, 0xB0, 0xAD, 
-    0xEC, 0x48, 0x58, 0x4F, 0x66, 0x02, 0x76, 0x01, 0x2B, 0x6E, 0xFF, 0xFC, 0xEC, 0x4C, 0x20, 0x03, 
-    0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x4A, 0xAD, 0xF2, 0xF6, 0x67, 0x2A, 
-    0x70, 0x00, 0x10, 0x28, 0x00, 0x01, 0xE1, 0x88, 0x72, 0x00, 0x12, 0x10, 0x82, 0x80, 0x70, 0x00, 
-    0x10, 0x28, 0x00, 0x02, 0x74, 0x10, 0xE5, 0xA8, 0x80, 0x81, 0x72, 0x00, 0x12, 0x28, 0x00, 0x03, 
-    0x74, 0x18, 0xE5, 0xA9, 0x82, 0x80, 0x20, 0x01, 0x4E, 0x75, 0x70, 0x00, 0x10, 0x28, 0x00, 0x01, 
-    0x72, 0x10, 0xE3, 0xA8, 0x72, 0x00, 0x12, 0x10, 0x74, 0x18, 0xE5, 0xA9, 0x82, 0x80, 0x70, 0x00, 
-    0x10, 0x28, 0x00, 0x02, 0xE1, 0x88, 0x80, 0x81, 0x72, 0x00, 0x12, 0x28, 0x00, 0x03, 0x82, 0x80, 
-    0x20, 0x01, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x4A, 0xAD, 0xF2, 0xF6, 0x67, 0x12, 0x70, 0x00, 
-    0x10, 0x28, 0x00, 0x01, 0xE1, 0x88, 0x72, 0x00, 0x12, 0x10, 0x82, 0x80, 0x20, 0x01, 0x4E, 0x75, 
-    0x70, 0x00, 0x10, 0x10, 0x72, 0x00, 0x12, 0x10, 0xE1, 0x89, 0x82, 0x80, 0x20, 0x01, 0x4E, 0x75, 
-    0x20, 0x6F, 0x00, 0x04, 0x24, 0x2F, 0x00, 0x08, 0x4A, 0xAD, 0xF2, 0xF6, 0x67, 0x20, 0x10, 0x82, 
-    0x20, 0x02, 0xE0, 0x88, 0x11, 0x40, 0x00, 0x01, 0x20, 0x02, 0x72, 0x10, 0xE2, 0xA8, 0x11, 0x40, 
-    0x00, 0x02, 0x20, 0x02, 0x72, 0x18, 0xE2, 0xA8, 0x11, 0x40, 0x00, 0x03, 0x60, 0x1E, 0x20, 0x02, 
-    0x72, 0x18, 0xE2, 0xA8, 0x10, 0x80, 0x20, 0x02, 0x72, 0x10, 0xE2, 0xA8, 0x11, 0x40, 0x00, 0x01, 
-    0x20, 0x02, 0xE0, 0x88, 0x11, 0x40, 0x00, 0x02, 0x11, 0x42, 0x00, 0x03, 0x4E, 0x75, 0x20, 0x6F, 
-    0x00, 0x04, 0x22, 0x2F, 0x00, 0x08, 0x4A, 0xAD, 0xF2, 0xF6, 0x67, 0x0C, 0x10, 0x81, 0x20, 0x01, 
-    0xE0, 0x88, 0x11, 0x40, 0x00, 0x01, 0x60, 0x0A, 0x20, 0x01, 0xE0, 0x88, 0x10, 0x80, 0x11, 0x41, 
-    0x00, 0x01, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFD, 0xB8, 0xD0, 0xAE, 0x00, 0x0C, 0x58, 0x4F, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0x16, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x80, 0x4E, 0x5E, 0x4E, 0x75, 0x2F, 0x0B, 0x26, 0x6F, 
-    0x00, 0x08, 0x22, 0x6F, 0x00, 0x0C, 0x12, 0x1B, 0x49, 0xC1, 0x14, 0x19, 0x49, 0xC2, 0xB2, 0x82, 
-    0x66, 0x0A, 0x4A, 0x81, 0x66, 0xF0, 0x70, 0x00, 0x26, 0x5F, 0x4E, 0x75, 0x20, 0x6D, 0xF9, 0x28, 
-    0x10, 0x30, 0x18, 0x00, 0x49, 0xC0, 0x22, 0x00, 0x10, 0x30, 0x28, 0x00, 0x49, 0xC0, 0x24, 0x00, 
-    0xB2, 0x82, 0x67, 0xD2, 0x20, 0x01, 0x90, 0x82, 0x26, 0x5F, 0x4E, 0x75, 0x2F, 0x0C, 0x20, 0x6F, 
-    0x00, 0x08, 0x22, 0x6F, 0x00, 0x0C, 0x22, 0x2F, 0x00, 0x10, 0x28, 0x48, 0x60, 0x06, 0x52, 0x88, 
-    0x52, 0x89, 0x53, 0x81, 0x10, 0x91, 0x67, 0x06, 0x70, 0x01, 0xB2, 0x80, 0x6E, 0xF0, 0x42, 0x10, 
-    0x20, 0x4C, 0x28, 0x5F, 0x4E, 0x75, 0x22, 0x6F, 0x00, 0x04, 0x74, 0x00, 0x60, 0x1A, 0x10, 0x11, 
-    0x48, 0x80, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x00, 0x00, 0x49, 0xC0, 0x72, 0x25, 0x4C, 0x02, 
-    0x18, 0x00, 0xD2, 0x80, 0x24, 0x01, 0x52, 0x89, 0x4A, 0x11, 0x66, 0xE2, 0x20, 0x2F, 0x00, 0x08, 
-    0x53, 0x80, 0xC0, 0x82, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x6E, 
-    0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x27, 0x43, 0x00, 0x04, 0x27, 0x4A, 
-    0x00, 0x08, 0x20, 0x03, 0xE5, 0x88, 0x2F, 0x00, 0x4E, 0x92, 0x26, 0x88, 0x24, 0x53, 0x20, 0x03, 
-    0xE5, 0x88, 0x26, 0x4A, 0xD7, 0xC0, 0x58, 0x4F, 0x60, 0x02, 0x42, 0x9A, 0xB5, 0xCB, 0x65, 0xFA, 
-    0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 
-    0x2A, 0x2E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x14, 
-    0x20, 0x43, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x28, 0x00, 
-    0x20, 0x43, 0x22, 0x50, 0x24, 0x71, 0x4C, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x24, 0x52, 0x20, 0x0A, 
-    0x67, 0x0E, 0x2F, 0x0B, 0x48, 0x6A, 0x00, 0x08, 0x4E, 0x94, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0xEC, 
-    0x20, 0x0A, 0x66, 0x42, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x0C, 
-    0xD0, 0x81, 0x2F, 0x00, 0x20, 0x43, 0x20, 0x68, 0x00, 0x08, 0x4E, 0x90, 0x24, 0x48, 0x41, 0xEA, 
-    0x00, 0x08, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x43, 0x22, 0x50, 0x24, 0xB1, 
-    0x4C, 0x00, 0x42, 0xAA, 0x00, 0x04, 0x22, 0x50, 0x23, 0x8A, 0x4C, 0x00, 0x20, 0x45, 0x20, 0x8A, 
-    0x70, 0x01, 0x58, 0x4F, 0x60, 0x06, 0x20, 0x45, 0x20, 0x8A, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x38, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x26, 0x6E, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x04, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xDA, 
-    0x26, 0x00, 0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x0C, 0xD0, 0x81, 
-    0x2F, 0x00, 0x20, 0x6B, 0x00, 0x08, 0x4E, 0x90, 0x24, 0x48, 0x41, 0xEA, 0x00, 0x08, 0x22, 0x4C, 
-    0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x53, 0x24, 0xB0, 0x3C, 0x00, 0x20, 0x53, 0x21, 0x8A, 
-    0x3C, 0x00, 0x20, 0x4A, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 
-    0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x20, 0x54, 0x24, 0x70, 
-    0x0C, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x24, 0x52, 0x20, 0x0A, 0x67, 0x12, 0x2F, 0x0B, 0x48, 0x6A, 
-    0x00, 0x08, 0x61, 0xFF, 0x00, 0x01, 0x1B, 0x54, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0xE8, 0x20, 0x4A, 
-    0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x4A, 0xAD, 0xEC, 0x9C, 
-    0x67, 0x44, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 0xF5, 0x5E, 0x4A, 0xAD, 0xED, 0x90, 
-    0x58, 0x4F, 0x66, 0x06, 0x4A, 0xAD, 0xED, 0x8C, 0x67, 0x28, 0x2F, 0x2D, 0xED, 0xC8, 0x61, 0xFF, 
-    0x00, 0x00, 0xFE, 0x2C, 0x2F, 0x2D, 0xED, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 
-    0x00, 0x00, 0x35, 0x40, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0xF9, 0x64, 0x4F, 0xEF, 
-    0x00, 0x14, 0x42, 0xAD, 0xEC, 0x9C, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x18, 0x30, 0x47, 0xEE, 0x00, 0x08, 0x58, 0x8B, 0x24, 0x6E, 0x00, 0x08, 0x16, 0x1A, 0x49, 0xC3, 
-    0x72, 0xD0, 0xD6, 0x81, 0x41, 0xED, 0xED, 0x94, 0x2F, 0x30, 0x3C, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x35, 0x30, 0x48, 0x79, 0x00, 0x00, 0x35, 0x29, 0x48, 0x6D, 0xEA, 0x48, 0x61, 0xFF, 0x00, 0x00, 
-    0xFE, 0xEA, 0x2F, 0x0B, 0x2F, 0x0A, 0x41, 0xED, 0xEA, 0x48, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x41, 0xED, 0xEA, 0x48, 0x48, 0x70, 0x08, 0x00, 0x61, 0xFF, 0x00, 0x00, 0xFF, 0x90, 
-    0x41, 0xED, 0xED, 0x84, 0x52, 0xB0, 0x3C, 0x00, 0x48, 0x6D, 0xEA, 0x48, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x42, 0xA7, 0x41, 0xED, 0xF2, 0xFA, 0x1F, 0x30, 0x38, 0x00, 0x20, 0x6D, 
-    0xEC, 0x98, 0x4E, 0x90, 0x18, 0x00, 0x70, 0x03, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x2E, 0x67, 0x04, 
-    0x4A, 0x04, 0x66, 0x0A, 0x42, 0xA7, 0x61, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0x58, 0x4F, 0x4C, 0xDF, 
-    0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x26, 0x2E, 
-    0x00, 0x08, 0x4A, 0x83, 0x67, 0x48, 0x70, 0x02, 0xB6, 0x80, 0x67, 0x22, 0x70, 0x0F, 0xB6, 0x80, 
-    0x67, 0x1C, 0x48, 0x79, 0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 0x00, 0x00, 0x35, 0x14, 0x48, 0x6D, 
-    0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0xF8, 0x8A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1A, 0x48, 0x79, 
-    0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 0x00, 0x00, 0x34, 0xFA, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 
-    0x00, 0x00, 0xF8, 0x6E, 0x4F, 0xEF, 0x00, 0x0C, 0x52, 0xAD, 0xED, 0x90, 0x60, 0x34, 0x20, 0x2D, 
-    0xED, 0x84, 0xD0, 0xAD, 0xED, 0x88, 0xD0, 0xAD, 0xED, 0x8C, 0x67, 0x26, 0x2F, 0x2D, 0xED, 0x8C, 
-    0x2F, 0x2D, 0xED, 0x88, 0x2F, 0x2D, 0xED, 0x84, 0x48, 0x79, 0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 
-    0x00, 0x00, 0x34, 0xB6, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0xF8, 0x34, 0x4F, 0xEF, 
-    0x00, 0x18, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x20, 0x2F, 0x2D, 0xEC, 0x50, 0x2F, 0x2D, 0xEC, 0x54, 
-    0x2F, 0x2D, 0xEC, 0x5C, 0x2F, 0x2D, 0xEC, 0x60, 0x48, 0x79, 0x00, 0x00, 0x34, 0x7D, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xBA, 0x4F, 0xEF, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x5E, 0x24, 0x6D, 
-    0xEF, 0x34, 0x60, 0x14, 0x4A, 0xAA, 0x00, 0x18, 0x6D, 0x0C, 0x2F, 0x2A, 0x00, 0x18, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xED, 0x0E, 0x58, 0x4F, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xE8, 0x4A, 0x83, 0x66, 0x0A, 
-    0x20, 0x2D, 0xED, 0x8C, 0xD0, 0xAD, 0xED, 0x90, 0x67, 0x04, 0x76, 0x02, 0x60, 0x02, 0x76, 0x01, 
-    0x2F, 0x03, 0x48, 0x6D, 0xEC, 0x64, 0x61, 0xFF, 0x00, 0x00, 0xF4, 0x12, 0x50, 0x4F, 0x4C, 0xDF, 
-    0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x76, 0x00, 0x78, 0x00, 0x20, 0x0B, 
-    0x67, 0x2E, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x28, 0x00, 0x48, 0x78, 
-    0x00, 0x8A, 0x2F, 0x0B, 0x48, 0x6D, 0xE9, 0xBE, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0x41, 0xED, 
-    0xE9, 0xBE, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0x8A, 0x90, 0x83, 0x2F, 0x00, 0x2F, 0x0C, 0x41, 0xED, 0xE9, 0xBE, 
-    0x48, 0x70, 0x38, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xD6, 0x26, 0x48, 0x20, 0x4C, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0xD8, 0x80, 0x20, 0x0A, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x36, 
-    0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0xD6, 0x80, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0x8A, 0x90, 0x83, 0x2F, 0x00, 0x2F, 0x0A, 0x41, 0xED, 0xE9, 0xBE, 0x48, 0x70, 0x38, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x9A, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0xD8, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x0C, 0x84, 0x00, 0x00, 0x00, 0x89, 0x6F, 0x12, 0x48, 0x6D, 
-    0xE9, 0xBE, 0x48, 0x79, 0x00, 0x00, 0x34, 0x60, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xA0, 0x50, 0x4F, 
-    0x41, 0xED, 0xE9, 0xBE, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x24, 0x6D, 0xEF, 0x34, 0x60, 0x34, 0x26, 0x6A, 
-    0x00, 0x14, 0x20, 0x0B, 0x67, 0x2A, 0xB7, 0xCC, 0x63, 0x26, 0x20, 0x4C, 0xD1, 0xEC, 0x00, 0x08, 
-    0xB7, 0xC8, 0x64, 0x1C, 0x42, 0xAA, 0x00, 0x14, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x12, 0x48, 0x6A, 
-    0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x34, 0x40, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x50, 0x4F, 
-    0x24, 0x52, 0x20, 0x0A, 0x66, 0xC8, 0x24, 0x6D, 0xEE, 0x84, 0x60, 0x34, 0x26, 0x6A, 0x00, 0x10, 
-    0x20, 0x0B, 0x67, 0x2A, 0xB7, 0xCC, 0x63, 0x26, 0x20, 0x4C, 0xD1, 0xEC, 0x00, 0x08, 0xB7, 0xC8, 
-    0x64, 0x1C, 0x42, 0xAA, 0x00, 0x10, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x12, 0x2F, 0x2A, 0x00, 0x04, 
-    0x48, 0x79, 0x00, 0x00, 0x34, 0x40, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x12, 0x50, 0x4F, 0x24, 0x52, 
-    0x20, 0x0A, 0x66, 0xC8, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x30, 0x26, 0x2E, 0x00, 0x08, 0x0C, 0x83, 0x00, 0x00, 0xFF, 0x00, 0x64, 0x06, 
-    0x26, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x70, 0x0C, 0xD6, 0x80, 0x47, 0xED, 0xE9, 0xBA, 0x60, 0x10, 
-    0xB6, 0xAA, 0x00, 0x08, 0x6E, 0x08, 0x26, 0x92, 0x26, 0x2A, 0x00, 0x08, 0x60, 0x08, 0x26, 0x4A, 
-    0x24, 0x53, 0x20, 0x0A, 0x66, 0xEA, 0x20, 0x0A, 0x66, 0x4A, 0x42, 0xA7, 0x2F, 0x03, 0x61, 0xFF, 
-    0x00, 0x00, 0xF0, 0xA6, 0x24, 0x48, 0x20, 0x0A, 0x50, 0x4F, 0x66, 0x26, 0x47, 0xED, 0xE9, 0xAE, 
-    0x60, 0x1A, 0xB6, 0xAA, 0x00, 0x08, 0x6E, 0x12, 0x26, 0x92, 0x26, 0x2A, 0x00, 0x08, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x58, 0x4F, 0x60, 0x08, 0x26, 0x4A, 0x24, 0x53, 0x20, 0x0A, 
-    0x66, 0xE0, 0x20, 0x0A, 0x66, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x34, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFC, 0x7C, 0x58, 0x4F, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xF0, 0xCE, 0x25, 0x40, 0x00, 0x08, 
-    0x20, 0x4A, 0xD1, 0xEA, 0x00, 0x08, 0x25, 0x48, 0x00, 0x04, 0x20, 0x4A, 0x58, 0x4F, 0x4C, 0xDF, 
-    0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x26, 0x2E, 0x00, 0x08, 
-    0x70, 0xFC, 0x22, 0x03, 0x56, 0x81, 0xC2, 0x80, 0x26, 0x01, 0xB6, 0x83, 0x67, 0x10, 0x2F, 0x03, 
-    0x48, 0x79, 0x00, 0x00, 0x34, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x32, 0x50, 0x4F, 0x20, 0x03, 
-    0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x2F, 0x2E, 
-    0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x26, 0x00, 0x24, 0x6D, 0xE9, 0xB6, 0x58, 0x4F, 
-    0x60, 0x10, 0x70, 0x0C, 0xD0, 0x83, 0x20, 0x6A, 0x00, 0x04, 0x91, 0xCA, 0xB1, 0xC0, 0x64, 0x06, 
-    0x24, 0x52, 0x20, 0x0A, 0x66, 0xEC, 0x20, 0x0A, 0x66, 0x2C, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0xEE, 0x24, 0x48, 0x20, 0x2A, 0x00, 0x08, 0x72, 0x0C, 0x90, 0x81, 0x2F, 0x00, 0x42, 0xA7, 
-    0x48, 0x6A, 0x00, 0x0C, 0x61, 0xFF, 0x00, 0x01, 0x15, 0xD6, 0x24, 0xAD, 0xE9, 0xB6, 0x2B, 0x4A, 
-    0xE9, 0xB6, 0x4F, 0xEF, 0x00, 0x10, 0x97, 0xAA, 0x00, 0x04, 0xD7, 0xAD, 0xEC, 0x60, 0x20, 0x6A, 
-    0x00, 0x04, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x18, 0x20, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x26, 0x00, 0x24, 0x6D, 
-    0xE9, 0xAE, 0x20, 0x0A, 0x58, 0x4F, 0x67, 0x0E, 0x70, 0x0C, 0xD0, 0x83, 0x20, 0x6A, 0x00, 0x04, 
-    0x91, 0xCA, 0xB1, 0xC0, 0x64, 0x4A, 0x28, 0x03, 0x0C, 0x84, 0x00, 0x00, 0xFF, 0x00, 0x64, 0x06, 
-    0x28, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x70, 0x0C, 0xD8, 0x80, 0x42, 0xA7, 0x2F, 0x04, 0x61, 0xFF, 
-    0x00, 0x00, 0xEF, 0x56, 0x24, 0x48, 0x20, 0x0A, 0x50, 0x4F, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x2C, 
-    0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xEF, 0xB2, 0x25, 0x40, 0x00, 0x08, 0x20, 0x4A, 0xD1, 0xEA, 
-    0x00, 0x08, 0x25, 0x48, 0x00, 0x04, 0x24, 0xAD, 0xE9, 0xAE, 0x2B, 0x4A, 0xE9, 0xAE, 0x58, 0x4F, 
-    0x97, 0xAA, 0x00, 0x04, 0xD7, 0xAD, 0xEC, 0x50, 0x20, 0x6A, 0x00, 0x04, 0x4C, 0xDF, 0x04, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6F, 0x00, 0x0C, 0x20, 0x0C, 0x66, 0x08, 
-    0x91, 0xC8, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x75, 0x22, 0x6D, 0xE9, 0xAE, 0x60, 0x38, 0x26, 0x49, 
-    0x22, 0x29, 0x00, 0x08, 0x4A, 0x81, 0x6C, 0x02, 0x44, 0x81, 0xB9, 0xCB, 0x65, 0x26, 0x20, 0x4B, 
-    0xD1, 0xC1, 0xB9, 0xC8, 0x64, 0x1E, 0x4A, 0xA9, 0x00, 0x08, 0x6C, 0x08, 0x91, 0xC8, 0x4C, 0xDF, 
-    0x18, 0x00, 0x4E, 0x75, 0x20, 0x01, 0x44, 0x80, 0x23, 0x40, 0x00, 0x08, 0x20, 0x4B, 0x4C, 0xDF, 
-    0x18, 0x00, 0x4E, 0x75, 0x22, 0x51, 0x20, 0x09, 0x66, 0xC4, 0x91, 0xC8, 0x4C, 0xDF, 0x18, 0x00, 
-    0x4E, 0x75, 0x22, 0x6F, 0x00, 0x04, 0x20, 0x09, 0x67, 0x10, 0x20, 0x49, 0x22, 0x28, 0x00, 0x08, 
-    0x4A, 0x81, 0x6C, 0x02, 0x44, 0x81, 0x21, 0x41, 0x00, 0x08, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x20, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x4C, 0x26, 0x00, 
-    0x24, 0x6D, 0xE9, 0xB2, 0x20, 0x0A, 0x58, 0x4F, 0x67, 0x0E, 0x70, 0x0C, 0xD0, 0x83, 0x20, 0x6A, 
-    0x00, 0x04, 0x91, 0xCA, 0xB1, 0xC0, 0x64, 0x14, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 
-    0x24, 0x48, 0x24, 0xAD, 0xE9, 0xB2, 0x2B, 0x4A, 0xE9, 0xB2, 0x58, 0x4F, 0x97, 0xAA, 0x00, 0x04, 
-    0xD7, 0xAD, 0xEC, 0x58, 0x20, 0x2D, 0xEC, 0x58, 0xB0, 0xAD, 0xEC, 0x54, 0x6F, 0x06, 0x2B, 0x6D, 
-    0xEC, 0x58, 0xEC, 0x54, 0x20, 0x6A, 0x00, 0x04, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x48, 0x78, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 
-    0x24, 0x48, 0x24, 0xAD, 0xE9, 0xAA, 0x2B, 0x4A, 0xE9, 0xAA, 0x58, 0x4F, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x24, 0x6D, 0xE9, 0xB2, 0x60, 0x00, 
-    0x00, 0x8E, 0x28, 0x52, 0x20, 0x6D, 0xE9, 0xAA, 0xB1, 0xEA, 0x00, 0x04, 0x65, 0x46, 0x20, 0x4A, 
-    0xD1, 0xEA, 0x00, 0x08, 0xB1, 0xED, 0xE9, 0xAA, 0x63, 0x3A, 0x26, 0x6A, 0x00, 0x04, 0x20, 0x6D, 
-    0xE9, 0xAA, 0x58, 0x88, 0x25, 0x48, 0x00, 0x04, 0x20, 0x6D, 0xE9, 0xAA, 0x2B, 0x50, 0xE9, 0xAA, 
-    0x20, 0x6A, 0x00, 0x04, 0x91, 0xCB, 0x20, 0x08, 0x91, 0xAD, 0xEC, 0x58, 0x20, 0x6A, 0x00, 0x04, 
-    0x91, 0xCB, 0x2F, 0x08, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x01, 0x13, 0xD2, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x40, 0x26, 0x6A, 0x00, 0x04, 0x20, 0x4A, 0xD1, 0xEA, 0x00, 0x08, 0x25, 0x48, 
-    0x00, 0x04, 0x20, 0x6A, 0x00, 0x04, 0x91, 0xCB, 0x20, 0x08, 0x91, 0xAD, 0xEC, 0x58, 0x20, 0x6A, 
-    0x00, 0x04, 0x91, 0xCB, 0x2F, 0x08, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x01, 0x13, 0xA0, 
-    0x24, 0xAD, 0xE9, 0xBA, 0x2B, 0x4A, 0xE9, 0xBA, 0x24, 0x4C, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x0A, 
-    0x66, 0x00, 0xFF, 0x70, 0x2B, 0x4A, 0xE9, 0xB2, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x20, 0x6F, 0x00, 0x04, 0x22, 0x2F, 0x00, 0x08, 0x42, 0x90, 0x21, 0x41, 0x00, 0x04, 0x20, 0x3C, 
-    0x00, 0x00, 0x04, 0x00, 0x4C, 0x41, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x21, 0x40, 0x00, 0x0C, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x4A, 0x92, 
-    0x67, 0x0A, 0x20, 0x2A, 0x00, 0x08, 0xB0, 0xAA, 0x00, 0x0C, 0x66, 0x16, 0x48, 0x78, 0x04, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x14, 0x26, 0x48, 0x26, 0x92, 0x42, 0xAA, 0x00, 0x08, 0x24, 0x8B, 
-    0x58, 0x4F, 0x20, 0x52, 0x20, 0x2A, 0x00, 0x08, 0x41, 0xF0, 0x08, 0x04, 0x22, 0x6E, 0x00, 0x0C, 
-    0x22, 0x2A, 0x00, 0x04, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 
-    0x20, 0x2A, 0x00, 0x04, 0xD1, 0xAA, 0x00, 0x08, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x22, 0x6F, 0x00, 0x04, 0x4A, 0x91, 0x67, 0x26, 0x4A, 0xA9, 0x00, 0x08, 0x66, 0x0A, 0x20, 0x51, 
-    0x22, 0x90, 0x23, 0x69, 0x00, 0x0C, 0x00, 0x08, 0x4A, 0x91, 0x67, 0x12, 0x20, 0x29, 0x00, 0x04, 
-    0x91, 0xA9, 0x00, 0x08, 0x20, 0x51, 0xD1, 0xE9, 0x00, 0x08, 0x58, 0x88, 0x4E, 0x75, 0x91, 0xC8, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x28, 0x2E, 
-    0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x3F, 0x3C, 0x00, 0x01, 0x61, 0xFF, 0x00, 0x01, 0x1E, 0x90, 
-    0x20, 0x6D, 0xED, 0x4C, 0xB8, 0xA8, 0x00, 0x10, 0x67, 0x16, 0x42, 0xA7, 0x2F, 0x04, 0x2F, 0x28, 
-    0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x5E, 0x52, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x2A, 
-    0x2F, 0x03, 0x2F, 0x0A, 0x20, 0x6D, 0xED, 0x4C, 0x2F, 0x28, 0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE7, 0x64, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x10, 0x20, 0x04, 0xD0, 0x83, 0x20, 0x6D, 
-    0xED, 0x4C, 0x21, 0x40, 0x00, 0x10, 0x20, 0x4A, 0x60, 0x1C, 0x20, 0x6D, 0xED, 0x4C, 0x48, 0x68, 
-    0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x50, 0x41, 0xF9, 
-    0x00, 0x00, 0x35, 0x64, 0x50, 0x4F, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x60, 0x36, 0x4A, 0xAA, 0x00, 0x18, 0x6D, 0x2E, 
-    0x2F, 0x2A, 0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x98, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 
-    0x48, 0x6A, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x0E, 
-    0x50, 0x4F, 0x53, 0xAD, 0xED, 0x54, 0x70, 0xFF, 0x25, 0x40, 0x00, 0x18, 0x60, 0x06, 0x24, 0x52, 
-    0x20, 0x0A, 0x66, 0xC6, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 
-    0x24, 0x6E, 0x00, 0x08, 0x42, 0xAD, 0xED, 0x60, 0x2B, 0x6A, 0x00, 0x0C, 0xED, 0x5C, 0x2B, 0x4A, 
-    0xED, 0x4C, 0x2B, 0x6A, 0x00, 0x14, 0xED, 0x58, 0x66, 0x4E, 0x4A, 0xAA, 0x00, 0x18, 0x6C, 0x48, 
-    0x20, 0x2D, 0xED, 0x54, 0xB0, 0xAD, 0xED, 0x50, 0x6D, 0x0C, 0x2F, 0x2D, 0xEF, 0x34, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x7E, 0x58, 0x4F, 0x48, 0x78, 0x08, 0x00, 0x48, 0x6A, 0x00, 0x24, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE5, 0x9A, 0x25, 0x40, 0x00, 0x18, 0x4A, 0x80, 0x50, 0x4F, 0x6C, 0x12, 0x48, 0x6A, 
-    0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x90, 0x50, 0x4F, 
-    0x42, 0xAA, 0x00, 0x10, 0x52, 0xAD, 0xED, 0x54, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0x2B, 0x6E, 0x00, 0x0C, 
-    0xED, 0x60, 0x2B, 0x6E, 0x00, 0x10, 0xED, 0x5C, 0x4A, 0xAD, 0xED, 0x58, 0x58, 0x4F, 0x67, 0x08, 
-    0x20, 0x2E, 0x00, 0x0C, 0xD1, 0xAD, 0xED, 0x58, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x2B, 0x6A, 0x00, 0x10, 0xED, 0x58, 0x67, 0x14, 0x2B, 0x6A, 
-    0x00, 0x14, 0xED, 0x60, 0x2B, 0x6A, 0x00, 0x18, 0xED, 0x5C, 0x2B, 0x6A, 0x00, 0x08, 0xED, 0x4C, 
-    0x60, 0x16, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2A, 0x00, 0x14, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x9E, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 0x28, 0x2E, 0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 0x4A, 0x84, 
-    0x6D, 0x10, 0x20, 0x2D, 0xED, 0x60, 0xD0, 0xAD, 0xED, 0x5C, 0x22, 0x04, 0xD2, 0x83, 0xB2, 0x80, 
-    0x6F, 0x16, 0x20, 0x6D, 0xED, 0x4C, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xCA, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0xD8, 0x50, 0x4F, 0xD7, 0xAD, 0xEC, 0x5C, 0x4A, 0xAD, 0xED, 0x58, 
-    0x67, 0x28, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xA0, 0x24, 0x48, 0x20, 0x4A, 0x22, 0x6D, 
-    0xED, 0x58, 0x43, 0xF1, 0x48, 0x00, 0x22, 0x03, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x20, 0x4A, 0x58, 0x4F, 0x60, 0x20, 0x2F, 0x03, 0x20, 0x2D, 0xED, 0x60, 
-    0xD0, 0x84, 0x2F, 0x00, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x6E, 0x58, 0x4F, 0x2F, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xC0, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x00, 0x26, 0x2E, 0x00, 0x08, 0x28, 0x2E, 
-    0x00, 0x0C, 0x4A, 0x83, 0x6D, 0x10, 0x20, 0x2D, 0xED, 0x60, 0xD0, 0xAD, 0xED, 0x5C, 0x22, 0x03, 
-    0xD2, 0x84, 0xB2, 0x80, 0x6F, 0x16, 0x20, 0x6D, 0xED, 0x4C, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 
-    0x00, 0x00, 0x33, 0xCA, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x44, 0x50, 0x4F, 0x4A, 0xAD, 0xED, 0x58, 
-    0x67, 0x08, 0x20, 0x6D, 0xED, 0x58, 0xD1, 0xC3, 0x60, 0x20, 0x2F, 0x04, 0x20, 0x2D, 0xED, 0x60, 
-    0xD0, 0x83, 0x2F, 0x00, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x74, 0x58, 0x4F, 0x2F, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0x2C, 
-    0x58, 0x4F, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0x1E, 0x58, 0x4F, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x2D, 0xEC, 0x9C, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x2E, 0x00, 0x08, 
-    0x61, 0xFF, 0x00, 0x00, 0xF2, 0x5E, 0xB0, 0xAE, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x12, 
-    0x2F, 0x2D, 0xED, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x33, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0xAE, 
-    0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xAA, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x4A, 0xAD, 0xF2, 0xF6, 0x67, 0x04, 0x7A, 0x06, 0x60, 0x02, 
-    0x7A, 0x00, 0x2D, 0x6D, 0xE9, 0xA6, 0xFF, 0xFC, 0x70, 0x03, 0x22, 0x0C, 0xC2, 0x80, 0x67, 0x00, 
-    0x00, 0xF2, 0x20, 0x0C, 0xE2, 0x80, 0xE0, 0x88, 0xE0, 0x88, 0xE0, 0x88, 0xEC, 0x88, 0xD0, 0x8C, 
-    0xE4, 0x80, 0xD0, 0xAE, 0xFF, 0xFC, 0x2F, 0x00, 0x70, 0x03, 0x22, 0x0C, 0xC2, 0x80, 0x2F, 0x01, 
-    0x48, 0x79, 0x00, 0x00, 0x33, 0x77, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x52, 0x70, 0xFC, 0x22, 0x0C, 
-    0xC2, 0x80, 0x28, 0x41, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xB8, 0x70, 0x20, 0xB9, 0xC0, 
-    0x6C, 0x06, 0x2C, 0x0C, 0xE4, 0x8E, 0x60, 0x02, 0x7C, 0x08, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x06, 
-    0x48, 0x79, 0x00, 0x00, 0x33, 0x68, 0x48, 0x6E, 0xFF, 0xAA, 0x61, 0xFF, 0x00, 0x00, 0xF4, 0x3C, 
-    0x45, 0xEE, 0xFF, 0xAA, 0x50, 0x8A, 0x58, 0x8A, 0x20, 0x2E, 0xFF, 0xFC, 0xE0, 0x88, 0x02, 0x80, 
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x86, 0x2E, 0x2E, 0xFF, 0xFC, 0x02, 0x87, 0x00, 0x00, 0x00, 0xFF, 
-    0xDE, 0x80, 0xDD, 0xAE, 0xFF, 0xFC, 0x76, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x2C, 0x78, 0x00, 
-    0x18, 0x1B, 0xDE, 0x84, 0x20, 0x04, 0xE8, 0x88, 0x41, 0xF9, 0x00, 0x00, 0x33, 0x57, 0x22, 0x03, 
-    0xBB, 0x81, 0x15, 0xB0, 0x08, 0x00, 0x18, 0x00, 0x70, 0x0F, 0xC0, 0x84, 0x22, 0x03, 0xBB, 0x81, 
-    0x52, 0x81, 0x15, 0xB0, 0x08, 0x00, 0x18, 0x00, 0x54, 0x83, 0x20, 0x06, 0xE7, 0x88, 0xB6, 0x80, 
-    0x65, 0xCC, 0x44, 0x87, 0x02, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0x07, 0x48, 0x79, 0x00, 0x00, 
-    0x33, 0x50, 0x48, 0x72, 0x38, 0x00, 0x61, 0xFF, 0x00, 0x00, 0xF3, 0xC0, 0x2F, 0x2D, 0xEC, 0x9C, 
-    0x48, 0x6E, 0xFF, 0xAA, 0x61, 0xFF, 0x00, 0x00, 0xEE, 0x88, 0x49, 0xEC, 0xFF, 0xE0, 0x4F, 0xEF, 
-    0x00, 0x14, 0xB8, 0xFC, 0x00, 0x00, 0x6E, 0x00, 0xFF, 0x44, 0x2B, 0x6E, 0xFF, 0xFC, 0xE9, 0xA6, 
-    0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 
-    0x28, 0x2E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x3F, 0x3C, 0x00, 0x01, 
-    0x61, 0xFF, 0x00, 0x01, 0x1A, 0x3A, 0x4A, 0x2D, 0xEE, 0x0D, 0x67, 0x0E, 0x2F, 0x03, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xA4, 0x50, 0x4F, 0x60, 0x24, 0xB8, 0xAD, 0xEC, 0xA0, 0x67, 0x12, 
-    0x42, 0xA7, 0x2F, 0x04, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 0xF0, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2F, 0x03, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x44, 0x50, 0x4F, 0x20, 0x04, 
-    0xD0, 0x83, 0x2B, 0x40, 0xEC, 0xA0, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0x00, 0x08, 0x2F, 0x2D, 0xEF, 0x28, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x88, 0x58, 0xAD, 0xEF, 0x28, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x60, 0x20, 0x2F, 0x2A, 0x00, 0x04, 0x2F, 0x0B, 
-    0x2F, 0x2D, 0xEF, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x20, 0x2A, 0x00, 0x04, 0xD1, 0xAD, 
-    0xEF, 0x28, 0x52, 0xAD, 0xEE, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFA, 0xC2, 0x26, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x66, 0xD0, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x3C, 0xE1, 0xA0, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xEF, 0x2A, 0xB0, 0x92, 
-    0x58, 0x4F, 0x67, 0x1E, 0x4C, 0x7C, 0x30, 0x03, 0x00, 0x00, 0x00, 0x04, 0x60, 0x10, 0x2F, 0x12, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEF, 0x12, 0x24, 0x80, 0x58, 0x8A, 0x53, 0x83, 0x58, 0x4F, 0x4A, 0x83, 
-    0x6E, 0xEC, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x1C, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x4A, 0x2D, 0xEE, 0x0A, 0x67, 0x10, 0x20, 0x2D, 0xEF, 0x20, 
-    0xD0, 0xAD, 0xF1, 0xE4, 0x2B, 0x40, 0xEF, 0x28, 0x60, 0x00, 0x03, 0xD4, 0x0C, 0x2D, 0x00, 0x01, 
-    0xEE, 0x0F, 0x67, 0x00, 0x03, 0xCA, 0x41, 0xED, 0xEE, 0xA4, 0xB5, 0xC8, 0x66, 0x00, 0x03, 0xC0, 
-    0x48, 0x78, 0x00, 0x80, 0x2F, 0x2D, 0xF1, 0x98, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x28, 0x2A, 
-    0x00, 0x14, 0x4A, 0x2D, 0xEE, 0x0F, 0x50, 0x4F, 0x66, 0x06, 0x06, 0x84, 0x00, 0x00, 0x00, 0x80, 
-    0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0xA0, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x14, 
-    0xD8, 0xAA, 0x00, 0x18, 0x2F, 0x2A, 0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x8A, 0x20, 0x6D, 
-    0xF1, 0x98, 0x21, 0x40, 0x00, 0x18, 0x20, 0x6D, 0xF1, 0x98, 0x42, 0xA8, 0x00, 0x1C, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x50, 0x4F, 0x67, 0x6E, 0x2A, 0x2D, 0xED, 0x34, 0xE7, 0x8D, 0x72, 0x24, 0xDA, 0x81, 
-    0xDA, 0xAD, 0xED, 0x44, 0x20, 0x2A, 0x00, 0x20, 0xD0, 0x85, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEE, 0x56, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x1C, 0x4A, 0x2D, 0xEE, 0x04, 0x58, 0x4F, 
-    0x67, 0x16, 0x2F, 0x3C, 0xEF, 0x04, 0x1D, 0x41, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x3A, 0x20, 0x6D, 
-    0xF1, 0x98, 0x21, 0x40, 0x00, 0x40, 0x58, 0x4F, 0x76, 0x00, 0x4A, 0xAD, 0xED, 0x34, 0x6F, 0x02, 
-    0x76, 0x01, 0x4A, 0x2D, 0xED, 0xED, 0x67, 0x04, 0x70, 0x02, 0x86, 0x80, 0x20, 0x05, 0xE9, 0x88, 
-    0x86, 0x80, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x0E, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 
-    0x00, 0x24, 0x58, 0x4F, 0x2F, 0x2A, 0x00, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0xFA, 0x20, 0x6D, 
-    0xF1, 0x98, 0x21, 0x40, 0x00, 0x20, 0x2F, 0x2D, 0xED, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0xE8, 
-    0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x2C, 0x2F, 0x2D, 0xF2, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xED, 0xD6, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x28, 0x20, 0x2D, 0xED, 0xE0, 0xC0, 0xAD, 
-    0xED, 0xDC, 0x02, 0x80, 0x00, 0x01, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x04, 0x76, 0x00, 
-    0x60, 0x12, 0x20, 0x2D, 0xED, 0xE0, 0x02, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x04, 0x76, 0x20, 
-    0x60, 0x02, 0x76, 0x1A, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x1A, 0x00, 0x83, 0x00, 0x00, 0x01, 0x00, 
-    0x2F, 0x2D, 0xED, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x8E, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 
-    0x00, 0x34, 0x58, 0x4F, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x7C, 0x20, 0x6D, 0xF1, 0x98, 
-    0x21, 0x40, 0x00, 0x30, 0x4A, 0xAA, 0x00, 0x1C, 0x58, 0x4F, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x16, 0x2F, 0x3C, 0xEB, 0x00, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x5A, 0x20, 0x6D, 
-    0xF1, 0x98, 0x21, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0C, 0x66, 0x3C, 
-    0x20, 0x6D, 0xF1, 0x98, 0x50, 0x88, 0x91, 0xED, 0xF1, 0x98, 0x26, 0x2D, 0xF2, 0xE2, 0xD6, 0x88, 
-    0x20, 0x03, 0x50, 0x80, 0x20, 0x6D, 0xED, 0x0C, 0x20, 0x68, 0x00, 0x04, 0x22, 0x28, 0x00, 0x0C, 
-    0x92, 0x80, 0xE4, 0x81, 0x00, 0x81, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xED, 0x16, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x0C, 0x2D, 0x00, 0x02, 
-    0xEE, 0x0C, 0x66, 0x38, 0x4A, 0xAD, 0xF2, 0xA8, 0x67, 0x32, 0x26, 0x2D, 0xF2, 0xBC, 0x06, 0x83, 
-    0x00, 0x00, 0x00, 0x80, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x10, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 
-    0x72, 0x24, 0xD0, 0x81, 0xD0, 0xAD, 0xED, 0x44, 0xD6, 0x80, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEC, 0xD6, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x38, 0x58, 0x4F, 0x4A, 0xAD, 0xEE, 0x24, 
-    0x66, 0x18, 0x4A, 0x2D, 0xEE, 0x13, 0x66, 0x12, 0x48, 0x79, 0x00, 0x00, 0x33, 0x35, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF1, 0x1A, 0x58, 0x4F, 0x60, 0x00, 0x00, 0xF6, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x13, 
-    0x66, 0x32, 0x4A, 0xAD, 0xEE, 0x24, 0x67, 0x26, 0x20, 0x6D, 0xEE, 0x24, 0x26, 0x28, 0x00, 0x28, 
-    0xD6, 0xAD, 0xEE, 0x1C, 0xB6, 0xAD, 0xEE, 0x14, 0x67, 0x26, 0x48, 0x68, 0x00, 0x44, 0x48, 0x79, 
-    0x00, 0x00, 0x33, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0xE4, 0x50, 0x4F, 0x60, 0x12, 0x26, 0x2D, 
-    0xEE, 0x14, 0x60, 0x0C, 0x20, 0x6D, 0xEE, 0x24, 0x26, 0x28, 0x00, 0x28, 0xD6, 0xAD, 0xEE, 0x1C, 
-    0x96, 0xAD, 0xF2, 0xE2, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x80, 0x6C, 0x06, 0x4A, 0x2D, 0xEE, 0x0F, 
-    0x67, 0x08, 0x4A, 0x83, 0x6D, 0x04, 0xB6, 0x84, 0x6F, 0x5C, 0x4A, 0x2D, 0xEE, 0x0F, 0x66, 0x08, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x60, 0x02, 0x70, 0x00, 0x2A, 0x00, 0x0C, 0x2D, 0x00, 0x01, 
-    0xEE, 0x13, 0x66, 0x2A, 0x20, 0x04, 0xD0, 0xAD, 0xF2, 0xE2, 0x2F, 0x00, 0x20, 0x05, 0xD0, 0xAD, 
-    0xF2, 0xE2, 0x2F, 0x00, 0x20, 0x03, 0xD0, 0xAD, 0xF2, 0xE2, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x32, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x76, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x16, 0x2F, 0x04, 
-    0x2F, 0x05, 0x2F, 0x03, 0x48, 0x79, 0x00, 0x00, 0x32, 0x96, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x5E, 
-    0x4F, 0xEF, 0x00, 0x10, 0x26, 0x05, 0x4A, 0x2D, 0xEE, 0x0F, 0x67, 0x14, 0x2F, 0x03, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEB, 0xE4, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x0C, 0x58, 0x4F, 0x60, 0x1E, 
-    0x70, 0xEC, 0xD0, 0x83, 0xE4, 0x80, 0x00, 0x80, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEB, 0xC4, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x0C, 0x58, 0x4F, 0x20, 0x6D, 
-    0xF1, 0x98, 0x2F, 0x28, 0x00, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x40, 0xD0, 0xAA, 0x00, 0x14, 
-    0xD0, 0xAA, 0x00, 0x18, 0x06, 0x80, 0x00, 0x00, 0x00, 0x80, 0x2B, 0x40, 0xEF, 0x20, 0x20, 0x2A, 
-    0x00, 0x14, 0x06, 0x80, 0x00, 0x00, 0x00, 0xA4, 0xD0, 0xAA, 0x00, 0x18, 0xD0, 0xAA, 0x00, 0x20, 
-    0x2B, 0x40, 0xED, 0x28, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 0xD0, 0xAD, 0xED, 0x28, 0x2B, 0x40, 
-    0xED, 0x24, 0x20, 0x2D, 0xEF, 0x20, 0xD0, 0xAD, 0xF2, 0xA4, 0x2B, 0x40, 0xEF, 0x28, 0x4A, 0x2D, 
-    0xEE, 0x09, 0x58, 0x4F, 0x67, 0x44, 0x4A, 0x2D, 0xEE, 0x0F, 0x67, 0x1C, 0x2F, 0x2D, 0xEF, 0x20, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x52, 0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x04, 0x2B, 0x6D, 
-    0xEF, 0x20, 0xEF, 0x28, 0x58, 0x4F, 0x60, 0x22, 0x20, 0x2D, 0xEF, 0x20, 0x72, 0x0C, 0x90, 0x81, 
-    0xE4, 0x88, 0x00, 0x80, 0xEB, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x28, 
-    0x20, 0x6D, 0xF1, 0x98, 0x21, 0x40, 0x00, 0x04, 0x58, 0x4F, 0x48, 0x78, 0x00, 0x80, 0x2F, 0x2D, 
-    0xF1, 0x98, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x02, 0x4F, 0xEF, 0x00, 0x0C, 0x2B, 0x6D, 
-    0xEC, 0xA0, 0xEF, 0x24, 0x4C, 0xDF, 0x04, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1C, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 0x00, 0x10, 0x26, 0x2E, 0x00, 0x14, 
-    0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x72, 0x28, 0x00, 0x70, 0xFC, 0x22, 0x03, 
-    0x56, 0x81, 0xC2, 0x80, 0x26, 0x01, 0x20, 0x04, 0xE9, 0x88, 0x24, 0x4B, 0xD5, 0xC0, 0x50, 0x8A, 
-    0x58, 0x8A, 0x48, 0x78, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x01, 
-    0x0A, 0x6C, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0xAE, 0x25, 0x40, 0x00, 0x08, 0x2F, 0x03, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0xA2, 0x25, 0x40, 0x00, 0x0C, 0x20, 0x04, 0x52, 0x80, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x92, 0x27, 0x40, 0x00, 0x08, 0x20, 0x05, 0xD0, 0x83, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x4C, 0xDF, 0x0C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 
-    0x70, 0x14, 0x4C, 0x2E, 0x08, 0x00, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x08, 0xD5, 0xC0, 0x45, 0xEA, 
-    0x00, 0x18, 0x2F, 0x2D, 0xED, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x5C, 0x24, 0x80, 0x2F, 0x2E, 
-    0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x50, 0x25, 0x40, 0x00, 0x04, 0x2F, 0x2E, 0x00, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x42, 0x25, 0x40, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x18, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEA, 0x34, 0x25, 0x40, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEA, 0x26, 0x25, 0x40, 0x00, 0x10, 0x20, 0x2E, 0x00, 0x1C, 0xD1, 0xAD, 0xED, 0x44, 0x4F, 0xEF, 
-    0x00, 0x14, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 
-    0x26, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x24, 0x43, 0x50, 0x8A, 0x58, 0x8A, 0x20, 0x43, 
-    0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xE9, 0x82, 0xE9, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x26, 0x48, 0x58, 0x4F, 0x60, 0x24, 0x4A, 0xAA, 0x00, 0x08, 0x67, 0x1A, 0x48, 0x78, 0x00, 0x08, 
-    0x2F, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x01, 0x09, 0x4C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x04, 0x20, 0x4A, 0x60, 0x0A, 0x70, 0x10, 0xD5, 0xC0, 0xB5, 0xCB, 0x65, 0xD8, 0x91, 0xC8, 
-    0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 
-    0x4A, 0xAD, 0xEE, 0x34, 0x66, 0x00, 0x02, 0x00, 0x4A, 0xAD, 0xEE, 0x30, 0x66, 0x00, 0x01, 0xF8, 
-    0x78, 0x00, 0x76, 0x00, 0x42, 0xAD, 0xED, 0x40, 0x49, 0xED, 0xF2, 0xA8, 0x60, 0x00, 0x00, 0xA6, 
-    0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x18, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0xD1, 0xAD, 0xED, 0x40, 0x26, 0x6C, 
-    0x00, 0x04, 0x60, 0x7A, 0x4A, 0xAB, 0x00, 0x14, 0x67, 0x10, 0x52, 0x84, 0x4A, 0x2D, 0xEE, 0x0C, 
-    0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x02, 0x52, 0x83, 0x4A, 0xAB, 0x00, 0x18, 0x67, 0x10, 
-    0x52, 0x84, 0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x02, 0x52, 0x83, 
-    0x4A, 0xAB, 0x00, 0x1C, 0x67, 0x10, 0x52, 0x84, 0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x67, 0x02, 0x52, 0x83, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x2E, 0x24, 0x6B, 0x00, 0x08, 
-    0x60, 0x24, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x14, 0x52, 0x83, 
-    0x41, 0xEA, 0x00, 0x44, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0xD1, 0xAD, 
-    0xED, 0x40, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0xD8, 0x26, 0x6B, 0x00, 0x68, 0x20, 0x0B, 
-    0x66, 0x82, 0x28, 0x54, 0x20, 0x0C, 0x66, 0x00, 0xFF, 0x58, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x08, 
-    0x70, 0x10, 0xD1, 0xAD, 0xED, 0x40, 0x54, 0x83, 0x4A, 0x83, 0x67, 0x08, 0x70, 0x0A, 0xD1, 0xAD, 
-    0xED, 0x40, 0x52, 0x83, 0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x44, 0x00, 0x2C, 0x20, 0x6D, 0xF2, 0xCE, 
-    0x31, 0x7C, 0x00, 0x20, 0x00, 0x2A, 0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x43, 0x00, 0x30, 0x20, 0x6D, 
-    0xF2, 0xCE, 0x31, 0x7C, 0x00, 0x28, 0x00, 0x2E, 0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x7C, 0x00, 0x02, 
-    0x00, 0x10, 0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x7C, 0x00, 0x15, 0x00, 0x12, 0x20, 0x6D, 0xF2, 0xCE, 
-    0x70, 0x01, 0x21, 0x40, 0x00, 0x14, 0x7A, 0x00, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x13, 0x66, 0x2E, 
-    0x2A, 0x2D, 0xEE, 0x14, 0x4A, 0xAD, 0xEE, 0x24, 0x67, 0x36, 0x20, 0x6D, 0xEE, 0x24, 0x20, 0x28, 
-    0x00, 0x28, 0xD0, 0xAD, 0xEE, 0x1C, 0xB0, 0x85, 0x67, 0x26, 0x48, 0x68, 0x00, 0x44, 0x48, 0x79, 
-    0x00, 0x00, 0x33, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xEC, 0xB4, 0x50, 0x4F, 0x60, 0x12, 0x4A, 0xAD, 
-    0xEE, 0x24, 0x67, 0x0C, 0x20, 0x6D, 0xEE, 0x24, 0x2A, 0x28, 0x00, 0x28, 0xDA, 0xAD, 0xEE, 0x1C, 
-    0x20, 0x6D, 0xF2, 0xCE, 0x21, 0x45, 0x00, 0x18, 0x20, 0x6D, 0xF2, 0xCE, 0x42, 0xA8, 0x00, 0x24, 
-    0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x7C, 0x00, 0x34, 0x00, 0x28, 0x4A, 0x84, 0x67, 0x12, 0x20, 0x04, 
-    0xEB, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x50, 0x2B, 0x48, 0xEE, 0x34, 0x58, 0x4F, 
-    0x4A, 0x83, 0x67, 0x5C, 0x52, 0x83, 0x70, 0x28, 0x4C, 0x03, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF0, 0x36, 0x2B, 0x48, 0xEE, 0x30, 0x42, 0x90, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 
-    0x00, 0x08, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 0x00, 0x0C, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 
-    0x00, 0x10, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 0x00, 0x14, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 
-    0x00, 0x18, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 0x00, 0x1C, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 
-    0x00, 0x20, 0x20, 0x6D, 0xEE, 0x30, 0x42, 0xA8, 0x00, 0x24, 0x52, 0xAD, 0xEE, 0x28, 0x58, 0x4F, 
-    0x70, 0x34, 0x2B, 0x40, 0xEF, 0x24, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x03, 0x76, 0x00, 0x4A, 0xAD, 0xEE, 0x34, 0x67, 0x1E, 0x42, 0xA7, 0x2F, 0x2D, 
-    0xEE, 0x2C, 0x2F, 0x2D, 0xEE, 0x34, 0x2F, 0x2D, 0xF2, 0xCE, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 
-    0x00, 0x00, 0xDB, 0x8C, 0x26, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x4A, 0xAD, 0xEE, 0x30, 0x67, 0x20, 
-    0x4A, 0x83, 0x66, 0x1C, 0x42, 0xA7, 0x2F, 0x2D, 0xEE, 0x28, 0x2F, 0x2D, 0xEE, 0x30, 0x2F, 0x2D, 
-    0xF2, 0xCE, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 0xDC, 0x80, 0x4F, 0xEF, 0x00, 0x14, 
-    0x4A, 0x83, 0x66, 0x10, 0x2F, 0x2D, 0xF2, 0xCE, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 
-    0xD9, 0xBE, 0x50, 0x4F, 0x4A, 0x83, 0x67, 0x12, 0x2F, 0x2D, 0xED, 0xC8, 0x48, 0x79, 0x00, 0x00, 
-    0x33, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x86, 0x50, 0x4F, 0x70, 0x34, 0x2B, 0x40, 0xEC, 0xA0, 
-    0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x1E, 0x30, 0x26, 0x6E, 
-    0x00, 0x08, 0x41, 0xED, 0xEE, 0xA4, 0xB7, 0xC8, 0x66, 0x00, 0x04, 0x18, 0x26, 0x2B, 0x00, 0x3C, 
-    0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x22, 0x76, 0x00, 0x4A, 0xAB, 0x00, 0x14, 0x67, 0x02, 0x52, 0x83, 
-    0x4A, 0xAB, 0x00, 0x18, 0x67, 0x02, 0x52, 0x83, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x02, 0x52, 0x83, 
-    0x4A, 0xAB, 0x00, 0x1C, 0x67, 0x02, 0x52, 0x83, 0x48, 0x79, 0x00, 0x00, 0x32, 0x6A, 0x48, 0x79, 
-    0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 0x00, 0x00, 0x32, 0x90, 0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 
-    0x00, 0x00, 0xEA, 0x38, 0x41, 0xEE, 0xFF, 0x00, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2A, 0x00, 0x2B, 0x7C, 0x00, 0x00, 0x00, 0x8C, 0xEE, 0x70, 0x28, 0x3C, 0x00, 0x00, 0x00, 0x8C, 
-    0x2F, 0x2D, 0xEE, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x46, 0x2B, 0x48, 0xEE, 0x78, 0x20, 0x03, 
-    0x53, 0x80, 0x4C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x72, 0x2C, 0xD0, 0x81, 0x2B, 0x40, 
-    0xEE, 0x6C, 0x2F, 0x2D, 0xEE, 0x6C, 0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x24, 0x2B, 0x48, 0xEE, 0x74, 
-    0x2F, 0x3C, 0xC3, 0xCB, 0xC6, 0xC5, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x5C, 0x20, 0x6D, 0xEE, 0x78, 
-    0x20, 0x80, 0x48, 0x78, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x4C, 0x20, 0x6D, 0xEE, 0x78, 
-    0x21, 0x40, 0x00, 0x04, 0x20, 0x6D, 0xEE, 0x78, 0x42, 0xA8, 0x00, 0x08, 0x48, 0x78, 0x00, 0x80, 
-    0x42, 0xA7, 0x20, 0x6D, 0xEE, 0x78, 0x48, 0x68, 0x00, 0x0C, 0x61, 0xFF, 0x00, 0x01, 0x04, 0x90, 
-    0x2F, 0x3C, 0xC5, 0xE2, 0xD0, 0x80, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x1C, 0x20, 0x6D, 0xEE, 0x74, 
-    0x20, 0x80, 0x48, 0x78, 0x01, 0x37, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x0C, 0x20, 0x6D, 0xEE, 0x74, 
-    0x21, 0x40, 0x00, 0x04, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xFC, 0x20, 0x6D, 0xEE, 0x74, 
-    0x21, 0x40, 0x00, 0x08, 0x2F, 0x2D, 0xED, 0x34, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xEA, 0x20, 0x6D, 
-    0xEE, 0x74, 0x21, 0x40, 0x00, 0x0C, 0x2C, 0x2D, 0xED, 0x44, 0x59, 0x86, 0x70, 0x04, 0x2B, 0x40, 
-    0xED, 0x44, 0x4A, 0x2D, 0xEE, 0x10, 0x4F, 0xEF, 0x00, 0x3C, 0x66, 0x00, 0x01, 0x24, 0x76, 0x00, 
-    0x20, 0x6D, 0xEE, 0x74, 0x42, 0xA8, 0x00, 0x10, 0x20, 0x6D, 0xEE, 0x74, 0x42, 0xA8, 0x00, 0x14, 
-    0x4A, 0xAB, 0x00, 0x14, 0x67, 0x5C, 0x2F, 0x2D, 0xF2, 0xE2, 0x48, 0x78, 0x00, 0x0A, 0x42, 0xA7, 
-    0x2F, 0x2B, 0x00, 0x14, 0x48, 0x78, 0x23, 0x00, 0x20, 0x03, 0x52, 0x83, 0x2F, 0x00, 0x2F, 0x2D, 
-    0xEE, 0x74, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x16, 0x4A, 0xAD, 0xEE, 0x24, 0x4F, 0xEF, 0x00, 0x1C, 
-    0x67, 0x30, 0x48, 0x78, 0x00, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0x7C, 0x20, 0x6D, 0xEE, 0x74, 
-    0x21, 0x40, 0x00, 0x10, 0x20, 0x6D, 0xEE, 0x24, 0x20, 0x28, 0x00, 0x28, 0x90, 0xAD, 0xF2, 0xE2, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0x60, 0x20, 0x6D, 0xEE, 0x74, 0x21, 0x40, 0x00, 0x14, 
-    0x50, 0x4F, 0x4A, 0xAB, 0x00, 0x18, 0x67, 0x2C, 0x20, 0x2D, 0xF2, 0xE2, 0xD0, 0xAB, 0x00, 0x14, 
-    0x2F, 0x00, 0x48, 0x78, 0x00, 0x0A, 0x42, 0xA7, 0x2F, 0x2B, 0x00, 0x18, 0x48, 0x78, 0x01, 0x00, 
-    0x20, 0x03, 0x52, 0x83, 0x2F, 0x00, 0x2F, 0x2D, 0xEE, 0x74, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xAE, 
-    0x4F, 0xEF, 0x00, 0x1C, 0x4A, 0xAB, 0x00, 0x1C, 0x67, 0x30, 0x20, 0x2D, 0xF2, 0xE2, 0xD0, 0xAB, 
-    0x00, 0x14, 0xD0, 0xAB, 0x00, 0x18, 0x2F, 0x00, 0x48, 0x78, 0x00, 0x0A, 0x42, 0xA7, 0x2F, 0x2B, 
-    0x00, 0x1C, 0x48, 0x78, 0x11, 0x00, 0x20, 0x03, 0x52, 0x83, 0x2F, 0x00, 0x2F, 0x2D, 0xEE, 0x74, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x78, 0x4F, 0xEF, 0x00, 0x1C, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x00, 
-    0x00, 0xC6, 0x4A, 0x2D, 0xEE, 0x0D, 0x66, 0x00, 0x00, 0xBE, 0x20, 0x2D, 0xF2, 0xE2, 0xD0, 0xAB, 
-    0x00, 0x14, 0xD0, 0xAB, 0x00, 0x18, 0x2F, 0x00, 0x48, 0x78, 0x00, 0x0B, 0x42, 0xA7, 0x2F, 0x2B, 
-    0x00, 0x20, 0x2F, 0x3C, 0x00, 0x00, 0x81, 0x00, 0x20, 0x03, 0x52, 0x83, 0x2F, 0x00, 0x2F, 0x2D, 
-    0xEE, 0x74, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x36, 0x4F, 0xEF, 0x00, 0x1C, 0x60, 0x00, 0x00, 0x88, 
-    0x20, 0x6D, 0xEE, 0x74, 0x42, 0xA8, 0x00, 0x10, 0x20, 0x6D, 0xEE, 0x74, 0x42, 0xA8, 0x00, 0x14, 
-    0x76, 0x00, 0x60, 0x6C, 0x20, 0x6B, 0x00, 0x10, 0x24, 0x70, 0x3C, 0x00, 0xB5, 0xED, 0xEE, 0x20, 
-    0x66, 0x28, 0x20, 0x03, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE4, 0x7A, 0x20, 0x6D, 
-    0xEE, 0x74, 0x21, 0x40, 0x00, 0x10, 0x2F, 0x2D, 0xEE, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xE4, 0x68, 
-    0x20, 0x6D, 0xEE, 0x74, 0x21, 0x40, 0x00, 0x14, 0x50, 0x4F, 0x2F, 0x2A, 0x00, 0x28, 0x20, 0x6A, 
-    0x00, 0x04, 0x41, 0xE8, 0x00, 0x08, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 
-    0x2F, 0x00, 0x2F, 0x2A, 0x00, 0x24, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2A, 0x00, 0x2C, 0x2F, 0x03, 
-    0x2F, 0x2D, 0xEE, 0x74, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xB4, 0x52, 0x83, 0x4F, 0xEF, 0x00, 0x1C, 
-    0xB6, 0xAB, 0x00, 0x3C, 0x6D, 0x8E, 0x70, 0xFC, 0x22, 0x2D, 0xED, 0x44, 0xD2, 0x86, 0x56, 0x81, 
-    0xC2, 0x80, 0x2B, 0x41, 0xED, 0x44, 0x2F, 0x2D, 0xEE, 0x6C, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x32, 0x61, 0x2F, 0x2D, 0xEE, 0x78, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x04, 0x28, 0x00, 0x20, 0x05, 
-    0x52, 0x80, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x32, 0x58, 0x2F, 0x2D, 0xEE, 0x78, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0xEA, 0x28, 0x00, 0x20, 0x2B, 0x00, 0x14, 0xD0, 0xAB, 0x00, 0x18, 
-    0xD0, 0xAB, 0x00, 0x20, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x32, 0x4F, 0x2F, 0x2D, 
-    0xEE, 0x78, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0xC8, 0x28, 0x00, 0x2B, 0x44, 0xED, 0x28, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x4F, 0xEF, 0x00, 0x30, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x3C, 0x20, 0x2D, 
-    0xED, 0x34, 0xE9, 0x88, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x32, 0x46, 0x2F, 0x2D, 
-    0xEE, 0x78, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x98, 0x28, 0x00, 0x2B, 0x44, 0xED, 0x24, 0x2F, 0x2D, 
-    0xED, 0x44, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x32, 0x3D, 0x2F, 0x2D, 0xEE, 0x78, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF8, 0x7C, 0x28, 0x00, 0x4F, 0xEF, 0x00, 0x20, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x06, 
-    0x66, 0x30, 0x2B, 0x44, 0xED, 0x20, 0x20, 0x6D, 0xEE, 0x78, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE2, 0xE8, 0x2B, 0x40, 0xED, 0x1C, 0x42, 0xA7, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x32, 0x34, 0x2F, 0x2D, 0xEE, 0x78, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x44, 0x28, 0x00, 0x4F, 0xEF, 
-    0x00, 0x14, 0x2F, 0x2D, 0xEE, 0x70, 0x2F, 0x2D, 0xEE, 0x78, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF3, 0x1A, 0x2F, 0x2D, 0xEE, 0x6C, 0x2F, 0x2D, 0xEE, 0x74, 0x2F, 0x2D, 0xEE, 0x70, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF3, 0x08, 0x2F, 0x05, 0x48, 0x6E, 0xFF, 0x00, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF2, 0xF8, 0x70, 0x03, 0xC0, 0x85, 0x72, 0x04, 0x92, 0x80, 0x2F, 0x01, 0x48, 0x79, 
-    0x00, 0x00, 0x32, 0x30, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0xDE, 0x4F, 0xEF, 
-    0x00, 0x30, 0x2B, 0x6D, 0xEC, 0xA0, 0xEF, 0x24, 0x20, 0x6B, 0x00, 0x10, 0x20, 0x50, 0x20, 0x2D, 
-    0xEF, 0x24, 0xD0, 0xA8, 0x00, 0x18, 0x2B, 0x40, 0xEF, 0x28, 0x4C, 0xDF, 0x0C, 0x78, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 0x45, 0xED, 0xEE, 0xA4, 0x28, 0x2D, 
-    0xEE, 0x7C, 0xE7, 0x8C, 0xD9, 0xAD, 0xED, 0x28, 0xD9, 0xAD, 0xED, 0x24, 0x76, 0x00, 0x60, 0x24, 
-    0x20, 0x6A, 0x00, 0x10, 0x20, 0x70, 0x3C, 0x00, 0x2F, 0x28, 0x00, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE2, 0x96, 0x72, 0x14, 0x4C, 0x03, 0x18, 0x00, 0x20, 0x6D, 0xEE, 0x74, 0x21, 0x80, 0x18, 0x24, 
-    0x52, 0x83, 0x58, 0x4F, 0xB6, 0xAA, 0x00, 0x3C, 0x6D, 0xD6, 0x24, 0x6D, 0xEE, 0x78, 0x50, 0x8A, 
-    0x58, 0x8A, 0x2F, 0x04, 0x48, 0x6A, 0x00, 0x2C, 0x61, 0xFF, 0xFF, 0xFF, 0xE4, 0x3A, 0x20, 0x6D, 
-    0xEE, 0x78, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xE1, 0xF0, 0x26, 0x00, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x14, 0x53, 0x83, 0x2F, 0x04, 0x20, 0x03, 0xE9, 0x88, 0x48, 0x72, 0x08, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE4, 0x12, 0x50, 0x4F, 0x70, 0x03, 0xB6, 0x80, 0x6E, 0xE6, 0x4C, 0xDF, 
-    0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2D, 0xEE, 0x70, 0x2F, 0x2D, 
-    0xEE, 0x78, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0x12, 0x2F, 0x2D, 0xEE, 0x6C, 0x2F, 0x2D, 
-    0xEE, 0x74, 0x2F, 0x2D, 0xEE, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 
-    0x66, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0xF4, 0x58, 0x4F, 0x60, 0x36, 0x70, 0x01, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xCC, 0x58, 0x4F, 
-    0x60, 0x22, 0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x1C, 
-    0x60, 0x12, 0x2F, 0x2D, 0xED, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x32, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE6, 0x1C, 0x50, 0x4F, 0x20, 0x6A, 0x00, 0x10, 0x2B, 0x50, 0xEE, 0x88, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x01, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xD2, 0x60, 0x12, 0x2F, 0x2D, 0xED, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x32, 0x10, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xE8, 0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x70, 0x01, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x60, 0x22, 
-    0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xC4, 0x60, 0x12, 
-    0x2F, 0x2D, 0xED, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x32, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xAE, 
-    0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1E, 0x38, 0x28, 0x6E, 
-    0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x14, 0x47, 0xF9, 
-    0x00, 0x00, 0x35, 0x64, 0x45, 0xED, 0xF2, 0xFE, 0x60, 0x6A, 0x4A, 0x85, 0x67, 0x0C, 0x10, 0x2A, 
-    0x00, 0x04, 0x72, 0x01, 0xC0, 0x81, 0x66, 0x58, 0x60, 0x0A, 0x10, 0x2A, 0x00, 0x04, 0x72, 0x02, 
-    0xC0, 0x81, 0x66, 0x4C, 0x20, 0x06, 0xC0, 0x92, 0x67, 0x46, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6A, 0x00, 0x08, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0xD0, 0xAE, 0xFF, 0xFC, 0x26, 0x00, 0xB6, 0x84, 0x64, 0x22, 0x98, 0x83, 
-    0x2F, 0x2A, 0x00, 0x08, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x31, 0x54, 0x2F, 0x0C, 0x61, 0xFF, 
-    0x00, 0x00, 0xE4, 0x48, 0xD9, 0xC3, 0x47, 0xF9, 0x00, 0x00, 0x31, 0x51, 0x4F, 0xEF, 0x00, 0x10, 
-    0x70, 0x0C, 0xD5, 0xC0, 0x41, 0xED, 0xF2, 0xFE, 0x41, 0xE8, 0x00, 0xE4, 0xB5, 0xC8, 0x65, 0x8A, 
-    0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xFC, 0x48, 0xE7, 0x1F, 0x38, 
-    0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x10, 0x28, 0x2E, 0x00, 0x14, 
-    0x2C, 0x2E, 0x00, 0x1C, 0x26, 0x2E, 0x00, 0x20, 0x2E, 0x2E, 0x00, 0x24, 0x20, 0x03, 0x02, 0x80, 
-    0x00, 0x00, 0x80, 0x00, 0x67, 0x24, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x0C, 0x2D, 
-    0x00, 0x01, 0xEE, 0x0F, 0x67, 0x0E, 0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x06, 0x4A, 0x2D, 
-    0xEE, 0x06, 0x67, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x03, 0xE2, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 
-    0x80, 0x00, 0x67, 0x1A, 0x48, 0x79, 0x00, 0x00, 0x31, 0x48, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 
-    0xFF, 0x8A, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0xED, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x66, 0x18, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x66, 0x00, 0x03, 0x02, 0x20, 0x03, 0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x67, 0x00, 0x02, 0xF6, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x67, 0x06, 0x02, 0x83, 0xFF, 0xFF, 0xF7, 0xFF, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x14, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x14, 0x00, 0x66, 0x0C, 
-    0x02, 0x83, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x83, 0x00, 0x00, 0x08, 0x00, 0x20, 0x03, 0x02, 0x80, 
-    0x00, 0x00, 0x08, 0x00, 0x67, 0x06, 0x00, 0x83, 0x00, 0x00, 0x10, 0x00, 0x20, 0x03, 0x02, 0x80, 
-    0x00, 0x00, 0x02, 0x00, 0x66, 0x30, 0x20, 0x03, 0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x67, 0x26, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x67, 0x1C, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x04, 
-    0x48, 0x79, 0x00, 0x00, 0x30, 0xFB, 0x61, 0xFF, 0xFF, 0xFF, 0xE4, 0x02, 0x02, 0x83, 0xFF, 0xFF, 
-    0xF3, 0xFF, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x01, 0x3D, 0x7C, 0x48, 0x6D, 0xEF, 0x58, 
-    0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0x50, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x42, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x48, 
-    0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE7, 0xA0, 0x22, 0x6E, 0xFF, 0xFC, 0x23, 0x48, 
-    0x00, 0x04, 0x24, 0x48, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x58, 0x4F, 0x66, 0x00, 
-    0x02, 0x52, 0x2F, 0x04, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xEC, 0x96, 0x25, 0x48, 0x00, 0x3C, 
-    0x50, 0x4F, 0x60, 0x00, 0x02, 0x3E, 0x20, 0x6E, 0xFF, 0xFC, 0x24, 0x68, 0x00, 0x04, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x00, 0x00, 0x86, 0x20, 0x03, 0x22, 0x2A, 0x00, 0x2C, 
-    0xB3, 0x80, 0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x66, 0x1A, 0x20, 0x03, 0x02, 0x80, 0x00, 0x20, 
-    0x00, 0x00, 0x67, 0x6A, 0x20, 0x03, 0x22, 0x2A, 0x00, 0x2C, 0xB3, 0x80, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x67, 0x5A, 0x2F, 0x0B, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x20, 0x52, 
-    0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x30, 0xC6, 0x61, 0xFF, 0xFF, 0xFF, 0xE3, 0x3E, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x20, 0x2A, 0x00, 0x2C, 0xB7, 0x80, 
-    0x02, 0x80, 0x00, 0x20, 0x10, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x01, 0x00, 0x48, 0x6E, 0xFE, 0xFC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x74, 0x48, 0x6E, 0xFE, 0xFC, 0x48, 0x79, 0x00, 0x00, 0x30, 0xA6, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE3, 0x08, 0x4F, 0xEF, 0x00, 0x2C, 0x60, 0x00, 0x01, 0x88, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x67, 0x3C, 0xB8, 0xAA, 0x00, 0x18, 0x6F, 0x30, 0x20, 0x2A, 
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x67, 0x20, 0x2F, 0x0B, 0x20, 0x52, 0x2F, 0x28, 
-    0x00, 0x04, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x30, 0x70, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE2, 0xCA, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x04, 0x25, 0x44, 0x00, 0x18, 0x20, 0x4A, 
-    0x60, 0x00, 0x01, 0xE8, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x78, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x67, 0x6E, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 
-    0x67, 0x0C, 0xB8, 0xAA, 0x00, 0x18, 0x6F, 0x58, 0x25, 0x44, 0x00, 0x18, 0x60, 0x52, 0xB8, 0xAA, 
-    0x00, 0x18, 0x66, 0x2C, 0xBC, 0xAA, 0x00, 0x24, 0x66, 0x26, 0xB8, 0x84, 0x66, 0x22, 0x2F, 0x04, 
-    0x2F, 0x04, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0xFC, 0x50, 0x4F, 0x2F, 0x08, 0x2F, 0x2A, 
-    0x00, 0x3C, 0x61, 0xFF, 0x00, 0x00, 0xFC, 0x16, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x20, 
-    0x2F, 0x2C, 0x00, 0x04, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x30, 0x3E, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0x46, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x00, 0xC6, 
-    0x20, 0x4A, 0x60, 0x00, 0x01, 0x66, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x67, 0x00, 
-    0x00, 0xA8, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x67, 0x50, 0xB8, 0xAA, 
-    0x00, 0x18, 0x66, 0x2C, 0xBC, 0xAA, 0x00, 0x24, 0x66, 0x26, 0xB8, 0x84, 0x66, 0x22, 0x2F, 0x04, 
-    0x2F, 0x04, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x8C, 0x50, 0x4F, 0x2F, 0x08, 0x2F, 0x2A, 
-    0x00, 0x3C, 0x61, 0xFF, 0x00, 0x00, 0xFB, 0xA6, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x62, 
-    0x2F, 0x2C, 0x00, 0x04, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x30, 0x3E, 0x61, 0xFF, 0xFF, 0xFF, 0xE1, 0xD6, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x56, 0xB8, 0xAA, 
-    0x00, 0x18, 0x6C, 0x1E, 0x2F, 0x0B, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x2F, 0x2C, 
-    0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x30, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0xE1, 0xB0, 0x4F, 0xEF, 
-    0x00, 0x14, 0x25, 0x45, 0x00, 0x14, 0x25, 0x44, 0x00, 0x18, 0x42, 0xAA, 0x00, 0x1C, 0x25, 0x6E, 
-    0x00, 0x18, 0x00, 0x20, 0x25, 0x46, 0x00, 0x24, 0x24, 0x8C, 0x25, 0x47, 0x00, 0x34, 0x25, 0x43, 
-    0x00, 0x2C, 0x20, 0x4A, 0x60, 0x00, 0x00, 0xB4, 0x48, 0x78, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE2, 0x18, 0x58, 0x4F, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x48, 
-    0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0x40, 0x24, 0x48, 0x42, 0xAA, 0x00, 0x3C, 
-    0x58, 0x4F, 0x42, 0xAA, 0x00, 0x40, 0x52, 0xAD, 0xED, 0x48, 0x25, 0x6D, 0xED, 0x48, 0x00, 0x38, 
-    0x25, 0x45, 0x00, 0x14, 0x25, 0x44, 0x00, 0x18, 0x42, 0xAA, 0x00, 0x1C, 0x42, 0xAA, 0x00, 0x28, 
-    0x25, 0x6E, 0x00, 0x18, 0x00, 0x20, 0x25, 0x46, 0x00, 0x24, 0x25, 0x43, 0x00, 0x2C, 0x24, 0x8C, 
-    0x25, 0x47, 0x00, 0x34, 0x42, 0xAA, 0x00, 0x30, 0x42, 0xAA, 0x00, 0x0C, 0x42, 0xAA, 0x00, 0x10, 
-    0x41, 0xEA, 0x00, 0x44, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x6D, 0xF2, 0xC4, 
-    0x20, 0x8A, 0x42, 0xAA, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x08, 0x20, 0x4A, 0x50, 0x88, 0x2B, 0x48, 
-    0xF2, 0xC4, 0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x20, 0x08, 0x03, 0x00, 0x0F, 0x66, 0x04, 0x70, 0xFF, 
-    0x60, 0x02, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x04, 0x42, 0xA7, 0x2F, 0x0B, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x11, 0x36, 0x4F, 0xEF, 0x00, 0x14, 0x20, 0x4A, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2D, 0xF3, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x58, 
-    0x2B, 0x40, 0xF3, 0xE2, 0x2F, 0x2D, 0xF3, 0xE6, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x4A, 0x2B, 0x40, 
-    0xF3, 0xE6, 0x70, 0x00, 0x30, 0x2D, 0xF3, 0xEA, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x4A, 
-    0x3B, 0x40, 0xF3, 0xEA, 0x70, 0x00, 0x30, 0x2D, 0xF3, 0xEC, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDC, 0x38, 0x3B, 0x40, 0xF3, 0xEC, 0x70, 0x00, 0x30, 0x2D, 0xF3, 0xEE, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xDC, 0x26, 0x3B, 0x40, 0xF3, 0xEE, 0x2F, 0x2D, 0xF3, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDC, 0x06, 0x2B, 0x40, 0xF3, 0xF2, 0x2F, 0x2D, 0xF3, 0xFA, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xF8, 
-    0x2B, 0x40, 0xF3, 0xFA, 0x2F, 0x2D, 0xF3, 0xFE, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xEA, 0x2B, 0x40, 
-    0xF3, 0xFE, 0x2F, 0x2D, 0xF4, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xDC, 0x2B, 0x40, 0xF4, 0x02, 
-    0x70, 0x00, 0x30, 0x2D, 0xF4, 0x06, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xDC, 0x3B, 0x40, 
-    0xF4, 0x06, 0x70, 0x00, 0x30, 0x2D, 0xF4, 0x08, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xCA, 
-    0x3B, 0x40, 0xF4, 0x08, 0x70, 0x00, 0x30, 0x2D, 0xF4, 0x0A, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDB, 0xB8, 0x3B, 0x40, 0xF4, 0x0A, 0x2F, 0x2D, 0xF4, 0x0E, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x98, 
-    0x2B, 0x40, 0xF4, 0x0E, 0x70, 0x00, 0x30, 0x2D, 0xF4, 0x12, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDB, 0x98, 0x3B, 0x40, 0xF4, 0x12, 0x2F, 0x2D, 0xF4, 0x16, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x78, 
-    0x2B, 0x40, 0xF4, 0x16, 0x2F, 0x2D, 0xF4, 0x1A, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x6A, 0x2B, 0x40, 
-    0xF4, 0x1A, 0x2F, 0x2D, 0xF4, 0x1E, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x5C, 0x2B, 0x40, 0xF4, 0x1E, 
-    0x2F, 0x2D, 0xF4, 0x26, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x4E, 0x2B, 0x40, 0xF4, 0x26, 0x2F, 0x2D, 
-    0xF4, 0x2A, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x40, 0x2B, 0x40, 0xF4, 0x2A, 0x70, 0x00, 0x30, 0x2D, 
-    0xF4, 0x32, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x40, 0x3B, 0x40, 0xF4, 0x32, 0x2F, 0x2D, 
-    0xF4, 0x36, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x20, 0x2B, 0x40, 0xF4, 0x36, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x47, 0xF9, 0x00, 0x00, 0x30, 0x30, 0x76, 0x18, 
-    0x4C, 0x2D, 0x30, 0x00, 0xE9, 0x9E, 0x72, 0x18, 0x4C, 0x2D, 0x10, 0x00, 0xE9, 0xA2, 0xD2, 0x83, 
-    0x76, 0x14, 0x4C, 0x2D, 0x30, 0x00, 0xE9, 0x9A, 0xD6, 0x81, 0x72, 0x0C, 0x4C, 0x2D, 0x10, 0x00, 
-    0xE9, 0x96, 0xD2, 0x83, 0x26, 0x2D, 0xE9, 0x92, 0xE7, 0x8B, 0xD6, 0x81, 0x4A, 0x83, 0x66, 0x06, 
-    0x91, 0xC8, 0x60, 0x00, 0x00, 0xAC, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x72, 0x28, 0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0xFE, 0x24, 0x48, 0x25, 0x43, 
-    0x00, 0x0C, 0x41, 0xEA, 0x00, 0x24, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x2A, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0xE2, 0x25, 0x48, 0x00, 0x14, 0x48, 0x78, 0x00, 0x30, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0xD4, 0x26, 0x48, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x24, 0x27, 0x48, 
-    0x00, 0x04, 0x27, 0x4A, 0x00, 0x08, 0x27, 0x6A, 0x00, 0x0C, 0x00, 0x18, 0x70, 0x01, 0x27, 0x40, 
-    0x00, 0x24, 0x48, 0x78, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0xAE, 0x27, 0x48, 0x00, 0x28, 
-    0x42, 0xA7, 0x48, 0x78, 0x20, 0x02, 0x42, 0xA7, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x0C, 
-    0x42, 0xA7, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x30, 0x26, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xAC, 
-    0x28, 0x48, 0x70, 0x04, 0x81, 0xAC, 0x00, 0x30, 0x20, 0x6B, 0x00, 0x28, 0x20, 0x8C, 0x2B, 0x6A, 
-    0x00, 0x14, 0xEF, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xCC, 0x20, 0x4C, 0x4F, 0xEF, 0x00, 0x30, 
-    0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 
-    0x47, 0xF9, 0x00, 0x00, 0x30, 0x30, 0x76, 0x0C, 0x4C, 0x2D, 0x30, 0x00, 0xED, 0x18, 0x58, 0x83, 
-    0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x28, 0xD0, 0x81, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0x34, 0x24, 0x48, 0x25, 0x43, 0x00, 0x0C, 0x41, 0xEA, 0x00, 0x24, 
-    0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x2A, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE2, 0x18, 0x25, 0x48, 0x00, 0x14, 0x48, 0x78, 0x00, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0x0A, 
-    0x26, 0x48, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x24, 0x27, 0x48, 0x00, 0x04, 0x27, 0x4A, 0x00, 0x08, 
-    0x27, 0x6A, 0x00, 0x0C, 0x00, 0x18, 0x70, 0x01, 0x27, 0x40, 0x00, 0x24, 0x48, 0x78, 0x00, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE1, 0xE4, 0x27, 0x48, 0x00, 0x28, 0x42, 0xA7, 0x48, 0x78, 0x20, 0x00, 
-    0x42, 0xA7, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x0C, 0x42, 0xA7, 0x2F, 0x0B, 0x48, 0x79, 
-    0x00, 0x00, 0x30, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0xE2, 0x28, 0x48, 0x70, 0x04, 0x81, 0xAC, 
-    0x00, 0x30, 0x20, 0x6B, 0x00, 0x28, 0x20, 0x8C, 0x2B, 0x6A, 0x00, 0x14, 0xEC, 0xCC, 0x20, 0x4C, 
-    0x4F, 0xEF, 0x00, 0x30, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xC0, 0x70, 0x08, 
-    0xB0, 0xAA, 0x00, 0x0C, 0x58, 0x4F, 0x6E, 0x00, 0x00, 0xA4, 0x48, 0x78, 0x00, 0x08, 0x42, 0xA7, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x8C, 0x25, 0x48, 0x00, 0x08, 0x20, 0x6A, 0x00, 0x08, 0x2F, 0x10, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xD9, 0x46, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x5A, 0x20, 0x6A, 
-    0x00, 0x08, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xD8, 0xA0, 0xE9, 0x88, 0x72, 0x0C, 
-    0xD0, 0x81, 0x58, 0x4F, 0x2F, 0x00, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x54, 0x25, 0x48, 
-    0x00, 0x08, 0x48, 0x79, 0x00, 0x00, 0x32, 0x61, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEE, 0xDA, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x04, 0x70, 0x01, 0x60, 0x52, 0x48, 0x79, 
-    0x00, 0x00, 0x30, 0x0A, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0xBE, 0x20, 0x08, 
-    0x50, 0x4F, 0x67, 0x28, 0x70, 0x02, 0x60, 0x38, 0x20, 0x6A, 0x00, 0x08, 0x2F, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xD9, 0x50, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 0x48, 0x6A, 0x00, 0x24, 0x48, 0x79, 
-    0x00, 0x00, 0x2F, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 0xDD, 0x04, 0x50, 0x4F, 0x48, 0x6A, 0x00, 0x24, 
-    0x48, 0x79, 0x00, 0x00, 0x2F, 0xAA, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0xF2, 0x70, 0x00, 0x50, 0x4F, 
-    0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x78, 0x00, 0x14, 0x42, 0xA7, 
-    0x48, 0x6D, 0xE9, 0x7E, 0x61, 0xFF, 0x00, 0x00, 0xF6, 0xD6, 0x2B, 0x6E, 0x00, 0x08, 0xE9, 0x7E, 
-    0x2B, 0x6E, 0x00, 0x0C, 0xE9, 0x86, 0x2B, 0x6E, 0x00, 0x10, 0xE9, 0x82, 0x41, 0xED, 0xE9, 0x7E, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xFC, 0x48, 0xE7, 0x1E, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x24, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x97, 0xCB, 0x20, 0x43, 0x1D, 0x50, 0xFE, 0xFC, 
-    0x1D, 0x68, 0x00, 0x01, 0xFE, 0xFD, 0x48, 0x78, 0x00, 0xFE, 0x2F, 0x0C, 0x48, 0x6E, 0xFE, 0xFE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0x5A, 0x70, 0x08, 0xC0, 0xAA, 0x00, 0x08, 0x4A, 0x80, 0x66, 0x06, 
-    0x20, 0x6D, 0xF2, 0xD2, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x20, 0x20, 0x2F, 0x08, 0x48, 0x6D, 
-    0xEF, 0x4C, 0x48, 0x6E, 0xFE, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0xCC, 
-    0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x1C, 0x66, 0x3C, 0x26, 0x6E, 0xFF, 0xFC, 0x26, 0x6B, 
-    0x00, 0x04, 0x50, 0x8B, 0x58, 0x8B, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x08, 0x67, 0x28, 0x20, 0x2B, 
-    0x00, 0x08, 0x02, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xB0, 0xAA, 0x00, 0x08, 0x66, 0x18, 0x20, 0x6A, 
-    0x00, 0x04, 0xB1, 0xEB, 0x00, 0x04, 0x66, 0x0E, 0x20, 0x12, 0xB0, 0x93, 0x66, 0x08, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x60, 0x00, 0x02, 0x62, 0x4A, 0x83, 0x66, 0x3A, 0x7A, 0x03, 0xCA, 0xAA, 0x00, 0x08, 
-    0x70, 0x01, 0xBA, 0x80, 0x67, 0x2E, 0x70, 0x03, 0xBA, 0x80, 0x66, 0x00, 0x01, 0x10, 0x70, 0x03, 
-    0xC0, 0xAB, 0x00, 0x08, 0x57, 0x80, 0x66, 0x00, 0x01, 0x04, 0x20, 0x2B, 0x00, 0x08, 0x02, 0x80, 
-    0x00, 0x00, 0x10, 0x00, 0x22, 0x2A, 0x00, 0x08, 0x02, 0x81, 0x00, 0x00, 0x10, 0x00, 0xB2, 0x80, 
-    0x67, 0x00, 0x00, 0xEA, 0x26, 0x6E, 0xFF, 0xFC, 0x4A, 0x83, 0x66, 0x4E, 0x70, 0x03, 0xC0, 0xAA, 
-    0x00, 0x08, 0x57, 0x80, 0x66, 0x10, 0x2F, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x2F, 0x76, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xDB, 0xBA, 0x50, 0x4F, 0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x72, 0x0C, 0xD0, 0x81, 0x2F, 0x00, 0x20, 0x6D, 0xEF, 0x54, 0x4E, 0x90, 0x26, 0x48, 0x41, 0xEB, 
-    0x00, 0x08, 0x43, 0xEE, 0xFE, 0xFC, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x26, 0x90, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x8B, 0x58, 0x4F, 0x48, 0x78, 0x00, 0x20, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xDF, 0x56, 0x27, 0x48, 0x00, 0x04, 0x43, 0xD2, 0x41, 0xE8, 0x00, 0x0C, 0x70, 0x04, 
-    0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x70, 0x13, 0xC0, 0xAA, 0x00, 0x08, 0x55, 0x80, 0x58, 0x4F, 
-    0x66, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x6B, 
-    0x00, 0x04, 0x70, 0xFF, 0x21, 0x40, 0x00, 0x04, 0x20, 0x6B, 0x00, 0x04, 0x70, 0xFF, 0x21, 0x40, 
-    0x00, 0x08, 0x20, 0x6D, 0xEF, 0x38, 0x20, 0x8B, 0x2B, 0x6B, 0x00, 0x04, 0xEF, 0x38, 0x4A, 0x2D, 
-    0xED, 0xFC, 0x67, 0x00, 0x01, 0x6E, 0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x00, 0x01, 0x66, 0x70, 0x04, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x00, 0x01, 0x5C, 0x48, 0x78, 0x00, 0x24, 0x2F, 0x0C, 0x61, 0xFF, 
-    0x00, 0x00, 0xF5, 0xD2, 0x20, 0x08, 0x50, 0x4F, 0x67, 0x00, 0x01, 0x48, 0x20, 0x6B, 0x00, 0x04, 
-    0x00, 0xA8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x60, 0x00, 0x01, 0x38, 0x70, 0x01, 0xC0, 0xAA, 
-    0x00, 0x08, 0x67, 0x00, 0x01, 0x02, 0x26, 0x6E, 0xFF, 0xFC, 0x26, 0x6B, 0x00, 0x04, 0x50, 0x8B, 
-    0x58, 0x8B, 0x70, 0x20, 0x22, 0x2A, 0x00, 0x08, 0x24, 0x2B, 0x00, 0x08, 0xB5, 0x81, 0xC2, 0x80, 
-    0x67, 0x78, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x2A, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x08, 0x67, 0x22, 
-    0x20, 0x6B, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6A, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 
-    0x2F, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x2F, 0x22, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0xA0, 0x4F, 0xEF, 
-    0x00, 0x10, 0x70, 0x20, 0xC0, 0xAA, 0x00, 0x08, 0x67, 0x24, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x08, 
-    0x67, 0x38, 0x48, 0x79, 0x00, 0x00, 0x2F, 0x1E, 0x2F, 0x0B, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFD, 0xC6, 0x70, 0xFE, 0xC1, 0xAB, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1C, 0x48, 0x79, 
-    0x00, 0x00, 0x2F, 0x1E, 0x2F, 0x0A, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xAA, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x9E, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x08, 
-    0x67, 0x56, 0x08, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x66, 0x4E, 0x4A, 0x2D, 0xEE, 0x02, 0x67, 0x24, 
-    0x20, 0x6B, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6A, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 
-    0x2F, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x2E, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0x20, 0x4F, 0xEF, 
-    0x00, 0x10, 0x60, 0x5E, 0x20, 0x6B, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6A, 0x00, 0x10, 
-    0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x2E, 0xC6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD9, 0xFC, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x3A, 0x41, 0xD2, 0x43, 0xD3, 0x70, 0x04, 0x22, 0xD8, 
-    0x51, 0xC8, 0xFF, 0xFC, 0x60, 0x2C, 0x70, 0x10, 0xC0, 0xAA, 0x00, 0x08, 0x66, 0x24, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x41, 0xE8, 0x00, 0x14, 0x28, 0x08, 0x20, 0x44, 0x2C, 0x10, 
-    0x70, 0x10, 0xC0, 0x86, 0x67, 0x0C, 0x70, 0xEF, 0xC0, 0x86, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 
-    0x20, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x00, 0x28, 0x2E, 0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 
-    0xB8, 0x84, 0x67, 0x14, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x98, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD9, 0x8C, 0x50, 0x4F, 0x60, 0x02, 0xD6, 0x83, 0xB6, 0x84, 0x6D, 0xFA, 0x20, 0x03, 0x4C, 0xDF, 
-    0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xCC, 0x48, 0xE7, 0x1F, 0x38, 0x2A, 0x2E, 
-    0x00, 0x08, 0x78, 0x00, 0x48, 0x79, 0x00, 0x00, 0x32, 0x61, 0x20, 0x45, 0x2F, 0x28, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0xE6, 0x24, 0x48, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE3, 0x40, 0x2D, 0x48, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xD4, 0x68, 0x2D, 0x40, 0xFF, 0xCC, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x6F, 0x28, 
-    0x48, 0x79, 0x00, 0x00, 0x32, 0x46, 0x20, 0x45, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEA, 0xAA, 0x24, 0x48, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE3, 0x04, 0x28, 0x08, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x79, 0x00, 0x00, 0x32, 0x3D, 0x20, 0x45, 
-    0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x82, 0x24, 0x48, 0x2F, 0x2A, 0x00, 0x0C, 
-    0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xE2, 0xDC, 0x2D, 0x48, 0xFF, 0xE8, 0x48, 0x79, 
-    0x00, 0x00, 0x32, 0x4F, 0x20, 0x45, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x5C, 
-    0x50, 0x4F, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0xF0, 0x2D, 0x40, 0xFF, 0xE4, 
-    0x20, 0x6E, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0xDE, 0xE5, 0x88, 
-    0x58, 0x4F, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x80, 0x22, 0x45, 0x23, 0x48, 0x00, 0x28, 
-    0x20, 0x6E, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0xBE, 0x2D, 0x40, 
-    0xFF, 0xD0, 0x20, 0x45, 0x21, 0x40, 0x00, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0xDE, 0x36, 0x48, 0x79, 
-    0x00, 0x00, 0x27, 0xE0, 0x48, 0x78, 0x00, 0x10, 0x2F, 0x2E, 0xFF, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0xC2, 0x50, 0x4F, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xD8, 0x61, 0xFF, 0xFF, 0xFF, 0xD6, 0x8A, 
-    0x7C, 0x00, 0x24, 0x6E, 0xFF, 0xD4, 0x45, 0xEA, 0x00, 0x18, 0x4F, 0xEF, 0x00, 0x28, 0x60, 0x00, 
-    0x00, 0xEC, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0x70, 0x2E, 0x00, 0x2F, 0x2A, 
-    0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0x64, 0x26, 0x00, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD3, 0x5A, 0x20, 0x6E, 0xFF, 0xE8, 0xD1, 0xC0, 0x26, 0x48, 0x2F, 0x06, 0x2F, 0x03, 0x2F, 0x2A, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0x44, 0x58, 0x4F, 0x2F, 0x00, 0x20, 0x2E, 0xFF, 0xE4, 
-    0xD0, 0x87, 0x2F, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 0xFF, 0xE4, 0x2F, 0x05, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF2, 0xF8, 0x28, 0x48, 0x22, 0x45, 0x20, 0x29, 0x00, 0x28, 0x22, 0x40, 0x23, 0x88, 
-    0x6C, 0x00, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x4F, 0xEF, 0x00, 0x2C, 0x66, 0x14, 
-    0x2F, 0x2A, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0x02, 0xE7, 0x88, 0xD0, 0x87, 0xD1, 0xAE, 
-    0xFF, 0xE4, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x5E, 0x2F, 0x2A, 0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD2, 0xEA, 0x29, 0x40, 0x00, 0x28, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x58, 0x4F, 
-    0x67, 0x12, 0x4A, 0x2D, 0xEE, 0x12, 0x66, 0x0C, 0x2B, 0x6C, 0x00, 0x28, 0xF2, 0xE2, 0x1B, 0x7C, 
-    0x00, 0x01, 0xEE, 0x12, 0x20, 0x6E, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD2, 0xBA, 0x0C, 0x80, 0x00, 0x00, 0x01, 0x2C, 0x58, 0x4F, 0x6C, 0x08, 0x00, 0xAC, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x30, 0x48, 0x6E, 0xFF, 0xD8, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xD6, 0x78, 
-    0x21, 0x4C, 0x00, 0x04, 0x50, 0x4F, 0x52, 0x86, 0x70, 0x14, 0xD5, 0xC0, 0xBC, 0xAE, 0xFF, 0xD0, 
-    0x6D, 0x00, 0xFF, 0x10, 0x20, 0x6E, 0xFF, 0xD4, 0x4A, 0xA8, 0x00, 0x10, 0x67, 0x7A, 0x4A, 0xAD, 
-    0xEE, 0x24, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x80, 0x61, 0xFF, 0xFF, 0xFF, 0xD7, 0x3E, 
-    0x58, 0x4F, 0x20, 0x6E, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xD2, 0x5C, 
-    0x53, 0x80, 0x2C, 0x00, 0x48, 0x6E, 0xFF, 0xD8, 0x70, 0x14, 0x4C, 0x06, 0x08, 0x00, 0x20, 0x6E, 
-    0xFF, 0xD4, 0x2F, 0x30, 0x08, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xD2, 0x40, 0x20, 0x6E, 0xFF, 0xE8, 
-    0x58, 0x4F, 0x48, 0x70, 0x08, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xD6, 0x68, 0x24, 0x48, 0x20, 0x0A, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x20, 0x6A, 0x00, 0x04, 
-    0x2B, 0x48, 0xEE, 0x24, 0x20, 0x6E, 0xFF, 0xD4, 0x2F, 0x28, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD2, 0x0A, 0x2B, 0x40, 0xEE, 0x1C, 0x58, 0x4F, 0x20, 0x45, 0x21, 0x6E, 0xFF, 0xCC, 0x00, 0x1C, 
-    0x20, 0x2E, 0xFF, 0xCC, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0x9C, 0x22, 0x45, 
-    0x23, 0x48, 0x00, 0x20, 0x20, 0x45, 0x28, 0x68, 0x00, 0x20, 0x20, 0x2E, 0xFF, 0xCC, 0xE5, 0x88, 
-    0x20, 0x4C, 0xD1, 0xC0, 0x2C, 0x08, 0x58, 0x4F, 0x60, 0x00, 0x00, 0xC4, 0x48, 0x78, 0x00, 0x14, 
-    0x42, 0xA7, 0x48, 0x6E, 0xFF, 0xEC, 0x61, 0xFF, 0x00, 0x00, 0xF0, 0x94, 0x20, 0x44, 0x2F, 0x28, 
-    0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xD1, 0xB4, 0x26, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x2D, 0x45, 
-    0xFF, 0xFC, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xD1, 0x9E, 0x2D, 0x40, 
-    0xFF, 0xEC, 0x70, 0x01, 0xC0, 0x83, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x42, 0x70, 0x20, 0xC0, 0x83, 
-    0x66, 0x06, 0x70, 0x04, 0xC0, 0x83, 0x66, 0x36, 0x48, 0x6E, 0xFF, 0xD8, 0x20, 0x44, 0x2F, 0x28, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xD1, 0x74, 0x20, 0x6E, 0xFF, 0xE8, 0x58, 0x4F, 0x48, 0x70, 
-    0x08, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xD5, 0x9C, 0x24, 0x48, 0x20, 0x0A, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x20, 0x6A, 0x00, 0x04, 0x2D, 0x48, 0xFF, 0xF0, 0x70, 0x03, 
-    0xC0, 0x83, 0x53, 0x80, 0x66, 0x08, 0x26, 0x45, 0x47, 0xEB, 0x00, 0x2C, 0x60, 0x06, 0x47, 0xF9, 
-    0x00, 0x00, 0x2E, 0x7C, 0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xEC, 0x20, 0x44, 0x2F, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xD1, 0x28, 0x20, 0x6E, 0xFF, 0xE8, 0x58, 0x4F, 0x48, 0x70, 0x08, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF9, 0x34, 0x28, 0xC8, 0x70, 0x10, 0xD8, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0xB9, 0xC6, 
-    0x65, 0x00, 0xFF, 0x3A, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0xAC, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x1B, 0x7C, 
-    0x00, 0x01, 0xED, 0xEC, 0x4A, 0xAA, 0x00, 0x10, 0x67, 0x10, 0x2F, 0x2A, 0x00, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xDA, 0x84, 0x26, 0x48, 0x58, 0x4F, 0x60, 0x12, 0x20, 0x6A, 0x00, 0x08, 0x2F, 0x28, 
-    0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0x70, 0x26, 0x48, 0x58, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDB, 0x42, 0x70, 0x08, 0x20, 0x6A, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x67, 0x0C, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xCC, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFB, 0xF8, 0x58, 0x4F, 0x20, 0x6D, 0xEF, 0x38, 0x42, 0x90, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x36, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xDA, 0x8E, 0x58, 0x4F, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x38, 0x7A, 0x00, 0x99, 0xCC, 0x48, 0x79, 
-    0x00, 0x00, 0x32, 0x61, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE6, 0xBA, 0x24, 0x48, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xDF, 0x14, 0x26, 0x48, 0x2F, 0x2B, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xD0, 0x3E, 0x26, 0x00, 
-    0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x14, 0x6F, 0x2A, 0x48, 0x79, 0x00, 0x00, 0x32, 0x46, 0x20, 0x6E, 
-    0x00, 0x08, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x80, 0x24, 0x48, 0x2F, 0x2A, 
-    0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xDE, 0xDA, 0x28, 0x48, 0x4F, 0xEF, 
-    0x00, 0x10, 0x48, 0x79, 0x00, 0x00, 0x32, 0x3D, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x56, 0x24, 0x48, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xDE, 0xB0, 0x2D, 0x48, 0xFF, 0xFC, 0x48, 0x79, 0x00, 0x00, 0x32, 0x4F, 
-    0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x2E, 0x50, 0x4F, 
-    0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0xC2, 0x28, 0x00, 0x2F, 0x2B, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0xB6, 0x28, 0x40, 0x7C, 0x00, 0x24, 0x4B, 0x45, 0xEA, 0x00, 0x18, 
-    0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0x00, 0xD4, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCF, 0x9A, 0x26, 0x00, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0x8E, 0x2E, 0x00, 
-    0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0x84, 0x20, 0x6E, 0xFF, 0xFC, 0xD1, 0xC0, 0x26, 0x48, 
-    0x48, 0x79, 0x00, 0x00, 0x2E, 0x74, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xEF, 0x2E, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x14, 0x66, 0x1C, 0x0C, 0x83, 0x00, 0x00, 0x00, 0x80, 0x66, 0x14, 0x2F, 0x03, 
-    0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xDD, 0x1A, 0x2B, 0x48, 0xF1, 0x98, 0x52, 0x85, 0x50, 0x4F, 
-    0x60, 0x56, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x6A, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xEE, 0xFC, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x18, 0x2F, 0x03, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0xF2, 
-    0x2B, 0x48, 0xF2, 0xA0, 0x2B, 0x43, 0xF2, 0xA4, 0x52, 0x85, 0x50, 0x4F, 0x60, 0x2A, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x60, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xEE, 0xD0, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x16, 0x2F, 0x03, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0xC6, 0x2B, 0x48, 0xF1, 0xE0, 
-    0x2B, 0x43, 0xF1, 0xE4, 0x52, 0x85, 0x50, 0x4F, 0x20, 0x07, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 
-    0x66, 0x12, 0x2F, 0x2A, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0xE0, 0xE7, 0x88, 0xD0, 0x83, 
-    0xD8, 0x80, 0x58, 0x4F, 0x52, 0x86, 0x70, 0x14, 0xD5, 0xC0, 0xBC, 0x8C, 0x6D, 0x00, 0xFF, 0x2A, 
-    0x4A, 0x85, 0x6F, 0x1E, 0xBA, 0x8C, 0x67, 0x1A, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x08, 
-    0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x34, 0x61, 0xFF, 0xFF, 0xFF, 0xD3, 0x7E, 
-    0x50, 0x4F, 0x20, 0x05, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x24, 0x2F, 0x00, 0x04, 
-    0x20, 0x02, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x04, 0x70, 0x07, 0x4E, 0x75, 0x20, 0x02, 
-    0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x04, 0x70, 0x08, 0x4E, 0x75, 0x72, 0x01, 0x20, 0x02, 
-    0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x66, 0x02, 0x56, 0x81, 0x20, 0x02, 0x02, 0x80, 0x00, 0x00, 
-    0x02, 0x00, 0x66, 0x0E, 0x20, 0x02, 0x02, 0x80, 0x00, 0x10, 0x00, 0x00, 0x66, 0x02, 0x52, 0x81, 
-    0x52, 0x81, 0x20, 0x01, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x26, 0x6E, 
-    0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x70, 0x20, 0xC0, 0xAA, 0x00, 0x30, 0x66, 0x08, 0x70, 0x10, 
-    0xC0, 0xAB, 0x00, 0x30, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xD4, 0x70, 0x20, 0xC0, 0xAB, 
-    0x00, 0x30, 0x66, 0x08, 0x70, 0x10, 0xC0, 0xAA, 0x00, 0x30, 0x67, 0x06, 0x70, 0x01, 0x60, 0x00, 
-    0x00, 0xBE, 0x2F, 0x2B, 0x00, 0x2C, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x26, 0x00, 0x2F, 0x2A, 
-    0x00, 0x2C, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x28, 0x00, 0xB6, 0x84, 0x50, 0x4F, 0x6F, 0x06, 
-    0x70, 0x01, 0x60, 0x00, 0x00, 0x9A, 0xB6, 0x84, 0x66, 0x00, 0x00, 0x92, 0x4A, 0x93, 0x67, 0x4E, 
-    0x4A, 0x92, 0x67, 0x4A, 0x70, 0x08, 0x20, 0x53, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 
-    0x67, 0x1E, 0x70, 0x08, 0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x66, 0x2E, 
-    0x70, 0x08, 0xC0, 0xAD, 0xED, 0xCC, 0x67, 0x04, 0x70, 0x00, 0x60, 0x62, 0x70, 0x01, 0x60, 0x5E, 
-    0x70, 0x08, 0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x67, 0x10, 0x70, 0x08, 
-    0xC0, 0xAD, 0xED, 0xCC, 0x67, 0x04, 0x70, 0x01, 0x60, 0x44, 0x70, 0x00, 0x60, 0x40, 0x20, 0x6A, 
-    0x00, 0x04, 0x50, 0x88, 0x22, 0x6B, 0x00, 0x04, 0x50, 0x89, 0xB3, 0xC8, 0x66, 0x0E, 0x20, 0x2B, 
-    0x00, 0x38, 0xB0, 0xAA, 0x00, 0x38, 0x6F, 0x24, 0x70, 0x01, 0x60, 0x22, 0x20, 0x6A, 0x00, 0x04, 
-    0x48, 0x68, 0x00, 0x08, 0x20, 0x6B, 0x00, 0x04, 0x48, 0x68, 0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 
-    0xED, 0x2A, 0x4A, 0x80, 0x50, 0x4F, 0x6F, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 
-    0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1E, 0x30, 0x24, 0x6E, 
-    0x00, 0x08, 0x2C, 0x2E, 0x00, 0x0C, 0x59, 0x8A, 0x78, 0x01, 0x70, 0x03, 0x4C, 0x04, 0x08, 0x00, 
-    0x52, 0x80, 0x28, 0x00, 0xB8, 0x86, 0x6F, 0xF2, 0x4C, 0x7C, 0x48, 0x04, 0x00, 0x00, 0x00, 0x03, 
-    0x2A, 0x04, 0x52, 0x85, 0x60, 0x34, 0x26, 0x72, 0x5C, 0x00, 0x26, 0x05, 0x60, 0x0C, 0x20, 0x03, 
-    0x90, 0x84, 0x25, 0xB2, 0x0C, 0x00, 0x3C, 0x00, 0x96, 0x84, 0xB6, 0x84, 0x6F, 0x16, 0x2F, 0x0B, 
-    0x20, 0x03, 0x90, 0x84, 0x2F, 0x32, 0x0C, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xAC, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0xDA, 0x25, 0x8B, 0x3C, 0x00, 0x52, 0x85, 0xBA, 0x86, 0x6F, 0xC8, 0x70, 0x01, 
-    0xB8, 0x80, 0x6E, 0xB4, 0x4C, 0xDF, 0x0C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x1E, 0x20, 
-    0x51, 0x4F, 0x24, 0x6F, 0x00, 0x20, 0x2C, 0x2F, 0x00, 0x24, 0x51, 0x8A, 0x78, 0x01, 0x70, 0x03, 
-    0x4C, 0x04, 0x08, 0x00, 0x52, 0x80, 0x28, 0x00, 0xB8, 0x86, 0x6F, 0xF2, 0x4C, 0x7C, 0x48, 0x04, 
-    0x00, 0x00, 0x00, 0x03, 0x2A, 0x04, 0x52, 0x85, 0x60, 0x4E, 0x20, 0x05, 0xE7, 0x88, 0x20, 0x4A, 
-    0xD1, 0xC0, 0x2E, 0x90, 0x2F, 0x68, 0x00, 0x04, 0x00, 0x04, 0x26, 0x05, 0x60, 0x18, 0x20, 0x03, 
-    0x90, 0x84, 0xE7, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 0x20, 0x03, 0xE7, 0x88, 0x22, 0x4A, 0xD3, 0xC0, 
-    0x22, 0xD8, 0x22, 0xD8, 0x96, 0x84, 0xB6, 0x84, 0x6F, 0x0C, 0x20, 0x03, 0x90, 0x84, 0x20, 0x32, 
-    0x0E, 0x00, 0xB0, 0x97, 0x62, 0xD8, 0x20, 0x03, 0xE7, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 0x20, 0x97, 
-    0x21, 0x6F, 0x00, 0x04, 0x00, 0x04, 0x52, 0x85, 0xBA, 0x86, 0x6F, 0xAE, 0x70, 0x01, 0xB8, 0x80, 
-    0x6E, 0x9A, 0x50, 0x4F, 0x4C, 0xDF, 0x04, 0x78, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xE8, 0x2F, 0x0A, 
-    0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x2A, 
-    0x2D, 0x48, 0xFF, 0xFC, 0x48, 0x6D, 0xEF, 0x4C, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD0, 0x06, 0x24, 0x48, 0x20, 0x6E, 0xFF, 0xFC, 0x43, 0xEE, 0xFF, 0xE8, 0x70, 0x04, 0x22, 0xD8, 
-    0x51, 0xC8, 0xFF, 0xFC, 0x48, 0x78, 0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0xD4, 0xBC, 0x25, 0x48, 
-    0x00, 0x04, 0x43, 0xEE, 0xFF, 0xE8, 0x41, 0xE8, 0x00, 0x0C, 0x70, 0x04, 0x20, 0xD9, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x20, 0x6A, 0x00, 0x04, 0x70, 0xFF, 0x21, 0x40, 0x00, 0x04, 0x20, 0x6A, 0x00, 0x04, 
-    0x70, 0xFF, 0x21, 0x40, 0x00, 0x08, 0x20, 0x6D, 0xEF, 0x38, 0x20, 0x8A, 0x2B, 0x6A, 0x00, 0x04, 
-    0xEF, 0x38, 0x4F, 0xEF, 0x00, 0x18, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xEC, 
-    0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x48, 0x6D, 0xEF, 0x4C, 
-    0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0xEC, 0x24, 0x48, 0x20, 0x0A, 0x50, 0x4F, 0x66, 0x06, 
-    0x4A, 0x2D, 0xEE, 0x0D, 0x66, 0x54, 0x20, 0x0A, 0x67, 0x16, 0x26, 0x6A, 0x00, 0x04, 0x20, 0x2B, 
-    0x00, 0x14, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x67, 0x06, 0x27, 0x43, 0x00, 0x0C, 0x60, 0x3A, 
-    0x48, 0x78, 0x00, 0x14, 0x42, 0xA7, 0x48, 0x6E, 0xFF, 0xEC, 0x61, 0xFF, 0x00, 0x00, 0xEA, 0x50, 
-    0x2D, 0x43, 0xFF, 0xEC, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xF0, 0x2D, 0x7C, 0x01, 0x00, 0x00, 0x07, 
-    0xFF, 0xF4, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x48, 0x6E, 0xFF, 0xEC, 0x48, 0x6C, 0x00, 0x02, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x72, 0x4F, 0xEF, 0x00, 0x18, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0xD1, 0x9E, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x08, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x48, 0x6D, 0xEF, 0x4C, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xCF, 0x40, 0x20, 0x08, 0x50, 0x4F, 0x67, 0x26, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x6A, 
-    0x00, 0x02, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x2F, 0x2E, 
-    0x00, 0x10, 0x2F, 0x0A, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x4F, 0xEF, 0x00, 0x18, 
-    0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x6E, 
-    0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x18, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x0C, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD1, 0x18, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xD0, 
-    0x2F, 0x2E, 0x00, 0x14, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x04, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x2E, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0xD0, 0xF2, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0x70, 0xFF, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x28, 
-    0x2F, 0x03, 0x48, 0x79, 0x00, 0x00, 0x2D, 0xF8, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xD0, 0xC4, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0x7C, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFE, 0xFC, 0x48, 0xE7, 0x1C, 0x38, 0x2A, 0x2E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 
-    0x26, 0x6E, 0x00, 0x10, 0x26, 0x2A, 0x00, 0x2C, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x67, 0x00, 0x00, 0xA8, 0x20, 0x03, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x81, 0xAD, 0xED, 0xE0, 
-    0x20, 0x03, 0x46, 0x80, 0x02, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x81, 0xAD, 0xED, 0xDC, 0x20, 0x2D, 
-    0xED, 0xE0, 0xC0, 0xAD, 0xED, 0xDC, 0x28, 0x2D, 0xED, 0xD8, 0x46, 0x84, 0xC8, 0x80, 0x4A, 0x84, 
-    0x67, 0x4A, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x2D, 0xC0, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0xA6, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x2F, 0x00, 0x2F, 0x04, 0x48, 0x78, 0x01, 0x00, 0x48, 0x6E, 0xFE, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE8, 0xE8, 0x48, 0x6E, 0xFE, 0xFC, 0x48, 0x79, 0x00, 0x00, 0x30, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCE, 0x7C, 0x89, 0xAD, 0xED, 0xD8, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x2E, 0x20, 0x03, 0x02, 0x80, 
-    0x00, 0x04, 0x00, 0x00, 0x67, 0x24, 0x10, 0x2D, 0xED, 0xEE, 0x72, 0x20, 0xC0, 0x81, 0x67, 0x1A, 
-    0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x2D, 0x92, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x01, 0x3D, 0x7C, 
-    0x20, 0x45, 0x48, 0x68, 0x00, 0x5C, 0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCC, 0x9A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x00, 0x00, 0xDA, 0x20, 0x4B, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x48, 0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD1, 0xE8, 0x22, 0x6E, 0xFF, 0xFC, 0x23, 0x48, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 
-    0x00, 0x04, 0x42, 0xA8, 0x00, 0x40, 0x52, 0xAD, 0xED, 0x48, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 
-    0x00, 0x04, 0x21, 0x6D, 0xED, 0x48, 0x00, 0x38, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 
-    0x21, 0x43, 0x00, 0x2C, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x14, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x18, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x68, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x24, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 
-    0x70, 0xFF, 0x21, 0x40, 0x00, 0x28, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x21, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x08, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x42, 0x90, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 
-    0x00, 0x04, 0x41, 0xE8, 0x00, 0x44, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x45, 
-    0x52, 0xA8, 0x00, 0x3C, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x6D, 0xEE, 0x90, 0x22, 0xA8, 0x00, 0x04, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x50, 0x88, 0x2B, 0x48, 0xEE, 0x90, 0x58, 0x4F, 
-    0x60, 0x00, 0x01, 0x4E, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x41, 0xE8, 0x00, 0x2C, 
-    0x28, 0x48, 0x28, 0x14, 0xB6, 0x84, 0x67, 0x00, 0x01, 0x38, 0x20, 0x03, 0x02, 0x80, 0x00, 0x04, 
-    0x00, 0x00, 0x81, 0x94, 0x20, 0x03, 0x02, 0x80, 0x00, 0x04, 0x00, 0x00, 0x22, 0x04, 0x02, 0x81, 
-    0xFF, 0xFB, 0xFF, 0xFF, 0x82, 0x80, 0x28, 0x01, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x67, 0x14, 0x20, 0x03, 0x02, 0x80, 0x00, 0x70, 0x00, 0x00, 0x22, 0x04, 0x02, 0x81, 0xFF, 0x8F, 
-    0xFF, 0xFF, 0x82, 0x80, 0x28, 0x01, 0xB6, 0x84, 0x67, 0x6A, 0x70, 0x02, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x68, 0x00, 0x04, 0xC0, 0xA8, 0x00, 0x30, 0x66, 0x5A, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 
-    0x2F, 0x28, 0x00, 0x04, 0x48, 0x6A, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x2D, 0x46, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xCC, 0xCA, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x20, 0x04, 
-    0xB7, 0x80, 0x2F, 0x00, 0x48, 0x78, 0x01, 0x00, 0x48, 0x6E, 0xFE, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE7, 0x08, 0x48, 0x6E, 0xFE, 0xFC, 0x48, 0x79, 0x00, 0x00, 0x30, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCC, 0x9C, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x70, 0x02, 0x81, 0xA8, 0x00, 0x30, 
-    0x4F, 0xEF, 0x00, 0x28, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x12, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0x10, 0x90, 0x00, 0x67, 0x08, 0x02, 0x83, 0x0F, 0x10, 0x90, 0x00, 0x60, 0x06, 
-    0x02, 0x83, 0x00, 0x00, 0x22, 0x00, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x12, 
-    0x20, 0x04, 0x02, 0x80, 0x00, 0x10, 0x90, 0x00, 0x67, 0x08, 0x02, 0x84, 0x0F, 0x10, 0x90, 0x00, 
-    0x60, 0x06, 0x02, 0x84, 0x00, 0x00, 0x22, 0x00, 0xB6, 0x84, 0x67, 0x44, 0x2F, 0x03, 0x48, 0x79, 
-    0x00, 0x00, 0x2D, 0x42, 0x48, 0x6E, 0xFE, 0xFC, 0x61, 0xFF, 0x00, 0x00, 0xCB, 0x4E, 0x41, 0xEE, 
-    0xFE, 0xFC, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x28, 0x00, 0x20, 0x3C, 0x00, 0x00, 
-    0x01, 0x00, 0x90, 0x84, 0x2F, 0x00, 0x2F, 0x0B, 0x41, 0xEE, 0xFE, 0xFC, 0x48, 0x70, 0x48, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC9, 0xDA, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0xFD, 0xBC, 
-    0x25, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x1C, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x7A, 0x0A, 0x78, 0x00, 0x0C, 0x12, 
-    0x00, 0x26, 0x67, 0x16, 0x0C, 0x12, 0x00, 0x30, 0x66, 0x62, 0x0C, 0x2A, 0x00, 0x78, 0x00, 0x01, 
-    0x67, 0x08, 0x0C, 0x2A, 0x00, 0x58, 0x00, 0x01, 0x66, 0x52, 0x7A, 0x10, 0x0C, 0x12, 0x00, 0x26, 
-    0x66, 0x04, 0x52, 0x8A, 0x60, 0x46, 0x54, 0x8A, 0x60, 0x42, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x38, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x67, 0x0C, 0x4C, 0x05, 0x48, 0x00, 0xD8, 0x83, 0x72, 0xD0, 
-    0xD8, 0x81, 0x60, 0x28, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x38, 0x00, 0x49, 0xC0, 0x26, 0x00, 
-    0x70, 0x10, 0xBA, 0x80, 0x66, 0x1C, 0x70, 0x61, 0xB6, 0x80, 0x6D, 0x16, 0x70, 0x66, 0xB6, 0x80, 
-    0x6E, 0x10, 0x4C, 0x05, 0x48, 0x00, 0xD8, 0x83, 0x72, 0xA9, 0xD8, 0x81, 0x16, 0x1A, 0x49, 0xC3, 
-    0x66, 0xB8, 0x70, 0x6B, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x6D, 0xB6, 0x80, 0x66, 0x12, 0x70, 0x0A, 
-    0xE1, 0xAC, 0x70, 0x6D, 0xB6, 0x80, 0x66, 0x04, 0x70, 0x0A, 0xE1, 0xAC, 0x16, 0x12, 0x49, 0xC3, 
-    0x4A, 0x83, 0x67, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xCB, 0x40, 0x58, 0x4F, 
-    0x20, 0x04, 0x4C, 0xDF, 0x04, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x00, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x20, 0x4A, 
-    0x58, 0x88, 0x24, 0x88, 0x42, 0xAA, 0x00, 0x38, 0x42, 0xAA, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x54, 
-    0x42, 0xAA, 0x00, 0x50, 0x42, 0xAA, 0x00, 0x3C, 0x42, 0xAA, 0x00, 0x08, 0x42, 0xAA, 0x00, 0x24, 
-    0x42, 0xAA, 0x00, 0x28, 0x70, 0xFF, 0x25, 0x40, 0x00, 0x44, 0x42, 0xAA, 0x00, 0x6C, 0x42, 0xAA, 
-    0x00, 0x68, 0x42, 0xAA, 0x00, 0x70, 0x48, 0x79, 0x00, 0x00, 0x26, 0x6A, 0x48, 0x78, 0x02, 0x00, 
-    0x48, 0x6A, 0x00, 0x5C, 0x61, 0xFF, 0xFF, 0xFF, 0xC9, 0x00, 0x10, 0x2D, 0xEE, 0x0C, 0x49, 0xC0, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x53, 0x80, 0x67, 0x08, 0x53, 0x80, 0x67, 0x5A, 0x60, 0x00, 0x00, 0x80, 
-    0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x4C, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0xD0, 0xAE, 0xFF, 0xFC, 0x54, 0x80, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x74, 0x25, 0x48, 0x00, 0x58, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x2D, 0x3A, 0x20, 0x6A, 0x00, 0x58, 0x22, 0x4C, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x00, 
-    0x61, 0xFF, 0x00, 0x00, 0xE5, 0x1C, 0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xE5, 0x12, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x4E, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x30, 0x25, 0x48, 0x00, 0x58, 0x20, 0x6A, 
-    0x00, 0x58, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x58, 0x4F, 0x60, 0x26, 0x20, 0x4C, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCE, 0x08, 0x25, 0x48, 0x00, 0x58, 0x20, 0x6A, 0x00, 0x58, 0x22, 0x4C, 0x20, 0x08, 0x10, 0xD9, 
-    0x66, 0xFC, 0x58, 0x4F, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1C, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x76, 0x00, 0x28, 0x03, 0x60, 0x02, 0x52, 0x83, 
-    0x4A, 0x34, 0x38, 0x00, 0x67, 0x08, 0x0C, 0x34, 0x00, 0x5F, 0x38, 0x00, 0x66, 0xF0, 0x41, 0xED, 
-    0xEE, 0xA4, 0x41, 0xE8, 0x00, 0x50, 0x2A, 0x08, 0x26, 0x6D, 0xEE, 0xF4, 0x60, 0x00, 0x00, 0x82, 
-    0x20, 0x53, 0x24, 0x68, 0x00, 0x58, 0x70, 0x01, 0x20, 0x53, 0xC0, 0xA8, 0x00, 0x70, 0x67, 0x66, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0C, 0x66, 0x46, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0xD5, 0xC0, 0x60, 0x02, 0x53, 0x8A, 0x20, 0x53, 0xB5, 0xE8, 0x00, 0x58, 0x67, 0x0A, 
-    0x10, 0x12, 0xB0, 0x39, 0x00, 0x00, 0x2D, 0x3A, 0x66, 0xEC, 0x2F, 0x03, 0x2F, 0x0C, 0x48, 0x6A, 
-    0x00, 0x01, 0x61, 0xFF, 0x00, 0x00, 0xE4, 0xAE, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x26, 
-    0x20, 0x53, 0x22, 0x4A, 0x52, 0x89, 0x93, 0xE8, 0x00, 0x58, 0x28, 0x09, 0x60, 0x28, 0x2F, 0x03, 
-    0x2F, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xE4, 0x8C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x04, 0x78, 0x00, 0x60, 0x10, 0x20, 0x4B, 0x58, 0x88, 0x2A, 0x08, 0x26, 0x6B, 0x00, 0x04, 
-    0x20, 0x0B, 0x66, 0x00, 0xFF, 0x7C, 0x20, 0x0B, 0x66, 0x1E, 0x48, 0x78, 0x00, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xCD, 0x26, 0x22, 0x45, 0x22, 0x88, 0x26, 0x48, 0x42, 0xAB, 0x00, 0x04, 0x70, 0xFF, 
-    0x27, 0x40, 0x00, 0x08, 0x42, 0x93, 0x58, 0x4F, 0x26, 0x0B, 0x24, 0x53, 0x60, 0x32, 0x20, 0x6A, 
-    0x00, 0x58, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0xB0, 0x84, 0x63, 0x16, 0x2F, 0x0C, 
-    0x20, 0x6A, 0x00, 0x58, 0x48, 0x70, 0x48, 0x00, 0x61, 0xFF, 0x00, 0x00, 0xE3, 0xFE, 0x4A, 0x80, 
-    0x50, 0x4F, 0x67, 0x10, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x54, 0x26, 0x08, 0x24, 0x6A, 0x00, 0x54, 
-    0x20, 0x0A, 0x66, 0xCA, 0x20, 0x0A, 0x66, 0x2E, 0x48, 0x78, 0x00, 0x74, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xCC, 0xC8, 0x22, 0x43, 0x22, 0x88, 0x24, 0x48, 0x2F, 0x0C, 0x2F, 0x2D, 0xED, 0xC4, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xA8, 0x52, 0xAD, 0xED, 0x18, 0x25, 0x4B, 0x00, 0x4C, 0x52, 0xAB, 
-    0x00, 0x08, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x4A, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 
-    0x76, 0x00, 0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x2E, 0x4A, 0x92, 0x67, 0x26, 0x2F, 0x0B, 0x20, 0x52, 
-    0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xC6, 0x26, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x12, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x06, 0x76, 0x01, 0x25, 0x4C, 
-    0x00, 0x10, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0xCE, 0x4A, 0x83, 0x66, 0x10, 0x2F, 0x0B, 
-    0x48, 0x79, 0x00, 0x00, 0x2D, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xC8, 0x62, 0x50, 0x4F, 0x4C, 0xDF, 
-    0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x2A, 0x2E, 
-    0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x76, 0x00, 0x24, 0x6D, 0xEE, 0x8C, 
-    0x60, 0x34, 0x4A, 0x92, 0x67, 0x2C, 0x2F, 0x04, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xC5, 0xBC, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x18, 0x2F, 0x0C, 0x48, 0x6A, 0x00, 0x44, 
-    0x61, 0xFF, 0x00, 0x00, 0xE3, 0x06, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x76, 0x01, 0x25, 0x45, 
-    0x00, 0x10, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0xC8, 0x4A, 0x83, 0x66, 0x48, 0x24, 0x6D, 
-    0xEF, 0x3C, 0x60, 0x3E, 0x26, 0x6A, 0x00, 0x04, 0x2F, 0x0C, 0x48, 0x6A, 0x00, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xC5, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x26, 0x24, 0x6B, 0x00, 0x10, 0x20, 0x0A, 
-    0x67, 0x1E, 0x4A, 0x92, 0x67, 0x1A, 0x2F, 0x04, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xC5, 0x5C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x76, 0x01, 0x25, 0x45, 0x00, 0x10, 
-    0x24, 0x53, 0x20, 0x0A, 0x66, 0xBE, 0x4A, 0x83, 0x66, 0x14, 0x2F, 0x0C, 0x2F, 0x04, 0x48, 0x79, 
-    0x00, 0x00, 0x2C, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0xC7, 0xA4, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 
-    0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x28, 0x6E, 
-    0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x10, 0x28, 0x2E, 0x00, 0x14, 0x76, 0x00, 
-    0x00, 0x84, 0x00, 0x00, 0x80, 0x00, 0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x2C, 0x4A, 0x92, 0x67, 0x24, 
-    0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x7D, 0xF0, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x10, 0x20, 0x2A, 0x00, 0x2C, 0xC0, 0x84, 0xBA, 0x80, 0x66, 0x06, 0x76, 0x01, 
-    0x25, 0x4C, 0x00, 0x10, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0xD0, 0x4A, 0x83, 0x66, 0x16, 
-    0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x2C, 0xD6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC7, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x45, 0xED, 0xF2, 0xA8, 0x99, 0xCC, 
-    0x60, 0x26, 0x2F, 0x0B, 0x2F, 0x2A, 0x00, 0x18, 0x61, 0xFF, 0x00, 0x00, 0xE1, 0xEE, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x10, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x2C, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC6, 0xEC, 0x50, 0x4F, 0x28, 0x4A, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xD6, 0x48, 0x78, 0x00, 0x1C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCA, 0xB4, 0x24, 0x48, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x26, 0x00, 0x20, 0x03, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xCA, 0x9A, 
-    0x25, 0x48, 0x00, 0x18, 0x20, 0x6A, 0x00, 0x18, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 
-    0x25, 0x6E, 0x00, 0x0C, 0x00, 0x0C, 0x25, 0x6E, 0x00, 0x10, 0x00, 0x10, 0x42, 0xAA, 0x00, 0x04, 
-    0x42, 0xAA, 0x00, 0x14, 0x28, 0x8A, 0x52, 0xAD, 0xEE, 0xA0, 0x20, 0x4A, 0x50, 0x4F, 0x4C, 0xDF, 
-    0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 
-    0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x14, 0x4A, 0x83, 0x67, 0x0E, 0x2F, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x5A, 0x26, 0x48, 0x58, 0x4F, 0x60, 0x54, 0x47, 0xED, 0xEE, 0xA4, 
-    0x47, 0xEB, 0x00, 0x50, 0x24, 0x6D, 0xEE, 0xF4, 0x60, 0x08, 0x26, 0x4A, 0x58, 0x8B, 0x24, 0x6A, 
-    0x00, 0x04, 0x20, 0x0A, 0x66, 0xF4, 0x48, 0x78, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xCA, 0x1A, 
-    0x26, 0x88, 0x24, 0x48, 0x42, 0xAA, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x08, 0x48, 0x78, 0x00, 0x74, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCA, 0x04, 0x24, 0x88, 0x26, 0x48, 0x2F, 0x04, 0x2F, 0x2D, 0xED, 0xC4, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xE6, 0x27, 0x4A, 0x00, 0x4C, 0x4F, 0xEF, 0x00, 0x14, 
-    0x27, 0x4C, 0x00, 0x6C, 0x27, 0x6E, 0x00, 0x10, 0x00, 0x24, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x0A, 
-    0x20, 0x6C, 0x00, 0x08, 0x21, 0x4B, 0x00, 0x68, 0x60, 0x04, 0x29, 0x4B, 0x00, 0x04, 0x29, 0x4B, 
-    0x00, 0x08, 0x4A, 0x83, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x27, 0x40, 0x00, 0x70, 
-    0x52, 0xAD, 0xEE, 0x9C, 0x20, 0x4B, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0x54, 0x48, 0xE7, 0x1F, 0x38, 0x95, 0xCA, 0x99, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x2C, 0xAA, 
-    0x2F, 0x2D, 0xED, 0xBC, 0x61, 0xFF, 0x00, 0x00, 0xBA, 0x90, 0x26, 0x48, 0x20, 0x08, 0x50, 0x4F, 
-    0x66, 0x12, 0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC5, 0x9C, 0x50, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 0xCB, 0x4A, 0x48, 0x78, 0x10, 0x00, 0x42, 0xA7, 
-    0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xCA, 0xD6, 0x58, 0x4F, 0x2F, 0x08, 0x2F, 0x0B, 
-    0x61, 0xFF, 0x00, 0x00, 0xC3, 0x8C, 0x7C, 0x01, 0x7E, 0x00, 0x76, 0x00, 0x42, 0xAE, 0xFF, 0x54, 
-    0x7A, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x0C, 0xB1, 0xEB, 0x00, 0x10, 0x65, 0x0C, 
-    0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xBD, 0x8C, 0x58, 0x4F, 0x60, 0x0C, 0x20, 0x6B, 0x00, 0x0C, 
-    0x52, 0xAB, 0x00, 0x0C, 0x70, 0x00, 0x10, 0x10, 0x28, 0x00, 0x70, 0xFF, 0xB8, 0x80, 0x66, 0x08, 
-    0x78, 0x0D, 0x70, 0x01, 0x2D, 0x40, 0xFF, 0x54, 0x70, 0x0D, 0xB8, 0x80, 0x66, 0x02, 0x52, 0x86, 
-    0x4A, 0x87, 0x67, 0x0A, 0x70, 0x0D, 0xB8, 0x80, 0x66, 0x00, 0x02, 0x80, 0x7E, 0x00, 0x70, 0x3B, 
-    0xB8, 0x80, 0x66, 0x06, 0x7E, 0x01, 0x60, 0x00, 0x02, 0x72, 0x70, 0x5C, 0xB8, 0x80, 0x66, 0x42, 
-    0x20, 0x6B, 0x00, 0x0C, 0xB1, 0xEB, 0x00, 0x10, 0x65, 0x0C, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 
-    0xBD, 0x32, 0x58, 0x4F, 0x60, 0x0C, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x70, 0x00, 
-    0x10, 0x10, 0x28, 0x00, 0x70, 0x0D, 0xB8, 0x80, 0x67, 0x16, 0x2F, 0x06, 0x2F, 0x2D, 0xED, 0xBC, 
-    0x48, 0x79, 0x00, 0x00, 0x2C, 0x8C, 0x61, 0xFF, 0xFF, 0xFF, 0xC4, 0xD2, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x78, 0x20, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x48, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x67, 0x06, 
-    0x0C, 0x03, 0x00, 0x08, 0x66, 0x10, 0x70, 0x28, 0xB8, 0x80, 0x66, 0x00, 0x00, 0xC0, 0x0C, 0x03, 
-    0x00, 0x01, 0x66, 0x00, 0x00, 0xB8, 0x0C, 0x03, 0x00, 0x01, 0x66, 0x58, 0x42, 0x12, 0x41, 0xEE, 
-    0xFF, 0xD8, 0x22, 0x4A, 0x93, 0xC8, 0x70, 0x0A, 0xB3, 0xC0, 0x6F, 0x1C, 0x48, 0x78, 0x00, 0x0A, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x2C, 0x4C, 0x61, 0xFF, 0xFF, 0xFF, 0xC4, 0x7E, 
-    0x42, 0x2E, 0xFF, 0xE2, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x6E, 0xFF, 0xD8, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFA, 0x5E, 0x28, 0x48, 0x70, 0x01, 0x81, 0xAC, 0x00, 0x70, 0x70, 0x28, 0xB8, 0x80, 0x58, 0x4F, 
-    0x66, 0x0E, 0x45, 0xEE, 0xFF, 0x58, 0x2A, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x76, 0x03, 0x60, 0x32, 
-    0x76, 0x04, 0x60, 0x2E, 0x0C, 0x03, 0x00, 0x05, 0x66, 0x28, 0x42, 0x12, 0x4A, 0x85, 0x6E, 0x12, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x34, 0x60, 0x61, 0xFF, 0xFF, 0xFF, 0xC4, 0x2E, 
-    0x50, 0x4F, 0x48, 0x6E, 0xFF, 0xD8, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x66, 0x76, 0x04, 
-    0x50, 0x4F, 0x70, 0x0D, 0xB8, 0x80, 0x66, 0x00, 0x01, 0x72, 0x0C, 0x03, 0x00, 0x07, 0x66, 0x16, 
-    0x2F, 0x06, 0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x2C, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC3, 0xFC, 0x4F, 0xEF, 0x00, 0x0C, 0x76, 0x00, 0x60, 0x00, 0x01, 0x50, 0x70, 0x28, 0xB8, 0x80, 
-    0x66, 0x48, 0x0C, 0x03, 0x00, 0x05, 0x66, 0x1E, 0x42, 0x12, 0x4A, 0x85, 0x6E, 0x12, 0x48, 0x6E, 
-    0xFF, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x34, 0x60, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0xD0, 0x50, 0x4F, 
-    0x76, 0x06, 0x60, 0x00, 0x01, 0x26, 0x0C, 0x03, 0x00, 0x01, 0x66, 0x08, 0x42, 0x12, 0x76, 0x03, 
-    0x60, 0x00, 0x01, 0x18, 0x2F, 0x06, 0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x2B, 0xEE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0xA8, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x29, 0xB8, 0x80, 0x66, 0x24, 
-    0x0C, 0x03, 0x00, 0x03, 0x66, 0x1E, 0x42, 0x12, 0x48, 0x79, 0x00, 0x00, 0x2B, 0xAE, 0x48, 0x6E, 
-    0xFF, 0x58, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x9A, 0x29, 0x40, 0x00, 0x24, 0x76, 0x04, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xD8, 0x70, 0x29, 0xB8, 0x80, 0x67, 0x14, 0x70, 0x2C, 0xB8, 0x80, 0x67, 0x0E, 
-    0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x48, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x67, 0x56, 0x0C, 0x03, 
-    0x00, 0x08, 0x66, 0x3A, 0x42, 0x12, 0x4A, 0x85, 0x6E, 0x12, 0x48, 0x6E, 0xFF, 0x58, 0x48, 0x79, 
-    0x00, 0x00, 0x34, 0x60, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x44, 0x50, 0x4F, 0x48, 0x6E, 0xFF, 0x58, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xDE, 0x76, 0x04, 0x70, 0x2C, 
-    0xB8, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 0x00, 0x82, 0x76, 0x07, 0x60, 0x7C, 0x2F, 0x06, 
-    0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x2B, 0x88, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x0E, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x48, 0x00, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0xC0, 0x67, 0x18, 0x2F, 0x04, 0x2F, 0x06, 0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 
-    0x2B, 0x5C, 0x61, 0xFF, 0xFF, 0xFF, 0xC2, 0xE6, 0x4F, 0xEF, 0x00, 0x10, 0x4A, 0x03, 0x66, 0x0A, 
-    0x45, 0xEE, 0xFF, 0xD8, 0x76, 0x01, 0x7A, 0x28, 0x60, 0x28, 0x0C, 0x03, 0x00, 0x04, 0x66, 0x0A, 
-    0x45, 0xEE, 0xFF, 0xD8, 0x76, 0x05, 0x7A, 0x28, 0x60, 0x18, 0x0C, 0x03, 0x00, 0x06, 0x67, 0x06, 
-    0x0C, 0x03, 0x00, 0x07, 0x66, 0x0C, 0x45, 0xEE, 0xFF, 0x58, 0x76, 0x08, 0x2A, 0x3C, 0x00, 0x00, 
-    0x00, 0x80, 0x53, 0x85, 0x4A, 0x85, 0x6F, 0x02, 0x14, 0xC4, 0x4A, 0xAE, 0xFF, 0x54, 0x67, 0x00, 
-    0xFD, 0x36, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xB9, 0xFC, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 
-    0x2F, 0x2D, 0xED, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x33, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 0xC2, 0x7E, 
-    0x50, 0x4F, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xB7, 0x90, 0x61, 0xFF, 0xFF, 0xFF, 0xC8, 0x46, 
-    0x58, 0x4F, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x1C, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x10, 0x28, 0x6E, 
-    0x00, 0x18, 0x78, 0x00, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xBA, 0x78, 0x26, 0x00, 0x70, 0x20, 
-    0xB6, 0x80, 0x58, 0x4F, 0x67, 0x0A, 0x70, 0x09, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x01, 0x4A, 0x80, 0x66, 0xDE, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x42, 0x70, 0x3B, 0xB6, 0x80, 
-    0x66, 0x1A, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xBA, 0x4A, 0x26, 0x00, 0x72, 0x0D, 0xB0, 0x81, 
-    0x58, 0x4F, 0x67, 0x2A, 0x70, 0xFF, 0xB6, 0x80, 0x66, 0xE8, 0x60, 0x22, 0x2F, 0x03, 0x4E, 0x94, 
-    0x4A, 0x80, 0x58, 0x4F, 0x66, 0x18, 0x20, 0x04, 0x52, 0x84, 0x17, 0x83, 0x08, 0x00, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0xBA, 0x1E, 0x26, 0x00, 0xB8, 0x85, 0x58, 0x4F, 0x6D, 0xB8, 0x42, 0x33, 
-    0x48, 0x00, 0x20, 0x6E, 0x00, 0x14, 0x20, 0x84, 0x20, 0x03, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x2F, 0x03, 0x26, 0x2F, 0x00, 0x08, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x20, 0x20, 0x6D, 
-    0xF7, 0xA4, 0x10, 0x30, 0x38, 0x00, 0x72, 0x32, 0xC0, 0x81, 0x4A, 0x80, 0x66, 0x0C, 0x70, 0x5F, 
-    0xB6, 0x80, 0x67, 0x06, 0x70, 0x2D, 0xB6, 0x80, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 
-    0x26, 0x1F, 0x4E, 0x75, 0x2F, 0x03, 0x26, 0x2F, 0x00, 0x08, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x1A, 
-    0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x38, 0x00, 0x72, 0x32, 0xC0, 0x81, 0x4A, 0x80, 0x66, 0x06, 
-    0x70, 0x26, 0xB6, 0x80, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x26, 0x1F, 0x4E, 0x75, 
-    0x2F, 0x03, 0x26, 0x2F, 0x00, 0x08, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x20, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x38, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x4A, 0x80, 0x66, 0x10, 0x70, 0x28, 0xB6, 0x80, 
-    0x67, 0x0A, 0x70, 0x7D, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x26, 0x1F, 
-    0x4E, 0x75, 0x2F, 0x03, 0x26, 0x2F, 0x00, 0x08, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x20, 0x20, 0x6D, 
-    0xF7, 0xA4, 0x10, 0x30, 0x38, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x4A, 0x80, 0x66, 0x10, 0x70, 0x29, 
-    0xB6, 0x80, 0x67, 0x0A, 0x70, 0x2C, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 
-    0x26, 0x1F, 0x4E, 0x75, 0x4E, 0x56, 0xFB, 0x2C, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x08, 
-    0x42, 0xAE, 0xFB, 0x44, 0x7E, 0x00, 0x42, 0xAE, 0xFB, 0x48, 0x7A, 0x01, 0x48, 0x79, 0x00, 0x00, 
-    0x2C, 0xAA, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xB5, 0xC0, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 
-    0x66, 0x10, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 0xC0, 0xCE, 
-    0x50, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 0xC6, 0x7C, 0x48, 0x78, 0x10, 0x00, 0x42, 0xA7, 0x48, 0x78, 
-    0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC6, 0x08, 0x58, 0x4F, 0x2F, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0xBE, 0xBE, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x79, 0x00, 0x00, 0x60, 0xC6, 0x48, 0x6E, 
-    0xFB, 0x30, 0x48, 0x78, 0x00, 0x1F, 0x48, 0x6E, 0xFB, 0x4C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0x2C, 0x26, 0x00, 0x70, 0xFF, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x00, 0x05, 0xCA, 
-    0x70, 0x0D, 0xB6, 0x80, 0x66, 0x04, 0x52, 0x85, 0x60, 0xCE, 0x70, 0x20, 0xB6, 0x80, 0x67, 0x1A, 
-    0x70, 0x09, 0xB6, 0x80, 0x67, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x2B, 0x24, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC0, 0x58, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x60, 0xF8, 
-    0x48, 0x6E, 0xFB, 0x6C, 0x48, 0x78, 0x00, 0x0F, 0x48, 0x6E, 0xFB, 0x70, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFD, 0xDA, 0x26, 0x00, 0x48, 0x79, 0x00, 0x00, 0x2B, 0x1A, 0x48, 0x6E, 0xFB, 0x4C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0xBA, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x1C, 0x66, 0x00, 0x00, 0xAE, 
-    0x48, 0x79, 0x00, 0x00, 0x2A, 0xFA, 0x48, 0x6E, 0xFB, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x22, 
-    0x2B, 0x40, 0xED, 0xD4, 0x70, 0x20, 0xB6, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x70, 0x09, 0xB6, 0x80, 
-    0x66, 0x22, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xB8, 0x2A, 0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 
-    0x58, 0x4F, 0x67, 0x0A, 0x70, 0x09, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 
-    0x4A, 0x80, 0x66, 0xDE, 0x70, 0x3B, 0xB6, 0x80, 0x66, 0x18, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0xB8, 0x02, 0x26, 0x00, 0x72, 0x0D, 0xB0, 0x81, 0x58, 0x4F, 0x67, 0x06, 0x70, 0xFF, 0xB6, 0x80, 
-    0x66, 0xE8, 0x70, 0x0D, 0xB6, 0x80, 0x67, 0x1A, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x14, 0x2F, 0x05, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x2A, 0xC4, 0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0xA0, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4A, 0xAE, 0xFB, 0x48, 0x67, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x2A, 0x86, 0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x86, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x01, 0x2D, 0x40, 
-    0xFB, 0x48, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x03, 0x60, 0x00, 0xFE, 0xCE, 0x70, 0x0D, 0xB6, 0x80, 
-    0x67, 0x4E, 0x48, 0x79, 0x00, 0x00, 0x60, 0xF8, 0x48, 0x6E, 0xFB, 0x44, 0x48, 0x78, 0x00, 0x0F, 
-    0x48, 0x6E, 0xFB, 0x34, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xF2, 0x26, 0x00, 0x70, 0x20, 
-    0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x06, 0x70, 0x09, 0xB6, 0x80, 0x66, 0x22, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0xB7, 0x6E, 0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 0x58, 0x4F, 0x67, 0x0A, 
-    0x70, 0x09, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4A, 0x80, 0x66, 0xDE, 
-    0x48, 0x79, 0x00, 0x00, 0x35, 0x86, 0x48, 0x6E, 0xFB, 0x4C, 0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0xA0, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x5A, 0x70, 0x3B, 0xB6, 0x80, 0x66, 0x18, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0xB7, 0x30, 0x26, 0x00, 0x72, 0x0D, 0xB0, 0x81, 0x58, 0x4F, 0x67, 0x06, 0x70, 0xFF, 
-    0xB6, 0x80, 0x66, 0xE8, 0x70, 0x0D, 0xB6, 0x80, 0x67, 0x1A, 0x70, 0xFF, 0xB6, 0x80, 0x67, 0x14, 
-    0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x2A, 0x55, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0xCE, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x87, 0x67, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x2A, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0xB6, 0x4F, 0xEF, 0x00, 0x0C, 0x7E, 0x01, 0x60, 0x1C, 
-    0x70, 0x7B, 0xB6, 0x80, 0x67, 0x16, 0x2F, 0x03, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x29, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x96, 0x4F, 0xEF, 0x00, 0x10, 0x4A, 0xAE, 0xFB, 0x44, 
-    0x6F, 0x16, 0x48, 0x79, 0x00, 0x00, 0x29, 0xC0, 0x48, 0x6E, 0xFB, 0x34, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF2, 0x90, 0x26, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x76, 0x00, 0x4A, 0xAE, 0xFB, 0x6C, 0x66, 0x14, 
-    0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x29, 0x8C, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x5E, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x29, 0x71, 0x48, 0x6E, 0xFB, 0x70, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF2, 0x5E, 0x28, 0x00, 0x70, 0x01, 0xBE, 0x80, 0x50, 0x4F, 0x66, 0x0E, 0x2B, 0x44, 
-    0xF2, 0xB4, 0x2B, 0x43, 0xF2, 0xB8, 0x7E, 0x02, 0x60, 0x00, 0xFD, 0x8E, 0x2F, 0x03, 0x2F, 0x04, 
-    0x48, 0x6E, 0xFB, 0x4C, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x08, 0x2C, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x48, 0x79, 0x00, 0x00, 0x60, 0xC6, 0x48, 0x6E, 0xFB, 0x80, 0x48, 0x78, 0x00, 0x1F, 0x48, 0x6E, 
-    0xFB, 0x84, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xA4, 0x26, 0x00, 0x70, 0x0D, 0xB6, 0x80, 
-    0x4F, 0xEF, 0x00, 0x14, 0x66, 0x04, 0x52, 0x85, 0x60, 0xD6, 0x4A, 0xAE, 0xFB, 0x80, 0x66, 0x08, 
-    0x70, 0x7D, 0xB6, 0x80, 0x67, 0x00, 0xFD, 0x42, 0x70, 0x20, 0xB6, 0x80, 0x67, 0x1A, 0x70, 0x09, 
-    0xB6, 0x80, 0x67, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x29, 0x32, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xBD, 0xCA, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x60, 0xF8, 0x48, 0x6E, 
-    0xFB, 0x6C, 0x48, 0x78, 0x00, 0x0F, 0x48, 0x6E, 0xFB, 0x70, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFB, 0x4C, 0x26, 0x00, 0x4A, 0xAE, 0xFB, 0x6C, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x14, 0x2F, 0x05, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x28, 0xFA, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0x90, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x70, 0x20, 0xB6, 0x80, 0x67, 0x1A, 0x70, 0x09, 0xB6, 0x80, 0x67, 0x14, 0x2F, 0x05, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x29, 0x32, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0x70, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x60, 0xC6, 0x48, 0x6E, 0xFB, 0xA8, 0x48, 0x78, 0x04, 0x00, 
-    0x48, 0x6E, 0xFB, 0xFE, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xF2, 0x26, 0x00, 0x70, 0x20, 
-    0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x06, 0x70, 0x09, 0xB6, 0x80, 0x66, 0x22, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0xB5, 0x6E, 0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 0x58, 0x4F, 0x67, 0x0A, 
-    0x70, 0x09, 0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4A, 0x80, 0x66, 0xDE, 
-    0x70, 0x7B, 0xB6, 0x80, 0x67, 0x16, 0x2F, 0x03, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x29, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0x06, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x79, 0x00, 0x00, 
-    0x2A, 0xFA, 0x48, 0x6E, 0xFB, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0x06, 0x28, 0x00, 0x76, 0x00, 
-    0x4A, 0xAE, 0xFB, 0xA8, 0x50, 0x4F, 0x6F, 0x52, 0x48, 0x79, 0x00, 0x00, 0x28, 0xF2, 0x48, 0x6E, 
-    0xFB, 0xFE, 0x61, 0xFF, 0xFF, 0xFF, 0xBA, 0x68, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x28, 0x70, 0x0A, 
-    0xB0, 0xAE, 0xFB, 0x80, 0x6C, 0x1C, 0x48, 0x78, 0x00, 0x0A, 0x48, 0x6E, 0xFB, 0x84, 0x48, 0x79, 
-    0x00, 0x00, 0x2C, 0x4C, 0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0xB4, 0x42, 0x2E, 0xFB, 0x8E, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x76, 0x01, 0x60, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x28, 0xC7, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0x98, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x03, 0x2F, 0x04, 0x48, 0x6E, 
-    0xFB, 0x84, 0x2F, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x28, 0x48, 0x4F, 0xEF, 0x00, 0x10, 
-    0x48, 0x79, 0x00, 0x00, 0x61, 0x24, 0x48, 0x6E, 0xFB, 0xA4, 0x48, 0x78, 0x00, 0x50, 0x48, 0x6E, 
-    0xFB, 0xAC, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x04, 0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 
-    0x4F, 0xEF, 0x00, 0x14, 0x67, 0x06, 0x70, 0x09, 0xB6, 0x80, 0x66, 0x22, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0xB4, 0x80, 0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 0x58, 0x4F, 0x67, 0x0A, 0x70, 0x09, 
-    0xB6, 0x80, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4A, 0x80, 0x66, 0xDE, 0x4A, 0xAE, 
-    0xFB, 0xA4, 0x66, 0x22, 0x70, 0x0D, 0xB6, 0x80, 0x67, 0xA6, 0x70, 0x7D, 0xB6, 0x80, 0x67, 0x00, 
-    0xFE, 0x00, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x28, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xBC, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x28, 0xB6, 0x80, 0x67, 0x26, 0x48, 0x6E, 0xFB, 0xAC, 
-    0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x3C, 0x70, 0x0D, 0xB6, 0x80, 0x50, 0x4F, 0x67, 0x00, 
-    0xFF, 0x70, 0x2F, 0x0A, 0x2F, 0x03, 0x61, 0xFF, 0x00, 0x00, 0xBB, 0x3E, 0x50, 0x4F, 0x60, 0x00, 
-    0xFF, 0x60, 0x48, 0x79, 0x00, 0x00, 0x61, 0x56, 0x48, 0x6E, 0xFB, 0xA8, 0x48, 0x78, 0x04, 0x00, 
-    0x48, 0x6E, 0xFB, 0xFE, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x62, 0x26, 0x00, 0x4A, 0xAE, 
-    0xFB, 0xA8, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x28, 0x68, 0x61, 0xFF, 0xFF, 0xFF, 0xBB, 0xA6, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x20, 0xB6, 0x80, 
-    0x67, 0x06, 0x70, 0x09, 0xB6, 0x80, 0x66, 0x22, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xB3, 0xC4, 
-    0x26, 0x00, 0x70, 0x20, 0xB6, 0x80, 0x58, 0x4F, 0x67, 0x0A, 0x70, 0x09, 0xB6, 0x80, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4A, 0x80, 0x66, 0xDE, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFA, 0x34, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x14, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x28, 0x68, 0x61, 0xFF, 0xFF, 0xFF, 0xBB, 0x56, 0x4F, 0xEF, 0x00, 0x0C, 0x0C, 0x2E, 0x00, 0x2B, 
-    0xFB, 0xFE, 0x66, 0x74, 0x78, 0x00, 0x60, 0x02, 0x52, 0x84, 0x70, 0x03, 0xB8, 0x80, 0x64, 0x1E, 
-    0x70, 0x0C, 0x4C, 0x04, 0x08, 0x00, 0x41, 0xED, 0xF4, 0x3A, 0x2F, 0x30, 0x08, 0x08, 0x48, 0x6E, 
-    0xFB, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 0xB8, 0xB8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0xDA, 0x70, 0x03, 
-    0xB8, 0x80, 0x65, 0x18, 0x48, 0x6E, 0xFB, 0xFF, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 
-    0x28, 0x3C, 0x61, 0xFF, 0xFF, 0xFF, 0xBB, 0x06, 0x4F, 0xEF, 0x00, 0x10, 0x70, 0x0C, 0x4C, 0x04, 
-    0x08, 0x00, 0x41, 0xED, 0xF4, 0x3A, 0xD1, 0xC0, 0x2D, 0x48, 0xFB, 0x2C, 0x2F, 0x28, 0x00, 0x08, 
-    0x2F, 0x10, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x6E, 0xFB, 0xAC, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF3, 0x48, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x14, 0x48, 0x6E, 0xFB, 0xFE, 0x48, 0x6E, 0xFB, 0xAC, 
-    0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0x72, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x29, 0xB6, 0x80, 
-    0x66, 0x00, 0xFE, 0xE0, 0x60, 0x00, 0xFE, 0x3A, 0x4A, 0x87, 0x66, 0x0E, 0x48, 0x79, 0x00, 0x00, 
-    0x28, 0x13, 0x61, 0xFF, 0xFF, 0xFF, 0xBA, 0xA6, 0x58, 0x4F, 0x4A, 0xAE, 0xFB, 0x48, 0x66, 0x0E, 
-    0x48, 0x79, 0x00, 0x00, 0x27, 0xEA, 0x61, 0xFF, 0xFF, 0xFF, 0xBA, 0x92, 0x58, 0x4F, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0xAF, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xC0, 0x5A, 0x58, 0x4F, 0x4C, 0xDF, 
-    0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x2F, 0x04, 0x24, 0x2F, 0x00, 0x08, 0x02, 0x82, 0x00, 0x00, 
-    0x0F, 0xFF, 0x28, 0x02, 0xE0, 0x8C, 0xD8, 0x84, 0x02, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x4A, 0x84, 
-    0x67, 0x10, 0x70, 0x20, 0x90, 0x84, 0x22, 0x02, 0xE1, 0xA9, 0x20, 0x02, 0xE8, 0xA8, 0x80, 0x81, 
-    0x24, 0x00, 0x20, 0x02, 0x28, 0x1F, 0x4E, 0x75, 0x48, 0xE7, 0x0C, 0x00, 0x2A, 0x2F, 0x00, 0x0C, 
-    0x28, 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x18, 0x60, 0x04, 0x55, 0x82, 0xE4, 0x8C, 0x4A, 0x82, 
-    0x6F, 0x06, 0x20, 0x04, 0xC0, 0x85, 0x67, 0xF2, 0x20, 0x05, 0xE4, 0xA8, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0xFF, 0x72, 0x20, 0x92, 0x82, 0xEF, 0x89, 0x02, 0x81, 0x00, 0x00, 0x0F, 0x00, 0x82, 0x80, 
-    0x20, 0x01, 0x4C, 0xDF, 0x00, 0x30, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 
-    0x24, 0x6E, 0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x70, 0xFC, 0x26, 0x04, 0x56, 0x83, 0xC6, 0x80, 
-    0x4A, 0xAD, 0xE9, 0x7A, 0x67, 0x18, 0x20, 0x2D, 0xE9, 0x76, 0xD0, 0x83, 0xB0, 0xAD, 0xF4, 0x5E, 
-    0x63, 0x46, 0x60, 0x0A, 0x20, 0x2D, 0xF4, 0x5E, 0xD0, 0x80, 0x2B, 0x40, 0xF4, 0x5E, 0x20, 0x2D, 
-    0xE9, 0x76, 0xD0, 0x83, 0xB0, 0xAD, 0xF4, 0x5E, 0x62, 0xEA, 0x2F, 0x2D, 0xF4, 0x5E, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xBD, 0x96, 0x26, 0x48, 0x4A, 0xAD, 0xE9, 0x7A, 0x58, 0x4F, 0x67, 0x16, 0x20, 0x4B, 
-    0x22, 0x6D, 0xE9, 0x7A, 0x22, 0x2D, 0xE9, 0x76, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x2B, 0x4B, 0xE9, 0x7A, 0x20, 0x6D, 0xE9, 0x7A, 0x20, 0x2D, 0xE9, 0x76, 
-    0x41, 0xF0, 0x08, 0x00, 0x22, 0x4A, 0x22, 0x04, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x24, 0x40, 0x60, 0x08, 0x20, 0x04, 0x52, 0x84, 0x42, 0x32, 0x08, 0x00, 
-    0xB8, 0x83, 0x65, 0xF4, 0xD7, 0xAD, 0xE9, 0x76, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x28, 0x2D, 0xED, 0x30, 0x20, 0x04, 0xE5, 0x88, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0x22, 0x28, 0x48, 0x2B, 0x48, 0xE9, 0x6E, 0x26, 0x6D, 
-    0xEF, 0x3C, 0x58, 0x4F, 0x60, 0x2C, 0x24, 0x6B, 0x00, 0x04, 0x20, 0x2A, 0x00, 0x14, 0x02, 0x80, 
-    0x02, 0x00, 0x00, 0x00, 0x67, 0x1A, 0x26, 0x2A, 0x00, 0x04, 0x4A, 0x83, 0x6D, 0x12, 0x08, 0x2A, 
-    0x00, 0x03, 0x00, 0x14, 0x66, 0x04, 0x70, 0x08, 0x60, 0x02, 0x70, 0x10, 0x29, 0x80, 0x3C, 0x00, 
-    0x26, 0x52, 0x20, 0x0B, 0x66, 0xD0, 0x7A, 0x00, 0x76, 0x00, 0x60, 0x06, 0xDA, 0xB4, 0x3C, 0x00, 
-    0x52, 0x83, 0xB6, 0x84, 0x6D, 0xF6, 0x26, 0x04, 0xD6, 0xAD, 0xED, 0x2C, 0xE7, 0x8B, 0xBA, 0x83, 
-    0x67, 0x14, 0x2F, 0x03, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x27, 0xBA, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB8, 0xDC, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x1F, 0x38, 0x70, 0x0C, 0x2B, 0x40, 0xE9, 0x72, 0x2A, 0x2D, 0xED, 0x30, 
-    0x76, 0x0C, 0x4C, 0x05, 0x30, 0x00, 0x28, 0x05, 0xE7, 0x8C, 0x2E, 0x05, 0xDE, 0xAD, 0xED, 0x2C, 
-    0xE7, 0x8F, 0x72, 0x10, 0xDE, 0x81, 0xDE, 0xAD, 0xE9, 0x76, 0x2C, 0x05, 0x54, 0x86, 0xE7, 0x8E, 
-    0x4A, 0x2D, 0xED, 0xFD, 0x67, 0x04, 0x50, 0x86, 0x50, 0x87, 0x45, 0xF9, 0x00, 0x00, 0x30, 0x30, 
-    0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x72, 0x28, 0xD0, 0x81, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0x54, 0x28, 0x48, 0x41, 0xEC, 0x00, 0x24, 0x22, 0x4A, 0x20, 0x08, 
-    0x10, 0xD9, 0x66, 0xFC, 0x20, 0x03, 0xD0, 0x84, 0xD0, 0x87, 0xD0, 0x86, 0x29, 0x40, 0x00, 0x0C, 
-    0x2F, 0x2C, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0x30, 0x29, 0x48, 0x00, 0x14, 0x24, 0x48, 
-    0x48, 0x78, 0x00, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0xBC, 0x20, 0x26, 0x48, 0x20, 0x4C, 0x41, 0xE8, 
-    0x00, 0x24, 0x27, 0x48, 0x00, 0x04, 0x27, 0x4C, 0x00, 0x08, 0x27, 0x6C, 0x00, 0x0C, 0x00, 0x18, 
-    0x70, 0x02, 0x27, 0x40, 0x00, 0x24, 0x48, 0x78, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xBB, 0xFA, 
-    0x27, 0x48, 0x00, 0x28, 0x42, 0xA7, 0x2F, 0x3C, 0x00, 0x02, 0x22, 0x02, 0x20, 0x04, 0xE6, 0x88, 
-    0x2F, 0x00, 0x2F, 0x03, 0x2F, 0x03, 0x42, 0xA7, 0x2F, 0x0B, 0x2F, 0x2D, 0xF2, 0xE6, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xD2, 0xF8, 0x28, 0x48, 0x2B, 0x48, 0xEC, 0xEC, 0x20, 0x6B, 0x00, 0x28, 0x20, 0x8C, 
-    0xD6, 0x84, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x3C, 0x09, 0x10, 0x20, 0x02, 0x20, 0x06, 0xE6, 0x88, 
-    0x2F, 0x00, 0x20, 0x03, 0xD0, 0x87, 0x2F, 0x00, 0x2F, 0x07, 0x2F, 0x03, 0x2F, 0x0B, 0x2F, 0x2D, 
-    0xF2, 0xEA, 0x61, 0xFF, 0xFF, 0xFF, 0xD2, 0xC4, 0x28, 0x48, 0x2B, 0x48, 0xEC, 0xE8, 0x20, 0x6B, 
-    0x00, 0x28, 0x21, 0x4C, 0x00, 0x04, 0x70, 0x03, 0x27, 0x40, 0x00, 0x1C, 0x48, 0x78, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBB, 0x84, 0x27, 0x48, 0x00, 0x20, 0x20, 0x6B, 0x00, 0x20, 0x20, 0xAD, 
-    0xED, 0x08, 0x20, 0x6B, 0x00, 0x20, 0x21, 0x6D, 0xED, 0x04, 0x00, 0x04, 0x20, 0x6B, 0x00, 0x20, 
-    0x21, 0x6D, 0xEC, 0xF8, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x28, 0x78, 0x00, 0x76, 0x00, 
-    0x4F, 0xEF, 0x00, 0x54, 0x60, 0x60, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x2E, 0x2C, 0x00, 
-    0x20, 0x06, 0x06, 0x80, 0xE2, 0x89, 0xC0, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0xF8, 
-    0x24, 0xC0, 0x2F, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x22, 0x04, 0x92, 0x80, 0x58, 0x4F, 
-    0x2F, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x04, 0x06, 0x80, 0xE2, 0x8C, 0xC0, 0x00, 0x58, 0x4F, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0xD0, 0x24, 0xC0, 0x2F, 0x3C, 0xE8, 0x9C, 0x90, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0xC2, 0x24, 0xC0, 0x20, 0x6D, 0xE9, 0x6E, 0xD8, 0xB0, 0x3C, 0x00, 
-    0x52, 0x83, 0x4F, 0xEF, 0x00, 0x10, 0xB6, 0x85, 0x65, 0x9C, 0x26, 0x4A, 0x76, 0x00, 0x60, 0x26, 
-    0x70, 0x0C, 0x4C, 0x03, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x9A, 0x26, 0x80, 
-    0x2F, 0x3C, 0x93, 0x00, 0x00, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x8C, 0x27, 0x40, 0x00, 0x04, 
-    0x50, 0x8B, 0x52, 0x83, 0x50, 0x4F, 0xB6, 0x85, 0x65, 0xD6, 0x24, 0x4B, 0x26, 0x4A, 0xD7, 0xC7, 
-    0x2E, 0x05, 0xDE, 0xAD, 0xED, 0x2C, 0xE7, 0x8F, 0x78, 0x00, 0x76, 0x00, 0x60, 0x68, 0x20, 0x6D, 
-    0xE9, 0x6E, 0x70, 0x10, 0xB0, 0xB0, 0x3C, 0x00, 0x66, 0x20, 0x2F, 0x3C, 0xE2, 0x8F, 0xC0, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x52, 0x24, 0xC0, 0x2F, 0x3C, 0xE8, 0x9C, 0x90, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xB2, 0x44, 0x24, 0xC0, 0x50, 0x84, 0x50, 0x4F, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB2, 0x36, 0x24, 0xC0, 0x2F, 0x07, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x2C, 0x24, 0xC0, 0x20, 0x04, 
-    0x58, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x1E, 0x26, 0x80, 0x2F, 0x3C, 0x82, 0x00, 
-    0x00, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xB2, 0x10, 0x27, 0x40, 0x00, 0x04, 0x50, 0x8B, 0x50, 0x84, 
-    0x52, 0x83, 0x4F, 0xEF, 0x00, 0x10, 0xB6, 0x85, 0x65, 0x94, 0x2F, 0x3C, 0xE9, 0x2D, 0x40, 0x7F, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0xF2, 0x24, 0xC0, 0x2F, 0x3C, 0xE5, 0x1F, 0x00, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xB1, 0xE4, 0x24, 0xC0, 0x20, 0x07, 0xE4, 0x88, 0x72, 0xFC, 0x92, 0x80, 0x02, 0x81, 
-    0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x81, 0xEA, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB1, 0xC6, 0x24, 0xC0, 0x42, 0x9A, 0x4A, 0x2D, 0xED, 0xFD, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x18, 
-    0x20, 0x6D, 0xEC, 0xF0, 0x20, 0x68, 0x00, 0x04, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB1, 0xA6, 0x24, 0xC0, 0x42, 0x9A, 0x58, 0x4F, 0x76, 0x00, 0x60, 0x0A, 0x20, 0x6D, 0xE9, 0x7A, 
-    0x24, 0xF0, 0x3C, 0x00, 0x52, 0x83, 0x20, 0x2D, 0xE9, 0x76, 0xE4, 0x88, 0xB6, 0x80, 0x65, 0xEC, 
-    0x20, 0x07, 0x50, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x7C, 0x26, 0x80, 0x2F, 0x3C, 
-    0x8F, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x6E, 0x27, 0x40, 0x00, 0x04, 0x50, 0x8B, 
-    0x70, 0x0C, 0xD0, 0x87, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x5C, 0x26, 0x80, 0x2F, 0x3C, 
-    0x8A, 0x00, 0x00, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x4E, 0x27, 0x40, 0x00, 0x04, 0x4A, 0x2D, 
-    0xED, 0xFD, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x22, 0x50, 0x8B, 0x70, 0x14, 0xD0, 0x87, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x32, 0x26, 0x80, 0x2F, 0x3C, 0x8A, 0x00, 0x00, 0x02, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xB1, 0x24, 0x27, 0x40, 0x00, 0x04, 0x50, 0x4F, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x70, 0x10, 0x2B, 0x40, 0xE9, 0x72, 
-    0x28, 0x2D, 0xED, 0x30, 0x26, 0x04, 0xE9, 0x8B, 0x72, 0x10, 0xD6, 0x81, 0xD6, 0xAD, 0xE9, 0x76, 
-    0x2A, 0x04, 0x54, 0x85, 0xE7, 0x8D, 0x4A, 0x2D, 0xED, 0xFD, 0x67, 0x04, 0x50, 0x85, 0x50, 0x83, 
-    0x45, 0xF9, 0x00, 0x00, 0x30, 0x30, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x72, 0x28, 0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB9, 0x0E, 0x28, 0x48, 0x41, 0xEC, 
-    0x00, 0x24, 0x22, 0x4A, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x03, 0xD0, 0x85, 0x29, 0x40, 
-    0x00, 0x0C, 0x2F, 0x2C, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xB8, 0xEE, 0x29, 0x48, 0x00, 0x14, 
-    0x24, 0x48, 0x48, 0x78, 0x00, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0xB8, 0xDE, 0x26, 0x48, 0x20, 0x4C, 
-    0x41, 0xE8, 0x00, 0x24, 0x27, 0x48, 0x00, 0x04, 0x27, 0x4C, 0x00, 0x08, 0x27, 0x6C, 0x00, 0x0C, 
-    0x00, 0x18, 0x70, 0x01, 0x27, 0x40, 0x00, 0x24, 0x48, 0x78, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB8, 0xB8, 0x27, 0x48, 0x00, 0x28, 0x42, 0xA7, 0x2F, 0x3C, 0x09, 0x10, 0x20, 0x02, 0x20, 0x05, 
-    0xE6, 0x88, 0x2F, 0x00, 0x2F, 0x03, 0x2F, 0x03, 0x42, 0xA7, 0x2F, 0x0B, 0x2F, 0x2D, 0xF2, 0xEA, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCF, 0xB6, 0x28, 0x48, 0x2B, 0x48, 0xEC, 0xE8, 0x2B, 0x48, 0xEC, 0xEC, 
-    0x20, 0x6B, 0x00, 0x28, 0x20, 0x8C, 0x70, 0x03, 0x27, 0x40, 0x00, 0x1C, 0x48, 0x78, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB8, 0x74, 0x27, 0x48, 0x00, 0x20, 0x20, 0x6B, 0x00, 0x20, 0x20, 0xAD, 
-    0xED, 0x08, 0x20, 0x6B, 0x00, 0x20, 0x21, 0x6D, 0xED, 0x04, 0x00, 0x04, 0x20, 0x6B, 0x00, 0x20, 
-    0x21, 0x6D, 0xEC, 0xF8, 0x00, 0x08, 0x76, 0x00, 0x4F, 0xEF, 0x00, 0x34, 0x60, 0x3A, 0x2F, 0x3C, 
-    0xE2, 0x8F, 0xC0, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xFE, 0x24, 0xC0, 0x2F, 0x3C, 0xE8, 0x9C, 
-    0x90, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xF0, 0x24, 0xC0, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xAF, 0xE6, 0x24, 0xC0, 0x20, 0x04, 0xE9, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xD8, 
-    0x24, 0xC0, 0x52, 0x83, 0x4F, 0xEF, 0x00, 0x10, 0xB6, 0x84, 0x65, 0xC2, 0x2F, 0x3C, 0xE9, 0x2D, 
-    0x40, 0x7F, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xC0, 0x24, 0xC0, 0x2F, 0x3C, 0xE5, 0x1F, 0x00, 0x10, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xB2, 0x24, 0xC0, 0x20, 0x04, 0xE5, 0x88, 0x72, 0xFC, 0x92, 0x80, 
-    0x02, 0x81, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x81, 0xEA, 0x00, 0x00, 0x00, 0x2F, 0x01, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAF, 0x94, 0x24, 0xC0, 0x42, 0x9A, 0x4A, 0x2D, 0xED, 0xFD, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x18, 0x20, 0x6D, 0xEC, 0xF0, 0x20, 0x68, 0x00, 0x04, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAF, 0x74, 0x24, 0xC0, 0x42, 0x9A, 0x58, 0x4F, 0x76, 0x00, 0x60, 0x0A, 0x20, 0x6D, 
-    0xE9, 0x7A, 0x24, 0xF0, 0x3C, 0x00, 0x52, 0x83, 0x20, 0x2D, 0xE9, 0x76, 0xE4, 0x88, 0xB6, 0x80, 
-    0x65, 0xEC, 0x26, 0x4A, 0x76, 0x00, 0x60, 0x28, 0x20, 0x03, 0xE9, 0x88, 0x72, 0x0C, 0xD0, 0x81, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0x40, 0x26, 0x80, 0x2F, 0x3C, 0x82, 0x00, 0x00, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0x32, 0x27, 0x40, 0x00, 0x04, 0x50, 0x8B, 0x52, 0x83, 0x50, 0x4F, 
-    0xB6, 0x84, 0x65, 0xD4, 0x20, 0x04, 0xE9, 0x88, 0x50, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xAF, 0x16, 0x26, 0x80, 0x2F, 0x3C, 0x8F, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0x08, 
-    0x27, 0x40, 0x00, 0x04, 0x50, 0x8B, 0x20, 0x04, 0xE9, 0x88, 0x72, 0x0C, 0xD0, 0x81, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAE, 0xF2, 0x26, 0x80, 0x2F, 0x3C, 0x8A, 0x00, 0x00, 0x01, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAE, 0xE4, 0x27, 0x40, 0x00, 0x04, 0x4A, 0x2D, 0xED, 0xFD, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x26, 0x50, 0x8B, 0x20, 0x04, 0xE9, 0x88, 0x72, 0x14, 0xD0, 0x81, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAE, 0xC4, 0x26, 0x80, 0x2F, 0x3C, 0x8A, 0x00, 0x00, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xAE, 0xB6, 0x27, 0x40, 0x00, 0x04, 0x50, 0x4F, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xAE, 0x9A, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0xEC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x52, 0x8C, 0x24, 0x4C, 0x26, 0x4A, 0x16, 0x12, 0x49, 0xC3, 0x4A, 0x83, 0x66, 0x04, 0x20, 0x4A, 
-    0x60, 0x48, 0x70, 0x5C, 0xB6, 0x80, 0x66, 0x18, 0x0C, 0x2A, 0x00, 0x22, 0x00, 0x01, 0x67, 0x08, 
-    0x0C, 0x2A, 0x00, 0x5C, 0x00, 0x01, 0x66, 0x08, 0x16, 0x2A, 0x00, 0x01, 0x49, 0xC3, 0x60, 0x08, 
-    0x70, 0x22, 0xB6, 0x80, 0x66, 0x02, 0x76, 0x00, 0x16, 0xC3, 0x4A, 0x83, 0x67, 0x08, 0x52, 0x8A, 
-    0x16, 0x12, 0x49, 0xC3, 0x60, 0xC4, 0x20, 0x4B, 0x91, 0xCC, 0x2F, 0x08, 0x2F, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF8, 0x88, 0x20, 0x4A, 0x52, 0x88, 0x50, 0x4F, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x4A, 0x13, 
-    0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x2E, 0x7C, 0x60, 0x28, 0x24, 0x6D, 0xEE, 0x84, 0x60, 0x1C, 
-    0x2F, 0x0B, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xE4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x08, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x2C, 0x60, 0x08, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xE0, 
-    0x91, 0xC8, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x18, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x28, 0x3C, 0x00, 0x00, 0x00, 0xFD, 0x47, 0xED, 0xE8, 0x6E, 
-    0x54, 0x8B, 0x60, 0x08, 0x4A, 0x84, 0x6F, 0x04, 0x16, 0xC3, 0x53, 0x84, 0x20, 0x6A, 0x00, 0x0C, 
-    0xB1, 0xEA, 0x00, 0x10, 0x65, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xAA, 0x36, 0x58, 0x4F, 
-    0x60, 0x0C, 0x20, 0x6A, 0x00, 0x0C, 0x52, 0xAA, 0x00, 0x0C, 0x70, 0x00, 0x10, 0x10, 0x26, 0x00, 
-    0x52, 0x80, 0x67, 0x06, 0x70, 0x0D, 0xB6, 0x80, 0x66, 0xCA, 0x4A, 0x84, 0x66, 0x18, 0x2F, 0x2E, 
-    0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x27, 0x9C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB1, 0xCC, 0x4F, 0xEF, 0x00, 0x0C, 0x42, 0x13, 0x41, 0xED, 0xE8, 0x6E, 0x54, 0x88, 0xB7, 0xC8, 
-    0x66, 0x12, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xA9, 0x0A, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x04, 
-    0x91, 0xC8, 0x60, 0x06, 0x41, 0xED, 0xE8, 0x6E, 0x54, 0x88, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x4B, 
-    0x41, 0xF9, 0x00, 0x00, 0x2E, 0x7C, 0x28, 0x08, 0x60, 0x02, 0x52, 0x8A, 0x16, 0x12, 0x49, 0xC3, 
-    0x67, 0x06, 0x70, 0x28, 0xB6, 0x80, 0x66, 0xF2, 0x28, 0x4A, 0x70, 0x28, 0xB6, 0x80, 0x66, 0x68, 
-    0x52, 0x8A, 0x28, 0x4A, 0x60, 0x02, 0x52, 0x8A, 0x16, 0x12, 0x49, 0xC3, 0x67, 0x06, 0x70, 0x29, 
-    0xB6, 0x80, 0x66, 0xF2, 0x42, 0x12, 0x70, 0x29, 0xB6, 0x80, 0x67, 0x18, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x48, 0x79, 0x00, 0x00, 0x27, 0x75, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x42, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x01, 0x58, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xBA, 0x28, 0x08, 0x20, 0x08, 
-    0x58, 0x4F, 0x66, 0x18, 0x14, 0xBC, 0x00, 0x29, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x27, 0x56, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x18, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x30, 0x42, 0x2C, 0xFF, 0xFF, 
-    0x26, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x60, 0x06, 0x26, 0x3C, 0x04, 0x00, 0x00, 0x00, 0x20, 0x44, 
-    0x17, 0x50, 0xFF, 0xFE, 0x17, 0x68, 0x00, 0x01, 0xFF, 0xFF, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x6B, 
-    0xFF, 0xFE, 0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0x4C, 0x28, 0x08, 0x4A, 0x84, 0x50, 0x4F, 0x66, 0x14, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x27, 0x56, 0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0xD0, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xE8, 0x20, 0x44, 0x24, 0x68, 0x00, 0x04, 0x4A, 0xAA, 0x00, 0x10, 0x66, 0x38, 
-    0x70, 0x04, 0xC0, 0xAA, 0x00, 0x14, 0x67, 0x1C, 0x00, 0xAA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x27, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0xA0, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xB8, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x26, 0xF5, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB0, 0x8C, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA4, 0x20, 0x6A, 0x00, 0x10, 0x20, 0x28, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x6A, 0x20, 0x2A, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 
-    0x01, 0x00, 0x66, 0x5E, 0x20, 0x2A, 0x00, 0x14, 0xC0, 0x83, 0x67, 0x30, 0x0C, 0x83, 0x04, 0x00, 
-    0x00, 0x00, 0x66, 0x12, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x26, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xB0, 0x4C, 0x50, 0x4F, 0x60, 0x58, 0x2F, 0x0C, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x26, 0xAF, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0x38, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x42, 0x20, 0x2A, 0x00, 0x14, 
-    0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x66, 0x0C, 0x20, 0x2D, 0xED, 0x30, 0x52, 0xAD, 0xED, 0x30, 
-    0x25, 0x40, 0x00, 0x04, 0x0C, 0x83, 0x08, 0x00, 0x00, 0x00, 0x66, 0x22, 0x52, 0xAD, 0xED, 0x2C, 
-    0x60, 0x1C, 0x0C, 0x83, 0x08, 0x00, 0x00, 0x00, 0x66, 0x14, 0x2F, 0x0C, 0x2F, 0x0B, 0x48, 0x79, 
-    0x00, 0x00, 0x26, 0x8A, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xF4, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x03, 
-    0x06, 0x80, 0x02, 0x00, 0x00, 0x00, 0x81, 0xAA, 0x00, 0x14, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x4A, 0x20, 0x0C, 0x67, 0x14, 0x20, 0x52, 0x2F, 0x28, 
-    0x00, 0x04, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x46, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x2E, 
-    0x20, 0x0B, 0x67, 0x16, 0x4A, 0x13, 0x67, 0x12, 0x48, 0x6A, 0x00, 0x44, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAD, 0x2C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x14, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x30, 0xDE, 0x00, 0x66, 0x08, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x80, 0x00, 0x30, 0x24, 0x6A, 
-    0x00, 0x08, 0x20, 0x0A, 0x66, 0xB2, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x99, 0xCC, 0x97, 0xCB, 0x1B, 0x7C, 
-    0x00, 0x01, 0xED, 0xFD, 0x60, 0x00, 0x00, 0xB0, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x38, 0x00, 
-    0x72, 0x44, 0xC0, 0x81, 0x66, 0x00, 0x00, 0xA0, 0x70, 0x2C, 0xB6, 0x80, 0x67, 0x00, 0x00, 0x98, 
-    0x70, 0x28, 0xB6, 0x80, 0x66, 0x04, 0x99, 0xCC, 0x60, 0x24, 0x28, 0x4A, 0x53, 0x8C, 0x60, 0x04, 
-    0x16, 0x1A, 0x49, 0xC3, 0x4A, 0x83, 0x67, 0x12, 0x70, 0x20, 0xB6, 0x80, 0x67, 0x0C, 0x70, 0x2C, 
-    0xB6, 0x80, 0x67, 0x06, 0x70, 0x28, 0xB6, 0x80, 0x66, 0xE6, 0x42, 0x2A, 0xFF, 0xFF, 0x70, 0x28, 
-    0xB6, 0x80, 0x66, 0x56, 0x60, 0x48, 0x16, 0x1A, 0x49, 0xC3, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x38, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEE, 0x70, 0x2C, 0xB6, 0x80, 0x67, 0xE8, 0x26, 0x4A, 
-    0x53, 0x8B, 0x60, 0x04, 0x16, 0x1A, 0x49, 0xC3, 0x4A, 0x83, 0x67, 0x12, 0x70, 0x20, 0xB6, 0x80, 
-    0x67, 0x0C, 0x70, 0x2C, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x29, 0xB6, 0x80, 0x66, 0xE6, 0x42, 0x2A, 
-    0xFF, 0xFF, 0x2F, 0x0B, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0x50, 0x4F, 0x4A, 0x83, 
-    0x67, 0x14, 0x70, 0x29, 0xB6, 0x80, 0x66, 0xAE, 0x60, 0x0C, 0x42, 0xA7, 0x2F, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xD2, 0x50, 0x4F, 0x16, 0x1A, 0x49, 0xC3, 0x66, 0x00, 0xFF, 0x4C, 0x4C, 0xDF, 
-    0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1C, 0x38, 0x48, 0x79, 
-    0x00, 0x00, 0x2C, 0xAA, 0x2F, 0x2D, 0xED, 0xB0, 0x61, 0xFF, 0x00, 0x00, 0xA3, 0x5C, 0x2A, 0x08, 
-    0x20, 0x08, 0x50, 0x4F, 0x66, 0x12, 0x2F, 0x2D, 0xED, 0xB0, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAE, 0x68, 0x50, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 0xB4, 0x16, 0x48, 0x78, 
-    0x10, 0x00, 0x42, 0xA7, 0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB3, 0xA2, 0x58, 0x4F, 
-    0x2F, 0x08, 0x2F, 0x05, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0x58, 0x78, 0x00, 0x99, 0xCC, 0x76, 0x00, 
-    0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x02, 0x2E, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 
-    0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x70, 0x5C, 0xB6, 0x80, 
-    0x67, 0x0E, 0x10, 0x12, 0x49, 0xC0, 0x26, 0x00, 0x72, 0x3E, 0xB0, 0x81, 0x66, 0x00, 0x01, 0xDE, 
-    0x70, 0x3E, 0xB6, 0x80, 0x66, 0x00, 0x01, 0xCE, 0x20, 0x0C, 0x67, 0x1A, 0x2F, 0x04, 0x2F, 0x2D, 
-    0xED, 0xB0, 0x48, 0x79, 0x00, 0x00, 0x26, 0x5D, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0xF0, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x01, 0xE0, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x26, 0x4A, 0x60, 0x02, 0x52, 0x8A, 
-    0x16, 0x12, 0x49, 0xC3, 0x67, 0x14, 0x70, 0x28, 0xB6, 0x80, 0x67, 0x0E, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x38, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x67, 0xE4, 0x42, 0x1A, 0x70, 0x28, 0xB6, 0x80, 
-    0x66, 0x72, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x74, 0x58, 0x4F, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 
-    0x2B, 0x40, 0xED, 0xB4, 0x26, 0x4A, 0x60, 0x02, 0x52, 0x8A, 0x16, 0x12, 0x49, 0xC3, 0x67, 0x06, 
-    0x70, 0x29, 0xB6, 0x80, 0x66, 0xF2, 0x70, 0x29, 0xB6, 0x80, 0x66, 0x08, 0x42, 0x1A, 0x16, 0x12, 
-    0x49, 0xC3, 0x60, 0x16, 0x2F, 0x04, 0x2F, 0x2D, 0xED, 0xB0, 0x48, 0x79, 0x00, 0x00, 0x26, 0x42, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x58, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x26, 0x40, 
-    0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0xC8, 0x34, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x1B, 0x7C, 
-    0x00, 0x02, 0xEE, 0x06, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xB1, 0x02, 0x58, 0x4F, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 
-    0x66, 0xFC, 0x28, 0x40, 0x4A, 0xAD, 0xED, 0xB4, 0x66, 0x00, 0x00, 0xDA, 0x2B, 0x4C, 0xED, 0xB4, 
-    0x60, 0x00, 0x00, 0xD2, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x10, 0x12, 0x49, 0xC0, 0x26, 0x00, 0x72, 0x22, 
-    0xB0, 0x81, 0x66, 0x10, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xFC, 0x24, 0x48, 0x58, 0x4F, 
-    0x60, 0x00, 0x00, 0x9E, 0x70, 0x3B, 0xB6, 0x80, 0x67, 0x00, 0x00, 0xCA, 0x70, 0x5C, 0xB6, 0x80, 
-    0x66, 0x30, 0x60, 0x02, 0x52, 0x8A, 0x16, 0x2A, 0x00, 0x01, 0x49, 0xC3, 0x67, 0x14, 0x70, 0x3B, 
-    0xB6, 0x80, 0x67, 0x0E, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x38, 0x00, 0x72, 0x44, 0xC0, 0x81, 
-    0x66, 0xE2, 0x4A, 0x83, 0x67, 0x06, 0x70, 0x3B, 0xB6, 0x80, 0x66, 0x64, 0x76, 0x5C, 0x60, 0x00, 
-    0x00, 0x94, 0x4A, 0x83, 0x67, 0x5A, 0x42, 0xAD, 0xEF, 0x7C, 0x42, 0xA7, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0xC3, 0x78, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF9, 0x70, 0x26, 0x4A, 0x58, 0x4F, 0x52, 0x8A, 0x4A, 0x12, 0x67, 0x12, 0x10, 0x12, 
-    0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x67, 0xE8, 
-    0xB5, 0xEE, 0xFF, 0xFC, 0x66, 0x08, 0x70, 0x22, 0xB0, 0xAD, 0xEF, 0x7C, 0x66, 0x12, 0x42, 0x12, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x26, 0x1B, 0x61, 0xFF, 0xFF, 0xFF, 0xAC, 0x40, 0x50, 0x4F, 
-    0x16, 0x12, 0x49, 0xC3, 0x4A, 0x83, 0x66, 0x00, 0xFF, 0x2E, 0x60, 0x28, 0x70, 0x3B, 0xB6, 0x80, 
-    0x67, 0x22, 0x4A, 0x83, 0x67, 0x1E, 0x70, 0x2B, 0xB6, 0x80, 0x66, 0x0E, 0x48, 0x6A, 0x00, 0x01, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xAC, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFA, 0x74, 0x58, 0x4F, 0x52, 0x84, 0x2F, 0x04, 0x2F, 0x2D, 0xED, 0xB0, 0x2F, 0x05, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF9, 0xCA, 0x24, 0x48, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 0xFD, 0xBC, 
-    0x2F, 0x05, 0x61, 0xFF, 0x00, 0x00, 0xA3, 0x4E, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 0x2F, 0x2D, 
-    0xED, 0xB0, 0x48, 0x79, 0x00, 0x00, 0x33, 0xF2, 0x61, 0xFF, 0xFF, 0xFF, 0xAB, 0xD0, 0x50, 0x4F, 
-    0x20, 0x0C, 0x66, 0x12, 0x2F, 0x2D, 0xED, 0xB0, 0x48, 0x79, 0x00, 0x00, 0x25, 0xF0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAB, 0xBA, 0x50, 0x4F, 0x2F, 0x05, 0x61, 0xFF, 0x00, 0x00, 0xA0, 0xCC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xB1, 0x82, 0x48, 0x78, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0x7C, 0x24, 0x48, 
-    0x2B, 0x48, 0xEE, 0xF4, 0x42, 0xAA, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x08, 0x48, 0x78, 0x00, 0x74, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0x64, 0x26, 0x08, 0x24, 0x88, 0x42, 0xA7, 0x2F, 0x0C, 0x2F, 0x03, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE0, 0x48, 0x20, 0x43, 0x21, 0x4A, 0x00, 0x4C, 0x78, 0x00, 0x24, 0x6D, 
-    0xEE, 0x8C, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0x01, 0x00, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0x22, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x22, 0x00, 0x66, 0x38, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x02, 0x00, 0x00, 0x66, 0x24, 0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 0x48, 0x68, 
-    0x00, 0x24, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x6A, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 
-    0x25, 0xC2, 0x61, 0xFF, 0xFF, 0xFF, 0xAB, 0x26, 0x4F, 0xEF, 0x00, 0x10, 0x25, 0x43, 0x00, 0x10, 
-    0x60, 0x00, 0x00, 0xB2, 0x20, 0x2A, 0x00, 0x30, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x67, 0x00, 
-    0x00, 0xA4, 0x4A, 0xAA, 0x00, 0x24, 0x6F, 0x1E, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 
-    0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x25, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0xAA, 0xF0, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0x80, 0x2F, 0x2A, 0x00, 0x34, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x2F, 0x00, 0x42, 0xA7, 0x42, 0xA7, 
-    0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2A, 0x00, 0x14, 0x2F, 0x12, 0x48, 0x79, 0x00, 0x00, 0x25, 0x72, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC5, 0xB6, 0x26, 0x48, 0x27, 0x43, 0x00, 0x10, 0x41, 0xEA, 0x00, 0x44, 
-    0x43, 0xF9, 0x00, 0x00, 0x25, 0x6E, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x25, 0x40, 0x00, 0x2C, 
-    0x4A, 0x84, 0x4F, 0xEF, 0x00, 0x20, 0x66, 0x18, 0x20, 0x6D, 0xEC, 0xF8, 0x20, 0x68, 0x00, 0x04, 
-    0x21, 0x4A, 0x00, 0x10, 0x20, 0x6D, 0xEC, 0xF4, 0x20, 0x68, 0x00, 0x04, 0x21, 0x4B, 0x00, 0x10, 
-    0xD8, 0xAA, 0x00, 0x18, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0x00, 0xFE, 0xFE, 0x20, 0x6D, 
-    0xEC, 0xF0, 0x20, 0x68, 0x00, 0x04, 0x21, 0x44, 0x00, 0x0C, 0x20, 0x6D, 0xEC, 0xF8, 0x20, 0x68, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x10, 0x66, 0x0E, 0x20, 0x6D, 0xEC, 0xF8, 0x20, 0x68, 0x00, 0x04, 
-    0x70, 0x04, 0x81, 0xA8, 0x00, 0x14, 0x4A, 0x2D, 0xEE, 0x05, 0x67, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF1, 0x60, 0x60, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0xAC, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x59, 0x4F, 0x4A, 0xAD, 0xEC, 0xE4, 0x67, 0x12, 0x70, 0x01, 0x20, 0x6D, 0xEC, 0xE4, 
-    0x50, 0x88, 0x58, 0x88, 0x2E, 0x88, 0xC0, 0xA8, 0x00, 0x08, 0x66, 0x06, 0x70, 0x00, 0x58, 0x4F, 
-    0x4E, 0x75, 0x22, 0x6F, 0x00, 0x08, 0x43, 0xE9, 0x00, 0x0C, 0x70, 0x04, 0x22, 0xD8, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x70, 0x01, 0x58, 0x4F, 0x4E, 0x75, 0x48, 0xE7, 0x00, 0x38, 0x47, 0xED, 0xEE, 0x8C, 
-    0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x6E, 0x28, 0x6A, 0x00, 0x08, 0x4A, 0x92, 0x66, 0x08, 0x41, 0xED, 
-    0xEE, 0xA4, 0x25, 0x48, 0x00, 0x10, 0x4A, 0xAA, 0x00, 0x10, 0x66, 0x20, 0x70, 0x02, 0x20, 0x52, 
-    0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x67, 0x12, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0x02, 0x00, 0x67, 0x06, 0x4A, 0xAA, 0x00, 0x0C, 0x66, 0x32, 0x4A, 0xAA, 0x00, 0x10, 
-    0x66, 0x08, 0x41, 0xED, 0xEE, 0xA4, 0x25, 0x48, 0x00, 0x10, 0x26, 0xAA, 0x00, 0x08, 0x20, 0x6A, 
-    0x00, 0x10, 0x20, 0x50, 0x20, 0x8A, 0x20, 0x4A, 0x50, 0x88, 0x22, 0x6A, 0x00, 0x10, 0x22, 0x88, 
-    0x42, 0xAA, 0x00, 0x08, 0x20, 0x6A, 0x00, 0x10, 0x52, 0xA8, 0x00, 0x38, 0x60, 0x04, 0x26, 0x4A, 
-    0x50, 0x8B, 0x24, 0x4C, 0x20, 0x0A, 0x66, 0x8E, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x75, 0x48, 0xE7, 
-    0x06, 0x38, 0x4A, 0x2D, 0xED, 0xFF, 0x66, 0x00, 0x00, 0x88, 0x41, 0xED, 0xEE, 0x8C, 0x24, 0x08, 
-    0x26, 0x6D, 0xEE, 0x8C, 0x7C, 0x00, 0x60, 0x6E, 0x2A, 0x2B, 0x00, 0x08, 0x24, 0x6B, 0x00, 0x0C, 
-    0x72, 0x00, 0x20, 0x52, 0x28, 0x68, 0x00, 0x10, 0x20, 0x52, 0x4A, 0xA8, 0x00, 0x10, 0x67, 0x12, 
-    0x20, 0x52, 0xB9, 0xE8, 0x00, 0x10, 0x67, 0x02, 0x72, 0x01, 0x24, 0x6A, 0x00, 0x04, 0x20, 0x0A, 
-    0x66, 0xE6, 0x20, 0x0A, 0x66, 0x38, 0x27, 0x4C, 0x00, 0x10, 0x4A, 0x81, 0x67, 0x08, 0x41, 0xED, 
-    0xEE, 0xA4, 0x27, 0x48, 0x00, 0x10, 0x7C, 0x01, 0x20, 0x42, 0x20, 0xAB, 0x00, 0x08, 0x20, 0x6B, 
-    0x00, 0x10, 0x20, 0x50, 0x20, 0x8B, 0x20, 0x4B, 0x50, 0x88, 0x22, 0x6B, 0x00, 0x10, 0x22, 0x88, 
-    0x42, 0xAB, 0x00, 0x08, 0x20, 0x6B, 0x00, 0x10, 0x52, 0xA8, 0x00, 0x38, 0x60, 0x06, 0x20, 0x4B, 
-    0x50, 0x88, 0x24, 0x08, 0x26, 0x45, 0x20, 0x0B, 0x66, 0x8E, 0x4A, 0x86, 0x66, 0x00, 0xFF, 0x7C, 
-    0x26, 0x6D, 0xEE, 0x8C, 0x20, 0x6D, 0xEE, 0xA4, 0x20, 0x8B, 0x60, 0x14, 0x41, 0xED, 0xEE, 0xA4, 
-    0x27, 0x48, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x10, 0x52, 0xA8, 0x00, 0x38, 0x26, 0x6B, 0x00, 0x08, 
-    0x20, 0x0B, 0x66, 0xE8, 0x4C, 0xDF, 0x1C, 0x60, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x38, 0x26, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x24, 0x6D, 
-    0xED, 0xF4, 0x60, 0x18, 0x2F, 0x03, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0x00, 0x00, 0xC3, 0x6C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 0x70, 0x01, 0x60, 0x42, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xE4, 
-    0x24, 0x6D, 0xED, 0xF0, 0x60, 0x30, 0x2F, 0x0C, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0x00, 0x00, 
-    0xC3, 0x4A, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x18, 0x20, 0x0B, 0x67, 0x18, 0x48, 0x6B, 0x00, 0x0A, 
-    0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0x00, 0x00, 0xC3, 0x32, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 
-    0x70, 0x01, 0x60, 0x08, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xCC, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x26, 0x6E, 0x00, 0x0C, 0x28, 0x2E, 0x00, 0x10, 0x24, 0x6C, 0x00, 0x0C, 0x60, 0x0A, 0xB7, 0xD2, 
-    0x67, 0x00, 0x00, 0xD4, 0x24, 0x6A, 0x00, 0x04, 0x20, 0x0A, 0x66, 0xF2, 0x4A, 0xAD, 0xE8, 0x6A, 
-    0x66, 0x0A, 0x41, 0xF9, 0x00, 0x00, 0x30, 0x30, 0x2B, 0x48, 0xE8, 0x6A, 0x4A, 0x2D, 0xED, 0xFA, 
-    0x66, 0x08, 0x4A, 0x2D, 0xED, 0xF9, 0x67, 0x00, 0x00, 0x94, 0x4A, 0x94, 0x66, 0x06, 0x20, 0x6D, 
-    0xE8, 0x6A, 0x60, 0x0C, 0x20, 0x54, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x24, 0x48, 0x4A, 0x93, 0x66, 0x06, 0x20, 0x6D, 0xE8, 0x6A, 0x60, 0x0C, 0x20, 0x53, 0x2D, 0x68, 
-    0x00, 0x04, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x26, 0x08, 0x4A, 0x2D, 0xED, 0xFA, 0x66, 0x18, 
-    0x2F, 0x04, 0x48, 0x6B, 0x00, 0x44, 0x48, 0x6C, 0x00, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x44, 0x4A, 0x84, 0x67, 0x24, 0x20, 0x44, 0x48, 0x68, 
-    0x00, 0x0A, 0x48, 0x6B, 0x00, 0x44, 0x2F, 0x03, 0x48, 0x6C, 0x00, 0x44, 0x2F, 0x0A, 0x48, 0x79, 
-    0x00, 0x00, 0x25, 0x4E, 0x61, 0xFF, 0x00, 0x00, 0xA5, 0x44, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x1C, 
-    0x48, 0x6B, 0x00, 0x44, 0x2F, 0x03, 0x48, 0x6C, 0x00, 0x44, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x25, 0x35, 0x61, 0xFF, 0x00, 0x00, 0xA5, 0x26, 0x4F, 0xEF, 0x00, 0x14, 0x48, 0x78, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAB, 0x24, 0x24, 0x48, 0x24, 0x8B, 0x25, 0x6C, 0x00, 0x0C, 0x00, 0x04, 
-    0x29, 0x4A, 0x00, 0x0C, 0x58, 0x4F, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xEC, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x7C, 0x00, 0x4A, 0xAC, 0x00, 0x24, 
-    0x67, 0x12, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x10, 0x20, 0x2C, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x02, 0x00, 0x67, 0x04, 0x60, 0x00, 0x02, 0xDE, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xAF, 0xB0, 
-    0x70, 0x08, 0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x58, 0x4F, 0x66, 0x00, 
-    0x02, 0xC4, 0x42, 0xAE, 0xFF, 0xF4, 0x26, 0x2C, 0x00, 0x24, 0xE7, 0x8B, 0x2D, 0x6C, 0x00, 0x18, 
-    0xFF, 0xF0, 0x2F, 0x03, 0x2F, 0x2C, 0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0x58, 0x24, 0x48, 
-    0x2D, 0x4A, 0xFF, 0xF8, 0x20, 0x2C, 0x00, 0x24, 0xE7, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 0x2D, 0x48, 
-    0xFF, 0xEC, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x82, 0x20, 0x6E, 0xFF, 0xF8, 0x2F, 0x10, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xA1, 0xD8, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xF8, 0x2F, 0x28, 0x00, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xA1, 0xC6, 0x26, 0x00, 0x7A, 0x00, 0x20, 0x03, 0x72, 0x1F, 0xE2, 0xA8, 
-    0x50, 0x4F, 0x67, 0x56, 0x2E, 0x03, 0x02, 0x87, 0x00, 0xFF, 0xFF, 0xFF, 0x70, 0x03, 0x28, 0x03, 
-    0x74, 0x18, 0xE4, 0xAC, 0xC8, 0x80, 0x70, 0x01, 0x22, 0x03, 0x74, 0x1A, 0xE4, 0xA9, 0xC2, 0x80, 
-    0x24, 0x41, 0x2C, 0x03, 0x74, 0x1B, 0xE4, 0xAE, 0xCC, 0x80, 0x20, 0x2C, 0x00, 0x30, 0x02, 0x80, 
-    0x00, 0x00, 0x01, 0x00, 0x67, 0x06, 0x20, 0x0A, 0x67, 0x02, 0x78, 0x03, 0x70, 0x03, 0xB8, 0x80, 
-    0x66, 0x4E, 0x70, 0x01, 0xC0, 0xAE, 0xFF, 0xFC, 0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 
-    0x2A, 0x00, 0x70, 0xFE, 0xC1, 0xAE, 0xFF, 0xFC, 0x60, 0x36, 0x2E, 0x03, 0x02, 0x87, 0x00, 0x00, 
-    0xFF, 0xFF, 0x70, 0x03, 0x28, 0x03, 0x74, 0x10, 0xE4, 0xAC, 0xC8, 0x80, 0x70, 0x01, 0x22, 0x03, 
-    0x74, 0x12, 0xE4, 0xA9, 0xC2, 0x80, 0x24, 0x41, 0x2C, 0x03, 0x74, 0x13, 0xE4, 0xAE, 0xCC, 0x80, 
-    0x20, 0x0A, 0x67, 0x04, 0x7C, 0x01, 0x78, 0x03, 0x4A, 0x86, 0x66, 0x04, 0x2E, 0x2C, 0x00, 0x34, 
-    0x4A, 0x85, 0x67, 0x10, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x0A, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x04, 
-    0x52, 0xAD, 0xED, 0x34, 0x20, 0x2E, 0xFF, 0xFC, 0xB0, 0xAE, 0xFF, 0xF0, 0x6D, 0x18, 0x20, 0x54, 
-    0x20, 0x68, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xCA, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xA5, 0xCA, 0x50, 0x4F, 0x4A, 0x86, 0x67, 0x00, 0x01, 0x4C, 0x20, 0x54, 0x22, 0x68, 
-    0x00, 0x20, 0x26, 0x71, 0x7C, 0x00, 0x26, 0x2B, 0x00, 0x04, 0x24, 0x43, 0x50, 0x8A, 0x58, 0x8A, 
-    0x7C, 0x00, 0x70, 0x11, 0xC0, 0xAA, 0x00, 0x08, 0x66, 0x10, 0x4A, 0xAD, 0xEC, 0xE4, 0x67, 0x0A, 
-    0x26, 0x2D, 0xEC, 0xE4, 0x24, 0x43, 0x50, 0x8A, 0x58, 0x8A, 0x70, 0x20, 0xC0, 0xAA, 0x00, 0x08, 
-    0x67, 0x34, 0xB9, 0xEA, 0x00, 0x04, 0x66, 0x2E, 0x17, 0x7C, 0x00, 0x20, 0x00, 0x08, 0x48, 0x6D, 
-    0xEF, 0x4C, 0x48, 0x6B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xA4, 0xD8, 0x2E, 0x08, 0x4A, 0x87, 
-    0x50, 0x4F, 0x67, 0x0C, 0x20, 0x47, 0x26, 0x28, 0x00, 0x04, 0x24, 0x43, 0x50, 0x8A, 0x58, 0x8A, 
-    0x17, 0x7C, 0x00, 0x21, 0x00, 0x08, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x08, 0x67, 0x00, 0x00, 0xE2, 
-    0x70, 0x03, 0xB8, 0x80, 0x66, 0x00, 0x00, 0xCA, 0x20, 0x2A, 0x00, 0x08, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0xB0, 0x85, 0x67, 0x00, 0x00, 0xB2, 
-    0x2C, 0x13, 0x4A, 0x86, 0x67, 0x24, 0x20, 0x46, 0x48, 0x68, 0x00, 0x08, 0x48, 0x6B, 0x00, 0x08, 
-    0x61, 0xFF, 0x00, 0x00, 0xC0, 0x06, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0E, 0x26, 0x46, 0x24, 0x6B, 
-    0x00, 0x04, 0x50, 0x8A, 0x58, 0x8A, 0x60, 0x00, 0x00, 0x88, 0x4A, 0xAA, 0x00, 0x04, 0x67, 0x2E, 
-    0x20, 0x6A, 0x00, 0x04, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x40, 0x00, 0x00, 0x67, 0x1E, 
-    0x20, 0x43, 0x70, 0xFF, 0xB0, 0xA8, 0x00, 0x08, 0x66, 0x66, 0x42, 0xA8, 0x00, 0x08, 0x4A, 0x85, 
-    0x66, 0x06, 0x52, 0xAD, 0xE9, 0x96, 0x60, 0x58, 0x52, 0xAD, 0xE9, 0x92, 0x60, 0x52, 0x4A, 0x85, 
-    0x66, 0x4A, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x14, 0x2F, 0x2E, 0xFF, 0xF0, 0x2F, 0x2C, 0x00, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAE, 0x40, 0x2D, 0x48, 0xFF, 0xF4, 0x50, 0x4F, 0x26, 0x6E, 0xFF, 0xF4, 
-    0xD7, 0xEE, 0xFF, 0xFC, 0x2F, 0x13, 0x61, 0xFF, 0xFF, 0xFF, 0x9F, 0xD0, 0x26, 0x00, 0x20, 0x03, 
-    0x02, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x58, 0x4F, 0x66, 0x06, 
-    0x52, 0xAD, 0xE9, 0x9E, 0x60, 0x0A, 0x52, 0xAD, 0xE9, 0xA2, 0x60, 0x04, 0x52, 0xAD, 0xE9, 0x9A, 
-    0x2C, 0x2A, 0x00, 0x04, 0x60, 0x0A, 0x20, 0x54, 0x22, 0x68, 0x00, 0x28, 0x2C, 0x31, 0x7C, 0x00, 
-    0x4A, 0x86, 0x67, 0x30, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x2A, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x24, 
-    0x20, 0x2C, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x66, 0x18, 0x20, 0x46, 0x20, 0x28, 
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x0A, 0x70, 0x02, 0xB8, 0x80, 0x66, 0x04, 
-    0x52, 0xAD, 0xED, 0x34, 0x50, 0xAE, 0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 0xB1, 0xEE, 0xFF, 0xEC, 
-    0x65, 0x00, 0xFD, 0x76, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF4, 
-    0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x99, 0xCC, 0x4A, 0xAB, 0x00, 0x24, 0x67, 0x12, 
-    0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x10, 0x20, 0x2B, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x67, 0x04, 0x60, 0x00, 0x02, 0xEA, 0x2F, 0x13, 0x61, 0xFF, 0xFF, 0xFF, 0xAC, 0xA2, 0x70, 0x08, 
-    0x20, 0x53, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x58, 0x4F, 0x66, 0x00, 0x02, 0xD0, 
-    0x26, 0x2B, 0x00, 0x24, 0xE7, 0x8B, 0x2D, 0x6B, 0x00, 0x18, 0xFF, 0xF4, 0x2F, 0x03, 0x2F, 0x2B, 
-    0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x4E, 0x24, 0x48, 0x2C, 0x0A, 0x20, 0x2B, 0x00, 0x24, 
-    0xE7, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xF8, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x98, 
-    0x20, 0x46, 0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x9E, 0xD2, 0x28, 0x40, 0x20, 0x46, 0x2F, 0x28, 
-    0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x9E, 0xC4, 0x26, 0x00, 0x42, 0xAE, 0xFF, 0xFC, 0x20, 0x03, 
-    0x72, 0x1F, 0xE2, 0xA8, 0x50, 0x4F, 0x67, 0x5A, 0x28, 0x03, 0x02, 0x84, 0x00, 0xFF, 0xFF, 0xFF, 
-    0x70, 0x03, 0x2A, 0x03, 0x74, 0x18, 0xE4, 0xAD, 0xCA, 0x80, 0x70, 0x01, 0x22, 0x03, 0x74, 0x1A, 
-    0xE4, 0xA9, 0xC2, 0x80, 0x24, 0x41, 0x2E, 0x03, 0x74, 0x1B, 0xE4, 0xAF, 0xCE, 0x80, 0x20, 0x2B, 
-    0x00, 0x30, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x67, 0x06, 0x20, 0x0A, 0x67, 0x02, 0x7A, 0x03, 
-    0x70, 0x03, 0xBA, 0x80, 0x66, 0x52, 0x70, 0x01, 0x22, 0x0C, 0xC2, 0x80, 0x4A, 0x81, 0x56, 0xC1, 
-    0x44, 0x01, 0x49, 0xC1, 0x2D, 0x41, 0xFF, 0xFC, 0x70, 0xFE, 0x22, 0x0C, 0xC2, 0x80, 0x28, 0x41, 
-    0x60, 0x36, 0x28, 0x03, 0x02, 0x84, 0x00, 0x00, 0xFF, 0xFF, 0x70, 0x03, 0x2A, 0x03, 0x74, 0x10, 
-    0xE4, 0xAD, 0xCA, 0x80, 0x70, 0x01, 0x22, 0x03, 0x74, 0x12, 0xE4, 0xA9, 0xC2, 0x80, 0x24, 0x41, 
-    0x2E, 0x03, 0x74, 0x13, 0xE4, 0xAF, 0xCE, 0x80, 0x20, 0x0A, 0x67, 0x04, 0x7E, 0x01, 0x7A, 0x03, 
-    0x4A, 0x87, 0x66, 0x04, 0x28, 0x2B, 0x00, 0x34, 0xB9, 0xEE, 0xFF, 0xF4, 0x6D, 0x18, 0x20, 0x53, 
-    0x20, 0x68, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x33, 0xCA, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xA2, 0xDA, 0x50, 0x4F, 0x4A, 0x87, 0x67, 0x00, 0x00, 0xC6, 0x20, 0x53, 0x22, 0x68, 
-    0x00, 0x20, 0x26, 0x31, 0x4C, 0x00, 0x20, 0x43, 0x28, 0x28, 0x00, 0x04, 0x24, 0x44, 0x50, 0x8A, 
-    0x58, 0x8A, 0x99, 0xCC, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x08, 0x66, 0x10, 0x4A, 0xAD, 0xEC, 0xE4, 
-    0x67, 0x0A, 0x28, 0x2D, 0xEC, 0xE4, 0x24, 0x44, 0x50, 0x8A, 0x58, 0x8A, 0x70, 0x20, 0xC0, 0xAA, 
-    0x00, 0x08, 0x67, 0x38, 0xB7, 0xEA, 0x00, 0x04, 0x66, 0x32, 0x20, 0x43, 0x11, 0x7C, 0x00, 0x20, 
-    0x00, 0x08, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x68, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xA1, 0xE4, 
-    0x2E, 0x08, 0x4A, 0x87, 0x50, 0x4F, 0x67, 0x0C, 0x20, 0x47, 0x28, 0x28, 0x00, 0x04, 0x24, 0x44, 
-    0x50, 0x8A, 0x58, 0x8A, 0x20, 0x43, 0x11, 0x7C, 0x00, 0x21, 0x00, 0x08, 0x70, 0x01, 0xC0, 0xAA, 
-    0x00, 0x08, 0x67, 0x5A, 0x70, 0x03, 0xBA, 0x80, 0x66, 0x40, 0x20, 0x2A, 0x00, 0x08, 0x02, 0x80, 
-    0x00, 0x00, 0x10, 0x00, 0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0xB0, 0xAE, 0xFF, 0xFC, 
-    0x67, 0x28, 0x20, 0x43, 0x28, 0x50, 0x20, 0x0C, 0x67, 0x20, 0x48, 0x6C, 0x00, 0x08, 0x48, 0x68, 
-    0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xBD, 0x14, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0C, 0x26, 0x0C, 
-    0x24, 0x43, 0x24, 0x6A, 0x00, 0x04, 0x50, 0x8A, 0x58, 0x8A, 0x28, 0x6A, 0x00, 0x04, 0x60, 0x0E, 
-    0x20, 0x53, 0x22, 0x68, 0x00, 0x28, 0x28, 0x71, 0x4C, 0x00, 0x76, 0x00, 0x95, 0xCA, 0x20, 0x0C, 
-    0x67, 0x00, 0x00, 0xE2, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x00, 0x00, 0xC6, 0x20, 0x6B, 0x00, 0x10, 
-    0xB1, 0xEC, 0x00, 0x10, 0x67, 0x00, 0x00, 0xCE, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEC, 0x00, 0x10, 
-    0x66, 0x26, 0x20, 0x54, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x6C, 0x00, 0x44, 0x20, 0x53, 0x2F, 0x28, 
-    0x00, 0x04, 0x48, 0x6B, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x24, 0xE0, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xA1, 0xBC, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x46, 0x20, 0x2C, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x02, 0x00, 0x67, 0x16, 0x20, 0x0A, 0x67, 0x12, 0x20, 0x2A, 0x00, 0x08, 0x02, 0x80, 0x02, 0x00, 
-    0x01, 0x00, 0x0C, 0x80, 0x02, 0x00, 0x00, 0x00, 0x67, 0x7A, 0x20, 0x54, 0x2F, 0x28, 0x00, 0x04, 
-    0x48, 0x6C, 0x00, 0x44, 0x20, 0x53, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x6B, 0x00, 0x44, 0x48, 0x79, 
-    0x00, 0x00, 0x24, 0x8F, 0x61, 0xFF, 0xFF, 0xFF, 0xA1, 0x74, 0x4F, 0xEF, 0x00, 0x14, 0x20, 0x46, 
-    0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x9C, 0x94, 0x58, 0x4F, 0x2F, 0x00, 0xB4, 0xFC, 0x00, 0x00, 
-    0x67, 0x04, 0x20, 0x12, 0x60, 0x02, 0x70, 0x00, 0x2F, 0x00, 0x4A, 0x83, 0x67, 0x08, 0x20, 0x43, 
-    0x50, 0x88, 0x54, 0x88, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x24, 0x58, 0x48, 0x50, 0x48, 0x79, 
-    0x00, 0x00, 0x24, 0x62, 0x61, 0xFF, 0xFF, 0xFF, 0xA1, 0x34, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x14, 
-    0xB9, 0xCB, 0x67, 0x10, 0x2F, 0x03, 0x2F, 0x0C, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x50, 0x86, 0xBC, 0xAE, 0xFF, 0xF8, 0x65, 0x00, 0xFD, 0x64, 0x4C, 0xDF, 
-    0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x20, 0x6E, 0x00, 0x08, 
-    0x70, 0x04, 0x81, 0xA8, 0x00, 0x30, 0x24, 0x68, 0x00, 0x0C, 0x60, 0x18, 0x70, 0x04, 0x20, 0x52, 
-    0xC0, 0xA8, 0x00, 0x30, 0x66, 0x0A, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x58, 0x4F, 
-    0x24, 0x6A, 0x00, 0x04, 0x20, 0x0A, 0x66, 0xE4, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x1F, 0x38, 0x2F, 0x2D, 0xEE, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 
-    0x41, 0xED, 0xEE, 0x8C, 0x2D, 0x48, 0xFF, 0xF8, 0x28, 0x6D, 0xEE, 0x8C, 0x58, 0x4F, 0x60, 0x00, 
-    0x01, 0x80, 0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xFC, 0x70, 0x04, 0xC0, 0xAC, 0x00, 0x30, 0x66, 0x0E, 
-    0x20, 0x2C, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x00, 0x00, 0xFE, 0x20, 0x4C, 
-    0x50, 0x88, 0x2D, 0x48, 0xFF, 0xF8, 0x4A, 0xAC, 0x00, 0x24, 0x6F, 0x00, 0x01, 0x50, 0x2F, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xA9, 0x2A, 0x20, 0x2C, 0x00, 0x24, 0xE7, 0x88, 0x2F, 0x00, 0x2F, 0x2C, 
-    0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0xA9, 0xEE, 0x24, 0x48, 0x28, 0x0A, 0x20, 0x2C, 0x00, 0x24, 
-    0xE7, 0x88, 0x20, 0x4A, 0xD1, 0xC0, 0x2E, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xB4, 
-    0x20, 0x44, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x9B, 0x70, 0x26, 0x00, 0x20, 0x03, 
-    0x72, 0x1F, 0xE2, 0xA8, 0x58, 0x4F, 0x67, 0x14, 0x2C, 0x03, 0x02, 0x86, 0x00, 0xFF, 0xFF, 0xFF, 
-    0x70, 0x01, 0x2A, 0x03, 0x74, 0x1B, 0xE4, 0xAD, 0xCA, 0x80, 0x60, 0x2C, 0x2C, 0x03, 0x02, 0x86, 
-    0x00, 0x00, 0xFF, 0xFF, 0x70, 0x01, 0x22, 0x03, 0x74, 0x12, 0xE4, 0xA9, 0xC2, 0x80, 0x4A, 0x81, 
-    0x66, 0x12, 0x70, 0x01, 0x22, 0x03, 0x74, 0x13, 0xE4, 0xA9, 0xC2, 0x80, 0x4A, 0x81, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x2A, 0x00, 0x4A, 0x85, 0x67, 0x54, 0x20, 0x54, 0x22, 0x68, 
-    0x00, 0x20, 0x24, 0x71, 0x6C, 0x00, 0x26, 0x6A, 0x00, 0x04, 0x50, 0x8B, 0x58, 0x8B, 0x70, 0x20, 
-    0xC0, 0xAB, 0x00, 0x08, 0x67, 0x32, 0xB9, 0xEB, 0x00, 0x04, 0x66, 0x2C, 0x15, 0x7C, 0x00, 0x20, 
-    0x00, 0x08, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x6A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x9F, 0x24, 
-    0x26, 0x08, 0x4A, 0x83, 0x50, 0x4F, 0x67, 0x0A, 0x26, 0x43, 0x26, 0x6B, 0x00, 0x04, 0x50, 0x8B, 
-    0x58, 0x8B, 0x15, 0x7C, 0x00, 0x21, 0x00, 0x08, 0x00, 0xAB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x50, 0x84, 0xB8, 0x87, 0x65, 0x00, 0xFF, 0x4A, 0x60, 0x62, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x10, 
-    0xC0, 0x81, 0x67, 0x42, 0x4A, 0xAC, 0x00, 0x18, 0x6F, 0x3C, 0x4A, 0x94, 0x67, 0x26, 0x20, 0x54, 
-    0x20, 0x68, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x6C, 0x00, 0x44, 0x20, 0x54, 0x2F, 0x28, 
-    0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x24, 0x1F, 0x61, 0xFF, 0xFF, 0xFF, 0x9F, 0x60, 0x4F, 0xEF, 
-    0x00, 0x10, 0x60, 0x12, 0x48, 0x6C, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x23, 0xF2, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x9F, 0x4A, 0x50, 0x4F, 0x20, 0x2C, 0x00, 0x18, 0xD1, 0xAD, 0xEF, 0x2C, 0x70, 0x08, 
-    0x81, 0xAC, 0x00, 0x30, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0xAE, 0xFF, 0xFC, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x0C, 0x66, 0x00, 0xFE, 0x7E, 0x2B, 0x6E, 0xFF, 0xF8, 0xF2, 0xC4, 0x4C, 0xDF, 0x1C, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x2F, 0x04, 0x74, 0x04, 0x78, 0x1F, 0xC8, 0xAF, 0x00, 0x0C, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x66, 0x0C, 0x60, 0x02, 0xD4, 0x82, 0x53, 0x84, 0x70, 0x02, 0xB8, 0x80, 0x6C, 0xF6, 
-    0x53, 0x82, 0x20, 0x2F, 0x00, 0x08, 0xD0, 0x82, 0x22, 0x02, 0x46, 0x81, 0xC2, 0x80, 0x20, 0x01, 
-    0x28, 0x1F, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x80, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x08, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x20, 0x2C, 0x00, 0x38, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xA2, 0xA8, 0x2D, 0x48, 0xFF, 0xFC, 0x29, 0x48, 0x00, 0x0C, 0x20, 0x4C, 0x50, 0x88, 0x2B, 0x48, 
-    0xEE, 0x90, 0x24, 0x6C, 0x00, 0x04, 0x58, 0x4F, 0x60, 0x00, 0x01, 0x32, 0x26, 0x4A, 0x47, 0xEB, 
-    0x00, 0x44, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x00, 0x00, 0xD4, 0x41, 0xED, 0xEE, 0xA4, 0xB9, 0xC8, 
-    0x66, 0x00, 0x00, 0xCA, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x14, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x10, 0x00, 0x00, 0x67, 0x08, 0x26, 0x6D, 0xF2, 0xEA, 
-    0x60, 0x00, 0x00, 0xDC, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x5C, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x20, 0x00, 0x00, 0x67, 0x50, 0x48, 0x79, 0x00, 0x00, 
-    0x2E, 0x7C, 0x42, 0xA7, 0x2F, 0x3C, 0x01, 0x00, 0x00, 0x02, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC1, 0x68, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x0C, 0x48, 0x6A, 
-    0x00, 0x44, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x9F, 0xD0, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC1, 0x72, 0x25, 0x48, 0x00, 0x04, 0x70, 0x40, 0x81, 0xAA, 0x00, 0x30, 
-    0x53, 0xAC, 0x00, 0x38, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x8E, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x66, 0x08, 0x2A, 0x00, 0x04, 0x00, 0x2E, 0x66, 0x08, 
-    0x41, 0xF9, 0x00, 0x00, 0x23, 0xE2, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x23, 0xE9, 0x48, 0x50, 
-    0x2F, 0x2D, 0xED, 0xB4, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x9F, 0x7E, 0x26, 0x48, 0x00, 0xAA, 
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x32, 0x70, 0x04, 0xB0, 0xAD, 
-    0xED, 0xCC, 0x66, 0x2A, 0x41, 0xED, 0xEE, 0xA4, 0xB9, 0xC8, 0x66, 0x22, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x16, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x10, 
-    0x00, 0x00, 0x67, 0x0A, 0x4A, 0x2D, 0xEE, 0x05, 0x67, 0x04, 0x26, 0x6D, 0xF2, 0xEA, 0x2F, 0x0B, 
-    0x2F, 0x0A, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x8A, 0x20, 0x6E, 0xFF, 0xFC, 0x58, 0xAE, 
-    0xFF, 0xFC, 0x20, 0x8A, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0x00, 
-    0xFE, 0xCC, 0x2D, 0x6E, 0xFF, 0xFC, 0xFF, 0xEC, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x2F, 0x2C, 
-    0x00, 0x38, 0x2F, 0x2E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0xCB, 0x3E, 0x28, 0x07, 0x7C, 0x00, 
-    0x42, 0xAE, 0xFF, 0xDC, 0x42, 0xAE, 0xFF, 0xE0, 0x42, 0xAE, 0xFF, 0x98, 0x42, 0xAE, 0xFF, 0x94, 
-    0x26, 0x6E, 0xFF, 0xFC, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x90, 0x20, 0x53, 0x2A, 0x28, 0x00, 0x2C, 
-    0x70, 0xFC, 0x20, 0x53, 0x26, 0x28, 0x00, 0x18, 0x56, 0x83, 0xC6, 0x80, 0x20, 0x05, 0x02, 0x80, 
-    0x00, 0x00, 0x20, 0x00, 0x66, 0x18, 0x4A, 0x86, 0x66, 0x14, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x0C, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB9, 0xC8, 0x66, 0x04, 0x28, 0x2D, 0xED, 0xD4, 0x7C, 0x01, 0x24, 0x44, 
-    0x2F, 0x05, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xEE, 0x28, 0x00, 0x20, 0x04, 0x90, 0x8A, 
-    0xD6, 0x80, 0x28, 0x0A, 0xD8, 0x83, 0x70, 0x01, 0x20, 0x53, 0xC0, 0xA8, 0x00, 0x30, 0x50, 0x4F, 
-    0x66, 0x34, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x06, 0xD7, 0xAE, 0xFF, 0x94, 
-    0x60, 0x24, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x06, 0xD7, 0xAE, 0xFF, 0x98, 
-    0x60, 0x14, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x06, 0xD7, 0xAE, 0xFF, 0xDC, 
-    0x60, 0x04, 0xD7, 0xAE, 0xFF, 0xE0, 0x58, 0x8B, 0xB7, 0xEE, 0xFF, 0xEC, 0x65, 0x00, 0xFF, 0x6C, 
-    0x42, 0xAE, 0xFF, 0x90, 0x4A, 0xAD, 0xED, 0x18, 0x6F, 0x00, 0x00, 0xA0, 0x41, 0xED, 0xEE, 0xA4, 
-    0xB9, 0xC8, 0x66, 0x5C, 0x76, 0x00, 0x26, 0x6D, 0xEE, 0xF4, 0x60, 0x14, 0x24, 0x53, 0x60, 0x08, 
-    0xD6, 0xAB, 0x00, 0x08, 0x24, 0x6A, 0x00, 0x54, 0x20, 0x0A, 0x66, 0xF4, 0x26, 0x6B, 0x00, 0x04, 
-    0x20, 0x0B, 0x66, 0xE8, 0x20, 0x2D, 0xED, 0x14, 0xD0, 0xAD, 0xED, 0x18, 0xD0, 0x83, 0xE5, 0x88, 
-    0x22, 0x2D, 0xED, 0x18, 0xEB, 0x89, 0xD2, 0x80, 0x2D, 0x41, 0xFF, 0x90, 0x4A, 0x2D, 0xEE, 0x03, 
-    0x67, 0x0E, 0x20, 0x2D, 0xED, 0xD4, 0xD0, 0xAE, 0xFF, 0xE0, 0x2B, 0x40, 0xEE, 0xE4, 0x60, 0x42, 
-    0x20, 0x07, 0xD0, 0xAE, 0xFF, 0xDC, 0xD0, 0xAE, 0xFF, 0xE0, 0x2B, 0x40, 0xEE, 0xE4, 0x60, 0x32, 
-    0x70, 0x01, 0xC0, 0xAC, 0x00, 0x70, 0x67, 0x2A, 0x20, 0x2C, 0x00, 0x28, 0xE5, 0x88, 0x2D, 0x40, 
-    0xFF, 0x90, 0x29, 0x6D, 0xEE, 0xE4, 0x00, 0x40, 0x20, 0x6C, 0x00, 0x4C, 0x20, 0x28, 0x00, 0x08, 
-    0xE5, 0x88, 0x22, 0x2E, 0xFF, 0x90, 0x58, 0x81, 0x74, 0x20, 0xD2, 0x82, 0xD2, 0x80, 0xD3, 0xAD, 
-    0xEE, 0xE4, 0x20, 0x2E, 0xFF, 0x90, 0xD1, 0xAE, 0xFF, 0xE0, 0x28, 0x07, 0x2C, 0x07, 0x2D, 0x47, 
-    0xFF, 0xF0, 0x20, 0x2E, 0xFF, 0xDC, 0xD0, 0xAE, 0xFF, 0xE0, 0xD0, 0xAE, 0xFF, 0x98, 0x2D, 0x40, 
-    0xFF, 0x8C, 0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x00, 0x00, 0x96, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x67, 0x16, 0x4A, 0x2D, 0xEE, 0x06, 0x66, 0x04, 0x2C, 0x2E, 0xFF, 0xDC, 0x20, 0x06, 0xD0, 0xAE, 
-    0xFF, 0xE0, 0x2D, 0x40, 0xFF, 0xF0, 0x60, 0x78, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x08, 0x41, 0xED, 
-    0xEE, 0xA4, 0xB9, 0xC8, 0x67, 0x08, 0x20, 0x04, 0xD0, 0xAE, 0xFF, 0xDC, 0x60, 0x04, 0x20, 0x2D, 
-    0xED, 0xD4, 0x2C, 0x00, 0x20, 0x06, 0xD0, 0xAE, 0xFF, 0xE0, 0x2D, 0x40, 0xFF, 0xF0, 0x4A, 0x2D, 
-    0xEE, 0x03, 0x67, 0x34, 0xBC, 0x84, 0x6D, 0x0A, 0x20, 0x04, 0xD0, 0xAE, 0xFF, 0xDC, 0xBC, 0x80, 
-    0x6D, 0x10, 0xBC, 0x84, 0x6C, 0x22, 0x20, 0x2E, 0xFF, 0xF0, 0xD0, 0xAE, 0xFF, 0x98, 0xB0, 0x84, 
-    0x6F, 0x16, 0x2F, 0x07, 0x2F, 0x2D, 0xED, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x23, 0xB3, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x9B, 0x6A, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x12, 0x41, 0xED, 
-    0xEE, 0xA4, 0xB9, 0xC8, 0x66, 0x0A, 0x2D, 0x6E, 0xFF, 0xDC, 0xFF, 0x8C, 0x42, 0xAE, 0xFF, 0x90, 
-    0x42, 0xAE, 0xFF, 0xE8, 0x42, 0xAE, 0xFF, 0xF8, 0x42, 0xAE, 0xFF, 0xE4, 0x29, 0x44, 0x00, 0x2C, 
-    0x29, 0x46, 0x00, 0x30, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x34, 0x29, 0x47, 0x00, 0x44, 0x26, 0x6E, 
-    0xFF, 0xFC, 0x60, 0x00, 0x02, 0xB8, 0x24, 0x53, 0x2A, 0x2A, 0x00, 0x2C, 0x70, 0xFC, 0x26, 0x2A, 
-    0x00, 0x18, 0x56, 0x83, 0xC6, 0x80, 0x70, 0x30, 0xC0, 0xAA, 0x00, 0x30, 0x2D, 0x40, 0xFF, 0x88, 
-    0x4A, 0xAE, 0xFF, 0x88, 0x67, 0x00, 0x01, 0x00, 0x2E, 0x00, 0x20, 0x07, 0x46, 0x80, 0xC0, 0xAA, 
-    0x00, 0x30, 0x25, 0x40, 0x00, 0x30, 0x70, 0x10, 0xC0, 0x87, 0x67, 0x3E, 0x20, 0x4B, 0x58, 0x88, 
-    0xB1, 0xEE, 0xFF, 0xEC, 0x64, 0x34, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0xB0, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC7, 0x64, 0x2D, 0x40, 0xFF, 0x80, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC7, 0x4E, 0xB0, 0xAE, 0xFF, 0x80, 0x50, 0x4F, 0x6E, 0x44, 0x70, 0x20, 0xC0, 0x87, 0x67, 0x00, 
-    0x00, 0xA2, 0xB7, 0xEE, 0xFF, 0xFC, 0x63, 0x00, 0x00, 0x9A, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0xB0, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC7, 0x24, 0x2D, 0x40, 0xFF, 0x80, 
-    0x20, 0x6B, 0xFF, 0xFC, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC7, 0x0A, 0xB0, 0xAE, 0xFF, 0x80, 0x50, 0x4F, 0x6F, 0x64, 0x70, 0x10, 
-    0xC0, 0x87, 0x4A, 0x80, 0x66, 0x06, 0x20, 0x6B, 0xFF, 0xFC, 0x60, 0x04, 0x20, 0x6B, 0x00, 0x04, 
-    0x2D, 0x48, 0xFF, 0xF4, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 
-    0x20, 0x2A, 0x00, 0x2C, 0x22, 0x28, 0x00, 0x2C, 0xB3, 0x80, 0x02, 0x80, 0x00, 0x00, 0xB0, 0x00, 
-    0x2F, 0x00, 0x48, 0x78, 0x00, 0x40, 0x48, 0x6E, 0xFF, 0x9C, 0x61, 0xFF, 0xFF, 0xFF, 0xB4, 0x8A, 
-    0x48, 0x6E, 0xFF, 0x9C, 0x20, 0x6E, 0xFF, 0xF4, 0x48, 0x68, 0x00, 0x44, 0x20, 0x50, 0x2F, 0x28, 
-    0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x23, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0x9A, 0x10, 0x4F, 0xEF, 
-    0x00, 0x20, 0x8F, 0xAA, 0x00, 0x30, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x30, 0x66, 0x00, 0x01, 0x2C, 
-    0x2E, 0x2A, 0x00, 0x28, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x2A, 0x2F, 0x05, 
-    0x2F, 0x2E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xCE, 0x25, 0x40, 0x00, 0x28, 0x20, 0x2A, 
-    0x00, 0x28, 0x90, 0xAE, 0xFF, 0xF0, 0x25, 0x40, 0x00, 0x1C, 0xD6, 0xAA, 0x00, 0x1C, 0xD7, 0xAE, 
-    0xFF, 0xF0, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xCA, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 
-    0x67, 0x72, 0x20, 0x6A, 0x00, 0x04, 0xB1, 0xEE, 0xFF, 0xE8, 0x67, 0x36, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x66, 0x2C, 0x2F, 0x2E, 0xFF, 0xE4, 0x48, 0x79, 0x00, 0x00, 0x2D, 0xF8, 0x48, 0x6A, 0x00, 0x44, 
-    0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0x9B, 0x2E, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xC8, 0xE6, 0x4F, 0xEF, 0x00, 0x0C, 0x42, 0xAE, 
-    0xFF, 0xF8, 0x2F, 0x05, 0x2F, 0x2E, 0xFF, 0xF8, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x5A, 0x25, 0x40, 
-    0x00, 0x28, 0x20, 0x2A, 0x00, 0x28, 0x90, 0xAE, 0xFF, 0xF8, 0x25, 0x40, 0x00, 0x1C, 0xD6, 0xAA, 
-    0x00, 0x1C, 0xD7, 0xAE, 0xFF, 0xF8, 0xD7, 0xAE, 0xFF, 0xE4, 0x2D, 0x6A, 0x00, 0x04, 0xFF, 0xE8, 
-    0x50, 0x4F, 0x60, 0x4C, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x22, 0x2F, 0x05, 
-    0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x25, 0x40, 0x00, 0x28, 0x20, 0x2A, 0x00, 0x28, 
-    0x90, 0x84, 0x25, 0x40, 0x00, 0x1C, 0xD6, 0xAA, 0x00, 0x1C, 0xD8, 0x83, 0x50, 0x4F, 0x60, 0x20, 
-    0x2F, 0x05, 0x2F, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xFE, 0x25, 0x40, 0x00, 0x28, 0x20, 0x2A, 
-    0x00, 0x28, 0x90, 0x86, 0x25, 0x40, 0x00, 0x1C, 0xD6, 0xAA, 0x00, 0x1C, 0xDC, 0x83, 0x50, 0x4F, 
-    0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x67, 0x20, 0xBE, 0xAA, 0x00, 0x28, 0x67, 0x1A, 
-    0x2F, 0x2A, 0x00, 0x28, 0x2F, 0x07, 0x48, 0x6A, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x23, 0x0F, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x98, 0xD8, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 
-    0x00, 0x04, 0x41, 0xE8, 0x00, 0x28, 0x2D, 0x48, 0xFF, 0x84, 0x70, 0xFF, 0xB0, 0x90, 0x66, 0x04, 
-    0x20, 0xAA, 0x00, 0x28, 0xB5, 0xED, 0xEE, 0x24, 0x66, 0x34, 0x41, 0xED, 0xEE, 0xA4, 0xB9, 0xC8, 
-    0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x22, 0xEA, 0x61, 0xFF, 0xFF, 0xFF, 0x98, 0xA0, 0x58, 0x4F, 
-    0x20, 0x6A, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x04, 0xEE, 0x20, 0x20, 0x2D, 0xEE, 0x1C, 0xD0, 0xAA, 
-    0x00, 0x28, 0x20, 0x6D, 0xEE, 0x20, 0x90, 0xA8, 0x00, 0x28, 0x2B, 0x40, 0xEE, 0x18, 0x20, 0x6A, 
-    0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0xD7, 0xA8, 0x00, 0x18, 0x58, 0x8B, 0xB7, 0xEE, 0xFF, 0xEC, 
-    0x65, 0x00, 0xFD, 0x44, 0x20, 0x6D, 0xEE, 0x90, 0x42, 0x90, 0x26, 0x2C, 0x00, 0x3C, 0x0C, 0x2D, 
-    0x00, 0x02, 0xEE, 0x06, 0x66, 0x02, 0x52, 0x83, 0x20, 0x03, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x9C, 0x26, 0x29, 0x48, 0x00, 0x10, 0x2D, 0x48, 0xFF, 0xFC, 0x24, 0x6C, 0x00, 0x08, 
-    0x58, 0x4F, 0x60, 0x78, 0x20, 0x6E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x8A, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x66, 0x24, 0x48, 0x78, 0xFF, 0xFF, 0x20, 0x2A, 0x00, 0x28, 0xD0, 0xAA, 0x00, 0x18, 
-    0x2F, 0x00, 0x2F, 0x2A, 0x00, 0x28, 0x48, 0x6A, 0x00, 0x44, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xC8, 0x68, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x40, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x3A, 0x41, 0xED, 
-    0xEE, 0xA4, 0xB9, 0xC8, 0x66, 0x32, 0x2F, 0x2D, 0xF2, 0xEA, 0x20, 0x6A, 0x00, 0x04, 0x48, 0x68, 
-    0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xB2, 0xD4, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1A, 0x20, 0x6D, 
-    0xED, 0x04, 0x26, 0x68, 0x00, 0x04, 0x70, 0x05, 0x81, 0xAB, 0x00, 0x14, 0x20, 0x2A, 0x00, 0x18, 
-    0x90, 0xAD, 0xE9, 0x76, 0x27, 0x40, 0x00, 0x0C, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0x84, 
-    0x2F, 0x2C, 0x00, 0x3C, 0x2F, 0x2C, 0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xC5, 0x8C, 0x2D, 0x6C, 
-    0x00, 0x10, 0xFF, 0xFC, 0x26, 0x2C, 0x00, 0x3C, 0x53, 0x83, 0x50, 0x4F, 0x60, 0x0E, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x70, 0x3C, 0x00, 0x21, 0x43, 0x00, 0x34, 0x53, 0x83, 0x4A, 0x83, 0x6C, 0xEE, 
-    0x29, 0x6E, 0xFF, 0xDC, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xE0, 0x00, 0x18, 0x29, 0x6E, 0xFF, 0x98, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0x94, 0x00, 0x20, 0x20, 0x2C, 0x00, 0x44, 0xD0, 0xAE, 0xFF, 0x8C, 
-    0x90, 0xAE, 0xFF, 0x90, 0x29, 0x40, 0x00, 0x48, 0x20, 0x2E, 0xFF, 0x8C, 0x4C, 0xDF, 0x1C, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x1E, 0x38, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x66, 0x00, 0x02, 0x30, 0x78, 0x00, 0x18, 0x2D, 0xED, 0xEE, 0x7C, 0x00, 0x26, 0x6D, 0xEF, 0x3C, 
-    0x60, 0x00, 0x02, 0x0C, 0x28, 0x6B, 0x00, 0x04, 0x70, 0x01, 0xC0, 0xAC, 0x00, 0x14, 0x66, 0x00, 
-    0x01, 0xFC, 0x26, 0x2C, 0x00, 0x0C, 0x24, 0x4B, 0x50, 0x8A, 0x1D, 0x5A, 0xFF, 0x00, 0x1D, 0x5A, 
-    0xFF, 0x01, 0x42, 0x2E, 0xFF, 0x02, 0x0C, 0x12, 0x00, 0x40, 0x66, 0x22, 0x70, 0x40, 0xC0, 0x84, 
-    0x67, 0x00, 0x00, 0xEA, 0x48, 0x78, 0x00, 0xFE, 0x48, 0x6A, 0x00, 0x01, 0x48, 0x6E, 0xFF, 0x02, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x94, 0xCA, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xD0, 0x0C, 0x12, 
-    0x00, 0x5F, 0x66, 0x2A, 0x70, 0x01, 0xC0, 0x84, 0x67, 0x00, 0x00, 0xC2, 0x48, 0x78, 0x00, 0xFE, 
-    0x48, 0x6A, 0x00, 0x01, 0x48, 0x6E, 0xFF, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0x94, 0xA2, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0xA8, 0x0C, 0x12, 0x00, 0x5F, 0x67, 0x06, 0x52, 0x8A, 0x4A, 0x12, 
-    0x66, 0xF4, 0x0C, 0x12, 0x00, 0x5F, 0x66, 0x72, 0x48, 0x78, 0x01, 0x00, 0x48, 0x6B, 0x00, 0x08, 
-    0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x94, 0x76, 0x0C, 0x2A, 0x00, 0x5F, 0x00, 0x01, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x24, 0x70, 0x08, 0xC0, 0x84, 0x67, 0x1E, 0x20, 0x4B, 0x50, 0x88, 
-    0x22, 0x4A, 0x93, 0xC8, 0xB2, 0xFC, 0x01, 0x00, 0x64, 0x10, 0x20, 0x4B, 0x50, 0x88, 0x22, 0x4A, 
-    0x93, 0xC8, 0x41, 0xEE, 0xFF, 0x00, 0x42, 0x30, 0x98, 0x00, 0x0C, 0x2A, 0x00, 0x5F, 0x00, 0x01, 
-    0x67, 0x4A, 0x70, 0x04, 0xC0, 0x84, 0x67, 0x44, 0x20, 0x4B, 0x50, 0x88, 0x22, 0x4A, 0x93, 0xC8, 
-    0xB2, 0xFC, 0x01, 0x00, 0x64, 0x36, 0x20, 0x4B, 0x50, 0x88, 0x22, 0x4A, 0x93, 0xC8, 0x41, 0xEE, 
-    0xFF, 0x00, 0x11, 0xBC, 0x00, 0x2E, 0x98, 0x00, 0x60, 0x22, 0x70, 0x02, 0xC0, 0x84, 0x67, 0x1C, 
-    0x1D, 0x7C, 0x00, 0x5F, 0xFF, 0x02, 0x48, 0x78, 0x00, 0xFD, 0x48, 0x6B, 0x00, 0x0A, 0x48, 0x6E, 
-    0xFF, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x93, 0xF8, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x6D, 0xEF, 0x4C, 
-    0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x95, 0x7A, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 
-    0x67, 0x44, 0x70, 0x01, 0x20, 0x6A, 0x00, 0x04, 0xC0, 0xA8, 0x00, 0x14, 0x67, 0x38, 0x20, 0x6A, 
-    0x00, 0x04, 0x41, 0xE8, 0x00, 0x0C, 0x43, 0xEC, 0x00, 0x0C, 0x70, 0x04, 0x22, 0xD8, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x08, 0x04, 0x00, 0x07, 0x66, 0x00, 0x00, 0xB4, 0x48, 0x6E, 0xFF, 0x02, 0x48, 0x6B, 
-    0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x22, 0xAE, 0x61, 0xFF, 0xFF, 0xFF, 0x95, 0xD0, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0x98, 0x48, 0x6D, 0xEF, 0x58, 0x48, 0x6B, 0x00, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x95, 0x20, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x67, 0x46, 0x26, 0x6A, 0x00, 0x04, 
-    0xB6, 0xAB, 0x00, 0x18, 0x6F, 0x2C, 0x08, 0x2B, 0x00, 0x04, 0x00, 0x2E, 0x67, 0x06, 0x27, 0x43, 
-    0x00, 0x18, 0x60, 0x1E, 0x20, 0x53, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x6A, 0x00, 0x08, 0x48, 0x6A, 
-    0x00, 0x08, 0x48, 0x79, 0x00, 0x00, 0x22, 0x6E, 0x61, 0xFF, 0xFF, 0xFF, 0x95, 0x80, 0x4F, 0xEF, 
-    0x00, 0x10, 0x70, 0x03, 0x29, 0x40, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x10, 0x42, 0xAC, 0x00, 0x0C, 
-    0x60, 0x3A, 0x4A, 0x83, 0x67, 0x36, 0x70, 0x10, 0xC0, 0xAC, 0x00, 0x14, 0x66, 0x2E, 0x70, 0x03, 
-    0x29, 0x40, 0x00, 0x14, 0x70, 0x02, 0xB6, 0x80, 0x6F, 0x04, 0x7A, 0x03, 0x60, 0x0C, 0x70, 0x02, 
-    0xB6, 0x80, 0x66, 0x04, 0x7A, 0x01, 0x60, 0x02, 0x7A, 0x00, 0x20, 0x06, 0xD0, 0x85, 0x22, 0x05, 
-    0x46, 0x81, 0xC2, 0x80, 0x2C, 0x01, 0x29, 0x46, 0x00, 0x0C, 0xDC, 0x83, 0x26, 0x54, 0x20, 0x0B, 
-    0x66, 0x00, 0xFD, 0xF2, 0x4A, 0xAD, 0xEE, 0x94, 0x67, 0x08, 0x20, 0x6D, 0xEE, 0x94, 0x21, 0x46, 
-    0x00, 0x18, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x66, 0x06, 0x4A, 0xAD, 0xED, 0x18, 0x66, 0x06, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x75, 
-    0x26, 0x6D, 0xEF, 0x3C, 0x60, 0x5C, 0x22, 0x6B, 0x00, 0x04, 0x70, 0x01, 0xC0, 0xA9, 0x00, 0x14, 
-    0x67, 0x4E, 0x20, 0x29, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x66, 0x42, 0x4A, 0xA9, 
-    0x00, 0x10, 0x67, 0x3C, 0x20, 0x69, 0x00, 0x10, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x02, 0x00, 0x67, 0x2C, 0x20, 0x69, 0x00, 0x10, 0x28, 0x68, 0x00, 0x10, 0x20, 0x0C, 0x67, 0x20, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB9, 0xC8, 0x67, 0x18, 0x70, 0x01, 0xC0, 0xAC, 0x00, 0x70, 0x67, 0x10, 
-    0x20, 0x2C, 0x00, 0x28, 0x52, 0xAC, 0x00, 0x28, 0x23, 0x40, 0x00, 0x04, 0x52, 0xAD, 0xED, 0x14, 
-    0x26, 0x51, 0x20, 0x0B, 0x66, 0xA0, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x30, 0x26, 0x6D, 0xEC, 0xCC, 0x2F, 0x2D, 0xED, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x90, 0x16, 0x26, 0x80, 0x58, 0x8B, 0x58, 0x4F, 0x60, 0x40, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x90, 0x06, 0x24, 0x80, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x25, 0x40, 
-    0x00, 0x08, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x8F, 0xEC, 0x25, 0x40, 0x00, 0x04, 
-    0x20, 0x4B, 0x22, 0x4A, 0x72, 0x0C, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 
-    0x66, 0xFA, 0x50, 0x8B, 0x58, 0x8B, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x6D, 0xEC, 0xD4, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x9B, 0x30, 0x24, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x66, 0xAE, 0x4C, 0xDF, 0x0C, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xE4, 0x48, 0xE7, 0x1F, 0x38, 0x20, 0x2D, 0xEE, 0xA0, 
-    0x52, 0x80, 0xE7, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x97, 0xDE, 0x2C, 0x08, 0x20, 0x46, 
-    0x20, 0xAD, 0xEE, 0xD0, 0x41, 0xED, 0xF2, 0xA8, 0x22, 0x46, 0x23, 0x48, 0x00, 0x04, 0x7E, 0x01, 
-    0x20, 0x2D, 0xEE, 0x9C, 0x54, 0x80, 0xE7, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x97, 0xBA, 
-    0x26, 0x48, 0x41, 0xED, 0xEE, 0xA4, 0x27, 0x48, 0x00, 0x04, 0x26, 0xAD, 0xEE, 0xD0, 0x7A, 0x01, 
-    0x20, 0x2D, 0xEE, 0xB8, 0xD0, 0xAD, 0xEE, 0xD0, 0xB0, 0xAD, 0xEE, 0xD4, 0x50, 0x4F, 0x67, 0x74, 
-    0x2F, 0x2D, 0xEE, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x22, 0x56, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x96, 
-    0x2F, 0x2D, 0xEE, 0xBC, 0x48, 0x79, 0x00, 0x00, 0x22, 0x42, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x86, 
-    0x20, 0x2D, 0xEE, 0xB8, 0xD0, 0xAD, 0xEE, 0xD0, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x22, 0x30, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x70, 0x4A, 0xAD, 0xEE, 0xC0, 0x4F, 0xEF, 0x00, 0x18, 0x6F, 0x24, 
-    0x2F, 0x2D, 0xEE, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x22, 0x1A, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x56, 
-    0x2F, 0x2D, 0xEE, 0xC0, 0x48, 0x79, 0x00, 0x00, 0x22, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0xC3, 0x46, 
-    0x4F, 0xEF, 0x00, 0x10, 0x41, 0xED, 0xEE, 0xA4, 0x27, 0x48, 0x00, 0x0C, 0x27, 0x6D, 0xEE, 0xD4, 
-    0x00, 0x08, 0x7A, 0x02, 0x26, 0x2D, 0xEE, 0xB8, 0xD6, 0xAD, 0xEE, 0xBC, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x04, 0xD6, 0xAD, 0xEE, 0xC4, 0x4A, 0xAD, 0xF2, 0xB8, 0x67, 0x1C, 0xB6, 0xAD, 0xF2, 0xB8, 
-    0x63, 0x16, 0x2F, 0x03, 0x2F, 0x2D, 0xF2, 0xC0, 0x48, 0x79, 0x00, 0x00, 0x21, 0xCE, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x93, 0x1A, 0x4F, 0xEF, 0x00, 0x0C, 0x2B, 0x43, 0xF2, 0xBC, 0x28, 0x6D, 0xF2, 0xA8, 
-    0x60, 0x00, 0x02, 0x14, 0x26, 0x2C, 0x00, 0x0C, 0x20, 0x46, 0x21, 0x8C, 0x7E, 0x04, 0x20, 0x07, 
-    0x52, 0x87, 0x21, 0x83, 0x0E, 0x00, 0x24, 0x6C, 0x00, 0x04, 0x60, 0x00, 0x01, 0xC0, 0x27, 0xAA, 
-    0x00, 0x44, 0x5E, 0x00, 0x20, 0x05, 0x52, 0x85, 0x27, 0x8A, 0x0E, 0x04, 0x28, 0x2A, 0x00, 0x14, 
-    0xD8, 0xAA, 0x00, 0x18, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x70, 0x67, 0x44, 0x20, 0x2A, 0x00, 0x28, 
-    0xE5, 0x88, 0x2D, 0x40, 0xFE, 0xF0, 0x20, 0x2A, 0x00, 0x48, 0x90, 0xAA, 0x00, 0x44, 0xD0, 0xAE, 
-    0xFE, 0xF0, 0x2D, 0x40, 0xFE, 0xF4, 0x20, 0x2A, 0x00, 0x40, 0xD0, 0xAE, 0xFE, 0xF0, 0x50, 0x80, 
-    0x2D, 0x40, 0xFE, 0xF8, 0x2D, 0x43, 0xFE, 0xFC, 0xD6, 0xAE, 0xFE, 0xF4, 0x48, 0x6E, 0xFE, 0xF4, 
-    0x48, 0x6D, 0xEC, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0x99, 0x3C, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x5A, 
-    0xB6, 0xAA, 0x00, 0x44, 0x67, 0x00, 0x01, 0x48, 0x4A, 0x84, 0x67, 0x00, 0x00, 0xB0, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x0C, 0x2F, 0x2A, 0x00, 0x58, 0x41, 0xEE, 0xFF, 0x00, 0x43, 0xF9, 0x00, 0x00, 
-    0x21, 0xC6, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x00, 0x61, 0xFF, 0x00, 0x00, 0xAD, 0x02, 
-    0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0xF8, 0x2F, 0x2A, 0x00, 0x44, 0x48, 0x6E, 
-    0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC2, 0x2E, 0x48, 0x79, 0x00, 0x00, 0x21, 0xBD, 0x2F, 0x2A, 
-    0x00, 0x58, 0x41, 0xEE, 0xFF, 0x00, 0x43, 0xF9, 0x00, 0x00, 0x21, 0xC6, 0x20, 0x08, 0x10, 0xD9, 
-    0x66, 0xFC, 0x2F, 0x00, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0xC8, 0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 
-    0x00, 0x00, 0xAC, 0xBE, 0x2F, 0x04, 0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC1, 0xF6, 
-    0x48, 0x79, 0x00, 0x00, 0x2E, 0x0C, 0x2F, 0x2A, 0x00, 0x58, 0x41, 0xEE, 0xFF, 0x00, 0x43, 0xF9, 
-    0x00, 0x00, 0x21, 0xB6, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x00, 0x61, 0xFF, 0x00, 0x00, 
-    0xAC, 0x90, 0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0x86, 0x2F, 0x03, 0x48, 0x6E, 
-    0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC1, 0xBE, 0x4F, 0xEF, 0x00, 0x30, 0x4A, 0xAA, 0x00, 0x1C, 
-    0x67, 0x7C, 0x48, 0x79, 0x00, 0x00, 0x21, 0xAB, 0x2F, 0x2A, 0x00, 0x58, 0x41, 0xEE, 0xFF, 0x00, 
-    0x43, 0xF9, 0x00, 0x00, 0x21, 0xC6, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x00, 0x61, 0xFF, 
-    0x00, 0x00, 0xAC, 0x4E, 0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0x44, 0x20, 0x2A, 
-    0x00, 0x44, 0xD0, 0x84, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC1, 0x76, 
-    0x48, 0x79, 0x00, 0x00, 0x21, 0x9E, 0x2F, 0x2A, 0x00, 0x58, 0x41, 0xEE, 0xFF, 0x00, 0x43, 0xF9, 
-    0x00, 0x00, 0x21, 0xC6, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x00, 0x61, 0xFF, 0x00, 0x00, 
-    0xAC, 0x10, 0x50, 0x4F, 0x2F, 0x08, 0x61, 0xFF, 0x00, 0x00, 0xAC, 0x06, 0x2F, 0x2A, 0x00, 0x1C, 
-    0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xC1, 0x3C, 0x4F, 0xEF, 0x00, 0x20, 0x20, 0x2A, 
-    0x00, 0x48, 0x90, 0xAA, 0x00, 0x44, 0x90, 0xAA, 0x00, 0x1C, 0xD6, 0x80, 0x60, 0x0A, 0x20, 0x2A, 
-    0x00, 0x48, 0x90, 0xAA, 0x00, 0x44, 0xD6, 0x80, 0x24, 0x6A, 0x00, 0x68, 0x20, 0x0A, 0x66, 0x00, 
-    0xFE, 0x3E, 0x20, 0x03, 0x90, 0xAC, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x14, 0x4A, 0xAC, 0x00, 0x10, 
-    0x67, 0x22, 0x20, 0x2C, 0x00, 0x10, 0xB0, 0xAC, 0x00, 0x14, 0x64, 0x18, 0x2F, 0x2C, 0x00, 0x14, 
-    0x2F, 0x2C, 0x00, 0x18, 0x48, 0x79, 0x00, 0x00, 0x21, 0xCE, 0x61, 0xFF, 0xFF, 0xFF, 0x90, 0xFE, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x28, 0x54, 0x20, 0x0C, 0x66, 0x00, 0xFD, 0xEA, 0x2F, 0x07, 0x2F, 0x06, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x3A, 0x78, 0x00, 0x50, 0x4F, 0x60, 0x42, 0x20, 0x46, 0x24, 0x70, 
-    0x4E, 0x04, 0x20, 0x04, 0x52, 0x80, 0xE7, 0x88, 0x2D, 0x40, 0xFE, 0xEC, 0x22, 0x46, 0x22, 0x2A, 
-    0x00, 0x14, 0xD2, 0xB1, 0x4E, 0x00, 0xB2, 0xB0, 0x08, 0x00, 0x63, 0x20, 0x20, 0x70, 0x08, 0x04, 
-    0x2F, 0x28, 0x00, 0x18, 0x2F, 0x2A, 0x00, 0x14, 0x2F, 0x2A, 0x00, 0x18, 0x48, 0x79, 0x00, 0x00, 
-    0x21, 0x6C, 0x61, 0xFF, 0xFF, 0xFF, 0x90, 0xA6, 0x4F, 0xEF, 0x00, 0x10, 0x52, 0x84, 0x20, 0x07, 
-    0x53, 0x80, 0xB8, 0x80, 0x6D, 0xB6, 0x2F, 0x05, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0xE0, 
-    0x78, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x1A, 0x24, 0x73, 0x4E, 0x04, 0x70, 0x01, 0xC0, 0xAA, 
-    0x00, 0x70, 0x67, 0x78, 0x26, 0x04, 0x52, 0x83, 0x60, 0x6A, 0x20, 0x2A, 0x00, 0x48, 0xB0, 0xB3, 
-    0x3E, 0x00, 0x63, 0x5E, 0x70, 0x01, 0x20, 0x73, 0x3E, 0x04, 0xC0, 0xA8, 0x00, 0x70, 0x66, 0x28, 
-    0x20, 0x73, 0x3E, 0x04, 0x2F, 0x28, 0x00, 0x58, 0x20, 0x2A, 0x00, 0x48, 0x90, 0xAA, 0x00, 0x44, 
-    0x2F, 0x00, 0x2F, 0x2A, 0x00, 0x58, 0x48, 0x79, 0x00, 0x00, 0x21, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x90, 0x3C, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x2A, 0x20, 0x73, 0x3E, 0x04, 0x22, 0x6A, 0x00, 0x4C, 
-    0xB3, 0xE8, 0x00, 0x4C, 0x67, 0x1C, 0x20, 0x73, 0x3E, 0x04, 0x2F, 0x28, 0x00, 0x58, 0x2F, 0x2A, 
-    0x00, 0x58, 0x48, 0x79, 0x00, 0x00, 0x21, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x90, 0x10, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x52, 0x83, 0xB6, 0x85, 0x6D, 0x92, 0x60, 0x00, 0x00, 0x94, 0x41, 0xED, 0xEE, 0xA4, 
-    0xB5, 0xC8, 0x66, 0x50, 0x20, 0x2D, 0xEE, 0xD4, 0xB0, 0xB3, 0x4E, 0x00, 0x66, 0x46, 0x20, 0x04, 
-    0x52, 0x80, 0xE7, 0x88, 0x2D, 0x40, 0xFE, 0xE8, 0x22, 0x2D, 0xEE, 0xD4, 0xD2, 0xAD, 0xEE, 0xC0, 
-    0xD2, 0xAD, 0xEE, 0xBC, 0xB2, 0xB3, 0x08, 0x00, 0x63, 0x64, 0x20, 0x73, 0x08, 0x04, 0x2F, 0x28, 
-    0x00, 0x58, 0x20, 0x2D, 0xEE, 0xC0, 0xD0, 0xAD, 0xEE, 0xBC, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x20, 0xF2, 0x48, 0x79, 0x00, 0x00, 0x21, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0x8F, 0xB0, 0x4F, 0xEF, 
-    0x00, 0x10, 0x60, 0x3A, 0x20, 0x04, 0x52, 0x80, 0xE7, 0x88, 0x2D, 0x40, 0xFE, 0xE4, 0x22, 0x2A, 
-    0x00, 0x48, 0xB2, 0xB3, 0x08, 0x00, 0x63, 0x26, 0x20, 0x73, 0x08, 0x04, 0x2F, 0x28, 0x00, 0x58, 
-    0x20, 0x2A, 0x00, 0x48, 0x90, 0xAA, 0x00, 0x44, 0x2F, 0x00, 0x2F, 0x2A, 0x00, 0x58, 0x48, 0x79, 
-    0x00, 0x00, 0x21, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0x8F, 0x74, 0x4F, 0xEF, 0x00, 0x10, 0x52, 0x84, 
-    0x20, 0x05, 0x53, 0x80, 0xB8, 0x80, 0x6D, 0x00, 0xFE, 0xE0, 0x4A, 0xAD, 0xED, 0x18, 0x6F, 0x06, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xCA, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x00, 0x01, 0x76, 0x20, 0x2D, 0xEE, 0xD0, 0xD0, 0xAD, 
-    0xEE, 0xB8, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x20, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x16, 
-    0x20, 0x2D, 0xEE, 0xD4, 0xD0, 0xAD, 0xEE, 0xBC, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x20, 0xDD, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0x2D, 0xEE, 0xD8, 0xD0, 0xAD, 0xEE, 0xC0, 0x2F, 0x00, 
-    0x48, 0x79, 0x00, 0x00, 0x20, 0xD8, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0xEA, 0x48, 0x78, 0xFF, 0xFF, 
-    0x20, 0x2D, 0xEE, 0xD0, 0xD0, 0xAD, 0xEE, 0xB8, 0x2F, 0x00, 0x2F, 0x2D, 0xEE, 0xD0, 0x48, 0x79, 
-    0x00, 0x00, 0x20, 0xCE, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x3E, 0x48, 0x78, 0xFF, 0xFF, 
-    0x20, 0x2D, 0xEE, 0xD8, 0xD0, 0xAD, 0xEE, 0xC0, 0xD0, 0xAD, 0xEE, 0x98, 0x2F, 0x00, 0x2F, 0x2D, 
-    0xEE, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x20, 0xC4, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xBF, 0x1A, 
-    0x48, 0x78, 0xFF, 0xFF, 0x20, 0x2D, 0xEE, 0xD8, 0xD0, 0xAD, 0xEE, 0xC0, 0xD0, 0xAD, 0xEE, 0x98, 
-    0x2F, 0x00, 0x2F, 0x2D, 0xEE, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x20, 0xBA, 0x42, 0xA7, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xBE, 0xF6, 0x2F, 0x2D, 0xEE, 0xD0, 0x48, 0x79, 0x00, 0x00, 0x20, 0x98, 0x48, 0x79, 
-    0x00, 0x00, 0x20, 0xA8, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x98, 0x20, 0x2D, 0xEE, 0xD0, 0xD0, 0xAD, 
-    0xEE, 0xB8, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x20, 0x74, 0x48, 0x79, 0x00, 0x00, 0x20, 0x85, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x7C, 0x2F, 0x2D, 0xEE, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x20, 0x52, 
-    0x48, 0x79, 0x00, 0x00, 0x20, 0x62, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x66, 0x20, 0x2D, 0xEE, 0xD8, 
-    0xD0, 0xAD, 0xEE, 0xC0, 0xD0, 0xAD, 0xEE, 0x98, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x20, 0x2D, 
-    0x48, 0x79, 0x00, 0x00, 0x20, 0x3E, 0x61, 0xFF, 0xFF, 0xFF, 0xBE, 0x46, 0x4A, 0xAD, 0xED, 0x18, 
-    0x4F, 0xEF, 0x00, 0x84, 0x6F, 0x1E, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x66, 0x16, 0x20, 0x6D, 
-    0xEC, 0xD0, 0x2F, 0x28, 0x00, 0x28, 0x48, 0x79, 0x00, 0x00, 0x20, 0x1A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xBD, 0xF4, 0x50, 0x4F, 0x20, 0x2D, 0xEE, 0xB8, 0xD0, 0xAD, 0xEE, 0xBC, 0x2F, 0x00, 0x48, 0x79, 
-    0x00, 0x00, 0x20, 0x0E, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0x54, 0x4A, 0x2D, 0xEE, 0x0A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x18, 0x20, 0x2D, 0xEE, 0xD0, 0xD0, 0xAD, 0xEF, 0x20, 0x2F, 0x00, 
-    0x48, 0x79, 0x00, 0x00, 0x20, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0xBD, 0xBA, 0x50, 0x4F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x1E, 0x38, 0x2C, 0x2E, 0x00, 0x08, 0x2A, 0x2D, 
-    0xF2, 0xE2, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x12, 0x4A, 0x2D, 0xEE, 0x0F, 0x66, 0x0C, 
-    0x4A, 0x2D, 0xEE, 0x0A, 0x66, 0x06, 0x06, 0x85, 0x00, 0x00, 0x00, 0x80, 0x2F, 0x05, 0x48, 0x6D, 
-    0xEE, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0xB0, 0xDA, 0x80, 0x4A, 0x2D, 0xEE, 0x0A, 0x50, 0x4F, 
-    0x67, 0x14, 0x20, 0x2D, 0xEE, 0xB8, 0xD0, 0xAD, 0xEE, 0xBC, 0x2B, 0x40, 0xEF, 0x20, 0x20, 0x2D, 
-    0xF1, 0xE4, 0xD1, 0xAD, 0xEE, 0xBC, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x46, 0x20, 0x6D, 0xEE, 0xF4, 
-    0x24, 0x50, 0x42, 0xA7, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x7C, 0x20, 0x2D, 0xED, 0x30, 
-    0x52, 0x80, 0xE5, 0x88, 0x22, 0x2A, 0x00, 0x48, 0x92, 0xAA, 0x00, 0x44, 0xD2, 0x80, 0x20, 0x6D, 
-    0xEC, 0xFC, 0x20, 0x68, 0x00, 0x04, 0x21, 0x41, 0x00, 0x0C, 0x20, 0x2A, 0x00, 0x48, 0x90, 0xAA, 
-    0x00, 0x44, 0x20, 0x6D, 0xED, 0x00, 0x20, 0x68, 0x00, 0x04, 0x21, 0x40, 0x00, 0x0C, 0x50, 0x4F, 
-    0x60, 0x68, 0x26, 0x6D, 0xEE, 0xF4, 0x60, 0x4A, 0x78, 0x00, 0x4A, 0x2D, 0xEE, 0x09, 0x67, 0x02, 
-    0x7A, 0x00, 0x24, 0x53, 0x60, 0x2E, 0x4A, 0xAA, 0x00, 0x24, 0x67, 0x10, 0x2F, 0x2A, 0x00, 0x24, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x20, 0x50, 0x4F, 0x60, 0x14, 0x2F, 0x05, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x12, 0x26, 0x00, 0xB6, 0x84, 0x50, 0x4F, 0x6F, 0x02, 0x28, 0x03, 
-    0x24, 0x6A, 0x00, 0x54, 0x20, 0x0A, 0x66, 0xCE, 0xDA, 0x84, 0xD9, 0xAD, 0xEE, 0x98, 0x26, 0x6B, 
-    0x00, 0x04, 0x20, 0x0B, 0x66, 0xB2, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x66, 0x06, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF8, 0xB4, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x78, 0x20, 0x6D, 0xEF, 0x38, 0x42, 0x90, 
-    0x78, 0x00, 0x26, 0x6D, 0xEF, 0x3C, 0x60, 0x00, 0x01, 0xCA, 0x24, 0x6B, 0x00, 0x04, 0x70, 0x01, 
-    0xC0, 0xAA, 0x00, 0x14, 0x66, 0x00, 0x00, 0xF8, 0x4A, 0x86, 0x67, 0x0E, 0x20, 0x2A, 0x00, 0x14, 
-    0x02, 0x80, 0x20, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x00, 0x70, 0x10, 0xC0, 0xAA, 0x00, 0x14, 
-    0x67, 0x08, 0x42, 0xAA, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xF0, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x16, 
-    0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x00, 0x00, 0xE2, 0x20, 0x2A, 0x00, 0x14, 0x02, 0x80, 0x01, 0x00, 
-    0x00, 0x00, 0x66, 0x00, 0x00, 0xD4, 0x28, 0x6A, 0x00, 0x1C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE2, 0x44, 0x26, 0x00, 0x4A, 0x83, 0x58, 0x4F, 0x67, 0x08, 0x4A, 0x2D, 0xED, 0xFB, 0x67, 0x00, 
-    0x00, 0xB8, 0x4A, 0x84, 0x66, 0x1C, 0x4A, 0x83, 0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x1F, 0xD6, 
-    0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x1F, 0xEC, 0x48, 0x50, 0x61, 0xFF, 0xFF, 0xFF, 0x8C, 0x2E, 
-    0x58, 0x4F, 0x52, 0x84, 0x48, 0x78, 0x01, 0x00, 0x48, 0x6E, 0xFF, 0x00, 0x48, 0x6B, 0x00, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0x79, 0x7A, 0x20, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x14, 0x48, 0x6E, 
-    0xFF, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1F, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x50, 0x4F, 
-    0x60, 0x66, 0x70, 0x02, 0x20, 0x6C, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x67, 0x22, 0x2F, 0x2C, 
-    0x00, 0x04, 0x20, 0x6C, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x6E, 0xFF, 0x00, 0x48, 0x79, 
-    0x00, 0x00, 0x1F, 0xAA, 0x61, 0xFF, 0xFF, 0xFF, 0x8B, 0xD4, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x38, 
-    0x20, 0x6C, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x6E, 0xFF, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x1F, 0x8C, 0x61, 0xFF, 0xFF, 0xFF, 0x8B, 0xB6, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1A, 0x70, 0x04, 
-    0xC0, 0xAA, 0x00, 0x14, 0x66, 0x12, 0x4A, 0xAA, 0x00, 0x10, 0x67, 0x0C, 0x20, 0x6A, 0x00, 0x10, 
-    0x20, 0x28, 0x00, 0x28, 0xD1, 0xAA, 0x00, 0x0C, 0x4A, 0x2D, 0xEE, 0x11, 0x66, 0x1C, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x67, 0x00, 0x00, 0x9C, 0x70, 0x03, 0xC0, 0xAA, 0x00, 0x14, 0x53, 0x80, 0x66, 0x0A, 
-    0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x00, 0x00, 0x88, 0x20, 0x2A, 0x00, 0x14, 0x02, 0x80, 
-    0x40, 0x00, 0x00, 0x00, 0x66, 0x7A, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x0C, 0x20, 0x2A, 0x00, 0x14, 
-    0x02, 0x80, 0x03, 0x00, 0x00, 0x00, 0x67, 0x68, 0x4A, 0xAA, 0x00, 0x10, 0x67, 0x0C, 0x70, 0x08, 
-    0x20, 0x6A, 0x00, 0x10, 0xC0, 0xA8, 0x00, 0x30, 0x66, 0x56, 0x25, 0x6D, 0xED, 0x34, 0x00, 0x18, 
-    0x52, 0xAD, 0xED, 0x34, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x2C, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x26, 
-    0x0C, 0x2B, 0x00, 0x24, 0x00, 0x0A, 0x66, 0x1E, 0x0C, 0x2B, 0x00, 0x24, 0x00, 0x0B, 0x67, 0x10, 
-    0x0C, 0x2B, 0x00, 0x54, 0x00, 0x0B, 0x67, 0x08, 0x0C, 0x2B, 0x00, 0x41, 0x00, 0x0B, 0x66, 0x06, 
-    0x4A, 0x2B, 0x00, 0x0C, 0x67, 0x1A, 0x41, 0xEB, 0x00, 0x08, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0xD1, 0xAD, 0xED, 0x44, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x04, 0x53, 0xAD, 0xED, 0x44, 
-    0x26, 0x52, 0x20, 0x0B, 0x66, 0x00, 0xFE, 0x34, 0x70, 0xFC, 0x22, 0x2D, 0xED, 0x44, 0x56, 0x81, 
-    0xC2, 0x80, 0x2B, 0x41, 0xED, 0x44, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x86, 0x5C, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x6D, 0xEC, 0xBC, 0x61, 0xFF, 0xFF, 0xFF, 0x91, 0x58, 0x52, 0xAD, 
-    0xEE, 0x7C, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x86, 0x34, 0x2D, 0x40, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x86, 0x26, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xF8, 0x48, 0x6D, 0xEC, 0xAC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x91, 0x22, 0x52, 0xAD, 0xEE, 0x7C, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1F, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x4A, 0xAE, 0x00, 0x10, 
-    0x67, 0x74, 0x70, 0x00, 0x30, 0x12, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x85, 0xC4, 0x26, 0x00, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x58, 0x4F, 
-    0x66, 0x00, 0x01, 0x66, 0x70, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x85, 0xA0, 0x28, 0x00, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x80, 0x00, 0x00, 
-    0xF8, 0x00, 0x58, 0x4F, 0x66, 0x00, 0x01, 0x42, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x07, 0xFF, 
-    0x72, 0x0A, 0xE3, 0xA8, 0x22, 0x03, 0x02, 0x81, 0x00, 0x00, 0x07, 0xFF, 0x74, 0x15, 0xE5, 0xA9, 
-    0x82, 0x80, 0x20, 0x01, 0xE0, 0x80, 0xE0, 0x88, 0xE0, 0x88, 0xEE, 0x88, 0xD0, 0x81, 0xE0, 0x80, 
-    0xE2, 0x80, 0x60, 0x00, 0x01, 0x16, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x85, 0x0E, 0x26, 0x00, 
-    0x20, 0x03, 0x02, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x0C, 0x80, 0x0A, 0x00, 0x00, 0x00, 
-    0x58, 0x4F, 0x67, 0x06, 0xB6, 0xFC, 0x00, 0x00, 0x6C, 0x0A, 0x20, 0x03, 0xE1, 0x88, 0xEC, 0x80, 
-    0x60, 0x00, 0x00, 0xE8, 0x0C, 0x85, 0x04, 0x00, 0x00, 0x00, 0x67, 0x1C, 0x20, 0x03, 0x02, 0x80, 
-    0x0F, 0xF0, 0x00, 0x00, 0x2A, 0x00, 0x0C, 0x80, 0x02, 0x80, 0x00, 0x00, 0x67, 0x0A, 0x0C, 0x85, 
-    0x02, 0x40, 0x00, 0x00, 0x66, 0x00, 0x00, 0xC2, 0x78, 0x00, 0x7C, 0xFF, 0x7E, 0x00, 0x0C, 0x85, 
-    0x02, 0x80, 0x00, 0x00, 0x67, 0x08, 0x0C, 0x85, 0x02, 0x40, 0x00, 0x00, 0x66, 0x6E, 0x2C, 0x03, 
-    0x02, 0x86, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0xFC, 0x26, 0x00, 
-    0x0C, 0x85, 0x02, 0x40, 0x00, 0x00, 0x58, 0x4F, 0x66, 0x02, 0x44, 0x83, 0xDE, 0x83, 0x52, 0x84, 
-    0xB8, 0x8B, 0x66, 0x06, 0x20, 0x07, 0x60, 0x00, 0x00, 0x82, 0x2F, 0x32, 0x4C, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x84, 0x78, 0x26, 0x00, 0x70, 0x03, 0xB8, 0x80, 0x58, 0x4F, 0x6C, 0x26, 0x20, 0x03, 
-    0x02, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xB0, 0x85, 0x66, 0x1A, 0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 
-    0xF0, 0x00, 0xB0, 0x86, 0x66, 0x0E, 0x20, 0x03, 0x02, 0x80, 0x00, 0x0F, 0x00, 0x00, 0xE8, 0x80, 
-    0xB0, 0x86, 0x67, 0xA2, 0x2A, 0x03, 0x02, 0x85, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x85, 0x04, 0x00, 
-    0x00, 0x00, 0x66, 0x30, 0x70, 0xFF, 0xBC, 0x80, 0x67, 0x0E, 0x20, 0x03, 0x02, 0x80, 0x00, 0x0F, 
-    0x00, 0x00, 0xE8, 0x80, 0xB0, 0x86, 0x66, 0x1C, 0x2A, 0x03, 0x02, 0x85, 0xFF, 0xFF, 0xF0, 0x00, 
-    0x02, 0x83, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x05, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0x66, 0x02, 
-    0x44, 0x83, 0xDE, 0x83, 0x20, 0x07, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xDF, 0x0C, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x00, 0x00, 0xBC, 0x70, 0x00, 
-    0x30, 0x12, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x84, 0x18, 0x2E, 0x00, 0x20, 0x07, 0x02, 0x80, 
-    0x00, 0x00, 0xF8, 0x00, 0x0C, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x58, 0x4F, 0x66, 0x00, 0x02, 0xA4, 
-    0x70, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x83, 0xF4, 0x26, 0x00, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x58, 0x4F, 
-    0x66, 0x00, 0x02, 0x80, 0x0C, 0x85, 0xFF, 0xC0, 0x00, 0x00, 0x6D, 0x00, 0x02, 0x76, 0x0C, 0x85, 
-    0x00, 0x40, 0x00, 0x00, 0x6C, 0x00, 0x02, 0x6C, 0x70, 0x01, 0xC0, 0x85, 0x67, 0x0E, 0x48, 0x79, 
-    0x00, 0x00, 0x1F, 0x63, 0x61, 0xFF, 0xFF, 0xFF, 0x88, 0x44, 0x58, 0x4F, 0x20, 0x05, 0x72, 0x0C, 
-    0xE2, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x22, 0x07, 0x02, 0x81, 0x00, 0x00, 0xF8, 0x00, 
-    0x82, 0x80, 0x2E, 0x01, 0x20, 0x05, 0xE2, 0x80, 0x02, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x22, 0x03, 
-    0x02, 0x81, 0x00, 0x00, 0xF8, 0x00, 0x82, 0x80, 0x26, 0x01, 0x2F, 0x07, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x83, 0xB8, 0x34, 0x80, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x83, 0xAE, 0x35, 0x40, 0x00, 0x02, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x26, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x83, 0x1C, 
-    0x2E, 0x00, 0x20, 0x07, 0x02, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x26, 0x40, 0x0C, 0x80, 0x0A, 0x00, 
-    0x00, 0x00, 0x58, 0x4F, 0x67, 0x06, 0xB8, 0xFC, 0x00, 0x00, 0x6C, 0x66, 0x26, 0x05, 0xE4, 0x83, 
-    0x70, 0x03, 0xC0, 0x85, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x1F, 0x63, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x87, 0xBC, 0x70, 0x01, 0x58, 0x4F, 0x60, 0x00, 0x01, 0xE4, 0x0C, 0x83, 0xFF, 0x80, 0x00, 0x00, 
-    0x6D, 0x08, 0x0C, 0x83, 0x00, 0x80, 0x00, 0x00, 0x6D, 0x14, 0x48, 0x79, 0x00, 0x00, 0x1F, 0x30, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x87, 0x98, 0x70, 0x01, 0x58, 0x4F, 0x60, 0x00, 0x01, 0xC0, 0x20, 0x03, 
-    0x02, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x22, 0x07, 0x02, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x82, 0x80, 
-    0x2F, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0x83, 0x10, 0x24, 0x80, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x00, 
-    0x01, 0x9C, 0xB7, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x67, 0x1C, 0x20, 0x07, 0x02, 0x80, 0x0F, 0xF0, 
-    0x00, 0x00, 0x26, 0x40, 0x0C, 0x80, 0x02, 0x80, 0x00, 0x00, 0x67, 0x0A, 0xB7, 0xFC, 0x02, 0x40, 
-    0x00, 0x00, 0x66, 0x00, 0x01, 0x5E, 0x76, 0x00, 0x78, 0x00, 0xB7, 0xFC, 0x02, 0x80, 0x00, 0x00, 
-    0x67, 0x08, 0xB7, 0xFC, 0x02, 0x40, 0x00, 0x00, 0x66, 0x54, 0x2C, 0x07, 0x02, 0x86, 0x00, 0x00, 
-    0xF0, 0x00, 0x78, 0x01, 0x60, 0x3E, 0x2F, 0x32, 0x4C, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x82, 0x4C, 
-    0x26, 0x00, 0x20, 0x03, 0x02, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xB0, 0x8B, 0x58, 0x4F, 0x66, 0x1A, 
-    0x20, 0x03, 0x02, 0x80, 0x00, 0x00, 0xF0, 0x00, 0xB0, 0x86, 0x66, 0x0E, 0x20, 0x03, 0x02, 0x80, 
-    0x00, 0x0F, 0x00, 0x00, 0xE8, 0x88, 0xB0, 0x86, 0x67, 0x08, 0x02, 0x83, 0x0E, 0x00, 0x00, 0x00, 
-    0x60, 0x0C, 0x52, 0x84, 0x70, 0x03, 0xB8, 0x80, 0x6C, 0x04, 0xB8, 0x8C, 0x66, 0xB8, 0xB7, 0xFC, 
-    0x02, 0x80, 0x00, 0x00, 0x67, 0x0A, 0xB7, 0xFC, 0x02, 0x40, 0x00, 0x00, 0x66, 0x00, 0x00, 0xB2, 
-    0x0C, 0x83, 0x04, 0x00, 0x00, 0x00, 0x66, 0x3A, 0xB8, 0x8C, 0x67, 0x36, 0x42, 0xA7, 0x48, 0x78, 
-    0x00, 0x01, 0x48, 0x72, 0x4C, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x44, 0x22, 0x05, 0x92, 0x80, 
-    0x26, 0x01, 0x2C, 0x01, 0x4A, 0x86, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x02, 0x44, 0x86, 0x20, 0x04, 
-    0xE7, 0x88, 0x22, 0x06, 0xE0, 0xA1, 0x66, 0x06, 0x2A, 0x03, 0x28, 0x44, 0x60, 0x06, 0x99, 0xCC, 
-    0x60, 0x02, 0x28, 0x44, 0x4A, 0x85, 0x6C, 0x0A, 0x26, 0x3C, 0x02, 0x40, 0x00, 0x00, 0x44, 0x85, 
-    0x60, 0x06, 0x26, 0x3C, 0x02, 0x80, 0x00, 0x00, 0x97, 0xCB, 0x60, 0x3A, 0x2F, 0x05, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xCC, 0x28, 0x2C, 0x00, 0x2F, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0xCB, 0xEC, 0x9A, 0x80, 
-    0x20, 0x07, 0x02, 0x80, 0xF0, 0x0F, 0xF0, 0x00, 0x80, 0x83, 0x80, 0x86, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x81, 0xE4, 0x24, 0xC0, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0x6E, 0x2E, 0x00, 
-    0x52, 0x8B, 0x4F, 0xEF, 0x00, 0x10, 0xB7, 0xC4, 0x6D, 0xC2, 0x4A, 0x85, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x5A, 0x20, 0x0C, 0x66, 0x3C, 0x0C, 0x83, 0x02, 0x40, 0x00, 0x00, 0x66, 0x02, 0x44, 0x85, 
-    0x26, 0x07, 0x02, 0x83, 0xFF, 0x7F, 0xF0, 0x00, 0x4A, 0x85, 0x6C, 0x04, 0x44, 0x85, 0x60, 0x06, 
-    0x00, 0x83, 0x00, 0x80, 0x00, 0x00, 0x20, 0x05, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x83, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0x90, 0x24, 0x80, 0x02, 0x85, 0xFF, 0xFF, 0xF0, 0x00, 
-    0x58, 0x4F, 0x4A, 0x85, 0x66, 0x06, 0xB8, 0xFC, 0x00, 0x00, 0x6C, 0x0E, 0x48, 0x79, 0x00, 0x00, 
-    0x1F, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0x85, 0xD6, 0x58, 0x4F, 0x20, 0x05, 0x4C, 0xDF, 0x1C, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x2F, 0x00, 0x04, 0xE5, 0x88, 0x20, 0x6F, 0x00, 0x08, 0x20, 0x68, 
-    0x00, 0x04, 0x20, 0x68, 0x00, 0x10, 0x22, 0x28, 0x00, 0x40, 0x58, 0x81, 0xD2, 0x80, 0x20, 0x01, 
-    0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x4A, 0x2D, 0xEE, 0x05, 0x67, 0x2C, 0x70, 0x03, 0xB0, 0xAF, 
-    0x00, 0x08, 0x66, 0x10, 0x70, 0x0C, 0x4C, 0x01, 0x08, 0x00, 0x20, 0x6D, 0xEC, 0xEC, 0xD0, 0xA8, 
-    0x00, 0x28, 0x4E, 0x75, 0x20, 0x6D, 0xE9, 0x6E, 0x20, 0x30, 0x1C, 0x00, 0x51, 0x80, 0x20, 0x6D, 
-    0xEC, 0xE8, 0xD0, 0xA8, 0x00, 0x28, 0x4E, 0x75, 0x20, 0x01, 0xE9, 0x88, 0x20, 0x6D, 0xEC, 0xE8, 
-    0xD0, 0xA8, 0x00, 0x28, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x78, 0x48, 0xE7, 0x1F, 0x38, 0x24, 0x6E, 
-    0x00, 0x08, 0x76, 0x00, 0x99, 0xCC, 0x42, 0xAE, 0xFF, 0xCC, 0x42, 0xAE, 0xFF, 0xD4, 0x0C, 0x2D, 
-    0x00, 0x02, 0xEE, 0x0B, 0x6D, 0x00, 0x00, 0x90, 0x48, 0x79, 0x00, 0x00, 0x35, 0x30, 0x48, 0x79, 
-    0x00, 0x00, 0x1F, 0x2B, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0x7E, 0x84, 0x48, 0x6A, 
-    0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x1F, 0x14, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 
-    0x7E, 0x70, 0x4A, 0x92, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x46, 0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 
-    0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x1F, 0x0B, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 
-    0x00, 0x00, 0x7E, 0x4E, 0x70, 0x02, 0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x1A, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x1F, 0x06, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0x7E, 0x26, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x48, 0x79, 0x00, 0x00, 0x1F, 0x03, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0x7E, 0x12, 
-    0x52, 0xAD, 0xED, 0x84, 0x50, 0x4F, 0x4A, 0xAA, 0x00, 0x18, 0x6F, 0x0C, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x04, 0x60, 0x00, 0x0F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x8A, 0x52, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x8D, 0x46, 0x28, 0x2A, 0x00, 0x18, 0x2F, 0x04, 
-    0x2F, 0x2A, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x8E, 0x0C, 0x2D, 0x48, 0xFF, 0xC4, 0x70, 0x08, 
-    0x20, 0x52, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 
-    0x0D, 0xF6, 0x7C, 0x00, 0x20, 0x6A, 0x00, 0x04, 0x26, 0x68, 0x00, 0x04, 0xB7, 0xED, 0xEE, 0x88, 
-    0x67, 0x44, 0x20, 0x6D, 0xEE, 0x88, 0x20, 0x28, 0x00, 0x24, 0xE7, 0x88, 0xD1, 0xAD, 0xEF, 0x24, 
-    0x2B, 0x4B, 0xEE, 0x88, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x2C, 0x48, 0x6D, 0xEC, 0xAC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x90, 0x4C, 0x48, 0x78, 0x00, 0x08, 0x48, 0x6D, 0xEC, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x8A, 0xB2, 0x20, 0x6D, 0xEE, 0x88, 0x20, 0x2D, 0xEF, 0x24, 0xD0, 0xA8, 0x00, 0x18, 0x2B, 0x40, 
-    0xEF, 0x28, 0x4F, 0xEF, 0x00, 0x0C, 0x28, 0x2A, 0x00, 0x24, 0xE7, 0x8C, 0x2F, 0x04, 0x2F, 0x2A, 
-    0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0x8D, 0x8E, 0x26, 0x48, 0x2D, 0x4B, 0xFF, 0xDC, 0x20, 0x2A, 
-    0x00, 0x24, 0xE7, 0x88, 0x20, 0x4B, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xC0, 0x50, 0x4F, 0x60, 0x00, 
-    0x0D, 0x6A, 0x20, 0x6E, 0xFF, 0xDC, 0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x7F, 0x0E, 0x2A, 0x00, 
-    0x20, 0x6E, 0xFF, 0xDC, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x7E, 0xFE, 0x28, 0x00, 
-    0x70, 0xFF, 0x2D, 0x40, 0xFF, 0xD8, 0x42, 0xAE, 0xFF, 0xE4, 0x20, 0x04, 0x72, 0x1F, 0xE2, 0xA8, 
-    0x50, 0x4F, 0x67, 0x76, 0x20, 0x04, 0x02, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x70, 0x03, 0x2E, 0x04, 0x74, 0x18, 0xE4, 0xAF, 0xCE, 0x80, 0x70, 0x01, 0x22, 0x04, 0x74, 0x1A, 
-    0xE4, 0xA9, 0xC2, 0x80, 0x2D, 0x41, 0xFF, 0xF8, 0x22, 0x04, 0x74, 0x1B, 0xE4, 0xA9, 0xC2, 0x80, 
-    0x2D, 0x41, 0xFF, 0xE8, 0x20, 0x2A, 0x00, 0x30, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x67, 0x0A, 
-    0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x12, 0x7E, 0x03, 0x60, 0x0E, 0x70, 0x03, 0x22, 0x04, 0x74, 0x1D, 
-    0xE4, 0xA9, 0xC2, 0x80, 0x2D, 0x41, 0xFF, 0xD8, 0x02, 0x84, 0x90, 0x00, 0x00, 0x00, 0x70, 0x03, 
-    0xBE, 0x80, 0x66, 0x60, 0x70, 0x01, 0xC0, 0x85, 0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 
-    0x2D, 0x40, 0xFF, 0xE4, 0x70, 0xFE, 0xCA, 0x80, 0x60, 0x4A, 0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 
-    0xFF, 0xFF, 0x2D, 0x40, 0xFF, 0xEC, 0x70, 0x03, 0x2E, 0x04, 0x74, 0x10, 0xE4, 0xAF, 0xCE, 0x80, 
-    0x70, 0x01, 0x22, 0x04, 0x74, 0x12, 0xE4, 0xA9, 0xC2, 0x80, 0x2D, 0x41, 0xFF, 0xF8, 0x22, 0x04, 
-    0x74, 0x13, 0xE4, 0xA9, 0xC2, 0x80, 0x2D, 0x41, 0xFF, 0xE8, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x06, 
-    0x2D, 0x40, 0xFF, 0xE8, 0x7E, 0x03, 0x4A, 0xAE, 0xFF, 0xE8, 0x66, 0x06, 0x2D, 0x6A, 0x00, 0x34, 
-    0xFF, 0xEC, 0x78, 0x00, 0x20, 0x6E, 0xFF, 0xC4, 0xD1, 0xC5, 0x2D, 0x48, 0xFF, 0xF0, 0x4A, 0x2D, 
-    0xEE, 0x06, 0x67, 0x36, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x2C, 0x4A, 0xAE, 
-    0xFF, 0xF8, 0x66, 0x26, 0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 0x66, 0x1C, 0x48, 0x6A, 
-    0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x1E, 0xD6, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x82, 0xB8, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x07, 0x67, 0x12, 0x53, 0x80, 
-    0x67, 0x1A, 0x53, 0x80, 0x67, 0x16, 0x53, 0x80, 0x67, 0x00, 0x00, 0x8C, 0x60, 0x00, 0x00, 0xF2, 
-    0x20, 0x6E, 0xFF, 0xF0, 0x16, 0x10, 0x49, 0xC3, 0x60, 0x00, 0x00, 0xE6, 0x70, 0x01, 0xEF, 0xA8, 
-    0x53, 0x80, 0xC0, 0x85, 0x67, 0x4C, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x1E, 
-    0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 
-    0x1E, 0xAB, 0x61, 0xFF, 0xFF, 0xFF, 0x82, 0x66, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x24, 0xB5, 0xED, 
-    0xE8, 0x66, 0x67, 0x1E, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 
-    0x00, 0x00, 0x1E, 0x6C, 0x61, 0xFF, 0xFF, 0xFF, 0x82, 0x44, 0x2B, 0x4A, 0xE8, 0x66, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x70, 0x01, 0xBE, 0x80, 0x67, 0x0E, 0x2F, 0x2E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x7E, 0x98, 0x58, 0x4F, 0x60, 0x0C, 0x2F, 0x2E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0x7E, 0xE8, 
-    0x58, 0x4F, 0x26, 0x00, 0x60, 0x6A, 0x2F, 0x2E, 0xFF, 0xE4, 0x2F, 0x2E, 0xFF, 0xD8, 0x2F, 0x2E, 
-    0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x98, 0x26, 0x00, 0x70, 0xFF, 0xB6, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x66, 0x4C, 0x4A, 0xAE, 0xFF, 0xE4, 0x67, 0x16, 0x20, 0x6E, 0xFF, 0xF0, 0x70, 0x00, 
-    0x30, 0x10, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x7D, 0x58, 0x26, 0x00, 0x58, 0x4F, 0x60, 0x10, 
-    0x20, 0x6E, 0xFF, 0xF0, 0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x26, 0x00, 0x58, 0x4F, 
-    0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x05, 0x2F, 0x03, 0x48, 0x79, 
-    0x00, 0x00, 0x1E, 0x33, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0xB4, 0x76, 0x00, 0x4F, 0xEF, 0x00, 0x14, 
-    0x70, 0x01, 0x2D, 0x40, 0xFF, 0xF4, 0x70, 0x01, 0x2D, 0x40, 0xFF, 0xE0, 0x0C, 0x2D, 0x00, 0x03, 
-    0xEE, 0x0B, 0x6D, 0x36, 0x2F, 0x2E, 0xFF, 0xEC, 0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 
-    0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x2F, 0x2E, 0xFF, 0xE8, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xFE, 0x48, 0x6D, 0xFC, 0x20, 
-    0x61, 0xFF, 0x00, 0x00, 0x7A, 0xBC, 0x4F, 0xEF, 0x00, 0x20, 0x4A, 0xAE, 0xFF, 0xE4, 0x67, 0x2A, 
-    0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x24, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x1E, 0x2F, 0x3C, 0x01, 0x00, 
-    0x01, 0x01, 0x20, 0x2A, 0x00, 0x28, 0xD0, 0x85, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xF9, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xB0, 0x18, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0xAE, 0xFF, 0xE8, 0x67, 0x00, 
-    0x07, 0x32, 0x20, 0x52, 0x22, 0x68, 0x00, 0x20, 0x20, 0x2E, 0xFF, 0xEC, 0x2D, 0x71, 0x0C, 0x00, 
-    0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x2C, 0x28, 0x00, 0x04, 0x26, 0x46, 0x50, 0x8B, 0x58, 0x8B, 
-    0x20, 0x2B, 0x00, 0x08, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x4A, 0x80, 0x56, 0xC0, 0x44, 0x00, 
-    0x49, 0xC0, 0xB0, 0xAE, 0xFF, 0xE4, 0x67, 0x2A, 0x28, 0x50, 0x20, 0x0C, 0x67, 0x24, 0x48, 0x6C, 
-    0x00, 0x08, 0x48, 0x68, 0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0x9B, 0xD0, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x10, 0x2D, 0x4C, 0xFF, 0xFC, 0x20, 0x4C, 0x2C, 0x28, 0x00, 0x04, 0x26, 0x46, 0x50, 0x8B, 
-    0x58, 0x8B, 0x70, 0x10, 0xC0, 0xAB, 0x00, 0x08, 0x67, 0x04, 0x42, 0xAE, 0xFF, 0xF4, 0x99, 0xCC, 
-    0x2D, 0x6B, 0x00, 0x0C, 0xFF, 0xEC, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x08, 0x67, 0x00, 0x06, 0x98, 
-    0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x0C, 0x70, 0x03, 0xC0, 0xAB, 0x00, 0x08, 0x53, 0x80, 0x66, 0x00, 
-    0x06, 0x86, 0x20, 0x2B, 0x00, 0x08, 0x02, 0x80, 0x02, 0x00, 0x01, 0x00, 0x0C, 0x80, 0x02, 0x00, 
-    0x00, 0x00, 0x66, 0x32, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x66, 0x28, 0x4A, 0xAB, 
-    0x00, 0x04, 0x67, 0x22, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x02, 0x00, 0x67, 0x12, 0x70, 0x03, 0xBE, 0x80, 0x66, 0x06, 0x28, 0x6D, 0xEC, 0xEC, 0x60, 0x0A, 
-    0x28, 0x6D, 0xEC, 0xE8, 0x60, 0x04, 0x28, 0x6B, 0x00, 0x04, 0x70, 0x20, 0xC0, 0xAB, 0x00, 0x08, 
-    0x67, 0x54, 0xB9, 0xCA, 0x66, 0x50, 0x20, 0x6E, 0xFF, 0xFC, 0x11, 0x7C, 0x00, 0x20, 0x00, 0x08, 
-    0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x68, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x7F, 0x96, 0x2D, 0x48, 
-    0xFF, 0xD0, 0x4A, 0xAE, 0xFF, 0xD0, 0x50, 0x4F, 0x67, 0x0C, 0x2C, 0x28, 0x00, 0x04, 0x26, 0x46, 
-    0x50, 0x8B, 0x58, 0x8B, 0x60, 0x16, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 0x00, 0x0A, 0x48, 0x79, 
-    0x00, 0x00, 0x1D, 0xDC, 0x61, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x50, 0x4F, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x11, 0x7C, 0x00, 0x21, 0x00, 0x08, 0x20, 0x46, 0x4A, 0xA8, 0x00, 0x04, 0x6D, 0x4C, 0x4A, 0xAE, 
-    0xFF, 0xF8, 0x67, 0x0E, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x68, 0x00, 0x10, 0xB1, 0xEA, 0x00, 0x10, 
-    0x67, 0x38, 0x20, 0x2B, 0x00, 0x08, 0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x67, 0x16, 0x2F, 0x07, 
-    0x20, 0x46, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x1A, 0xD6, 0x80, 0x50, 0x4F, 
-    0x60, 0x00, 0x04, 0x80, 0x2F, 0x0B, 0x20, 0x46, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF9, 0xE6, 0xD6, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x04, 0x6A, 0xD6, 0x93, 0x20, 0x2B, 0x00, 0x08, 
-    0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x00, 0x02, 0xA4, 0x70, 0x03, 0xBE, 0x80, 0x66, 0x00, 
-    0x02, 0x7A, 0x4A, 0xAE, 0xFF, 0xE4, 0x66, 0x00, 0x04, 0x4A, 0x4A, 0xAB, 0x00, 0x04, 0x67, 0x00, 
-    0x00, 0xB2, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x40, 0x00, 0x00, 
-    0x67, 0x00, 0x00, 0xA0, 0x20, 0x46, 0x70, 0xFF, 0xB0, 0xA8, 0x00, 0x08, 0x66, 0x22, 0x48, 0x6A, 
-    0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 0x00, 0x0A, 
-    0x48, 0x79, 0x00, 0x00, 0x1D, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 0x7F, 0x42, 0x4F, 0xEF, 0x00, 0x10, 
-    0x20, 0x46, 0x4A, 0xA8, 0x00, 0x08, 0x66, 0x5E, 0x21, 0x6D, 0xEF, 0x18, 0x00, 0x08, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x67, 0x20, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x1A, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 
-    0x2F, 0x2D, 0xEF, 0x18, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0xEE, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x13, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x7A, 0x98, 
-    0x2B, 0x40, 0xF4, 0x2E, 0x20, 0x6D, 0xEF, 0x1C, 0x43, 0xED, 0xF4, 0x26, 0x72, 0x0C, 0x20, 0x08, 
-    0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0x70, 0x0C, 0xD1, 0xAD, 0xEF, 0x1C, 
-    0xD1, 0xAD, 0xEF, 0x18, 0x58, 0x4F, 0x96, 0x93, 0x20, 0x46, 0xD6, 0xA8, 0x00, 0x08, 0x60, 0x00, 
-    0x03, 0x92, 0x20, 0x6E, 0xFF, 0xF0, 0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x79, 0xEE, 0x2D, 0x40, 
-    0xFF, 0xC8, 0x96, 0x93, 0xD6, 0xAD, 0xEF, 0x18, 0x02, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x80, 
-    0x0B, 0x00, 0x00, 0x00, 0x58, 0x4F, 0x66, 0x00, 0x00, 0xC4, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x54, 
-    0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x4E, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 0x2F, 0x2D, 0xEF, 0x18, 
-    0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x62, 0x2F, 0x3C, 0x01, 0x00, 
-    0x11, 0x01, 0x20, 0x2D, 0xEF, 0x18, 0x50, 0x80, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xF9, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x48, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 0x70, 0x10, 0xD0, 0xAD, 
-    0xEF, 0x18, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAD, 0x2E, 
-    0x4F, 0xEF, 0x00, 0x24, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0xFF, 0xFF, 0x70, 0x0C, 0xD0, 0xAD, 
-    0xEF, 0x18, 0x22, 0x13, 0x92, 0x80, 0x2F, 0x01, 0x48, 0x6D, 0xF3, 0xEA, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF5, 0x64, 0x42, 0xA7, 0x48, 0x78, 0xFF, 0xFF, 0x20, 0x2A, 0x00, 0x28, 0xD0, 0x85, 0x58, 0x80, 
-    0x72, 0x18, 0xD2, 0xAD, 0xEF, 0x18, 0x90, 0x81, 0x2F, 0x00, 0x48, 0x6D, 0xF3, 0xF2, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF5, 0x42, 0x20, 0x6D, 0xEF, 0x1C, 0x43, 0xED, 0xF3, 0xE2, 0x72, 0x18, 0x20, 0x08, 
-    0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0x70, 0x18, 0xD1, 0xAD, 0xEF, 0x1C, 
-    0xD1, 0xAD, 0xEF, 0x18, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x00, 0x00, 0x9E, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x54, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x4E, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 0x2F, 0x2D, 
-    0xEF, 0x18, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAC, 0xA0, 0x2F, 0x3C, 
-    0x01, 0x00, 0x11, 0x01, 0x70, 0x0C, 0xD0, 0xAD, 0xEF, 0x18, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x1D, 0xF9, 0x61, 0xFF, 0xFF, 0xFF, 0xAC, 0x86, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 0x70, 0x14, 
-    0xD0, 0xAD, 0xEF, 0x18, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xAC, 0x6C, 0x4F, 0xEF, 0x00, 0x24, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0xFF, 0xFF, 0x70, 0x10, 
-    0xD0, 0xAD, 0xEF, 0x18, 0x22, 0x13, 0x92, 0x80, 0x2F, 0x01, 0x48, 0x6D, 0xF4, 0x06, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF4, 0xA2, 0x20, 0x6D, 0xEF, 0x1C, 0x43, 0xED, 0xF3, 0xFA, 0x72, 0x18, 0x20, 0x08, 
-    0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0x70, 0x18, 0xD1, 0xAD, 0xEF, 0x1C, 
-    0xD1, 0xAD, 0xEF, 0x18, 0x4F, 0xEF, 0x00, 0x10, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x04, 0xC0, 0x81, 
-    0x67, 0x00, 0x02, 0x00, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x48, 0x68, 0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x1D, 0x67, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x7D, 0x1C, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x01, 0xDA, 0x20, 0x2C, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0x02, 0x00, 0x67, 0x00, 0x01, 0xCC, 0x20, 0x2B, 0x00, 0x08, 0x02, 0x80, 0x00, 0x00, 
-    0x01, 0x00, 0x66, 0x00, 0x01, 0xBE, 0x52, 0x83, 0x60, 0x00, 0x01, 0xB8, 0x70, 0x03, 0xBE, 0x80, 
-    0x66, 0x00, 0x01, 0xB0, 0x4A, 0xAE, 0xFF, 0xE4, 0x67, 0x00, 0x01, 0xA8, 0x4A, 0xAB, 0x00, 0x04, 
-    0x67, 0x00, 0x00, 0xDA, 0x20, 0x6B, 0x00, 0x04, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x40, 
-    0x00, 0x00, 0x67, 0x00, 0x00, 0xC8, 0x20, 0x46, 0x70, 0xFF, 0xB0, 0xA8, 0x00, 0x08, 0x66, 0x22, 
-    0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 
-    0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 0x7C, 0xA0, 0x4F, 0xEF, 
-    0x00, 0x10, 0x20, 0x46, 0x4A, 0xA8, 0x00, 0x08, 0x66, 0x00, 0x00, 0x86, 0x21, 0x6D, 0xEF, 0x18, 
-    0x00, 0x08, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x3A, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x34, 0x2F, 0x3C, 
-    0x01, 0x00, 0x11, 0x01, 0x2F, 0x2D, 0xEF, 0x18, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xAB, 0x4A, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 0x20, 0x2D, 0xEF, 0x18, 0x58, 0x80, 
-    0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAB, 0x30, 0x4F, 0xEF, 
-    0x00, 0x18, 0x42, 0xA7, 0x48, 0x78, 0xFF, 0xFF, 0x70, 0x0C, 0xD0, 0xAD, 0xEF, 0x18, 0x22, 0x13, 
-    0x92, 0x80, 0x2F, 0x01, 0x48, 0x6D, 0xF4, 0x36, 0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x68, 0x20, 0x6D, 
-    0xEF, 0x1C, 0x43, 0xED, 0xF4, 0x32, 0x72, 0x08, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x50, 0xAD, 0xEF, 0x1C, 0x50, 0xAD, 0xEF, 0x18, 0x4F, 0xEF, 0x00, 0x10, 
-    0x96, 0x93, 0x20, 0x46, 0xD6, 0xA8, 0x00, 0x08, 0x60, 0x00, 0x00, 0xC8, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x3A, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x34, 0x2F, 0x3C, 0x01, 0x00, 0x11, 0x01, 0x2F, 0x2D, 
-    0xEF, 0x18, 0x48, 0x79, 0x00, 0x00, 0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAA, 0xC0, 0x2F, 0x3C, 
-    0x01, 0x00, 0x01, 0x01, 0x20, 0x2D, 0xEF, 0x18, 0x58, 0x80, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x1D, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0xAA, 0xA6, 0x4F, 0xEF, 0x00, 0x18, 0x42, 0xA7, 0x48, 0x78, 
-    0xFF, 0xFF, 0x70, 0x0C, 0xD0, 0xAD, 0xEF, 0x18, 0x22, 0x13, 0x92, 0x80, 0x2F, 0x01, 0x48, 0x6D, 
-    0xF4, 0x16, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0xDE, 0x20, 0x2A, 0x00, 0x28, 0xD0, 0x85, 0x5A, 0x80, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x77, 0x30, 0x2B, 0x40, 0xF4, 0x22, 0x96, 0x93, 0xD6, 0xAD, 
-    0xEF, 0x18, 0x20, 0x6D, 0xEF, 0x1C, 0x43, 0xED, 0xF4, 0x12, 0x72, 0x14, 0x20, 0x08, 0x4A, 0x81, 
-    0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0x70, 0x14, 0xD1, 0xAD, 0xEF, 0x1C, 0xD1, 0xAD, 
-    0xEF, 0x18, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x04, 0xC0, 0x81, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x22, 
-    0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 
-    0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x1D, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0x7B, 0x40, 0x4F, 0xEF, 
-    0x00, 0x10, 0x70, 0x04, 0xC0, 0xAB, 0x00, 0x08, 0x66, 0x10, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x70, 
-    0x20, 0x6C, 0x00, 0x04, 0xB1, 0xEA, 0x00, 0x04, 0x66, 0x66, 0x42, 0xAE, 0xFF, 0xE0, 0x20, 0x2B, 
-    0x00, 0x08, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, 0x66, 0x04, 0x42, 0xAE, 0xFF, 0xF4, 0x4A, 0xAE, 
-    0xFF, 0xF8, 0x67, 0x24, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x1E, 0x70, 0x04, 0xC0, 0xAB, 0x00, 0x08, 
-    0x67, 0x16, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x1C, 0xFA, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x7A, 0xE8, 0x50, 0x4F, 0x70, 0x03, 0xBE, 0x80, 0x66, 0x00, 0x01, 0x5C, 
-    0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x50, 0x20, 0x2B, 0x00, 0x08, 
-    0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x66, 0x00, 0x01, 0x42, 0x58, 0x83, 0x60, 0x00, 0x01, 0x3C, 
-    0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x0A, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x14, 
-    0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x20, 0x4A, 0xAE, 0xFF, 0xF8, 
-    0x66, 0x00, 0x01, 0x18, 0x20, 0x0C, 0x67, 0x4E, 0x70, 0x40, 0xC0, 0xAC, 0x00, 0x30, 0x67, 0x16, 
-    0x96, 0xAC, 0x00, 0x28, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x2D, 0x68, 0x00, 0x18, 
-    0xFF, 0xEC, 0x60, 0x00, 0x00, 0xF6, 0x70, 0x03, 0xC0, 0xAB, 0x00, 0x08, 0x53, 0x80, 0x66, 0x20, 
-    0x20, 0x6C, 0x00, 0x04, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0x7C, 0x20, 0x6E, 0xFF, 0x7C, 0x96, 0xA8, 
-    0x00, 0x28, 0x42, 0xAE, 0xFF, 0xE8, 0x2D, 0x68, 0x00, 0x34, 0xFF, 0xEC, 0x60, 0x00, 0x00, 0xCC, 
-    0x96, 0x93, 0x60, 0x00, 0x00, 0xC6, 0x42, 0xAE, 0xFF, 0xF4, 0x42, 0xAE, 0xFF, 0xE0, 0x48, 0x6A, 
-    0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x05, 0x20, 0x6E, 0xFF, 0xFC, 0x48, 0x68, 
-    0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x1C, 0xBA, 0x61, 0xFF, 0xFF, 0xFF, 0x7A, 0x20, 0x4F, 0xEF, 
-    0x00, 0x14, 0x60, 0x00, 0x00, 0x96, 0x70, 0x03, 0xBE, 0x80, 0x66, 0x00, 0x00, 0x8E, 0x70, 0x10, 
-    0xC0, 0xAB, 0x00, 0x08, 0x67, 0x00, 0x00, 0x84, 0x20, 0x2A, 0x00, 0x28, 0xD0, 0x85, 0xD6, 0x80, 
-    0x60, 0x78, 0x20, 0x52, 0x22, 0x68, 0x00, 0x28, 0x20, 0x2E, 0xFF, 0xEC, 0x28, 0x71, 0x0C, 0x00, 
-    0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0xB1, 0xEA, 0x00, 0x04, 0x66, 0x06, 
-    0x42, 0xAE, 0xFF, 0xE0, 0x60, 0x54, 0xD6, 0xAC, 0x00, 0x28, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x0A, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x0A, 0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 
-    0x00, 0x00, 0x67, 0x36, 0x70, 0x40, 0xC0, 0xAC, 0x00, 0x30, 0x67, 0x16, 0x70, 0x01, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x2D, 0x68, 0x00, 0x18, 0xFF, 0xEC, 
-    0x60, 0x18, 0x20, 0x6C, 0x00, 0x04, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0x78, 0x20, 0x6E, 0xFF, 0x78, 
-    0x96, 0xA8, 0x00, 0x28, 0x2D, 0x68, 0x00, 0x34, 0xFF, 0xEC, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x0E, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x04, 0x42, 0xAE, 0xFF, 0xE0, 0x0C, 0x2D, 
-    0x00, 0x01, 0xEE, 0x0C, 0x66, 0x00, 0x00, 0x8E, 0x20, 0x0C, 0x67, 0x00, 0x00, 0x88, 0x20, 0x2C, 
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x66, 0x7A, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEC, 
-    0x00, 0x10, 0x67, 0x70, 0x20, 0x6C, 0x00, 0x10, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x66, 0x20, 0x6C, 
-    0x00, 0x10, 0x22, 0x6A, 0x00, 0x10, 0x22, 0x69, 0x00, 0x4C, 0xB3, 0xE8, 0x00, 0x4C, 0x66, 0x28, 
-    0x4A, 0xAE, 0xFF, 0xD4, 0x66, 0x4E, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 
-    0x48, 0x79, 0x00, 0x00, 0x1C, 0x92, 0x61, 0xFF, 0xFF, 0xFF, 0x79, 0x12, 0x70, 0x01, 0x2D, 0x40, 
-    0xFF, 0xD4, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x2C, 0x4A, 0xAE, 0xFF, 0xCC, 0x66, 0x26, 0x4A, 0xAE, 
-    0xFF, 0xD4, 0x66, 0x20, 0x48, 0x6A, 0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 
-    0x00, 0x00, 0x1C, 0x6B, 0x61, 0xFF, 0xFF, 0xFF, 0x78, 0xE4, 0x70, 0x01, 0x2D, 0x40, 0xFF, 0xCC, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x2C, 0x20, 0x04, 0x02, 0x80, 0x80, 0x00, 
-    0x00, 0x00, 0x66, 0x06, 0x20, 0x05, 0x50, 0x80, 0x96, 0x80, 0x96, 0xAA, 0x00, 0x28, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x67, 0x12, 0x4A, 0xAE, 0xFF, 0xE0, 0x67, 0x0C, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 
-    0x00, 0x04, 0xD6, 0xA8, 0x00, 0x28, 0x20, 0x07, 0x67, 0x12, 0x53, 0x80, 0x67, 0x1C, 0x53, 0x80, 
-    0x67, 0x2E, 0x53, 0x80, 0x67, 0x00, 0x00, 0xE4, 0x60, 0x00, 0x01, 0x50, 0x42, 0xAE, 0xFF, 0xF4, 
-    0x20, 0x6E, 0xFF, 0xF0, 0x10, 0x83, 0x60, 0x00, 0x01, 0x42, 0x42, 0xAE, 0xFF, 0xF4, 0x2F, 0x03, 
-    0x2F, 0x2E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0x75, 0xB8, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x2C, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0C, 0x66, 0x52, 0x20, 0x0C, 0x67, 0x4E, 0x41, 0xED, 0xEE, 0xA4, 
-    0xB1, 0xEA, 0x00, 0x10, 0x66, 0x0A, 0x2D, 0x7C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x60, 0x3A, 
-    0xB1, 0xEC, 0x00, 0x10, 0x67, 0x0E, 0x4A, 0xAE, 0xFF, 0xE8, 0x67, 0x1C, 0x20, 0x46, 0x4A, 0xA8, 
-    0x00, 0x04, 0x6D, 0x14, 0x2D, 0x7C, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x4A, 0x2D, 0xEE, 0x09, 
-    0x67, 0x18, 0x96, 0xAD, 0xF2, 0xE2, 0x60, 0x12, 0x20, 0x6C, 0x00, 0x10, 0xB1, 0xEA, 0x00, 0x10, 
-    0x66, 0x08, 0x2D, 0x7C, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0x03, 0x2F, 0x2E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x74, 0xFE, 0x4A, 0x2D, 0xEE, 0x11, 0x50, 0x4F, 0x67, 0x00, 0x00, 0xBC, 
-    0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x00, 0x00, 0xB4, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x80, 0x00, 0x66, 0x00, 0x00, 0xA6, 0x20, 0x0C, 0x67, 0x00, 0x00, 0xA0, 0x20, 0x2C, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x00, 0x00, 0x92, 0x2F, 0x3C, 0x01, 0x00, 0x01, 0x01, 
-    0x20, 0x2A, 0x00, 0x28, 0xD0, 0x85, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1C, 0x66, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xA6, 0x9A, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x70, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x30, 
-    0x20, 0x0C, 0x67, 0x2C, 0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEA, 0x00, 0x10, 0x67, 0x0A, 0x20, 0x6A, 
-    0x00, 0x10, 0xB1, 0xEC, 0x00, 0x10, 0x66, 0x06, 0x42, 0xAE, 0xFF, 0xF4, 0x60, 0x12, 0x2D, 0x7C, 
-    0x30, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x4A, 0x2D, 0xEE, 0x09, 0x67, 0x04, 0x96, 0xAD, 0xF2, 0xE2, 
-    0x2F, 0x2E, 0xFF, 0xE4, 0x2F, 0x2E, 0xFF, 0xD8, 0x2F, 0x03, 0x2F, 0x2E, 0xFF, 0xF0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEE, 0xA2, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x1E, 0x2F, 0x03, 0x48, 0x6A, 
-    0x00, 0x44, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x1C, 0x34, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x77, 0x48, 0x4F, 0xEF, 0x00, 0x14, 0x4A, 0x2D, 0xEE, 0x09, 0x66, 0x06, 
-    0x4A, 0x2D, 0xEE, 0x0A, 0x67, 0x3C, 0x4A, 0xAE, 0xFF, 0xF4, 0x67, 0x36, 0x70, 0x09, 0xB0, 0xAD, 
-    0xED, 0xCC, 0x67, 0x2E, 0x4A, 0x2D, 0xEE, 0x0F, 0x66, 0x04, 0x70, 0x00, 0x60, 0x06, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0x80, 0x22, 0x2D, 0xEF, 0x24, 0xD2, 0x85, 0x24, 0x2E, 0xFF, 0xF4, 0x02, 0x82, 
-    0x70, 0x00, 0x00, 0x00, 0xD4, 0x81, 0x94, 0x80, 0x2F, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0xEC, 0x32, 
-    0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x6E, 0x4A, 0xAE, 0xFF, 0xE0, 0x67, 0x68, 0x70, 0x09, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x60, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x52, 0xA8, 
-    0x00, 0x24, 0x20, 0x07, 0x72, 0x18, 0xE3, 0xA8, 0x22, 0x2E, 0xFF, 0xEC, 0x06, 0x81, 0x80, 0x00, 
-    0x00, 0x00, 0xD2, 0x80, 0x88, 0x81, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x06, 0x00, 0x84, 0x04, 0x00, 
-    0x00, 0x00, 0x4A, 0xAE, 0xFF, 0xE8, 0x67, 0x06, 0x00, 0x84, 0x08, 0x00, 0x00, 0x00, 0x2F, 0x04, 
-    0x4A, 0xAE, 0xFF, 0xE4, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x20, 0x6A, 0x00, 0x04, 
-    0x20, 0x68, 0x00, 0x04, 0x22, 0x28, 0x00, 0x14, 0xD2, 0x85, 0xD2, 0x80, 0x2F, 0x01, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEB, 0xE6, 0x50, 0x4F, 0x50, 0xAE, 0xFF, 0xDC, 0x20, 0x6E, 0xFF, 0xDC, 0xB1, 0xEE, 
-    0xFF, 0xC0, 0x65, 0x00, 0xF2, 0x8E, 0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x56, 0x4A, 0x2D, 
-    0xEE, 0x10, 0x66, 0x50, 0x70, 0x01, 0xC0, 0xAA, 0x00, 0x30, 0x67, 0x2A, 0x20, 0x2A, 0x00, 0x2C, 
-    0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x00, 0x00, 0xA4, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2E, 
-    0xFF, 0xC4, 0x2F, 0x3C, 0x00, 0x00, 0x80, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0xCE, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0x88, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2E, 0xFF, 0xC4, 0x20, 0x2A, 
-    0x00, 0x28, 0x90, 0xAD, 0xED, 0xD0, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0xAE, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x68, 0x4A, 0xAA, 0x00, 0x1C, 0x6F, 0x46, 0x48, 0x78, 0x00, 0x40, 0x42, 0xA7, 
-    0x48, 0x6E, 0xFF, 0x80, 0x61, 0xFF, 0x00, 0x00, 0x90, 0x06, 0x26, 0x2A, 0x00, 0x1C, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x28, 0x70, 0x40, 0xB6, 0x80, 0x63, 0x04, 0x78, 0x40, 0x60, 0x02, 0x28, 0x03, 
-    0x2F, 0x04, 0x48, 0x6E, 0xFF, 0x80, 0x2F, 0x2D, 0xEF, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x81, 0x6C, 
-    0x2B, 0x6D, 0xEC, 0xA0, 0xEF, 0x24, 0x96, 0x84, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x83, 0x6E, 0xD4, 
-    0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x2E, 0xFF, 0xC4, 0x2F, 0x2D, 0xEF, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x81, 0x4A, 0x2B, 0x6D, 0xEC, 0xA0, 0xEF, 0x24, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2A, 0x00, 0x18, 
-    0xD0, 0xAA, 0x00, 0x1C, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0xD1, 0xA8, 0x00, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x7B, 0x70, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x6F, 
-    0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xB0, 
-    0x48, 0xE7, 0x1F, 0x38, 0x7E, 0x00, 0x42, 0xAE, 0xFF, 0xD4, 0x42, 0xAE, 0xFF, 0xD0, 0x42, 0xAE, 
-    0xFF, 0xCC, 0x7A, 0x00, 0x42, 0xAE, 0xFF, 0xFC, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x00, 
-    0x03, 0x72, 0x7C, 0x00, 0x42, 0xAE, 0xFF, 0xC8, 0x48, 0x78, 0x00, 0x24, 0x42, 0xA7, 0x48, 0x6E, 
-    0xFF, 0xD8, 0x61, 0xFF, 0x00, 0x00, 0x8F, 0x48, 0x2F, 0x3C, 0x00, 0x24, 0x00, 0x01, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x70, 0xD4, 0x2D, 0x40, 0xFF, 0xD8, 0x42, 0x2E, 0xFF, 0xDC, 0x1D, 0x7C, 0x00, 0x02, 
-    0xFF, 0xDF, 0x2F, 0x2D, 0xEE, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0xBC, 0x2D, 0x40, 0xFF, 0xE0, 
-    0x2F, 0x2D, 0xEE, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0xAE, 0x2D, 0x40, 0xFF, 0xE4, 0x2F, 0x2D, 
-    0xEE, 0xB8, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0xA0, 0x2D, 0x40, 0xFF, 0xE8, 0x2F, 0x2D, 0xEE, 0xBC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x92, 0x2D, 0x40, 0xFF, 0xEC, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 
-    0x72, 0x24, 0xD0, 0x81, 0xD0, 0xAD, 0xED, 0x44, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x78, 
-    0x2D, 0x40, 0xFF, 0xF4, 0x2F, 0x2D, 0xED, 0x34, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x6A, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x48, 0x78, 0x00, 0x24, 0x48, 0x6E, 0xFF, 0xD8, 0x20, 0x2D, 0xED, 0x28, 0x72, 0x24, 
-    0x90, 0x81, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x80, 0x42, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x79, 0xF8, 0x2D, 0x48, 0xFF, 0xB8, 0x24, 0x48, 0x2F, 0x2D, 
-    0xED, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0x79, 0xE8, 0x2D, 0x48, 0xFF, 0xFC, 0x2A, 0x08, 0x2F, 0x2D, 
-    0xED, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x20, 0x20, 0x45, 0x20, 0x80, 0x58, 0x85, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x4F, 0xEF, 0x00, 0x40, 0x67, 0x5A, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x54, 0x2C, 0x05, 
-    0x20, 0x45, 0x52, 0x85, 0x10, 0xBC, 0x00, 0x02, 0x48, 0x79, 0x00, 0x00, 0x1C, 0x2B, 0x2F, 0x05, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xCC, 0x2A, 0x08, 0x2E, 0x05, 0x20, 0x45, 0x52, 0x85, 0x10, 0xBC, 
-    0x00, 0x02, 0x48, 0x79, 0x00, 0x00, 0x1C, 0x28, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xB2, 
-    0x2A, 0x08, 0x2D, 0x45, 0xFF, 0xC8, 0x20, 0x45, 0x52, 0x85, 0x10, 0xBC, 0x00, 0x02, 0x48, 0x79, 
-    0x00, 0x00, 0x1C, 0x25, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x96, 0x2A, 0x08, 0x4F, 0xEF, 
-    0x00, 0x18, 0x26, 0x2D, 0xEF, 0x3C, 0x60, 0x00, 0x01, 0x86, 0x20, 0x43, 0x26, 0x68, 0x00, 0x04, 
-    0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x40, 0x00, 0x00, 0x00, 0x66, 0x00, 0x01, 0x70, 0x4A, 0xAB, 
-    0x00, 0x10, 0x66, 0x04, 0x78, 0x00, 0x60, 0x40, 0x70, 0x08, 0x20, 0x6B, 0x00, 0x10, 0xC0, 0xA8, 
-    0x00, 0x30, 0x66, 0x00, 0x01, 0x58, 0x20, 0x6B, 0x00, 0x10, 0x28, 0x28, 0x00, 0x2C, 0x20, 0x04, 
-    0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x08, 0x28, 0x3C, 0x06, 0x00, 0x00, 0x00, 0x60, 0x18, 
-    0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x08, 0x28, 0x3C, 0x02, 0x00, 0x00, 0x00, 
-    0x60, 0x06, 0x28, 0x3C, 0x04, 0x00, 0x00, 0x00, 0x70, 0x03, 0xC0, 0xAB, 0x00, 0x14, 0x53, 0x80, 
-    0x67, 0x06, 0x00, 0x84, 0x01, 0x00, 0x00, 0x00, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x67, 0x12, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x66, 0x06, 
-    0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x28, 0x43, 0x50, 0x8C, 0x54, 0x8C, 0x0C, 0x14, 0x00, 0x24, 
-    0x66, 0x2A, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x24, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x1E, 0x0C, 0x2C, 
-    0x00, 0x24, 0x00, 0x01, 0x67, 0x10, 0x0C, 0x2C, 0x00, 0x54, 0x00, 0x01, 0x67, 0x08, 0x0C, 0x2C, 
-    0x00, 0x41, 0x00, 0x01, 0x66, 0x06, 0x4A, 0x2C, 0x00, 0x02, 0x67, 0x36, 0x20, 0x45, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x20, 0x04, 0xD0, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x6E, 0xDA, 0x24, 0x80, 
-    0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x20, 0x45, 0x52, 0x85, 0x10, 0x80, 
-    0x2F, 0x0C, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x98, 0x2A, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x78, 0x0C, 0x2C, 0x00, 0x24, 0x00, 0x01, 0x66, 0x24, 0x20, 0x46, 0x91, 0xEE, 0xFF, 0xFC, 
-    0x20, 0x04, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 0xD0, 0x88, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x6E, 0x90, 0x24, 0x80, 0x58, 0x4F, 0x60, 0x4C, 0x0C, 0x2C, 
-    0x00, 0x54, 0x00, 0x01, 0x66, 0x22, 0x20, 0x47, 0x91, 0xEE, 0xFF, 0xFC, 0xD1, 0xFC, 0x10, 0x00, 
-    0x00, 0x00, 0x20, 0x08, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x6E, 0x66, 0x24, 0x80, 0x58, 0x4F, 0x60, 0x22, 0x0C, 0x2C, 0x00, 0x41, 0x00, 0x01, 0x66, 0x1A, 
-    0x20, 0x6E, 0xFF, 0xC8, 0x91, 0xEE, 0xFF, 0xFC, 0xD1, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x2F, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x6E, 0x42, 0x24, 0x80, 0x58, 0x4F, 0x2F, 0x2B, 0x00, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x6E, 0x34, 0x25, 0x40, 0x00, 0x04, 0x50, 0x8A, 0x58, 0x4F, 0x26, 0x13, 0x4A, 0x83, 
-    0x66, 0x00, 0xFE, 0x78, 0x4A, 0xAD, 0xED, 0x34, 0x67, 0x00, 0x09, 0xCC, 0x20, 0x4A, 0x91, 0xEE, 
-    0xFF, 0xB8, 0x20, 0x08, 0xE4, 0x80, 0xE0, 0x88, 0xE0, 0x88, 0xE0, 0x88, 0xEA, 0x88, 0xD0, 0x88, 
-    0xE6, 0x80, 0xB0, 0xAD, 0xED, 0x34, 0x67, 0x2C, 0x20, 0x4A, 0x91, 0xEE, 0xFF, 0xB8, 0x20, 0x08, 
-    0xE4, 0x80, 0xE0, 0x88, 0xE0, 0x88, 0xE0, 0x88, 0xEA, 0x88, 0xD0, 0x88, 0xE6, 0x80, 0x2F, 0x00, 
-    0x2F, 0x2D, 0xED, 0x34, 0x48, 0x79, 0x00, 0x00, 0x1B, 0xE4, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0x3E, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFC, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x56, 0x88, 0x22, 0x08, 
-    0xC2, 0x80, 0xB2, 0xAD, 0xED, 0x44, 0x67, 0x1C, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x2F, 0x08, 
-    0x2F, 0x2D, 0xED, 0x44, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x9E, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0x0E, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xB8, 
-    0x2F, 0x2D, 0xED, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0x7D, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x09, 0x36, 0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x00, 0x06, 0x9C, 0x42, 0xAE, 0xFF, 0xC4, 
-    0x42, 0xAE, 0xFF, 0xC0, 0x42, 0xAE, 0xFF, 0xBC, 0x20, 0x2D, 0xED, 0x34, 0x52, 0x80, 0xE9, 0x88, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x77, 0x18, 0x2D, 0x48, 0xFF, 0xB4, 0x2E, 0x08, 0x2F, 0x2D, 
-    0xED, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0x77, 0x08, 0x2D, 0x48, 0xFF, 0xFC, 0x2A, 0x08, 0x20, 0x45, 
-    0x52, 0x85, 0x42, 0x10, 0x4A, 0x2D, 0xEE, 0x0C, 0x50, 0x4F, 0x66, 0x08, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x00, 0x01, 0xD0, 0x7C, 0x00, 0x78, 0x01, 0x28, 0x6D, 0xF2, 0xA8, 0x60, 0x00, 0x00, 0xF0, 
-    0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x1E, 0x20, 0x6D, 0xED, 0x3C, 
-    0x91, 0xED, 0xED, 0x38, 0x2C, 0x08, 0x2F, 0x2C, 0x00, 0x18, 0x2F, 0x2D, 0xED, 0x3C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFB, 0xDE, 0x2B, 0x48, 0xED, 0x3C, 0x50, 0x4F, 0x26, 0x6C, 0x00, 0x04, 0x60, 0x00, 
-    0x00, 0xB6, 0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x4E, 0x4A, 0xAB, 
-    0x00, 0x14, 0x67, 0x14, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 
-    0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 0x08, 0x00, 0x4A, 0xAB, 0x00, 0x18, 0x67, 0x14, 0x20, 0x04, 
-    0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 
-    0x08, 0x00, 0x4A, 0xAB, 0x00, 0x1C, 0x67, 0x14, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 0x08, 0x00, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x50, 0x76, 0x00, 0x60, 0x46, 0x20, 0x6B, 0x00, 0x10, 0x24, 0x70, 0x3C, 0x00, 0x20, 0x2A, 
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x30, 0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 
-    0xED, 0x38, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0x6D, 
-    0xEE, 0x30, 0x23, 0x88, 0x08, 0x00, 0x48, 0x6A, 0x00, 0x44, 0x2F, 0x2D, 0xED, 0x3C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFB, 0x2E, 0x2B, 0x48, 0xED, 0x3C, 0x50, 0x4F, 0x52, 0x83, 0xB6, 0xAB, 0x00, 0x3C, 
-    0x6D, 0xB4, 0x26, 0x6B, 0x00, 0x68, 0x20, 0x0B, 0x66, 0x00, 0xFF, 0x48, 0x28, 0x54, 0x20, 0x0C, 
-    0x66, 0x00, 0xFF, 0x0E, 0x4A, 0x2D, 0xEE, 0x0C, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x6C, 
-    0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 0xED, 0x38, 0x2C, 0x08, 0x2F, 0x2D, 0xEE, 0xFC, 0x2F, 0x2D, 
-    0xED, 0x3C, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xEA, 0x2B, 0x48, 0xED, 0x3C, 0x4A, 0xAD, 0xEE, 0xB8, 
-    0x50, 0x4F, 0x67, 0x14, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 
-    0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 0x08, 0x00, 0x4A, 0xAD, 0xEE, 0xBC, 0x67, 0x14, 0x20, 0x04, 
-    0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 
-    0x08, 0x00, 0x4A, 0xAD, 0xEE, 0xC0, 0x67, 0x14, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0x21, 0x86, 0x08, 0x00, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x67, 0x50, 0x76, 0x00, 0x60, 0x46, 0x20, 0x6D, 0xEE, 0xB4, 0x24, 0x70, 0x3C, 0x00, 0x20, 0x2A, 
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x30, 0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 
-    0xED, 0x38, 0x20, 0x04, 0x52, 0x84, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22, 0x6D, 
-    0xEE, 0x30, 0x23, 0x88, 0x08, 0x00, 0x48, 0x6A, 0x00, 0x44, 0x2F, 0x2D, 0xED, 0x3C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFA, 0x4E, 0x2B, 0x48, 0xED, 0x3C, 0x50, 0x4F, 0x52, 0x83, 0xB6, 0xAD, 0xEE, 0xE0, 
-    0x6D, 0xB4, 0x20, 0x2D, 0xEE, 0x28, 0x52, 0xAD, 0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 
-    0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0xD1, 0xC0, 0x2C, 0x08, 0x20, 0x2D, 0xEE, 0x28, 0x52, 0xAD, 
-    0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0xD1, 0xC0, 
-    0x28, 0x08, 0x20, 0x44, 0x91, 0xED, 0xEE, 0x30, 0x20, 0x08, 0x4C, 0x7C, 0x08, 0x00, 0x00, 0x00, 
-    0x00, 0x28, 0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x40, 0x00, 0x32, 0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 
-    0xED, 0x38, 0x22, 0x46, 0x22, 0x88, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x96, 0x2F, 0x2D, 0xED, 0x3C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xDC, 0x2B, 0x48, 0xED, 0x3C, 0x20, 0x46, 0x70, 0x02, 0x21, 0x40, 
-    0x00, 0x04, 0x42, 0xA8, 0x00, 0x08, 0x42, 0xA8, 0x00, 0x0C, 0x20, 0x44, 0x91, 0xED, 0xEE, 0x30, 
-    0x20, 0x08, 0x4C, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x46, 0x21, 0x40, 0x00, 0x18, 
-    0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 0xED, 0x38, 0x22, 0x44, 0x22, 0x88, 0x48, 0x79, 0x00, 0x00, 
-    0x1B, 0x8E, 0x2F, 0x2D, 0xED, 0x3C, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x96, 0x2B, 0x48, 0xED, 0x3C, 
-    0x20, 0x44, 0x70, 0x03, 0x21, 0x40, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x08, 0x42, 0xA8, 0x00, 0x0C, 
-    0x42, 0xA8, 0x00, 0x18, 0x42, 0xA8, 0x00, 0x1C, 0x4A, 0x2D, 0xEE, 0x11, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x5E, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x58, 0x2D, 0x45, 0xFF, 0xC4, 0x20, 0x45, 0x52, 0x85, 
-    0x10, 0xBC, 0x00, 0x02, 0x48, 0x79, 0x00, 0x00, 0x1C, 0x2B, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF9, 0x50, 0x2A, 0x08, 0x2D, 0x45, 0xFF, 0xC0, 0x20, 0x45, 0x52, 0x85, 0x10, 0xBC, 0x00, 0x02, 
-    0x48, 0x79, 0x00, 0x00, 0x1C, 0x28, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x34, 0x2A, 0x08, 
-    0x2D, 0x45, 0xFF, 0xBC, 0x20, 0x45, 0x52, 0x85, 0x10, 0xBC, 0x00, 0x02, 0x48, 0x79, 0x00, 0x00, 
-    0x1C, 0x25, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x18, 0x2A, 0x08, 0x4F, 0xEF, 0x00, 0x18, 
-    0x20, 0x47, 0x42, 0x90, 0x42, 0xA8, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x08, 0x42, 0x28, 0x00, 0x0C, 
-    0x42, 0x28, 0x00, 0x0D, 0x42, 0x68, 0x00, 0x0E, 0x70, 0x10, 0xDE, 0x80, 0x26, 0x2D, 0xEF, 0x3C, 
-    0x60, 0x00, 0x01, 0x5E, 0x20, 0x43, 0x26, 0x68, 0x00, 0x04, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 
-    0x40, 0x00, 0x00, 0x00, 0x66, 0x00, 0x01, 0x48, 0x24, 0x6B, 0x00, 0x10, 0x20, 0x0A, 0x67, 0x0A, 
-    0x70, 0x08, 0xC0, 0xAA, 0x00, 0x30, 0x66, 0x00, 0x01, 0x36, 0x28, 0x43, 0x50, 0x8C, 0x54, 0x8C, 
-    0x0C, 0x14, 0x00, 0x24, 0x66, 0x2A, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x24, 0x4A, 0x2D, 0xED, 0xFC, 
-    0x66, 0x1E, 0x0C, 0x2C, 0x00, 0x24, 0x00, 0x01, 0x67, 0x10, 0x0C, 0x2C, 0x00, 0x54, 0x00, 0x01, 
-    0x67, 0x08, 0x0C, 0x2C, 0x00, 0x41, 0x00, 0x01, 0x66, 0x06, 0x4A, 0x2C, 0x00, 0x02, 0x67, 0x36, 
-    0x70, 0x03, 0xC0, 0xAB, 0x00, 0x14, 0x53, 0x80, 0x66, 0x00, 0x00, 0xF4, 0x20, 0x45, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x22, 0x47, 0x22, 0x88, 0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x20, 0x45, 0x52, 0x85, 0x10, 0x80, 0x2F, 0x0C, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x62, 
-    0x2A, 0x08, 0x50, 0x4F, 0x60, 0x40, 0x0C, 0x2C, 0x00, 0x24, 0x00, 0x01, 0x66, 0x0E, 0x20, 0x6E, 
-    0xFF, 0xC4, 0x91, 0xEE, 0xFF, 0xFC, 0x22, 0x47, 0x22, 0x88, 0x60, 0x2A, 0x0C, 0x2C, 0x00, 0x54, 
-    0x00, 0x01, 0x66, 0x0E, 0x20, 0x6E, 0xFF, 0xC0, 0x91, 0xEE, 0xFF, 0xFC, 0x22, 0x47, 0x22, 0x88, 
-    0x60, 0x14, 0x0C, 0x2C, 0x00, 0x41, 0x00, 0x01, 0x66, 0x0C, 0x20, 0x6E, 0xFF, 0xBC, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x22, 0x47, 0x22, 0x88, 0x20, 0x47, 0x21, 0x6B, 0x00, 0x0C, 0x00, 0x04, 0x42, 0xA8, 
-    0x00, 0x08, 0x11, 0x7C, 0x00, 0x02, 0x00, 0x0C, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x67, 0x06, 0x11, 0x7C, 0x00, 0x0D, 0x00, 0x0C, 0x20, 0x0A, 0x66, 0x08, 0x20, 0x47, 
-    0x42, 0x28, 0x00, 0x0C, 0x60, 0x20, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 
-    0x67, 0x0C, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x67, 0x08, 0x20, 0x47, 
-    0x11, 0x7C, 0x00, 0x01, 0x00, 0x0C, 0x20, 0x47, 0x42, 0x28, 0x00, 0x0D, 0xB4, 0xFC, 0x00, 0x00, 
-    0x67, 0x1C, 0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x40, 0x67, 0x0E, 
-    0x20, 0x6A, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x40, 0x60, 0x06, 0x20, 0x3C, 
-    0x00, 0x00, 0xFF, 0xF1, 0x20, 0x47, 0x31, 0x40, 0x00, 0x0E, 0x70, 0x10, 0xDE, 0x80, 0x26, 0x13, 
-    0x4A, 0x83, 0x66, 0x00, 0xFE, 0xA0, 0x20, 0x47, 0x91, 0xEE, 0xFF, 0xB4, 0x20, 0x08, 0xE6, 0x80, 
-    0xE0, 0x88, 0xE0, 0x88, 0xE0, 0x88, 0xE8, 0x88, 0xD0, 0x88, 0xE8, 0x80, 0x20, 0x46, 0x21, 0x40, 
-    0x00, 0x1C, 0x26, 0x2D, 0xEF, 0x3C, 0x60, 0x00, 0x01, 0x14, 0x20, 0x43, 0x26, 0x68, 0x00, 0x04, 
-    0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x40, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0xFE, 0x24, 0x6B, 
-    0x00, 0x10, 0x20, 0x0A, 0x67, 0x0A, 0x70, 0x08, 0xC0, 0xAA, 0x00, 0x30, 0x66, 0x00, 0x00, 0xEC, 
-    0x28, 0x43, 0x50, 0x8C, 0x54, 0x8C, 0x0C, 0x14, 0x00, 0x24, 0x66, 0x20, 0x0C, 0x2C, 0x00, 0x24, 
-    0x00, 0x01, 0x67, 0x10, 0x0C, 0x2C, 0x00, 0x54, 0x00, 0x01, 0x67, 0x08, 0x0C, 0x2C, 0x00, 0x41, 
-    0x00, 0x01, 0x66, 0x08, 0x4A, 0x2C, 0x00, 0x02, 0x67, 0x00, 0x00, 0xC0, 0x70, 0x03, 0xC0, 0xAB, 
-    0x00, 0x14, 0x53, 0x80, 0x67, 0x00, 0x00, 0xB4, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x22, 0x47, 
-    0x22, 0x88, 0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x20, 0x45, 0x52, 0x85, 
-    0x10, 0x80, 0x2F, 0x0C, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0xE6, 0x2A, 0x08, 0x20, 0x47, 
-    0x21, 0x6B, 0x00, 0x0C, 0x00, 0x04, 0x42, 0xA8, 0x00, 0x08, 0x11, 0x7C, 0x00, 0x12, 0x00, 0x0C, 
-    0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x50, 0x4F, 0x67, 0x06, 0x11, 0x7C, 
-    0x00, 0x1D, 0x00, 0x0C, 0x20, 0x0A, 0x66, 0x0A, 0x20, 0x47, 0x11, 0x7C, 0x00, 0x10, 0x00, 0x0C, 
-    0x60, 0x20, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x0C, 0x20, 0x2B, 
-    0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x01, 0x00, 0x67, 0x08, 0x20, 0x47, 0x11, 0x7C, 0x00, 0x11, 
-    0x00, 0x0C, 0x20, 0x47, 0x42, 0x28, 0x00, 0x0D, 0xB4, 0xFC, 0x00, 0x00, 0x67, 0x1C, 0x20, 0x6A, 
-    0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x40, 0x67, 0x0E, 0x20, 0x6A, 0x00, 0x04, 
-    0x20, 0x68, 0x00, 0x04, 0x20, 0x28, 0x00, 0x40, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0xFF, 0xF1, 
-    0x20, 0x47, 0x31, 0x40, 0x00, 0x0E, 0x70, 0x10, 0xDE, 0x80, 0x26, 0x13, 0x4A, 0x83, 0x66, 0x00, 
-    0xFE, 0xEA, 0x60, 0x06, 0x20, 0x45, 0x52, 0x85, 0x42, 0x10, 0x70, 0x03, 0x20, 0x45, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x22, 0x08, 0xC2, 0x80, 0x66, 0xEC, 0x42, 0xA7, 0x20, 0x47, 0x91, 0xEE, 0xFF, 0xB4, 
-    0x20, 0x08, 0xE6, 0x80, 0xE0, 0x88, 0xE0, 0x88, 0xE0, 0x88, 0xE8, 0x88, 0xD0, 0x88, 0xE8, 0x80, 
-    0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xB4, 0x2F, 0x06, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 
-    0x5E, 0x02, 0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x20, 0x42, 0xA7, 0x20, 0x45, 
-    0x91, 0xEE, 0xFF, 0xFC, 0x2F, 0x08, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x04, 0x2F, 0x2D, 0xEC, 0x9C, 
-    0x61, 0xFF, 0x00, 0x00, 0x5D, 0x7E, 0x26, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x4A, 0x83, 0x67, 0x12, 
-    0x2F, 0x2D, 0xED, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x33, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0x6B, 0x5E, 
-    0x50, 0x4F, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 0x67, 0xD4, 0x2B, 0x40, 0xEF, 0x24, 
-    0x58, 0x4F, 0x60, 0x00, 0x02, 0xBC, 0x20, 0x2D, 0xED, 0x34, 0xE9, 0x88, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x70, 0x8C, 0x2D, 0x48, 0xFF, 0xB0, 0x24, 0x48, 0x2F, 0x2D, 0xED, 0x44, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x70, 0x7C, 0x2D, 0x48, 0xFF, 0xFC, 0x2A, 0x08, 0x2F, 0x2D, 0xED, 0x44, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x66, 0xB4, 0x20, 0x45, 0x20, 0x80, 0x58, 0x85, 0x4A, 0x2D, 0xEE, 0x10, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x3E, 0x7C, 0x00, 0x60, 0x30, 0x28, 0x6D, 0xEE, 0xB4, 0x28, 0x74, 0x6C, 0x00, 
-    0x28, 0x6C, 0x00, 0x04, 0x50, 0x8C, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x22, 0x6D, 0xEE, 0xB4, 
-    0x22, 0x71, 0x6C, 0x00, 0x23, 0x48, 0x00, 0x14, 0x2F, 0x0C, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF5, 0x50, 0x2A, 0x08, 0x52, 0x86, 0x50, 0x4F, 0xBC, 0xAD, 0xEE, 0xE0, 0x6D, 0xCA, 0x60, 0x00, 
-    0x00, 0x88, 0x4A, 0xAD, 0xEE, 0xB8, 0x67, 0x1C, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x2D, 0x48, 
-    0xFF, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x20, 0xCE, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x22, 
-    0x2A, 0x08, 0x50, 0x4F, 0x4A, 0xAD, 0xEE, 0xBC, 0x67, 0x1C, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 
-    0x2D, 0x48, 0xFF, 0xD0, 0x48, 0x79, 0x00, 0x00, 0x20, 0xC4, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF5, 0x00, 0x2A, 0x08, 0x50, 0x4F, 0x4A, 0xAD, 0xEE, 0xC0, 0x67, 0x1C, 0x20, 0x45, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x2D, 0x48, 0xFF, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x20, 0xBA, 0x2F, 0x05, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF4, 0xDE, 0x2A, 0x08, 0x50, 0x4F, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x1A, 0x20, 0x45, 
-    0x91, 0xEE, 0xFF, 0xFC, 0x2E, 0x08, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x82, 0x2F, 0x05, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF4, 0xBE, 0x2A, 0x08, 0x50, 0x4F, 0x26, 0x2D, 0xEF, 0x3C, 0x60, 0x00, 0x01, 0x5A, 
-    0x20, 0x43, 0x26, 0x68, 0x00, 0x04, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x12, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x66, 0x0C, 0x70, 0x03, 0xC0, 0xAB, 0x00, 0x14, 0x53, 0x80, 0x67, 0x00, 0x01, 0x3A, 0x4A, 0x2D, 
-    0xEE, 0x06, 0x67, 0x0E, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x03, 0x00, 0x00, 0x00, 0x67, 0x00, 
-    0x01, 0x26, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0x2F, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x98, 
-    0x24, 0x80, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x58, 0x4F, 0x67, 0x1A, 
-    0x2C, 0x2B, 0x00, 0x04, 0x4A, 0x86, 0x6D, 0x12, 0x28, 0x6D, 0xEC, 0xEC, 0x28, 0x06, 0x4C, 0x2D, 
-    0x48, 0x00, 0xE9, 0x72, 0xD8, 0xAC, 0x00, 0x28, 0x60, 0x08, 0x28, 0x2B, 0x00, 0x0C, 0x28, 0x6B, 
-    0x00, 0x10, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x5E, 0x25, 0x40, 0x00, 0x08, 0x28, 0x2B, 
-    0x00, 0x14, 0x02, 0x84, 0x80, 0xFF, 0xFF, 0xFF, 0x4A, 0x2D, 0xEE, 0x10, 0x58, 0x4F, 0x67, 0x04, 
-    0x20, 0x0C, 0x66, 0x04, 0x70, 0x04, 0x88, 0x80, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x38, 
-    0x25, 0x40, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x0C, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x00, 0x00, 0x92, 
-    0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x64, 0xB2, 0x28, 0x00, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x58, 0x4F, 0x67, 0x34, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x64, 0x9E, 0x28, 0x00, 
-    0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 0x98, 0xA8, 0x00, 0x28, 0x2F, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x64, 0xF4, 0x25, 0x40, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x04, 
-    0x28, 0x28, 0x00, 0x14, 0x50, 0x4F, 0x60, 0x3A, 0x70, 0x08, 0xC0, 0xAC, 0x00, 0x30, 0x66, 0x56, 
-    0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x67, 0x06, 0x28, 0x2E, 0xFF, 0xCC, 0x60, 0x22, 
-    0x20, 0x04, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x04, 0x28, 0x07, 0x60, 0x14, 0x20, 0x04, 
-    0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x06, 0x28, 0x2E, 0xFF, 0xD4, 0x60, 0x04, 0x28, 0x2E, 
-    0xFF, 0xD0, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x64, 0x9E, 0x25, 0x40, 0x00, 0x0C, 0x58, 0x4F, 
-    0x20, 0x43, 0x48, 0x68, 0x00, 0x0A, 0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x64, 0x2A, 0x08, 
-    0x70, 0x10, 0xD5, 0xC0, 0x50, 0x4F, 0x26, 0x13, 0x4A, 0x83, 0x66, 0x00, 0xFE, 0xA4, 0x4A, 0xAD, 
-    0xED, 0x34, 0x67, 0x22, 0x20, 0x2D, 0xED, 0x34, 0xE9, 0x88, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xB0, 
-    0x2F, 0x2D, 0xED, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0x74, 0x52, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x06, 
-    0x20, 0x45, 0x52, 0x85, 0x42, 0x10, 0x20, 0x45, 0x91, 0xEE, 0xFF, 0xFC, 0xB1, 0xED, 0xED, 0x44, 
-    0x6D, 0xEE, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0x44, 0x6C, 0x16, 0x2F, 0x2D, 0xED, 0x44, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x2F, 0x2D, 0xED, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x74, 0x20, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xB0, 0x48, 0xE7, 0x00, 0x30, 
-    0x24, 0x6D, 0xEF, 0x3C, 0x60, 0x3A, 0x26, 0x6A, 0x00, 0x04, 0x48, 0x6A, 0x00, 0x0A, 0x2F, 0x2B, 
-    0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x72, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 0x00, 0x00, 
-    0x67, 0x7A, 0x41, 0xEE, 0xFF, 0xB0, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0x66, 0x24, 0x53, 0x4F, 0xEF, 0x00, 0x18, 
-    0x20, 0x0A, 0x66, 0xC2, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xDC, 
-    0x48, 0xE7, 0x18, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x28, 0xE5, 0x88, 0xD0, 0xAB, 
-    0x00, 0x40, 0x72, 0x0C, 0xD0, 0x81, 0x20, 0x6D, 0xED, 0x10, 0x20, 0x68, 0x00, 0x04, 0x22, 0x28, 
-    0x00, 0x0C, 0x92, 0x80, 0xE4, 0x81, 0x02, 0x81, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x81, 0xEB, 0x00, 
-    0x00, 0x00, 0x2F, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x8E, 0x2D, 0x40, 0xFF, 0xDC, 0x20, 0x2B, 
-    0x00, 0x28, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x7C, 0x2D, 0x40, 0xFF, 0xE0, 
-    0x2F, 0x2B, 0x00, 0x44, 0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x6E, 0x2D, 0x40, 0xFF, 0xE4, 0x2F, 0x2B, 
-    0x00, 0x48, 0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x60, 0x2D, 0x40, 0xFF, 0xE8, 0x20, 0x6B, 0x00, 0x58, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x28, 0x00, 0x24, 0x6B, 0x00, 0x58, 0x76, 0x00, 
-    0x4F, 0xEF, 0x00, 0x10, 0x60, 0x18, 0x41, 0xEE, 0xFF, 0xDC, 0x11, 0x84, 0x38, 0x10, 0x52, 0x83, 
-    0x10, 0x39, 0x00, 0x00, 0x2D, 0x3A, 0x49, 0xC0, 0xB8, 0x80, 0x66, 0x02, 0x76, 0x00, 0x18, 0x1A, 
-    0x49, 0xC4, 0x66, 0xE2, 0x60, 0x0C, 0x20, 0x03, 0x52, 0x83, 0x41, 0xEE, 0xFF, 0xDC, 0x42, 0x30, 
-    0x08, 0x10, 0x70, 0x0C, 0xB6, 0x80, 0x6D, 0xEE, 0x20, 0x6B, 0x00, 0x4C, 0x20, 0x28, 0x00, 0x08, 
-    0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x62, 0xFE, 0x2D, 0x40, 0xFF, 0xF8, 0x48, 0x78, 
-    0x00, 0x20, 0x48, 0x6E, 0xFF, 0xDC, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0xDC, 
-    0x20, 0x6B, 0x00, 0x4C, 0x24, 0x50, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x64, 0xB5, 0xCB, 0x67, 0x5C, 
-    0x4A, 0x2D, 0xEE, 0x09, 0x66, 0x08, 0x70, 0x01, 0xC0, 0xAD, 0xED, 0xE8, 0x67, 0x1A, 0x20, 0x2A, 
-    0x00, 0x28, 0x90, 0xAB, 0x00, 0x28, 0xE5, 0x88, 0x22, 0x2A, 0x00, 0x40, 0x92, 0xAB, 0x00, 0x40, 
-    0xD2, 0x80, 0x2D, 0x41, 0xFF, 0xFC, 0x60, 0x10, 0x20, 0x2A, 0x00, 0x28, 0xE5, 0x88, 0xD0, 0xAA, 
-    0x00, 0x40, 0x50, 0x80, 0x2D, 0x40, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x62, 0x96, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2D, 
-    0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0x74, 0x4F, 0xEF, 0x00, 0x10, 0x24, 0x6A, 0x00, 0x54, 
-    0x20, 0x0A, 0x66, 0x98, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x10, 0x30, 0x2F, 0x3C, 0xE5, 0x0F, 0xE0, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x62, 0x58, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x6D, 0xEE, 0xF4, 0x58, 0x4F, 0x60, 0x46, 0x24, 0x53, 0x60, 0x3A, 
-    0x70, 0x01, 0xC0, 0xAA, 0x00, 0x70, 0x67, 0x2E, 0x26, 0x2A, 0x00, 0x28, 0x60, 0x16, 0x48, 0x78, 
-    0x00, 0x04, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x72, 0x1C, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x03, 0x53, 0x83, 0x4A, 0x80, 0x6C, 0xE2, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0x4C, 0x58, 0x4F, 0x24, 0x6A, 0x00, 0x54, 0x20, 0x0A, 0x66, 0xC2, 0x26, 0x6B, 
-    0x00, 0x04, 0x20, 0x0B, 0x66, 0xB6, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x76, 0x0C, 0xD6, 0xAC, 0x00, 0x40, 
-    0x26, 0x6D, 0xEF, 0x3C, 0x60, 0x78, 0x24, 0x6B, 0x00, 0x04, 0x4A, 0xAA, 0x00, 0x04, 0x6D, 0x6C, 
-    0x20, 0x6A, 0x00, 0x10, 0xB9, 0xE8, 0x00, 0x10, 0x66, 0x62, 0x20, 0x2A, 0x00, 0x0C, 0x90, 0x83, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x58, 0x83, 0x4A, 0x2D, 0xEE, 0x09, 0x67, 0x1C, 0x20, 0x2D, 0xEC, 0xA0, 
-    0x06, 0x80, 0x70, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xDB, 0x44, 0x20, 0x2D, 
-    0xF2, 0xE2, 0xD1, 0xAE, 0xFF, 0xFC, 0x58, 0x4F, 0x20, 0x2E, 0xFF, 0xFC, 0xE4, 0x80, 0x02, 0x80, 
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xEA, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x61, 0x86, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2D, 
-    0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x71, 0x64, 0x4F, 0xEF, 0x00, 0x10, 0x26, 0x52, 0x20, 0x0B, 
-    0x66, 0x84, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x1C, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2D, 0xED, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0x61, 0x48, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xF8, 0x2F, 0x2D, 0xEC, 0xA0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x71, 0x26, 0x4A, 0x2D, 0xEE, 0x0B, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x24, 
-    0x2F, 0x2D, 0xE9, 0x76, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x4A, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x7E, 
-    0x2F, 0x2D, 0xED, 0x30, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x31, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x6E, 
-    0x4F, 0xEF, 0x00, 0x10, 0x4A, 0xAD, 0xED, 0x30, 0x67, 0x00, 0x00, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x6B, 0x12, 0x20, 0x2D, 0xED, 0x30, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x6A, 0xA0, 
-    0x2A, 0x08, 0x26, 0x6D, 0xEF, 0x3C, 0x58, 0x4F, 0x60, 0x64, 0x24, 0x6B, 0x00, 0x04, 0x20, 0x2A, 
-    0x00, 0x14, 0x02, 0x80, 0x02, 0x00, 0x00, 0x00, 0x67, 0x52, 0x28, 0x2A, 0x00, 0x04, 0x4A, 0x84, 
-    0x6D, 0x4A, 0x20, 0x2C, 0x00, 0x48, 0x90, 0xAC, 0x00, 0x44, 0x26, 0x2A, 0x00, 0x0C, 0x96, 0x80, 
-    0x20, 0x2A, 0x00, 0x14, 0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x66, 0x02, 0x58, 0x83, 0x2F, 0x03, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x60, 0xA2, 0x20, 0x45, 0x21, 0x80, 0x4C, 0x00, 0x4A, 0x2D, 0xEE, 0x0B, 
-    0x58, 0x4F, 0x67, 0x18, 0x48, 0x6B, 0x00, 0x08, 0x2F, 0x03, 0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x1B, 0x16, 0x61, 0xFF, 0xFF, 0xFF, 0x64, 0xE6, 0x4F, 0xEF, 0x00, 0x10, 0x26, 0x52, 0x20, 0x0B, 
-    0x66, 0x98, 0x20, 0x2D, 0xED, 0x30, 0xE5, 0x88, 0x2F, 0x00, 0x2F, 0x05, 0x2F, 0x2D, 0xEC, 0xA0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x56, 0x61, 0xFF, 0xFF, 0xFF, 0x6A, 0x9A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4A, 0x2D, 0xED, 0xFD, 0x67, 0x54, 0x20, 0x6D, 0xEC, 0xF0, 0x20, 0x68, 0x00, 0x04, 0x2F, 0x28, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x60, 0x40, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 
-    0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x70, 0x1E, 0x20, 0x6D, 
-    0xEC, 0xF4, 0x20, 0x68, 0x00, 0x04, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x60, 0x18, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2D, 0xEC, 0xA0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x6F, 0xF6, 0x4F, 0xEF, 0x00, 0x20, 0x2F, 0x2D, 0xE9, 0x76, 0x2F, 0x2D, 
-    0xE9, 0x7A, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x6F, 0xE0, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x18, 0x38, 
-    0x26, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x24, 0x43, 0x26, 0x6D, 0xEC, 0x9C, 0x20, 0x0B, 
-    0x67, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x59, 0x40, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x5A, 
-    0x4A, 0x14, 0x67, 0x56, 0x4A, 0x2D, 0xED, 0xFE, 0x67, 0x50, 0x4A, 0x2D, 0xEE, 0x0D, 0x66, 0x08, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x42, 0x20, 0x4C, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x43, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0xD0, 0xAE, 0xFF, 0xFC, 0x52, 0x80, 0x28, 0x00, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x67, 0xBA, 
-    0x24, 0x48, 0x20, 0x4A, 0x22, 0x43, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x0C, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0x7E, 0x6C, 0x4F, 0xEF, 0x00, 0x0C, 0x2B, 0x4A, 0xED, 0xC8, 0x4A, 0x2D, 
-    0xEE, 0x0D, 0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x1B, 0x10, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 
-    0x1B, 0x14, 0x48, 0x50, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x58, 0x7E, 0x26, 0x48, 0x2B, 0x48, 
-    0xEC, 0x9C, 0x20, 0x0B, 0x50, 0x4F, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x88, 0x50, 0x4F, 0x2F, 0x2D, 0xEC, 0xA8, 0x42, 0xA7, 0x2F, 0x2D, 
-    0xEC, 0xA4, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x61, 0x88, 0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xDF, 
-    0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x70, 0x01, 0x20, 0x80, 0x42, 0xA8, 
-    0x00, 0x04, 0x21, 0x6F, 0x00, 0x08, 0x00, 0x10, 0x21, 0x6F, 0x00, 0x0C, 0x00, 0x14, 0x21, 0x6F, 
-    0x00, 0x10, 0x00, 0x18, 0x70, 0x04, 0x21, 0x40, 0x00, 0x1C, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 
-    0x42, 0xA8, 0x00, 0x08, 0x42, 0xA8, 0x00, 0x0C, 0x42, 0xA8, 0x00, 0x18, 0x42, 0xA8, 0x00, 0x1C, 
-    0x42, 0xA8, 0x00, 0x10, 0x21, 0x6F, 0x00, 0x08, 0x00, 0x14, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xAC, 
-    0x48, 0x79, 0x00, 0x00, 0x1A, 0xEE, 0x48, 0x79, 0x00, 0x00, 0x32, 0x6A, 0x48, 0x79, 0x00, 0x00, 
-    0x1A, 0xFA, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 0x00, 0x00, 0x62, 0x20, 0x41, 0xEE, 0xFF, 0xB0, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x6D, 0x0C, 0x48, 0x6E, 0xFF, 0xAC, 0x61, 0xFF, 0x00, 0x00, 0x58, 0x96, 0x48, 0x6E, 
-    0xFF, 0xAC, 0x61, 0xFF, 0x00, 0x00, 0x7E, 0xEC, 0x58, 0x4F, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 
-    0x1A, 0xDE, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 0x00, 0x00, 0x61, 0xE0, 0x41, 0xEE, 0xFF, 0xB0, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x6C, 0xCC, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0x00, 0x00, 
-    0x1A, 0xC0, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 0x00, 0x00, 0x61, 0xB0, 0x41, 0xEE, 0xFF, 0xB0, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xB0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x6C, 0x9C, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xA4, 0x48, 0xE7, 0x1F, 0x38, 
-    0x28, 0x2E, 0x00, 0x08, 0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x00, 0x01, 0x24, 0x41, 0xEE, 0xFF, 0x00, 
-    0x43, 0xF9, 0x00, 0x00, 0x2E, 0x7C, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x44, 0x24, 0x68, 
-    0x00, 0x08, 0x60, 0x00, 0x01, 0x04, 0x48, 0x78, 0x00, 0xFE, 0x20, 0x6A, 0x00, 0x04, 0x48, 0x68, 
-    0x00, 0x08, 0x48, 0x6E, 0xFF, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0x60, 0x04, 0x41, 0xEE, 0xFF, 0x00, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 
-    0x90, 0x83, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x0C, 0x41, 0xEE, 0xFF, 0x00, 0x48, 0x70, 
-    0x38, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x5F, 0xD8, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x6E, 0xFF, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x61, 0x5E, 0x26, 0x48, 0x20, 0x0B, 0x4F, 0xEF, 0x00, 0x20, 0x67, 0x32, 
-    0x20, 0x6B, 0x00, 0x04, 0x2A, 0x28, 0x00, 0x0C, 0xBA, 0xAA, 0x00, 0x28, 0x6F, 0x24, 0x2F, 0x2A, 
-    0x00, 0x28, 0x2F, 0x05, 0x48, 0x6E, 0xFF, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x9B, 0x61, 0xFF, 
-    0x00, 0x00, 0x5F, 0x9A, 0x20, 0x6B, 0x00, 0x04, 0x21, 0x6A, 0x00, 0x28, 0x00, 0x0C, 0x4F, 0xEF, 
-    0x00, 0x10, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x90, 0x83, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 
-    0x2E, 0x04, 0x41, 0xEE, 0xFF, 0x00, 0x48, 0x70, 0x38, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x5F, 0x70, 
-    0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x6E, 0xFF, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x60, 0xF6, 0x26, 0x48, 
-    0x20, 0x0B, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x3C, 0x2C, 0x2A, 0x00, 0x28, 0xDC, 0xAA, 0x00, 0x18, 
-    0x20, 0x6B, 0x00, 0x04, 0x2E, 0x28, 0x00, 0x0C, 0xBC, 0x87, 0x6F, 0x28, 0x2F, 0x06, 0x2F, 0x07, 
-    0x48, 0x6E, 0xFF, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x9B, 0x61, 0xFF, 0x00, 0x00, 0x5F, 0x2E, 
-    0x20, 0x2A, 0x00, 0x28, 0xD0, 0xAA, 0x00, 0x18, 0x20, 0x6B, 0x00, 0x04, 0x21, 0x40, 0x00, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x10, 0x24, 0x6A, 0x00, 0x08, 0x20, 0x0A, 0x66, 0x00, 0xFE, 0xFA, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x66, 0xF0, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x67, 0x1A, 0x2F, 0x2D, 0xF2, 0xEE, 
-    0x20, 0x44, 0x2F, 0x28, 0x00, 0x58, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x42, 0xAD, 0xEF, 0x24, 
-    0x42, 0xAD, 0xEC, 0xA0, 0x50, 0x4F, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x7A, 0xA6, 0x4A, 0x2D, 
-    0xEE, 0x0D, 0x58, 0x4F, 0x67, 0x12, 0x2F, 0x2D, 0xF2, 0xE2, 0x48, 0x79, 0x00, 0x00, 0x2B, 0x4D, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xDA, 0x50, 0x4F, 0x48, 0x78, 0x00, 0x08, 0x48, 0x6D, 0xEC, 0xAC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x67, 0x6E, 0x48, 0x78, 0x00, 0x04, 0x48, 0x6D, 0xEC, 0xBC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x67, 0x60, 0x2D, 0x7C, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xF0, 0x2D, 0x7C, 0xFF, 0xFF, 
-    0xFF, 0x00, 0xFE, 0xEC, 0x2D, 0x7C, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xE8, 0x42, 0xAE, 0xFE, 0xFC, 
-    0x42, 0xAE, 0xFE, 0xF8, 0x42, 0xAE, 0xFE, 0xF4, 0x4F, 0xEF, 0x00, 0x10, 0x70, 0x06, 0xB0, 0xAD, 
-    0xED, 0xCC, 0x66, 0x00, 0x01, 0x86, 0x20, 0x44, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x7A, 0x20, 0x2D, 
-    0xEE, 0x2C, 0x52, 0xAD, 0xEE, 0x2C, 0xEB, 0x88, 0x20, 0x6D, 0xEE, 0x34, 0xD1, 0xC0, 0x2D, 0x48, 
-    0xFE, 0xF0, 0x48, 0x78, 0x00, 0x05, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x14, 0x2F, 0x28, 0x00, 0x14, 
-    0x2F, 0x2E, 0xFE, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x4A, 0x2D, 0xEE, 0x0C, 0x4F, 0xEF, 
-    0x00, 0x10, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x3E, 0x20, 0x2D, 0xEE, 0x28, 0x52, 0xAD, 
-    0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 0xD1, 0xC0, 
-    0x2D, 0x48, 0xFE, 0xFC, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x14, 0x2F, 0x2E, 0xFE, 0xFC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFC, 0xFC, 0x20, 0x6E, 0xFE, 0xFC, 0x70, 0x01, 0x21, 0x40, 0x00, 0x04, 0x21, 0x7C, 
-    0x20, 0x00, 0x00, 0x06, 0x00, 0x08, 0x50, 0x4F, 0x20, 0x44, 0x4A, 0xA8, 0x00, 0x18, 0x67, 0x7A, 
-    0x20, 0x2D, 0xEE, 0x2C, 0x52, 0xAD, 0xEE, 0x2C, 0xEB, 0x88, 0x20, 0x6D, 0xEE, 0x34, 0xD1, 0xC0, 
-    0x2D, 0x48, 0xFE, 0xEC, 0x48, 0x78, 0x00, 0x06, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x18, 0x2F, 0x28, 
-    0x00, 0x18, 0x2F, 0x2E, 0xFE, 0xEC, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x8E, 0x4A, 0x2D, 0xEE, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x10, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x3E, 0x20, 0x2D, 0xEE, 0x28, 
-    0x52, 0xAD, 0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 
-    0xD1, 0xC0, 0x2D, 0x48, 0xFE, 0xF8, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x18, 0x2F, 0x2E, 0xFE, 0xF8, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x7A, 0x20, 0x6E, 0xFE, 0xF8, 0x70, 0x01, 0x21, 0x40, 0x00, 0x04, 
-    0x21, 0x7C, 0x20, 0x00, 0x00, 0x03, 0x00, 0x08, 0x50, 0x4F, 0x20, 0x44, 0x4A, 0xA8, 0x00, 0x1C, 
-    0x67, 0x78, 0x20, 0x2D, 0xEE, 0x2C, 0x52, 0xAD, 0xEE, 0x2C, 0xEB, 0x88, 0x20, 0x6D, 0xEE, 0x34, 
-    0xD1, 0xC0, 0x2D, 0x48, 0xFE, 0xE8, 0x48, 0x78, 0x00, 0x06, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x1C, 
-    0x42, 0xA7, 0x2F, 0x2E, 0xFE, 0xE8, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x0E, 0x4A, 0x2D, 0xEE, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x10, 0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x3E, 0x20, 0x2D, 0xEE, 0x28, 
-    0x52, 0xAD, 0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x6D, 0xEE, 0x30, 
-    0xD1, 0xC0, 0x2D, 0x48, 0xFE, 0xF4, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x1C, 0x2F, 0x2E, 0xFE, 0xF4, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xFA, 0x20, 0x6E, 0xFE, 0xF4, 0x70, 0x08, 0x21, 0x40, 0x00, 0x04, 
-    0x21, 0x7C, 0x20, 0x00, 0x00, 0x03, 0x00, 0x08, 0x50, 0x4F, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 
-    0x67, 0x14, 0x20, 0x44, 0x22, 0x44, 0x20, 0x29, 0x00, 0x14, 0xD0, 0xA8, 0x00, 0x18, 0xD0, 0xA8, 
-    0x00, 0x1C, 0x2B, 0x40, 0xEF, 0x28, 0x7C, 0x00, 0x97, 0xCB, 0x20, 0x44, 0x2A, 0x28, 0x00, 0x0C, 
-    0x20, 0x28, 0x00, 0x38, 0xE5, 0x88, 0x20, 0x45, 0xD1, 0xC0, 0x2E, 0x08, 0x60, 0x00, 0x01, 0x98, 
-    0x20, 0x45, 0x24, 0x50, 0x4A, 0xAD, 0xED, 0x18, 0x6E, 0x06, 0x4A, 0x2D, 0xEE, 0x11, 0x66, 0x14, 
-    0x4A, 0x2D, 0xEE, 0x10, 0x66, 0x0E, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 
-    0x66, 0x00, 0x01, 0x72, 0x4A, 0x2D, 0xED, 0xFE, 0x67, 0x60, 0x4A, 0x2D, 0xEE, 0x0D, 0x66, 0x08, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x52, 0x20, 0x44, 0x20, 0x28, 0x00, 0x30, 0xB0, 0xAA, 
-    0x00, 0x28, 0x66, 0x46, 0x4A, 0xAA, 0x00, 0x18, 0x6F, 0x40, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 
-    0x00, 0x00, 0x20, 0x00, 0x66, 0x34, 0x2F, 0x2D, 0xF2, 0xF2, 0x2F, 0x28, 0x00, 0x58, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFA, 0x48, 0x42, 0xAD, 0xEC, 0xA0, 0x42, 0xAD, 0xEF, 0x24, 0x4A, 0x2D, 0xEE, 0x0D, 
-    0x50, 0x4F, 0x67, 0x16, 0x2F, 0x2D, 0xED, 0xD4, 0x48, 0x79, 0x00, 0x00, 0x2B, 0x53, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFB, 0x4C, 0x42, 0xAD, 0xE9, 0xA6, 0x50, 0x4F, 0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 
-    0x66, 0x00, 0x00, 0xF8, 0x20, 0x6A, 0x00, 0x04, 0x2D, 0x68, 0x00, 0x04, 0xFE, 0xA4, 0xBC, 0xAE, 
-    0xFE, 0xA4, 0x67, 0x60, 0x2C, 0x2E, 0xFE, 0xA4, 0x97, 0xCB, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x54, 
-    0x20, 0x46, 0x20, 0x28, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x46, 0x21, 0x6D, 
-    0xEE, 0x28, 0x00, 0x40, 0x20, 0x2D, 0xEE, 0x28, 0x52, 0xAD, 0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 
-    0x00, 0x00, 0x00, 0x28, 0x26, 0x6D, 0xEE, 0x30, 0xD7, 0xC0, 0x70, 0x01, 0x27, 0x40, 0x00, 0x04, 
-    0x27, 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0xAB, 0x00, 0x0C, 0x42, 0xAB, 0x00, 0x18, 
-    0x42, 0xAB, 0x00, 0x1C, 0x27, 0x6D, 0xEF, 0x24, 0x00, 0x10, 0x27, 0x6A, 0x00, 0x28, 0x00, 0x0C, 
-    0x42, 0xAB, 0x00, 0x14, 0x20, 0x0B, 0x67, 0x08, 0x20, 0x2A, 0x00, 0x18, 0xD1, 0xAB, 0x00, 0x14, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x66, 0x6E, 0x28, 0x6E, 0xFE, 0xF0, 
-    0x26, 0x2E, 0xFE, 0xFC, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x66, 0x1C, 
-    0x28, 0x6E, 0xFE, 0xEC, 0x26, 0x2E, 0xFE, 0xF8, 0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x67, 0x08, 0x28, 0x6E, 0xFE, 0xE8, 0x26, 0x2E, 0xFE, 0xF4, 0x20, 0x43, 0x91, 0xED, 
-    0xEE, 0x30, 0x20, 0x08, 0x4C, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x46, 0x21, 0x40, 
-    0x00, 0x40, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x22, 0x29, 0x6D, 0xEF, 0x24, 0x00, 0x04, 0x29, 0x6A, 
-    0x00, 0x28, 0x00, 0x08, 0x42, 0xAC, 0x00, 0x0C, 0x4A, 0x83, 0x67, 0x0E, 0x20, 0x43, 0x21, 0x6D, 
-    0xEF, 0x24, 0x00, 0x10, 0x21, 0x6A, 0x00, 0x28, 0x00, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xD7, 0xF8, 0x58, 0x4F, 0x58, 0x85, 0xBA, 0x87, 0x65, 0x00, 0xFE, 0x66, 0x4A, 0xAD, 0xED, 0x18, 
-    0x6F, 0x74, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x58, 0x26, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF6, 0x6C, 0x2B, 0x6D, 0xEC, 0xA0, 0xEF, 0x24, 0x20, 0x2D, 0xEC, 0xA0, 0x90, 0x83, 
-    0x26, 0x00, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x4E, 0x20, 0x44, 0x2A, 0x28, 0x00, 0x0C, 0x20, 0x28, 
-    0x00, 0x38, 0xE5, 0x88, 0x20, 0x45, 0xD1, 0xC0, 0x2E, 0x08, 0x60, 0x20, 0x20, 0x45, 0x24, 0x50, 
-    0x20, 0x2A, 0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x0E, 0xD7, 0xAA, 0x00, 0x28, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xD7, 0x92, 0x58, 0x4F, 0x58, 0x85, 0xBA, 0x87, 0x65, 0xDC, 
-    0x60, 0x14, 0x70, 0x01, 0x20, 0x44, 0xC0, 0xA8, 0x00, 0x70, 0x67, 0x0A, 0x2F, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF6, 0x7E, 0x58, 0x4F, 0x48, 0x6D, 0xEC, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 0x68, 0xE0, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x58, 0x4F, 0x66, 0x5E, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 
-    0x67, 0x56, 0x4A, 0x2D, 0xEE, 0x0E, 0x66, 0x50, 0x20, 0x44, 0x26, 0x28, 0x00, 0x1C, 0x48, 0x78, 
-    0x00, 0x40, 0x42, 0xA7, 0x48, 0x6E, 0xFE, 0xA8, 0x61, 0xFF, 0x00, 0x00, 0x76, 0xA2, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x1A, 0x48, 0x78, 0x00, 0x40, 0x48, 0x6E, 0xFE, 0xA8, 0x2F, 0x2D, 0xEC, 0xA0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x68, 0x16, 0x70, 0x40, 0x96, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x40, 
-    0xB6, 0x80, 0x62, 0xE0, 0x2F, 0x03, 0x48, 0x6E, 0xFE, 0xA8, 0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x67, 0xF8, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x0E, 0x41, 0xED, 
-    0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0x76, 0x4A, 0x4A, 0xAD, 0xED, 0x40, 
-    0x67, 0x30, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x28, 0x70, 0xFC, 0x22, 0x2D, 0xED, 0x40, 
-    0x58, 0x81, 0xC2, 0x80, 0x2B, 0x41, 0xED, 0x40, 0x2F, 0x2D, 0xED, 0x40, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x61, 0x7E, 0x2B, 0x48, 0xED, 0x38, 0x2B, 0x48, 0xED, 0x3C, 0x52, 0xAD, 0xED, 0x3C, 0x42, 0x10, 
-    0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x0D, 0x67, 0x24, 0x48, 0x78, 0x00, 0x10, 0x48, 0x79, 0x00, 0x00, 
-    0x1A, 0x8A, 0x61, 0xFF, 0xFF, 0xFF, 0x66, 0x28, 0x4A, 0x2D, 0xEE, 0x11, 0x50, 0x4F, 0x67, 0x00, 
-    0x00, 0xB8, 0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x74, 0x60, 0x00, 0x00, 0xAE, 0x4A, 0x2D, 0xEE, 0x11, 
-    0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x7A, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x72, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x5A, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x06, 0x66, 0x00, 0x00, 0x8A, 
-    0x76, 0x03, 0xC6, 0xAD, 0xEC, 0xA0, 0x20, 0x6D, 0xEE, 0xF4, 0x28, 0x10, 0x42, 0xAD, 0xEE, 0xF4, 
-    0x4A, 0x83, 0x67, 0x1A, 0x70, 0x04, 0x90, 0x83, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x32, 0x30, 
-    0x2F, 0x2D, 0xEC, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x67, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x2B, 0x6D, 
-    0xEC, 0xA0, 0xEF, 0x24, 0x26, 0x2D, 0xED, 0x30, 0x52, 0x83, 0xE5, 0x8B, 0x20, 0x44, 0xD6, 0xA8, 
-    0x00, 0x14, 0xD6, 0xAD, 0xE9, 0x76, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x57, 0x1A, 0x22, 0x2D, 
-    0xED, 0x1C, 0xE9, 0x89, 0x20, 0x6D, 0xEE, 0x78, 0x21, 0x80, 0x18, 0x18, 0x58, 0x4F, 0x60, 0x00, 
-    0xFA, 0xBC, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x20, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x67, 0x18, 
-    0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x96, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x06, 0x58, 0x4F, 
-    0x66, 0x06, 0x41, 0xED, 0xEE, 0xA4, 0x28, 0x08, 0x4A, 0xAD, 0xED, 0x40, 0x67, 0x00, 0x00, 0xD4, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x00, 0x00, 0xCA, 0x20, 0x2D, 0xEE, 0x28, 0x52, 0xAD, 
-    0xEE, 0x28, 0x4C, 0x3C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x24, 0x6D, 0xEE, 0x30, 0xD5, 0xC0, 
-    0x20, 0x4A, 0x91, 0xED, 0xEE, 0x30, 0x20, 0x08, 0x4C, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 
-    0x20, 0x6D, 0xF2, 0xCE, 0x31, 0x40, 0x00, 0x32, 0x20, 0x6D, 0xED, 0x3C, 0x91, 0xED, 0xED, 0x38, 
-    0x24, 0x88, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x80, 0x2F, 0x2D, 0xED, 0x3C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE5, 0x60, 0x2B, 0x48, 0xED, 0x3C, 0x70, 0x03, 0x25, 0x40, 0x00, 0x04, 0x42, 0xAA, 0x00, 0x08, 
-    0x42, 0xAA, 0x00, 0x0C, 0x42, 0xAA, 0x00, 0x18, 0x42, 0xAA, 0x00, 0x1C, 0x50, 0x4F, 0x60, 0x0A, 
-    0x20, 0x6D, 0xED, 0x3C, 0x52, 0xAD, 0xED, 0x3C, 0x42, 0x10, 0x70, 0x03, 0x20, 0x6D, 0xED, 0x3C, 
-    0x91, 0xED, 0xED, 0x38, 0x22, 0x08, 0xC2, 0x80, 0x66, 0xE6, 0x42, 0xA7, 0x20, 0x6D, 0xED, 0x3C, 
-    0x91, 0xED, 0xED, 0x38, 0x2F, 0x08, 0x2F, 0x2D, 0xED, 0x38, 0x2F, 0x0A, 0x2F, 0x2D, 0xEC, 0x9C, 
-    0x61, 0xFF, 0x00, 0x00, 0x4C, 0x9E, 0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x12, 
-    0x2F, 0x2D, 0xED, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x33, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0x5A, 0x7E, 
-    0x50, 0x4F, 0x2F, 0x2D, 0xEC, 0x9C, 0x61, 0xFF, 0x00, 0x00, 0x56, 0xF4, 0x2B, 0x40, 0xEF, 0x24, 
-    0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x09, 0x67, 0x68, 0x4A, 0x2D, 0xEE, 0x0F, 0x67, 0x18, 0x2F, 0x2D, 
-    0xEE, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0xF0, 0x58, 0x4F, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x66, 0x40, 0x58, 0x4F, 0x60, 0x2C, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x66, 0x24, 0x2F, 0x2D, 
-    0xF2, 0xA4, 0x2F, 0x2D, 0xF2, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x66, 0x8A, 0x2F, 0x2D, 0xF2, 0xA4, 
-    0x2F, 0x2D, 0xF2, 0xA0, 0x2F, 0x2D, 0xEF, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0xAE, 0x4F, 0xEF, 
-    0x00, 0x14, 0x48, 0x6D, 0xEC, 0xBC, 0x61, 0xFF, 0xFF, 0xFF, 0x66, 0x24, 0x4A, 0x2D, 0xEE, 0x0F, 
-    0x58, 0x4F, 0x66, 0x0C, 0x48, 0x78, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0xF4, 0x58, 0x4F, 
-    0x4A, 0x2D, 0xEE, 0x0A, 0x67, 0x7A, 0x26, 0x2D, 0xF1, 0xE4, 0x24, 0x6D, 0xF1, 0xE0, 0x20, 0x03, 
-    0xE4, 0x88, 0xE5, 0x88, 0xD5, 0xC0, 0x20, 0x2D, 0xEF, 0x20, 0xD0, 0xAD, 0xF2, 0xE2, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x55, 0x72, 0x25, 0x40, 0xFF, 0xF8, 0x2F, 0x2D, 0xF2, 0xE2, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x55, 0x64, 0x25, 0x40, 0xFF, 0xFC, 0x2F, 0x03, 0x2F, 0x2D, 0xF1, 0xE0, 0x2F, 0x2D, 
-    0xEF, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x44, 0x48, 0x6D, 0xEC, 0xBC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x65, 0xBE, 0x20, 0x2D, 0xEF, 0x20, 0xD0, 0x83, 0x51, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x65, 0x90, 0x20, 0x2D, 0xEF, 0x20, 0xD0, 0x83, 0x59, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x65, 0x80, 0x48, 0x78, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 0x65, 0x76, 0x4F, 0xEF, 0x00, 0x24, 
-    0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x08, 0x41, 0xED, 0xEE, 0xA4, 0xB8, 0x88, 0x67, 0x08, 0x70, 0x06, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0x73, 0x84, 0x0C, 0x2D, 0x00, 0x02, 
-    0xEE, 0x0C, 0x67, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0x59, 0x02, 0x61, 0xFF, 0xFF, 0xFF, 0x5F, 0x26, 
-    0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xD4, 0x48, 0xE7, 0x10, 0x30, 
-    0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x00, 0x00, 0xC4, 0x41, 0xEE, 0xFE, 0xD4, 0x22, 0x6D, 
-    0xED, 0xC4, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x48, 0x79, 0x00, 0x00, 0x2D, 0x3A, 0x48, 0x6E, 
-    0xFE, 0xD4, 0x61, 0xFF, 0x00, 0x00, 0x73, 0xBA, 0x41, 0xEE, 0xFE, 0xD4, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x26, 0x6D, 0xF2, 0xA8, 0x50, 0x4F, 0x60, 0x4A, 0x41, 0xEE, 
-    0xFE, 0xD4, 0x41, 0xF0, 0x38, 0x00, 0x22, 0x6B, 0x00, 0x18, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 
-    0x2F, 0x2D, 0xF2, 0xEE, 0x48, 0x6E, 0xFE, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x9E, 0x42, 0xAD, 
-    0xEF, 0x24, 0x42, 0xAD, 0xEC, 0xA0, 0x24, 0x6B, 0x00, 0x04, 0x50, 0x4F, 0x60, 0x0E, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x56, 0x24, 0x6A, 0x00, 0x68, 0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x58, 0x66, 0x26, 0x53, 0x20, 0x0B, 0x66, 0xB2, 0x41, 0xEE, 0xFE, 0xD4, 
-    0x41, 0xF0, 0x38, 0x00, 0x22, 0x6D, 0xF2, 0xC0, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x2F, 0x2D, 
-    0xF2, 0xEE, 0x48, 0x6E, 0xFE, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x50, 0x42, 0xAD, 0xEF, 0x24, 
-    0x42, 0xAD, 0xEC, 0xA0, 0x48, 0x6D, 0xEE, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x0E, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x58, 0x28, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x32, 0x2F, 0x2D, 0xF2, 0xEE, 
-    0x2F, 0x2D, 0xED, 0xC4, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x22, 0x42, 0xAD, 0xEC, 0xA0, 0x70, 0x06, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x50, 0x4F, 0x67, 0x32, 0x20, 0x2D, 0xEE, 0xB8, 0x06, 0x80, 0x00, 0x00, 
-    0x00, 0x80, 0xD0, 0xAD, 0xEE, 0xBC, 0x2B, 0x40, 0xEF, 0x24, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x1A, 
-    0x20, 0x2D, 0xEE, 0xC4, 0xD1, 0xAD, 0xEF, 0x24, 0x20, 0x2D, 0xED, 0x34, 0xE7, 0x88, 0x72, 0x24, 
-    0xD0, 0x81, 0xD0, 0xAD, 0xED, 0x44, 0xD1, 0xAD, 0xEF, 0x24, 0x26, 0x6D, 0xF2, 0xA8, 0x60, 0x00, 
-    0x00, 0xB8, 0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x00, 0x00, 0x94, 0x4A, 0x93, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x0C, 0x20, 0x2D, 0xEF, 0x24, 0xD0, 0xAB, 0x00, 0x14, 0x72, 0x2C, 0xD0, 0x81, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x53, 0x90, 0x2D, 0x40, 0xFF, 0xD4, 0x2F, 0x2B, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x53, 0x82, 0x2D, 0x40, 0xFF, 0xD8, 0x2F, 0x2B, 0x00, 0x14, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x53, 0x74, 0x2D, 0x40, 0xFF, 0xDC, 0x20, 0x6B, 0x00, 0x18, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x41, 0xEE, 0xFF, 0xE0, 0x22, 0x6B, 0x00, 0x18, 0x20, 0x08, 
-    0x10, 0xD9, 0x66, 0xFC, 0x70, 0x1F, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x1A, 0x70, 0x1F, 
-    0x90, 0x83, 0x2F, 0x00, 0x42, 0xA7, 0x41, 0xEE, 0xFF, 0xD4, 0x48, 0x70, 0x38, 0x0D, 0x61, 0xFF, 
-    0x00, 0x00, 0x71, 0x9C, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x78, 0x00, 0x2C, 0x48, 0x6E, 0xFF, 0xD4, 
-    0x2F, 0x2D, 0xEF, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x63, 0x12, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x6B, 
-    0x00, 0x04, 0x60, 0x0E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x24, 0x6A, 0x00, 0x68, 
-    0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 0x26, 0x53, 0x20, 0x0B, 0x66, 0x00, 0xFF, 0x46, 0x70, 0x06, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x04, 0x42, 0xAD, 0xEF, 0x24, 0x48, 0x6D, 0xEE, 0xA4, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF4, 0xD8, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0xF2, 0x58, 0x4F, 0x4C, 0xDF, 0x0C, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x24, 0x6E, 0x00, 0x08, 
-    0x2F, 0x2A, 0x00, 0x58, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x42, 0x61, 0xFF, 0x00, 0x00, 0x54, 0xEE, 
-    0x26, 0x6A, 0x00, 0x0C, 0x20, 0x2A, 0x00, 0x38, 0xE5, 0x88, 0x28, 0x4B, 0xD9, 0xC0, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x04, 0x24, 0x53, 0x26, 0x2A, 0x00, 0x28, 0x4A, 0x2D, 0xEE, 0x0A, 0x67, 0x04, 
-    0x96, 0xAD, 0xF2, 0xE2, 0x4A, 0xAA, 0x00, 0x1C, 0x6F, 0x5C, 0x48, 0x6A, 0x00, 0x44, 0x08, 0x2A, 
-    0x00, 0x05, 0x00, 0x2E, 0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x2B, 0x53, 0x60, 0x06, 0x41, 0xF9, 
-    0x00, 0x00, 0x2B, 0x4D, 0x48, 0x50, 0x2F, 0x2A, 0x00, 0x1C, 0x20, 0x03, 0x90, 0xAA, 0x00, 0x1C, 
-    0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x2A, 0x61, 0xFF, 0x00, 0x00, 0x54, 0x90, 0x4A, 0x92, 
-    0x4F, 0xEF, 0x00, 0x14, 0x67, 0x14, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 
-    0x1A, 0x14, 0x61, 0xFF, 0x00, 0x00, 0x54, 0x76, 0x50, 0x4F, 0x48, 0x78, 0x00, 0x0D, 0x61, 0xFF, 
-    0x00, 0x00, 0x4C, 0x72, 0x58, 0x4F, 0x48, 0x6A, 0x00, 0x44, 0x08, 0x2A, 0x00, 0x05, 0x00, 0x2E, 
-    0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x2B, 0x53, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x2B, 0x4D, 
-    0x48, 0x50, 0x08, 0x2A, 0x00, 0x01, 0x00, 0x2E, 0x66, 0x28, 0x08, 0x2A, 0x00, 0x04, 0x00, 0x2E, 
-    0x66, 0x18, 0x08, 0x2A, 0x00, 0x07, 0x00, 0x2E, 0x66, 0x08, 0x41, 0xF9, 0x00, 0x00, 0x19, 0xEF, 
-    0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x19, 0xF4, 0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x19, 0xF9, 
-    0x60, 0x06, 0x41, 0xF9, 0x00, 0x00, 0x31, 0xF6, 0x48, 0x50, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x03, 
-    0x48, 0x79, 0x00, 0x00, 0x19, 0xFE, 0x61, 0xFF, 0x00, 0x00, 0x54, 0x02, 0x4A, 0x92, 0x4F, 0xEF, 
-    0x00, 0x18, 0x67, 0x14, 0x20, 0x52, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x14, 
-    0x61, 0xFF, 0x00, 0x00, 0x53, 0xE8, 0x50, 0x4F, 0x48, 0x78, 0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 
-    0x4B, 0xE4, 0x58, 0x8B, 0x58, 0x4F, 0xB7, 0xCC, 0x65, 0x00, 0xFE, 0xFA, 0x4C, 0xDF, 0x1C, 0x08, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x07, 0x18, 0x22, 0x6F, 0x00, 0x18, 0x2E, 0x2F, 0x00, 0x1C, 
-    0x59, 0x89, 0x74, 0x01, 0x70, 0x03, 0x4C, 0x02, 0x08, 0x00, 0x52, 0x80, 0x24, 0x00, 0xB4, 0x87, 
-    0x6F, 0xF2, 0x4C, 0x7C, 0x28, 0x02, 0x00, 0x00, 0x00, 0x03, 0x2C, 0x02, 0x52, 0x86, 0x60, 0x4E, 
-    0x26, 0x71, 0x6C, 0x00, 0x22, 0x06, 0x20, 0x6B, 0x00, 0x04, 0x2A, 0x28, 0x00, 0x0C, 0x60, 0x0C, 
-    0x20, 0x01, 0x90, 0x82, 0x23, 0xB1, 0x0C, 0x00, 0x1C, 0x00, 0x92, 0x82, 0xB2, 0x82, 0x6F, 0x28, 
-    0x20, 0x01, 0x90, 0x82, 0x20, 0x71, 0x0C, 0x00, 0x20, 0x68, 0x00, 0x04, 0x28, 0x68, 0x00, 0x0C, 
-    0xB9, 0xC5, 0x6E, 0xDC, 0xBA, 0x8C, 0x66, 0x10, 0x20, 0x01, 0x90, 0x82, 0x20, 0x71, 0x0C, 0x00, 
-    0x0C, 0x28, 0x00, 0x24, 0x00, 0x0A, 0x67, 0xC8, 0x23, 0x8B, 0x1C, 0x00, 0x52, 0x86, 0xBC, 0x87, 
-    0x6F, 0xAE, 0x70, 0x01, 0xB4, 0x80, 0x6E, 0x9A, 0x4C, 0xDF, 0x18, 0xE0, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xD4, 0x48, 0xE7, 0x1F, 0x38, 0x41, 0xED, 0xE8, 0x12, 0x43, 0xEE, 0xFF, 0xD8, 0x70, 0x06, 
-    0x22, 0xD8, 0x51, 0xC8, 0xFF, 0xFC, 0x7C, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x1C, 
-    0x2F, 0x28, 0x00, 0x20, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x42, 0xAE, 0xFF, 0xD4, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x84, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x68, 0x00, 0x28, 0x20, 0x2E, 0xFF, 0xD4, 
-    0x26, 0x71, 0x0C, 0x00, 0x20, 0x0B, 0x67, 0x00, 0x01, 0x6A, 0x70, 0x08, 0xC0, 0xAB, 0x00, 0x30, 
-    0x66, 0x00, 0x01, 0x60, 0x2E, 0x2B, 0x00, 0x18, 0x08, 0x2B, 0x00, 0x01, 0x00, 0x2E, 0x67, 0x00, 
-    0x01, 0x2A, 0x42, 0xAE, 0xFF, 0xFC, 0x42, 0xAE, 0xFF, 0xF8, 0x42, 0xAE, 0xFF, 0xF4, 0x78, 0xFF, 
-    0x7A, 0x00, 0x60, 0x00, 0x00, 0xDE, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x68, 0x00, 0x20, 0x28, 0x71, 
-    0x5C, 0x00, 0x20, 0x6C, 0x00, 0x04, 0x26, 0x28, 0x00, 0x0C, 0xB6, 0xAB, 0x00, 0x28, 0x6D, 0x00, 
-    0x00, 0xC0, 0x20, 0x2B, 0x00, 0x28, 0xD0, 0x87, 0xB6, 0x80, 0x6C, 0x00, 0x00, 0xB4, 0x24, 0x4C, 
-    0x50, 0x8A, 0x54, 0x8A, 0x96, 0xAB, 0x00, 0x28, 0x4A, 0x84, 0x6D, 0x32, 0x48, 0x78, 0x00, 0x0C, 
-    0x48, 0x79, 0x00, 0x00, 0x19, 0xE2, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x6F, 0xC8, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x18, 0x70, 0xFC, 0x22, 0x03, 0x56, 0x81, 0xC2, 0x80, 0x26, 0x01, 
-    0x20, 0x03, 0x90, 0x84, 0x90, 0x86, 0xD1, 0xAE, 0xFF, 0xF8, 0x78, 0xFF, 0x60, 0x72, 0x0C, 0x12, 
-    0x00, 0x24, 0x66, 0x30, 0x0C, 0x2A, 0x00, 0x53, 0x00, 0x01, 0x66, 0x64, 0x48, 0x78, 0x00, 0x0A, 
-    0x42, 0xA7, 0x48, 0x6A, 0x00, 0x02, 0x61, 0xFF, 0x00, 0x00, 0x6B, 0x64, 0x26, 0x00, 0x70, 0xFC, 
-    0x22, 0x03, 0x56, 0x81, 0xC2, 0x80, 0x26, 0x01, 0xD7, 0xAE, 0xFF, 0xF4, 0xDC, 0x83, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x3C, 0x48, 0x79, 0x00, 0x00, 0x19, 0xD6, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x6F, 0x3A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x20, 0x07, 0x90, 0x83, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x60, 0x2C, 0x48, 0x78, 0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x19, 0xCA, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x6F, 0x42, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x04, 0x28, 0x03, 0x7C, 0x00, 
-    0x52, 0x85, 0x20, 0x6E, 0x00, 0x08, 0xBA, 0xA8, 0x00, 0x1C, 0x6D, 0x00, 0xFF, 0x1A, 0x20, 0x2E, 
-    0xFF, 0xFC, 0xD1, 0xAE, 0xFF, 0xE4, 0x20, 0x2E, 0xFF, 0xF8, 0xD1, 0xAE, 0xFF, 0xDC, 0x20, 0x2E, 
-    0xFF, 0xF4, 0xD1, 0xAE, 0xFF, 0xE0, 0x20, 0x07, 0x90, 0xAE, 0xFF, 0xFC, 0x90, 0xAE, 0xFF, 0xF8, 
-    0x90, 0xAE, 0xFF, 0xF4, 0xD1, 0xAE, 0xFF, 0xD8, 0x60, 0x28, 0x08, 0x2B, 0x00, 0x07, 0x00, 0x2E, 
-    0x67, 0x06, 0xDF, 0xAE, 0xFF, 0xF0, 0x60, 0x1A, 0x08, 0x2B, 0x00, 0x04, 0x00, 0x2E, 0x67, 0x06, 
-    0xDF, 0xAE, 0xFF, 0xEC, 0x60, 0x0C, 0x08, 0x2B, 0x00, 0x03, 0x00, 0x2E, 0x66, 0x04, 0xDF, 0xAE, 
-    0xFF, 0xE8, 0x52, 0xAE, 0xFF, 0xD4, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x2E, 0xFF, 0xD4, 0xB0, 0xA8, 
-    0x00, 0x24, 0x6D, 0x00, 0xFE, 0x70, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x66, 
-    0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x19, 0xC4, 0x61, 0xFF, 0x00, 0x00, 0x51, 0x5E, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x72, 0x10, 0xB0, 0x81, 0x50, 0x4F, 0x63, 0x12, 0x48, 0x78, 0x00, 0x20, 0x48, 0x79, 0x00, 0x00, 
-    0x19, 0xBD, 0x61, 0xFF, 0x00, 0x00, 0x51, 0x36, 0x50, 0x4F, 0x2F, 0x2E, 0xFF, 0xF0, 0x2F, 0x2E, 
-    0xFF, 0xEC, 0x2F, 0x2E, 0xFF, 0xE8, 0x2F, 0x2E, 0xFF, 0xE4, 0x2F, 0x2E, 0xFF, 0xE0, 0x2F, 0x2E, 
-    0xFF, 0xDC, 0x2F, 0x2E, 0xFF, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x19, 0x92, 0x61, 0xFF, 0x00, 0x00, 
-    0x51, 0x0C, 0x4F, 0xEF, 0x00, 0x20, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xD8, 0xD1, 0x90, 
-    0x20, 0x2E, 0xFF, 0xDC, 0xD1, 0xA8, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE0, 0xD1, 0xA8, 0x00, 0x08, 
-    0x20, 0x2E, 0xFF, 0xE4, 0xD1, 0xA8, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xE8, 0xD1, 0xA8, 0x00, 0x10, 
-    0x20, 0x2E, 0xFF, 0xEC, 0xD1, 0xA8, 0x00, 0x14, 0x20, 0x2E, 0xFF, 0xF0, 0xD1, 0xA8, 0x00, 0x18, 
-    0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 
-    0x26, 0x6E, 0x00, 0x08, 0x76, 0x00, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x20, 
-    0x48, 0x79, 0x00, 0x00, 0x19, 0x42, 0x61, 0xFF, 0x00, 0x00, 0x50, 0xA2, 0x48, 0x78, 0x00, 0x20, 
-    0x48, 0x79, 0x00, 0x00, 0x19, 0x00, 0x61, 0xFF, 0x00, 0x00, 0x50, 0x92, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x24, 0x4B, 0x60, 0x20, 0x70, 0x02, 0x20, 0x6A, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x66, 0x10, 
-    0x48, 0x6D, 0xE8, 0x4A, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x36, 0x50, 0x4F, 0x60, 0x02, 
-    0x76, 0x01, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xDC, 0x4A, 0x83, 0x67, 0x58, 0x10, 0x2D, 0xED, 0xEF, 
-    0x72, 0x01, 0xC0, 0x81, 0x67, 0x2A, 0x48, 0x78, 0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x56, 
-    0x48, 0x79, 0x00, 0x00, 0x18, 0xB0, 0x61, 0xFF, 0x00, 0x00, 0x50, 0x42, 0x48, 0x78, 0x00, 0x20, 
-    0x48, 0x79, 0x00, 0x00, 0x19, 0x00, 0x61, 0xFF, 0x00, 0x00, 0x50, 0x32, 0x4F, 0xEF, 0x00, 0x10, 
-    0x24, 0x4B, 0x60, 0x1C, 0x70, 0x02, 0x20, 0x6A, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 0x67, 0x0E, 
-    0x48, 0x6D, 0xE8, 0x2E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xD6, 0x50, 0x4F, 0x24, 0x52, 
-    0x20, 0x0A, 0x66, 0xE0, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x0C, 0x48, 0x78, 
-    0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 0x47, 0xFE, 0x58, 0x4F, 0x48, 0x78, 0x00, 0x20, 0x48, 0x79, 
-    0x00, 0x00, 0x18, 0x6F, 0x61, 0xFF, 0x00, 0x00, 0x4F, 0xE4, 0x48, 0x78, 0x00, 0x20, 0x48, 0x79, 
-    0x00, 0x00, 0x19, 0x00, 0x61, 0xFF, 0x00, 0x00, 0x4F, 0xD4, 0x2F, 0x2D, 0xE8, 0x62, 0x2F, 0x2D, 
-    0xE8, 0x5E, 0x2F, 0x2D, 0xE8, 0x5A, 0x2F, 0x2D, 0xE8, 0x56, 0x2F, 0x2D, 0xE8, 0x52, 0x2F, 0x2D, 
-    0xE8, 0x4E, 0x2F, 0x2D, 0xE8, 0x4A, 0x48, 0x79, 0x00, 0x00, 0x18, 0x34, 0x61, 0xFF, 0x00, 0x00, 
-    0x4F, 0xAC, 0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x30, 0x67, 0x00, 0x00, 0x80, 0x2F, 0x2D, 0xE8, 0x46, 
-    0x2F, 0x2D, 0xE8, 0x42, 0x2F, 0x2D, 0xE8, 0x3E, 0x2F, 0x2D, 0xE8, 0x3A, 0x2F, 0x2D, 0xE8, 0x36, 
-    0x2F, 0x2D, 0xE8, 0x32, 0x2F, 0x2D, 0xE8, 0x2E, 0x48, 0x79, 0x00, 0x00, 0x17, 0xF9, 0x61, 0xFF, 
-    0x00, 0x00, 0x4F, 0x7A, 0x20, 0x2D, 0xE8, 0x62, 0xD0, 0xAD, 0xE8, 0x46, 0x2F, 0x00, 0x20, 0x2D, 
-    0xE8, 0x5E, 0xD0, 0xAD, 0xE8, 0x42, 0x2F, 0x00, 0x20, 0x2D, 0xE8, 0x5A, 0xD0, 0xAD, 0xE8, 0x3E, 
-    0x2F, 0x00, 0x20, 0x2D, 0xE8, 0x56, 0xD0, 0xAD, 0xE8, 0x3A, 0x2F, 0x00, 0x20, 0x2D, 0xE8, 0x52, 
-    0xD0, 0xAD, 0xE8, 0x36, 0x2F, 0x00, 0x20, 0x2D, 0xE8, 0x4E, 0xD0, 0xAD, 0xE8, 0x32, 0x2F, 0x00, 
-    0x20, 0x2D, 0xE8, 0x4A, 0xD0, 0xAD, 0xE8, 0x2E, 0x2F, 0x00, 0x48, 0x79, 0x00, 0x00, 0x17, 0xBE, 
-    0x61, 0xFF, 0x00, 0x00, 0x4F, 0x28, 0x4F, 0xEF, 0x00, 0x40, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1E, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x10, 0x28, 0x6D, 0xEF, 0x34, 0x60, 0x2A, 0x48, 0x6C, 0x00, 0x24, 
-    0x2F, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xB8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x16, 0x2F, 0x05, 
-    0x48, 0x79, 0x00, 0x00, 0x17, 0xA2, 0x61, 0xFF, 0xFF, 0xFF, 0x51, 0x12, 0x20, 0x4A, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0x0E, 0x28, 0x54, 0x20, 0x0C, 0x66, 0xD2, 0x26, 0x45, 0x60, 0x02, 0x52, 0x8B, 
-    0x4A, 0x13, 0x67, 0x06, 0x0C, 0x13, 0x00, 0x28, 0x66, 0xF4, 0x20, 0x4B, 0x91, 0xC5, 0x26, 0x08, 
-    0x70, 0x28, 0xD0, 0x83, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0xBE, 0x28, 0x48, 0x24, 0x8C, 
-    0x41, 0xEC, 0x00, 0x24, 0x22, 0x45, 0x22, 0x03, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x20, 0x4C, 0x41, 0xE8, 0x00, 0x24, 0x2A, 0x08, 0x42, 0x34, 0x38, 0x24, 
-    0x42, 0xAC, 0x00, 0x20, 0x0C, 0x13, 0x00, 0x28, 0x58, 0x4F, 0x66, 0x00, 0x00, 0x9C, 0x52, 0x8B, 
-    0x0C, 0x13, 0x00, 0x20, 0x67, 0xF8, 0x24, 0x4B, 0x60, 0x02, 0x52, 0x8A, 0x4A, 0x12, 0x67, 0x12, 
-    0x0C, 0x12, 0x00, 0x2C, 0x67, 0x0C, 0x0C, 0x12, 0x00, 0x20, 0x67, 0x06, 0x0C, 0x12, 0x00, 0x29, 
-    0x66, 0xE8, 0x20, 0x4A, 0x91, 0xCB, 0x26, 0x08, 0x4A, 0x83, 0x66, 0x10, 0x2F, 0x05, 0x48, 0x79, 
-    0x00, 0x00, 0x17, 0x72, 0x61, 0xFF, 0xFF, 0xFF, 0x50, 0x74, 0x50, 0x4F, 0x20, 0x03, 0x50, 0x80, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0x42, 0x28, 0x08, 0x20, 0x44, 0x41, 0xE8, 0x00, 0x04, 
-    0x22, 0x4B, 0x22, 0x03, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 
-    0x20, 0x44, 0x42, 0x30, 0x38, 0x04, 0x20, 0xAC, 0x00, 0x20, 0x29, 0x44, 0x00, 0x20, 0x26, 0x4A, 
-    0x4A, 0x13, 0x58, 0x4F, 0x67, 0x06, 0x0C, 0x13, 0x00, 0x29, 0x66, 0x82, 0x52, 0x8B, 0x0C, 0x13, 
-    0x00, 0x20, 0x67, 0xF8, 0x4A, 0x13, 0x67, 0x10, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x17, 0x42, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x50, 0x18, 0x50, 0x4F, 0x70, 0xFF, 0x29, 0x40, 0x00, 0x18, 0x42, 0x94, 
-    0x48, 0x79, 0x00, 0x00, 0x17, 0x3E, 0x48, 0x6C, 0x00, 0x24, 0x61, 0xFF, 0x00, 0x00, 0x44, 0xDA, 
-    0x24, 0x48, 0x20, 0x0A, 0x50, 0x4F, 0x66, 0x12, 0x48, 0x6C, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 
-    0x17, 0x2A, 0x61, 0xFF, 0xFF, 0xFF, 0x4F, 0xE6, 0x50, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0x94, 
-    0x48, 0x78, 0x10, 0x00, 0x42, 0xA7, 0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0x20, 
-    0x58, 0x4F, 0x2F, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x4D, 0xD6, 0x48, 0x78, 0x00, 0x02, 
-    0x42, 0xA7, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x4B, 0x8C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x4C, 0x2E, 0x29, 0x40, 0x00, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x44, 0xBC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x55, 0x72, 0x42, 0xAC, 0x00, 0x14, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x71, 0xD0, 
-    0x29, 0x40, 0x00, 0x04, 0x29, 0x46, 0x00, 0x1C, 0x4A, 0x86, 0x4F, 0xEF, 0x00, 0x28, 0x67, 0x2A, 
-    0x70, 0x09, 0xC0, 0xAC, 0x00, 0x04, 0x67, 0x12, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x16, 0xF8, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x4F, 0x68, 0x50, 0x4F, 0x60, 0x10, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 
-    0x16, 0xCA, 0x61, 0xFF, 0xFF, 0xFF, 0x4F, 0x56, 0x50, 0x4F, 0x70, 0x0A, 0xB0, 0xAC, 0x00, 0x04, 
-    0x67, 0x4C, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x0C, 0x66, 0x32, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x53, 0x88, 0x24, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x67, 0x20, 0x2F, 0x2C, 
-    0x00, 0x0C, 0x42, 0xA7, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0x5A, 0x29, 0x48, 0x00, 0x14, 
-    0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0xDA, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x10, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x0C, 0x66, 0x06, 0x70, 0x01, 0x2B, 0x40, 0xEF, 0x30, 0x20, 0x4C, 
-    0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xED, 0x64, 
-    0x48, 0x79, 0x00, 0x00, 0x1A, 0xEE, 0x48, 0x79, 0x00, 0x00, 0x32, 0x6A, 0x48, 0x79, 0x00, 0x00, 
-    0x35, 0x30, 0x48, 0x79, 0x00, 0x00, 0x16, 0x7C, 0x61, 0xFF, 0x00, 0x00, 0x4C, 0xA0, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x15, 0x5A, 0x61, 0xFF, 0x00, 0x00, 0x48, 0xB4, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x14, 0x3A, 0x61, 0xFF, 0x00, 0x00, 0x48, 0xA4, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x13, 0x20, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x94, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x11, 0x89, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x84, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x0F, 0xE8, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x74, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x0E, 0x2A, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x64, 0x48, 0x6D, 
-    0xFB, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x0D, 0xDB, 0x61, 0xFF, 0x00, 0x00, 0x48, 0x54, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x4A, 
-    0x60, 0x08, 0x0C, 0x03, 0x00, 0x3A, 0x66, 0x02, 0x26, 0x4A, 0x16, 0x1A, 0x66, 0xF4, 0x48, 0x78, 
-    0x00, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0x52, 0x12, 0x24, 0x48, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x8A, 
-    0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x51, 0xF6, 0x58, 0x4F, 0x22, 0x4B, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x25, 0x40, 
-    0x00, 0x04, 0x25, 0x6E, 0x00, 0x10, 0x00, 0x08, 0x25, 0x6E, 0x00, 0x14, 0x00, 0x0C, 0x25, 0x6E, 
-    0x00, 0x18, 0x00, 0x14, 0x25, 0x6E, 0x00, 0x1C, 0x00, 0x18, 0x10, 0x2D, 0xF2, 0xCC, 0x52, 0x2D, 
-    0xF2, 0xCC, 0x0C, 0x00, 0x00, 0x5A, 0x58, 0x4F, 0x6F, 0x26, 0x1B, 0x7C, 0x00, 0x21, 0xF2, 0xCC, 
-    0x10, 0x2D, 0xF2, 0xCD, 0x52, 0x2D, 0xF2, 0xCD, 0x0C, 0x00, 0x00, 0x5A, 0x6F, 0x12, 0x48, 0x78, 
-    0x0D, 0x24, 0x48, 0x79, 0x00, 0x00, 0x0D, 0xB4, 0x61, 0xFF, 0xFF, 0xFF, 0x4D, 0xC0, 0x50, 0x4F, 
-    0x15, 0x6D, 0xF2, 0xCC, 0x00, 0x2C, 0x15, 0x6D, 0xF2, 0xCD, 0x00, 0x2D, 0x42, 0x92, 0x20, 0x4A, 
-    0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 
-    0x47, 0xED, 0xE8, 0x0E, 0x60, 0x2E, 0x70, 0x01, 0x20, 0x6A, 0x00, 0x04, 0xC0, 0xA8, 0x00, 0x14, 
-    0x67, 0x20, 0x2F, 0x2A, 0x00, 0x08, 0x48, 0x79, 0x00, 0x00, 0x0D, 0x9C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x4D, 0x7C, 0x26, 0x92, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x61, 0x26, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x02, 0x26, 0x4A, 0x24, 0x53, 0x20, 0x0A, 0x66, 0xCC, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x28, 0x6D, 0xEF, 0x3C, 0x60, 0x76, 
-    0x26, 0x6C, 0x00, 0x04, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x14, 0x66, 0x68, 0x24, 0x6D, 0xE8, 0x0E, 
-    0x60, 0x08, 0xB7, 0xEA, 0x00, 0x04, 0x67, 0x06, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xF4, 0x20, 0x0A, 
-    0x66, 0x52, 0x70, 0x10, 0xC0, 0xAB, 0x00, 0x14, 0x67, 0x14, 0x48, 0x6C, 0x00, 0x0A, 0x48, 0x79, 
-    0x00, 0x00, 0x0D, 0x7C, 0x61, 0xFF, 0xFF, 0xFF, 0x4D, 0x14, 0x50, 0x4F, 0x60, 0x12, 0x48, 0x6C, 
-    0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0D, 0x64, 0x61, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x50, 0x4F, 
-    0x48, 0x78, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x50, 0xD0, 0x24, 0x48, 0x24, 0xAD, 0xE8, 0x0E, 
-    0x25, 0x4B, 0x00, 0x04, 0x20, 0x4C, 0x50, 0x88, 0x54, 0x88, 0x25, 0x48, 0x00, 0x08, 0x2B, 0x4A, 
-    0xE8, 0x0E, 0x58, 0x4F, 0x28, 0x53, 0x20, 0x0C, 0x66, 0x86, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x2E, 0x00, 0x08, 0x48, 0x79, 
-    0x00, 0x00, 0x30, 0x0A, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x5E, 0x3C, 
-    0x26, 0x48, 0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0x96, 
-    0x24, 0x48, 0x2F, 0x2B, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x47, 0xC0, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x2E, 0x08, 0x48, 0x79, 0x00, 0x00, 0x0D, 0x5B, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x5E, 0x08, 0x26, 0x48, 0xB6, 0xFC, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x1C, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x2A, 0x00, 0x20, 0x44, 0x70, 0x61, 0xB0, 0xA8, 0x00, 0x1C, 
-    0x66, 0x06, 0x20, 0x05, 0x60, 0x00, 0x02, 0xDC, 0x4A, 0x85, 0x67, 0x14, 0x70, 0x6C, 0xB0, 0xA8, 
-    0x00, 0x1C, 0x67, 0x0C, 0x70, 0x61, 0x21, 0x40, 0x00, 0x1C, 0x20, 0x05, 0x60, 0x00, 0x02, 0xC4, 
-    0x48, 0x79, 0x00, 0x00, 0x0D, 0x52, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x5D, 0xBA, 0x26, 0x48, 0x20, 0x0B, 0x50, 0x4F, 0x66, 0x18, 0x20, 0x44, 0x48, 0x68, 0x00, 0x24, 
-    0x48, 0x79, 0x00, 0x00, 0x0D, 0x31, 0x61, 0xFF, 0xFF, 0xFF, 0x4C, 0x12, 0x50, 0x4F, 0x60, 0x00, 
-    0x01, 0x2A, 0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0xF6, 
-    0x28, 0x48, 0x48, 0x79, 0x00, 0x00, 0x0D, 0x28, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x5D, 0x78, 0x26, 0x48, 0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x55, 0xD2, 0x26, 0x08, 0x2F, 0x2C, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0xFC, 
-    0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x00, 0x20, 0x43, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x46, 0xE8, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x26, 0x40, 0xB7, 0xC6, 0x4F, 0xEF, 
-    0x00, 0x20, 0x6E, 0x22, 0xBC, 0x8B, 0x66, 0x36, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0xCC, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x43, 0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0xBE, 0xB0, 0xAE, 
-    0xFF, 0xFC, 0x50, 0x4F, 0x6F, 0x18, 0x20, 0x44, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 
-    0x0C, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 0x4B, 0x76, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x8E, 0x4A, 0x85, 
-    0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x26, 0x00, 0x48, 0x79, 0x00, 0x00, 0x0C, 0xF6, 
-    0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x5C, 0xE0, 0x26, 0x48, 0x2F, 0x2B, 
-    0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0x3A, 0x24, 0x48, 0x2F, 0x2B, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x64, 0x20, 0x4A, 0xD1, 0xC0, 0x28, 0x48, 0x4F, 0xEF, 
-    0x00, 0x14, 0x60, 0x3C, 0x4A, 0x92, 0x67, 0x26, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x4C, 
-    0x90, 0x83, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6D, 0xEF, 0x40, 0x48, 0x6A, 0x00, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4A, 0x14, 0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x2A, 
-    0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x24, 0x20, 0x4A, 0xD1, 0xC0, 0x24, 0x48, 0x58, 0x4F, 
-    0xB5, 0xCC, 0x65, 0xC0, 0x20, 0x05, 0x60, 0x00, 0x01, 0x6A, 0x28, 0x4A, 0x60, 0x00, 0x01, 0x5C, 
-    0x4A, 0x94, 0x67, 0x00, 0x01, 0x44, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0xFE, 0xE9, 0x88, 
-    0x20, 0x44, 0x20, 0x68, 0x00, 0x08, 0xD1, 0xC0, 0x50, 0x88, 0x58, 0x88, 0x26, 0x48, 0x2F, 0x2B, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0xE4, 0x58, 0x4F, 0x2F, 0x00, 0x2F, 0x2B, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x45, 0xD6, 0x58, 0x4F, 0x2F, 0x00, 0x2F, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x53, 0x20, 0x48, 0x78, 0x00, 0x1C, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0x18, 0x26, 0x08, 
-    0x20, 0x43, 0x2F, 0x28, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0xB0, 0xE9, 0x88, 0x72, 0x1C, 
-    0xD0, 0x81, 0x58, 0x4F, 0x2F, 0x00, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x53, 0xF8, 0x26, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x32, 0x61, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x5B, 0xEE, 0x26, 0x48, 
-    0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0x48, 0x2A, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x32, 0x46, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x5B, 0xCE, 0x26, 0x48, 
-    0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0x28, 0x24, 0x48, 
-    0x48, 0x79, 0x00, 0x00, 0x32, 0x3D, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x5B, 0xAE, 0x26, 0x48, 
-    0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x54, 0x08, 0x26, 0x08, 
-    0x20, 0x45, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0x30, 0x2C, 0x00, 0x20, 0x06, 
-    0xE9, 0x88, 0x26, 0x4A, 0xD7, 0xC0, 0x4F, 0xEF, 0x00, 0x54, 0x60, 0x4E, 0x70, 0x03, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0x10, 0xC0, 0xAE, 0xFF, 0xFC, 
-    0x57, 0x80, 0x58, 0x4F, 0x66, 0x30, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x44, 0xFE, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x48, 0x6D, 0xEF, 0x40, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x44, 0xEE, 0x20, 0x43, 
-    0x58, 0x4F, 0x48, 0x70, 0x08, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x48, 0xBC, 0x21, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x10, 0xD5, 0xC0, 0xB5, 0xCB, 0x65, 0xAE, 0x2F, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x51, 0xA8, 0x58, 0x4F, 0x2F, 0x2C, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x44, 0xBA, 0x20, 0x4C, 0xD1, 0xC0, 0x28, 0x48, 0x58, 0x4F, 0xB9, 0xC7, 0x65, 0x00, 0xFE, 0xA2, 
-    0x70, 0x00, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x0C, 0x13, 0x00, 0x2A, 0x66, 0x24, 
-    0x52, 0x8B, 0x0C, 0x13, 0x00, 0x2A, 0x67, 0xF8, 0x60, 0x16, 0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xDA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 0x70, 0x00, 0x60, 0x36, 0x52, 0x8A, 
-    0x4A, 0x12, 0x66, 0xE6, 0x4A, 0x12, 0x66, 0x0A, 0x4A, 0x13, 0x56, 0xC0, 0x44, 0x00, 0x49, 0xC0, 
-    0x60, 0x22, 0x0C, 0x13, 0x00, 0x3F, 0x67, 0x16, 0x70, 0x20, 0x12, 0x12, 0x49, 0xC1, 0x82, 0x80, 
-    0x14, 0x13, 0x49, 0xC2, 0x84, 0x80, 0xB4, 0x81, 0x67, 0x04, 0x70, 0x01, 0x60, 0x06, 0x52, 0x8B, 
-    0x52, 0x8A, 0x60, 0xA6, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x60, 0x18, 0x2F, 0x0B, 
-    0x48, 0x6A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x08, 0x24, 0x52, 0x20, 0x0A, 0x66, 0xE4, 0x70, 0x01, 0x4C, 0xDF, 0x0C, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1E, 0x38, 0x26, 0x6E, 0x00, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x30, 0x0A, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x5A, 0x3C, 
-    0x28, 0x48, 0x2F, 0x2C, 0x00, 0x0C, 0x2F, 0x2C, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x52, 0x96, 
-    0x24, 0x48, 0x2F, 0x2C, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0xC0, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x2C, 0x08, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x01, 0x2C, 0x4A, 0x92, 0x67, 0x00, 0x01, 0x14, 
-    0x70, 0x61, 0xB0, 0xAB, 0x00, 0x1C, 0x67, 0x34, 0x48, 0x6A, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x20, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x00, 0xF6, 0x4A, 0x2D, 
-    0xEE, 0x0B, 0x67, 0x18, 0x48, 0x6B, 0x00, 0x24, 0x48, 0x6A, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 
-    0x0C, 0xD2, 0x61, 0xFF, 0xFF, 0xFF, 0x48, 0x46, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x12, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x43, 0x68, 0xE9, 0x88, 0x20, 0x6B, 0x00, 0x08, 0xD1, 0xC0, 0x50, 0x88, 0x58, 0x88, 
-    0x28, 0x48, 0x2F, 0x2C, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x50, 0x28, 0x00, 0x2F, 0x2C, 
-    0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x44, 0x26, 0x00, 0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x50, 0x8C, 0x2A, 0x2D, 0xF2, 0xC8, 0x4A, 0xAD, 0xED, 0x58, 0x4F, 0xEF, 
-    0x00, 0x18, 0x66, 0x28, 0xB6, 0x83, 0x66, 0x24, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x4C, 0x3E, 
-    0x28, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x67, 0x14, 0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4F, 0x12, 0x2B, 0x48, 0xED, 0x58, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x78, 0x00, 0x1C, 
-    0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x50, 0xBA, 0x28, 0x48, 0x2F, 0x2C, 0x00, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x42, 0xE8, 0xE9, 0x88, 0x72, 0x1C, 0xD0, 0x81, 0x58, 0x4F, 0x2F, 0x00, 0x42, 0xA7, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x50, 0x9C, 0x28, 0x48, 0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x48, 0x6A, 0x00, 0x0C, 0x2F, 0x2D, 0xF2, 0xC8, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x38, 0x2B, 0x48, 
-    0xF2, 0xC8, 0x20, 0x45, 0x20, 0x50, 0x21, 0x6D, 0xED, 0x58, 0x00, 0x10, 0x20, 0x45, 0x2F, 0x10, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x71, 0xB0, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x4F, 0x80, 0x4F, 0xEF, 
-    0x00, 0x30, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x42, 0x90, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x24, 0x48, 0x58, 0x4F, 0xB5, 0xC6, 0x65, 0x00, 0xFE, 0xD2, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x42, 0xAE, 
-    0xFF, 0xFC, 0x7E, 0x00, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x6A, 0x28, 0x00, 0x70, 0x61, 
-    0xB0, 0xAC, 0x00, 0x1C, 0x58, 0x4F, 0x67, 0x00, 0x00, 0xC0, 0x20, 0x6C, 0x00, 0x08, 0x2F, 0x28, 
-    0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x42, 0x44, 0x26, 0x00, 0x20, 0x03, 0xE5, 0x88, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x4C, 0x5A, 0x2D, 0x48, 0xFF, 0xFC, 0x4A, 0x84, 0x50, 0x4F, 0x67, 0x10, 
-    0x20, 0x03, 0xE5, 0x88, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x4C, 0x44, 0x2E, 0x08, 0x58, 0x4F, 
-    0x48, 0x79, 0x00, 0x00, 0x30, 0x0A, 0x2F, 0x2C, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x58, 0x6C, 
-    0x26, 0x08, 0x20, 0x43, 0x2F, 0x28, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x50, 0xC4, 0x24, 0x48, 0x20, 0x43, 0x2F, 0x28, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x41, 0xEC, 
-    0x20, 0x4A, 0xD1, 0xC0, 0x26, 0x48, 0x76, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x46, 0x20, 0x4A, 
-    0x50, 0x88, 0x58, 0x88, 0x2D, 0x48, 0xFF, 0xF8, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x41, 0xCC, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x21, 0xAE, 0xFF, 0xF8, 0x0C, 0x00, 0x4A, 0x84, 0x58, 0x4F, 0x67, 0x10, 
-    0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x41, 0xB4, 0x20, 0x47, 0x21, 0x80, 0x3C, 0x00, 0x58, 0x4F, 
-    0x52, 0x83, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 0x41, 0xA0, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x24, 0x48, 0x58, 0x4F, 0xB5, 0xCB, 0x65, 0xB6, 0x70, 0x61, 0xB0, 0xAC, 0x00, 0x1C, 0x67, 0x00, 
-    0x01, 0xC6, 0x4A, 0xAC, 0x00, 0x20, 0x66, 0x00, 0x01, 0xBE, 0x76, 0x01, 0x60, 0x00, 0x01, 0xB0, 
-    0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x2C, 0x70, 0x02, 0xB6, 0x80, 0x66, 0x14, 0x48, 0x6C, 0x00, 0x24, 
-    0x48, 0x79, 0x00, 0x00, 0x0C, 0xA0, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x32, 0x50, 0x4F, 0x60, 0x12, 
-    0x48, 0x6C, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x0C, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x1E, 
-    0x50, 0x4F, 0x76, 0x00, 0x24, 0x6D, 0xEF, 0x3C, 0x60, 0x00, 0x01, 0x6E, 0x20, 0x6A, 0x00, 0x04, 
-    0x20, 0x28, 0x00, 0x14, 0x02, 0x80, 0x10, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x56, 0x20, 0x6A, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x66, 0x00, 0x01, 0x4A, 0x0C, 0x2A, 0x00, 0x21, 0x00, 0x08, 
-    0x66, 0x00, 0x01, 0x40, 0x0C, 0x2A, 0x00, 0x21, 0x00, 0x09, 0x66, 0x00, 0x01, 0x36, 0x48, 0x6D, 
-    0xEF, 0x40, 0x48, 0x6A, 0x00, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x45, 0x38, 0x26, 0x48, 0x20, 0x08, 
-    0x50, 0x4F, 0x67, 0x00, 0x01, 0x1E, 0x20, 0x6A, 0x00, 0x04, 0x02, 0xA8, 0xEF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x14, 0x26, 0x2B, 0x00, 0x04, 0x4A, 0x87, 0x67, 0x06, 0x20, 0x47, 0x26, 0x30, 0x3C, 0x00, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x2A, 0x30, 0x3C, 0x00, 0x20, 0x03, 0xE9, 0x88, 0x26, 0x6C, 0x00, 0x08, 
-    0xD7, 0xC0, 0x50, 0x8B, 0x58, 0x8B, 0x2F, 0x2B, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x40, 0xBC, 
-    0x28, 0x00, 0x2F, 0x2B, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x40, 0xB0, 0x26, 0x00, 0x2F, 0x03, 
-    0x2F, 0x04, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0x4D, 0xF8, 0x4A, 0xAD, 0xED, 0x58, 0x4F, 0xEF, 
-    0x00, 0x14, 0x66, 0x28, 0xB6, 0x83, 0x66, 0x24, 0x2F, 0x03, 0x61, 0xFF, 0xFF, 0xFF, 0x49, 0xAE, 
-    0x26, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x67, 0x14, 0x2F, 0x03, 0x2F, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4C, 0x82, 0x2B, 0x48, 0xED, 0x58, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x78, 0x00, 0x1C, 
-    0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x2A, 0x26, 0x48, 0x2F, 0x2B, 0x00, 0x04, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x40, 0x58, 0xE9, 0x88, 0x72, 0x1C, 0xD0, 0x81, 0x58, 0x4F, 0x2F, 0x00, 0x42, 0xA7, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x0C, 0x26, 0x48, 0x4A, 0x2D, 0xEE, 0x0B, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x16, 0x48, 0x6A, 0x00, 0x0A, 0x2F, 0x05, 0x48, 0x79, 0x00, 0x00, 0x0C, 0x51, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x44, 0xFA, 0x4F, 0xEF, 0x00, 0x0C, 0x2C, 0x2D, 0xF2, 0xC8, 0x2F, 0x03, 0x2F, 0x04, 
-    0x2F, 0x0B, 0x2F, 0x0C, 0x2F, 0x05, 0x2F, 0x2D, 0xF2, 0xC8, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x86, 
-    0x2B, 0x48, 0xF2, 0xC8, 0x20, 0x46, 0x20, 0x50, 0x21, 0x6D, 0xED, 0x58, 0x00, 0x10, 0x20, 0x46, 
-    0x2F, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x6E, 0xFE, 0x0C, 0x2D, 0x00, 0x03, 0xEE, 0x0B, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x6D, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x5C, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x0C, 
-    0x76, 0x02, 0x20, 0x6A, 0x00, 0x04, 0x24, 0x50, 0x20, 0x0A, 0x66, 0x00, 0xFE, 0x90, 0x4A, 0x83, 
-    0x66, 0x00, 0xFE, 0x4E, 0x60, 0x28, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x12, 0x48, 0x6C, 0x00, 0x24, 
-    0x48, 0x79, 0x00, 0x00, 0x0C, 0x34, 0x61, 0xFF, 0xFF, 0xFF, 0x44, 0x82, 0x50, 0x4F, 0x4A, 0xAE, 
-    0x00, 0x0C, 0x67, 0x0A, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xAC, 0x58, 0x4F, 0x4C, 0xDF, 
-    0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 
-    0x2F, 0x2A, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x49, 0x2E, 0x2D, 0x48, 0xFF, 0xFC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4A, 0x00, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x4C, 0x52, 0x48, 0x79, 0x00, 0x00, 
-    0x27, 0xE0, 0x48, 0x78, 0x02, 0x00, 0x48, 0x6D, 0xEF, 0x40, 0x61, 0xFF, 0xFF, 0xFF, 0x42, 0x5A, 
-    0x70, 0x0A, 0xB0, 0xAA, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x0E, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xCE, 0x50, 0x4F, 0x61, 0xFF, 0xFF, 0xFF, 0x49, 0xE6, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x61, 0xFF, 0xFF, 0xFF, 0x49, 0x3C, 0x58, 0x4F, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1E, 0x38, 0x28, 0x2E, 0x00, 0x08, 0x2C, 0x2E, 
-    0x00, 0x0C, 0x97, 0xCB, 0x24, 0x44, 0x60, 0x02, 0x52, 0x8A, 0x4A, 0x12, 0x67, 0x06, 0x0C, 0x12, 
-    0x00, 0x28, 0x66, 0xF4, 0x0C, 0x12, 0x00, 0x28, 0x66, 0x3A, 0x42, 0x1A, 0x26, 0x4A, 0x60, 0x02, 
-    0x52, 0x8A, 0x0C, 0x12, 0x00, 0x29, 0x67, 0x06, 0x0C, 0x12, 0x00, 0x30, 0x66, 0xF2, 0x0C, 0x12, 
-    0x00, 0x29, 0x66, 0x04, 0x42, 0x12, 0x60, 0x1C, 0x2F, 0x0B, 0x2F, 0x04, 0x2F, 0x06, 0x48, 0x79, 
-    0x00, 0x00, 0x0C, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0xA4, 0x91, 0xC8, 0x4F, 0xEF, 0x00, 0x10, 
-    0x60, 0x00, 0x00, 0x9E, 0x28, 0x6D, 0xEE, 0x84, 0x60, 0x7C, 0x2F, 0x04, 0x2F, 0x2C, 0x00, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x41, 0x1A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x68, 0x7A, 0x00, 0x76, 0x00, 
-    0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x3C, 0xB9, 0xD2, 0x66, 0x34, 0x20, 0x0B, 0x67, 0x12, 0x48, 0x6A, 
-    0x00, 0x44, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x40, 0xF6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1E, 
-    0x4A, 0x83, 0x66, 0x04, 0x2A, 0x0A, 0x60, 0x14, 0x2F, 0x04, 0x2F, 0x06, 0x48, 0x79, 0x00, 0x00, 
-    0x0B, 0xDA, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x46, 0x4F, 0xEF, 0x00, 0x0C, 0x76, 0x01, 0x24, 0x6A, 
-    0x00, 0x08, 0x20, 0x0A, 0x66, 0xC0, 0x4A, 0x83, 0x66, 0x16, 0x2F, 0x04, 0x2F, 0x0B, 0x2F, 0x06, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0xB4, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x22, 0x4F, 0xEF, 0x00, 0x10, 
-    0x20, 0x45, 0x60, 0x1C, 0x28, 0x54, 0x20, 0x0C, 0x66, 0x80, 0x2F, 0x04, 0x2F, 0x06, 0x48, 0x79, 
-    0x00, 0x00, 0x0B, 0x98, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x04, 0x91, 0xC8, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x4A, 0xAE, 
-    0x00, 0x08, 0x67, 0x1E, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0xE4, 0x24, 0x48, 0x20, 0x0A, 0x50, 0x4F, 0x67, 0x08, 0x20, 0x2E, 0x00, 0x0C, 0x81, 0xAA, 
-    0x00, 0x30, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 
-    0x00, 0x08, 0x20, 0x0A, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x20, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0x7C, 0x58, 0x4F, 
-    0x22, 0x4A, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x20, 0x40, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFC, 0x18, 0x48, 0xE7, 0x1E, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 0x00, 0x0C, 
-    0x7C, 0x00, 0x60, 0x00, 0x0F, 0xF2, 0x0C, 0x12, 0x00, 0x2D, 0x67, 0x00, 0x00, 0x84, 0x26, 0x4A, 
-    0x60, 0x22, 0x0C, 0x13, 0x00, 0x2C, 0x66, 0x1A, 0x42, 0x13, 0x52, 0x8B, 0x28, 0x8B, 0x2F, 0x0A, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x6C, 0x61, 0xFF, 0xFF, 0xFF, 0x42, 0x52, 0x59, 0x8C, 0x50, 0x4F, 
-    0x60, 0x06, 0x52, 0x8B, 0x4A, 0x13, 0x66, 0xDA, 0x78, 0x00, 0x4A, 0x86, 0x67, 0x02, 0x78, 0x6C, 
-    0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x20, 0x4A, 0xD1, 0xC0, 0x53, 0x88, 
-    0x26, 0x48, 0x10, 0x10, 0x49, 0xC0, 0x26, 0x00, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x38, 0x00, 
-    0x49, 0xC0, 0x26, 0x00, 0x70, 0x61, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x6C, 0xB6, 0x80, 0x66, 0x0A, 
-    0x0C, 0x23, 0x00, 0x2F, 0x66, 0x04, 0x28, 0x03, 0x42, 0x13, 0x2F, 0x04, 0x2F, 0x0A, 0x2F, 0x05, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0xB0, 0x2A, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x0F, 0x68, 
-    0x52, 0x8A, 0x16, 0x12, 0x49, 0xC3, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x38, 0x00, 0x49, 0xC0, 
-    0x26, 0x00, 0x20, 0x03, 0x04, 0x80, 0x00, 0x00, 0x00, 0x61, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x17, 
-    0x62, 0x00, 0x0F, 0x34, 0x30, 0x3B, 0x02, 0x06, 0x4E, 0xFB, 0x00, 0x02, 0x00, 0x30, 0x00, 0xD4, 
-    0x01, 0x4A, 0x01, 0x58, 0x02, 0x60, 0x04, 0x26, 0x0F, 0x2A, 0x04, 0x70, 0x05, 0x62, 0x0F, 0x2A, 
-    0x0F, 0x2A, 0x04, 0x80, 0x07, 0x74, 0x0A, 0x22, 0x06, 0xEE, 0x0F, 0x2A, 0x07, 0xD6, 0x08, 0x4C, 
-    0x0B, 0x0A, 0x0F, 0x2A, 0x0C, 0x48, 0x0C, 0xD0, 0x08, 0x04, 0x0E, 0x88, 0x48, 0x79, 0x00, 0x00, 
-    0x0B, 0x68, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3F, 0x16, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1A, 
-    0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x12, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x0A, 
-    0x1B, 0x7C, 0x00, 0x02, 0xEE, 0x0F, 0x60, 0x00, 0x0E, 0xDE, 0x4A, 0xAD, 0xED, 0xCC, 0x67, 0x0E, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x41, 0x52, 0x58, 0x4F, 0x48, 0x79, 
-    0x00, 0x00, 0x0B, 0x68, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0xD4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x0A, 0x70, 0x04, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 0x0E, 0xAC, 0x48, 0x79, 0x00, 0x00, 
-    0x0B, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0xB6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x10, 
-    0x70, 0x01, 0x2B, 0x40, 0xED, 0xCC, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x10, 0x60, 0x00, 0x0E, 0x88, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x1B, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x92, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x00, 0x0E, 0x62, 0x70, 0x09, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 0x0E, 0x68, 
-    0x4A, 0x2A, 0x00, 0x01, 0x67, 0x00, 0x08, 0x08, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x16, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x6A, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x00, 0x07, 0xF2, 0x48, 0x79, 
-    0x00, 0x00, 0x0B, 0x12, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x54, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x0E, 0x24, 0x4A, 0xAD, 0xED, 0xCC, 0x67, 0x1C, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 
-    0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x0F, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x40, 0x9A, 0x58, 0x4F, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x1B, 0x7C, 
-    0x00, 0x02, 0xEE, 0x0F, 0x60, 0x06, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x0F, 0x70, 0x04, 0x2B, 0x40, 
-    0xED, 0xCC, 0x60, 0x00, 0x0D, 0xF2, 0x41, 0xF9, 0x00, 0x00, 0x20, 0x20, 0x2B, 0x48, 0xF2, 0xD2, 
-    0x60, 0x00, 0x0D, 0xE4, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x0E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x3D, 0xEE, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x04, 0x60, 0x00, 
-    0x0D, 0xC6, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0xD0, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x02, 0x60, 0x00, 0x0D, 0xA8, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x03, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0xB2, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x0E, 0x41, 0xF9, 0x00, 0x00, 0x0A, 0xFE, 0x2B, 0x48, 0xF2, 0xF2, 0x60, 0x00, 
-    0x07, 0xA6, 0x4A, 0x2A, 0x00, 0x01, 0x67, 0x3E, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xF8, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x8A, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x2A, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xF2, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x76, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x16, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0xE8, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x62, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x00, 0x0D, 0x32, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x11, 0x4A, 0x2D, 0xEE, 0x04, 
-    0x67, 0x3A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xF2, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x40, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x26, 0x4A, 0xAD, 0xED, 0xCC, 0x67, 0x16, 0x70, 0x01, 0xB0, 0xAD, 
-    0xED, 0xCC, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x3F, 0x8E, 
-    0x58, 0x4F, 0x70, 0x01, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 0x0C, 0xFC, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xE8, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x06, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x0C, 0xE6, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0xFC, 0x60, 0x00, 0x0C, 0xDC, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xE1, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3C, 0xE6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x00, 0x84, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3F, 0x38, 0x50, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x14, 0x2F, 0x14, 
-    0x61, 0xFF, 0x00, 0x00, 0x34, 0x04, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x66, 0x14, 0x2F, 0x14, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0xAB, 0x61, 0xFF, 0xFF, 0xFF, 0x3F, 0x12, 0x50, 0x4F, 0x60, 0x00, 
-    0x0C, 0x86, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x34, 0x20, 0x48, 0x6D, 0xFC, 0x20, 0x48, 0x79, 
-    0x00, 0x00, 0x1B, 0x14, 0x2F, 0x14, 0x61, 0xFF, 0x00, 0x00, 0x3A, 0x88, 0x48, 0x78, 0x02, 0x00, 
-    0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x02, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x42, 0xBC, 0x58, 0x4F, 
-    0x2F, 0x08, 0x48, 0x6D, 0xFC, 0x20, 0x61, 0xFF, 0x00, 0x00, 0x3C, 0xE6, 0x4F, 0xEF, 0x00, 0x20, 
-    0x60, 0x00, 0x0C, 0x44, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xA6, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x3C, 0x4E, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x3C, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0xA2, 0x50, 0x4F, 0x4A, 0xAD, 
-    0xED, 0xC0, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x8F, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x8E, 
-    0x58, 0x4F, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0xC2, 0x2B, 0x48, 0xED, 0xC0, 0x58, 0x4F, 
-    0x60, 0x00, 0x0B, 0xF4, 0x4A, 0x2A, 0x00, 0x01, 0x67, 0x2A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x8C, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3B, 0xF8, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x16, 0x48, 0x79, 
-    0x00, 0x00, 0x0A, 0x86, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3B, 0xE4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x00, 0x90, 0x4A, 0x2D, 0xEE, 0x13, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x8F, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x38, 0x58, 0x4F, 0x58, 0x8C, 0x26, 0x54, 0x20, 0x0B, 0x66, 0x10, 
-    0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3E, 0x20, 0x50, 0x4F, 
-    0x48, 0x78, 0x00, 0x2B, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x58, 0xDA, 0x24, 0x48, 0x20, 0x08, 
-    0x50, 0x4F, 0x67, 0x30, 0x1B, 0x7C, 0x00, 0x02, 0xEE, 0x13, 0x42, 0x12, 0x48, 0x6A, 0x00, 0x01, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x36, 0x2B, 0x48, 0xED, 0xAC, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x5A, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x71, 0xFA, 0x2B, 0x40, 0xEE, 0x1C, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x0B, 0x54, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x13, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x5A, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x71, 0xDA, 0x2B, 0x40, 0xEE, 0x14, 0x50, 0x4F, 0x60, 0x00, 
-    0x0B, 0x36, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x56, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3B, 0x40, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x0B, 0x10, 0x70, 0x06, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 
-    0x0B, 0x16, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x50, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3B, 0x20, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x28, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 
-    0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x74, 0x50, 0x4F, 0x2F, 0x14, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFA, 0xA8, 0x2B, 0x48, 0xED, 0xA8, 0x58, 0x4F, 0x60, 0x00, 0x0A, 0xDA, 0x4A, 0x2A, 
-    0x00, 0x01, 0x66, 0x00, 0x0A, 0xC2, 0x7C, 0x00, 0x60, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEE, 0x5A, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0xE0, 0x58, 0x4F, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x4B, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x3A, 0xC6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x00, 0x84, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3D, 0x18, 0x50, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x1B, 0x14, 0x2F, 0x14, 
-    0x61, 0xFF, 0x00, 0x00, 0x31, 0xE4, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x66, 0x14, 0x2F, 0x14, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0xAB, 0x61, 0xFF, 0xFF, 0xFF, 0x3C, 0xF2, 0x50, 0x4F, 0x60, 0x00, 
-    0x0A, 0x66, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x32, 0x00, 0x48, 0x6D, 0xFB, 0xE8, 0x48, 0x79, 
-    0x00, 0x00, 0x1B, 0x14, 0x2F, 0x14, 0x61, 0xFF, 0x00, 0x00, 0x38, 0x68, 0x48, 0x78, 0x10, 0x00, 
-    0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x40, 0x9C, 0x58, 0x4F, 
-    0x2F, 0x08, 0x48, 0x6D, 0xFB, 0xE8, 0x61, 0xFF, 0x00, 0x00, 0x3A, 0xC6, 0x4F, 0xEF, 0x00, 0x20, 
-    0x60, 0x00, 0x0A, 0x24, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x46, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x3A, 0x2E, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x28, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3C, 0x82, 0x50, 0x4F, 0x2F, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xB6, 0x2B, 0x48, 0xED, 0xA4, 0x58, 0x4F, 0x60, 0x00, 0x09, 0xE8, 
-    0x4A, 0x2A, 0x00, 0x01, 0x66, 0x00, 0x09, 0xD0, 0x7C, 0x01, 0x60, 0x00, 0x09, 0xDA, 0x48, 0x79, 
-    0x00, 0x00, 0x0A, 0x42, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0xE4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x0A, 0x70, 0x05, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 0x09, 0xBC, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x3D, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0xC6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x01, 0x3E, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x3C, 0x18, 0x50, 0x4F, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x4C, 
-    0x26, 0x48, 0x58, 0x4F, 0x24, 0x4B, 0x60, 0x02, 0x52, 0x8A, 0x4A, 0x12, 0x67, 0x06, 0x0C, 0x12, 
-    0x00, 0x2C, 0x66, 0xF4, 0x16, 0x12, 0x42, 0x12, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x38, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x7A, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x32, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x66, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 
-    0x00, 0x2D, 0x00, 0x01, 0xED, 0xEF, 0x60, 0x00, 0x00, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x2C, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x48, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 
-    0x00, 0x00, 0x0A, 0x22, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x34, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x0A, 0x00, 0x2D, 0x00, 0x04, 0xED, 0xEF, 0x60, 0x00, 0x00, 0x96, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x18, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x16, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x08, 
-    0x00, 0x2D, 0x00, 0x08, 0xED, 0xEF, 0x60, 0x78, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x12, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x38, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x0B, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0xE6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x08, 
-    0x00, 0x2D, 0x00, 0x02, 0xED, 0xEF, 0x60, 0x48, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x04, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x38, 0xCA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x08, 0x00, 0x2D, 0x00, 0x10, 
-    0xED, 0xEF, 0x60, 0x2C, 0x48, 0x79, 0x00, 0x00, 0x09, 0xFA, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x38, 0xAE, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x08, 0x00, 0x2D, 0x00, 0x20, 0xED, 0xEF, 0x60, 0x10, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x09, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x50, 0x4F, 
-    0x26, 0x4A, 0x52, 0x8B, 0x4A, 0x03, 0x66, 0x00, 0xFE, 0xEC, 0x60, 0x00, 0x08, 0x6A, 0x48, 0x79, 
-    0x00, 0x00, 0x09, 0xCA, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x74, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x08, 0x44, 0x45, 0xF9, 0x00, 0x00, 0x09, 0xC8, 0x48, 0x79, 0x00, 0x00, 0x09, 0xC5, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x58, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 
-    0x00, 0x00, 0x28, 0xF2, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x44, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x06, 0x76, 0x01, 0x60, 0x00, 0x04, 0xEE, 0x4A, 0x2A, 0x00, 0x01, 0x67, 0x16, 0x48, 0x79, 
-    0x00, 0x00, 0x09, 0xBE, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x24, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x07, 0xF4, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3A, 0x76, 0x50, 0x4F, 0x4A, 0xAD, 0xED, 0xC4, 0x67, 0x0E, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x3A, 0x62, 0x58, 0x4F, 0x2F, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x96, 0x2B, 0x48, 0xED, 0xC4, 0x58, 0x4F, 0x60, 0x00, 0x07, 0xC8, 
-    0x48, 0x79, 0x00, 0x00, 0x09, 0xBA, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x37, 0xD2, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x07, 0x60, 0x00, 0x07, 0xAA, 0x48, 0x79, 
-    0x00, 0x00, 0x09, 0xB4, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x37, 0xB4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x07, 0x84, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x3A, 0x06, 0x50, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x09, 0x88, 
-    0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x6E, 0x0A, 0x1B, 0x40, 0xED, 0xEE, 0x50, 0x4F, 0x60, 0x00, 
-    0x07, 0x66, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x39, 0xD8, 0x50, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x09, 0x58, 0x2F, 0x14, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x6D, 0xDC, 0x2B, 0x40, 0xED, 0xE8, 0x50, 0x4F, 0x60, 0x00, 0x07, 0x38, 
-    0x4A, 0x2D, 0xEE, 0x08, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0A, 0x8F, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x39, 0xAC, 0x58, 0x4F, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x96, 0x50, 0x4F, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x09, 0x58, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x6D, 0x94, 0x2B, 0x40, 
-    0xED, 0xE4, 0x50, 0x4F, 0x60, 0x00, 0x06, 0xF0, 0x48, 0x79, 0x00, 0x00, 0x09, 0x54, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x36, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1E, 0x4A, 0xAD, 0xED, 0xCC, 
-    0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0x50, 0x58, 0x4F, 
-    0x70, 0x03, 0x2B, 0x40, 0xED, 0xCC, 0x60, 0x00, 0x06, 0xBE, 0x48, 0x79, 0x00, 0x00, 0x09, 0x4E, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x36, 0xC8, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 
-    0x00, 0x00, 0x09, 0x44, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x36, 0xB4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x05, 0x60, 0x00, 0x06, 0x8C, 0x48, 0x79, 0x00, 0x00, 
-    0x09, 0x40, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x36, 0x96, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 
-    0x48, 0x79, 0x00, 0x00, 0x09, 0x38, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x36, 0x82, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x50, 0x41, 0xF9, 0x00, 0x00, 0x09, 0x34, 0x2B, 0x48, 0xF2, 0xEE, 0x4A, 0x2D, 
-    0xEE, 0x12, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x09, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0xCE, 
-    0x58, 0x4F, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x08, 0xE1, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x38, 0xBA, 0x58, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x08, 0xE1, 0x2F, 0x14, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x6C, 0xBE, 0x2B, 0x40, 0xF2, 0xE2, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x12, 0x50, 0x4F, 
-    0x60, 0x00, 0x06, 0x14, 0x48, 0x79, 0x00, 0x00, 0x08, 0xDE, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x36, 0x1E, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x08, 0xD6, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x36, 0x0A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x52, 0x41, 0xF9, 0x00, 0x00, 
-    0x08, 0xD2, 0x2B, 0x48, 0xF2, 0xF2, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0x8F, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x56, 0x58, 0x4F, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 
-    0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x40, 0x50, 0x4F, 
-    0x48, 0x79, 0x00, 0x00, 0x08, 0x9F, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x6C, 0x44, 0x2B, 0x40, 
-    0xED, 0xD4, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x03, 0x50, 0x4F, 0x60, 0x00, 0x05, 0x9A, 0x48, 0x79, 
-    0x00, 0x00, 0x08, 0x98, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0xA4, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x1E, 0x4A, 0x2D, 0xEE, 0x01, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x08, 0x52, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x37, 0xFA, 0x58, 0x4F, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x00, 0x60, 0x00, 0x05, 0x68, 
-    0x4A, 0x2A, 0x00, 0x01, 0x67, 0x3E, 0x48, 0x79, 0x00, 0x00, 0x08, 0x4E, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x35, 0x6C, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x2A, 0x48, 0x79, 0x00, 0x00, 0x08, 0x48, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x58, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x16, 0x48, 0x79, 
-    0x00, 0x00, 0x08, 0x3C, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x44, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x05, 0x14, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x09, 0x60, 0x00, 0x05, 0x1A, 0x48, 0x79, 
-    0x00, 0x00, 0x08, 0x2E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x24, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x3C, 0x48, 0x79, 0x00, 0x00, 0x08, 0x25, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x10, 
-    0x4A, 0x80, 0x50, 0x4F, 0x67, 0x28, 0x48, 0x79, 0x00, 0x00, 0x08, 0x1C, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x34, 0xFC, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x08, 0x0C, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0xE8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1E, 0x4A, 0x2D, 
-    0xEE, 0x00, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x08, 0x52, 0x61, 0xFF, 0xFF, 0xFF, 0x37, 0x3E, 
-    0x58, 0x4F, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x01, 0x60, 0x00, 0x04, 0xAC, 0x48, 0x79, 0x00, 0x00, 
-    0x08, 0x00, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0xB6, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 
-    0x1B, 0x7C, 0x00, 0x01, 0xED, 0xFF, 0x60, 0x00, 0x04, 0x8E, 0x48, 0x79, 0x00, 0x00, 0x07, 0xFC, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0x98, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x3E, 0x48, 0x79, 
-    0x00, 0x00, 0x07, 0xF4, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0x84, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x2A, 0x48, 0x79, 0x00, 0x00, 0x07, 0xEC, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0x70, 
-    0x4A, 0x80, 0x50, 0x4F, 0x67, 0x16, 0x48, 0x79, 0x00, 0x00, 0x07, 0xE2, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x34, 0x5C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x04, 0x2C, 0x1B, 0x7C, 0x00, 0x01, 
-    0xEE, 0x0E, 0x60, 0x00, 0x04, 0x32, 0x48, 0x79, 0x00, 0x00, 0x07, 0xDE, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x34, 0x3C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x56, 0x4A, 0xAD, 0xED, 0xCC, 0x67, 0x0E, 
-    0x48, 0x79, 0x00, 0x00, 0x0B, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x36, 0x92, 0x58, 0x4F, 0x70, 0x01, 
-    0x2B, 0x40, 0xED, 0xCC, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x10, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x06, 
-    0x58, 0x8C, 0x2B, 0x54, 0xED, 0xB0, 0x66, 0x14, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x36, 0x68, 0x50, 0x4F, 0x60, 0x00, 0x03, 0xDC, 0x2F, 0x2D, 0xED, 0xB0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0x96, 0x2B, 0x48, 0xED, 0xB0, 0x58, 0x4F, 0x60, 0x00, 0x03, 0xC8, 
-    0x4A, 0x2A, 0x00, 0x01, 0x67, 0x28, 0x48, 0x79, 0x00, 0x00, 0x07, 0xDA, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x33, 0xCC, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x07, 0xD2, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x33, 0xB8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x30, 0x58, 0x8C, 
-    0x2B, 0x54, 0xED, 0xB8, 0x66, 0x14, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x36, 0x0A, 0x50, 0x4F, 0x60, 0x00, 0x03, 0x7E, 0x2F, 0x2D, 0xED, 0xB8, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF3, 0x38, 0x2B, 0x48, 0xED, 0xB8, 0x58, 0x4F, 0x60, 0x00, 0x03, 0x6A, 0x48, 0x79, 
-    0x00, 0x00, 0x07, 0xCC, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x33, 0x74, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0xFE, 0x60, 0x00, 0x03, 0x4C, 0x48, 0x79, 0x00, 0x00, 
-    0x07, 0xC4, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x33, 0x56, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x03, 0x26, 0x76, 0x02, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 
-    0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0xA6, 0x50, 0x4F, 0x4A, 0x2D, 0xEE, 0x0C, 0x67, 0x0E, 
-    0x48, 0x79, 0x00, 0x00, 0x0A, 0x8F, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x92, 0x58, 0x4F, 0x1B, 0x43, 
-    0xEE, 0x0C, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0xC2, 0x2B, 0x48, 0xED, 0xBC, 0x58, 0x4F, 
-    0x60, 0x00, 0x02, 0xF4, 0x4A, 0x2A, 0x00, 0x01, 0x67, 0x16, 0x48, 0x79, 0x00, 0x00, 0x07, 0xB9, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x32, 0xF8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x02, 0xC8, 
-    0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x35, 0x4A, 0x50, 0x4F, 0x4A, 0xAD, 0xEC, 0xE4, 0x67, 0x12, 0x48, 0x79, 0x00, 0x00, 
-    0x07, 0x94, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0x36, 0x58, 0x4F, 0x60, 0x00, 0x02, 0xAA, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 0x00, 0x02, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x58, 0x38, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x2F, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0x58, 0x58, 
-    0x2B, 0x68, 0x00, 0x04, 0xEC, 0xE4, 0x4A, 0x2A, 0x00, 0x01, 0x57, 0xC0, 0x44, 0x00, 0x49, 0xC0, 
-    0x1B, 0x40, 0xED, 0xFB, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0x6C, 0x48, 0x79, 0x00, 0x00, 
-    0x07, 0x90, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x32, 0x76, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 
-    0x01, 0x7A, 0x58, 0x8C, 0x4A, 0x94, 0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x34, 0xC8, 0x50, 0x4F, 0x48, 0x79, 0x00, 0x00, 0x17, 0x3E, 0x2F, 0x14, 
-    0x61, 0xFF, 0x00, 0x00, 0x29, 0x94, 0x26, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x66, 0x10, 0x2F, 0x14, 
-    0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0xA2, 0x50, 0x4F, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x3A, 0x50, 0x48, 0x78, 0x10, 0x00, 0x42, 0xA7, 0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x39, 0xDC, 0x58, 0x4F, 0x2F, 0x08, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x32, 0x92, 
-    0x48, 0x78, 0x00, 0x02, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 0x30, 0x48, 0x2F, 0x0B, 
-    0x61, 0xFF, 0x00, 0x00, 0x30, 0xEA, 0x28, 0x00, 0x42, 0xA7, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 
-    0x00, 0x00, 0x30, 0x32, 0x20, 0x04, 0x52, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x38, 0x2A, 
-    0x26, 0x08, 0x2F, 0x0B, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x04, 0x2F, 0x03, 0x61, 0xFF, 0x00, 0x00, 
-    0x2F, 0x12, 0x53, 0x80, 0x4F, 0xEF, 0x00, 0x40, 0x66, 0x0E, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 
-    0x2B, 0x94, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x10, 0x2F, 0x14, 0x48, 0x79, 0x00, 0x00, 0x33, 0xF2, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x34, 0x18, 0x50, 0x4F, 0x20, 0x43, 0x42, 0x30, 0x48, 0x00, 0x2F, 0x0B, 
-    0x61, 0xFF, 0x00, 0x00, 0x29, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x39, 0xDA, 0x78, 0x00, 0x24, 0x43, 
-    0x58, 0x4F, 0x60, 0x02, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x76, 0x01, 0x60, 0x5E, 0x20, 0x03, 0x52, 0x83, 
-    0x41, 0xEE, 0xFC, 0x18, 0x21, 0x8A, 0x0C, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x00, 0xFA, 0x63, 0x18, 
-    0x2F, 0x04, 0x2F, 0x0B, 0x48, 0x79, 0x00, 0x00, 0x07, 0x69, 0x61, 0xFF, 0xFF, 0xFF, 0x33, 0xBE, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x02, 0x52, 0x8A, 0x4A, 0x12, 0x67, 0x12, 0x10, 0x12, 0x48, 0x80, 
-    0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x67, 0xE8, 0x4A, 0x12, 
-    0x67, 0x18, 0x42, 0x1A, 0x60, 0x02, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x4A, 0x12, 0x66, 0x9E, 0x41, 0xEE, 
-    0xFC, 0x18, 0x42, 0xB0, 0x3C, 0x00, 0x2F, 0x05, 0x48, 0x6E, 0xFC, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF0, 0xE2, 0x2A, 0x08, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xDE, 0x16, 0x1A, 0x49, 0xC3, 0x60, 0x08, 
-    0x52, 0x2D, 0xEE, 0x0B, 0x16, 0x1A, 0x49, 0xC3, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x38, 0x00, 
-    0x49, 0xC0, 0x26, 0x00, 0x72, 0x65, 0xB0, 0x81, 0x67, 0xE6, 0x70, 0x76, 0xB6, 0x80, 0x67, 0xE0, 
-    0x60, 0x00, 0x00, 0xB4, 0x4A, 0x2A, 0x00, 0x01, 0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x07, 0x64, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x30, 0xB8, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 
-    0x00, 0x01, 0xED, 0xFA, 0x60, 0x00, 0x00, 0x90, 0x48, 0x79, 0x00, 0x00, 0x07, 0x5B, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x30, 0x9A, 0x4A, 0x80, 0x57, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0x26, 0x00, 
-    0x50, 0x4F, 0x66, 0x14, 0x48, 0x79, 0x00, 0x00, 0x07, 0x54, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x30, 0x7E, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x4E, 0x48, 0x78, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x36, 0xB8, 0x26, 0x48, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0xF9, 0x58, 0x8C, 0x4A, 0x94, 0x58, 0x4F, 
-    0x66, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x0A, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x32, 0xBE, 
-    0x50, 0x4F, 0x4A, 0x83, 0x66, 0x06, 0x20, 0x6D, 0xED, 0xF0, 0x60, 0x04, 0x20, 0x6D, 0xED, 0xF4, 
-    0x26, 0x88, 0x27, 0x54, 0x00, 0x04, 0x4A, 0x83, 0x67, 0x06, 0x2B, 0x4B, 0xED, 0xF4, 0x60, 0x16, 
-    0x2B, 0x4B, 0xED, 0xF0, 0x60, 0x10, 0x2F, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x07, 0x3A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x32, 0x8A, 0x50, 0x4F, 0x58, 0x8C, 0x24, 0x54, 0x20, 0x0A, 0x66, 0x00, 0xF0, 0x08, 
-    0x20, 0x45, 0x4C, 0xDF, 0x1C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x18, 0x38, 0x48, 0x79, 0x00, 0x00, 0x26, 0x40, 0x2F, 0x2D, 0xED, 0xB8, 0x61, 0xFF, 0x00, 0x00, 
-    0x4D, 0x4A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x45, 0xED, 0xFB, 0xE8, 0x60, 0x52, 0x48, 0x79, 
-    0x00, 0x00, 0x1B, 0x14, 0x2F, 0x2D, 0xED, 0xB8, 0x61, 0xFF, 0x00, 0x00, 0x27, 0x1C, 0x24, 0x48, 
-    0x20, 0x08, 0x50, 0x4F, 0x66, 0x14, 0x2F, 0x2D, 0xED, 0xB8, 0x48, 0x79, 0x00, 0x00, 0x33, 0xE2, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x32, 0x28, 0x50, 0x4F, 0x60, 0x26, 0x61, 0xFF, 0xFF, 0xFF, 0x37, 0xD4, 
-    0x48, 0x78, 0x10, 0x00, 0x42, 0xA7, 0x48, 0x78, 0x10, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x37, 0x60, 
-    0x58, 0x4F, 0x2F, 0x08, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x30, 0x16, 0x4F, 0xEF, 0x00, 0x10, 
-    0x48, 0x79, 0x00, 0x00, 0x07, 0x24, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x2B, 0x44, 0x26, 0x2D, 
-    0xEF, 0x3C, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x86, 0x20, 0x43, 0x26, 0x68, 0x00, 0x04, 0x28, 0x6B, 
-    0x00, 0x10, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x40, 0x00, 0x00, 0x00, 0x66, 0x00, 0x01, 0x6C, 
-    0x20, 0x0C, 0x67, 0x0A, 0x70, 0x08, 0xC0, 0xAC, 0x00, 0x30, 0x66, 0x00, 0x01, 0x5E, 0x20, 0x43, 
-    0x48, 0x68, 0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x07, 0x1E, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x2B, 0x00, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x14, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x32, 0x70, 0x10, 
-    0xC0, 0xAB, 0x00, 0x14, 0x67, 0x12, 0x48, 0x79, 0x00, 0x00, 0x06, 0xFC, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x2A, 0xDE, 0x50, 0x4F, 0x60, 0x10, 0x48, 0x79, 0x00, 0x00, 0x06, 0xDF, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0x2A, 0xCC, 0x50, 0x4F, 0x26, 0x2B, 0x00, 0x1C, 0x60, 0x00, 0x00, 0x96, 
-    0x2F, 0x2B, 0x00, 0x0C, 0x48, 0x79, 0x00, 0x00, 0x06, 0xD8, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x2A, 0xB0, 0x76, 0x00, 0x20, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x20, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x67, 0x1A, 0x48, 0x6C, 0x00, 0x44, 0x48, 0x79, 0x00, 0x00, 0x06, 0xD0, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x2A, 0x8E, 0x26, 0x14, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x58, 0x20, 0x0C, 0x67, 0x54, 
-    0x41, 0xED, 0xEE, 0xA4, 0xB1, 0xEC, 0x00, 0x10, 0x67, 0x4A, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0C, 
-    0x66, 0x42, 0x4A, 0x2D, 0xEE, 0x09, 0x67, 0x3C, 0x20, 0x6C, 0x00, 0x10, 0x28, 0x28, 0x00, 0x58, 
-    0x10, 0x39, 0x00, 0x00, 0x2D, 0x3A, 0x49, 0xC0, 0x2F, 0x00, 0x2F, 0x04, 0x61, 0xFF, 0x00, 0x00, 
-    0x4C, 0x7A, 0x28, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x67, 0x06, 0x20, 0x4C, 0x52, 0x88, 0x28, 0x08, 
-    0x2F, 0x04, 0x48, 0x79, 0x00, 0x00, 0x06, 0xD0, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x2A, 0x32, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x83, 0x67, 0x48, 0x4A, 0x2D, 0xEE, 0x10, 0x67, 0x42, 0x20, 0x43, 
-    0x20, 0x68, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x14, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0x2A, 0x0C, 0x70, 0x02, 0x20, 0x43, 0x20, 0x68, 0x00, 0x08, 0xC0, 0xA8, 
-    0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x18, 0x20, 0x43, 0x2F, 0x28, 0x00, 0x04, 0x48, 0x79, 
-    0x00, 0x00, 0x1F, 0x06, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x29, 0xE6, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x70, 0x21, 0xC0, 0xAB, 0x00, 0x14, 0x72, 0x21, 0xB0, 0x81, 0x66, 0x10, 0x48, 0x79, 0x00, 0x00, 
-    0x06, 0xC6, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x29, 0xC8, 0x50, 0x4F, 0x2F, 0x0A, 0x48, 0x78, 
-    0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 0x29, 0xEC, 0x50, 0x4F, 0x26, 0x13, 0x4A, 0x83, 0x66, 0x00, 
-    0xFE, 0x78, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x27, 0xBC, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 
-    0x2F, 0x2D, 0xED, 0xB8, 0x48, 0x79, 0x00, 0x00, 0x33, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0x30, 0x3E, 
-    0x50, 0x4F, 0x41, 0xED, 0xFB, 0xE8, 0xB5, 0xC8, 0x67, 0x10, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x25, 0x48, 0x61, 0xFF, 0xFF, 0xFF, 0x35, 0xFE, 0x58, 0x4F, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x48, 0x79, 0x00, 0x00, 0x06, 0xB0, 
-    0x61, 0xFF, 0x00, 0x00, 0x2D, 0xD8, 0x24, 0x6D, 0xEF, 0x3C, 0x58, 0x4F, 0x60, 0x00, 0x00, 0xB6, 
-    0x26, 0x6A, 0x00, 0x04, 0x28, 0x6B, 0x00, 0x10, 0x20, 0x2B, 0x00, 0x14, 0x02, 0x80, 0x41, 0x00, 
-    0x00, 0x20, 0x66, 0x00, 0x00, 0x9E, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x14, 0x67, 0x00, 0x00, 0x94, 
-    0x20, 0x0C, 0x67, 0x0A, 0x70, 0x08, 0xC0, 0xAC, 0x00, 0x30, 0x66, 0x00, 0x00, 0x86, 0x0C, 0x2A, 
-    0x00, 0x21, 0x00, 0x08, 0x66, 0x7C, 0x0C, 0x2A, 0x00, 0x21, 0x00, 0x09, 0x66, 0x74, 0x2F, 0x2B, 
-    0x00, 0x0C, 0x48, 0x6A, 0x00, 0x0A, 0x48, 0x79, 0x00, 0x00, 0x06, 0xA4, 0x61, 0xFF, 0x00, 0x00, 
-    0x2D, 0x7C, 0x20, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x4C, 0x24, 0x54, 0x48, 0x6C, 0x00, 0x44, 
-    0x48, 0x79, 0x00, 0x00, 0x06, 0x96, 0x61, 0xFF, 0x00, 0x00, 0x2D, 0x62, 0x20, 0x0A, 0x50, 0x4F, 
-    0x67, 0x34, 0x20, 0x6A, 0x00, 0x08, 0x48, 0x68, 0x00, 0x24, 0x48, 0x79, 0x00, 0x00, 0x1A, 0x14, 
-    0x61, 0xFF, 0x00, 0x00, 0x2D, 0x48, 0x70, 0x02, 0x20, 0x6A, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x04, 
-    0x50, 0x4F, 0x67, 0x12, 0x2F, 0x2A, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x1F, 0x06, 0x61, 0xFF, 
-    0x00, 0x00, 0x2D, 0x2A, 0x50, 0x4F, 0x48, 0x78, 0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 0x25, 0x26, 
-    0x58, 0x4F, 0x24, 0x53, 0x20, 0x0A, 0x66, 0x00, 0xFF, 0x48, 0x48, 0x6D, 0xFB, 0xE8, 0x61, 0xFF, 
-    0x00, 0x00, 0x26, 0xA2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x06, 0x7E, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x2F, 0x28, 0x58, 0x4F, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x28, 0x2E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 
-    0x41, 0xF9, 0x00, 0x00, 0x35, 0x64, 0x2B, 0x48, 0xED, 0x94, 0x41, 0xF9, 0x00, 0x00, 0x06, 0x73, 
-    0x2B, 0x48, 0xED, 0x98, 0x41, 0xF9, 0x00, 0x00, 0x06, 0x6A, 0x2B, 0x48, 0xED, 0x9C, 0x41, 0xF9, 
-    0x00, 0x00, 0x06, 0x61, 0x2B, 0x48, 0xED, 0xA0, 0x48, 0x78, 0x00, 0x20, 0x48, 0x6D, 0xED, 0x64, 
-    0x2F, 0x12, 0x61, 0xFF, 0x00, 0x00, 0x0B, 0x5E, 0x70, 0x01, 0xB8, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x6E, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xDF, 0xD4, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x2F, 0x5A, 
-    0x58, 0x4F, 0x42, 0xAD, 0xE8, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x23, 0x2A, 0x48, 0x78, 0x00, 0x02, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x11, 0x08, 0x48, 0x79, 0x00, 0x00, 0x23, 0x2A, 0x48, 0x78, 0x00, 0x0F, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x10, 0xF8, 0x48, 0x79, 0x00, 0x00, 0x23, 0x2A, 0x48, 0x78, 0x00, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x10, 0xE8, 0x48, 0x79, 0x00, 0x00, 0x23, 0x2A, 0x48, 0x78, 0x00, 0x06, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x10, 0xD8, 0x48, 0x79, 0x00, 0x00, 0x23, 0x2A, 0x48, 0x78, 0x00, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x10, 0xC8, 0x70, 0x10, 0x2B, 0x40, 0xED, 0x50, 0x2F, 0x3C, 0x00, 0x00, 
-    0xFE, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x32, 0x32, 0x2B, 0x48, 0xEC, 0xA4, 0x2B, 0x7C, 0x00, 0x00, 
-    0xFE, 0x00, 0xEC, 0xA8, 0x48, 0x79, 0x00, 0x00, 0x26, 0x6A, 0x48, 0x78, 0x00, 0x80, 0x48, 0x6D, 
-    0xEF, 0x58, 0x61, 0xFF, 0xFF, 0xFF, 0x2C, 0x62, 0x48, 0x79, 0x00, 0x00, 0x26, 0x6A, 0x48, 0x78, 
-    0x10, 0x00, 0x48, 0x6D, 0xEF, 0x4C, 0x61, 0xFF, 0xFF, 0xFF, 0x2C, 0x4E, 0x48, 0x78, 0x00, 0x0C, 
-    0x48, 0x6D, 0xEC, 0xD4, 0x61, 0xFF, 0xFF, 0xFF, 0x34, 0x9A, 0x42, 0xAD, 0xEF, 0x3C, 0x41, 0xED, 
-    0xEF, 0x3C, 0x2B, 0x48, 0xEF, 0x38, 0x1B, 0x6D, 0xF2, 0xE0, 0xED, 0xEE, 0x48, 0x6D, 0xEF, 0x34, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x6C, 0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x4F, 0xEF, 
-    0x00, 0x54, 0x66, 0x24, 0x42, 0xA7, 0x48, 0x78, 0x08, 0x00, 0x42, 0xA7, 0x42, 0xA7, 0x42, 0xA7, 
-    0x42, 0xA7, 0x42, 0xA7, 0x48, 0x79, 0x00, 0x00, 0x06, 0x54, 0x61, 0xFF, 0xFF, 0xFF, 0x48, 0xCC, 
-    0x2B, 0x48, 0xEE, 0x94, 0x4F, 0xEF, 0x00, 0x20, 0x4A, 0xAD, 0xEF, 0x30, 0x67, 0x0E, 0x48, 0x79, 
-    0x00, 0x00, 0x06, 0x26, 0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0xB4, 0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x10, 
-    0x67, 0x2A, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x0C, 0x4A, 0x2D, 0xEE, 0x12, 0x66, 0x1E, 0x42, 0xAD, 
-    0xF2, 0xE2, 0x60, 0x18, 0x4A, 0x2D, 0xEE, 0x12, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x05, 0xEE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0x88, 0x58, 0x4F, 0x42, 0xAD, 0xF2, 0xE2, 0x0C, 0x2D, 0x00, 0x02, 
-    0xEE, 0x0C, 0x66, 0x6A, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x12, 0x48, 0x79, 0x00, 0x00, 0x05, 0xAE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0x68, 0x42, 0x2D, 0xEE, 0x03, 0x58, 0x4F, 0x4A, 0x2D, 0xED, 0xFE, 
-    0x67, 0x12, 0x48, 0x79, 0x00, 0x00, 0x05, 0x72, 0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0x50, 0x42, 0x2D, 
-    0xED, 0xFE, 0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x12, 0x67, 0x12, 0x48, 0x79, 0x00, 0x00, 0x05, 0x32, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0x38, 0x42, 0x2D, 0xEE, 0x12, 0x58, 0x4F, 0x4A, 0x2D, 0xEE, 0x0F, 
-    0x66, 0x1C, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x14, 0x48, 0x79, 0x00, 0x00, 0x04, 0xF8, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x2D, 0x18, 0x1B, 0x7C, 0x00, 0x02, 0xEE, 0x0F, 0x58, 0x4F, 0x70, 0x05, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x30, 0x70, 0x04, 0x2B, 0x40, 0xED, 0xCC, 0x1B, 0x7C, 0x00, 0x01, 
-    0xEE, 0x0F, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x0D, 0x4A, 0x2D, 0xEE, 0x03, 0x67, 0x18, 0x4A, 0x2D, 
-    0xED, 0xFE, 0x66, 0x12, 0x48, 0x79, 0x00, 0x00, 0x04, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0x2C, 0xDE, 
-    0x42, 0x2D, 0xEE, 0x03, 0x58, 0x4F, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x18, 0x4A, 0x2D, 
-    0xEE, 0x11, 0x67, 0x12, 0x42, 0x2D, 0xEE, 0x11, 0x48, 0x79, 0x00, 0x00, 0x04, 0x64, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x2C, 0xBA, 0x58, 0x4F, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x66, 0x18, 0x4A, 0x2D, 
-    0xEE, 0x09, 0x67, 0x12, 0x42, 0x2D, 0xEE, 0x09, 0x48, 0x79, 0x00, 0x00, 0x04, 0x20, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x2C, 0x9A, 0x58, 0x4F, 0x4A, 0xAD, 0xED, 0xCC, 0x66, 0x06, 0x70, 0x04, 0x2B, 0x40, 
-    0xED, 0xCC, 0x70, 0x03, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x0C, 0x70, 0x04, 0x2B, 0x40, 0xED, 0xCC, 
-    0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x0A, 0x4A, 0x2D, 0xEE, 0x12, 0x66, 0x10, 0x4A, 0x2D, 0xEE, 0x0F, 
-    0x66, 0x06, 0x4A, 0x2D, 0xEE, 0x0D, 0x67, 0x04, 0x42, 0xAD, 0xF2, 0xE2, 0x42, 0xAD, 0xE9, 0xA6, 
-    0x4A, 0xAD, 0xED, 0xC4, 0x66, 0x44, 0x70, 0x09, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x0C, 0x41, 0xF9, 
-    0x00, 0x00, 0x04, 0x1A, 0x2B, 0x48, 0xED, 0xC4, 0x60, 0x30, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 
-    0x66, 0x1E, 0x4A, 0x2D, 0xEE, 0x0C, 0x67, 0x0C, 0x41, 0xF9, 0x00, 0x00, 0x04, 0x18, 0x2B, 0x48, 
-    0xED, 0xC4, 0x60, 0x16, 0x41, 0xF9, 0x00, 0x00, 0x04, 0x0F, 0x2B, 0x48, 0xED, 0xC4, 0x60, 0x0A, 
-    0x41, 0xF9, 0x00, 0x00, 0x04, 0x06, 0x2B, 0x48, 0xED, 0xC4, 0x4A, 0xAD, 0xEF, 0x34, 0x66, 0x12, 
-    0x48, 0x6D, 0xED, 0x64, 0x48, 0x79, 0x00, 0x00, 0x03, 0xDC, 0x61, 0xFF, 0xFF, 0xFF, 0x2B, 0xFE, 
-    0x50, 0x4F, 0x4A, 0x2D, 0xEE, 0x06, 0x67, 0x00, 0x01, 0x44, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 
-    0x42, 0xA7, 0x2F, 0x3C, 0x01, 0x00, 0x00, 0x02, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xFA, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x03, 0xCE, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x4F, 0x16, 0x2B, 0x48, 0xED, 0x08, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x2F, 0x3C, 
-    0x01, 0x00, 0x00, 0x07, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xCE, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x03, 0xC2, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xEA, 0x2B, 0x48, 
-    0xED, 0x00, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x2F, 0x3C, 0x01, 0x00, 0x00, 0x07, 
-    0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xA2, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 
-    0x00, 0x00, 0x03, 0xB6, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0xBE, 0x2B, 0x48, 0xEC, 0xFC, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 0x00, 0x05, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x4E, 0x78, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x04, 0x2F, 0x2D, 
-    0xF2, 0xEA, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x2C, 0xE0, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x82, 0x2B, 0x48, 0xED, 0x04, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 
-    0x42, 0xA7, 0x48, 0x78, 0x00, 0x07, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x3C, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x03, 0xA6, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x58, 
-    0x2B, 0x48, 0xEC, 0xF0, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 0x00, 0x03, 
-    0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x12, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 
-    0x00, 0x00, 0x03, 0x9C, 0x61, 0xFF, 0xFF, 0xFF, 0x4E, 0x2E, 0x2B, 0x48, 0xEC, 0xF8, 0x48, 0x79, 
-    0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 0x00, 0x07, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x4D, 0xE8, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x03, 0x8C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4E, 0x04, 0x2B, 0x48, 0xEC, 0xF4, 0x4F, 0xEF, 0x00, 0x54, 0x42, 0xAD, 0xED, 0x34, 
-    0x26, 0x6D, 0xEF, 0x34, 0x60, 0x00, 0x00, 0x86, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x04, 0x67, 0x7A, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0x32, 0xA6, 0x24, 0x6D, 0xF2, 0xC8, 0x2F, 0x2B, 0x00, 0x0C, 
-    0x42, 0xA7, 0x2F, 0x2B, 0x00, 0x08, 0x2F, 0x0B, 0x48, 0x6B, 0x00, 0x24, 0x2F, 0x2D, 0xF2, 0xC8, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x20, 0x2B, 0x48, 0xF2, 0xC8, 0x41, 0xED, 0xEE, 0x84, 0xB5, 0xC8, 
-    0x4F, 0xEF, 0x00, 0x1C, 0x66, 0x0E, 0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0x55, 0x18, 0x4A, 0x80, 
-    0x58, 0x4F, 0x66, 0x36, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x12, 0x48, 0x6B, 0x00, 0x24, 0x48, 0x79, 
-    0x00, 0x00, 0x03, 0x70, 0x61, 0xFF, 0xFF, 0xFF, 0x2A, 0x44, 0x50, 0x4F, 0x2F, 0x12, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x54, 0x72, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0B, 0x58, 0x4F, 0x6D, 0x0C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xDC, 0xD2, 0x61, 0xFF, 0xFF, 0xFF, 0xDC, 0x82, 0x26, 0x53, 0x20, 0x0B, 0x66, 0x00, 
-    0xFF, 0x78, 0x70, 0x06, 0xB0, 0xAD, 0xED, 0xCC, 0x67, 0x10, 0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 
-    0x66, 0x14, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 0x67, 0x0C, 0x4A, 0x2D, 0xED, 0xED, 0x67, 0x06, 
-    0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x11, 0x42, 0x2D, 0xED, 0xEC, 0x26, 0x6D, 0xEF, 0x34, 0x60, 0x18, 
-    0x70, 0x02, 0xC0, 0xAB, 0x00, 0x04, 0x67, 0x0E, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE5, 0x76, 0x50, 0x4F, 0x26, 0x53, 0x20, 0x0B, 0x66, 0xE4, 0x60, 0x00, 0x00, 0xB0, 
-    0x42, 0x2D, 0xED, 0xEC, 0x26, 0x6D, 0xEF, 0x34, 0x60, 0x00, 0x00, 0x9E, 0x70, 0x02, 0xC0, 0xAB, 
-    0x00, 0x04, 0x67, 0x00, 0x00, 0x92, 0x76, 0x00, 0x24, 0x6D, 0xEF, 0x3C, 0x60, 0x74, 0x70, 0x13, 
-    0x20, 0x6A, 0x00, 0x04, 0xC0, 0xA8, 0x00, 0x14, 0x55, 0x80, 0x66, 0x60, 0x20, 0x6A, 0x00, 0x04, 
-    0x4A, 0xA8, 0x00, 0x0C, 0x66, 0x56, 0x0C, 0x2A, 0x00, 0x21, 0x00, 0x08, 0x66, 0x4E, 0x0C, 0x2A, 
-    0x00, 0x21, 0x00, 0x09, 0x66, 0x46, 0x48, 0x78, 0x00, 0x09, 0x48, 0x79, 0x00, 0x00, 0x03, 0x66, 
-    0x48, 0x6A, 0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0x44, 0x8C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x2A, 0x48, 0x78, 0x00, 0x08, 0x48, 0x79, 0x00, 0x00, 0x03, 0x5D, 0x48, 0x6A, 0x00, 0x08, 
-    0x61, 0xFF, 0x00, 0x00, 0x44, 0x70, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0E, 0x20, 0x6A, 
-    0x00, 0x04, 0x00, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x01, 0x20, 0x6A, 0x00, 0x04, 
-    0x24, 0x50, 0x20, 0x0A, 0x66, 0x88, 0x4A, 0x83, 0x67, 0x14, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE4, 0xC6, 0x50, 0x4F, 0x26, 0x53, 0x20, 0x0B, 0x66, 0x00, 0xFF, 0x60, 0x4A, 0x2D, 
-    0xED, 0xEC, 0x66, 0x00, 0xFF, 0x4C, 0x48, 0x79, 0x00, 0x00, 0x03, 0x56, 0x48, 0x78, 0x00, 0x10, 
-    0x2F, 0x2D, 0xED, 0xA8, 0x61, 0xFF, 0xFF, 0xFF, 0xE6, 0x12, 0x48, 0x79, 0x00, 0x00, 0x03, 0x50, 
-    0x48, 0x78, 0x00, 0x20, 0x2F, 0x2D, 0xED, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xE5, 0xFE, 0x4A, 0xAD, 
-    0xEE, 0x24, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x14, 0x4A, 0xAD, 0xED, 0xAC, 0x67, 0x0E, 0x48, 0x79, 
-    0x00, 0x00, 0x03, 0x1F, 0x61, 0xFF, 0xFF, 0xFF, 0x28, 0xD4, 0x58, 0x4F, 0x4A, 0xAD, 0xED, 0xAC, 
-    0x67, 0x16, 0x48, 0x79, 0x00, 0x00, 0x03, 0x18, 0x2F, 0x2D, 0xED, 0xAC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE4, 0xC4, 0x2B, 0x48, 0xEE, 0x24, 0x50, 0x4F, 0x4A, 0xAD, 0xEE, 0x94, 0x67, 0x06, 0x20, 0x6D, 
-    0xEE, 0x94, 0x42, 0x90, 0x20, 0x6D, 0xF2, 0xC4, 0x42, 0x90, 0x48, 0x79, 0x00, 0x00, 0x35, 0x86, 
-    0x2F, 0x2D, 0xED, 0xC4, 0x48, 0x6D, 0xEE, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0x5D, 0x60, 0x41, 0xED, 
-    0xF2, 0xA8, 0x2B, 0x48, 0xEF, 0x10, 0x4A, 0x2D, 0xEE, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x42, 
-    0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x66, 0x14, 0x2F, 0x2D, 0xED, 0xBC, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x67, 0x66, 0x2B, 0x6D, 0xF2, 0xB4, 0xF2, 0xE2, 0x58, 0x4F, 0x60, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x62, 0x90, 0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x66, 0x08, 0x0C, 0x2D, 0x00, 0x01, 0xEE, 0x0F, 
-    0x66, 0x10, 0x48, 0x78, 0x01, 0xFD, 0x2F, 0x2D, 0xED, 0xC4, 0x61, 0xFF, 0xFF, 0xFF, 0x23, 0x48, 
-    0x50, 0x4F, 0x4A, 0xAD, 0xED, 0x18, 0x6F, 0x00, 0x00, 0xB6, 0x42, 0xA7, 0x48, 0x78, 0x08, 0x00, 
-    0x42, 0xA7, 0x42, 0xA7, 0x48, 0x78, 0x04, 0x00, 0x42, 0xA7, 0x42, 0xA7, 0x48, 0x79, 0x00, 0x00, 
-    0x03, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x43, 0x14, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x79, 0x00, 0x00, 
-    0x02, 0xF8, 0x61, 0xFF, 0xFF, 0xFF, 0x27, 0x6C, 0x2B, 0x48, 0xED, 0x10, 0x4A, 0xAD, 0xED, 0x10, 
-    0x4F, 0xEF, 0x00, 0x28, 0x66, 0x2E, 0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 
-    0x00, 0x02, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 
-    0x48, 0x79, 0x00, 0x00, 0x02, 0xE8, 0x61, 0xFF, 0xFF, 0xFF, 0x4B, 0x1C, 0x2B, 0x48, 0xED, 0x10, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x6D, 0xEF, 0x4C, 0x48, 0x79, 0x00, 0x00, 0x02, 0xD2, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x27, 0x20, 0x2B, 0x48, 0xED, 0x0C, 0x4A, 0xAD, 0xED, 0x0C, 0x50, 0x4F, 0x66, 0x2E, 
-    0x48, 0x79, 0x00, 0x00, 0x2E, 0x7C, 0x42, 0xA7, 0x48, 0x78, 0x00, 0x02, 0x42, 0xA7, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x4A, 0xB6, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x48, 0x79, 0x00, 0x00, 0x02, 0xBE, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x4A, 0xD2, 0x2B, 0x48, 0xED, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x2D, 
-    0xEE, 0x06, 0x67, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 0x78, 0xE0, 0x4A, 0xAD, 0xEE, 0x24, 0x67, 0x14, 
-    0x70, 0x04, 0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x0C, 0x4A, 0x2D, 0xEE, 0x0F, 0x66, 0x06, 0x4A, 0x2D, 
-    0xED, 0xED, 0x67, 0x06, 0x1B, 0x7C, 0x00, 0x01, 0xEE, 0x01, 0x4A, 0xAD, 0xEE, 0x24, 0x67, 0x0A, 
-    0x4A, 0x2D, 0xEE, 0x00, 0x67, 0x04, 0x42, 0x2D, 0xEE, 0x01, 0x61, 0xFF, 0xFF, 0xFF, 0x8F, 0xE8, 
-    0x4A, 0x2D, 0xED, 0xFA, 0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x02, 0xA4, 0x61, 0xFF, 0x00, 0x00, 
-    0x24, 0xFC, 0x58, 0x4F, 0x24, 0x6D, 0xEE, 0x8C, 0x60, 0x0E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x82, 0xFE, 0x24, 0x6A, 0x00, 0x08, 0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 0x4A, 0xAD, 0xED, 0x18, 
-    0x6F, 0x2A, 0x4A, 0xAD, 0xEE, 0x24, 0x67, 0x24, 0x20, 0x6D, 0xED, 0x0C, 0x20, 0x68, 0x00, 0x04, 
-    0x24, 0x68, 0x00, 0x10, 0x20, 0x0A, 0x67, 0x14, 0x2F, 0x2D, 0xED, 0x0C, 0x2F, 0x0A, 0x2F, 0x2D, 
-    0xEE, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 0x7E, 0xC0, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x2D, 0xED, 0xFA, 
-    0x67, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x02, 0xA2, 0x61, 0xFF, 0x00, 0x00, 0x24, 0xA0, 0x58, 0x4F, 
-    0x4A, 0x2D, 0xEE, 0x01, 0x66, 0x28, 0x61, 0xFF, 0xFF, 0xFF, 0x85, 0xF6, 0x4A, 0x2D, 0xEE, 0x0B, 
-    0x66, 0x0A, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x10, 0xC0, 0x81, 0x67, 0x12, 0x2F, 0x2D, 0xEF, 0x2C, 
-    0x48, 0x79, 0x00, 0x00, 0x02, 0x7F, 0x61, 0xFF, 0xFF, 0xFF, 0x26, 0xA2, 0x50, 0x4F, 0x0C, 0x2D, 
-    0x00, 0x02, 0xEE, 0x0C, 0x66, 0x10, 0x4A, 0xAD, 0xED, 0x18, 0x6F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x48, 0x0A, 0x2B, 0x48, 0xEC, 0xD0, 0x61, 0xFF, 0xFF, 0xFF, 0x97, 0x36, 0x24, 0x6D, 0xEE, 0x8C, 
-    0x60, 0x0E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0x7F, 0x48, 0x24, 0x6A, 0x00, 0x08, 0x58, 0x4F, 
-    0x20, 0x0A, 0x66, 0xEE, 0x61, 0xFF, 0xFF, 0xFF, 0x46, 0xEA, 0x24, 0x48, 0x61, 0xFF, 0xFF, 0xFF, 
-    0x7C, 0x7A, 0x61, 0xFF, 0xFF, 0xFF, 0x7C, 0xFA, 0x61, 0xFF, 0xFF, 0xFF, 0x91, 0x40, 0x70, 0x06, 
-    0xB0, 0xAD, 0xED, 0xCC, 0x66, 0x08, 0x70, 0x01, 0x2B, 0x40, 0xED, 0x44, 0x60, 0x06, 0x70, 0x04, 
-    0x2B, 0x40, 0xED, 0x44, 0x4A, 0x2D, 0xEE, 0x11, 0x67, 0x48, 0x4A, 0x2D, 0xED, 0xFC, 0x66, 0x42, 
-    0x52, 0xAD, 0xED, 0x44, 0x56, 0xAD, 0xED, 0x44, 0x52, 0xAD, 0xED, 0x44, 0x56, 0xAD, 0xED, 0x44, 
-    0x52, 0xAD, 0xED, 0x44, 0x56, 0xAD, 0xED, 0x44, 0x70, 0x03, 0x4C, 0x2D, 0x08, 0x00, 0xE9, 0x9E, 
-    0x72, 0x03, 0x4C, 0x2D, 0x18, 0x00, 0xE9, 0xA2, 0xD2, 0xAD, 0xE9, 0x96, 0xD2, 0x80, 0x20, 0x2D, 
-    0xE9, 0x92, 0xD0, 0x80, 0xD0, 0x81, 0x22, 0x2D, 0xE9, 0x9A, 0xD2, 0x81, 0xD2, 0x80, 0xD3, 0xAD, 
-    0xED, 0x34, 0x4A, 0x2D, 0xEE, 0x01, 0x57, 0xC0, 0x44, 0x00, 0x49, 0xC0, 0x2F, 0x00, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x98, 0x12, 0x4A, 0xAD, 0xED, 0xB8, 0x58, 0x4F, 0x67, 0x06, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xF3, 0x5C, 0x20, 0x0A, 0x67, 0x06, 0x2B, 0x6A, 0x00, 0x28, 0xEF, 0x18, 0x26, 0x2D, 0xE9, 0xA2, 
-    0xD6, 0xAD, 0xE9, 0x9E, 0x4A, 0x83, 0x67, 0x10, 0x2F, 0x03, 0x48, 0x79, 0x00, 0x00, 0x02, 0x32, 
-    0x61, 0xFF, 0xFF, 0xFF, 0x25, 0xA8, 0x50, 0x4F, 0x26, 0x2D, 0xE9, 0x9A, 0x4A, 0x83, 0x67, 0x10, 
-    0x2F, 0x03, 0x48, 0x79, 0x00, 0x00, 0x01, 0xE5, 0x61, 0xFF, 0xFF, 0xFF, 0x25, 0x90, 0x50, 0x4F, 
-    0x4A, 0xAD, 0xED, 0x8C, 0x66, 0x00, 0x00, 0xC2, 0x4A, 0x2D, 0xEE, 0x07, 0x67, 0x3A, 0x48, 0x6D, 
-    0xEE, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x40, 0x26, 0x6D, 0xEE, 0xF4, 0x58, 0x4F, 0x60, 0x24, 
-    0x24, 0x53, 0x60, 0x18, 0x48, 0x78, 0x00, 0x0D, 0x61, 0xFF, 0x00, 0x00, 0x1B, 0x38, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xCE, 0x22, 0x24, 0x6A, 0x00, 0x54, 0x50, 0x4F, 0x20, 0x0A, 0x66, 0xE4, 
-    0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 0x66, 0xD8, 0x4A, 0x2D, 0xEE, 0x0B, 0x67, 0x12, 0x2F, 0x2D, 
-    0xED, 0xC4, 0x48, 0x79, 0x00, 0x00, 0x01, 0xCC, 0x61, 0xFF, 0xFF, 0xFF, 0x25, 0x30, 0x50, 0x4F, 
-    0x0C, 0x2D, 0x00, 0x02, 0xEE, 0x0C, 0x66, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xCB, 0xDE, 0x60, 0x30, 
-    0x48, 0x6D, 0xEE, 0xA4, 0x61, 0xFF, 0xFF, 0xFF, 0xC2, 0xA2, 0x26, 0x6D, 0xEE, 0xF4, 0x58, 0x4F, 
-    0x60, 0x1A, 0x24, 0x53, 0x60, 0x0E, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xC2, 0x8E, 0x24, 0x6A, 
-    0x00, 0x54, 0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 0x66, 0xE2, 
-    0x10, 0x2D, 0xED, 0xEF, 0x72, 0x03, 0xC0, 0x81, 0x67, 0x0C, 0x2F, 0x2D, 0xEE, 0x84, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xD1, 0xE8, 0x58, 0x4F, 0x10, 0x2D, 0xED, 0xEF, 0x72, 0x20, 0xC0, 0x81, 0x67, 0x16, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0xB0, 0x60, 0x0E, 0x48, 0x79, 0x00, 0x00, 0x01, 0xA6, 0x61, 0xFF, 
-    0xFF, 0xFF, 0x24, 0xBA, 0x58, 0x4F, 0x42, 0xA7, 0x61, 0xFF, 0xFF, 0xFF, 0x25, 0x4C, 0x70, 0x00, 
-    0x58, 0x4F, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x2B, 0x6E, 
-    0x00, 0x10, 0xEC, 0x98, 0x61, 0xFF, 0x00, 0x00, 0x18, 0x42, 0x48, 0x79, 0x00, 0x00, 0x26, 0x6A, 
-    0x61, 0xFF, 0x00, 0x00, 0x19, 0x2A, 0x48, 0x6D, 0xEC, 0x64, 0x61, 0xFF, 0x00, 0x00, 0x1A, 0x0C, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x4E, 0x50, 0x4F, 0x61, 0xFF, 0x00, 0x00, 0x19, 0xBE, 0x61, 0xFF, 
-    0x00, 0x00, 0x18, 0xCC, 0x70, 0x01, 0xB0, 0xAE, 0xFF, 0xFC, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 
-    0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xFC, 0x20, 0x2F, 0x2E, 
-    0x00, 0x16, 0x61, 0xFF, 0x00, 0x00, 0x1E, 0x2A, 0x48, 0x6D, 0xFC, 0x20, 0x48, 0x78, 0x00, 0x0D, 
-    0x61, 0xFF, 0x00, 0x00, 0x1D, 0xAE, 0x0C, 0x2E, 0x00, 0x04, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x10, 
-    0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0x79, 0x00, 0x00, 0xFE, 0x4A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x5A, 0x4E, 0x5E, 0x4E, 0x75, 0x2B, 0x6F, 0x00, 0x04, 0xEF, 0x64, 0x4E, 0x75, 
-    0x20, 0x2D, 0xEF, 0x64, 0x4E, 0x75, 0x48, 0xE7, 0x18, 0x00, 0x26, 0x2F, 0x00, 0x0C, 0x4A, 0xAD, 
-    0xEF, 0x64, 0x67, 0x30, 0x28, 0x03, 0x72, 0x10, 0xE2, 0xAC, 0x22, 0x03, 0x74, 0x10, 0xE5, 0xA9, 
-    0x82, 0x84, 0x28, 0x03, 0xB3, 0x84, 0x02, 0x84, 0xFF, 0x00, 0xFF, 0xFF, 0x20, 0x03, 0xE0, 0x88, 
-    0x22, 0x03, 0x74, 0x18, 0xE5, 0xA9, 0x82, 0x80, 0x26, 0x01, 0x20, 0x04, 0xE0, 0x88, 0x22, 0x03, 
-    0xB1, 0x81, 0x26, 0x01, 0x20, 0x03, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x24, 0x2F, 0x00, 0x04, 
-    0x4A, 0xAD, 0xEF, 0x64, 0x67, 0x18, 0x20, 0x02, 0xE1, 0x88, 0x02, 0x80, 0x00, 0x00, 0xFF, 0x00, 
-    0x22, 0x02, 0xE0, 0x81, 0x02, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x80, 0x24, 0x01, 0x20, 0x02, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x28, 0x6E, 
-    0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x10, 0x20, 0x0C, 0x67, 0x06, 0x70, 0x01, 0xBA, 0x80, 0x6C, 0x06, 
-    0x20, 0x4A, 0x60, 0x00, 0x00, 0xA6, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x26, 0x00, 0x26, 0x4A, 0xD7, 0xC3, 0x70, 0x04, 0xB6, 0x80, 0x6F, 0x30, 0x48, 0x79, 0x00, 0x00, 
-    0x01, 0xA0, 0x48, 0x6B, 0xFF, 0xFC, 0x61, 0xFF, 0x00, 0x00, 0x3E, 0x20, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x16, 0x48, 0x79, 0x00, 0x00, 0x01, 0x9B, 0x48, 0x6B, 0xFF, 0xFC, 0x61, 0xFF, 0x00, 0x00, 
-    0x3E, 0x0A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 0x59, 0x8B, 0x59, 0x83, 0x28, 0x03, 0x55, 0x84, 
-    0x60, 0x28, 0x16, 0x32, 0x48, 0x00, 0x49, 0xC3, 0x70, 0x5C, 0xB6, 0x80, 0x67, 0x12, 0x70, 0x2F, 
-    0xB6, 0x80, 0x67, 0x0C, 0x70, 0x3A, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x2E, 0xB6, 0x80, 0x66, 0x08, 
-    0x20, 0x04, 0x52, 0x80, 0xD5, 0xC0, 0x60, 0x06, 0x53, 0x84, 0x4A, 0x84, 0x6C, 0xD4, 0x20, 0x4B, 
-    0x91, 0xCA, 0x26, 0x08, 0x20, 0x05, 0x53, 0x80, 0xB6, 0x80, 0x6F, 0x04, 0x26, 0x05, 0x53, 0x83, 
-    0x4A, 0x83, 0x6F, 0x10, 0x2F, 0x03, 0x2F, 0x0A, 0x2F, 0x0C, 0x61, 0xFF, 0x00, 0x00, 0x3E, 0x0E, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x42, 0x34, 0x38, 0x00, 0x20, 0x4C, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x2E, 
-    0x00, 0x10, 0x26, 0x6E, 0x00, 0x14, 0x20, 0x6A, 0x00, 0x08, 0x91, 0xCB, 0x2A, 0x08, 0x20, 0x52, 
-    0x91, 0xCB, 0x28, 0x08, 0xD7, 0xAA, 0x00, 0x0C, 0xBA, 0x83, 0x6C, 0x02, 0x26, 0x05, 0x20, 0x05, 
-    0x90, 0x83, 0xB0, 0x84, 0x6C, 0x04, 0x28, 0x05, 0x98, 0x83, 0x2F, 0x04, 0x2F, 0x0B, 0x48, 0x73, 
-    0x38, 0x00, 0x61, 0xFF, 0x00, 0x00, 0x3C, 0x4E, 0x20, 0x4B, 0x22, 0x6E, 0x00, 0x0C, 0x22, 0x03, 
-    0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xB7, 0xEA, 0x00, 0x04, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x62, 0x18, 0x20, 0x6A, 0x00, 0x08, 0x91, 0xEA, 0x00, 0x04, 0xB6, 0x88, 
-    0x6C, 0x06, 0xD7, 0xAA, 0x00, 0x04, 0x60, 0x06, 0x25, 0x6A, 0x00, 0x08, 0x00, 0x04, 0x20, 0x6A, 
-    0x00, 0x08, 0x91, 0xCB, 0x20, 0x03, 0xD0, 0x84, 0xB0, 0x88, 0x6C, 0x0A, 0x20, 0x4B, 0xD1, 0xC3, 
-    0xD1, 0xC4, 0x24, 0x88, 0x60, 0x04, 0x24, 0xAA, 0x00, 0x08, 0x4C, 0xDF, 0x0C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x20, 0x6A, 0x00, 0x04, 0xB1, 0xD2, 0x66, 0x26, 0xD7, 0xAA, 
-    0x00, 0x0C, 0x60, 0x0C, 0x20, 0x6A, 0x00, 0x04, 0x52, 0xAA, 0x00, 0x04, 0x10, 0x9B, 0x53, 0x83, 
-    0x20, 0x6A, 0x00, 0x04, 0xB1, 0xEA, 0x00, 0x08, 0x64, 0x04, 0x4A, 0x83, 0x6E, 0xE6, 0x24, 0xAA, 
-    0x00, 0x04, 0x60, 0x14, 0x2F, 0x2A, 0x00, 0x04, 0x2F, 0x03, 0x2F, 0x0B, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x12, 0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x20, 0x6A, 0x00, 0x04, 0xB1, 0xD2, 
-    0x66, 0x20, 0x52, 0xAA, 0x00, 0x0C, 0x20, 0x6A, 0x00, 0x04, 0xB1, 0xEA, 0x00, 0x08, 0x64, 0x0C, 
-    0x20, 0x6A, 0x00, 0x04, 0x52, 0xAA, 0x00, 0x04, 0x10, 0xAE, 0x00, 0x0C, 0x24, 0xAA, 0x00, 0x04, 
-    0x60, 0x18, 0x2F, 0x2A, 0x00, 0x04, 0x48, 0x78, 0x00, 0x01, 0x48, 0x6E, 0x00, 0x0C, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x4F, 0xEF, 0x00, 0x10, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x26, 0x2E, 0x00, 0x0C, 
-    0x45, 0xED, 0xF4, 0xE4, 0x28, 0x4A, 0x49, 0xEC, 0x01, 0x40, 0x60, 0x52, 0x48, 0x78, 0x00, 0x04, 
-    0x2F, 0x12, 0x2F, 0x03, 0x61, 0xFF, 0x00, 0x00, 0x3C, 0x4C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x3A, 0x41, 0xED, 0xF4, 0xD4, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 
-    0x48, 0x6D, 0xF4, 0xD4, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x20, 0x6A, 0x00, 0x04, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x2F, 0x2A, 0x00, 0x04, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x06, 0x50, 0x8A, 0xB5, 0xCC, 
-    0x65, 0xAA, 0xB5, 0xCC, 0x66, 0x12, 0x48, 0x78, 0x00, 0x04, 0x2F, 0x03, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xD2, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x24, 0x6E, 0x00, 0x0C, 0x48, 0x78, 0x00, 0x0A, 
-    0x42, 0xA7, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x37, 0xA6, 0x26, 0x00, 0x70, 0x01, 0xB6, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x06, 0x91, 0xC8, 0x60, 0x3E, 0x52, 0x8A, 0x70, 0x00, 0x10, 0x12, 
-    0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x66, 0xEC, 0x20, 0x4A, 
-    0xD1, 0xC3, 0xB1, 0xEE, 0x00, 0x10, 0x63, 0x04, 0x91, 0xC8, 0x60, 0x1C, 0x4A, 0xAE, 0x00, 0x14, 
-    0x67, 0x12, 0x2F, 0x03, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x66, 
-    0x4F, 0xEF, 0x00, 0x0C, 0xD5, 0xC3, 0x20, 0x4A, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x10, 0x28, 0x2E, 0x00, 0x18, 0x70, 0x00, 0x10, 0x12, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x74, 0x16, 0x1A, 
-    0x49, 0xC3, 0x72, 0xD0, 0xD6, 0x81, 0x70, 0x02, 0xB6, 0x80, 0x6C, 0x44, 0x91, 0xC8, 0x60, 0x62, 
-    0x2F, 0x04, 0x2F, 0x0C, 0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x24, 0x48, 
-    0x20, 0x0A, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x46, 0x4A, 0x84, 0x67, 0x1E, 
-    0x41, 0xED, 0xF4, 0xCC, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF4, 0xCC, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xDC, 0x4F, 0xEF, 0x00, 0x0C, 0x53, 0x83, 
-    0x70, 0x01, 0xB6, 0x80, 0x6E, 0xBA, 0x4A, 0xAE, 0x00, 0x14, 0x66, 0x14, 0x2F, 0x04, 0x2F, 0x0C, 
-    0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x02, 
-    0x20, 0x4A, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x26, 0x2E, 
-    0x00, 0x14, 0x0C, 0x12, 0x00, 0x51, 0x66, 0x18, 0x2F, 0x03, 0x42, 0xA7, 0x2F, 0x0B, 0x48, 0x6A, 
-    0x00, 0x01, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x12, 
-    0x2F, 0x03, 0x2F, 0x0B, 0x2F, 0x0A, 0x2F, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0xA6, 0x4F, 0xEF, 
-    0x00, 0x10, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x16, 0x2E, 0x00, 0x0C, 0x4A, 0xAE, 0x00, 0x0E, 0x67, 0x16, 
-    0x10, 0x03, 0x72, 0x03, 0xC0, 0x81, 0x67, 0x0E, 0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFD, 0x90, 0x5C, 0x4F, 0x10, 0x03, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x34, 0x41, 0xED, 
-    0xF4, 0xB4, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xB4, 
-    0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x0E, 0x10, 0x03, 0x72, 0x02, 0xC0, 0x81, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x0E, 0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x54, 
-    0x5C, 0x4F, 0x10, 0x03, 0x72, 0x02, 0xC0, 0x81, 0x67, 0x1E, 0x41, 0xED, 0xF4, 0xBA, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xBA, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFC, 0xD2, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0xAE, 0x00, 0x12, 0x67, 0x16, 0x10, 0x03, 
-    0x72, 0x03, 0xC0, 0x81, 0x67, 0x0E, 0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFD, 0x12, 0x5C, 0x4F, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 
-    0x20, 0x0B, 0x67, 0x00, 0x00, 0xC6, 0x20, 0x6B, 0x00, 0x04, 0x10, 0x10, 0x49, 0xC0, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x4D, 0x67, 0x2A, 0x57, 0x80, 0x67, 0x06, 0x55, 0x80, 0x67, 0x12, 0x60, 0x76, 
-    0x1F, 0x3C, 0x00, 0x2A, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xC8, 0x5C, 0x4F, 0x60, 0x76, 
-    0x1F, 0x3C, 0x00, 0x26, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xB8, 0x5C, 0x4F, 0x60, 0x66, 
-    0x4A, 0xAE, 0x00, 0x14, 0x67, 0x0E, 0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFC, 0xA2, 0x5C, 0x4F, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x48, 0x68, 
-    0x00, 0x01, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x84, 0x41, 0xED, 0xF4, 0xCC, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xCC, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFC, 0x12, 0x1F, 0x3C, 0x00, 0x2A, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x64, 
-    0x4F, 0xEF, 0x00, 0x22, 0x60, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x1F, 0x10, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFC, 0x50, 0x5C, 0x4F, 0x42, 0xA7, 0x42, 0xA7, 0x1F, 0x2B, 0x00, 0x08, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x88, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x0C, 0x2F, 0x13, 0x2F, 0x0A, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x4F, 0xEF, 0x00, 0x1E, 0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x90, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x1E, 0x78, 0x00, 0x2D, 0x6B, 0x00, 0x0C, 
-    0xFF, 0xB0, 0x26, 0x05, 0x42, 0xAE, 0xFF, 0xA0, 0x4A, 0x85, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x06, 
-    0x20, 0x45, 0x41, 0xE8, 0x00, 0x48, 0x2D, 0x48, 0xFF, 0xB4, 0x2E, 0x13, 0x4A, 0xAE, 0x00, 0x1A, 
-    0x67, 0x06, 0x20, 0x6E, 0x00, 0x1A, 0x42, 0x90, 0x4A, 0x85, 0x67, 0x00, 0x07, 0x74, 0x60, 0x20, 
-    0x20, 0x43, 0x4A, 0x90, 0x66, 0x18, 0x91, 0xC5, 0x20, 0x08, 0xE4, 0x80, 0xE0, 0x88, 0xE0, 0x88, 
-    0xE0, 0x88, 0xEA, 0x88, 0xD0, 0x88, 0xE6, 0x80, 0x2D, 0x40, 0xFF, 0xA0, 0x60, 0x08, 0x50, 0x83, 
-    0xB6, 0xAE, 0xFF, 0xB4, 0x65, 0xDA, 0xB6, 0xAE, 0xFF, 0xB4, 0x66, 0x00, 0x07, 0x44, 0x70, 0x09, 
-    0x2D, 0x40, 0xFF, 0xA0, 0x76, 0x00, 0x60, 0x00, 0x07, 0x38, 0x7C, 0x00, 0x1C, 0x1A, 0x20, 0x6D, 
-    0xF7, 0xA4, 0x10, 0x30, 0x68, 0x00, 0x72, 0x10, 0xC0, 0x81, 0x66, 0x12, 0x10, 0x30, 0x68, 0x00, 
-    0x72, 0x20, 0xC0, 0x81, 0x66, 0x08, 0x70, 0x51, 0xBC, 0x80, 0x66, 0x00, 0x02, 0x46, 0x48, 0x78, 
-    0x00, 0x01, 0x42, 0xA7, 0x1F, 0x2E, 0x00, 0x14, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0xAE, 
-    0x4F, 0xEF, 0x00, 0x0E, 0x20, 0x06, 0x61, 0xFF, 0xFF, 0xFE, 0xFE, 0xE4, 0x02, 0x0A, 0x00, 0x00, 
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x76, 0x00, 0x14, 0x00, 0x00, 0x00, 0x30, 0x01, 0xC8, 0x00, 0x00, 
-    0x00, 0x31, 0x01, 0xC2, 0x00, 0x00, 0x00, 0x32, 0x01, 0xBC, 0x00, 0x00, 0x00, 0x33, 0x01, 0xB6, 
-    0x00, 0x00, 0x00, 0x34, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x35, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x36, 
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x37, 0x01, 0x9E, 0x00, 0x00, 0x00, 0x38, 0x01, 0x98, 0x00, 0x00, 
-    0x00, 0x39, 0x01, 0x92, 0x00, 0x00, 0x00, 0x51, 0x01, 0xA6, 0x00, 0x00, 0x00, 0x62, 0x00, 0x5A, 
-    0x00, 0x00, 0x00, 0x63, 0x00, 0x76, 0x00, 0x00, 0x00, 0x64, 0x01, 0x1A, 0x00, 0x00, 0x00, 0x65, 
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x66, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x69, 0x00, 0xA2, 0x00, 0x00, 
-    0x00, 0x6C, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x72, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x73, 0x00, 0x6E, 
-    0x00, 0x00, 0x00, 0x76, 0x00, 0x02, 0x41, 0xED, 0xF4, 0x68, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x68, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x56, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x60, 0x41, 0xED, 0xF4, 0x62, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x62, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFA, 0x34, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x3E, 0x41, 0xED, 0xF4, 0x6E, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x6E, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFA, 0x12, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x1C, 0x41, 0xED, 0xF4, 0x74, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x74, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xFA, 0x41, 0xED, 
-    0xF4, 0x7A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x7A, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xCE, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xD8, 
-    0x41, 0xED, 0xF4, 0x7E, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF4, 0x7E, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xAC, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x00, 0xB6, 0x41, 0xED, 0xF4, 0x84, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 
-    0x48, 0x6D, 0xF4, 0x84, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x8A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x00, 0x94, 0x41, 0xED, 0xF4, 0x8A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x8A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x68, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x72, 0x41, 0xED, 0xF4, 0x92, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x92, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x48, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x52, 0x41, 0xED, 0xF4, 0x9E, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF4, 0x9E, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x28, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x32, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x0C, 0x48, 0x6A, 0xFF, 0xFF, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x4E, 0x24, 0x48, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x18, 0x48, 0x78, 
-    0x00, 0x01, 0x42, 0xA7, 0x2F, 0x0C, 0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0xA4, 
-    0x24, 0x48, 0x4F, 0xEF, 0x00, 0x14, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x16, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x38, 0x78, 0x01, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 
-    0x04, 0xD0, 0x20, 0x06, 0x61, 0xFF, 0xFF, 0xFE, 0xFC, 0xB6, 0x04, 0xC2, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x5F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB2, 0x00, 0x00, 0x00, 0x41, 
-    0x02, 0x98, 0x00, 0x00, 0x00, 0x43, 0x01, 0xDA, 0x00, 0x00, 0x00, 0x46, 0x00, 0x38, 0x00, 0x00, 
-    0x00, 0x4D, 0x02, 0x2A, 0x00, 0x00, 0x00, 0x4E, 0x03, 0xCC, 0x00, 0x00, 0x00, 0x50, 0x02, 0x1E, 
-    0x00, 0x00, 0x00, 0x52, 0x02, 0x18, 0x00, 0x00, 0x00, 0x53, 0x01, 0xDA, 0x00, 0x00, 0x00, 0x54, 
-    0x03, 0x68, 0x00, 0x00, 0x00, 0x55, 0x01, 0x72, 0x00, 0x00, 0x00, 0x56, 0x01, 0xB6, 0x00, 0x00, 
-    0x00, 0x5F, 0x04, 0x6A, 0x2D, 0x6B, 0x00, 0x04, 0xFF, 0x9C, 0x41, 0xEE, 0xFF, 0xB8, 0x28, 0x08, 
-    0x41, 0xE8, 0x00, 0x48, 0x2C, 0x08, 0x60, 0x0A, 0x20, 0x44, 0x42, 0x90, 0x42, 0xA8, 0x00, 0x04, 
-    0x50, 0x84, 0xB8, 0x86, 0x65, 0xF2, 0x4A, 0xAE, 0x00, 0x16, 0x67, 0x40, 0x1F, 0x3C, 0x00, 0x28, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x9C, 0x42, 0xA7, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x16, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x88, 0x27, 0x53, 0x00, 0x04, 0x4A, 0xAE, 0x00, 0x1A, 
-    0x4F, 0xEF, 0x00, 0x16, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x1A, 0x70, 0x01, 0x20, 0x80, 0x1F, 0x3C, 
-    0x00, 0x29, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0x5C, 0x4F, 0x1F, 0x3C, 0x00, 0x28, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF8, 0x5C, 0x0C, 0x12, 0x00, 0x76, 0x5C, 0x4F, 0x66, 0x04, 
-    0x52, 0x8A, 0x60, 0x50, 0x48, 0x6E, 0xFF, 0xB8, 0x42, 0xA7, 0x42, 0xA7, 0x42, 0x27, 0x2F, 0x0C, 
-    0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x24, 0x48, 0x20, 0x0A, 0x4F, 0xEF, 
-    0x00, 0x1A, 0x66, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x03, 0xEC, 0x4A, 0x12, 0x67, 0x26, 0x0C, 0x12, 
-    0x00, 0x5F, 0x67, 0x20, 0x41, 0xED, 0xF4, 0xD0, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xD0, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0xA8, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0xB0, 0x1F, 0x3C, 0x00, 0x29, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 
-    0x0C, 0x12, 0x00, 0x5F, 0x5C, 0x4F, 0x66, 0x64, 0x20, 0x6E, 0xFF, 0x9C, 0xB1, 0xEB, 0x00, 0x04, 
-    0x63, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x20, 0x6B, 0x00, 0x04, 0x28, 0x08, 0x2C, 0x13, 0x42, 0xAE, 
-    0xFF, 0x98, 0x27, 0x6E, 0xFF, 0x9C, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0xB8, 0x48, 0x6E, 0xFF, 0x98, 
-    0x42, 0xA7, 0x42, 0x27, 0x2F, 0x0C, 0x48, 0x6A, 0x00, 0x01, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFB, 0x94, 0x24, 0x48, 0x4A, 0xAE, 0xFF, 0x98, 0x4F, 0xEF, 0x00, 0x1A, 0x66, 0x0E, 0x1F, 0x3C, 
-    0x00, 0x20, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF7, 0x9A, 0x5C, 0x4F, 0x4A, 0x84, 0x67, 0x0C, 
-    0x20, 0x53, 0x91, 0xC6, 0x22, 0x44, 0xD3, 0xC8, 0x27, 0x49, 0x00, 0x04, 0x42, 0xA7, 0x48, 0x78, 
-    0x00, 0x01, 0x1F, 0x2E, 0x00, 0x14, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xC0, 0x78, 0x01, 
-    0x4F, 0xEF, 0x00, 0x0E, 0x60, 0x00, 0x03, 0x0A, 0x48, 0x78, 0x00, 0x01, 0x42, 0xA7, 0x1F, 0x2E, 
-    0x00, 0x14, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0xA4, 0x42, 0x2E, 0x00, 0x14, 0x41, 0xED, 
-    0xF4, 0xAA, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xAA, 
-    0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0xDE, 0x4F, 0xEF, 0x00, 0x1A, 0x60, 0x00, 0x02, 0xD2, 
-    0x70, 0x01, 0x72, 0x00, 0x12, 0x2E, 0x00, 0x14, 0x82, 0x80, 0x1D, 0x41, 0x00, 0x14, 0x60, 0x00, 
-    0x02, 0xC0, 0x70, 0x02, 0x72, 0x00, 0x12, 0x2E, 0x00, 0x14, 0x82, 0x80, 0x1D, 0x41, 0x00, 0x14, 
-    0x60, 0x00, 0x02, 0xAE, 0x48, 0x78, 0x00, 0x01, 0x42, 0xA7, 0x1F, 0x2E, 0x00, 0x14, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x48, 0x42, 0x2E, 0x00, 0x14, 0x41, 0xED, 0xF4, 0xA2, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xA2, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF6, 0x82, 0x4F, 0xEF, 0x00, 0x1A, 0x60, 0x00, 0x02, 0x76, 0x2D, 0x6E, 0x00, 0x16, 
-    0xFF, 0xA4, 0x20, 0x4A, 0x53, 0x88, 0x2D, 0x48, 0xFF, 0xA8, 0x1D, 0x6E, 0x00, 0x14, 0xFF, 0xAC, 
-    0x70, 0x4D, 0xBC, 0x80, 0x66, 0x1E, 0x42, 0xA7, 0x2F, 0x0C, 0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF8, 0xAA, 0x24, 0x48, 0x20, 0x0A, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x06, 0x91, 0xC8, 
-    0x60, 0x00, 0x02, 0x62, 0x2F, 0x05, 0x2F, 0x2E, 0x00, 0x1A, 0x48, 0x6E, 0xFF, 0xA4, 0x42, 0x27, 
-    0x2F, 0x0C, 0x2F, 0x0A, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFA, 0x6A, 0x24, 0x48, 0x78, 0x01, 
-    0x4F, 0xEF, 0x00, 0x1A, 0x60, 0x00, 0x02, 0x1A, 0x28, 0x2B, 0x00, 0x04, 0x4A, 0xAE, 0x00, 0x16, 
-    0x67, 0x40, 0x1F, 0x3C, 0x00, 0x28, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x66, 0x42, 0xA7, 
-    0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x16, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x52, 0x27, 0x53, 
-    0x00, 0x04, 0x4A, 0xAE, 0x00, 0x1A, 0x4F, 0xEF, 0x00, 0x16, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x1A, 
-    0x70, 0x01, 0x20, 0x80, 0x1F, 0x3C, 0x00, 0x29, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x34, 
-    0x5C, 0x4F, 0x1F, 0x3C, 0x00, 0x5B, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x26, 0x5C, 0x4F, 
-    0x60, 0x16, 0xB9, 0xCA, 0x62, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x01, 0xDA, 0x1F, 0x1A, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF6, 0x0E, 0x5C, 0x4F, 0x0C, 0x12, 0x00, 0x5F, 0x66, 0xE4, 0x52, 0x8A, 
-    0xB9, 0xCA, 0x62, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x01, 0xBC, 0x1F, 0x3C, 0x00, 0x5D, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0x0C, 0x12, 0x00, 0x41, 0x5C, 0x4F, 0x66, 0x04, 0x52, 0x8A, 
-    0x60, 0xB0, 0xB8, 0xAB, 0x00, 0x04, 0x65, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x20, 0x6B, 0x00, 0x04, 
-    0x2C, 0x08, 0x2D, 0x53, 0xFF, 0x90, 0x42, 0xAE, 0xFF, 0x94, 0x27, 0x44, 0x00, 0x04, 0x2F, 0x05, 
-    0x48, 0x6E, 0xFF, 0x94, 0x42, 0xA7, 0x1F, 0x2E, 0x00, 0x14, 0x2F, 0x0C, 0x2F, 0x0A, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF9, 0x90, 0x24, 0x48, 0x4A, 0xAE, 0xFF, 0x94, 0x4F, 0xEF, 0x00, 0x1A, 
-    0x66, 0x0E, 0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x96, 0x5C, 0x4F, 
-    0x4A, 0x86, 0x67, 0x0E, 0x20, 0x53, 0x91, 0xEE, 0xFF, 0x90, 0x22, 0x46, 0xD3, 0xC8, 0x27, 0x49, 
-    0x00, 0x04, 0x78, 0x01, 0x60, 0x00, 0x01, 0x1A, 0x70, 0x00, 0x10, 0x12, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x66, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x01, 0x26, 
-    0x18, 0x1A, 0x49, 0xC4, 0x72, 0xCF, 0xD8, 0x81, 0x4A, 0x84, 0x6D, 0x06, 0xB8, 0xAE, 0xFF, 0xA0, 
-    0x6D, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x01, 0x0E, 0x20, 0x45, 0x2F, 0x30, 0x4E, 0x00, 0x2F, 0x30, 
-    0x4E, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0xDC, 0x78, 0x01, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x00, 0xCE, 0x70, 0x00, 0x10, 0x12, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 
-    0x72, 0x20, 0xC0, 0x81, 0x66, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x00, 0xDA, 0x1C, 0x1A, 0x49, 0xC6, 
-    0x72, 0xD0, 0xDC, 0x81, 0x70, 0x02, 0xBC, 0x80, 0x6C, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x00, 0xC6, 
-    0x70, 0x00, 0x10, 0x12, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x66, 0x06, 0x91, 0xC8, 
-    0x60, 0x00, 0x00, 0xB2, 0x18, 0x1A, 0x49, 0xC4, 0x72, 0xCF, 0xD8, 0x81, 0x4A, 0x84, 0x6F, 0x74, 
-    0xB8, 0xAE, 0xFF, 0xA0, 0x6D, 0x6E, 0x91, 0xC8, 0x60, 0x00, 0x00, 0x9A, 0x20, 0x45, 0x2F, 0x30, 
-    0x4E, 0x00, 0x2F, 0x30, 0x4E, 0x04, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x68, 0x70, 0x01, 
-    0xBC, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6F, 0x4A, 0x4A, 0x83, 0x67, 0x28, 0x20, 0x45, 0x22, 0x43, 
-    0x22, 0xB0, 0x4E, 0x00, 0x20, 0x43, 0x21, 0x47, 0x00, 0x04, 0x4A, 0x93, 0x67, 0x06, 0x20, 0x53, 
-    0x52, 0x88, 0x2E, 0x08, 0x2D, 0x6B, 0x00, 0x0C, 0xFF, 0xB0, 0x50, 0x83, 0xB6, 0xAE, 0xFF, 0xB4, 
-    0x66, 0x02, 0x76, 0x00, 0x41, 0xED, 0xF4, 0xD0, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 
-    0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xD0, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x18, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x53, 0x86, 0x4A, 0x86, 0x6E, 0x94, 0x78, 0x01, 0x60, 0x04, 0x53, 0x8A, 0x60, 0x06, 
-    0x4A, 0x84, 0x67, 0x00, 0xF8, 0xC6, 0x20, 0x0A, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x16, 0x4A, 0x83, 
-    0x67, 0x10, 0x20, 0x2B, 0x00, 0x0C, 0x90, 0xAE, 0xFF, 0xB0, 0x20, 0x43, 0x20, 0x80, 0x21, 0x47, 
-    0x00, 0x04, 0x20, 0x4A, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x41, 0xED, 0xF4, 0xD4, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xD4, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF3, 0xB6, 
-    0x1F, 0x3C, 0x00, 0x20, 0x2F, 0x0A, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x08, 0x42, 0xA7, 0x42, 0xA7, 
-    0x42, 0xA7, 0x42, 0x27, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF7, 0xD2, 0x4F, 0xEF, 0x00, 0x2C, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xEC, 0x48, 0xE7, 0x1F, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x2E, 
-    0x00, 0x10, 0x26, 0x4A, 0x7E, 0x00, 0x76, 0x00, 0x42, 0xAE, 0xFF, 0xEC, 0x7A, 0x00, 0x20, 0x4A, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x20, 0x4A, 0xD1, 0xC0, 0x28, 0x48, 0xB9, 0xCA, 
-    0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x02, 0xAE, 0x2D, 0x6E, 0x00, 0x14, 0xFF, 0xF4, 0x2D, 0x6E, 
-    0x00, 0x14, 0xFF, 0xF0, 0x4A, 0xAE, 0x00, 0x18, 0x6E, 0x04, 0x70, 0x00, 0x60, 0x06, 0x20, 0x2E, 
-    0x00, 0x18, 0x53, 0x80, 0x20, 0x6E, 0x00, 0x14, 0xD1, 0xC0, 0x2D, 0x48, 0xFF, 0xF8, 0x42, 0xAE, 
-    0xFF, 0xFC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x30, 0x32, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x70, 0x01, 0x2D, 0x40, 
-    0xFF, 0xEC, 0x48, 0x78, 0x00, 0x04, 0x48, 0x79, 0x00, 0x00, 0x00, 0x37, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x30, 0x12, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x02, 0x7A, 0x01, 0x4A, 0x12, 
-    0x67, 0x14, 0x48, 0x79, 0x00, 0x00, 0x00, 0x34, 0x48, 0x6A, 0x00, 0x01, 0x61, 0xFF, 0x00, 0x00, 
-    0x30, 0x78, 0x2E, 0x08, 0x50, 0x4F, 0x4A, 0x87, 0x66, 0x1C, 0x4A, 0x86, 0x66, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x02, 0x22, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 
-    0xD5, 0xC3, 0x60, 0x00, 0x00, 0x94, 0x20, 0x47, 0x91, 0xCA, 0x26, 0x08, 0x20, 0x03, 0x54, 0x80, 
-    0xD5, 0xC0, 0x0C, 0x12, 0x00, 0x51, 0x66, 0x28, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x00, 0x01, 
-    0x2F, 0x0C, 0x48, 0x6A, 0x00, 0x01, 0x48, 0x6E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xF4, 0x34, 
-    0x24, 0x48, 0x20, 0x0A, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0xD6, 
-    0x70, 0x00, 0x10, 0x12, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 
-    0x67, 0x46, 0x48, 0x78, 0x00, 0x0A, 0x42, 0xA7, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x2B, 0x50, 
-    0x28, 0x00, 0x70, 0x01, 0xB8, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x08, 0x70, 0x00, 0x60, 0x00, 
-    0x01, 0xA4, 0x52, 0x8A, 0x70, 0x00, 0x10, 0x12, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 
-    0x72, 0x20, 0xC0, 0x81, 0x66, 0xEC, 0x20, 0x4A, 0xD1, 0xC4, 0xB9, 0xC8, 0x64, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x01, 0x82, 0x2C, 0x0A, 0xD5, 0xC4, 0x4A, 0x86, 0x67, 0x62, 0x2F, 0x04, 0x2F, 0x06, 
-    0x48, 0x6E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0x41, 0xED, 0xF4, 0xCC, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xCC, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0x4A, 0xAE, 0xFF, 0xEC, 0x4F, 0xEF, 0x00, 0x18, 0x66, 0x04, 
-    0x4A, 0x85, 0x67, 0x3A, 0x4A, 0x85, 0x67, 0x10, 0x1F, 0x3C, 0x00, 0x7E, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF2, 0x2E, 0x5C, 0x4F, 0x2F, 0x04, 0x2F, 0x06, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0xC0, 0x76, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x10, 0x4A, 0xAE, 
-    0xFF, 0xEC, 0x66, 0x04, 0x4A, 0x85, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x08, 0x4A, 0x83, 
-    0x6F, 0x7C, 0x70, 0x04, 0xB6, 0x80, 0x66, 0x10, 0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xF0, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xF2, 0x40, 0x50, 0x4F, 0x60, 0x66, 0x41, 0xED, 0xF4, 0xDE, 0x70, 0xFF, 0x52, 0x80, 
-    0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xDE, 0x2F, 0x0B, 0x61, 0xFF, 0x00, 0x00, 
-    0x2E, 0x94, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x32, 0x48, 0x73, 0x38, 0x00, 0x41, 0xED, 
-    0xF4, 0xDE, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x48, 0x73, 0x08, 0x00, 0x48, 0x6E, 
-    0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x78, 0x28, 0x08, 0x20, 0x4B, 0xD1, 0xC3, 0xB8, 0x88, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x18, 0x70, 0x00, 0x60, 0x00, 0x00, 0x9A, 0x2F, 0x03, 0x2F, 0x0B, 
-    0x48, 0x6E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xF1, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x4A, 
-    0x0C, 0x13, 0x00, 0x53, 0x66, 0x2A, 0x2F, 0x2E, 0x00, 0x14, 0x41, 0xED, 0xF4, 0xC4, 0x70, 0xFF, 
-    0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x2F, 0x00, 0x48, 0x6D, 0xF4, 0xC4, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xF0, 0x60, 0x52, 0x8A, 0x52, 0x8B, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x10, 
-    0x0C, 0x13, 0x00, 0x43, 0x66, 0x02, 0x52, 0x8B, 0x0C, 0x13, 0x00, 0x56, 0x66, 0x02, 0x52, 0x8B, 
-    0x0C, 0x13, 0x00, 0x46, 0x66, 0x24, 0x42, 0xA7, 0x42, 0xA7, 0x42, 0xA7, 0x42, 0x27, 0x2F, 0x0C, 
-    0x2F, 0x0A, 0x48, 0x6E, 0xFF, 0xF0, 0x61, 0xFF, 0xFF, 0xFF, 0xF5, 0x0A, 0x24, 0x48, 0x20, 0x0A, 
-    0x4F, 0xEF, 0x00, 0x1A, 0x66, 0x04, 0x70, 0x00, 0x60, 0x1A, 0xB5, 0xCC, 0x67, 0x04, 0x70, 0x00, 
-    0x60, 0x12, 0x4A, 0xAE, 0x00, 0x18, 0x6F, 0x06, 0x20, 0x6E, 0xFF, 0xF0, 0x42, 0x10, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x52, 0x80, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x18, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x28, 0x2E, 0x00, 0x10, 
-    0x2F, 0x04, 0x2F, 0x0A, 0x42, 0xA7, 0x42, 0xA7, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xF2, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x2E, 0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x26, 0x00, 0x20, 0x04, 0x53, 0x80, 0xB0, 0x83, 0x64, 0x04, 0x26, 0x04, 0x53, 0x83, 
-    0x20, 0x4A, 0x22, 0x4B, 0x22, 0x03, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 
-    0x66, 0xFA, 0x42, 0x32, 0x38, 0x00, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x59, 0x4F, 
-    0x42, 0x97, 0x1E, 0xBC, 0x00, 0x54, 0x70, 0x54, 0xB0, 0x97, 0x57, 0xC0, 0x44, 0x00, 0x49, 0xC0, 
-    0x58, 0x4F, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x26, 0x2E, 0x00, 0x0C, 0x4A, 0x83, 
-    0x66, 0x18, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0x0E, 0x94, 0x26, 0x00, 0x4A, 0x83, 
-    0x58, 0x4F, 0x67, 0x04, 0x20, 0x03, 0x60, 0x1E, 0x76, 0x34, 0x42, 0xA7, 0x2F, 0x03, 0x2F, 0x2E, 
-    0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0x0D, 0xCE, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x20, 0x03, 0x26, 0x1F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xC8, 
-    0x48, 0xE7, 0x10, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x24, 0x4B, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xED, 0xE0, 0x4A, 0x80, 0x67, 0x00, 0x00, 0xE0, 0x45, 0xEE, 0xFF, 0xCC, 0x70, 0x00, 
-    0x30, 0x2B, 0x00, 0x10, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x14, 0x35, 0x40, 0x00, 0x10, 
-    0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xEE, 0x02, 0x35, 0x40, 
-    0x00, 0x12, 0x2F, 0x2B, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0xAE, 0x25, 0x40, 0x00, 0x14, 
-    0x2F, 0x2B, 0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0xA0, 0x25, 0x40, 0x00, 0x18, 0x2F, 0x2B, 
-    0x00, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x92, 0x25, 0x40, 0x00, 0x1C, 0x2F, 0x2B, 0x00, 0x20, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x84, 0x25, 0x40, 0x00, 0x20, 0x2F, 0x2B, 0x00, 0x24, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xED, 0x76, 0x25, 0x40, 0x00, 0x24, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x28, 0x2F, 0x00, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xED, 0xAA, 0x35, 0x40, 0x00, 0x28, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x2A, 
-    0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x98, 0x35, 0x40, 0x00, 0x2A, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x2C, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x86, 0x35, 0x40, 0x00, 0x2C, 0x70, 0x00, 
-    0x30, 0x2B, 0x00, 0x2E, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x74, 0x35, 0x40, 0x00, 0x2E, 
-    0x70, 0x00, 0x30, 0x2B, 0x00, 0x30, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x62, 0x35, 0x40, 
-    0x00, 0x30, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x32, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xED, 0x50, 
-    0x35, 0x40, 0x00, 0x32, 0x4F, 0xEF, 0x00, 0x34, 0x48, 0x78, 0x00, 0x10, 0x42, 0xA7, 0x2F, 0x0A, 
-    0x61, 0xFF, 0x00, 0x00, 0x2A, 0xDA, 0x14, 0xBC, 0x00, 0x7F, 0x15, 0x7C, 0x00, 0x45, 0x00, 0x01, 
-    0x15, 0x7C, 0x00, 0x4C, 0x00, 0x02, 0x15, 0x7C, 0x00, 0x46, 0x00, 0x03, 0x15, 0x7C, 0x00, 0x01, 
-    0x00, 0x04, 0x15, 0x7C, 0x00, 0x01, 0x00, 0x05, 0x61, 0xFF, 0xFF, 0xFF, 0xFE, 0x74, 0x2D, 0x40, 
-    0xFF, 0xC8, 0x61, 0xFF, 0xFF, 0xFF, 0xEC, 0xBC, 0xB0, 0xAE, 0xFF, 0xC8, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x06, 0x15, 0x7C, 0x00, 0x02, 0x00, 0x05, 0x42, 0xA7, 0x42, 0xA7, 0x2F, 0x0C, 0x61, 0xFF, 
-    0x00, 0x00, 0x0C, 0x62, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x04, 0x70, 0x01, 0x60, 0x24, 
-    0x2F, 0x0C, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x00, 0x34, 0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 
-    0x0D, 0x02, 0x26, 0x00, 0x70, 0x01, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x6C, 0x04, 0x70, 0x01, 
-    0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xE0, 
-    0x48, 0xE7, 0x1C, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 
-    0x2A, 0x2E, 0x00, 0x14, 0x26, 0x2E, 0x00, 0x18, 0x2F, 0x03, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0x06, 0x26, 0x00, 0x4A, 0x83, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x01, 0x60, 0x00, 0x00, 0xE2, 
-    0x29, 0x43, 0x00, 0x1C, 0x39, 0x7C, 0x00, 0x20, 0x00, 0x2A, 0x39, 0x45, 0x00, 0x2C, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEC, 0x20, 0x4A, 0x80, 0x66, 0x22, 0x2F, 0x0B, 0x2F, 0x05, 0x48, 0x78, 0x00, 0x20, 
-    0x2F, 0x0A, 0x61, 0xFF, 0x00, 0x00, 0x0C, 0x8C, 0x26, 0x00, 0xB6, 0x85, 0x4F, 0xEF, 0x00, 0x10, 
-    0x6C, 0x00, 0x00, 0xAC, 0x70, 0x01, 0x60, 0x00, 0x00, 0xA8, 0x78, 0x00, 0x60, 0x00, 0x00, 0x9A, 
-    0x2F, 0x12, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0xF2, 0x2D, 0x40, 0xFF, 0xE0, 0x2F, 0x2A, 0x00, 0x04, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0xE4, 0x2D, 0x40, 0xFF, 0xE4, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEB, 0xD6, 0x2D, 0x40, 0xFF, 0xE8, 0x2F, 0x2A, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEB, 0xC8, 0x2D, 0x40, 0xFF, 0xEC, 0x2F, 0x2A, 0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0xBA, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2F, 0x2A, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0xAC, 0x2D, 0x40, 
-    0xFF, 0xF4, 0x2F, 0x2A, 0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x9E, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x2F, 0x2A, 0x00, 0x1C, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x90, 0x2D, 0x40, 0xFF, 0xFC, 0x2F, 0x0B, 
-    0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x00, 0x20, 0x48, 0x6E, 0xFF, 0xE0, 0x61, 0xFF, 0x00, 0x00, 
-    0x0B, 0xF2, 0x26, 0x00, 0x70, 0x01, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x30, 0x6C, 0x04, 0x70, 0x01, 
-    0x60, 0x0E, 0x52, 0x84, 0x70, 0x20, 0xD5, 0xC0, 0xB8, 0x85, 0x6D, 0x00, 0xFF, 0x64, 0x70, 0x00, 
-    0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xD8, 0x48, 0xE7, 0x1C, 0x38, 
-    0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x14, 
-    0x26, 0x2E, 0x00, 0x18, 0x2F, 0x03, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 0xFC, 0xEA, 0x26, 0x00, 
-    0x4A, 0x83, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x01, 0x60, 0x00, 0x00, 0xFE, 0x29, 0x43, 0x00, 0x20, 
-    0x39, 0x7C, 0x00, 0x28, 0x00, 0x2E, 0x39, 0x45, 0x00, 0x30, 0x61, 0xFF, 0xFF, 0xFF, 0xEB, 0x04, 
-    0x4A, 0x80, 0x66, 0x22, 0x2F, 0x0B, 0x2F, 0x05, 0x48, 0x78, 0x00, 0x28, 0x2F, 0x0A, 0x61, 0xFF, 
-    0x00, 0x00, 0x0B, 0x70, 0x26, 0x00, 0xB6, 0x85, 0x4F, 0xEF, 0x00, 0x10, 0x6C, 0x00, 0x00, 0xC8, 
-    0x70, 0x01, 0x60, 0x00, 0x00, 0xC4, 0x78, 0x00, 0x60, 0x00, 0x00, 0xB6, 0x2F, 0x12, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEA, 0xD6, 0x2D, 0x40, 0xFF, 0xD8, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEA, 0xC8, 0x2D, 0x40, 0xFF, 0xDC, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0xBA, 
-    0x2D, 0x40, 0xFF, 0xE0, 0x2F, 0x2A, 0x00, 0x0C, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0xAC, 0x2D, 0x40, 
-    0xFF, 0xE4, 0x2F, 0x2A, 0x00, 0x10, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x9E, 0x2D, 0x40, 0xFF, 0xE8, 
-    0x2F, 0x2A, 0x00, 0x14, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x90, 0x2D, 0x40, 0xFF, 0xEC, 0x2F, 0x2A, 
-    0x00, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x82, 0x2D, 0x40, 0xFF, 0xF0, 0x2F, 0x2A, 0x00, 0x1C, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xEA, 0x74, 0x2D, 0x40, 0xFF, 0xF4, 0x2F, 0x2A, 0x00, 0x20, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xEA, 0x66, 0x2D, 0x40, 0xFF, 0xF8, 0x2F, 0x2A, 0x00, 0x24, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xEA, 0x58, 0x2D, 0x40, 0xFF, 0xFC, 0x2F, 0x0B, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x00, 0x28, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x61, 0xFF, 0x00, 0x00, 0x0A, 0xBA, 0x26, 0x00, 0x70, 0x01, 0xB6, 0x80, 
-    0x4F, 0xEF, 0x00, 0x38, 0x6C, 0x04, 0x70, 0x01, 0x60, 0x0E, 0x52, 0x84, 0x70, 0x28, 0xD5, 0xC0, 
-    0xB8, 0x85, 0x6D, 0x00, 0xFF, 0x48, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 
-    0x28, 0x2E, 0x00, 0x14, 0x26, 0x2E, 0x00, 0x18, 0x2F, 0x03, 0x2F, 0x0B, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFB, 0xB6, 0x26, 0x00, 0x4A, 0x83, 0x50, 0x4F, 0x66, 0x04, 0x70, 0x01, 0x60, 0x2A, 0x25, 0x43, 
-    0x00, 0x10, 0x25, 0x44, 0x00, 0x14, 0x2F, 0x0B, 0x2F, 0x04, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x2E, 
-    0x00, 0x10, 0x61, 0xFF, 0x00, 0x00, 0x0A, 0x4C, 0x26, 0x00, 0xB6, 0x84, 0x4F, 0xEF, 0x00, 0x10, 
-    0x6C, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x1C, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x14, 0x26, 0x2E, 0x00, 0x18, 0x2F, 0x03, 0x2F, 0x0B, 
-    0x61, 0xFF, 0xFF, 0xFF, 0xFB, 0x52, 0x26, 0x00, 0x4A, 0x83, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x01, 
-    0x60, 0x00, 0x00, 0xC0, 0x28, 0x05, 0xE9, 0x8C, 0x25, 0x43, 0x00, 0x10, 0x25, 0x44, 0x00, 0x14, 
-    0x70, 0x10, 0x25, 0x40, 0x00, 0x24, 0x70, 0x02, 0x25, 0x40, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE9, 0x62, 0x4A, 0x80, 0x66, 0x20, 0x2F, 0x0B, 0x2F, 0x05, 0x48, 0x78, 0x00, 0x10, 0x2F, 0x0C, 
-    0x61, 0xFF, 0x00, 0x00, 0x09, 0xCE, 0x26, 0x00, 0xB6, 0x85, 0x4F, 0xEF, 0x00, 0x10, 0x6C, 0x00, 
-    0x00, 0x80, 0x70, 0x01, 0x60, 0x7C, 0x78, 0x00, 0x24, 0x4C, 0x60, 0x70, 0x2F, 0x12, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xE9, 0x36, 0x2D, 0x40, 0xFF, 0xF0, 0x2F, 0x2A, 0x00, 0x04, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xE9, 0x28, 0x2D, 0x40, 0xFF, 0xF4, 0x2F, 0x2A, 0x00, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0xE9, 0x1A, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x1D, 0x6A, 0x00, 0x0C, 0xFF, 0xFC, 0x1D, 0x6A, 0x00, 0x0D, 0xFF, 0xFD, 
-    0x70, 0x00, 0x30, 0x2A, 0x00, 0x0E, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xE9, 0x42, 0x3D, 0x40, 
-    0xFF, 0xFE, 0x2F, 0x0B, 0x48, 0x78, 0x00, 0x01, 0x48, 0x78, 0x00, 0x10, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x61, 0xFF, 0x00, 0x00, 0x09, 0x5E, 0x26, 0x00, 0x70, 0x01, 0xB6, 0x80, 0x4F, 0xEF, 0x00, 0x20, 
-    0x6C, 0x04, 0x70, 0x01, 0x60, 0x0C, 0x52, 0x84, 0x70, 0x10, 0xD5, 0xC0, 0xB8, 0x85, 0x6D, 0x8C, 
-    0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFE, 0x48, 0xE7, 
-    0x10, 0x30, 0x26, 0x2E, 0x00, 0x08, 0x97, 0xCB, 0x59, 0x4F, 0x2F, 0x03, 0x48, 0x6E, 0xFF, 0xFE, 
-    0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x20, 0x5F, 0x24, 0x48, 0x20, 0x0A, 0x66, 0x06, 0x20, 0x03, 
-    0xA1, 0x22, 0x24, 0x48, 0x20, 0x0A, 0x67, 0x06, 0x20, 0x4A, 0xA0, 0x29, 0x26, 0x52, 0x20, 0x4B, 
-    0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 
-    0xA1, 0x28, 0xA0, 0x23, 0x4E, 0x5E, 0x4E, 0x75, 0x2B, 0x6D, 0xEF, 0x6C, 0xEF, 0x68, 0x20, 0x6D, 
-    0xEF, 0x6C, 0x60, 0x06, 0x21, 0x50, 0x00, 0x08, 0x20, 0x50, 0x20, 0x08, 0x66, 0xF6, 0x4E, 0x75, 
-    0x22, 0x2F, 0x00, 0x04, 0x43, 0xED, 0xEF, 0x68, 0x20, 0x51, 0x20, 0x08, 0x66, 0x04, 0x91, 0xC8, 
-    0x4E, 0x75, 0xB2, 0xA8, 0x00, 0x04, 0x62, 0x06, 0x22, 0xA8, 0x00, 0x08, 0x4E, 0x75, 0x22, 0x48, 
-    0x50, 0x89, 0x60, 0xE4, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 0x28, 0x2E, 
-    0x00, 0x0C, 0x70, 0xFC, 0x26, 0x2E, 0x00, 0x08, 0x56, 0x83, 0xC6, 0x80, 0x2F, 0x03, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xC0, 0x24, 0x48, 0x20, 0x0A, 0x58, 0x4F, 0x66, 0x2A, 0x0C, 0x83, 0x00, 0x00, 
-    0x0F, 0xF8, 0x64, 0x06, 0x26, 0x3C, 0x00, 0x00, 0x0F, 0xF8, 0xB6, 0x84, 0x64, 0x08, 0x70, 0xFC, 
-    0x26, 0x04, 0x56, 0x83, 0xC6, 0x80, 0x20, 0x03, 0x50, 0x80, 0x2F, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0x2C, 0x24, 0x48, 0x58, 0x4F, 0x20, 0x0A, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x10, 0x25, 0x43, 
-    0x00, 0x04, 0x24, 0xAD, 0xEF, 0x6C, 0x2B, 0x4A, 0xEF, 0x6C, 0x20, 0x4A, 0x50, 0x88, 0x4C, 0xDF, 
-    0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4A, 0xAF, 0x00, 0x04, 0x66, 0x04, 0x70, 0x00, 0x4E, 0x75, 
-    0x20, 0x6F, 0x00, 0x04, 0x51, 0x88, 0x20, 0x28, 0x00, 0x04, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x30, 0x24, 0x6D, 0xEF, 0x6C, 0x60, 0x0E, 0x26, 0x52, 0x2F, 0x0A, 0x61, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x18, 0x24, 0x4B, 0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 0x42, 0xAD, 0xEF, 0x68, 
-    0x42, 0xAD, 0xEF, 0x6C, 0x4C, 0xDF, 0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x2B, 0x6F, 0x00, 0x04, 
-    0xEF, 0x78, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6D, 0xEF, 0x70, 0x20, 0x0A, 
-    0x67, 0x08, 0x2B, 0x6A, 0x00, 0x04, 0xEF, 0x70, 0x60, 0x14, 0x4A, 0xAD, 0xEF, 0x78, 0x67, 0x0E, 
-    0x48, 0x78, 0x00, 0x08, 0x20, 0x6D, 0xEF, 0x78, 0x4E, 0x90, 0x24, 0x48, 0x58, 0x4F, 0x20, 0x4A, 
-    0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x30, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x61, 0xFF, 0x00, 0x00, 0x03, 0xAA, 0x26, 0x48, 0x20, 0x0B, 
-    0x50, 0x4F, 0x67, 0x18, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x24, 0x48, 0x20, 0x0A, 0x67, 0x0C, 
-    0x24, 0x8B, 0x25, 0x6D, 0xEF, 0x74, 0x00, 0x04, 0x2B, 0x4A, 0xEF, 0x74, 0x20, 0x4B, 0x4C, 0xDF, 
-    0x0C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x38, 0x28, 0x6E, 
-    0x00, 0x08, 0x47, 0xED, 0xEF, 0x74, 0x24, 0x53, 0x20, 0x0A, 0x67, 0x1A, 0xB9, 0xD2, 0x66, 0x10, 
-    0x26, 0xAA, 0x00, 0x04, 0x25, 0x6D, 0xEF, 0x70, 0x00, 0x04, 0x2B, 0x4A, 0xEF, 0x70, 0x60, 0x06, 
-    0x26, 0x4A, 0x58, 0x8B, 0x60, 0xE0, 0x2F, 0x0C, 0x61, 0xFF, 0x00, 0x00, 0x01, 0x08, 0x58, 0x4F, 
-    0x4C, 0xDF, 0x1C, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6D, 
-    0xEF, 0x74, 0x60, 0x0E, 0x2F, 0x12, 0x61, 0xFF, 0x00, 0x00, 0x00, 0xEA, 0x24, 0x6A, 0x00, 0x04, 
-    0x58, 0x4F, 0x20, 0x0A, 0x66, 0xEE, 0x42, 0xAD, 0xEF, 0x70, 0x42, 0xAD, 0xEF, 0x74, 0x42, 0xAD, 
-    0xEF, 0x78, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x22, 0x5F, 0x20, 0x57, 0x20, 0xAD, 0xE6, 0x60, 
-    0x48, 0xE8, 0xFE, 0xF8, 0x00, 0x04, 0x70, 0x00, 0x4E, 0xD1, 0x58, 0x8F, 0x20, 0x5F, 0x20, 0x17, 
-    0x66, 0x02, 0x70, 0x01, 0x2B, 0x50, 0xE6, 0x60, 0x4C, 0xE8, 0xFE, 0xF8, 0x00, 0x04, 0x4E, 0xD1, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x41, 0xEE, 0xFF, 0xFC, 0x20, 0xB8, 0x02, 0x0C, 0x4A, 0xAE, 0x00, 0x08, 
-    0x67, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x20, 0xAE, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xFB, 0xE8, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x01, 0x1C, 0x14, 0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x30, 0x10, 0x72, 0x03, 
-    0xC0, 0x81, 0x67, 0x04, 0x02, 0x50, 0xFC, 0xFF, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x20, 0x76, 0x00, 0x60, 0x1C, 0x20, 0x03, 0xE5, 0x88, 0x41, 0xED, 0xFC, 0x58, 0x24, 0x70, 
-    0x08, 0x00, 0x20, 0x0A, 0x67, 0x0A, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x18, 0xE6, 0x58, 0x4F, 
-    0x52, 0x83, 0x70, 0x40, 0xB6, 0x80, 0x65, 0xDE, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x4A, 0xAD, 0xEF, 0x80, 0x66, 0x14, 0x70, 0x01, 0x2B, 0x40, 0xEF, 0x80, 
-    0x48, 0x79, 0x00, 0x01, 0x18, 0x8E, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xB6, 0x58, 0x4F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x2F, 0x0A, 
-    0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 0x28, 0x00, 0x30, 0x12, 0x72, 0x40, 0xC0, 0x81, 0x58, 0x4F, 
-    0x67, 0x0C, 0x2F, 0x2A, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x01, 0x36, 0x42, 0x58, 0x4F, 0x42, 0xAA, 
-    0x00, 0x04, 0x4A, 0x6A, 0x00, 0x02, 0x6D, 0x14, 0x30, 0x6A, 0x00, 0x02, 0x2F, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x11, 0x02, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x02, 0x78, 0xFF, 0x4A, 0xAA, 0x00, 0x30, 
-    0x67, 0x22, 0x2F, 0x2A, 0x00, 0x30, 0x4E, 0xB9, 0x00, 0x01, 0x20, 0x90, 0x4A, 0x80, 0x58, 0x4F, 
-    0x67, 0x02, 0x78, 0xFF, 0x2F, 0x2A, 0x00, 0x30, 0x4E, 0xB9, 0x00, 0x01, 0x36, 0x42, 0x42, 0xAA, 
-    0x00, 0x30, 0x58, 0x4F, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x00, 0x80, 0x67, 0x30, 0x76, 0x00, 
-    0x60, 0x1A, 0x20, 0x03, 0xE5, 0x88, 0x41, 0xED, 0xFC, 0x58, 0xB5, 0xF0, 0x08, 0x00, 0x66, 0x0A, 
-    0x20, 0x03, 0xE5, 0x88, 0x42, 0xB0, 0x08, 0x00, 0x60, 0x08, 0x52, 0x83, 0x70, 0x40, 0xB6, 0x80, 
-    0x65, 0xE0, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x36, 0x42, 0x58, 0x4F, 0x60, 0x48, 0x42, 0x52, 
-    0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x0C, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 
-    0x25, 0x48, 0x00, 0x10, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x26, 0x20, 0x4A, 
-    0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x14, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 
-    0x00, 0x2A, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x18, 0x20, 0x4A, 0x41, 0xE8, 
-    0x00, 0x22, 0x25, 0x48, 0x00, 0x1C, 0x20, 0x04, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x20, 0x6F, 0x00, 0x04, 0x08, 0x10, 0x00, 0x00, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0xFF, 
-    0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x08, 0x10, 0x00, 0x01, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0xFF, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x24, 0x6E, 0x00, 0x08, 
-    0x20, 0x0A, 0x66, 0x32, 0x78, 0x00, 0x76, 0x00, 0x60, 0x22, 0x20, 0x03, 0xE5, 0x88, 0x41, 0xED, 
-    0xFC, 0x58, 0x26, 0x70, 0x08, 0x00, 0x20, 0x0B, 0x67, 0x10, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x01, 
-    0x1A, 0x08, 0x4A, 0x80, 0x58, 0x4F, 0x6C, 0x02, 0x78, 0xFF, 0x52, 0x83, 0x70, 0x40, 0xB6, 0x80, 
-    0x6D, 0xD8, 0x20, 0x04, 0x60, 0x72, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x64, 0x26, 0x6A, 0x00, 0x04, 0x60, 0x38, 0x20, 0x6A, 0x00, 0x0C, 0x91, 0xCB, 
-    0x2F, 0x08, 0x2F, 0x0B, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x48, 0x26, 0x00, 0x4A, 0x83, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6E, 0x1A, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x0C, 0x25, 0x6A, 0x00, 0x04, 
-    0x00, 0x14, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x2A, 0x00, 0x52, 0x02, 0x00, 0x70, 0xFF, 0x60, 0x28, 
-    0xD7, 0xC3, 0xB7, 0xEA, 0x00, 0x0C, 0x65, 0xC2, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x0C, 0x30, 0x12, 
-    0x02, 0x80, 0x00, 0x00, 0x40, 0x00, 0x67, 0x08, 0x25, 0x6A, 0x00, 0x08, 0x00, 0x14, 0x60, 0x06, 
-    0x25, 0x6A, 0x00, 0x08, 0x00, 0x2A, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 
-    0xB1, 0xEA, 0x00, 0x18, 0x63, 0x0E, 0x20, 0x6A, 0x00, 0x18, 0x52, 0xAA, 0x00, 0x18, 0x70, 0x00, 
-    0x10, 0x10, 0x60, 0x38, 0x4A, 0xAA, 0x00, 0x22, 0x67, 0x0A, 0x25, 0x6A, 0x00, 0x22, 0x00, 0x10, 
-    0x42, 0xAA, 0x00, 0x22, 0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 0x00, 0x10, 0x65, 0x12, 0x2F, 0x0A, 
-    0x4E, 0xB9, 0x00, 0x01, 0x25, 0x22, 0x4A, 0x80, 0x58, 0x4F, 0x6E, 0x04, 0x70, 0xFF, 0x60, 0x0C, 
-    0x20, 0x6A, 0x00, 0x0C, 0x52, 0xAA, 0x00, 0x0C, 0x70, 0x00, 0x10, 0x10, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x76, 0x00, 0x60, 0x52, 0x20, 0x03, 
-    0xE5, 0x88, 0x41, 0xED, 0xFC, 0x58, 0x4A, 0xB0, 0x08, 0x00, 0x66, 0x28, 0x48, 0x78, 0x00, 0x38, 
-    0x4E, 0xB9, 0x00, 0x01, 0x37, 0xD4, 0x24, 0x48, 0x20, 0x0A, 0x58, 0x4F, 0x66, 0x04, 0x91, 0xC8, 
-    0x60, 0x54, 0x20, 0x03, 0xE5, 0x88, 0x41, 0xED, 0xFC, 0x58, 0x21, 0x8A, 0x08, 0x00, 0x34, 0xBC, 
-    0x00, 0x80, 0x60, 0x22, 0x20, 0x03, 0xE5, 0x88, 0x20, 0x70, 0x08, 0x00, 0x4A, 0x50, 0x66, 0x0E, 
-    0x20, 0x03, 0xE5, 0x88, 0x41, 0xED, 0xFC, 0x58, 0x24, 0x70, 0x08, 0x00, 0x60, 0x08, 0x52, 0x83, 
-    0x70, 0x40, 0xB6, 0x80, 0x65, 0xA8, 0x70, 0x40, 0xB6, 0x80, 0x65, 0x04, 0x91, 0xC8, 0x60, 0x16, 
-    0x42, 0x67, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 
-    0x23, 0xFC, 0x4F, 0xEF, 0x00, 0x0E, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x01, 0x1F, 0x24, 0xB0, 0xAE, 0x00, 0x10, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x20, 0x6E, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x41, 0xEE, 0x00, 0x0C, 0x58, 0x88, 0x2D, 0x48, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0x00, 0x01, 0x1B, 0xB2, 0x4E, 0xB9, 
-    0x00, 0x01, 0x2C, 0xBC, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x24, 0x6E, 0x00, 0x0C, 0x16, 0x2E, 0x00, 0x0B, 
-    0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 0x00, 0x14, 0x65, 0x12, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 
-    0x27, 0x64, 0x4A, 0x80, 0x58, 0x4F, 0x6C, 0x04, 0x70, 0xFF, 0x60, 0x3A, 0x20, 0x6A, 0x00, 0x0C, 
-    0x52, 0xAA, 0x00, 0x0C, 0x10, 0x83, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x66, 0x10, 
-    0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x67, 0x18, 0x0C, 0x03, 0x00, 0x0D, 0x66, 0x12, 
-    0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x04, 0x70, 0xFF, 
-    0x60, 0x04, 0x70, 0x00, 0x10, 0x03, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x24, 0x6E, 0x00, 0x0C, 0x60, 0x00, 
-    0x00, 0x9E, 0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 0x00, 0x14, 0x65, 0x14, 0x2F, 0x0A, 0x4E, 0xB9, 
-    0x00, 0x01, 0x27, 0x64, 0x4A, 0x80, 0x58, 0x4F, 0x6C, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xAA, 
-    0x08, 0x12, 0x00, 0x02, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x0E, 0x48, 0x78, 0x00, 0x0D, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3D, 0x56, 0x50, 0x4F, 0x28, 0x48, 0x20, 0x0C, 0x4A, 0x80, 0x66, 0x0C, 
-    0x20, 0x4B, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x60, 0x08, 0x20, 0x4C, 0x91, 0xCB, 
-    0x52, 0x88, 0x20, 0x08, 0x26, 0x00, 0x20, 0x6A, 0x00, 0x14, 0x91, 0xEA, 0x00, 0x0C, 0x28, 0x08, 
-    0xB8, 0x83, 0x64, 0x04, 0x99, 0xCC, 0x26, 0x04, 0x20, 0x6A, 0x00, 0x0C, 0x22, 0x4B, 0x22, 0x03, 
-    0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xD7, 0xC3, 0xD7, 0xAA, 
-    0x00, 0x0C, 0x20, 0x0C, 0x67, 0x18, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x0A, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x14, 0x70, 0xFF, 0x60, 0x2A, 0x4A, 0x13, 
-    0x66, 0x00, 0xFF, 0x60, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x67, 0x18, 0x25, 0x6A, 
-    0x00, 0x04, 0x00, 0x14, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 0x4A, 0x80, 0x58, 0x4F, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1E, 0x30, 0x2A, 0x2E, 0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x10, 
-    0x24, 0x6E, 0x00, 0x14, 0x20, 0x05, 0x22, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x26, 0x00, 
-    0x26, 0x6E, 0x00, 0x08, 0x4A, 0x83, 0x66, 0x12, 0x70, 0x00, 0x60, 0x00, 0x00, 0x8C, 0x20, 0x6A, 
-    0x00, 0x18, 0x52, 0xAA, 0x00, 0x18, 0x16, 0xD0, 0x53, 0x83, 0x4A, 0x83, 0x67, 0x62, 0x20, 0x4A, 
-    0x41, 0xE8, 0x00, 0x36, 0xB1, 0xEA, 0x00, 0x18, 0x62, 0xE4, 0x60, 0x54, 0x4A, 0xAA, 0x00, 0x22, 
-    0x67, 0x0A, 0x25, 0x6A, 0x00, 0x22, 0x00, 0x10, 0x42, 0xAA, 0x00, 0x22, 0x20, 0x6A, 0x00, 0x0C, 
-    0xB1, 0xEA, 0x00, 0x10, 0x65, 0x0E, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x25, 0x22, 0x4A, 0x80, 
-    0x58, 0x4F, 0x6F, 0x30, 0x20, 0x6A, 0x00, 0x10, 0x91, 0xEA, 0x00, 0x0C, 0x28, 0x08, 0xB6, 0x84, 
-    0x64, 0x02, 0x28, 0x03, 0x20, 0x4B, 0x22, 0x6A, 0x00, 0x0C, 0x22, 0x04, 0x20, 0x08, 0x4A, 0x81, 
-    0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xD7, 0xC4, 0x96, 0x84, 0xD9, 0xAA, 0x00, 0x0C, 
-    0x4A, 0x83, 0x66, 0xA8, 0x20, 0x05, 0x22, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x90, 0x83, 
-    0x22, 0x05, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x7C, 0x4C, 0xDF, 0x0C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFE, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x10, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0x80, 0x3D, 0x40, 0xFF, 0xFE, 0x02, 0x52, 0xFF, 0x7F, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 
-    0x18, 0xE6, 0x34, 0xAE, 0xFF, 0xFE, 0x42, 0x67, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 0x23, 0xFC, 0x4F, 0xEF, 0x00, 0x12, 0x24, 0x5F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x1E, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x10, 0x4A, 0x86, 0x66, 0x78, 0x48, 0x78, 0x00, 0x02, 0x42, 0xA7, 
-    0x42, 0xA7, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x26, 0x2E, 0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x6C, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1F, 0x10, 
-    0x26, 0x00, 0xBA, 0x83, 0x58, 0x4F, 0x6F, 0x4A, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x18, 0x7C, 
-    0x28, 0x05, 0x98, 0x83, 0x48, 0x78, 0x01, 0x00, 0x42, 0xA7, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xB9, 
-    0x00, 0x01, 0x3C, 0x90, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x24, 0x26, 0x3C, 0x00, 0x00, 0x01, 0x00, 
-    0xB6, 0x84, 0x6F, 0x02, 0x26, 0x04, 0x2F, 0x0A, 0x2F, 0x03, 0x48, 0x78, 0x00, 0x01, 0x48, 0x6E, 
-    0xFF, 0x00, 0x4E, 0xB9, 0x00, 0x01, 0x1F, 0x24, 0x98, 0x83, 0x4F, 0xEF, 0x00, 0x10, 0x4A, 0x84, 
-    0x6E, 0xD8, 0x2F, 0x06, 0x2F, 0x05, 0x42, 0xA7, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x26, 0x2E, 
-    0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xDF, 0x04, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x42, 0xA7, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xC2, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x38, 0x2A, 0x2E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x10, 
-    0x24, 0x6E, 0x00, 0x14, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x05, 0x22, 0x07, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x4A, 0x26, 0x00, 0x4A, 0x83, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xD6, 0x4A, 0x85, 
-    0x66, 0x00, 0x00, 0x9C, 0x20, 0x07, 0x60, 0x00, 0x00, 0xCA, 0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 
-    0x00, 0x14, 0x65, 0x10, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x27, 0x64, 0x4A, 0x80, 0x58, 0x4F, 
-    0x6D, 0x00, 0x00, 0x82, 0x08, 0x12, 0x00, 0x02, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x12, 0x2F, 0x03, 
-    0x48, 0x78, 0x00, 0x0D, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x01, 0x3C, 0x1E, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x28, 0x48, 0x20, 0x0C, 0x4A, 0x80, 0x66, 0x04, 0x20, 0x03, 0x60, 0x08, 0x20, 0x4C, 0x91, 0xCB, 
-    0x52, 0x88, 0x20, 0x08, 0x28, 0x00, 0x20, 0x6A, 0x00, 0x14, 0x91, 0xEA, 0x00, 0x0C, 0x2C, 0x08, 
-    0xBC, 0x84, 0x64, 0x04, 0x99, 0xCC, 0x28, 0x06, 0x20, 0x6A, 0x00, 0x0C, 0x22, 0x4B, 0x22, 0x04, 
-    0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xD7, 0xC4, 0x96, 0x84, 
-    0xD9, 0xAA, 0x00, 0x0C, 0x20, 0x0C, 0x67, 0x16, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x08, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x14, 0x60, 0x06, 0x4A, 0x83, 
-    0x66, 0x00, 0xFF, 0x68, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x08, 0x00, 0x67, 0x10, 0x25, 0x6A, 
-    0x00, 0x04, 0x00, 0x14, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x1A, 0x08, 0x58, 0x4F, 0x20, 0x05, 
-    0x22, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x90, 0x83, 0x22, 0x05, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x7C, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 
-    0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x78, 0x00, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x01, 0x1F, 0x24, 0xB0, 0xAE, 0x00, 0x10, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x04, 0x91, 0xC8, 
-    0x60, 0x04, 0x20, 0x6E, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x41, 0xEE, 
-    0x00, 0x08, 0x58, 0x88, 0x2D, 0x48, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x6D, 0xFB, 0xE8, 0x48, 0x79, 0x00, 0x01, 0x20, 0x2E, 0x4E, 0xB9, 0x00, 0x01, 0x2C, 0xBC, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x18, 0xA4, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x1C, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x2A, 0x2E, 0x00, 0x10, 0x26, 0x2E, 
-    0x00, 0x14, 0x26, 0x6E, 0x00, 0x0C, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x30, 0x00, 0x67, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0xB6, 0x4A, 0x85, 0x67, 0x20, 0x70, 0x01, 0xBA, 0x80, 0x67, 0x12, 
-    0x70, 0x02, 0xBA, 0x80, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x08, 0x00, 
-    0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x60, 0x02, 0x70, 0x00, 0x28, 0x00, 0x70, 0xFF, 
-    0xB8, 0x80, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x82, 0x4A, 0x83, 0x66, 0x0A, 0x26, 0x4A, 
-    0x47, 0xEB, 0x00, 0x36, 0x76, 0x01, 0x60, 0x0E, 0x0C, 0x83, 0x7F, 0xFF, 0xFF, 0xFF, 0x63, 0x06, 
-    0x26, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x20, 0x0B, 0x66, 0x18, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 
-    0x37, 0xD4, 0x26, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4C, 0x70, 0x40, 
-    0x88, 0x80, 0x30, 0x12, 0x72, 0x40, 0xC0, 0x81, 0x67, 0x10, 0x2F, 0x2A, 0x00, 0x04, 0x4E, 0xB9, 
-    0x00, 0x01, 0x36, 0x42, 0x02, 0x52, 0xFF, 0xBF, 0x58, 0x4F, 0x70, 0x00, 0x30, 0x12, 0x02, 0x80, 
-    0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x84, 0x34, 0x80, 0x25, 0x4B, 0x00, 0x04, 0x20, 0x4B, 0xD1, 0xC3, 
-    0x25, 0x48, 0x00, 0x08, 0x25, 0x4B, 0x00, 0x0C, 0x25, 0x4B, 0x00, 0x10, 0x25, 0x4B, 0x00, 0x26, 
-    0x25, 0x4B, 0x00, 0x14, 0x25, 0x4B, 0x00, 0x2A, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x38, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x6E, 0x00, 0x0C, 0x22, 0x2E, 
-    0x00, 0x10, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0x20, 0x40, 
-    0xD1, 0xEE, 0x00, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x30, 
-    0x26, 0x6E, 0x00, 0x08, 0x45, 0xEE, 0x00, 0x0C, 0x58, 0x8A, 0x2F, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x0B, 0x48, 0x79, 0x00, 0x01, 0x21, 0x86, 0x4E, 0xB9, 0x00, 0x01, 0x2C, 0xBC, 0x26, 0x00, 
-    0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x10, 0x6D, 0x04, 0x42, 0x33, 0x38, 0x00, 0x20, 0x03, 0x4C, 0xDF, 
-    0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x22, 0x6F, 0x00, 0x08, 0x70, 0xFF, 0xB0, 0xAF, 0x00, 0x04, 
-    0x67, 0x18, 0x20, 0x49, 0x41, 0xE8, 0x00, 0x34, 0xB1, 0xE9, 0x00, 0x18, 0x64, 0x0C, 0x30, 0x11, 
-    0x02, 0x80, 0x00, 0x00, 0xA0, 0x01, 0x53, 0x80, 0x67, 0x04, 0x70, 0xFF, 0x4E, 0x75, 0x70, 0x00, 
-    0x30, 0x11, 0x02, 0x80, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x50, 0x00, 0x32, 0x80, 
-    0x4A, 0xA9, 0x00, 0x22, 0x66, 0x0C, 0x23, 0x69, 0x00, 0x10, 0x00, 0x22, 0x23, 0x69, 0x00, 0x04, 
-    0x00, 0x10, 0x53, 0xA9, 0x00, 0x18, 0x20, 0x69, 0x00, 0x18, 0x10, 0xAF, 0x00, 0x07, 0x70, 0x00, 
-    0x10, 0x2F, 0x00, 0x07, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x6E, 
-    0x00, 0x0C, 0x22, 0x2E, 0x00, 0x10, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 
-    0x66, 0xFA, 0x20, 0x40, 0xD1, 0xEE, 0x00, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x03, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 
-    0x00, 0x01, 0x22, 0x4A, 0x4E, 0xB9, 0x00, 0x01, 0x2C, 0xBC, 0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 
-    0x00, 0x10, 0x6D, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x42, 0x30, 0x38, 0x00, 0x20, 0x03, 0x26, 0x1F, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x08, 0xB1, 0xEF, 0x00, 0x0C, 0x65, 0x04, 0x70, 0x00, 
-    0x60, 0x0A, 0x20, 0x6F, 0x00, 0x0C, 0x91, 0xEF, 0x00, 0x08, 0x20, 0x08, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x10, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x48, 0x78, 
-    0x00, 0x01, 0x42, 0xA7, 0x30, 0x6A, 0x00, 0x02, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x18, 0x56, 
-    0x26, 0x00, 0x30, 0x12, 0x72, 0x03, 0xC0, 0x81, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0x70, 0xFF, 
-    0xB6, 0x80, 0x66, 0x0C, 0x70, 0x23, 0x2B, 0x40, 0xEF, 0x7C, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x94, 
-    0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x18, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x2A, 
-    0x00, 0x04, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 0xD6, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x5E, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x54, 0x2F, 0x2A, 0x00, 0x26, 
-    0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x4A, 0xAA, 0x00, 0x22, 0x66, 0x06, 0x20, 0x6A, 0x00, 0x10, 0x60, 0x04, 0x20, 0x6A, 0x00, 0x22, 
-    0x48, 0x50, 0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x48, 0x6A, 0x00, 0x36, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 
-    0x22, 0xA8, 0xD0, 0xAE, 0xFF, 0xFC, 0xD0, 0xAE, 0xFF, 0xF8, 0x96, 0x80, 0x4F, 0xEF, 0x00, 0x24, 
-    0x20, 0x0B, 0x66, 0x04, 0x20, 0x03, 0x60, 0x0A, 0x26, 0x83, 0x37, 0x6A, 0x00, 0x2E, 0x00, 0x04, 
-    0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x18, 0x00, 0x28, 0x2E, 0x00, 0x0C, 0x70, 0x03, 0xC0, 0x84, 0xE5, 0x88, 0x41, 0xED, 0xFD, 0x58, 
-    0x26, 0x30, 0x08, 0x00, 0x70, 0x04, 0xC0, 0x84, 0x67, 0x04, 0x70, 0x08, 0x86, 0x80, 0x70, 0x08, 
-    0xC0, 0x84, 0x67, 0x06, 0x00, 0x83, 0x00, 0x00, 0x02, 0x00, 0x70, 0x10, 0xC0, 0x84, 0x67, 0x06, 
-    0x00, 0x83, 0x00, 0x00, 0x01, 0x00, 0x70, 0x20, 0xC0, 0x84, 0x67, 0x06, 0x00, 0x83, 0x00, 0x00, 
-    0x08, 0x00, 0x2F, 0x03, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x10, 0x7E, 0x50, 0x4F, 
-    0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 
-    0x26, 0x6E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x38, 0x2E, 0x00, 0x14, 0x36, 0x12, 0x02, 0x83, 
-    0x00, 0x00, 0x00, 0x80, 0x41, 0xED, 0xFD, 0x68, 0x43, 0xD2, 0x70, 0x0D, 0x22, 0xD8, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x0C, 0x20, 0x4A, 0x41, 0xE8, 
-    0x00, 0x36, 0x25, 0x48, 0x00, 0x10, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x26, 
-    0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x14, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 
-    0x25, 0x48, 0x00, 0x2A, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x18, 0x20, 0x4A, 
-    0x41, 0xE8, 0x00, 0x22, 0x25, 0x48, 0x00, 0x1C, 0x0C, 0x13, 0x00, 0x72, 0x67, 0x18, 0x0C, 0x13, 
-    0x00, 0x77, 0x67, 0x0E, 0x0C, 0x13, 0x00, 0x61, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x16, 
-    0x60, 0x02, 0x70, 0x1A, 0x60, 0x02, 0x70, 0x01, 0x72, 0x00, 0x32, 0x03, 0x82, 0x80, 0x34, 0x81, 
-    0x30, 0x12, 0x72, 0x03, 0xC0, 0x81, 0x66, 0x30, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x18, 0xE6, 
-    0x91, 0xC8, 0x58, 0x4F, 0x60, 0x70, 0x0C, 0x13, 0x00, 0x62, 0x66, 0x0E, 0x30, 0x12, 0x72, 0x20, 
-    0xC0, 0x81, 0x66, 0x22, 0x00, 0x52, 0x00, 0x20, 0x60, 0x0E, 0x30, 0x12, 0x72, 0x03, 0xC0, 0x81, 
-    0x57, 0x80, 0x67, 0x12, 0x00, 0x52, 0x00, 0x03, 0x52, 0x8B, 0x0C, 0x13, 0x00, 0x62, 0x67, 0xD6, 
-    0x0C, 0x13, 0x00, 0x2B, 0x67, 0xD0, 0x4A, 0x44, 0x67, 0x06, 0x35, 0x44, 0x00, 0x02, 0x60, 0x1A, 
-    0x2F, 0x0B, 0x70, 0x00, 0x30, 0x12, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 
-    0x23, 0x9E, 0x35, 0x40, 0x00, 0x02, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x6A, 0x00, 0x02, 0x6C, 0x0E, 
-    0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x18, 0xE6, 0x91, 0xC8, 0x58, 0x4F, 0x60, 0x08, 0x4E, 0xB9, 
-    0x00, 0x01, 0x18, 0xC4, 0x20, 0x4A, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x20, 0x24, 0x6E, 0x00, 0x08, 0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 
-    0x00, 0x10, 0x64, 0x06, 0x70, 0x01, 0x60, 0x00, 0x00, 0xEA, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 
-    0x01, 0x00, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xDA, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 
-    0xA0, 0x01, 0x53, 0x80, 0x67, 0x1C, 0x08, 0x12, 0x00, 0x07, 0x66, 0x08, 0x20, 0x3C, 0x00, 0x00, 
-    0x42, 0x00, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x81, 0x52, 0x70, 0xFF, 0x60, 0x00, 
-    0x00, 0xB2, 0x4A, 0xAA, 0x00, 0x04, 0x66, 0x46, 0x48, 0x78, 0x10, 0x00, 0x4E, 0xB9, 0x00, 0x01, 
-    0x37, 0xD4, 0x25, 0x48, 0x00, 0x04, 0x20, 0x08, 0x58, 0x4F, 0x66, 0x16, 0x20, 0x4A, 0x41, 0xE8, 
-    0x00, 0x36, 0x25, 0x48, 0x00, 0x04, 0x20, 0x6A, 0x00, 0x04, 0x52, 0x88, 0x25, 0x48, 0x00, 0x08, 
-    0x60, 0x1C, 0x00, 0x52, 0x00, 0x40, 0x20, 0x6A, 0x00, 0x04, 0x41, 0xE8, 0x10, 0x00, 0x25, 0x48, 
-    0x00, 0x08, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x26, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x2A, 0x25, 0x6A, 
-    0x00, 0x04, 0x00, 0x0C, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x10, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x14, 
-    0x20, 0x6A, 0x00, 0x08, 0x91, 0xEA, 0x00, 0x04, 0x2F, 0x08, 0x2F, 0x2A, 0x00, 0x04, 0x2F, 0x0A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x05, 0x66, 0x26, 0x00, 0x4A, 0x83, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x08, 
-    0x00, 0x52, 0x42, 0x00, 0x70, 0xFF, 0x60, 0x2A, 0x4A, 0x83, 0x66, 0x1C, 0x70, 0x00, 0x30, 0x12, 
-    0x02, 0x80, 0xFF, 0xFF, 0xEF, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 
-    0x40, 0x00, 0x34, 0x80, 0x70, 0x00, 0x60, 0x0A, 0x00, 0x52, 0x50, 0x00, 0xD7, 0xAA, 0x00, 0x10, 
-    0x70, 0x01, 0x4C, 0xDF, 0x04, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x18, 0x30, 0x24, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 0x28, 0x2E, 
-    0x00, 0x14, 0x30, 0x12, 0x72, 0x03, 0xC0, 0x81, 0x67, 0x0E, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 
-    0x1A, 0x08, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0C, 0x70, 0x23, 0x2B, 0x40, 0xEF, 0x7C, 0x70, 0xFF, 
-    0x60, 0x00, 0x00, 0xF6, 0x20, 0x0B, 0x67, 0x02, 0xD6, 0x93, 0x70, 0x01, 0xB8, 0x80, 0x66, 0x5E, 
-    0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x67, 0x54, 0x2F, 0x2A, 0x00, 0x26, 0x2F, 0x2A, 
-    0x00, 0x0C, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 0x2D, 0x40, 0xFF, 0xF8, 0x4A, 0xAA, 
-    0x00, 0x22, 0x66, 0x06, 0x20, 0x6A, 0x00, 0x10, 0x60, 0x04, 0x20, 0x6A, 0x00, 0x22, 0x48, 0x50, 
-    0x2F, 0x2A, 0x00, 0x0C, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x48, 0x6A, 0x00, 0x36, 0x2F, 0x2A, 0x00, 0x18, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x22, 0xA8, 
-    0xD0, 0xAE, 0xFF, 0xFC, 0xD0, 0xAE, 0xFF, 0xF8, 0x96, 0x80, 0x4F, 0xEF, 0x00, 0x24, 0x70, 0x01, 
-    0xB8, 0x80, 0x66, 0x04, 0x4A, 0x83, 0x66, 0x0A, 0x4A, 0x84, 0x66, 0x06, 0x70, 0xFF, 0xB6, 0x80, 
-    0x67, 0x16, 0x2F, 0x04, 0x2F, 0x03, 0x30, 0x6A, 0x00, 0x02, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x18, 0x56, 0x26, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0xB6, 0x80, 0x66, 0x0A, 0x70, 0x23, 
-    0x2B, 0x40, 0xEF, 0x7C, 0x70, 0xFF, 0x60, 0x50, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x30, 0x00, 
-    0x67, 0x36, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x0C, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x10, 0x25, 0x6A, 
-    0x00, 0x04, 0x00, 0x26, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x14, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x2A, 
-    0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 0x00, 0x18, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x22, 
-    0x25, 0x48, 0x00, 0x1C, 0x42, 0xAA, 0x00, 0x22, 0x20, 0x0B, 0x67, 0x06, 0x35, 0x6B, 0x00, 0x04, 
-    0x00, 0x2E, 0x02, 0x52, 0xCE, 0xFF, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x24, 0x6E, 0x00, 0x08, 0x20, 0x6A, 0x00, 0x0C, 0xB1, 0xEA, 
-    0x00, 0x14, 0x64, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xBC, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 
-    0x60, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x60, 0x00, 0x66, 0x0E, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 
-    0x1A, 0x08, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x9E, 0x30, 0x12, 0x02, 0x80, 0x00, 0x00, 0x90, 0x02, 
-    0x55, 0x80, 0x67, 0x1A, 0x08, 0x12, 0x00, 0x07, 0x66, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x42, 0x00, 
-    0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x81, 0x52, 0x70, 0xFF, 0x60, 0x76, 0x4A, 0xAA, 
-    0x00, 0x04, 0x66, 0x52, 0x48, 0x78, 0x10, 0x00, 0x4E, 0xB9, 0x00, 0x01, 0x37, 0xD4, 0x25, 0x48, 
-    0x00, 0x04, 0x20, 0x08, 0x58, 0x4F, 0x66, 0x1C, 0x20, 0x4A, 0x41, 0xE8, 0x00, 0x36, 0x25, 0x48, 
-    0x00, 0x04, 0x20, 0x6A, 0x00, 0x04, 0x52, 0x88, 0x25, 0x48, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 
-    0x18, 0xC4, 0x60, 0x22, 0x00, 0x52, 0x00, 0x40, 0x20, 0x6A, 0x00, 0x04, 0x41, 0xE8, 0x10, 0x00, 
-    0x25, 0x48, 0x00, 0x08, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x26, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x2A, 
-    0x4E, 0xB9, 0x00, 0x01, 0x18, 0xC4, 0x25, 0x6A, 0x00, 0x04, 0x00, 0x0C, 0x25, 0x6A, 0x00, 0x04, 
-    0x00, 0x10, 0x25, 0x6A, 0x00, 0x08, 0x00, 0x14, 0x00, 0x52, 0x60, 0x00, 0x4E, 0xB9, 0x00, 0x01, 
-    0x18, 0xC4, 0x70, 0x00, 0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFE, 0xD8, 0x48, 0xE7, 
-    0x1F, 0x38, 0x24, 0x6E, 0x00, 0x08, 0x18, 0x2E, 0x00, 0x0C, 0x2D, 0x52, 0xFE, 0xD8, 0x2D, 0x6A, 
-    0x00, 0x04, 0xFE, 0xDC, 0x3D, 0x6A, 0x00, 0x08, 0xFE, 0xE0, 0x26, 0x6A, 0x00, 0x12, 0x76, 0x00, 
-    0x7C, 0x00, 0x4A, 0xAA, 0x00, 0x2E, 0x6C, 0x08, 0x70, 0x06, 0x25, 0x40, 0x00, 0x2E, 0x60, 0x18, 
-    0x4A, 0xAA, 0x00, 0x2E, 0x66, 0x12, 0x0C, 0x04, 0x00, 0x67, 0x67, 0x06, 0x0C, 0x04, 0x00, 0x47, 
-    0x66, 0x06, 0x70, 0x01, 0x25, 0x40, 0x00, 0x2E, 0x70, 0x13, 0xB0, 0xAA, 0x00, 0x2E, 0x6C, 0x06, 
-    0x70, 0x13, 0x25, 0x40, 0x00, 0x2E, 0x3D, 0x6A, 0x00, 0x30, 0xFE, 0xFE, 0x10, 0x04, 0x48, 0x80, 
-    0x48, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x70, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 
-    0x00, 0x67, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x47, 0x00, 0x18, 
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x66, 0x00, 0x12, 0x00, 0x00, 0x00, 0x67, 
-    0x00, 0x06, 0x52, 0x6E, 0xFE, 0xFE, 0x42, 0x2E, 0xFE, 0xFC, 0x60, 0x06, 0x1D, 0x7C, 0x00, 0x01, 
-    0xFE, 0xFC, 0x48, 0x6E, 0xFE, 0xE2, 0x2F, 0x2E, 0xFE, 0xDE, 0x2F, 0x2E, 0xFE, 0xDA, 0x3F, 0x2E, 
-    0xFE, 0xD8, 0x48, 0x6E, 0xFE, 0xFC, 0x4E, 0xB9, 0x00, 0x01, 0x47, 0x02, 0x42, 0x2E, 0xFE, 0xE2, 
-    0x48, 0x6E, 0xFF, 0x01, 0x48, 0x6E, 0xFE, 0xE2, 0x48, 0x6E, 0xFE, 0xFC, 0x4E, 0xB9, 0x00, 0x01, 
-    0x47, 0x2E, 0x41, 0xEE, 0xFF, 0x01, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x1D, 0x40, 
-    0xFF, 0x00, 0x0C, 0x04, 0x00, 0x67, 0x4F, 0xEF, 0x00, 0x1E, 0x67, 0x08, 0x0C, 0x04, 0x00, 0x47, 
-    0x66, 0x00, 0x00, 0xB4, 0x7A, 0x00, 0x7E, 0x01, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0x00, 0x49, 0xEE, 
-    0xFF, 0x00, 0xD8, 0xC0, 0x60, 0x24, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x72, 0xD0, 0xD0, 0x81, 
-    0x22, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0xD0, 0x85, 0xDA, 0x80, 0x53, 0x8C, 0x20, 0x07, 
-    0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x2E, 0x00, 0x0C, 0x14, 0x00, 0x65, 0x67, 0x0C, 
-    0x0C, 0x14, 0x00, 0x2B, 0x67, 0x06, 0x0C, 0x14, 0x00, 0x2D, 0x66, 0xCA, 0x0C, 0x14, 0x00, 0x2D, 
-    0x66, 0x02, 0x44, 0x85, 0x70, 0xFC, 0xBA, 0x80, 0x6D, 0x5C, 0xBA, 0xAA, 0x00, 0x2E, 0x6C, 0x56, 
-    0x1D, 0x7C, 0x00, 0x01, 0xFE, 0xFC, 0x20, 0x2A, 0x00, 0x2E, 0x90, 0x85, 0x53, 0x80, 0x3D, 0x40, 
-    0xFE, 0xFE, 0x48, 0x6E, 0xFE, 0xE2, 0x2F, 0x2E, 0xFE, 0xDE, 0x2F, 0x2E, 0xFE, 0xDA, 0x3F, 0x2E, 
-    0xFE, 0xD8, 0x48, 0x6E, 0xFE, 0xFC, 0x4E, 0xB9, 0x00, 0x01, 0x47, 0x02, 0x42, 0x2E, 0xFE, 0xE2, 
-    0x48, 0x6E, 0xFF, 0x01, 0x48, 0x6E, 0xFE, 0xE2, 0x48, 0x6E, 0xFE, 0xFC, 0x4E, 0xB9, 0x00, 0x01, 
-    0x47, 0x2E, 0x41, 0xEE, 0xFF, 0x01, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x1D, 0x40, 
-    0xFF, 0x00, 0x4F, 0xEF, 0x00, 0x1E, 0x0C, 0x2E, 0x00, 0x20, 0xFF, 0x01, 0x57, 0xC0, 0x44, 0x00, 
-    0x48, 0x80, 0x48, 0xC0, 0x52, 0x80, 0x2A, 0x00, 0x60, 0x00, 0x00, 0x9C, 0x41, 0xEE, 0xFF, 0x00, 
-    0x0C, 0x30, 0x00, 0x65, 0x58, 0x00, 0x67, 0x14, 0x0C, 0x30, 0x00, 0x2E, 0x58, 0x00, 0x66, 0x02, 
-    0x7C, 0x01, 0x41, 0xEE, 0xFF, 0x00, 0x16, 0xF0, 0x58, 0x00, 0x60, 0x76, 0x30, 0x2A, 0x00, 0x3A, 
-    0x72, 0x08, 0xC0, 0x81, 0x66, 0x26, 0x0C, 0x04, 0x00, 0x47, 0x67, 0x0C, 0x0C, 0x04, 0x00, 0x67, 
-    0x66, 0x1A, 0x60, 0x04, 0x53, 0x8B, 0x53, 0x83, 0x0C, 0x2B, 0x00, 0x30, 0xFF, 0xFF, 0x67, 0xF4, 
-    0x0C, 0x2B, 0x00, 0x2E, 0xFF, 0xFF, 0x66, 0x04, 0x53, 0x8B, 0x53, 0x83, 0x4A, 0xAA, 0x00, 0x2E, 
-    0x66, 0x10, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x06, 0x16, 0xFC, 0x00, 0x2E, 
-    0x52, 0x83, 0x0C, 0x04, 0x00, 0x47, 0x67, 0x0A, 0x0C, 0x04, 0x00, 0x45, 0x67, 0x04, 0x70, 0x65, 
-    0x60, 0x02, 0x70, 0x45, 0x16, 0xC0, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0x00, 0x90, 0x85, 0x55, 0x80, 
-    0x66, 0x10, 0x52, 0x85, 0x41, 0xEE, 0xFF, 0x00, 0x16, 0xF0, 0x58, 0x00, 0x16, 0xFC, 0x00, 0x30, 
-    0x54, 0x83, 0x52, 0x83, 0x52, 0x85, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0x00, 0xBA, 0x80, 0x6F, 0x00, 
-    0xFF, 0x5C, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x66, 0x48, 0x0C, 0x04, 0x00, 0x47, 
-    0x67, 0x06, 0x0C, 0x04, 0x00, 0x67, 0x66, 0x3C, 0x0C, 0x2E, 0x00, 0x01, 0xFE, 0xFC, 0x66, 0x34, 
-    0x4A, 0x86, 0x67, 0x30, 0x0C, 0x2B, 0x00, 0x2E, 0xFF, 0xFF, 0x66, 0x06, 0x53, 0x8B, 0x53, 0x83, 
-    0x60, 0x22, 0x0C, 0x2B, 0x00, 0x30, 0xFF, 0xFF, 0x66, 0x1A, 0x60, 0x04, 0x53, 0x8B, 0x53, 0x83, 
-    0x0C, 0x2B, 0x00, 0x30, 0xFF, 0xFF, 0x67, 0xF4, 0x0C, 0x2B, 0x00, 0x2E, 0xFF, 0xFF, 0x66, 0x04, 
-    0x53, 0x8B, 0x53, 0x83, 0x4A, 0xAA, 0x00, 0x2E, 0x67, 0x08, 0x70, 0x01, 0xB0, 0xAA, 0x00, 0x2E, 
-    0x66, 0x1C, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x12, 0x0C, 0x2E, 0x00, 0x01, 
-    0xFE, 0xFC, 0x66, 0x0A, 0x4A, 0x86, 0x66, 0x06, 0x16, 0xFC, 0x00, 0x2E, 0x52, 0x83, 0x25, 0x43, 
-    0x00, 0x1E, 0x20, 0x6A, 0x00, 0x12, 0x42, 0x30, 0x38, 0x00, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x14, 
-    0xC0, 0x81, 0x72, 0x10, 0xB0, 0x81, 0x66, 0x18, 0x20, 0x2A, 0x00, 0x36, 0x90, 0x83, 0x90, 0xAA, 
-    0x00, 0x16, 0x25, 0x40, 0x00, 0x1A, 0x4A, 0xAA, 0x00, 0x1A, 0x6C, 0x04, 0x42, 0xAA, 0x00, 0x1A, 
-    0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xD8, 0x48, 0xE7, 0x1E, 0x30, 
-    0x24, 0x6E, 0x00, 0x08, 0x1C, 0x2E, 0x00, 0x0C, 0x0C, 0x06, 0x00, 0x58, 0x67, 0x06, 0x41, 0xED, 
-    0xFD, 0xA0, 0x60, 0x04, 0x41, 0xED, 0xFD, 0xB2, 0x26, 0x48, 0x0C, 0x06, 0x00, 0x6F, 0x67, 0x14, 
-    0x0C, 0x06, 0x00, 0x78, 0x67, 0x06, 0x0C, 0x06, 0x00, 0x58, 0x66, 0x04, 0x70, 0x10, 0x60, 0x02, 
-    0x70, 0x0A, 0x60, 0x02, 0x70, 0x08, 0x28, 0x00, 0x76, 0x18, 0x2A, 0x12, 0x0C, 0x06, 0x00, 0x64, 
-    0x67, 0x06, 0x0C, 0x06, 0x00, 0x69, 0x66, 0x06, 0x4A, 0x92, 0x6C, 0x02, 0x44, 0x85, 0x4A, 0x85, 
-    0x66, 0x0C, 0x4A, 0xAA, 0x00, 0x2E, 0x66, 0x06, 0x70, 0x08, 0xB8, 0x80, 0x66, 0x16, 0x20, 0x05, 
-    0x22, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xFC, 0x53, 0x83, 0x41, 0xEE, 0xFF, 0xE8, 0x11, 0xB3, 
-    0x08, 0x00, 0x38, 0x00, 0x20, 0x05, 0x22, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x7C, 0x24, 0x80, 
-    0x60, 0x32, 0x2F, 0x04, 0x2F, 0x12, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x01, 0x36, 0xF2, 
-    0x2D, 0x6E, 0xFF, 0xD8, 0xFF, 0xE0, 0x2D, 0x6E, 0xFF, 0xDC, 0xFF, 0xE4, 0x24, 0xAE, 0xFF, 0xE0, 
-    0x20, 0x2E, 0xFF, 0xE4, 0x53, 0x83, 0x41, 0xEE, 0xFF, 0xE8, 0x11, 0xB3, 0x08, 0x00, 0x38, 0x00, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x92, 0x6F, 0x04, 0x4A, 0x83, 0x6E, 0xC6, 0x70, 0x08, 0xB8, 0x80, 
-    0x66, 0x1E, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x14, 0x41, 0xEE, 0xFF, 0xE8, 
-    0x0C, 0x30, 0x00, 0x30, 0x38, 0x00, 0x67, 0x08, 0x53, 0x83, 0x11, 0xBC, 0x00, 0x30, 0x38, 0x00, 
-    0x70, 0x18, 0x90, 0x83, 0x25, 0x40, 0x00, 0x1E, 0x20, 0x6A, 0x00, 0x12, 0x43, 0xEE, 0xFF, 0xE8, 
-    0x43, 0xF1, 0x38, 0x00, 0x22, 0x2A, 0x00, 0x1E, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0x20, 0x2A, 0x00, 0x1E, 0xB0, 0xAA, 0x00, 0x2E, 0x6C, 0x14, 0x20, 0x2A, 
-    0x00, 0x2E, 0x90, 0xAA, 0x00, 0x1E, 0x25, 0x40, 0x00, 0x1A, 0x02, 0x6A, 0xFF, 0xEF, 0x00, 0x3A, 
-    0x60, 0x2E, 0x4A, 0xAA, 0x00, 0x2E, 0x6C, 0x28, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x14, 0xC0, 0x81, 
-    0x72, 0x10, 0xB0, 0x81, 0x66, 0x1A, 0x20, 0x2A, 0x00, 0x36, 0x90, 0xAA, 0x00, 0x16, 0x90, 0xAA, 
-    0x00, 0x1A, 0x90, 0xAA, 0x00, 0x1E, 0x26, 0x00, 0x4A, 0x80, 0x6F, 0x04, 0x25, 0x43, 0x00, 0x1A, 
-    0x4C, 0xDF, 0x0C, 0x78, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0x82, 0x48, 0xE7, 0x18, 0x30, 
-    0x24, 0x6E, 0x00, 0x10, 0x3D, 0x6D, 0xEF, 0x84, 0xFF, 0xBE, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xCC, 
-    0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xD0, 0x42, 0xAE, 0xFF, 0xF4, 0x42, 0x2E, 0xFF, 0xC1, 0x48, 0x6E, 
-    0xFF, 0xBE, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x0A, 0x48, 0x6E, 0xFF, 0xC1, 0x4E, 0xB9, 
-    0x00, 0x01, 0x38, 0x76, 0x26, 0x00, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x6E, 0x0C, 0x20, 0x4A, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x0C, 0x2E, 0x00, 0x25, 0xFF, 0xC1, 
-    0x67, 0x04, 0x20, 0x03, 0x60, 0x04, 0x20, 0x03, 0x53, 0x80, 0x28, 0x00, 0x4A, 0x80, 0x6F, 0x24, 
-    0x2F, 0x04, 0x2F, 0x0A, 0x2F, 0x2E, 0xFF, 0xD0, 0x20, 0x6E, 0xFF, 0xCC, 0x4E, 0x90, 0x2D, 0x48, 
-    0xFF, 0xD0, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xA2, 
-    0xD9, 0xAE, 0xFF, 0xF4, 0xD5, 0xC3, 0x0C, 0x2E, 0x00, 0x25, 0xFF, 0xC1, 0x67, 0x0E, 0x4A, 0x2E, 
-    0xFF, 0xC1, 0x66, 0x86, 0x20, 0x2E, 0xFF, 0xF4, 0x60, 0x00, 0x01, 0x86, 0x42, 0xAE, 0xFF, 0xEC, 
-    0x42, 0xAE, 0xFF, 0xE8, 0x42, 0xAE, 0xFF, 0xE4, 0x42, 0xAE, 0xFF, 0xE0, 0x42, 0xAE, 0xFF, 0xDC, 
-    0x42, 0xAE, 0xFF, 0xD8, 0x42, 0x6E, 0xFF, 0xFC, 0x60, 0x1A, 0x41, 0xED, 0xFD, 0xC4, 0x22, 0x4B, 
-    0x93, 0xC8, 0x20, 0x09, 0xE5, 0x88, 0x41, 0xED, 0xFD, 0xCA, 0x20, 0x30, 0x08, 0x00, 0x81, 0x6E, 
-    0xFF, 0xFC, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x6D, 0xFD, 0xC4, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3D, 0x56, 0x26, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x66, 0xCC, 0x0C, 0x12, 
-    0x00, 0x2A, 0x66, 0x28, 0x58, 0xAE, 0x00, 0x14, 0x20, 0x6E, 0x00, 0x14, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0xF8, 0x4A, 0xAE, 0xFF, 0xF8, 0x6C, 0x10, 0x20, 0x2E, 0xFF, 0xF8, 0x44, 0x80, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x00, 0x6E, 0x00, 0x04, 0xFF, 0xFC, 0x52, 0x8A, 0x60, 0x40, 0x42, 0xAE, 0xFF, 0xF8, 
-    0x60, 0x28, 0x0C, 0xAE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6C, 0x1C, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x12, 0x12, 0x48, 0x81, 0x48, 0xC1, 0xD2, 0x80, 
-    0x70, 0xD0, 0xD2, 0x80, 0x2D, 0x41, 0xFF, 0xF8, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 
-    0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 0xC0, 0x81, 0x66, 0xC6, 0x0C, 0x12, 0x00, 0x2E, 
-    0x67, 0x08, 0x70, 0xFF, 0x2D, 0x40, 0xFF, 0xF0, 0x60, 0x5A, 0x52, 0x8A, 0x0C, 0x12, 0x00, 0x2A, 
-    0x66, 0x12, 0x58, 0xAE, 0x00, 0x14, 0x20, 0x6E, 0x00, 0x14, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xF0, 
-    0x52, 0x8A, 0x60, 0x40, 0x42, 0xAE, 0xFF, 0xF0, 0x60, 0x28, 0x0C, 0xAE, 0x7F, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xF0, 0x6C, 0x1C, 0x20, 0x2E, 0xFF, 0xF0, 0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 
-    0x12, 0x12, 0x48, 0x81, 0x48, 0xC1, 0xD2, 0x80, 0x70, 0xD0, 0xD2, 0x80, 0x2D, 0x41, 0xFF, 0xF0, 
-    0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 
-    0xC0, 0x81, 0x66, 0xC6, 0x10, 0x12, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x6D, 0xFD, 0xE2, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3D, 0x56, 0x20, 0x08, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x06, 0x10, 0x1A, 0x48, 0x80, 0x48, 0xC0, 0x1D, 0x40, 0xFF, 0xFE, 0x48, 0x6E, 0xFF, 0x82, 
-    0x1F, 0x1A, 0x48, 0x6E, 0x00, 0x14, 0x48, 0x6E, 0xFF, 0xC2, 0x4E, 0xB9, 0x00, 0x01, 0x2E, 0xEC, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0E, 0x66, 0x16, 0x48, 0x6E, 0xFF, 0x82, 0x48, 0x6E, 0xFF, 0xC2, 
-    0x4E, 0xB9, 0x00, 0x01, 0x33, 0xE8, 0x4A, 0x80, 0x50, 0x4F, 0x6C, 0x00, 0xFD, 0xFE, 0x70, 0xFF, 
-    0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xEA, 0x48, 0xE7, 0x18, 0x38, 
-    0x24, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x16, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x12, 
-    0x10, 0x03, 0x48, 0x80, 0x48, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x70, 0x03, 0xA6, 0x00, 0x00, 
-    0x00, 0x25, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x25, 0x03, 0x86, 0x00, 0x00, 
-    0x00, 0x45, 0x01, 0xB2, 0x00, 0x00, 0x00, 0x47, 0x01, 0xAC, 0x00, 0x00, 0x00, 0x58, 0x01, 0x22, 
-    0x00, 0x00, 0x00, 0x63, 0x00, 0x44, 0x00, 0x00, 0x00, 0x64, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x65, 
-    0x01, 0x94, 0x00, 0x00, 0x00, 0x66, 0x01, 0x8E, 0x00, 0x00, 0x00, 0x67, 0x01, 0x88, 0x00, 0x00, 
-    0x00, 0x69, 0x00, 0x74, 0x00, 0x00, 0x00, 0x6E, 0x02, 0x34, 0x00, 0x00, 0x00, 0x6F, 0x00, 0xF2, 
-    0x00, 0x00, 0x00, 0x70, 0x02, 0x68, 0x00, 0x00, 0x00, 0x73, 0x02, 0x86, 0x00, 0x00, 0x00, 0x75, 
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0xDA, 0x0C, 0x2A, 0x00, 0x6C, 0x00, 0x3C, 0x67, 0x16, 
-    0x58, 0x94, 0x20, 0x54, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xA8, 0xFF, 0xFF, 
-    0x08, 0x00, 0x60, 0x00, 0x03, 0x38, 0x58, 0x94, 0x20, 0x54, 0x26, 0x28, 0xFF, 0xFC, 0x1D, 0x43, 
-    0xFF, 0xFE, 0x42, 0x2E, 0xFF, 0xFF, 0x70, 0xFF, 0x25, 0x40, 0x00, 0x2E, 0x48, 0x6E, 0xFF, 0xFE, 
-    0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x32, 0xDA, 0x4A, 0x80, 0x50, 0x4F, 0x6C, 0x00, 0x03, 0x0E, 
-    0x70, 0xFF, 0x60, 0x00, 0x03, 0x0A, 0x0C, 0x2A, 0x00, 0x6C, 0x00, 0x3C, 0x67, 0x0A, 0x58, 0x94, 
-    0x20, 0x54, 0x20, 0x28, 0xFF, 0xFC, 0x60, 0x08, 0x58, 0x94, 0x20, 0x54, 0x20, 0x28, 0xFF, 0xFC, 
-    0x24, 0x80, 0x0C, 0x2A, 0x00, 0x68, 0x00, 0x3C, 0x66, 0x06, 0x30, 0x6A, 0x00, 0x02, 0x24, 0x88, 
-    0x4A, 0x92, 0x6C, 0x10, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x2D, 
-    0x08, 0x00, 0x60, 0x32, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x02, 0xC0, 0x81, 0x67, 0x10, 0x20, 0x2A, 
-    0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x2B, 0x08, 0x00, 0x60, 0x18, 0x30, 0x2A, 
-    0x00, 0x3A, 0x72, 0x01, 0xC0, 0x81, 0x67, 0x0E, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 
-    0x17, 0xBC, 0x00, 0x20, 0x08, 0x00, 0x20, 0x4B, 0xD1, 0xEA, 0x00, 0x16, 0x25, 0x48, 0x00, 0x12, 
-    0x1F, 0x03, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x2B, 0x5C, 0x5C, 0x4F, 0x60, 0x00, 0x02, 0x7E, 
-    0x0C, 0x2A, 0x00, 0x6C, 0x00, 0x3C, 0x67, 0x0A, 0x58, 0x94, 0x20, 0x54, 0x20, 0x28, 0xFF, 0xFC, 
-    0x60, 0x08, 0x58, 0x94, 0x20, 0x54, 0x20, 0x28, 0xFF, 0xFC, 0x24, 0x80, 0x0C, 0x2A, 0x00, 0x68, 
-    0x00, 0x3C, 0x66, 0x0A, 0x70, 0x00, 0x30, 0x2A, 0x00, 0x02, 0x24, 0x80, 0x60, 0x08, 0x4A, 0x2A, 
-    0x00, 0x3C, 0x66, 0x02, 0x24, 0x92, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x2A, 
-    0x4A, 0x92, 0x67, 0x26, 0x0C, 0x03, 0x00, 0x78, 0x67, 0x06, 0x0C, 0x03, 0x00, 0x58, 0x66, 0x1A, 
-    0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x30, 0x08, 0x00, 0x20, 0x2A, 
-    0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0x83, 0x08, 0x00, 0x20, 0x4B, 0xD1, 0xEA, 0x00, 0x16, 
-    0x25, 0x48, 0x00, 0x12, 0x1F, 0x03, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x2B, 0x5C, 0x5C, 0x4F, 
-    0x60, 0x00, 0x01, 0xFA, 0x0C, 0x2A, 0x00, 0x4C, 0x00, 0x3C, 0x67, 0x26, 0x50, 0x94, 0x20, 0x54, 
-    0x48, 0x68, 0xFF, 0xF8, 0x48, 0x6E, 0xFF, 0xF4, 0x3F, 0x3C, 0x08, 0x0E, 0xA9, 0xEB, 0x2D, 0x6E, 
-    0xFF, 0xF4, 0xFF, 0xEA, 0x2D, 0x6E, 0xFF, 0xF8, 0xFF, 0xEE, 0x3D, 0x6E, 0xFF, 0xFC, 0xFF, 0xF2, 
-    0x60, 0x18, 0x70, 0x0A, 0xD1, 0x94, 0x22, 0x54, 0x2D, 0x69, 0xFF, 0xF6, 0xFF, 0xEA, 0x2D, 0x69, 
-    0xFF, 0xFA, 0xFF, 0xEE, 0x3D, 0x69, 0xFF, 0xFE, 0xFF, 0xF2, 0x24, 0xAE, 0xFF, 0xEA, 0x25, 0x6E, 
-    0xFF, 0xEE, 0x00, 0x04, 0x35, 0x6E, 0xFF, 0xF2, 0x00, 0x08, 0x08, 0x12, 0x00, 0x07, 0x67, 0x10, 
-    0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x2D, 0x08, 0x00, 0x60, 0x32, 
-    0x30, 0x2A, 0x00, 0x3A, 0x72, 0x02, 0xC0, 0x81, 0x67, 0x10, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 
-    0x00, 0x16, 0x17, 0xBC, 0x00, 0x2B, 0x08, 0x00, 0x60, 0x18, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x01, 
-    0xC0, 0x81, 0x67, 0x0E, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x20, 
-    0x08, 0x00, 0x20, 0x4B, 0xD1, 0xEA, 0x00, 0x16, 0x25, 0x48, 0x00, 0x12, 0x1F, 0x03, 0x2F, 0x0A, 
-    0x4E, 0xB9, 0x00, 0x01, 0x28, 0x3E, 0x5C, 0x4F, 0x60, 0x00, 0x01, 0x42, 0x0C, 0x2A, 0x00, 0x68, 
-    0x00, 0x3C, 0x66, 0x10, 0x58, 0x94, 0x20, 0x54, 0x20, 0x68, 0xFF, 0xFC, 0x30, 0xAA, 0x00, 0x34, 
-    0x60, 0x00, 0x01, 0x2A, 0x0C, 0x2A, 0x00, 0x6C, 0x00, 0x3C, 0x67, 0x10, 0x58, 0x94, 0x20, 0x54, 
-    0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAA, 0x00, 0x32, 0x60, 0x00, 0x01, 0x12, 0x58, 0x94, 0x20, 0x54, 
-    0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAA, 0x00, 0x32, 0x60, 0x00, 0x01, 0x02, 0x58, 0x94, 0x20, 0x54, 
-    0x24, 0xA8, 0xFF, 0xFC, 0x20, 0x4B, 0xD1, 0xEA, 0x00, 0x16, 0x25, 0x48, 0x00, 0x12, 0x1F, 0x3C, 
-    0x00, 0x78, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x2B, 0x5C, 0x5C, 0x4F, 0x60, 0x00, 0x00, 0xDE, 
-    0x0C, 0x2A, 0x00, 0x6C, 0x00, 0x3C, 0x67, 0x00, 0x00, 0x90, 0x58, 0x94, 0x20, 0x54, 0x25, 0x68, 
-    0xFF, 0xFC, 0x00, 0x12, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x08, 0xC0, 0x81, 0x67, 0x38, 0x4A, 0xAA, 
-    0x00, 0x2E, 0x6D, 0x1E, 0x20, 0x6A, 0x00, 0x12, 0x70, 0x00, 0x10, 0x10, 0xB0, 0xAA, 0x00, 0x2E, 
-    0x6D, 0x06, 0x20, 0x2A, 0x00, 0x2E, 0x60, 0x08, 0x20, 0x6A, 0x00, 0x12, 0x70, 0x00, 0x10, 0x10, 
-    0x60, 0x08, 0x20, 0x6A, 0x00, 0x12, 0x70, 0x00, 0x10, 0x10, 0x25, 0x40, 0x00, 0x1E, 0x52, 0xAA, 
-    0x00, 0x12, 0x60, 0x00, 0x00, 0x88, 0x4A, 0xAA, 0x00, 0x2E, 0x6D, 0x2A, 0x2F, 0x2A, 0x00, 0x2E, 
-    0x42, 0xA7, 0x2F, 0x2A, 0x00, 0x12, 0x4E, 0xB9, 0x00, 0x01, 0x3C, 0x1E, 0x28, 0x08, 0x20, 0x08, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x20, 0x2A, 0x00, 0x2E, 0x60, 0x08, 0x20, 0x44, 0x91, 0xEA, 
-    0x00, 0x12, 0x20, 0x08, 0x60, 0x0C, 0x20, 0x6A, 0x00, 0x12, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 
-    0x66, 0xFA, 0x25, 0x40, 0x00, 0x1E, 0x60, 0x44, 0x58, 0x94, 0x20, 0x54, 0x2F, 0x28, 0xFF, 0xFC, 
-    0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x32, 0xDA, 0x4A, 0x80, 0x50, 0x4F, 0x6C, 0x2E, 0x70, 0xFF, 
-    0x60, 0x2C, 0x20, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0xBC, 0x00, 0x25, 0x08, 0x00, 
-    0x60, 0x1A, 0x4A, 0x03, 0x66, 0x04, 0x70, 0x25, 0x60, 0x06, 0x10, 0x03, 0x48, 0x80, 0x48, 0xC0, 
-    0x22, 0x2A, 0x00, 0x16, 0x52, 0xAA, 0x00, 0x16, 0x17, 0x80, 0x18, 0x00, 0x70, 0x00, 0x4C, 0xDF, 
-    0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xB6, 0x48, 0xE7, 0x1E, 0x38, 0x24, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x4A, 0xAA, 0x00, 0x2E, 0x6D, 0x06, 0x20, 0x2A, 0x00, 0x2E, 
-    0x60, 0x06, 0x20, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x18, 0x2D, 0xFB, 0x2E, 0x48, 0x84, 
-    0x48, 0xC4, 0xD8, 0xAA, 0x00, 0x36, 0x3D, 0x6D, 0xEF, 0x86, 0xFF, 0xB6, 0x30, 0x2A, 0x00, 0x3A, 
-    0x72, 0x04, 0xC0, 0x81, 0x66, 0x06, 0x70, 0x40, 0xB8, 0x80, 0x62, 0x08, 0x47, 0xEE, 0xFF, 0xC0, 
-    0x78, 0x40, 0x60, 0x16, 0x2F, 0x04, 0x4E, 0xB9, 0x00, 0x01, 0x37, 0xD4, 0x26, 0x48, 0x20, 0x08, 
-    0x58, 0x4F, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xA4, 0x7C, 0x00, 0x60, 0x72, 0x48, 0x6E, 
-    0xFF, 0xB6, 0x1F, 0x14, 0x48, 0x6E, 0xFF, 0xB8, 0x4E, 0xB9, 0x00, 0x01, 0x3B, 0x02, 0x26, 0x00, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0A, 0x6E, 0x04, 0x7C, 0xFF, 0x60, 0x58, 0x4A, 0x14, 0x67, 0x04, 
-    0x20, 0x03, 0x60, 0x04, 0x53, 0x83, 0x20, 0x03, 0xBA, 0x80, 0x6D, 0x48, 0x20, 0x2A, 0x00, 0x16, 
-    0xD0, 0x83, 0xB8, 0x80, 0x64, 0x14, 0x42, 0xAA, 0x00, 0x36, 0x2F, 0x0B, 0x2F, 0x0A, 0x4E, 0xB9, 
-    0x00, 0x01, 0x33, 0xE8, 0x42, 0xAA, 0x00, 0x16, 0x50, 0x4F, 0x20, 0x2A, 0x00, 0x16, 0x41, 0xF3, 
-    0x08, 0x00, 0x43, 0xEE, 0xFF, 0xB8, 0x22, 0x03, 0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 
-    0x53, 0x81, 0x66, 0xFA, 0xD7, 0xAA, 0x00, 0x16, 0x4A, 0x14, 0x67, 0x08, 0x52, 0x8C, 0x9A, 0x83, 
-    0x4A, 0x85, 0x6E, 0x8A, 0x2F, 0x0B, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x33, 0xE8, 0x42, 0xAA, 
-    0x00, 0x36, 0x42, 0xAA, 0x00, 0x16, 0x41, 0xEE, 0xFF, 0xC0, 0xB7, 0xC8, 0x50, 0x4F, 0x67, 0x0A, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x01, 0x36, 0x42, 0x58, 0x4F, 0x20, 0x06, 0x4C, 0xDF, 0x1C, 0x78, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1C, 0x20, 0x24, 0x6E, 0x00, 0x08, 
-    0x26, 0x2A, 0x00, 0x36, 0x96, 0xAA, 0x00, 0x16, 0x96, 0xAA, 0x00, 0x1A, 0x96, 0xAA, 0x00, 0x1E, 
-    0x96, 0xAA, 0x00, 0x22, 0x96, 0xAA, 0x00, 0x26, 0x96, 0xAA, 0x00, 0x2A, 0x30, 0x2A, 0x00, 0x3A, 
-    0x72, 0x04, 0xC0, 0x81, 0x66, 0x48, 0x4A, 0x83, 0x6F, 0x44, 0x2A, 0x03, 0x60, 0x3C, 0x70, 0x20, 
-    0xBA, 0x80, 0x62, 0x04, 0x20, 0x05, 0x60, 0x02, 0x70, 0x20, 0x28, 0x00, 0x4A, 0x84, 0x6F, 0x28, 
-    0x2F, 0x04, 0x48, 0x6D, 0xFD, 0xE6, 0x2F, 0x2A, 0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 
-    0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0xD9, 0xAA, 0x00, 0x32, 
-    0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xE0, 0x9A, 0x84, 0x4A, 0x85, 0x6E, 0xC0, 0x4A, 0xAA, 
-    0x00, 0x16, 0x6F, 0x2E, 0x2F, 0x2A, 0x00, 0x16, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2A, 0x00, 0x0E, 
-    0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x0A, 0x20, 0x2A, 0x00, 0x16, 0xD1, 0xAA, 0x00, 0x32, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 
-    0x01, 0xA6, 0x4A, 0xAA, 0x00, 0x1A, 0x6F, 0x46, 0x2A, 0x2A, 0x00, 0x1A, 0x60, 0x3C, 0x70, 0x20, 
-    0xBA, 0x80, 0x62, 0x04, 0x20, 0x05, 0x60, 0x02, 0x70, 0x20, 0x28, 0x00, 0x4A, 0x84, 0x6F, 0x28, 
-    0x2F, 0x04, 0x48, 0x6D, 0xFE, 0x08, 0x2F, 0x2A, 0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 
-    0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0xD9, 0xAA, 0x00, 0x32, 
-    0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x60, 0x9A, 0x84, 0x4A, 0x85, 0x6E, 0xC0, 0x4A, 0xAA, 
-    0x00, 0x1E, 0x6F, 0x2E, 0x2F, 0x2A, 0x00, 0x1E, 0x2F, 0x2A, 0x00, 0x12, 0x2F, 0x2A, 0x00, 0x0E, 
-    0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x0A, 0x20, 0x2A, 0x00, 0x1E, 0xD1, 0xAA, 0x00, 0x32, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 
-    0x01, 0x26, 0x4A, 0xAA, 0x00, 0x22, 0x6F, 0x46, 0x2A, 0x2A, 0x00, 0x22, 0x60, 0x3C, 0x70, 0x20, 
-    0xBA, 0x80, 0x62, 0x04, 0x20, 0x05, 0x60, 0x02, 0x70, 0x20, 0x28, 0x00, 0x4A, 0x84, 0x6F, 0x28, 
-    0x2F, 0x04, 0x48, 0x6D, 0xFE, 0x08, 0x2F, 0x2A, 0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 
-    0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0xD9, 0xAA, 0x00, 0x32, 
-    0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xE0, 0x9A, 0x84, 0x4A, 0x85, 0x6E, 0xC0, 0x4A, 0xAA, 
-    0x00, 0x26, 0x6F, 0x36, 0x2F, 0x2A, 0x00, 0x26, 0x20, 0x6A, 0x00, 0x12, 0x20, 0x2A, 0x00, 0x1E, 
-    0x48, 0x70, 0x08, 0x00, 0x2F, 0x2A, 0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 0x25, 0x48, 
-    0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0A, 0x20, 0x2A, 0x00, 0x26, 0xD1, 0xAA, 
-    0x00, 0x32, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x9E, 0x4A, 0xAA, 0x00, 0x2A, 0x6F, 0x44, 
-    0x2A, 0x2A, 0x00, 0x2A, 0x60, 0x3A, 0x70, 0x20, 0xBA, 0x80, 0x62, 0x04, 0x20, 0x05, 0x60, 0x02, 
-    0x70, 0x20, 0x28, 0x00, 0x4A, 0x84, 0x6F, 0x26, 0x2F, 0x04, 0x48, 0x6D, 0xFE, 0x08, 0x2F, 0x2A, 
-    0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x06, 0xD9, 0xAA, 0x00, 0x32, 0x60, 0x04, 0x70, 0xFF, 0x60, 0x58, 0x9A, 0x84, 
-    0x4A, 0x85, 0x6E, 0xC2, 0x30, 0x2A, 0x00, 0x3A, 0x72, 0x04, 0xC0, 0x81, 0x67, 0x46, 0x4A, 0x83, 
-    0x6F, 0x42, 0x28, 0x03, 0x60, 0x3A, 0x70, 0x20, 0xB8, 0x80, 0x62, 0x04, 0x20, 0x04, 0x60, 0x02, 
-    0x70, 0x20, 0x26, 0x00, 0x4A, 0x83, 0x6F, 0x26, 0x2F, 0x03, 0x48, 0x6D, 0xFD, 0xE6, 0x2F, 0x2A, 
-    0x00, 0x0E, 0x20, 0x6A, 0x00, 0x0A, 0x4E, 0x90, 0x25, 0x48, 0x00, 0x0E, 0x20, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x06, 0xD7, 0xAA, 0x00, 0x32, 0x60, 0x04, 0x70, 0xFF, 0x60, 0x08, 0x98, 0x83, 
-    0x4A, 0x84, 0x6E, 0xC2, 0x70, 0x00, 0x4C, 0xDF, 0x04, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 
-    0x00, 0x18, 0x59, 0x4F, 0x26, 0x6F, 0x00, 0x10, 0x20, 0x0B, 0x67, 0x00, 0x00, 0x9A, 0x22, 0x4B, 
-    0x59, 0x89, 0x70, 0x08, 0xB0, 0x91, 0x62, 0x06, 0x70, 0x03, 0xC0, 0x91, 0x67, 0x04, 0x60, 0x00, 
-    0x00, 0x86, 0x2E, 0x91, 0x4A, 0xAD, 0xEF, 0x8C, 0x67, 0x06, 0xB3, 0xED, 0xEF, 0x8C, 0x64, 0x0C, 
-    0x23, 0x6D, 0xEF, 0x8C, 0x00, 0x04, 0x2B, 0x49, 0xEF, 0x8C, 0x60, 0x44, 0x26, 0x6D, 0xEF, 0x8C, 
-    0x60, 0x04, 0x26, 0x6B, 0x00, 0x04, 0x4A, 0xAB, 0x00, 0x04, 0x67, 0x06, 0xB3, 0xEB, 0x00, 0x04, 
-    0x62, 0xF0, 0x28, 0x4B, 0xD9, 0xD3, 0xB3, 0xCC, 0x65, 0x4C, 0xB9, 0xC9, 0x66, 0x08, 0x20, 0x11, 
-    0xD1, 0x93, 0x22, 0x4B, 0x60, 0x1A, 0x4A, 0xAB, 0x00, 0x04, 0x67, 0x0A, 0x20, 0x49, 0xD1, 0xD1, 
-    0xB1, 0xEB, 0x00, 0x04, 0x62, 0x30, 0x23, 0x6B, 0x00, 0x04, 0x00, 0x04, 0x27, 0x49, 0x00, 0x04, 
-    0x4A, 0xA9, 0x00, 0x04, 0x67, 0x20, 0x20, 0x49, 0xD1, 0xD1, 0xB1, 0xE9, 0x00, 0x04, 0x66, 0x16, 
-    0x42, 0xAD, 0xEF, 0x88, 0x20, 0x69, 0x00, 0x04, 0x20, 0x10, 0xD1, 0x91, 0x20, 0x69, 0x00, 0x04, 
-    0x23, 0x68, 0x00, 0x04, 0x00, 0x04, 0x58, 0x4F, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x75, 0x51, 0x4F, 
-    0x20, 0x2F, 0x00, 0x10, 0x22, 0x2F, 0x00, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x2E, 0x80, 
-    0x20, 0x2F, 0x00, 0x14, 0x22, 0x17, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x22, 0x2F, 0x00, 0x10, 
-    0x92, 0x80, 0x2F, 0x41, 0x00, 0x04, 0x20, 0x6F, 0x00, 0x0C, 0x20, 0x97, 0x21, 0x6F, 0x00, 0x04, 
-    0x00, 0x04, 0x50, 0x4F, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x28, 0x2E, 
-    0x00, 0x08, 0x24, 0x6D, 0xEF, 0x88, 0x20, 0x0A, 0x66, 0x2E, 0x45, 0xED, 0xEF, 0x88, 0x58, 0x8A, 
-    0x60, 0x10, 0x20, 0x52, 0xB8, 0x90, 0x62, 0x04, 0x20, 0x4A, 0x60, 0x7C, 0x20, 0x52, 0x58, 0x88, 
-    0x24, 0x48, 0x4A, 0x92, 0x66, 0xEC, 0x60, 0x36, 0x20, 0x52, 0xB8, 0x90, 0x62, 0x04, 0x20, 0x4A, 
-    0x60, 0x66, 0x20, 0x52, 0x58, 0x88, 0x24, 0x48, 0x4A, 0x92, 0x66, 0xEC, 0x20, 0x6D, 0xEF, 0x88, 
-    0x26, 0x50, 0x45, 0xED, 0xEF, 0x88, 0x58, 0x8A, 0x60, 0x10, 0x20, 0x52, 0xB8, 0x90, 0x62, 0x04, 
-    0x20, 0x4A, 0x60, 0x44, 0x20, 0x52, 0x58, 0x88, 0x24, 0x48, 0xB7, 0xD2, 0x66, 0xEC, 0x26, 0x3C, 
-    0x00, 0x00, 0x80, 0x00, 0xB6, 0x84, 0x64, 0x02, 0x26, 0x04, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 
-    0x38, 0x4C, 0x26, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x66, 0x0C, 0xB6, 0x84, 0x66, 0x04, 0x91, 0xC8, 
-    0x60, 0x16, 0xE2, 0x8B, 0x60, 0xDE, 0x26, 0x83, 0x48, 0x6B, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x01, 
-    0x36, 0x42, 0x58, 0x4F, 0x60, 0x00, 0xFF, 0x6C, 0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x30, 0x28, 0x2E, 0x00, 0x08, 0x70, 0xFC, 0x26, 0x04, 
-    0x5E, 0x83, 0xC6, 0x80, 0x4A, 0x84, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x54, 0xB6, 0x84, 0x62, 0x04, 
-    0x91, 0xC8, 0x60, 0x4C, 0x70, 0x08, 0xB6, 0x80, 0x64, 0x02, 0x76, 0x08, 0x2F, 0x03, 0x4E, 0xB9, 
-    0x00, 0x01, 0x37, 0x2A, 0x26, 0x48, 0x20, 0x08, 0x58, 0x4F, 0x66, 0x04, 0x91, 0xC8, 0x60, 0x30, 
-    0x24, 0x53, 0x20, 0x12, 0x51, 0x80, 0xB0, 0x83, 0x64, 0x06, 0x26, 0xAA, 0x00, 0x04, 0x60, 0x18, 
-    0x20, 0x4A, 0xD1, 0xC3, 0x26, 0x88, 0x20, 0x53, 0x21, 0x6A, 0x00, 0x04, 0x00, 0x04, 0x20, 0x12, 
-    0x90, 0x83, 0x20, 0x53, 0x20, 0x80, 0x24, 0x83, 0x2B, 0x4B, 0xEF, 0x88, 0x20, 0x4A, 0x58, 0x88, 
-    0x4C, 0xDF, 0x0C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x03, 0x26, 0x2E, 
-    0x00, 0x08, 0x4A, 0x83, 0x67, 0x14, 0x20, 0x03, 0xA1, 0x1E, 0x2D, 0x48, 0xFF, 0xFC, 0x20, 0x08, 
-    0x4A, 0x80, 0x67, 0x06, 0x20, 0x6E, 0xFF, 0xFC, 0x60, 0x02, 0x91, 0xC8, 0x26, 0x1F, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x48, 0xE7, 0x0F, 0x18, 0x28, 0x6F, 0x00, 0x20, 0x22, 0x6F, 0x00, 0x28, 0x20, 0x0C, 
-    0x66, 0x14, 0x32, 0xAD, 0xEF, 0x90, 0x20, 0x6D, 0xFB, 0x30, 0x30, 0x10, 0x02, 0x80, 0x00, 0x00, 
-    0x0F, 0x00, 0x60, 0x00, 0x00, 0xE2, 0x1A, 0x29, 0x00, 0x01, 0x7C, 0x00, 0x26, 0x4C, 0x14, 0x11, 
-    0x4A, 0xAF, 0x00, 0x24, 0x66, 0x0C, 0x12, 0x82, 0x13, 0x45, 0x00, 0x01, 0x70, 0xFE, 0x60, 0x00, 
-    0x00, 0xC6, 0x0C, 0x05, 0x00, 0x10, 0x6C, 0x2A, 0x10, 0x05, 0x48, 0x80, 0x48, 0xC0, 0xE5, 0x88, 
-    0x41, 0xED, 0xFB, 0x30, 0x2E, 0x30, 0x08, 0x00, 0x67, 0x18, 0x52, 0x86, 0x0C, 0x86, 0x00, 0x00, 
-    0x0F, 0xF0, 0x64, 0x0E, 0x70, 0x00, 0x10, 0x13, 0xD0, 0x80, 0x20, 0x47, 0x38, 0x30, 0x08, 0x00, 
-    0x66, 0x0C, 0x70, 0x24, 0x2B, 0x40, 0xEF, 0x7C, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x8A, 0x3A, 0x04, 
-    0x02, 0x85, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0x85, 0x30, 0x04, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 
-    0x67, 0x18, 0x30, 0x04, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x12, 0x02, 0x48, 0x81, 0x48, 0xC1, 
-    0x02, 0x81, 0xFF, 0xFF, 0xFF, 0x00, 0x82, 0x80, 0x14, 0x01, 0x30, 0x04, 0x02, 0x80, 0x00, 0x00, 
-    0x10, 0x00, 0x67, 0x18, 0x10, 0x02, 0x48, 0x80, 0x48, 0xC0, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 
-    0x12, 0x02, 0x48, 0x81, 0x48, 0xC1, 0xE1, 0x89, 0x82, 0x80, 0x14, 0x01, 0x30, 0x04, 0x02, 0x80, 
-    0x00, 0x00, 0x40, 0x00, 0x67, 0x0C, 0x4A, 0x13, 0x67, 0x08, 0x52, 0x8B, 0x53, 0xAF, 0x00, 0x24, 
-    0x7C, 0x00, 0x30, 0x04, 0x02, 0x80, 0x00, 0x00, 0x20, 0x00, 0x67, 0x00, 0xFF, 0x44, 0x4A, 0xAF, 
-    0x00, 0x1C, 0x67, 0x06, 0x20, 0x6F, 0x00, 0x1C, 0x10, 0x82, 0x12, 0x82, 0x13, 0x45, 0x00, 0x01, 
-    0x20, 0x4B, 0x91, 0xCC, 0x20, 0x08, 0x4C, 0xDF, 0x18, 0xF0, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF4, 
-    0x48, 0xE7, 0x1F, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x26, 0x2E, 0x00, 0x10, 
-    0x24, 0x4C, 0x60, 0x02, 0x52, 0x8A, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x00, 0x00, 0x72, 0x44, 0xC0, 0x81, 0x66, 0xEC, 0x0C, 0x12, 0x00, 0x2D, 0x67, 0x0A, 0x0C, 0x12, 
-    0x00, 0x2B, 0x67, 0x04, 0x70, 0x2B, 0x60, 0x06, 0x10, 0x1A, 0x48, 0x80, 0x48, 0xC0, 0x1C, 0x00, 
-    0x4A, 0x83, 0x6D, 0x0C, 0x70, 0x01, 0xB6, 0x80, 0x67, 0x06, 0x70, 0x24, 0xB6, 0x80, 0x6F, 0x0C, 
-    0x20, 0x0B, 0x67, 0x02, 0x26, 0x8C, 0x70, 0x00, 0x60, 0x00, 0x01, 0x1C, 0x4A, 0x83, 0x6F, 0x20, 
-    0x70, 0x10, 0xB6, 0x80, 0x66, 0x3C, 0x0C, 0x12, 0x00, 0x30, 0x66, 0x36, 0x0C, 0x2A, 0x00, 0x78, 
-    0x00, 0x01, 0x67, 0x08, 0x0C, 0x2A, 0x00, 0x58, 0x00, 0x01, 0x66, 0x26, 0x54, 0x8A, 0x60, 0x22, 
-    0x0C, 0x12, 0x00, 0x30, 0x67, 0x04, 0x76, 0x0A, 0x60, 0x18, 0x0C, 0x2A, 0x00, 0x78, 0x00, 0x01, 
-    0x67, 0x08, 0x0C, 0x2A, 0x00, 0x58, 0x00, 0x01, 0x66, 0x06, 0x76, 0x10, 0x54, 0x8A, 0x60, 0x02, 
-    0x76, 0x08, 0x2D, 0x4A, 0xFF, 0xFC, 0x60, 0x02, 0x52, 0x8A, 0x0C, 0x12, 0x00, 0x30, 0x67, 0xF8, 
-    0x78, 0x00, 0x2D, 0x4A, 0xFF, 0xF8, 0x60, 0x24, 0x2D, 0x44, 0xFF, 0xF4, 0x41, 0xED, 0xFE, 0x2A, 
-    0x22, 0x47, 0x93, 0xC8, 0x2A, 0x09, 0x20, 0x04, 0x22, 0x03, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 
-    0x12, 0x05, 0x48, 0x81, 0x48, 0xC1, 0xD2, 0x80, 0x28, 0x01, 0x52, 0x8A, 0x2F, 0x03, 0x10, 0x12, 
-    0x48, 0x80, 0x20, 0x6D, 0xF9, 0x28, 0x10, 0x30, 0x00, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 
-    0x48, 0x6D, 0xFE, 0x2A, 0x4E, 0xB9, 0x00, 0x01, 0x3C, 0x1E, 0x2E, 0x08, 0x20, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x66, 0xB4, 0xB5, 0xEE, 0xFF, 0xFC, 0x66, 0x0A, 0x20, 0x0B, 0x67, 0x02, 0x26, 0x8C, 
-    0x70, 0x00, 0x60, 0x62, 0x20, 0x4A, 0x91, 0xEE, 0xFF, 0xF8, 0x43, 0xED, 0xFE, 0x50, 0x10, 0x31, 
-    0x38, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x91, 0xC0, 0x2E, 0x08, 0x4A, 0x87, 0x6D, 0x38, 0x4A, 0x87, 
-    0x6E, 0x28, 0x10, 0x05, 0x48, 0x80, 0x48, 0xC0, 0x22, 0x04, 0x92, 0x80, 0xB8, 0x81, 0x65, 0x1A, 
-    0x10, 0x05, 0x48, 0x80, 0x48, 0xC0, 0x22, 0x04, 0x92, 0x80, 0x20, 0x01, 0x22, 0x03, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x7C, 0xB0, 0xAE, 0xFF, 0xF4, 0x67, 0x0C, 0x70, 0x22, 0x2B, 0x40, 0xEF, 0x7C, 
-    0x24, 0x4C, 0x78, 0xFF, 0x7C, 0x2B, 0x0C, 0x06, 0x00, 0x2D, 0x66, 0x02, 0x44, 0x84, 0x20, 0x0B, 
-    0x67, 0x02, 0x26, 0x8A, 0x20, 0x04, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 
-    0x1F, 0x38, 0x18, 0x2F, 0x00, 0x28, 0x26, 0x6F, 0x00, 0x2A, 0x4A, 0xAF, 0x00, 0x24, 0x66, 0x14, 
-    0x36, 0xAD, 0xEF, 0x92, 0x20, 0x6D, 0xFB, 0x30, 0x30, 0x10, 0x02, 0x80, 0x00, 0x00, 0x0F, 0x00, 
-    0x60, 0x00, 0x00, 0xF2, 0x1A, 0x2B, 0x00, 0x01, 0x7E, 0x00, 0x95, 0xCA, 0x7C, 0x00, 0x0C, 0x05, 
-    0x00, 0x10, 0x6C, 0x3C, 0x10, 0x05, 0x48, 0x80, 0x48, 0xC0, 0xE5, 0x88, 0x41, 0xED, 0xFB, 0x70, 
-    0x28, 0x70, 0x08, 0x00, 0x20, 0x0C, 0x67, 0x28, 0x10, 0x2D, 0xFB, 0x2E, 0x48, 0x80, 0x48, 0xC0, 
-    0xB0, 0x86, 0x6F, 0x1C, 0x52, 0x8A, 0xB4, 0xFC, 0x0F, 0xF0, 0x64, 0x14, 0x10, 0x04, 0x48, 0x80, 
-    0x48, 0xC0, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x80, 0x36, 0x34, 0x08, 0x00, 0x66, 0x0C, 
-    0x70, 0x24, 0x2B, 0x40, 0xEF, 0x7C, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x9A, 0x3A, 0x03, 0x02, 0x85, 
-    0x00, 0x00, 0x0F, 0x00, 0xE0, 0x85, 0x30, 0x03, 0x02, 0x80, 0x00, 0x00, 0x80, 0x00, 0x67, 0x18, 
-    0x30, 0x03, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x12, 0x04, 0x48, 0x81, 0x48, 0xC1, 0x02, 0x81, 
-    0xFF, 0xFF, 0xFF, 0x00, 0x82, 0x80, 0x18, 0x01, 0x30, 0x03, 0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 
-    0x67, 0x18, 0x10, 0x04, 0x48, 0x80, 0x48, 0xC0, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x12, 0x04, 
-    0x48, 0x81, 0x48, 0xC1, 0xE1, 0x89, 0x82, 0x80, 0x18, 0x01, 0x30, 0x03, 0x02, 0x80, 0x00, 0x00, 
-    0x20, 0x00, 0x67, 0x2A, 0x30, 0x03, 0x02, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x4A, 0x80, 0x66, 0x08, 
-    0x10, 0x04, 0x48, 0x80, 0x48, 0xC0, 0x60, 0x04, 0x70, 0x00, 0x30, 0x03, 0x22, 0x06, 0x52, 0x86, 
-    0x20, 0x6F, 0x00, 0x24, 0x11, 0x80, 0x18, 0x00, 0x66, 0x02, 0x7E, 0x01, 0x95, 0xCA, 0x30, 0x03, 
-    0x02, 0x80, 0x00, 0x00, 0x40, 0x00, 0x66, 0x06, 0x4A, 0x87, 0x67, 0x00, 0xFF, 0x22, 0x17, 0x45, 
-    0x00, 0x01, 0x20, 0x06, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x0C, 0x10, 0x2F, 
-    0x00, 0x0B, 0x20, 0x6F, 0x00, 0x04, 0x60, 0x0A, 0xB0, 0x10, 0x66, 0x02, 0x4E, 0x75, 0x52, 0x88, 
-    0x53, 0x81, 0x4A, 0x81, 0x66, 0xF2, 0x91, 0xC8, 0x4E, 0x75, 0x48, 0xE7, 0x10, 0x30, 0x26, 0x2F, 
-    0x00, 0x18, 0x24, 0x6F, 0x00, 0x10, 0x26, 0x6F, 0x00, 0x14, 0x60, 0x1A, 0x10, 0x12, 0xB0, 0x13, 
-    0x67, 0x0E, 0x10, 0x12, 0xB0, 0x13, 0x65, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0xFF, 0x60, 0x0C, 
-    0x52, 0x8A, 0x52, 0x8B, 0x53, 0x83, 0x4A, 0x83, 0x66, 0xE2, 0x70, 0x00, 0x4C, 0xDF, 0x0C, 0x08, 
-    0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x0C, 0x22, 0x6E, 0x00, 0x08, 0x20, 0x2E, 
-    0x00, 0x10, 0xA2, 0x2E, 0x20, 0x6E, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x0F, 0x00, 
-    0x22, 0x6F, 0x00, 0x14, 0x28, 0x2F, 0x00, 0x1C, 0x20, 0x49, 0x1A, 0x2F, 0x00, 0x1B, 0x7C, 0x00, 
-    0x74, 0x00, 0x4A, 0x84, 0x67, 0x00, 0x00, 0x80, 0x4A, 0x05, 0x67, 0x22, 0x70, 0x00, 0x10, 0x05, 
-    0x48, 0xC0, 0xE1, 0x88, 0x7C, 0x00, 0x1C, 0x05, 0x8C, 0x80, 0x70, 0x00, 0x30, 0x06, 0x74, 0x10, 
-    0xE5, 0xA8, 0x74, 0x00, 0x34, 0x06, 0x84, 0x80, 0x60, 0x04, 0x53, 0x84, 0x10, 0xC5, 0x4A, 0x84, 
-    0x67, 0x08, 0x70, 0x03, 0x22, 0x08, 0xC2, 0x80, 0x66, 0xF0, 0x2E, 0x04, 0xEA, 0x8F, 0x67, 0x24, 
-    0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 
-    0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 0x20, 0x82, 0x58, 0x88, 
-    0x53, 0x87, 0x66, 0xDC, 0x7E, 0x1F, 0xCE, 0x84, 0xE4, 0x8F, 0x67, 0x08, 0x20, 0x82, 0x58, 0x88, 
-    0x53, 0x87, 0x66, 0xF8, 0x70, 0x02, 0xC0, 0x84, 0x67, 0x04, 0x30, 0x86, 0x54, 0x88, 0x70, 0x01, 
-    0xC0, 0x84, 0x67, 0x02, 0x10, 0x85, 0x20, 0x49, 0x4C, 0xDF, 0x00, 0xF0, 0x4E, 0x75, 0x2F, 0x0C, 
-    0x28, 0x6F, 0x00, 0x08, 0x22, 0x6F, 0x00, 0x0C, 0x20, 0x4C, 0x60, 0x02, 0x52, 0x88, 0x4A, 0x10, 
-    0x66, 0xFA, 0x60, 0x04, 0x52, 0x88, 0x52, 0x89, 0x10, 0x91, 0x66, 0xF8, 0x20, 0x4C, 0x28, 0x5F, 
-    0x4E, 0x75, 0x55, 0x4F, 0x20, 0x6F, 0x00, 0x06, 0x1F, 0x6F, 0x00, 0x0D, 0x00, 0x01, 0x60, 0x0C, 
-    0x4A, 0x10, 0x66, 0x06, 0x91, 0xC8, 0x54, 0x4F, 0x4E, 0x75, 0x52, 0x88, 0x10, 0x10, 0xB0, 0x2F, 
-    0x00, 0x01, 0x66, 0xEC, 0x54, 0x4F, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 
-    0x60, 0x0C, 0x4A, 0x10, 0x66, 0x04, 0x70, 0x00, 0x4E, 0x75, 0x52, 0x88, 0x52, 0x89, 0x10, 0x10, 
-    0xB0, 0x11, 0x67, 0xEE, 0x70, 0x00, 0x10, 0x11, 0x72, 0x00, 0x12, 0x10, 0x92, 0x80, 0x20, 0x01, 
-    0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x24, 0x2F, 0x00, 0x0C, 0x60, 0x22, 
-    0x10, 0x10, 0xB0, 0x11, 0x67, 0x0E, 0x70, 0x00, 0x10, 0x11, 0x72, 0x00, 0x12, 0x10, 0x92, 0x80, 
-    0x20, 0x01, 0x4E, 0x75, 0x4A, 0x10, 0x66, 0x04, 0x70, 0x00, 0x4E, 0x75, 0x52, 0x88, 0x52, 0x89, 
-    0x53, 0x82, 0x4A, 0x82, 0x66, 0xDA, 0x70, 0x00, 0x4E, 0x75, 0x2F, 0x0C, 0x28, 0x6F, 0x00, 0x08, 
-    0x22, 0x6F, 0x00, 0x0C, 0x20, 0x2F, 0x00, 0x10, 0x20, 0x4C, 0x60, 0x04, 0x10, 0xD9, 0x53, 0x80, 
-    0x4A, 0x80, 0x67, 0x0A, 0x4A, 0x11, 0x66, 0xF4, 0x60, 0x04, 0x42, 0x18, 0x53, 0x80, 0x4A, 0x80, 
-    0x66, 0xF8, 0x20, 0x4C, 0x28, 0x5F, 0x4E, 0x75, 0x20, 0x6F, 0x00, 0x04, 0x10, 0x2F, 0x00, 0x0B, 
-    0x93, 0xC9, 0xB0, 0x10, 0x66, 0x02, 0x22, 0x48, 0x4A, 0x10, 0x66, 0x04, 0x20, 0x49, 0x4E, 0x75, 
-    0x52, 0x88, 0x60, 0xEE, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x38, 0x24, 0x6E, 
-    0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x4A, 0x14, 0x66, 0x1E, 0x20, 0x4A, 0x60, 0x34, 0x26, 0x0A, 
-    0x26, 0x4C, 0x52, 0x8B, 0x4A, 0x13, 0x66, 0x04, 0x20, 0x4A, 0x60, 0x26, 0x52, 0x83, 0x20, 0x43, 
-    0x10, 0x10, 0xB0, 0x13, 0x67, 0xEC, 0x52, 0x8A, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 
-    0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x3D, 0x56, 0x24, 0x48, 0x20, 0x08, 0x50, 0x4F, 0x66, 0xCE, 
-    0x91, 0xC8, 0x4C, 0xDF, 0x1C, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 
-    0xFF, 0x82, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 0xFF, 0xB5, 0x48, 0x78, 0x00, 0x1A, 0x48, 0x6D, 
-    0xFF, 0x9A, 0x4E, 0xB9, 0x00, 0x01, 0x45, 0xEA, 0x41, 0xED, 0xFF, 0x9A, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 0x3E, 0xC0, 0x58, 0x4F, 
-    0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x01, 0x3E, 0x7E, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xE6, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x10, 0x41, 0xEE, 0xFF, 0xF2, 0xA9, 0xC6, 0x30, 0x2E, 0xFF, 0xFC, 
-    0x48, 0xC0, 0x2B, 0x40, 0xEF, 0x98, 0x30, 0x2E, 0xFF, 0xFA, 0x48, 0xC0, 0x2B, 0x40, 0xEF, 0x9C, 
-    0x30, 0x2E, 0xFF, 0xF8, 0x48, 0xC0, 0x2B, 0x40, 0xEF, 0xA0, 0x30, 0x2E, 0xFF, 0xF6, 0x48, 0xC0, 
-    0x2B, 0x40, 0xEF, 0xA4, 0x30, 0x2E, 0xFF, 0xF4, 0x48, 0xC0, 0x53, 0x80, 0x2B, 0x40, 0xEF, 0xA8, 
-    0x30, 0x2E, 0xFF, 0xF2, 0x48, 0xC0, 0x06, 0x80, 0xFF, 0xFF, 0xF8, 0x94, 0x2B, 0x40, 0xEF, 0xAC, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x53, 0x80, 0x2B, 0x40, 0xEF, 0xB0, 0x20, 0x2D, 0xEF, 0xA8, 
-    0xD0, 0x80, 0x41, 0xED, 0xFF, 0xBC, 0x30, 0x30, 0x08, 0x00, 0x48, 0xC0, 0xD0, 0xAD, 0xEF, 0xA4, 
-    0x53, 0x80, 0x2B, 0x40, 0xEF, 0xB4, 0x70, 0x01, 0xB0, 0xAD, 0xEF, 0xA8, 0x6C, 0x0C, 0x70, 0x03, 
-    0xC0, 0xAD, 0xEF, 0xAC, 0x66, 0x04, 0x52, 0xAD, 0xEF, 0xB4, 0x41, 0xEE, 0xFF, 0xE6, 0x20, 0x3C, 
-    0x00, 0x0C, 0x00, 0xE4, 0xA0, 0x51, 0x10, 0x2E, 0xFF, 0xEE, 0x48, 0x80, 0x48, 0xC0, 0x2B, 0x40, 
-    0xEF, 0xB8, 0x41, 0xED, 0xEF, 0x98, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x18, 0x20, 0x24, 0x6F, 
-    0x00, 0x10, 0x26, 0x2F, 0x00, 0x14, 0x28, 0x2F, 0x00, 0x18, 0x4A, 0x83, 0x6C, 0x02, 0x76, 0x00, 
-    0xD5, 0xC4, 0x42, 0x12, 0x60, 0x1C, 0x20, 0x03, 0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x58, 
-    0x72, 0x30, 0xD0, 0x81, 0x15, 0x00, 0x20, 0x03, 0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 
-    0x26, 0x00, 0x53, 0x84, 0x4A, 0x84, 0x6C, 0xDE, 0x20, 0x4A, 0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x75, 
-    0x2F, 0x03, 0x26, 0x2F, 0x00, 0x0C, 0x20, 0x03, 0x5E, 0x80, 0x90, 0xAF, 0x00, 0x08, 0x72, 0x07, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x58, 0x26, 0x00, 0x20, 0x2F, 0x00, 0x10, 0x5E, 0x80, 0x90, 0x83, 
-    0x72, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x26, 0x1F, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1C, 0x38, 0x28, 0x6E, 0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x1A, 0x2E, 0x00, 0x10, 
-    0x24, 0x6E, 0x00, 0x12, 0x26, 0x2E, 0x00, 0x16, 0x10, 0x05, 0x48, 0x80, 0x48, 0xC0, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x70, 0x03, 0xAA, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x79, 0x00, 0x16, 
-    0x00, 0x00, 0x00, 0x25, 0x03, 0x90, 0x00, 0x00, 0x00, 0x41, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x42, 
-    0x00, 0xDC, 0x00, 0x00, 0x00, 0x44, 0x01, 0x34, 0x00, 0x00, 0x00, 0x48, 0x01, 0x58, 0x00, 0x00, 
-    0x00, 0x49, 0x01, 0x6E, 0x00, 0x00, 0x00, 0x4D, 0x01, 0xD2, 0x00, 0x00, 0x00, 0x53, 0x02, 0x0E, 
-    0x00, 0x00, 0x00, 0x55, 0x02, 0x22, 0x00, 0x00, 0x00, 0x57, 0x02, 0x66, 0x00, 0x00, 0x00, 0x58, 
-    0x02, 0xB2, 0x00, 0x00, 0x00, 0x59, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x5A, 0x03, 0x0E, 0x00, 0x00, 
-    0x00, 0x61, 0x00, 0x38, 0x00, 0x00, 0x00, 0x62, 0x00, 0x74, 0x00, 0x00, 0x00, 0x63, 0x00, 0xB0, 
-    0x00, 0x00, 0x00, 0x64, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x6A, 0x01, 0x50, 0x00, 0x00, 0x00, 0x6D, 
-    0x01, 0x6A, 0x00, 0x00, 0x00, 0x70, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x77, 0x02, 0x08, 0x00, 0x00, 
-    0x00, 0x78, 0x02, 0x4E, 0x00, 0x00, 0x00, 0x79, 0x02, 0x8C, 0x2F, 0x0A, 0x20, 0x2C, 0x00, 0x18, 
-    0xD0, 0x80, 0x2F, 0x00, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x01, 0x43, 0xCA, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x03, 0x04, 0x2F, 0x0A, 0x20, 0x2C, 0x00, 0x18, 
-    0xD0, 0x80, 0x52, 0x80, 0x2F, 0x00, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x01, 
-    0x43, 0xCA, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0xE2, 0x2F, 0x0A, 0x20, 0x2C, 
-    0x00, 0x10, 0xD0, 0x80, 0x2F, 0x00, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x01, 
-    0x43, 0xCA, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0xC2, 0x2F, 0x0A, 0x20, 0x2C, 
-    0x00, 0x10, 0xD0, 0x80, 0x52, 0x80, 0x2F, 0x00, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x10, 0x4E, 0xB9, 
-    0x00, 0x01, 0x43, 0xCA, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0xA0, 0x2F, 0x0A, 
-    0x42, 0xA7, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 0x43, 0xCA, 0x26, 0x48, 
-    0x20, 0x12, 0x44, 0x80, 0x24, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0x80, 0x70, 0x02, 
-    0x24, 0x80, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x0C, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0x64, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 
-    0x2F, 0x2C, 0x00, 0x0C, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x20, 0x43, 
-    0x0C, 0x10, 0x00, 0x30, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 0x02, 0x42, 0x10, 0xBC, 0x00, 0x20, 
-    0x60, 0x00, 0x02, 0x3A, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x08, 0x2F, 0x03, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x02, 0x1E, 
-    0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 0x70, 0x0B, 0xD0, 0xAC, 0x00, 0x08, 0x72, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x58, 0x52, 0x80, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0xF4, 0x70, 0x03, 0x24, 0x80, 0x2F, 0x00, 
-    0x20, 0x2C, 0x00, 0x1C, 0x52, 0x80, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0xD4, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 
-    0x20, 0x2C, 0x00, 0x10, 0x52, 0x80, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0xB4, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 
-    0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x01, 0x98, 0x2F, 0x0A, 0x70, 0x0C, 0xB0, 0xAC, 0x00, 0x08, 0x5F, 0xC0, 
-    0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x20, 0x44, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x01, 
-    0x43, 0xCA, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x72, 0x70, 0x02, 0x24, 0x80, 
-    0x2F, 0x00, 0x2F, 0x14, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x01, 0x58, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x1C, 
-    0x2F, 0x2C, 0x00, 0x18, 0x42, 0xA7, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0xB4, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x01, 0x2A, 0x70, 0x01, 0x24, 0x80, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x18, 0x2F, 0x03, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x0E, 
-    0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x1C, 0x2F, 0x2C, 0x00, 0x18, 0x48, 0x78, 
-    0x00, 0x01, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0xB4, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x2F, 0x03, 
-    0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xDE, 
-    0x2F, 0x0A, 0x48, 0x78, 0x00, 0x01, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x01, 
-    0x43, 0xCA, 0x26, 0x48, 0x20, 0x12, 0x44, 0x80, 0x24, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x00, 0xBC, 0x2F, 0x0A, 0x48, 0x78, 0x00, 0x02, 0x20, 0x44, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x01, 0x43, 0xCA, 0x26, 0x48, 0x20, 0x12, 0x44, 0x80, 0x24, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x00, 0x9A, 0x70, 0x02, 0x24, 0x80, 0x2F, 0x00, 0x20, 0x2C, 0x00, 0x14, 0x72, 0x64, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x58, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0x6E, 
-    0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x74, 0x70, 0x04, 0x24, 0x80, 0x2F, 0x00, 0x20, 0x2C, 
-    0x00, 0x14, 0x06, 0x80, 0x00, 0x00, 0x07, 0x6C, 0x2F, 0x00, 0x2F, 0x03, 0x4E, 0xB9, 0x00, 0x01, 
-    0x3F, 0x6E, 0x26, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x52, 0x20, 0x44, 0x20, 0x68, 0x00, 0x14, 
-    0x4A, 0x10, 0x66, 0x0C, 0x4E, 0xB9, 0x00, 0x01, 0x45, 0x6A, 0x22, 0x44, 0x23, 0x48, 0x00, 0x14, 
-    0x2F, 0x0A, 0x4A, 0xAC, 0x00, 0x20, 0x5E, 0xC0, 0x44, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 
-    0x20, 0x44, 0x2F, 0x28, 0x00, 0x14, 0x4E, 0xB9, 0x00, 0x01, 0x43, 0xCA, 0x26, 0x48, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x18, 0x47, 0xED, 0xFF, 0xD4, 0x70, 0x01, 0x24, 0x80, 0x60, 0x0E, 0x20, 0x43, 
-    0x10, 0x85, 0x42, 0x28, 0x00, 0x01, 0x26, 0x43, 0x70, 0x02, 0x24, 0x80, 0x20, 0x4B, 0x4C, 0xDF, 
-    0x1C, 0x38, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x18, 0x38, 0x24, 0x6E, 
-    0x00, 0x08, 0x28, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x4A, 0x12, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x06, 0x10, 0x1A, 0x48, 0x80, 0x48, 0xC0, 0x16, 0x00, 0x10, 0x03, 0x48, 0x80, 0x48, 0xC0, 
-    0x2F, 0x00, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x3D, 0x56, 0x26, 0x48, 0x20, 0x08, 0x50, 0x4F, 
-    0x66, 0x10, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x20, 0x4A, 0xD1, 0xC0, 
-    0x26, 0x48, 0x4A, 0x84, 0x6E, 0x0A, 0x20, 0x4B, 0x91, 0xCA, 0x28, 0x88, 0x20, 0x4A, 0x60, 0x14, 
-    0x4A, 0x13, 0x66, 0x08, 0x70, 0x01, 0x28, 0x80, 0x20, 0x4B, 0x60, 0x08, 0x53, 0x84, 0x24, 0x4B, 
-    0x52, 0x8A, 0x60, 0xB6, 0x4C, 0xDF, 0x1C, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 0x48, 0xE7, 0x18, 0x20, 
-    0x24, 0x6F, 0x00, 0x10, 0x76, 0x01, 0x60, 0x2C, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 
-    0x10, 0x30, 0x00, 0x00, 0x72, 0x12, 0xC0, 0x81, 0x67, 0x12, 0x41, 0xED, 0xFF, 0xDC, 0x11, 0x92, 
-    0x38, 0x00, 0x20, 0x03, 0x58, 0x80, 0x11, 0x9A, 0x08, 0x00, 0x60, 0x06, 0x91, 0xC8, 0x60, 0x00, 
-    0x00, 0xF0, 0x52, 0x83, 0x70, 0x03, 0xB6, 0x80, 0x6F, 0xCE, 0x0C, 0x12, 0x00, 0x2D, 0x67, 0x0A, 
-    0x0C, 0x12, 0x00, 0x2B, 0x67, 0x04, 0x70, 0x2B, 0x60, 0x06, 0x10, 0x1A, 0x48, 0x80, 0x48, 0xC0, 
-    0x1B, 0x40, 0xFF, 0xE5, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 
-    0x72, 0x20, 0xC0, 0x81, 0x66, 0x06, 0x91, 0xC8, 0x60, 0x00, 0x00, 0xB6, 0x18, 0x1A, 0x48, 0x84, 
-    0x48, 0xC4, 0x72, 0xD0, 0xD8, 0x81, 0x10, 0x12, 0x48, 0x80, 0x10, 0x30, 0x00, 0x00, 0x72, 0x20, 
-    0xC0, 0x81, 0x67, 0x18, 0x20, 0x04, 0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x12, 0x1A, 
-    0x48, 0x81, 0x48, 0xC1, 0xD2, 0x80, 0x70, 0xD0, 0xD2, 0x80, 0x28, 0x01, 0x20, 0x04, 0x72, 0x3C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x4A, 0x28, 0x00, 0x76, 0x0D, 0x60, 0x24, 0x20, 0x04, 0x72, 0x0A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x58, 0x72, 0x30, 0xD0, 0x81, 0x41, 0xED, 0xFF, 0xDC, 0x11, 0x80, 
-    0x38, 0x00, 0x53, 0x83, 0x20, 0x04, 0x72, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x28, 0x00, 
-    0x70, 0x0A, 0xB6, 0x80, 0x6C, 0xD6, 0x10, 0x12, 0x48, 0x80, 0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 
-    0x00, 0x00, 0x72, 0x12, 0xC0, 0x81, 0x67, 0x2C, 0x76, 0x05, 0x60, 0x22, 0x10, 0x12, 0x48, 0x80, 
-    0x20, 0x6D, 0xF7, 0xA4, 0x10, 0x30, 0x00, 0x00, 0x72, 0x12, 0xC0, 0x81, 0x67, 0x0A, 0x41, 0xED, 
-    0xFF, 0xDC, 0x11, 0x9A, 0x38, 0x00, 0x60, 0x04, 0x91, 0xC8, 0x60, 0x14, 0x52, 0x83, 0x70, 0x07, 
-    0xB6, 0x80, 0x6F, 0xD8, 0x4A, 0x12, 0x67, 0x04, 0x91, 0xC8, 0x60, 0x04, 0x41, 0xED, 0xFF, 0xDC, 
-    0x4C, 0xDF, 0x04, 0x18, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0A, 0x4A, 0xAD, 0xEF, 0xBC, 
-    0x66, 0x5E, 0x48, 0x6D, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xDE, 0x24, 0x48, 0x20, 0x08, 
-    0x58, 0x4F, 0x67, 0x2C, 0x20, 0x4A, 0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x52, 0x80, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x01, 0x37, 0xD4, 0x2B, 0x48, 0xEF, 0xBC, 0x20, 0x08, 0x58, 0x4F, 
-    0x67, 0x2E, 0x20, 0x6D, 0xEF, 0xBC, 0x22, 0x4A, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x60, 0x20, 
-    0x48, 0x6D, 0xFF, 0xF5, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xDE, 0x24, 0x48, 0x20, 0x08, 0x58, 0x4F, 
-    0x67, 0x0E, 0x2F, 0x0A, 0x4E, 0xB9, 0x00, 0x01, 0x44, 0x40, 0x2B, 0x48, 0xEF, 0xBC, 0x58, 0x4F, 
-    0x4A, 0xAD, 0xEF, 0xBC, 0x66, 0x06, 0x2B, 0x6D, 0xFF, 0xD8, 0xEF, 0xBC, 0x20, 0x6D, 0xEF, 0xBC, 
-    0x24, 0x5F, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xE4, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 
-    0x00, 0x08, 0x2A, 0x2E, 0x00, 0x0C, 0x24, 0x6E, 0x00, 0x10, 0x2E, 0x0B, 0x99, 0xCC, 0x20, 0x4A, 
-    0x70, 0xFF, 0x52, 0x80, 0x4A, 0x18, 0x66, 0xFA, 0x26, 0x00, 0x7C, 0x00, 0x3D, 0x6D, 0xEF, 0xC0, 
-    0xFF, 0xFA, 0x60, 0x00, 0x00, 0xC2, 0x4A, 0x83, 0x66, 0x06, 0x24, 0x4C, 0x99, 0xCC, 0x26, 0x06, 
-    0x48, 0x6E, 0xFF, 0xFA, 0x2F, 0x03, 0x2F, 0x0A, 0x48, 0x6E, 0xFF, 0xF9, 0x4E, 0xB9, 0x00, 0x01, 
-    0x38, 0x76, 0x28, 0x00, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x6E, 0x02, 0x28, 0x03, 0xD5, 0xC4, 
-    0x96, 0x84, 0x0C, 0x2E, 0x00, 0x25, 0xFF, 0xF9, 0x66, 0x04, 0x4A, 0x83, 0x66, 0x24, 0xBA, 0x84, 
-    0x64, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xA0, 0x20, 0x4B, 0x22, 0x4A, 0x93, 0xC4, 0x22, 0x04, 
-    0x20, 0x08, 0x4A, 0x81, 0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xD7, 0xC4, 0x9A, 0x84, 
-    0x60, 0x64, 0x48, 0x6E, 0xFF, 0xE4, 0x48, 0x6E, 0xFF, 0xFC, 0x1F, 0x12, 0x2F, 0x2E, 0x00, 0x18, 
-    0x2F, 0x2E, 0x00, 0x14, 0x4E, 0xB9, 0x00, 0x01, 0x3F, 0xE0, 0x28, 0x08, 0x52, 0x8A, 0x53, 0x83, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x12, 0x6F, 0x28, 0xBA, 0xAE, 0xFF, 0xFC, 0x64, 0x04, 
-    0x70, 0x00, 0x60, 0x52, 0x20, 0x4B, 0x22, 0x44, 0x22, 0x2E, 0xFF, 0xFC, 0x20, 0x08, 0x4A, 0x81, 
-    0x67, 0x06, 0x10, 0xD9, 0x53, 0x81, 0x66, 0xFA, 0xD7, 0xEE, 0xFF, 0xFC, 0x9A, 0xAE, 0xFF, 0xFC, 
-    0x60, 0x14, 0x20, 0x0C, 0x67, 0x04, 0x70, 0x00, 0x60, 0x2C, 0x28, 0x4A, 0x24, 0x44, 0x2C, 0x03, 
-    0x26, 0x2E, 0xFF, 0xFC, 0x44, 0x83, 0x4A, 0x83, 0x66, 0x00, 0xFF, 0x3C, 0x20, 0x0C, 0x67, 0x06, 
-    0x4A, 0x86, 0x66, 0x00, 0xFF, 0x32, 0x4A, 0x85, 0x66, 0x04, 0x70, 0x00, 0x60, 0x08, 0x42, 0x13, 
-    0x20, 0x4B, 0x91, 0xC7, 0x20, 0x08, 0x4C, 0xDF, 0x1C, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x4F, 0xEF, 
-    0xFF, 0xF6, 0x2E, 0xAF, 0x00, 0x12, 0x2F, 0x6F, 0x00, 0x16, 0x00, 0x04, 0x3F, 0x6F, 0x00, 0x1A, 
-    0x00, 0x08, 0x2F, 0x2F, 0x00, 0x0E, 0x48, 0x6F, 0x00, 0x04, 0x2F, 0x2F, 0x00, 0x24, 0x3F, 0x3C, 
-    0x00, 0x0B, 0xA9, 0xEB, 0x4F, 0xEF, 0x00, 0x0A, 0x4E, 0x75, 0x2F, 0x2F, 0x00, 0x04, 0x2F, 0x2F, 
-    0x00, 0x0C, 0x2F, 0x2F, 0x00, 0x14, 0x3F, 0x3C, 0x00, 0x03, 0xA9, 0xEE, 0x2F, 0x2F, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x1D, 0x88, 0x58, 0x4F, 0x4E, 0x75, 0x22, 0x1F, 0x20, 0x17, 0x2E, 0x81, 
-    0x2F, 0x0B, 0x3F, 0x03, 0x4A, 0x80, 0x66, 0x00, 0x00, 0x80, 0x42, 0x38, 0x0A, 0x5E, 0x59, 0x4F, 
-    0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x42, 0x67, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x12, 0x26, 0x40, 
-    0x42, 0x43, 0x55, 0x4F, 0xA9, 0x94, 0x55, 0x4F, 0x2F, 0x0B, 0xA9, 0xA4, 0xBF, 0x4F, 0x67, 0x3C, 
-    0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xA0, 0x20, 0x1F, 
-    0x67, 0x0A, 0x50, 0xF8, 0x0A, 0x5E, 0x2B, 0x40, 0xFF, 0xF8, 0x60, 0x74, 0x59, 0x4F, 0x2F, 0x3C, 
-    0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x08, 0x26, 0x40, 
-    0x36, 0x3C, 0x00, 0x02, 0x60, 0x06, 0x50, 0xF8, 0x0A, 0x5E, 0x60, 0x54, 0x50, 0xF8, 0x0A, 0x5E, 
-    0x22, 0x13, 0x67, 0x04, 0x2F, 0x0B, 0xA9, 0xA3, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 
-    0x3F, 0x03, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x38, 0x2B, 0x40, 0xFF, 0xF8, 0x20, 0x40, 0xA0, 0x29, 
-    0x26, 0x6D, 0xFF, 0xF8, 0x26, 0x53, 0x36, 0x13, 0x6F, 0x26, 0x30, 0x03, 0xD0, 0x40, 0xD0, 0x40, 
-    0x36, 0xC0, 0x58, 0x40, 0x36, 0xC0, 0x53, 0x43, 0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x55, 0x52, 0x53, 
-    0x3F, 0x13, 0xA9, 0xA0, 0x26, 0xDF, 0x57, 0xCB, 0xFF, 0xF0, 0x66, 0x04, 0x42, 0xAD, 0xFF, 0xF8, 
-    0x36, 0x1F, 0x26, 0x5F, 0x4E, 0x75, 0x20, 0x5F, 0x24, 0x1F, 0x6A, 0x0C, 0x02, 0x42, 0x00, 0x1F, 
-    0x66, 0x04, 0x72, 0xFC, 0x60, 0x0A, 0x4E, 0xD0, 0x02, 0x42, 0x00, 0x1F, 0x66, 0xF8, 0x72, 0x04, 
-    0x2F, 0x08, 0x20, 0x2D, 0xFF, 0xF8, 0x66, 0x10, 0x3F, 0x01, 0x42, 0xA7, 0x4E, 0xBA, 0xFF, 0x0C, 
-    0x32, 0x1F, 0x20, 0x2D, 0xFF, 0xF8, 0x67, 0x22, 0x22, 0x40, 0x22, 0x51, 0x34, 0x29, 0x00, 0x02, 
-    0xD4, 0x41, 0x66, 0x04, 0x34, 0x11, 0x60, 0x06, 0xB4, 0x51, 0x6F, 0x02, 0x74, 0x04, 0x33, 0x42, 
-    0x00, 0x02, 0x22, 0x71, 0x20, 0x00, 0x2F, 0x11, 0xA8, 0x51, 0x4E, 0x75, 0x24, 0x2D, 0xFF, 0xFC, 
-    0x20, 0x5F, 0x30, 0x1F, 0x48, 0xC0, 0x6E, 0x04, 0x6D, 0x0C, 0x74, 0x00, 0xD4, 0x80, 0x2B, 0x42, 
-    0xFF, 0xFC, 0x4E, 0xFA, 0xFF, 0xA4, 0xD4, 0x80, 0x2B, 0x42, 0xFF, 0xFC, 0x4E, 0xFA, 0xFF, 0x8E, 
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x35, 0xA8, 0x00, 0x00, 0x19, 0xC0, 0x00, 0x00, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x45, 0x9B, 
-    0x00, 0x00, 0x41, 0x72, 0xFF, 0xFF, 0xEF, 0xC2, 0x42, 0x80, 0x20, 0x53, 0x81, 0x53, 0x48, 0x01, 
-    0xEF, 0xD6, 0x43, 0x80, 0x81, 0x42, 0x01, 0xE7, 0x3C, 0x5C, 0x80, 0x01, 0x45, 0x83, 0x46, 0x53, 
-    0x59, 0x53, 0x41, 0x81, 0x0F, 0xD4, 0x41, 0x81, 0x0F, 0xD6, 0x41, 0x81, 0x0F, 0xD8, 0x41, 0x81, 
-    0x0F, 0xDA, 0x41, 0x85, 0x0F, 0xDC, 0x43, 0x4F, 0x4E, 0x53, 0x41, 0x81, 0x0F, 0xC8, 0x41, 0x81, 
-    0x0F, 0xCA, 0x41, 0x81, 0x0F, 0xCC, 0x41, 0x81, 0x0F, 0xCE, 0x41, 0x85, 0x0F, 0xD0, 0x53, 0x59, 
-    0x53, 0x54, 0x41, 0x81, 0x0F, 0xDE, 0x41, 0x81, 0x0F, 0xE0, 0x41, 0x81, 0x0F, 0xE2, 0x41, 0x81, 
-    0x0F, 0xE4, 0x41, 0x81, 0x0F, 0xE6, 0x6D, 0x01, 0x00, 0x00, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 
-    0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 
-    0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 
-    0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 
-    0x40, 0x41, 0x81, 0x1B, 0x40, 0x41, 0x81, 0x1B, 0x40, 0x7F, 0x43, 0x81, 0xE1, 0xA0, 0x41, 0x81, 
-    0xE1, 0xA0, 0x41, 0x81, 0xE1, 0xA0, 0x41, 0x81, 0xE1, 0xA0, 0x41, 0x80, 0xEF, 0x41, 0x80, 0x11, 
-    0x55, 0x80, 0x80, 0x54, 0x81, 0xE1, 0xA0, 0x41, 0xA5, 0xE0, 0x4E, 0xC0, 0x0F, 0xE0, 0x8F, 0xC0, 
-    0x0C, 0xE9, 0x9C, 0x00, 0x0F, 0xE2, 0x4C, 0xC0, 0x10, 0xE5, 0x9C, 0x20, 0x30, 0xE3, 0x12, 0x0C, 
-    0x01, 0x15, 0x9C, 0xC0, 0x34, 0x00, 0x8C, 0xC0, 0x00, 0xE0, 0x8C, 0xC0, 0x01, 0xE3, 0xA0, 0x41, 
-    0x81, 0xE3, 0x53, 0x41, 0x8C, 0xD1, 0xA0, 0xF0, 0x0E, 0xE4, 0x8C, 0x00, 0x04, 0xE2, 0x53, 0x30, 
-    0x04, 0xEA, 0x11, 0x80, 0xFB, 0x11, 0x83, 0xF1, 0x18, 0xE1, 0xA0, 0x41, 0x8A, 0xE5, 0x9F, 0x10, 
-    0x30, 0xE2, 0x4F, 0xB0, 0x10, 0xE0, 0x5B, 0x10, 0x20, 0x01, 0x8C, 0xA0, 0xF0, 0x0E, 0xE5, 0x9F, 
-    0xB0, 0x24, 0xE0, 0x8B, 0xB0, 0x01, 0xE2, 0x8F, 0x20, 0x20, 0x98, 0xE4, 0x92, 0x00, 0x04, 0xE3, 
-    0x70, 0x00, 0x01, 0xD1, 0xA0, 0xF0, 0x0E, 0xE7, 0x9B, 0x30, 0x00, 0xE0, 0x83, 0x30, 0x01, 0xE7, 
-    0x8B, 0x30, 0x00, 0xEA, 0x11, 0x80, 0xF8, 0x43, 0x01, 0xF1, 0x9C, 0x42, 0x82, 0x44, 0xE1, 0xA0, 
-    0x41, 0x99, 0xE0, 0x4E, 0xC0, 0x0F, 0xE0, 0x8F, 0xC0, 0x0C, 0xE2, 0x4C, 0xC0, 0x0C, 0xE5, 0x1F, 
-    0x00, 0x18, 0xE5, 0x8C, 0x00, 0x04, 0xE5, 0x9C, 0x90, 0x2C, 0xE3, 0x59, 0x41, 0x80, 0x0A, 0x41, 
-    0x89, 0x18, 0xE5, 0x9C, 0x00, 0x20, 0xE0, 0x89, 0x90, 0x00, 0xEF, 0x41, 0x8D, 0x10, 0xE2, 0x8F, 
-    0x20, 0x80, 0xE4, 0x92, 0x00, 0x04, 0xE3, 0x70, 0x00, 0x01, 0x1A, 0x11, 0x89, 0xFC, 0xE0, 0x41, 
-    0x30, 0x09, 0xE0, 0x53, 0x00, 0x02, 0xDA, 0x41, 0x99, 0x0E, 0xE3, 0xC0, 0x00, 0x0F, 0xE0, 0x82, 
-    0x30, 0x00, 0xE2, 0x4F, 0x80, 0x04, 0xE9, 0x32, 0x00, 0xF0, 0xE9, 0x23, 0x00, 0xF0, 0xE1, 0x52, 
-    0x00, 0x08, 0xCA, 0x11, 0x95, 0xFB, 0xE0, 0x8F, 0x40, 0x00, 0xE1, 0xA0, 0xF0, 0x04, 0xE9, 0x32, 
-    0x00, 0xF0, 0xE9, 0x23, 0x00, 0xF0, 0xE1, 0x52, 0x00, 0x0C, 0xCA, 0x11, 0x8F, 0xFB, 0xE0, 0x8C, 
-    0xC0, 0x00, 0xE0, 0x8E, 0xE0, 0x00, 0xE5, 0x9C, 0x10, 0x28, 0xE0, 0x5C, 0x10, 0x20, 0x01, 0x91, 
-    0xA0, 0xF0, 0x0E, 0xE5, 0x8C, 0xC0, 0x28, 0xE2, 0x8F, 0x20, 0x18, 0xE4, 0x92, 0x00, 0x04, 0xE3, 
-    0x70, 0x00, 0x20, 0x01, 0x8F, 0xA0, 0xF0, 0x0E, 0xE7, 0x9C, 0x30, 0x00, 0xE0, 0x83, 0x30, 0x01, 
-    0xE7, 0x8C, 0x30, 0x00, 0xEA, 0x11, 0x80, 0xF8, 0x11, 0x81, 0xF1, 0xE8, 0x42, 0x80, 0xB8, 0x01, 
-    0xEE, 0xA4, 0x11, 0x81, 0xEE, 0xA4, 0x4D, 0x81, 0x35, 0x86, 0x11, 0x81, 0xEE, 0x8C, 0x11, 0x81, 
-    0xEE, 0x84, 0x20, 0x21, 0x11, 0x90, 0xEE, 0x38, 0x00, 0x01, 0x3D, 0x7C, 0x78, 0x63, 0x6F, 0x6E, 
-    0x66, 0x69, 0x67, 0x78, 0x0C, 0x04, 0x10, 0x42, 0x80, 0x80, 0x42, 0x81, 0x35, 0x76, 0x41, 0x81, 
-    0x35, 0x66, 0x41, 0x81, 0x35, 0x64, 0x41, 0x81, 0x35, 0x64, 0x42, 0x84, 0x01, 0x00, 0x01, 0x02, 
-    0x04, 0x42, 0x10, 0x45, 0x80, 0x32, 0x42, 0x80, 0x01, 0x46, 0x81, 0x31, 0xFC, 0x41, 0x80, 0x02, 
-    0x46, 0x81, 0x31, 0xF6, 0x41, 0x80, 0x04, 0x46, 0x81, 0x31, 0xEF, 0x41, 0x80, 0x08, 0x46, 0x81, 
-    0x31, 0xE8, 0x41, 0x80, 0x10, 0x46, 0x81, 0x31, 0xE2, 0x41, 0x80, 0x20, 0x46, 0x81, 0x31, 0xD8, 
-    0x41, 0x80, 0x40, 0x46, 0x81, 0x31, 0xD4, 0x41, 0x80, 0x80, 0x46, 0x83, 0x31, 0xCE, 0x00, 0x01, 
-    0x41, 0x80, 0x02, 0x44, 0x83, 0x31, 0xC4, 0x00, 0x02, 0x41, 0x80, 0x02, 0x44, 0x83, 0x31, 0xBA, 
-    0x00, 0x04, 0x41, 0x80, 0x02, 0x44, 0x83, 0x31, 0xB4, 0x00, 0x08, 0x41, 0x80, 0x02, 0x44, 0x83, 
-    0x31, 0xA2, 0x00, 0x10, 0x41, 0x80, 0x02, 0x44, 0x83, 0x31, 0x9C, 0x00, 0x20, 0x41, 0x80, 0x02, 
-    0x44, 0x83, 0x31, 0x8F, 0x00, 0x40, 0x41, 0x80, 0x02, 0x44, 0x83, 0x31, 0x78, 0x00, 0x10, 0x41, 
-    0x80, 0x01, 0x44, 0x83, 0x31, 0x72, 0x00, 0x20, 0x41, 0x80, 0x01, 0x44, 0x82, 0x31, 0x68, 0x0F, 
-    0x42, 0x80, 0x01, 0x44, 0x8F, 0x31, 0x5A, 0xE2, 0x8F, 0xE0, 0x01, 0xE1, 0x2F, 0xFF, 0x1E, 0xF0, 
-    0x00, 0xF8, 0x00, 0x47, 0x78, 0x41, 0x80, 0xEA, 0x11, 0x80, 0xFA, 0x43, 0x91, 0xE9, 0x2D, 0x40, 
-    0x00, 0xE2, 0x8F, 0xE0, 0x01, 0xE1, 0x2F, 0xFF, 0x1E, 0xF0, 0x00, 0xF8, 0x00, 0x47, 0x78, 0x41, 
-    0x85, 0xE8, 0xBD, 0x80, 0x00, 0x47, 0x78, 0x41, 0x80, 0xEB, 0x42, 0x87, 0xE5, 0x9F, 0xE0, 0x00, 
-    0xE1, 0x2F, 0xFF, 0x1E, 0x43, 0x87, 0xE5, 0x9F, 0xC0, 0x00, 0xE1, 0x2F, 0xFF, 0x1C, 0x43, 0x81, 
-    0x47, 0x78, 0x41, 0x80, 0xEA, 0x44, 0x80, 0x30, 0x46, 0x81, 0x2B, 0x53, 0x41, 0x80, 0x10, 0x42, 
-    0x80, 0x10, 0x42, 0x81, 0x2B, 0x50, 0x41, 0x80, 0x20, 0x42, 0x80, 0x20, 0x42, 0x81, 0x2B, 0x4D, 
-    0x42, 0x81, 0x40, 0x62, 0x20, 0x6F, 0x80, 0x6C, 0x41, 0x83, 0x76, 0x6F, 0x69, 0x64, 0x41, 0x83, 
-    0x63, 0x68, 0x61, 0x72, 0x41, 0x8D, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x00, 0x69, 0x6E, 0x74, 0x00, 
-    0x6C, 0x6F, 0x6E, 0x67, 0x41, 0x8B, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x00, 0x64, 0x6F, 0x75, 0x62, 
-    0x6C, 0x65, 0x41, 0x8B, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x00, 
-    0x21, 0x2E, 0x40, 0x9F, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x00, 0x75, 0x6E, 0x73, 0x69, 
-    0x67, 0x6E, 0x65, 0x64, 0x20, 0x00, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x00, 0x76, 0x6F, 0x6C, 0x61, 
-    0x74, 0x69, 0x6C, 0x65, 0x41, 0x87, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x00, 0x20, 0x3A, 
-    0x41, 0x81, 0x2C, 0x20, 0x41, 0x87, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x41, 0x20, 
-    0x5F, 0x81, 0x6F, 0x70, 0x43, 0x81, 0x01, 0x96, 0x41, 0x81, 0x01, 0x94, 0x41, 0x81, 0x01, 0x8E, 
-    0x41, 0x81, 0x01, 0x8C, 0x41, 0x81, 0x01, 0x86, 0x41, 0x81, 0x01, 0x84, 0x41, 0x81, 0x01, 0x7E, 
-    0x41, 0x81, 0x01, 0x7B, 0x41, 0x81, 0x01, 0x76, 0x41, 0x81, 0x01, 0x73, 0x41, 0x81, 0x01, 0x6E, 
-    0x41, 0x81, 0x01, 0x6C, 0x41, 0x81, 0x01, 0x66, 0x41, 0x81, 0x01, 0x63, 0x41, 0x81, 0x01, 0x5E, 
-    0x41, 0x81, 0x01, 0x5C, 0x41, 0x81, 0x01, 0x56, 0x41, 0x81, 0x01, 0x53, 0x41, 0x81, 0x01, 0x4E, 
-    0x41, 0x81, 0x01, 0x4C, 0x41, 0x81, 0x01, 0x46, 0x41, 0x81, 0x01, 0x43, 0x41, 0x81, 0x01, 0x3E, 
-    0x41, 0x81, 0x01, 0x3C, 0x41, 0x81, 0x01, 0x36, 0x41, 0x81, 0x01, 0x32, 0x41, 0x81, 0x01, 0x2B, 
-    0x41, 0x81, 0x01, 0x28, 0x41, 0x81, 0x01, 0x22, 0x41, 0x81, 0x01, 0x1E, 0x41, 0x81, 0x01, 0x18, 
-    0x41, 0x81, 0x01, 0x14, 0x41, 0x81, 0x01, 0x0E, 0x41, 0x81, 0x01, 0x0B, 0x41, 0x81, 0x01, 0x06, 
-    0x41, 0x81, 0x01, 0x04, 0x42, 0x80, 0xFE, 0x42, 0x80, 0xFC, 0x42, 0x80, 0xF6, 0x42, 0x80, 0xF4, 
-    0x42, 0x80, 0xEE, 0x42, 0x80, 0xEB, 0x42, 0x80, 0xE6, 0x42, 0x80, 0xE3, 0x42, 0x80, 0xDE, 0x42, 
-    0x80, 0xDC, 0x42, 0x80, 0xD6, 0x42, 0x80, 0xD3, 0x42, 0x80, 0xCE, 0x42, 0x80, 0xCC, 0x42, 0x80, 
-    0xC6, 0x42, 0x80, 0xC4, 0x42, 0x80, 0xBE, 0x42, 0x80, 0xBB, 0x42, 0x80, 0xB6, 0x42, 0x80, 0xB4, 
-    0x42, 0x80, 0xAF, 0x42, 0x80, 0xAC, 0x42, 0x80, 0xA7, 0x42, 0x80, 0xA4, 0x42, 0x80, 0x9E, 0x42, 
-    0x80, 0x9A, 0x42, 0x80, 0x94, 0x42, 0x80, 0x90, 0x42, 0x80, 0x8A, 0x42, 0x80, 0x86, 0x42, 0x80, 
-    0x80, 0x42, 0x80, 0x7C, 0x42, 0x80, 0x76, 0x42, 0x80, 0x73, 0x42, 0x80, 0x6E, 0x42, 0x80, 0x6A, 
-    0x42, 0x80, 0x64, 0x42, 0x80, 0x61, 0x42, 0x80, 0x5C, 0x42, 0x80, 0x59, 0x42, 0x80, 0x54, 0x42, 
-    0x80, 0x4F, 0x42, 0x80, 0x4A, 0x42, 0x80, 0x42, 0x25, 0x02, 0x37, 0x10, 0x2C, 0x08, 0x20, 0x02, 
-    0x2C, 0x08, 0x20, 0x10, 0x29, 0x08, 0x22, 0x02, 0x80, 0x10, 0x26, 0x08, 0x81, 0x10, 0x02, 0x29, 
-    0x08, 0x29, 0x02, 0x80, 0x08, 0x22, 0x02, 0x80, 0x10, 0x27, 0x08, 0x40, 0x27, 0x80, 0x23, 0x40, 
-    0x30, 0x80, 0x80, 0x04, 0x2D, 0x08, 0x28, 0x21, 0x25, 0x08, 0x24, 0x03, 0x32, 0x02, 0x24, 0x08, 
-    0x24, 0x11, 0x32, 0x10, 0x22, 0x08, 0x80, 0x80, 0x25, 0x02, 0x37, 0x10, 0x2C, 0x08, 0x20, 0x02, 
-    0x2C, 0x08, 0x20, 0x10, 0x29, 0x08, 0x22, 0x02, 0x80, 0x10, 0x26, 0x08, 0x81, 0x10, 0x02, 0x29, 
-    0x08, 0x29, 0x02, 0x80, 0x08, 0x22, 0x02, 0x80, 0x10, 0x27, 0x08, 0x40, 0x11, 0xCF, 0xF6, 0xA4, 
-    0x8A, 0x8C, 0x8D, 0x8E, 0x96, 0x9A, 0x9F, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 
-    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 
-    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xBE, 0xBF, 
-    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 
-    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0x88, 0x8B, 0x9B, 0x20, 0xCF, 
-    0x87, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0x20, 0xD8, 0xFF, 0xDA, 0xDB, 0xDC, 0xDD, 
-    0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0x89, 0x90, 0x87, 0x91, 0x8F, 0x92, 0x94, 0x95, 0x93, 
-    0x97, 0x99, 0xF0, 0x98, 0x9C, 0x9E, 0x9D, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 
-    0xFE, 0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 
-    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 
-    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 
-    0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 
-    0x3E, 0x3F, 0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 
-    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0xF3, 0x7A, 0x5B, 0x5C, 
-    0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 
-    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 
-    0x7D, 0x7E, 0x7F, 0x8A, 0x8C, 0x8D, 0x8E, 0x96, 0x9A, 0x9F, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 
-    0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 
-    0x9D, 0x9E, 0x9F, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 
-    0xAD, 0xBE, 0xBF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 
-    0xBD, 0xBE, 0xBF, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0x88, 0x8B, 
-    0x9B, 0x20, 0xCF, 0x87, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0x20, 0xD8, 0xA4, 0xDA, 
-    0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0x89, 0x90, 0x87, 0x91, 0x8F, 0x92, 
-    0x94, 0x95, 0x93, 0x97, 0x99, 0xF0, 0x98, 0x9C, 0x9E, 0x9D, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 
-    0xFB, 0xFC, 0xFD, 0xFE, 0x12, 0x81, 0xF8, 0x28, 0x41, 0xFF, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x02, 
-    0xE0, 0x03, 0xE0, 0x04, 0xE0, 0x05, 0xE0, 0x06, 0xE0, 0x07, 0xE0, 0x08, 0xE0, 0x09, 0xE0, 0x0A, 
-    0xE0, 0x0B, 0xE0, 0x0C, 0xE0, 0x0D, 0xE0, 0x0E, 0xE0, 0x0F, 0xE0, 0x10, 0xE0, 0x11, 0xE0, 0x12, 
-    0xE0, 0x13, 0xE0, 0x14, 0xE0, 0x15, 0xE0, 0x16, 0xE0, 0x17, 0xE0, 0x18, 0xE0, 0x19, 0xE0, 0x1A, 
-    0xE0, 0x1B, 0xE0, 0x1C, 0xE0, 0x1D, 0xE0, 0x1E, 0xE0, 0x1F, 0xE0, 0x20, 0xE0, 0x21, 0xE0, 0x22, 
-    0xE0, 0x23, 0xE0, 0x24, 0xE0, 0x25, 0xE0, 0x26, 0xE0, 0x27, 0xE0, 0x28, 0xE0, 0x29, 0xE0, 0x2A, 
-    0xE0, 0x2B, 0xE0, 0x2C, 0xE0, 0x2D, 0xE0, 0x2E, 0xE0, 0x2F, 0xE0, 0x30, 0xE0, 0x31, 0xE0, 0x32, 
-    0xE0, 0x33, 0xE0, 0x34, 0xE0, 0x35, 0xE0, 0x36, 0xE0, 0x37, 0xE0, 0x38, 0xE0, 0x39, 0xE0, 0x3A, 
-    0xE0, 0x3B, 0xE0, 0x3C, 0xE0, 0x3D, 0xE0, 0x3E, 0xE0, 0x3F, 0xFF, 0xE0, 0x40, 0xE0, 0x41, 0xE0, 
-    0x42, 0xE0, 0x43, 0xE0, 0x44, 0xE0, 0x45, 0xE0, 0x46, 0xE0, 0x47, 0xE0, 0x48, 0xE0, 0x49, 0xE0, 
-    0x4A, 0xE0, 0x4B, 0xE0, 0x4C, 0xE0, 0x4D, 0xE0, 0x4E, 0xE0, 0x4F, 0xE0, 0x50, 0xE0, 0x51, 0xE0, 
-    0x52, 0xE0, 0x53, 0xE0, 0x54, 0xE0, 0x55, 0xE0, 0x56, 0xE0, 0x57, 0xE0, 0x58, 0xE0, 0x59, 0xE0, 
-    0x5A, 0xE0, 0x5B, 0xE0, 0x5C, 0xE0, 0x5D, 0xE0, 0x5E, 0xE0, 0x5F, 0xE0, 0x60, 0xE0, 0x61, 0xE0, 
-    0x62, 0xE0, 0x63, 0xE0, 0x64, 0xE0, 0x65, 0xE0, 0x66, 0xE0, 0x67, 0xE0, 0x68, 0xE0, 0x69, 0xE0, 
-    0x6A, 0xE0, 0x6B, 0xE0, 0x6C, 0xE0, 0x6D, 0xE0, 0x6E, 0xE0, 0x6F, 0xE0, 0x70, 0xE0, 0x71, 0xE0, 
-    0x72, 0xE0, 0x73, 0xE0, 0x74, 0xE0, 0x75, 0xE0, 0x76, 0xE0, 0x77, 0xE0, 0x78, 0xE0, 0x79, 0xE0, 
-    0x7A, 0xE0, 0x7B, 0xE0, 0x7C, 0xE0, 0x7D, 0xE0, 0x7E, 0xE0, 0x7F, 0xFF, 0xE0, 0x80, 0xE0, 0x81, 
-    0xE0, 0x82, 0xE0, 0x83, 0xE0, 0x84, 0xE0, 0x85, 0xE0, 0x86, 0xE0, 0x87, 0xE0, 0x88, 0xE0, 0x89, 
-    0xE0, 0x8A, 0xE0, 0x8B, 0xE0, 0x8C, 0xE0, 0x8D, 0xE0, 0x8E, 0xE0, 0x8F, 0xE0, 0x90, 0xE0, 0x91, 
-    0xE0, 0x92, 0xE0, 0x93, 0xE0, 0x94, 0xE0, 0x95, 0xE0, 0x96, 0xE0, 0x97, 0xE0, 0x98, 0xE0, 0x99, 
-    0xE0, 0x9A, 0xE0, 0x9B, 0xE0, 0x9C, 0xE0, 0x9D, 0xE0, 0x9E, 0xE0, 0x9F, 0xE0, 0xA0, 0xE0, 0xA1, 
-    0xE0, 0xA2, 0xE0, 0xA3, 0xE0, 0xA4, 0xE0, 0xA5, 0xE0, 0xA6, 0xE0, 0xA7, 0xE0, 0xA8, 0xE0, 0xA9, 
-    0xE0, 0xAA, 0xE0, 0xAB, 0xE0, 0xAC, 0xE0, 0xAD, 0xE0, 0xAE, 0xE0, 0xAF, 0xE0, 0xB0, 0xE0, 0xB1, 
-    0xE0, 0xB2, 0xE0, 0xB3, 0xE0, 0xB4, 0xE0, 0xB5, 0xE0, 0xB6, 0xE0, 0xB7, 0xE0, 0xB8, 0xE0, 0xB9, 
-    0xE0, 0xBA, 0xE0, 0xBB, 0xE0, 0xBC, 0xE0, 0xBD, 0xE0, 0xBE, 0xE0, 0xBF, 0xBF, 0xE0, 0xC0, 0xE0, 
-    0xC1, 0xE0, 0xC2, 0xE0, 0xC3, 0xE0, 0xC4, 0xE0, 0xC5, 0xE0, 0xC6, 0xE0, 0xC7, 0xE0, 0xC8, 0xE0, 
-    0xC9, 0xE0, 0xCA, 0xE0, 0xCB, 0xE0, 0xCC, 0xE0, 0xCD, 0xE0, 0xCE, 0xE0, 0xCF, 0xE0, 0xD0, 0xE0, 
-    0xD1, 0xE0, 0xD2, 0xE0, 0xD3, 0xE0, 0xD4, 0xE0, 0xD5, 0xE0, 0xD6, 0xE0, 0xD7, 0xE0, 0xD8, 0xE0, 
-    0xD9, 0xE0, 0xDA, 0xE0, 0xDB, 0xE0, 0xDC, 0xE0, 0xDD, 0xE0, 0xDE, 0xE0, 0xDF, 0x21, 0xE0, 0xBE, 
-    0xE1, 0xE0, 0xE2, 0xE0, 0xE3, 0xE0, 0xE4, 0xE0, 0xE5, 0xE0, 0xE6, 0xE0, 0xE7, 0xE0, 0xE8, 0xE0, 
-    0xE9, 0xE0, 0xEA, 0xE0, 0xEB, 0xE0, 0xEC, 0xE0, 0xED, 0xE0, 0xEE, 0xE0, 0xEF, 0xE0, 0xF0, 0xE0, 
-    0xF1, 0xE0, 0xF2, 0xE0, 0xF3, 0xE0, 0xF4, 0xE0, 0xF5, 0xE0, 0xF6, 0xE0, 0xF7, 0xE0, 0xF8, 0xE0, 
-    0xF9, 0xE0, 0xFA, 0xE0, 0xFB, 0xE0, 0xFC, 0xE0, 0xFD, 0xE0, 0xFE, 0xE0, 0xFF, 0x01, 0x00, 0x11, 
-    0x81, 0xF9, 0x2E, 0x77, 0x01, 0xF9, 0x2E, 0x7C, 0x80, 0x01, 0x45, 0x01, 0xFB, 0xE6, 0x11, 0x81, 
-    0xFB, 0xE6, 0x11, 0x81, 0xFB, 0xE6, 0x11, 0x81, 0xFB, 0xE6, 0x11, 0x81, 0xFB, 0xD2, 0x57, 0x83, 
-    0x04, 0x02, 0x00, 0x01, 0x43, 0x01, 0xFC, 0x1E, 0x11, 0x81, 0xFC, 0x1E, 0x11, 0x81, 0xFC, 0x1E, 
-    0x11, 0x81, 0xFC, 0x1E, 0x11, 0x81, 0xFC, 0x0A, 0x57, 0x83, 0x04, 0x02, 0x00, 0x02, 0x43, 0x01, 
-    0xFC, 0x56, 0x11, 0x81, 0xFC, 0x56, 0x11, 0x81, 0xFC, 0x56, 0x11, 0x81, 0xFC, 0x56, 0x11, 0x81, 
-    0xFC, 0x42, 0x53, 0x01, 0xFB, 0xB0, 0x11, 0x81, 0xFB, 0xE8, 0x11, 0x81, 0xFC, 0x20, 0x7F, 0x7F, 
-    0x7F, 0x7E, 0x80, 0x01, 0x42, 0x80, 0x02, 0x41, 0x11, 0x73, 0x8F, 0x30, 0x31, 0x32, 0x33, 0x34, 
-    0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x41, 0x8F, 0x30, 0x31, 0x32, 
-    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x41, 0x84, 0x20, 
-    0x2B, 0x2D, 0x23, 0x30, 0x43, 0x80, 0x01, 0x42, 0x80, 0x02, 0x42, 0x80, 0x04, 0x42, 0x80, 0x08, 
-    0x42, 0x80, 0x10, 0x43, 0x83, 0x68, 0x6C, 0x4C, 0x00, 0x3E, 0x20, 0x41, 0x3E, 0x30, 0x41, 0xA3, 
-    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 
-    0x77, 0x78, 0x79, 0x7A, 0x43, 0x85, 0x21, 0x15, 0x11, 0x0E, 0x0D, 0x0C, 0x20, 0x0B, 0x20, 0x0A, 
-    0x23, 0x09, 0x25, 0x08, 0x2B, 0x07, 0x40, 0x85, 0x3A, 0x41, 0x4D, 0x3A, 0x50, 0x4D, 0x41, 0xF9, 
-    0x3A, 0x53, 0x75, 0x6E, 0x3A, 0x53, 0x75, 0x6E, 0x64, 0x61, 0x79, 0x3A, 0x4D, 0x6F, 0x6E, 0x3A, 
-    0x4D, 0x6F, 0x6E, 0x64, 0x61, 0x79, 0x3A, 0x54, 0x75, 0x65, 0x3A, 0x54, 0x75, 0x65, 0x73, 0x64, 
-    0x61, 0x79, 0x3A, 0x57, 0x65, 0x64, 0x3A, 0x57, 0x65, 0x64, 0x6E, 0x65, 0x73, 0x64, 0x61, 0x79, 
-    0x3A, 0x54, 0x68, 0x75, 0x3A, 0x54, 0x68, 0x75, 0x72, 0x73, 0x64, 0x61, 0x79, 0x3A, 0x46, 0x72, 
-    0x69, 0x3A, 0x46, 0x72, 0x69, 0x64, 0x61, 0x79, 0x3A, 0x53, 0x61, 0x74, 0x3A, 0x53, 0x61, 0x74, 
-    0x75, 0x72, 0x64, 0x61, 0x79, 0x00, 0x7C, 0x25, 0x62, 0x20, 0x25, 0x44, 0x20, 0x25, 0x48, 0x3A, 
-    0x25, 0x4D, 0x3A, 0x25, 0x53, 0x20, 0x25, 0x59, 0x7C, 0x25, 0x62, 0x20, 0x25, 0x44, 0x20, 0x25, 
-    0x59, 0x7C, 0x25, 0x48, 0x3A, 0x25, 0x4D, 0x3A, 0x25, 0x53, 0x41, 0xFF, 0x3A, 0x4A, 0x61, 0x6E, 
-    0x3A, 0x4A, 0x61, 0x6E, 0x75, 0x61, 0x72, 0x79, 0x3A, 0x46, 0x65, 0x62, 0x3A, 0x46, 0x65, 0x62, 
-    0x72, 0x75, 0x61, 0x72, 0x79, 0x3A, 0x4D, 0x61, 0x72, 0x3A, 0x4D, 0x61, 0x72, 0x63, 0x68, 0x3A, 
-    0x41, 0x70, 0x72, 0x3A, 0x41, 0x70, 0x72, 0x69, 0x6C, 0x3A, 0x4D, 0x61, 0x79, 0x3A, 0x4D, 0x61, 
-    0x79, 0x3A, 0x4A, 0x75, 0x6E, 0x3A, 0x4A, 0x75, 0x6E, 0x65, 0x3A, 0x4A, 0x75, 0x6C, 0x3A, 0x4A, 
-    0x75, 0x6C, 0x79, 0x3A, 0x41, 0x75, 0x67, 0x3A, 0x41, 0x75, 0x67, 0x75, 0x73, 0x74, 0x3A, 0x53, 
-    0x65, 0x70, 0x3A, 0x53, 0x65, 0x70, 0x74, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x3A, 0x4F, 0x63, 0x74, 
-    0x3A, 0x4F, 0x63, 0x74, 0x6F, 0x62, 0x65, 0x72, 0x3A, 0x4E, 0x6F, 0x76, 0x3A, 0x4E, 0x6F, 0x76, 
-    0x65, 0x6D, 0x62, 0x65, 0x72, 0x3A, 0x44, 0x65, 0x63, 0x3A, 0x44, 0x65, 0x85, 0x63, 0x65, 0x6D, 
-    0x62, 0x65, 0x72, 0x41, 0x11, 0x81, 0xFE, 0x76, 0x11, 0x81, 0xFE, 0x7E, 0x11, 0x81, 0xFE, 0xD4, 
-    0x11, 0x81, 0xEF, 0x96, 0x11, 0x81, 0xFE, 0xFA, 0x11, 0x89, 0xEF, 0x94, 0x44, 0x61, 0x79, 0x20, 
-    0x4D, 0x6F, 0x6E, 0x20, 0x20, 0x64, 0x80, 0x20, 0x20, 0x68, 0x80, 0x3A, 0x20, 0x6D, 0x80, 0x3A, 
-    0x20, 0x73, 0x80, 0x20, 0x22, 0x79, 0x80, 0x0D, 0x41, 0x85, 0x25, 0x61, 0x20, 0x25, 0x63, 0x0D, 
-    0x43, 0x95, 0x1F, 0x00, 0x3B, 0x00, 0x5A, 0x00, 0x78, 0x00, 0x97, 0x00, 0xB5, 0x00, 0xD4, 0x00, 
-    0xF3, 0x01, 0x11, 0x01, 0x30, 0x01, 0x4E, 0x25, 0x42, 0x12, 0x8C, 0xD7, 0x3A, 0x45, 0x53, 0x54, 
-    0x3A, 0x45, 0x44, 0x54, 0x3A, 0x2B, 0x30, 0x33, 0x20, 0x30, 0x41, 0x8A, 0x54, 0x49, 0x4D, 0x45, 
-    0x5A, 0x4F, 0x4E, 0x45, 0x00, 0x54, 0x5A, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
-    0x00, 0x28, 0x40, 0x10, 0x81, 0x81, 0x28, 0x42, 0x81, 0x2F, 0x81, 0x42, 0x20, 0x5F, 0x40, 0x20, 
-    0x5F, 0x82, 0x64, 0x74, 0x00, 0x20, 0x5F, 0x81, 0x63, 0x74, 0x41, 0x87, 0x20, 0x64, 0x65, 0x6C, 
-    0x65, 0x74, 0x65, 0x00, 0x20, 0x5F, 0x87, 0x64, 0x6C, 0x00, 0x20, 0x6E, 0x65, 0x77, 0x00, 0x20, 
-    0x5F, 0x85, 0x6E, 0x77, 0x00, 0x5B, 0x5D, 0x00, 0x20, 0x5F, 0x85, 0x76, 0x63, 0x00, 0x28, 0x29, 
-    0x00, 0x20, 0x5F, 0x81, 0x63, 0x6C, 0x41, 0x83, 0x2D, 0x3E, 0x2A, 0x00, 0x20, 0x5F, 0x85, 0x72, 
-    0x6D, 0x00, 0x5E, 0x3D, 0x00, 0x20, 0x5F, 0x85, 0x61, 0x65, 0x72, 0x00, 0x26, 0x3D, 0x41, 0x20, 
-    0x5F, 0x20, 0x61, 0x81, 0x64, 0x00, 0x20, 0x3C, 0x81, 0x3D, 0x00, 0x20, 0x5F, 0x85, 0x61, 0x6C, 
-    0x73, 0x00, 0x2F, 0x3D, 0x41, 0x20, 0x5F, 0x85, 0x61, 0x64, 0x76, 0x00, 0x2D, 0x3D, 0x41, 0x20, 
-    0x5F, 0x86, 0x61, 0x6D, 0x69, 0x00, 0x2D, 0x3E, 0x00, 0x20, 0x5F, 0x82, 0x72, 0x66, 0x00, 0x20, 
-    0x2D, 0x40, 0x20, 0x5F, 0x20, 0x6D, 0x40, 0x81, 0x7E, 0x00, 0x20, 0x5F, 0x82, 0x63, 0x6F, 0x00, 
-    0x20, 0x7C, 0x40, 0x20, 0x5F, 0x20, 0x6F, 0x41, 0x81, 0x5E, 0x00, 0x20, 0x5F, 0x81, 0x65, 0x72, 
-    0x41, 0x81, 0x26, 0x00, 0x20, 0x5F, 0x85, 0x61, 0x64, 0x00, 0x3C, 0x3D, 0x00, 0x20, 0x5F, 0x81, 
-    0x6C, 0x65, 0x41, 0x81, 0x3C, 0x00, 0x20, 0x5F, 0x82, 0x6C, 0x74, 0x00, 0x20, 0x3D, 0x40, 0x20, 
-    0x5F, 0x82, 0x65, 0x71, 0x00, 0x20, 0x3C, 0x40, 0x20, 0x5F, 0x81, 0x6C, 0x73, 0x41, 0x81, 0x2B, 
-    0x00, 0x20, 0x5F, 0x81, 0x70, 0x6C, 0x41, 0x81, 0x2F, 0x00, 0x20, 0x5F, 0x81, 0x64, 0x76, 0x41, 
-    0x81, 0x2C, 0x00, 0x20, 0x5F, 0x85, 0x63, 0x6D, 0x00, 0x7C, 0x3D, 0x00, 0x20, 0x5F, 0x83, 0x61, 
-    0x6F, 0x72, 0x00, 0x20, 0x3E, 0x81, 0x3D, 0x00, 0x20, 0x5F, 0x85, 0x61, 0x72, 0x73, 0x00, 0x25, 
-    0x3D, 0x41, 0x20, 0x5F, 0x86, 0x61, 0x6D, 0x64, 0x00, 0x2A, 0x3D, 0x00, 0x20, 0x5F, 0x86, 0x61, 
-    0x6D, 0x75, 0x73, 0x00, 0x2B, 0x3D, 0x41, 0x20, 0x5F, 0x85, 0x61, 0x70, 0x6C, 0x00, 0x3D, 0x00, 
-    0x20, 0x5F, 0x82, 0x61, 0x73, 0x00, 0x20, 0x2B, 0x40, 0x20, 0x5F, 0x20, 0x70, 0x41, 0x81, 0x21, 
-    0x00, 0x20, 0x5F, 0x82, 0x6E, 0x74, 0x00, 0x20, 0x26, 0x40, 0x20, 0x5F, 0x20, 0x61, 0x41, 0x81, 
-    0x7C, 0x00, 0x20, 0x5F, 0x85, 0x6F, 0x72, 0x00, 0x3E, 0x3D, 0x00, 0x20, 0x5F, 0x81, 0x67, 0x65, 
-    0x41, 0x81, 0x3E, 0x00, 0x20, 0x5F, 0x85, 0x67, 0x74, 0x00, 0x21, 0x3D, 0x00, 0x20, 0x5F, 0x82, 
-    0x6E, 0x65, 0x00, 0x20, 0x3E, 0x40, 0x20, 0x5F, 0x81, 0x72, 0x73, 0x41, 0x81, 0x2D, 0x00, 0x20, 
-    0x5F, 0x81, 0x6D, 0x69, 0x41, 0x81, 0x25, 0x00, 0x20, 0x5F, 0x81, 0x6D, 0x64, 0x41, 0x81, 0x2A, 
-    0x00, 0x20, 0x5F, 0x8B, 0x6D, 0x6C, 0x00, 0x2E, 0x45, 0x58, 0x45, 0x00, 0x2E, 0x65, 0x78, 0x65, 
-    0x41, 0x81, 0x30, 0x45, 0x20, 0x72, 0xDA, 0x6F, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6C, 0x69, 
-    0x6E, 0x6B, 0x2C, 0x20, 0x6E, 0x6F, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x67, 0x65, 
-    0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x2E, 0x00, 0x30, 0x4F, 0x70, 0x65, 0x6E, 0x69, 0x6E, 
-    0x67, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 
-    0x2E, 0x00, 0x30, 0x25, 0x64, 0x20, 0x54, 0x68, 0x75, 0x6D, 0x62, 0x20, 0x74, 0x6F, 0x20, 0x41, 
-    0x52, 0x4D, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 
-    0x63, 0x61, 0x20, 0x6C, 0xCA, 0x73, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 
-    0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x27, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x69, 0x6E, 0x74, 
-    0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 
-    0x30, 0x25, 0x64, 0x20, 0x41, 0x52, 0x4D, 0x20, 0x74, 0x6F, 0x20, 0x54, 0x68, 0x75, 0x6D, 0x62, 
-    0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x61, 
-    0x20, 0x6C, 0xC7, 0x73, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x2C, 0x20, 
-    0x75, 0x73, 0x65, 0x20, 0x27, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x77, 0x6F, 0x72, 0x6B, 0x27, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x30, 0x25, 
-    0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x75, 0x6E, 0x75, 0x73, 0x65, 
-    0x64, 0x20, 0x61, 0x72, 0x65, 0x61, 0x73, 0x20, 0x6F, 0x6D, 0x69, 0x20, 0x74, 0x9B, 0x65, 0x64, 
-    0x2E, 0x00, 0x0D, 0x00, 0x0D, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x2D, 0x41, 0x52, 0x45, 0x41, 0x20, 
-    0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x0D, 0x41, 0x84, 0x49, 0x6D, 
-    0x61, 0x67, 0x65, 0x20, 0x24, 0x8C, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x69, 0x6E, 
-    0x69, 0x74, 0x00, 0x20, 0x21, 0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x91, 0x6F, 0x76, 
-    0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 
-    0x20, 0x24, 0x88, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x73, 0x65, 0x67, 0x00, 0x20, 0x21, 0x84, 0x49, 
-    0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x8F, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x73, 0x65, 0x67, 0x00, 
-    0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x24, 0xC9, 0x44, 0x61, 0x74, 0x61, 0x00, 0x2D, 
-    0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x31, 0x49, 0x6D, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x74, 0x20, 
-    0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x25, 
-    0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x72, 0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 
-    0x74, 0x6F, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x2D, 0x4C, 0x61, 0x73, 0x74, 0x00, 0x2D, 0x46, 0x69, 
-    0x72, 0x73, 0x74, 0x00, 0x20, 0x21, 0x83, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x24, 0x40, 0x20, 0x21, 
-    0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x40, 0x80, 0x30, 0x20, 0x20, 0x96, 0x4C, 0x6F, 
-    0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x25, 0x73, 0x2E, 0x41, 0x82, 0x53, 0x48, 0x4C, 0x20, 0x24, 0x83, 0x64, 0x61, 0x74, 
-    0x61, 0x20, 0x24, 0x84, 0x42, 0x61, 0x73, 0x65, 0x00, 0x20, 0x24, 0x80, 0x30, 0x20, 0x24, 0x87, 
-    0x42, 0x61, 0x73, 0x65, 0x00, 0x53, 0x48, 0x4C, 0x20, 0x24, 0x83, 0x64, 0x61, 0x74, 0x61, 0x20, 
-    0x24, 0x87, 0x53, 0x69, 0x7A, 0x65, 0x00, 0x45, 0x46, 0x54, 0x20, 0x24, 0x89, 0x50, 0x61, 0x72, 
-    0x61, 0x6D, 0x73, 0x00, 0x45, 0x46, 0x54, 0x20, 0x24, 0x80, 0x4F, 0x20, 0x66, 0x83, 0x73, 0x65, 
-    0x74, 0x00, 0x20, 0x5F, 0x89, 0x72, 0x74, 0x5F, 0x64, 0x79, 0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x41, 
-    0xFF, 0x33, 0x4E, 0x6F, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 
-    0x6E, 0x6B, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x25, 0x73, 0x20, 0x2D, 0x68, 0x65, 0x6C, 0x70, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x2E, 0x00, 0x4C, 0x69, 0x6E, 0x6B, 0x2E, 
-    0x61, 0x6F, 0x66, 0x00, 0x4C, 0x69, 0x6E, 0x6B, 0x2E, 0x61, 0x69, 0x66, 0x00, 0x2E, 0x00, 0x61, 
-    0x2E, 0x6F, 0x75, 0x74, 0x00, 0x32, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 
-    0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 
-    0x61, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x28, 0x2D, 0x72, 0x20, 0x69, 
-    0x67, 0xFD, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x29, 0x2E, 0x00, 0x31, 0x44, 0x65, 0x62, 0x75, 0x67, 
-    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 
-    0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x62, 0x69, 
-    0x6E, 0x61, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x28, 0x2D, 0x64, 0x20, 
-    0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x29, 0x2E, 0x00, 0x31, 0x2D, 0x52, 0x57, 0x2D, 0x62, 
-    0x61, 0x73, 0x65, 0x2F, 0x2D, 0x44, 0x41, 0x54, 0x41, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 
-    0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x2D, 0x49, 0x48, 0x46, 
-    0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x2D, 0x53, 0x50, 0x4C, 0x49, 0x54, 0x0D, 
-    0x22, 0x20, 0xB2, 0x28, 0x2D, 0x52, 0x57, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x2F, 0x2D, 0x44, 0x41, 
-    0x54, 0x41, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x29, 0x2E, 0x00, 0x31, 0x2D, 0x41, 
-    0x49, 0x46, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 
-    0x68, 0x20, 0x2D, 0x53, 0x43, 0x41, 0x20, 0x54, 0xBE, 0x45, 0x52, 0x20, 0x69, 0x73, 0x20, 0x65, 
-    0x71, 0x75, 0x69, 0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x41, 0x49, 
-    0x46, 0x20, 0x2D, 0x42, 0x49, 0x4E, 0x2E, 0x00, 0x31, 0x2D, 0x52, 0x4F, 0x2D, 0x62, 0x61, 0x73, 
-    0x65, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 
-    0x69, 0x74, 0x68, 0x20, 0x2D, 0x53, 0x43, 0x41, 0x20, 0x54, 0x8E, 0x45, 0x52, 0x2E, 0x20, 0x2D, 
-    0x52, 0x4F, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x20, 0x77, 0x69, 0x20, 0x6C, 0xAA, 0x20, 0x62, 0x65, 
-    0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0x31, 0x2D, 0x53, 0x50, 0x4C, 0x49, 
-    0x54, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 
-    0x69, 0x74, 0x68, 0x20, 0x2D, 0x53, 0x43, 0x41, 0x20, 0x54, 0x8C, 0x45, 0x52, 0x2E, 0x20, 0x2D, 
-    0x53, 0x50, 0x4C, 0x49, 0x54, 0x20, 0x77, 0x69, 0x20, 0x6C, 0xAC, 0x20, 0x62, 0x65, 0x20, 0x69, 
-    0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0x31, 0x2D, 0x52, 0x57, 0x2D, 0x62, 0x61, 0x73, 
-    0x65, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 
-    0x69, 0x74, 0x68, 0x20, 0x2D, 0x53, 0x43, 0x41, 0x20, 0x54, 0x8E, 0x45, 0x52, 0x2E, 0x20, 0x2D, 
-    0x52, 0x57, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x20, 0x77, 0x69, 0x20, 0x6C, 0x9F, 0x20, 0x62, 0x65, 
-    0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0x33, 0x43, 0x61, 0x6E, 0x27, 0x74, 
-    0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 
-    0x72, 0x65, 0x20, 0x73, 0x8A, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 
-    0x20, 0x6C, 0x8F, 0x79, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x65, 0x64, 0x20, 0x6F, 0x75, 0x74, 0x70, 
-    0x75, 0x74, 0x2E, 0x41, 0xA2, 0x31, 0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x68, 0x6F, 
-    0x72, 0x74, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 
-    0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x20, 0x6C, 0x8C, 0x6F, 0x63, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x2E, 0x00, 0x41, 0x6F, 0x75, 0x74, 0x20, 0x24, 0x81, 0x43, 0x6F, 0x20, 0x6D, 0x8D, 
-    0x6F, 0x6E, 0x00, 0x28, 0x46, 0x61, 0x74, 0x61, 0x6C, 0x29, 0x20, 0x00, 0x28, 0x45, 0x20, 0x72, 
-    0x91, 0x6F, 0x72, 0x29, 0x20, 0x00, 0x28, 0x57, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x29, 0x20, 
-    0x00, 0x33, 0x45, 0x20, 0x72, 0x91, 0x6F, 0x72, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 
-    0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x2E, 0x41, 0xAC, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 
-    0x65, 0x61, 0x20, 0x7C, 0x25, 0x73, 0x7C, 0x00, 0x25, 0x2D, 0x32, 0x34, 0x73, 0x20, 0x25, 0x30, 
-    0x36, 0x6C, 0x78, 0x00, 0x0D, 0x4E, 0x6F, 0x6E, 0x2D, 0x53, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 
-    0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x0D, 0x40, 0x99, 0x20, 0x5B, 0x73, 0x74, 0x72, 
-    0x6F, 0x6E, 0x67, 0x5D, 0x00, 0x20, 0x2B, 0x20, 0x7C, 0x25, 0x73, 0x7C, 0x00, 0x20, 0x25, 0x30, 
-    0x36, 0x6C, 0x78, 0x00, 0x20, 0x24, 0x3F, 0x96, 0x20, 0x55, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 
-    0x65, 0x64, 0x2C, 0x20, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x20, 0x24, 
-    0x3F, 0xAD, 0x20, 0x55, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x2C, 0x20, 0x57, 0x45, 
-    0x41, 0x4B, 0x20, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x25, 0x2D, 0x32, 
-    0x34, 0x73, 0x00, 0x0D, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x0D, 0x41, 0x82, 0xEF, 0x83, 0xE8, 0x41, 0xA3, 0x33, 0x55, 0x6E, 0x72, 0x65, 0x63, 0x6F, 
-    0x67, 0x6E, 0x69, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x2D, 0x25, 
-    0x73, 0x2E, 0x00, 0x78, 0x72, 0x65, 0x66, 0x74, 0x6F, 0x00, 0x78, 0x72, 0x65, 0x20, 0x66, 0x97, 
-    0x72, 0x6F, 0x6D, 0x00, 0x78, 0x72, 0x65, 0x66, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 
-    0x6E, 0x65, 0x20, 0x25, 0x75, 0x3A, 0x20, 0x54, 0x20, 0x6F, 0xCC, 0x20, 0x6D, 0x61, 0x6E, 0x79, 
-    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x2E, 
-    0x00, 0x76, 0x69, 0x61, 0x00, 0x33, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x2D, 
-    0x55, 0x6E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 
-    0x6E, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2E, 0x00, 0x75, 0x6E, 0x72, 0x65, 0x73, 0x6F, 
-    0x6C, 0x76, 0x65, 0x64, 0x00, 0x73, 0x63, 0x61, 0x20, 0x74, 0xB0, 0x65, 0x72, 0x00, 0x73, 0x70, 
-    0x6C, 0x69, 0x74, 0x00, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x00, 0x73, 0x79, 0x6D, 0x00, 
-    0x73, 0x68, 0x6C, 0x00, 0x6E, 0x6F, 0x7A, 0x65, 0x72, 0x6F, 0x70, 0x61, 0x64, 0x00, 0x6E, 0x6F, 
-    0x7A, 0x65, 0x72, 0x6F, 0x73, 0x00, 0x6E, 0x6F, 0x7A, 0x65, 0x72, 0x6F, 0x41, 0xEA, 0x6E, 0x6F, 
-    0x7A, 0x00, 0x6E, 0x6F, 0x61, 0x75, 0x74, 0x6F, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x00, 0x6E, 0x6F, 
-    0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x61, 0x6C, 0x00, 0x6E, 0x6F, 
-    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x00, 0x6E, 0x6F, 0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x00, 
-    0x6E, 0x6F, 0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x61, 0x72, 0x65, 0x61, 0x73, 0x00, 0x72, 0x65, 
-    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x00, 
-    0x72, 0x65, 0x6C, 0x00, 0x33, 0x43, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x69, 0x6E, 0x67, 
-    0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x20, 0xC8, 0x6F, 0x6E, 0x6C, 0x79, 
-    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x2D, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 
-    0x61, 0x6E, 0x64, 0x20, 0x2D, 0x6E, 0x6F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x6D, 0x61, 
-    0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2E, 0x00, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
-    0x65, 0x00, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 
-    0x6F, 0x72, 0x20, 0x6D, 0x69, 0x20, 0x73, 0xBF, 0x69, 0x6E, 0x67, 0x20, 0x2D, 0x52, 0x57, 0x2D, 
-    0x62, 0x61, 0x73, 0x65, 0x2F, 0x2D, 0x44, 0x41, 0x54, 0x41, 0x62, 0x61, 0x73, 0x65, 0x20, 0x76, 
-    0x61, 0x6C, 0x75, 0x65, 0x2E, 0x00, 0x2E, 0x72, 0x77, 0x00, 0x72, 0x77, 0x2D, 0x62, 0x61, 0x73, 
-    0x65, 0x00, 0x72, 0x77, 0x00, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
-    0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x69, 0x20, 0x73, 0xA9, 0x69, 0x6E, 0x67, 0x20, 0x2D, 
-    0x52, 0x4F, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x2F, 0x2D, 0x42, 0x61, 0x73, 0x65, 0x20, 0x76, 0x61, 
-    0x6C, 0x75, 0x65, 0x2E, 0x00, 0x33, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x62, 
-    0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0x9B, 0x65, 0x73, 0x20, 
-    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2E, 0x00, 0x2E, 0x72, 0x6F, 0x00, 0x72, 
-    0x6F, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x00, 0x72, 0x6F, 0x41, 0x80, 0x72, 0x20, 0x65, 0x87, 0x6E, 
-    0x74, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x72, 0x20, 0x65, 0xFF, 0x6E, 0x74, 0x00, 0x72, 0x6D, 0x66, 
-    0x00, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x63, 
-    0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x2D, 0x57, 0x6F, 0x72, 0x6B, 
-    0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2E, 
-    0x00, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x63, 
-    0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x2D, 0x4D, 0x61, 0x74, 0x63, 
-    0x68, 0x20, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2E, 0x00, 0x6D, 0x61, 0x74, 
-    0x63, 0x68, 0x00, 0x6D, 0x61, 0x70, 0x00, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x6F, 0x76, 
-    0x00, 0x6F, 0x00, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x00, 0x33, 0xFF, 0x55, 0x6E, 0x72, 0x65, 0x63, 
-    0x6F, 0x67, 0x6E, 0x69, 0x73, 0x65, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
-    0x20, 0x25, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x6F, 0x70, 0x74, 
-    0x69, 0x6F, 0x6E, 0x00, 0x6E, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x00, 0x75, 0x6E, 
-    0x75, 0x73, 0x65, 0x64, 0x00, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x73, 0x00, 0x74, 0x6F, 0x74, 0x61, 
-    0x6C, 0x00, 0x75, 0x6E, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x69, 0x6E, 0x74, 0x65, 
-    0x72, 0x77, 0x6F, 0x72, 0x6B, 0x00, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x73, 0x69, 0x7A, 0x65, 
-    0x73, 0x00, 0x73, 0x69, 0x7A, 0x65, 0x00, 0x69, 0x6E, 0x66, 0x6F, 0x00, 0x69, 0x68, 0x66, 0x00, 
-    0x6C, 0x61, 0x73, 0x74, 0x00, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x66, 0xEB, 0x69, 0x72, 0x73, 0x74, 
-    0x00, 0x65, 0x6C, 0x66, 0x00, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
-    0x65, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x2D, 
-    0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2E, 
-    0x00, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x65, 0x6E, 0x00, 0x33, 0x4D, 0x75, 0x6C, 0x74, 0x69, 
-    0x70, 0x6C, 0x65, 0x20, 0x2D, 0x25, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 
-    0x00, 0x65, 0x64, 0x69, 0x74, 0x00, 0x33, 0x43, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6F, 
-    0x70, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x64, 0x65, 0x20, 0x72, 0xA2, 0x20, 0x74, 0x6F, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x33, 0x4E, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 
-    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x2D, 0x25, 0x73, 0x2E, 0x00, 0x65, 0x20, 0x72, 
-    0x86, 0x6F, 0x72, 0x73, 0x00, 0x64, 0x73, 0x75, 0x20, 0x70, 0x81, 0x72, 0x65, 0x20, 0x73, 0x40, 
-    0x83, 0x64, 0x62, 0x75, 0x67, 0x41, 0x95, 0x64, 0x65, 0x62, 0x75, 0x67, 0x00, 0x2E, 0x64, 0x61, 
-    0x74, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x64, 0x75, 0x70, 0x6F, 0x6B, 0x00, 0x20, 0x64, 0xD5, 
-    0x65, 0x00, 0x62, 0x69, 0x6E, 0x00, 0x62, 0x61, 0x73, 0x65, 0x00, 0x61, 0x6F, 0x75, 0x74, 0x00, 
-    0x61, 0x6F, 0x66, 0x00, 0x33, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x6F, 0x75, 
-    0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 
-    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x2D, 0x61, 0x69, 0x66, 0x2C, 0x20, 0x2D, 0x61, 0x6F, 
-    0x66, 0x2C, 0x20, 0x2D, 0x72, 0x6D, 0x66, 0x2C, 0x20, 0x2D, 0x62, 0x69, 0x6E, 0x20, 0x6F, 0x72, 
-    0x20, 0x2D, 0x69, 0x68, 0x66, 0x2E, 0x41, 0xC9, 0x61, 0x69, 0x66, 0x00, 0x31, 0x4F, 0x6C, 0x64, 
-    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 
-    0x61, 0x74, 0x6F, 0x72, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x25, 0x73, 0x2C, 0x20, 0x75, 
-    0x73, 0x65, 0x20, 0x27, 0x20, 0x27, 0x2E, 0x00, 0x32, 0x28, 0x25, 0x73, 0x29, 0x20, 0x6F, 0x62, 
-    0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 
-    0x64, 0x2E, 0x41, 0xD1, 0x32, 0x28, 0x25, 0x73, 0x29, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 
-    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x6F, 
-    0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x32, 0x28, 0x25, 0x73, 0x29, 0x20, 
-    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 
-    0x6E, 0x73, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 
-    0x20, 0x41, 0x52, 0x45, 0x41, 0x2E, 0x41, 0xAC, 0x32, 0x28, 0x25, 0x73, 0x29, 0x20, 0x62, 0x61, 
-    0x64, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 0x72, 0x65, 0x61, 0x29, 0x20, 0x6E, 
-    0x61, 0x6D, 0x65, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 
-    0x65, 0x64, 0x2E, 0x00, 0x30, 0x20, 0x20, 0x9A, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 
-    0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 
-    0x2E, 0x00, 0x30, 0x22, 0x20, 0x9A, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x25, 0x73, 
-    0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x20, 0x25, 0x73, 0x2E, 0x00, 
-    0x30, 0x20, 0x20, 0x82, 0x53, 0x63, 0x61, 0x20, 0x6E, 0xA5, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x69, 
-    0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x66, 
-    0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2E, 
-    0x41, 0x80, 0x30, 0x20, 0x20, 0x85, 0x52, 0x65, 0x2D, 0x73, 0x63, 0x61, 0x20, 0x6E, 0xA7, 0x69, 
-    0x6E, 0x67, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x20, 0x66, 0x6F, 
-    0x72, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x6D, 0x6F, 0x64, 
-    0x75, 0x6C, 0x65, 0x73, 0x2E, 0x00, 0x30, 0x20, 0x20, 0xFF, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 
-    0x67, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 0x20, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x25, 
-    0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x4F, 0x46, 0x4C, 0x5F, 0x53, 
-    0x59, 0x4D, 0x54, 0x00, 0x31, 0x4F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x65, 
-    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 
-    0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x4C, 0x49, 0x42, 
-    0x5F, 0x54, 0x49, 0x4D, 0x45, 0x00, 0x31, 0x4C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x25, 
-    0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x00, 0x4F, 0x46, 0x4C, 0x8F, 0x5F, 0x54, 0x49, 0x4D, 0x45, 
-    0x00, 0x4C, 0x49, 0x42, 0x5F, 0x56, 0x52, 0x53, 0x4E, 0x00, 0x30, 0x2C, 0x20, 0x83, 0x72, 0x65, 
-    0x66, 0x3A, 0x20, 0x20, 0x83, 0x25, 0x73, 0x00, 0x30, 0x2C, 0x20, 0x83, 0x72, 0x65, 0x66, 0x3A, 
-    0x20, 0x20, 0x88, 0x25, 0x73, 0x20, 0x28, 0x77, 0x65, 0x61, 0x6B, 0x29, 0x41, 0x80, 0x30, 0x2C, 
-    0x20, 0x83, 0x64, 0x65, 0x66, 0x3A, 0x20, 0x20, 0xB3, 0x25, 0x73, 0x00, 0x33, 0x43, 0x61, 0x6E, 
-    0x27, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 
-    0x6E, 0x20, 0x25, 0x64, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x73, 0x2E, 0x00, 0x2D, 0x4E, 0x4F, 0x5A, 0x45, 0x52, 0x4F, 0x70, 0x61, 0x64, 0x27, 0x20, 0xCB, 
-    0x44, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x7A, 0x65, 
-    0x72, 0x6F, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x73, 0x65, 0x64, 0x20, 0x61, 
-    0x72, 0x65, 0x61, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x73, 0x20, 0x69, 0x6E, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x0D, 0x00, 0x2D, 0x46, 0x49, 0x52, 
-    0x53, 0x54, 0x20, 0x6F, 0x62, 0x6A, 0x28, 0x61, 0x72, 0x65, 0x61, 0x29, 0x21, 0x20, 0xBD, 0x50, 
-    0x6C, 0x61, 0x63, 0x65, 0x20, 0x27, 0x61, 0x72, 0x65, 0x61, 0x27, 0x20, 0x66, 0x72, 0x6F, 0x6D, 
-    0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x27, 0x6F, 0x62, 0x6A, 0x27, 0x20, 0x66, 0x69, 
-    0x72, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 
-    0x74, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x0D, 0x2D, 0x4C, 0x41, 0x53, 0x54, 0x20, 0x20, 0x88, 
-    0x6F, 0x62, 0x6A, 0x28, 0x61, 0x72, 0x65, 0x61, 0x29, 0x21, 0x20, 0xA2, 0x50, 0x6C, 0x61, 0x63, 
-    0x65, 0x20, 0x27, 0x61, 0x72, 0x65, 0x61, 0x27, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6F, 0x62, 
-    0x6A, 0x65, 0x63, 0x74, 0x20, 0x27, 0x6F, 0x62, 0x6A, 0x27, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x21, 
-    0x2E, 0x8E, 0x0D, 0x2D, 0x4E, 0x4F, 0x55, 0x4E, 0x55, 0x53, 0x45, 0x44, 0x61, 0x72, 0x65, 0x61, 
-    0x73, 0x23, 0x20, 0xAC, 0x44, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
-    0x20, 0x41, 0x52, 0x45, 0x41, 0x73, 0x20, 0x75, 0x6E, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 
-    0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x41, 0x52, 0x45, 0x41, 
-    0x0D, 0x35, 0x20, 0xB3, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 
-    0x68, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x28, 
-    0x41, 0x49, 0x46, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x29, 
-    0x0D, 0x2D, 0x52, 0x45, 0x4D, 0x4F, 0x56, 0x45, 0x2A, 0x20, 0xB9, 0x52, 0x65, 0x6D, 0x6F, 0x76, 
-    0x65, 0x20, 0x75, 0x6E, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x41, 0x52, 
-    0x45, 0x41, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x2D, 0x62, 0x69, 0x6E, 
-    0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x64, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x73, 0x0D, 0x2D, 
-    0x44, 0x55, 0x50, 0x4F, 0x4B, 0x2B, 0x20, 0x80, 0x41, 0x20, 0x6C, 0xA3, 0x6F, 0x77, 0x20, 0x64, 
-    0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 
-    0x0D, 0x2D, 0x55, 0x6E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x20, 0x73, 0x79, 0x6D, 
-    0x22, 0x20, 0x85, 0x4D, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x6C, 0xC7, 0x20, 0x75, 0x6E, 0x72, 
-    0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 
-    0x65, 0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x27, 0x73, 0x79, 0x6D, 
-    0x27, 0x0D, 0x00, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 
-    0x6E, 0x73, 0x3A, 0x0D, 0x2D, 0x52, 0x4F, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x20, 0x6E, 0x0D, 0x2D, 
-    0x42, 0x61, 0x73, 0x65, 0x22, 0x20, 0x80, 0x6E, 0x27, 0x20, 0xA5, 0x53, 0x70, 0x65, 0x63, 0x69, 
-    0x66, 0x79, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 
-    0x0D, 0x2D, 0x52, 0x57, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x20, 0x6E, 0x0D, 0x2D, 0x44, 0x41, 0x54, 
-    0x41, 0x22, 0x20, 0x80, 0x6E, 0x27, 0x20, 0xAC, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 
-    0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x66, 0x6F, 
-    0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x27, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0D, 0x2D, 
-    0x45, 0x6E, 0x74, 0x72, 0x79, 0x21, 0x20, 0x80, 0x6E, 0x27, 0x20, 0x8E, 0x53, 0x70, 0x65, 0x63, 
-    0x69, 0x66, 0x79, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 
-    0x20, 0x73, 0xA5, 0x0D, 0x2D, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x6E, 0x2B, 0x6F, 0x62, 0x6A, 
-    0x28, 0x61, 0x72, 0x65, 0x61, 0x29, 0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x65, 
-    0x6E, 0x74, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6F, 0x20, 0x66, 0xDD, 0x73, 0x65, 0x74, 0x20, 
-    0x77, 0x69, 0x74, 0x68, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x61, 0x0D, 0x28, 0x70, 0x72, 0x65, 
-    0x66, 0x69, 0x78, 0x20, 0x27, 0x6E, 0x27, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x26, 0x20, 0x6F, 
-    0x72, 0x20, 0x30, 0x78, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x78, 0x3B, 0x20, 0x70, 0x6F, 
-    0x73, 0x74, 0x66, 0x69, 0x78, 0x20, 0x77, 0x69, 0x74, 0x6B, 0x20, 0x4B, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x2A, 0x32, 0x5E, 0x31, 0x30, 0x2C, 0x20, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x2A, 0x32, 
-    0x5E, 0x32, 0x30, 0x29, 0x0D, 0x2D, 0x43, 0x61, 0x73, 0x65, 0x2C, 0x20, 0xA8, 0x49, 0x67, 0x6E, 
-    0x6F, 0x72, 0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x0D, 0x2D, 0x4D, 
-    0x41, 0x54, 0x43, 0x48, 0x20, 0x6E, 0x29, 0x20, 0xAA, 0x53, 0x65, 0x74, 0x20, 0x6C, 0x61, 0x73, 
-    0x74, 0x2D, 0x67, 0x61, 0x73, 0x70, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x6D, 0x61, 
-    0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0D, 0x00, 
-    0x2D, 0x49, 0x48, 0x46, 0x2D, 0x20, 0x83, 0x49, 0x6E, 0x74, 0x65, 0x20, 0x6C, 0xA3, 0x65, 0x63, 
-    0x20, 0x48, 0x65, 0x78, 0x20, 0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x28, 0x72, 0x65, 0x61, 
-    0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x29, 0x0D, 0x2D, 0x53, 0x50, 0x4C, 
-    0x49, 0x54, 0x2B, 0x20, 0xC1, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x52, 0x4F, 0x20, 0x61, 
-    0x6E, 0x64, 0x20, 0x52, 0x57, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 
-    0x6F, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 
-    0x20, 0x28, 0x2D, 0x42, 0x49, 0x4E, 0x2C, 0x20, 0x2D, 0x49, 0x48, 0x46, 0x29, 0x0D, 0x2D, 0x53, 
-    0x48, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x28, 0x20, 0xB9, 0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 
-    0x2D, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x2B, 0x20, 0x73, 0x74, 0x75, 0x62, 0x2C, 
-    0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 0x69, 0x6E, 
-    0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x0D, 0x2D, 0x53, 0x48, 0x4C, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x2D, 0x52, 0x20, 0x45, 0x85, 0x4E, 0x54, 0x72, 0x61, 0x6E, 0x74, 0x21, 0x20, 0x91, 
-    0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2D, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x2B, 
-    0x20, 0x72, 0x20, 0x65, 0x8F, 0x6E, 0x74, 0x72, 0x61, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x75, 0x62, 
-    0x0D, 0x2D, 0x52, 0x4D, 0x46, 0x2D, 0x20, 0x9B, 0x52, 0x49, 0x53, 0x43, 0x20, 0x4F, 0x53, 0x20, 
-    0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x0D, 0x2D, 0x4F, 0x56, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x24, 0x20, 0xA9, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x69, 0x64, 0x20, 
-    0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 
-    0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x0D, 0x2D, 0x53, 0x43, 
-    0x41, 0x20, 0x54, 0x86, 0x45, 0x52, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x24, 0x20, 0x82, 0x53, 0x63, 
-    0x61, 0x20, 0x74, 0xA5, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6D, 
-    0x61, 0x67, 0x65, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 
-    0x20, 0x69, 0x6E, 0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x20, 0x0D, 0x40, 0x93, 0x4F, 0x75, 
-    0x74, 0x70, 0x75, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x0D, 0x2D, 0x41, 
-    0x49, 0x46, 0x2D, 0x20, 0xAB, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x41, 0x49, 
-    0x46, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x0D, 
-    0x2D, 0x41, 0x49, 0x46, 0x20, 0x2D, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x20, 0x20, 0xA2, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x41, 0x49, 0x46, 0x0D, 0x2D, 0x41, 0x49, 0x46, 0x20, 0x2D, 0x52, 0x20, 0x2D, 0x57, 0x6F, 0x72, 
-    0x6B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x21, 0x6E, 0x23, 0x20, 0x93, 0x53, 0x65, 0x6C, 0x66, 
-    0x2D, 0x6D, 0x6F, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x41, 0x49, 0x46, 0x0D, 0x2D, 0x41, 0x4F, 0x46, 
-    0x2D, 0x20, 0x85, 0x50, 0x61, 0x72, 0x74, 0x69, 0x61, 0x20, 0x6C, 0x90, 0x79, 0x20, 0x6C, 0x69, 
-    0x6E, 0x6B, 0x65, 0x64, 0x20, 0x41, 0x4F, 0x46, 0x0D, 0x2D, 0x42, 0x49, 0x4E, 0x2D, 0x20, 0x95, 
-    0x50, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x0D, 0x2D, 0x42, 0x49, 
-    0x4E, 0x20, 0x2D, 0x41, 0x49, 0x46, 0x28, 0x20, 0xB0, 0x50, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x62, 
-    0x69, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x64, 0x20, 
-    0x62, 0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x41, 
-    0x49, 0x46, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0D, 0x41, 0x88, 0x2D, 0x56, 0x49, 0x41, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x28, 0x20, 0xAF, 0x54, 0x61, 0x6B, 0x65, 0x20, 0x6D, 0x6F, 0x72, 
-    0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 
-    0x6D, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x0D, 
-    0x2D, 0x56, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x29, 0x20, 0x94, 0x47, 0x69, 0x76, 0x65, 0x20, 
-    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x65, 
-    0x20, 0x73, 0x95, 0x61, 0x67, 0x65, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x6E, 
-    0x6B, 0x69, 0x6E, 0x67, 0x0D, 0x2D, 0x4D, 0x41, 0x50, 0x2D, 0x20, 0xAD, 0x50, 0x72, 0x69, 0x6E, 
-    0x74, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x74, 0x6F, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20, 0x6F, 0x75, 
-    0x74, 0x70, 0x75, 0x74, 0x0D, 0x2D, 0x58, 0x72, 0x65, 0x66, 0x2C, 0x20, 0x90, 0x50, 0x72, 0x69, 
-    0x6E, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x63, 0x72, 0x6F, 0x20, 0x73, 
-    0x9C, 0x2D, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6C, 0x69, 0x73, 0x74, 
-    0x0D, 0x2D, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x24, 0x20, 
-    0xA0, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x64, 0x65, 0x66, 
-    0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x27, 0x66, 0x69, 0x6C, 
-    0x65, 0x27, 0x20, 0x0D, 0x40, 0x91, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x6F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x28, 0x61, 0x20, 0x62, 0xAA, 0x72, 0x65, 0x76, 0x69, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x6E, 0x20, 0x63, 0x61, 0x70, 0x69, 
-    0x74, 0x61, 0x6C, 0x69, 0x73, 0x65, 0x64, 0x29, 0x3A, 0x0D, 0x2D, 0x4F, 0x75, 0x74, 0x70, 0x75, 
-    0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x25, 0x20, 0xA4, 0x50, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6E, 
-    0x61, 0x6C, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x27, 0x66, 0x69, 
-    0x6C, 0x65, 0x27, 0x0D, 0x2D, 0x5B, 0x4E, 0x4F, 0x5D, 0x44, 0x65, 0x62, 0x75, 0x67, 0x27, 0x20, 
-    0x8B, 0x49, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x64, 0x65, 0x62, 0x75, 0x20, 0x67, 0xA4, 
-    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
-    0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x2D, 0x44, 0x65, 0x62, 0x75, 
-    0x67, 0x29, 0x0D, 0x2D, 0x45, 0x20, 0x52, 0x87, 0x4F, 0x52, 0x53, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x25, 0x20, 0xA2, 0x50, 0x75, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69, 
-    0x63, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x2C, 0x20, 0x6E, 0x6F, 
-    0x74, 0x20, 0x73, 0x74, 0x64, 0x65, 0x20, 0x72, 0x8A, 0x0D, 0x2D, 0x4C, 0x49, 0x53, 0x54, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x27, 0x20, 0xAE, 0x50, 0x75, 0x74, 0x20, 0x4D, 0x61, 0x70, 0x20, 0x61, 
-    0x6E, 0x64, 0x20, 0x58, 0x72, 0x65, 0x66, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 
-    0x74, 0x6F, 0x20, 0x27, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x2C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 
-    0x74, 0x64, 0x6F, 0x75, 0x74, 0x0D, 0x41, 0x8D, 0x25, 0x73, 0x20, 0x76, 0x73, 0x6E, 0x20, 0x25, 
-    0x73, 0x20, 0x5B, 0x25, 0x73, 0x5D, 0x20, 0x0D, 0x81, 0x43, 0x6F, 0x20, 0x6D, 0xB3, 0x61, 0x6E, 
-    0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x3A, 0x20, 0x25, 0x73, 0x20, 0x5B, 0x6F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5D, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x5F, 0x66, 0x69, 
-    0x6C, 0x65, 0x31, 0x2C, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x5F, 0x66, 0x69, 0x6C, 0x65, 
-    0x32, 0x20, 0x21, 0x2E, 0x20, 0x0D, 0x40, 0xAB, 0x31, 0x4F, 0x6C, 0x64, 0x20, 0x73, 0x74, 0x79, 
-    0x6C, 0x65, 0x20, 0x2F, 0x61, 0x20, 0x6F, 0x72, 0x20, 0x2F, 0x6C, 0x20, 0x71, 0x75, 0x61, 0x6C, 
-    0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 
-    0x20, 0x25, 0x73, 0x2E, 0x41, 0xC7, 0x33, 0x2F, 0x61, 0x20, 0x6F, 0x72, 0x20, 0x2F, 0x6C, 0x20, 
-    0x71, 0x75, 0x61, 0x6C, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x41, 0x4F, 0x46, 
-    0x2C, 0x20, 0x61, 0x2E, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x2E, 0x61, 0x72, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x33, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 
-    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x00, 0x72, 0x62, 0x41, 0xB2, 
-    0x33, 0x45, 0x78, 0x74, 0x72, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
-    0x73, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x62, 
-    0x65, 0x72, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x25, 0x73, 0x2E, 0x00, 
-    0x33, 0x4D, 0x69, 0x20, 0x73, 0xA8, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
-    0x79, 0x20, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x65, 0x6D, 0x62, 
-    0x65, 0x72, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x25, 0x73, 0x2E, 0x41, 
-    0xA7, 0x31, 0x44, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x25, 0x73, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0x47, 0x72, 0x61, 
-    0x6E, 0x64, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x73, 0x23, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 
-    0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 
-    0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 
-    0x37, 0x6C, 0x64, 0x20, 0x20, 0x93, 0x25, 0x37, 0x6C, 0x64, 0x0D, 0x00, 0x4C, 0x69, 0x62, 0x72, 
-    0x61, 0x72, 0x79, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x73, 0x21, 0x20, 0x83, 0x25, 0x37, 0x6C, 
-    0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 
-    0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 
-    0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x92, 0x25, 0x37, 0x6C, 0x64, 0x0D, 0x00, 0x4F, 0x62, 0x6A, 
-    0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x73, 0x22, 0x20, 0x83, 0x25, 0x37, 0x6C, 
-    0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 
-    0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 
-    0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x89, 0x25, 0x37, 0x6C, 0x64, 0x0D, 0x00, 0x25, 0x2D, 0x32, 
-    0x30, 0x20, 0x63, 0x82, 0x6F, 0x64, 0x65, 0x21, 0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 
-    0x21, 0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x20, 0x86, 0x27, 0x63, 0x6F, 0x6E, 
-    0x73, 0x74, 0x27, 0x25, 0x20, 0x81, 0x52, 0x57, 0x21, 0x20, 0x85, 0x30, 0x2D, 0x49, 0x6E, 0x69, 
-    0x74, 0x22, 0x20, 0x94, 0x64, 0x65, 0x62, 0x75, 0x67, 0x0D, 0x00, 0x6C, 0x69, 0x62, 0x72, 0x61, 
-    0x72, 0x79, 0x20, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x24, 0x20, 0x83, 0x63, 0x6F, 0x64, 0x65, 
-    0x21, 0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x21, 0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 
-    0x6E, 0x65, 0x20, 0x20, 0x86, 0x27, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x27, 0x25, 0x20, 0x81, 0x52, 
-    0x57, 0x21, 0x20, 0x85, 0x30, 0x2D, 0x49, 0x6E, 0x69, 0x74, 0x22, 0x20, 0x8F, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x0D, 0x00, 0x25, 0x2D, 0x32, 0x30, 0x63, 0x73, 0x69, 0x7A, 0x65, 0x23, 0x20, 0x83, 
-    0x64, 0x61, 0x74, 0x61, 0x20, 0x20, 0x86, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x23, 0x20, 
-    0x83, 0x64, 0x61, 0x74, 0x61, 0x23, 0x20, 0x83, 0x64, 0x61, 0x74, 0x61, 0x23, 0x20, 0x83, 0x64, 
-    0x61, 0x74, 0x61, 0x23, 0x20, 0x84, 0x64, 0x61, 0x74, 0x61, 0x0D, 0x41, 0x8A, 0x6F, 0x62, 0x6A, 
-    0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x27, 0x20, 0x83, 0x63, 0x6F, 0x64, 0x65, 0x21, 
-    0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x21, 0x20, 0x85, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 
-    0x65, 0x20, 0x20, 0x86, 0x27, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x27, 0x25, 0x20, 0x81, 0x52, 0x57, 
-    0x21, 0x20, 0x85, 0x30, 0x2D, 0x49, 0x6E, 0x69, 0x74, 0x22, 0x20, 0x8B, 0x64, 0x65, 0x62, 0x75, 
-    0x67, 0x0D, 0x00, 0x20, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 
-    0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 
-    0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x83, 0x25, 0x37, 0x6C, 0x64, 0x20, 0x20, 0x98, 0x25, 0x37, 
-    0x6C, 0x64, 0x0D, 0x00, 0x0D, 0x25, 0x2D, 0x31, 0x36, 0x63, 0x00, 0x25, 0x2D, 0x31, 0x36, 0x73, 
-    0x00, 0x78, 0x24, 0x6C, 0x69, 0x74, 0x70, 0x20, 0x6F, 0x81, 0x6C, 0x24, 0x41, 0x91, 0x78, 0x24, 
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x64, 0x61, 0x74, 0x61, 0x00, 0x78, 0x24, 0x6C, 0x69, 0x74, 0x70, 
-    0x20, 0x6F, 0xA4, 0x6C, 0x5F, 0x65, 0x24, 0x00, 0x44, 0x41, 0x54, 0x41, 0x00, 0x44, 0x42, 0x55, 
-    0x47, 0x00, 0x5A, 0x45, 0x52, 0x4F, 0x00, 0x25, 0x2D, 0x38, 0x6C, 0x78, 0x20, 0x25, 0x2D, 0x38, 
-    0x6C, 0x78, 0x20, 0x25, 0x73, 0x20, 0x25, 0x73, 0x20, 0x20, 0x96, 0x25, 0x73, 0x00, 0x20, 0x66, 
-    0x72, 0x6F, 0x6D, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 
-    0x25, 0x73, 0x41, 0x8E, 0x25, 0x2D, 0x38, 0x6C, 0x78, 0x20, 0x25, 0x2D, 0x38, 0x6C, 0x78, 0x20, 
-    0x50, 0x41, 0x44, 0x20, 0x20, 0x81, 0x25, 0x73, 0x20, 0x20, 0x96, 0x25, 0x73, 0x00, 0x41, 0x52, 
-    0x45, 0x41, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x3A, 0x0D, 0x42, 0x61, 
-    0x73, 0x65, 0x23, 0x20, 0x83, 0x53, 0x69, 0x7A, 0x65, 0x23, 0x20, 0x8D, 0x54, 0x79, 0x70, 0x65, 
-    0x20, 0x52, 0x4F, 0x3F, 0x20, 0x4E, 0x61, 0x6D, 0x65, 0x0D, 0x42, 0x82, 0x61, 0x81, 0x2C, 0x42, 
-    0x10, 0x81, 0x81, 0x5C, 0x41, 0x8A, 0x2E, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 
-    0x3A, 0x20, 0x30, 0x80, 0x20, 0x22, 0x30, 0x83, 0x20, 0x30, 0x31, 0x20, 0x20, 0x46, 0x20, 0x0D, 
-    0x40, 0x21, 0x2A, 0x8D, 0x25, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x72, 0x65, 0x77, 
-    0x72, 0x69, 0x20, 0x74, 0xAC, 0x65, 0x6E, 0x3A, 0x20, 0x25, 0x23, 0x6C, 0x78, 0x20, 0x2D, 0x3E, 
-    0x20, 0x25, 0x23, 0x6C, 0x78, 0x0D, 0x00, 0x23, 0x20, 0x25, 0x73, 0x20, 0x73, 0x65, 0x67, 0x6D, 
-    0x65, 0x6E, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x30, 0x78, 0x25, 
-    0x6C, 0x78, 0x20, 0x0D, 0x40, 0x80, 0x23, 0x27, 0x20, 0x8D, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x00, 
-    0x41, 0x70, 0x72, 0x20, 0x32, 0x39, 0x20, 0x31, 0x20, 0x39, 0x99, 0x36, 0x00, 0x23, 0x20, 0x43, 
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x25, 0x73, 0x20, 0x5B, 0x25, 0x73, 
-    0x5D, 0x0D, 0x00, 0x77, 0x62, 0x41, 0x82, 0x77, 0x00, 0x30, 0x22, 0x20, 0xEB, 0x65, 0x66, 0x74, 
-    0x5B, 0x25, 0x33, 0x6C, 0x75, 0x5D, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x36, 0x6C, 0x78, 0x20, 
-    0x25, 0x73, 0x00, 0x30, 0x54, 0x68, 0x65, 0x20, 0x45, 0x46, 0x54, 0x20, 0x68, 0x61, 0x73, 0x20, 
-    0x25, 0x6C, 0x75, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x30, 0x53, 0x69, 0x7A, 
-    0x65, 0x20, 0x6F, 0x66, 0x20, 0x45, 0x46, 0x54, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 
-    0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x25, 0x75, 0x20, 0x62, 0x79, 
-    0x74, 0x65, 0x73, 0x00, 0x23, 0x2A, 0x20, 0x25, 0x2E, 0x38, 0x6C, 0x78, 0x20, 0x25, 0x2E, 0x36, 
-    0x34, 0x73, 0x0D, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x82, 0x52, 0x57, 0x30, 0x41, 
-    0x97, 0x2E, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2E, 0x73, 0x79, 0x6D, 0x74, 0x61, 0x62, 
-    0x00, 0x32, 0x50, 0x68, 0x61, 0x73, 0x65, 0x20, 0x65, 0x20, 0x72, 0x97, 0x6F, 0x72, 0x3A, 0x20, 
-    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 
-    0x65, 0x20, 0x64, 0x69, 0x20, 0x66, 0x88, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x28, 0x6D, 0x69, 
-    0x20, 0x64, 0x9E, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x77, 0x72, 0x69, 
-    0x74, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x29, 0x00, 0x32, 0x50, 0x68, 0x61, 0x73, 0x65, 
-    0x20, 0x65, 0x20, 0x72, 0x92, 0x6F, 0x72, 0x3A, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 
-    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x64, 0x69, 0x20, 0x66, 0x88, 0x65, 0x72, 0x65, 0x6E, 0x74, 
-    0x20, 0x28, 0x6D, 0x69, 0x20, 0x64, 0x9C, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x2C, 
-    0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x29, 0x00, 0x24, 0x41, 
-    0x00, 0x24, 0x54, 0x00, 0x20, 0x24, 0x41, 0x10, 0x81, 0x80, 0x88, 0x41, 0x96, 0x30, 0x28, 0x61, 
-    0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 
-    0x29, 0x3A, 0x20, 0x6F, 0x20, 0x66, 0x98, 0x73, 0x65, 0x74, 0x2F, 0x76, 0x61, 0x6C, 0x75, 0x65, 
-    0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29, 0x00, 
-    0x20, 0x21, 0xCF, 0x24, 0x41, 0x00, 0x31, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x72, 0x65, 
-    0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x72, 0x65, 
-    0x73, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x00, 0x32, 0x25, 0x73, 
-    0x28, 0x25, 0x73, 0x29, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6E, 
-    0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x72, 0x65, 0x73, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x61, 
-    0x74, 0x61, 0x2E, 0x41, 0xA8, 0x32, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x77, 0x2E, 0x72, 0x2E, 0x74, 0x2E, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x20, 0x25, 0x73, 0x20, 0x6C, 0x6F, 0x73, 0x74, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x20, 0x66, 
-    0xD2, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x25, 0x73, 
-    0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x32, 0x50, 0x43, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 
-    0x76, 0x65, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 
-    0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 
-    0x25, 0x73, 0x2E, 0x00, 0x30, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 
-    0x67, 0x20, 0x63, 0x61, 0x20, 0x6C, 0xBC, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x54, 0x68, 0x75, 
-    0x6D, 0x62, 0x20, 0x74, 0x6F, 0x20, 0x41, 0x52, 0x4D, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 
-    0x73, 0x29, 0x2E, 0x00, 0x30, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 
-    0x67, 0x20, 0x63, 0x61, 0x20, 0x6C, 0xAC, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x41, 0x52, 0x4D, 
-    0x20, 0x74, 0x6F, 0x20, 0x54, 0x68, 0x75, 0x6D, 0x62, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 
-    0x73, 0x29, 0x2E, 0x00, 0x20, 0x21, 0x20, 0x24, 0x41, 0x87, 0x32, 0x50, 0x68, 0x61, 0x73, 0x65, 
-    0x20, 0x65, 0x20, 0x72, 0xC2, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 
-    0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 
-    0x69, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x32, 0x55, 0x6E, 0x64, 0x65, 
-    0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x53, 0x54, 0x52, 0x4F, 0x4E, 0x47, 0x20, 0x73, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x20, 0x21, 0x88, 0x24, 0x54, 0x00, 0x72, 0x65, 
-    0x6C, 0x3A, 0x20, 0x6F, 0x20, 0x66, 0xCE, 0x3D, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x2C, 0x20, 0x41, 
-    0x3D, 0x25, 0x75, 0x2C, 0x20, 0x52, 0x3D, 0x25, 0x75, 0x2C, 0x20, 0x6C, 0x65, 0x6E, 0x3D, 0x25, 
-    0x75, 0x2C, 0x20, 0x42, 0x3D, 0x25, 0x75, 0x2C, 0x20, 0x73, 0x79, 0x6D, 0x6E, 0x6F, 0x3D, 0x25, 
-    0x6C, 0x75, 0x0D, 0x00, 0x32, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x20, 0x5B, 0x25, 0x2E, 0x38, 0x6C, 0x78, 
-    0x5D, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x20, 0x66, 0xE7, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 
-    0x6C, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x31, 0x55, 
-    0x6E, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 
-    0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x27, 0x2D, 0x69, 
-    0x6E, 0x66, 0x6F, 0x20, 0x75, 0x6E, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x27, 0x20, 0x66, 
-    0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x00, 0x31, 0x55, 0x6E, 
-    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x74, 0x20, 
-    0x6F, 0x20, 0x66, 0xD2, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x69, 0x6E, 
-    0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x32, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 
-    0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x6C, 
-    0x6F, 0x63, 0x20, 0x61, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x25, 
-    0x73, 0x28, 0x25, 0x73, 0x29, 0x00, 0x2E, 0x0D, 0x00, 0x28, 0x25, 0x73, 0x29, 0x00, 0x20, 0x66, 
-    0x72, 0x6F, 0x6D, 0x20, 0x25, 0x73, 0x00, 0x22, 0x20, 0xA9, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x69, 0x6E, 0x67, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x00, 0x25, 0x73, 0x3A, 
-    0x20, 0x00, 0x32, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6C, 
-    0x75, 0x65, 0x20, 0x74, 0x20, 0x6F, 0xC0, 0x20, 0x62, 0x69, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 
-    0x69, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x71, 0x75, 
-    0x65, 0x6E, 0x63, 0x65, 0x2E, 0x00, 0x32, 0x42, 0x20, 0x6F, 0x72, 0x20, 0x42, 0x4C, 0x20, 0x74, 
-    0x6F, 0x20, 0x75, 0x6E, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x64, 0x65, 0x73, 0x74, 
-    0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x41, 0x81, 0xEF, 0x81, 0x42, 0x80, 0x30, 0x22, 
-    0x20, 0x87, 0x25, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x66, 0x65, 0x20, 0x72, 0x8F, 0x65, 0x64, 0x20, 
-    0x74, 0x6F, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x30, 0x22, 0x20, 0x87, 
-    0x25, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x66, 0x65, 0x20, 0x72, 0x93, 0x65, 0x64, 0x20, 0x74, 0x6F, 
-    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x30, 0x22, 
-    0x20, 0x82, 0x25, 0x73, 0x2E, 0x41, 0xAB, 0x32, 0x55, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x28, 0x73, 0x29, 0x2E, 0x00, 0x31, 0x55, 0x6E, 
-    0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x28, 0x73, 
-    0x29, 0x2E, 0x00, 0x20, 0x5F, 0x89, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x43, 0x6F, 0x64, 0x65, 0x00, 
-    0x20, 0x21, 0x82, 0x52, 0x4F, 0x4D, 0x20, 0x24, 0x85, 0x53, 0x69, 0x7A, 0x65, 0x00, 0x52, 0x20, 
-    0x6F, 0x80, 0x74, 0x20, 0x24, 0x91, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x54, 0x61, 0x62, 
-    0x6C, 0x65, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x81, 0x52, 0x57, 0x20, 0x24, 0x85, 
-    0x4C, 0x69, 0x6D, 0x69, 0x74, 0x00, 0x20, 0x21, 0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 
-    0x88, 0x44, 0x61, 0x74, 0x61, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x41, 0x84, 0x49, 0x6D, 0x61, 0x67, 
-    0x65, 0x20, 0x24, 0x81, 0x52, 0x57, 0x20, 0x24, 0x84, 0x42, 0x61, 0x73, 0x65, 0x00, 0x20, 0x21, 
-    0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x8D, 0x44, 0x61, 0x74, 0x61, 0x42, 0x61, 0x73, 
-    0x65, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x81, 0x52, 0x4F, 0x20, 0x24, 0x85, 0x4C, 
-    0x69, 0x6D, 0x69, 0x74, 0x00, 0x20, 0x21, 0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x8E, 
-    0x43, 0x6F, 0x64, 0x65, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 
-    0x24, 0x81, 0x52, 0x4F, 0x20, 0x24, 0x84, 0x42, 0x61, 0x73, 0x65, 0x00, 0x20, 0x21, 0x84, 0x49, 
-    0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x8D, 0x43, 0x6F, 0x64, 0x65, 0x42, 0x61, 0x73, 0x65, 0x00, 
-    0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x87, 0x5A, 0x49, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 
-    0x20, 0x24, 0x87, 0x52, 0x57, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x94, 0x52, 0x4F, 
-    0x00, 0x5F, 0x65, 0x6E, 0x64, 0x00, 0x5F, 0x65, 0x64, 0x61, 0x74, 0x61, 0x00, 0x5F, 0x65, 0x74, 
-    0x65, 0x78, 0x74, 0x42, 0x10, 0x81, 0x81, 0x1C, 0x41, 0x80, 0x72, 0x20, 0x6F, 0x88, 0x74, 0x20, 
-    0x52, 0x57, 0x20, 0x64, 0x61, 0x74, 0x61, 0x41, 0xFF, 0x32, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 
-    0x79, 0x65, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x25, 0x73, 0x20, 0x61, 
-    0x6E, 0x64, 0x20, 0x25, 0x73, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x68, 0x20, 0x75, 0x6E, 0x65, 0x78, 
-    0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x6C, 0x79, 0x00, 0x32, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 
-    0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x20, 0x28, 0x73, 
-    0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 0x29, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x73, 
-    0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 
-    0x6E, 0x20, 0x25, 0x73, 0x00, 0x32, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 
-    0x6E, 0x20, 0x25, 0x73, 0x20, 0x28, 0x73, 0x69, 0x7A, 0x9D, 0x65, 0x20, 0x25, 0x64, 0x29, 0x20, 
-    0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x73, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 
-    0x67, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x00, 0x20, 0x24, 0x81, 0x5A, 0x49, 0x20, 0x24, 0x86, 
-    0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x00, 0x20, 0x24, 0x81, 0x5A, 0x49, 0x20, 0x24, 0x88, 0x42, 
-    0x61, 0x73, 0x65, 0x00, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x24, 0x40, 0x20, 0x24, 0x8B, 0x4C, 0x65, 
-    0x6E, 0x67, 0x74, 0x68, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x40, 0x9C, 0x32, 0x4C, 
-    0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x20, 0x28, 0x73, 
-    0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 0x29, 0x20, 0x65, 0x78, 0x63, 0x20, 0x65, 0x92, 0x64, 0x73, 
-    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 
-    0x2E, 0x41, 0x84, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x80, 0x72, 0x20, 0x6F, 0x80, 0x74, 
-    0x20, 0x24, 0x81, 0x5A, 0x49, 0x20, 0x24, 0x8B, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x00, 0x49, 
-    0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x80, 0x72, 0x20, 0x6F, 0x80, 0x74, 0x20, 0x24, 0x81, 0x5A, 
-    0x49, 0x20, 0x24, 0x88, 0x42, 0x61, 0x73, 0x65, 0x00, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x24, 0x80, 
-    0x72, 0x20, 0x6F, 0x80, 0x74, 0x20, 0x24, 0x83, 0x42, 0x61, 0x73, 0x65, 0x41, 0x84, 0x49, 0x6D, 
-    0x61, 0x67, 0x65, 0x20, 0x24, 0x80, 0x72, 0x20, 0x6F, 0x80, 0x74, 0x20, 0x24, 0x8B, 0x4C, 0x65, 
-    0x6E, 0x67, 0x74, 0x68, 0x00, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x24, 0x80, 0x72, 0x20, 0x6F, 
-    0x80, 0x74, 0x20, 0x24, 0x83, 0x42, 0x61, 0x73, 0x65, 0x41, 0x81, 0xEF, 0x81, 0x42, 0x82, 0x31, 
-    0x43, 0x4F, 0x20, 0x4D, 0x9D, 0x4F, 0x4E, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 
-    0x73, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 
-    0x20, 0x43, 0x4F, 0x20, 0x4D, 0xCE, 0x4F, 0x4E, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 
-    0x20, 0x28, 0x69, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x29, 0x2E, 
-    0x00, 0x31, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 
-    0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 
-    0x66, 0x20, 0x25, 0x73, 0x2E, 0x42, 0x10, 0x20, 0x80, 0x41, 0x97, 0x32, 0x45, 0x6E, 0x74, 0x72, 
-    0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 
-    0x6E, 0x20, 0x72, 0x20, 0x6F, 0xAD, 0x74, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 
-    0x00, 0x33, 0x41, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 
-    0x25, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x25, 0x78, 0x20, 0x68, 
-    0x61, 0x73, 0x20, 0x62, 0x20, 0x65, 0x91, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 
-    0x61, 0x74, 0x20, 0x25, 0x78, 0x2E, 0x00, 0x32, 0x41, 0x20, 0x74, 0xC1, 0x72, 0x69, 0x62, 0x75, 
-    0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x2D, 0x46, 0x49, 0x52, 0x53, 0x54, 0x2F, 0x4C, 0x41, 
-    0x53, 0x54, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 
-    0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E, 0x65, 0x69, 0x67, 0x68, 0x62, 
-    0x6F, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x0D, 0x22, 0x20, 
-    0x82, 0x28, 0x6D, 0x69, 0x20, 0x73, 0x8A, 0x69, 0x6E, 0x67, 0x2F, 0x65, 0x78, 0x74, 0x72, 0x61, 
-    0x20, 0x61, 0x20, 0x74, 0xC1, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 
-    0x20, 0x7B, 0x25, 0x73, 0x7D, 0x29, 0x2E, 0x00, 0x32, 0x44, 0x61, 0x74, 0x61, 0x20, 0x62, 0x61, 
-    0x73, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x25, 0x6C, 0x78, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 
-    0x61, 0x70, 0x73, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x61, 
-    0x74, 0x20, 0x25, 0x6C, 0x78, 0x2E, 0x00, 0x20, 0x24, 0x84, 0x64, 0x61, 0x74, 0x61, 0x00, 0x20, 
-    0x24, 0xA1, 0x7A, 0x69, 0x64, 0x61, 0x74, 0x61, 0x00, 0x30, 0x55, 0x6E, 0x72, 0x65, 0x66, 0x65, 
-    0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x28, 0x25, 0x73, 0x29, 
-    0x20, 0x6F, 0x6D, 0x69, 0x20, 0x74, 0xB6, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6F, 
-    0x75, 0x74, 0x70, 0x75, 0x74, 0x2E, 0x00, 0x30, 0x55, 0x6E, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 
-    0x6E, 0x63, 0x65, 0x64, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 
-    0x20, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x29, 0x20, 0x6F, 0x6D, 0x69, 0x20, 0x74, 
-    0x9A, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2E, 
-    0x00, 0x41, 0x52, 0x45, 0x41, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x00, 0x30, 0x26, 0x20, 0x96, 0x28, 
-    0x72, 0x65, 0x66, 0x20, 0x74, 0x6F, 0x20, 0x7C, 0x25, 0x73, 0x7C, 0x2B, 0x30, 0x78, 0x25, 0x6C, 
-    0x78, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x20, 0x66, 0xA6, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 
-    0x6C, 0x78, 0x29, 0x00, 0x32, 0x53, 0x74, 0x75, 0x62, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 
-    0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x61, 
-    0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0x82, 0x65, 0x73, 0x0D, 0x2C, 0x20, 0xBD, 0x73, 0x68, 
-    0x61, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x41, 
-    0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x32, 0x53, 0x68, 0x61, 
-    0x72, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 
-    0x29, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 
-    0x65, 0x20, 0x73, 0x82, 0x65, 0x73, 0x0D, 0x2C, 0x20, 0xD6, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x75, 0x62, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 
-    0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x72, 
-    0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x0D, 
-    0x00, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 
-    0x6F, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x25, 0x73, 0x0D, 
-    0x00, 0x20, 0x24, 0x84, 0x30, 0x00, 0x53, 0x48, 0x4C, 0x20, 0x24, 0x9A, 0x64, 0x61, 0x74, 0x61, 
-    0x00, 0x32, 0x44, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 
-    0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x6E, 0x20, 0x65, 0x92, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x6F, 
-    0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x2D, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x20, 0x73, 0x96, 
-    0x69, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x6C, 
-    0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x2E, 0x41, 0xA3, 0x31, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 
-    0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 
-    0x28, 0x25, 0x73, 0x29, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x52, 0x20, 0x45, 0xE9, 
-    0x4E, 0x54, 0x52, 0x41, 0x4E, 0x54, 0x2E, 0x00, 0x33, 0x4E, 0x6F, 0x20, 0x73, 0x68, 0x61, 0x72, 
-    0x65, 0x64, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x25, 
-    0x73, 0x2E, 0x00, 0x32, 0x45, 0x46, 0x54, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 
-    0x72, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 
-    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0x00, 0x2D, 0x00, 0x31, 0x25, 0x73, 0x2C, 0x20, 0x6C, 
-    0x69, 0x6E, 0x65, 0x20, 0x25, 0x75, 0x3A, 0x20, 0x6D, 0x69, 0x20, 0x73, 0xFF, 0x69, 0x6E, 0x67, 
-    0x20, 0x27, 0x29, 0x27, 0x2E, 0x00, 0x31, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 
-    0x25, 0x75, 0x3A, 0x20, 0x64, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x75, 
-    0x74, 0x70, 0x75, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 
-    0x64, 0x2E, 0x00, 0x32, 0x45, 0x46, 0x54, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x25, 0x73, 0x28, 
-    0x25, 0x73, 0x29, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x64, 0x65, 0x20, 
-    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x00, 0x31, 0x44, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 
-    0x74, 0x65, 0x20, 0x45, 0x46, 0x54, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x25, 0x73, 0x28, 
-    0x25, 0x73, 0x29, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0xAD, 0x31, 0x44, 
-    0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x45, 0x46, 0x54, 0x20, 0x65, 0x6E, 0x74, 
-    0x72, 0x79, 0x20, 0x25, 0x73, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x00, 0x32, 
-    0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x63, 0x61, 0x20, 0x6E, 0xF3, 0x6F, 
-    0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 
-    0x6F, 0x6D, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2D, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
-    0x79, 0x2E, 0x00, 0x31, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x73, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6D, 0x69, 0x67, 0x72, 0x61, 
-    0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x75, 0x62, 0x2E, 
-    0x00, 0x32, 0x45, 0x78, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x20, 0x25, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x00, 
-    0x31, 0x4D, 0x69, 0x20, 0x73, 0xBD, 0x69, 0x6E, 0x67, 0x20, 0x27, 0x29, 0x27, 0x20, 0x69, 0x6E, 
-    0x20, 0x45, 0x46, 0x54, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 
-    0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x32, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 
-    0x65, 0x20, 0x25, 0x75, 0x3A, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x72, 0x75, 0x6E, 0x63, 
-    0x61, 0x74, 0x65, 0x64, 0x41, 0xA8, 0x33, 0x45, 0x46, 0x54, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x62, 
-    0x6F, 0x74, 0x63, 0x68, 0x3A, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x75, 0x2C, 
-    0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x2E, 0x41, 
-    0x10, 0x81, 0x84, 0xD4, 0x41, 0x81, 0x33, 0x52, 0x20, 0x6F, 0x8E, 0x74, 0x20, 0x72, 0x65, 0x67, 
-    0x69, 0x6F, 0x6E, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 
-    0x73, 0x91, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 
-    0x2E, 0x00, 0x33, 0x52, 0x20, 0x6F, 0x8E, 0x74, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 
-    0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0xA6, 0x20, 0x6E, 
-    0x6F, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2E, 0x00, 0x33, 0x25, 
-    0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x55, 0x6E, 0x6B, 0x6E, 
-    0x6F, 0x77, 0x6E, 0x20, 0x61, 0x20, 0x74, 0xA4, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 
-    0x61, 0x6C, 0x75, 0x65, 0x20, 0x2D, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 
-    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x49, 0x6E, 0x63, 0x6F, 0x20, 0x72, 0xA1, 
-    0x65, 0x63, 0x74, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 
-    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 
-    0x63, 0x6F, 0x20, 0x72, 0x93, 0x65, 0x63, 0x74, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 
-    0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x4D, 0x69, 0x20, 0x73, 0xE8, 0x69, 0x6E, 0x67, 0x20, 
-    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x00, 0x33, 0x25, 0x73, 
-    0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x42, 0x61, 0x64, 0x20, 0x65, 
-    0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 
-    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x00, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x00, 
-    0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x65, 0x78, 
-    0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x62, 
-    0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0x85, 0x20, 0x69, 0x73, 
-    0x20, 0x6D, 0x69, 0x20, 0x73, 0xFE, 0x69, 0x6E, 0x67, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 
-    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x55, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x74, 0x6F, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x20, 0x65, 0x78, 0x65, 
-    0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 
-    0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x00, 0x33, 0x49, 0x6E, 0x76, 0x61, 0x6C, 
-    0x69, 0x64, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x62, 
-    0x61, 0x73, 0x65, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 
-    0x6C, 0x75, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x62, 
-    0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0x85, 0x20, 0x69, 0x73, 
-    0x20, 0x6D, 0x69, 0x20, 0x73, 0x83, 0x69, 0x6E, 0x67, 0x2E, 0x41, 0xEF, 0x33, 0x4C, 0x6F, 0x61, 
-    0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6C, 0x69, 
-    0x6D, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x2E, 0x00, 
-    0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x27, 0x7B, 
-    0x27, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x61, 0x73, 0x20, 0x65, 
-    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x46, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x27, 
-    0x25, 0x63, 0x27, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 
-    0x75, 0x20, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x20, 0x6F, 0x8E, 0x74, 
-    0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 
-    0x81, 0x72, 0x65, 0x20, 0x73, 0x9C, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
-    0x65, 0x64, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 
-    0x75, 0x20, 0x52, 0x20, 0x6F, 0x8C, 0x74, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x69, 
-    0x6E, 0x63, 0x6F, 0x20, 0x72, 0xA8, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x73, 0x70, 0x65, 0x63, 
-    0x69, 0x66, 0x69, 0x65, 0x64, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 
-    0x20, 0x25, 0x6C, 0x75, 0x20, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x20, 
-    0x6F, 0x8E, 0x74, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 
-    0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0x8C, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 
-    0x69, 0x66, 0x69, 0x65, 0x64, 0x2E, 0x41, 0x8E, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 
-    0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x52, 0x20, 0x6F, 0x91, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 
-    0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x20, 0x72, 0xB1, 0x65, 
-    0x63, 0x74, 0x6C, 0x79, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2E, 0x00, 
-    0x33, 0x49, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x2E, 0x00, 
-    0x72, 0x20, 0x6F, 0x95, 0x74, 0x2D, 0x64, 0x61, 0x74, 0x61, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 
-    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x45, 0x20, 0x72, 0x9F, 0x6F, 0x72, 0x20, 
-    0x69, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
-    0x61, 0x6D, 0x65, 0x2E, 0x00, 0x52, 0x4F, 0x00, 0x5A, 0x49, 0x00, 0x52, 0x57, 0x41, 0x10, 0x81, 
-    0x80, 0xAC, 0x41, 0x8F, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 
-    0x75, 0x3A, 0x20, 0x69, 0x20, 0x6E, 0xBD, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x25, 0x64, 0x2E, 
-    0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x3A, 0x20, 
-    0x6D, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x27, 0x29, 0x27, 0x20, 0x6F, 0x72, 
-    0x20, 0x27, 0x2C, 0x27, 0x2E, 0x41, 0x9B, 0x33, 0x42, 0x61, 0x64, 0x6C, 0x79, 0x20, 0x66, 0x6F, 
-    0x72, 0x6D, 0x65, 0x64, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x62, 0x61, 0x73, 
-    0x65, 0x20, 0x61, 0x20, 0x64, 0x81, 0x72, 0x65, 0x20, 0x73, 0xE5, 0x20, 0x69, 0x6E, 0x20, 0x6F, 
-    0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 
-    0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x3A, 0x20, 0x6D, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x63, 0x65, 
-    0x64, 0x20, 0x27, 0x28, 0x27, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6E, 0x65, 
-    0x20, 0x25, 0x6C, 0x75, 0x3A, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x69, 0x6E, 
-    0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x2D, 0x20, 0x75, 0x73, 0x65, 
-    0x20, 0x20, 0x27, 0x91, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 
-    0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0x41, 0x99, 0x31, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 
-    0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x25, 0x73, 
-    0x20, 0x74, 0x20, 0x6F, 0xBC, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x2D, 0x20, 0x74, 0x72, 0x75, 
-    0x6E, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x25, 0x64, 0x20, 0x63, 0x68, 0x61, 
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x2C, 0x20, 0x6C, 0x69, 
-    0x6E, 0x65, 0x20, 0x25, 0x6C, 0x75, 0x3A, 0x20, 0x6D, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x63, 0x65, 
-    0x64, 0x20, 0x20, 0x27, 0x80, 0x2E, 0x41, 0x9E, 0x72, 0x00, 0x33, 0x4C, 0x6F, 0x61, 0x64, 0x20, 
-    0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6C, 
-    0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x62, 0x20, 0x65, 0xA3, 0x6E, 0x20, 0x64, 0x65, 0x66, 0x69, 
-    0x6E, 0x65, 0x64, 0x2E, 0x00, 0x32, 0x4E, 0x6F, 0x20, 0x61, 0x72, 0x65, 0x61, 0x20, 0x69, 0x6E, 
-    0x20, 0x25, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 
-    0xC9, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x32, 0x4F, 0x76, 0x65, 
-    0x72, 0x6C, 0x61, 0x79, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 
-    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x00, 0x32, 0x4F, 0x76, 0x65, 
-    0x72, 0x6C, 0x61, 0x79, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x20, 0x6E, 
-    0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x00, 0x3A, 0x41, 0x82, 0xE7, 0x81, 0x04, 
-    0x41, 0x85, 0x25, 0x6C, 0x78, 0x00, 0x31, 0x41, 0x20, 0x74, 0x9E, 0x72, 0x69, 0x62, 0x75, 0x74, 
-    0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 
-    0x6E, 0x20, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x0D, 0x22, 0x20, 0x9F, 0x28, 0x63, 0x6F, 
-    0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x75, 
-    0x6E, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x20, 0x29, 0x80, 
-    0x2E, 0x41, 0xAF, 0x31, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 
-    0x75, 0x73, 0x65, 0x73, 0x20, 0x72, 0x65, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x2D, 0x33, 0x20, 
-    0x46, 0x50, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 
-    0x00, 0x31, 0x41, 0x20, 0x74, 0x93, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 
-    0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x62, 0x65, 0x74, 0x77, 0x20, 0x65, 0x9D, 0x6E, 0x20, 0x41, 
-    0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 
-    0x6D, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x2E, 0x00, 0x20, 0x24, 0x83, 0x44, 0x62, 
-    0x67, 0x4F, 0x20, 0x66, 0x83, 0x73, 0x65, 0x74, 0x00, 0x20, 0x24, 0x85, 0x4C, 0x69, 0x6D, 0x69, 
-    0x74, 0x00, 0x20, 0x24, 0x83, 0x42, 0x61, 0x73, 0x65, 0x41, 0xC9, 0x31, 0x53, 0x79, 0x6D, 0x62, 
-    0x6F, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x64, 
-    0x2C, 0x20, 0x25, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2E, 0x00, 0x32, 0x53, 0x70, 0x65, 0x63, 
-    0x69, 0x61, 0x6C, 0x20, 0x41, 0x4F, 0x46, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x20, 
-    0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x41, 0x9B, 0x41, 0x4D, 0x46, 0x5F, 0x52, 0x45, 0x4C, 0x4F, 0x43, 
-    0x00, 0x41, 0x49, 0x46, 0x5F, 0x52, 0x45, 0x4C, 0x4F, 0x43, 0x00, 0x41, 0x49, 0x46, 0x5F, 0x48, 
-    0x44, 0x52, 0x00, 0x20, 0x21, 0x41, 0xB6, 0x32, 0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 
-    0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x73, 0x2E, 0x00, 0x33, 
-    0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x28, 
-    0x25, 0x6C, 0x75, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x29, 0x20, 0x74, 0x20, 0x6F, 
-    0x84, 0x20, 0x62, 0x69, 0x67, 0x2E, 0x42, 0x82, 0xEF, 0x81, 0x04, 0x41, 0xD9, 0x32, 0x47, 0x6C, 
-    0x6F, 0x62, 0x61, 0x6C, 0x20, 0x25, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x79, 
-    0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x28, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x20, 
-    0x61, 0x6E, 0x64, 0x20, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x31, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 
-    0x20, 0x25, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x79, 0x20, 0x64, 0x65, 0x66, 
-    0x69, 0x6E, 0x65, 0x64, 0x20, 0x28, 0x69, 0x6E, 0x20, 0x25, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 
-    0x25, 0x73, 0x29, 0x2E, 0x00, 0x20, 0x21, 0x41, 0xFF, 0x32, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 
-    0x20, 0x25, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x6F, 0x74, 0x68, 
-    0x20, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 
-    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x72, 
-    0x74, 0x69, 0x61, 0x6C, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x69, 0x6E, 
-    0x20, 0x25, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x30, 0x42, 0x6F, 
-    0x74, 0x68, 0x20, 0x41, 0x52, 0x4D, 0x20, 0x26, 0x20, 0x54, 0x68, 0x75, 0x6D, 0x62, 0x20, 0x76, 
-    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x20, 0x70, 0x72, 
-    0x65, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x85, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 
-    0x41, 0xB2, 0x33, 0x25, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20, 
-    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
-    0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x00, 0x33, 0x25, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x6F, 0x20, 0x70, 0xB2, 0x6F, 0x73, 0x69, 0x74, 0x65, 0x20, 0x62, 0x79, 
-    0x74, 0x65, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 
-    0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
-    0x73, 0x2E, 0x00, 0x4C, 0x49, 0x42, 0x5F, 0x44, 0x49, 0x52, 0x59, 0x41, 0x80, 0x52, 0x20, 0x6F, 
-    0x80, 0x74, 0x20, 0x24, 0x8E, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x49, 0x6E, 0x66, 0x6F, 
-    0x00, 0x49, 0x57, 0x56, 0x20, 0x24, 0x8A, 0x43, 0x6F, 0x64, 0x65, 0x00, 0x3C, 0x61, 0x6E, 0x6F, 
-    0x6E, 0x3E, 0x42, 0x10, 0x81, 0x81, 0x04, 0x41, 0x8A, 0x31, 0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 
-    0x73, 0x20, 0x64, 0x69, 0x20, 0x66, 0x87, 0x65, 0x72, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x20, 
-    0x65, 0x9D, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x20, 0x61, 0x6E, 
-    0x64, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x31, 0x43, 0x4F, 
-    0x20, 0x4D, 0xAE, 0x4F, 0x4E, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x69, 0x73, 0x20, 
-    0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x69, 0x74, 0x73, 0x20, 
-    0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 
-    0x29, 0x2E, 0x41, 0x82, 0x30, 0x28, 0x61, 0x20, 0x74, 0x88, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
-    0x20, 0x64, 0x69, 0x20, 0x66, 0x91, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x7B, 
-    0x25, 0x73, 0x7D, 0x29, 0x2E, 0x00, 0x31, 0x41, 0x20, 0x74, 0x93, 0x72, 0x69, 0x62, 0x75, 0x74, 
-    0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x62, 0x65, 0x74, 0x77, 0x20, 
-    0x65, 0xB8, 0x6E, 0x20, 0x41, 0x52, 0x45, 0x41, 0x53, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 
-    0x20, 0x61, 0x6E, 0x64, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x2E, 0x00, 0x31, 0x41, 0x52, 
-    0x45, 0x41, 0x20, 0x25, 0x73, 0x28, 0x25, 0x73, 0x29, 0x20, 0x68, 0x61, 0x73, 0x20, 0x63, 0x6F, 
-    0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 0x89, 0x72, 0x69, 
-    0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x43, 0x4F, 0x20, 0x4D, 0x8A, 0x4F, 0x4E, 0x2C, 0x53, 0x48, 
-    0x4C, 0x44, 0x41, 0x54, 0x41, 0x3B, 0x22, 0x20, 0x82, 0x28, 0x43, 0x4F, 0x20, 0x4D, 0x8D, 0x4F, 
-    0x4E, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x29, 0x2E, 0x00, 0x43, 0x20, 0x24, 0x8C, 
-    0x66, 0x70, 0x6D, 0x61, 0x70, 0x00, 0x2C, 0x20, 0x00, 0x25, 0x73, 0x25, 0x73, 0x41, 0x95, 0x62, 
-    0x61, 0x73, 0x65, 0x2D, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x00, 0x53, 0x48, 0x4C, 
-    0x2D, 0x64, 0x61, 0x74, 0x61, 0x41, 0xC8, 0x42, 0x41, 0x53, 0x45, 0x44, 0x00, 0x41, 0x52, 0x4D, 
-    0x2F, 0x54, 0x48, 0x55, 0x4D, 0x42, 0x2D, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x77, 0x6F, 0x72, 0x6B, 
-    0x69, 0x6E, 0x67, 0x00, 0x41, 0x52, 0x4D, 0x2D, 0x48, 0x61, 0x6C, 0x66, 0x77, 0x6F, 0x72, 0x64, 
-    0x00, 0x54, 0x48, 0x55, 0x4D, 0x42, 0x00, 0x4E, 0x4F, 0x5F, 0x53, 0x57, 0x5F, 0x53, 0x54, 0x41, 
-    0x43, 0x4B, 0x5F, 0x43, 0x48, 0x45, 0x43, 0x4B, 0x00, 0x46, 0x50, 0x49, 0x53, 0x33, 0x00, 0x52, 
-    0x20, 0x45, 0x8E, 0x4E, 0x54, 0x52, 0x41, 0x4E, 0x54, 0x00, 0x33, 0x32, 0x62, 0x69, 0x74, 0x2D, 
-    0x50, 0x43, 0x41, 0x91, 0x44, 0x45, 0x42, 0x55, 0x47, 0x00, 0x50, 0x49, 0x43, 0x00, 0x52, 0x45, 
-    0x41, 0x44, 0x4F, 0x4E, 0x4C, 0x59, 0x41, 0x97, 0x30, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x43, 0x4F, 
-    0x4D, 0x52, 0x45, 0x46, 0x00, 0x43, 0x4F, 0x4D, 0x44, 0x45, 0x46, 0x00, 0x43, 0x4F, 0x44, 0x45, 
-    0x41, 0x91, 0x41, 0x42, 0x53, 0x00, 0x61, 0x72, 0x65, 0x61, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 
-    0x6D, 0x65, 0x6E, 0x74, 0x41, 0x98, 0x33, 0x55, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x6F, 
-    0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x5B, 0x25, 0x64, 0x5D, 0x2E, 0x41, 
-    0x81, 0x6F, 0x81, 0x46, 0xD9, 0x53, 0x48, 0x4C, 0x5F, 0x4C, 0x49, 0x42, 0x59, 0x00, 0x4F, 0x42, 
-    0x4A, 0x5F, 0x53, 0x54, 0x52, 0x54, 0x00, 0x4F, 0x42, 0x4A, 0x5F, 0x53, 0x59, 0x4D, 0x54, 0x00, 
-    0x4F, 0x42, 0x4A, 0x5F, 0x41, 0x52, 0x45, 0x41, 0x00, 0x4F, 0x42, 0x4A, 0x5F, 0x49, 0x44, 0x46, 
-    0x4E, 0x00, 0x4F, 0x42, 0x4A, 0x5F, 0x48, 0x45, 0x41, 0x44, 0x00, 0x35, 0x2E, 0x30, 0x34, 0x20, 
-    0x28, 0x41, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x52, 0x49, 0x53, 0x43, 0x20, 0x4D, 
-    0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x72, 0x65, 0x6C, 0x31, 0x39, 0x35, 0x29, 0x41, 
-    0x8D, 0x25, 0x73, 0x20, 0x25, 0x73, 0x00, 0x32, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x6F, 0x20, 
-    0x66, 0xED, 0x73, 0x65, 0x74, 0x20, 0x2B, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x20, 0x6E, 0x6F, 0x74, 
-    0x20, 0x69, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 
-    0x5B, 0x2B, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x2C, 0x20, 0x2B, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x29, 
-    0x2E, 0x00, 0x32, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x30, 
-    0x78, 0x25, 0x6C, 0x78, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 
-    0x65, 0x20, 0x5B, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x2C, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x78, 0x29, 
-    0x2E, 0x00, 0x32, 0x43, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x20, 0x62, 0x65, 0x74, 0x77, 
-    0x20, 0x65, 0xE2, 0x6E, 0x20, 0x2D, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x6F, 0x70, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x45, 0x4E, 0x54, 0x52, 0x59, 0x20, 0x69, 0x6E, 0x20, 
-    0x41, 0x52, 0x45, 0x41, 0x20, 0x25, 0x73, 0x00, 0x33, 0x4E, 0x6F, 0x20, 0x65, 0x6E, 0x74, 0x72, 
-    0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 
-    0x65, 0x2E, 0x00, 0x20, 0x25, 0x2E, 0x32, 0x58, 0x0D, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 
-    0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x3A, 0x25, 0x2E, 0x32, 0x58, 
-    0x20, 0x25, 0x2E, 0x34, 0x58, 0x20, 0x20, 0x30, 0xC2, 0x20, 0x00, 0x33, 0x25, 0x6C, 0x75, 0x20, 
-    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x2D, 0x77, 0x6F, 
-    0x72, 0x64, 0x20, 0x6C, 0x6F, 0x73, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x77, 0x6F, 
-    0x72, 0x64, 0x20, 0x30, 0x78, 0x25, 0x2E, 0x6C, 0x78, 0x20, 0x6F, 0x66, 0x20, 0x49, 0x48, 0x46, 
-    0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2E, 0x0D, 0x00, 0x33, 0x45, 0x20, 0x72, 0x8D, 0x6F, 
-    0x72, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x25, 0x73, 0x2E, 0x41, 0x90, 0x33, 
-    0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x20, 0x63, 0x6F, 
-    0x20, 0x72, 0x96, 0x75, 0x70, 0x74, 0x2E, 0x00, 0x33, 0x43, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x6F, 
-    0x70, 0x65, 0x6E, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x33, 0x45, 0x20, 0x72, 0xB0, 0x6F, 0x72, 0x20, 
-    0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x2E, 
-    0x00, 0x33, 0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 
-    0x20, 0x28, 0x25, 0x6C, 0x75, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29, 0x20, 0x74, 0x20, 0x6F, 
-    0x84, 0x20, 0x62, 0x69, 0x67, 0x2E, 0x41, 0xBD, 0x33, 0x4F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 
-    0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2E, 0x00, 0x30, 0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 
-    0x73, 0x68, 0x6F, 0x72, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x20, 0x75, 0x6E, 0x63, 0x61, 0x63, 0x68, 
-    0x69, 0x6E, 0x67, 0x20, 0x25, 0x73, 0x2E, 0x00, 0x33, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x25, 0x73, 
-    0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x20, 0x65, 0xD2, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x6E, 0x63, 
-    0x61, 0x74, 0x65, 0x64, 0x2E, 0x00, 0x30, 0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x75, 0x73, 
-    0x61, 0x67, 0x65, 0x3A, 0x20, 0x68, 0x65, 0x61, 0x70, 0x3D, 0x25, 0x64, 0x2C, 0x20, 0x68, 0x65, 
-    0x61, 0x70, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x3D, 0x25, 0x64, 0x2C, 0x20, 0x74, 0x65, 0x6D, 0x70, 
-    0x3D, 0x25, 0x64, 0x2C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3D, 0x25, 0x64, 0x2E, 0x00, 0x25, 
-    0x73, 0x3A, 0x20, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x2C, 0x20, 0x20, 0xA4, 0x25, 
-    0x64, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x2C, 
-    0x20, 0x25, 0x64, 0x20, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 
-    0x25, 0x64, 0x20, 0x65, 0x20, 0x72, 0x84, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x20, 0x73, 0x8E, 0x61, 
-    0x67, 0x65, 0x73, 0x2E, 0x0D, 0x00, 0x25, 0x73, 0x3A, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x20, 0x72, 
-    0x9D, 0x75, 0x70, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2E, 0x0D, 
-    0x00, 0x25, 0x73, 0x3A, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x20, 
-    0x72, 0x8B, 0x6F, 0x72, 0x2E, 0x0D, 0x00, 0x25, 0x73, 0x3A, 0x20, 0x25, 0x73, 0x00, 0x21, 0x23, 
-    0x8A, 0x20, 0x41, 0x52, 0x4D, 0x20, 0x4C, 0x69, 0x6E, 0x6B, 0x65, 0x72, 0x41, 0xA2, 0x25, 0x73, 
-    0x3A, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x25, 0x73, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x64, 
-    0x0D, 0x42, 0x81, 0x73, 0x62, 0x20, 0x24, 0x8D, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x4C, 0x55, 0x64, 
-    0x61, 0x74, 0x61, 0x00, 0x73, 0x62, 0x20, 0x24, 0x8C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x4C, 0x55, 
-    0x63, 0x6F, 0x64, 0x65, 0x00, 0x72, 0x20, 0x6F, 0x90, 0x74, 0x00, 0x6D, 0x6B, 0x64, 0x69, 0x72, 
-    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x75, 0x20, 0x70, 0x88, 0x6F, 0x72, 0x74, 
-    0x65, 0x64, 0x20, 0x79, 0x65, 0x74, 0x40, 0x00, 0x00, 0x00, 0x00, 0x92, 0xEC, 0xD5, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x7E, 0x61, 0x82, 0x82, 0xEE, 0xFE, 0xFE, 0xFE, 0xFE, 0xEC, 0xFE, 0xFE, 0xFE, 
-    0xFE, 0xEC, 0xFE, 0xFE, 0xFE, 0xFE, 0xDA, 0xE0, 0x7E, 0xFC, 0x7F, 0x3E, 0x7E, 0xA0, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7F, 0x11, 0x86, 
-    0x86, 0x7F, 0x56, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
-    0x86, 0x86, 0x86, 0x86, 0x86, 0x7F, 0x8A, 0xFE, 0xFE, 0xFE, 0xF4, 0xFD, 0xFE, 0xF6, 0xFE, 0x8A, 
-    0xF0, 0x7F, 0xA0, 0xDC, 0x7F, 0x24, 0x88, 0x00, 0x00, 0x00, 0x20, 0x79, 0x69, 0x7E, 0xE1, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7F, 0xA6, 
-    0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x82, 0x82, 0x82, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x59, 0x4E, 0xCF, 0x42, 0x68, 0x83, 0x9F, 0x83, 0x40, 0x73, 0xE3, 
-    0xF2, 0x83, 0x8E, 0x9D, 0x95, 0x40, 0x8D, 0x40, 0x47, 0xE1, 0x40, 0x6A, 0xA5, 0x41, 0xF1, 0x86, 
-    0x9B, 0xBF, 0x40, 0x5C, 0x40, 0x4A, 0x40, 0x4B, 0xAE, 0x98, 0xA4, 0x9A, 0x41, 0xC6, 0x9B, 0xB7, 
-    0x8C, 0x41, 0xD5, 0x40, 0x97, 0xAE, 0x83, 0x83, 0x41, 0x5C, 0x8D, 0x91, 0x98, 0x8E, 0x9C, 0xA9, 
-    0x40, 0x9C, 0x9A, 0x9D, 0x95, 0xAC, 0x88, 0xBF, 0x40, 0x4E, 0x40, 0x62, 0x9B, 0x40, 0xAC, 0x7F, 
-    0x73, 0x40, 0x7A, 0xC8, 0x41, 0x6E, 0x40, 0x5E, 0x9E, 0x40, 0x47, 0x40, 0x4A, 0x8E, 0x98, 0x89, 
-    0x40, 0x9C, 0x40, 0x8D, 0x9E, 0xF2, 0xB0, 0x92, 0xB8, 0x97, 0x9E, 0x94, 0x93, 0x40, 0xCB, 0x40, 
-    0x9D, 0x40, 0x68, 0x9D, 0x95, 0x94, 0xB3, 0x99, 0x96, 0xB3, 0x41, 0xA7, 0x97, 0xA1, 0x9E, 0xAE, 
-    0xE9, 0xED, 0x8F, 0x97, 0x40, 0x45, 0x41, 0x05, 0x7F, 0x10, 0x9A, 0x40, 0xBF, 0x40, 0x4B, 0x40, 
-    0xD7, 0x40, 0x73, 0x40, 0x9F, 0x40, 0x5F, 0xBC, 0xA0, 0x40, 0x9A, 0x8E, 0x40, 0x65, 0xAA, 0x40, 
-    0x9D, 0x7F, 0xBA, 0xD1, 0x99, 0xAA, 0x8F, 0xBE, 0x94, 0xB4, 0x40, 0xCC, 0x8C, 0xBB, 0x96, 0x41, 
-    0x9B, 0x7E, 0x72, 0xB9, 0x8D, 0xBA, 0xA2, 0x8C, 0x40, 0xD8, 0x7F, 0x38, 0x8B, 0x91, 0x88, 0x40, 
-    0x6F, 0xD3, 0x9D, 0x40, 0x5B, 0x93, 0x8E, 0x40, 0x46, 0x40, 0x5B, 0xD8, 0x40, 0x50, 0xB0, 0x8A, 
-    0x40, 0xDB, 0xAA, 0x41, 0xA3, 0x41, 0x71, 0x40, 0x4A, 0xA5, 0xA0, 0xB9, 0xDC, 0xBC, 0x8A, 0xA0, 
-    0x8A, 0xA2, 0x40, 0xB8, 0x8E, 0xBC, 0x40, 0x4C, 0x88, 0x40, 0x84, 0xB8, 0x8B, 0x40, 0x4A, 0x9B, 
-    0x9C, 0x8B, 0x41, 0x59, 0xBE, 0x8F, 0x40, 0xC6, 0x41, 0x78, 0x40, 0x8F, 0xA4, 0x9C, 0x84, 0x40, 
-    0xEA, 0x8B, 0x42, 0xDC, 0x7D, 0x9E, 0x8E, 0xA4, 0x84, 0x41, 0x40, 0x40, 0xAD, 0xBA, 0x40, 0x62, 
-    0x9C, 0x41, 0x68, 0xA8, 0x40, 0xE9, 0x88, 0x8B, 0x8D, 0x88, 0x41, 0x30, 0x7E, 0xF2, 0x40, 0x8C, 
-    0xC7, 0x40, 0x80, 0xE1, 0xC3, 0xE3, 0x96, 0xA3, 0x9A, 0x9F, 0x40, 0x6E, 0x40, 0x99, 0xE2, 0x7F, 
-    0xBA, 0x96, 0xAD, 0x40, 0x44, 0x8B, 0x8B, 0x8F, 0x92, 0x92, 0x89, 0x83, 0x8B, 0x83, 0x88, 0x83, 
-    0x8D, 0x83, 0x93, 0x8C, 0x91, 0x40, 0xCD, 0x84, 0x98, 0x96, 0x8F, 0x41, 0xFD, 0x7F, 0xBC, 0x41, 
-    0x37, 0x7F, 0x1F, 0x41, 0x2F, 0x83, 0x8A, 0x91, 0x94, 0x8A, 0x41, 0x05, 0xA9, 0x91, 0x40, 0x48, 
-    0xA4, 0x41, 0xE3, 0x7F, 0x9F, 0x7E, 0x98, 0x40, 0x9A, 0x41, 0xB2, 0x7E, 0xAF, 0x41, 0xBE, 0xF3, 
-    0xC8, 0xF3, 0x7F, 0x6F, 0xE6, 0x7F, 0xB9, 0xE6, 0x7F, 0xBA, 0x40, 0xF9, 0x40, 0xEE, 0xAC, 0x40, 
-    0x64, 0x40, 0x87, 0x97, 0x40, 0x95, 0xB9, 0x44, 0x35, 0x7D, 0x42, 0x42, 0xCC, 0x7D, 0x41, 0x42, 
-    0xCD, 0x7D, 0x41, 0x40, 0xF3, 0x98, 0x41, 0x51, 0xA3, 0x41, 0xE4, 0x40, 0x57, 0x91, 0x91, 0x90, 
-    0x40, 0xF6, 0x40, 0x67, 0x41, 0x0A, 0x88, 0x40, 0x44, 0x40, 0x9C, 0x84, 0x8F, 0xBB, 0x83, 0x83, 
-    0xA0, 0x98, 0xA2, 0xA2, 0x40, 0x58, 0xCA, 0x92, 0x40, 0x57, 0x41, 0x47, 0x41, 0x32, 0xAF, 0x40, 
-    0x5C, 0xB9, 0x40, 0xB2, 0x40, 0xFE, 0x40, 0x4F, 0xD2, 0xB2, 0xD2, 0x8A, 0x40, 0x54, 0x7F, 0xB9, 
-    0xA7, 0x84, 0x84, 0x84, 0x87, 0x40, 0xC0, 0xB2, 0x91, 0x40, 0x4F, 0x94, 0x95, 0xB5, 0x40, 0x67, 
-    0xD1, 0xD0, 0xA8, 0xAF, 0x9C, 0x99, 0xA9, 0xA3, 0x40, 0x4F, 0xAE, 0x8B, 0x8E, 0xBF, 0x89, 0xBA, 
-    0x83, 0x83, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0x50, 0xA2, 0xB4, 0x8A, 0xA6, 
-    0x9A, 0xA7, 0x90, 0x91, 0xBD, 0x8F, 0x40, 0x7B, 0x90, 0x90, 0x40, 0xB8, 0xB6, 0x40, 0xB2, 0x40, 
-    0x58, 0x8A, 0x40, 0x92, 0xBC, 0x40, 0x6F, 0xAF, 0x92, 0x8F, 0x40, 0x59, 0x40, 0x87, 0xDF, 0x45, 
-    0x7A, 0x7E, 0xA1, 0x7F, 0x77, 0x7D, 0x6A, 0x7F, 0x7A, 0x7F, 0xA4, 0x96, 0x92, 0x94, 0x8B, 0xB3, 
-    0x8F, 0x8F, 0x8A, 0x8A, 0xA5, 0xE5, 0xB8, 0xD2, 0xBE, 0x46, 0x4C, 0x7E, 0xFB, 0x7F, 0xBF, 0xD2, 
-    0xCE, 0xD1, 0x7F, 0x14, 0x7F, 0x55, 0xDF, 0xE9, 0xC8, 0x7F, 0x2F, 0xCB, 0x7F, 0xB5, 0xD2, 0x7F, 
-    0xAA, 0x7F, 0xBF, 0x7F, 0xB5, 0x41, 0x32, 0xE5, 0x7F, 0x0B, 0xE5, 0x41, 0x1C, 0x7E, 0xF0, 0xAA, 
-    0x44, 0x96, 0x7E, 0x9E, 0x7F, 0x55, 0x7D, 0xBA, 0xD5, 0x93, 0x8A, 0x40, 0x46, 0xF0, 0x9C, 0x90, 
-    0xAD, 0x40, 0x4C, 0xA5, 0x8F, 0xA6, 0x8A, 0x8F, 0x8A, 0x8F, 0x8E, 0x8A, 0x8E, 0x8E, 0x8F, 0x8E, 
-    0x8B, 0x83, 0x8A, 0x90, 0xA9, 0x8F, 0x96, 0xBB, 0xDC, 0xB0, 0x99, 0x8A, 0x8F, 0x8A, 0x8A, 0x88, 
-    0x91, 0xF9, 0x96, 0x8A, 0x8A, 0x9A, 0x8F, 0x40, 0x6B, 0x7F, 0xA2, 0x8F, 0x8A, 0x8A, 0x90, 0x8A, 
-    0x8A, 0x8A, 0x99, 0x8F, 0x8A, 0x8A, 0x8A, 0x90, 0xB8, 0x8A, 0xA2, 0x8F, 0xAF, 0x99, 0x89, 0x9F, 
-    0x96, 0x8C, 0x40, 0x45, 0xAD, 0x40, 0x4B, 0x8F, 0x8E, 0xB2, 0x95, 0x8E, 0x8E, 0x9B, 0xA2, 0x91, 
-    0x89, 0x8E, 0xBF, 0xD2, 0x9D, 0xA4, 0x93, 0x8F, 0x9C, 0x9B, 0xAE, 0x8D, 0x8D, 0x8F, 0x99, 0x93, 
-    0x85, 0x85, 0x85, 0x40, 0x8B, 0x8D, 0x96, 0x90, 0x8C, 0x8C, 0x90, 0x9D, 0x92, 0x90, 0xAB, 0x8D, 
-    0x86, 0x86, 0x8A, 0x42, 0x2E, 0xDB, 0x7E, 0x8C, 0xEB, 0xEB, 0xE2, 0xEA, 0xEA, 0xEA, 0x8E, 0x96, 
-    0x96, 0x95, 0x9E, 0x95, 0x95, 0xBB, 0x40, 0x66, 0x8E, 0xA8, 0x8A, 0x92, 0x8A, 0x94, 0x40, 0x41, 
-    0x88, 0x9A, 0x8C, 0x99, 0xAE, 0xAE, 0x97, 0x40, 0x7D, 0x8C, 0xB0, 0xBB, 0x40, 0xC2, 0x8B, 0x47, 
-    0x02, 0x90, 0x8E, 0x00, 0x00, 0x00, 0xC2, 0x40, 0x51, 0x83, 0xAF, 0x41, 0xDE, 0x91, 0xA7, 0x95, 
-    0x90, 0x5C, 0x90, 0x43, 0xC0, 0x41, 0xFC, 0x45, 0x1E, 0x41, 0xAE, 0x46, 0xBE, 0x7F, 0xA7, 0x7E, 
-    0xBC, 0x41, 0x70, 0x7F, 0x2D, 0x7F, 0x8C, 0x41, 0xEB, 0x40, 0x51, 0x00, 0x00, 0x6F, 0x29, 0x41, 
-    0xE5, 0x49, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x40, 0x41, 0xF6, 0x44, 0xDB, 0x40, 0x43, 0x4C, 0xF7, 
-    0x9D, 0x94, 0x83, 0x8D, 0x40, 0x4A, 0xE2, 0xDF, 0x8C, 0x8C, 0x40, 0x7B, 0x9D, 0x40, 0x4D, 0xA0, 
-    0xAE, 0x93, 0x9B, 0x83, 0x97, 0x9B, 0x9E, 0x91, 0x40, 0x43, 0xE9, 0x40, 0x78, 0x7F, 0xB8, 0xA8, 
-    0xA5, 0x95, 0x8B, 0x40, 0x54, 0xC5, 0x8B, 0x88, 0x8A, 0x92, 0x9A, 0x40, 0x7E, 0x7F, 0x95, 0x95, 
-    0x90, 0x40, 0x40, 0xEA, 0xA1, 0x91, 0x9B, 0x83, 0x8D, 0x40, 0x44, 0x91, 0x40, 0x42, 0x83, 0x40, 
-    0x5B, 0x83, 0xAB, 0x40, 0x49, 0xF6, 0xEF, 0xEF, 0x40, 0x6A, 0x40, 0x8D, 0xCC, 0xA9, 0x91, 0xB7, 
-    0xB2, 0xB6, 0xB7, 0xF6, 0xEF, 0xB4, 0x40, 0x50, 0x9E, 0xB2, 0xF2, 0xEE, 0x40, 0x5B, 0x40, 0x8A, 
-    0x7F, 0xA0, 0x40, 0x6B, 0x7F, 0xA0, 0xAB, 0xF8, 0x41, 0x38, 0x8B, 0x89, 0x40, 0x82, 0x40, 0xD1, 
-    0x7F, 0x88, 0x40, 0x5D, 0xCC, 0x40, 0x64, 0x8B, 0x9B, 0x41, 0xC6, 0x7E, 0x90, 0x41, 0x19, 0x7F, 
-    0x72, 0x7F, 0xBE, 0x40, 0x9E, 0x40, 0x6B, 0x40, 0x68, 0x91, 0xB8, 0xE3, 0xAA, 0x41, 0x93, 0x87, 
-    0x40, 0x4B, 0x90, 0xA1, 0x41, 0x26, 0x95, 0xAD, 0x41, 0xCA, 0x98, 0x8B, 0x85, 0x40, 0x6C, 0x88, 
-    0x93, 0x89, 0x96, 0x41, 0xCC, 0x7F, 0xBC, 0xEF, 0x7F, 0xA8, 0x7F, 0x76, 0xF3, 0xEF, 0xF0, 0xEF, 
-    0x41, 0x59, 0xEF, 0xCB, 0xE8, 0xF2, 0xE9, 0xE0, 0xF2, 0xF0, 0xF0, 0xEB, 0xEB, 0xF2, 0x40, 0xF3, 
-    0x7F, 0x3F, 0x40, 0x8A, 0xDA, 0x40, 0x7F, 0x40, 0x40, 0x40, 0x76, 0xF4, 0x94, 0x8C, 0x40, 0x56, 
-    0xE1, 0x8E, 0x99, 0xB4, 0xAC, 0x40, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x43, 
-    0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x43, 
-    0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x31, 0x39, 
-    0x39, 0x38, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 
-    0x0F, 0x4E, 0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x44, 0x44, 0x4B, 0x73, 0x20, 0x31, 0x2E, 0x30, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x8B, 
-    0x02, 0x75, 0x77, 0x7C, 0x2A, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x86, 0x00, 0x03, 0x63, 0x66, 
-    0x72, 0x67, 0x00, 0x00, 0x00, 0x22, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x01, 0x00, 0x2E, 0x44, 0x41, 
-    0x54, 0x41, 0x00, 0x00, 0x00, 0x46, 0x76, 0x65, 0x72, 0x73, 0x00, 0x01, 0x00, 0x52, 0x00, 0x00, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x28, 0x00, 
-    0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x01, 0x48, 0xF0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x01, 0x49, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0xFF, 0xFF, 0x20, 0x01, 0x8E, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x01, 
-    0x8E, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4D, 0x61, 0x69, 0x6E, 
-};
-
-unsigned char *gAppResource = rsrc;
-unsigned int gAppResourceSize = sizeof(rsrc);
+MOS_INCBIN("rsrc_armlink.bin")
+unsigned int gAppResourceCompressed = 1;
 
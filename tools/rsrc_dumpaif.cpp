@@ -1,2674 +1,6 @@
 
 #include "rsrc.h"
 
-unsigned char rsrc[] = {
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA5, 0x9B, 0x00, 0x00, 0xA4, 0x9B, 0x00, 0x00, 0x00, 0xE9, 
-    0x00, 0x00, 0x00, 0x02, 0x0A, 0x44, 0x65, 0x73, 0x6B, 0x74, 0x6F, 0x70, 0x20, 0x44, 0x42, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x42, 0x54, 0x46, 0x4C, 0x44, 0x4D, 0x47, 0x52, 0x40, 0x00, 0x00, 0x00, 
-    0x07, 0x44, 0x75, 0x6D, 0x70, 0x41, 0x49, 0x46, 0x02, 0x00, 0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 
-    0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x58, 
-    0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x9C, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAF, 0x7A, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x84, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x44, 0x65, 0x73, 
-    0x6B, 0x74, 0x6F, 0x70, 0x20, 0x44, 0x46, 0x00, 0x02, 0x00, 0x00, 0x00, 0x44, 0x54, 0x46, 0x4C, 
-    0x44, 0x4D, 0x47, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x07, 0xA2, 0x58, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA6, 0x9E, 0x07, 0xF6, 0xA9, 0x58, 0x71, 0xF4, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x2C, 0x7D, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 
-    0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x03, 0x70, 0x00, 0x00, 0x24, 0x5C, 0x00, 0x00, 0x03, 0x50, 
-    0x00, 0x00, 0x00, 0x20, 0x21, 0x3A, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x04, 0x76, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x05, 0x10, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x17, 0x0A, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x17, 0xA6, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x18, 0xC4, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x19, 0x08, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x19, 0x40, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x19, 0x7E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x19, 0xF0, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x1B, 0xD2, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x1C, 0x28, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x22, 0x8E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x23, 0x16, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x26, 0x04, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x26, 0x2A, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x26, 0x4E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x26, 0x72, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x26, 0xC2, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x27, 0x50, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x28, 0x28, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x28, 0x9E, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x28, 0xCE, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x29, 0x0E, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x29, 0x20, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x29, 0x32, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x29, 0x84, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x29, 0x9E, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x29, 0xA2, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2A, 0x24, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2A, 0x48, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2A, 0x74, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2A, 0x94, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2A, 0xB6, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2A, 0xEE, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2B, 0x04, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2B, 0x1A, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2B, 0x2C, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2B, 0x3E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2B, 0x86, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2B, 0xCE, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2C, 0x0E, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2C, 0x6C, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x2C, 0xE6, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x2E, 0x3E, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x30, 0x4C, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x30, 0xC2, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xF0, 0x30, 0xF0, 0x3F, 0x3C, 
-    0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x24, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xF0, 0x00, 0x38, 0x3F, 0x3C, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x3F, 0x3C, 
-    0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x76, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xF0, 0x00, 0xE8, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x01, 0x80, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xF0, 0x02, 0x18, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x03, 0x24, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xF0, 0x05, 0x32, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x06, 0xF0, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xF0, 0x07, 0xC0, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x08, 0xC6, 0x3F, 0x3C, 
-    0x00, 0x04, 0xA9, 0xF0, 0x09, 0xC4, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xF0, 0x04, 0xB4, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x06, 0x2C, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x0B, 0x72, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x0C, 0x0A, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x0C, 0x7A, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x0D, 0x0C, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x0E, 0xD6, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x14, 0x56, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x14, 0xD0, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x14, 0xE6, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x15, 0x1A, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x15, 0x50, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x15, 0x88, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x15, 0x9A, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x17, 0x1E, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x17, 0x34, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x17, 0x48, 0x3F, 0x3C, 
-    0x00, 0x05, 0xA9, 0xF0, 0x17, 0x76, 0x3F, 0x3C, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x5E, 0x3F, 0x3C, 
-    0x00, 0x06, 0xA9, 0xF0, 0x00, 0xC4, 0x3F, 0x3C, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0xF4, 0x3F, 0x3C, 
-    0x00, 0x06, 0xA9, 0xF0, 0x04, 0x70, 0x3F, 0x3C, 0x00, 0x06, 0xA9, 0xF0, 0x05, 0x8A, 0x3F, 0x3C, 
-    0x00, 0x06, 0xA9, 0xF0, 0x05, 0xCC, 0x3F, 0x3C, 0x00, 0x06, 0xA9, 0xF0, 0x06, 0x22, 0x3F, 0x3C, 
-    0x00, 0x06, 0xA9, 0xF0, 0x06, 0x82, 0x3F, 0x3C, 0x00, 0x06, 0xA9, 0xF0, 0x06, 0xAE, 0x3F, 0x3C, 
-    0x00, 0x06, 0xA9, 0xF0, 0x06, 0xC6, 0x3F, 0x3C, 0x00, 0x06, 0xA9, 0xF0, 0x08, 0x30, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x09, 0x44, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x0A, 0x8A, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x0B, 0xF2, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x0D, 0x16, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x11, 0xC6, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x11, 0xE8, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x14, 0x2E, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x15, 0x66, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x16, 0x0A, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x16, 0x54, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x16, 0xA0, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x16, 0xE8, 0x3F, 0x3C, 
-    0x00, 0x07, 0xA9, 0xF0, 0x17, 0x44, 0x3F, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 0x09, 0xAC, 0x3F, 0x3C, 
-    0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x32, 0xEA, 0x00, 0x00, 0x00, 0x30, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x2D, 0xED, 0x84, 0x48, 0x6D, 0xDD, 0x8E, 0x48, 0x6D, 
-    0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x20, 0x0C, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x12, 0x2F, 0x0C, 
-    0x48, 0x6D, 0xDD, 0x98, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x52, 
-    0x48, 0x6D, 0xF6, 0xF6, 0x48, 0x6D, 0xDD, 0x9E, 0x4E, 0xAD, 0x02, 0xFA, 0x4F, 0xEF, 0x00, 0x14, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x76, 0x5F, 0x67, 0x6F, 0x6F, 0x66, 0x5F, 
-    0x5F, 0x46, 0x50, 0x43, 0x63, 0x54, 0x31, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 0x48, 0x6D, 0xDD, 0xA2, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFF, 0x76, 0x70, 0x02, 0x2B, 0x40, 0xED, 0x80, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x6D, 0x65, 0x73, 
-    0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x18, 0x47, 0xED, 0xED, 0x88, 0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 
-    0x2F, 0x0C, 0x48, 0x6D, 0xDD, 0xA8, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFF, 0x30, 0x2F, 0x2D, 
-    0xED, 0x84, 0x2F, 0x0B, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x24, 0x94, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x75, 
-    0x73, 0x61, 0x67, 0x65, 0x5F, 0x65, 0x78, 0x69, 0x74, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x5F, 0x6D, 
-    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0x00, 0x2F, 0x0C, 0x49, 0xEE, 0xFF, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x6D, 0xDD, 0xB2, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0xFE, 0xD6, 0x2F, 0x0C, 0x30, 0x2E, 0x00, 0x0A, 0x48, 0xC0, 
-    0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x6A, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xDD, 0xB8, 0x48, 0x6D, 
-    0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x28, 0x6E, 0xFE, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x76, 
-    0x5F, 0x65, 0x72, 0x72, 0x5F, 0x67, 0x6F, 0x6F, 0x66, 0x5F, 0x5F, 0x46, 0x73, 0x50, 0x63, 0x54, 
-    0x32, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x3E, 0x2D, 0xF5, 0x84, 
-    0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 0x4A, 0x47, 0x67, 0x14, 0x2F, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xFF, 0x86, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 
-    0x2F, 0x0C, 0x48, 0x6D, 0xDD, 0xC0, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x60, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x23, 0xCE, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x65, 0x78, 0x69, 0x74, 0x5F, 0x77, 0x69, 0x74, 0x68, 
-    0x5F, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x65, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x3E, 0x2E, 0x00, 0x0A, 0x67, 0x24, 0x41, 0xEE, 
-    0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0xC7, 0x2F, 0x07, 
-    0x4E, 0xBA, 0xFF, 0x1C, 0x70, 0x02, 0x2B, 0x40, 0xED, 0x80, 0x70, 0x01, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x52, 
-    0x65, 0x70, 0x6F, 0x72, 0x74, 0x4F, 0x53, 0x45, 0x72, 0x72, 0x5F, 0x5F, 0x46, 0x73, 0x50, 0x63, 
-    0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x3E, 0x2E, 0x00, 0x0A, 
-    0x67, 0x22, 0x41, 0xEE, 0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xFE, 0xC8, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x23, 0x28, 
-    0x4F, 0xEF, 0x00, 0x10, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x65, 
-    0x78, 0x69, 0x74, 0x5F, 0x69, 0x66, 0x5F, 0x4F, 0x53, 0x45, 0x72, 0x72, 0x5F, 0x5F, 0x46, 0x73, 
-    0x50, 0x63, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x58, 0x80, 0xB0, 0xAE, 0x00, 0x0C, 0x65, 0x12, 0x2F, 0x14, 0x2F, 0x2E, 0x00, 0x10, 
-    0x48, 0x6D, 0xDD, 0xC6, 0x4E, 0xBA, 0xFE, 0x16, 0x4F, 0xEF, 0x00, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x61, 0x73, 0x73, 0x75, 0x72, 0x65, 0x4E, 0x65, 0x78, 0x74, 0x41, 
-    0x72, 0x67, 0x5F, 0x5F, 0x46, 0x50, 0x50, 0x43, 0x63, 0x54, 0x31, 0x50, 0x63, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x70, 0x00, 0x10, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0xB2, 0x1E, 0x00, 0x52, 0x4C, 0x1C, 0x13, 
-    0x52, 0x4B, 0x58, 0x4F, 0x70, 0x00, 0x10, 0x07, 0x72, 0x00, 0x12, 0x06, 0x3A, 0x00, 0x9A, 0x41, 
-    0x70, 0x00, 0x10, 0x05, 0x4A, 0x80, 0x66, 0x08, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x66, 0xD0, 
-    0x70, 0x00, 0x10, 0x05, 0x4A, 0x80, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x68, 0x63, 0x69, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 
-    0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x2D, 0x4B, 0xFF, 0xFC, 0x60, 0x00, 0x01, 0x0C, 0x28, 0x53, 0x48, 0x6D, 0xDD, 0xDA, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFF, 0x7E, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0x7E, 
-    0x60, 0x00, 0x00, 0xEE, 0x48, 0x6D, 0xDD, 0xDE, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x64, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0x78, 0x60, 0x00, 0x00, 0xD4, 0x48, 0x6D, 
-    0xDD, 0xE2, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x4A, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 
-    0x00, 0x01, 0xED, 0x7C, 0x60, 0x00, 0x00, 0xBA, 0x48, 0x6D, 0xDD, 0xE6, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFF, 0x30, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0x7A, 0x60, 0x00, 
-    0x00, 0xA0, 0x48, 0x6D, 0xDD, 0xEA, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x16, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x44, 0x1B, 0x7C, 0x00, 0x01, 0xED, 0x76, 0x48, 0x6D, 0xDD, 0xF2, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0xB2, 0x58, 0x4B, 0x30, 0x2D, 0xED, 0x5E, 0xE5, 0x40, 0x41, 0xED, 
-    0xED, 0x60, 0x21, 0x93, 0x00, 0x00, 0x52, 0xAD, 0xED, 0x5C, 0x70, 0x05, 0xB0, 0xAD, 0xED, 0x5C, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x5A, 0x70, 0x05, 0x2F, 0x00, 0x48, 0x6D, 0xDE, 0x06, 0x4E, 0xBA, 
-    0xFD, 0x74, 0x50, 0x4F, 0x60, 0x4A, 0x48, 0x6D, 0xDE, 0x3C, 0x2F, 0x0C, 0x4E, 0xBA, 0xFE, 0xC2, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x1A, 0x48, 0x6D, 0xDE, 0x40, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xBA, 0xFE, 0x64, 0x58, 0x4B, 0x2B, 0x53, 0xED, 0x58, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x20, 
-    0x70, 0x2D, 0xB0, 0x14, 0x67, 0x0E, 0x20, 0x2E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x40, 
-    0x20, 0x93, 0x60, 0x0C, 0x2F, 0x0C, 0x48, 0x6D, 0xDE, 0x50, 0x4E, 0xBA, 0xFC, 0x70, 0x50, 0x4F, 
-    0x58, 0x4B, 0xB7, 0xEE, 0x00, 0x0C, 0x65, 0x00, 0xFE, 0xF0, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x50, 0x43, 0x63, 0x50, 0x50, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 0x4A, 0xAD, 0xED, 0x54, 0x67, 0x26, 0x2F, 0x2D, 0xED, 0x54, 
-    0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x48, 0x6D, 0xDE, 0x66, 0x30, 0x2E, 
-    0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFD, 0x38, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x54, 
-    0x50, 0x4F, 0x4A, 0xAD, 0xED, 0x50, 0x67, 0x26, 0x2F, 0x2D, 0xED, 0x50, 0x48, 0x6E, 0xFF, 0xFE, 
-    0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x48, 0x6D, 0xDE, 0x82, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFD, 0x0C, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x50, 0x50, 0x4F, 0x4A, 0xAD, 
-    0xED, 0x4C, 0x67, 0x26, 0x2F, 0x2D, 0xED, 0x4C, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x20, 
-    0xA8, 0x8F, 0x48, 0x6D, 0xDE, 0x9E, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xFC, 0xE0, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x4C, 0x50, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x6D, 
-    0x79, 0x65, 0x78, 0x69, 0x74, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x2D, 0xED, 0x84, 0x48, 0x6D, 0xDE, 0xB8, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 
-    0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x20, 0x50, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x6D, 0x79, 0x73, 
-    0x69, 0x67, 0x6E, 0x61, 0x6C, 0x5F, 0x5F, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF2, 
-    0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x10, 0x2B, 0x00, 0x05, 0x4A, 0x80, 
-    0x66, 0x06, 0x4A, 0xAB, 0x00, 0x18, 0x67, 0x18, 0x2F, 0x2B, 0x00, 0x18, 0x70, 0x00, 0x10, 0x2B, 
-    0x00, 0x05, 0x2F, 0x00, 0x48, 0x6D, 0xDE, 0xC8, 0x4E, 0xBA, 0xFB, 0xFA, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x20, 0x2B, 0x00, 0x1C, 0x72, 0x24, 0x90, 0x81, 0x20, 0x6E, 0x00, 0x14, 0xB0, 0x90, 0x67, 0x12, 
-    0x2F, 0x10, 0x2F, 0x2B, 0x00, 0x1C, 0x48, 0x6D, 0xDF, 0x04, 0x4E, 0xBA, 0xFB, 0xD8, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x14, 0x2F, 0x2B, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x10, 0x2F, 0x2B, 
-    0x00, 0x08, 0x48, 0x6D, 0xDF, 0x42, 0x4E, 0xAD, 0x03, 0x42, 0x2E, 0x2B, 0x00, 0x20, 0xE7, 0x87, 
-    0x20, 0x6E, 0x00, 0x14, 0xBE, 0x90, 0x4F, 0xEF, 0x00, 0x14, 0x63, 0x14, 0x2F, 0x2E, 0x00, 0x08, 
-    0x2F, 0x10, 0x2F, 0x07, 0x48, 0x6D, 0xDF, 0xC6, 0x4E, 0xBA, 0xFB, 0x9A, 0x4F, 0xEF, 0x00, 0x10, 
-    0x4A, 0x2D, 0xED, 0x78, 0x67, 0x00, 0x02, 0x6E, 0x59, 0x8F, 0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xFE, 
-    0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x2B, 0x5F, 0xED, 0x54, 0x2F, 0x07, 0x48, 0x6D, 0xE0, 0x08, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0x2A, 0x2F, 0x2D, 0xED, 0x54, 
-    0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x6D, 0xE0, 0x36, 0x30, 0x2E, 
-    0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0x0C, 0x20, 0x6D, 0xED, 0x54, 0x28, 0x50, 
-    0x20, 0x2B, 0x00, 0x20, 0xE7, 0x80, 0xD0, 0x8C, 0x2D, 0x40, 0xFF, 0xF2, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2B, 0x00, 0x20, 0x70, 0x08, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0x2A, 0xB0, 0xAB, 
-    0x00, 0x20, 0x4F, 0xEF, 0x00, 0x24, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x07, 0x48, 0x6D, 
-    0xE0, 0x52, 0x4E, 0xBA, 0xFB, 0x10, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x14, 0x9F, 0x90, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x48, 0x6E, 0xFF, 0xF6, 
-    0x4E, 0xAD, 0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x14, 0x2F, 0x2E, 
-    0x00, 0x08, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x6D, 0xE0, 0x88, 0x4E, 0xBA, 0xFA, 0xD8, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x14, 0x20, 0x10, 0xB0, 0xAE, 0xFF, 0xF6, 0x67, 0x14, 0x2F, 0x2E, 
-    0x00, 0x08, 0x2F, 0x2E, 0xFF, 0xF6, 0x48, 0x6D, 0xE0, 0xC4, 0x4E, 0xBA, 0xFA, 0xB8, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x59, 0x8F, 0x2F, 0x2E, 0xFF, 0xF6, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1D, 
-    0xA8, 0x8F, 0x2B, 0x5F, 0xED, 0x50, 0x2F, 0x2E, 0xFF, 0xF6, 0x48, 0x6D, 0xE0, 0xF6, 0x30, 0x2E, 
-    0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFB, 0x4C, 0x2F, 0x2D, 0xED, 0x50, 0x48, 0x6E, 
-    0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x6D, 0xE1, 0x24, 0x30, 0x2E, 0xFF, 0xFE, 
-    0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFB, 0x2E, 0x20, 0x6D, 0xED, 0x50, 0x2D, 0x50, 0xFF, 0xFA, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x22, 0x2E, 0xFF, 0xF6, 0x59, 0x81, 0x2F, 0x01, 
-    0x22, 0x2E, 0xFF, 0xFA, 0x58, 0x81, 0x2F, 0x01, 0x4E, 0xAD, 0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 
-    0x4F, 0xEF, 0x00, 0x24, 0x67, 0x14, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0xFF, 0xF6, 0x48, 0x6D, 
-    0xE1, 0x40, 0x4E, 0xBA, 0xFA, 0x30, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x2E, 0xFF, 0xF6, 0x70, 0x01, 
-    0xB0, 0xAB, 0x00, 0x20, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x41, 0xED, 0xE1, 0x76, 0x20, 0x08, 
-    0x60, 0x06, 0x41, 0xED, 0xE1, 0x78, 0x20, 0x08, 0x2F, 0x00, 0x2F, 0x2B, 0x00, 0x20, 0x48, 0x6D, 
-    0xE1, 0x7A, 0x4E, 0xAD, 0x03, 0x42, 0x20, 0x6E, 0x00, 0x14, 0x20, 0x2E, 0xFF, 0xF6, 0x91, 0x90, 
-    0x4F, 0xEF, 0x00, 0x10, 0x60, 0x60, 0x70, 0x01, 0x3F, 0x00, 0x4E, 0xBA, 0x2B, 0x42, 0x2E, 0x14, 
-    0x20, 0x3C, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x87, 0x72, 0x09, 0x42, 0x40, 0x48, 0x40, 0xE2, 0x68, 
-    0xE5, 0x40, 0x41, 0xED, 0xED, 0x3C, 0x2F, 0x30, 0x00, 0x00, 0x20, 0x3C, 0x01, 0x00, 0x00, 0x00, 
-    0xC0, 0x87, 0x67, 0x08, 0x41, 0xED, 0xE1, 0xA8, 0x20, 0x08, 0x60, 0x06, 0x41, 0xED, 0xE1, 0xB0, 
-    0x20, 0x08, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x87, 
-    0x20, 0x6E, 0xFF, 0xFA, 0x48, 0x70, 0x08, 0x00, 0x48, 0x6D, 0xE1, 0xB6, 0x4E, 0xAD, 0x03, 0x42, 
-    0x4F, 0xEF, 0x00, 0x14, 0x50, 0x4C, 0xB9, 0xEE, 0xFF, 0xF2, 0x65, 0x9A, 0x2F, 0x2D, 0xED, 0x50, 
-    0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x50, 
-    0x48, 0x6D, 0xE1, 0xCC, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0xD2, 
-    0x2F, 0x2D, 0xED, 0x54, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 
-    0x2B, 0x40, 0xED, 0x54, 0x48, 0x6D, 0xE1, 0xEC, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF9, 0xAE, 0x20, 0x6E, 0x00, 0x14, 0x4A, 0x90, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x60, 
-    0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x10, 0x48, 0x6D, 0xE2, 0x0C, 0x4E, 0xBA, 0xF9, 0x28, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x4C, 0x2F, 0x2B, 0x00, 0x20, 0x48, 0x6D, 0xE2, 0x50, 0x4E, 0xAD, 0x03, 0x42, 
-    0x70, 0x01, 0x2F, 0x00, 0x22, 0x2B, 0x00, 0x1C, 0x74, 0x24, 0x92, 0x82, 0x2F, 0x01, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xAD, 0x03, 0x32, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x14, 0x20, 0x2B, 
-    0x00, 0x1C, 0x72, 0x24, 0x90, 0x81, 0x2F, 0x00, 0x48, 0x6D, 0xE2, 0x68, 0x4E, 0xBA, 0xF8, 0xE6, 
-    0x50, 0x4F, 0x20, 0x6E, 0x00, 0x14, 0x20, 0x2B, 0x00, 0x1C, 0x72, 0x24, 0x90, 0x81, 0x91, 0x90, 
-    0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xE2, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x37, 0x64, 0x75, 0x6D, 0x70, 
-    0x5F, 0x6C, 0x6F, 0x77, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x52, 0x43, 0x31, 0x31, 0x49, 0x74, 0x65, 0x6D, 0x53, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x50, 0x55, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFE, 0xDC, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0B, 
-    0x4E, 0xAD, 0x03, 0x32, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0A, 0x48, 0x6D, 0xE2, 0x9A, 
-    0x4E, 0xBA, 0xF8, 0x62, 0x58, 0x4F, 0x78, 0x00, 0x7A, 0x00, 0x60, 0x00, 0x01, 0xE2, 0x2F, 0x0B, 
-    0x70, 0x01, 0x2F, 0x00, 0x72, 0x24, 0x2F, 0x01, 0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xAD, 0x03, 0x2A, 
-    0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x12, 0x2F, 0x0C, 0x70, 0x24, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE2, 0xB4, 0x4E, 0xBA, 0xF8, 0x2E, 0x4F, 0xEF, 0x00, 0x0C, 0x04, 0xAE, 0x00, 0x00, 
-    0x00, 0x24, 0x00, 0x14, 0x2E, 0x2E, 0xFF, 0xDC, 0x42, 0x47, 0x48, 0x47, 0xBE, 0xAE, 0x00, 0x14, 
-    0x63, 0x12, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x07, 0x48, 0x6D, 0xE2, 0xF0, 0x4E, 0xBA, 0xF8, 0x06, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xAE, 0xFF, 0xDC, 0x53, 0x80, 
-    0x66, 0x00, 0x01, 0x2A, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xE0, 0x4A, 0x80, 0x66, 0x2C, 0x70, 0x01, 
-    0xB0, 0x84, 0x66, 0x0C, 0x2F, 0x0C, 0x48, 0x6D, 0xE3, 0x20, 0x4E, 0xBA, 0xF6, 0xE0, 0x50, 0x4F, 
-    0x48, 0x6E, 0x00, 0x14, 0x48, 0x6E, 0xFF, 0xDC, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xFB, 0x9E, 
-    0x52, 0x84, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x01, 0x46, 0x4A, 0x2D, 0xED, 0x7A, 0x67, 0x00, 
-    0x00, 0xA8, 0x20, 0x2E, 0xFF, 0xFC, 0xE1, 0x88, 0x2D, 0x40, 0xFE, 0xDC, 0x2C, 0x07, 0x70, 0x24, 
-    0x9C, 0x80, 0x2F, 0x0B, 0x2F, 0x06, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFE, 0xDF, 0x4E, 0xAD, 
-    0x03, 0x2A, 0xBC, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x10, 0x2F, 0x0C, 0x2F, 0x06, 0x48, 0x6D, 
-    0xE3, 0x4E, 0x4E, 0xBA, 0xF7, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x9D, 0xAE, 0x00, 0x14, 0x48, 0x6E, 
-    0xFE, 0xDC, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF4, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xE1, 
-    0x2F, 0x00, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xE0, 0x2F, 0x00, 0x48, 0x6D, 0xE3, 0x82, 0x4E, 0xAD, 
-    0x03, 0x42, 0x4A, 0x2D, 0xED, 0x74, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x7C, 0x70, 0x01, 0x2F, 0x00, 
-    0x22, 0x2E, 0xFF, 0xF8, 0x92, 0x87, 0x2F, 0x01, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x32, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x16, 0x2F, 0x0C, 0x20, 0x2E, 0xFF, 0xF8, 0x90, 0x87, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE3, 0xE6, 0x4E, 0xBA, 0xF7, 0x1E, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x90, 0x87, 0x91, 0xAE, 0x00, 0x14, 0x60, 0x40, 0x70, 0x01, 0x2F, 0x00, 0x22, 0x2E, 0xFF, 0xF8, 
-    0x74, 0x24, 0x92, 0x82, 0x2F, 0x01, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x32, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x18, 0x2F, 0x0C, 0x20, 0x2E, 0xFF, 0xF8, 0x72, 0x24, 0x90, 0x81, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE4, 0x1C, 0x4E, 0xBA, 0xF6, 0xDE, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xF8, 
-    0x72, 0x24, 0x90, 0x81, 0x91, 0xAE, 0x00, 0x14, 0x52, 0x85, 0x60, 0x52, 0x2F, 0x07, 0x20, 0x3C, 
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xAE, 0xFF, 0xDC, 0x2F, 0x00, 0x48, 0x6D, 0xE4, 0x52, 0x4E, 0xBA, 
-    0xF5, 0xBC, 0x70, 0x01, 0x2F, 0x00, 0x22, 0x07, 0x74, 0x24, 0x92, 0x82, 0x2F, 0x01, 0x2F, 0x0B, 
-    0x4E, 0xAD, 0x03, 0x32, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x16, 0x2F, 0x0C, 0x20, 0x07, 
-    0x72, 0x24, 0x90, 0x81, 0x2F, 0x00, 0x48, 0x6D, 0xE4, 0x8E, 0x4E, 0xBA, 0xF6, 0x88, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x07, 0x72, 0x24, 0x90, 0x81, 0x91, 0xAE, 0x00, 0x14, 0x52, 0x85, 0x4A, 0xAE, 
-    0x00, 0x14, 0x62, 0x00, 0xFE, 0x1A, 0x70, 0x01, 0xB0, 0x85, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 
-    0x41, 0xED, 0xE4, 0xBA, 0x20, 0x08, 0x60, 0x06, 0x41, 0xED, 0xE4, 0xBC, 0x20, 0x08, 0x2F, 0x00, 
-    0x2F, 0x05, 0x70, 0x01, 0xB0, 0x84, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x41, 0xED, 0xE4, 0xBE, 
-    0x20, 0x08, 0x60, 0x06, 0x41, 0xED, 0xE4, 0xC0, 0x20, 0x08, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x6D, 
-    0xE4, 0xC2, 0x4E, 0xAD, 0x03, 0x42, 0x70, 0x00, 0x10, 0x2E, 0x00, 0x1B, 0x72, 0x01, 0xB2, 0x84, 
-    0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0xB6, 0x40, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x48, 0x6D, 0xE5, 0x02, 0x4E, 0xBA, 0xF5, 0x16, 0x50, 0x4F, 0x70, 0x00, 0x10, 0x2E, 0x00, 0x1F, 
-    0x4A, 0x80, 0x4A, 0x85, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 0xB6, 0x40, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x48, 0x6D, 0xE5, 0x3E, 0x4E, 0xBA, 0xF4, 0xF6, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0xF8, 0xFE, 0xC0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x64, 0x75, 0x6D, 0x70, 0x5F, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x6C, 0x55, 0x6C, 0x55, 0x63, 0x54, 0x35, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 
-    0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0x12, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 
-    0x70, 0x0D, 0xB0, 0x87, 0x67, 0x24, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0xCE, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x67, 0x0C, 0x2F, 0x0B, 
-    0x48, 0x6D, 0xE5, 0x7C, 0x4E, 0xBA, 0xF5, 0x5E, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x73, 0x6B, 0x69, 0x70, 0x74, 0x6F, 0x65, 0x6F, 0x6C, 0x5F, 0x5F, 
-    0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFE, 0xC2, 
-    0x48, 0xE7, 0x07, 0x18, 0x2A, 0x2E, 0x00, 0x14, 0x4A, 0xAD, 0xED, 0x58, 0x66, 0x0A, 0x48, 0x6D, 
-    0xE5, 0x94, 0x4E, 0xBA, 0xF4, 0x68, 0x58, 0x4F, 0x48, 0x78, 0x10, 0x00, 0x70, 0x00, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x10, 0x64, 0x26, 0x40, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xD6, 0x7C, 0x00, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xD6, 0x48, 0x6D, 0xE5, 0xAE, 0x20, 0x06, 0xE5, 0x40, 0x41, 0xED, 0xED, 0x60, 
-    0x2F, 0x30, 0x00, 0x00, 0x4E, 0xAD, 0x03, 0x22, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x66, 0x1A, 
-    0x20, 0x06, 0xE5, 0x40, 0x41, 0xED, 0xED, 0x60, 0x2F, 0x30, 0x00, 0x00, 0x48, 0x6D, 0xE5, 0xB0, 
-    0x4E, 0xBA, 0xF4, 0xD2, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x48, 0x6E, 0xFE, 0xCA, 0x48, 0x6D, 
-    0xE5, 0xC6, 0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0x3A, 0x2E, 0x00, 0x70, 0x01, 0xB0, 0x87, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x66, 0x4C, 0x70, 0x3B, 0xB0, 0x2E, 0xFE, 0xCA, 0x67, 0x2E, 0x2F, 0x2E, 0xFF, 0xD6, 
-    0x48, 0x6E, 0xFE, 0xCA, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x0D, 0xEA, 0x2D, 0x40, 0xFE, 0xC2, 
-    0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x20, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x24, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x14, 0x2F, 0x0C, 0x20, 0x06, 0xE5, 0x40, 
-    0x41, 0xED, 0xED, 0x60, 0x2F, 0x30, 0x00, 0x00, 0x4E, 0xBA, 0xFE, 0xB0, 0x50, 0x4F, 0x60, 0x9A, 
-    0x70, 0xFF, 0xB0, 0x87, 0x66, 0x94, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 
-    0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x67, 0x16, 0x20, 0x06, 0xE5, 0x40, 0x41, 0xED, 0xED, 0x60, 
-    0x2F, 0x30, 0x00, 0x00, 0x48, 0x6D, 0xE5, 0xCA, 0x4E, 0xBA, 0xF4, 0x3A, 0x50, 0x4F, 0x2F, 0x0C, 
-    0x4E, 0xAD, 0x03, 0x02, 0x58, 0x4F, 0x52, 0x86, 0xBC, 0xAD, 0xED, 0x5C, 0x6D, 0x00, 0xFF, 0x26, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xAD, 0x03, 0x32, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0A, 0x48, 0x6D, 0xE5, 0xE2, 0x4E, 0xBA, 0xF4, 0x06, 
-    0x58, 0x4F, 0x2F, 0x2E, 0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x24, 0x2F, 0x01, 0x48, 0x6E, 
-    0xFF, 0xDA, 0x4E, 0xAD, 0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x14, 
-    0x2F, 0x2E, 0x00, 0x08, 0x70, 0x24, 0x2F, 0x00, 0x48, 0x6D, 0xE5, 0xFC, 0x4E, 0xBA, 0xF3, 0xD6, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xAE, 0xFF, 0xDA, 0x72, 0x01, 
-    0xB2, 0x80, 0x67, 0x16, 0x20, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xAE, 0xFF, 0xDA, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE6, 0x38, 0x4E, 0xBA, 0xF3, 0xAE, 0x50, 0x4F, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xDE, 
-    0x4A, 0x80, 0x66, 0x10, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xDF, 0x4A, 0x80, 0x66, 0x06, 0x4A, 0xAE, 
-    0xFF, 0xF2, 0x67, 0x20, 0x2F, 0x2E, 0xFF, 0xF2, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xDF, 0x2F, 0x00, 
-    0x70, 0x00, 0x10, 0x2E, 0xFF, 0xDE, 0x2F, 0x00, 0x48, 0x6D, 0xE6, 0x56, 0x4E, 0xBA, 0xF3, 0x76, 
-    0x4F, 0xEF, 0x00, 0x10, 0xBA, 0xAE, 0xFF, 0xF6, 0x67, 0x0E, 0x2F, 0x2E, 0xFF, 0xF6, 0x48, 0x6D, 
-    0xE6, 0x96, 0x4E, 0xBA, 0xF3, 0x60, 0x50, 0x4F, 0x04, 0x85, 0x00, 0x00, 0x00, 0x24, 0x2C, 0x2E, 
-    0xFF, 0xFA, 0xE7, 0x86, 0xBC, 0x85, 0x63, 0x12, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x06, 0x48, 0x6D, 
-    0xE6, 0xBE, 0x4E, 0xBA, 0xF3, 0x40, 0x4F, 0xEF, 0x00, 0x0C, 0x59, 0x8F, 0x2F, 0x06, 0x48, 0x6E, 
-    0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x2B, 0x5F, 0xED, 0x54, 0x2F, 0x06, 0x48, 0x6D, 
-    0xE6, 0xF0, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF3, 0xD8, 0x2F, 0x2D, 
-    0xED, 0x54, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x6D, 0xE7, 0x1E, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF3, 0xBA, 0x20, 0x6D, 0xED, 0x54, 
-    0x28, 0x50, 0x20, 0x2E, 0xFF, 0xFA, 0xE7, 0x80, 0xD0, 0x8C, 0x2D, 0x40, 0xFF, 0xCA, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0xFF, 0xFA, 0x70, 0x08, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0x2A, 
-    0xB0, 0xAE, 0xFF, 0xFA, 0x4F, 0xEF, 0x00, 0x24, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x06, 
-    0x48, 0x6D, 0xE7, 0x3A, 0x4E, 0xBA, 0xF2, 0xBE, 0x4F, 0xEF, 0x00, 0x0C, 0x9A, 0x86, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x48, 0x6E, 0xFF, 0xCE, 0x4E, 0xAD, 
-    0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x14, 0x2F, 0x2E, 0x00, 0x08, 
-    0x70, 0x04, 0x2F, 0x00, 0x48, 0x6D, 0xE7, 0x70, 0x4E, 0xBA, 0xF2, 0x8A, 0x4F, 0xEF, 0x00, 0x0C, 
-    0xBA, 0xAE, 0xFF, 0xCE, 0x67, 0x14, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x2E, 0xFF, 0xCE, 0x48, 0x6D, 
-    0xE7, 0xAC, 0x4E, 0xBA, 0xF2, 0x70, 0x4F, 0xEF, 0x00, 0x0C, 0x59, 0x8F, 0x2F, 0x2E, 0xFF, 0xCE, 
-    0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1D, 0xA8, 0x8F, 0x2B, 0x5F, 0xED, 0x50, 0x2F, 0x2E, 
-    0xFF, 0xCE, 0x48, 0x6D, 0xE7, 0xDE, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xF3, 0x04, 0x2F, 0x2D, 0xED, 0x50, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 
-    0x48, 0x6D, 0xE8, 0x0C, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF2, 0xE6, 
-    0x20, 0x6D, 0xED, 0x50, 0x2D, 0x50, 0xFF, 0xD2, 0x2F, 0x2E, 0x00, 0x0C, 0x70, 0x01, 0x2F, 0x00, 
-    0x22, 0x2E, 0xFF, 0xCE, 0x59, 0x81, 0x2F, 0x01, 0x22, 0x2E, 0xFF, 0xD2, 0x58, 0x81, 0x2F, 0x01, 
-    0x4E, 0xAD, 0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x24, 0x67, 0x14, 0x2F, 0x2E, 
-    0x00, 0x08, 0x2F, 0x2E, 0xFF, 0xCE, 0x48, 0x6D, 0xE8, 0x28, 0x4E, 0xBA, 0xF1, 0xE8, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x9A, 0xAE, 0xFF, 0xCE, 0x48, 0x6E, 0xFF, 0x28, 0x4E, 0xBA, 0x0D, 0x86, 0x48, 0x6E, 
-    0xFF, 0x34, 0x4E, 0xBA, 0x0D, 0x7E, 0x7A, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x84, 0x70, 0x01, 
-    0x3F, 0x00, 0x4E, 0xBA, 0x23, 0x1A, 0x2C, 0x14, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x86, 
-    0x52, 0x80, 0x20, 0x6E, 0xFF, 0xD2, 0x48, 0x70, 0x08, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0x0B, 0x90, 
-    0x4A, 0x80, 0x50, 0x4F, 0x67, 0x58, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x86, 0x20, 0x6E, 
-    0xFF, 0xD2, 0x48, 0x70, 0x08, 0x00, 0x4E, 0xAD, 0x02, 0xF2, 0x54, 0x80, 0x58, 0x8F, 0x2F, 0x00, 
-    0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x86, 0x20, 0x6E, 0xFF, 0xD2, 0x48, 0x70, 0x08, 0x00, 
-    0x48, 0x6E, 0xFF, 0x34, 0x4E, 0xBA, 0x0E, 0x88, 0x2E, 0x00, 0x20, 0x3C, 0xFF, 0x00, 0x00, 0x00, 
-    0xC0, 0x94, 0x22, 0x07, 0x58, 0x81, 0x82, 0x80, 0x28, 0x81, 0x70, 0x08, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x48, 0x6E, 0xFF, 0x28, 0x4E, 0xBA, 0x0E, 0x68, 0x52, 0x85, 0x4F, 0xEF, 0x00, 0x18, 0x50, 0x4C, 
-    0xB9, 0xEE, 0xFF, 0xCA, 0x65, 0x00, 0xFF, 0x78, 0x7E, 0x03, 0xCE, 0xAE, 0xFF, 0x34, 0x4A, 0x87, 
-    0x67, 0x1C, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0xC6, 0x70, 0x04, 0x90, 0x87, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFE, 0xC6, 0x48, 0x6E, 0xFF, 0x34, 0x4E, 0xBA, 0x0E, 0x36, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 
-    0xFF, 0x34, 0x58, 0x80, 0x2D, 0x40, 0xFF, 0x40, 0x20, 0x2E, 0xFF, 0x28, 0xD0, 0xAE, 0xFF, 0x40, 
-    0x2C, 0x00, 0x70, 0x24, 0xDC, 0x80, 0x2F, 0x2D, 0xED, 0x50, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 
-    0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x50, 0x48, 0x6D, 0xE8, 0x5E, 0x30, 0x2E, 
-    0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF1, 0x48, 0x2F, 0x2D, 0xED, 0x54, 0x48, 0x6E, 
-    0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x54, 0x48, 0x6D, 
-    0xE8, 0x7E, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF1, 0x24, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0x20, 0x0A, 0x2F, 0x2D, 0xED, 0x58, 0x4E, 0xBA, 0x20, 0x02, 0x55, 0x8F, 
-    0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x3F, 0x00, 0x48, 0x6E, 0xFF, 0xC4, 0x4E, 0xBA, 0x18, 0x72, 
-    0x70, 0xD5, 0xB0, 0x5F, 0x4F, 0xEF, 0x00, 0x18, 0x66, 0x0E, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 
-    0xE8, 0x9E, 0x4E, 0xBA, 0xF0, 0x80, 0x50, 0x4F, 0x2D, 0x7C, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xC6, 
-    0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 0x48, 0x6E, 0xFF, 0xC6, 0x48, 0x6E, 0xFF, 0x44, 0x4E, 0xBA, 
-    0x18, 0x9A, 0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xE8, 0xB4, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xF1, 0x10, 0x0C, 0xAE, 0xEF, 0x00, 0x00, 0x11, 0xFF, 0x54, 0x50, 0x4F, 
-    0x67, 0x0E, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6D, 0xE8, 0xDA, 0x4E, 0xBA, 0xF0, 0x38, 0x50, 0x4F, 
-    0x02, 0xAE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x68, 0x2D, 0x46, 0xFF, 0x60, 0x59, 0x8F, 0x20, 0x2E, 
-    0xFF, 0x5C, 0xD0, 0xAE, 0xFF, 0x58, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1D, 
-    0xA8, 0x8F, 0x2B, 0x5F, 0xED, 0x4C, 0x20, 0x2E, 0xFF, 0x5C, 0xD0, 0xAE, 0xFF, 0x58, 0x2F, 0x00, 
-    0x48, 0x6D, 0xE9, 0x06, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF0, 0xB6, 
-    0x2F, 0x2D, 0xED, 0x4C, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 0x00, 0x1E, 0xA8, 0x8F, 0x48, 0x6D, 
-    0xE9, 0x46, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF0, 0x98, 0x20, 0x6D, 
-    0xED, 0x4C, 0x26, 0x50, 0x20, 0x2E, 0xFF, 0x5C, 0xD0, 0xAE, 0xFF, 0x58, 0x2D, 0x40, 0xFF, 0xC6, 
-    0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 0x48, 0x6E, 0xFF, 0xC6, 0x2F, 0x0B, 0x4E, 0xBA, 0x17, 0xEC, 
-    0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xE9, 0x62, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF0, 0x62, 0x55, 0x8F, 0x2F, 0x2D, 0xED, 0x58, 0x70, 0x00, 0x3F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xC4, 0x4E, 0xBA, 0x17, 0x6C, 0x3D, 0x5F, 0xFF, 0xFE, 0x70, 0xD5, 0xB0, 0x6E, 0xFF, 0xFE, 
-    0x4F, 0xEF, 0x00, 0x1C, 0x66, 0x48, 0x55, 0x8F, 0x2F, 0x2D, 0xED, 0x58, 0x70, 0x00, 0x3F, 0x00, 
-    0x2F, 0x3C, 0x48, 0x4D, 0x52, 0x36, 0x2F, 0x3C, 0x61, 0x69, 0x66, 0x20, 0x4E, 0xBA, 0x17, 0xE4, 
-    0x3D, 0x5F, 0xFF, 0xFE, 0x66, 0x28, 0x55, 0x8F, 0x2F, 0x2D, 0xED, 0x58, 0x70, 0x00, 0x3F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xC4, 0x4E, 0xBA, 0x17, 0x2A, 0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xE9, 0x90, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEF, 0xFA, 0x50, 0x4F, 0x2D, 0x7C, 
-    0x00, 0x00, 0x00, 0x80, 0xFF, 0xC6, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 0x48, 0x6E, 0xFF, 0xC6, 
-    0x48, 0x6E, 0xFF, 0x44, 0x4E, 0xBA, 0x17, 0x58, 0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xE9, 0xB8, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEF, 0xCA, 0x20, 0x2E, 0xFF, 0x5C, 
-    0xD0, 0xAE, 0xFF, 0x58, 0x2D, 0x40, 0xFF, 0xC6, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 0x48, 0x6E, 
-    0xFF, 0xC6, 0x2F, 0x0B, 0x4E, 0xBA, 0x17, 0x28, 0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xE9, 0xE4, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEF, 0x9A, 0x2D, 0x46, 0xFF, 0xF6, 
-    0x2D, 0x45, 0xFF, 0xFA, 0x70, 0x24, 0x2D, 0x40, 0xFF, 0xC6, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 
-    0x48, 0x6E, 0xFF, 0xC6, 0x48, 0x6E, 0xFF, 0xDA, 0x4E, 0xBA, 0x16, 0xF4, 0x3D, 0x5F, 0xFF, 0xFE, 
-    0x48, 0x6D, 0xEA, 0x22, 0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEF, 0x66, 
-    0x30, 0x2E, 0xFF, 0xC4, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x28, 0x4E, 0xBA, 0x0C, 0x12, 
-    0x70, 0x04, 0x2D, 0x40, 0xFF, 0xC6, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0xC4, 0x48, 0x6E, 0xFF, 0xC6, 
-    0x48, 0x6E, 0xFF, 0x40, 0x4E, 0xBA, 0x16, 0xB8, 0x3D, 0x5F, 0xFF, 0xFE, 0x48, 0x6D, 0xEA, 0x40, 
-    0x30, 0x2E, 0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEF, 0x2A, 0x30, 0x2E, 0xFF, 0xC4, 
-    0x48, 0xC0, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x34, 0x4E, 0xBA, 0x0B, 0xD6, 0x55, 0x8F, 0x3F, 0x2E, 
-    0xFF, 0xC4, 0x4E, 0xBA, 0x16, 0x6C, 0x2F, 0x2D, 0xED, 0x4C, 0x48, 0x6E, 0xFF, 0xFE, 0x3F, 0x3C, 
-    0x00, 0x20, 0xA8, 0x8F, 0x70, 0x00, 0x2B, 0x40, 0xED, 0x4C, 0x48, 0x6D, 0xEA, 0x72, 0x30, 0x2E, 
-    0xFF, 0xFE, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xEE, 0x98, 0x2F, 0x2E, 0xFF, 0x40, 0x2F, 0x05, 
-    0x2F, 0x06, 0x48, 0x6D, 0xEA, 0x90, 0x4E, 0xAD, 0x03, 0x42, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x34, 0x4E, 0xBA, 0x0A, 0x56, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x28, 0x4E, 0xBA, 
-    0x0A, 0x4A, 0x4F, 0xEF, 0x00, 0x5A, 0x4C, 0xEE, 0x18, 0xE0, 0xFE, 0xAE, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9D, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x5F, 
-    0x5F, 0x46, 0x50, 0x43, 0x63, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x6C, 0x55, 0x6C, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0x70, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x48, 0x6D, 0x00, 0x2A, 
-    0x4E, 0xBA, 0x11, 0x82, 0x48, 0x6D, 0x00, 0x32, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x0A, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x1D, 0xEC, 0x2B, 0x53, 0xED, 0x84, 0x20, 0x4B, 0x58, 0x88, 
-    0x2D, 0x48, 0xFF, 0xF8, 0x20, 0x2E, 0x00, 0x08, 0xE5, 0x80, 0x48, 0x73, 0x08, 0x00, 0x2F, 0x08, 
-    0x4E, 0xBA, 0xEF, 0x52, 0x2D, 0x40, 0xFF, 0xFC, 0x4A, 0xAD, 0xED, 0x58, 0x4F, 0xEF, 0x00, 0x14, 
-    0x67, 0x10, 0x4A, 0x2D, 0xED, 0x76, 0x66, 0x0A, 0x48, 0x6D, 0xEA, 0xD8, 0x4E, 0xBA, 0xEC, 0xBE, 
-    0x58, 0x4F, 0x4A, 0x2D, 0xED, 0x76, 0x67, 0x00, 0x02, 0xA8, 0x20, 0x2E, 0xFF, 0xF8, 0x58, 0x80, 
-    0xB0, 0xAE, 0xFF, 0xFC, 0x67, 0x00, 0x02, 0x9A, 0x48, 0x6D, 0xEA, 0xF4, 0x4E, 0xBA, 0xEC, 0x9E, 
-    0x58, 0x4F, 0x60, 0x00, 0x02, 0x8C, 0x20, 0x6E, 0xFF, 0xF8, 0x28, 0x50, 0x48, 0x6D, 0xEB, 0x1A, 
-    0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0x22, 0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 0x66, 0x0C, 0x2F, 0x0C, 
-    0x48, 0x6D, 0xEB, 0x1C, 0x4E, 0xBA, 0xED, 0x2E, 0x50, 0x4F, 0x2F, 0x0B, 0x70, 0x01, 0x2F, 0x00, 
-    0x48, 0x78, 0x00, 0x80, 0x48, 0x6E, 0xFF, 0x74, 0x4E, 0xAD, 0x03, 0x2A, 0x72, 0x01, 0xB2, 0x80, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x12, 0x2F, 0x0C, 0x48, 0x78, 0x00, 0x80, 0x48, 0x6D, 0xEB, 0x32, 
-    0x4E, 0xBA, 0xED, 0x02, 0x4F, 0xEF, 0x00, 0x0C, 0x0C, 0xAE, 0xEF, 0x00, 0x00, 0x11, 0xFF, 0x84, 
-    0x67, 0x0C, 0x2F, 0x0C, 0x48, 0x6D, 0xEB, 0x62, 0x4E, 0xBA, 0xEC, 0xEA, 0x50, 0x4F, 0x70, 0x00, 
-    0x10, 0x2E, 0xFF, 0x80, 0x0C, 0x40, 0x00, 0xEB, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 
-    0x2E, 0x03, 0x7C, 0x00, 0x1C, 0x2E, 0xFF, 0xA7, 0x4A, 0x86, 0x66, 0x02, 0x7C, 0x1A, 0x2F, 0x06, 
-    0x4A, 0x87, 0x67, 0x08, 0x41, 0xED, 0xEB, 0x8E, 0x20, 0x08, 0x60, 0x06, 0x41, 0xED, 0xEB, 0x9C, 
-    0x20, 0x08, 0x2F, 0x00, 0x2F, 0x0C, 0x48, 0x6D, 0xEB, 0xAE, 0x4E, 0xAD, 0x03, 0x42, 0x2F, 0x2E, 
-    0xFF, 0x94, 0x2F, 0x2E, 0xFF, 0x8C, 0x2F, 0x2E, 0xFF, 0x88, 0x48, 0x6D, 0xEB, 0xD6, 0x4E, 0xAD, 
-    0x03, 0x42, 0x4A, 0x87, 0x4F, 0xEF, 0x00, 0x20, 0x67, 0x34, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 
-    0xC0, 0xAE, 0xFF, 0x80, 0x2D, 0x40, 0xFF, 0x70, 0x20, 0x3C, 0x00, 0x80, 0x00, 0x00, 0xC0, 0xAE, 
-    0xFF, 0x70, 0x67, 0x06, 0x00, 0x2E, 0x00, 0xFF, 0xFF, 0x70, 0x20, 0x2E, 0xFF, 0x70, 0xE5, 0x88, 
-    0xD0, 0xAE, 0xFF, 0x9C, 0x72, 0x18, 0xD0, 0x81, 0x2D, 0x40, 0xFF, 0xF4, 0x60, 0x06, 0x2D, 0x6E, 
-    0xFF, 0x80, 0xFF, 0xF4, 0x2F, 0x2E, 0xFF, 0xF4, 0x2F, 0x2E, 0xFF, 0x9C, 0x48, 0x6D, 0xEC, 0x26, 
-    0x4E, 0xAD, 0x03, 0x42, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 0xC0, 0xAE, 0xFF, 0xA4, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x10, 0x2F, 0x2E, 0xFF, 0xA8, 0x48, 0x6D, 0xEC, 0x56, 0x4E, 0xAD, 0x03, 0x42, 
-    0x50, 0x4F, 0x60, 0x32, 0x53, 0xAD, 0xF6, 0xE0, 0x4A, 0xAD, 0xF6, 0xE0, 0x5C, 0xC3, 0x44, 0x03, 
-    0x67, 0x14, 0x20, 0x2D, 0xF6, 0xE4, 0x52, 0xAD, 0xF6, 0xE4, 0x20, 0x40, 0x10, 0xBC, 0x00, 0x0D, 
-    0x70, 0x0D, 0x4A, 0x80, 0x60, 0x10, 0x48, 0x6D, 0xF6, 0xE0, 0x70, 0x0D, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x03, 0x1A, 0x4A, 0x80, 0x50, 0x4F, 0x4A, 0xAE, 0xFF, 0x98, 0x67, 0x00, 0x00, 0xEC, 0x70, 0x01, 
-    0xC0, 0xAE, 0xFF, 0x98, 0x56, 0xC3, 0x44, 0x03, 0x18, 0x03, 0x70, 0x02, 0xC0, 0xAE, 0xFF, 0x98, 
-    0x56, 0xC3, 0x44, 0x03, 0x1A, 0x03, 0x67, 0x08, 0x41, 0xED, 0xEC, 0x74, 0x20, 0x08, 0x60, 0x06, 
-    0x41, 0xED, 0xEC, 0x82, 0x20, 0x08, 0x2F, 0x00, 0x76, 0x00, 0x4A, 0x04, 0x67, 0x06, 0x4A, 0x05, 
-    0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x08, 0x41, 0xED, 0xEC, 0x84, 0x20, 0x08, 0x60, 0x06, 
-    0x41, 0xED, 0xEC, 0x8A, 0x20, 0x08, 0x2F, 0x00, 0x4A, 0x04, 0x67, 0x08, 0x41, 0xED, 0xEC, 0x8C, 
-    0x20, 0x08, 0x60, 0x06, 0x41, 0xED, 0xEC, 0x96, 0x20, 0x08, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0x90, 
-    0x48, 0x6D, 0xEC, 0x98, 0x4E, 0xAD, 0x03, 0x42, 0x4A, 0x2D, 0xED, 0x7C, 0x4F, 0xEF, 0x00, 0x14, 
-    0x66, 0x06, 0x4A, 0x2D, 0xED, 0x78, 0x67, 0x3A, 0x70, 0x00, 0x10, 0x05, 0x2F, 0x00, 0x70, 0x00, 
-    0x10, 0x04, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0x90, 0x20, 0x2E, 0xFF, 0x8C, 0xD0, 0xAE, 0xFF, 0x88, 
-    0x4A, 0x87, 0x67, 0x04, 0x72, 0x00, 0x60, 0x06, 0x22, 0x3C, 0x00, 0x00, 0x00, 0x80, 0x74, 0x00, 
-    0x14, 0x01, 0xD4, 0x80, 0x2F, 0x02, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xF2, 0xAA, 0x4F, 0xEF, 
-    0x00, 0x18, 0x4A, 0x2D, 0xED, 0x76, 0x67, 0x50, 0x2F, 0x2E, 0xFF, 0x90, 0x20, 0x2E, 0xFF, 0x8C, 
-    0xD0, 0xAE, 0xFF, 0x88, 0x4A, 0x87, 0x67, 0x04, 0x72, 0x00, 0x60, 0x06, 0x22, 0x3C, 0x00, 0x00, 
-    0x00, 0x80, 0x74, 0x00, 0x14, 0x01, 0xD4, 0x80, 0x2F, 0x02, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xF5, 0xCC, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x20, 0x4A, 0xAE, 0xFF, 0x90, 0x66, 0x0C, 0x48, 0x6D, 
-    0xEC, 0xD6, 0x4E, 0xAD, 0x03, 0x42, 0x58, 0x4F, 0x60, 0x0E, 0x2F, 0x2E, 0xFF, 0x90, 0x48, 0x6D, 
-    0xEC, 0xFC, 0x4E, 0xAD, 0x03, 0x42, 0x50, 0x4F, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x02, 0x4A, 0x2D, 
-    0xED, 0x76, 0x58, 0x4F, 0x66, 0x16, 0x4A, 0xAD, 0xED, 0x80, 0x66, 0x10, 0x58, 0xAE, 0xFF, 0xF8, 
-    0x20, 0x2E, 0xFF, 0xF8, 0xB0, 0xAE, 0xFF, 0xFC, 0x65, 0x00, 0xFD, 0x6C, 0x20, 0x2D, 0xED, 0x80, 
-    0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x54, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6D, 0x61, 0x69, 0x6E, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xAD, 0x02, 0xF2, 0x52, 0x80, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xBA, 0x1A, 0x78, 0x28, 0x40, 
-    0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0xEA, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x43, 0x6F, 0x70, 0x79, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x5F, 
-    0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x08, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x2E, 0x00, 0x20, 0x6C, 0x00, 0x04, 
-    0x20, 0x07, 0xE5, 0x80, 0x26, 0x70, 0x08, 0x00, 0x20, 0x0B, 0x50, 0x4F, 0x66, 0x28, 0x70, 0x00, 
-    0x60, 0x2A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x0A, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x06, 0x26, 0x53, 0x20, 0x0B, 0x66, 0xD8, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x80, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x27, 0x4C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x5F, 0x5F, 
-    0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 
-    0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 
-    0x60, 0x3E, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 0x26, 0x70, 0x08, 0x00, 0x60, 0x28, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x18, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x04, 0x20, 0x0B, 0x60, 0x10, 0x26, 0x53, 0x20, 0x0B, 0x66, 0xD4, 0x20, 0x07, 0x52, 0x87, 
-    0xBE, 0x94, 0x6D, 0xBE, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x27, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 
-    0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x0E, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x19, 0x14, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x52, 0x29, 0x6D, 0xEE, 0x38, 0x00, 0x0A, 
-    0x19, 0x6E, 0x00, 0x13, 0x00, 0x08, 0x20, 0x2E, 0x00, 0x0C, 0x28, 0x80, 0xE5, 0x80, 0xA3, 0x1E, 
-    0x29, 0x48, 0x00, 0x04, 0x66, 0x36, 0x20, 0x14, 0xE5, 0x80, 0x2F, 0x00, 0x48, 0x6D, 0xED, 0xE2, 
-    0x4E, 0xBA, 0x08, 0x38, 0x70, 0x44, 0x2F, 0x00, 0x48, 0x6D, 0xEE, 0x1C, 0x4E, 0xBA, 0x08, 0x72, 
-    0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xEE, 0x24, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 
-    0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x0C, 0xE0, 0x4F, 0xEF, 0x00, 0x18, 0x20, 0x0C, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x54, 
-    0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x55, 0x63, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x10, 0x53, 0x80, 0x22, 0x2E, 0x00, 0x0C, 
-    0xE0, 0x81, 0xC2, 0x80, 0x20, 0x01, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x25, 0x48, 0x61, 0x73, 0x68, 
-    0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 
-    0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 
-    0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x01, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2A, 
-    0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 
-    0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x70, 0x01, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x30, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x43, 0x6F, 
-    0x6D, 0x70, 0x61, 0x72, 0x65, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 
-    0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 
-    0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0B, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 
-    0x2E, 0x00, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 0x26, 0xB0, 0x08, 0x00, 0x20, 0x6C, 
-    0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 0x21, 0x8B, 0x08, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x24, 0x41, 0x64, 0x64, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 
-    0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 
-    0x2E, 0x00, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 0x4A, 0xB0, 0x08, 0x00, 0x50, 0x4F, 
-    0x66, 0x02, 0xA9, 0xFF, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 0x20, 0x30, 0x08, 0x00, 
-    0xB0, 0xAE, 0x00, 0x0C, 0x66, 0x12, 0x20, 0x6E, 0x00, 0x0C, 0x22, 0x6C, 0x00, 0x04, 0x20, 0x07, 
-    0xE5, 0x80, 0x23, 0x90, 0x08, 0x00, 0x60, 0x36, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x07, 0xE5, 0x80, 
-    0x2D, 0x70, 0x08, 0x00, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x26, 0x50, 0x60, 0x0C, 0xB7, 0xEE, 
-    0x00, 0x0C, 0x67, 0x0A, 0x2D, 0x4B, 0xFF, 0xFC, 0x26, 0x53, 0x20, 0x0B, 0x66, 0xF0, 0x20, 0x0B, 
-    0x67, 0x02, 0xA9, 0xFF, 0x20, 0x6E, 0x00, 0x0C, 0x22, 0x6E, 0xFF, 0xFC, 0x22, 0x90, 0x4C, 0xEE, 
-    0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x27, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
-    0x5F, 0x5F, 0x31, 0x30, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 
-    0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 
-    0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x10, 0x70, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0x16, 0x8A, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x50, 0x26, 0x4C, 0x76, 0x01, 0x20, 0x0B, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x04, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x16, 0x70, 0x58, 0x8F, 0x26, 0x1F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x06, 0x70, 0x00, 0x26, 0x80, 0x60, 0x02, 0x70, 0x00, 0x28, 0x4B, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x29, 0x6E, 0x00, 0x10, 0x00, 0x08, 0x67, 0x08, 0x20, 0x6E, 
-    0x00, 0x10, 0x21, 0x4C, 0x00, 0x04, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0xFB, 0xA6, 0x29, 0x40, 
-    0x00, 0x0C, 0x58, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9A, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x46, 
-    0x50, 0x63, 0x50, 0x37, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF0, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x47, 0xEE, 0xFF, 0xF0, 0x76, 0x01, 
-    0x20, 0x0B, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x04, 0x2F, 0x00, 0x4E, 0xBA, 0x15, 0xE8, 0x58, 0x8F, 
-    0x26, 0x1F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x06, 0x70, 0x00, 
-    0x26, 0x80, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xF0, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0xF0, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x0A, 0xD0, 0xE9, 0x00, 0x30, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x34, 0x4E, 0x91, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xE4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x46, 0x69, 0x6E, 0x64, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x2F, 0x2C, 
-    0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x0C, 0x4E, 0xAD, 0x02, 0xE2, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2C, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x5F, 0x5F, 0x31, 
-    0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x31, 
-    0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x79, 
-    0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x26, 0x6E, 0x00, 0x0C, 
-    0x7E, 0x00, 0x7C, 0x08, 0x28, 0x6B, 0x00, 0x0C, 0x60, 0x30, 0x22, 0x07, 0x20, 0x01, 0xC2, 0xFC, 
-    0x00, 0x25, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x25, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x2D, 0x41, 
-    0xFF, 0xFC, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0xB2, 0x22, 0x2E, 
-    0xFF, 0xFC, 0xD0, 0x81, 0x2E, 0x00, 0x52, 0x4C, 0x58, 0x4F, 0x4A, 0x14, 0x67, 0x08, 0x20, 0x06, 
-    0x53, 0x86, 0x4A, 0x80, 0x66, 0xC4, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x10, 0x53, 0x80, 0xC0, 0x87, 
-    0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x27, 0x48, 0x61, 0x73, 0x68, 
-    0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x46, 0x50, 0x31, 0x35, 0x54, 0x48, 0x61, 0x73, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x45, 0x6E, 
-    0x74, 0x72, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x10, 0x70, 0x0E, 0x2F, 0x00, 0x4E, 0xBA, 0x14, 0x8A, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x1A, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFB, 0x4C, 0x28, 0x40, 0x29, 0x6D, 0xEE, 0x3C, 0x00, 0x0A, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x0C, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 
-    0x32, 0x54, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x70, 0x0C, 0x2F, 0x00, 0x4E, 0xBA, 0x14, 0x2E, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x56, 
-    0x70, 0x00, 0x28, 0x80, 0x29, 0x7C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 
-    0x04, 0x00, 0xA1, 0x22, 0x29, 0x48, 0x00, 0x08, 0x66, 0x3C, 0x30, 0x38, 0x02, 0x20, 0x48, 0xC0, 
-    0x2F, 0x00, 0x48, 0x78, 0x04, 0x00, 0x48, 0x6D, 0xEE, 0x40, 0x4E, 0xBA, 0x03, 0x4E, 0x70, 0x1F, 
-    0x2F, 0x00, 0x48, 0x6D, 0xEE, 0x64, 0x4E, 0xBA, 0x03, 0x88, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 
-    0xEE, 0x72, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x07, 0xF6, 0x4F, 0xEF, 0x00, 0x1C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x5E, 0x20, 0x6C, 0x00, 0x08, 0xA0, 0x23, 0x4A, 0xAC, 
-    0x00, 0x08, 0x66, 0x3C, 0x30, 0x38, 0x02, 0x20, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x08, 
-    0x48, 0x6D, 0xEE, 0x86, 0x4E, 0xBA, 0x02, 0xD4, 0x70, 0x26, 0x2F, 0x00, 0x48, 0x6D, 0xEE, 0xAA, 
-    0x4E, 0xBA, 0x03, 0x0E, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xEE, 0xB8, 0x48, 0x6D, 0xF6, 0xF6, 
-    0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x07, 0x7C, 0x4F, 0xEF, 0x00, 0x1C, 
-    0x20, 0x0C, 0x67, 0x12, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x13, 0x18, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 
-    0x62, 0x6C, 0x65, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 
-    0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x20, 0x2E, 0x00, 0x10, 0xD0, 0x8C, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x60, 0x02, 0x16, 0xDC, 0xB9, 0xEE, 0xFF, 0xFC, 0x65, 0xF8, 0x20, 0x0B, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x63, 0x6F, 0x70, 0x79, 0x42, 0x79, 0x74, 
-    0x65, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x50, 0x43, 0x63, 0x55, 0x6C, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x07, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0xE6, 0x2C, 0x14, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x6C, 
-    0x00, 0x08, 0x20, 0x50, 0x48, 0x70, 0x68, 0x00, 0x4E, 0xBA, 0xFF, 0x8E, 0xDF, 0x94, 0x20, 0x06, 
-    0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x41, 0x70, 0x70, 0x65, 
-    0x6E, 0x64, 0x42, 0x79, 0x74, 0x65, 0x73, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x50, 0x43, 0x76, 0x55, 0x6C, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x54, 0xFF, 0xFC, 
-    0x20, 0x6C, 0x00, 0x08, 0xA0, 0x29, 0x55, 0x8F, 0x3F, 0x2E, 0x00, 0x0E, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x6C, 0x00, 0x08, 0x2F, 0x10, 0x4E, 0xBA, 0x0A, 0x96, 0x3E, 0x1F, 0x20, 0x6C, 0x00, 0x08, 
-    0xA0, 0x2A, 0x4A, 0x47, 0x66, 0x3E, 0x20, 0x14, 0xB0, 0xAE, 0xFF, 0xFC, 0x67, 0x36, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x2F, 0x14, 0x48, 0x6D, 0xEE, 0xCC, 0x4E, 0xBA, 0x01, 0x80, 0x70, 0x52, 0x2F, 0x00, 
-    0x48, 0x6D, 0xEF, 0x10, 0x4E, 0xBA, 0x01, 0xBA, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0x1E, 
-    0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x28, 
-    0x4F, 0xEF, 0x00, 0x1C, 0x30, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x97, 0x57, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x73, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x03, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x14, 0xB0, 0xAC, 0x00, 0x04, 
-    0x63, 0x36, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x48, 0x6D, 0xEF, 0x32, 0x4E, 0xBA, 0x01, 0x0C, 
-    0x70, 0x59, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0x56, 0x4E, 0xBA, 0x01, 0x46, 0x50, 0x8F, 0x2F, 0x00, 
-    0x48, 0x6D, 0xEF, 0x64, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x05, 0xB4, 0x4F, 0xEF, 0x00, 0x1C, 0x2C, 0x2C, 0x00, 0x04, 0x9C, 0x94, 0xBE, 0x86, 
-    0x63, 0x6A, 0x2C, 0x2C, 0x00, 0x04, 0xE3, 0x8E, 0x0C, 0xAC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 
-    0x63, 0x0A, 0x2C, 0x2C, 0x00, 0x04, 0xDC, 0xBC, 0x00, 0x00, 0x40, 0x00, 0x20, 0x6C, 0x00, 0x08, 
-    0x20, 0x06, 0xA0, 0x24, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x3E, 0x30, 0x38, 0x02, 0x20, 0x48, 0xC0, 
-    0x2F, 0x00, 0x2F, 0x06, 0x2F, 0x2C, 0x00, 0x08, 0x48, 0x6D, 0xEF, 0x78, 0x4E, 0xBA, 0x00, 0x9C, 
-    0x70, 0x61, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0xA4, 0x4E, 0xBA, 0x00, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 
-    0x48, 0x6D, 0xEF, 0xB2, 0x48, 0x6D, 0xF6, 0xF6, 0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x05, 0x44, 0x4F, 0xEF, 0x00, 0x20, 0x29, 0x46, 0x00, 0x04, 0x20, 0x07, 0xD0, 0x94, 
-    0xB0, 0xAC, 0x00, 0x04, 0x63, 0x3A, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x07, 0xD0, 0x94, 0x2F, 0x00, 
-    0x48, 0x6D, 0xEF, 0xC6, 0x4E, 0xBA, 0x00, 0x54, 0x70, 0x64, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0xF0, 
-    0x4E, 0xBA, 0x00, 0x8E, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xEF, 0xFE, 0x48, 0x6D, 0xF6, 0xF6, 
-    0x4E, 0xAD, 0x03, 0x4A, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0xFC, 0x4F, 0xEF, 0x00, 0x1C, 
-    0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x41, 0x73, 0x73, 0x75, 0x72, 
-    0x65, 0x53, 0x69, 0x7A, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x54, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x46, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x47, 0xED, 0xF2, 0x2C, 0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x62, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x44, 0x62, 0x67, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x50, 0x72, 
-    0x69, 0x6E, 0x74, 0x53, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x65, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x47, 0xED, 0xF2, 0x2C, 0x49, 0xED, 0xF0, 0x2C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 0x48, 0x6D, 0xF0, 0x12, 0x2F, 0x0C, 
-    0x4E, 0xAD, 0x03, 0x5A, 0x2F, 0x0C, 0x4E, 0xBA, 0x0F, 0xA6, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x44, 0x62, 0x67, 0x53, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x5F, 0x46, 
-    0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x20, 0x57, 0x42, 0xA7, 0x48, 0x6D, 0xF3, 0x34, 0x48, 0x6D, 
-    0xF3, 0x30, 0x48, 0x6D, 0xF3, 0x2C, 0x2F, 0x08, 0x4E, 0xBA, 0x01, 0xE2, 0x72, 0xFF, 0xB0, 0x41, 
-    0x67, 0x2E, 0x58, 0x8F, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x6D, 0xF5, 0x54, 0x4E, 0xBA, 0x05, 0xD0, 
-    0x58, 0x4F, 0x4A, 0x80, 0x66, 0x24, 0x2F, 0x2D, 0xF3, 0x34, 0x2F, 0x2D, 0xF3, 0x30, 0x2F, 0x2D, 
-    0xF3, 0x2C, 0x4E, 0xBA, 0xF2, 0x1C, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0xF8, 
-    0x48, 0x7A, 0x00, 0x0A, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x4E, 0x75, 0x1B, 0x44, 0x61, 0x74, 
-    0x61, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x21, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 
-    0x4A, 0x6D, 0xF4, 0x5C, 0x66, 0x00, 0x00, 0xBC, 0x59, 0x8F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 
-    0x48, 0x6D, 0xF4, 0x06, 0xA8, 0x20, 0x28, 0x5F, 0x20, 0x0C, 0x67, 0x00, 0x00, 0xA6, 0x55, 0x8F, 
-    0xA9, 0x94, 0x55, 0x8F, 0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 0x66, 0x00, 0x00, 0x94, 
-    0x41, 0xED, 0x00, 0x82, 0x22, 0x6D, 0xF4, 0x78, 0x23, 0x48, 0x00, 0x0C, 0x26, 0x54, 0x30, 0x13, 
-    0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x3B, 0x7C, 0x00, 0x28, 0xF4, 0x5A, 0x60, 0x06, 0x3B, 0x7C, 
-    0x00, 0x04, 0xF4, 0x5A, 0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x9E, 0x30, 0x2D, 0xF4, 0x5A, 
-    0x48, 0xC0, 0x22, 0x1F, 0x92, 0x80, 0x20, 0x01, 0x72, 0x04, 0x4E, 0xBA, 0x04, 0x0A, 0x2C, 0x00, 
-    0x70, 0x00, 0x26, 0x40, 0x60, 0x36, 0x2F, 0x0C, 0xA9, 0xA2, 0x30, 0x2D, 0xF4, 0x5A, 0x48, 0xC0, 
-    0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xFC, 0x30, 0x2D, 0xF4, 0x5C, 0x48, 0xC0, 0x20, 0x6E, 0xFF, 0xFC, 
-    0xE5, 0x80, 0x30, 0x30, 0x08, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x67, 0x08, 0x20, 0x0D, 0x26, 0x40, 
-    0xD7, 0xC7, 0x4E, 0x93, 0x30, 0x2D, 0xF4, 0x5C, 0x52, 0x6D, 0xF4, 0x5C, 0x30, 0x2D, 0xF4, 0x5C, 
-    0x48, 0xC0, 0xBC, 0x80, 0x6E, 0xC0, 0x20, 0x0B, 0x67, 0x04, 0x2F, 0x0B, 0xA9, 0xF1, 0x2F, 0x0C, 
-    0xA9, 0xA3, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x5F, 0x43, 
-    0x70, 0x6C, 0x75, 0x73, 0x49, 0x6E, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x01, 0x18, 0x4A, 0x6D, 0xF4, 0x5C, 0x67, 0x64, 0x59, 0x8F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 
-    0x48, 0x6D, 0xF4, 0x30, 0xA9, 0xA1, 0x28, 0x5F, 0x20, 0x0C, 0x67, 0x50, 0x55, 0x8F, 0xA9, 0x94, 
-    0x55, 0x8F, 0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 0x66, 0x40, 0x60, 0x34, 0x2F, 0x0C, 
-    0xA9, 0xA2, 0x30, 0x2D, 0xF4, 0x5A, 0x48, 0xC0, 0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xFC, 0x53, 0x6D, 
-    0xF4, 0x5C, 0x30, 0x2D, 0xF4, 0x5C, 0x48, 0xC0, 0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x80, 0x30, 0x30, 
-    0x08, 0x02, 0x48, 0xC0, 0x2E, 0x00, 0x20, 0x0D, 0x26, 0x40, 0xD7, 0xC7, 0x4A, 0x87, 0x67, 0x02, 
-    0x4E, 0x93, 0x4A, 0x6D, 0xF4, 0x5C, 0x6E, 0xC6, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xEE, 0x18, 0x80, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x64, 0x74, 0x6F, 0x72, 0x73, 0x5F, 0x5F, 0x46, 0x76, 
-    0x00, 0x00, 0x2F, 0x02, 0x20, 0x2F, 0x00, 0x08, 0x20, 0x6F, 0x00, 0x0C, 0x42, 0x67, 0xA9, 0xEE, 
-    0x2F, 0x08, 0x4E, 0xBA, 0x0D, 0x76, 0x58, 0x4F, 0x24, 0x1F, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x13, 0x38, 0x2E, 0x2E, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x4E, 0xAD, 0x01, 0xBA, 
-    0x4A, 0x80, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xC8, 0x20, 0x6D, 0xF4, 0x78, 0x20, 0xAE, 
-    0x00, 0x08, 0x76, 0x01, 0x4A, 0xB8, 0x03, 0x16, 0x67, 0x2C, 0x70, 0x01, 0xC0, 0xB8, 0x03, 0x16, 
-    0x66, 0x24, 0x20, 0x78, 0x03, 0x16, 0x0C, 0x90, 0x4D, 0x50, 0x47, 0x4D, 0x66, 0x18, 0x20, 0x78, 
-    0x03, 0x16, 0x4A, 0xA8, 0x00, 0x04, 0x67, 0x0E, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 
-    0x4A, 0x50, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2B, 0x43, 0xF4, 0x5E, 0x67, 0x60, 
-    0x41, 0xED, 0xF5, 0x32, 0x43, 0xF8, 0x09, 0x10, 0x70, 0x07, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0xD9, 0x41, 0xED, 0xF5, 0x32, 0x22, 0x6D, 0xF4, 0x68, 0x22, 0x88, 0x4A, 0x87, 0x66, 0x0E, 
-    0x59, 0x8F, 0x20, 0x6D, 0xF4, 0x68, 0x2F, 0x10, 0x4E, 0xBA, 0x0C, 0xC4, 0x58, 0x4F, 0x20, 0x0B, 
-    0x67, 0x04, 0x70, 0x01, 0x26, 0x80, 0x4A, 0xAE, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0xAD, 0xF4, 0x68, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 
-    0xF4, 0x6C, 0x4E, 0xBA, 0xFD, 0xC4, 0x70, 0x01, 0x2B, 0x40, 0xF4, 0x5E, 0x60, 0x00, 0x01, 0x22, 
-    0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x30, 0x2D, 0xF4, 0x62, 0xB0, 0x50, 0x67, 0x0C, 
-    0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x4E, 0xBA, 0x01, 0x8E, 0x58, 0x4F, 0x41, 0xED, 0xF4, 0x62, 
-    0x22, 0x78, 0x03, 0x16, 0x22, 0x69, 0x00, 0x04, 0x23, 0x48, 0x00, 0x24, 0x20, 0x78, 0x03, 0x16, 
-    0x2B, 0x68, 0x00, 0x04, 0xF4, 0x86, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 
-    0x00, 0x02, 0xF4, 0x64, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x06, 
-    0xF4, 0x68, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x0A, 0xF4, 0x6C, 
-    0x4A, 0x87, 0x67, 0x2C, 0x28, 0x6D, 0xF4, 0x68, 0x60, 0x0C, 0x59, 0x8F, 0x2F, 0x14, 0x4E, 0xBA, 
-    0x0B, 0xE8, 0x58, 0x4F, 0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 0x28, 0x6D, 0xF4, 0x6C, 0x60, 0x0C, 
-    0x59, 0x8F, 0x2F, 0x14, 0x4E, 0xBA, 0x0B, 0xD2, 0x58, 0x4F, 0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 
-    0x20, 0x0B, 0x67, 0x04, 0x26, 0xAD, 0xF4, 0x64, 0x4A, 0xAE, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0xAD, 0xF4, 0x68, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 
-    0x20, 0xAD, 0xF4, 0x6C, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x20, 
-    0x67, 0x54, 0x70, 0x78, 0xA1, 0x1E, 0x2B, 0x48, 0xF4, 0x82, 0x66, 0x0A, 0x70, 0x02, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x00, 0xD4, 0x58, 0x4F, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x26, 0x68, 
-    0x00, 0x20, 0x7E, 0x00, 0x76, 0x05, 0x22, 0x07, 0x20, 0x01, 0xC2, 0xFC, 0x00, 0x18, 0x48, 0x40, 
-    0xC0, 0xFC, 0x00, 0x18, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x2C, 0x01, 0x20, 0x6D, 0xF4, 0x82, 
-    0x43, 0xF3, 0x68, 0x00, 0x45, 0xF0, 0x68, 0x00, 0x70, 0x05, 0x24, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x52, 0x87, 0xB6, 0x87, 0x6E, 0xD0, 0x4E, 0xBA, 0xFC, 0xA0, 0x70, 0x00, 0x2B, 0x40, 0xF4, 0x5E, 
-    0x4C, 0xEE, 0x1C, 0xC8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x49, 0x6E, 
-    0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x4A, 0xAD, 0xF4, 0x74, 0x66, 0x08, 0x41, 0xED, 0xF6, 0x42, 0x2B, 0x48, 0xF4, 0x74, 0x20, 0x6D, 
-    0xF4, 0x78, 0x49, 0xE8, 0x00, 0x10, 0x60, 0x0C, 0x4A, 0x94, 0x66, 0x06, 0x28, 0x8B, 0x70, 0x00, 
-    0x60, 0x10, 0x58, 0x4C, 0x20, 0x6D, 0xF4, 0x78, 0x41, 0xE8, 0x00, 0x90, 0xB1, 0xCC, 0x62, 0xE8, 
-    0x70, 0x01, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x61, 0x74, 0x65, 
-    0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 
-    0xC0, 0xAE, 0x00, 0x08, 0x2F, 0x00, 0x4E, 0xBA, 0x00, 0x0E, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x65, 
-    0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x20, 0x6D, 0xF4, 0x78, 
-    0x49, 0xE8, 0x00, 0x8C, 0x60, 0x0A, 0x4A, 0x94, 0x67, 0x04, 0x20, 0x54, 0x4E, 0x90, 0x59, 0x4C, 
-    0x20, 0x6D, 0xF4, 0x78, 0xB1, 0xCC, 0x65, 0xEE, 0x4A, 0xAD, 0xF4, 0x86, 0x67, 0x0A, 0x20, 0x6D, 
-    0xF4, 0x86, 0x21, 0x6E, 0x00, 0x08, 0x00, 0x0E, 0x4A, 0xAD, 0xF5, 0x6C, 0x66, 0x0A, 0x20, 0x6D, 
-    0xF4, 0x78, 0x22, 0x50, 0x4E, 0x91, 0x60, 0x0E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6D, 0xF5, 0x54, 
-    0x4E, 0xBA, 0x01, 0x58, 0x50, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x52, 0x54, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x04, 0x22, 0x2F, 0x00, 0x08, 
-    0x2F, 0x00, 0xC0, 0xC1, 0x20, 0x40, 0x20, 0x01, 0xC2, 0xDF, 0x42, 0x40, 0x48, 0x40, 0x67, 0x02, 
-    0xC0, 0xD7, 0x54, 0x8F, 0xD0, 0x41, 0x48, 0x40, 0x42, 0x40, 0xD0, 0x88, 0x4E, 0x75, 0x22, 0x2F, 
-    0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 
-    0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x08, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x48, 0x20, 0x01, 
-    0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 
-    0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x00, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 
-    0x00, 0x74, 0x20, 0x01, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 
-    0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x08, 0x01, 
-    0xC3, 0x40, 0x4E, 0x75, 0x4A, 0x80, 0x6B, 0x14, 0x4A, 0x81, 0x6B, 0x06, 0x4E, 0xBA, 0x00, 0x46, 
-    0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x3E, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x80, 0x4A, 0x81, 
-    0x6B, 0x0A, 0x4E, 0xBA, 0x00, 0x30, 0x44, 0x80, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 
-    0x00, 0x24, 0x44, 0x80, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 
-    0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x00, 0x01, 
-    0xC3, 0x40, 0x4E, 0x75, 0x3F, 0x01, 0x48, 0x41, 0x4A, 0x41, 0x66, 0x1C, 0x22, 0x00, 0x42, 0x41, 
-    0x48, 0x41, 0x67, 0x0A, 0x82, 0xD7, 0x48, 0x41, 0x48, 0x40, 0x30, 0x01, 0x48, 0x40, 0x80, 0xDF, 
-    0x32, 0x00, 0x42, 0x40, 0x48, 0x40, 0x4E, 0x75, 0x48, 0x41, 0x3E, 0x82, 0x2F, 0x03, 0x34, 0x00, 
-    0x26, 0x01, 0x72, 0x01, 0x42, 0x40, 0x48, 0x40, 0x66, 0x0C, 0x48, 0x40, 0x30, 0x02, 0x72, 0x00, 
-    0x60, 0x16, 0xD2, 0x41, 0x65, 0x12, 0xD4, 0x42, 0xD1, 0x80, 0xB0, 0x83, 0x65, 0xF4, 0x90, 0x83, 
-    0xD2, 0x41, 0x08, 0xC1, 0x00, 0x00, 0x64, 0xEE, 0x26, 0x1F, 0x34, 0x1F, 0x4E, 0x75, 0x22, 0x5F, 
-    0x20, 0x57, 0x48, 0xD0, 0xDE, 0xFC, 0x70, 0x00, 0x4E, 0xD1, 0x20, 0x2F, 0x00, 0x08, 0x66, 0x02, 
-    0x70, 0x01, 0x20, 0x6F, 0x00, 0x04, 0x4C, 0xD0, 0xDE, 0xFC, 0x4E, 0xD1, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x03, 0x00, 0x2C, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xF4, 0x74, 0x66, 0x08, 0x41, 0xED, 
-    0xF6, 0x42, 0x2B, 0x48, 0xF4, 0x74, 0x20, 0x6D, 0xF4, 0x74, 0x42, 0x68, 0x00, 0x02, 0x7E, 0x01, 
-    0x60, 0x04, 0xE2, 0x86, 0x52, 0x87, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xF6, 0x20, 0x07, 0xE1, 0x48, 
-    0x48, 0x40, 0x42, 0x40, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0x0E, 0x58, 0x4F, 0x4C, 0xEE, 0x00, 0xC0, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x69, 0x67, 0x5F, 0x64, 0x66, 0x6C, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x42, 0xA7, 0x3F, 0x3C, 0xA8, 0x6E, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 
-    0x01, 0x06, 0x42, 0xA7, 0x3F, 0x3C, 0xAA, 0x6E, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 0x00, 0xF8, 
-    0x20, 0x1F, 0xB0, 0x9F, 0x66, 0x08, 0x3D, 0x7C, 0x02, 0x00, 0x00, 0x08, 0x60, 0x06, 0x3D, 0x7C, 
-    0x04, 0x00, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x4E, 0x55, 0x4D, 0x54, 0x4F, 
-    0x4F, 0x4C, 0x42, 0x4F, 0x58, 0x54, 0x52, 0x41, 0x50, 0x53, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x70, 0x00, 0x30, 0x2E, 0x00, 0x08, 0xC0, 0xBC, 0x00, 0x00, 0x08, 0x00, 0x4A, 0x80, 0x6F, 0x08, 
-    0x1D, 0x7C, 0x00, 0x01, 0x00, 0x0A, 0x60, 0x04, 0x42, 0x2E, 0x00, 0x0A, 0x4E, 0x5E, 0x20, 0x5F, 
-    0x54, 0x4F, 0x4E, 0xD0, 0x8D, 0x5F, 0x5F, 0x47, 0x45, 0x54, 0x54, 0x52, 0x41, 0x50, 0x54, 0x59, 
-    0x50, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 0x48, 0xE7, 0x03, 0x00, 0x3E, 0x2E, 0x00, 0x08, 
-    0x42, 0x67, 0x3F, 0x07, 0x4E, 0xBA, 0xFF, 0xB6, 0x1C, 0x1F, 0x70, 0x01, 0xB0, 0x06, 0x66, 0x1A, 
-    0x70, 0x00, 0x30, 0x07, 0xC0, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0x3E, 0x00, 0x42, 0x67, 0x4E, 0xBA, 
-    0xFF, 0x50, 0xBE, 0x5F, 0x6D, 0x04, 0x3E, 0x3C, 0xA8, 0x9F, 0x42, 0xA7, 0x3F, 0x07, 0x1F, 0x06, 
-    0x4E, 0xBA, 0x00, 0x54, 0x42, 0xA7, 0x3F, 0x3C, 0xA8, 0x9F, 0x1F, 0x3C, 0x00, 0x01, 0x4E, 0xBA, 
-    0x00, 0x46, 0x20, 0x1F, 0xB0, 0x9F, 0x56, 0xC0, 0x44, 0x00, 0x1D, 0x40, 0x00, 0x0A, 0x4C, 0xDF, 
-    0x00, 0xC0, 0x4E, 0x5E, 0x20, 0x5F, 0x54, 0x4F, 0x4E, 0xD0, 0x8D, 0x54, 0x52, 0x41, 0x50, 0x41, 
-    0x56, 0x41, 0x49, 0x4C, 0x41, 0x42, 0x4C, 0x45, 0x00, 0x00, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x21, 
-    0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x25, 0x2E, 0x80, 
-    0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 0x22, 0x5F, 0x12, 0x1F, 0x30, 0x1F, 0x4A, 0x01, 0x67, 0x04, 
-    0xA7, 0x46, 0x60, 0x02, 0xA3, 0x46, 0x2E, 0x88, 0x4E, 0xD1, 0x20, 0x6F, 0x00, 0x0C, 0x22, 0x6F, 
-    0x00, 0x08, 0x70, 0x00, 0x10, 0x18, 0x48, 0x40, 0x10, 0x19, 0x4A, 0x2F, 0x00, 0x04, 0x67, 0x0E, 
-    0x4A, 0x2F, 0x00, 0x06, 0x67, 0x04, 0xA4, 0x3C, 0x60, 0x10, 0xA0, 0x3C, 0x60, 0x0C, 0x4A, 0x2F, 
-    0x00, 0x06, 0x67, 0x04, 0xA6, 0x3C, 0x60, 0x02, 0xA2, 0x3C, 0x0A, 0x00, 0x00, 0x01, 0x1F, 0x40, 
-    0x00, 0x10, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0C, 0x4E, 0xD0, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 
-    0x66, 0x04, 0xA0, 0x01, 0x60, 0x02, 0xA4, 0x01, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 
-    0x20, 0x5F, 0x66, 0x04, 0xA0, 0x02, 0x60, 0x02, 0xA4, 0x02, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 
-    0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 0xA0, 0x12, 0x60, 0x02, 0xA4, 0x12, 0x3E, 0x80, 0x4E, 0xD1, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x0E, 0x00, 0x12, 0x31, 0x6E, 0x00, 0x0C, 
-    0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 0x42, 0x28, 0x00, 0x1B, 0x42, 0xA8, 0x00, 0x1C, 0x70, 0x1A, 
-    0xA0, 0x60, 0x0C, 0x40, 0xFF, 0xCE, 0x66, 0x02, 0xA0, 0x00, 0x22, 0x6E, 0x00, 0x08, 0x32, 0xA8, 
-    0x00, 0x18, 0x3D, 0x40, 0x00, 0x12, 0x4E, 0x5E, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0A, 0x4E, 0xD0, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x31, 0x6E, 0x00, 0x08, 0x00, 0x18, 0xA0, 0x01, 0x3D, 0x40, 
-    0x00, 0x0A, 0x4E, 0x5E, 0x20, 0x5F, 0x54, 0x8F, 0x4E, 0xD0, 0x51, 0xC1, 0x60, 0x02, 0x50, 0xC1, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x08, 0x00, 0x20, 0x31, 0x6E, 0x00, 0x10, 
-    0x00, 0x18, 0x22, 0x6E, 0x00, 0x0C, 0x21, 0x51, 0x00, 0x24, 0x42, 0x68, 0x00, 0x2C, 0x42, 0xA8, 
-    0x00, 0x2E, 0x4A, 0x01, 0x66, 0x04, 0xA0, 0x02, 0x60, 0x02, 0xA0, 0x03, 0x3D, 0x40, 0x00, 0x12, 
-    0x22, 0x6E, 0x00, 0x0C, 0x22, 0xA8, 0x00, 0x28, 0x4E, 0x5E, 0x22, 0x5F, 0x4F, 0xEF, 0x00, 0x0A, 
-    0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xB0, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x12, 0x00, 0x12, 0x31, 0x6E, 
-    0x00, 0x10, 0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 0xA0, 0x08, 0x66, 0x16, 0x42, 0x68, 0x00, 0x1C, 
-    0xA0, 0x0C, 0x66, 0x0E, 0x43, 0xE8, 0x00, 0x20, 0x22, 0xEE, 0x00, 0x08, 0x22, 0xAE, 0x00, 0x0C, 
-    0xA0, 0x0D, 0x3D, 0x40, 0x00, 0x16, 0x4E, 0x5E, 0x22, 0x5F, 0x4F, 0xEF, 0x00, 0x0E, 0x4E, 0xD1, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x0A, 0x00, 0x12, 0x31, 0x6E, 0x00, 0x08, 
-    0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 0xA0, 0x09, 0x3D, 0x40, 0x00, 0x0E, 0x4E, 0x5E, 0x22, 0x5F, 
-    0x5C, 0x8F, 0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x21, 0x6E, 0x00, 0x0E, 0x00, 0x12, 
-    0x31, 0x6E, 0x00, 0x0C, 0x00, 0x16, 0x42, 0x28, 0x00, 0x1A, 0x21, 0x6E, 0x00, 0x08, 0x00, 0x1C, 
-    0xA0, 0x0B, 0x3D, 0x40, 0x00, 0x12, 0x4E, 0x5E, 0x22, 0x5F, 0x4F, 0xEF, 0x00, 0x0A, 0x4E, 0xD1, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x31, 0x6E, 0x00, 0x0C, 0x00, 0x18, 0x21, 0x6E, 0x00, 0x08, 
-    0x00, 0x1C, 0xA0, 0x12, 0x3D, 0x40, 0x00, 0x0E, 0x4E, 0x5E, 0x22, 0x5F, 0x5C, 0x8F, 0x4E, 0xD1, 
-    0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x31, 0x6E, 0x00, 0x0C, 0x00, 0x18, 0xA0, 0x18, 0x3D, 0x40, 
-    0x00, 0x0E, 0x22, 0x6E, 0x00, 0x08, 0x22, 0xA8, 0x00, 0x2E, 0x4E, 0x5E, 0x22, 0x5F, 0x5C, 0x8F, 
-    0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xCE, 0x20, 0x4F, 0x31, 0x6E, 0x00, 0x0E, 0x00, 0x18, 0x31, 0x6E, 
-    0x00, 0x0C, 0x00, 0x2C, 0x21, 0x6E, 0x00, 0x08, 0x00, 0x2E, 0xA0, 0x44, 0x3D, 0x40, 0x00, 0x10, 
-    0x4E, 0x5E, 0x22, 0x5F, 0x50, 0x8F, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 
-    0xA2, 0x14, 0x60, 0x02, 0xA6, 0x14, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 
-    0x66, 0x06, 0x70, 0x08, 0xA2, 0x60, 0x60, 0x04, 0x70, 0x08, 0xA6, 0x60, 0x3E, 0x80, 0x4E, 0xD1, 
-    0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 0x66, 0x06, 0x70, 0x09, 0xA2, 0x60, 0x60, 0x04, 0x70, 0x09, 
-    0xA6, 0x60, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 0xA2, 0x00, 
-    0x60, 0x02, 0xA6, 0x00, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 
-    0xA2, 0x0A, 0x60, 0x02, 0xA6, 0x0A, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 
-    0x66, 0x04, 0xA2, 0x08, 0x60, 0x02, 0xA6, 0x08, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 0x10, 0x1F, 
-    0x20, 0x5F, 0x66, 0x04, 0xA2, 0x09, 0x60, 0x02, 0xA6, 0x09, 0x3E, 0x80, 0x4E, 0xD1, 0x22, 0x5F, 
-    0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 0xA2, 0x0C, 0x60, 0x02, 0xA6, 0x0C, 0x3E, 0x80, 0x4E, 0xD1, 
-    0x22, 0x5F, 0x10, 0x1F, 0x20, 0x5F, 0x66, 0x04, 0xA2, 0x0D, 0x60, 0x02, 0xA6, 0x0D, 0x3E, 0x80, 
-    0x4E, 0xD1, 0x4E, 0x56, 0xFF, 0xCC, 0x2F, 0x07, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xDE, 0x55, 0x8F, 
-    0x48, 0x6E, 0xFF, 0xCC, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xBA, 0xFF, 0x3E, 0x3E, 0x1F, 0x20, 0x6E, 
-    0x00, 0x0C, 0x30, 0xAE, 0xFF, 0xE2, 0x20, 0x6E, 0x00, 0x08, 0x20, 0xAE, 0xFF, 0xFC, 0x3D, 0x47, 
-    0x00, 0x14, 0x2E, 0x2E, 0xFF, 0xC8, 0x4E, 0x5E, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0C, 0x4E, 0xD0, 
-    0x87, 0x48, 0x47, 0x45, 0x54, 0x56, 0x4F, 0x4C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x86, 0x3D, 0x6E, 
-    0x00, 0x10, 0xFF, 0x9C, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xB6, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0x98, 
-    0x42, 0x2E, 0xFF, 0xA0, 0x55, 0x8F, 0x48, 0x6E, 0xFF, 0x86, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xBA, 
-    0xFF, 0x5C, 0x3D, 0x5F, 0x00, 0x12, 0x4E, 0x5E, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0A, 0x4E, 0xD0, 
-    0x87, 0x48, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x86, 0x2F, 0x07, 
-    0x3D, 0x6E, 0x00, 0x14, 0xFF, 0x9C, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xB6, 0x2D, 0x6E, 0x00, 0x0C, 
-    0xFF, 0x98, 0x42, 0x2E, 0xFF, 0xA0, 0x42, 0x6E, 0xFF, 0xA2, 0x55, 0x8F, 0x48, 0x6E, 0xFF, 0x86, 
-    0x70, 0x00, 0x1F, 0x00, 0x4E, 0xBA, 0xFF, 0x28, 0x3E, 0x1F, 0x20, 0x6E, 0x00, 0x08, 0x43, 0xEE, 
-    0xFF, 0xA6, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x3D, 0x47, 0x00, 0x16, 0x2E, 0x2E, 
-    0xFF, 0x82, 0x4E, 0x5E, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x0E, 0x4E, 0xD0, 0x89, 0x48, 0x47, 0x45, 
-    0x54, 0x46, 0x49, 0x4E, 0x46, 0x4F, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x86, 0x48, 0xE7, 0x03, 0x00, 
-    0x2C, 0x2E, 0x00, 0x10, 0x3D, 0x6E, 0x00, 0x14, 0xFF, 0x9C, 0x2D, 0x46, 0xFF, 0xB6, 0x2D, 0x6E, 
-    0x00, 0x0C, 0xFF, 0x98, 0x42, 0x2E, 0xFF, 0xA0, 0x42, 0x6E, 0xFF, 0xA2, 0x55, 0x8F, 0x48, 0x6E, 
-    0xFF, 0x86, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xBA, 0xFE, 0xC6, 0x3E, 0x1F, 0x66, 0x24, 0x20, 0x6E, 
-    0x00, 0x08, 0x43, 0xEE, 0xFF, 0xA6, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x2D, 0x46, 
-    0xFF, 0xB6, 0x55, 0x8F, 0x48, 0x6E, 0xFF, 0x86, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xBA, 0xFE, 0xB2, 
-    0x3E, 0x1F, 0x3D, 0x47, 0x00, 0x16, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0x7E, 0x4E, 0x5E, 0x20, 0x5F, 
-    0x4F, 0xEF, 0x00, 0x0E, 0x4E, 0xD0, 0x89, 0x48, 0x53, 0x45, 0x54, 0x46, 0x49, 0x4E, 0x46, 0x4F, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0x7C, 0x48, 0xE7, 0x0F, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 
-    0x00, 0x0C, 0x3A, 0x2E, 0x00, 0x16, 0x2C, 0x2E, 0x00, 0x12, 0x42, 0x04, 0x55, 0x8F, 0x2F, 0x3C, 
-    0x66, 0x6F, 0x6C, 0x64, 0x48, 0x6E, 0xFF, 0x7C, 0x4E, 0xBA, 0x01, 0x30, 0x3E, 0x1F, 0x66, 0x0C, 
-    0x20, 0x2E, 0xFF, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x02, 0x78, 0x01, 0x4A, 0x04, 0x67, 0x1A, 
-    0x55, 0x8F, 0x3F, 0x05, 0x2F, 0x06, 0x1F, 0x2E, 0x00, 0x10, 0x2F, 0x0C, 0x2F, 0x0B, 0x70, 0x00, 
-    0xA8, 0x23, 0x3D, 0x5F, 0x00, 0x18, 0x60, 0x00, 0x00, 0xE4, 0x0C, 0x86, 0x6D, 0x61, 0x63, 0x73, 
-    0x67, 0x42, 0x0C, 0x86, 0x74, 0x65, 0x6D, 0x70, 0x67, 0x3A, 0x0C, 0x86, 0x70, 0x72, 0x65, 0x66, 
-    0x67, 0x32, 0x0C, 0x86, 0x65, 0x78, 0x74, 0x6E, 0x67, 0x2A, 0x0C, 0x86, 0x63, 0x74, 0x72, 0x6C, 
-    0x67, 0x22, 0x0C, 0x86, 0x61, 0x6D, 0x6E, 0x75, 0x67, 0x1A, 0x0C, 0x86, 0x73, 0x74, 0x72, 0x74, 
-    0x67, 0x12, 0x0C, 0x86, 0x70, 0x72, 0x6E, 0x74, 0x67, 0x0A, 0x3D, 0x7C, 0xFF, 0xCE, 0x00, 0x18, 
-    0x60, 0x00, 0x00, 0x9A, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x92, 0x0C, 0x45, 0x80, 0x00, 0x66, 0x24, 
-    0x3D, 0x78, 0x0A, 0x58, 0xFF, 0x98, 0x42, 0x6E, 0xFF, 0x9C, 0x70, 0x02, 0x2D, 0x40, 0xFF, 0xBA, 
-    0x41, 0xEE, 0xFF, 0x80, 0x70, 0x08, 0xA2, 0x60, 0x3E, 0x00, 0x66, 0x6C, 0x3D, 0x6E, 0xFF, 0xB4, 
-    0xFF, 0x96, 0x60, 0x04, 0x3D, 0x45, 0xFF, 0x96, 0x70, 0x06, 0x2D, 0x40, 0xFF, 0xA4, 0x41, 0xEE, 
-    0xFF, 0xFA, 0x2D, 0x48, 0xFF, 0xA0, 0x41, 0xEE, 0xFF, 0x80, 0x70, 0x30, 0xA2, 0x60, 0x3E, 0x00, 
-    0x0C, 0x47, 0xFF, 0xCE, 0x67, 0x10, 0x4A, 0x47, 0x66, 0x38, 0x20, 0x3C, 0x00, 0x02, 0x00, 0x00, 
-    0xC0, 0xAE, 0xFF, 0xFC, 0x66, 0x2C, 0x42, 0x6E, 0xFF, 0x9C, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xDA, 
-    0x2D, 0x40, 0xFF, 0xB0, 0x41, 0xEE, 0xFF, 0x80, 0xA2, 0x07, 0x3E, 0x00, 0x66, 0x1A, 0x4A, 0xAE, 
-    0xFF, 0xDA, 0x67, 0x0A, 0x38, 0xAE, 0xFF, 0x96, 0x26, 0xAE, 0xFF, 0xDA, 0x60, 0x0A, 0x7E, 0xD5, 
-    0x60, 0x06, 0x4A, 0x47, 0x66, 0x02, 0x7E, 0xD5, 0x3D, 0x47, 0x00, 0x18, 0x4C, 0xEE, 0x18, 0xF0, 
-    0xFF, 0x64, 0x4E, 0x5E, 0x20, 0x5F, 0x4F, 0xEF, 0x00, 0x10, 0x4E, 0xD0, 0x8A, 0x46, 0x49, 0x4E, 
-    0x44, 0x46, 0x4F, 0x4C, 0x44, 0x45, 0x52, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x3C, 
-    0x00, 0x00, 0xA8, 0x9F, 0xA7, 0x46, 0x2F, 0x08, 0x20, 0x3C, 0x00, 0x00, 0xA0, 0xAD, 0xA3, 0x46, 
-    0xB1, 0xDF, 0x67, 0x0E, 0x20, 0x2E, 0x00, 0x0C, 0xA1, 0xAD, 0x22, 0x6E, 0x00, 0x08, 0x22, 0x88, 
-    0x60, 0x26, 0x41, 0xFA, 0x00, 0x36, 0x30, 0x3C, 0xEA, 0x51, 0x22, 0x2E, 0x00, 0x0C, 0xB2, 0x98, 
-    0x67, 0x06, 0x4A, 0x98, 0x67, 0x12, 0x60, 0xF6, 0x43, 0xFA, 0x00, 0x20, 0xD3, 0xD0, 0x4E, 0xD1, 
-    0x22, 0x6E, 0x00, 0x08, 0x22, 0x80, 0x42, 0x40, 0x3D, 0x40, 0x00, 0x10, 0x4E, 0x5E, 0x20, 0x5F, 
-    0x50, 0x8F, 0x4E, 0xD0, 0x30, 0x3C, 0xEA, 0x52, 0x60, 0xEE, 0x76, 0x65, 0x72, 0x73, 0x00, 0x00, 
-    0x00, 0x60, 0x6D, 0x61, 0x63, 0x68, 0x00, 0x00, 0x00, 0x64, 0x73, 0x79, 0x73, 0x76, 0x00, 0x00, 
-    0x00, 0x88, 0x70, 0x72, 0x6F, 0x63, 0x00, 0x00, 0x00, 0x92, 0x66, 0x70, 0x75, 0x20, 0x00, 0x00, 
-    0x00, 0x9E, 0x71, 0x64, 0x20, 0x20, 0x00, 0x00, 0x00, 0xE8, 0x6B, 0x62, 0x64, 0x20, 0x00, 0x00, 
-    0x01, 0x1A, 0x61, 0x74, 0x6C, 0x6B, 0x00, 0x00, 0x01, 0x42, 0x6D, 0x6D, 0x75, 0x20, 0x00, 0x00, 
-    0x01, 0x64, 0x72, 0x61, 0x6D, 0x20, 0x00, 0x00, 0x01, 0x88, 0x6C, 0x72, 0x61, 0x6D, 0x00, 0x00, 
-    0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0x60, 0x82, 0x22, 0x78, 
-    0x02, 0xAE, 0x70, 0x04, 0x0C, 0x69, 0x00, 0x75, 0x00, 0x08, 0x67, 0x12, 0x0C, 0x69, 0x02, 0x76, 
-    0x00, 0x08, 0x66, 0x04, 0x52, 0x40, 0x60, 0x06, 0x10, 0x38, 0x0C, 0xB3, 0x5C, 0x80, 0x60, 0x00, 
-    0xFF, 0x60, 0x70, 0x00, 0x30, 0x38, 0x01, 0x5A, 0x60, 0x00, 0xFF, 0x56, 0x70, 0x00, 0x10, 0x38, 
-    0x01, 0x2F, 0x52, 0x40, 0x60, 0x00, 0xFF, 0x4A, 0x0C, 0x38, 0x00, 0x04, 0x01, 0x2F, 0x67, 0x38, 
-    0x08, 0x38, 0x00, 0x04, 0x0B, 0x22, 0x67, 0x34, 0x20, 0x4F, 0xF2, 0x80, 0x00, 0x00, 0xF3, 0x27, 
-    0x30, 0x17, 0x2E, 0x48, 0x0C, 0x40, 0x1F, 0x18, 0x67, 0x16, 0x0C, 0x40, 0x3F, 0x18, 0x67, 0x10, 
-    0x0C, 0x40, 0x3F, 0x38, 0x67, 0x0E, 0x0C, 0x40, 0x1F, 0x38, 0x67, 0x08, 0x70, 0x00, 0x60, 0x0E, 
-    0x70, 0x01, 0x60, 0x0A, 0x70, 0x02, 0x60, 0x06, 0x70, 0x03, 0x60, 0x02, 0x70, 0x00, 0x60, 0x00, 
-    0xFF, 0x00, 0x0C, 0x78, 0x3F, 0xFF, 0x02, 0x8E, 0x6E, 0x1C, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 
-    0x24, 0x08, 0x20, 0x3C, 0x00, 0x00, 0xAB, 0x03, 0xA7, 0x46, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 
-    0xB4, 0x88, 0x66, 0x06, 0x60, 0x0A, 0x70, 0x00, 0x60, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 
-    0x60, 0x00, 0xFE, 0xCE, 0x10, 0x38, 0x02, 0x1E, 0x41, 0xFA, 0x00, 0x16, 0x22, 0x48, 0x12, 0x18, 
-    0x67, 0x00, 0xFE, 0xD2, 0xB2, 0x00, 0x66, 0xF6, 0x91, 0xC9, 0x20, 0x08, 0x60, 0x00, 0xFE, 0xB2, 
-    0x03, 0x13, 0x0B, 0x02, 0x01, 0x06, 0x07, 0x04, 0x05, 0x08, 0x09, 0x00, 0x70, 0x00, 0x4A, 0x38, 
-    0x02, 0x91, 0x6B, 0x16, 0x12, 0x38, 0x01, 0xFB, 0x02, 0x01, 0x00, 0x0F, 0x0C, 0x01, 0x00, 0x01, 
-    0x66, 0x08, 0x20, 0x78, 0x02, 0xDC, 0x10, 0x28, 0x00, 0x07, 0x60, 0x00, 0xFE, 0x84, 0x0C, 0x38, 
-    0x00, 0x02, 0x01, 0x2F, 0x6D, 0x16, 0x70, 0x00, 0x10, 0x38, 0x0C, 0xB1, 0x0C, 0x00, 0x00, 0x01, 
-    0x67, 0x0C, 0x0C, 0x00, 0x00, 0x03, 0x6D, 0x04, 0x53, 0x40, 0x60, 0x02, 0x70, 0x00, 0x60, 0x00, 
-    0xFE, 0x60, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0x24, 0x08, 0x20, 0x3C, 0x00, 0x00, 0xA8, 0x8F, 
-    0xA7, 0x46, 0x20, 0x38, 0x01, 0x08, 0xB4, 0x88, 0x67, 0x0A, 0x59, 0x8F, 0x3F, 0x3C, 0x00, 0x16, 
-    0xA8, 0x8F, 0x20, 0x1F, 0x60, 0x00, 0xFE, 0x3A, 0x20, 0x2F, 0x00, 0x04, 0x2F, 0x40, 0x00, 0x08, 
-    0x67, 0x26, 0x20, 0x40, 0x22, 0x48, 0x10, 0x19, 0x67, 0x1E, 0x12, 0x11, 0x12, 0xC0, 0x10, 0x01, 
-    0x66, 0xF8, 0x93, 0xC8, 0x20, 0x09, 0x53, 0x40, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x80, 0x22, 0x5F, 0x58, 0x4F, 0x4E, 0xD1, 0x22, 0x5F, 
-    0x20, 0x1F, 0x2E, 0x80, 0x67, 0x12, 0x20, 0x40, 0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 
-    0x00, 0x01, 0x51, 0xC8, 0xFF, 0xFA, 0x42, 0x10, 0x4E, 0xD1, 0x20, 0x2F, 0x00, 0x04, 0x67, 0x12, 
-    0x20, 0x40, 0x42, 0x41, 0x12, 0x10, 0x60, 0x04, 0x10, 0xE8, 0x00, 0x01, 0x51, 0xC9, 0xFF, 0xFA, 
-    0x42, 0x10, 0x4E, 0x75, 0x86, 0x70, 0x32, 0x63, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x20, 0x2F, 
-    0x00, 0x04, 0x67, 0x1C, 0x20, 0x40, 0x22, 0x40, 0x34, 0x3C, 0x00, 0xFF, 0x12, 0x10, 0x10, 0xC0, 
-    0x10, 0x01, 0x57, 0xCA, 0xFF, 0xF8, 0x22, 0x08, 0x20, 0x09, 0x92, 0x80, 0x53, 0x01, 0x12, 0x81, 
-    0x4E, 0x75, 0x86, 0x63, 0x32, 0x70, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x22, 0x5F, 
-    0x20, 0x5F, 0x2F, 0x00, 0x70, 0x00, 0x72, 0x00, 0x10, 0x18, 0x12, 0x19, 0x90, 0x41, 0x6C, 0x02, 
-    0xD2, 0x40, 0xB0, 0x00, 0x60, 0x02, 0xB1, 0x09, 0x56, 0xC9, 0xFF, 0xFC, 0x67, 0x0A, 0x6D, 0x04, 
-    0x70, 0x01, 0x60, 0x04, 0x70, 0x01, 0x44, 0x40, 0x3F, 0x40, 0x00, 0x04, 0x4E, 0x75, 0x88, 0x50, 
-    0x4C, 0x53, 0x74, 0x72, 0x43, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0xC2, 0x58, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x64, 0x6C, 0x5F, 0x5F, 0x46, 
-    0x50, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x08, 
-    0x60, 0x16, 0x4A, 0xAD, 0xF8, 0x82, 0x67, 0x0C, 0x4A, 0x87, 0x67, 0x08, 0x20, 0x6D, 0xF8, 0x82, 
-    0x4E, 0x90, 0x60, 0x04, 0x70, 0x00, 0x60, 0x14, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xAD, 
-    0x02, 0xAA, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x67, 0xD8, 0x20, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x46, 0x55, 0x69, 
-    0x00, 0x00, 0x22, 0x1F, 0x20, 0x17, 0x2E, 0x81, 0x2F, 0x0B, 0x3F, 0x03, 0x4A, 0x80, 0x66, 0x00, 
-    0x00, 0x80, 0x42, 0x38, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x42, 0x67, 
-    0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x12, 0x26, 0x40, 0x42, 0x43, 0x55, 0x4F, 0xA9, 0x94, 0x55, 0x4F, 
-    0x2F, 0x0B, 0xA9, 0xA4, 0xBF, 0x4F, 0x67, 0x3C, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 
-    0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x0A, 0x50, 0xF8, 0x0A, 0x5E, 0x2B, 0x40, 
-    0xF8, 0x86, 0x60, 0x6E, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 0x00, 0x02, 
-    0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x08, 0x26, 0x40, 0x36, 0x3C, 0x00, 0x02, 0x60, 0x06, 0x50, 0xF8, 
-    0x0A, 0x5E, 0x60, 0x4E, 0x50, 0xF8, 0x0A, 0x5E, 0x22, 0x13, 0x67, 0x04, 0x2F, 0x0B, 0xA9, 0xA3, 
-    0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x03, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x32, 
-    0x2B, 0x40, 0xF8, 0x86, 0x26, 0x40, 0x26, 0x53, 0x36, 0x13, 0x6F, 0x26, 0x30, 0x03, 0xD0, 0x40, 
-    0xD0, 0x40, 0x36, 0xC0, 0x58, 0x40, 0x36, 0xC0, 0x53, 0x43, 0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x55, 
-    0x52, 0x53, 0x3F, 0x13, 0xA9, 0xA0, 0x26, 0xDF, 0x57, 0xCB, 0xFF, 0xF0, 0x66, 0x04, 0x42, 0xAD, 
-    0xF8, 0x86, 0x36, 0x1F, 0x26, 0x5F, 0x4E, 0x75, 0x20, 0x5F, 0x24, 0x1F, 0x6A, 0x0C, 0x02, 0x42, 
-    0x00, 0x1F, 0x66, 0x04, 0x72, 0xFC, 0x60, 0x0A, 0x4E, 0xD0, 0x02, 0x42, 0x00, 0x1F, 0x66, 0xF8, 
-    0x72, 0x04, 0x2F, 0x08, 0x20, 0x2D, 0xF8, 0x86, 0x66, 0x10, 0x3F, 0x01, 0x42, 0xA7, 0x4E, 0xBA, 
-    0xFF, 0x12, 0x32, 0x1F, 0x20, 0x2D, 0xF8, 0x86, 0x67, 0x22, 0x22, 0x40, 0x22, 0x51, 0x34, 0x29, 
-    0x00, 0x02, 0xD4, 0x41, 0x66, 0x04, 0x34, 0x11, 0x60, 0x06, 0xB4, 0x51, 0x6F, 0x02, 0x74, 0x04, 
-    0x33, 0x42, 0x00, 0x02, 0x22, 0x71, 0x20, 0x00, 0x2F, 0x11, 0xA8, 0x51, 0x4E, 0x75, 0x24, 0x2D, 
-    0xF8, 0x8A, 0x20, 0x5F, 0x30, 0x1F, 0x48, 0xC0, 0x6E, 0x04, 0x6D, 0x0C, 0x74, 0x00, 0xD4, 0x80, 
-    0x2B, 0x42, 0xF8, 0x8A, 0x4E, 0xFA, 0xFF, 0xA4, 0xD4, 0x80, 0x2B, 0x42, 0xF8, 0x8A, 0x4E, 0xFA, 
-    0xFF, 0x8E, 0x00, 0x00, 0x00, 0x58, 0x01, 0x80, 0x00, 0x03, 0x42, 0x67, 0x4C, 0xEF, 0x01, 0x03, 
-    0x00, 0x06, 0xC1, 0x88, 0x48, 0xE7, 0xC0, 0x80, 0x48, 0x6F, 0x00, 0x0C, 0x3F, 0x3C, 0x00, 0x04, 
-    0xA9, 0xEE, 0x70, 0x00, 0x10, 0x1F, 0x20, 0x6F, 0x00, 0x10, 0x30, 0x80, 0x4E, 0x75, 0x2F, 0x2F, 
-    0x00, 0x04, 0x48, 0x6F, 0x00, 0x0C, 0x2F, 0x2F, 0x00, 0x1A, 0x3F, 0x3C, 0x00, 0x0B, 0xA9, 0xEB, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF4, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF6, 0x3F, 0x3C, 
-    0x00, 0x09, 0xA9, 0xEB, 0x4C, 0xEE, 0x01, 0x03, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x00, 0x00, 
-    0x17, 0x44, 0x01, 0x98, 0x00, 0x01, 0x48, 0xE7, 0x7F, 0xF8, 0x49, 0xFA, 0x01, 0xA8, 0x30, 0x2C, 
-    0x00, 0x04, 0x53, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x32, 0x26, 0x4D, 0x97, 0xD4, 0x2F, 0x0B, 
-    0x2F, 0x14, 0x61, 0x00, 0x01, 0x4C, 0x20, 0x2C, 0x00, 0x08, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 
-    0x61, 0x00, 0x00, 0x2E, 0x50, 0x4F, 0x20, 0x2C, 0x00, 0x0C, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 
-    0x2F, 0x0D, 0x61, 0x00, 0x00, 0xD0, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xDF, 0x1F, 0xFE, 
-    0x4E, 0x75, 0x80, 0x09, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x00, 0x00, 
-    0x22, 0x6F, 0x00, 0x04, 0x20, 0x6F, 0x00, 0x08, 0x48, 0xE7, 0x18, 0x00, 0x76, 0x01, 0x72, 0x00, 
-    0x12, 0x18, 0x24, 0x01, 0x02, 0x41, 0x00, 0x0F, 0x66, 0x0A, 0x61, 0x00, 0x00, 0x44, 0x22, 0x00, 
-    0x67, 0x24, 0x60, 0x02, 0xD2, 0x41, 0x02, 0x42, 0x00, 0xF0, 0x66, 0x08, 0x61, 0x00, 0x00, 0x32, 
-    0x24, 0x00, 0x60, 0x02, 0xE6, 0x4A, 0xD3, 0xC2, 0x28, 0x01, 0x12, 0xD8, 0x53, 0x84, 0x66, 0xFA, 
-    0x53, 0x83, 0x66, 0xF2, 0x60, 0xC6, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x80, 0x10, 0x75, 0x6E, 
-    0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 
-    0x70, 0x00, 0x10, 0x18, 0x6A, 0x42, 0x08, 0x00, 0x00, 0x06, 0x67, 0x34, 0x08, 0x00, 0x00, 0x05, 
-    0x67, 0x20, 0x08, 0x00, 0x00, 0x04, 0x67, 0x0A, 0x61, 0xE6, 0x26, 0x00, 0x61, 0xE2, 0xC1, 0x43, 
-    0x4E, 0x75, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 
-    0x4E, 0x75, 0x02, 0x00, 0x00, 0x1F, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 
-    0x02, 0x00, 0x00, 0x3F, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x80, 0x06, 0x67, 0x65, 0x74, 0x5F, 
-    0x72, 0x6C, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x20, 0x6F, 0x00, 0x0C, 
-    0x74, 0x01, 0x70, 0x00, 0x10, 0x18, 0x67, 0x0C, 0x6A, 0x26, 0x08, 0x80, 0x00, 0x07, 0xE1, 0x88, 
-    0x10, 0x18, 0x60, 0x1C, 0x10, 0x18, 0x67, 0x24, 0x6A, 0x0E, 0xE1, 0x88, 0x10, 0x18, 0xE1, 0x88, 
-    0x10, 0x18, 0xE1, 0x88, 0x10, 0x18, 0x60, 0x08, 0x24, 0x00, 0x61, 0x00, 0xFF, 0x74, 0xC1, 0x42, 
-    0xD0, 0x80, 0xD3, 0xC0, 0xD3, 0x91, 0x53, 0x82, 0x66, 0xF8, 0x60, 0xC4, 0x4E, 0x75, 0x80, 0x0E, 
-    0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 
-    0x74, 0x00, 0x20, 0x5F, 0x20, 0x1F, 0x22, 0x5F, 0x67, 0x28, 0x32, 0x09, 0x02, 0x41, 0x00, 0x03, 
-    0x67, 0x08, 0x12, 0xC2, 0x53, 0x80, 0x66, 0xF2, 0x60, 0x18, 0x22, 0x00, 0xE4, 0x89, 0x67, 0x06, 
-    0x22, 0xC2, 0x53, 0x81, 0x66, 0xFA, 0x02, 0x40, 0x00, 0x03, 0x60, 0x02, 0x12, 0xC2, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x4E, 0xD0, 0x80, 0x0A, 0x5A, 0x45, 0x52, 0x4F, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x5C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-    0x00, 0x00, 0x15, 0x53, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x69, 
-    0x6E, 0x69, 0x74, 0x00, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x19, 0x72, 
-    0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x00, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 
-    0x65, 0x00, 0x01, 0x11, 0x4A, 0x00, 0xF0, 0x01, 0x06, 0x07, 0x52, 0x5A, 0x62, 0x6A, 0x3A, 0x42, 
-    0x00, 0x01, 0x17, 0x7A, 0x00, 0xF0, 0x01, 0x06, 0x07, 0x72, 0x5A, 0x62, 0x6A, 0x3A, 0x42, 0x00, 
-    0x80, 0x80, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 
-    0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x48, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x10, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 
-    0x10, 0x10, 0x20, 0x00, 0x28, 0x80, 0x85, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x00, 0x3A, 
-    0x4D, 0x50, 0x57, 0x3A, 0x00, 0x53, 0x79, 0x73, 0x45, 0x72, 0x72, 0x73, 0x2E, 0x45, 0x72, 0x72, 
-    0x00, 0x53, 0x68, 0x65, 0x6C, 0x6C, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x19, 
-    0x23, 0x23, 0x23, 0x20, 0x25, 0x73, 0x20, 0x2D, 0x20, 0x00, 0x25, 0x73, 0x20, 0x2D, 0x20, 0x00, 
-    0x2E, 0x0D, 0x1E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x62, 0x61, 0x64, 0x20, 0x75, 0x73, 0x61, 
-    0x67, 0x65, 0x00, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x23, 0x20, 0x25, 0x73, 0x2E, 0x0D, 0x1C, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x6E, 0x6F, 0x20, 0x25, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 
-    0x6F, 0x77, 0x73, 0x20, 0xD2, 0x25, 0x73, 0xD3, 0x10, 0xF0, 0x02, 0x03, 0x2D, 0x70, 0x2D, 0x73, 
-    0x2D, 0x64, 0x15, 0x2D, 0x73, 0x6C, 0x00, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x10, 0x4C, 0x70, 
-    0x75, 0x62, 0x6C, 0x69, 0x63, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x00, 0x25, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 
-    0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 
-    0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x00, 0x2D, 0x6F, 0x10, 0x40, 0x41, 0x49, 0x46, 
-    0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x00, 0xD2, 0x25, 0x73, 
-    0xD3, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 
-    0x6F, 0x6E, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 
-    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x1D, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x10, 0x28, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x68, 0x61, 0x6E, 
-    0x64, 0x6C, 0x65, 0x00, 0x23, 0x23, 0x23, 0x20, 0x25, 0x73, 0x3A, 0x20, 0x4F, 0x75, 0x63, 0x68, 
-    0x21, 0x0D, 0x10, 0x3A, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 
-    0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x3D, 
-    0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x10, 0x3C, 
-    0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 
-    0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 
-    0x78, 0x20, 0x21, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x10, 0x80, 0x82, 0x6C, 
-    0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 
-    0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 
-    0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
-    0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 
-    0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 
-    0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 
-    0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 
-    0x0D, 0x10, 0x40, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 
-    0x6F, 0x6E, 0x67, 0x20, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
-    0x3D, 0x20, 0x25, 0x6C, 0x64, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 
-    0x25, 0x73, 0x22, 0x10, 0x7E, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 
-    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 
-    0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 
-    0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 
-    0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 
-    0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 
-    0x25, 0x73, 0x22, 0x10, 0x80, 0xEC, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 
-    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 
-    0x74, 0x68, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x74, 0x72, 
-    0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 
-    0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 
-    0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 
-    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 
-    0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 
-    0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 
-    0x73, 0x22, 0x20, 0x36, 0x73, 0x00, 0x25, 0x6C, 0x75, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 
-    0x76, 0x65, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x25, 0x73, 0x2C, 0x20, 0x25, 0x6C, 
-    0x75, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x73, 0x0D, 0x00, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x1D, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
-    0x00, 0x25, 0x50, 0x20, 0x2A, 0x20, 0x26, 0x25, 0x30, 0x38, 0x78, 0x09, 0x3B, 0x20, 0x25, 0x73, 
-    0x2C, 0x20, 0x25, 0x73, 0x0D, 0x10, 0xF0, 0x1E, 0x02, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 
-    0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 
-    0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x10, 0x42, 0x25, 0x6C, 0x64, 0x20, 0x65, 0x78, 0x63, 0x65, 0x73, 
-    0x73, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 
-    0x77, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 
-    0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x1B, 0x25, 0x6C, 0x75, 0x20, 0x6C, 0x6F, 
-    0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x0D, 
-    0x10, 0x4A, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x70, 0x61, 0x73, 
-    0x74, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6C, 
-    0x6F, 0x77, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 
-    0x6E, 0x66, 0x6F, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x74, 
-    0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x10, 0x6A, 0x63, 0x61, 
-    0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 
-    0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 
-    0x74, 0x65, 0x6D, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x6C, 
-    0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x25, 0x64, 0x20, 0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x73, 
-    0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 0x10, 0x2C, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 
-    0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 
-    0x6C, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x80, 0xCC, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 
-    0x65, 0x61, 0x64, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x66, 0x72, 
-    0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x73, 0x65, 0x63, 
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x3A, 0x20, 0x20, 0x6C, 0x61, 0x6E, 0x67, 
-    0x75, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x2C, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 
-    0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x69, 
-    0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x64, 
-    0x65, 0x62, 0x75, 0x67, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 
-    0x6C, 0x78, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x25, 0x73, 0x22, 0x0D, 
-    0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x20, 0x25, 0x64, 0x20, 0x62, 
-    0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x34, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 0x6B, 0x69, 
-    0x70, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x66, 0x72, 0x6F, 
-    0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x3A, 0x75, 0x6E, 0x65, 
-    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x25, 0x64, 0x3A, 
-    0x20, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x20, 0x28, 0x65, 
-    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
-    0x69, 0x74, 0x65, 0x6D, 0x29, 0x20, 0x0D, 0x10, 0x2B, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x73, 
-    0x6B, 0x69, 0x70, 0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 
-    0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 
-    0x22, 0x25, 0x73, 0x22, 0x00, 0x01, 0x03, 0x73, 0x00, 0x40, 0x03, 0x73, 0x00, 0x25, 0x64, 0x20, 
-    0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 
-    0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x25, 0x73, 0x2C, 0x20, 0x25, 0x64, 0x20, 0x73, 0x6F, 
-    0x75, 0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x25, 0x73, 0x0D, 0x10, 0x3A, 0x75, 0x6E, 0x65, 
-    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 
-    0x66, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 
-    0x67, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x6E, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 
-    0x74, 0x65, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x6F, 
-    0x75, 0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 
-    0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x61, 
-    0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x6E, 
-    0x6F, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x70, 
-    0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x1B, 0x72, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x11, 0x25, 
-    0x73, 0x10, 0x30, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 
-    0x20, 0x73, 0x65, 0x65, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x69, 
-    0x6E, 0x66, 0x6F, 0x10, 0x81, 0x72, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 
-    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x68, 0x65, 0x61, 0x64, 
-    0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x25, 0x64, 0x00, 
-    0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 
-    0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x2C, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 
-    0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x32, 0x78, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 
-    0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
-    0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
-    0x65, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 
-    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 
-    0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 
-    0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 
-    0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 
-    0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 
-    0x62, 0x6F, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x80, 0xEC, 0x63, 0x61, 0x6E, 0xD5, 0x74, 
-    0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 
-    0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 0x6C, 
-    0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
-    0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 
-    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 
-    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
-    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 
-    0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 
-    0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 
-    0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 
-    0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0xF0, 0x1E, 0x02, 0x63, 0x61, 0x6E, 0xD5, 0x74, 
-    0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 
-    0x69, 0x6E, 0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x64, 
-    0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x1A, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6F, 0x70, 
-    0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x80, 0x90, 0x55, 
-    0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x41, 0x49, 
-    0x46, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x64, 
-    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 
-    0x62, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
-    0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 
-    0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 
-    0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 
-    0x72, 0x65, 0x61, 0x64, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x1D, 
-    0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
-    0x61, 0x74, 0x61, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x10, 0x2C, 0x55, 0x6E, 0x61, 0x62, 
-    0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 
-    0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x77, 0x72, 
-    0x69, 0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x10, 0x52, 0x55, 0x6E, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x74, 0x6F, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x41, 0x49, 0x46, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 
-    0x67, 0x00, 0x55, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 
-    0x65, 0x20, 0x41, 0x49, 0x46, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 
-    0x6E, 0x65, 0x77, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x10, 0x5A, 0x55, 0x6E, 
-    0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x72, 0x65, 
-    0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64, 
-    0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x20, 0x6E, 
-    0x65, 0x77, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x00, 0x55, 0x6E, 0x61, 0x62, 
-    0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 
-    0x69, 0x6F, 0x6E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x10, 0x80, 0x96, 0x55, 0x6E, 0x61, 0x62, 0x6C, 
-    0x65, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20, 
-    0x6E, 0x65, 0x77, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x00, 0x63, 0x61, 0x6E, 
-    0xD5, 0x74, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
-    0x61, 0x74, 0x61, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x6E, 0x65, 0x77, 0x20, 0x64, 
-    0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 
-    0x38, 0x6C, 0x78, 0x2C, 0x20, 0x25, 0x6C, 0x75, 0x20, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 
-    0x65, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2C, 0x20, 0x25, 0x6C, 0x75, 0x20, 
-    0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 
-    0x0D, 0x1D, 0x27, 0x2D, 0x6F, 0x27, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
-    0x6F, 0x75, 0x74, 0x20, 0x27, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x27, 0x10, 0x3C, 0x20, 0x63, 
-    0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x27, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x70, 0x27, 
-    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 
-    0x69, 0x6D, 0x65, 0x00, 0x72, 0x00, 0x63, 0x61, 0x6E, 0xD5, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x2E, 0x63, 0x61, 0x6E, 0xD5, 
-    0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0x4A, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 
-    0x65, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x41, 0x49, 0x46, 
-    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 
-    0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x65, 0x78, 0x65, 0x63, 
-    0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x10, 0x26, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x20, 0x69, 0x73, 0x20, 0x25, 0x73, 0x20, 0x25, 0x75, 0x2D, 0x62, 0x69, 0x74, 0x20, 0x6D, 
-    0x6F, 0x64, 0x65, 0x20, 0x41, 0x49, 0x46, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x0D, 0x10, 0x4E, 
-    0x72, 0x65, 0x61, 0x64, 0x2D, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
-    0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 
-    0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 
-    0x38, 0x6C, 0x78, 0x2C, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2D, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x73, 
-    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x0D, 0x10, 0x4C, 
-    0x72, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3D, 
-    0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x2C, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 
-    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x00, 
-    0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x62, 0x61, 0x73, 
-    0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x0D, 0x16, 0x73, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x05, 0x20, 0x61, 0x6E, 0x64, 0x20, 
-    0x00, 0x09, 0x03, 0x6C, 0x6F, 0x77, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x00, 0x80, 0xA2, 0x03, 
-    0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 
-    0x30, 0x38, 0x6C, 0x78, 0x3A, 0x20, 0x20, 0x25, 0x73, 0x25, 0x73, 0x25, 0x73, 0x20, 0x64, 0x65, 
-    0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
-    0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x0D, 0x00, 0x4E, 0x6F, 
-    0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 
-    0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 
-    0x74, 0x2E, 0x0D, 0x00, 0x30, 0x78, 0x25, 0x30, 0x38, 0x6C, 0x78, 0x20, 0x62, 0x79, 0x74, 0x65, 
-    0x73, 0x20, 0x6F, 0x66, 0x20, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 
-    0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 
-    0x2E, 0x0D, 0x18, 0xFF, 0xFF, 0xDB, 0xC4, 0xFF, 0xFF, 0xDB, 0xBA, 0xFF, 0xFF, 0xDB, 0xAE, 0xFF, 
-    0xFF, 0xDB, 0xA4, 0x00, 0x01, 0x28, 0x01, 0x00, 0x58, 0x13, 0x23, 0x20, 0x55, 0x73, 0x61, 0x67, 
-    0x65, 0x3A, 0x20, 0x20, 0x20, 0x25, 0x73, 0x20, 0x5B, 0x2D, 0x70, 0x5D, 0x20, 0x5B, 0x2D, 0x73, 
-    0x5D, 0x20, 0x5B, 0x2D, 0x64, 0x5D, 0x20, 0x5B, 0x2D, 0x73, 0x6C, 0x5D, 0x20, 0x5B, 0x2D, 0x73, 
-    0x74, 0x72, 0x69, 0x70, 0x20, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x45, 0x6E, 0x74, 0x72, 0x69, 
-    0x65, 0x73, 0x46, 0x69, 0x6C, 0x65, 0x5D, 0xC9, 0x20, 0x5B, 0x2D, 0x6F, 0x20, 0x41, 0x49, 0x46, 
-    0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x5D, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0xC9, 0x0D, 0x10, 0x40, 0x75, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 
-    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x6D, 0x65, 
-    0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x42, 0x75, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x00, 0x48, 0x61, 
-    0x73, 0x68, 0x2E, 0x63, 0x19, 0x23, 0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 
-    0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 0x0D, 0x10, 0x2A, 0xFF, 0xFF, 0xDB, 0xCE, 0xFF, 0xFF, 0xDC, 
-    0x16, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 
-    0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x20, 0x3D, 
-    0x20, 0x25, 0x64, 0x10, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x2E, 0x63, 0x00, 0x23, 0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 
-    0x50, 0x22, 0x29, 0x3B, 0x0D, 0x10, 0x44, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x73, 
-    0x70, 0x6F, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x25, 0x70, 
-    0x2C, 0x20, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x20, 0x25, 0x64, 0x00, 0x53, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x00, 0x23, 0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 
-    0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 0x0D, 0x10, 0x42, 0x6E, 0x6F, 0x20, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 
-    0x69, 0x6E, 0x67, 0x20, 0x62, 0x75, 0x74, 0x2C, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 
-    0x65, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x25, 0x6C, 
-    0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x10, 
-    0x20, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x00, 0x23, 
-    0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 
-    0x0D, 0x10, 0x22, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x25, 0x6C, 0x64, 0x2C, 0x20, 0x69, 
-    0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x73, 0x69, 
-    0x7A, 0x65, 0x20, 0x25, 0x64, 0x10, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x62, 
-    0x6C, 0x65, 0x2E, 0x63, 0x00, 0x23, 0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 
-    0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 0x0D, 0x10, 0x4C, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x67, 
-    0x72, 0x6F, 0x77, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x25, 0x70, 0x20, 0x74, 0x6F, 
-    0x20, 0x25, 0x6C, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x20, 
-    0x3D, 0x20, 0x25, 0x64, 0x00, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x2E, 0x63, 0x00, 0x23, 0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 
-    0x50, 0x22, 0x29, 0x3B, 0x0D, 0x10, 0x4A, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x25, 0x6C, 
-    0x64, 0x20, 0x2B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x61, 0x72, 
-    0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x25, 0x64, 
-    0x00, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x00, 0x23, 
-    0x23, 0x23, 0x20, 0x41, 0x53, 0x53, 0x45, 0x52, 0x54, 0x28, 0x22, 0x25, 0x50, 0x22, 0x29, 0x3B, 
-    0x0D, 0x10, 0x19, 0x25, 0x73, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 
-    0x73, 0x22, 0x2D, 0x2D, 0x20, 0x4C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x64, 0x00, 0x53, 0x83, 0xDB, 
-    0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 
-    0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 
-    0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x00, 0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 
-    0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 
-    0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 
-    0x65, 0x72, 0x73, 0x40, 0x03, 0x01, 0x53, 0x48, 0x20, 0x09, 0xFF, 0xFF, 0xF4, 0x96, 0xFF, 0xFF, 
-    0xF4, 0x9E, 0x81, 0x02, 0x07, 0xFF, 0xFF, 0xF4, 0xA2, 0x02, 0x81, 0x0E, 0x46, 0x53, 0x59, 0x53, 
-    0x10, 0xF0, 0x02, 0x04, 0x02, 0x22, 0x02, 0x2A, 0x02, 0x32, 0x02, 0x3A, 0x13, 0x02, 0x42, 0x43, 
-    0x4F, 0x4E, 0x53, 0x10, 0xF0, 0x02, 0x04, 0x02, 0x52, 0x02, 0x5A, 0x02, 0x62, 0x02, 0x6A, 0x13, 
-    0x02, 0x72, 0x53, 0x59, 0x53, 0x54, 0x10, 0xF0, 0x02, 0x05, 0x02, 0x82, 0x02, 0x8A, 0x02, 0x92, 
-    0x02, 0x9A, 0x02, 0xA2, 0x00, 0x01, 0x33, 0xBA, 0x00, 0xF0, 0x01, 0x0F, 0x03, 0xBA, 0xBA, 0xBA, 
-    0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0x10, 0xF0, 0x02, 0x11, 
-    0xFF, 0xFF, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 
-    0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 
-    0x02, 0x12, 0xC2, 0xFF, 0xFF, 0xDC, 0x5F, 0x02, 0x24, 0xFF, 0xFF, 0xF8, 0x82, 0x00, 0x01, 0x13, 
-    0x01, 0x00, 0x03, 0x15, 0x02, 0x00, 0x01, 0x00, 0x03, 0x13, 0x42, 0x00, 0x02, 0x08, 0x81, 0x82, 
-    0x4F, 0x53, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x00, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 
-    0x10, 0x46, 0x20, 0x00, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 
-    0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 
-    0x70, 0x74, 0x65, 0x64, 0x29, 0x00, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 
-    0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x61, 
-    0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x1C, 0x54, 0x6F, 0x6F, 0x20, 0x6D, 0x61, 0x6E, 
-    0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x29, 0x00, 0x20, 
-    0x28, 0x12, 0x29, 0x00, 0x20, 0x28, 0x10, 0xF0, 0x22, 0x02, 0x28, 0x45, 0x72, 0x72, 0x6F, 0x72, 
-    0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6E, 0x6F, 
-    0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x28, 0x45, 0x72, 0x72, 
-    0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 
-    0x6E, 0x6F, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x29, 0x08, 0x26, 
-    0xFF, 0xFF, 0xFB, 0xC8, 0xFF, 0xFF, 0xDD, 0x64, 0xFF, 0xFF, 0xDD, 0x62, 0xFF, 0xFF, 0xDD, 0x60, 
-    0x00, 0x11, 0x81, 0x01, 0x09, 0xFF, 0xFF, 0xFB, 0x96, 0xFF, 0xFF, 0xDD, 0x7E, 0xFF, 0xFF, 0xDD, 
-    0x72, 0xFF, 0xFF, 0xDD, 0x6C, 0x10, 0x00, 0x1B, 0x00, 0x04, 0x06, 0x0C, 0x00, 0x04, 0x06, 0x88, 
-    0x75, 0x02, 0x02, 0x02, 0x78, 0x02, 0x83, 0x16, 0x02, 0x06, 0x80, 0x8B, 0x00, 0x02, 0x04, 0x04, 
-    0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x04, 0x1A, 0x00, 0x02, 0x0F, 0x04, 0x00, 0x02, 0x0F, 0x0E, 
-    0x14, 0x81, 0x57, 0x02, 0x02, 0x02, 0x80, 0x83, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xB2, 0x6D, 0x70, 0x77, 0x64, 0x00, 0x00, 0x0A, 0x4E, 0x01, 0xA0, 0x00, 0x0B, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x01, 0x08, 0x70, 0xFF, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0xBA, 0x03, 0x10, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x42, 
-    0x30, 0x2E, 0x00, 0x0E, 0x52, 0x40, 0x38, 0x80, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x04, 0x2F, 0x0C, 0x48, 0x78, 0x64, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF8, 
-    0x4E, 0xBA, 0x07, 0xC6, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x06, 0x42, 0x54, 0x70, 0xFF, 
-    0x60, 0x10, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x06, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x04, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6F, 0x70, 0x65, 
-    0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x4A, 0xAE, 0x00, 0x08, 
-    0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x06, 0x22, 0x70, 0xFF, 
-    0x50, 0x4F, 0x60, 0x40, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0x88, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2C, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 
-    0x00, 0x08, 0x4E, 0x91, 0x2E, 0x00, 0x42, 0x54, 0x4A, 0x87, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 
-    0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x05, 0xE4, 0x70, 0xFF, 0x50, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 
-    0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 
-    0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 
-    0x4E, 0xBA, 0x05, 0xAC, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 
-    0x02, 0x12, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x01, 
-    0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0x80, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 
-    0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x05, 0x50, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 
-    0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0x14, 0x70, 0xFF, 0x50, 0x4F, 
-    0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x01, 0x7A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x02, 0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0xE8, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 
-    0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 
-    0x00, 0x10, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 
-    0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x04, 0xB8, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 
-    0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x77, 
-    0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 
-    0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0x78, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD2, 
-    0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0xDC, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0xBC, 0x20, 0x06, 0x04, 0x80, 0x00, 0x00, 0x66, 0x01, 0x67, 0x32, 
-    0x2F, 0x0B, 0x2F, 0x06, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0x94, 0x30, 0x2C, 
-    0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x04, 0x24, 0x70, 0xFF, 0x50, 0x4F, 
-    0x60, 0x7E, 0x20, 0x0B, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 
-    0x04, 0x0E, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x68, 0x70, 0xFF, 0x90, 0x8B, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x00, 0x6C, 0x26, 0x40, 0x20, 0x0B, 0x58, 0x4F, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x4C, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0x58, 0x28, 0x40, 0x20, 0x4B, 
-    0x22, 0x4C, 0x70, 0x04, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 
-    0x66, 0x01, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x16, 0x42, 0x53, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 
-    0x2F, 0x07, 0x4E, 0xBA, 0x03, 0xAA, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x69, 0x6F, 0x63, 0x74, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x4A, 0x6D, 
-    0xF4, 0x7C, 0x66, 0x04, 0x4E, 0xBA, 0x01, 0x2A, 0x30, 0x2D, 0xF4, 0x7C, 0x48, 0xC0, 0x81, 0xFC, 
-    0x00, 0x14, 0x48, 0xC0, 0x2E, 0x00, 0x53, 0x87, 0x4A, 0x93, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x20, 0x13, 0x60, 0x04, 0x70, 0xFF, 0x90, 0x93, 0xBE, 0x80, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x48, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xDA, 
-    0x4A, 0x93, 0x6D, 0x2E, 0x20, 0x6D, 0xF4, 0x7E, 0x20, 0x13, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 
-    0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x4A, 0x54, 0x66, 0x00, 0x00, 0xBC, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x18, 0x70, 0x00, 0x28, 0x40, 0x50, 0x4F, 0x60, 0x00, 
-    0x00, 0xA6, 0x70, 0xFF, 0x90, 0x93, 0x20, 0x6D, 0xF4, 0x7E, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 
-    0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x60, 0x08, 0x4A, 0x54, 0x67, 0x18, 0x49, 0xEC, 0x00, 0x14, 
-    0x20, 0x6D, 0xF4, 0x7E, 0x20, 0x07, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0xD1, 0xC0, 
-    0xB1, 0xCC, 0x64, 0xE4, 0x20, 0x6D, 0xF4, 0x7E, 0x20, 0x07, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 
-    0xD0, 0x81, 0xD1, 0xC0, 0xB1, 0xCC, 0x64, 0x4E, 0x30, 0x2D, 0xF4, 0x7C, 0x48, 0xC0, 0xD0, 0xBC, 
-    0x00, 0x00, 0x01, 0x90, 0x2F, 0x00, 0x2F, 0x2D, 0xF4, 0x7E, 0x4E, 0xBA, 0x03, 0x3C, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x18, 0x2F, 0x01, 0x4E, 0xBA, 
-    0x02, 0x9E, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x30, 0x20, 0x07, 0x52, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 
-    0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x06, 0x6D, 0x01, 0x90, 
-    0xF4, 0x7C, 0x2B, 0x48, 0xF4, 0x7E, 0x20, 0x6D, 0xF4, 0x7E, 0x20, 0x0C, 0x90, 0x88, 0x72, 0x14, 
-    0x4E, 0xAD, 0x00, 0x9A, 0x26, 0x80, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xEC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8A, 0x5F, 0x67, 0x65, 0x74, 0x49, 0x4F, 0x50, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x3B, 0x7C, 0x01, 0x90, 0xF4, 0x7C, 0x48, 0x78, 0x01, 0x90, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x02, 0xC2, 0x2B, 0x40, 0xF4, 0x7E, 0x4A, 0xAD, 0xF4, 0x86, 
-    0x50, 0x4F, 0x67, 0x46, 0x22, 0x6D, 0xF4, 0x86, 0x20, 0x69, 0x00, 0x1C, 0x22, 0x6D, 0xF4, 0x7E, 
-    0x70, 0x3C, 0xA0, 0x2E, 0x20, 0x6D, 0xF4, 0x7E, 0x49, 0xD0, 0x60, 0x20, 0x4A, 0x54, 0x67, 0x18, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x01, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 
-    0x00, 0x14, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x0C, 0x49, 0xEC, 0x00, 0x14, 0x20, 0x6D, 0xF4, 0x7E, 
-    0x41, 0xE8, 0x00, 0x28, 0xB1, 0xCC, 0x64, 0xD4, 0x60, 0x28, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x7A, 
-    0x00, 0x54, 0x4E, 0xBA, 0xFB, 0x2A, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x48, 0x4E, 0xBA, 
-    0xFB, 0x1E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x3C, 0x4E, 0xBA, 0xFB, 0x12, 0x4F, 0xEF, 
-    0x00, 0x18, 0x41, 0xED, 0x01, 0xF2, 0x22, 0x6D, 0xF4, 0x78, 0x23, 0x48, 0x00, 0x04, 0x4A, 0xAD, 
-    0xF4, 0x74, 0x66, 0x08, 0x41, 0xED, 0xF6, 0x42, 0x2B, 0x48, 0xF4, 0x74, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x49, 0x4F, 0x50, 0x74, 0x61, 0x62, 
-    0x6C, 0x65, 0x00, 0x0C, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 0x30, 0x2D, 0xF4, 0x7C, 0x48, 0xC0, 0x81, 0xFC, 
-    0x00, 0x14, 0x48, 0xC0, 0x2C, 0x00, 0x53, 0x86, 0x7E, 0x00, 0x60, 0x0A, 0x2F, 0x07, 0x4E, 0xBA, 
-    0xFB, 0x24, 0x58, 0x4F, 0x52, 0x87, 0xBC, 0x87, 0x6C, 0xF2, 0x4A, 0xAD, 0xF4, 0x5E, 0x67, 0x04, 
-    0x4E, 0xAD, 0x02, 0x7A, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 
-    0x63, 0x6F, 0x72, 0x65, 0x49, 0x4F, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x07, 0x7E, 0x00, 0x30, 0x2E, 0x00, 0x0A, 0x04, 0x40, 0xFF, 0x88, 0x67, 0x00, 0x01, 0x08, 
-    0x04, 0x40, 0x00, 0x0C, 0x67, 0x00, 0x00, 0xC4, 0x04, 0x40, 0x00, 0x2F, 0x67, 0x00, 0x00, 0xF0, 
-    0x53, 0x40, 0x67, 0x00, 0x00, 0x86, 0x53, 0x40, 0x67, 0x00, 0x00, 0xA8, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0x8E, 0x53, 0x40, 0x67, 0x00, 0x00, 0xAC, 0x53, 0x40, 0x67, 0x00, 0x00, 0xA2, 0x53, 0x40, 
-    0x67, 0x00, 0x00, 0xC4, 0x53, 0x40, 0x67, 0x00, 0x00, 0xAA, 0x53, 0x40, 0x67, 0x00, 0x00, 0xB4, 
-    0x55, 0x40, 0x67, 0x00, 0x00, 0xA6, 0x53, 0x40, 0x67, 0x00, 0x00, 0x94, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0x8A, 0x53, 0x40, 0x67, 0x50, 0x53, 0x40, 0x67, 0x58, 0x53, 0x40, 0x67, 0x00, 0x00, 0x9C, 
-    0x53, 0x40, 0x67, 0x52, 0x53, 0x40, 0x67, 0x00, 0x00, 0x9A, 0x53, 0x40, 0x67, 0x4C, 0x53, 0x40, 
-    0x67, 0x7C, 0x55, 0x40, 0x67, 0x70, 0x53, 0x40, 0x67, 0x30, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 
-    0x67, 0x1C, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 0x67, 0x4C, 0x53, 0x40, 0x67, 0x14, 0x53, 0x40, 
-    0x67, 0x10, 0x04, 0x40, 0x00, 0x21, 0x67, 0x70, 0x60, 0x6E, 0x7E, 0x14, 0x60, 0x6A, 0x7E, 0x0E, 
-    0x60, 0x66, 0x7E, 0x1C, 0x60, 0x62, 0x7E, 0x11, 0x60, 0x5E, 0x7E, 0x06, 0x60, 0x5A, 0x7E, 0x14, 
-    0x60, 0x56, 0x7E, 0x1F, 0x60, 0x52, 0x7E, 0x10, 0x60, 0x4E, 0x7E, 0x02, 0x60, 0x4A, 0x7E, 0x09, 
-    0x60, 0x46, 0x7E, 0x04, 0x60, 0x42, 0x7E, 0x05, 0x60, 0x3E, 0x7E, 0x0C, 0x60, 0x3A, 0x7E, 0x06, 
-    0x60, 0x36, 0x7E, 0x14, 0x60, 0x32, 0x7E, 0x06, 0x60, 0x2E, 0x7E, 0x1A, 0x60, 0x2A, 0x7E, 0x16, 
-    0x60, 0x26, 0x7E, 0x0D, 0x60, 0x22, 0x7E, 0x1D, 0x60, 0x1E, 0x7E, 0x09, 0x60, 0x1A, 0x7E, 0x17, 
-    0x60, 0x16, 0x7E, 0x06, 0x60, 0x12, 0x7E, 0x10, 0x60, 0x0E, 0x7E, 0x1E, 0x60, 0x0A, 0x7E, 0x0D, 
-    0x60, 0x06, 0x7E, 0x1E, 0x60, 0x02, 0x7E, 0x14, 0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x89, 0x5F, 0x6D, 0x61, 0x70, 0x4F, 0x53, 0x65, 0x72, 0x72, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x3E, 0x2E, 0x00, 0x0E, 0x3B, 0x47, 0xF5, 0x84, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0x00, 0x08, 0x60, 0x0C, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 
-    0xFE, 0xAC, 0x4A, 0x80, 0x58, 0x4F, 0x2B, 0x40, 0xF5, 0x86, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x75, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x11, 0x00, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xF8, 0x2D, 0x6E, 0x00, 0x0C, 
-    0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xF8, 0x48, 0x78, 0x66, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xFB, 0x06, 0x2E, 0x00, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0xFF, 0xFC, 0x60, 0x02, 
-    0x70, 0xFF, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x85, 0x6C, 0x73, 0x65, 0x65, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x07, 0x18, 
-    0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x20, 0x0C, 0x67, 0x18, 0x59, 0x8F, 
-    0x2F, 0x0C, 0x4E, 0xAD, 0x00, 0xCA, 0x2E, 0x1F, 0xBE, 0x86, 0x6F, 0x0A, 0x20, 0x4C, 0x20, 0x06, 
-    0xA0, 0x20, 0x20, 0x0C, 0x60, 0x3C, 0x20, 0x06, 0xA1, 0x1E, 0x2D, 0x48, 0xFF, 0xFC, 0x4A, 0x78, 
-    0x02, 0x20, 0x67, 0x04, 0x70, 0x00, 0x60, 0x2A, 0x20, 0x0C, 0x67, 0x0E, 0x20, 0x4C, 0x22, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x07, 0xA0, 0x2E, 0x20, 0x4C, 0xA0, 0x1F, 0x2A, 0x2E, 0xFF, 0xFC, 0x28, 0x45, 
-    0xD9, 0xC7, 0x26, 0x45, 0xD7, 0xC6, 0x60, 0x02, 0x42, 0x1C, 0xB7, 0xCC, 0x62, 0xFA, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x67, 
-    0x72, 0x6F, 0x77, 0x46, 0x69, 0x6C, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 
-    0x00, 0x08, 0x2D, 0x4C, 0xFF, 0xFC, 0x60, 0x0E, 0x18, 0x9B, 0x4A, 0x1C, 0x66, 0x08, 0x60, 0x02, 
-    0x42, 0x1C, 0x53, 0x87, 0x6C, 0xFA, 0x53, 0x87, 0x6C, 0xEE, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 
-    0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x6C, 0x69, 0x62, 0x5F, 0x43, 0x73, 
-    0x74, 0x72, 0x6E, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 
-    0x2C, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x4A, 0xAD, 0xF4, 0x82, 0x66, 0x08, 0x41, 0xED, 
-    0xF5, 0x8A, 0x2B, 0x48, 0xF4, 0x82, 0x20, 0x6D, 0xF4, 0x82, 0x49, 0xD0, 0x60, 0x0A, 0x4A, 0xAC, 
-    0x00, 0x04, 0x67, 0x10, 0x49, 0xEC, 0x00, 0x18, 0x20, 0x6D, 0xF4, 0x82, 0x41, 0xE8, 0x00, 0x78, 
-    0xB1, 0xCC, 0x62, 0xEA, 0x2E, 0x3C, 0x40, 0x00, 0x00, 0x06, 0x60, 0x16, 0x2F, 0x2E, 0x00, 0x14, 
-    0x2F, 0x06, 0x2F, 0x0B, 0x20, 0x6C, 0x00, 0x04, 0x4E, 0x90, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x6C, 0x0C, 0x49, 0xEC, 0xFF, 0xE8, 0x20, 0x6D, 0xF4, 0x82, 0xB1, 0xCC, 0x63, 0xDE, 0x4A, 0xAE, 
-    0x00, 0x08, 0x67, 0x0E, 0x20, 0x6D, 0xF4, 0x82, 0xB1, 0xCC, 0x62, 0x06, 0x20, 0x6E, 0x00, 0x08, 
-    0x20, 0x8C, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x87, 0x66, 0x04, 0x20, 0x07, 0x60, 0x1E, 
-    0x3C, 0x07, 0x6C, 0x04, 0x7E, 0x00, 0x60, 0x08, 0x02, 0x87, 0xBF, 0xFF, 0xFF, 0xFF, 0x42, 0x46, 
-    0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x07, 0x4E, 0xBA, 0xFE, 0x06, 0x70, 0xFF, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x61, 0x63, 0x63, 0x65, 0x73, 
-    0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x17, 0x18, 0x28, 0x6E, 0x00, 0x0C, 
-    0x2A, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xF4, 0x74, 0x66, 0x08, 0x41, 0xED, 0xF6, 0x42, 0x2B, 0x48, 
-    0xF4, 0x74, 0x7E, 0x00, 0x2C, 0x05, 0x60, 0x16, 0x70, 0x10, 0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x16, 
-    0x2B, 0x40, 0xF5, 0x86, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xB6, 0x52, 0x87, 0xE2, 0x86, 0x70, 0x01, 
-    0xC0, 0x86, 0x67, 0xE4, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xF6, 0x02, 0x47, 0xF0, 0x00, 0x00, 
-    0x20, 0x6D, 0xF4, 0x74, 0x70, 0x00, 0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 0xC2, 0x80, 0x66, 0x08, 
-    0x70, 0x03, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x16, 0x41, 0xED, 0x00, 0xBA, 0xB1, 0xD3, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 0x20, 0x13, 0x2D, 0x40, 0xFF, 0xFC, 0xB9, 0xFC, 
-    0x00, 0x00, 0x00, 0x03, 0x66, 0x0E, 0x20, 0x6D, 0xF4, 0x74, 0x20, 0x05, 0x46, 0x80, 0xC1, 0x68, 
-    0x00, 0x02, 0x60, 0x56, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x66, 0x36, 0x20, 0x6D, 0xF4, 0x74, 
-    0x8B, 0x68, 0x00, 0x02, 0x70, 0x02, 0xB0, 0x85, 0x66, 0x10, 0x20, 0x6D, 0xF4, 0x74, 0x70, 0x00, 
-    0x30, 0x10, 0x22, 0x05, 0xC2, 0x80, 0x66, 0xF2, 0x60, 0x30, 0x20, 0x6D, 0xF4, 0x74, 0x4A, 0x50, 
-    0x67, 0x28, 0x20, 0x05, 0x46, 0x80, 0xC1, 0x50, 0x2F, 0x05, 0x4E, 0xBA, 0x00, 0x36, 0x58, 0x4F, 
-    0x60, 0x18, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x41, 0xED, 
-    0x00, 0xBA, 0x20, 0x08, 0x60, 0x02, 0x20, 0x0C, 0x26, 0x80, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 
-    0x18, 0xE8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x08, 0x2A, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 
-    0xF4, 0x74, 0x66, 0x08, 0x41, 0xED, 0xF6, 0x42, 0x2B, 0x48, 0xF4, 0x74, 0x7E, 0x00, 0x2C, 0x05, 
-    0x60, 0x0E, 0x70, 0x10, 0xB0, 0x87, 0x6E, 0x04, 0x70, 0xFF, 0x60, 0x4A, 0x52, 0x87, 0xE2, 0x86, 
-    0x70, 0x01, 0xC0, 0x86, 0x67, 0xEC, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xF6, 0x02, 0x28, 0x70, 
-    0x00, 0x00, 0x20, 0x0C, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2C, 0x20, 0x6D, 0xF4, 0x74, 0x70, 0x00, 
-    0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 0xC2, 0x80, 0x66, 0x06, 0x8B, 0x50, 0x70, 0xFF, 0x60, 0x16, 
-    0x70, 0x01, 0x2F, 0x00, 0x2F, 0x05, 0x4E, 0xBA, 0xFE, 0x9C, 0x2F, 0x05, 0x20, 0x4C, 0x4E, 0x90, 
-    0x70, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xE0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x85, 0x72, 0x61, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x17, 0xBC, 0x01, 0xF8, 0x00, 0x12, 
-    0x4E, 0x56, 0xFF, 0x94, 0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x10, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xA0, 0x3D, 0x53, 0xFF, 0xAA, 0x42, 0x6E, 0xFF, 0xB0, 0x2D, 0x6B, 
-    0x00, 0x02, 0xFF, 0xC4, 0x20, 0x4B, 0x5C, 0x88, 0x2D, 0x48, 0xFF, 0xA6, 0x55, 0x8F, 0x48, 0x6E, 
-    0xFF, 0x94, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x01, 0x3A, 0x3E, 0x1F, 0x70, 0x10, 0xC0, 0x2E, 
-    0xFF, 0xB2, 0x72, 0x00, 0x12, 0x00, 0x4A, 0x81, 0x56, 0xC3, 0x44, 0x03, 0x18, 0x83, 0x67, 0x08, 
-    0x20, 0x6E, 0x00, 0x14, 0x42, 0x10, 0x60, 0x18, 0x30, 0x3C, 0x80, 0x00, 0xC0, 0x6E, 0xFF, 0xBC, 
-    0x72, 0x00, 0x32, 0x00, 0x4A, 0x81, 0x56, 0xC3, 0x44, 0x03, 0x20, 0x6E, 0x00, 0x14, 0x10, 0x83, 
-    0x4A, 0x2E, 0x00, 0x0F, 0x67, 0x00, 0x00, 0x9C, 0x20, 0x6E, 0x00, 0x14, 0x4A, 0x10, 0x67, 0x00, 
-    0x00, 0x92, 0x20, 0x2E, 0xFF, 0xB4, 0x04, 0x80, 0x64, 0x72, 0x6F, 0x70, 0x67, 0x7C, 0x04, 0x80, 
-    0x01, 0xEE, 0xF1, 0xFD, 0x67, 0x74, 0x04, 0x80, 0x00, 0x00, 0x02, 0x07, 0x67, 0x6C, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0xFE, 0x67, 0x64, 0x04, 0x80, 0x00, 0x00, 0x01, 0x02, 0x67, 0x5C, 0x59, 0x80, 
-    0x67, 0x58, 0x04, 0x80, 0x00, 0x00, 0x07, 0xF6, 0x67, 0x50, 0x04, 0x80, 0x00, 0x00, 0x02, 0xF8, 
-    0x67, 0x48, 0x51, 0x80, 0x67, 0x44, 0x04, 0x80, 0x00, 0x00, 0x02, 0xFA, 0x67, 0x3C, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x0C, 0x67, 0x34, 0x5B, 0x80, 0x67, 0x30, 0x04, 0x80, 0x00, 0x02, 0xFE, 0xF7, 
-    0x67, 0x28, 0x04, 0x80, 0x00, 0x07, 0xF2, 0x02, 0x67, 0x20, 0x04, 0x80, 0x00, 0x00, 0x0C, 0x07, 
-    0x67, 0x18, 0x04, 0x80, 0x01, 0xF8, 0x02, 0xF2, 0x67, 0x10, 0x04, 0x80, 0x0B, 0x0E, 0x03, 0x07, 
-    0x67, 0x08, 0x04, 0x80, 0x00, 0xFF, 0xFC, 0xF6, 0x66, 0x06, 0x18, 0xBC, 0x00, 0x01, 0x60, 0x02, 
-    0x42, 0x14, 0x30, 0x07, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0x84, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 
-    0x47, 0x65, 0x74, 0x41, 0x6C, 0x69, 0x61, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xBA, 0x48, 0xE7, 0x17, 0x18, 0x1A, 0x2E, 0x00, 0x17, 0x1C, 0x2E, 0x00, 0x1B, 0x26, 0x6E, 
-    0x00, 0x28, 0x28, 0x6E, 0x00, 0x1C, 0x55, 0x8F, 0x3F, 0x2E, 0x00, 0x0A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0C, 0x30, 0x3C, 0x00, 0x01, 0xAA, 0x52, 0x3E, 0x1F, 0x67, 0x0C, 
-    0x0C, 0x47, 0xFF, 0xD5, 0x67, 0x06, 0x30, 0x07, 0x60, 0x00, 0x00, 0xBC, 0x4A, 0x05, 0x66, 0x1C, 
-    0x4A, 0x06, 0x67, 0x18, 0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x20, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFE, 0x7E, 0x3E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x54, 0x41, 0xEE, 0xFF, 0xBA, 
-    0x22, 0x4C, 0x70, 0x10, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x55, 0x8F, 0x2F, 0x0C, 
-    0x70, 0x01, 0x1F, 0x00, 0x2F, 0x2E, 0x00, 0x20, 0x2F, 0x0B, 0x70, 0x0C, 0xA8, 0x23, 0x3E, 0x1F, 
-    0x4A, 0x13, 0x67, 0x2C, 0x0C, 0x47, 0xFF, 0xD5, 0x66, 0x26, 0x30, 0x2E, 0xFF, 0xBA, 0xB0, 0x54, 
-    0x66, 0x1E, 0x20, 0x2E, 0xFF, 0xBC, 0xB0, 0xAC, 0x00, 0x02, 0x66, 0x14, 0x55, 0x8F, 0x48, 0x6E, 
-    0xFF, 0xC0, 0x48, 0x6C, 0x00, 0x06, 0x4E, 0xAD, 0x01, 0x9A, 0x4A, 0x5F, 0x66, 0x02, 0x7E, 0xF7, 
-    0x4A, 0x47, 0x67, 0x0A, 0x0C, 0x47, 0xFF, 0xD5, 0x67, 0x04, 0x30, 0x07, 0x60, 0x38, 0x0C, 0x47, 
-    0xFF, 0xD5, 0x66, 0x08, 0x4A, 0x06, 0x66, 0x04, 0x70, 0x88, 0x60, 0x2A, 0x4A, 0x05, 0x66, 0x0E, 
-    0x4A, 0x06, 0x67, 0x0A, 0x4A, 0x13, 0x67, 0x06, 0x20, 0x6E, 0x00, 0x20, 0x42, 0x10, 0x76, 0x01, 
-    0x20, 0x6E, 0x00, 0x24, 0x4A, 0x10, 0x66, 0x06, 0x4A, 0x13, 0x66, 0x02, 0x76, 0x00, 0x20, 0x6E, 
-    0x00, 0x24, 0x10, 0x83, 0x30, 0x07, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xA2, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x5F, 0x52, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x6C, 0x69, 
-    0x61, 0x73, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x6E, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x2E, 0x00, 0x0C, 
-    0x3A, 0x2E, 0x00, 0x0A, 0x20, 0x6E, 0x00, 0x10, 0x1D, 0x50, 0xFF, 0x79, 0x28, 0x48, 0x41, 0xEE, 
-    0xFF, 0x7A, 0x2D, 0x48, 0xFF, 0xFC, 0x42, 0x10, 0x20, 0x6E, 0x00, 0x20, 0x42, 0x10, 0x42, 0x06, 
-    0x60, 0x00, 0x01, 0xFE, 0x26, 0x4C, 0x52, 0x4B, 0x60, 0x02, 0x52, 0x4B, 0x10, 0x14, 0x48, 0x80, 
-    0x48, 0xC0, 0xD0, 0x8C, 0xB0, 0x8B, 0x63, 0x06, 0x70, 0x3A, 0xB0, 0x13, 0x67, 0xEC, 0x53, 0x4B, 
-    0xB9, 0xCB, 0x67, 0x10, 0x1D, 0x53, 0xFF, 0x77, 0x20, 0x0B, 0x22, 0x0C, 0x90, 0x41, 0x12, 0x14, 
-    0x92, 0x00, 0x16, 0x81, 0x70, 0x01, 0xB0, 0x13, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 
-    0x60, 0x1C, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x70, 0x3A, 0x2F, 0x00, 0x22, 0x0B, 
-    0x52, 0x81, 0x2F, 0x01, 0x4E, 0xBA, 0x02, 0xDA, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x2D, 0x40, 
-    0xFF, 0x72, 0xB9, 0xCB, 0x67, 0x06, 0x16, 0xAE, 0xFF, 0x77, 0x60, 0x48, 0x70, 0x00, 0x10, 0x06, 
-    0x4A, 0x80, 0x66, 0x40, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0x79, 0xD0, 0xAE, 0x00, 0x10, 0xB0, 0xAE, 
-    0xFF, 0x72, 0x66, 0x30, 0x55, 0x8F, 0x3F, 0x05, 0x2F, 0x04, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x18, 
-    0x30, 0x3C, 0x00, 0x01, 0xAA, 0x52, 0x3E, 0x1F, 0x57, 0xC3, 0x44, 0x03, 0x20, 0x6E, 0x00, 0x1C, 
-    0x10, 0x83, 0x20, 0x6E, 0x00, 0x24, 0x42, 0x10, 0x20, 0x6E, 0x00, 0x20, 0x42, 0x10, 0x30, 0x07, 
-    0x60, 0x00, 0x01, 0x70, 0x4A, 0xAE, 0xFF, 0x72, 0x67, 0x24, 0x1D, 0x54, 0xFF, 0x78, 0x20, 0x0C, 
-    0x32, 0x2E, 0xFF, 0x74, 0x92, 0x40, 0x53, 0x01, 0x18, 0x81, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0x78, 
-    0x12, 0x14, 0x48, 0x81, 0x90, 0x41, 0x53, 0x00, 0x20, 0x6E, 0xFF, 0x72, 0x10, 0x80, 0x70, 0x00, 
-    0x10, 0x06, 0x4A, 0x80, 0x66, 0x40, 0xB9, 0xCB, 0x66, 0x3C, 0x4A, 0xAE, 0xFF, 0x72, 0x67, 0x36, 
-    0x10, 0x14, 0x48, 0x80, 0x52, 0x40, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x0C, 0x48, 0x6E, 0xFF, 0x7A, 
-    0x4E, 0xBA, 0x02, 0x64, 0x10, 0x2E, 0xFF, 0x7A, 0x52, 0x2E, 0xFF, 0x7A, 0x41, 0xEE, 0xFF, 0x7A, 
-    0x10, 0x2E, 0xFF, 0x7A, 0x48, 0x80, 0x48, 0xC0, 0xD0, 0x88, 0x20, 0x40, 0x10, 0xBC, 0x00, 0x3A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x32, 0x10, 0x14, 0x48, 0x80, 0x52, 0x40, 0x48, 0xC0, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xBA, 0x02, 0x2E, 0x41, 0xEE, 0xFF, 0x7A, 0xB1, 0xEE, 
-    0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x10, 0x20, 0x6E, 0xFF, 0xFC, 0x10, 0x10, 0x52, 0x00, 
-    0xD1, 0x2E, 0xFF, 0x7A, 0x10, 0xBC, 0x00, 0x3A, 0x2F, 0x2E, 0x00, 0x24, 0x2F, 0x2E, 0x00, 0x20, 
-    0x2F, 0x2E, 0x00, 0x1C, 0x2F, 0x2E, 0x00, 0x18, 0x4A, 0xAE, 0xFF, 0x72, 0x57, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x2F, 0x03, 0x70, 0x00, 0x10, 0x2E, 0x00, 0x17, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x7A, 0x2F, 0x04, 0x48, 0xC5, 0x2F, 0x05, 0x4E, 0xBA, 0xFD, 0x34, 0x3E, 0x00, 0x18, 0xBC, 
-    0x00, 0x3A, 0x4A, 0x47, 0x4F, 0xEF, 0x00, 0x24, 0x67, 0x06, 0x0C, 0x47, 0xFF, 0xD5, 0x66, 0x66, 
-    0x28, 0x6E, 0xFF, 0x72, 0x20, 0x0C, 0x67, 0x54, 0x20, 0x6E, 0x00, 0x18, 0x3A, 0x10, 0x28, 0x28, 
-    0x00, 0x02, 0x70, 0x00, 0x10, 0x28, 0x00, 0x06, 0x52, 0x40, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x68, 
-    0x00, 0x06, 0x41, 0xEE, 0xFF, 0x7A, 0x52, 0x48, 0x2F, 0x08, 0x4E, 0xBA, 0x01, 0x9A, 0x41, 0xEE, 
-    0xFF, 0x7A, 0x52, 0x48, 0x2D, 0x48, 0xFF, 0x6E, 0x10, 0x10, 0x52, 0x00, 0x1D, 0x40, 0xFF, 0x7A, 
-    0x10, 0xBC, 0x00, 0x3A, 0x41, 0xEE, 0xFF, 0x7A, 0x10, 0x2E, 0xFF, 0x7A, 0x48, 0x80, 0x48, 0xC0, 
-    0xD0, 0x88, 0x52, 0x80, 0x2D, 0x40, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x0C, 0x10, 0x06, 0x52, 0x06, 
-    0x20, 0x0C, 0x66, 0x00, 0xFE, 0x00, 0x4A, 0x47, 0x67, 0x0E, 0x4A, 0xAE, 0xFF, 0x72, 0x67, 0x08, 
-    0x20, 0x6E, 0xFF, 0x72, 0x10, 0xBC, 0x00, 0x3A, 0x20, 0x6E, 0x00, 0x10, 0x10, 0xAE, 0xFF, 0x79, 
-    0x30, 0x07, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x52, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x52, 0x65, 0x73, 
-    0x6F, 0x6C, 0x76, 0x65, 0x46, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x41, 0x6C, 0x69, 0x61, 0x73, 0x65, 
-    0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xBA, 0x48, 0xE7, 0x07, 0x18, 0x2A, 0x2E, 0x00, 0x0C, 
-    0x3C, 0x2E, 0x00, 0x0A, 0x26, 0x6E, 0x00, 0x20, 0x28, 0x6E, 0x00, 0x14, 0x55, 0x8F, 0x3F, 0x06, 
-    0x2F, 0x05, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0C, 0x30, 0x3C, 0x00, 0x01, 0xAA, 0x52, 0x3E, 0x1F, 
-    0x30, 0x07, 0x04, 0x40, 0xFF, 0xD5, 0x67, 0x62, 0x04, 0x40, 0x00, 0x2B, 0x66, 0x6C, 0x41, 0xEE, 
-    0xFF, 0xBA, 0x22, 0x4C, 0x70, 0x10, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x55, 0x8F, 
-    0x2F, 0x0C, 0x70, 0x01, 0x1F, 0x00, 0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x0B, 0x70, 0x0C, 0xA8, 0x23, 
-    0x3E, 0x1F, 0x4A, 0x13, 0x67, 0x2C, 0x0C, 0x47, 0xFF, 0xD5, 0x66, 0x26, 0x30, 0x2E, 0xFF, 0xBA, 
-    0xB0, 0x54, 0x66, 0x1E, 0x20, 0x2E, 0xFF, 0xBC, 0xB0, 0xAC, 0x00, 0x02, 0x66, 0x14, 0x55, 0x8F, 
-    0x48, 0x6E, 0xFF, 0xC0, 0x48, 0x6C, 0x00, 0x06, 0x4E, 0xAD, 0x01, 0x9A, 0x4A, 0x5F, 0x66, 0x02, 
-    0x7E, 0xF7, 0x20, 0x6E, 0x00, 0x1C, 0x10, 0x93, 0x60, 0x34, 0x42, 0x13, 0x20, 0x6E, 0x00, 0x1C, 
-    0x42, 0x10, 0x20, 0x6E, 0x00, 0x18, 0x42, 0x10, 0x60, 0x24, 0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x1C, 
-    0x2F, 0x2E, 0x00, 0x18, 0x2F, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x05, 
-    0x48, 0xC6, 0x2F, 0x06, 0x4E, 0xBA, 0xFC, 0xCE, 0x3E, 0x00, 0x4F, 0xEF, 0x00, 0x20, 0x30, 0x07, 
-    0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xA6, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x4D, 0x61, 0x6B, 0x65, 0x52, 
-    0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x46, 0x53, 0x53, 0x70, 0x65, 0x63, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x10, 0x2F, 0x00, 0x0B, 0x22, 0x2F, 0x00, 0x0C, 0x44, 0xFC, 0x00, 0x00, 
-    0x60, 0x04, 0x48, 0x41, 0xB0, 0x18, 0x57, 0xC9, 0xFF, 0xFC, 0x67, 0x0A, 0x48, 0x41, 0x51, 0xC9, 
-    0xFF, 0xF2, 0x30, 0x7C, 0x00, 0x01, 0x20, 0x08, 0x53, 0x80, 0x4E, 0x75, 0x87, 0x5F, 0x6D, 0x65, 
-    0x6D, 0x63, 0x68, 0x72, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x2F, 0x02, 
-    0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 0xB1, 0x02, 
-    0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 0x24, 0x01, 
-    0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 0x64, 0xF4, 
-    0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 0x24, 0x1F, 
-    0x4E, 0x75, 0x87, 0x5F, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4E, 0x56, 0xFE, 0x00, 
-    0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x49, 0xEE, 0xFE, 0x00, 0x20, 0x0B, 0x67, 0x04, 
-    0x4A, 0x13, 0x66, 0x0A, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x16, 0x60, 0x00, 0x00, 0x9A, 0x48, 0x78, 
-    0x00, 0xFF, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0x02, 0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xAD, 
-    0x01, 0x8A, 0x20, 0x2E, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x64, 0x00, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x10, 0x53, 0x80, 0x67, 0x1A, 0x53, 0x80, 0x67, 0x26, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x16, 
-    0x60, 0x64, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x10, 0x4E, 0xBA, 0x00, 0x74, 0x50, 0x4F, 0x60, 0x56, 
-    0x55, 0x8F, 0x2F, 0x0C, 0x70, 0x00, 0x3F, 0x00, 0x4E, 0xAD, 0x01, 0x0A, 0x3E, 0x1F, 0x60, 0x30, 
-    0x48, 0x78, 0x00, 0xFF, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xAD, 0x02, 0x02, 
-    0x59, 0x8F, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xAD, 0x01, 0x8A, 0x55, 0x8F, 0x2F, 0x0C, 0x70, 0x00, 
-    0x3F, 0x00, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xAD, 0x01, 0x12, 0x3E, 0x1F, 0x4F, 0xEF, 0x00, 0x10, 
-    0x4A, 0x47, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 0x60, 0x0A, 0x70, 0x00, 0x30, 0x07, 
-    0x80, 0xBC, 0x40, 0x00, 0x00, 0x00, 0x4C, 0xEE, 0x18, 0x88, 0xFD, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8A, 0x5F, 0x66, 0x73, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFE, 0xE4, 0x48, 0xE7, 0x0F, 0x38, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x14, 
-    0x48, 0xC0, 0x2C, 0x00, 0x7A, 0x00, 0x70, 0x20, 0xC0, 0x86, 0x67, 0x1C, 0x42, 0x04, 0x20, 0x3C, 
-    0x00, 0x00, 0x25, 0x00, 0xC0, 0x86, 0x67, 0x12, 0x2A, 0x3C, 0x40, 0x00, 0x00, 0x16, 0x20, 0x3C, 
-    0x40, 0x00, 0x00, 0x16, 0x60, 0x00, 0x04, 0x28, 0x78, 0x01, 0x55, 0x8F, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFE, 0xE8, 0x48, 0x6E, 0xFE, 0xE4, 0x4E, 0xAD, 0x01, 0x5A, 0x20, 0x3C, 0x00, 0x00, 
-    0x10, 0x00, 0xC0, 0x86, 0x54, 0x4F, 0x67, 0x0C, 0x42, 0x6E, 0xFF, 0x10, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x2A, 0x60, 0x0C, 0x3D, 0x6E, 0xFE, 0xE8, 0xFF, 0x10, 0x2D, 0x6E, 0xFE, 0xE4, 0xFF, 0x2A, 
-    0x2D, 0x4B, 0xFF, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0x40, 0x00, 0xC0, 0x86, 0x66, 0x28, 0x55, 0x8F, 
-    0x3F, 0x3C, 0xA1, 0xAD, 0x4E, 0xAD, 0x00, 0xC2, 0x4A, 0x1F, 0x67, 0x1A, 0x55, 0x8F, 0x2F, 0x3C, 
-    0x61, 0x6C, 0x69, 0x73, 0x48, 0x6E, 0xFF, 0xB2, 0x4E, 0xAD, 0x01, 0x82, 0x7E, 0x01, 0xCE, 0xAE, 
-    0xFF, 0xB2, 0x54, 0x4F, 0x60, 0x02, 0x42, 0x07, 0x4A, 0x07, 0x67, 0x00, 0x01, 0x2E, 0x42, 0x6E, 
-    0xFF, 0xFE, 0x42, 0x2E, 0xFF, 0xFD, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0x10, 0x2F, 0x2E, 0xFE, 0xE4, 
-    0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xB6, 0x30, 0x3C, 0x00, 0x01, 0xAA, 0x52, 0x3E, 0x1F, 0x66, 0x3E, 
-    0x4A, 0x04, 0x67, 0x20, 0x55, 0x8F, 0x48, 0x6E, 0xFF, 0xB6, 0x70, 0x01, 0x1F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xFF, 0x48, 0x6E, 0xFF, 0xFE, 0x70, 0x0C, 0xA8, 0x23, 0x3E, 0x1F, 0x1D, 0x6E, 0xFF, 0xFE, 
-    0xFF, 0xFD, 0x60, 0x1A, 0x48, 0x6E, 0xFF, 0xFE, 0x48, 0x6E, 0xFF, 0xFF, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xB6, 0x4E, 0xBA, 0xF7, 0xFA, 0x3E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x0C, 0x47, 
-    0xFF, 0xD5, 0x66, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x86, 0x67, 0x02, 0x42, 0x47, 
-    0x0C, 0x47, 0xFF, 0xD5, 0x67, 0x0C, 0x0C, 0x47, 0xFF, 0x88, 0x67, 0x06, 0x0C, 0x47, 0xFF, 0xDD, 
-    0x66, 0x40, 0x48, 0x6E, 0xFF, 0xFE, 0x48, 0x6E, 0xFF, 0xFD, 0x48, 0x6E, 0xFF, 0xFF, 0x48, 0x6E, 
-    0xFF, 0xB6, 0x70, 0x00, 0x10, 0x04, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x2E, 0xFE, 0xE4, 0x30, 0x2E, 
-    0xFF, 0x10, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0xEC, 0x3E, 0x00, 0x0C, 0x47, 0xFF, 0xD5, 
-    0x4F, 0xEF, 0x00, 0x20, 0x66, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x86, 0x67, 0x02, 
-    0x42, 0x47, 0x4A, 0x47, 0x67, 0x16, 0x70, 0x00, 0x30, 0x07, 0x2A, 0x00, 0x8A, 0xBC, 0x40, 0x00, 
-    0x00, 0x00, 0x39, 0x47, 0x00, 0x02, 0x20, 0x05, 0x60, 0x00, 0x02, 0xD4, 0x4A, 0x2E, 0xFF, 0xFF, 
-    0x67, 0x0A, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x15, 0x60, 0x00, 0x02, 0xC4, 0x4A, 0x04, 0x66, 0x10, 
-    0x4A, 0x2E, 0xFF, 0xFE, 0x66, 0x0A, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x03, 0x60, 0x00, 0x02, 0xB0, 
-    0x4A, 0x2E, 0xFF, 0xFD, 0x67, 0x24, 0x3D, 0x6E, 0xFF, 0xB6, 0xFF, 0x10, 0x2D, 0x6E, 0xFF, 0xB8, 
-    0xFF, 0x2A, 0x41, 0xEE, 0xFF, 0xBC, 0x2D, 0x48, 0xFF, 0x0C, 0x2D, 0x6E, 0xFF, 0xB8, 0xFE, 0xE4, 
-    0x47, 0xEE, 0xFF, 0xBC, 0x3D, 0x6E, 0xFF, 0xB6, 0xFE, 0xE8, 0x42, 0x2E, 0xFF, 0x14, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x16, 0x2D, 0x40, 0xFF, 0x1A, 0x72, 0x03, 0xC2, 0x86, 0x53, 0x81, 0x67, 0x08, 
-    0x53, 0x81, 0x67, 0x0C, 0x53, 0x81, 0x67, 0x10, 0x1D, 0x7C, 0x00, 0x01, 0xFF, 0x15, 0x60, 0x0E, 
-    0x1D, 0x7C, 0x00, 0x02, 0xFF, 0x15, 0x60, 0x06, 0x1D, 0x7C, 0x00, 0x03, 0xFF, 0x15, 0x70, 0x10, 
-    0xC0, 0x86, 0x67, 0x12, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 
-    0x01, 0x4A, 0x3E, 0x1F, 0x60, 0x10, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 
-    0x4E, 0xAD, 0x01, 0x42, 0x3E, 0x1F, 0x4A, 0x47, 0x66, 0x28, 0x20, 0x3C, 0x00, 0x00, 0x05, 0x00, 
-    0xC0, 0x86, 0x0C, 0x80, 0x00, 0x00, 0x05, 0x00, 0x66, 0x18, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 
-    0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x00, 0xDA, 0x7E, 0xD0, 0x2A, 0x3C, 0x40, 0x00, 0x00, 0x11, 
-    0x54, 0x4F, 0x0C, 0x47, 0xFF, 0xD5, 0x66, 0x00, 0x00, 0x8A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x00, 
-    0xC0, 0x86, 0x67, 0x7E, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 
-    0x01, 0x52, 0x38, 0x1F, 0x66, 0x6A, 0x70, 0x10, 0xC0, 0x86, 0x67, 0x12, 0x55, 0x8F, 0x48, 0x6E, 
-    0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x01, 0x4A, 0x3E, 0x1F, 0x60, 0x54, 0x55, 0x8F, 
-    0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x01, 0x42, 0x3E, 0x1F, 0x20, 0x3C, 
-    0x00, 0x00, 0x08, 0x00, 0xC0, 0x86, 0x66, 0x3A, 0x55, 0x8F, 0x3F, 0x2E, 0xFE, 0xE8, 0x2F, 0x2E, 
-    0xFE, 0xE4, 0x2F, 0x0B, 0x48, 0x6E, 0xFE, 0xEA, 0x4E, 0xAD, 0x01, 0x6A, 0x4A, 0x5F, 0x66, 0x22, 
-    0x2D, 0x7C, 0x54, 0x45, 0x58, 0x54, 0xFE, 0xEA, 0x55, 0x8F, 0x3F, 0x2E, 0xFE, 0xE8, 0x2F, 0x2E, 
-    0xFE, 0xE4, 0x2F, 0x0B, 0x48, 0x6E, 0xFE, 0xEA, 0x4E, 0xAD, 0x01, 0x72, 0x54, 0x4F, 0x60, 0x02, 
-    0x3E, 0x04, 0x4A, 0x47, 0x66, 0x00, 0x00, 0x82, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x80, 0x42, 0x6E, 
-    0xFF, 0x90, 0x2D, 0x40, 0xFF, 0x86, 0x3D, 0x6E, 0xFF, 0x10, 0xFF, 0x8A, 0x3D, 0x6E, 0xFF, 0x12, 
-    0xFF, 0x8C, 0x55, 0x8F, 0x48, 0x6E, 0xFF, 0x74, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x01, 0x32, 
-    0x70, 0x02, 0xC0, 0x86, 0x54, 0x4F, 0x67, 0x1E, 0x30, 0x3C, 0x01, 0x00, 0xC0, 0x6E, 0xFF, 0x98, 
-    0x66, 0x14, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x00, 0xDA, 
-    0x7E, 0x01, 0x54, 0x4F, 0x60, 0x32, 0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 0xC0, 0x86, 0x67, 0x28, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0x16, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 
-    0x4E, 0xAD, 0x00, 0xEA, 0x3E, 0x1F, 0x67, 0x10, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 
-    0x1F, 0x00, 0x4E, 0xAD, 0x00, 0xDA, 0x54, 0x4F, 0x4A, 0x47, 0x67, 0x12, 0x70, 0x00, 0x30, 0x07, 
-    0x2A, 0x00, 0x8A, 0xBC, 0x40, 0x00, 0x00, 0x00, 0x39, 0x47, 0x00, 0x02, 0x60, 0x08, 0x4A, 0x85, 
-    0x67, 0x04, 0x42, 0x6C, 0x00, 0x02, 0x4A, 0x85, 0x66, 0x00, 0x00, 0xC2, 0x70, 0x0E, 0xA1, 0x22, 
-    0x29, 0x48, 0x00, 0x08, 0x66, 0x16, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 
-    0x4E, 0xAD, 0x00, 0xDA, 0x7A, 0x0C, 0x54, 0x4F, 0x60, 0x00, 0x00, 0xA2, 0x20, 0x6C, 0x00, 0x08, 
-    0x20, 0x50, 0x31, 0x6E, 0xFF, 0x12, 0x00, 0x02, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x30, 0xBC, 
-    0x00, 0x01, 0x20, 0x3C, 0x00, 0x00, 0x20, 0x00, 0xC0, 0x86, 0x67, 0x6C, 0x12, 0x13, 0x48, 0x81, 
-    0x52, 0x41, 0x48, 0xC1, 0x20, 0x01, 0xA1, 0x1E, 0x22, 0x6C, 0x00, 0x08, 0x22, 0x51, 0x23, 0x48, 
-    0x00, 0x0A, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x4A, 0xA8, 0x00, 0x0A, 0x66, 0x1A, 0x20, 0x6C, 
-    0x00, 0x08, 0xA0, 0x23, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xFA, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 
-    0x00, 0xDA, 0x7A, 0x0C, 0x54, 0x4F, 0x60, 0x30, 0x20, 0x4B, 0x24, 0x6C, 0x00, 0x08, 0x24, 0x52, 
-    0x22, 0x6A, 0x00, 0x0A, 0x12, 0x13, 0x48, 0x81, 0x52, 0x41, 0x48, 0xC1, 0x20, 0x01, 0xA0, 0x2E, 
-    0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x31, 0x6E, 0xFE, 0xE8, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x08, 
-    0x20, 0x50, 0x21, 0x6E, 0xFE, 0xE4, 0x00, 0x06, 0x55, 0x8F, 0x3F, 0x2E, 0xFF, 0x12, 0x70, 0x01, 
-    0x3F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x4E, 0xAD, 0x01, 0x2A, 0x54, 0x4F, 0x20, 0x05, 0x4C, 0xEE, 
-    0x1C, 0xF0, 0xFE, 0xC8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x73, 0x4F, 0x70, 0x65, 0x6E, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x42, 0x47, 
-    0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x53, 0x50, 0x4A, 0x50, 0x6E, 0x5A, 0x55, 0x8F, 0x20, 0x6C, 
-    0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x4E, 0xAD, 0x00, 0xF2, 0x3E, 0x1F, 0x67, 0x06, 
-    0x39, 0x47, 0x00, 0x02, 0x60, 0x3A, 0x30, 0x3C, 0x20, 0x00, 0xC0, 0x54, 0x67, 0x32, 0x55, 0x8F, 
-    0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 
-    0x2F, 0x28, 0x00, 0x06, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x2F, 0x28, 0x00, 0x0A, 0x4E, 0xAD, 
-    0x01, 0x62, 0x22, 0x6C, 0x00, 0x08, 0x22, 0x51, 0x20, 0x69, 0x00, 0x0A, 0xA0, 0x1F, 0x54, 0x4F, 
-    0x20, 0x6C, 0x00, 0x08, 0xA0, 0x23, 0x4A, 0x47, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x09, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x66, 0x73, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x55, 0x8F, 0x20, 0x6C, 
-    0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2C, 0x00, 0x10, 
-    0x4E, 0xAD, 0x00, 0xFA, 0x3E, 0x1F, 0x0C, 0x47, 0xFF, 0xD9, 0x66, 0x02, 0x42, 0x47, 0x4A, 0x47, 
-    0x66, 0x12, 0x20, 0x2E, 0xFF, 0xFC, 0x91, 0xAC, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xFC, 0xD1, 0xAC, 
-    0x00, 0x10, 0x60, 0x04, 0x39, 0x47, 0x00, 0x02, 0x4A, 0x47, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x05, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x66, 0x73, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x08, 0xC0, 0x54, 0x67, 0x24, 0x55, 0x8F, 0x20, 0x6C, 
-    0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x70, 0x02, 0x3F, 0x00, 0x72, 0x00, 0x2F, 0x01, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x3E, 0x1F, 0x67, 0x08, 0x39, 0x47, 0x00, 0x02, 0x70, 0x1D, 0x60, 0x46, 
-    0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x55, 0x8F, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 
-    0x00, 0x02, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xAD, 0x01, 0x02, 0x3E, 0x1F, 
-    0x66, 0x12, 0x20, 0x2E, 0xFF, 0xFC, 0x91, 0xAC, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xFC, 0xD1, 0xAC, 
-    0x00, 0x10, 0x60, 0x04, 0x39, 0x47, 0x00, 0x02, 0x4A, 0x47, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x05, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x88, 0x5F, 0x66, 0x73, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x13, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2E, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 
-    0x66, 0x00, 0x6B, 0x20, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x06, 0x6E, 0x18, 0xD0, 0x80, 0x30, 0x3B, 
-    0x08, 0x06, 0x4E, 0xFB, 0x00, 0x00, 0x00, 0x1A, 0x00, 0xA6, 0x00, 0x10, 0x00, 0xB2, 0x00, 0x10, 
-    0x00, 0xBA, 0x00, 0xCC, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x16, 0x60, 0x00, 0x00, 0xE0, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0x10, 0x67, 0x0A, 0x53, 0x80, 0x67, 0x0A, 0x53, 0x80, 0x67, 0x0A, 0x60, 0x0C, 
-    0x7C, 0x01, 0x60, 0x12, 0x7C, 0x03, 0x60, 0x0E, 0x7C, 0x02, 0x60, 0x0A, 0x42, 0x6C, 0x00, 0x02, 
-    0x70, 0x16, 0x60, 0x00, 0x00, 0xB8, 0x70, 0x03, 0xB0, 0x86, 0x66, 0x0E, 0x20, 0x6E, 0x00, 0x10, 
-    0x4A, 0xA8, 0x00, 0x04, 0x66, 0x04, 0x42, 0x47, 0x60, 0x26, 0x55, 0x8F, 0x20, 0x6C, 0x00, 0x08, 
-    0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x3F, 0x06, 0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x04, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x3E, 0x1F, 0x67, 0x08, 0x39, 0x47, 0x00, 0x02, 0x70, 0x1D, 0x60, 0x7C, 
-    0x70, 0x01, 0xB0, 0x86, 0x67, 0x60, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x20, 0x80, 0x55, 0x8F, 
-    0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x20, 0x6E, 0x00, 0x10, 0x48, 0x68, 
-    0x00, 0x04, 0x4E, 0xAD, 0x01, 0x22, 0x54, 0x4F, 0x60, 0x3C, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 
-    0x52, 0x50, 0x42, 0x47, 0x60, 0x30, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x16, 0x60, 0x3E, 0x20, 0x6C, 
-    0x00, 0x08, 0x20, 0x50, 0x22, 0x6E, 0x00, 0x10, 0x32, 0xA8, 0x00, 0x02, 0x42, 0x47, 0x60, 0x16, 
-    0x55, 0x8F, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x50, 0x3F, 0x28, 0x00, 0x02, 0x2F, 0x2E, 0x00, 0x10, 
-    0x4E, 0xAD, 0x01, 0x1A, 0x3E, 0x1F, 0x4A, 0x47, 0x67, 0x04, 0x39, 0x47, 0x00, 0x02, 0x4A, 0x47, 
-    0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x16, 0x4C, 0xEE, 0x10, 0xC8, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x73, 0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2D, 0x4C, 0xFF, 0xFC, 0x18, 0xDB, 0x66, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x70, 0x79, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x4C, 
-    0x52, 0x4B, 0x4A, 0x1C, 0x66, 0xFC, 0x20, 0x0C, 0x90, 0x8B, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x6C, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 0x2E, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2D, 0x4C, 0xFF, 0xFC, 0x60, 0x02, 0x18, 0xDB, 0x53, 0x87, 0x6C, 0xFA, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 
-    0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE0, 0x2F, 0x2E, 0x00, 0x0A, 0x3F, 0x2E, 
-    0x00, 0x08, 0x48, 0x6E, 0xFF, 0xEC, 0x48, 0x6E, 0xFF, 0xE0, 0x48, 0x6E, 0xFF, 0xE4, 0xA9, 0x8D, 
-    0x48, 0x6E, 0xFF, 0xE4, 0x70, 0xFC, 0x3F, 0x00, 0x3F, 0x00, 0xA8, 0xA9, 0x48, 0x6E, 0xFF, 0xEE, 
-    0xA8, 0x98, 0x70, 0x03, 0x3F, 0x00, 0x3F, 0x00, 0xA8, 0x9B, 0x48, 0x6E, 0xFF, 0xE4, 0x70, 0x10, 
-    0x3F, 0x00, 0x3F, 0x00, 0xA8, 0xB0, 0x48, 0x6E, 0xFF, 0xEE, 0xA8, 0x99, 0x4E, 0x5E, 0x20, 0x5F, 
-    0x5C, 0x4F, 0x4E, 0xD0, 0x92, 0x48, 0x49, 0x4C, 0x49, 0x54, 0x45, 0x44, 0x49, 0x41, 0x4C, 0x4F, 
-    0x47, 0x42, 0x55, 0x54, 0x54, 0x4F, 0x4E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEA, 0x48, 0xE7, 
-    0x1F, 0x38, 0x26, 0x6E, 0x00, 0x08, 0x41, 0xFA, 0x02, 0x14, 0x2D, 0x48, 0xFF, 0xF8, 0x48, 0x6D, 
-    0xF6, 0x96, 0x2F, 0x3C, 0x00, 0x8A, 0x01, 0x42, 0x2F, 0x3C, 0x00, 0x9E, 0x01, 0x7E, 0xA8, 0xA7, 
-    0x48, 0x6D, 0xF6, 0x8E, 0x70, 0x0C, 0x3F, 0x00, 0x72, 0x08, 0x3F, 0x01, 0x3F, 0x3C, 0x01, 0x9B, 
-    0x70, 0x2C, 0x3F, 0x00, 0xA8, 0xA7, 0x48, 0x6D, 0xF6, 0x86, 0x70, 0x0C, 0x3F, 0x00, 0x72, 0x2E, 
-    0x3F, 0x01, 0x3F, 0x3C, 0x01, 0x9B, 0x70, 0x7D, 0x3F, 0x00, 0xA8, 0xA7, 0x0C, 0xAB, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x0C, 0x5F, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2B, 0x00, 0x0C, 0x60, 0x06, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0x3E, 0x00, 0x70, 0x00, 0x27, 0x40, 0x00, 0x0C, 0x48, 0xC7, 
-    0x22, 0x07, 0xD2, 0xBC, 0x00, 0x00, 0x00, 0x80, 0x20, 0x01, 0xA1, 0x22, 0x28, 0x48, 0x20, 0x0C, 
-    0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x7C, 0x20, 0x54, 0x30, 0xBC, 0x00, 0x03, 0x20, 0x54, 
-    0x70, 0x00, 0x21, 0x40, 0x00, 0x02, 0x20, 0x54, 0x5C, 0x88, 0x43, 0xED, 0xF6, 0x96, 0x20, 0xD9, 
-    0x20, 0xD9, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x04, 0x00, 0x0E, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x02, 
-    0x00, 0x0F, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x4F, 0x00, 0x10, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x4B, 
-    0x00, 0x11, 0x41, 0xED, 0x02, 0x4A, 0x22, 0x54, 0x23, 0x48, 0x00, 0x12, 0x20, 0x54, 0x2D, 0x48, 
-    0xFF, 0xFC, 0x22, 0x48, 0x5C, 0x88, 0x45, 0xE9, 0x00, 0x16, 0x24, 0xD8, 0x24, 0xD8, 0x20, 0x54, 
-    0x42, 0x28, 0x00, 0x1E, 0x20, 0x54, 0x42, 0x28, 0x00, 0x1F, 0x20, 0x54, 0x21, 0x40, 0x00, 0x20, 
-    0x20, 0x54, 0x41, 0xE8, 0x00, 0x24, 0x43, 0xED, 0xF6, 0x8E, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0x54, 
-    0x11, 0x7C, 0x00, 0x08, 0x00, 0x2C, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xFE, 0x26, 0x20, 0x54, 
-    0x11, 0x40, 0x00, 0x2D, 0x2F, 0x2E, 0xFF, 0xF8, 0x20, 0x54, 0x48, 0x68, 0x00, 0x2E, 0x4E, 0xBA, 
-    0xFD, 0xE2, 0x20, 0x54, 0x70, 0x00, 0x21, 0x40, 0x00, 0x70, 0x20, 0x54, 0x41, 0xE8, 0x00, 0x74, 
-    0x43, 0xED, 0xF6, 0x86, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x08, 0x00, 0x7C, 
-    0x20, 0x54, 0x11, 0x47, 0x00, 0x7D, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x2B, 0x00, 0x10, 0x20, 0x54, 
-    0x48, 0x68, 0x00, 0x7E, 0x4E, 0xBA, 0xFE, 0x08, 0x3C, 0x3C, 0x01, 0xA8, 0x3E, 0x3C, 0x00, 0xAA, 
-    0x38, 0x2D, 0xF3, 0x94, 0x98, 0x6D, 0xF3, 0x90, 0x3A, 0x2D, 0xF3, 0x92, 0x9A, 0x6D, 0xF3, 0x8E, 
-    0x48, 0xC4, 0x48, 0xC6, 0x20, 0x04, 0x90, 0x86, 0x72, 0x02, 0x4E, 0xAD, 0x00, 0x9A, 0x3D, 0x40, 
-    0xFF, 0xEC, 0x30, 0x06, 0xD0, 0x6E, 0xFF, 0xEC, 0x3D, 0x40, 0xFF, 0xF0, 0x48, 0xC5, 0x48, 0xC7, 
-    0x20, 0x05, 0x90, 0x87, 0x72, 0x04, 0x4E, 0xAD, 0x00, 0x9A, 0x3D, 0x40, 0xFF, 0xEA, 0x30, 0x07, 
-    0xD0, 0x6E, 0xFF, 0xEA, 0x3D, 0x40, 0xFF, 0xEE, 0x48, 0x6E, 0xFF, 0xF2, 0xA8, 0x74, 0x59, 0x8F, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEA, 0x2F, 0x00, 0x72, 0x00, 0x1F, 0x01, 0x70, 0x01, 
-    0x3F, 0x00, 0x70, 0xFF, 0x2F, 0x00, 0x1F, 0x01, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0xA9, 0x7D, 
-    0x26, 0x5F, 0x20, 0x0B, 0x4F, 0xEF, 0x00, 0x18, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x24, 0x2F, 0x0B, 
-    0xA9, 0x15, 0x2F, 0x0B, 0xA9, 0x1F, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF6, 0xA9, 0x91, 
-    0x70, 0x01, 0xB0, 0x6E, 0xFF, 0xF6, 0x66, 0xEE, 0x2F, 0x0B, 0xA9, 0x83, 0x2F, 0x2E, 0xFF, 0xF2, 
-    0xA8, 0x73, 0x4C, 0xEE, 0x1C, 0xF8, 0xFF, 0xCA, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x44, 0x6F, 0x50, 
-    0x72, 0x69, 0x6E, 0x74, 0x41, 0x6C, 0x65, 0x72, 0x74, 0x00, 0x00, 0x44, 0x57, 0x61, 0x72, 0x6E, 
-    0x69, 0x6E, 0x67, 0x21, 0x20, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 
-    0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x73, 0x20, 0x4E, 
-    0x4F, 0x54, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x21, 0x0D, 0x00, 0x00, 
-    0x4E, 0x56, 0xFE, 0xE0, 0x48, 0xE7, 0x0F, 0x38, 0x47, 0xEE, 0xFE, 0xF0, 0x42, 0x53, 0x3C, 0x3C, 
-    0x01, 0x00, 0x41, 0xFA, 0x02, 0x4A, 0x2D, 0x48, 0xFF, 0xF8, 0x48, 0x6D, 0xF6, 0x96, 0x2F, 0x3C, 
-    0x00, 0x8A, 0x01, 0x42, 0x2F, 0x3C, 0x00, 0x9E, 0x01, 0x7E, 0xA8, 0xA7, 0x48, 0x6D, 0xF6, 0x8E, 
-    0x70, 0x0C, 0x3F, 0x00, 0x72, 0x08, 0x3F, 0x01, 0x3F, 0x3C, 0x01, 0x9B, 0x70, 0x2C, 0x3F, 0x00, 
-    0xA8, 0xA7, 0x48, 0x6D, 0xF6, 0x86, 0x70, 0x0C, 0x3F, 0x00, 0x72, 0x2E, 0x3F, 0x01, 0x3F, 0x3C, 
-    0x01, 0x9B, 0x70, 0x7D, 0x3F, 0x00, 0xA8, 0xA7, 0x3E, 0x06, 0x48, 0xC7, 0x22, 0x07, 0xD2, 0xBC, 
-    0x00, 0x00, 0x01, 0x94, 0x20, 0x01, 0xA1, 0x22, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x06, 0x70, 0xFF, 
-    0x60, 0x00, 0x01, 0xD4, 0x20, 0x54, 0x30, 0xBC, 0x00, 0x03, 0x20, 0x54, 0x70, 0x00, 0x21, 0x40, 
-    0x00, 0x02, 0x20, 0x54, 0x5C, 0x88, 0x43, 0xED, 0xF6, 0x96, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0x54, 
-    0x11, 0x7C, 0x00, 0x04, 0x00, 0x0E, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x02, 0x00, 0x0F, 0x20, 0x54, 
-    0x11, 0x7C, 0x00, 0x4F, 0x00, 0x10, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x4B, 0x00, 0x11, 0x41, 0xED, 
-    0x02, 0x4A, 0x22, 0x54, 0x23, 0x48, 0x00, 0x12, 0x20, 0x54, 0x2D, 0x48, 0xFF, 0xFC, 0x22, 0x48, 
-    0x5C, 0x88, 0x45, 0xE9, 0x00, 0x16, 0x24, 0xD8, 0x24, 0xD8, 0x20, 0x54, 0x42, 0x28, 0x00, 0x1E, 
-    0x20, 0x54, 0x42, 0x28, 0x00, 0x1F, 0x20, 0x54, 0x21, 0x40, 0x00, 0x20, 0x20, 0x54, 0x41, 0xE8, 
-    0x00, 0x24, 0x43, 0xED, 0xF6, 0x8E, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x08, 
-    0x00, 0x2C, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xBA, 0xFB, 0xDA, 0x20, 0x54, 0x11, 0x40, 0x00, 0x2D, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x20, 0x54, 0x48, 0x68, 0x00, 0x2E, 0x4E, 0xBA, 0xFB, 0x96, 0x20, 0x54, 
-    0x70, 0x00, 0x21, 0x40, 0x00, 0x86, 0x20, 0x54, 0x41, 0xE8, 0x00, 0x8A, 0x43, 0xED, 0xF6, 0x86, 
-    0x20, 0xD9, 0x20, 0xD9, 0x20, 0x54, 0x11, 0x7C, 0x00, 0x10, 0x00, 0x92, 0x20, 0x54, 0x42, 0x28, 
-    0x00, 0x93, 0x20, 0x54, 0x42, 0x28, 0x00, 0x94, 0x3C, 0x3C, 0x01, 0xA8, 0x3E, 0x3C, 0x00, 0xAA, 
-    0x38, 0x2D, 0xF3, 0x94, 0x98, 0x6D, 0xF3, 0x90, 0x3A, 0x2D, 0xF3, 0x92, 0x9A, 0x6D, 0xF3, 0x8E, 
-    0x48, 0xC4, 0x48, 0xC6, 0x22, 0x04, 0x92, 0x86, 0x20, 0x01, 0x72, 0x02, 0x4E, 0xAD, 0x00, 0x9A, 
-    0x3D, 0x40, 0xFE, 0xE2, 0x30, 0x06, 0xD0, 0x6E, 0xFE, 0xE2, 0x3D, 0x40, 0xFE, 0xE6, 0x48, 0xC5, 
-    0x48, 0xC7, 0x20, 0x05, 0x90, 0x87, 0x72, 0x04, 0x4E, 0xAD, 0x00, 0x9A, 0x3D, 0x40, 0xFE, 0xE0, 
-    0x30, 0x07, 0xD0, 0x6E, 0xFE, 0xE0, 0x3D, 0x40, 0xFE, 0xE4, 0x48, 0x6E, 0xFE, 0xE8, 0xA8, 0x74, 
-    0x59, 0x8F, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFE, 0xE0, 0x2F, 0x00, 0x72, 0x00, 0x1F, 0x01, 
-    0x70, 0x01, 0x3F, 0x00, 0x70, 0xFF, 0x2F, 0x00, 0x1F, 0x01, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0xA9, 0x7D, 0x2D, 0x5F, 0xFE, 0xEC, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 
-    0x00, 0x86, 0x2F, 0x2E, 0xFE, 0xEC, 0xA9, 0x15, 0x2F, 0x2E, 0xFE, 0xEC, 0xA9, 0x1F, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF6, 0xA9, 0x91, 0x70, 0x01, 0xB0, 0x6E, 0xFF, 0xF6, 0x66, 0xEE, 
-    0x2F, 0x2E, 0xFE, 0xEC, 0x70, 0x04, 0x3F, 0x00, 0x48, 0x6E, 0xFF, 0xF4, 0x48, 0x6E, 0xFF, 0xF0, 
-    0x48, 0x6D, 0xF6, 0x86, 0xA9, 0x8D, 0x2F, 0x2E, 0xFF, 0xF0, 0x2F, 0x0B, 0xA9, 0x90, 0x70, 0x00, 
-    0x10, 0x13, 0x2F, 0x00, 0x48, 0x6B, 0x00, 0x01, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x10, 
-    0x4E, 0xBA, 0xFA, 0xEC, 0x20, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x10, 0x13, 0xD0, 0xA8, 0x00, 0x10, 
-    0x20, 0x40, 0x10, 0xBC, 0x00, 0x0D, 0x20, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x10, 0x13, 0x52, 0x40, 
-    0x48, 0xC0, 0x91, 0xA8, 0x00, 0x0C, 0x2F, 0x2E, 0xFE, 0xEC, 0xA9, 0x83, 0x2F, 0x2E, 0xFE, 0xE8, 
-    0xA8, 0x73, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x1C, 0xF0, 0xFE, 0xC4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8B, 0x44, 0x6F, 0x52, 0x65, 0x61, 0x64, 0x41, 0x6C, 0x65, 0x72, 0x74, 0x00, 0x58, 0x41, 0x6C, 
-    0x65, 0x72, 0x74, 0x21, 0x20, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 
-    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x20, 0x69, 0x6E, 
-    0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x73, 
-    0x20, 0x4E, 0x4F, 0x54, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x21, 0x20, 
-    0x20, 0x59, 0x6F, 0x75, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x62, 0x65, 
-    0x6C, 0x6F, 0x77, 0x3A, 0x0D, 0x00, 0x4E, 0x56, 0xFF, 0x00, 0x2F, 0x0C, 0x49, 0xEE, 0xFF, 0x00, 
-    0x48, 0x78, 0x00, 0xFF, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0x02, 0x59, 0x8F, 
-    0x2F, 0x0C, 0x4E, 0xAD, 0x01, 0x8A, 0x55, 0x8F, 0x2F, 0x0C, 0x48, 0x7A, 0x00, 0x46, 0x70, 0x00, 
-    0x1F, 0x00, 0x72, 0x01, 0x1F, 0x01, 0x4E, 0xAD, 0x00, 0xD2, 0x4A, 0x1F, 0x4F, 0xEF, 0x00, 0x10, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x16, 0x20, 0x2E, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x64, 0x00, 
-    0x67, 0x08, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x16, 0x60, 0x02, 0x70, 0x00, 0x28, 0x6E, 0xFE, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x63, 0x6F, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 
-    0x00, 0x0E, 0x0B, 0x64, 0x65, 0x76, 0x3A, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x43, 0x6C, 
-    0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4A, 0x38, 0x08, 0xF3, 0x67, 0x10, 
-    0x48, 0x6D, 0xF4, 0x02, 0xA8, 0x6E, 0x4A, 0x38, 0x08, 0xF2, 0x67, 0x04, 0xA9, 0x12, 0xA8, 0xFE, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFC, 0x9A, 0x70, 0x00, 0x58, 0x4F, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x63, 0x6F, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4A, 0x38, 
-    0x08, 0xF3, 0x67, 0x10, 0x48, 0x6D, 0xF4, 0x02, 0xA8, 0x6E, 0x4A, 0x38, 0x08, 0xF2, 0x67, 0x04, 
-    0xA9, 0x12, 0xA8, 0xFE, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFA, 0x00, 0x70, 0x00, 0x58, 0x4F, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x20, 0x2E, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x66, 0x02, 0x67, 0x08, 
-    0x53, 0x80, 0x67, 0x08, 0x70, 0xFF, 0x60, 0x10, 0x70, 0x00, 0x60, 0x0C, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 
-    0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x63, 0x6F, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFE, 0xFC, 0x48, 0xE7, 
-    0x00, 0x18, 0x47, 0xEE, 0xFF, 0x00, 0x48, 0x78, 0x00, 0xFF, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xAD, 0x02, 0x02, 0x59, 0x8F, 0x2F, 0x0B, 0x4E, 0xAD, 0x01, 0x8A, 0x55, 0x8F, 0x2F, 0x0B, 
-    0x48, 0x7A, 0x01, 0x52, 0x70, 0x00, 0x1F, 0x00, 0x72, 0x01, 0x1F, 0x01, 0x4E, 0xAD, 0x00, 0xD2, 
-    0x4A, 0x1F, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xFC, 0x55, 0x8F, 
-    0x2F, 0x0B, 0x48, 0x7A, 0x01, 0x24, 0x70, 0x00, 0x1F, 0x00, 0x72, 0x01, 0x1F, 0x01, 0x4E, 0xAD, 
-    0x00, 0xD2, 0x4A, 0x1F, 0x67, 0x08, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0xFC, 0x60, 0x46, 0x55, 0x8F, 
-    0x2F, 0x0B, 0x48, 0x7A, 0x00, 0xF8, 0x70, 0x00, 0x1F, 0x00, 0x72, 0x01, 0x1F, 0x01, 0x4E, 0xAD, 
-    0x00, 0xD2, 0x4A, 0x1F, 0x67, 0x08, 0x70, 0x01, 0x2D, 0x40, 0xFE, 0xFC, 0x60, 0x26, 0x55, 0x8F, 
-    0x2F, 0x0B, 0x48, 0x7A, 0x00, 0xCC, 0x70, 0x00, 0x1F, 0x00, 0x72, 0x01, 0x1F, 0x01, 0x4E, 0xAD, 
-    0x00, 0xD2, 0x4A, 0x1F, 0x67, 0x08, 0x70, 0x02, 0x2D, 0x40, 0xFE, 0xFC, 0x60, 0x06, 0x70, 0xFF, 
-    0x60, 0x00, 0x00, 0x96, 0x0C, 0xAE, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0C, 0x67, 0x0A, 0x20, 0x3C, 
-    0x40, 0x00, 0x00, 0x16, 0x60, 0x00, 0x00, 0x82, 0x20, 0x6E, 0x00, 0x10, 0x30, 0x3C, 0x05, 0x00, 
-    0xC0, 0x50, 0x72, 0x00, 0x32, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x05, 0x00, 0x66, 0x08, 0x20, 0x3C, 
-    0x40, 0x00, 0x00, 0x11, 0x60, 0x62, 0x48, 0x6E, 0xFE, 0xFC, 0x4E, 0xAD, 0x01, 0xEA, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x66, 0x08, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x09, 0x60, 0x4A, 0x20, 0x6E, 
-    0x00, 0x10, 0x30, 0x10, 0xC0, 0x54, 0x72, 0x03, 0xC2, 0x40, 0x70, 0x03, 0xC0, 0x50, 0xB0, 0x41, 
-    0x67, 0x08, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x0D, 0x60, 0x2E, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 
-    0x66, 0x01, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x20, 0x6E, 
-    0x00, 0x10, 0x21, 0x6C, 0x00, 0x04, 0x00, 0x04, 0x20, 0x6E, 0x00, 0x10, 0x21, 0x6C, 0x00, 0x08, 
-    0x00, 0x08, 0x70, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFE, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8A, 0x5F, 0x73, 0x79, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x2E, 
-    0x0A, 0x64, 0x65, 0x76, 0x3A, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x00, 0x0A, 0x64, 0x65, 0x76, 
-    0x3A, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x00, 0x09, 0x64, 0x65, 0x76, 0x3A, 0x73, 0x74, 0x64, 
-    0x69, 0x6E, 0x00, 0x00, 0x08, 0x64, 0x65, 0x76, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x43, 0x6C, 0x6F, 0x73, 
-    0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x73, 0x79, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 0xD1, 0xAC, 0x00, 0x10, 0x70, 0x00, 0x29, 0x40, 0x00, 0x0C, 
-    0x70, 0x00, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x57, 0x72, 
-    0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x10, 
-    0x20, 0x2E, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x66, 0x00, 0x67, 0x06, 0x53, 0x80, 0x67, 0x0E, 
-    0x60, 0x10, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 0x00, 0x04, 0x70, 0x00, 0x60, 0x06, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x16, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 
-    0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0A, 0x02, 0x88, 0x00, 0x0A, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 0x00, 0x08, 0x2E, 0x2E, 0x00, 0x10, 
-    0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x07, 0x70, 0x30, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x04, 
-    0xD9, 0xC7, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1A, 0x70, 0x0F, 0xC0, 0x86, 0x19, 0x00, 0x70, 0x09, 
-    0xB0, 0x14, 0x6C, 0x04, 0x70, 0x37, 0x60, 0x02, 0x70, 0x30, 0xD1, 0x14, 0x20, 0x07, 0x53, 0x87, 
-    0xE8, 0x8E, 0x4A, 0x86, 0x63, 0x04, 0x4A, 0x87, 0x6E, 0xDE, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x62, 0x69, 0x6E, 0x68, 0x65, 0x78, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x08, 0x20, 0x06, 0x22, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xAD, 0x00, 0x92, 0x2C, 0x00, 0x2F, 0x06, 0x4E, 0xBA, 0x01, 0x86, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x58, 0x4F, 0x67, 0x28, 0x28, 0x6E, 0xFF, 0xFC, 0x20, 0x06, 0xE4, 0x88, 0x2E, 0x00, 0x60, 0x04, 
-    0x70, 0x00, 0x28, 0xC0, 0x53, 0x87, 0x6C, 0xF8, 0x26, 0x4C, 0x20, 0x06, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0x03, 0x2E, 0x00, 0x60, 0x02, 0x42, 0x1B, 0x53, 0x87, 0x6C, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x63, 0x61, 0x6C, 0x6C, 0x6F, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x41, 
-    0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x5A, 0xB0, 0x87, 0x6D, 0x06, 0x04, 0x87, 0xFF, 0xFF, 0xFF, 0xE0, 
-    0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x74, 0x6F, 0x6C, 0x6F, 0x77, 
-    0x65, 0x72, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x1A, 
-    0x28, 0x6E, 0x00, 0x08, 0x1D, 0x6E, 0x00, 0x25, 0xFF, 0xFC, 0x3D, 0x6E, 0x00, 0x18, 0xFF, 0xFE, 
-    0x2F, 0x0C, 0x41, 0xEE, 0x00, 0x16, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0xAD, 0x01, 0xAA, 0x10, 0x2C, 0x00, 0x05, 0x04, 0x00, 0x00, 0x30, 0x4F, 0xEF, 0x00, 0x12, 
-    0x67, 0x36, 0x04, 0x00, 0x00, 0x0F, 0x67, 0x0C, 0x04, 0x00, 0x00, 0x0A, 0x67, 0x3E, 0x5B, 0x00, 
-    0x67, 0x3A, 0x60, 0x28, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x1E, 0x2F, 0x0B, 0x72, 0x13, 
-    0x2F, 0x01, 0x41, 0xEE, 0x00, 0x16, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFF, 0x94, 0x4F, 0xEF, 0x00, 0x1E, 0x60, 0x30, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x10, 0x2C, 
-    0x00, 0x04, 0x32, 0x2C, 0x00, 0x02, 0x48, 0xC1, 0xD2, 0x80, 0x26, 0x81, 0x10, 0x14, 0x48, 0x80, 
-    0x48, 0xC0, 0x20, 0x6E, 0x00, 0x1E, 0x20, 0x80, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x42, 0x34, 
-    0x00, 0x05, 0x20, 0x4C, 0x5A, 0x88, 0x20, 0x08, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x84, 0x5F, 0x63, 0x76, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x49, 0xEE, 0xFF, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0xF0, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x02, 0x2E, 0x00, 0x70, 0x08, 0x2F, 0x00, 0x22, 0x0C, 0xD2, 0x87, 
-    0x2F, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0xFE, 0x28, 0x42, 0x34, 0x70, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xAD, 0x01, 0x92, 0x2F, 0x0C, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFE, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x62, 0x61, 0x64, 0x50, 0x74, 0x72, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x18, 0x47, 0xED, 0xF6, 0xA2, 0x2A, 0x2E, 0x00, 0x08, 
-    0x7E, 0x00, 0x0C, 0x85, 0x00, 0x80, 0x00, 0x00, 0x63, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xAE, 
-    0x70, 0x08, 0xB0, 0x85, 0x63, 0x02, 0x7A, 0x08, 0x20, 0x05, 0x56, 0x80, 0x72, 0xFC, 0xC2, 0x80, 
-    0x2A, 0x01, 0x20, 0x05, 0x53, 0x80, 0x2C, 0x00, 0xE4, 0x86, 0x60, 0x02, 0x52, 0x87, 0xE2, 0x8E, 
-    0x4A, 0x86, 0x66, 0xF8, 0x70, 0x08, 0xB0, 0x87, 0x6D, 0x0A, 0x20, 0x07, 0xE5, 0x40, 0x4A, 0xB3, 
-    0x00, 0x00, 0x66, 0x14, 0x2F, 0x05, 0x2F, 0x07, 0x4E, 0xBA, 0x00, 0xBE, 0x28, 0x40, 0x20, 0x0C, 
-    0x50, 0x4F, 0x66, 0x26, 0x70, 0x00, 0x60, 0x64, 0x20, 0x07, 0xE5, 0x40, 0x28, 0x73, 0x00, 0x00, 
-    0x20, 0x07, 0xE5, 0x40, 0x20, 0x73, 0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 0x27, 0x90, 0x00, 0x00, 
-    0x18, 0xAC, 0x00, 0x04, 0x19, 0x6C, 0x00, 0x05, 0x00, 0x01, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 
-    0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 
-    0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x08, 0x63, 0x1C, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 
-    0x0C, 0x40, 0x00, 0xFF, 0x67, 0x10, 0x2F, 0x0C, 0x48, 0x7A, 0x00, 0x26, 0x4E, 0xBA, 0xFE, 0xEC, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x4C, 0x58, 0x88, 0x20, 0x08, 0x4C, 0xEE, 0x18, 0xE0, 
-    0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x38, 
-    0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 
-    0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x43, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 
-    0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x46, 0x72, 0x65, 0x65, 
-    0x4C, 0x69, 0x73, 0x74, 0x20, 0x40, 0x20, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x0F, 0x18, 
-    0x47, 0xED, 0xF6, 0xA2, 0x2A, 0x2E, 0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x08, 0x70, 0x08, 0xB0, 0x86, 
-    0x6C, 0x26, 0x41, 0xF8, 0x00, 0x04, 0x20, 0x05, 0xD0, 0x88, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 
-    0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xE6, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x7C, 0x00, 0xFF, 
-    0x00, 0x01, 0x20, 0x0C, 0x60, 0x00, 0x00, 0xD6, 0x20, 0x06, 0xE5, 0x40, 0x4A, 0xB3, 0x00, 0x00, 
-    0x67, 0x10, 0x48, 0x7A, 0x00, 0xDE, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x70, 0x00, 0x60, 0x00, 
-    0x00, 0xBC, 0x70, 0x08, 0xB0, 0x86, 0x6D, 0x04, 0x70, 0x08, 0x60, 0x02, 0x20, 0x06, 0x28, 0x00, 
-    0x56, 0x84, 0x20, 0x06, 0x56, 0x80, 0x12, 0x04, 0x92, 0x00, 0x7E, 0x01, 0xE3, 0xAF, 0xBC, 0x84, 
-    0x6F, 0x02, 0x28, 0x06, 0x70, 0x01, 0xE9, 0xA8, 0x41, 0xF8, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x20, 0x07, 0x22, 0x08, 0x4E, 0xAD, 0x00, 0x92, 0x22, 0x2E, 0xFF, 0xFC, 0x2A, 0x00, 0xDA, 0x81, 
-    0x20, 0x05, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x14, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x68, 0x28, 0x06, 0x56, 0x84, 0x7E, 0x01, 0x4A, 0x87, 0x6E, 0xC6, 0x4A, 0x87, 
-    0x66, 0x04, 0x70, 0x00, 0x60, 0x56, 0x20, 0x06, 0xE5, 0x40, 0x27, 0x8C, 0x00, 0x00, 0x10, 0x06, 
-    0x56, 0x00, 0x72, 0x01, 0xE1, 0xA9, 0x41, 0xF8, 0x00, 0x04, 0x2A, 0x01, 0xDA, 0x88, 0x60, 0x12, 
-    0x20, 0x0C, 0xD0, 0x85, 0x28, 0x80, 0x28, 0x40, 0x19, 0x7C, 0x00, 0x55, 0x00, 0x04, 0x19, 0x46, 
-    0x00, 0x05, 0x53, 0x87, 0x6E, 0xEA, 0x70, 0x00, 0x28, 0x80, 0x22, 0x06, 0xE5, 0x41, 0x28, 0x73, 
-    0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x20, 0x73, 0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x27, 0x90, 
-    0x10, 0x00, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x46, 0x00, 0x01, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xF0, 
-    0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x4D, 0x65, 0x6D, 
-    0x00, 0x2E, 0x2B, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 
-    0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x72, 0x65, 0x65, 
-    0x4C, 0x69, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x0B, 0x08, 0x00, 
-    0x00, 0x00, 0x67, 0x10, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0xE0, 0x4E, 0xBA, 0xFD, 0x1E, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0x90, 0x20, 0x0B, 0x67, 0x00, 0x00, 0x8A, 0x41, 0xF8, 0x00, 0x04, 0x28, 0x4B, 
-    0x99, 0xC8, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 
-    0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x08, 
-    0x63, 0x1A, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x40, 0x00, 0xFF, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x48, 0x7A, 0x00, 0x62, 0x4E, 0xBA, 0xFC, 0xD4, 0x50, 0x4F, 0x60, 0x46, 0x7E, 0x00, 0x1E, 0x2C, 
-    0x00, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x66, 0x14, 0x18, 0xBC, 0x00, 0x51, 0x19, 0x7C, 
-    0x00, 0x09, 0x00, 0x01, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xEA, 0x58, 0x4F, 0x60, 0x24, 0x19, 0x54, 
-    0x00, 0x04, 0x19, 0x6C, 0x00, 0x01, 0x00, 0x05, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xF6, 0xA2, 
-    0x26, 0x70, 0x00, 0x00, 0x28, 0x8B, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xF6, 0xA2, 0x21, 0x8C, 
-    0x00, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x66, 0x72, 0x65, 
-    0x65, 0x00, 0x00, 0x56, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x66, 
-    0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 
-    0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x62, 0x6C, 
-    0x6F, 0x63, 0x6B, 0x20, 0x40, 0x20, 0x00, 0x00, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 
-    0x74, 0x6F, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x70, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x40, 0x20, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x03, 0x18, 0x2C, 0x2E, 0x00, 0x14, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x60, 0x0A, 0x18, 0x9B, 0xBE, 0x1C, 0x66, 0x04, 0x20, 0x0C, 0x60, 0x0A, 0x20, 0x06, 
-    0x53, 0x86, 0x4A, 0x80, 0x62, 0xEE, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x6D, 0x65, 0x6D, 0x63, 0x63, 0x70, 0x79, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 
-    0x00, 0x04, 0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 
-    0x6D, 0x2E, 0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 
-    0x10, 0xD9, 0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 
-    0x20, 0xD9, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 
-    0x53, 0x81, 0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 
-    0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 0x4C, 0xEF, 0x00, 0x03, 0x00, 0x08, 0x0C, 0x81, 0x00, 0x00, 
-    0x00, 0x13, 0x6D, 0x3A, 0x74, 0x00, 0x14, 0x00, 0xE1, 0x48, 0x84, 0x40, 0x20, 0x02, 0x48, 0x42, 
-    0x80, 0x82, 0x24, 0x08, 0xE2, 0x0A, 0x64, 0x04, 0x10, 0xC0, 0x53, 0x81, 0xE2, 0x0A, 0x64, 0x04, 
-    0x30, 0xC0, 0x55, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 
-    0x20, 0xC0, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x41, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xC0, 0x51, 0xC9, 
-    0xFF, 0xFC, 0x20, 0x2F, 0x00, 0x04, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x73, 0x65, 0x74, 0x00, 
-    0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x70, 0x00, 0xB3, 0xC8, 0x67, 0x0A, 0x10, 0x18, 
-    0xB0, 0x19, 0x66, 0x08, 0x4A, 0x00, 0x66, 0xF6, 0x70, 0x00, 0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 
-    0x90, 0x81, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4C, 0xEF, 
-    0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 
-    0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 0x22, 0x48, 0x4A, 0x18, 0x66, 0xFC, 
-    0x91, 0xC9, 0x20, 0x08, 0x53, 0x80, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x6C, 0x65, 0x6E, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0xA0, 0x1F, 0x30, 0x38, 0x02, 0x20, 
-    0x48, 0xC0, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x53, 0x41, 0x5F, 0x44, 0x65, 0x6C, 0x65, 0x74, 
-    0x65, 0x50, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x23, 0x66, 0x02, 0xD8, 0x00, 0x0E, 0x4E, 0x56, 
-    0xFE, 0x38, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 
-    0x2D, 0x40, 0xFE, 0x46, 0x2D, 0x40, 0xFE, 0x4A, 0x2D, 0x40, 0xFE, 0x4E, 0x10, 0x1B, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x66, 0x08, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x07, 0xEE, 0x20, 0x6D, 
-    0xF6, 0x9E, 0x70, 0x08, 0xC0, 0x30, 0x68, 0x00, 0x67, 0x50, 0x20, 0x2E, 0xFE, 0x4A, 0x52, 0xAE, 
-    0xFE, 0x4A, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x0B, 0x94, 0x58, 0x4F, 
-    0x2E, 0x00, 0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 0x66, 0xCC, 0x20, 0x2E, 
-    0xFE, 0x4A, 0x53, 0xAE, 0xFE, 0x4A, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 0x15, 0x1C, 0x72, 0xFF, 
-    0xB2, 0x80, 0x50, 0x4F, 0x66, 0x96, 0x60, 0x00, 0x07, 0x84, 0x70, 0x25, 0xB0, 0x86, 0x66, 0x0E, 
-    0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x25, 0xB0, 0x86, 0x66, 0x50, 0x20, 0x2E, 
-    0xFE, 0x4A, 0x52, 0xAE, 0xFE, 0x4A, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x0B, 0x30, 0x58, 0x4F, 0x2E, 0x00, 0xBC, 0x87, 0x67, 0x00, 0xFF, 0x52, 0x20, 0x2E, 0xFE, 0x4A, 
-    0x53, 0xAE, 0xFE, 0x4A, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 0x14, 0xBE, 0x72, 0xFF, 0xB2, 0x80, 
-    0x50, 0x4F, 0x67, 0x00, 0x07, 0x28, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x07, 0x2E, 0x70, 0x01, 
-    0x2D, 0x40, 0xFE, 0x52, 0x72, 0x2A, 0xB2, 0x86, 0x66, 0x10, 0x20, 0x2E, 0xFE, 0x52, 0x53, 0xAE, 
-    0xFE, 0x52, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x7A, 0x00, 0x60, 0x1A, 0x22, 0x05, 
-    0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 0x2A, 0x01, 
-    0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x04, 0xC0, 0x30, 
-    0x68, 0x00, 0x66, 0xDA, 0x4A, 0x85, 0x66, 0x06, 0x2A, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2D, 0x46, 
-    0xFE, 0x56, 0x70, 0x6C, 0xB0, 0x86, 0x67, 0x18, 0x70, 0x68, 0xB0, 0xAE, 0xFE, 0x56, 0x67, 0x10, 
-    0x70, 0x4C, 0xB0, 0xAE, 0xFE, 0x56, 0x67, 0x08, 0x70, 0x4D, 0xB0, 0xAE, 0xFE, 0x56, 0x66, 0x08, 
-    0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x63, 0xB0, 0x86, 0x67, 0x5A, 0x70, 0x5B, 
-    0xB0, 0x86, 0x67, 0x54, 0x70, 0x6E, 0xB0, 0x86, 0x67, 0x4E, 0x20, 0x2E, 0xFE, 0x4A, 0x52, 0xAE, 
-    0xFE, 0x4A, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x0A, 0x54, 0x58, 0x4F, 
-    0x2E, 0x00, 0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 0x66, 0xCC, 0x20, 0x2E, 
-    0xFE, 0x4A, 0x53, 0xAE, 0xFE, 0x4A, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 0x13, 0xDC, 0x72, 0xFF, 
-    0xB2, 0x80, 0x50, 0x4F, 0x67, 0x00, 0x06, 0x46, 0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x01, 0xC0, 0x30, 
-    0x68, 0x00, 0x67, 0x0C, 0x70, 0x50, 0xB0, 0x86, 0x67, 0x06, 0x06, 0x86, 0x00, 0x00, 0x00, 0x20, 
-    0x70, 0x00, 0x2D, 0x40, 0xFE, 0x62, 0x22, 0x06, 0x04, 0x81, 0x00, 0x00, 0x00, 0x50, 0x6B, 0x00, 
-    0x05, 0xD8, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x28, 0x6E, 0x00, 0x05, 0xCE, 0xD2, 0x81, 0x32, 0x3B, 
-    0x18, 0x06, 0x4E, 0xFB, 0x10, 0x00, 0x01, 0x1E, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 
-    0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x00, 0x54, 0x05, 0xC4, 
-    0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 0x01, 0x2C, 0x02, 0x38, 
-    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x05, 0xC4, 0x02, 0x38, 0x05, 0xC4, 0x05, 0xC4, 0x05, 0xC4, 
-    0x05, 0xC4, 0x02, 0x00, 0x02, 0x28, 0x02, 0x38, 0x05, 0xC4, 0x05, 0xC4, 0x01, 0x36, 0x05, 0xC4, 
-    0x02, 0x38, 0x05, 0xC4, 0x05, 0xC4, 0x02, 0x30, 0x70, 0x5E, 0xB0, 0x13, 0x66, 0x0A, 0x70, 0x01, 
-    0x2D, 0x40, 0xFE, 0x7A, 0x52, 0x4B, 0x60, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x7A, 0x48, 0x78, 
-    0x01, 0x00, 0x4A, 0xAE, 0xFE, 0x7A, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x2F, 0x03, 
-    0x48, 0x6E, 0xFE, 0x7E, 0x4E, 0xAD, 0x02, 0xDA, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x28, 0x00, 
-    0x70, 0x5D, 0xB0, 0x84, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0x70, 0x2D, 0xB0, 0x84, 0x66, 0x72, 
-    0x41, 0xEE, 0xFE, 0x7E, 0x11, 0xAE, 0xFE, 0x7D, 0x40, 0x00, 0x52, 0x4B, 0x60, 0x64, 0x4A, 0x84, 
-    0x66, 0x08, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x05, 0x62, 0x70, 0x2D, 0xB0, 0x84, 0x66, 0x48, 
-    0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x76, 0x72, 0x5D, 0xB2, 0x80, 0x67, 0x38, 
-    0x10, 0x2B, 0xFF, 0xFE, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x72, 0xB0, 0xAE, 0xFE, 0x76, 
-    0x6E, 0x26, 0x20, 0x2E, 0xFE, 0x76, 0x90, 0xAE, 0xFE, 0x72, 0x2F, 0x00, 0x2F, 0x2E, 0xFE, 0x7A, 
-    0x30, 0x2E, 0xFE, 0x74, 0x41, 0xEE, 0xFE, 0x7F, 0x48, 0x70, 0x00, 0x00, 0x4E, 0xAD, 0x02, 0xDA, 
-    0x52, 0x4B, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x0A, 0x41, 0xEE, 0xFE, 0x7E, 0x11, 0xAE, 0xFE, 0x7D, 
-    0x40, 0x00, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x28, 0x00, 0x70, 0x5D, 0xB0, 0x84, 0x66, 0x8E, 
-    0x60, 0x18, 0x0C, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 0x2A, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0x0C, 0x85, 0x7F, 0xFF, 0xFF, 0xFF, 0x66, 0x02, 0x7A, 0x01, 0x4A, 0xAE, 0xFE, 0x52, 0x67, 0x0E, 
-    0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x60, 0x04, 0x30, 0x7C, 
-    0x00, 0x00, 0x2D, 0x48, 0xFE, 0x6E, 0x2D, 0x48, 0xFE, 0x6A, 0x60, 0x18, 0x4A, 0xAE, 0xFE, 0x52, 
-    0x67, 0x06, 0x20, 0x6E, 0xFE, 0x6E, 0x10, 0x87, 0x20, 0x2E, 0xFE, 0x6E, 0x52, 0xAE, 0xFE, 0x6E, 
-    0x53, 0x85, 0x67, 0x56, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 
-    0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 
-    0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x08, 0x5A, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 
-    0x67, 0x28, 0x70, 0x73, 0xB0, 0x86, 0x67, 0x06, 0x70, 0x50, 0xB0, 0x86, 0x66, 0x0C, 0x20, 0x6D, 
-    0xF6, 0x9E, 0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 0x66, 0x10, 0x70, 0x5B, 0xB0, 0x86, 0x66, 0x9C, 
-    0x41, 0xEE, 0xFE, 0x7E, 0x4A, 0x30, 0x70, 0x00, 0x67, 0x92, 0x20, 0x2E, 0xFE, 0x6E, 0xB0, 0xAE, 
-    0xFE, 0x6A, 0x67, 0x00, 0x03, 0xFA, 0x4A, 0xAE, 0xFE, 0x52, 0x67, 0x1C, 0x70, 0x63, 0xB0, 0x86, 
-    0x67, 0x06, 0x20, 0x6E, 0xFE, 0x6E, 0x42, 0x10, 0x70, 0x50, 0xB0, 0x86, 0x66, 0x0A, 0x2F, 0x2E, 
-    0xFE, 0x6A, 0x4E, 0xAD, 0x01, 0x92, 0x58, 0x4F, 0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 
-    0x60, 0x00, 0x03, 0xCC, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x52, 0x22, 0x2E, 0xFE, 0x4A, 0xD2, 0xAE, 
-    0xFE, 0x46, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x20, 0x81, 
-    0x22, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x60, 0x00, 0x03, 0xA4, 0x70, 0x08, 0x2D, 0x40, 
-    0xFE, 0x5A, 0x60, 0x0E, 0x70, 0x10, 0x2D, 0x40, 0xFE, 0x5A, 0x60, 0x06, 0x70, 0x0A, 0x2D, 0x40, 
-    0xFE, 0x5A, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x66, 0x2D, 0x40, 0xFE, 0x5E, 0x22, 0x2E, 0xFE, 0x46, 
-    0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x72, 0x00, 0x12, 0x10, 0x4A, 0x81, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x07, 0x82, 
-    0x22, 0x00, 0x58, 0x4F, 0x2E, 0x01, 0x70, 0x2D, 0xB0, 0x87, 0x67, 0x06, 0x70, 0x2B, 0xB0, 0x87, 
-    0x66, 0x3C, 0x70, 0x2D, 0xB0, 0x87, 0x66, 0x08, 0x20, 0x2E, 0xFE, 0x5E, 0x52, 0xAE, 0xFE, 0x5E, 
-    0x53, 0x85, 0x67, 0x00, 0x03, 0x3A, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 
-    0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 
-    0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x07, 0x38, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0x78, 
-    0xB0, 0x86, 0x67, 0x0E, 0x70, 0x69, 0xB0, 0x86, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x86, 0x66, 0x00, 
-    0x01, 0x20, 0x70, 0x30, 0xB0, 0x87, 0x66, 0x00, 0x01, 0x18, 0x53, 0x85, 0x66, 0x0C, 0x20, 0x2E, 
-    0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x60, 0x00, 0x01, 0x32, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 
-    0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0xE4, 0x58, 0x4F, 
-    0x2E, 0x00, 0x70, 0x58, 0xB0, 0x87, 0x67, 0x06, 0x70, 0x78, 0xB0, 0x87, 0x66, 0x38, 0x53, 0x85, 
-    0x67, 0x00, 0x02, 0xAC, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 
-    0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 
-    0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0xAA, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0x10, 0x2D, 0x40, 
-    0xFE, 0x5A, 0x60, 0x00, 0x00, 0x9C, 0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x70, 0x78, 
-    0xB0, 0x86, 0x67, 0x00, 0x00, 0x8C, 0x70, 0x08, 0x2D, 0x40, 0xFE, 0x5A, 0x60, 0x00, 0x00, 0x82, 
-    0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x04, 0xC0, 0x30, 0x78, 0x00, 0x67, 0x04, 0x70, 0x30, 0x60, 0x12, 
-    0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x01, 0xC0, 0x30, 0x78, 0x00, 0x67, 0x04, 0x70, 0x37, 0x60, 0x02, 
-    0x70, 0x57, 0x48, 0x80, 0x48, 0xC0, 0x22, 0x07, 0x92, 0x80, 0x2D, 0x41, 0xFE, 0x42, 0x20, 0x01, 
-    0xB0, 0xAE, 0xFE, 0x5A, 0x6C, 0x74, 0x20, 0x2E, 0xFE, 0x5A, 0x22, 0x2E, 0xFE, 0x66, 0x4E, 0xAD, 
-    0x00, 0x92, 0x22, 0x2E, 0xFE, 0x42, 0xD2, 0x80, 0x2D, 0x41, 0xFE, 0x66, 0x20, 0x2E, 0xFE, 0x62, 
-    0x52, 0xAE, 0xFE, 0x62, 0x53, 0x85, 0x67, 0x52, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 
-    0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 
-    0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x06, 0x58, 0x4F, 0x2E, 0x00, 
-    0x20, 0x6D, 0xF6, 0x9E, 0x70, 0x04, 0xC0, 0x30, 0x78, 0x00, 0x66, 0x00, 0xFF, 0x74, 0x70, 0x10, 
-    0xB0, 0xAE, 0xFE, 0x5A, 0x66, 0x14, 0x20, 0x6D, 0xF6, 0x9E, 0x10, 0x30, 0x78, 0x00, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0x80, 0xC2, 0x00, 0x66, 0x00, 0xFF, 0x58, 0x4A, 0xAE, 0xFE, 0x52, 0x67, 0x00, 
-    0x01, 0xAE, 0x4A, 0xAE, 0xFE, 0x62, 0x67, 0x00, 0x01, 0xA6, 0x4A, 0xAE, 0xFE, 0x5E, 0x67, 0x0A, 
-    0x20, 0x2E, 0xFE, 0x66, 0x44, 0x80, 0x2D, 0x40, 0xFE, 0x66, 0x20, 0x2E, 0xFE, 0x56, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x68, 0x67, 0x18, 0x59, 0x80, 0x66, 0x28, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAE, 0xFE, 0x66, 0x60, 0x00, 0x01, 0x72, 0x58, 0xAE, 
-    0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x30, 0xAE, 0xFE, 0x68, 0x60, 0x00, 
-    0x01, 0x5E, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAE, 
-    0xFE, 0x66, 0x60, 0x00, 0x01, 0x4A, 0x2D, 0x45, 0xFF, 0x88, 0x70, 0x50, 0xB0, 0x85, 0x6C, 0x02, 
-    0x7A, 0x50, 0x41, 0xEE, 0xFF, 0x90, 0x2D, 0x48, 0xFF, 0xE2, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 
-    0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x34, 0x58, 0x4F, 
-    0x2E, 0x00, 0x20, 0x2E, 0xFF, 0xE2, 0x52, 0xAE, 0xFF, 0xE2, 0x20, 0x40, 0x10, 0x87, 0x20, 0x6E, 
-    0xFF, 0xE2, 0x42, 0x10, 0x42, 0x6E, 0xFF, 0x8C, 0x48, 0x6E, 0xFF, 0x8E, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x48, 0x6E, 0xFF, 0x8C, 0x48, 0x6E, 0xFF, 0x90, 0x4E, 0xAD, 0x01, 0xA2, 0x53, 0x85, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x06, 0x4A, 0x6E, 0xFF, 0x8E, 0x66, 0xA0, 0x4A, 0x6E, 0xFF, 0x8C, 0x67, 0x14, 
-    0x4A, 0x85, 0x6E, 0x08, 0x70, 0x50, 0xB0, 0xAE, 0xFF, 0x88, 0x6D, 0x08, 0x20, 0x2E, 0xFE, 0x62, 
-    0x52, 0xAE, 0xFE, 0x62, 0x4A, 0xAE, 0xFE, 0x62, 0x67, 0x00, 0x00, 0xB4, 0x4A, 0xAE, 0xFE, 0x52, 
-    0x67, 0x00, 0x00, 0xAC, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x01, 0xB2, 0x3D, 0x40, 0xFE, 0x38, 
-    0x2D, 0x41, 0xFE, 0x3A, 0x2D, 0x48, 0xFE, 0x3E, 0x41, 0xEE, 0xFE, 0x38, 0x43, 0xEE, 0xFF, 0x7E, 
-    0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x20, 0x2E, 0xFE, 0x56, 0x04, 0x80, 0x00, 0x00, 0x00, 0x4C, 
-    0x58, 0x4F, 0x67, 0x26, 0x53, 0x80, 0x67, 0x3C, 0x04, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x66, 0x4E, 
-    0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0x7E, 
-    0x2F, 0x08, 0x3F, 0x3C, 0x08, 0x10, 0xA9, 0xEB, 0x60, 0x54, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x43, 0xEE, 0xFF, 0x7E, 0x45, 0xD0, 0x24, 0xD9, 0x24, 0xD9, 
-    0x34, 0xD9, 0x60, 0x3A, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 
-    0x48, 0x6E, 0xFF, 0x7E, 0x2F, 0x08, 0x3F, 0x3C, 0x30, 0x10, 0xA9, 0xEB, 0x60, 0x20, 0x58, 0xAE, 
-    0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0x7E, 0x2F, 0x08, 
-    0x3F, 0x3C, 0x10, 0x10, 0xA9, 0xEB, 0x60, 0x06, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x4C, 0x4A, 0xAE, 
-    0xFE, 0x62, 0x67, 0x08, 0x20, 0x2E, 0xFE, 0x52, 0xD1, 0xAE, 0xFE, 0x4E, 0x4A, 0x85, 0x6F, 0x1E, 
-    0x70, 0x6E, 0xB0, 0x86, 0x67, 0x18, 0x20, 0x2E, 0xFE, 0x46, 0x53, 0xAE, 0xFE, 0x46, 0x2F, 0x0C, 
-    0x2F, 0x07, 0x4E, 0xBA, 0x0D, 0xA4, 0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x67, 0x0E, 0x4A, 0xAE, 
-    0xFE, 0x62, 0x66, 0x00, 0xF8, 0x18, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x0E, 0x4A, 0xAE, 0xFE, 0x46, 
-    0x67, 0x06, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 0x1C, 0xF8, 0xFE, 0x18, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x64, 0x6F, 0x73, 0x63, 0x61, 0x6E, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x13, 0x18, 0x28, 0x6E, 0x00, 0x0C, 0x7C, 0x00, 0x76, 0x01, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x8C, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xA6, 0x2D, 0x6C, 0x00, 0x0C, 
-    0xFF, 0xF8, 0x60, 0x14, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0xDC, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 
-    0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x8A, 0x26, 0x6C, 0x00, 0x04, 0x2E, 0x2E, 0xFF, 0xF8, 
-    0x9E, 0x8B, 0x4A, 0x87, 0x6F, 0xDE, 0x2F, 0x07, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xCA, 0x2D, 0x40, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x0A, 
-    0x20, 0x2E, 0xFF, 0xFC, 0x90, 0x8B, 0x2E, 0x00, 0x53, 0x87, 0x9F, 0x94, 0xDF, 0xAC, 0x00, 0x04, 
-    0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x6C, 0x04, 0x72, 0x00, 0x60, 0x02, 
-    0x22, 0x14, 0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0xB8, 0x58, 0x4F, 0xDC, 0x87, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x22, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x12, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x5E, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x0C, 0x20, 0x06, 0x60, 0x08, 0xDF, 0xAE, 0x00, 0x08, 0x60, 0x00, 0xFF, 0x7A, 
-    0x4C, 0xEE, 0x18, 0xC8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x70, 0x75, 0x74, 0x73, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0xFF, 
-    0x20, 0x0C, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x6A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 
-    0x00, 0x83, 0xC2, 0x40, 0x67, 0x34, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x5C, 0x58, 0x4F, 0x2E, 0x00, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xCA, 0x4A, 0x80, 0x58, 0x4F, 
-    0x6C, 0x08, 0x7E, 0xFF, 0x70, 0x02, 0x2B, 0x40, 0xF5, 0x86, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x08, 0xC2, 0x40, 0x67, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0xA0, 0x1F, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x08, 0x42, 0x6C, 0x00, 0x12, 0x70, 0x00, 0x28, 0x80, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 
-    0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x63, 0x6C, 
-    0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x7E, 0x00, 0x20, 0x0C, 0x66, 0x36, 0x47, 0xED, 0xF6, 0xCA, 0x60, 0x1E, 0x70, 0x00, 
-    0x30, 0x2B, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x0E, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0xD8, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x02, 0x7E, 0x01, 0x47, 0xEB, 0x00, 0x16, 0xB7, 0xED, 0xF6, 0xC6, 
-    0x65, 0xDC, 0x4A, 0x87, 0x66, 0x04, 0x70, 0x00, 0x60, 0x5A, 0x70, 0xFF, 0x60, 0x56, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x66, 0x10, 0x70, 0x00, 0x28, 0x80, 0x70, 0x00, 
-    0x60, 0x42, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x3E, 0x58, 0x4F, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x04, 0xC2, 0x40, 0x66, 0x1C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 
-    0x67, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x0A, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x62, 0xD0, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 
-    0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 
-    0x66, 0x6C, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x49, 0xED, 
-    0xF6, 0xCA, 0x60, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0xFE, 0xAA, 0x58, 0x4F, 0x49, 0xEC, 0x00, 0x16, 
-    0xB9, 0xED, 0xF6, 0xC6, 0x65, 0xEE, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 
-    0x5F, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x03, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x41, 0xED, 0x03, 0x0A, 0x22, 0x6D, 0xF4, 0x78, 0x23, 0x48, 
-    0x00, 0x08, 0x2C, 0x2D, 0xF5, 0x86, 0x3E, 0x2D, 0xF5, 0x84, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x04, 0xC2, 0x40, 0x67, 0x0E, 0x42, 0x6C, 0x00, 0x10, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 
-    0x60, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 0x66, 0x44, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x08, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x12, 0x74, 0x40, 0xC4, 0x41, 0x67, 0x08, 
-    0x39, 0x7C, 0x00, 0x64, 0x00, 0x10, 0x60, 0x2A, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x78, 0x66, 0x03, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xE2, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x6D, 0x08, 0x39, 0x6E, 0xFF, 0xFE, 0x00, 0x10, 0x60, 0x06, 0x39, 0x7C, 0x04, 0x00, 
-    0x00, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x54, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0xA1, 0x1E, 
-    0x29, 0x48, 0x00, 0x08, 0x66, 0x32, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x0C, 0x40, 0x00, 0x64, 
-    0x63, 0x26, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x0C, 0x40, 0x04, 0x00, 0x63, 0x08, 0x20, 0x3C, 
-    0x00, 0x00, 0x04, 0x00, 0x60, 0x02, 0x70, 0x64, 0x39, 0x40, 0x00, 0x10, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x10, 0xA1, 0x1E, 0x29, 0x48, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x08, 0x00, 0x6C, 
-    0x00, 0x08, 0x00, 0x12, 0x60, 0x06, 0x00, 0x6C, 0x00, 0x04, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x10, 0xD0, 0xAC, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x02, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x14, 0x2F, 0x01, 
-    0x4E, 0xAD, 0x01, 0xE2, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x06, 0x00, 0x6C, 0x01, 0x00, 
-    0x00, 0x12, 0x2B, 0x46, 0xF5, 0x86, 0x3B, 0x47, 0xF5, 0x84, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x12, 0x32, 0x3C, 0x00, 0x81, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0xEC, 0x00, 0x6B, 0x00, 0x01, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x12, 0x72, 0x10, 0xC2, 0x40, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xD4, 0x4A, 0xAB, 
-    0x00, 0x08, 0x66, 0x08, 0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0x82, 0x58, 0x4F, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x12, 0x32, 0x3C, 0x01, 0x00, 0xC2, 0x40, 0x67, 0x3C, 0x49, 0xED, 0xF6, 0xCA, 0x60, 0x30, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x01, 0x02, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 
-    0x0C, 0x80, 0x00, 0x00, 0x01, 0x02, 0x66, 0x14, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x6A, 0x72, 0xFF, 
-    0xB2, 0x80, 0x58, 0x4F, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x86, 0x49, 0xEC, 0x00, 0x16, 
-    0xB9, 0xED, 0xF6, 0xC6, 0x65, 0xCA, 0x27, 0x6B, 0x00, 0x08, 0x00, 0x04, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x04, 0x70, 0x01, 0x60, 0x08, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x10, 0x4A, 0x80, 0x2F, 0x00, 0x2F, 0x2B, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x14, 
-    0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xD2, 0x26, 0x80, 0x53, 0x93, 0x4A, 0x93, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x6D, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x52, 0xAB, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 
-    0x60, 0x2E, 0x70, 0xFF, 0xB0, 0x93, 0x66, 0x1C, 0x00, 0x6B, 0x00, 0x10, 0x00, 0x12, 0x70, 0x00, 
-    0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x80, 0xC2, 0x40, 0x67, 0x0E, 0x02, 0x6B, 0xFF, 0xFE, 
-    0x00, 0x12, 0x60, 0x06, 0x00, 0x6B, 0x00, 0x20, 0x00, 0x12, 0x70, 0x00, 0x26, 0x80, 0x70, 0xFF, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x69, 0x6C, 0x62, 
-    0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 0x48, 0xE7, 0x11, 0x08, 0x1E, 0x2E, 0x00, 0x0B, 
-    0x28, 0x6E, 0x00, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x52, 0xC2, 0x40, 0x70, 0x00, 
-    0x30, 0x01, 0x72, 0x42, 0xB2, 0x80, 0x66, 0x48, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x0C, 
-    0x64, 0x00, 0x00, 0x8A, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 
-    0x10, 0x07, 0x0C, 0x40, 0x00, 0x0D, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 
-    0x01, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x0E, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x06, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x60, 0x00, 0x00, 0xE2, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x16, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x06, 
-    0xB2, 0x80, 0x66, 0x38, 0x1D, 0x47, 0xFF, 0xFF, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFF, 
-    0x72, 0x00, 0x32, 0x2C, 0x00, 0x14, 0x2F, 0x01, 0x4E, 0xAD, 0x01, 0xDA, 0x72, 0x01, 0xB2, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x0A, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 0x00, 0xA2, 
-    0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x96, 0x76, 0x01, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0xFC, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x46, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x56, 
-    0x53, 0x94, 0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 
-    0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x00, 0x10, 0x07, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xFE, 0xD2, 0x50, 0x4F, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x06, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x58, 0x4F, 
-    0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF2, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x6C, 0x73, 0x62, 
-    0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x26, 0x6C, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x04, 0x9E, 0x8B, 0x29, 0x4B, 0x00, 0x04, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x67, 0x04, 0x70, 0x00, 0x60, 0x08, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 0x72, 0x00, 0x32, 0x00, 0x28, 0x81, 0x20, 0x2C, 0x00, 0x0C, 
-    0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x6C, 0x04, 0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 
-    0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0xEC, 0x58, 0x4F, 0x4A, 0x87, 0x6F, 0x22, 0x2F, 0x07, 
-    0x2F, 0x0B, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xDA, 0xB0, 0x87, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0A, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x60, 0x02, 
-    0x70, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x78, 0x66, 
-    0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 
-    0x72, 0x02, 0xB2, 0x80, 0x67, 0x2E, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 
-    0xC2, 0x40, 0x66, 0x0A, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x60, 0x62, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0xEF, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0x82, 0x40, 
-    0x39, 0x41, 0x00, 0x12, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xFB, 0x5C, 
-    0x58, 0x4F, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x32, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x66, 0x26, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x28, 0x80, 
-    0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x6C, 0x04, 0x72, 0x00, 0x60, 0x02, 
-    0x22, 0x14, 0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x18, 0x58, 0x4F, 0x70, 0x00, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x77, 0x72, 0x74, 0x63, 0x68, 0x6B, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2C, 
-    0x00, 0x0C, 0x9E, 0xAC, 0x00, 0x04, 0x4A, 0x87, 0x6C, 0x08, 0x29, 0x6C, 0x00, 0x0C, 0x00, 0x04, 
-    0x60, 0x06, 0xBE, 0x94, 0x6C, 0x02, 0x28, 0x87, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x88, 0x5F, 0x62, 0x75, 0x66, 0x73, 0x79, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x49, 0xED, 0xF6, 0xCA, 0x60, 0x1C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x32, 0x3C, 0x00, 0x83, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x04, 0x20, 0x0C, 
-    0x60, 0x0C, 0x49, 0xEC, 0x00, 0x16, 0xB9, 0xED, 0xF6, 0xC6, 0x65, 0xDE, 0x70, 0x00, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x69, 0x6F, 0x70, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x10, 0x20, 0x0C, 0x66, 0x0C, 0x70, 0x17, 0x2B, 0x40, 0xF5, 0x86, 0x70, 0x00, 0x60, 0x00, 
-    0x01, 0x5E, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0x10, 0x66, 0x0C, 
-    0x70, 0x16, 0x2B, 0x40, 0xF5, 0x86, 0x70, 0x00, 0x60, 0x00, 0x01, 0x44, 0x76, 0x01, 0x70, 0x2B, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x2B, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2C, 0x03, 0x76, 0x01, 0x70, 0x62, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x62, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2A, 0x03, 0x76, 0x01, 0x70, 0x70, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x1E, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x02, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x2B, 0x00, 0x03, 
-    0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x28, 0x03, 0x10, 0x13, 0x04, 0x00, 0x00, 0x61, 
-    0x67, 0x2A, 0x04, 0x00, 0x00, 0x11, 0x67, 0x44, 0x5B, 0x00, 0x66, 0x52, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x48, 0x80, 0x32, 0x3C, 0x02, 0x00, 0x82, 0x40, 0x30, 0x3C, 
-    0x01, 0x00, 0x80, 0x41, 0x7E, 0x00, 0x3E, 0x00, 0x4A, 0x87, 0x60, 0x3C, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x72, 0x08, 0x82, 0x00, 0x70, 0x00, 0x10, 0x01, 0x32, 0x3C, 
-    0x01, 0x00, 0x82, 0x40, 0x7E, 0x00, 0x3E, 0x01, 0x4A, 0x87, 0x60, 0x1C, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x60, 0x0A, 0x70, 0x16, 
-    0x2B, 0x40, 0xF5, 0x86, 0x70, 0x00, 0x60, 0x66, 0x4A, 0x85, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 
-    0x08, 0x00, 0x4A, 0x84, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xAD, 0x01, 0xC2, 0x2A, 0x00, 0x50, 0x4F, 0x6C, 0x04, 0x70, 0x00, 0x60, 0x3E, 
-    0x70, 0x00, 0x28, 0x80, 0x39, 0x45, 0x00, 0x14, 0x4A, 0x86, 0x67, 0x06, 0x32, 0x3C, 0x00, 0x80, 
-    0x60, 0x10, 0x70, 0x72, 0xB0, 0x13, 0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x02, 0x48, 0x80, 
-    0x32, 0x00, 0x70, 0x00, 0x10, 0x01, 0x39, 0x40, 0x00, 0x12, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 
-    0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x08, 0x42, 0x6C, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0xF8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x65, 0x6E, 0x64, 0x6F, 0x70, 0x65, 
-    0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0xBA, 0xFE, 0x24, 0x2F, 0x00, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x5A, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 
-    0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x0F, 0x18, 0x26, 0x6E, 
-    0x00, 0x08, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x14, 0x4A, 0x85, 
-    0x63, 0x04, 0x4A, 0x84, 0x62, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0x84, 0x20, 0x04, 0x22, 0x05, 
-    0x4E, 0xAD, 0x00, 0x92, 0x2C, 0x00, 0x4A, 0x94, 0x6E, 0x28, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0xD2, 
-    0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x14, 0x20, 0x06, 0xD0, 0x85, 0x53, 0x80, 0x22, 0x05, 
-    0x4E, 0xAD, 0x00, 0xA2, 0x22, 0x04, 0x92, 0x80, 0x20, 0x01, 0x60, 0x52, 0x53, 0xAC, 0x00, 0x04, 
-    0x52, 0x94, 0xBC, 0x94, 0x64, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x14, 0x2E, 0x00, 0x2F, 0x07, 
-    0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xD2, 0xD0, 0x87, 0x26, 0x40, 0x9F, 0x94, 
-    0xDF, 0xAC, 0x00, 0x04, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x6C, 0x04, 
-    0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6F, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFD, 0x30, 0x58, 0x4F, 0x9C, 0x87, 0x4A, 0x86, 0x66, 0x8A, 0x20, 0x04, 0x4C, 0xEE, 
-    0x18, 0xF0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x14, 0x4A, 0x85, 0x63, 0x4E, 0x4A, 0x84, 0x63, 0x4A, 0x76, 0x01, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0xFC, 0x0C, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x0E, 0x20, 0x04, 0x22, 0x05, 
-    0x4E, 0xAD, 0x00, 0x92, 0x2C, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x6E, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x1A, 0x2F, 0x06, 
-    0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xDA, 
-    0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x28, 0x7E, 0x00, 0x60, 0x20, 0x2F, 0x0C, 0x20, 0x6E, 
-    0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xF9, 0xB4, 0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x52, 0x87, 0xBC, 0x87, 0x62, 0xDC, 
-    0x4A, 0x87, 0x6C, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xA0, 0xBC, 0x87, 0x66, 0x06, 0x20, 0x04, 
-    0x60, 0x00, 0x00, 0x96, 0x20, 0x07, 0x22, 0x05, 0x4E, 0xAD, 0x00, 0xA2, 0x60, 0x00, 0x00, 0x8A, 
-    0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x60, 0x22, 0x2F, 0x0C, 0x4E, 0xBA, 0xFA, 0xD8, 0x72, 0xFF, 
-    0xB2, 0x80, 0x58, 0x4F, 0x66, 0x14, 0x20, 0x06, 0xD0, 0x85, 0x53, 0x80, 0x22, 0x05, 0x4E, 0xAD, 
-    0x00, 0xA2, 0x22, 0x04, 0x92, 0x80, 0x20, 0x01, 0x60, 0x5E, 0x26, 0x6C, 0x00, 0x04, 0x2E, 0x2E, 
-    0xFF, 0xFC, 0x9E, 0x8B, 0x4A, 0x87, 0x6F, 0xD0, 0xBE, 0x86, 0x63, 0x04, 0x20, 0x06, 0x60, 0x02, 
-    0x20, 0x07, 0x2E, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xD2, 
-    0x9F, 0x94, 0xDF, 0xAC, 0x00, 0x04, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 
-    0x6C, 0x04, 0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6F, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xFB, 0xAE, 0x58, 0x4F, 0x9C, 0x87, 0x4A, 0x86, 0x66, 0x04, 0x20, 0x04, 
-    0x60, 0x06, 0xDF, 0xAE, 0x00, 0x08, 0x60, 0xA2, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x66, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x0F, 0x08, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x02, 0x6C, 0xFF, 0xEF, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x4A, 0x80, 0x08, 0x00, 
-    0x00, 0x00, 0x67, 0x00, 0x00, 0xA8, 0x70, 0x02, 0xB0, 0x84, 0x6F, 0x6A, 0x4A, 0xAC, 0x00, 0x08, 
-    0x67, 0x64, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x66, 0x58, 0x2E, 0x14, 
-    0x2C, 0x05, 0x4A, 0x84, 0x66, 0x20, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x74, 0x00, 
-    0x34, 0x2C, 0x00, 0x14, 0x2F, 0x02, 0x4E, 0xAD, 0x01, 0xFA, 0x22, 0x07, 0x92, 0x80, 0xDC, 0x81, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x02, 0x9A, 0x87, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 
-    0x00, 0x80, 0xC2, 0x40, 0x66, 0x20, 0x4A, 0x87, 0x6F, 0x1C, 0xBE, 0x86, 0x6D, 0x18, 0x20, 0x2C, 
-    0x00, 0x08, 0x90, 0xAC, 0x00, 0x04, 0xB0, 0x86, 0x6E, 0x0C, 0xDD, 0xAC, 0x00, 0x04, 0x9D, 0x94, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0x8E, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x80, 
-    0xC2, 0x40, 0x67, 0x0C, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 0x02, 0x6C, 0xFF, 0xFE, 0x00, 0x12, 
-    0x2F, 0x04, 0x2F, 0x05, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xFA, 
-    0x2C, 0x00, 0x70, 0x00, 0x28, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x4A, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 0xC2, 0x40, 0x67, 0x3C, 0x2F, 0x0C, 0x4E, 0xBA, 0xF4, 0xC8, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x80, 0xC2, 0x40, 0x58, 0x4F, 0x67, 0x10, 
-    0x70, 0x00, 0x28, 0x80, 0x02, 0x6C, 0xFF, 0xFD, 0x00, 0x12, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 
-    0x2F, 0x04, 0x2F, 0x05, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x01, 0xFA, 
-    0x2C, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x86, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x02, 
-    0x70, 0x00, 0x4C, 0xEE, 0x10, 0xF0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x73, 0x65, 
-    0x65, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x41, 0xEE, 0x00, 0x0C, 
-    0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xEA, 0x7E, 0x2E, 0x00, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 
-    0x73, 0x63, 0x61, 0x6E, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x04, 0x70, 0xFF, 
-    0x60, 0x42, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x01, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 
-    0x4A, 0x80, 0x67, 0x0A, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x62, 0x18, 0x20, 0x2C, 
-    0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x0A, 0x4A, 0x94, 0x66, 0x06, 0x52, 0xAC, 0x00, 0x04, 
-    0x60, 0x04, 0x70, 0xFF, 0x60, 0x0E, 0x53, 0xAC, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x04, 0x10, 0x87, 
-    0x52, 0x94, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x75, 
-    0x6E, 0x67, 0x65, 0x74, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 0x48, 0x6D, 0xF6, 0xE0, 0x2F, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0x01, 0xAE, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2D, 0xF6, 0xF2, 0x72, 0x20, 
-    0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x41, 0xEE, 
-    0x00, 0x0C, 0x26, 0x48, 0x58, 0x4B, 0x2F, 0x0C, 0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 
-    0x01, 0x62, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x01, 0x1C, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x76, 0x66, 0x70, 0x72, 0x69, 
-    0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEA, 0x48, 0xE7, 0x01, 0x08, 0x2D, 0x7C, 
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xEE, 0x2D, 0x6E, 0x00, 0x08, 
-    0xFF, 0xF2, 0x3D, 0x7C, 0x00, 0x02, 0xFF, 0xFC, 0x3D, 0x7C, 0x00, 0x14, 0xFF, 0xFE, 0x41, 0xEE, 
-    0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x48, 0x6E, 0xFF, 0xEA, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0x00, 0xB0, 0x2E, 0x00, 0x20, 0x6E, 0xFF, 0xEE, 0x42, 0x10, 0x20, 0x07, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xE2, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEA, 0x2F, 0x07, 0x2D, 0x7C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 
-    0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xEE, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xF2, 0x3D, 0x7C, 0x00, 0x02, 
-    0xFF, 0xFC, 0x3D, 0x7C, 0x00, 0x14, 0xFF, 0xFE, 0x48, 0x6E, 0xFF, 0xEA, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x00, 0x5C, 0x2E, 0x00, 0x20, 0x6E, 0xFF, 0xEE, 0x42, 0x10, 
-    0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xE6, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x76, 0x73, 0x70, 0x72, 0x69, 
-    0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x08, 
-    0x70, 0x61, 0xB0, 0x87, 0x6E, 0x08, 0x20, 0x07, 0x72, 0x57, 0x90, 0x81, 0x60, 0x14, 0x70, 0x41, 
-    0xB0, 0x87, 0x6E, 0x08, 0x20, 0x07, 0x72, 0x37, 0x90, 0x81, 0x60, 0x06, 0x20, 0x07, 0x72, 0x30, 
-    0x90, 0x81, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x74, 0x6F, 0x69, 0x6E, 0x74, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0x3A, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x6E, 0x00, 0x10, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x3E, 0x26, 0x6E, 0x00, 0x08, 0x60, 0x08, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x67, 0x06, 
-    0x70, 0x25, 0xB0, 0x86, 0x66, 0xE4, 0x2E, 0x2E, 0x00, 0x08, 0x9E, 0x8B, 0x67, 0x68, 0xDF, 0xAE, 
-    0xFF, 0x3E, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x28, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 0x10, 0x13, 0x4A, 0x80, 0x60, 0x46, 
-    0x2F, 0x0C, 0x70, 0x00, 0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 0xF4, 0xDA, 0x50, 0x4F, 0x60, 0x36, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 0xB2, 0x80, 0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xAD, 0x02, 0xD2, 0xD0, 0x87, 0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x12, 0x2F, 0x0C, 0x2F, 0x07, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xFA, 0x30, 0x4F, 0xEF, 0x00, 0x10, 0x4A, 0x86, 0x66, 0x1A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x20, 0xC2, 0x40, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x0A, 0x80, 0x20, 0x2E, 0xFF, 0x3E, 
-    0x60, 0x00, 0x0A, 0x78, 0x42, 0xAE, 0xFF, 0x58, 0x42, 0xAE, 0xFF, 0x54, 0x42, 0x6E, 0xFF, 0x52, 
-    0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x20, 0x67, 0x26, 0x57, 0x80, 0x67, 0x2C, 0x51, 0x80, 0x67, 0x0A, 
-    0x55, 0x80, 0x67, 0x10, 0x57, 0x80, 0x67, 0x2A, 0x60, 0x32, 0x30, 0x2E, 0xFF, 0x52, 0x52, 0x6E, 
-    0xFF, 0x52, 0x60, 0xCC, 0x30, 0x2E, 0xFF, 0x54, 0x52, 0x6E, 0xFF, 0x54, 0x60, 0xC2, 0x30, 0x2E, 
-    0xFF, 0x56, 0x52, 0x6E, 0xFF, 0x56, 0x60, 0xB8, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 
-    0x60, 0xAE, 0x30, 0x2E, 0xFF, 0x5A, 0x52, 0x6E, 0xFF, 0x5A, 0x60, 0xA4, 0x70, 0x2A, 0xB0, 0x86, 
-    0x66, 0x2C, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x46, 
-    0x6C, 0x12, 0x20, 0x2E, 0xFF, 0x46, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x46, 0x30, 0x2E, 0xFF, 0x54, 
-    0x52, 0x6E, 0xFF, 0x54, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x3E, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x46, 0x60, 0x1E, 0x22, 0x2E, 0xFF, 0x46, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 
-    0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 0x2D, 0x41, 0xFF, 0x46, 0x20, 0x2E, 0x00, 0x08, 
-    0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 
-    0x70, 0x30, 0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 0xB0, 0x86, 0x6C, 0xCA, 0x20, 0x6E, 0x00, 0x08, 
-    0x70, 0x2E, 0xB0, 0x10, 0x67, 0x04, 0x7A, 0xFF, 0x60, 0x5A, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 
-    0x00, 0x08, 0x70, 0x2A, 0xB0, 0x10, 0x66, 0x16, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x2A, 0x28, 0xFF, 0xFC, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x36, 0x7A, 0x00, 
-    0x60, 0x1A, 0x22, 0x05, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 
-    0x92, 0x80, 0x2A, 0x01, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x30, 0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 
-    0xB0, 0x86, 0x6C, 0xCE, 0x42, 0x6E, 0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x04, 0x00, 
-    0x00, 0x4C, 0x67, 0x1A, 0x04, 0x00, 0x00, 0x1C, 0x67, 0x06, 0x59, 0x00, 0x67, 0x08, 0x60, 0x16, 
-    0x3D, 0x7C, 0xFF, 0xFE, 0xFF, 0x5C, 0x30, 0x2E, 0xFF, 0x5C, 0x52, 0x6E, 0xFF, 0x5C, 0x20, 0x2E, 
-    0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x41, 0xFA, 0x09, 0x56, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 
-    0xFF, 0xE4, 0x42, 0x10, 0x2D, 0x48, 0xFF, 0x66, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x2D, 0x40, 
-    0xFF, 0x4A, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x12, 0x10, 0x48, 0x81, 0x48, 0xC1, 
-    0x2C, 0x01, 0x67, 0x00, 0x06, 0xA6, 0x04, 0x81, 0x00, 0x00, 0x00, 0x45, 0x67, 0x00, 0x01, 0xEE, 
-    0x55, 0x81, 0x67, 0x00, 0x05, 0x18, 0x04, 0x81, 0x00, 0x00, 0x00, 0x09, 0x67, 0x00, 0x06, 0x16, 
-    0x51, 0x81, 0x67, 0x5C, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0B, 0x67, 0x00, 0x05, 0xAE, 0x53, 0x81, 
-    0x67, 0x36, 0x53, 0x81, 0x67, 0x00, 0x01, 0xC6, 0x53, 0x81, 0x67, 0x00, 0x03, 0xAA, 0x53, 0x81, 
-    0x67, 0x00, 0x04, 0xEA, 0x55, 0x81, 0x67, 0x20, 0x5B, 0x81, 0x67, 0x00, 0x06, 0x22, 0x53, 0x81, 
-    0x67, 0x1E, 0x53, 0x81, 0x67, 0x22, 0x57, 0x81, 0x67, 0x00, 0x05, 0x9E, 0x55, 0x81, 0x67, 0x08, 
-    0x57, 0x81, 0x67, 0x1C, 0x60, 0x00, 0x05, 0x6E, 0x70, 0x0A, 0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x16, 
-    0x70, 0x08, 0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 
-    0x70, 0x10, 0x2D, 0x40, 0xFF, 0x5E, 0x4A, 0x85, 0x6D, 0x04, 0x42, 0x6E, 0xFF, 0x5A, 0x4A, 0x6E, 
-    0xFF, 0x5C, 0x6F, 0x10, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0x6A, 0x60, 0x36, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0x6A, 0x4A, 0x6E, 0xFF, 0x5C, 0x6C, 0x22, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 0x70, 0x69, 
-    0xB0, 0x86, 0x66, 0x0C, 0x30, 0x2E, 0xFF, 0x6C, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x0A, 
-    0x70, 0x00, 0x30, 0x2E, 0xFF, 0x6C, 0x2D, 0x40, 0xFF, 0x6A, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 
-    0x70, 0x69, 0xB0, 0x86, 0x66, 0x38, 0x4A, 0xAE, 0xFF, 0x6A, 0x6C, 0x14, 0x41, 0xFA, 0x08, 0x04, 
-    0x2D, 0x48, 0xFF, 0x62, 0x20, 0x2E, 0xFF, 0x6A, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x1E, 
-    0x4A, 0x6E, 0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x07, 0xE8, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 
-    0x4A, 0x6E, 0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x07, 0xD6, 0x2D, 0x48, 0xFF, 0x62, 0x76, 0x01, 
-    0x70, 0x58, 0xB0, 0x86, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x86, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x08, 0x41, 0xFA, 0x07, 0xE8, 0x20, 0x08, 0x60, 0x06, 0x41, 0xFA, 0x07, 0xCE, 0x20, 0x08, 
-    0x2D, 0x40, 0xFF, 0x84, 0x41, 0xEE, 0xFF, 0x8C, 0x26, 0x48, 0x47, 0xEB, 0x00, 0x0B, 0x2D, 0x4B, 
-    0xFF, 0x42, 0x60, 0x24, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 0x4E, 0xAD, 0x00, 0xB2, 
-    0x20, 0x6E, 0xFF, 0x84, 0x17, 0x30, 0x08, 0x00, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 
-    0x4E, 0xAD, 0x00, 0xA2, 0x2D, 0x40, 0xFF, 0x6A, 0x4A, 0xAE, 0xFF, 0x6A, 0x66, 0xD6, 0x20, 0x2E, 
-    0xFF, 0x42, 0x90, 0x8B, 0x2D, 0x40, 0xFF, 0x6E, 0x4A, 0x6E, 0xFF, 0x58, 0x67, 0x56, 0x70, 0x6F, 
-    0xB0, 0x86, 0x66, 0x22, 0x4A, 0x85, 0x6D, 0x12, 0x20, 0x2E, 0xFF, 0x6E, 0x52, 0x80, 0xB0, 0x85, 
-    0x6F, 0x42, 0x2A, 0x2E, 0xFF, 0x6E, 0x52, 0x85, 0x60, 0x3A, 0x20, 0x2E, 0xFF, 0x6E, 0x44, 0x80, 
-    0x2A, 0x00, 0x53, 0x85, 0x60, 0x2E, 0x4A, 0xAE, 0xFF, 0x6E, 0x67, 0x28, 0x20, 0x06, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x58, 0x67, 0x16, 0x04, 0x80, 0x00, 0x00, 0x00, 0x18, 0x67, 0x04, 0x51, 0x80, 
-    0x66, 0x12, 0x41, 0xFA, 0x07, 0x32, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x08, 0x41, 0xFA, 0x07, 0x24, 
-    0x2D, 0x48, 0xFF, 0x62, 0x4A, 0x85, 0x6C, 0x06, 0x20, 0x05, 0x44, 0x80, 0x60, 0x02, 0x20, 0x05, 
-    0x90, 0xAE, 0xFF, 0x6E, 0x2D, 0x40, 0xFF, 0x4A, 0x60, 0x00, 0x04, 0xB6, 0x4A, 0x85, 0x6C, 0x02, 
-    0x7A, 0x06, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 
-    0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x22, 0x05, 0x52, 0x81, 0x74, 0x13, 0xB4, 0x81, 
-    0x6F, 0x06, 0x22, 0x05, 0x52, 0x81, 0x60, 0x02, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0xFF, 0x7C, 
-    0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x02, 0xBA, 0x26, 0x40, 
-    0x4F, 0xEF, 0x00, 0x1E, 0x4A, 0xAE, 0xFF, 0x80, 0x67, 0x0A, 0x41, 0xFA, 0x06, 0x96, 0x2D, 0x48, 
-    0xFF, 0x62, 0x60, 0x1E, 0x4A, 0x6E, 0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x06, 0x84, 0x2D, 0x48, 
-    0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x06, 0x72, 0x2D, 0x48, 
-    0xFF, 0x62, 0x41, 0xEE, 0xFF, 0x8C, 0x2D, 0x48, 0xFF, 0x42, 0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 
-    0x00, 0xCA, 0x70, 0x4E, 0xB0, 0x13, 0x67, 0x00, 0x00, 0xC2, 0x4A, 0x13, 0x67, 0x04, 0x10, 0x1B, 
-    0x60, 0x02, 0x70, 0x30, 0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 
-    0x4A, 0x85, 0x66, 0x06, 0x4A, 0x6E, 0xFF, 0x58, 0x67, 0x0E, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 
-    0xFF, 0x42, 0x20, 0x40, 0x10, 0xBC, 0x00, 0x2E, 0x2D, 0x45, 0xFF, 0x4E, 0x60, 0x10, 0x20, 0x2E, 
-    0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 0x10, 0x9B, 0x53, 0xAE, 0xFF, 0x4E, 0x4A, 0xAE, 
-    0xFF, 0x4E, 0x6F, 0x04, 0x4A, 0x13, 0x66, 0xE6, 0x2E, 0x2E, 0xFF, 0x7C, 0x53, 0x87, 0x4A, 0x87, 
-    0x6C, 0x06, 0x20, 0x07, 0x44, 0x80, 0x2E, 0x00, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x00, 0xAA, 
-    0x72, 0x30, 0xD0, 0x01, 0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x20, 0x07, 
-    0x72, 0x0A, 0x4E, 0xAD, 0x00, 0x9A, 0x2E, 0x00, 0x66, 0xDE, 0x41, 0xEE, 0xFF, 0xE4, 0x55, 0x48, 
-    0xB1, 0xEE, 0xFF, 0x66, 0x65, 0xD2, 0x4A, 0xAE, 0xFF, 0x7C, 0x6F, 0x04, 0x70, 0x2B, 0x60, 0x02, 
-    0x70, 0x2D, 0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x70, 0x5A, 0xB0, 0x86, 
-    0x6D, 0x04, 0x70, 0x45, 0x60, 0x02, 0x70, 0x65, 0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 
-    0x10, 0x80, 0x47, 0xEE, 0xFF, 0x8C, 0x60, 0x00, 0x03, 0x58, 0x42, 0x6E, 0xFF, 0x5A, 0x70, 0x49, 
-    0xB0, 0x13, 0x66, 0x10, 0x48, 0x7A, 0x05, 0x98, 0x2F, 0x2E, 0xFF, 0x42, 0x4E, 0xAD, 0x02, 0xEA, 
-    0x50, 0x4F, 0x60, 0x5C, 0x48, 0x7A, 0x05, 0x7E, 0x2F, 0x2E, 0xFF, 0x42, 0x4E, 0xAD, 0x02, 0xEA, 
-    0x10, 0x2B, 0x00, 0x03, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0xDA, 0xE9, 0x80, 
-    0x2E, 0x00, 0x10, 0x2B, 0x00, 0x04, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0xC8, 
-    0xDE, 0x80, 0x78, 0x06, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x00, 0xAA, 
-    0x72, 0x30, 0xD0, 0x01, 0x22, 0x04, 0x53, 0x84, 0xD2, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 
-    0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x00, 0x9A, 0x2E, 0x00, 0x70, 0x04, 0xB0, 0x84, 0x6F, 0xD8, 
-    0x26, 0x6E, 0xFF, 0x42, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xF2, 0xD0, 0x8B, 0x2D, 0x40, 0xFF, 0x42, 
-    0x58, 0x4F, 0x60, 0x00, 0x02, 0xCC, 0x4A, 0x85, 0x6C, 0x02, 0x7A, 0x06, 0x06, 0xAE, 0x00, 0x00, 
-    0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 
-    0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 
-    0xFF, 0x7C, 0x2F, 0x05, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 
-    0xFF, 0xE6, 0x4E, 0xAD, 0x02, 0xBA, 0x26, 0x40, 0x4F, 0xEF, 0x00, 0x1E, 0x4A, 0xAE, 0xFF, 0x80, 
-    0x67, 0x0A, 0x41, 0xFA, 0x04, 0xBE, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x1E, 0x4A, 0x6E, 0xFF, 0x52, 
-    0x67, 0x0A, 0x41, 0xFA, 0x04, 0xAC, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 0xFF, 0x56, 
-    0x67, 0x08, 0x41, 0xFA, 0x04, 0x9A, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 0xFF, 0x8C, 0x2D, 0x48, 
-    0xFF, 0x42, 0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 0xFE, 0xF2, 0x70, 0x4E, 0xB0, 0x13, 0x67, 0x00, 
-    0xFE, 0xEA, 0x20, 0x6E, 0xFF, 0x62, 0x4A, 0x10, 0x66, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 
-    0x48, 0x80, 0x48, 0xC0, 0x22, 0x2E, 0xFF, 0x7C, 0xD2, 0x80, 0x76, 0x01, 0x4A, 0x85, 0x6E, 0x08, 
-    0x4A, 0x6E, 0xFF, 0x58, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x06, 0x20, 0x05, 0x52, 0x80, 
-    0x60, 0x02, 0x70, 0x00, 0xD0, 0x81, 0x72, 0x50, 0xB2, 0x80, 0x6C, 0x06, 0x7A, 0x12, 0x60, 0x00, 
-    0xFD, 0x6C, 0x2E, 0x2E, 0xFF, 0x7C, 0x76, 0x01, 0x4A, 0x87, 0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 0x60, 0x02, 0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 
-    0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x53, 0x87, 0x6E, 0xDA, 0x4A, 0x6E, 0xFF, 0x58, 
-    0x66, 0x04, 0x4A, 0x85, 0x6F, 0x0E, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 
-    0x10, 0xBC, 0x00, 0x2E, 0x2E, 0x05, 0x60, 0x28, 0x76, 0x01, 0x52, 0xAE, 0xFF, 0x7C, 0x4A, 0xAE, 
-    0xFF, 0x7C, 0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 
-    0x60, 0x02, 0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 
-    0x53, 0x87, 0x6C, 0xD4, 0x47, 0xEE, 0xFF, 0x8C, 0x60, 0x00, 0x01, 0x86, 0x4A, 0x85, 0x6C, 0x04, 
-    0x7A, 0x06, 0x60, 0x06, 0x4A, 0x85, 0x66, 0x02, 0x7A, 0x01, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 
-    0x22, 0xD8, 0x32, 0xD8, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 
-    0x72, 0x13, 0xB2, 0x85, 0x6F, 0x04, 0x22, 0x05, 0x60, 0x02, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 
-    0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x02, 0xBA, 
-    0x26, 0x40, 0x28, 0x05, 0x4A, 0x6E, 0xFF, 0x58, 0x4F, 0xEF, 0x00, 0x1E, 0x66, 0x26, 0x2F, 0x0B, 
-    0x4E, 0xAD, 0x02, 0xF2, 0x2E, 0x00, 0xB8, 0x87, 0x58, 0x4F, 0x6F, 0x06, 0x28, 0x07, 0x60, 0x02, 
-    0x53, 0x84, 0x70, 0x01, 0xB0, 0x84, 0x6E, 0x0C, 0x20, 0x04, 0x53, 0x80, 0x72, 0x30, 0xB2, 0x33, 
-    0x08, 0x00, 0x67, 0xEC, 0x70, 0xFD, 0xB0, 0xAE, 0xFF, 0x7C, 0x6E, 0x06, 0xBA, 0xAE, 0xFF, 0x7C, 
-    0x6C, 0x08, 0x2A, 0x04, 0x53, 0x85, 0x60, 0x00, 0xFC, 0x8C, 0x2A, 0x04, 0x9A, 0xAE, 0xFF, 0x7C, 
-    0x60, 0x00, 0xFE, 0x5A, 0x1D, 0x46, 0xFF, 0x8C, 0x60, 0x0E, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 
-    0x00, 0x0C, 0x1D, 0x68, 0xFF, 0xFF, 0xFF, 0x8C, 0x47, 0xEE, 0xFF, 0x8C, 0x20, 0x0B, 0x52, 0x80, 
-    0x2D, 0x40, 0xFF, 0x42, 0x60, 0x00, 0x00, 0xBA, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x26, 0x68, 0xFF, 0xFC, 0x2D, 0x4B, 0xFF, 0x42, 0x4A, 0x85, 0x6C, 0x10, 0x2F, 0x0B, 0x4E, 0xAD, 
-    0x02, 0xF2, 0xD1, 0xAE, 0xFF, 0x42, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x2E, 0xFF, 0x42, 
-    0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 0x4A, 0x10, 0x67, 0x04, 0x53, 0x85, 0x6C, 0xEE, 0x53, 0xAE, 
-    0xFF, 0x42, 0x60, 0x7C, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 
-    0x52, 0x4B, 0x2D, 0x4B, 0xFF, 0x42, 0x76, 0x01, 0x4A, 0x85, 0x6D, 0x0C, 0x70, 0x00, 0x10, 0x2B, 
-    0xFF, 0xFF, 0xB0, 0x85, 0x6D, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x2B, 
-    0xFF, 0xFF, 0x4A, 0x80, 0x60, 0x02, 0x20, 0x05, 0xD1, 0xAE, 0xFF, 0x42, 0x60, 0x42, 0x2D, 0x4B, 
-    0xFF, 0x42, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x88, 
-    0x4A, 0x6E, 0xFF, 0x5C, 0x66, 0x0A, 0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x20, 
-    0x4A, 0x6E, 0xFF, 0x5C, 0x6F, 0x0A, 0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x10, 
-    0x20, 0x6E, 0xFF, 0x88, 0x30, 0xAE, 0xFF, 0x40, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x02, 0x2C, 
-    0x4A, 0xAE, 0xFF, 0x4E, 0x6C, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4A, 
-    0x6C, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4A, 0x2F, 0x2E, 0xFF, 0x62, 0x4E, 0xAD, 0x02, 0xF2, 
-    0x22, 0x2E, 0xFF, 0x4A, 0xD2, 0x80, 0x20, 0x2E, 0xFF, 0x4E, 0xD0, 0x81, 0x2E, 0x2E, 0xFF, 0x42, 
-    0x9E, 0x8B, 0xD0, 0x87, 0x41, 0xEE, 0xFF, 0xDE, 0xD0, 0x88, 0x5C, 0x80, 0x28, 0x00, 0x98, 0xAE, 
-    0xFF, 0x66, 0x4A, 0x6E, 0xFF, 0x5A, 0x58, 0x4F, 0x67, 0x1A, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x14, 
-    0xB8, 0xAE, 0xFF, 0x46, 0x6C, 0x0E, 0x20, 0x2E, 0xFF, 0x46, 0x90, 0x84, 0xD1, 0xAE, 0xFF, 0x4A, 
-    0x28, 0x2E, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 0x6C, 0x06, 0x20, 0x2E, 0xFF, 0x46, 0x60, 0x02, 
-    0x20, 0x04, 0xD1, 0xAE, 0xFF, 0x3E, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x68, 0x60, 0x24, 0x53, 0x94, 
-    0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x20, 
-    0x70, 0x20, 0x4A, 0x80, 0x60, 0x0C, 0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xBA, 0xEB, 0x96, 
-    0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 0x6F, 0xD2, 0x60, 0x36, 0x53, 0x94, 
-    0x4A, 0x94, 0x6D, 0x1A, 0x20, 0x6E, 0xFF, 0x62, 0x52, 0xAE, 0xFF, 0x62, 0x22, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x12, 0x90, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x16, 0x2F, 0x0C, 
-    0x20, 0x6E, 0xFF, 0x62, 0x52, 0xAE, 0xFF, 0x62, 0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xEB, 0x54, 0x50, 0x4F, 0x20, 0x6E, 0xFF, 0x62, 0x4A, 0x10, 0x66, 0xC2, 0x60, 0x24, 0x53, 0x94, 
-    0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 
-    0x70, 0x30, 0x4A, 0x80, 0x60, 0x0C, 0x2F, 0x0C, 0x70, 0x30, 0x2F, 0x00, 0x4E, 0xBA, 0xEB, 0x26, 
-    0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4A, 0x4A, 0xAE, 0xFF, 0x4A, 0x6C, 0xD2, 0x4A, 0x87, 0x6F, 0x00, 
-    0x00, 0x8C, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x28, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 0x10, 0x13, 0x4A, 0x80, 0x60, 0x6C, 
-    0x2F, 0x0C, 0x70, 0x00, 0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 0xEA, 0xEA, 0x50, 0x4F, 0x60, 0x5C, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 0xB2, 0x80, 0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xAD, 0x02, 0xD2, 0xD0, 0x87, 0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x38, 0x2F, 0x0C, 0x2F, 0x07, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xF0, 0x40, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x24, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 0x70, 0x30, 0x4A, 0x80, 0x60, 0x0C, 
-    0x2F, 0x0C, 0x70, 0x30, 0x2F, 0x00, 0x4E, 0xBA, 0xEA, 0x8C, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4E, 
-    0x4A, 0xAE, 0xFF, 0x4E, 0x6C, 0xD2, 0x60, 0x36, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x1A, 0x20, 0x6E, 
-    0xFF, 0x66, 0x52, 0xAE, 0xFF, 0x66, 0x22, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x90, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x16, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x66, 0x52, 0xAE, 
-    0xFF, 0x66, 0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0xEA, 0x4A, 0x50, 0x4F, 0x20, 0x6E, 
-    0xFF, 0x66, 0x4A, 0x10, 0x66, 0xC2, 0x60, 0x24, 0x53, 0x94, 0x4A, 0x94, 0x6D, 0x12, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x20, 0x70, 0x20, 0x4A, 0x80, 0x60, 0x0C, 
-    0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xBA, 0xEA, 0x1C, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 
-    0xB8, 0xAE, 0xFF, 0x46, 0x6F, 0xD2, 0x60, 0x00, 0xF4, 0xDC, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x1E, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x64, 0x6F, 0x70, 0x72, 0x6E, 0x74, 0x00, 0x42, 0x20, 0x00, 
-    0x2B, 0x00, 0x2D, 0x00, 0x4E, 0x41, 0x4E, 0x28, 0x30, 0x30, 0x30, 0x29, 0x00, 0x00, 0x49, 0x4E, 
-    0x46, 0x00, 0x30, 0x58, 0x00, 0x00, 0x30, 0x78, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 
-    0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 
-    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x09, 0xCC, 0x03, 0x48, 0x00, 0x01, 0x4E, 0x56, 0xFF, 0xB6, 0x48, 0xE7, 0x01, 0x18, 
-    0x4A, 0x2D, 0xFF, 0xFA, 0x67, 0x00, 0x00, 0x82, 0x48, 0x6E, 0xFF, 0xB9, 0x48, 0x6E, 0xFF, 0xB8, 
-    0x48, 0x6E, 0xFF, 0xB7, 0x48, 0x6E, 0xFF, 0xBA, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x12, 
-    0x2F, 0x28, 0x00, 0x30, 0x30, 0x28, 0x00, 0x16, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xAD, 0x02, 0x1A, 
-    0x3E, 0x00, 0x4A, 0x2E, 0xFF, 0xB7, 0x4F, 0xEF, 0x00, 0x1C, 0x67, 0x06, 0x30, 0x3C, 0xFA, 0xEA, 
-    0x60, 0x56, 0x4A, 0x47, 0x66, 0x3E, 0x4A, 0x2E, 0xFF, 0xB8, 0x67, 0x3C, 0x20, 0x6E, 0x00, 0x08, 
-    0x31, 0x6E, 0xFF, 0xBA, 0x00, 0x16, 0x20, 0x6E, 0x00, 0x08, 0x21, 0x6E, 0xFF, 0xBC, 0x00, 0x30, 
-    0x41, 0xEE, 0xFF, 0xC0, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xC0, 0xD0, 0x88, 0x20, 0x40, 0x42, 0x28, 
-    0x00, 0x01, 0x20, 0x6E, 0x00, 0x08, 0x26, 0x68, 0x00, 0x12, 0x49, 0xEE, 0xFF, 0xC0, 0x16, 0xDC, 
-    0x66, 0xFC, 0x60, 0x04, 0x30, 0x07, 0x60, 0x10, 0x55, 0x8F, 0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 
-    0x1F, 0x00, 0x4E, 0xAD, 0x01, 0x42, 0x30, 0x1F, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xAA, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x0C, 0x53, 0x4C, 
-    0x52, 0x4C, 0x4A, 0x14, 0x66, 0xFA, 0x41, 0xEE, 0x00, 0x0C, 0x58, 0x48, 0x2D, 0x48, 0xFF, 0xFC, 
-    0x60, 0x18, 0x53, 0x4C, 0x60, 0x06, 0x20, 0x6E, 0x00, 0x08, 0x53, 0x50, 0x20, 0x6E, 0x00, 0x08, 
-    0x4A, 0x50, 0x67, 0x06, 0x52, 0x4C, 0x18, 0x9B, 0x66, 0xEC, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0x50, 
-    0x67, 0x10, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0x26, 0x68, 0xFF, 0xFC, 0x20, 0x0B, 
-    0x66, 0xD0, 0x20, 0x2E, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x20, 0x0B, 0x67, 0x4A, 
-    0x4A, 0x13, 0x67, 0x46, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0x2D, 0xFF, 0xFE, 0x67, 0x16, 0x10, 0x13, 
-    0x52, 0x00, 0x1E, 0x00, 0x60, 0x02, 0x18, 0xDB, 0x10, 0x07, 0x53, 0x07, 0x4A, 0x00, 0x66, 0xF6, 
-    0x42, 0x14, 0x60, 0x2C, 0x2D, 0x4B, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 
-    0x20, 0x40, 0x52, 0x4C, 0x18, 0x90, 0x66, 0xF0, 0x20, 0x0B, 0x32, 0x2E, 0xFF, 0xFE, 0x92, 0x40, 
-    0x53, 0x01, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x81, 0x60, 0x06, 0x20, 0x6E, 0x00, 0x08, 0x42, 0x10, 
-    0x20, 0x2E, 0x00, 0x08, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x2F, 0x07, 0x70, 0x00, 0x30, 0x2D, 0xFA, 0x84, 0x72, 0x10, 0xC2, 0x40, 0x67, 0x04, 
-    0x4E, 0xBA, 0x00, 0xF2, 0x2F, 0x3C, 0x00, 0x00, 0xA1, 0xAD, 0x4E, 0xAD, 0x00, 0xC2, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x40, 0x55, 0x8F, 0x2F, 0x3C, 0x66, 0x6F, 0x6C, 0x64, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0xAD, 0x01, 0x82, 0x3E, 0x1F, 0x70, 0x01, 0xC0, 0xAE, 0xFF, 0xFC, 0x67, 0x06, 0x1B, 0x7C, 
-    0x00, 0x01, 0xFF, 0xFC, 0x55, 0x8F, 0x2F, 0x3C, 0x61, 0x6C, 0x69, 0x73, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0xAD, 0x01, 0x82, 0x3E, 0x1F, 0x70, 0x01, 0xC0, 0xAE, 0xFF, 0xFC, 0x67, 0x06, 0x1B, 0x7C, 
-    0x00, 0x01, 0xFF, 0xFA, 0x4A, 0x2E, 0x00, 0x13, 0x67, 0x06, 0x00, 0x6D, 0x00, 0x08, 0xF9, 0x72, 
-    0x00, 0x6D, 0x00, 0x10, 0xFA, 0x84, 0x00, 0x6D, 0x00, 0x10, 0xF9, 0x72, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x6D, 0xF9, 0x84, 0x4E, 0xBA, 0xFF, 0x0A, 0x2B, 0x40, 0xFB, 0xDA, 0x70, 0x00, 0x2B, 0x40, 
-    0xFB, 0xD4, 0x42, 0x6D, 0xFB, 0xDE, 0x42, 0x2D, 0xFB, 0xE2, 0x1B, 0x7C, 0x00, 0x01, 0xFB, 0xE3, 
-    0x2B, 0x40, 0xFB, 0xE4, 0x41, 0xED, 0xFB, 0xFA, 0x2B, 0x48, 0xFB, 0xE8, 0x2B, 0x7C, 0x00, 0x00, 
-    0x04, 0x00, 0xFB, 0xEC, 0x3B, 0x7C, 0x00, 0x01, 0xFB, 0xF4, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x6D, 
-    0xFA, 0x96, 0x4E, 0xBA, 0xFE, 0xCC, 0x2B, 0x40, 0xFB, 0xA8, 0x70, 0x00, 0x2B, 0x40, 0xFB, 0xA2, 
-    0x42, 0x6D, 0xFB, 0xAC, 0x42, 0x2D, 0xFB, 0xB0, 0x1B, 0x7C, 0x00, 0x01, 0xFB, 0xB1, 0x2B, 0x40, 
-    0xFB, 0xB2, 0x41, 0xED, 0xFB, 0xFA, 0x2B, 0x48, 0xFB, 0xB6, 0x2B, 0x7C, 0x00, 0x00, 0x04, 0x00, 
-    0xFB, 0xBA, 0x3B, 0x7C, 0x00, 0x01, 0xFB, 0xC2, 0x4F, 0xEF, 0x00, 0x10, 0x2E, 0x2E, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x00, 0x30, 0x2D, 0xF9, 0x72, 0x72, 0x02, 
-    0xC2, 0x40, 0x67, 0x10, 0x55, 0x8F, 0x2F, 0x2D, 0xF9, 0x74, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 
-    0x00, 0xDA, 0x54, 0x4F, 0x70, 0x00, 0x30, 0x2D, 0xFA, 0x84, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x10, 
-    0x55, 0x8F, 0x2F, 0x2D, 0xFA, 0x86, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x00, 0xDA, 0x54, 0x4F, 
-    0x3B, 0x7C, 0x00, 0x09, 0xFA, 0x84, 0x42, 0x6D, 0xF9, 0x72, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 
-    0xFF, 0xEA, 0x48, 0xE7, 0x00, 0x18, 0x47, 0xED, 0xF9, 0x50, 0x49, 0xEE, 0xFF, 0xEA, 0x3D, 0x7C, 
-    0x00, 0x1E, 0xFF, 0xFE, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xAD, 0x00, 0x8A, 0x42, 0x13, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4A, 0x2E, 0x00, 0x0F, 0x67, 0x08, 0x41, 0xED, 0xF8, 0x8E, 
-    0x22, 0x08, 0x60, 0x06, 0x41, 0xED, 0xF8, 0x98, 0x22, 0x08, 0x2F, 0x01, 0x2F, 0x0B, 0x48, 0x6E, 
-    0xFF, 0xFE, 0x4E, 0xBA, 0xFD, 0x9E, 0x4F, 0xEF, 0x00, 0x1C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xE2, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x14, 
-    0x48, 0x6D, 0xF8, 0xA0, 0x70, 0x00, 0x10, 0x2E, 0x00, 0x1B, 0x2F, 0x00, 0x30, 0x2E, 0x00, 0x12, 
-    0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x88, 0x50, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFD, 0x5C, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x03, 0x18, 0x3C, 0x2E, 0x00, 0x12, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x14, 
-    0x55, 0x8F, 0x2F, 0x2C, 0x00, 0x02, 0x70, 0x00, 0x1F, 0x00, 0x4E, 0xAD, 0x00, 0xE2, 0x3E, 0x1F, 
-    0x0C, 0x47, 0xFF, 0xD9, 0x66, 0x32, 0x20, 0x6C, 0x00, 0x02, 0x4A, 0xA8, 0x00, 0x28, 0x66, 0x54, 
-    0x70, 0x00, 0x30, 0x14, 0x72, 0x01, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF8, 0xA2, 0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0x76, 
-    0x70, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x2E, 0x4A, 0x47, 0x67, 0x28, 0x70, 0x00, 0x30, 0x14, 
-    0x72, 0x01, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x2F, 0x00, 0x48, 0x6D, 0xF8, 0xC4, 0x48, 0xC6, 
-    0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0x4A, 0x70, 0x00, 0x4F, 0xEF, 
-    0x00, 0x14, 0x60, 0x02, 0x70, 0x01, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x13, 0x18, 0x26, 0x6E, 0x00, 0x14, 0x3E, 0x2E, 0x00, 0x12, 
-    0x20, 0x6B, 0x00, 0x02, 0x70, 0x00, 0x21, 0x40, 0x00, 0x2E, 0x2F, 0x0B, 0x48, 0xC7, 0x2F, 0x07, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFF, 0x42, 0x4A, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xE4, 0x3C, 0x2D, 0xFB, 0xFA, 0x6E, 0x06, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0xD8, 0x49, 0xED, 0xFB, 0xFE, 0x0C, 0x46, 0x00, 0xFF, 0x5D, 0xC3, 
-    0x44, 0x03, 0x67, 0x04, 0x30, 0x06, 0x60, 0x04, 0x30, 0x3C, 0x00, 0xFF, 0x48, 0xC0, 0xE5, 0x80, 
-    0xD0, 0x8C, 0x59, 0x80, 0x2D, 0x40, 0xFF, 0xFC, 0x04, 0x46, 0x00, 0xFF, 0x20, 0x6E, 0xFF, 0xFC, 
-    0xBE, 0x50, 0x6E, 0x58, 0x60, 0x02, 0x58, 0x4C, 0xBE, 0x54, 0x6E, 0xFA, 0xBE, 0x54, 0x6C, 0x06, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0x98, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x20, 0x6B, 0x00, 0x02, 
-    0x21, 0x40, 0x00, 0x2E, 0x2F, 0x0B, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xFE, 0xC8, 0x4A, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x6A, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xFB, 0xFA, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xFB, 0xFE, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x50, 0x4A, 0x46, 0x6E, 0x04, 
-    0x70, 0x00, 0x60, 0x48, 0x2F, 0x0B, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x88, 0x4A, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x2A, 0x49, 0xED, 0xFB, 0xFA, 0x0C, 0x46, 0x01, 0x00, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x30, 0x06, 0x60, 0x04, 0x30, 0x3C, 0x01, 0x00, 0x48, 0xC0, 0xE5, 0x80, 0xD0, 0x8C, 0x59, 0x80, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x04, 0x46, 0x01, 0x00, 0x60, 0x00, 0xFF, 0x52, 0x4C, 0xEE, 0x18, 0xC8, 
-    0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x11, 0x18, 0x2D, 0x6D, 
-    0xF3, 0x34, 0xFF, 0xFC, 0x67, 0x06, 0x4A, 0xAE, 0x00, 0x08, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 
-    0x01, 0x3C, 0x4A, 0x2E, 0x00, 0x0F, 0x67, 0x00, 0x01, 0x28, 0x60, 0x00, 0x00, 0x92, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x28, 0x50, 0x26, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x1E, 0x1C, 0x4A, 0x87, 0x60, 0x0C, 
-    0x4A, 0x13, 0x67, 0x68, 0x20, 0x07, 0x53, 0x87, 0x52, 0x4C, 0x52, 0x4B, 0x4A, 0x87, 0x67, 0x5C, 
-    0x76, 0x00, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x00, 0x00, 0x61, 0x65, 0x0C, 0x70, 0x00, 0x10, 0x14, 
-    0x0C, 0x00, 0x00, 0x7A, 0x62, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 
-    0x90, 0x7C, 0x00, 0x20, 0x60, 0x06, 0x70, 0x00, 0x10, 0x14, 0x4A, 0x80, 0x76, 0x00, 0x72, 0x00, 
-    0x12, 0x13, 0x0C, 0x01, 0x00, 0x61, 0x65, 0x0C, 0x72, 0x00, 0x12, 0x13, 0x0C, 0x01, 0x00, 0x7A, 
-    0x62, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0A, 0x72, 0x00, 0x12, 0x13, 0x92, 0x7C, 0x00, 0x20, 
-    0x60, 0x06, 0x72, 0x00, 0x12, 0x13, 0x4A, 0x81, 0xB2, 0x40, 0x67, 0x94, 0x4A, 0x87, 0x66, 0x06, 
-    0x20, 0x0C, 0x60, 0x00, 0x00, 0xA8, 0x20, 0x2E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x4A, 0x90, 0x66, 0x00, 0xFF, 0x68, 0x60, 0x00, 0x00, 0x90, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x28, 0x50, 0x26, 0x6E, 0x00, 0x08, 0x60, 0x08, 0x4A, 0x14, 0x67, 0x60, 0x52, 0x4C, 0x52, 0x4B, 
-    0x76, 0x00, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x00, 0x00, 0x61, 0x65, 0x0C, 0x70, 0x00, 0x10, 0x14, 
-    0x0C, 0x00, 0x00, 0x7A, 0x62, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 
-    0x90, 0x7C, 0x00, 0x20, 0x60, 0x06, 0x70, 0x00, 0x10, 0x14, 0x4A, 0x80, 0x76, 0x00, 0x72, 0x00, 
-    0x12, 0x13, 0x0C, 0x01, 0x00, 0x61, 0x65, 0x0C, 0x72, 0x00, 0x12, 0x13, 0x0C, 0x01, 0x00, 0x7A, 
-    0x62, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0A, 0x72, 0x00, 0x12, 0x13, 0x92, 0x7C, 0x00, 0x20, 
-    0x60, 0x06, 0x72, 0x00, 0x12, 0x13, 0x4A, 0x81, 0xB2, 0x40, 0x67, 0x9C, 0x10, 0x14, 0xB0, 0x13, 
-    0x66, 0x06, 0x52, 0x4C, 0x20, 0x0C, 0x60, 0x14, 0x20, 0x2E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x4A, 0x90, 0x66, 0x00, 0xFF, 0x74, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x88, 
-    0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xFA, 0x48, 0xE7, 0x1F, 0x18, 0x3E, 0x2E, 
-    0x00, 0x0E, 0x42, 0x45, 0x3D, 0x7C, 0x00, 0xFE, 0xFF, 0xFA, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 
-    0x30, 0x10, 0x7C, 0x01, 0xCC, 0x40, 0x70, 0x00, 0x30, 0x10, 0x72, 0x10, 0xC2, 0x40, 0x70, 0x00, 
-    0x30, 0x01, 0x4A, 0x80, 0x66, 0x12, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x01, 
-    0x4E, 0xBA, 0xFA, 0xCC, 0x4F, 0xEF, 0x00, 0x0C, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xFC, 0x4A, 0x2D, 
-    0xFF, 0xFE, 0x67, 0x0E, 0x20, 0x2E, 0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x20, 0x40, 0x10, 0xBC, 
-    0x00, 0x01, 0x20, 0x6E, 0xFF, 0xFC, 0x42, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x30, 0x10, 
-    0x72, 0x04, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x00, 0x02, 0x02, 0x20, 0x68, 
-    0x00, 0x02, 0x70, 0x00, 0x21, 0x40, 0x00, 0x30, 0x20, 0x6E, 0x00, 0x10, 0x4A, 0x28, 0x00, 0x12, 
-    0x57, 0xC3, 0x44, 0x03, 0x18, 0x03, 0x67, 0x42, 0x49, 0xE8, 0x00, 0x12, 0x2F, 0x2D, 0xF9, 0x6E, 
-    0x2F, 0x28, 0x00, 0x06, 0x4E, 0xBA, 0xFE, 0x00, 0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 0x67, 0x06, 
-    0x52, 0x4C, 0x18, 0x9B, 0x66, 0xFA, 0x20, 0x6E, 0x00, 0x10, 0x26, 0x68, 0x00, 0x0A, 0x18, 0xDB, 
-    0x66, 0xFC, 0x20, 0x0C, 0x20, 0x6E, 0x00, 0x10, 0x41, 0xE8, 0x00, 0x12, 0x22, 0x08, 0x90, 0x41, 
-    0x55, 0x00, 0x20, 0x6E, 0x00, 0x10, 0x11, 0x40, 0x00, 0x12, 0x20, 0x6E, 0x00, 0x10, 0x4A, 0x28, 
-    0x00, 0x12, 0x67, 0x16, 0x2F, 0x28, 0x00, 0x02, 0x4E, 0xBA, 0xF8, 0xAE, 0x3A, 0x00, 0x58, 0x4F, 
-    0x66, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x02, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 
-    0x30, 0x10, 0x72, 0x02, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x00, 0x00, 0xEC, 
-    0x4A, 0x04, 0x67, 0x00, 0x00, 0xE6, 0x4A, 0x06, 0x67, 0x00, 0x00, 0xE0, 0x49, 0xE8, 0x00, 0x12, 
-    0x26, 0x68, 0x00, 0x0A, 0x52, 0x4C, 0x18, 0x9B, 0x66, 0xFA, 0x20, 0x0C, 0x20, 0x6E, 0x00, 0x10, 
-    0x41, 0xE8, 0x00, 0x12, 0x22, 0x08, 0x90, 0x41, 0x53, 0x00, 0x20, 0x6E, 0x00, 0x10, 0x11, 0x40, 
-    0x00, 0x12, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0x00, 0x02, 0x31, 0x78, 0x02, 0x10, 0x00, 0x16, 
-    0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x02, 0x4E, 0xBA, 0xF8, 0x3E, 0x3A, 0x00, 0x58, 0x4F, 
-    0x66, 0x0C, 0x20, 0x6E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x02, 0x60, 0x00, 0x00, 0x8E, 0x4A, 0x2D, 
-    0xFF, 0xFC, 0x67, 0x00, 0x00, 0x86, 0x55, 0x8F, 0x3F, 0x3C, 0x80, 0x00, 0x2F, 0x3C, 0x70, 0x72, 
-    0x65, 0x66, 0x70, 0x00, 0x1F, 0x00, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0x00, 0x02, 0x48, 0x68, 
-    0x00, 0x16, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0x00, 0x02, 0x48, 0x68, 0x00, 0x30, 0x4E, 0xAD, 
-    0x01, 0x7A, 0x3A, 0x1F, 0x66, 0x54, 0x20, 0x6E, 0x00, 0x10, 0x49, 0xE8, 0x00, 0x12, 0x26, 0x68, 
-    0x00, 0x0E, 0x52, 0x4C, 0x18, 0x9B, 0x66, 0xFA, 0x20, 0x6E, 0x00, 0x10, 0x26, 0x68, 0x00, 0x0A, 
-    0x53, 0x4C, 0x52, 0x4C, 0x18, 0x9B, 0x66, 0xFA, 0x20, 0x0C, 0x20, 0x6E, 0x00, 0x10, 0x41, 0xE8, 
-    0x00, 0x12, 0x22, 0x08, 0x90, 0x41, 0x53, 0x00, 0x20, 0x6E, 0x00, 0x10, 0x11, 0x40, 0x00, 0x12, 
-    0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x02, 0x4E, 0xBA, 0xF7, 0xAE, 0x3A, 0x00, 0x58, 0x4F, 
-    0x66, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x02, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 
-    0x30, 0x10, 0x72, 0x02, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x68, 0x4A, 0x06, 
-    0x67, 0x64, 0xBE, 0x45, 0x66, 0x60, 0x0C, 0x47, 0xFF, 0xD6, 0x66, 0x5A, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6D, 0xF8, 0xE8, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xF8, 0x14, 
-    0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x30, 0x10, 0x72, 0x08, 0xC2, 0x40, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xF8, 0xFC, 0x70, 0x00, 0x10, 0x06, 
-    0x2F, 0x00, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xFA, 0x06, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF8, 0xFE, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xF7, 0xD6, 0x4F, 0xEF, 
-    0x00, 0x18, 0x60, 0x00, 0x00, 0xAE, 0x20, 0x6E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x04, 0x20, 0x6E, 
-    0x00, 0x10, 0x70, 0x00, 0x30, 0x10, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x78, 0x2F, 0x08, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xFA, 0xE4, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x3E, 0x20, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x30, 0x10, 0x72, 0x08, 
-    0xC2, 0x40, 0x67, 0x6E, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xF9, 0x02, 0x70, 0x00, 0x10, 0x06, 
-    0x2F, 0x00, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xF9, 0x96, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 
-    0xF9, 0x04, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xF7, 0x66, 0x4F, 0xEF, 
-    0x00, 0x18, 0x60, 0x3E, 0x70, 0x00, 0x10, 0x06, 0x2F, 0x00, 0x48, 0x6D, 0xF9, 0x08, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xF9, 0xB8, 0x4F, 0xEF, 
-    0x00, 0x14, 0x60, 0x1E, 0x70, 0x00, 0x10, 0x06, 0x2F, 0x00, 0x48, 0x6D, 0xF9, 0x2C, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x2E, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFA, 0x4E, 0xBA, 0xF9, 0x98, 0x4F, 0xEF, 
-    0x00, 0x14, 0x4A, 0x2D, 0xFF, 0xFE, 0x67, 0x0E, 0x30, 0x3C, 0x00, 0xFE, 0x90, 0x2E, 0xFF, 0xFB, 
-    0x20, 0x6E, 0x00, 0x08, 0x10, 0x80, 0x20, 0x2E, 0x00, 0x08, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xDE, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xFA, 0x84, 0x30, 0x2E, 0x00, 0x0A, 
-    0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0xFC, 0xAC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x00, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x20, 0x31, 
-    0x2E, 0x30, 0x2C, 0x20, 0xA9, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x70, 
-    0x75, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x31, 0x39, 0x39, 0x37, 0x00, 
-    0x00, 0x00, 0x18, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x0D, 0x43, 0x2B, 
-    0x2B, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x20, 0x31, 0x2E, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0xA5, 0x9B, 0x00, 0x00, 0xA4, 0x9B, 0x00, 0x00, 0x00, 0xE9, 0x01, 0x76, 0xA4, 0xC8, 0x18, 
-    0xFA, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xB2, 0x00, 0x01, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x08, 0x00, 
-    0x12, 0x76, 0x65, 0x72, 0x73, 0x00, 0x01, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x14, 0x00, 0x03, 0x64, 0x01, 0x76, 0xA5, 
-    0x78, 0x00, 0x02, 0x00, 0x05, 0x20, 0x00, 0x36, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-    0x0D, 0x20, 0x00, 0x36, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x15, 0x20, 0x00, 0x4D, 
-    0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1C, 0x20, 0x00, 0x58, 0x48, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x00, 0x22, 0x20, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 
-    0x2A, 0x20, 0x00, 0x77, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x00, 0x9A, 
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0xA4, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x00, 0xA4, 0x7F, 0x01, 0x76, 0xA5, 0xD0, 0x04, 0x4D, 0x61, 
-    0x69, 0x6E, 0x07, 0x53, 0x41, 0x4E, 0x45, 0x4C, 0x49, 0x42, 0x07, 0x25, 0x41, 0x35, 0x49, 0x6E, 
-    0x69, 0x74, 0x06, 0x49, 0x4E, 0x54, 0x45, 0x4E, 0x56, 0x05, 0x53, 0x41, 0x44, 0x45, 0x56, 0x07, 
-    0x53, 0x54, 0x44, 0x43, 0x4C, 0x49, 0x42, 0x05, 0x53, 0x54, 0x44, 0x49, 0x4F, 0x06, 0x45, 0x72, 
-    0x72, 0x4D, 0x67, 0x72, 
-};
-
-unsigned char *gAppResource = rsrc;
-unsigned int gAppResourceSize = sizeof(rsrc);
+MOS_INCBIN("rsrc_dumpaif.bin")
+unsigned int gAppResourceCompressed = 1;
 
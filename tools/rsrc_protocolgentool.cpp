@@ -1,6590 +1,6 @@
 
 #include "rsrc.h"
 
-unsigned char rsrc[] = {
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x9A, 0x45, 0x00, 0x01, 0x99, 0x45, 0x00, 0x00, 0x01, 0x04, 
-    0x72, 0x69, 0x70, 0x74, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x73, 
-    0x0D, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
-    0x0F, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 0x54, 0x6F, 0x6F, 0x6C, 
-    0x44, 0x44, 0x4B, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x61, 0x6E, 
-    0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0x80, 0x01, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xB1, 0x00, 0xAB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x49, 0x3A, 0x20, 
-    0x2A, 0x2F, 0x0D, 0x65, 0x6E, 0x75, 0x6D, 0x20, 0x7B, 0x0D, 0x09, 0x65, 0x72, 0x72, 0x41, 0x53, 
-    0x43, 0x61, 0x6E, 0x74, 0x43, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x41, 0x6E, 0x64, 0x49, 
-    0x67, 0x6E, 0x6F, 0x72, 0x65, 0x09, 0x3D, 0x20, 0x2D, 0x32, 0x37, 0x32, 0x30, 0x2C, 0x0D, 0x09, 
-    0x65, 0x72, 0x72, 0x41, 0x53, 0x43, 0x61, 0x6E, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 
-    0x4D, 0x6F, 0x72, 0x65, 0x54, 0x68, 0x61, 0x6E, 0x33, 0x32, 0x6B, 0x09, 0x3D, 0x20, 0x2D, 0x32, 
-    0x37, 0x32, 0x31, 0x2C, 0x0D, 0x2F, 0x2A, 0x20, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x43, 
-    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x3A, 0x20, 
-    0x2A, 0x2F, 0x0D, 0x09, 0x65, 0x72, 0x72, 0x41, 0x53, 0x54, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x6F, 
-    0x00, 0x00, 0x05, 0x08, 0x00, 0x00, 0x05, 0x18, 0x00, 0x00, 0xD7, 0x48, 0x00, 0x00, 0x04, 0xF8, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x09, 0xA9, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x25, 0xD6, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x52, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x05, 0x08, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x05, 0xC4, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x06, 0x5A, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x06, 0xCC, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x0C, 0x34, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x0C, 0xBE, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x0D, 0x44, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x0E, 0x40, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x0F, 0x4A, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x11, 0x7A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x12, 0x5E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x12, 0xE0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x13, 0x2E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x14, 0xD0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x15, 0x7E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x16, 0xB0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x17, 0xC6, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x18, 0x64, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x18, 0xFE, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x19, 0xDA, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1A, 0x44, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1A, 0x68, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1A, 0xD4, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1C, 0x2A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1D, 0x48, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1F, 0x84, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x20, 0x24, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x20, 0x48, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x20, 0x6C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x20, 0xBC, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x21, 0x4A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x22, 0xAA, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x26, 0x48, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x26, 0x76, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x26, 0xE4, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x26, 0xFE, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x27, 0x50, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x27, 0x76, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x27, 0x9A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x27, 0xC4, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x27, 0xEE, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x28, 0x16, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x28, 0x44, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x28, 0x80, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x28, 0xAC, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x28, 0xD8, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x29, 0x04, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x29, 0x32, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x29, 0x60, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x29, 0x8E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x29, 0xBA, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x29, 0xEC, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x2A, 0x14, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x2D, 0x82, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x2D, 0xC0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x2E, 0x04, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x2E, 0x8C, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x3C, 0xC0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x8C, 0x32, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x8C, 0x7A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x8D, 0x40, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x8D, 0xE4, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x8E, 0x4C, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x8E, 0xB8, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x90, 0x28, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x92, 0x2C, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x93, 0x2A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x93, 0xF6, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x94, 0x96, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x97, 0xF2, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x98, 0xE4, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x9B, 0x18, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x04, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x6A, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x9A, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0xA6, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x05, 0x1C, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x06, 0x36, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x06, 0x8C, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x06, 0xEC, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x07, 0x2E, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x07, 0x5A, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x07, 0x72, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0x24, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x02, 0x6E, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0xBA, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x0F, 0x3E, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x10, 0xB0, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x11, 0xD4, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x18, 0x3E, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x18, 0x60, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x9E, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0xC8, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0xEE, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x02, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x18, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x3E, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x52, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x66, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x05, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x9E, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x10, 0x00, 0x05, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0xA8, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x05, 0xA9, 0xF0, 
-    0x00, 0x00, 0x05, 0x5A, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x00, 0x09, 0x58, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x1E, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0xAA, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0x46, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x0D, 0x26, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x0E, 0x4C, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x11, 0xE0, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x17, 0x96, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x17, 0xF0, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x18, 0x7A, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x19, 0x40, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x19, 0x78, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x19, 0xBE, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x19, 0xF4, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1A, 0x36, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1A, 0xD2, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1D, 0x0E, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x22, 0x3E, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x23, 0x88, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x25, 0x18, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x25, 0x78, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x08, 0xA9, 0xF0, 
-    0x00, 0x00, 0x26, 0x32, 0x00, 0x08, 0xA9, 0xF0, 0x00, 0x00, 0x2B, 0x76, 0x00, 0x00, 0x07, 0x5A, 
-    0x00, 0x00, 0x00, 0x01, 0x70, 0x30, 0xA3, 0x1E, 0x4A, 0x40, 0x66, 0x72, 0x30, 0x38, 0x09, 0x34, 
-    0x2B, 0x88, 0x00, 0x0C, 0x4A, 0x78, 0x02, 0x8E, 0x6D, 0x2E, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 
-    0x22, 0x48, 0x30, 0x3C, 0xA0, 0x90, 0xA3, 0x46, 0xB3, 0xC8, 0x67, 0x1C, 0x9E, 0xFC, 0x00, 0x10, 
-    0x41, 0xD7, 0x70, 0x02, 0xA0, 0x90, 0x0C, 0x68, 0x00, 0x01, 0x00, 0x06, 0x56, 0xC0, 0x41, 0xFA, 
-    0x00, 0x52, 0x10, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x61, 0x00, 0x01, 0xBC, 0x61, 0x00, 0x00, 0xF4, 
-    0x61, 0x00, 0x01, 0x46, 0x41, 0xFA, 0x00, 0x24, 0x20, 0x97, 0x20, 0x4D, 0xD0, 0xF8, 0x09, 0x34, 
-    0x4E, 0xA8, 0x00, 0x12, 0x61, 0x00, 0x01, 0xEC, 0x20, 0x4D, 0xD0, 0xF8, 0x09, 0x34, 0x20, 0x68, 
-    0x00, 0x0C, 0xA0, 0x1F, 0x20, 0x7A, 0x00, 0x04, 0x4E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x75, 
-    0x80, 0x0E, 0x33, 0x32, 0x5F, 0x62, 0x69, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x3A, 0x00, 0x00, 0xFF, 0xFA, 0x67, 0x1E, 0x0C, 0x38, 0x00, 0x00, 
-    0x01, 0x2F, 0x67, 0x16, 0x30, 0x3C, 0xA1, 0x98, 0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 0xA8, 0x9F, 
-    0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x04, 0x70, 0x01, 0xA1, 0x98, 0x4E, 0x75, 0x80, 0x0B, 0x66, 0x6C, 
-    0x75, 0x73, 0x68, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x00, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 
-    0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0B, 0x70, 0x72, 0x65, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 0x53, 0x65, 
-    0x67, 0x00, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0C, 0x70, 0x6F, 
-    0x73, 0x74, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 
-    0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0D, 0x70, 0x72, 0x65, 0x5F, 0x55, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 
-    0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0D, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0xFF, 0x9C, 0x00, 0x02, 0xFF, 0xB4, 0x00, 0x03, 0xFF, 0xCC, 0x00, 0x04, 0xFF, 0xE6, 
-    0x00, 0x00, 0x48, 0xE7, 0x80, 0xE0, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x69, 0x00, 0x0C, 
-    0x45, 0xFA, 0xFF, 0xDE, 0x30, 0x1A, 0x67, 0x0A, 0x30, 0x5A, 0x41, 0xFB, 0x80, 0xD4, 0x61, 0x1A, 
-    0x60, 0xF2, 0x4C, 0xDF, 0x07, 0x01, 0x4E, 0x75, 0x80, 0x0D, 0x73, 0x65, 0x74, 0x75, 0x70, 0x5F, 
-    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x00, 0x00, 0xD0, 0x40, 0xD0, 0x40, 0x2F, 0x31, 
-    0x00, 0x00, 0x23, 0x88, 0x00, 0x00, 0x20, 0x5F, 0x4E, 0x75, 0x80, 0x0A, 0x73, 0x65, 0x74, 0x5F, 
-    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x00, 0x00, 0x48, 0xE7, 0x80, 0xC0, 0x42, 0x40, 0x61, 0x00, 
-    0x04, 0xD0, 0xB0, 0xFC, 0x00, 0x00, 0x66, 0x02, 0xA9, 0xFF, 0x59, 0x8F, 0x2F, 0x08, 0xA9, 0xA5, 
-    0x20, 0x5F, 0xD0, 0xF8, 0x09, 0x34, 0x90, 0xFC, 0x00, 0x10, 0x43, 0xFA, 0x00, 0x46, 0x22, 0x88, 
-    0x4C, 0xDF, 0x03, 0x01, 0x4E, 0x75, 0x80, 0x0E, 0x73, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x6A, 0x74, 
-    0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x00, 0x00, 0x01, 0xF3, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xF2, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xF1, 0x03, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3C, 0xA8, 0x8F, 0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 
-    0xA8, 0x9F, 0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x06, 0x43, 0xFA, 0xFF, 0xCE, 0x60, 0x04, 0x43, 0xFA, 
-    0xFF, 0xB8, 0x30, 0x11, 0x67, 0x16, 0xA7, 0x46, 0x23, 0x48, 0x00, 0x04, 0x30, 0x69, 0x00, 0x02, 
-    0x41, 0xFB, 0x80, 0xA6, 0x30, 0x11, 0xA6, 0x47, 0x50, 0x49, 0x60, 0xE6, 0x4E, 0x75, 0x80, 0x0F, 
-    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x00, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0xC0, 0x30, 0x3C, 0xA8, 0x8F, 0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 
-    0xA8, 0x9F, 0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x06, 0x43, 0xFA, 0xFF, 0x7E, 0x60, 0x04, 0x43, 0xFA, 
-    0xFF, 0x68, 0x30, 0x11, 0x67, 0x0A, 0x20, 0x69, 0x00, 0x04, 0xA6, 0x47, 0x50, 0x49, 0x60, 0xF2, 
-    0x4C, 0xDF, 0x03, 0x00, 0x4E, 0x75, 0x80, 0x11, 0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 
-    0x6C, 0x5F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x00, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x46, 
-    0x61, 0xB0, 0x4E, 0x75, 0x80, 0x0C, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x4C, 0x61, 0x75, 0x6E, 
-    0x63, 0x68, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x26, 0x61, 0x98, 0x4E, 0x75, 0x80, 0x0B, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x5F, 0x43, 0x68, 0x61, 0x69, 0x6E, 0x00, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x2E, 
-    0x61, 0x80, 0x4E, 0x75, 0x80, 0x11, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x45, 0x78, 0x69, 0x74, 
-    0x54, 0x6F, 0x53, 0x68, 0x65, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x48, 0xE7, 0xF0, 0xC0, 0x20, 0x4D, 
-    0xD0, 0xF8, 0x09, 0x34, 0x0C, 0x68, 0xFF, 0xFF, 0x00, 0x0A, 0x66, 0x00, 0x01, 0x4E, 0x76, 0x00, 
-    0x22, 0x6F, 0x00, 0x18, 0xB3, 0xCD, 0x6D, 0x0C, 0x41, 0xFA, 0xFE, 0xF8, 0x20, 0x50, 0xD1, 0xCD, 
-    0xB3, 0xC8, 0x6F, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x66, 0x0E, 0x30, 0x3C, 0x00, 0x01, 0x41, 0xEF, 
-    0x00, 0x18, 0x61, 0x00, 0x01, 0x42, 0x60, 0x14, 0x30, 0x2F, 0x00, 0x1C, 0x61, 0x00, 0x03, 0x6E, 
-    0x22, 0x50, 0x0C, 0x51, 0xFF, 0xFF, 0x66, 0x00, 0x01, 0x12, 0x60, 0x16, 0x22, 0x6F, 0x00, 0x18, 
-    0x30, 0x29, 0xFF, 0xFC, 0x61, 0x00, 0x03, 0x56, 0x22, 0x50, 0x0C, 0x51, 0xFF, 0xFF, 0x66, 0x00, 
-    0x00, 0xEE, 0xA0, 0x69, 0x08, 0x00, 0x00, 0x07, 0x66, 0x08, 0x4A, 0x38, 0x0B, 0xB2, 0x67, 0x02, 
-    0xA0, 0x64, 0xA0, 0x29, 0x20, 0x10, 0xA0, 0x55, 0x20, 0x40, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 
-    0x22, 0x28, 0x00, 0x08, 0x67, 0x1E, 0xD3, 0xE8, 0x00, 0x04, 0x0C, 0x69, 0x4E, 0xF9, 0x00, 0x02, 
-    0x67, 0x00, 0x00, 0x94, 0xD1, 0xA9, 0x00, 0x04, 0x33, 0x7C, 0x4E, 0xF9, 0x00, 0x02, 0x50, 0x49, 
-    0x53, 0x81, 0x66, 0xF0, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x28, 0x00, 0x10, 0x67, 0x1C, 
-    0xD3, 0xE8, 0x00, 0x0C, 0x0C, 0x69, 0x4E, 0xF9, 0x00, 0x02, 0x67, 0x6A, 0xD1, 0xA9, 0x00, 0x04, 
-    0x33, 0x7C, 0x4E, 0xF9, 0x00, 0x02, 0x50, 0x49, 0x53, 0x81, 0x66, 0xF0, 0x22, 0x0D, 0x92, 0xA8, 
-    0x00, 0x18, 0x67, 0x18, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x12, 0x21, 0x4D, 0x00, 0x18, 0x2F, 0x08, 
-    0x22, 0x48, 0xD1, 0xE8, 0x00, 0x14, 0x61, 0x00, 0x03, 0x4E, 0x20, 0x5F, 0x22, 0x08, 0x92, 0xA8, 
-    0x00, 0x20, 0x67, 0x24, 0x4A, 0xA8, 0x00, 0x20, 0x66, 0x06, 0x06, 0x81, 0x00, 0x00, 0x00, 0x28, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x12, 0x21, 0x48, 0x00, 0x20, 0x2F, 0x08, 0x22, 0x48, 0xD1, 0xE8, 
-    0x00, 0x1C, 0x61, 0x00, 0x03, 0x22, 0x20, 0x5F, 0x4A, 0x03, 0x66, 0x0A, 0x30, 0x3C, 0x00, 0x02, 
-    0x41, 0xEF, 0x00, 0x18, 0x61, 0x50, 0x4E, 0xBA, 0xFC, 0x7C, 0x4A, 0x03, 0x67, 0x10, 0x4C, 0xDF, 
-    0x03, 0x0F, 0x5D, 0x97, 0x2F, 0x57, 0x00, 0x02, 0x4F, 0xEF, 0x00, 0x02, 0x60, 0x06, 0x4C, 0xDF, 
-    0x03, 0x0F, 0x55, 0x97, 0x4A, 0x38, 0x01, 0x2D, 0x67, 0x02, 0xA9, 0xFF, 0x4E, 0x75, 0x30, 0x3C, 
-    0x00, 0x02, 0x20, 0x4F, 0x41, 0xE8, 0x00, 0x18, 0x61, 0x1C, 0x4C, 0xDF, 0x03, 0x0F, 0x2F, 0x3A, 
-    0xFD, 0x9C, 0x4E, 0x75, 0x80, 0x0D, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 
-    0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x48, 0xE7, 0xF0, 0xC0, 0x4C, 0xEF, 0x03, 0x0F, 0x00, 0x1C, 
-    0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 0x7F, 0xFF, 0x00, 0x0A, 0x22, 0x4F, 0x41, 0xEF, 0x00, 0x68, 
-    0x20, 0x50, 0x42, 0x40, 0x61, 0x60, 0x43, 0xE9, 0x00, 0x58, 0x20, 0x11, 0x61, 0x28, 0x55, 0x4F, 
-    0x48, 0x6F, 0x00, 0x02, 0x4E, 0x90, 0x4F, 0xEF, 0x00, 0x5A, 0x4C, 0xDF, 0x03, 0x0F, 0x4E, 0x75, 
-    0x80, 0x11, 0x63, 0x61, 0x6C, 0x6C, 0x5F, 0x75, 0x73, 0x65, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 
-    0x6C, 0x65, 0x72, 0x00, 0x00, 0x00, 0x2F, 0x09, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x69, 
-    0x00, 0x0C, 0xD0, 0x40, 0xD0, 0x40, 0x41, 0xF1, 0x00, 0x00, 0x20, 0x50, 0x22, 0x5F, 0x4E, 0x75, 
-    0x80, 0x12, 0x73, 0x65, 0x74, 0x5F, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x61, 0x64, 0x64, 
-    0x72, 0x65, 0x73, 0x73, 0x00, 0x00, 0x48, 0xE7, 0x80, 0x80, 0x32, 0xBC, 0xFF, 0xFF, 0x42, 0xA9, 
-    0x00, 0x54, 0x33, 0x40, 0x00, 0x52, 0x23, 0x48, 0x00, 0x02, 0x58, 0xA9, 0x00, 0x02, 0x20, 0x50, 
-    0x55, 0x48, 0x23, 0x48, 0x00, 0x06, 0x33, 0x68, 0xFF, 0xFE, 0x00, 0x46, 0x23, 0x7C, 0x43, 0x4F, 
-    0x44, 0x45, 0x00, 0x48, 0x30, 0x28, 0xFF, 0xFE, 0x61, 0x00, 0x01, 0x56, 0x42, 0x69, 0x00, 0x50, 
-    0x4A, 0x90, 0x67, 0x06, 0x13, 0x7C, 0x00, 0xFF, 0x00, 0x50, 0x59, 0x8F, 0x2F, 0x08, 0xA9, 0xA5, 
-    0x23, 0x5F, 0x00, 0x4C, 0x4C, 0xDF, 0x01, 0x01, 0x4E, 0x75, 0x80, 0x0B, 0x66, 0x69, 0x6C, 0x6C, 
-    0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x00, 0x00, 0x48, 0xE7, 0xE0, 0xC0, 0x20, 0x6F, 
-    0x00, 0x18, 0x0C, 0x50, 0x4E, 0xF9, 0x66, 0x00, 0x00, 0xFA, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 
-    0x0C, 0x69, 0xFF, 0xFF, 0x00, 0x0A, 0x66, 0x00, 0x00, 0xEA, 0x30, 0x28, 0xFF, 0xFE, 0x61, 0x00, 
-    0x01, 0x00, 0x2F, 0x08, 0x20, 0x50, 0x0C, 0x50, 0xFF, 0xFF, 0x20, 0x5F, 0x66, 0x00, 0x00, 0xD4, 
-    0x48, 0xE7, 0x00, 0xC0, 0x4C, 0xEF, 0x03, 0x07, 0x00, 0x08, 0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 
-    0x7F, 0xFF, 0x00, 0x0A, 0x3E, 0xBC, 0xFF, 0xFF, 0x42, 0xAF, 0x00, 0x54, 0x42, 0x6F, 0x00, 0x52, 
-    0x20, 0x4F, 0x41, 0xE8, 0x00, 0x58, 0x22, 0x50, 0x41, 0xE8, 0x00, 0x1C, 0x2F, 0x48, 0x00, 0x02, 
-    0x20, 0x68, 0x00, 0x04, 0x2F, 0x48, 0x00, 0x06, 0x3F, 0x68, 0xFF, 0xFE, 0x00, 0x46, 0x2F, 0x7C, 
-    0x43, 0x4F, 0x44, 0x45, 0x00, 0x48, 0x42, 0x6F, 0x00, 0x50, 0x4A, 0x91, 0x67, 0x06, 0x1F, 0x7C, 
-    0x00, 0xFF, 0x00, 0x50, 0x59, 0x8F, 0x2F, 0x09, 0xA9, 0xA5, 0x2F, 0x5F, 0x00, 0x4C, 0x30, 0x3C, 
-    0x00, 0x03, 0x61, 0x00, 0xFE, 0xD2, 0x55, 0x4F, 0x48, 0x6F, 0x00, 0x02, 0x4E, 0x90, 0x54, 0x4F, 
-    0xDE, 0xFC, 0x00, 0x58, 0x4C, 0xDF, 0x03, 0x00, 0xA0, 0x2A, 0x20, 0x10, 0xA0, 0x55, 0x20, 0x40, 
-    0x22, 0x28, 0x00, 0x08, 0x67, 0x16, 0xD3, 0xE8, 0x00, 0x04, 0x20, 0x08, 0x91, 0xA9, 0x00, 0x04, 
-    0x33, 0x7C, 0xA9, 0xF0, 0x00, 0x02, 0x50, 0x49, 0x53, 0x81, 0x66, 0xF0, 0x22, 0x4D, 0xD2, 0xF8, 
-    0x09, 0x34, 0x22, 0x28, 0x00, 0x10, 0x67, 0x18, 0xD3, 0xE8, 0x00, 0x0C, 0x20, 0x08, 0x91, 0xA9, 
-    0x00, 0x04, 0x33, 0x7C, 0xA9, 0xF0, 0x00, 0x02, 0x50, 0x49, 0x53, 0x81, 0x66, 0xF0, 0x60, 0x06, 
-    0x22, 0x28, 0x00, 0x08, 0x67, 0x0C, 0x61, 0x00, 0xFA, 0x4C, 0x4C, 0xDF, 0x03, 0x07, 0x2E, 0x9F, 
-    0x4E, 0x75, 0x4C, 0xDF, 0x03, 0x07, 0x2F, 0x3A, 0xFB, 0x9C, 0x4E, 0x75, 0x80, 0x0F, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x5F, 0x55, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 
-    0x51, 0xF8, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x3F, 0x00, 0xA9, 0xA0, 
-    0x30, 0x38, 0x0A, 0x60, 0x20, 0x5F, 0x50, 0xF8, 0x0A, 0x5E, 0x4E, 0x75, 0x80, 0x0B, 0x67, 0x65, 
-    0x74, 0x5F, 0x72, 0x65, 0x73, 0x5F, 0x68, 0x64, 0x6C, 0x00, 0x00, 0x00, 0x50, 0xF8, 0x0A, 0x5E, 
-    0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x3F, 0x00, 0xA9, 0xA0, 0x20, 0x5F, 0x4A, 0x78, 
-    0x0A, 0x60, 0x67, 0x62, 0x4C, 0xEF, 0x03, 0x0F, 0x00, 0x04, 0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 
-    0x7F, 0xFF, 0x00, 0x0A, 0x22, 0x4F, 0x30, 0x38, 0x0A, 0x60, 0x41, 0xEF, 0x00, 0x74, 0x61, 0x00, 
-    0xFE, 0x16, 0x30, 0x3C, 0x00, 0x04, 0x61, 0x00, 0xFD, 0xDE, 0x55, 0x4F, 0x48, 0x6F, 0x00, 0x02, 
-    0x4E, 0x90, 0x30, 0x1F, 0x0C, 0x40, 0x00, 0x01, 0x66, 0x10, 0x2F, 0x6F, 0x00, 0x06, 0x00, 0x74, 
-    0x4F, 0xEF, 0x00, 0x5C, 0x4C, 0xDF, 0x03, 0x0F, 0x60, 0x1C, 0x0C, 0x40, 0x00, 0x02, 0x66, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x5C, 0x4C, 0xDF, 0x03, 0x0F, 0x58, 0x4F, 0x60, 0x0A, 0x61, 0x00, 0xFB, 0x44, 
-    0x70, 0x0F, 0xA9, 0xC9, 0xA9, 0xFF, 0x4E, 0x75, 0x80, 0x09, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x63, 
-    0x6F, 0x64, 0x65, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x18, 0x67, 0x0A, 0x6A, 0x12, 0x08, 0x80, 
-    0x00, 0x07, 0x61, 0x14, 0x60, 0x0A, 0x61, 0x10, 0x67, 0x12, 0x61, 0x0C, 0x61, 0x0A, 0x61, 0x08, 
-    0xD0, 0x80, 0xD3, 0xC0, 0xD3, 0x91, 0x60, 0xDE, 0xE1, 0x88, 0x10, 0x18, 0x4E, 0x75, 0x80, 0x08, 
-    0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x72, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x9B, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x1A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x02, 0xD2, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x64, 0x6C, 0x5F, 0x5F, 0x46, 0x50, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x08, 0x60, 0x16, 0x4A, 0xAD, 
-    0xFB, 0x60, 0x67, 0x0C, 0x4A, 0x87, 0x67, 0x08, 0x20, 0x6D, 0xFB, 0x60, 0x4E, 0x90, 0x60, 0x04, 
-    0x70, 0x00, 0x60, 0x14, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xAD, 0x02, 0xB2, 0x28, 0x40, 
-    0x20, 0x0C, 0x50, 0x4F, 0x67, 0xD8, 0x20, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x46, 0x55, 0x69, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x6B, 0x00, 0x04, 0x30, 0x28, 
-    0x00, 0x30, 0x48, 0xC0, 0x28, 0x00, 0x42, 0x68, 0x00, 0x30, 0x2A, 0x04, 0x20, 0x6B, 0x00, 0x04, 
-    0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0x0A, 0x34, 0x4A, 0x80, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x01, 0x66, 0x06, 0x20, 0x0B, 0x60, 0x00, 0x03, 0x06, 0x4A, 0xAE, 0x00, 0x0C, 
-    0x66, 0x06, 0x20, 0x0B, 0x60, 0x00, 0x02, 0xFA, 0x20, 0x6B, 0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 
-    0x70, 0x02, 0xC0, 0xA8, 0x00, 0x28, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x28, 0x03, 
-    0x70, 0x0A, 0xB0, 0xAD, 0xFB, 0x64, 0x6D, 0x00, 0x00, 0xB8, 0x4A, 0x85, 0x67, 0x06, 0x4A, 0x84, 
-    0x67, 0x00, 0x00, 0xAE, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x8A, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x26, 
-    0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x10, 0x60, 0x0A, 0x20, 0x6E, 0xFF, 0xFC, 0x4A, 0x10, 0x66, 0x00, 0xFF, 0x70, 
-    0x2C, 0x2E, 0xFF, 0xFC, 0x9C, 0xAE, 0x00, 0x0C, 0x2E, 0x05, 0x9E, 0x86, 0x60, 0x00, 0x01, 0x5E, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xAD, 0x03, 0x0A, 0x2C, 0x00, 0x2E, 0x05, 0x9E, 0x86, 0x4A, 0x87, 
-    0x58, 0x4F, 0x6F, 0x00, 0x00, 0x9A, 0x4A, 0x84, 0x66, 0x00, 0x00, 0x94, 0x60, 0x00, 0x00, 0x86, 
-    0x20, 0x6B, 0x00, 0x04, 0x10, 0x28, 0x00, 0x2E, 0x48, 0x80, 0x48, 0xC0, 0x2A, 0x00, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0xC0, 0x85, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x85, 0x10, 0x05, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 
-    0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x10, 0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 0x6E, 0x00, 0xFF, 0x74, 0x20, 0x6B, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x00, 0x00, 0x9E, 0x20, 0x68, 
-    0x00, 0x08, 0x2D, 0x48, 0xFF, 0xF8, 0x22, 0x48, 0x20, 0x28, 0x00, 0x10, 0x90, 0xA9, 0x00, 0x0C, 
-    0xB0, 0x86, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x22, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x2F, 0x28, 0x00, 0x0C, 0x4E, 0xAD, 0x02, 0xDA, 0x20, 0x6E, 0xFF, 0xF8, 0xDD, 0xA8, 
-    0x00, 0x0C, 0x20, 0x06, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x2A, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0xBC, 0x80, 0x56, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6B, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x87, 0x6F, 0x00, 
-    0x00, 0x94, 0x60, 0x00, 0x00, 0x86, 0x20, 0x6B, 0x00, 0x04, 0x10, 0x28, 0x00, 0x2E, 0x48, 0x80, 
-    0x48, 0xC0, 0x28, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x84, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x84, 
-    0x10, 0x04, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 
-    0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 
-    0x6E, 0x00, 0xFF, 0x74, 0x22, 0x2D, 0xFB, 0x64, 0x20, 0x01, 0xD2, 0x81, 0xD2, 0x80, 0xD2, 0x86, 
-    0xE4, 0x81, 0x2B, 0x41, 0xFB, 0x64, 0x20, 0x6B, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 
-    0x2F, 0x0B, 0x4E, 0xBA, 0x07, 0xB6, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0B, 
-    0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xDC, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x6C, 0x73, 0x5F, 
-    0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x50, 0x43, 0x63, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x10, 0x2E, 0x00, 0x0F, 0x48, 0x80, 
-    0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0xCE, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 
-    0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x07, 0x62, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x20, 0x0C, 0x50, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x6C, 
-    0x73, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x5F, 0x37, 
-    0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x08, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 0x29, 0x40, 0x00, 0x14, 0x29, 0x40, 0x00, 0x1C, 
-    0x29, 0x40, 0x00, 0x18, 0x29, 0x40, 0x00, 0x20, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x18, 0x00, 0xAC, 
-    0x00, 0x00, 0x00, 0x82, 0x00, 0x0C, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x82, 0x00, 0x10, 0x00, 0xAC, 
-    0x00, 0x00, 0x00, 0x82, 0x00, 0x10, 0x70, 0x11, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0xEE, 
-    0x30, 0x2C, 0x00, 0x30, 0x48, 0xC0, 0x2E, 0x00, 0x42, 0x6C, 0x00, 0x30, 0x70, 0x06, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x9E, 0x70, 0x20, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x62, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0xF4, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 
-    0x28, 0x80, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x69, 0x6E, 0x69, 
-    0x74, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x50, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x00, 0x00, 0x96, 0x29, 0x6D, 0xFB, 0x68, 0x00, 0x36, 0x4A, 0xAC, 0x00, 0x08, 
-    0x67, 0x20, 0x20, 0x6C, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 
-    0x2F, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 
-    0x58, 0x4F, 0x4A, 0xAC, 0x00, 0x20, 0x67, 0x36, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x28, 0x70, 0x03, 
-    0x2F, 0x00, 0x20, 0x6C, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x58, 
-    0x2F, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x5C, 0x4E, 0x91, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x4A, 0xAC, 
-    0x00, 0x04, 0x67, 0x10, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xFA, 0x9C, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x04, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x12, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 
-    0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xFA, 0x80, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x64, 0x20, 0x6C, 0x00, 0x08, 0x21, 0x6D, 0xFB, 0x74, 0x00, 0x36, 
-    0x29, 0x6D, 0xFB, 0x70, 0x00, 0x0C, 0x29, 0x6D, 0xFB, 0x6C, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x4A, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x0C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0x00, 0xCC, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x50, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x14, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xFE, 0xE8, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0xF0, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x38, 0x69, 0x6F, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x40, 0x20, 0x6C, 0x00, 0x08, 
-    0x21, 0x6D, 0xFB, 0x7C, 0x00, 0x36, 0x29, 0x6D, 0xFB, 0x78, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x2C, 
-    0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x0C, 0xD2, 0x82, 
-    0x2F, 0x01, 0x4E, 0xBA, 0xFE, 0x72, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 
-    0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0x7E, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x37, 0x69, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x3C, 0x20, 0x6C, 
-    0x00, 0x04, 0x21, 0x6D, 0xFB, 0x84, 0x00, 0x36, 0x28, 0xAD, 0xFB, 0x80, 0x20, 0x0C, 0x67, 0x2A, 
-    0x70, 0x02, 0xC0, 0x87, 0x67, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x50, 0x81, 0x2F, 0x01, 
-    0x4E, 0xBA, 0xFE, 0x04, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 
-    0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0x10, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 
-    0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x42, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF8, 0xFE, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2E, 0x20, 0x0B, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x12, 0x26, 0x4C, 0x50, 0x4B, 0x20, 0x0C, 0x50, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x04, 0x76, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x29, 0x40, 0x00, 0x04, 0x28, 0xAD, 0xFB, 0x80, 
-    0x20, 0x6C, 0x00, 0x04, 0x21, 0x6D, 0xFB, 0x84, 0x00, 0x36, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x03, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x66, 0x06, 
-    0x20, 0x0C, 0x60, 0x00, 0x00, 0xF4, 0x20, 0x6C, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x4A, 0xAB, 
-    0x00, 0x0C, 0x67, 0x0A, 0x20, 0x2B, 0x00, 0x0C, 0x90, 0xAB, 0x00, 0x08, 0x60, 0x02, 0x70, 0x00, 
-    0x4A, 0x80, 0x67, 0x5A, 0x70, 0xFF, 0x2F, 0x00, 0x22, 0x6C, 0x00, 0x04, 0x20, 0x69, 0x00, 0x08, 
-    0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x04, 
-    0x20, 0x68, 0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x72, 0xFF, 
-    0xB2, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x00, 0xA0, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x60, 0x78, 0x20, 0x6C, 
-    0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x14, 0xB0, 0xAB, 0x00, 0x18, 0x55, 0xC3, 
-    0x44, 0x03, 0x67, 0x0A, 0x20, 0x2B, 0x00, 0x18, 0x90, 0xAB, 0x00, 0x14, 0x60, 0x02, 0x70, 0x00, 
-    0x4A, 0x80, 0x67, 0x52, 0x22, 0x6C, 0x00, 0x04, 0x20, 0x69, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x08, 
-    0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 
-    0x66, 0x24, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6C, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x91, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x1E, 0x2E, 
-    0x00, 0x0F, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xFA, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x67, 0x00, 
-    0x00, 0x9E, 0x20, 0x6C, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 
-    0xC0, 0x07, 0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 
-    0x66, 0x24, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6C, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xE6, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x70, 0x75, 0x74, 0x5F, 0x5F, 
-    0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x63, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6C, 0x00, 0x24, 
-    0xFF, 0xFC, 0x29, 0x4B, 0x00, 0x24, 0x20, 0x0B, 0x67, 0x12, 0x00, 0xAC, 0x00, 0x00, 0x04, 0x00, 
-    0x00, 0x10, 0x00, 0xAC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x60, 0x10, 0x02, 0xAC, 0xFF, 0xFF, 
-    0xFB, 0xFF, 0x00, 0x10, 0x02, 0xAC, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x14, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x74, 0x69, 0x65, 0x5F, 0x5F, 
-    0x33, 0x69, 0x6F, 0x73, 0x46, 0x50, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x1E, 0x2C, 0x00, 0x2E, 
-    0x19, 0x6E, 0x00, 0x0F, 0x00, 0x2E, 0x10, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x66, 0x69, 0x6C, 0x6C, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x2C, 
-    0x00, 0x2C, 0x48, 0xC0, 0x2E, 0x00, 0x39, 0x6E, 0x00, 0x0E, 0x00, 0x2C, 0x20, 0x07, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 
-    0x6F, 0x6E, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x28, 0x20, 0x2E, 0x00, 0x0C, 
-    0x29, 0x40, 0x00, 0x28, 0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x00, 0xAC, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x10, 0x60, 0x08, 0x02, 0xAC, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x10, 0x20, 0x3C, 0x00, 0x00, 
-    0x60, 0x00, 0xC0, 0xAC, 0x00, 0x28, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x29, 0x43, 
-    0x00, 0x1C, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x66, 
-    0x6C, 0x61, 0x67, 0x73, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0x80, 0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x04, 0x70, 0x00, 0x60, 0x4C, 0x20, 0x6C, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x24, 0x67, 0x30, 0x20, 0x68, 0x00, 0x24, 0x20, 0x68, 0x00, 0x04, 
-    0x26, 0x68, 0x00, 0x08, 0x4A, 0xAB, 0x00, 0x0C, 0x67, 0x0A, 0x20, 0x2B, 0x00, 0x0C, 0x90, 0xAB, 
-    0x00, 0x08, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x80, 0x67, 0x0E, 0x20, 0x6C, 0x00, 0x04, 0x2F, 0x28, 
-    0x00, 0x24, 0x4E, 0xBA, 0xFC, 0x56, 0x58, 0x4F, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 
-    0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x64, 0x6F, 0x5F, 0x6F, 0x70, 0x66, 0x78, 0x5F, 0x5F, 0x37, 0x6F, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xA8, 
-    0x00, 0x28, 0x67, 0x0C, 0x4A, 0xAD, 0xFB, 0xA4, 0x67, 0x06, 0x20, 0x6D, 0xFB, 0xA4, 0x4E, 0x90, 
-    0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x20, 0x00, 0xC0, 0xA8, 0x00, 0x28, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xFB, 0xE6, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x93, 0x64, 0x6F, 0x5F, 0x6F, 0x73, 0x66, 0x78, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x10, 0x70, 0x3A, 0x2F, 0x00, 0x4E, 0xBA, 0xF4, 0x56, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x14, 0x29, 0x6D, 0xFB, 0x68, 0x00, 0x36, 0x29, 0x6C, 0x00, 0x0C, 0x00, 0x32, 
-    0x29, 0x7C, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x4C, 0x20, 0x6C, 0x00, 0x08, 0x21, 0x6D, 0xFB, 0x8C, 0x00, 0x36, 
-    0x29, 0x6D, 0xFB, 0x88, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x38, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xF9, 0xF6, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x0C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF8, 0x8E, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF3, 0x98, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x31, 0x38, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 
-    0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x48, 
-    0x20, 0x6C, 0x00, 0x04, 0x21, 0x6D, 0xFB, 0x90, 0x00, 0x36, 0x28, 0xAD, 0xFB, 0x94, 0x20, 0x0C, 
-    0x67, 0x36, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0xE0, 0x70, 0x02, 0xC0, 0x87, 
-    0x67, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x50, 0x81, 0x2F, 0x01, 0x4E, 0xBA, 0xF8, 0x08, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xF3, 0x12, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x38, 0x6F, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x52, 0x29, 0x6D, 0xFB, 0xA0, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x08, 
-    0x21, 0x6D, 0xFB, 0x9C, 0x00, 0x36, 0x29, 0x6D, 0xFB, 0x98, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x38, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xF8, 0x4A, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x4E, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF7, 0x78, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xF2, 0x82, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9D, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x69, 0x6F, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x70, 0x3C, 0x2F, 0x00, 0x4E, 0xBA, 0xF2, 0x6A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2A, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x10, 0xC8, 0x28, 0x40, 0x29, 0x6D, 0xFB, 0xA8, 0x00, 0x24, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x28, 0x29, 0x40, 0x00, 0x2C, 0x29, 0x40, 0x00, 0x30, 0x72, 0x01, 0x29, 0x41, 
-    0x00, 0x34, 0x70, 0x40, 0x29, 0x40, 0x00, 0x38, 0x58, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xE4, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x40, 0xB0, 0xAC, 0x00, 0x38, 
-    0x6F, 0x06, 0x70, 0x40, 0x29, 0x40, 0x00, 0x38, 0x4A, 0xAC, 0x00, 0x28, 0x67, 0x10, 0x2F, 0x2C, 
-    0x00, 0x38, 0x20, 0x6C, 0x00, 0x28, 0x4E, 0x90, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x0C, 0x2F, 0x2C, 
-    0x00, 0x38, 0x4E, 0xBA, 0xF1, 0xDC, 0x4A, 0x80, 0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0x9A, 0x70, 0x00, 0x29, 0x40, 0x00, 0x34, 0x2D, 0x4B, 0xFF, 0xE4, 
-    0x22, 0x2C, 0x00, 0x38, 0xD2, 0x8B, 0x2D, 0x41, 0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 
-    0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xBA, 0xF1, 0x74, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 
-    0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 
-    0x42, 0x54, 0x2D, 0x4B, 0xFF, 0xEC, 0x20, 0x2C, 0x00, 0x38, 0xD0, 0x8B, 0x2D, 0x40, 0xFF, 0xF0, 
-    0x29, 0x4B, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x08, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x10, 
-    0x2D, 0x4B, 0xFF, 0xF4, 0x2D, 0x4B, 0xFF, 0xF8, 0x2D, 0x4B, 0xFF, 0xFC, 0x29, 0x4B, 0x00, 0x1C, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x18, 0x70, 0x00, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xD8, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x64, 0x6F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x1F, 0x18, 
-    0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x40, 0x76, 0x00, 
-    0x4A, 0xAC, 0x00, 0x04, 0x66, 0x0A, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x4A, 0xAC, 0x00, 0x04, 0x66, 0x00, 0x01, 0x68, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xB4, 0x20, 0x2C, 
-    0x00, 0x0C, 0x52, 0x80, 0xB0, 0xAC, 0x00, 0x10, 0x64, 0x04, 0x60, 0x00, 0x01, 0x52, 0x4A, 0xAC, 
-    0x00, 0x38, 0x67, 0x00, 0x01, 0x22, 0x4A, 0xAC, 0x00, 0x34, 0x66, 0x00, 0x01, 0x1A, 0x2E, 0x2C, 
-    0x00, 0x04, 0x2A, 0x2C, 0x00, 0x0C, 0x9A, 0x87, 0x28, 0x2C, 0x00, 0x14, 0x98, 0x87, 0x20, 0x2C, 
-    0x00, 0x20, 0xD0, 0x80, 0x2E, 0x00, 0x58, 0x87, 0xBE, 0xAC, 0x00, 0x38, 0x64, 0x04, 0x2E, 0x2C, 
-    0x00, 0x38, 0x4A, 0xAC, 0x00, 0x28, 0x67, 0x0E, 0x2F, 0x07, 0x20, 0x6C, 0x00, 0x28, 0x4E, 0x90, 
-    0x4A, 0x80, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x07, 0x4E, 0xBA, 0xF0, 0x56, 0x4A, 0x80, 0x58, 0x4F, 
-    0x26, 0x40, 0x20, 0x0B, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x46, 0x2F, 0x05, 0x2F, 0x2C, 
-    0x00, 0x04, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xDA, 0x4A, 0xAC, 0x00, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x2C, 0x4E, 0x90, 0x58, 0x4F, 0x60, 0x0A, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xEF, 0xF0, 0x58, 0x4F, 0x2D, 0x4B, 0xFF, 0xEC, 0x20, 0x0B, 
-    0xD0, 0x87, 0x2D, 0x40, 0xFF, 0xF0, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 
-    0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xEF, 0xC8, 
-    0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x04, 0x20, 0x2E, 
-    0xFF, 0xF0, 0xB0, 0xAE, 0xFF, 0xEC, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x20, 0x2E, 0xFF, 0xF0, 
-    0x90, 0xAE, 0xFF, 0xEC, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x20, 0x05, 
-    0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xF4, 0x26, 0x6C, 0x00, 0x20, 0xD7, 0xEC, 0x00, 0x04, 
-    0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 
-    0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF8, 0x20, 0x04, 0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x26, 0x6C, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 
-    0x29, 0x4B, 0x00, 0x18, 0x60, 0x28, 0x4A, 0xAC, 0x00, 0x30, 0x67, 0x1E, 0x26, 0x6C, 0x00, 0x0C, 
-    0x2D, 0x4B, 0xFF, 0xFC, 0x47, 0xEB, 0x04, 0x00, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x60, 0x04, 0x70, 0xFF, 0x60, 0x52, 0x70, 0xFF, 
-    0xB0, 0x86, 0x67, 0x4C, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 
-    0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xD0, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x6F, 0x76, 0x65, 0x72, 0x66, 
-    0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x40, 0x4A, 0xAC, 
-    0x00, 0x18, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x36, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF8, 0x2D, 0x6C, 
-    0x00, 0x18, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x20, 0x0B, 0xB0, 0xAC, 0x00, 0x14, 0x62, 0x04, 
-    0x70, 0xFF, 0x60, 0x0A, 0x20, 0x6C, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x66, 0x6C, 
-    0x6F, 0x77, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 
-    0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x21, 0x6E, 
-    0x00, 0x0C, 0x00, 0x34, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x66, 0x72, 0x65, 0x65, 0x7A, 0x65, 0x5F, 
-    0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 
-    0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x01, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0xC0, 0x20, 0x2C, 0x00, 0x04, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x73, 0x74, 0x72, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x52, 0x29, 0x6D, 0xFB, 0xA8, 0x00, 0x24, 
-    0x4A, 0xAC, 0x00, 0x34, 0x66, 0x24, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x1E, 0x4A, 0xAC, 0x00, 0x2C, 
-    0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x2C, 0x4E, 0x90, 0x58, 0x4F, 0x60, 0x0A, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xED, 0x90, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x1E, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x0C, 0xDC, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 
-    0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xED, 0x6E, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAE, 0x00, 0x0C, 0x66, 0x16, 0x4A, 0xAC, 
-    0x00, 0x04, 0x67, 0x06, 0x4A, 0xAC, 0x00, 0x38, 0x67, 0x0A, 0x29, 0x6E, 0x00, 0x10, 0x00, 0x38, 
-    0x20, 0x0C, 0x60, 0x02, 0x70, 0x00, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x73, 
-    0x65, 0x74, 0x62, 0x75, 0x66, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF4, 
-    0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x14, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x10, 0x2E, 0x00, 0x13, 0x67, 0x5C, 0x53, 0x00, 0x67, 0x06, 0x53, 0x00, 0x67, 0x20, 0x60, 0x52, 
-    0x08, 0x06, 0x00, 0x00, 0x67, 0x0C, 0x20, 0x2C, 0x00, 0x14, 0x90, 0xAC, 0x00, 0x04, 0xDE, 0x80, 
-    0x60, 0x40, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0xDE, 0x80, 0x60, 0x34, 0x20, 0x2C, 
-    0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 0x64, 0x16, 0x20, 0x2C, 0x00, 0x18, 0xB0, 0xAC, 0x00, 0x0C, 
-    0x63, 0x0C, 0x20, 0x2C, 0x00, 0x18, 0x90, 0xAC, 0x00, 0x04, 0xDE, 0x80, 0x60, 0x14, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x64, 0x0A, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 
-    0xDE, 0x80, 0x4A, 0x87, 0x6C, 0x04, 0x70, 0xFF, 0x60, 0x60, 0xBE, 0xAC, 0x00, 0x20, 0x6D, 0x0A, 
-    0x4A, 0xAC, 0x00, 0x30, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x50, 0x08, 0x06, 0x00, 0x00, 0x67, 0x24, 
-    0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF4, 0x20, 0x07, 0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x26, 0x6C, 0x00, 0x18, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 
-    0x29, 0x4B, 0x00, 0x18, 0x70, 0x02, 0xC0, 0x86, 0x67, 0x1E, 0x20, 0x07, 0xD0, 0xAC, 0x00, 0x04, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x10, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x20, 0x07, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xE4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x73, 0x65, 0x65, 0x6B, 0x6F, 0x66, 0x66, 0x5F, 0x5F, 0x31, 
-    0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x38, 
-    0x73, 0x65, 0x65, 0x6B, 0x5F, 0x64, 0x69, 0x72, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x70, 0x7E, 0x2F, 0x00, 0x4E, 0xBA, 0xEB, 0xFA, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x48, 
-    0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x44, 0x20, 0x0C, 
-    0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xF7, 0x6E, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 
-    0x29, 0x40, 0x00, 0x40, 0x29, 0x6D, 0xFB, 0xAC, 0x00, 0x3C, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 
-    0xFB, 0xB0, 0x00, 0x36, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0x3A, 0x2F, 0x0C, 0x2F, 0x2C, 0x00, 0x40, 
-    0x4E, 0xBA, 0xEF, 0xBA, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x33, 0x73, 0x74, 0x72, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x67, 0x4C, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFB, 0xB0, 0x00, 0x36, 0x29, 0x6D, 0xFB, 0xAC, 
-    0x00, 0x3C, 0x20, 0x0C, 0x67, 0x38, 0x70, 0x02, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x5E, 
-    0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 
-    0x2F, 0x01, 0x4E, 0xBA, 0xEF, 0xF2, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 
-    0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xEA, 0xFC, 0x58, 0x4F, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 
-    0x33, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x98, 0x72, 0x64, 0x62, 0x75, 0x66, 0x5F, 0x5F, 0x31, 0x33, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x64, 
-    0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFB, 0xBC, 0x00, 0x36, 0x29, 0x6D, 0xFB, 0xB8, 0x00, 0x48, 
-    0x29, 0x6D, 0xFB, 0xB4, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF0, 0xA0, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFF, 0x0C, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x50, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEF, 0x2E, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xEA, 0x36, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x69, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x48, 0x78, 0x00, 0x86, 0x4E, 0xBA, 
-    0xEA, 0x20, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x50, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x4C, 0x20, 0x0C, 0x72, 0x4C, 0xD0, 0x81, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF5, 0x94, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFD, 0xDC, 0x2F, 0x0B, 0x20, 0x0C, 0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xF0, 0xCA, 
-    0x29, 0x6D, 0xFB, 0xC0, 0x00, 0x3C, 0x29, 0x6D, 0xFB, 0xC4, 0x00, 0x44, 0x20, 0x6C, 0x00, 0x40, 
-    0x21, 0x6D, 0xFB, 0xC8, 0x00, 0x36, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 
-    0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x67, 0x00, 0x00, 0xB2, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFB, 0xC8, 0x00, 0x36, 0x29, 0x6D, 
-    0xFB, 0xC4, 0x00, 0x44, 0x29, 0x6D, 0xFB, 0xC0, 0x00, 0x3C, 0x20, 0x6C, 0x00, 0x40, 0x26, 0x68, 
-    0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 
-    0x70, 0x00, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x18, 0x20, 0x6B, 
-    0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x42, 0x10, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 
-    0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEF, 0x92, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFD, 0x8C, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x4C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xED, 0xAE, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xE8, 0xB6, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xFD, 0xB2, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xBA, 0xFA, 0x7C, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x73, 
-    0x74, 0x72, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x6A, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFB, 0xD8, 
-    0x00, 0x36, 0x29, 0x6D, 0xFB, 0xD4, 0x00, 0x48, 0x29, 0x6D, 0xFB, 0xD0, 0x00, 0x50, 0x29, 0x6D, 
-    0xFB, 0xCC, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 
-    0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xED, 0xBC, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFC, 0xBE, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x58, 
-    0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEC, 0xE0, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xE7, 0xE8, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x48, 0x78, 
-    0x04, 0x00, 0x4E, 0xBA, 0xE7, 0xDC, 0x2D, 0x40, 0xFF, 0xF8, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 
-    0x60, 0x54, 0x26, 0x6E, 0xFF, 0xF8, 0x20, 0x0B, 0xD0, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xE7, 0x7C, 0x70, 0x00, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x4B, 0x00, 0x04, 0xB7, 0xEE, 0xFF, 0xFC, 0x55, 0xC3, 0x44, 0x03, 
-    0x67, 0x08, 0x20, 0x2E, 0xFF, 0xFC, 0x90, 0x8B, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 
-    0x38, 0xBC, 0x00, 0x01, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x98, 0x64, 0x6F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x5F, 0x39, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x11, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0xFF, 0xB0, 0x87, 
-    0x66, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x60, 0x00, 0x00, 0x98, 0x76, 0x00, 
-    0x4A, 0xAC, 0x00, 0x04, 0x66, 0x0A, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x5A, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 
-    0x00, 0x10, 0x62, 0x4E, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1E, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x87, 
-    0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x6F, 
-    0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x18, 0x63, 0x20, 0x2D, 0x6C, 
-    0x00, 0x1C, 0xFF, 0xF8, 0x2D, 0x6C, 0x00, 0x14, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x20, 0x2C, 
-    0x00, 0x18, 0xB0, 0xAC, 0x00, 0x14, 0x63, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x66, 0x6C, 
-    0x6F, 0x77, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x70, 0x62, 0x61, 
-    0x63, 0x6B, 0x66, 0x61, 0x69, 0x6C, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 
-    0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x92, 0x73, 0x79, 0x6E, 0x63, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 
-    0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x2F, 0x2E, 0x00, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x30, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x34, 0x4E, 0x91, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x73, 0x65, 0x65, 0x6B, 0x70, 0x6F, 0x73, 
-    0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x69, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 0x9F, 0x73, 0x65, 0x65, 
-    0x6B, 0x6F, 0x66, 0x66, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 
-    0x46, 0x6C, 0x38, 0x73, 0x65, 0x65, 0x6B, 0x5F, 0x64, 0x69, 0x72, 0x69, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x17, 0x18, 0x2A, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2E, 0x05, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x67, 0x72, 0x60, 0x64, 0x10, 0x1B, 
-    0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 
-    0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 
-    0x10, 0x86, 0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 
-    0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x0A, 0x20, 0x05, 0x90, 0x87, 0x53, 0x80, 0x60, 0x00, 
-    0x00, 0x84, 0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 0x6E, 0x94, 0x20, 0x05, 0x60, 0x76, 0x2C, 0x2C, 
-    0x00, 0x10, 0x9C, 0xAC, 0x00, 0x0C, 0x60, 0x52, 0x2F, 0x06, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x4E, 0xAD, 0x02, 0xDA, 0xD7, 0xC6, 0xDD, 0xAC, 0x00, 0x0C, 0x9E, 0x86, 0x10, 0x1B, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x72, 0xFF, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x14, 0x66, 0x06, 0x20, 0x05, 0x90, 0x87, 0x60, 0x24, 
-    0x53, 0x87, 0x2C, 0x2C, 0x00, 0x10, 0x9C, 0xAC, 0x00, 0x0C, 0xBE, 0x86, 0x6E, 0xAA, 0x2F, 0x07, 
-    0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xAD, 0x02, 0xDA, 0xDF, 0xAC, 0x00, 0x0C, 0x20, 0x05, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x78, 
-    0x73, 0x70, 0x75, 0x74, 0x6E, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 
-    0x66, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x17, 0x18, 
-    0x2A, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 0x00, 0x0C, 0x2C, 0x05, 0x30, 0x2C, 
-    0x00, 0x02, 0x48, 0xC0, 0x67, 0x6E, 0x60, 0x64, 0x76, 0x00, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xAC, 
-    0x00, 0x18, 0x65, 0x22, 0x2F, 0x03, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x58, 0x8F, 0x26, 0x1F, 0x72, 0xFF, 
-    0xB2, 0x80, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x18, 0x20, 0x6C, 
-    0x00, 0x14, 0x52, 0xAC, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 
-    0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 0x67, 0x04, 
-    0x16, 0xC7, 0x60, 0x08, 0x20, 0x0B, 0x90, 0xAE, 0x00, 0x0C, 0x60, 0x76, 0x20, 0x06, 0x53, 0x86, 
-    0x4A, 0x80, 0x6E, 0x94, 0x4A, 0x86, 0x6E, 0x04, 0x70, 0x00, 0x60, 0x66, 0x2E, 0x2C, 0x00, 0x18, 
-    0x9E, 0xAC, 0x00, 0x14, 0x60, 0x42, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x14, 0x2F, 0x0B, 0x4E, 0xAD, 
-    0x02, 0xDA, 0xD7, 0xC7, 0x9C, 0x87, 0xDF, 0xAC, 0x00, 0x14, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x72, 0xFF, 
-    0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x08, 0x20, 0x0B, 0x90, 0xAE, 0x00, 0x0C, 0x60, 0x22, 
-    0x2E, 0x2C, 0x00, 0x18, 0x9E, 0xAC, 0x00, 0x14, 0xBC, 0x87, 0x6E, 0xBA, 0x2F, 0x06, 0x2F, 0x2C, 
-    0x00, 0x14, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xDA, 0xDD, 0xAC, 0x00, 0x14, 0x20, 0x05, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x78, 0x73, 0x67, 
-    0x65, 0x74, 0x6E, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 
-    0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE4, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 
-    0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x06, 
-    0x70, 0x00, 0x60, 0x00, 0x01, 0x34, 0x4A, 0x87, 0x6F, 0x06, 0x20, 0x0B, 0x66, 0x00, 0x00, 0x98, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE4, 0x2D, 0x40, 0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 
-    0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xBA, 0xE2, 0x94, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 
-    0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 
-    0x42, 0x54, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xF4, 
-    0x00, 0x18, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x0C, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x08, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x10, 0x39, 0x7C, 0x00, 0x01, 
-    0x00, 0x02, 0x60, 0x00, 0x00, 0x92, 0x2D, 0x4B, 0xFF, 0xE4, 0x20, 0x0B, 0xD0, 0x87, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xE1, 0xFC, 0x70, 0x00, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 
-    0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x2D, 0x4B, 0xFF, 0xEC, 0x2D, 0x4B, 
-    0xFF, 0xF0, 0x2D, 0x4B, 0xFF, 0xF4, 0x29, 0x4B, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x14, 
-    0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x18, 0x2D, 0x4B, 0xFF, 0xF8, 0x20, 0x0B, 0xD0, 0x87, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x29, 0x4B, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x08, 0x29, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x10, 0x42, 0x6C, 0x00, 0x02, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xD4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x73, 0x65, 0x74, 0x62, 0x75, 0x66, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 
-    0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x28, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xE1, 0x7E, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x00, 0x00, 0x84, 0x29, 0x6D, 
-    0xFB, 0xDC, 0x00, 0x24, 0x42, 0x94, 0x70, 0x00, 0x26, 0x40, 0x2D, 0x40, 0xFF, 0xF0, 0x76, 0x00, 
-    0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xE1, 0x20, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x29, 0x4B, 0x00, 0x04, 0xB7, 0xEE, 0xFF, 0xF0, 0x55, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x2E, 
-    0xFF, 0xF0, 0x90, 0x8B, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xF8, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x1C, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 
-    0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 
-    0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x46, 
-    0x29, 0x6D, 0xFB, 0xDC, 0x00, 0x24, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x4A, 0xAC, 0x00, 0x04, 0x58, 0x4F, 
-    0x67, 0x0E, 0x4A, 0x54, 0x67, 0x0A, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xE0, 0x6A, 0x58, 0x4F, 
-    0x20, 0x0C, 0x67, 0x12, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xE0, 0x54, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x04, 0x22, 0x2F, 0x00, 0x08, 0x2F, 0x00, 0xC0, 0xC1, 
-    0x20, 0x40, 0x20, 0x01, 0xC2, 0xDF, 0x42, 0x40, 0x48, 0x40, 0x67, 0x02, 0xC0, 0xD7, 0x54, 0x8F, 
-    0xD0, 0x41, 0x48, 0x40, 0x42, 0x40, 0xD0, 0x88, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 
-    0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 
-    0x4C, 0x41, 0x08, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x48, 0x20, 0x01, 0x4E, 0x75, 0x22, 0x2F, 
-    0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 
-    0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x00, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x74, 0x20, 0x01, 
-    0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 
-    0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x08, 0x01, 0xC3, 0x40, 0x4E, 0x75, 
-    0x4A, 0x80, 0x6B, 0x14, 0x4A, 0x81, 0x6B, 0x06, 0x4E, 0xBA, 0x00, 0x46, 0x4E, 0x75, 0x44, 0x81, 
-    0x4E, 0xBA, 0x00, 0x3E, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x80, 0x4A, 0x81, 0x6B, 0x0A, 0x4E, 0xBA, 
-    0x00, 0x30, 0x44, 0x80, 0x44, 0x81, 0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x24, 0x44, 0x80, 
-    0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 
-    0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 0x4C, 0x41, 0x00, 0x01, 0xC3, 0x40, 0x4E, 0x75, 
-    0x3F, 0x01, 0x48, 0x41, 0x4A, 0x41, 0x66, 0x1C, 0x22, 0x00, 0x42, 0x41, 0x48, 0x41, 0x67, 0x0A, 
-    0x82, 0xD7, 0x48, 0x41, 0x48, 0x40, 0x30, 0x01, 0x48, 0x40, 0x80, 0xDF, 0x32, 0x00, 0x42, 0x40, 
-    0x48, 0x40, 0x4E, 0x75, 0x48, 0x41, 0x3E, 0x82, 0x2F, 0x03, 0x34, 0x00, 0x26, 0x01, 0x72, 0x01, 
-    0x42, 0x40, 0x48, 0x40, 0x66, 0x0C, 0x48, 0x40, 0x30, 0x02, 0x72, 0x00, 0x60, 0x16, 0xD2, 0x41, 
-    0x65, 0x12, 0xD4, 0x42, 0xD1, 0x80, 0xB0, 0x83, 0x65, 0xF4, 0x90, 0x83, 0xD2, 0x41, 0x08, 0xC1, 
-    0x00, 0x00, 0x64, 0xEE, 0x26, 0x1F, 0x34, 0x1F, 0x4E, 0x75, 0x22, 0x5F, 0x20, 0x57, 0x48, 0xD0, 
-    0xDE, 0xFC, 0x70, 0x00, 0x4E, 0xD1, 0x20, 0x2F, 0x00, 0x08, 0x66, 0x02, 0x70, 0x01, 0x20, 0x6F, 
-    0x00, 0x04, 0x4C, 0xD0, 0xDE, 0xFC, 0x4E, 0xD1, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 
-    0x2C, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xFE, 0xE4, 0x66, 0x08, 0x41, 0xED, 0xFE, 0x86, 0x2B, 0x48, 
-    0xFE, 0xE4, 0x20, 0x6D, 0xFE, 0xE4, 0x42, 0x68, 0x00, 0x02, 0x7E, 0x01, 0x60, 0x04, 0xE2, 0x86, 
-    0x52, 0x87, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xF6, 0x20, 0x07, 0xE1, 0x48, 0x48, 0x40, 0x42, 0x40, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x03, 0xEE, 0x58, 0x4F, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x73, 0x69, 0x67, 0x5F, 0x64, 0x66, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x03, 0x18, 0x4A, 0x6D, 0xFE, 0xCC, 0x66, 0x00, 0x00, 0xBC, 0x59, 0x8F, 0x2F, 0x3C, 
-    0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 0x00, 0xC8, 0xA8, 0x20, 0x28, 0x5F, 0x20, 0x0C, 0x67, 0x00, 
-    0x00, 0xA6, 0x55, 0x8F, 0xA9, 0x94, 0x55, 0x8F, 0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 
-    0x66, 0x00, 0x00, 0x94, 0x41, 0xED, 0x01, 0x52, 0x22, 0x6D, 0xFE, 0xE8, 0x23, 0x48, 0x00, 0x0C, 
-    0x26, 0x54, 0x30, 0x13, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x3B, 0x7C, 0x00, 0x28, 0xFE, 0xCA, 
-    0x60, 0x06, 0x3B, 0x7C, 0x00, 0x04, 0xFE, 0xCA, 0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x84, 
-    0x30, 0x2D, 0xFE, 0xCA, 0x48, 0xC0, 0x22, 0x1F, 0x92, 0x80, 0x20, 0x01, 0x72, 0x04, 0x4E, 0xBA, 
-    0xFE, 0x12, 0x2C, 0x00, 0x70, 0x00, 0x26, 0x40, 0x60, 0x36, 0x2F, 0x0C, 0xA9, 0xA2, 0x30, 0x2D, 
-    0xFE, 0xCA, 0x48, 0xC0, 0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xFC, 0x30, 0x2D, 0xFE, 0xCC, 0x48, 0xC0, 
-    0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x80, 0x30, 0x30, 0x08, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x67, 0x08, 
-    0x20, 0x0D, 0x26, 0x40, 0xD7, 0xC7, 0x4E, 0x93, 0x30, 0x2D, 0xFE, 0xCC, 0x52, 0x6D, 0xFE, 0xCC, 
-    0x30, 0x2D, 0xFE, 0xCC, 0x48, 0xC0, 0xBC, 0x80, 0x6E, 0xC0, 0x20, 0x0B, 0x67, 0x04, 0x2F, 0x0B, 
-    0xA9, 0xF1, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8B, 0x5F, 0x5F, 0x43, 0x70, 0x6C, 0x75, 0x73, 0x49, 0x6E, 0x69, 0x74, 0x00, 0x2A, 0x28, 0x25, 
-    0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 
-    0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 
-    0x4A, 0x6D, 0xFE, 0xCC, 0x67, 0x64, 0x59, 0x8F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 
-    0x00, 0x70, 0xA9, 0xA1, 0x28, 0x5F, 0x20, 0x0C, 0x67, 0x50, 0x55, 0x8F, 0xA9, 0x94, 0x55, 0x8F, 
-    0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 0x66, 0x40, 0x60, 0x34, 0x2F, 0x0C, 0xA9, 0xA2, 
-    0x30, 0x2D, 0xFE, 0xCA, 0x48, 0xC0, 0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xFC, 0x53, 0x6D, 0xFE, 0xCC, 
-    0x30, 0x2D, 0xFE, 0xCC, 0x48, 0xC0, 0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x80, 0x30, 0x30, 0x08, 0x02, 
-    0x48, 0xC0, 0x2E, 0x00, 0x20, 0x0D, 0x26, 0x40, 0xD7, 0xC7, 0x4A, 0x87, 0x67, 0x02, 0x4E, 0x93, 
-    0x4A, 0x6D, 0xFE, 0xCC, 0x6E, 0xC6, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x64, 0x74, 0x6F, 0x72, 0x73, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x2A, 
-    0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 
-    0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 
-    0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x13, 0x38, 0x2E, 0x2E, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x4E, 0xAD, 0x04, 0x22, 0x4A, 0x80, 
-    0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xC8, 0x20, 0x6D, 0xFE, 0xE8, 0x20, 0xAE, 0x00, 0x08, 
-    0x76, 0x01, 0x4A, 0xB8, 0x03, 0x16, 0x67, 0x2C, 0x70, 0x01, 0xC0, 0xB8, 0x03, 0x16, 0x66, 0x24, 
-    0x20, 0x78, 0x03, 0x16, 0x0C, 0x90, 0x4D, 0x50, 0x47, 0x4D, 0x66, 0x18, 0x20, 0x78, 0x03, 0x16, 
-    0x4A, 0xA8, 0x00, 0x04, 0x67, 0x0E, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x4A, 0x50, 
-    0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2B, 0x43, 0xFE, 0xCE, 0x67, 0x60, 0x41, 0xED, 
-    0xFF, 0xA2, 0x43, 0xF8, 0x09, 0x10, 0x70, 0x07, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 
-    0x41, 0xED, 0xFF, 0xA2, 0x22, 0x6D, 0xFE, 0xD8, 0x22, 0x88, 0x4A, 0x87, 0x66, 0x0E, 0x59, 0x8F, 
-    0x20, 0x6D, 0xFE, 0xD8, 0x2F, 0x10, 0x4E, 0xBA, 0x02, 0xDE, 0x58, 0x4F, 0x20, 0x0B, 0x67, 0x04, 
-    0x70, 0x01, 0x26, 0x80, 0x4A, 0xAE, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0xAD, 
-    0xFE, 0xD8, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 0xFE, 0xDC, 
-    0x4E, 0xBA, 0xFD, 0x8A, 0x70, 0x01, 0x2B, 0x40, 0xFE, 0xCE, 0x60, 0x00, 0x01, 0x22, 0x20, 0x78, 
-    0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x30, 0x2D, 0xFE, 0xD2, 0xB0, 0x50, 0x67, 0x0C, 0x2F, 0x3C, 
-    0x80, 0x00, 0x00, 0x00, 0x4E, 0xBA, 0x01, 0x3C, 0x58, 0x4F, 0x41, 0xED, 0xFE, 0xD2, 0x22, 0x78, 
-    0x03, 0x16, 0x22, 0x69, 0x00, 0x04, 0x23, 0x48, 0x00, 0x24, 0x20, 0x78, 0x03, 0x16, 0x2B, 0x68, 
-    0x00, 0x04, 0xFE, 0xF6, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x02, 
-    0xFE, 0xD4, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x06, 0xFE, 0xD8, 
-    0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x0A, 0xFE, 0xDC, 0x4A, 0x87, 
-    0x67, 0x2C, 0x28, 0x6D, 0xFE, 0xD8, 0x60, 0x0C, 0x59, 0x8F, 0x2F, 0x14, 0x4E, 0xBA, 0x02, 0x02, 
-    0x58, 0x4F, 0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 0x28, 0x6D, 0xFE, 0xDC, 0x60, 0x0C, 0x59, 0x8F, 
-    0x2F, 0x14, 0x4E, 0xBA, 0x01, 0xEC, 0x58, 0x4F, 0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 0x20, 0x0B, 
-    0x67, 0x04, 0x26, 0xAD, 0xFE, 0xD4, 0x4A, 0xAE, 0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0xAD, 0xFE, 0xD8, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 
-    0xFE, 0xDC, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x20, 0x67, 0x54, 
-    0x70, 0x78, 0xA1, 0x1E, 0x2B, 0x48, 0xFE, 0xF2, 0x66, 0x0A, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x00, 0x82, 0x58, 0x4F, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x26, 0x68, 0x00, 0x20, 
-    0x7E, 0x00, 0x76, 0x05, 0x22, 0x07, 0x20, 0x01, 0xC2, 0xFC, 0x00, 0x18, 0x48, 0x40, 0xC0, 0xFC, 
-    0x00, 0x18, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x2C, 0x01, 0x20, 0x6D, 0xFE, 0xF2, 0x43, 0xF3, 
-    0x68, 0x00, 0x45, 0xF0, 0x68, 0x00, 0x70, 0x05, 0x24, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x52, 0x87, 
-    0xB6, 0x87, 0x6E, 0xD0, 0x4E, 0xBA, 0xFC, 0x66, 0x70, 0x00, 0x2B, 0x40, 0xFE, 0xCE, 0x4C, 0xEE, 
-    0x1C, 0xC8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x49, 0x6E, 0x69, 0x74, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xAE, 0x00, 0x08, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x00, 0x0E, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x65, 0x78, 0x69, 0x74, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x20, 0x6D, 0xFE, 0xE8, 0x49, 0xE8, 0x00, 0x8C, 
-    0x60, 0x0A, 0x4A, 0x94, 0x67, 0x04, 0x20, 0x54, 0x4E, 0x90, 0x59, 0x4C, 0x20, 0x6D, 0xFE, 0xE8, 
-    0xB1, 0xCC, 0x65, 0xEE, 0x4A, 0xAD, 0xFE, 0xF6, 0x67, 0x0A, 0x20, 0x6D, 0xFE, 0xF6, 0x21, 0x6E, 
-    0x00, 0x08, 0x00, 0x0E, 0x4A, 0xAD, 0xFF, 0xDC, 0x66, 0x0A, 0x20, 0x6D, 0xFE, 0xE8, 0x22, 0x50, 
-    0x4E, 0x91, 0x60, 0x0E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0xC4, 0x4E, 0xBA, 0xFB, 0x78, 
-    0x50, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x45, 0x78, 
-    0x69, 0x74, 0x00, 0x00, 0x20, 0x57, 0x42, 0xA7, 0x48, 0x6D, 0xFF, 0xFC, 0x48, 0x6D, 0xFF, 0xF8, 
-    0x48, 0x6D, 0xFF, 0xF4, 0x2F, 0x08, 0x4E, 0xBA, 0xFD, 0x72, 0x72, 0xFF, 0xB0, 0x41, 0x67, 0x2E, 
-    0x58, 0x8F, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x6D, 0xFF, 0xC4, 0x4E, 0xBA, 0xFB, 0x2E, 0x58, 0x4F, 
-    0x4A, 0x80, 0x66, 0x24, 0x2F, 0x2D, 0xFF, 0xFC, 0x2F, 0x2D, 0xFF, 0xF8, 0x2F, 0x2D, 0xFF, 0xF4, 
-    0x4E, 0xBA, 0x04, 0xF2, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x36, 0x48, 0x7A, 
-    0x00, 0x0A, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x4E, 0x75, 0x1B, 0x44, 0x61, 0x74, 0x61, 0x20, 
-    0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 
-    0x61, 0x69, 0x6C, 0x65, 0x64, 0x21, 0x20, 0x2F, 0x00, 0x04, 0x67, 0x1C, 0x20, 0x40, 0x22, 0x40, 
-    0x34, 0x3C, 0x00, 0xFF, 0x12, 0x10, 0x10, 0xC0, 0x10, 0x01, 0x57, 0xCA, 0xFF, 0xF8, 0x22, 0x08, 
-    0x20, 0x09, 0x92, 0x80, 0x53, 0x01, 0x12, 0x81, 0x4E, 0x75, 0x86, 0x63, 0x32, 0x70, 0x73, 0x74, 
-    0x72, 0x00, 0x00, 0x00, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x21, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 
-    0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x25, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 
-    0x20, 0x2F, 0x00, 0x04, 0x2F, 0x40, 0x00, 0x08, 0x67, 0x26, 0x20, 0x40, 0x22, 0x48, 0x10, 0x19, 
-    0x67, 0x1E, 0x12, 0x11, 0x12, 0xC0, 0x10, 0x01, 0x66, 0xF8, 0x93, 0xC8, 0x20, 0x09, 0x53, 0x40, 
-    0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x80, 
-    0x22, 0x5F, 0x58, 0x4F, 0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x1F, 0x2E, 0x80, 0x67, 0x12, 0x20, 0x40, 
-    0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 0x00, 0x01, 0x51, 0xC8, 0xFF, 0xFA, 0x42, 0x10, 
-    0x4E, 0xD1, 0x4E, 0x56, 0x00, 0x00, 0xA9, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x67, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x07, 0x7E, 0x00, 0x60, 0x28, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x78, 0x20, 0x07, 0xE5, 0x80, 
-    0x2F, 0x30, 0x08, 0x00, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x12, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x52, 0x87, 0xBE, 0xB9, 
-    0xFF, 0xFF, 0x47, 0x7C, 0x6D, 0xD0, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x45, 
-    0x63, 0x68, 0x6F, 0x41, 0x72, 0x67, 0x73, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x1A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x45, 0x6C, 0x76, 0x69, 0x73, 0x5F, 0x5F, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x02, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x60, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x52, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x56, 0x65, 0x72, 0x62, 0x6F, 
-    0x73, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x5A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8E, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x64, 0x69, 0x72, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x64, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x64, 0x65, 0x62, 
-    0x75, 0x67, 0x67, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x6A, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5F, 0x5F, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x74, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x52, 
-    0x65, 0x61, 0x6C, 0x6C, 0x79, 0x56, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 0x5F, 0x5F, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x50, 
-    0x72, 0x69, 0x6E, 0x74, 0x41, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x46, 0x6F, 0x72, 
-    0x77, 0x61, 0x72, 0x64, 0x65, 0x72, 0x73, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0x86, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x94, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x4E, 0x6F, 0x4C, 0x69, 0x62, 0x4D, 
-    0x61, 0x69, 0x6E, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0x2D, 0x92, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x70, 
-    0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x47, 0x6C, 0x75, 0x65, 
-    0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xA0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x70, 0x72, 0x69, 0x6E, 0x74, 
-    0x5F, 0x67, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xAE, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x53, 0x65, 
-    0x72, 0x76, 0x65, 0x72, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x53, 0x65, 0x72, 0x76, 
-    0x65, 0x72, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xCE, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x67, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x43, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x44, 0x61, 0x73, 0x68, 0x44, 
-    0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xE4, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x72, 0x65, 0x6E, 0x61, 0x6D, 
-    0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0x2D, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x70, 
-    0x72, 0x69, 0x6E, 0x74, 0x5F, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x5F, 0x5F, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x2D, 0xFE, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x1A, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x44, 0x61, 0x73, 
-    0x68, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x47, 0xF9, 0xFF, 0xFF, 0x41, 0x40, 0x28, 0x6E, 0x00, 0x08, 
-    0x70, 0x2D, 0xB0, 0x14, 0x67, 0x00, 0x00, 0x8A, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0x2E, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x70, 0x04, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x47, 0x78, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x7C, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0x3C, 0x48, 0x79, 
-    0xFF, 0xFF, 0x2E, 0x3C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 
-    0x2E, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x47, 0x78, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x7C, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0x3C, 
-    0x48, 0x79, 0xFF, 0xFF, 0x2E, 0x7E, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x48, 0x79, 0xFF, 0xFF, 
-    0x2E, 0xAC, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x48, 0x79, 0xFF, 0xFF, 0x2E, 0xC2, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x1A, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x58, 0x4F, 0xEF, 0x00, 0x40, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x45, 0x6D, 0x69, 0x74, 0x53, 
-    0x63, 0x72, 0x69, 0x70, 0x74, 0x46, 0x6F, 0x72, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x50, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x47, 0xF9, 0xFF, 0xFF, 
-    0x44, 0x12, 0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x23, 0xC7, 0xFF, 0xFF, 0x47, 0x7C, 
-    0x23, 0xCC, 0xFF, 0xFF, 0x47, 0x78, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x8C, 0x0A, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x36, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x0C, 0x2F, 0x07, 
-    0x4E, 0xB9, 0x00, 0x00, 0x86, 0x3C, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x14, 
-    0x67, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 0x2E, 0xC4, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0x2E, 0xCC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0x47, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x26, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x80, 0x4A, 0x10, 
-    0x67, 0x1C, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x48, 0x79, 0xFF, 0xFF, 0x2F, 0x32, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0xB9, 
-    0xFF, 0xFF, 0x47, 0x86, 0x67, 0x26, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x86, 0x4A, 0x10, 0x67, 0x1C, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0x2F, 0x4E, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x39, 0xFF, 0xFF, 
-    0x47, 0x4E, 0x66, 0x00, 0x01, 0x5E, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4C, 0x66, 0x00, 0x01, 0x54, 
-    0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4A, 0x66, 0x00, 0x01, 0x4A, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x50, 
-    0x66, 0x00, 0x01, 0x40, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x48, 0x66, 0x00, 0x01, 0x36, 0x48, 0x79, 
-    0xFF, 0xFF, 0x2F, 0x68, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x2F, 0x6C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x2F, 0x82, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x2F, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x2F, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x30, 0x3C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x30, 0x82, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x30, 0xE8, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x31, 0x4A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x31, 0xB4, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x31, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x32, 0x38, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x32, 0x9A, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x32, 0x9E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x32, 0xFE, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x33, 0x4A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0x4E, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x4F, 0xEF, 
-    0x00, 0x88, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x52, 0x67, 0x1A, 0x70, 0x03, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0x41, 0x40, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0x3C, 0x4F, 0xEF, 
-    0x00, 0x10, 0x60, 0x14, 0x70, 0x03, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xB9, 
-    0x00, 0x00, 0x86, 0x3C, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x39, 0xFF, 0xFF, 0x47, 0x72, 0x4C, 0xEE, 
-    0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6D, 0x61, 0x69, 0x6E, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x05, 0x2F, 0x01, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x28, 0x40, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x08, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x52, 0x65, 0x61, 0x6C, 0x52, 0x65, 0x64, 
-    0x65, 0x66, 0x69, 0x6E, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x70, 0x05, 0x2F, 0x00, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x28, 0x40, 0x20, 0x0C, 0x67, 0x06, 0x20, 0x2C, 0x00, 0x08, 
-    0x60, 0x02, 0x20, 0x0B, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8E, 0x52, 0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x49, 0xF9, 0xFF, 0xFF, 0x47, 0x8C, 0x4A, 0xB9, 
-    0xFF, 0xFF, 0x47, 0x60, 0x67, 0x1C, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x58, 0x48, 0x79, 0xFF, 0xFF, 
-    0x33, 0x5E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x58, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x02, 
-    0x41, 0xF9, 0xFF, 0xFF, 0xFC, 0x0C, 0x23, 0xC8, 0xFF, 0xFF, 0x4B, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x3C, 0xE6, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x0C, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x25, 0x2C, 0x58, 0x4F, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x58, 0x4E, 0xB9, 0x00, 0x00, 0x2F, 0x34, 
-    0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x55, 0x73, 0x65, 0x53, 0x74, 
-    0x64, 0x69, 0x6E, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x47, 0xF9, 0xFF, 0xFF, 0x47, 0x8C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0x47, 0x60, 0x67, 0x18, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x02, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0x8A, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x4A, 0x23, 0xC0, 0xFF, 0xFF, 0x4B, 0x8C, 0x4A, 0xB9, 0xFF, 0xFF, 0x4B, 0x8C, 
-    0x4F, 0xEF, 0x00, 0x10, 0x66, 0x10, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0x8C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x4E, 0xB9, 0x00, 0x00, 0x3C, 0xE6, 0x4A, 0x80, 0x67, 0x0C, 
-    0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0x2C, 0x58, 0x4F, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x4B, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x42, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x58, 0x67, 0x08, 
-    0x20, 0x39, 0xFF, 0xFF, 0x47, 0x58, 0x60, 0x02, 0x20, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x2F, 0x34, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x50, 
-    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x69, 
-    0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x50, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x2F, 0xBC, 0x58, 0x4F, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x48, 0x67, 0x0A, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x33, 0x36, 0x58, 0x4F, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4E, 0x66, 0x08, 
-    0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4C, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x35, 0x16, 
-    0x58, 0x4F, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4E, 0x66, 0x08, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x4A, 
-    0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0x8C, 0x58, 0x4F, 0x70, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x47, 0x58, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x47, 0x65, 0x6E, 
-    0x65, 0x72, 0x61, 0x74, 0x65, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5F, 0x5F, 0x46, 0x50, 0x63, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x7E, 0x00, 0x26, 0x79, 0xFF, 0xFF, 
-    0xF4, 0xD4, 0x60, 0x00, 0x03, 0x06, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x00, 
-    0x02, 0xE6, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xC2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 
-    0x02, 0xD6, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xF2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 
-    0x02, 0xC6, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x01, 0x2F, 0x01, 
-    0x4E, 0xB9, 0x00, 0x00, 0x96, 0x20, 0x28, 0x40, 0x4A, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 
-    0x02, 0x7C, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0x9E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x33, 0xE2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x33, 0xE6, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0x33, 0xEE, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0x22, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0x3A, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0x3E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0x42, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x34, 0x44, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x34, 0x46, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x34, 0x6A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0x6C, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0xAC, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0xF2, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0xF4, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x34, 0xFE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x35, 0x18, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x35, 0x44, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x35, 0x6C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x35, 0x94, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x35, 0x9E, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x35, 0xA0, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x35, 0xAA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x35, 0xC8, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x35, 0xFA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x36, 0x28, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x36, 0x58, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x36, 0x80, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x36, 0x9E, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x36, 0xEA, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x37, 0x1A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x37, 0x5A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x37, 0x64, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x37, 0x66, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x37, 0x70, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x37, 0x88, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x37, 0xB2, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x37, 0xDC, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x38, 0x04, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x38, 0x2C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x38, 0x54, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x38, 0x8C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x38, 0xC6, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x38, 0xD0, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x38, 0xD2, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x01, 0x68, 0x60, 0x10, 0x48, 0x79, 0xFF, 0xFF, 
-    0x38, 0xD4, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x2F, 0x0C, 0x20, 0x4B, 
-    0x22, 0x6B, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x20, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x24, 
-    0x4E, 0x91, 0x7E, 0x01, 0x50, 0x4F, 0x26, 0x6B, 0x00, 0x14, 0x20, 0x0B, 0x66, 0x00, 0xFC, 0xF8, 
-    0x4A, 0x87, 0x66, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x01, 
-    0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x96, 0x20, 0x28, 0x40, 0x48, 0x79, 0xFF, 0xFF, 0x38, 0xD8, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x14, 0x48, 0x79, 0xFF, 0xFF, 
-    0x38, 0xFC, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x47, 0x65, 0x6E, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 
-    0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x18, 0x7E, 0x00, 0x26, 0x79, 0xFF, 0xFF, 0xF4, 0xD4, 0x60, 0x00, 0x01, 0x6C, 
-    0x20, 0x4B, 0x22, 0x6B, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x01, 0x4C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xF2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x01, 0x3C, 0x4A, 0x87, 0x66, 0x00, 
-    0x00, 0xEA, 0x2F, 0x13, 0x4E, 0xB9, 0x00, 0x00, 0x95, 0x08, 0x58, 0x8F, 0x2F, 0x00, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x96, 0x20, 0x28, 0x40, 0x48, 0x79, 
-    0xFF, 0xFF, 0x39, 0x04, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x39, 0x48, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0x4C, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0x54, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0x88, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xA0, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x39, 0xA4, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x39, 0xA8, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0x39, 0xFF, 0xFF, 
-    0x47, 0x46, 0x4F, 0xEF, 0x00, 0x4C, 0x67, 0x30, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xAC, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xCC, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xD6, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x4A, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xD8, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xFC, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0x39, 0xFE, 
-    0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x4E, 0xB9, 
-    0x00, 0x00, 0x96, 0x20, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xEA, 0x2F, 0x0C, 0x20, 0x4B, 0x22, 0x6B, 
-    0x00, 0x34, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 
-    0x7E, 0x01, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x6B, 0x00, 0x14, 0x20, 0x0B, 0x66, 0x00, 0xFE, 0x92, 
-    0x4A, 0x87, 0x66, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x01, 
-    0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x96, 0x20, 0x28, 0x40, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0x02, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x14, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3A, 0x26, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x47, 0x65, 0x6E, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xF8, 0x00, 
-    0x48, 0xE7, 0x01, 0x18, 0x7E, 0x00, 0x28, 0x79, 0xFF, 0xFF, 0xF4, 0xD4, 0x60, 0x00, 0x02, 0x0E, 
-    0x20, 0x4C, 0x22, 0x6C, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x00, 0x01, 0xEE, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xC2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x01, 0xDE, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xF2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x01, 0xCE, 0x2F, 0x14, 0x2F, 0x14, 
-    0x4E, 0xB9, 0x00, 0x00, 0x2D, 0x98, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x10, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0x2E, 0x4E, 0xB9, 
-    0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x2D, 0x98, 0x58, 0x8F, 
-    0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x50, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x54, 0x4E, 0x91, 0x4A, 0x87, 0x50, 0x4F, 0x66, 0x00, 0x01, 0x30, 0x2F, 0x14, 
-    0x4E, 0xB9, 0x00, 0x00, 0x2D, 0x98, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x95, 0x08, 
-    0x58, 0x8F, 0x2F, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x02, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 
-    0x96, 0x20, 0x26, 0x40, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0x74, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0x78, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0xBE, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3A, 0xC2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3A, 0xC6, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0x3A, 0xCE, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3A, 0xD2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3B, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x14, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x18, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x6E, 0xFC, 0x00, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x2D, 0x98, 0x58, 0x8F, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x95, 0x08, 0x58, 0x8F, 0x2F, 0x00, 0x70, 0x02, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x95, 0x52, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x96, 0xF4, 
-    0x48, 0x6E, 0xFC, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x1C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x3C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xF8, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x4E, 0xB9, 
-    0x00, 0x00, 0x96, 0xF4, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0xBE, 
-    0x58, 0x8F, 0x2F, 0x00, 0x48, 0x6E, 0xF8, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x54, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x90, 0x60, 0x28, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3B, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x02, 0x2F, 0x01, 
-    0x4E, 0xB9, 0x00, 0x00, 0x96, 0x20, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xEA, 0x2F, 0x0B, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 
-    0x4E, 0x91, 0x7E, 0x01, 0x4F, 0xEF, 0x00, 0x0C, 0x28, 0x6C, 0x00, 0x14, 0x20, 0x0C, 0x66, 0x00, 
-    0xFD, 0xF0, 0x4A, 0x87, 0x67, 0x18, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x7E, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0x94, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 
-    0x4C, 0xEE, 0x18, 0x80, 0xF7, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x47, 0x65, 0x6E, 0x53, 0x65, 
-    0x72, 0x76, 0x65, 0x72, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFB, 0xFC, 0x48, 0xE7, 0x07, 0x18, 0x7C, 0x00, 0x7A, 0x00, 0x2D, 0x79, 
-    0xFF, 0xFF, 0xF4, 0xD4, 0xFF, 0xFC, 0x60, 0x30, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x34, 
-    0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x02, 0x52, 0x85, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x2D, 0x68, 0x00, 0x14, 0xFF, 0xFC, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0xCA, 0x2D, 0x79, 
-    0xFF, 0xFF, 0xF4, 0xD4, 0xFF, 0xFC, 0x60, 0x00, 0x04, 0x76, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x48, 
-    0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 
-    0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x04, 0x46, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xF2, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 
-    0x04, 0x34, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xEA, 0x4A, 0x86, 0x58, 0x4F, 
-    0x66, 0x00, 0x03, 0xEE, 0x20, 0x6E, 0xFF, 0xFC, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x95, 0x08, 
-    0x58, 0x8F, 0x2F, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x03, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 
-    0x96, 0x20, 0x28, 0x40, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 0x3B, 0xF0, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x36, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3C, 0x3A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3C, 0x3E, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x46, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3C, 0x4A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3C, 0x80, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x84, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x88, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x8C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x90, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x92, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x6E, 0xFB, 0xFC, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x4E, 0xB9, 0x00, 0x00, 0x96, 0xF4, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0xBE, 0x58, 0x8F, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0x94, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x54, 0x4F, 0xEF, 0x00, 0x78, 0x66, 0x00, 0x03, 0x12, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3C, 0xBA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3C, 0xD0, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3C, 0xE6, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0xE8, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3C, 0xEA, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0x30, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0x34, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0x76, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3D, 0x7A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3D, 0x7E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3D, 0xA2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0xA6, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0xBC, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3D, 0xC0, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0x3A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3E, 0x6E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3E, 0x72, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3E, 0x78, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0x90, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x05, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0x96, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0xD4, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3E, 0xD8, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0x0E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0x20, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3F, 0x3E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3F, 0x44, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x3F, 0x54, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0x7E, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0x86, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0xB2, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0xB8, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x3F, 0xD2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x3F, 0xF2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x3F, 0xFA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x40, 0x02, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0x2C, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0x34, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x7E, 0x00, 0x26, 0x79, 0xFF, 0xFF, 0xF4, 0xD4, 0x4F, 0xEF, 
-    0x01, 0x34, 0x60, 0x38, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x1A, 0x2F, 0x13, 
-    0x20, 0x07, 0x52, 0x87, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0x3C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x26, 0x6B, 0x00, 0x14, 0x20, 0x0B, 0x66, 0xC4, 
-    0x48, 0x79, 0xFF, 0xFF, 0x40, 0x6C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x40, 0x74, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x40, 0x7A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0x8C, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0x92, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0xA2, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0xA8, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x40, 0xAC, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0x40, 0xAE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0x40, 0xD6, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0x40, 0xDA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x58, 0x60, 0x10, 
-    0x48, 0x79, 0xFF, 0xFF, 0x40, 0xDE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x48, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x7C, 0x01, 0x50, 0x4F, 0x20, 0x6E, 0xFF, 0xFC, 0x2D, 0x68, 0x00, 0x14, 0xFF, 0xFC, 0x4A, 0xAE, 
-    0xFF, 0xFC, 0x66, 0x00, 0xFB, 0x86, 0x4A, 0x86, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0x40, 0xE2, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0xE0, 
-    0xFB, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x47, 0x65, 0x6E, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x3A, 0xB0, 0x14, 0x66, 0x18, 0x70, 0x3A, 
-    0x2F, 0x00, 0x22, 0x0C, 0x52, 0x81, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF2, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x02, 0x52, 0x4C, 0x23, 0xCC, 0xFF, 0xFF, 0x47, 0x80, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x53, 0x65, 0x74, 0x54, 0x72, 0x75, 0x65, 0x49, 0x6E, 0x70, 0x75, 
-    0x74, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x74, 
-    0x48, 0xE7, 0x13, 0x18, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xDC, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xD8, 0x72, 0xFF, 0x23, 0xC1, 0xFF, 0xFF, 0x8B, 0xD4, 0x41, 0xF9, 0xFF, 0xFF, 0x7C, 0x20, 
-    0x23, 0xC8, 0xFF, 0xFF, 0x8B, 0xCC, 0x41, 0xF9, 0xFF, 0xFF, 0x5C, 0xE0, 0x23, 0xC8, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 0x30, 0x80, 
-    0x30, 0x39, 0xFF, 0xFF, 0x8B, 0xD2, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xCA, 0x80, 0x30, 0x30, 
-    0x00, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x66, 0x00, 0x03, 0x62, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 
-    0x6C, 0x68, 0x4E, 0xB9, 0x00, 0x00, 0x77, 0x46, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD4, 0x6C, 0x08, 
-    0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD4, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x4A, 
-    0x70, 0x00, 0x28, 0x40, 0x0C, 0xB9, 0x00, 0x00, 0x01, 0x2F, 0xFF, 0xFF, 0x8B, 0xD4, 0x6E, 0x12, 
-    0x30, 0x39, 0xFF, 0xFF, 0x8B, 0xD6, 0xE5, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xA9, 0x44, 0x28, 0x70, 
-    0x00, 0x00, 0x20, 0x0C, 0x66, 0x06, 0x49, 0xF9, 0xFF, 0xFF, 0x4B, 0x90, 0x2F, 0x0C, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x8B, 0xD4, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD0, 0x48, 0x79, 0xFF, 0xFF, 0x4B, 0xA0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0x30, 0x39, 0xFF, 0xFF, 0x8B, 0xD2, 
-    0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xC7, 0x48, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2E, 0x00, 
-    0x67, 0x00, 0x00, 0xD2, 0xDE, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 0x4A, 0x87, 0x6D, 0x00, 0x00, 0xC6, 
-    0x0C, 0x87, 0x00, 0x00, 0x05, 0x0F, 0x6E, 0x00, 0x00, 0xBC, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 
-    0xFF, 0xFF, 0xAF, 0xD0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0xB0, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 
-    0x66, 0x00, 0x00, 0xA2, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x28, 0x20, 0x07, 0xD0, 0x40, 
-    0x20, 0x7C, 0xFF, 0xFF, 0xB9, 0xF0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x8B, 0xD0, 0x48, 0x79, 0xFF, 0xFF, 0x4B, 0xC4, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x41, 0xF9, 0xFF, 0xFF, 0x7C, 0x20, 0x41, 0xE8, 0x0F, 0x9E, 0xB1, 0xF9, 
-    0xFF, 0xFF, 0x8B, 0xCC, 0x62, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xD6, 0x4A, 0x80, 0x66, 0x00, 
-    0x33, 0x7C, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xB9, 0xF0, 0x30, 0x30, 0x00, 0x00, 
-    0x48, 0xC0, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x54, 0xB9, 0xFF, 0xFF, 0x8B, 0xCC, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xCC, 0x30, 0x80, 0x58, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x20, 0xB9, 0xFF, 0xFF, 0x8B, 0xC0, 0x70, 0xFF, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD4, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD8, 0x6F, 0x00, 0xFE, 0x98, 0x53, 0xB9, 0xFF, 0xFF, 0x8B, 0xD8, 
-    0x60, 0x00, 0xFE, 0x8E, 0x30, 0x39, 0xFF, 0xFF, 0x8B, 0xD2, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xC4, 0x7E, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x67, 0x40, 0xDE, 0xB9, 0xFF, 0xFF, 
-    0x8B, 0xD4, 0x4A, 0x87, 0x6D, 0x36, 0x0C, 0x87, 0x00, 0x00, 0x05, 0x0F, 0x6E, 0x2E, 0x20, 0x07, 
-    0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xAF, 0xD0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0xB0, 0xB9, 
-    0xFF, 0xFF, 0x8B, 0xD4, 0x66, 0x16, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xB9, 0xF0, 
-    0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x60, 0x00, 0x01, 0xB0, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0x8B, 0xD8, 0x66, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0x4B, 0xEE, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 
-    0x58, 0x4F, 0x52, 0xB9, 0xFF, 0xFF, 0x8B, 0xDC, 0x70, 0x03, 0xB0, 0xB9, 0xFF, 0xFF, 0x8B, 0xD8, 
-    0x6F, 0x00, 0x01, 0x20, 0x70, 0x03, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD8, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xCC, 0x30, 0x10, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xC7, 0x48, 0x30, 0x30, 0x00, 0x00, 
-    0x48, 0xC0, 0x2E, 0x00, 0x67, 0x00, 0x00, 0xBA, 0x06, 0x87, 0x00, 0x00, 0x01, 0x00, 0x4A, 0x87, 
-    0x6D, 0x00, 0x00, 0xAE, 0x0C, 0x87, 0x00, 0x00, 0x05, 0x0F, 0x6E, 0x00, 0x00, 0xA4, 0x20, 0x07, 
-    0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xAF, 0xD0, 0x0C, 0x70, 0x01, 0x00, 0x00, 0x00, 0x66, 0x00, 
-    0x00, 0x90, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x2E, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 
-    0xFF, 0xFF, 0xB9, 0xF0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xCC, 0x30, 0x10, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x4B, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x1A, 0x4F, 0xEF, 0x00, 0x0C, 0x41, 0xF9, 0xFF, 0xFF, 0x7C, 0x20, 0x41, 0xE8, 
-    0x0F, 0x9E, 0xB1, 0xF9, 0xFF, 0xFF, 0x8B, 0xCC, 0x62, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xD6, 
-    0x4A, 0x80, 0x66, 0x00, 0x32, 0x08, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xB9, 0xF0, 
-    0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x54, 0xB9, 0xFF, 0xFF, 
-    0x8B, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 0x30, 0x80, 0x58, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0xB9, 0xFF, 0xFF, 0x8B, 0xC0, 0x60, 0x00, 0xFD, 0x32, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x1A, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 0x30, 0x10, 
-    0x48, 0xC0, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x4C, 0x34, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x50, 0x4F, 0x41, 0xF9, 0xFF, 0xFF, 0x7C, 0x20, 0xB1, 0xF9, 0xFF, 0xFF, 0x8B, 0xCC, 0x64, 0x00, 
-    0x31, 0xAA, 0x55, 0xB9, 0xFF, 0xFF, 0x8B, 0xCC, 0x59, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 0x60, 0x00, 
-    0xFE, 0xEC, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 0x67, 0x00, 0x31, 0x90, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0x8B, 0xE0, 0x67, 0x4A, 0x70, 0x00, 0x28, 0x40, 0x0C, 0xB9, 0x00, 0x00, 0x01, 0x2F, 0xFF, 0xFF, 
-    0x8B, 0xD4, 0x6E, 0x12, 0x30, 0x39, 0xFF, 0xFF, 0x8B, 0xD6, 0xE5, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xA9, 0x44, 0x28, 0x70, 0x00, 0x00, 0x20, 0x0C, 0x66, 0x06, 0x49, 0xF9, 0xFF, 0xFF, 0x4C, 0x62, 
-    0x2F, 0x0C, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD4, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD0, 0x48, 0x79, 
-    0xFF, 0xFF, 0x4C, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0x70, 0xFF, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD4, 0x60, 0x00, 0xFC, 0x88, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 
-    0x67, 0x26, 0x20, 0x07, 0xE5, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0x8B, 0xE4, 0x2F, 0x30, 0x00, 0x00, 
-    0x2F, 0x07, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD0, 0x48, 0x79, 0xFF, 0xFF, 0x4C, 0xAC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x1A, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xCD, 0x4A, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x01, 0x90, 0x86, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0xE5, 0x80, 0x23, 0xF0, 0x08, 0x00, 0xFF, 0xFF, 0x8B, 0xC4, 0x20, 0x07, 
-    0x53, 0x80, 0x6B, 0x00, 0x2E, 0xE8, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xC6, 0x6E, 0x00, 0x2E, 0xDE, 
-    0xD0, 0x80, 0x30, 0x3B, 0x08, 0x06, 0x4E, 0xFB, 0x00, 0x00, 0x2E, 0xD4, 0x01, 0x94, 0x2E, 0xD4, 
-    0x01, 0xA6, 0x2E, 0xD4, 0x02, 0x38, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 
-    0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x02, 0x48, 
-    0x02, 0xDA, 0x03, 0xA6, 0x04, 0x4E, 0x05, 0x66, 0x06, 0x68, 0x08, 0xE2, 0x08, 0xEE, 0x0C, 0x06, 
-    0x0C, 0x12, 0x0C, 0xFA, 0x0D, 0xE2, 0x0D, 0xFA, 0x0E, 0x22, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 
-    0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x0E, 0x2E, 0x0E, 0x3A, 0x0E, 0x46, 0x0E, 0x52, 
-    0x0E, 0x64, 0x0E, 0x76, 0x0E, 0x88, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x0E, 0x98, 
-    0x0E, 0xCA, 0x0F, 0x0C, 0x0F, 0x40, 0x0F, 0x84, 0x0F, 0xC2, 0x10, 0x16, 0x10, 0x6A, 0x10, 0xC8, 
-    0x11, 0xCC, 0x13, 0x62, 0x16, 0xAE, 0x16, 0xDE, 0x2E, 0xD4, 0x17, 0x0E, 0x17, 0x4E, 0x17, 0x60, 
-    0x17, 0x72, 0x17, 0x7E, 0x17, 0x8A, 0x17, 0x9A, 0x17, 0xAC, 0x17, 0xE8, 0x18, 0x18, 0x18, 0x48, 
-    0x18, 0x84, 0x18, 0x9A, 0x18, 0xAA, 0x18, 0xBA, 0x18, 0xCA, 0x18, 0xDA, 0x18, 0xEA, 0x2E, 0xD4, 
-    0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x18, 0xFA, 
-    0x19, 0x06, 0x19, 0x32, 0x19, 0x3E, 0x19, 0x4E, 0x19, 0x5A, 0x19, 0x66, 0x19, 0x94, 0x19, 0xCA, 
-    0x1A, 0x00, 0x1A, 0x3E, 0x1A, 0xA6, 0x1A, 0xB2, 0x1A, 0xE2, 0x1A, 0xF2, 0x1B, 0x08, 0x1B, 0x9C, 
-    0x1B, 0xB2, 0x1B, 0xC2, 0x1B, 0xE6, 0x1C, 0xA4, 0x1C, 0xB4, 0x1C, 0xD2, 0x1C, 0xF4, 0x1D, 0x12, 
-    0x1D, 0x22, 0x1D, 0xD6, 0x1E, 0xC0, 0x1F, 0xAA, 0x20, 0x7C, 0x20, 0x8C, 0x20, 0x9C, 0x21, 0x04, 
-    0x21, 0x64, 0x21, 0xCC, 0x22, 0x2C, 0x22, 0x94, 0x22, 0xE2, 0x23, 0x38, 0x23, 0x8E, 0x23, 0xE4, 
-    0x24, 0x3A, 0x24, 0x90, 0x24, 0xDE, 0x25, 0x34, 0x25, 0x8A, 0x25, 0xE0, 0x26, 0x36, 0x26, 0x8C, 
-    0x26, 0xE2, 0x27, 0x38, 0x27, 0x86, 0x27, 0xD4, 0x28, 0x2A, 0x28, 0x80, 0x28, 0xD6, 0x29, 0x2C, 
-    0x29, 0x7A, 0x29, 0xC8, 0x2A, 0x16, 0x2A, 0x64, 0x2E, 0xD4, 0x2E, 0xD4, 0x2A, 0x6E, 0x2E, 0xD4, 
-    0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2E, 0xD4, 0x2A, 0x78, 0x2A, 0xAC, 
-    0x2A, 0xEE, 0x2A, 0xFA, 0x2B, 0x0A, 0x2B, 0x1A, 0x2B, 0x2A, 0x2B, 0x46, 0x2B, 0x56, 0x2B, 0x74, 
-    0x2B, 0x84, 0x2B, 0xA0, 0x2B, 0xB0, 0x2B, 0xD4, 0x2B, 0xF8, 0x2C, 0x08, 0x2C, 0x2C, 0x2C, 0x50, 
-    0x2C, 0x74, 0x2C, 0x98, 0x2C, 0xA8, 0x2C, 0xC6, 0x2C, 0xE4, 0x2C, 0xF4, 0x2D, 0x10, 0x2D, 0x2C, 
-    0x2D, 0x3C, 0x2D, 0x5E, 0x2D, 0xA4, 0x2D, 0xEA, 0x2D, 0xFA, 0x2E, 0x0E, 0x2E, 0x20, 0x2E, 0x3A, 
-    0x2E, 0x4E, 0x2E, 0x5E, 0x2E, 0x6E, 0x2E, 0x7C, 0x60, 0x00, 0x2D, 0x42, 0x70, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0xD0, 0x72, 0x23, 0xC0, 0xFF, 0xFF, 0xD0, 0x6A, 0x60, 0x00, 0x2D, 0x30, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x68, 0xFF, 0xF4, 0x2D, 0x48, 0xFF, 0xFC, 0x20, 0x3C, 0x00, 0x40, 
-    0x00, 0x00, 0xC0, 0x90, 0x56, 0xC3, 0x44, 0x03, 0x4A, 0x03, 0x66, 0x10, 0x48, 0x79, 0xFF, 0xFF, 
-    0x4C, 0xDA, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0x2C, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0x98, 
-    0x23, 0x50, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 
-    0x6C, 0x00, 0x2C, 0xCA, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0x38, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x2C, 0x9E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0xD0, 0x6A, 0x60, 0x00, 0x2C, 0x8E, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0xD0, 0x72, 0x67, 0x00, 0x2C, 0x84, 0x4A, 0xB9, 0xFF, 0xFF, 0xD0, 0x6A, 
-    0x67, 0x00, 0x2C, 0x7A, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xD0, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x40, 0x21, 0x79, 
-    0xFF, 0xFF, 0xD0, 0x6A, 0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x6C, 0x00, 0x2C, 0x48, 0x2F, 0x39, 0xFF, 0xFF, 0xD0, 0x72, 0x48, 0x79, 0xFF, 0xFF, 
-    0x4D, 0x58, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xD0, 0x72, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x20, 0x6E, 0xFF, 0x98, 0x2F, 0x28, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x0A, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0x7C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x00, 
-    0x2B, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0xFC, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xD0, 0x6A, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x02, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x21, 0x40, 0x00, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0xFC, 0x22, 0x69, 
-    0x00, 0x08, 0x23, 0x50, 0x00, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x08, 0x2F, 0x28, 
-    0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x18, 0x66, 0x12, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0xFC, 0x22, 0x69, 0x00, 0x08, 0x23, 0x50, 
-    0x00, 0x04, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 0x2B, 0x80, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0x7E, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x20, 0x6E, 0xFF, 0xFC, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x05, 0x0A, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0x92, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x00, 0x2B, 0x30, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xD0, 0x6A, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x02, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x68, 0xFF, 0xFC, 0x21, 0x40, 0x00, 0x10, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0x98, 
-    0x23, 0x68, 0xFF, 0xFC, 0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 
-    0x00, 0x14, 0x6C, 0x00, 0x2A, 0xD8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x48, 0x79, 
-    0xFF, 0xFF, 0x4D, 0x94, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x20, 0x6E, 
-    0xFF, 0x98, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x0A, 0x48, 0x79, 0xFF, 0xFF, 
-    0x4D, 0xB4, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x20, 0x60, 0x00, 0x2A, 0x88, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 
-    0xFF, 0xF0, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x68, 0xFF, 0xF0, 0x21, 0x79, 0xFF, 0xFF, 
-    0xD0, 0x6A, 0x00, 0x10, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x68, 0xFF, 0xF0, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF4, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x2E, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 
-    0x20, 0x6E, 0xFF, 0xF4, 0x20, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF4, 0x21, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x14, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x2E, 0xFF, 0xF8, 0x21, 0x40, 0x00, 0x10, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0xFF, 0xF0, 0x21, 0x6E, 0xFF, 0xF4, 0x00, 0x08, 
-    0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x00, 0x29, 0xCE, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0xB6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x20, 0x6E, 0xFF, 0xF0, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x05, 0x0A, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0xDE, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x00, 0x29, 0x70, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0xF0, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x2D, 0x79, 0xFF, 0xFF, 0xD0, 0x6A, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 
-    0xFF, 0xFC, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x2E, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x2E, 0xFF, 0xF8, 0x21, 0x40, 
-    0x00, 0x10, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0xFF, 0xF0, 0x21, 0x6E, 0xFF, 0xF4, 
-    0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x00, 
-    0x28, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 0x4D, 0xE0, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x20, 0x6E, 0xFF, 0xF0, 0x2F, 0x28, 0x00, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x05, 0x0A, 0x48, 0x79, 0xFF, 0xFF, 0x4E, 0x02, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x00, 0x28, 0x6E, 
-    0x48, 0x79, 0xFF, 0xFF, 0x4E, 0x04, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x00, 0xDA, 0x70, 0x06, 
-    0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8A, 0xDE, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x4E, 0x0E, 0x4E, 0xB9, 
-    0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 
-    0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x4E, 0x50, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 
-    0x70, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x8A, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x42, 0x2D, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0xFF, 0x94, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 
-    0x2D, 0x40, 0xFF, 0x98, 0x20, 0x6E, 0xFF, 0x94, 0x21, 0x6E, 0xFF, 0x98, 0x00, 0x20, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x06, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x88, 0x20, 0x40, 0x21, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0x00, 0x08, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x1C, 0x67, 0x00, 
-    0x00, 0xE0, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x4E, 0x7E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0xBC, 0x70, 0x06, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0x98, 0x50, 0x4F, 
-    0x67, 0x68, 0x20, 0x6E, 0xFF, 0x98, 0x2F, 0x28, 0x00, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xEC, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x8A, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x47, 0x42, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x7C, 0x48, 0x79, 0xFF, 0xFF, 
-    0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x2D, 0x40, 0xFF, 0x80, 0x20, 0x6E, 0xFF, 0x7C, 
-    0x21, 0x6E, 0xFF, 0x80, 0x00, 0x20, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x84, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x88, 0x20, 0x6E, 0xFF, 0x84, 0x21, 0x6E, 
-    0xFF, 0x88, 0x00, 0x1C, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x4E, 0xA6, 
-    0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x67, 0x20, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 0x4F, 0x00, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x52, 0xB9, 0xFF, 0xFF, 0x47, 0x3E, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x3A, 0x70, 0x04, 
-    0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0x98, 0x50, 0x4F, 0x66, 0x00, 0x26, 0x92, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x84, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xEC, 0xFF, 0x88, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0x84, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 
-    0x26, 0x1F, 0x2D, 0x40, 0xFF, 0x84, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 
-    0xFF, 0x84, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x84, 0x20, 0xBC, 0x80, 0x00, 
-    0x00, 0x00, 0x20, 0x6E, 0xFF, 0x84, 0x20, 0x2E, 0xFF, 0x88, 0x21, 0x40, 0x00, 0x08, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0xFF, 0x98, 0x21, 0x6E, 0xFF, 0x84, 0x00, 0x08, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0x98, 0x22, 0x69, 0x00, 0x08, 0x23, 0x68, 0xFF, 0xEC, 
-    0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x25, 0xF4, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x47, 0x42, 0x60, 0x00, 0x25, 0xE8, 0x48, 0x79, 0xFF, 0xFF, 0x4F, 0x2C, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 
-    0x66, 0x00, 0x01, 0x2A, 0x70, 0x06, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0x4F, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x4F, 0x78, 0x4E, 0xB9, 
-    0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x8C, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xEC, 0xFF, 0x90, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0x8C, 0x66, 0x18, 
-    0x2F, 0x03, 0x70, 0x38, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 
-    0x2D, 0x40, 0xFF, 0x8C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x2C, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x2E, 0xFF, 0x90, 0x2F, 0x2E, 0xFF, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x8A, 0x2D, 0x40, 
-    0xFF, 0x8C, 0x20, 0x40, 0x21, 0x79, 0xFF, 0xFF, 0x5A, 0x54, 0x00, 0x34, 0x20, 0x39, 0xFF, 0xFF, 
-    0x5A, 0x54, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0x8C, 0xFF, 0xFF, 
-    0x47, 0x42, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x94, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x6E, 0xFF, 0x94, 0x21, 0x6E, 
-    0xFF, 0x98, 0x00, 0x20, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x06, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x88, 
-    0x20, 0x40, 0x21, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x00, 0x08, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x00, 0x01, 0x2E, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 0x4F, 0xA6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0x0A, 0x70, 0x06, 0x2F, 0x00, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 
-    0x2D, 0x40, 0xFF, 0x98, 0x50, 0x4F, 0x67, 0x00, 0x00, 0xB6, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x74, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xEC, 0xFF, 0x78, 0x76, 0x01, 0x4A, 0xAE, 
-    0xFF, 0x74, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x38, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 
-    0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0x74, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x30, 
-    0x20, 0x6E, 0xFF, 0x98, 0x2F, 0x28, 0x00, 0x08, 0x2F, 0x2E, 0xFF, 0x78, 0x2F, 0x2E, 0xFF, 0x74, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x8A, 0x2D, 0x40, 0xFF, 0x74, 0x20, 0x40, 0x21, 0x79, 0xFF, 0xFF, 
-    0x5A, 0x54, 0x00, 0x34, 0x20, 0x39, 0xFF, 0xFF, 0x5A, 0x54, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0x74, 0xFF, 0xFF, 0x47, 0x42, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0xFF, 0x7C, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x2D, 0x40, 
-    0xFF, 0x80, 0x20, 0x6E, 0xFF, 0x7C, 0x21, 0x6E, 0xFF, 0x80, 0x00, 0x20, 0x2D, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0xFF, 0x84, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x88, 
-    0x20, 0x6E, 0xFF, 0x84, 0x21, 0x6E, 0xFF, 0x88, 0x00, 0x1C, 0x58, 0x4F, 0x60, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0x4F, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0x47, 0x60, 0x67, 0x20, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x48, 0x79, 
-    0xFF, 0xFF, 0x50, 0x24, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x52, 0xB9, 0xFF, 0xFF, 0x47, 0x3E, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x47, 0x3A, 0x70, 0x04, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0x98, 0x50, 0x4F, 0x66, 0x00, 0x23, 0x6E, 
-    0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x84, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xEC, 0xFF, 0x88, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0x84, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0x84, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x24, 0x2F, 0x2E, 0xFF, 0x84, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x84, 
-    0x20, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0x84, 0x20, 0x2E, 0xFF, 0x88, 0x21, 0x40, 
-    0x00, 0x08, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0xFF, 0x98, 0x21, 0x6E, 0xFF, 0x84, 
-    0x00, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0x98, 0x22, 0x69, 0x00, 0x08, 
-    0x23, 0x68, 0xFF, 0xEC, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x22, 0xD0, 0x70, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x42, 0x60, 0x00, 0x22, 0xC4, 0x70, 0x04, 0x2F, 0x00, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x00, 0x00, 0x9C, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x94, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x98, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0x94, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0x94, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0x94, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x94, 0x20, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x20, 0x6E, 
-    0xFF, 0x94, 0x20, 0x2E, 0xFF, 0x98, 0x21, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x21, 0x6E, 0xFF, 0x94, 0x00, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x22, 0x6E, 0xFF, 0xFC, 0x22, 0x69, 0x00, 0x08, 0x23, 0x68, 0xFF, 0xFC, 0x00, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 0x22, 0x00, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x50, 0x50, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 
-    0x21, 0xDC, 0x70, 0x04, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x00, 0x00, 0x9C, 
-    0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0xFC, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x94, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x98, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0x94, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0x94, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x24, 0x2F, 0x2E, 0xFF, 0x94, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x94, 
-    0x20, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0x94, 0x20, 0x2E, 0xFF, 0x98, 0x21, 0x40, 
-    0x00, 0x08, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0xFF, 0xFC, 0x21, 0x6E, 0xFF, 0x94, 
-    0x00, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x6E, 0xFF, 0xFC, 0x22, 0x69, 0x00, 0x08, 
-    0x23, 0x68, 0xFF, 0xFC, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 
-    0x47, 0x60, 0x6C, 0x00, 0x21, 0x18, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0x50, 0x70, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x20, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x28, 0xFF, 0xFC, 0x48, 0x40, 0x42, 0x40, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x20, 0xDC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF4, 0x48, 0x40, 0x42, 0x40, 
-    0x4A, 0x80, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x28, 0xFF, 0xFC, 0xE1, 0x89, 0xD2, 0x80, 
-    0x23, 0xC1, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x20, 0xB4, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x20, 0xA8, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x3A, 0x60, 0x00, 
-    0x20, 0x9C, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x3A, 0x60, 0x00, 0x20, 0x90, 0x70, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x3A, 0x60, 0x00, 0x20, 0x84, 0x48, 0x79, 0xFF, 0xFF, 0x50, 0x90, 
-    0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0x00, 0x20, 0x72, 0x48, 0x79, 0xFF, 0xFF, 
-    0x50, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0x00, 0x20, 0x60, 0x48, 0x79, 
-    0xFF, 0xFF, 0x51, 0x28, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0x00, 0x20, 0x4E, 
-    0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 0x20, 0x3E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x76, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 
-    0x20, 0x0C, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x50, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 
-    0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x76, 0x4F, 0xEF, 0x00, 0x10, 
-    0x60, 0x00, 0x1F, 0xCA, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x76, 
-    0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x1F, 0x96, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 
-    0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x9A, 0x76, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x1F, 0x52, 0x20, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x9A, 0xA8, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x1F, 0x14, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 
-    0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xF4, 0xFF, 0xF8, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x9A, 0xA8, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x1E, 0xC0, 0x20, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xF4, 
-    0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 0x2F, 0x00, 
-    0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0xA8, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 
-    0x1E, 0x6C, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x48, 0x68, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x9A, 0x0E, 0x2D, 0x40, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x68, 0xFF, 0xF4, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 0x2F, 0x00, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0x22, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 
-    0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x9A, 0xA8, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x1E, 0x0E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x67, 0x7E, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x90, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xF4, 0xFF, 0x94, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x98, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0x90, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 
-    0x26, 0x1F, 0x2D, 0x40, 0xFF, 0x90, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x2E, 0x2F, 0x2E, 
-    0xFF, 0x90, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x90, 0x20, 0xBC, 0x00, 0x03, 
-    0x00, 0x00, 0x20, 0x6E, 0xFF, 0x90, 0x21, 0x6E, 0xFF, 0x98, 0x00, 0x14, 0x20, 0x6E, 0xFF, 0x90, 
-    0x20, 0x2E, 0xFF, 0x94, 0x21, 0x40, 0x00, 0x10, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x21, 0x6E, 0xFF, 0x90, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x68, 0xFF, 0xF4, 0x0C, 0x90, 0x03, 0x00, 0x00, 0x00, 0x66, 0x18, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0x51, 0x62, 0x4E, 0xB9, 0x00, 0x00, 
-    0x72, 0x56, 0x50, 0x4F, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF4, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x92, 0xB4, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x30, 0x2F, 0x08, 0x20, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x34, 0x4E, 0x91, 0x50, 0x4F, 
-    0x60, 0x00, 0x1D, 0x0A, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF0, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xE8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xE4, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x2A, 0x2D, 0x40, 0xFF, 0xF4, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x3A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x20, 0x67, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0x51, 0x9E, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x2F, 0x2E, 0xFF, 0xF4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x42, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 
-    0x51, 0xBA, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 
-    0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 
-    0x4A, 0x80, 0x58, 0x4F, 0x66, 0x1E, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x32, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x51, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x58, 0x4F, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x4A, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x12, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0xF8, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x21, 0x6E, 0xFF, 0xF4, 0x00, 0x2C, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x52, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0xFC, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x21, 0x6E, 0xFF, 0xF4, 0x00, 0x30, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 
-    0xFF, 0xF8, 0x67, 0x0A, 0x20, 0x6E, 0xFF, 0xF4, 0x70, 0x01, 0x21, 0x40, 0x00, 0x28, 0x2F, 0x2E, 
-    0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 
-    0x00, 0x34, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 
-    0x00, 0x34, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 
-    0x50, 0x4F, 0x6C, 0x00, 0x1B, 0xB8, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x62, 
-    0x48, 0x79, 0xFF, 0xFF, 0x52, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x00, 0x1B, 0x74, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xF0, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xE8, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xE4, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x2A, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xF8, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x67, 0x0A, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x01, 0x21, 0x40, 0x00, 0x28, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x70, 0x01, 0x21, 0x40, 0x00, 0x34, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x32, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x00, 0xFA, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 
-    0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0x0E, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x58, 0x4F, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x5A, 0x72, 0x01, 
-    0xB2, 0x80, 0x58, 0x4F, 0x6F, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0x44, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x58, 0x4F, 0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x4A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x12, 
-    0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x98, 0x20, 0x6E, 0xFF, 0x98, 0x21, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x2C, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 0x1A, 0x50, 0x48, 0x79, 
-    0xFF, 0xFF, 0x52, 0x6E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x62, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0x7E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x00, 
-    0x1A, 0x0C, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 
-    0x67, 0x00, 0x00, 0xE2, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 
-    0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x0E, 
-    0x48, 0x79, 0xFF, 0xFF, 0x52, 0x80, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x4A, 0xA8, 0x00, 0x0C, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0xB2, 0x4E, 0xB9, 
-    0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x98, 0x20, 0x6E, 
-    0xFF, 0x98, 0x70, 0x01, 0x21, 0x40, 0x00, 0x24, 0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x28, 
-    0x2F, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x2C, 
-    0x4E, 0x91, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x50, 0x4F, 0x6C, 0x00, 0x19, 0x5E, 
-    0x48, 0x79, 0xFF, 0xFF, 0x52, 0xD8, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x62, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0xF0, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 
-    0x60, 0x00, 0x19, 0x1A, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x42, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x00, 0x19, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x79, 0xFF, 0xFF, 
-    0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 
-    0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x52, 0xF2, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x4A, 0xA8, 0x00, 0x0C, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x53, 0x28, 
-    0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x2D, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0xFF, 0x98, 
-    0x20, 0x6E, 0xFF, 0x98, 0x70, 0x01, 0x21, 0x40, 0x00, 0x28, 0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x79, 
-    0xFF, 0xFF, 0x47, 0x42, 0x22, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 
-    0x00, 0x28, 0x2F, 0x08, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 
-    0x00, 0x2C, 0x4E, 0x91, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x50, 0x4F, 0x6C, 0x00, 
-    0x18, 0x6C, 0x48, 0x79, 0xFF, 0xFF, 0x53, 0x52, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x62, 0x48, 0x79, 0xFF, 0xFF, 
-    0x53, 0x74, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x20, 0x60, 0x00, 0x18, 0x28, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 
-    0x18, 0x1C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x53, 0x76, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x17, 0xF8, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 
-    0x17, 0xEC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x53, 0x90, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x17, 0xC8, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x42, 0x2F, 0x28, 0x00, 0x04, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 
-    0x4A, 0x80, 0x50, 0x4F, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x53, 0xAA, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x58, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 0x54, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 
-    0x58, 0x4F, 0x60, 0x00, 0x17, 0x88, 0x48, 0x79, 0xFF, 0xFF, 0x54, 0x5C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x58, 0x4F, 0x60, 0x00, 0x17, 0x76, 0x48, 0x79, 0xFF, 0xFF, 0x54, 0xB0, 0x4E, 0xB9, 
-    0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0x00, 0x17, 0x64, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x17, 0x58, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x17, 0x4C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x17, 0x3C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xE8, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x17, 0x2A, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x70, 0x01, 
-    0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x58, 0x4F, 0x6C, 0x00, 0x17, 0x12, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x54, 0xEA, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x16, 0xEE, 
-    0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 0x16, 0xE2, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x16, 0xBE, 
-    0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x6C, 0x00, 0x16, 0xB2, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x16, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x16, 0x8E, 
-    0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 
-    0x47, 0x60, 0x58, 0x4F, 0x6C, 0x00, 0x16, 0x76, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x2C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x16, 0x52, 0x70, 0x7B, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x3E, 0x58, 0x4F, 0x60, 0x00, 
-    0x16, 0x3C, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x16, 0x2C, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x16, 0x1C, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x16, 0x0C, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x15, 0xFC, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x15, 0xEC, 0x70, 0x3B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x9E, 0x58, 0x4F, 0x60, 0x00, 
-    0x15, 0xDC, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x15, 0xD0, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x42, 
-    0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xE8, 
-    0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x15, 0xA4, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x15, 0x98, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x15, 0x88, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x15, 0x7C, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x15, 0x70, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0x5E, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x15, 0x42, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xFC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x93, 0x5E, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 
-    0x15, 0x0C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xF4, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0x5E, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x14, 0xD6, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF0, 0x70, 0x00, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0x5E, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x4F, 0xEF, 
-    0x00, 0x14, 0x60, 0x00, 0x14, 0x98, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0x55, 0x8C, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x05, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x2F, 0x2E, 0xFF, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0x5E, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x14, 0x30, 0x70, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x14, 0x24, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x8E, 0x48, 0x6E, 0xFF, 0x9C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x2A, 0x48, 0x6E, 0xFF, 0x9C, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x13, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x13, 0xE4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0xD0, 0x6A, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x13, 0xCE, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xE4, 
-    0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF4, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x2E, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x20, 0xBC, 0x00, 0x04, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF4, 0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x18, 
-    0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x2E, 0xFF, 0xF8, 0x21, 0x40, 0x00, 0x10, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x6A, 0x23, 0xEE, 0xFF, 0xF4, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xE8, 0xFF, 0xF0, 0xFF, 0xFF, 0xD0, 0x72, 
-    0x60, 0x00, 0x13, 0x3A, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0xD0, 0x6A, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x13, 0x24, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x13, 0x14, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x51, 0x23, 0x68, 0xFF, 0xFC, 0x00, 0x10, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x12, 0xF0, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x30, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x2D, 0x6E, 0xFF, 0xFC, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 
-    0x67, 0x5E, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x28, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x40, 
-    0x21, 0x6E, 0xFF, 0xF8, 0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x6C, 0x2C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x67, 0x20, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0x92, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x12, 0x32, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x12, 0x22, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x20, 0x50, 0x00, 0x90, 0x00, 0x40, 0x00, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x12, 0x04, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x68, 0xFF, 0xFC, 0x00, 0x90, 0x00, 0x40, 0x00, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xE8, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x11, 0xE2, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x20, 0x50, 0x00, 0x90, 0x00, 0x80, 0x00, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x11, 0xC4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x11, 0xB4, 0x70, 0x04, 0x2F, 0x00, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x50, 0x4F, 0x67, 0x1E, 0x20, 0x6E, 0xFF, 0xFC, 0x2F, 0x28, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x05, 0x02, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x50, 0x4F, 0x60, 0x00, 
-    0x11, 0x7C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0xA8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0x56, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x94, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2D, 0x50, 0xFF, 0x98, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0x94, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0x94, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0x94, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0x94, 0x20, 0xBC, 0x80, 0x00, 0x00, 0x00, 0x20, 0x6E, 
-    0xFF, 0x94, 0x20, 0x2E, 0xFF, 0x98, 0x21, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0x94, 0xFF, 0xFF, 0x8B, 0xC4, 0x50, 0x4F, 0x60, 0x00, 0x11, 0x00, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xF8, 0xFF, 0xFC, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x36, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x20, 0xBC, 0x01, 0x00, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x21, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x08, 0x20, 0x6E, 0xFF, 0xF8, 0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x70, 0x00, 0x21, 0x40, 0x00, 0x1C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x6E, 0xFF, 0xF8, 
-    0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xF8, 0x67, 0x5E, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x40, 0x21, 0x6E, 0xFF, 0xF4, 
-    0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x2C, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xF8, 0x67, 0x20, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0xC6, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x23, 0xEE, 0xFF, 0xF4, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x10, 0x16, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xF8, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF8, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 
-    0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x36, 0x2F, 0x2E, 
-    0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0xBC, 0x03, 0x00, 
-    0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x21, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xF8, 0x70, 0x00, 0x21, 0x40, 0x00, 0x1C, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x6E, 0xFF, 0xF8, 0xFF, 0xF4, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xF8, 0x67, 0x5E, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 0x2F, 0x01, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 
-    0x2D, 0x40, 0xFF, 0x98, 0x20, 0x40, 0x21, 0x6E, 0xFF, 0xF4, 0x00, 0x08, 0x70, 0x01, 0xB0, 0xB9, 
-    0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x2C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x4A, 0xA8, 0xFF, 0xF8, 0x67, 0x20, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 
-    0x48, 0x79, 0xFF, 0xFF, 0x55, 0xDE, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x23, 0xEE, 0xFF, 0xF4, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x0F, 0x2C, 0x70, 0x00, 0x26, 0x40, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0xFC, 0x76, 0x01, 0x22, 0x0B, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x24, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x26, 0xBC, 0x02, 0x00, 
-    0x00, 0x00, 0x27, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x27, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x70, 0x00, 
-    0x27, 0x40, 0x00, 0x1C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x4B, 0xFF, 0xF8, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x67, 0x5E, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x04, 
-    0x2F, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x40, 0x21, 0x6E, 0xFF, 0xF8, 0x00, 0x08, 0x70, 0x01, 
-    0xB0, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x2C, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x4A, 0xA8, 0xFF, 0xFC, 0x67, 0x20, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 
-    0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0x55, 0xF6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x0E, 0x5A, 0x41, 0xF9, 0xFF, 0xFF, 0x56, 0x0E, 0x23, 0xC8, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x0E, 0x4A, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x0E, 0x3A, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0xBC, 0x00, 0x01, 0x00, 0x00, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xFC, 0x21, 0x40, 0x00, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0D, 0xD2, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0xBC, 0x00, 0x01, 0x00, 0x00, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xFC, 0x21, 0x40, 0x00, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0D, 0x72, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x20, 0xBC, 0x00, 0x02, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xFC, 0x21, 0x40, 
-    0x00, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x0D, 0x0A, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x20, 0xBC, 0x00, 0x02, 0x00, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xFC, 0x21, 0x40, 
-    0x00, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x0C, 0xAA, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0xBC, 0x00, 0x40, 0x00, 0x00, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x20, 0x2E, 0xFF, 0xFC, 0x21, 0x40, 0x00, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xF8, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0C, 0x42, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x20, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 
-    0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0B, 0xF4, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x10, 0x00, 0x20, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x20, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0B, 0x9E, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x00, 0x20, 0x20, 0x3C, 
-    0x00, 0x20, 0x00, 0x20, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x0B, 0x48, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 
-    0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 
-    0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 
-    0x00, 0x00, 0x80, 0x00, 0x20, 0x3C, 0x00, 0x00, 0x80, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0A, 0xF2, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x10, 0x80, 0x00, 0x20, 0x3C, 0x00, 0x10, 0x80, 0x00, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x0A, 0x9C, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 
-    0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x80, 0x00, 
-    0x20, 0x3C, 0x00, 0x20, 0x80, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x0A, 0x46, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x70, 0x30, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x09, 0xF8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 
-    0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 
-    0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 
-    0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 
-    0x00, 0x10, 0x00, 0x30, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x30, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x09, 0xA2, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x00, 0x30, 0x20, 0x3C, 0x00, 0x20, 0x00, 0x30, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x09, 0x4C, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 
-    0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x00, 0x80, 0x30, 
-    0x20, 0x3C, 0x00, 0x00, 0x80, 0x30, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x08, 0xF6, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x20, 0xBC, 0x00, 0x10, 0x80, 0x30, 0x20, 0x3C, 0x00, 0x10, 0x80, 0x30, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x08, 0xA0, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x80, 0x30, 0x20, 0x3C, 0x00, 0x20, 
-    0x80, 0x30, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x08, 0x4A, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 
-    0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x10, 
-    0x80, 0x30, 0x20, 0x3C, 0x00, 0x10, 0x80, 0x30, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 
-    0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x07, 0xF4, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x80, 0x30, 0x20, 0x3C, 0x00, 0x20, 0x80, 0x30, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x07, 0x9E, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x40, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x07, 0x50, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x40, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x07, 0x02, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x10, 0x00, 0x40, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x40, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x06, 0xAC, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 
-    0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x00, 0x40, 
-    0x20, 0x3C, 0x00, 0x20, 0x00, 0x40, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x06, 0x56, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x20, 0xBC, 0x00, 0x10, 0x00, 0x40, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x40, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x06, 0x00, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x1E, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0xBC, 0x00, 0x20, 0x00, 0x40, 0x20, 0x3C, 0x00, 0x20, 
-    0x00, 0x40, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x05, 0xAA, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 
-    0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x50, 0x20, 0x80, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x05, 0x5C, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 
-    0x2F, 0x03, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x60, 0x20, 0x80, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x05, 0x0E, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x70, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x04, 0xC0, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x20, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0xFA, 0x20, 0x6E, 0xFF, 0xFC, 0x70, 0x01, 0x20, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x04, 0x72, 0x4E, 0xB9, 0x00, 0x00, 
-    0x76, 0x3E, 0x60, 0x00, 0x04, 0x68, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0x3E, 0x60, 0x00, 0x04, 0x5E, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 0x4E, 0xB9, 
-    0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x39, 0xFF, 0xFF, 0xD0, 0x6E, 0x52, 0xB9, 
-    0xFF, 0xFF, 0xD0, 0x6E, 0x20, 0x6E, 0xFF, 0xFC, 0x21, 0x40, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x00, 0x04, 0x2A, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0xD0, 0x6E, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x28, 0xFF, 0xF8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8B, 0xA6, 0x2D, 0x40, 0xFF, 0x98, 0x20, 0x39, 0xFF, 0xFF, 0xD0, 0x6E, 
-    0x52, 0xB9, 0xFF, 0xFF, 0xD0, 0x6E, 0x20, 0x6E, 0xFF, 0x98, 0x21, 0x40, 0x00, 0x08, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x03, 0xE8, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x03, 0xDC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x03, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x03, 0xBC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x03, 0xAC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 
-    0x80, 0xA8, 0xFF, 0xF8, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x90, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x80, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 0x22, 0x28, 0xFF, 0xF8, 
-    0xB1, 0x81, 0x23, 0xC1, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x62, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x52, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 0xC0, 0xA8, 0xFF, 0xF8, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x36, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x26, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0xB0, 0x91, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x03, 0x02, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0xB0, 0x91, 0x56, 0xC3, 
-    0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0xDE, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0xCE, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 
-    0xB0, 0x91, 0x5D, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x02, 0xAA, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x28, 0xFF, 0xF8, 0xB0, 0x91, 0x5F, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0x86, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0xB0, 0x91, 0x5E, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0x62, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0xB0, 0x91, 0x5C, 0xC3, 
-    0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0x3E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0x2E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 0x22, 0x28, 
-    0xFF, 0xF8, 0xE1, 0xA9, 0x23, 0xC1, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x02, 0x10, 0x20, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 0x22, 0x28, 0xFF, 0xF8, 
-    0xE0, 0xA1, 0x23, 0xC1, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x01, 0xF2, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x01, 0xE2, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x11, 0xD0, 0xA8, 0xFF, 0xF8, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x01, 0xC6, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 
-    0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0x90, 0x91, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x01, 0xAA, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 
-    0x60, 0x00, 0x01, 0x9A, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x28, 0xFF, 0xF8, 0x22, 0x11, 0x4E, 0xB9, 0x00, 0x00, 0x1F, 0xD6, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x01, 0x78, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0x90, 0x66, 0x1A, 
-    0x48, 0x79, 0xFF, 0xFF, 0x56, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x70, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x58, 0x4F, 0x60, 0x00, 0x01, 0x54, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 0x22, 0x11, 0x4E, 0xB9, 0x00, 0x00, 
-    0x1F, 0xFC, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x01, 0x32, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x4A, 0x90, 0x66, 0x1A, 0x48, 0x79, 0xFF, 0xFF, 0x56, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x71, 0xF2, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x58, 0x4F, 0x60, 0x00, 0x01, 0x0E, 
-    0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x22, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x28, 0xFF, 0xF8, 
-    0x22, 0x11, 0x4E, 0xB9, 0x00, 0x00, 0x1F, 0xFC, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x00, 0xEC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x00, 0xDC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x10, 0x44, 0x80, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x00, 0xC8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x10, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0x00, 0xB6, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x4A, 0x90, 
-    0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 
-    0x00, 0x9C, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x10, 0x46, 0x80, 0x23, 0xC0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x00, 0x00, 0x88, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xE8, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x76, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xE8, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x66, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x23, 0xD0, 0xFF, 0xFF, 
-    0x8B, 0xC4, 0x60, 0x58, 0x70, 0x00, 0x2F, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 0x2F, 0x10, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8A, 0xDE, 0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x32, 0x48, 0x79, 
-    0xFF, 0xFF, 0x56, 0x5C, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x56, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x70, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC4, 0x4F, 0xEF, 0x00, 0x10, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x23, 0xE8, 0x00, 0x08, 0xFF, 0xFF, 0x8B, 0xC4, 0x20, 0x06, 0xD0, 0x80, 
-    0x91, 0xB9, 0xFF, 0xFF, 0x8B, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 0x30, 0x10, 0x48, 0xC0, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x20, 0x06, 0xE5, 0x80, 0x91, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xCE, 0xDA, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 
-    0x2C, 0x00, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD0, 0x66, 0x00, 0x00, 0xC8, 0x4A, 0x86, 0x66, 0x00, 
-    0x00, 0xC2, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x12, 0x70, 0x1A, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0x56, 0x94, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 0x50, 0x4F, 0x70, 0x1A, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xD0, 0x54, 0xB9, 0xFF, 0xFF, 0x8B, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 
-    0x30, 0xBC, 0x00, 0x1A, 0x58, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xC8, 
-    0x20, 0xB9, 0xFF, 0xFF, 0x8B, 0xC4, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 0x6C, 0x66, 0x4E, 0xB9, 
-    0x00, 0x00, 0x77, 0x46, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD4, 0x6C, 0x08, 0x70, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x8B, 0xD4, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x48, 0x70, 0x00, 0x28, 0x40, 
-    0x0C, 0xB9, 0x00, 0x00, 0x01, 0x2F, 0xFF, 0xFF, 0x8B, 0xD4, 0x6E, 0x12, 0x30, 0x39, 0xFF, 0xFF, 
-    0x8B, 0xD6, 0xE5, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xA9, 0x44, 0x28, 0x70, 0x00, 0x00, 0x20, 0x0C, 
-    0x66, 0x06, 0x49, 0xF9, 0xFF, 0xFF, 0x56, 0xD2, 0x2F, 0x0C, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD4, 
-    0x70, 0x1A, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x56, 0xE2, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x1A, 
-    0x4F, 0xEF, 0x00, 0x10, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xD4, 0x67, 0x00, 0x00, 0xF2, 0x60, 0x00, 
-    0xCC, 0x40, 0x20, 0x06, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xC4, 0x10, 0x30, 0x30, 0x00, 0x00, 
-    0x48, 0xC0, 0x2E, 0x00, 0x67, 0x42, 0xDE, 0xB9, 0xFF, 0xFF, 0x8B, 0xD0, 0x4A, 0x87, 0x6D, 0x38, 
-    0x0C, 0x87, 0x00, 0x00, 0x05, 0x0F, 0x6E, 0x30, 0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xAF, 0xD0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0xB0, 0xB9, 0xFF, 0xFF, 0x8B, 0xD0, 0x66, 0x18, 
-    0x20, 0x07, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xB9, 0xF0, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x60, 0x16, 0x20, 0x06, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xCA, 0x12, 0x30, 0x30, 0x00, 0x00, 0x48, 0xC0, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xD0, 0x4A, 0xB9, 
-    0xFF, 0xFF, 0x8B, 0xE0, 0x67, 0x22, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xD0, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xCC, 0x30, 0x10, 0x48, 0xC0, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0x06, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x1A, 0x4F, 0xEF, 0x00, 0x0C, 0x41, 0xF9, 0xFF, 0xFF, 0x7C, 0x20, 0x41, 0xE8, 
-    0x0F, 0x9E, 0xB1, 0xF9, 0xFF, 0xFF, 0x8B, 0xCC, 0x62, 0x0A, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xD6, 
-    0x4A, 0x80, 0x66, 0x28, 0x54, 0xB9, 0xFF, 0xFF, 0x8B, 0xCC, 0x20, 0x79, 0xFF, 0xFF, 0x8B, 0xCC, 
-    0x30, 0xB9, 0xFF, 0xFF, 0x8B, 0xD2, 0x58, 0xB9, 0xFF, 0xFF, 0x8B, 0xC8, 0x20, 0x79, 0xFF, 0xFF, 
-    0x8B, 0xC8, 0x20, 0xB9, 0xFF, 0xFF, 0x8B, 0xC4, 0x60, 0x00, 0xCB, 0x66, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0x44, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 
-    0x4C, 0xEE, 0x18, 0xC8, 0xFF, 0x60, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x79, 0x79, 0x70, 0x61, 0x72, 
-    0x73, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x41, 0xF9, 0xFF, 0xFF, 
-    0x47, 0x8C, 0x20, 0x08, 0x67, 0x1C, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0x58, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x39, 0xFF, 0xFF, 0x5C, 0xDC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0x64, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0x2C, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x79, 0x79, 0x65, 
-    0x72, 0x72, 0x6F, 0x72, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x41, 0xF9, 0xFF, 0xFF, 0x47, 0x8C, 0x20, 0x08, 0x67, 0x1C, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 
-    0x48, 0x79, 0xFF, 0xFF, 0x57, 0x74, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x39, 0xFF, 0xFF, 0x5C, 0xDC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0x80, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0x96, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x79, 0x79, 0x77, 0x61, 0x72, 0x6E, 0x69, 
-    0x6E, 0x67, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x70, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x53, 0x74, 0x61, 
-    0x63, 0x6B, 0x4F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x20, 0x79, 0xFF, 0xFF, 0x4B, 0x8C, 0x53, 0x90, 
-    0x4A, 0x90, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x20, 0x79, 0xFF, 0xFF, 0x4B, 0x8C, 0x22, 0x68, 
-    0x00, 0x04, 0x52, 0xA8, 0x00, 0x04, 0x70, 0x00, 0x10, 0x11, 0x4A, 0x80, 0x60, 0x10, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x4B, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 0x1E, 0x00, 
-    0x0C, 0x07, 0x00, 0x0D, 0x66, 0x0C, 0x20, 0x39, 0xFF, 0xFF, 0x5C, 0xDC, 0x52, 0xB9, 0xFF, 0xFF, 
-    0x5C, 0xDC, 0x10, 0x07, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x47, 
-    0x65, 0x74, 0x43, 0x68, 0x61, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x07, 0x1E, 0x2E, 0x00, 0x0B, 0x2F, 0x39, 0xFF, 0xFF, 0x4B, 0x8C, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x52, 0x0C, 0x07, 0x00, 0x0D, 0x66, 0x0C, 0x20, 0x39, 
-    0xFF, 0xFF, 0x5C, 0xDC, 0x53, 0xB9, 0xFF, 0xFF, 0x5C, 0xDC, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8D, 0x55, 0x6E, 0x67, 0x65, 0x74, 0x43, 0x68, 0x61, 0x72, 0x5F, 0x5F, 0x46, 0x63, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0x7A, 0x48, 0xE7, 0x17, 0x18, 0x1A, 0x2E, 0x00, 0x0B, 0x7C, 0x00, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0x15, 0xF0, 0x50, 0x4F, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0xFF, 0x67, 0x00, 0x01, 0xAE, 
-    0x4A, 0x86, 0x67, 0x00, 0x00, 0xCC, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 
-    0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x48, 0x87, 
-    0x48, 0xC7, 0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x6E, 0xFF, 0xC2, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 
-    0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 
-    0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 
-    0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x7C, 0x00, 0x60, 0x00, 0xFF, 0x22, 
-    0x0C, 0x07, 0x00, 0x5C, 0x66, 0x08, 0x20, 0x06, 0x52, 0x86, 0x60, 0x00, 0xFF, 0x14, 0xBA, 0x07, 
-    0x67, 0x00, 0x00, 0xCA, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x00, 0xFE, 0xDE, 0x20, 0x6E, 0xFF, 0xC2, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 
-    0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 
-    0x00, 0xFF, 0xC0, 0x07, 0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 
-    0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 
-    0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 
-    0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x60, 0x00, 0xFE, 0x46, 0x48, 0x6E, 0xFF, 0x7A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x17, 0x70, 0x26, 0x40, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x16, 0x88, 0x20, 0x0B, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xE8, 
-    0xFF, 0x62, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x47, 0x65, 0x74, 0x43, 0x68, 0x61, 0x72, 0x73, 0x55, 
-    0x6E, 0x74, 0x69, 0x6C, 0x5F, 0x5F, 0x46, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x0F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x18, 0x2E, 0x00, 0x0B, 0x2C, 0x2E, 0x00, 0x10, 0x7A, 0x00, 
-    0x28, 0x4B, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0xFF, 0x66, 0x02, 
-    0x60, 0x2C, 0x4A, 0x85, 0x67, 0x0E, 0x70, 0x01, 0xB0, 0x86, 0x6E, 0x04, 0x53, 0x86, 0x18, 0xC7, 
-    0x7A, 0x00, 0x60, 0xDE, 0x0C, 0x07, 0x00, 0x5C, 0x66, 0x04, 0x7A, 0x01, 0x60, 0xD4, 0xB8, 0x07, 
-    0x67, 0x0C, 0x70, 0x01, 0xB0, 0x86, 0x6E, 0xCA, 0x53, 0x86, 0x18, 0xC7, 0x60, 0xC4, 0x42, 0x14, 
-    0x20, 0x0B, 0x4C, 0xEE, 0x18, 0xF0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x47, 0x65, 0x74, 
-    0x43, 0x68, 0x61, 0x72, 0x73, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x5F, 0x5F, 0x46, 0x63, 0x50, 0x63, 
-    0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 0x7C, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x72, 0xFA, 0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x0E, 
-    0x48, 0x79, 0xFF, 0xFF, 0x57, 0x98, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x70, 0x7B, 
-    0xB0, 0x87, 0x66, 0x04, 0x52, 0x86, 0x60, 0xD6, 0x70, 0x7D, 0xB0, 0x87, 0x66, 0xD0, 0x20, 0x06, 
-    0x53, 0x86, 0x4A, 0x80, 0x66, 0xC8, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x53, 0x6B, 0x69, 0x70, 0x43, 0x6F, 0x64, 0x65, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 0x1C, 0x2E, 0x00, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 
-    0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0xA6, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 
-    0x48, 0x86, 0x48, 0xC6, 0xBC, 0x87, 0x66, 0xD8, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x90, 0x53, 0x6B, 0x69, 0x70, 0x50, 0x61, 0x73, 0x74, 0x43, 0x68, 0x61, 0x72, 0x5F, 
-    0x5F, 0x46, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 
-    0x00, 0x08, 0x49, 0xF9, 0xFF, 0xFF, 0x5A, 0x58, 0x60, 0x18, 0x2F, 0x14, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x20, 0x2C, 0x00, 0x04, 0x60, 0x08, 
-    0x50, 0x4C, 0x4A, 0x94, 0x66, 0xE4, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x57, 0x6F, 0x72, 0x64, 0x54, 
-    0x6F, 0x6B, 0x65, 0x6E, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x7B, 0x52, 0x2E, 0x00, 0x4A, 0xB9, 0xFF, 0xFF, 0x8B, 0xE0, 
-    0x67, 0x00, 0x03, 0xE0, 0x70, 0x20, 0xB0, 0x87, 0x6F, 0x22, 0x20, 0x07, 0x72, 0x40, 0xD0, 0x81, 
-    0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0xB6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x03, 0xB8, 0x0C, 0x87, 0x00, 0x00, 
-    0x01, 0x00, 0x6C, 0x1C, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0xC4, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x03, 0x94, 
-    0x20, 0x07, 0x04, 0x80, 0x00, 0x00, 0x01, 0x01, 0x6B, 0x00, 0x03, 0x70, 0x0C, 0x80, 0x00, 0x00, 
-    0x00, 0x2D, 0x6E, 0x00, 0x03, 0x66, 0xD0, 0x80, 0x30, 0x3B, 0x08, 0x06, 0x4E, 0xFB, 0x00, 0x00, 
-    0x00, 0x5E, 0x00, 0x76, 0x00, 0x8E, 0x00, 0xA6, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x3E, 0x00, 0xBE, 
-    0x00, 0xD6, 0x00, 0xEE, 0x01, 0x06, 0x01, 0x1E, 0x01, 0x4E, 0x01, 0x36, 0x01, 0x66, 0x01, 0x7E, 
-    0x01, 0x96, 0x01, 0xAE, 0x03, 0x12, 0x03, 0x28, 0x01, 0xC6, 0x01, 0xDE, 0x01, 0xF6, 0x02, 0x0E, 
-    0x03, 0x5C, 0x03, 0x5C, 0x02, 0x26, 0x02, 0x3E, 0x02, 0x56, 0x03, 0x5C, 0x02, 0x6E, 0x03, 0x5C, 
-    0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 0x03, 0x5C, 
-    0x02, 0x86, 0x02, 0x9E, 0x02, 0xB6, 0x02, 0xCE, 0x02, 0xE6, 0x02, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0xD0, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x03, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x57, 0xE0, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0xE8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x57, 0xEE, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0xD0, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x02, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0xB8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x16, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0xA0, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x24, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x88, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x32, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0x70, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x3E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x58, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x4A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0x40, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x56, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x28, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x60, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x02, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x6C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x78, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0xE0, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0x86, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xC8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0x96, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0xA2, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x98, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0xAE, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x80, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0xBC, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x68, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0xCA, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x50, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0xDA, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x38, 0x48, 0x79, 0xFF, 0xFF, 
-    0x58, 0xE8, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x20, 0x48, 0x79, 0xFF, 0xFF, 0x58, 0xF6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x08, 0x48, 0x79, 0xFF, 0xFF, 
-    0x59, 0x02, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x59, 0x1E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xC0, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x2C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA8, 0x48, 0x79, 0xFF, 0xFF, 
-    0x59, 0x3C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0x90, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x46, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x78, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x54, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x62, 
-    0x48, 0x79, 0xFF, 0xFF, 0x59, 0x62, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x60, 0x4C, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x70, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x36, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x8B, 0xC0, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0x7C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x18, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 
-    0x59, 0x88, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x79, 0x79, 0x6C, 
-    0x65, 0x78, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFB, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2F, 0x66, 0x00, 0x00, 0x82, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2F, 0x66, 0x16, 0x4E, 0xB9, 
-    0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x0D, 0x67, 0xD4, 0x0C, 0x07, 0x00, 0xFF, 
-    0x66, 0xEC, 0x60, 0xCC, 0x0C, 0x07, 0x00, 0x2A, 0x66, 0x42, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 
-    0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2A, 0x66, 0x1E, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 
-    0x0C, 0x07, 0x00, 0x2F, 0x66, 0x02, 0x60, 0xA8, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 
-    0x00, 0x00, 0x73, 0x66, 0x58, 0x4F, 0x0C, 0x07, 0x00, 0xFF, 0x66, 0xCE, 0x48, 0x79, 0xFF, 0xFF, 
-    0x59, 0x92, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x60, 0xBE, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x2F, 0x58, 0x4F, 0x60, 0x00, 0x07, 0x44, 
-    0x0C, 0x07, 0x00, 0xFF, 0x67, 0x14, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 
-    0x72, 0x08, 0xC2, 0x30, 0x00, 0x00, 0x66, 0x00, 0xFF, 0x58, 0x0C, 0x07, 0x00, 0x23, 0x66, 0x00, 
-    0x01, 0x5E, 0x48, 0x78, 0x04, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x70, 0x0D, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x75, 0xC4, 0x70, 0x6C, 0xB0, 0x2E, 0xFC, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x00, 
-    0xFF, 0x30, 0x70, 0x69, 0xB0, 0x2E, 0xFC, 0x01, 0x66, 0x00, 0xFF, 0x26, 0x70, 0x6E, 0xB0, 0x2E, 
-    0xFC, 0x02, 0x66, 0x00, 0xFF, 0x1C, 0x70, 0x65, 0xB0, 0x2E, 0xFC, 0x03, 0x66, 0x00, 0xFF, 0x12, 
-    0x41, 0xEE, 0xFC, 0x00, 0x5A, 0x48, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xAA, 0x23, 0xC0, 
-    0xFF, 0xFF, 0x5C, 0xDC, 0x70, 0x22, 0x2F, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xF2, 0x52, 0x80, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x02, 0x70, 0x22, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xF2, 0x20, 0x40, 0x42, 0x10, 0x70, 0x3A, 0xB0, 0x39, 0xFF, 0xFF, 0x47, 0x8C, 
-    0x4F, 0xEF, 0x00, 0x14, 0x66, 0x52, 0x70, 0x3A, 0x2F, 0x00, 0x41, 0xF9, 0xFF, 0xFF, 0x47, 0x8C, 
-    0x52, 0x48, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF2, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x38, 
-    0x70, 0x22, 0x2F, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF2, 0x54, 0x80, 
-    0x50, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x02, 
-    0x70, 0x22, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF2, 
-    0x20, 0x40, 0x42, 0x10, 0x4F, 0xEF, 0x00, 0x10, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x48, 0x79, 
-    0xFF, 0xFF, 0x47, 0x8C, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x23, 0xC3, 0xFF, 0xFF, 0x5C, 0xD8, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 
-    0x50, 0x4F, 0x67, 0x00, 0xFE, 0x3C, 0x4A, 0xB9, 0xFF, 0xFF, 0x5C, 0xD8, 0x67, 0x20, 0x48, 0x79, 
-    0xFF, 0xFF, 0x47, 0x8C, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0xB6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0xFE, 0x14, 0x48, 0x79, 
-    0xFF, 0xFF, 0x47, 0x8C, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0xC6, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0xFD, 0xF4, 0x0C, 0x07, 
-    0x00, 0xFF, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x05, 0xBA, 0x0C, 0x07, 0x00, 0x22, 0x66, 0x1C, 
-    0x70, 0x22, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0xAC, 0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC0, 
-    0x20, 0x3C, 0x00, 0x00, 0x01, 0x06, 0x58, 0x4F, 0x60, 0x00, 0x05, 0x98, 0x10, 0x07, 0x04, 0x00, 
-    0x00, 0x21, 0x67, 0x00, 0x00, 0xFC, 0x5B, 0x00, 0x67, 0x00, 0x00, 0x9E, 0x51, 0x00, 0x67, 0x24, 
-    0x04, 0x00, 0x00, 0x0C, 0x67, 0x00, 0x01, 0x8E, 0x55, 0x00, 0x67, 0x00, 0x01, 0x4C, 0x53, 0x00, 
-    0x67, 0x00, 0x00, 0xB2, 0x53, 0x00, 0x67, 0x00, 0x01, 0x04, 0x04, 0x00, 0x00, 0x3E, 0x67, 0x4C, 
-    0x60, 0x00, 0x01, 0x9E, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2E, 
-    0x67, 0x14, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x2E, 
-    0x58, 0x4F, 0x60, 0x00, 0x05, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x0C, 0x00, 0x00, 0x2E, 
-    0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x59, 0xEE, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 
-    0x60, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x1A, 0x60, 0x00, 0x05, 0x18, 0x4E, 0xB9, 0x00, 0x00, 
-    0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x7C, 0x67, 0x14, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 
-    0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x7C, 0x58, 0x4F, 0x60, 0x00, 0x04, 0xF6, 0x20, 0x3C, 
-    0x00, 0x00, 0x01, 0x27, 0x60, 0x00, 0x04, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 
-    0x0C, 0x07, 0x00, 0x26, 0x67, 0x14, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x66, 0x70, 0x26, 0x58, 0x4F, 0x60, 0x00, 0x04, 0xCA, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x26, 
-    0x60, 0x00, 0x04, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x3D, 
-    0x67, 0x14, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x3D, 
-    0x58, 0x4F, 0x60, 0x00, 0x04, 0x9E, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x20, 0x60, 0x00, 0x04, 0x94, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x3D, 0x67, 0x14, 0x48, 0x87, 
-    0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x3D, 0x58, 0x4F, 0x60, 0x00, 
-    0x04, 0x72, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x21, 0x60, 0x00, 0x04, 0x68, 0x4E, 0xB9, 0x00, 0x00, 
-    0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x3E, 0x66, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x25, 
-    0x60, 0x00, 0x04, 0x50, 0x0C, 0x07, 0x00, 0x3D, 0x66, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x23, 
-    0x60, 0x00, 0x04, 0x40, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 
-    0x70, 0x3E, 0x58, 0x4F, 0x60, 0x00, 0x04, 0x2C, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 
-    0x0C, 0x07, 0x00, 0x3C, 0x66, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x24, 0x60, 0x00, 0x04, 0x14, 
-    0x0C, 0x07, 0x00, 0x3D, 0x66, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x22, 0x60, 0x00, 0x04, 0x04, 
-    0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x3C, 0x58, 0x4F, 
-    0x60, 0x00, 0x03, 0xF0, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x3A, 
-    0x66, 0x0A, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x28, 0x60, 0x00, 0x03, 0xD8, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x70, 0x3A, 0x58, 0x4F, 0x60, 0x00, 0x03, 0xC4, 
-    0x0C, 0x07, 0x00, 0x2E, 0x66, 0x46, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 
-    0x00, 0x2E, 0x67, 0x12, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 
-    0x7E, 0x2E, 0x58, 0x4F, 0x60, 0x26, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 
-    0x00, 0x2E, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x5A, 0x02, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 
-    0x58, 0x4F, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x1A, 0x60, 0x00, 0x03, 0x78, 0x0C, 0x07, 0x00, 0x27, 
-    0x66, 0x00, 0x01, 0x48, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 
-    0x15, 0xF0, 0x70, 0x27, 0x2F, 0x00, 0x70, 0x27, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0xAC, 
-    0x58, 0x8F, 0x2F, 0x00, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x70, 0x27, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 
-    0x00, 0x8A, 0x20, 0x6E, 0xFF, 0xC2, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x27, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0xBC, 
-    0x00, 0x27, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x27, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x78, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x83, 0x44, 0x70, 0x00, 0x2D, 0x40, 
-    0xFB, 0xFC, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0x17, 0x70, 0x26, 0x40, 0x52, 0x4B, 
-    0x4F, 0xEF, 0x00, 0x14, 0x60, 0x1C, 0x20, 0x2E, 0xFB, 0xFC, 0xE1, 0x88, 0x12, 0x13, 0x48, 0x81, 
-    0x34, 0x3C, 0x00, 0xFF, 0xC4, 0x01, 0x72, 0x00, 0x12, 0x02, 0xD2, 0x80, 0x2D, 0x41, 0xFB, 0xFC, 
-    0x52, 0x4B, 0x4A, 0x2B, 0x00, 0x01, 0x66, 0xDE, 0x23, 0xEE, 0xFB, 0xFC, 0xFF, 0xFF, 0x8B, 0xC0, 
-    0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0x16, 0x88, 0x20, 0x3C, 
-    0x00, 0x00, 0x01, 0x1E, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x2A, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 
-    0xFF, 0xFF, 0xFB, 0xE0, 0x72, 0x04, 0xC2, 0x30, 0x00, 0x00, 0x67, 0x00, 0x01, 0x10, 0x0C, 0x07, 
-    0x00, 0x30, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x08, 0x60, 0x02, 0x70, 0x0A, 0x48, 0x80, 
-    0x48, 0xC0, 0x2A, 0x00, 0x48, 0x87, 0x30, 0x07, 0x90, 0x7C, 0x00, 0x30, 0x48, 0xC0, 0x2C, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x78, 0x67, 0x08, 0x0C, 0x07, 
-    0x00, 0x58, 0x66, 0x00, 0x00, 0x8C, 0x4A, 0x86, 0x66, 0x00, 0x00, 0x86, 0x7A, 0x10, 0x4E, 0xB9, 
-    0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x60, 0x78, 0x70, 0x08, 0xB0, 0x85, 0x66, 0x1A, 0x0C, 0x07, 
-    0x00, 0x38, 0x67, 0x06, 0x0C, 0x07, 0x00, 0x39, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0x5A, 0x16, 
-    0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x58, 0x4F, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 
-    0xFB, 0xE0, 0x72, 0x04, 0xC2, 0x30, 0x00, 0x00, 0x67, 0x1A, 0x20, 0x06, 0x22, 0x05, 0x4E, 0xB9, 
-    0x00, 0x00, 0x1F, 0xD6, 0x48, 0x87, 0x32, 0x07, 0x92, 0x7C, 0x00, 0x30, 0x48, 0xC1, 0xD2, 0x80, 
-    0x2C, 0x01, 0x60, 0x24, 0x70, 0x10, 0xB0, 0x85, 0x66, 0x40, 0x20, 0x06, 0x22, 0x05, 0x4E, 0xB9, 
-    0x00, 0x00, 0x1F, 0xD6, 0x48, 0x87, 0x32, 0x07, 0x92, 0x7C, 0x00, 0x37, 0x74, 0x0F, 0xC4, 0x41, 
-    0x72, 0x00, 0x32, 0x02, 0xD2, 0x80, 0x2C, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 
-    0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 0x10, 0x30, 0x00, 0x00, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0x80, 0xC2, 0x00, 0x66, 0x00, 0xFF, 0x70, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xBA, 0x72, 0x4C, 0xB2, 0x80, 0x58, 0x4F, 0x67, 0x0E, 0x48, 0x87, 
-    0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x58, 0x4F, 0x23, 0xC6, 0xFF, 0xFF, 
-    0x8B, 0xC0, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x1E, 0x60, 0x00, 0x01, 0x08, 0x70, 0x00, 0x10, 0x07, 
-    0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 0x72, 0x03, 0xC2, 0x30, 0x00, 0x00, 0x66, 0x08, 0x0C, 0x07, 
-    0x00, 0x5F, 0x66, 0x00, 0x00, 0xBE, 0x78, 0x00, 0x20, 0x04, 0x52, 0x84, 0x41, 0xEE, 0xFF, 0x00, 
-    0x11, 0x87, 0x00, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x72, 0xFA, 0x1E, 0x00, 0x0C, 0x84, 0x00, 0x00, 
-    0x00, 0xFF, 0x6C, 0x2A, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 0x72, 0x07, 
-    0xC2, 0x30, 0x00, 0x00, 0x66, 0xD2, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 
-    0x5A, 0x28, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF2, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0xBA, 0x48, 0x87, 
-    0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x66, 0x41, 0xEE, 0xFF, 0x00, 0x42, 0x30, 
-    0x40, 0x00, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x76, 0xF0, 0x2D, 0x40, 0xFB, 0xFC, 
-    0x0C, 0xAE, 0xFF, 0xFF, 0xFC, 0x19, 0xFB, 0xFC, 0x50, 0x4F, 0x67, 0x00, 0xF8, 0xA4, 0x4A, 0xAE, 
-    0xFB, 0xFC, 0x67, 0x06, 0x20, 0x2E, 0xFB, 0xFC, 0x60, 0x68, 0x48, 0x6E, 0xFF, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x0A, 0x52, 0x80, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x8B, 0xC0, 0x48, 0x6E, 0xFF, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0x8B, 0xC0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x02, 0x20, 0x3C, 0x00, 0x00, 0x01, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x30, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0x5A, 0x2A, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xF2, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x08, 0x48, 0x87, 0x48, 0xC7, 0x20, 0x07, 
-    0x60, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x5A, 0x46, 0x4E, 0xB9, 0x00, 0x00, 0x71, 0xF2, 0x70, 0x00, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x18, 0xF8, 0xFB, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x79, 0x79, 0x6C, 
-    0x65, 0x78, 0x32, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x11, 0x18, 0x1E, 0x2E, 0x00, 0x0F, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 
-    0x00, 0x14, 0x66, 0x06, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x14, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x88, 0x20, 0x6C, 
-    0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 0x72, 0x00, 
-    0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 
-    0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 
-    0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 0x20, 0x6C, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 
-    0x5F, 0x6C, 0x73, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD0, 0x76, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFC, 0x38, 0x70, 0x0D, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x12, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x25, 0x2C, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x65, 0x72, 0x72, 0x6F, 0x72, 
-    0x64, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xD0, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x70, 0x0D, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x12, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0x2C, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x53, 
-    0x60, 0x02, 0x52, 0x4C, 0x4A, 0x14, 0x67, 0x12, 0x70, 0x00, 0x10, 0x14, 0x20, 0x79, 0xFF, 0xFF, 
-    0xFB, 0xE0, 0x72, 0x08, 0xC2, 0x30, 0x00, 0x00, 0x66, 0xE8, 0x26, 0x8C, 0x10, 0x14, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x73, 0x6B, 0x69, 0x70, 0x5F, 0x62, 0x6C, 
-    0x5F, 0x5F, 0x46, 0x50, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x08, 
-    0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x7A, 0x01, 0x7C, 0x00, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x84, 0xCC, 0x20, 0x54, 0x70, 0x2D, 0xB0, 0x10, 0x58, 0x4F, 0x66, 0x28, 0x20, 0x05, 0x44, 0x80, 
-    0x2A, 0x00, 0x52, 0x94, 0x60, 0x1E, 0x22, 0x07, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 
-    0x20, 0x54, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0xD0, 0x81, 0x72, 0x30, 0x90, 0x81, 0x2E, 0x00, 
-    0x52, 0x94, 0x7C, 0x01, 0x20, 0x54, 0x70, 0x00, 0x10, 0x10, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 
-    0x72, 0x04, 0xC2, 0x30, 0x00, 0x00, 0x66, 0xCE, 0x4A, 0x86, 0x66, 0x10, 0x2F, 0x14, 0x48, 0x79, 
-    0xFF, 0xFF, 0xD0, 0x7E, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x4A, 0x85, 0x6C, 0x06, 
-    0x20, 0x07, 0x44, 0x80, 0x2E, 0x00, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0xE0, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x73, 0x5F, 0x61, 0x74, 0x6F, 0x69, 0x5F, 0x5F, 0x46, 0x50, 0x50, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x60, 0x2A, 0x10, 0x1C, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xBA, 0x2E, 0x00, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xBA, 0x9E, 0x80, 0x4A, 0x87, 0x50, 0x4F, 0x67, 0x04, 0x20, 0x07, 0x60, 0x32, 0x4A, 0x14, 
-    0x67, 0x04, 0x4A, 0x13, 0x66, 0xCE, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xBA, 0x2D, 0x40, 0xFF, 0xFC, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xBA, 0x22, 0x2E, 0xFF, 0xFC, 0x92, 0x80, 0x20, 0x01, 0x50, 0x4F, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x53, 0x74, 0x72, 0x69, 0x6E, 
-    0x67, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x0F, 0x18, 0x28, 0x2E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x14, 0x7E, 0x01, 0x60, 0x00, 0x02, 0xDC, 0x7A, 0x00, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 0x22, 0x00, 0xC0, 0xFC, 
-    0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x4A, 0xB0, 
-    0x08, 0x00, 0x67, 0x34, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 0x22, 0x00, 0xC0, 0xFC, 
-    0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x2F, 0x30, 
-    0x08, 0x00, 0x20, 0x07, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x85, 0xAC, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x00, 0x02, 0x76, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 
-    0xD0, 0x81, 0x2D, 0x70, 0x08, 0x08, 0xFF, 0xF0, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 
-    0xD0, 0x81, 0x28, 0x70, 0x08, 0x04, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x60, 0x00, 0x02, 0x20, 0x20, 0x6E, 0xFF, 0xF0, 0x52, 0xAE, 0xFF, 0xF0, 0x10, 0x10, 0x04, 0x00, 
-    0x00, 0x30, 0x67, 0x00, 0x02, 0x20, 0x55, 0x00, 0x67, 0x00, 0x01, 0x26, 0x04, 0x00, 0x00, 0x12, 
-    0x67, 0x00, 0x01, 0x8E, 0x55, 0x00, 0x67, 0x00, 0x00, 0xD4, 0x04, 0x00, 0x00, 0x1C, 0x67, 0x00, 
-    0x00, 0x9E, 0x55, 0x00, 0x67, 0x14, 0x55, 0x00, 0x67, 0x00, 0x00, 0xAC, 0x5B, 0x00, 0x67, 0x00, 
-    0x01, 0xB2, 0x51, 0x00, 0x67, 0x4E, 0x60, 0x00, 0x01, 0xAE, 0x52, 0x87, 0xB8, 0x87, 0x6E, 0x18, 
-    0x20, 0x07, 0x53, 0x80, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD0, 0xA0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 0xE5, 0x80, 0x2D, 0x73, 0x08, 0x00, 
-    0xFF, 0xF4, 0x4A, 0x86, 0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x01, 0xBA, 0x20, 0x0C, 0x67, 0x00, 
-    0x01, 0xB4, 0x48, 0x6E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x85, 0x12, 0x28, 0x80, 0x58, 0x4F, 
-    0x60, 0x00, 0x01, 0xA2, 0x52, 0x87, 0xB8, 0x87, 0x6E, 0x18, 0x20, 0x07, 0x53, 0x80, 0xE5, 0x80, 
-    0x2F, 0x33, 0x08, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD0, 0xB8, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 
-    0x50, 0x4F, 0x4A, 0x86, 0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x01, 0x7A, 0x20, 0x0C, 0x67, 0x00, 
-    0x01, 0x74, 0x20, 0x07, 0xE5, 0x80, 0x28, 0xB3, 0x08, 0x00, 0x60, 0x00, 0x01, 0x68, 0x4A, 0x86, 
-    0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x01, 0x5E, 0x20, 0x0C, 0x67, 0x00, 0x01, 0x58, 0x18, 0xBC, 
-    0x00, 0x01, 0x60, 0x00, 0x01, 0x50, 0x4A, 0x86, 0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x01, 0x46, 
-    0x20, 0x0C, 0x67, 0x00, 0x01, 0x40, 0x4E, 0x94, 0x60, 0x00, 0x01, 0x3A, 0x52, 0x87, 0xB8, 0x87, 
-    0x6E, 0x18, 0x20, 0x07, 0x53, 0x80, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xD0, 0xD0, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 0xE5, 0x80, 0x2D, 0x73, 
-    0x08, 0x00, 0xFF, 0xF4, 0x4A, 0x86, 0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x01, 0x08, 0x20, 0x0C, 
-    0x67, 0x00, 0x01, 0x02, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0x94, 0x58, 0x4F, 0x60, 0x00, 0x00, 0xF6, 
-    0x52, 0x87, 0xB8, 0x87, 0x6E, 0x18, 0x20, 0x07, 0x53, 0x80, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 
-    0x48, 0x79, 0xFF, 0xFF, 0xD0, 0xE8, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 
-    0xE5, 0x80, 0x2D, 0x73, 0x08, 0x00, 0xFF, 0xF4, 0x52, 0x87, 0xB8, 0x87, 0x6E, 0x18, 0x20, 0x07, 
-    0x55, 0x80, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD1, 0x02, 0x4E, 0xB9, 
-    0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 0xE5, 0x80, 0x2D, 0x73, 0x08, 0x00, 0xFF, 0xF8, 
-    0x4A, 0x86, 0x67, 0x06, 0xBC, 0x85, 0x66, 0x00, 0x00, 0x9C, 0x20, 0x0C, 0x67, 0x00, 0x00, 0x96, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0x94, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x86, 
-    0x20, 0x07, 0xE5, 0x80, 0x20, 0x73, 0x08, 0x00, 0x70, 0x2D, 0xB0, 0x10, 0x66, 0x1A, 0x20, 0x0C, 
-    0x66, 0x16, 0x20, 0x07, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD1, 0x1C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x4A, 0x86, 0x67, 0x04, 0xBC, 0x85, 0x66, 0x54, 
-    0x20, 0x0C, 0x67, 0x50, 0x20, 0x07, 0xE5, 0x80, 0x2F, 0x33, 0x08, 0x00, 0x4E, 0x94, 0x58, 0x4F, 
-    0x60, 0x42, 0x2A, 0x0C, 0x60, 0x2C, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x2E, 0xFF, 0xFC, 0x22, 0x00, 
-    0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 
-    0x2F, 0x30, 0x08, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xD1, 0x32, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 
-    0x50, 0x4F, 0x20, 0x6E, 0xFF, 0xF0, 0x4A, 0x10, 0x66, 0x00, 0xFD, 0xDA, 0x52, 0xAE, 0xFF, 0xFC, 
-    0x60, 0x00, 0xFD, 0x32, 0x52, 0x87, 0xB8, 0x87, 0x6E, 0x00, 0xFD, 0x22, 0x4C, 0xEE, 0x18, 0xF0, 
-    0xFF, 0xD8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x25, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x41, 
-    0x72, 0x67, 0x73, 0x5F, 0x5F, 0x46, 0x69, 0x50, 0x50, 0x63, 0x50, 0x31, 0x34, 0x41, 0x72, 0x67, 
-    0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x54, 0x31, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xD1, 0x4E, 0x4E, 0xB9, 
-    0x00, 0x00, 0x84, 0x74, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x6D, 0x65, 0x6D, 0x65, 0x72, 0x72, 0x5F, 
-    0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 
-    0x00, 0x08, 0x7E, 0x00, 0x60, 0x14, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xBA, 0xDE, 0x80, 0x58, 0x4F, 0x52, 0x4C, 0x4A, 0x14, 0x66, 0xE8, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x90, 0x68, 0x61, 0x73, 0x68, 0x5F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x5F, 0x5F, 0x46, 0x50, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0xD1, 0x74, 0x66, 0x3E, 0x20, 0x3C, 0x00, 0x00, 0x0F, 0xA0, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 
-    0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xD1, 0x62, 0x4E, 0xB9, 0x00, 0x00, 0x89, 0x6A, 0x58, 0x4F, 
-    0x23, 0xCC, 0xFF, 0xFF, 0xD1, 0x74, 0x2E, 0x3C, 0x00, 0x00, 0x00, 0xC8, 0x60, 0x0C, 0x20, 0x0C, 
-    0x72, 0x14, 0xD0, 0x81, 0x28, 0x80, 0x49, 0xEC, 0x00, 0x14, 0x53, 0x87, 0x66, 0xF0, 0x70, 0x00, 
-    0x28, 0x80, 0x28, 0x79, 0xFF, 0xFF, 0xD1, 0x74, 0x23, 0xD4, 0xFF, 0xFF, 0xD1, 0x74, 0x70, 0x14, 
-    0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xE2, 0x20, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x61, 
-    0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x5F, 0x5F, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x47, 0xF9, 0xFF, 0xFF, 0xD5, 0x78, 
-    0x3E, 0x2E, 0x00, 0x0E, 0x30, 0x07, 0xE0, 0x48, 0xE5, 0x40, 0x28, 0x73, 0x00, 0x00, 0x20, 0x0C, 
-    0x66, 0x14, 0x20, 0x3C, 0x00, 0x00, 0x04, 0x00, 0xA1, 0x1E, 0x30, 0x07, 0xE0, 0x48, 0xE5, 0x40, 
-    0x27, 0x88, 0x00, 0x00, 0x28, 0x48, 0x20, 0x0C, 0x67, 0x16, 0x70, 0x00, 0x30, 0x07, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0xE5, 0x80, 0x29, 0xAE, 0x00, 0x08, 0x08, 0x00, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x69, 0x6E, 0x73, 0x74, 0x61, 
-    0x6C, 0x6C, 0x69, 0x64, 0x5F, 0x5F, 0x46, 0x50, 0x36, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x55, 
-    0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x3E, 0x2E, 0x00, 0x0E, 
-    0x26, 0x6E, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x89, 0x90, 0xE5, 0x40, 0x20, 0x7C, 
-    0xFF, 0xFF, 0xD1, 0x78, 0x28, 0x70, 0x00, 0x00, 0x58, 0x4F, 0x60, 0x1A, 0xBE, 0x6C, 0x00, 0x0C, 
-    0x66, 0x12, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 
-    0x50, 0x4F, 0x67, 0x06, 0x28, 0x54, 0x20, 0x0C, 0x66, 0xE2, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x80, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x5F, 0x5F, 0x46, 
-    0x50, 0x63, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x47, 0xF9, 
-    0xFF, 0xFF, 0xD1, 0x78, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x06, 0x29, 0x6E, 
-    0x00, 0x0C, 0x00, 0x04, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x1C, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 
-    0x00, 0x00, 0x89, 0x90, 0x2E, 0x00, 0xE5, 0x40, 0x28, 0xB3, 0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 
-    0x27, 0x8C, 0x00, 0x00, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x98, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 0x50, 
-    0x36, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x3E, 0x2E, 0x00, 0x12, 0x4E, 0xB9, 0x00, 0x00, 
-    0x89, 0xDE, 0x28, 0x40, 0x39, 0x6E, 0x00, 0x0E, 0x00, 0x0C, 0x39, 0x47, 0x00, 0x12, 0x20, 0x0B, 
-    0x67, 0x0C, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8B, 0x40, 0x50, 0x4F, 0x4A, 0x47, 
-    0x67, 0x10, 0x70, 0x00, 0x30, 0x07, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8A, 0x6C, 
-    0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x6E, 
-    0x65, 0x77, 0x73, 0x79, 0x6D, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x73, 0x55, 0x73, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x14, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0A, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xAC, 0x58, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 
-    0x67, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x30, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x0C, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xD2, 0x58, 0x4F, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x22, 0x0C, 
-    0x67, 0x14, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x04, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x28, 0x80, 0x29, 0x40, 0x00, 0x10, 
-    0x48, 0x78, 0x04, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xCA, 0x29, 0x40, 0x00, 0x04, 0x58, 0x4F, 
-    0x66, 0x20, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0x78, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0x2C, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x49, 0x6E, 0x69, 0x74, 0x5F, 
-    0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xAC, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 
-    0x00, 0x0C, 0x4A, 0xAE, 0x00, 0x18, 0x67, 0x0A, 0x41, 0xF9, 0xFF, 0xFF, 0xD9, 0xAE, 0x20, 0x08, 
-    0x60, 0x08, 0x41, 0xF9, 0xFF, 0xFF, 0xD9, 0xB0, 0x20, 0x08, 0x2F, 0x00, 0x4A, 0xAE, 0x00, 0x14, 
-    0x67, 0x0A, 0x41, 0xF9, 0xFF, 0xFF, 0xD9, 0xB2, 0x20, 0x08, 0x60, 0x08, 0x41, 0xF9, 0xFF, 0xFF, 
-    0xD9, 0xB4, 0x20, 0x08, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 
-    0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xB6, 0x2F, 0x2C, 
-    0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x2A, 0x4F, 0xEF, 0x00, 0x20, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x5F, 0x5F, 0x38, 
-    0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x50, 0x63, 0x54, 0x31, 0x69, 0x54, 0x33, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xAC, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 
-    0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x2F, 0x0B, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 
-    0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xC4, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x2A, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x4F, 
-    0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 
-    0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8C, 0xAC, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x2F, 0x0B, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xD9, 0xD2, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x2A, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x44, 
-    0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 
-    0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xAC, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 0x00, 0x08, 
-    0x29, 0x40, 0x00, 0x0C, 0x4A, 0xAE, 0x00, 0x0C, 0x67, 0x0A, 0x41, 0xF9, 0xFF, 0xFF, 0xD9, 0xE0, 
-    0x20, 0x08, 0x60, 0x08, 0x41, 0xF9, 0xFF, 0xFF, 0xD9, 0xE2, 0x20, 0x08, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xD9, 0xE4, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x2A, 0x4F, 0xEF, 
-    0x00, 0x10, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x46, 0x75, 0x6E, 0x63, 0x50, 
-    0x74, 0x72, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x69, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFB, 0xFC, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x42, 0x2E, 
-    0xFB, 0xFC, 0x48, 0x6E, 0xFB, 0xFC, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x12, 
-    0x70, 0x00, 0x26, 0x40, 0x76, 0x01, 0x22, 0x0B, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x58, 0x8F, 0x26, 0x1F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x48, 0x6E, 0xFB, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 
-    0x26, 0x80, 0x70, 0x00, 0x27, 0x40, 0x00, 0x04, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x4B, 
-    0xFF, 0xFC, 0x4A, 0xAC, 0x00, 0x08, 0x50, 0x4F, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x0C, 0x21, 0x4B, 
-    0x00, 0x04, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x60, 0x0C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 
-    0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFB, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9A, 0x41, 0x64, 0x64, 0x50, 0x61, 0x72, 0x6D, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 
-    0x6C, 0x65, 0x72, 0x46, 0x50, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x60, 0x12, 
-    0x2F, 0x2B, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0xFC, 0x50, 0x4F, 0x26, 0x6B, 
-    0x00, 0x04, 0x20, 0x0B, 0x66, 0xEA, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x21, 0x41, 0x64, 0x64, 0x50, 0x61, 0x72, 0x6D, 0x73, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 
-    0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x50, 0x31, 0x30, 0x54, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 
-    0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x21, 0x6E, 
-    0x00, 0x0C, 0x00, 0x10, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x20, 0x41, 0x64, 0x64, 0x52, 0x65, 0x74, 
-    0x75, 0x72, 0x6E, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 
-    0x65, 0x72, 0x46, 0x50, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x7E, 0x01, 0x20, 0x6E, 0x00, 0x08, 0x28, 0x68, 
-    0x00, 0x08, 0x60, 0x22, 0xB7, 0xCC, 0x66, 0x04, 0x70, 0x00, 0x60, 0x1E, 0x2F, 0x14, 0x2F, 0x13, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x04, 0x20, 0x07, 0x60, 0x0A, 
-    0x52, 0x87, 0x28, 0x6C, 0x00, 0x04, 0x20, 0x0C, 0x66, 0xDA, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x46, 0x69, 0x6E, 0x64, 0x50, 0x72, 0x69, 0x6F, 0x72, 0x55, 
-    0x73, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x50, 0x39, 
-    0x54, 0x50, 0x61, 0x72, 0x6D, 0x4E, 0x6F, 0x64, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEC, 
-    0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6C, 0x00, 0x08, 0x60, 0x36, 0x2F, 0x0B, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x90, 0x36, 0x2E, 0x00, 0x50, 0x4F, 0x67, 0x22, 0x2F, 0x07, 
-    0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xEA, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x2A, 
-    0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x26, 0x80, 0x4F, 0xEF, 0x00, 0x10, 
-    0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 0x66, 0xC6, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xE0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9F, 0x52, 0x65, 0x77, 0x72, 0x69, 0x74, 0x65, 0x41, 0x73, 0x50, 0x72, 0x69, 0x6F, 
-    0x72, 0x52, 0x65, 0x66, 0x73, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xF8, 0x00, 0x48, 0xE7, 0x07, 0x18, 0x7E, 0x00, 0x70, 0x00, 
-    0x28, 0x40, 0x7C, 0x00, 0x7A, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x26, 0x68, 0x00, 0x08, 0x60, 0x74, 
-    0x70, 0x09, 0xB0, 0x87, 0x67, 0x14, 0x4A, 0x87, 0x67, 0x3E, 0x2F, 0x14, 0x2F, 0x13, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x2E, 0x20, 0x14, 0x52, 0x80, 0x2F, 0x00, 
-    0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xEE, 0x48, 0x6E, 0xF8, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x2A, 0x48, 0x6E, 0xF8, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x28, 0x80, 0x7E, 0x00, 
-    0x70, 0x00, 0x28, 0x40, 0x4F, 0xEF, 0x00, 0x14, 0x20, 0x0C, 0x67, 0x1E, 0x2F, 0x14, 0x2F, 0x13, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0E, 0x4A, 0x87, 0x66, 0x02, 
-    0x7E, 0x01, 0x52, 0x87, 0x70, 0x00, 0x26, 0x80, 0x60, 0x04, 0x28, 0x4B, 0x2A, 0x06, 0x26, 0x6B, 
-    0x00, 0x04, 0x52, 0x86, 0x20, 0x0B, 0x66, 0x88, 0x4A, 0x87, 0x67, 0x28, 0x20, 0x14, 0x52, 0x80, 
-    0x2F, 0x00, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xF4, 0x48, 0x6E, 0xFC, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x2A, 0x48, 0x6E, 0xFC, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x28, 0x80, 
-    0x4F, 0xEF, 0x00, 0x14, 0x4C, 0xEE, 0x18, 0xE0, 0xF7, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x43, 
-    0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x52, 0x75, 0x6E, 0x73, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 
-    0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0x94, 0x67, 0x06, 0x20, 0x2C, 0x00, 0x04, 0x60, 0x7C, 
-    0x4A, 0xAC, 0x00, 0x08, 0x66, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xFA, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x5A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x90, 0xA6, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x91, 0x1E, 0x26, 0x6C, 0x00, 0x08, 0x50, 0x4F, 
-    0x60, 0x16, 0x4A, 0x93, 0x67, 0x0E, 0x2F, 0x13, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x50, 0x4F, 0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 0x66, 0xE6, 0x4A, 0xAC, 0x00, 0x10, 
-    0x67, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xD9, 0xFC, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0x12, 
-    0x4F, 0xEF, 0x00, 0x10, 0x70, 0x01, 0x28, 0x80, 0x20, 0x2C, 0x00, 0x04, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 
-    0x61, 0x6E, 0x67, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0A, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x04, 
-    0x28, 0xAE, 0x00, 0x10, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 
-    0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x46, 0x50, 0x35, 0x54, 
-    0x54, 0x79, 0x70, 0x65, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0x90, 
-    0x66, 0x04, 0x20, 0x8C, 0x60, 0x16, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x50, 0x60, 0x04, 0x26, 0x6B, 
-    0x00, 0x08, 0x4A, 0xAB, 0x00, 0x08, 0x66, 0xF6, 0x27, 0x4C, 0x00, 0x08, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x5F, 
-    0x5F, 0x36, 0x54, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x46, 0x50, 0x50, 0x36, 0x54, 0x46, 0x69, 0x65, 
-    0x6C, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x66, 0x12, 0x70, 0x10, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x2A, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x16, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x08, 0x28, 0xAE, 0x00, 0x10, 0x29, 0x6E, 
-    0x00, 0x14, 0x00, 0x04, 0x29, 0x6E, 0x00, 0x18, 0x00, 0x0C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2B, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x50, 
-    0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x46, 0x50, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 
-    0x50, 0x63, 0x50, 0x31, 0x30, 0x54, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x54, 
-    0x32, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x4A, 0xAE, 0x00, 0x10, 0x67, 0x16, 0x4A, 0x94, 0x66, 0x12, 0x4E, 0xB9, 0x00, 0x00, 0x97, 0x8C, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x28, 0x80, 0x58, 0x4F, 0x2F, 0x14, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x26, 0x6C, 0x00, 0x08, 0x0C, 0x93, 0x00, 0x03, 0x00, 0x00, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x06, 0x20, 0x2B, 0x00, 0x10, 0x60, 0x02, 0x20, 0x0B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x05, 0x0A, 0x4A, 0xAE, 0x00, 0x14, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x1E, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x67, 0x18, 0x2F, 0x2C, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0xEA, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x50, 
-    0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x69, 
-    0x54, 0x32, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE2, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x4A, 0x80, 0x58, 0x4F, 
-    0x66, 0x24, 0x4A, 0xB9, 0xFF, 0xFF, 0xFB, 0x44, 0x66, 0x1C, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 
-    0xFB, 0x44, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xB4, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x58, 0x8F, 
-    0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xFC, 0x48, 0x6E, 0xFF, 0xE2, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x2A, 0x48, 0x6E, 0xFF, 0xE2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x2F, 0x0C, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x1C, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xDA, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x64, 0x53, 0x74, 
-    0x72, 0x63, 0x61, 0x74, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x54, 0xB0, 0x14, 0x66, 0x1A, 0x70, 0x00, 
-    0x10, 0x2C, 0x00, 0x01, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0xE0, 0x72, 0x01, 0xC2, 0x30, 0x00, 0x00, 
-    0x67, 0x06, 0x20, 0x0C, 0x52, 0x80, 0x60, 0x02, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x92, 0x53, 0x74, 0x72, 0x69, 0x70, 0x4C, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x54, 
-    0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 
-    0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x47, 0xF9, 0xFF, 0xFF, 0xF7, 0x44, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x0C, 0x70, 0x2E, 0xB0, 0x14, 0x66, 0x04, 0x2D, 0x4B, 0xFF, 0xFC, 
-    0x16, 0xDC, 0x4A, 0x14, 0x66, 0xF0, 0x42, 0x1B, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x06, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x42, 0x10, 0x20, 0x07, 0x6B, 0x44, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x04, 0x6E, 0x3C, 
-    0xD0, 0x80, 0x30, 0x3B, 0x08, 0x06, 0x4E, 0xFB, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x14, 0x00, 0x1C, 
-    0x00, 0x24, 0x00, 0x2C, 0x47, 0xF9, 0xFF, 0xFF, 0xF6, 0x00, 0x60, 0x30, 0x47, 0xF9, 0xFF, 0xFF, 
-    0xF6, 0x04, 0x60, 0x28, 0x47, 0xF9, 0xFF, 0xFF, 0xF6, 0x0C, 0x60, 0x20, 0x47, 0xF9, 0xFF, 0xFF, 
-    0xF6, 0x14, 0x60, 0x18, 0x47, 0xF9, 0xFF, 0xFF, 0xF6, 0x18, 0x60, 0x10, 0x2F, 0x07, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF6, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x1C, 0x50, 0x4F, 0x2F, 0x0B, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF7, 0x44, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x41, 0xF9, 0xFF, 0xFF, 0xF7, 0x44, 
-    0x20, 0x08, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x4F, 
-    0x75, 0x74, 0x70, 0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 
-    0x69, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x49, 0xF9, 
-    0xFF, 0xFF, 0xF7, 0x30, 0x2E, 0x2E, 0x00, 0x08, 0x4A, 0x39, 0xFF, 0xFF, 0x47, 0x76, 0x67, 0x0C, 
-    0x41, 0xF9, 0xFF, 0xFF, 0xFC, 0x22, 0x20, 0x08, 0x60, 0x00, 0x00, 0x90, 0x20, 0x07, 0xE5, 0x40, 
-    0x4A, 0xB4, 0x00, 0x00, 0x66, 0x62, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 
-    0x95, 0x52, 0x26, 0x40, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x60, 0x50, 0x4F, 0x67, 0x18, 0x2F, 0x0B, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF6, 0x44, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0x62, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x4A, 0x22, 0x07, 0xE5, 0x41, 0x29, 0x80, 0x10, 0x00, 0x20, 0x07, 0xE5, 0x40, 
-    0x4A, 0xB4, 0x00, 0x00, 0x50, 0x4F, 0x66, 0x10, 0x2F, 0x0B, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0x64, 
-    0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 0xE5, 0x40, 0x4A, 0xB4, 0x00, 0x00, 
-    0x66, 0x10, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0x84, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x1C, 
-    0x50, 0x4F, 0x20, 0x07, 0xE5, 0x40, 0x20, 0x34, 0x00, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x5F, 
-    0x5F, 0x46, 0x69, 0x54, 0x31, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x00, 0x18, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x99, 0xBE, 0x26, 0x40, 0x2D, 0x6E, 
-    0x00, 0x0C, 0xFF, 0xFC, 0x70, 0x00, 0x28, 0x40, 0x58, 0x4F, 0x60, 0x2E, 0x70, 0x2E, 0xB0, 0x13, 
-    0x66, 0x0C, 0x20, 0x0C, 0x67, 0x04, 0x18, 0xBC, 0x00, 0x5F, 0x28, 0x6E, 0xFF, 0xFC, 0x10, 0x1B, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xBA, 0x22, 0x2E, 0xFF, 0xFC, 
-    0x52, 0xAE, 0xFF, 0xFC, 0x20, 0x41, 0x10, 0x80, 0x58, 0x4F, 0x4A, 0x13, 0x66, 0xCE, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x20, 0x40, 0x42, 0x10, 0x20, 0x0C, 0x67, 0x02, 0x42, 0x14, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x55, 0x70, 0x70, 0x65, 
-    0x72, 0x63, 0x61, 0x73, 0x65, 0x41, 0x6E, 0x64, 0x53, 0x74, 0x72, 0x69, 0x70, 0x70, 0x65, 0x64, 
-    0x46, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x49, 0xF9, 0xFF, 0xFF, 0xF7, 0x1C, 0x52, 0xB9, 
-    0xFF, 0xFF, 0xF7, 0x18, 0x2F, 0x39, 0xFF, 0xFF, 0xF7, 0x18, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0xCC, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x2A, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8A, 0x47, 0x65, 0x6E, 0x53, 0x79, 0x6D, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x7E, 0x01, 0x60, 0x00, 0x00, 0x9C, 0x4A, 0x87, 0x67, 0x04, 0x7E, 0x00, 
-    0x60, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0xD2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x20, 0x06, 0x53, 0x80, 0x67, 0x06, 0x53, 0x80, 0x67, 0x2E, 0x60, 0x5E, 0x4A, 0x94, 
-    0x66, 0x12, 0x4E, 0xB9, 0x00, 0x00, 0x97, 0x8C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 
-    0x28, 0x80, 0x58, 0x4F, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0xD6, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x46, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 
-    0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0xCE, 0x4A, 0xAC, 0x00, 0x0C, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x2C, 0x2F, 0x2C, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0xDA, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x14, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x93, 0xCE, 0x4F, 0xEF, 0x00, 0x10, 
-    0x28, 0x6C, 0x00, 0x04, 0x20, 0x0C, 0x66, 0x00, 0xFF, 0x62, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x29, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x50, 0x61, 0x72, 0x61, 0x6D, 
-    0x65, 0x74, 0x65, 0x72, 0x4C, 0x69, 0x73, 0x74, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 
-    0x45, 0x50, 0x31, 0x30, 0x54, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x69, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x52, 0x80, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xCA, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF6, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x2F, 0x0B, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x02, 0x20, 0x0C, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 
-    0x5F, 0x5F, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x2E, 0x2E, 0x00, 0x08, 0x70, 0x05, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xCA, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF6, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x84, 0x74, 0x50, 0x4F, 0x20, 0x07, 0x48, 0x40, 0x48, 0xC0, 0xE0, 0x40, 
-    0x18, 0x80, 0x20, 0x07, 0x48, 0x40, 0x48, 0xC0, 0x19, 0x40, 0x00, 0x01, 0x20, 0x07, 0xE0, 0x80, 
-    0x19, 0x40, 0x00, 0x02, 0x19, 0x47, 0x00, 0x03, 0x42, 0x2C, 0x00, 0x04, 0x4A, 0x14, 0x66, 0x04, 
-    0x18, 0xBC, 0x00, 0x20, 0x4A, 0x2C, 0x00, 0x01, 0x66, 0x06, 0x19, 0x7C, 0x00, 0x20, 0x00, 0x01, 
-    0x4A, 0x2C, 0x00, 0x02, 0x66, 0x06, 0x19, 0x7C, 0x00, 0x20, 0x00, 0x02, 0x4A, 0x2C, 0x00, 0x03, 
-    0x66, 0x06, 0x19, 0x7C, 0x00, 0x20, 0x00, 0x03, 0x20, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x4C, 0x6F, 0x6E, 0x67, 0x54, 0x6F, 0x53, 0x74, 0x72, 0x5F, 0x5F, 
-    0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 0x28, 0x40, 0xD9, 0xCB, 0x58, 0x4F, 0x60, 0x02, 
-    0x53, 0x4C, 0xB7, 0xCC, 0x64, 0x06, 0x70, 0x3A, 0xB0, 0x14, 0x66, 0xF4, 0x70, 0x3A, 0xB0, 0x14, 
-    0x66, 0x06, 0x20, 0x0C, 0x52, 0x80, 0x60, 0x02, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x4C, 0x65, 0x61, 0x66, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 
-    0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x2A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0E, 0x28, 0x93, 0x26, 0x8C, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x08, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x43, 
-    0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x46, 0x50, 0x50, 0x31, 0x31, 0x54, 0x43, 
-    0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 0x20, 0x6E, 0x00, 0x08, 0x21, 0x40, 
-    0x00, 0x04, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x53, 0x65, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x43, 
-    0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x98, 0xBC, 0x29, 0x40, 0x00, 0x04, 0x2F, 0x2E, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x98, 0xBC, 
-    0x29, 0x40, 0x00, 0x08, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x53, 0x65, 0x74, 
-    0x5F, 0x5F, 0x31, 0x31, 0x54, 0x43, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x46, 
-    0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2C, 0x00, 0x04, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0x48, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x16, 0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0x56, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0x5C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0x94, 0x50, 0x4F, 0x67, 0x0C, 0x2F, 0x0B, 0x2F, 0x14, 
-    0x4E, 0xB9, 0x00, 0x00, 0x9A, 0xF0, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9A, 0x45, 0x6D, 0x69, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x43, 0x61, 0x70, 0x61, 
-    0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 
-    0x93, 0x85, 0x08, 0x03, 0x03, 0x06, 0x12, 0x03, 0x03, 0x0E, 0x13, 0x03, 0x10, 0x03, 0x12, 0x03, 
-    0x11, 0x03, 0x14, 0x03, 0x1B, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x14, 0x03, 0x14, 0x03, 
-    0x16, 0x03, 0x15, 0x03, 0x12, 0x03, 0x11, 0x03, 0x15, 0x0A, 0x03, 0x06, 0x03, 0x06, 0x03, 0x04, 
-    0x03, 0x06, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x1B, 0x07, 0x03, 0x08, 0x0B, 0x06, 
-    0x04, 0x03, 0x03, 0x03, 0x06, 0x05, 0x03, 0x03, 0x03, 0x05, 0x04, 0x05, 0x03, 0x03, 0x03, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x05, 0x08, 0x06, 0x15, 0x50, 0x03, 0x04, 0x03, 0x03, 0x03, 0x05, 0x04, 
-    0x03, 0x03, 0x0F, 0x17, 0x05, 0x05, 0x03, 0x03, 0x07, 0x03, 0x04, 0x03, 0x03, 0x07, 0x12, 0x03, 
-    0x03, 0x04, 0x22, 0x09, 0x09, 0x04, 0x09, 0x04, 0x0A, 0x17, 0x14, 0x08, 0x07, 0x10, 0x04, 0x03, 
-    0x04, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x06, 0x04, 0x18, 0x0B, 0x04, 0x05, 0x04, 0x19, 0x14, 
-    0x18, 0x04, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x06, 0x04, 0x03, 0x04, 0x03, 0x04, 0x06, 0x04, 0x03, 0x04, 0x06, 0x03, 0x0D, 0x05, 0x18, 
-    0x0B, 0x04, 0x05, 0x04, 0x19, 0x14, 0x08, 0x0E, 0x07, 0x2E, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 
-    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x1E, 0x04, 0x03, 0x04, 
-    0x05, 0x06, 0x0A, 0x04, 0x06, 0x03, 0x0D, 0x05, 0x1A, 0x04, 0x08, 0x1E, 0x20, 0x1B, 0x09, 0x17, 
-    0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x05, 0x06, 0x0A, 0x04, 0x03, 0x07, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 
-    0x04, 0x03, 0x04, 0x03, 0x04, 0x04, 0x17, 0x04, 0x09, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x06, 0x04, 
-    0x23, 0x25, 0x07, 0x18, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x09, 0x07, 
-    0x05, 0x03, 0x08, 0x04, 0x04, 0x07, 0x04, 0x03, 0x03, 0x03, 0x05, 0x04, 0x09, 0x0D, 0x06, 0x05, 
-    0x06, 0x07, 0x03, 0x03, 0x05, 0x05, 0x0C, 0x06, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x05, 
-    0x05, 0x04, 0x08, 0x0B, 0x06, 0x06, 0x09, 0x04, 0x07, 0x04, 0x06, 0x03, 0x05, 0x16, 0x08, 0x06, 
-    0x07, 0x06, 0x03, 0x05, 0x05, 0x0C, 0x06, 0x03, 0x03, 0x04, 0x03, 0x03, 0x05, 0x04, 0x06, 0x03, 
-    0x04, 0x03, 0x05, 0x03, 0x05, 0x05, 0x08, 0x04, 0x04, 0x07, 0x04, 0x03, 0x03, 0x03, 0x06, 0x05, 
-    0x06, 0x06, 0x03, 0x03, 0x07, 0x09, 0x05, 0x80, 0xDB, 0x03, 0x05, 0x0F, 0x0B, 0x0A, 0x0A, 0x05, 
-    0x04, 0x05, 0x03, 0x03, 0x07, 0x03, 0x05, 0x05, 0x09, 0x09, 0x05, 0x07, 0x03, 0x03, 0x03, 0x03, 
-    0x03, 0x07, 0x03, 0x03, 0x03, 0x0B, 0x09, 0x05, 0x07, 0x0F, 0x07, 0x0A, 0x05, 0x04, 0x03, 0x03, 
-    0x03, 0x04, 0x07, 0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 0x0B, 0x09, 0x09, 0x07, 0x04, 0x03, 0x03, 
-    0x03, 0x04, 0x07, 0x03, 0x03, 0x03, 0x0B, 0x0A, 0x05, 0x07, 0x06, 0x1A, 0x1C, 0x07, 0x05, 0x05, 
-    0x03, 0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x0B, 0x0D, 0x04, 0x1A, 0x1C, 0x07, 0x05, 0x05, 
-    0x03, 0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x07, 0x03, 0x05, 0x09, 0x0B, 0x07, 0x06, 0x09, 
-    0x06, 0x03, 0x03, 0x04, 0x11, 0x0B, 0x04, 0x07, 0x05, 0x03, 0x03, 0x09, 0x10, 0x07, 0x03, 0x03, 
-    0x04, 0x0D, 0x04, 0x0E, 0x07, 0x04, 0x05, 0x03, 0x03, 0x05, 0x04, 0x05, 0x11, 0x0D, 0x1A, 0x16, 
-    0x0F, 0x05, 0x03, 0x05, 0x09, 0x0B, 0x07, 0x06, 0x0A, 0x1E, 0x06, 0x04, 0x08, 0x03, 0x04, 0x11, 
-    0x0B, 0x04, 0x07, 0x05, 0x03, 0x03, 0x09, 0x10, 0x20, 0x06, 0x04, 0x08, 0x03, 0x04, 0x0D, 0x04, 
-    0x0D, 0x07, 0x04, 0x05, 0x03, 0x03, 0x05, 0x04, 0x05, 0x11, 0x0D, 0x1A, 0x16, 0x0F, 0x07, 0x11, 
-    0x0D, 0x1A, 0x16, 0x0D, 0x05, 0x05, 0x03, 0x03, 0x09, 0x11, 0x0D, 0x1A, 0x16, 0x0D, 0x05, 0x05, 
-    0x03, 0x03, 0x07, 0x07, 0x05, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x09, 0x09, 0x11, 0x0C, 
-    0x0D, 0x0C, 0x15, 0x0C, 0x0E, 0x0C, 0x16, 0x0C, 0x05, 0x0E, 0x0C, 0x06, 0x18, 0x0C, 0x06, 0x18, 
-    0x0C, 0x06, 0x1D, 0x09, 0x06, 0x1A, 0x16, 0x06, 0x09, 0x05, 0x07, 0x05, 0x0D, 0x03, 0x08, 0x0E, 
-    0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x09, 0x06, 0x07, 0x03, 0x08, 0x0D, 0x06, 0x09, 0x06, 0x0B, 
-    0x06, 0x09, 0x0D, 0x03, 0x08, 0x09, 0x06, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x03, 0x0A, 0x05, 
-    0x05, 0x05, 0x06, 0x05, 0x14, 0x07, 0x03, 0x08, 0x0B, 0x09, 0x07, 0x09, 0x03, 0x08, 0x0A, 0x07, 
-    0x0A, 0x05, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x03, 0x09, 0x07, 0x03, 0x08, 0x0B, 0x0C, 0x07, 
-    0x0B, 0x03, 0x08, 0x09, 0x06, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x03, 0x09, 0x07, 0x03, 0x08, 
-    0x0B, 0x0C, 0x07, 0x0B, 0x03, 0x08, 0x09, 0x06, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x03, 0x08, 
-    0x05, 0x05, 0x03, 0x03, 0x08, 0x05, 0x05, 0x03, 0x03, 0x07, 0x05, 0x05, 0x06, 0x07, 0x09, 0x09, 
-    0x0A, 0x06, 0x05, 0x03, 0x05, 0x04, 0x0B, 0x06, 0x05, 0x03, 0x03, 0x08, 0x05, 0x05, 0x03, 0x03, 
-    0x08, 0x05, 0x05, 0x03, 0x03, 0x0D, 0x06, 0x05, 0x03, 0x03, 0x43, 0x05, 0x06, 0x07, 0x04, 0x06, 
-    0x05, 0x03, 0x06, 0x06, 0x05, 0x07, 0x09, 0x07, 0x06, 0x05, 0x09, 0x07, 0x05, 0x06, 0x09, 0x07, 
-    0x05, 0x04, 0x05, 0x0A, 0x0A, 0x19, 0x11, 0x08, 0x05, 0x04, 0x05, 0x08, 0x07, 0x03, 0x05, 0x03, 
-    0x03, 0x08, 0x06, 0x1A, 0x17, 0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x05, 0x03, 0x05, 0x03, 0x07, 
-    0x03, 0x1C, 0x0D, 0x0A, 0x0F, 0x06, 0x06, 0x05, 0x03, 0x03, 0x06, 0x05, 0x03, 0x05, 0x07, 0x03, 
-    0x05, 0x08, 0x04, 0x05, 0x07, 0x03, 0x05, 0x03, 0x07, 0x11, 0x03, 0x06, 0x04, 0x09, 0x19, 0x12, 
-    0x09, 0x1A, 0x1D, 0x0A, 0x0F, 0x06, 0x06, 0x05, 0x03, 0x03, 0x06, 0x08, 0x1A, 0x1D, 0x0A, 0x0F, 
-    0x06, 0x06, 0x05, 0x03, 0x03, 0x06, 0x07, 0x18, 0x14, 0x0A, 0x0F, 0x06, 0x06, 0x05, 0x03, 0x03, 
-    0x06, 0x05, 0x03, 0x05, 0x03, 0x08, 0x1A, 0x12, 0x1E, 0x12, 0x08, 0x1A, 0x12, 0x1E, 0x12, 0x08, 
-    0x1A, 0x12, 0x1C, 0x0B, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0B, 
-    0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0B, 
-    0x1C, 0x0B, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0F, 0x1C, 0x0B, 0x1C, 0x0B, 0x1C, 0x0B, 
-    0x1C, 0x0B, 0x12, 0x09, 0x03, 0x0B, 0x03, 0x06, 0x0A, 0x03, 0x0C, 0x05, 0x03, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x06, 0x05, 0x03, 0x05, 0x03, 0x07, 0x05, 0x03, 0x05, 0x03, 0x06, 0x05, 0x03, 
-    0x05, 0x03, 0x0A, 0x05, 0x03, 0x0A, 0x05, 0x03, 0x05, 0x03, 0x0A, 0x05, 0x03, 0x0A, 0x05, 0x03, 
-    0x0A, 0x05, 0x03, 0x0A, 0x05, 0x03, 0x05, 0x03, 0x07, 0x05, 0x03, 0x07, 0x05, 0x03, 0x05, 0x03, 
-    0x06, 0x05, 0x03, 0x06, 0x05, 0x03, 0x05, 0x03, 0x09, 0x05, 0x05, 0x07, 0x06, 0x03, 0x09, 0x05, 
-    0x05, 0x07, 0x06, 0x03, 0x09, 0x05, 0x03, 0x05, 0x05, 0x05, 0x04, 0x05, 0x08, 0x05, 0x05, 0x05, 
-    0x04, 0x04, 0x04, 0x04, 0x03, 0x06, 0x0B, 0x06, 0x04, 0x03, 0x03, 0x04, 0x08, 0x05, 0x03, 0x05, 
-    0x05, 0x05, 0x07, 0x08, 0x06, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 
-    0x08, 0x04, 0x04, 0x07, 0x04, 0x05, 0x03, 0x05, 0x09, 0x08, 0x0B, 0x06, 0x06, 0x06, 0x06, 0x06, 
-    0x03, 0x04, 0x03, 0x06, 0x03, 0x05, 0x05, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x18, 0x05, 
-    0x03, 0x03, 0x03, 0x07, 0x03, 0x03, 0x03, 0x14, 0x05, 0x03, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 
-    0x07, 0x03, 0x03, 0x03, 0x03, 0x25, 0x08, 0x0B, 0x03, 0x09, 0x03, 0x15, 0x06, 0x06, 0x03, 0x81, 
-    0x66, 0x31, 0x20, 0x06, 0x26, 0x0C, 0x03, 0x03, 0x0C, 0x03, 0x03, 0x45, 0x03, 0x03, 0x06, 0x03, 
-    0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 
-    0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 
-    0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 
-    0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 
-    0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x05, 
-    0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x07, 0x03, 0x03, 0x4A, 
-    0x17, 0x2F, 0x03, 0x07, 0x06, 0x03, 0x05, 0x03, 0x06, 0x08, 0x05, 0x0A, 0x06, 0x03, 0x05, 0x03, 
-    0x07, 0x03, 0x03, 0x08, 0x03, 0x06, 0x04, 0x03, 0x03, 0x03, 0x07, 0x03, 0x03, 0x03, 0x15, 0x3C, 
-    0x80, 0xD1, 0x80, 0xA3, 0x12, 0x36, 0x09, 0x2C, 0x0E, 0x0E, 0x0A, 0x1C, 0x0A, 0x03, 0x26, 0x09, 
-    0x05, 0x03, 0x0C, 0x03, 0x0A, 0x80, 0x82, 0x03, 0x03, 0x07, 0x03, 0x03, 0x05, 0x14, 0x03, 0x03, 
-    0x07, 0x03, 0x03, 0x05, 0x1F, 0x3F, 0x0A, 0x27, 0x08, 0x11, 0x09, 0x80, 0xA5, 0x25, 0x34, 0x22, 
-    0x14, 0x29, 0x25, 0x32, 0x1B, 0x1F, 0x0B, 0x07, 0x11, 0x03, 0x08, 0x19, 0x42, 0x0D, 0x1B, 0x80, 
-    0x91, 0x32, 0x07, 0x03, 0x03, 0x2D, 0x05, 0x08, 0x05, 0x07, 0x07, 0x05, 0x2C, 0x05, 0x05, 0x2A, 
-    0x05, 0x05, 0x2A, 0x05, 0x05, 0x05, 0x21, 0x80, 0xA3, 0x38, 0x05, 0x3A, 0x0A, 0x05, 0x12, 0x1A, 
-    0x05, 0x2C, 0x05, 0x16, 0x0B, 0x05, 0x07, 0x80, 0xC9, 0x0D, 0x05, 0x23, 0x06, 0x05, 0x03, 0x03, 
-    0x03, 0x05, 0x05, 0x05, 0x06, 0x05, 0x21, 0x22, 0x26, 0x04, 0x04, 0x04, 0x04, 0x05, 0x08, 0x03, 
-    0x03, 0x1A, 0x05, 0x04, 0x12, 0x06, 0x03, 0x03, 0x05, 0x04, 0x0E, 0x0D, 0x39, 0x31, 0x03, 0x03, 
-    0x03, 0x04, 0x20, 0x04, 0x16, 0x04, 0x15, 0x04, 0x38, 0x06, 0x09, 0x09, 0x1C, 0x09, 0x44, 0x80, 
-    0x9C, 0x04, 0x0A, 0x04, 0x05, 0x04, 0x00, 0x00, 0x95, 0x3E, 0x19, 0x40, 0x0B, 0x80, 0xF4, 0x10, 
-    0x0B, 0x1A, 0x1F, 0x3E, 0x08, 0x07, 0x42, 0x04, 0x07, 0x14, 0x21, 0x09, 0x0D, 0x0D, 0x46, 0x81, 
-    0x69, 0x49, 0x09, 0x74, 0x2A, 0x4F, 0x0F, 0x05, 0x14, 0x05, 0x09, 0x46, 0x05, 0x07, 0x05, 0x1A, 
-    0x06, 0x1B, 0x34, 0x69, 0x09, 0x4F, 0x06, 0x81, 0xBF, 0x6F, 0x7A, 0x62, 0x58, 0x81, 0x94, 0x0D, 
-    0x43, 0x40, 0x75, 0x46, 0x24, 0x68, 0x19, 0x75, 0x09, 0x0D, 0x19, 0x13, 0x2A, 0x1F, 0x1F, 0x26, 
-    0x11, 0x15, 0x4D, 0x09, 0x0D, 0x14, 0x2D, 0x13, 0x2A, 0x18, 0x2F, 0x1E, 0x26, 0x11, 0x15, 0x3E, 
-    0x11, 0x15, 0x4E, 0x11, 0x15, 0x80, 0x82, 0x09, 0x09, 0x08, 0x0D, 0x0B, 0x0E, 0x0C, 0x07, 0x0E, 
-    0x0C, 0x0E, 0x0D, 0x07, 0x0E, 0x11, 0x0E, 0x13, 0x09, 0x0E, 0x15, 0x07, 0x0E, 0x13, 0x07, 0x07, 
-    0x23, 0x3A, 0x10, 0x44, 0x0F, 0x25, 0x80, 0xC0, 0x10, 0x75, 0x0C, 0x6D, 0x0C, 0x80, 0x8E, 0x07, 
-    0x09, 0x09, 0x25, 0x4E, 0x1E, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x34, 0x1B, 0x1B, 
-    0x1F, 0x19, 0x1B, 0x1E, 0x33, 0x63, 0x29, 0x71, 0x1D, 0x12, 0x35, 0x39, 0x3C, 0x39, 0x3A, 0x2F, 
-    0x4C, 0x30, 0x34, 0x30, 0x34, 0x2E, 0x27, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x2B, 0x2B, 0x2B, 
-    0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x1D, 0x05, 0x0C, 
-    0x21, 0x81, 0x43, 0x10, 0x13, 0x10, 0x13, 0x57, 0x0A, 0x65, 0x80, 0x8E, 0x1C, 0x38, 0x80, 0xC3, 
-    0x04, 0x1C, 0x6F, 0x55, 0x08, 0x21, 0x36, 0x0C, 0x25, 0x0C, 0x45, 0x82, 0x07, 0x08, 0x07, 0x0E, 
-    0x07, 0x0B, 0x0A, 0x08, 0x1E, 0x80, 0xB3, 0x28, 0x0A, 0x07, 0x09, 0x0A, 0x0A, 0x0C, 0x0A, 0x0C, 
-    0x0A, 0x0C, 0x0A, 0x0C, 0x17, 0x07, 0x17, 0x07, 0x0F, 0x0A, 0x0A, 0x06, 0x0A, 0x11, 0x07, 0x15, 
-    0x4C, 0x05, 0x08, 0x21, 0x24, 0x0F, 0x11, 0x0F, 0x10, 0x0D, 0x1E, 0x20, 0x20, 0x09, 0x1A, 0x27, 
-    0x25, 0x77, 0x2C, 0x3A, 0x2C, 0x80, 0x93, 0x5B, 0x13, 0x12, 0x34, 0x22, 0x14, 0x29, 0x25, 0x32, 
-    0x45, 0x77, 0x3C, 0x27, 0x0D, 0x0A, 0x1C, 0x08, 0x2E, 0x35, 0x1C, 0x52, 0x34, 0x33, 0x47, 0x0D, 
-    0x3E, 0x7E, 0x11, 0x49, 0x31, 0x32, 0x04, 0x44, 0x55, 0x3A, 0x04, 0x80, 0xF9, 0x3C, 0x2A, 0x0D, 
-    0x1E, 0x80, 0x86, 0x04, 0x15, 0x19, 0x3F, 0x2E, 0x6E, 0x2C, 0x1C, 0x07, 0x43, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0xB2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x00, 0x0D, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x03, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x7C, 0x00, 0x60, 0x02, 0x52, 0x4C, 
-    0x10, 0x14, 0x48, 0x80, 0x20, 0x6D, 0xFB, 0xE0, 0x72, 0x08, 0xC2, 0x30, 0x00, 0x00, 0x66, 0xEE, 
-    0x10, 0x14, 0x04, 0x00, 0x00, 0x2B, 0x67, 0x08, 0x55, 0x00, 0x66, 0x20, 0x20, 0x06, 0x52, 0x86, 
-    0x52, 0x4C, 0x60, 0x18, 0x22, 0x07, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0x10, 0x1C, 
-    0x48, 0x80, 0x48, 0xC0, 0xD0, 0x81, 0x72, 0x30, 0x90, 0x81, 0x2E, 0x00, 0x70, 0x30, 0xB0, 0x14, 
-    0x6E, 0x06, 0x70, 0x39, 0xB0, 0x14, 0x6C, 0xDC, 0x4A, 0x86, 0x67, 0x06, 0x20, 0x07, 0x44, 0x80, 
-    0x60, 0x02, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x61, 
-    0x74, 0x6F, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x13, 0x08, 0x2C, 0x2E, 
-    0x00, 0x08, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x07, 0x70, 0x30, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0xCC, 0xD9, 0xC7, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1E, 0x70, 0x0F, 
-    0xC0, 0x86, 0x19, 0x00, 0x70, 0x09, 0xB0, 0x14, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x37, 
-    0x60, 0x02, 0x70, 0x30, 0xD1, 0x14, 0x20, 0x07, 0x53, 0x87, 0xE8, 0x8E, 0x4A, 0x86, 0x63, 0x04, 
-    0x4A, 0x87, 0x6E, 0xDA, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x62, 
-    0x69, 0x6E, 0x68, 0x65, 0x78, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 
-    0x2C, 0x2E, 0x00, 0x08, 0x20, 0x06, 0x22, 0x2E, 0x00, 0x0C, 0x4E, 0xAD, 0x01, 0x22, 0x2C, 0x00, 
-    0x2F, 0x06, 0x4E, 0xBA, 0x01, 0x86, 0x2D, 0x40, 0xFF, 0xFC, 0x58, 0x4F, 0x67, 0x28, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x06, 0xE4, 0x88, 0x2E, 0x00, 0x60, 0x04, 0x70, 0x00, 0x28, 0xC0, 0x53, 0x87, 
-    0x6C, 0xF8, 0x26, 0x4C, 0x20, 0x06, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03, 0x2E, 0x00, 0x60, 0x02, 
-    0x42, 0x1B, 0x53, 0x87, 0x6C, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x63, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x61, 0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x7A, 
-    0xB0, 0x87, 0x6D, 0x06, 0x06, 0x87, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x74, 0x6F, 0x75, 0x70, 0x70, 0x65, 0x72, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x1A, 0x28, 0x6E, 0x00, 0x08, 0x1D, 0x6E, 
-    0x00, 0x25, 0xFF, 0xFC, 0x3D, 0x6E, 0x00, 0x18, 0xFF, 0xFE, 0x2F, 0x0C, 0x41, 0xEE, 0x00, 0x16, 
-    0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xAD, 0x04, 0x1A, 0x10, 0x2C, 
-    0x00, 0x05, 0x04, 0x00, 0x00, 0x30, 0x4F, 0xEF, 0x00, 0x12, 0x67, 0x36, 0x04, 0x00, 0x00, 0x0F, 
-    0x67, 0x0C, 0x04, 0x00, 0x00, 0x0A, 0x67, 0x3E, 0x5B, 0x00, 0x67, 0x3A, 0x60, 0x28, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x1E, 0x2F, 0x0B, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0x00, 0x16, 
-    0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x94, 0x4F, 0xEF, 0x00, 0x1E, 
-    0x60, 0x30, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x32, 0x2C, 0x00, 0x02, 
-    0x48, 0xC1, 0xD2, 0x80, 0x26, 0x81, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x20, 0x6E, 0x00, 0x1E, 
-    0x20, 0x80, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x42, 0x34, 0x00, 0x05, 0x20, 0x4C, 0x5A, 0x88, 
-    0x20, 0x08, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x5F, 0x63, 0x76, 
-    0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x49, 0xEE, 0xFF, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0xF6, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x08, 
-    0x2E, 0x00, 0x70, 0x08, 0x2F, 0x00, 0x22, 0x0C, 0xD2, 0x87, 0x2F, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0xFE, 0x24, 0x42, 0x34, 0x70, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x01, 0x5A, 0x2F, 0x0C, 
-    0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x4C, 0xEE, 0x10, 0x80, 0xFE, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x62, 0x61, 0x64, 0x50, 0x74, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x07, 0x18, 0x47, 0xED, 0xFB, 0xE4, 0x2A, 0x2E, 0x00, 0x08, 0x7E, 0x00, 0x0C, 0x85, 0x00, 0x80, 
-    0x00, 0x00, 0x63, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xAE, 0x70, 0x08, 0xB0, 0x85, 0x63, 0x02, 
-    0x7A, 0x08, 0x20, 0x05, 0x56, 0x80, 0x72, 0xFC, 0xC2, 0x80, 0x2A, 0x01, 0x20, 0x05, 0x53, 0x80, 
-    0x2C, 0x00, 0xE4, 0x86, 0x60, 0x02, 0x52, 0x87, 0xE2, 0x8E, 0x4A, 0x86, 0x66, 0xF8, 0x70, 0x08, 
-    0xB0, 0x87, 0x6D, 0x0A, 0x20, 0x07, 0xE5, 0x40, 0x4A, 0xB3, 0x00, 0x00, 0x66, 0x14, 0x2F, 0x05, 
-    0x2F, 0x07, 0x4E, 0xBA, 0x00, 0xBE, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x66, 0x26, 0x70, 0x00, 
-    0x60, 0x64, 0x20, 0x07, 0xE5, 0x40, 0x28, 0x73, 0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 0x20, 0x73, 
-    0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 0x27, 0x90, 0x00, 0x00, 0x18, 0xAC, 0x00, 0x04, 0x19, 0x6C, 
-    0x00, 0x05, 0x00, 0x01, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 
-    0x10, 0x14, 0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 
-    0x00, 0x08, 0x63, 0x1C, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x40, 0x00, 0xFF, 0x67, 0x10, 
-    0x2F, 0x0C, 0x48, 0x7A, 0x00, 0x26, 0x4E, 0xBA, 0xFE, 0xEC, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x06, 
-    0x20, 0x4C, 0x58, 0x88, 0x20, 0x08, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x86, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x38, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 
-    0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 
-    0x2D, 0x2D, 0x20, 0x43, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 
-    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x46, 0x72, 0x65, 0x65, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x40, 
-    0x20, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x47, 0xED, 0xFB, 0xE4, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x08, 0x70, 0x08, 0xB0, 0x86, 0x6C, 0x28, 0x41, 0xF8, 0x00, 0x04, 
-    0x22, 0x05, 0xD2, 0x88, 0x20, 0x01, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x00, 0xEA, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x7C, 0x00, 0xFF, 0x00, 0x01, 0x20, 0x0C, 
-    0x60, 0x00, 0x00, 0xDA, 0x20, 0x06, 0xE5, 0x40, 0x4A, 0xB3, 0x00, 0x00, 0x67, 0x10, 0x48, 0x7A, 
-    0x00, 0xE2, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x70, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x70, 0x08, 
-    0xB0, 0x86, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x08, 0x60, 0x02, 0x20, 0x06, 0x28, 0x00, 
-    0x56, 0x84, 0x20, 0x06, 0x56, 0x80, 0x12, 0x04, 0x92, 0x00, 0x7E, 0x01, 0xE3, 0xAF, 0xBC, 0x84, 
-    0x6F, 0x02, 0x28, 0x06, 0x70, 0x01, 0xE9, 0xA8, 0x41, 0xF8, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x20, 0x07, 0x22, 0x08, 0x4E, 0xAD, 0x01, 0x22, 0x22, 0x2E, 0xFF, 0xFC, 0x2A, 0x00, 0xDA, 0x81, 
-    0x20, 0x05, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x14, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x68, 0x28, 0x06, 0x56, 0x84, 0x7E, 0x01, 0x4A, 0x87, 0x6E, 0xC6, 0x4A, 0x87, 
-    0x66, 0x04, 0x70, 0x00, 0x60, 0x56, 0x20, 0x06, 0xE5, 0x40, 0x27, 0x8C, 0x00, 0x00, 0x10, 0x06, 
-    0x56, 0x00, 0x72, 0x01, 0xE1, 0xA9, 0x41, 0xF8, 0x00, 0x04, 0x2A, 0x01, 0xDA, 0x88, 0x60, 0x12, 
-    0x20, 0x0C, 0xD0, 0x85, 0x28, 0x80, 0x28, 0x40, 0x19, 0x7C, 0x00, 0x55, 0x00, 0x04, 0x19, 0x46, 
-    0x00, 0x05, 0x53, 0x87, 0x6E, 0xEA, 0x70, 0x00, 0x28, 0x80, 0x22, 0x06, 0xE5, 0x41, 0x28, 0x73, 
-    0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x20, 0x73, 0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x27, 0x90, 
-    0x10, 0x00, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x46, 0x00, 0x01, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xF8, 
-    0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x4D, 0x65, 0x6D, 
-    0x00, 0x2E, 0x2B, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 
-    0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x72, 0x65, 0x65, 
-    0x4C, 0x69, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x0B, 0x08, 0x00, 
-    0x00, 0x00, 0x67, 0x10, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0xE0, 0x4E, 0xBA, 0xFD, 0x18, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0x90, 0x20, 0x0B, 0x67, 0x00, 0x00, 0x8A, 0x41, 0xF8, 0x00, 0x04, 0x28, 0x4B, 
-    0x99, 0xC8, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 
-    0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x08, 
-    0x63, 0x1A, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x40, 0x00, 0xFF, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x48, 0x7A, 0x00, 0x62, 0x4E, 0xBA, 0xFC, 0xCE, 0x50, 0x4F, 0x60, 0x46, 0x7E, 0x00, 0x1E, 0x2C, 
-    0x00, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x66, 0x14, 0x18, 0xBC, 0x00, 0x51, 0x19, 0x7C, 
-    0x00, 0x09, 0x00, 0x01, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xEA, 0x58, 0x4F, 0x60, 0x24, 0x19, 0x54, 
-    0x00, 0x04, 0x19, 0x6C, 0x00, 0x01, 0x00, 0x05, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xFB, 0xE4, 
-    0x26, 0x70, 0x00, 0x00, 0x28, 0x8B, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xFB, 0xE4, 0x21, 0x8C, 
-    0x00, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x66, 0x72, 0x65, 
-    0x65, 0x00, 0x00, 0x56, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x66, 
-    0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 
-    0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x62, 0x6C, 
-    0x6F, 0x63, 0x6B, 0x20, 0x40, 0x20, 0x00, 0x00, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 
-    0x74, 0x6F, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x70, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x40, 0x20, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 
-    0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 
-    0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 
-    0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 
-    0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 
-    0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x4C, 0xEF, 0x00, 0x03, 0x00, 0x08, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x13, 
-    0x6D, 0x3A, 0x74, 0x00, 0x14, 0x00, 0xE1, 0x48, 0x84, 0x40, 0x20, 0x02, 0x48, 0x42, 0x80, 0x82, 
-    0x24, 0x08, 0xE2, 0x0A, 0x64, 0x04, 0x10, 0xC0, 0x53, 0x81, 0xE2, 0x0A, 0x64, 0x04, 0x30, 0xC0, 
-    0x55, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 
-    0x53, 0x82, 0x64, 0xF4, 0x02, 0x41, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xC0, 0x51, 0xC9, 0xFF, 0xFC, 
-    0x20, 0x2F, 0x00, 0x04, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x20, 0x08, 0x4A, 0x18, 0x66, 0xFC, 0x22, 0x6F, 0x00, 0x08, 0x53, 0x88, 
-    0x10, 0xD9, 0x66, 0xFC, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x61, 0x74, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x12, 0x2F, 0x00, 0x0B, 0xB2, 0x10, 0x67, 0x08, 0x4A, 0x18, 0x66, 0xF8, 
-    0x70, 0x00, 0x4E, 0x75, 0x20, 0x08, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x68, 0x72, 0x00, 
-    0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x70, 0x00, 0xB3, 0xC8, 0x67, 0x0A, 0x10, 0x18, 
-    0xB0, 0x19, 0x66, 0x08, 0x4A, 0x00, 0x66, 0xF6, 0x70, 0x00, 0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 
-    0x90, 0x81, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4C, 0xEF, 
-    0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x10, 0xD9, 0x66, 0xFC, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 
-    0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x20, 0x6F, 0x00, 0x04, 0x22, 0x48, 0x4A, 0x18, 0x66, 0xFC, 
-    0x91, 0xC9, 0x20, 0x08, 0x53, 0x80, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x6C, 0x65, 0x6E, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0xA0, 0x1F, 0x30, 0x38, 0x02, 0x20, 
-    0x48, 0xC0, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x53, 0x41, 0x5F, 0x44, 0x65, 0x6C, 0x65, 0x74, 
-    0x65, 0x50, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x18, 0xD0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 
-    0x00, 0x0C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x10, 0x2F, 0x0C, 
-    0x70, 0x00, 0x10, 0x07, 0x2F, 0x00, 0x4E, 0xBA, 0x12, 0xD2, 0x4A, 0x80, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x70, 0x75, 0x74, 0x63, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x14, 0x4A, 0x85, 0x63, 0x50, 0x4A, 0x84, 0x63, 0x4C, 0x76, 0x01, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0xA4, 0x4A, 0x80, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x2E, 0x20, 0x04, 
-    0x22, 0x05, 0x4E, 0xAD, 0x01, 0x22, 0x2C, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 
-    0xC2, 0x40, 0x67, 0x00, 0x00, 0x86, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 
-    0x67, 0x30, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 
-    0x4E, 0xAD, 0x03, 0xFA, 0x2E, 0x00, 0xBC, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x3C, 0x4A, 0xAD, 
-    0xFD, 0xCA, 0x66, 0x06, 0x4A, 0x6D, 0xFD, 0xC8, 0x67, 0x30, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 
-    0x60, 0x28, 0x7E, 0x00, 0x60, 0x20, 0x2F, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0x11, 0xE0, 0x72, 0xFF, 0xB2, 0x80, 
-    0x50, 0x4F, 0x67, 0x06, 0x52, 0x87, 0xBC, 0x87, 0x62, 0xDC, 0x4A, 0x87, 0x6C, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x00, 0xA8, 0xBC, 0x87, 0x66, 0x06, 0x20, 0x04, 0x60, 0x00, 0x00, 0x9E, 0x20, 0x07, 
-    0x22, 0x05, 0x4E, 0xAD, 0x01, 0x32, 0x60, 0x00, 0x00, 0x92, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 
-    0x60, 0x22, 0x2F, 0x0C, 0x4E, 0xBA, 0x13, 0x16, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x14, 
-    0x20, 0x06, 0xD0, 0x85, 0x53, 0x80, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x32, 0x22, 0x04, 0x92, 0x80, 
-    0x20, 0x01, 0x60, 0x66, 0x26, 0x6C, 0x00, 0x04, 0x2E, 0x2E, 0xFF, 0xFC, 0x9E, 0x8B, 0x4A, 0x87, 
-    0x6F, 0xD0, 0xBE, 0x86, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x07, 
-    0x2E, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xAD, 0x02, 0xDA, 0x9F, 0x94, 
-    0xDF, 0xAC, 0x00, 0x04, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 
-    0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0x2C, 0x58, 0x4F, 0x9C, 0x87, 0x4A, 0x86, 0x66, 0x04, 
-    0x20, 0x04, 0x60, 0x06, 0xDF, 0xAE, 0x00, 0x08, 0x60, 0x9A, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x41, 0xEE, 0x00, 0x08, 0x28, 0x48, 0x58, 0x4C, 0x48, 0x6D, 
-    0xFC, 0x22, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0x01, 0x1E, 0x2E, 0x00, 0x70, 0x00, 
-    0x30, 0x2D, 0xFC, 0x34, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x70, 
-    0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x41, 0xEE, 0x00, 0x0C, 0x26, 0x48, 0x58, 0x4B, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x00, 0xD2, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x66, 0x70, 0x72, 0x69, 0x6E, 
-    0x74, 0x66, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEA, 0x48, 0xE7, 0x01, 0x08, 0x2D, 0x7C, 0x7F, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xEA, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xEE, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xF2, 
-    0x3D, 0x7C, 0x00, 0x02, 0xFF, 0xFC, 0x3D, 0x7C, 0x00, 0x14, 0xFF, 0xFE, 0x41, 0xEE, 0x00, 0x0C, 
-    0x28, 0x48, 0x58, 0x4C, 0x48, 0x6E, 0xFF, 0xEA, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 
-    0x00, 0x68, 0x2E, 0x00, 0x20, 0x6E, 0xFF, 0xEE, 0x42, 0x10, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xE2, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x61, 0xB0, 0x87, 
-    0x5F, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x07, 0x72, 0x57, 0x90, 0x81, 0x60, 0x18, 0x70, 0x41, 
-    0xB0, 0x87, 0x5F, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x07, 0x72, 0x37, 0x90, 0x81, 0x60, 0x06, 
-    0x20, 0x07, 0x72, 0x30, 0x90, 0x81, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x85, 0x74, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x3A, 0x48, 0xE7, 0x1F, 0x18, 
-    0x28, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x3E, 0x26, 0x6E, 0x00, 0x08, 0x60, 0x08, 
-    0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x67, 0x06, 0x70, 0x25, 0xB0, 0x86, 0x66, 0xE4, 0x2E, 0x2E, 0x00, 0x08, 
-    0x9E, 0x8B, 0x4A, 0x87, 0x67, 0x6E, 0xDF, 0xAE, 0xFF, 0x3E, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x2E, 
-    0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 0x10, 0x13, 0x4A, 0x80, 0x60, 0x48, 0x2F, 0x0C, 0x70, 0x00, 
-    0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 0x0F, 0x64, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x36, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 0xB2, 0x80, 0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 0x2F, 0x2C, 
-    0x00, 0x04, 0x4E, 0xAD, 0x02, 0xDA, 0xD0, 0x87, 0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x12, 0x2F, 0x0C, 0x2F, 0x07, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xFC, 0x72, 
-    0x4F, 0xEF, 0x00, 0x10, 0x4A, 0x86, 0x66, 0x1A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 
-    0xC2, 0x40, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x0A, 0xCA, 0x20, 0x2E, 0xFF, 0x3E, 0x60, 0x00, 
-    0x0A, 0xC2, 0x42, 0xAE, 0xFF, 0x58, 0x42, 0xAE, 0xFF, 0x54, 0x42, 0x6E, 0xFF, 0x52, 0x52, 0xAE, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x20, 0x67, 0x26, 0x57, 0x80, 0x67, 0x2C, 0x51, 0x80, 0x67, 0x0A, 0x55, 0x80, 
-    0x67, 0x10, 0x57, 0x80, 0x67, 0x2A, 0x60, 0x32, 0x30, 0x2E, 0xFF, 0x52, 0x52, 0x6E, 0xFF, 0x52, 
-    0x60, 0xCC, 0x30, 0x2E, 0xFF, 0x54, 0x52, 0x6E, 0xFF, 0x54, 0x60, 0xC2, 0x30, 0x2E, 0xFF, 0x56, 
-    0x52, 0x6E, 0xFF, 0x56, 0x60, 0xB8, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 0x60, 0xAE, 
-    0x30, 0x2E, 0xFF, 0x5A, 0x52, 0x6E, 0xFF, 0x5A, 0x60, 0xA4, 0x70, 0x2A, 0xB0, 0x86, 0x66, 0x2C, 
-    0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x46, 0x6C, 0x12, 
-    0x20, 0x2E, 0xFF, 0x46, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x46, 0x30, 0x2E, 0xFF, 0x54, 0x52, 0x6E, 
-    0xFF, 0x54, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x3E, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x46, 0x60, 0x1E, 0x22, 0x2E, 0xFF, 0x46, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 
-    0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 0x2D, 0x41, 0xFF, 0x46, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x30, 
-    0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 0xB0, 0x86, 0x6C, 0xCA, 0x20, 0x6E, 0x00, 0x08, 0x70, 0x2E, 
-    0xB0, 0x10, 0x67, 0x04, 0x7A, 0xFF, 0x60, 0x5A, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x70, 0x2A, 0xB0, 0x10, 0x66, 0x16, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2A, 0x28, 
-    0xFF, 0xFC, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x36, 0x7A, 0x00, 0x60, 0x1A, 
-    0x22, 0x05, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 
-    0x2A, 0x01, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x30, 0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 0xB0, 0x86, 
-    0x6C, 0xCE, 0x42, 0x6E, 0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x04, 0x00, 0x00, 0x4C, 
-    0x67, 0x1A, 0x04, 0x00, 0x00, 0x1C, 0x67, 0x06, 0x59, 0x00, 0x67, 0x08, 0x60, 0x16, 0x3D, 0x7C, 
-    0xFF, 0xFE, 0xFF, 0x5C, 0x30, 0x2E, 0xFF, 0x5C, 0x52, 0x6E, 0xFF, 0x5C, 0x20, 0x2E, 0x00, 0x08, 
-    0x52, 0xAE, 0x00, 0x08, 0x41, 0xFA, 0x09, 0xA0, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 0xFF, 0xE4, 
-    0x42, 0x10, 0x2D, 0x48, 0xFF, 0x66, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x2D, 0x40, 0xFF, 0x4A, 
-    0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x12, 0x10, 0x48, 0x81, 0x48, 0xC1, 0x2C, 0x01, 
-    0x67, 0x00, 0x06, 0xC2, 0x04, 0x81, 0x00, 0x00, 0x00, 0x45, 0x67, 0x00, 0x01, 0xF2, 0x55, 0x81, 
-    0x67, 0x00, 0x05, 0x30, 0x04, 0x81, 0x00, 0x00, 0x00, 0x09, 0x67, 0x00, 0x06, 0x32, 0x51, 0x81, 
-    0x67, 0x5C, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0B, 0x67, 0x00, 0x05, 0xCA, 0x53, 0x81, 0x67, 0x36, 
-    0x53, 0x81, 0x67, 0x00, 0x01, 0xCA, 0x53, 0x81, 0x67, 0x00, 0x03, 0xBE, 0x53, 0x81, 0x67, 0x00, 
-    0x05, 0x02, 0x55, 0x81, 0x67, 0x20, 0x5B, 0x81, 0x67, 0x00, 0x06, 0x3E, 0x53, 0x81, 0x67, 0x1E, 
-    0x53, 0x81, 0x67, 0x22, 0x57, 0x81, 0x67, 0x00, 0x05, 0xBA, 0x55, 0x81, 0x67, 0x08, 0x57, 0x81, 
-    0x67, 0x1C, 0x60, 0x00, 0x05, 0x8A, 0x70, 0x0A, 0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x16, 0x70, 0x08, 
-    0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 0x70, 0x10, 
-    0x2D, 0x40, 0xFF, 0x5E, 0x4A, 0x85, 0x6D, 0x04, 0x42, 0x6E, 0xFF, 0x5A, 0x4A, 0x6E, 0xFF, 0x5C, 
-    0x6F, 0x10, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x6A, 
-    0x60, 0x36, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x6A, 
-    0x4A, 0x6E, 0xFF, 0x5C, 0x6C, 0x22, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 0x70, 0x69, 0xB0, 0x86, 
-    0x66, 0x0C, 0x30, 0x2E, 0xFF, 0x6C, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x0A, 0x70, 0x00, 
-    0x30, 0x2E, 0xFF, 0x6C, 0x2D, 0x40, 0xFF, 0x6A, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 0x70, 0x69, 
-    0xB0, 0x86, 0x66, 0x38, 0x4A, 0xAE, 0xFF, 0x6A, 0x6C, 0x14, 0x41, 0xFA, 0x08, 0x4E, 0x2D, 0x48, 
-    0xFF, 0x62, 0x20, 0x2E, 0xFF, 0x6A, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x1E, 0x4A, 0x6E, 
-    0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x08, 0x32, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 
-    0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x08, 0x20, 0x2D, 0x48, 0xFF, 0x62, 0x76, 0x01, 0x70, 0x58, 
-    0xB0, 0x86, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x86, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x08, 
-    0x41, 0xFA, 0x08, 0x32, 0x20, 0x08, 0x60, 0x06, 0x41, 0xFA, 0x08, 0x18, 0x20, 0x08, 0x2D, 0x40, 
-    0xFF, 0x84, 0x41, 0xEE, 0xFF, 0x8C, 0x26, 0x48, 0x47, 0xEB, 0x00, 0x0B, 0x2D, 0x4B, 0xFF, 0x42, 
-    0x60, 0x24, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 0x4E, 0xAD, 0x01, 0x42, 0x20, 0x6E, 
-    0xFF, 0x84, 0x17, 0x30, 0x08, 0x00, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 0x4E, 0xAD, 
-    0x01, 0x32, 0x2D, 0x40, 0xFF, 0x6A, 0x4A, 0xAE, 0xFF, 0x6A, 0x66, 0xD6, 0x20, 0x2E, 0xFF, 0x42, 
-    0x90, 0x8B, 0x2D, 0x40, 0xFF, 0x6E, 0x4A, 0x6E, 0xFF, 0x58, 0x67, 0x56, 0x70, 0x6F, 0xB0, 0x86, 
-    0x66, 0x22, 0x4A, 0x85, 0x6D, 0x12, 0x20, 0x2E, 0xFF, 0x6E, 0x52, 0x80, 0xB0, 0x85, 0x6F, 0x42, 
-    0x2A, 0x2E, 0xFF, 0x6E, 0x52, 0x85, 0x60, 0x3A, 0x20, 0x2E, 0xFF, 0x6E, 0x44, 0x80, 0x2A, 0x00, 
-    0x53, 0x85, 0x60, 0x2E, 0x4A, 0xAE, 0xFF, 0x6E, 0x67, 0x28, 0x20, 0x06, 0x04, 0x80, 0x00, 0x00, 
-    0x00, 0x58, 0x67, 0x16, 0x04, 0x80, 0x00, 0x00, 0x00, 0x18, 0x67, 0x04, 0x51, 0x80, 0x66, 0x12, 
-    0x41, 0xFA, 0x07, 0x7C, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x08, 0x41, 0xFA, 0x07, 0x6E, 0x2D, 0x48, 
-    0xFF, 0x62, 0x4A, 0x85, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x05, 0x44, 0x80, 0x60, 0x02, 
-    0x20, 0x05, 0x90, 0xAE, 0xFF, 0x6E, 0x2D, 0x40, 0xFF, 0x4A, 0x60, 0x00, 0x04, 0xCE, 0x4A, 0x85, 
-    0x6C, 0x02, 0x7A, 0x06, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x41, 0xE8, 0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x22, 0x05, 0x52, 0x81, 0x74, 0x13, 
-    0xB4, 0x81, 0x5E, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x22, 0x05, 0x52, 0x81, 0x60, 0x02, 0x72, 0x13, 
-    0x2F, 0x01, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x4E, 0xAD, 0x02, 0xC2, 0x26, 0x40, 0x4F, 0xEF, 0x00, 0x1E, 0x4A, 0xAE, 0xFF, 0x80, 0x67, 0x0A, 
-    0x41, 0xFA, 0x06, 0xD8, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x1E, 0x4A, 0x6E, 0xFF, 0x52, 0x67, 0x0A, 
-    0x41, 0xFA, 0x06, 0xC6, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 0xFF, 0x56, 0x67, 0x08, 
-    0x41, 0xFA, 0x06, 0xB4, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 0xFF, 0x8C, 0x2D, 0x48, 0xFF, 0x42, 
-    0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 0x00, 0xD6, 0x70, 0x4E, 0xB0, 0x13, 0x67, 0x00, 0x00, 0xCE, 
-    0x4A, 0x13, 0x56, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x10, 0x1B, 0x60, 0x02, 0x70, 0x30, 0x22, 0x2E, 
-    0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x4A, 0x85, 0x66, 0x06, 0x4A, 0x6E, 
-    0xFF, 0x58, 0x67, 0x0E, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 0x10, 0xBC, 
-    0x00, 0x2E, 0x2D, 0x45, 0xFF, 0x4E, 0x60, 0x10, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 
-    0x20, 0x40, 0x10, 0x9B, 0x53, 0xAE, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4E, 0x6F, 0x04, 0x4A, 0x13, 
-    0x66, 0xE6, 0x2E, 0x2E, 0xFF, 0x7C, 0x53, 0x87, 0x4A, 0x87, 0x6C, 0x06, 0x20, 0x07, 0x44, 0x80, 
-    0x2E, 0x00, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x3A, 0x72, 0x30, 0xD0, 0x01, 0x53, 0xAE, 
-    0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x2A, 
-    0x2E, 0x00, 0x66, 0xDE, 0x41, 0xEE, 0xFF, 0xE4, 0x55, 0x48, 0xB1, 0xEE, 0xFF, 0x66, 0x65, 0xD2, 
-    0x4A, 0xAE, 0xFF, 0x7C, 0x5E, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x2B, 0x60, 0x02, 0x70, 0x2D, 
-    0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x70, 0x5A, 0xB0, 0x86, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x04, 0x70, 0x45, 0x60, 0x02, 0x70, 0x65, 0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 
-    0xFF, 0x66, 0x10, 0x80, 0x47, 0xEE, 0xFF, 0x8C, 0x60, 0x00, 0x03, 0x60, 0x42, 0x6E, 0xFF, 0x5A, 
-    0x70, 0x49, 0xB0, 0x13, 0x66, 0x10, 0x48, 0x7A, 0x05, 0xCE, 0x2F, 0x2E, 0xFF, 0x42, 0x4E, 0xAD, 
-    0x03, 0x02, 0x50, 0x4F, 0x60, 0x5C, 0x48, 0x7A, 0x05, 0xB4, 0x2F, 0x2E, 0xFF, 0x42, 0x4E, 0xAD, 
-    0x03, 0x02, 0x10, 0x2B, 0x00, 0x03, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0xF9, 0xB2, 
-    0xE9, 0x80, 0x2E, 0x00, 0x10, 0x2B, 0x00, 0x04, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xF9, 0xA0, 0xDE, 0x80, 0x78, 0x06, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 
-    0x01, 0x3A, 0x72, 0x30, 0xD0, 0x01, 0x22, 0x04, 0x53, 0x84, 0xD2, 0xAE, 0xFF, 0x42, 0x20, 0x41, 
-    0x10, 0x80, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x2A, 0x2E, 0x00, 0x70, 0x04, 0xB0, 0x84, 
-    0x6F, 0xD8, 0x26, 0x6E, 0xFF, 0x42, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x0A, 0xD0, 0x8B, 0x2D, 0x40, 
-    0xFF, 0x42, 0x58, 0x4F, 0x60, 0x00, 0x02, 0xD4, 0x4A, 0x85, 0x6C, 0x02, 0x7A, 0x06, 0x06, 0xAE, 
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 0x43, 0xEE, 
-    0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x80, 
-    0x48, 0x6E, 0xFF, 0x7C, 0x2F, 0x05, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 
-    0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x02, 0xC2, 0x26, 0x40, 0x4F, 0xEF, 0x00, 0x1E, 0x4A, 0xAE, 
-    0xFF, 0x80, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xF4, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x1E, 0x4A, 0x6E, 
-    0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xE2, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 
-    0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x04, 0xD0, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 0xFF, 0x8C, 
-    0x2D, 0x48, 0xFF, 0x42, 0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 0xFE, 0xF2, 0x70, 0x4E, 0xB0, 0x13, 
-    0x67, 0x00, 0xFE, 0xEA, 0x20, 0x6E, 0xFF, 0x62, 0x4A, 0x10, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x48, 0x80, 0x48, 0xC0, 0x22, 0x2E, 0xFF, 0x7C, 0xD2, 0x80, 
-    0x76, 0x01, 0x4A, 0x85, 0x6E, 0x08, 0x4A, 0x6E, 0xFF, 0x58, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x06, 0x20, 0x05, 0x52, 0x80, 0x60, 0x02, 0x70, 0x00, 0xD0, 0x81, 0x72, 0x50, 0xB2, 0x80, 
-    0x6C, 0x06, 0x7A, 0x12, 0x60, 0x00, 0xFD, 0x58, 0x2E, 0x2E, 0xFF, 0x7C, 0x76, 0x01, 0x4A, 0x87, 
-    0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 0x60, 0x02, 
-    0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x53, 0x87, 
-    0x6E, 0xDA, 0x4A, 0x6E, 0xFF, 0x58, 0x66, 0x04, 0x4A, 0x85, 0x6F, 0x0E, 0x20, 0x2E, 0xFF, 0x42, 
-    0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 0x10, 0xBC, 0x00, 0x2E, 0x2E, 0x05, 0x60, 0x28, 0x76, 0x01, 
-    0x52, 0xAE, 0xFF, 0x7C, 0x4A, 0xAE, 0xFF, 0x7C, 0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 0x60, 0x02, 0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 
-    0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x53, 0x87, 0x6C, 0xD4, 0x47, 0xEE, 0xFF, 0x8C, 0x60, 0x00, 
-    0x01, 0x8A, 0x4A, 0x85, 0x6C, 0x04, 0x7A, 0x06, 0x60, 0x06, 0x4A, 0x85, 0x66, 0x02, 0x7A, 0x01, 
-    0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 
-    0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x72, 0x13, 0xB2, 0x85, 0x5E, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x22, 0x05, 0x60, 0x02, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 
-    0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x02, 0xC2, 0x26, 0x40, 0x28, 0x05, 0x4A, 0x6E, 
-    0xFF, 0x58, 0x4F, 0xEF, 0x00, 0x1E, 0x66, 0x26, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x0A, 0x2E, 0x00, 
-    0xB8, 0x87, 0x58, 0x4F, 0x6F, 0x06, 0x28, 0x07, 0x60, 0x02, 0x53, 0x84, 0x70, 0x01, 0xB0, 0x84, 
-    0x6E, 0x0C, 0x20, 0x04, 0x53, 0x80, 0x72, 0x30, 0xB2, 0x33, 0x08, 0x00, 0x67, 0xEC, 0x70, 0xFD, 
-    0xB0, 0xAE, 0xFF, 0x7C, 0x6E, 0x06, 0xBA, 0xAE, 0xFF, 0x7C, 0x6C, 0x08, 0x2A, 0x04, 0x53, 0x85, 
-    0x60, 0x00, 0xFC, 0x78, 0x2A, 0x04, 0x9A, 0xAE, 0xFF, 0x7C, 0x60, 0x00, 0xFE, 0x52, 0x1D, 0x46, 
-    0xFF, 0x8C, 0x60, 0x0E, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x1D, 0x68, 0xFF, 0xFF, 
-    0xFF, 0x8C, 0x47, 0xEE, 0xFF, 0x8C, 0x20, 0x0B, 0x52, 0x80, 0x2D, 0x40, 0xFF, 0x42, 0x60, 0x00, 
-    0x00, 0xBA, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 0x2D, 0x4B, 
-    0xFF, 0x42, 0x4A, 0x85, 0x6C, 0x10, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x0A, 0xD1, 0xAE, 0xFF, 0x42, 
-    0x58, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 
-    0x4A, 0x10, 0x67, 0x04, 0x53, 0x85, 0x6C, 0xEE, 0x53, 0xAE, 0xFF, 0x42, 0x60, 0x7C, 0x58, 0xAE, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 0x52, 0x4B, 0x2D, 0x4B, 0xFF, 0x42, 
-    0x76, 0x01, 0x4A, 0x85, 0x6D, 0x0C, 0x70, 0x00, 0x10, 0x2B, 0xFF, 0xFF, 0xB0, 0x85, 0x6D, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x2B, 0xFF, 0xFF, 0x4A, 0x80, 0x60, 0x02, 
-    0x20, 0x05, 0xD1, 0xAE, 0xFF, 0x42, 0x60, 0x42, 0x2D, 0x4B, 0xFF, 0x42, 0x58, 0xAE, 0x00, 0x0C, 
-    0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x88, 0x4A, 0x6E, 0xFF, 0x5C, 0x66, 0x0A, 
-    0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x20, 0x4A, 0x6E, 0xFF, 0x5C, 0x6F, 0x0A, 
-    0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x10, 0x20, 0x6E, 0xFF, 0x88, 0x30, 0xAE, 
-    0xFF, 0x40, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x02, 0x5A, 0x4A, 0xAE, 0xFF, 0x4E, 0x6C, 0x06, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4A, 0x6C, 0x06, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0x4A, 0x2F, 0x2E, 0xFF, 0x62, 0x4E, 0xAD, 0x03, 0x0A, 0x22, 0x2E, 0xFF, 0x4A, 0xD2, 0x80, 
-    0x20, 0x2E, 0xFF, 0x4E, 0xD0, 0x81, 0x2E, 0x2E, 0xFF, 0x42, 0x9E, 0x8B, 0xD0, 0x87, 0x41, 0xEE, 
-    0xFF, 0xDE, 0xD0, 0x88, 0x5C, 0x80, 0x28, 0x00, 0x98, 0xAE, 0xFF, 0x66, 0x4A, 0x6E, 0xFF, 0x5A, 
-    0x58, 0x4F, 0x67, 0x1A, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x14, 0xB8, 0xAE, 0xFF, 0x46, 0x6C, 0x0E, 
-    0x20, 0x2E, 0xFF, 0x46, 0x90, 0x84, 0xD1, 0xAE, 0xFF, 0x4A, 0x28, 0x2E, 0xFF, 0x46, 0xB8, 0xAE, 
-    0xFF, 0x46, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0xFF, 0x46, 0x60, 0x02, 0x20, 0x04, 
-    0xD1, 0xAE, 0xFF, 0x3E, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x74, 0x60, 0x2A, 0x53, 0x94, 0x4A, 0x94, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 
-    0x00, 0x20, 0x70, 0x20, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x05, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 0x6F, 0xCC, 
-    0x60, 0x3C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x1A, 0x20, 0x6E, 0xFF, 0x62, 
-    0x52, 0xAE, 0xFF, 0x62, 0x22, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x90, 0x70, 0x00, 
-    0x10, 0x10, 0x4A, 0x80, 0x60, 0x18, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x62, 0x52, 0xAE, 0xFF, 0x62, 
-    0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0xB2, 0x4A, 0x80, 0x50, 0x4F, 0x20, 0x6E, 
-    0xFF, 0x62, 0x4A, 0x10, 0x66, 0xBC, 0x60, 0x2A, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 
-    0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 0x70, 0x30, 
-    0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x30, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x7E, 0x4A, 0x80, 
-    0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4A, 0x4A, 0xAE, 0xFF, 0x4A, 0x6C, 0xCC, 0x4A, 0x87, 0x6F, 0x00, 
-    0x00, 0x98, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x2E, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 
-    0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 0x10, 0x13, 
-    0x4A, 0x80, 0x60, 0x74, 0x2F, 0x0C, 0x70, 0x00, 0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x3C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x62, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 0xB2, 0x80, 
-    0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xAD, 0x02, 0xDA, 0xD0, 0x87, 
-    0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x3E, 0x2F, 0x0C, 0x2F, 0x07, 0x70, 0x01, 
-    0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xF2, 0x4A, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x2A, 0x53, 0x94, 
-    0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x10, 0xBC, 0x00, 0x30, 0x70, 0x30, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x30, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x04, 0xD8, 0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4E, 
-    0x6C, 0xCC, 0x60, 0x3C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x1A, 0x20, 0x6E, 
-    0xFF, 0x66, 0x52, 0xAE, 0xFF, 0x66, 0x22, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x90, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x18, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x66, 0x52, 0xAE, 
-    0xFF, 0x66, 0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x90, 0x4A, 0x80, 0x50, 0x4F, 
-    0x20, 0x6E, 0xFF, 0x66, 0x4A, 0x10, 0x66, 0xBC, 0x60, 0x2A, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x20, 
-    0x70, 0x20, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x5C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 0x6F, 0xCC, 0x60, 0x00, 
-    0xF4, 0x8A, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x1E, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x64, 0x6F, 
-    0x70, 0x72, 0x6E, 0x74, 0x00, 0x42, 0x20, 0x00, 0x2B, 0x00, 0x2D, 0x00, 0x4E, 0x41, 0x4E, 0x28, 
-    0x30, 0x30, 0x30, 0x29, 0x00, 0x00, 0x49, 0x4E, 0x46, 0x00, 0x30, 0x58, 0x00, 0x00, 0x30, 0x78, 
-    0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 
-    0x65, 0x66, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 
-    0x43, 0x44, 0x45, 0x46, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x49, 0xED, 
-    0xFC, 0x0C, 0x60, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x02, 0x86, 0x58, 0x4F, 0x49, 0xEC, 0x00, 0x16, 
-    0xB9, 0xED, 0xFC, 0x08, 0x65, 0xEE, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 
-    0x5F, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x13, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x41, 0xED, 0x03, 0x32, 0x22, 0x6D, 0xFE, 0xE8, 0x23, 0x48, 
-    0x00, 0x08, 0x2C, 0x2D, 0xFD, 0xCA, 0x3E, 0x2D, 0xFD, 0xC8, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x04, 0xC2, 0x40, 0x67, 0x10, 0x42, 0x6C, 0x00, 0x10, 0x41, 0xED, 0xFD, 0xC4, 0x29, 0x48, 
-    0x00, 0x08, 0x60, 0x00, 0x00, 0xB2, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 0x66, 0x44, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x12, 0x74, 0x40, 0xC4, 0x41, 
-    0x67, 0x08, 0x39, 0x7C, 0x00, 0x64, 0x00, 0x10, 0x60, 0x2A, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x78, 
-    0x66, 0x03, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x04, 0x02, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x08, 0x39, 0x6E, 0xFF, 0xFE, 0x00, 0x10, 0x60, 0x06, 0x39, 0x7C, 
-    0x04, 0x00, 0x00, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x5C, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x10, 
-    0x20, 0x01, 0xA1, 0x1E, 0x29, 0x48, 0x00, 0x08, 0x66, 0x38, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 
-    0x0C, 0x40, 0x00, 0x64, 0x63, 0x2C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x0C, 0x40, 0x04, 0x00, 
-    0x52, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x60, 0x02, 0x70, 0x64, 
-    0x39, 0x40, 0x00, 0x10, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x10, 0x20, 0x01, 0xA1, 0x1E, 0x29, 0x48, 
-    0x00, 0x08, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x08, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x12, 0x60, 0x06, 
-    0x00, 0x6C, 0x00, 0x04, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0xD0, 0xAC, 0x00, 0x08, 
-    0x29, 0x40, 0x00, 0x0C, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 
-    0x66, 0x02, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x14, 0x2F, 0x01, 0x4E, 0xAD, 0x04, 0x02, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x06, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x12, 0x2B, 0x46, 0xFD, 0xCA, 
-    0x3B, 0x47, 0xFD, 0xC8, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x66, 0x69, 0x6E, 0x64, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x81, 
-    0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xEC, 
-    0x00, 0x6B, 0x00, 0x01, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x10, 0xC2, 0x40, 
-    0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xD4, 0x4A, 0xAB, 0x00, 0x08, 0x66, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xBA, 0xFE, 0x78, 0x58, 0x4F, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 0x01, 0x00, 
-    0xC2, 0x40, 0x67, 0x3C, 0x49, 0xED, 0xFC, 0x0C, 0x60, 0x30, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x32, 0x3C, 0x01, 0x02, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x01, 0x02, 
-    0x66, 0x14, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x3E, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0x86, 0x49, 0xEC, 0x00, 0x16, 0xB9, 0xED, 0xFC, 0x08, 0x65, 0xCA, 
-    0x27, 0x6B, 0x00, 0x08, 0x00, 0x04, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 
-    0x67, 0x04, 0x70, 0x01, 0x60, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x10, 0x4A, 0x80, 0x2F, 0x00, 
-    0x2F, 0x2B, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0xF2, 
-    0x26, 0x80, 0x53, 0x93, 0x4A, 0x93, 0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x10, 0x20, 0x6B, 0x00, 0x04, 
-    0x52, 0xAB, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x2E, 0x70, 0xFF, 0xB0, 0x93, 
-    0x66, 0x1C, 0x00, 0x6B, 0x00, 0x10, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 
-    0x00, 0x80, 0xC2, 0x40, 0x67, 0x0E, 0x02, 0x6B, 0xFF, 0xFE, 0x00, 0x12, 0x60, 0x06, 0x00, 0x6B, 
-    0x00, 0x20, 0x00, 0x12, 0x70, 0x00, 0x26, 0x80, 0x70, 0xFF, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x69, 0x6C, 0x62, 0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0xFF, 0x20, 0x0C, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x6C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x83, 0xC2, 0x40, 
-    0x67, 0x36, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x04, 0x70, 0x00, 
-    0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x5E, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0xEA, 0x4A, 0x80, 0x58, 0x4F, 0x6C, 0x08, 
-    0x7E, 0xFF, 0x70, 0x02, 0x2B, 0x40, 0xFD, 0xCA, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x08, 
-    0xC2, 0x40, 0x67, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0xA0, 0x1F, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 
-    0x42, 0x6C, 0x00, 0x12, 0x70, 0x00, 0x28, 0x80, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 0x20, 0x07, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x63, 0x6C, 0x6F, 0x73, 
-    0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x7E, 0x00, 0x20, 0x0C, 0x66, 0x3A, 0x47, 0xED, 0xFC, 0x0C, 0x60, 0x1E, 0x70, 0x00, 0x30, 0x2B, 
-    0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x0E, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0xD8, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x02, 0x7E, 0x01, 0x47, 0xEB, 0x00, 0x16, 0xB7, 0xED, 0xFC, 0x08, 0x65, 0xDC, 
-    0x4A, 0x87, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 0x60, 0x6A, 0x70, 0xFF, 0x60, 0x66, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x66, 0x20, 0x70, 0x00, 0x28, 0x80, 
-    0x70, 0x00, 0x60, 0x52, 0x2E, 0x2C, 0x00, 0x04, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xD0, 0x72, 0xFF, 
-    0xB2, 0x80, 0x58, 0x4F, 0x66, 0x06, 0xBE, 0xAC, 0x00, 0x04, 0x67, 0x28, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x66, 0x1C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 
-    0xC2, 0x40, 0x67, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x0A, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 
-    0x00, 0x08, 0x62, 0xC0, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x86, 0x66, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 0x48, 0xE7, 
-    0x11, 0x08, 0x1E, 0x2E, 0x00, 0x0B, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x52, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x42, 0xB2, 0x80, 0x66, 0x4C, 0x20, 0x2C, 
-    0x00, 0x04, 0xB0, 0xAC, 0x00, 0x0C, 0x64, 0x00, 0x00, 0x8E, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 0x10, 0x07, 0x0C, 0x40, 0x00, 0x0D, 0x67, 0x0A, 0x70, 0x00, 
-    0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 0x01, 0x12, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x20, 0x72, 0xFF, 
-    0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x58, 0x4F, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x06, 0x70, 0x00, 
-    0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x60, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x16, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x06, 0xB2, 0x80, 0x66, 0x38, 0x1D, 0x47, 
-    0xFF, 0xFF, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFF, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x14, 
-    0x2F, 0x01, 0x4E, 0xAD, 0x03, 0xFA, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x0A, 
-    0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 0x00, 0xB0, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 
-    0x70, 0xFF, 0x60, 0x00, 0x00, 0xA4, 0x76, 0x01, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 
-    0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 
-    0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x4A, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x52, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x62, 0x72, 0xFF, 0xB2, 0x80, 
-    0x58, 0x4F, 0x67, 0x2C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x10, 
-    0x2F, 0x0C, 0x70, 0x00, 0x10, 0x07, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0xC0, 0x4A, 0x80, 0x50, 0x4F, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x06, 
-    0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF2, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x17, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xFC, 0x2A, 0x14, 
-    0x26, 0x6C, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x04, 0x9E, 0x8B, 0x29, 0x4B, 0x00, 0x04, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x67, 0x04, 0x70, 0x00, 0x60, 0x08, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 0x72, 0x00, 0x32, 0x00, 0x28, 0x81, 0x20, 0x2C, 0x00, 0x0C, 
-    0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 0x60, 0x02, 
-    0x22, 0x14, 0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x28, 0x58, 0x4F, 0x4A, 0x87, 
-    0x6F, 0x56, 0x2F, 0x07, 0x2F, 0x0B, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x03, 0xFA, 0x2C, 0x00, 0xBC, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x3C, 0x00, 0x6C, 0x00, 0x20, 
-    0x00, 0x12, 0x4A, 0x86, 0x6E, 0x0A, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x28, 0x85, 0x60, 0x24, 
-    0x20, 0x07, 0x90, 0x86, 0x28, 0x80, 0xD0, 0xAC, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 0x2F, 0x14, 
-    0x20, 0x06, 0xD0, 0xAC, 0x00, 0x08, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x08, 0x4E, 0xAD, 0x03, 0xDA, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x78, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 0x67, 0x2E, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 0xC2, 0x40, 0x66, 0x0A, 0x00, 0x6C, 
-    0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x60, 0x66, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0xEF, 
-    0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0x82, 0x40, 0x39, 0x41, 0x00, 0x12, 0x4A, 0xAC, 
-    0x00, 0x04, 0x66, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0xA2, 0x58, 0x4F, 0x20, 0x2C, 0x00, 0x04, 
-    0xB0, 0xAC, 0x00, 0x08, 0x66, 0x36, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x66, 0x2A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x28, 0x80, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 
-    0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 
-    0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x1A, 0x58, 0x4F, 0x70, 0x00, 0x4C, 0xEE, 
-    0x10, 0x08, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x77, 0x72, 0x74, 0x63, 0x68, 0x6B, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2C, 
-    0x00, 0x0C, 0x9E, 0xAC, 0x00, 0x04, 0x4A, 0x87, 0x6C, 0x08, 0x29, 0x6C, 0x00, 0x0C, 0x00, 0x04, 
-    0x60, 0x06, 0xBE, 0x94, 0x6C, 0x02, 0x28, 0x87, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x88, 0x5F, 0x62, 0x75, 0x66, 0x73, 0x79, 0x6E, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x49, 0xED, 0xFC, 0x0C, 0x60, 0x1C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x32, 0x3C, 0x00, 0x83, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x04, 0x20, 0x0C, 
-    0x60, 0x0C, 0x49, 0xEC, 0x00, 0x16, 0xB9, 0xED, 0xFC, 0x08, 0x65, 0xDE, 0x70, 0x00, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x69, 0x6F, 0x70, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x10, 0x20, 0x0C, 0x66, 0x0C, 0x70, 0x17, 0x2B, 0x40, 0xFD, 0xCA, 0x70, 0x00, 0x60, 0x00, 
-    0x01, 0x62, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0x10, 0x66, 0x0C, 
-    0x70, 0x16, 0x2B, 0x40, 0xFD, 0xCA, 0x70, 0x00, 0x60, 0x00, 0x01, 0x48, 0x76, 0x01, 0x70, 0x2B, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x2B, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2C, 0x03, 0x76, 0x01, 0x70, 0x62, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x62, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2A, 0x03, 0x76, 0x01, 0x70, 0x70, 
-    0xB0, 0x2B, 0x00, 0x01, 0x67, 0x1E, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x2B, 
-    0x00, 0x02, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x02, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x2B, 0x00, 0x03, 
-    0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x28, 0x03, 0x10, 0x13, 0x04, 0x00, 0x00, 0x61, 
-    0x67, 0x2A, 0x04, 0x00, 0x00, 0x11, 0x67, 0x44, 0x5B, 0x00, 0x66, 0x52, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x48, 0x80, 0x32, 0x3C, 0x02, 0x00, 0x82, 0x40, 0x30, 0x3C, 
-    0x01, 0x00, 0x80, 0x41, 0x7E, 0x00, 0x3E, 0x00, 0x4A, 0x87, 0x60, 0x3C, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x72, 0x08, 0x82, 0x00, 0x70, 0x00, 0x10, 0x01, 0x32, 0x3C, 
-    0x01, 0x00, 0x82, 0x40, 0x7E, 0x00, 0x3E, 0x01, 0x4A, 0x87, 0x60, 0x1C, 0x4A, 0x86, 0x67, 0x04, 
-    0x70, 0x02, 0x60, 0x02, 0x70, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x60, 0x0A, 0x70, 0x16, 
-    0x2B, 0x40, 0xFD, 0xCA, 0x70, 0x00, 0x60, 0x6A, 0x4A, 0x85, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 
-    0x08, 0x00, 0x4A, 0x84, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xAD, 0x03, 0xE2, 0x2A, 0x00, 0x50, 0x4F, 0x6C, 0x04, 0x70, 0x00, 0x60, 0x42, 
-    0x70, 0x00, 0x28, 0x80, 0x39, 0x45, 0x00, 0x14, 0x4A, 0x86, 0x67, 0x06, 0x32, 0x3C, 0x00, 0x80, 
-    0x60, 0x14, 0x70, 0x72, 0xB0, 0x13, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 
-    0x70, 0x02, 0x48, 0x80, 0x32, 0x00, 0x70, 0x00, 0x10, 0x01, 0x39, 0x40, 0x00, 0x12, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x08, 0x42, 0x6C, 0x00, 0x10, 
-    0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x65, 0x6E, 
-    0x64, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0xBA, 0xFE, 0x20, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x56, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x66, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x42, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x01, 0xC2, 0x40, 0x70, 0x00, 
-    0x30, 0x01, 0x4A, 0x80, 0x67, 0x0A, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x62, 0x18, 
-    0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x0A, 0x4A, 0x94, 0x66, 0x06, 0x52, 0xAC, 
-    0x00, 0x04, 0x60, 0x04, 0x70, 0xFF, 0x60, 0x0E, 0x53, 0xAC, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x04, 
-    0x10, 0x87, 0x52, 0x94, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x86, 0x75, 0x6E, 0x67, 0x65, 0x74, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x38, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 
-    0x63, 0x6F, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x63, 0x6F, 0x52, 0x65, 0x61, 0x64, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x57, 0x72, 
-    0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x63, 0x6F, 0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x63, 0x6F, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x66, 0x73, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x73, 0x43, 0x6C, 
-    0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x66, 0x73, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x88, 0x5F, 0x66, 0x73, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x73, 0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x73, 0x79, 0x46, 0x41, 0x63, 0x63, 
-    0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x73, 0x79, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x73, 0x79, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x49, 0x6F, 0x63, 0x74, 
-    0x6C, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 
-    0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 
-    0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 
-    0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 
-    0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 
-    0x87, 0x5F, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDE, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x01, 0x08, 0x70, 0xFF, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x03, 0x10, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x42, 0x30, 0x2E, 0x00, 0x0E, 0x52, 0x40, 0x38, 0x80, 
-    0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x2F, 0x0C, 0x48, 0x78, 0x64, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF8, 0x4E, 0xBA, 0x07, 0x32, 0x2E, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x06, 0x42, 0x54, 0x70, 0xFF, 0x60, 0x10, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x06, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 
-    0x2F, 0x01, 0x4E, 0xBA, 0x06, 0x22, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x40, 0x48, 0x6E, 0x00, 0x08, 
-    0x4E, 0xBA, 0x02, 0x88, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2C, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x08, 0x4E, 0x91, 0x2E, 0x00, 0x42, 0x54, 
-    0x4A, 0x87, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 
-    0x4E, 0xBA, 0x05, 0xE4, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 
-    0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0xAC, 0x70, 0xFF, 0x50, 0x4F, 
-    0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0x12, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x01, 0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0x80, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 
-    0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 
-    0x00, 0x0C, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 
-    0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x05, 0x50, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 
-    0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x72, 
-    0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 
-    0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 
-    0x4E, 0xBA, 0x05, 0x14, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 
-    0x01, 0x7A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x02, 
-    0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0xE8, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x10, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 
-    0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x04, 0xB8, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x4A, 0xAE, 
-    0x00, 0x08, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0x78, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD2, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0xDC, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xBC, 0x20, 0x06, 
-    0x04, 0x80, 0x00, 0x00, 0x66, 0x01, 0x67, 0x32, 0x2F, 0x0B, 0x2F, 0x06, 0x2F, 0x0C, 0x20, 0x6C, 
-    0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0x94, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 
-    0x4E, 0xBA, 0x04, 0x24, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x7E, 0x20, 0x0B, 0x6C, 0x12, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0x0E, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x68, 
-    0x70, 0xFF, 0x90, 0x8B, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x00, 0x6C, 
-    0x26, 0x40, 0x20, 0x0B, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4C, 0x48, 0x6E, 0x00, 0x08, 
-    0x4E, 0xBA, 0x00, 0x58, 0x28, 0x40, 0x20, 0x4B, 0x22, 0x4C, 0x70, 0x04, 0x20, 0xD9, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x01, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x16, 0x42, 0x53, 
-    0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x03, 0xAA, 0x70, 0xFF, 
-    0x50, 0x4F, 0x60, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x69, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x4A, 0x6D, 0xFE, 0xEC, 0x66, 0x04, 0x4E, 0xBA, 0x01, 0x2A, 
-    0x30, 0x2D, 0xFE, 0xEC, 0x48, 0xC0, 0x81, 0xFC, 0x00, 0x14, 0x48, 0xC0, 0x2E, 0x00, 0x53, 0x87, 
-    0x4A, 0x93, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x20, 0x13, 0x60, 0x04, 0x70, 0xFF, 0x90, 0x93, 
-    0xBE, 0x80, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x48, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xDA, 0x4A, 0x93, 0x6D, 0x2E, 0x20, 0x6D, 0xFE, 0xEE, 
-    0x20, 0x13, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x4A, 0x54, 
-    0x66, 0x00, 0x00, 0xBC, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x18, 
-    0x70, 0x00, 0x28, 0x40, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA6, 0x70, 0xFF, 0x90, 0x93, 0x20, 0x6D, 
-    0xFE, 0xEE, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x60, 0x08, 
-    0x4A, 0x54, 0x67, 0x18, 0x49, 0xEC, 0x00, 0x14, 0x20, 0x6D, 0xFE, 0xEE, 0x20, 0x07, 0xE5, 0x88, 
-    0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0xD1, 0xC0, 0xB1, 0xCC, 0x64, 0xE4, 0x20, 0x6D, 0xFE, 0xEE, 
-    0x20, 0x07, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0xD1, 0xC0, 0xB1, 0xCC, 0x64, 0x4E, 
-    0x30, 0x2D, 0xFE, 0xEC, 0x48, 0xC0, 0xD0, 0xBC, 0x00, 0x00, 0x01, 0x90, 0x2F, 0x00, 0x2F, 0x2D, 
-    0xFE, 0xEE, 0x4E, 0xBA, 0x02, 0xF2, 0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x12, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x18, 0x2F, 0x01, 0x4E, 0xBA, 0x02, 0x9E, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x30, 
-    0x20, 0x07, 0x52, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 
-    0x49, 0xF0, 0x08, 0x00, 0x06, 0x6D, 0x01, 0x90, 0xFE, 0xEC, 0x2B, 0x48, 0xFE, 0xEE, 0x20, 0x6D, 
-    0xFE, 0xEE, 0x20, 0x0C, 0x90, 0x88, 0x72, 0x14, 0x4E, 0xAD, 0x01, 0x2A, 0x26, 0x80, 0x20, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x67, 0x65, 0x74, 0x49, 
-    0x4F, 0x50, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x3B, 0x7C, 
-    0x01, 0x90, 0xFE, 0xEC, 0x48, 0x78, 0x01, 0x90, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x02, 0x78, 
-    0x2B, 0x40, 0xFE, 0xEE, 0x4A, 0xAD, 0xFE, 0xF6, 0x50, 0x4F, 0x67, 0x46, 0x22, 0x6D, 0xFE, 0xF6, 
-    0x20, 0x69, 0x00, 0x1C, 0x22, 0x6D, 0xFE, 0xEE, 0x70, 0x3C, 0xA0, 0x2E, 0x20, 0x6D, 0xFE, 0xEE, 
-    0x49, 0xD0, 0x60, 0x20, 0x4A, 0x54, 0x67, 0x18, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x01, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x49, 0xEC, 0x00, 0x14, 0x20, 0x6D, 0xFE, 0xEE, 0x41, 0xE8, 0x00, 0x28, 0xB1, 0xCC, 0x64, 0xD4, 
-    0x60, 0x28, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x54, 0x4E, 0xBA, 0xFB, 0x2A, 0x70, 0x01, 
-    0x2F, 0x00, 0x48, 0x7A, 0x00, 0x48, 0x4E, 0xBA, 0xFB, 0x1E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x7A, 
-    0x00, 0x3C, 0x4E, 0xBA, 0xFB, 0x12, 0x4F, 0xEF, 0x00, 0x18, 0x41, 0xED, 0x04, 0x0A, 0x22, 0x6D, 
-    0xFE, 0xE8, 0x23, 0x48, 0x00, 0x04, 0x4A, 0xAD, 0xFE, 0xE4, 0x66, 0x08, 0x41, 0xED, 0xFE, 0x86, 
-    0x2B, 0x48, 0xFE, 0xE4, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x69, 0x6E, 
-    0x69, 0x74, 0x49, 0x4F, 0x50, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x64, 0x65, 0x76, 0x3A, 
-    0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 
-    0x30, 0x2D, 0xFE, 0xEC, 0x48, 0xC0, 0x81, 0xFC, 0x00, 0x14, 0x48, 0xC0, 0x2C, 0x00, 0x53, 0x86, 
-    0x7E, 0x00, 0x60, 0x0A, 0x2F, 0x07, 0x4E, 0xBA, 0xFB, 0x24, 0x58, 0x4F, 0x52, 0x87, 0xBC, 0x87, 
-    0x6C, 0xF2, 0x4A, 0xAD, 0xFE, 0xCE, 0x67, 0x04, 0x4E, 0xAD, 0x03, 0x82, 0x4C, 0xEE, 0x00, 0xC0, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x63, 0x6F, 0x72, 0x65, 0x49, 0x4F, 0x45, 0x78, 
-    0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 0x7E, 0x00, 0x30, 0x2E, 0x00, 0x0A, 
-    0x04, 0x40, 0xFF, 0x88, 0x67, 0x00, 0x01, 0x08, 0x04, 0x40, 0x00, 0x0C, 0x67, 0x00, 0x00, 0xC4, 
-    0x04, 0x40, 0x00, 0x2F, 0x67, 0x00, 0x00, 0xF0, 0x53, 0x40, 0x67, 0x00, 0x00, 0x86, 0x53, 0x40, 
-    0x67, 0x00, 0x00, 0xA8, 0x53, 0x40, 0x67, 0x00, 0x00, 0x8E, 0x53, 0x40, 0x67, 0x00, 0x00, 0xAC, 
-    0x53, 0x40, 0x67, 0x00, 0x00, 0xA2, 0x53, 0x40, 0x67, 0x00, 0x00, 0xC4, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0xAA, 0x53, 0x40, 0x67, 0x00, 0x00, 0xB4, 0x55, 0x40, 0x67, 0x00, 0x00, 0xA6, 0x53, 0x40, 
-    0x67, 0x00, 0x00, 0x94, 0x53, 0x40, 0x67, 0x00, 0x00, 0x8A, 0x53, 0x40, 0x67, 0x50, 0x53, 0x40, 
-    0x67, 0x58, 0x53, 0x40, 0x67, 0x00, 0x00, 0x9C, 0x53, 0x40, 0x67, 0x52, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0x9A, 0x53, 0x40, 0x67, 0x4C, 0x53, 0x40, 0x67, 0x7C, 0x55, 0x40, 0x67, 0x70, 0x53, 0x40, 
-    0x67, 0x30, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 0x67, 0x1C, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 
-    0x67, 0x4C, 0x53, 0x40, 0x67, 0x14, 0x53, 0x40, 0x67, 0x10, 0x04, 0x40, 0x00, 0x21, 0x67, 0x70, 
-    0x60, 0x6E, 0x7E, 0x14, 0x60, 0x6A, 0x7E, 0x0E, 0x60, 0x66, 0x7E, 0x1C, 0x60, 0x62, 0x7E, 0x11, 
-    0x60, 0x5E, 0x7E, 0x06, 0x60, 0x5A, 0x7E, 0x14, 0x60, 0x56, 0x7E, 0x1F, 0x60, 0x52, 0x7E, 0x10, 
-    0x60, 0x4E, 0x7E, 0x02, 0x60, 0x4A, 0x7E, 0x09, 0x60, 0x46, 0x7E, 0x04, 0x60, 0x42, 0x7E, 0x05, 
-    0x60, 0x3E, 0x7E, 0x0C, 0x60, 0x3A, 0x7E, 0x06, 0x60, 0x36, 0x7E, 0x14, 0x60, 0x32, 0x7E, 0x06, 
-    0x60, 0x2E, 0x7E, 0x1A, 0x60, 0x2A, 0x7E, 0x16, 0x60, 0x26, 0x7E, 0x0D, 0x60, 0x22, 0x7E, 0x1D, 
-    0x60, 0x1E, 0x7E, 0x09, 0x60, 0x1A, 0x7E, 0x17, 0x60, 0x16, 0x7E, 0x06, 0x60, 0x12, 0x7E, 0x10, 
-    0x60, 0x0E, 0x7E, 0x1E, 0x60, 0x0A, 0x7E, 0x0D, 0x60, 0x06, 0x7E, 0x1E, 0x60, 0x02, 0x7E, 0x14, 
-    0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x6D, 0x61, 0x70, 0x4F, 
-    0x53, 0x65, 0x72, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x3E, 0x2E, 
-    0x00, 0x0E, 0x3B, 0x47, 0xFD, 0xC8, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0x00, 0x08, 
-    0x60, 0x0C, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xFE, 0xAC, 0x4A, 0x80, 0x58, 0x4F, 0x2B, 0x40, 
-    0xFD, 0xCA, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x75, 0x65, 
-    0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x07, 0x18, 0x2C, 0x2E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x20, 0x0C, 0x67, 0x18, 0x59, 0x8F, 0x2F, 0x0C, 
-    0x4E, 0xAD, 0x01, 0x62, 0x2E, 0x1F, 0xBE, 0x86, 0x6F, 0x0A, 0x20, 0x4C, 0x20, 0x06, 0xA0, 0x20, 
-    0x20, 0x0C, 0x60, 0x3C, 0x20, 0x06, 0xA1, 0x1E, 0x2D, 0x48, 0xFF, 0xFC, 0x4A, 0x78, 0x02, 0x20, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x2A, 0x20, 0x0C, 0x67, 0x0E, 0x20, 0x4C, 0x22, 0x6E, 0xFF, 0xFC, 
-    0x20, 0x07, 0xA0, 0x2E, 0x20, 0x4C, 0xA0, 0x1F, 0x2A, 0x2E, 0xFF, 0xFC, 0x28, 0x45, 0xD9, 0xC7, 
-    0x26, 0x45, 0xD7, 0xC6, 0x60, 0x02, 0x42, 0x1C, 0xB7, 0xCC, 0x62, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x67, 0x72, 0x6F, 
-    0x77, 0x46, 0x69, 0x6C, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x4A, 0xAD, 0xFE, 0xF2, 
-    0x66, 0x08, 0x41, 0xED, 0xFD, 0xCE, 0x2B, 0x48, 0xFE, 0xF2, 0x20, 0x6D, 0xFE, 0xF2, 0x49, 0xD0, 
-    0x60, 0x0A, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x10, 0x49, 0xEC, 0x00, 0x18, 0x20, 0x6D, 0xFE, 0xF2, 
-    0x41, 0xE8, 0x00, 0x78, 0xB1, 0xCC, 0x62, 0xEA, 0x2E, 0x3C, 0x40, 0x00, 0x00, 0x06, 0x60, 0x16, 
-    0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x06, 0x2F, 0x0B, 0x20, 0x6C, 0x00, 0x04, 0x4E, 0x90, 0x2E, 0x00, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x0C, 0x49, 0xEC, 0xFF, 0xE8, 0x20, 0x6D, 0xFE, 0xF2, 0xB1, 0xCC, 
-    0x63, 0xDE, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x0E, 0x20, 0x6D, 0xFE, 0xF2, 0xB1, 0xCC, 0x62, 0x06, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x8C, 0x20, 0x3C, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x87, 0x66, 0x04, 
-    0x20, 0x07, 0x60, 0x1E, 0x3C, 0x07, 0x6C, 0x04, 0x7E, 0x00, 0x60, 0x08, 0x02, 0x87, 0xBF, 0xFF, 
-    0xFF, 0xFF, 0x42, 0x46, 0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x07, 0x4E, 0xBA, 0xFE, 0x9A, 0x70, 0xFF, 
-    0x50, 0x4F, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x61, 
-    0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x17, 0x18, 
-    0x28, 0x6E, 0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xFE, 0xE4, 0x66, 0x08, 0x41, 0xED, 
-    0xFE, 0x86, 0x2B, 0x48, 0xFE, 0xE4, 0x7E, 0x00, 0x2C, 0x05, 0x60, 0x16, 0x70, 0x10, 0xB0, 0x87, 
-    0x6E, 0x0C, 0x70, 0x16, 0x2B, 0x40, 0xFD, 0xCA, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xB6, 0x52, 0x87, 
-    0xE2, 0x86, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xE4, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xFE, 0x46, 
-    0x47, 0xF0, 0x00, 0x00, 0x20, 0x6D, 0xFE, 0xE4, 0x70, 0x00, 0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 
-    0xC2, 0x80, 0x66, 0x08, 0x70, 0x03, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x16, 0x41, 0xED, 0x01, 0x4A, 
-    0xB1, 0xD3, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 0x20, 0x13, 0x2D, 0x40, 
-    0xFF, 0xFC, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x66, 0x0E, 0x20, 0x6D, 0xFE, 0xE4, 0x20, 0x05, 
-    0x46, 0x80, 0xC1, 0x68, 0x00, 0x02, 0x60, 0x56, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x66, 0x36, 
-    0x20, 0x6D, 0xFE, 0xE4, 0x8B, 0x68, 0x00, 0x02, 0x70, 0x02, 0xB0, 0x85, 0x66, 0x10, 0x20, 0x6D, 
-    0xFE, 0xE4, 0x70, 0x00, 0x30, 0x10, 0x22, 0x05, 0xC2, 0x80, 0x66, 0xF2, 0x60, 0x30, 0x20, 0x6D, 
-    0xFE, 0xE4, 0x4A, 0x50, 0x67, 0x28, 0x20, 0x05, 0x46, 0x80, 0xC1, 0x50, 0x2F, 0x05, 0x4E, 0xBA, 
-    0x00, 0x36, 0x58, 0x4F, 0x60, 0x18, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x08, 0x41, 0xED, 0x01, 0x4A, 0x20, 0x08, 0x60, 0x02, 0x20, 0x0C, 0x26, 0x80, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x73, 0x69, 0x67, 
-    0x6E, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x08, 0x2A, 0x2E, 
-    0x00, 0x08, 0x4A, 0xAD, 0xFE, 0xE4, 0x66, 0x08, 0x41, 0xED, 0xFE, 0x86, 0x2B, 0x48, 0xFE, 0xE4, 
-    0x7E, 0x00, 0x2C, 0x05, 0x60, 0x0E, 0x70, 0x10, 0xB0, 0x87, 0x6E, 0x04, 0x70, 0xFF, 0x60, 0x4A, 
-    0x52, 0x87, 0xE2, 0x86, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xEC, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 
-    0xFE, 0x46, 0x28, 0x70, 0x00, 0x00, 0x20, 0x0C, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2C, 0x20, 0x6D, 
-    0xFE, 0xE4, 0x70, 0x00, 0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 0xC2, 0x80, 0x66, 0x06, 0x8B, 0x50, 
-    0x70, 0xFF, 0x60, 0x16, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x05, 0x4E, 0xBA, 0xFE, 0x9C, 0x2F, 0x05, 
-    0x20, 0x4C, 0x4E, 0x90, 0x70, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xE0, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x72, 0x61, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x04, 0x48, 0x6F, 0x00, 0x0C, 
-    0x2F, 0x2F, 0x00, 0x1A, 0x3F, 0x3C, 0x00, 0x0B, 0xA9, 0xEB, 0x4E, 0x75, 0x00, 0x00, 0x89, 0x36, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xE7, 0x7F, 0xF8, 0x49, 0xFA, 0x01, 0xA8, 
-    0x30, 0x2C, 0x00, 0x04, 0x53, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x32, 0x26, 0x4D, 0x97, 0xD4, 
-    0x2F, 0x0B, 0x2F, 0x14, 0x61, 0x00, 0x01, 0x4C, 0x20, 0x2C, 0x00, 0x08, 0x48, 0x74, 0x08, 0x00, 
-    0x2F, 0x0B, 0x61, 0x00, 0x00, 0x2E, 0x50, 0x4F, 0x20, 0x2C, 0x00, 0x0C, 0x48, 0x74, 0x08, 0x00, 
-    0x2F, 0x0B, 0x2F, 0x0D, 0x61, 0x00, 0x00, 0xD0, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xDF, 
-    0x1F, 0xFE, 0x4E, 0x75, 0x80, 0x09, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x49, 0x4E, 0x49, 0x54, 0x00, 
-    0x00, 0x00, 0x22, 0x6F, 0x00, 0x04, 0x20, 0x6F, 0x00, 0x08, 0x48, 0xE7, 0x18, 0x00, 0x76, 0x01, 
-    0x72, 0x00, 0x12, 0x18, 0x24, 0x01, 0x02, 0x41, 0x00, 0x0F, 0x66, 0x0A, 0x61, 0x00, 0x00, 0x44, 
-    0x22, 0x00, 0x67, 0x24, 0x60, 0x02, 0xD2, 0x41, 0x02, 0x42, 0x00, 0xF0, 0x66, 0x08, 0x61, 0x00, 
-    0x00, 0x32, 0x24, 0x00, 0x60, 0x02, 0xE6, 0x4A, 0xD3, 0xC2, 0x28, 0x01, 0x12, 0xD8, 0x53, 0x84, 
-    0x66, 0xFA, 0x53, 0x83, 0x66, 0xF2, 0x60, 0xC6, 0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x80, 0x10, 
-    0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 
-    0x00, 0x00, 0x70, 0x00, 0x10, 0x18, 0x6A, 0x42, 0x08, 0x00, 0x00, 0x06, 0x67, 0x34, 0x08, 0x00, 
-    0x00, 0x05, 0x67, 0x20, 0x08, 0x00, 0x00, 0x04, 0x67, 0x0A, 0x61, 0xE6, 0x26, 0x00, 0x61, 0xE2, 
-    0xC1, 0x43, 0x4E, 0x75, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 
-    0x10, 0x18, 0x4E, 0x75, 0x02, 0x00, 0x00, 0x1F, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 
-    0x4E, 0x75, 0x02, 0x00, 0x00, 0x3F, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x80, 0x06, 0x67, 0x65, 
-    0x74, 0x5F, 0x72, 0x6C, 0x00, 0x00, 0x22, 0x2F, 0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x20, 0x6F, 
-    0x00, 0x0C, 0x74, 0x01, 0x70, 0x00, 0x10, 0x18, 0x67, 0x0C, 0x6A, 0x26, 0x08, 0x80, 0x00, 0x07, 
-    0xE1, 0x88, 0x10, 0x18, 0x60, 0x1C, 0x10, 0x18, 0x67, 0x24, 0x6A, 0x0E, 0xE1, 0x88, 0x10, 0x18, 
-    0xE1, 0x88, 0x10, 0x18, 0xE1, 0x88, 0x10, 0x18, 0x60, 0x08, 0x24, 0x00, 0x61, 0x00, 0xFF, 0x74, 
-    0xC1, 0x42, 0xD0, 0x80, 0xD3, 0xC0, 0xD3, 0x91, 0x53, 0x82, 0x66, 0xF8, 0x60, 0xC4, 0x4E, 0x75, 
-    0x80, 0x0E, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 
-    0x00, 0x00, 0x74, 0x00, 0x20, 0x5F, 0x20, 0x1F, 0x22, 0x5F, 0x67, 0x28, 0x32, 0x09, 0x02, 0x41, 
-    0x00, 0x03, 0x67, 0x08, 0x12, 0xC2, 0x53, 0x80, 0x66, 0xF2, 0x60, 0x18, 0x22, 0x00, 0xE4, 0x89, 
-    0x67, 0x06, 0x22, 0xC2, 0x53, 0x81, 0x66, 0xFA, 0x02, 0x40, 0x00, 0x03, 0x60, 0x02, 0x12, 0xC2, 
-    0x51, 0xC8, 0xFF, 0xFC, 0x4E, 0xD0, 0x80, 0x0A, 0x5A, 0x45, 0x52, 0x4F, 0x42, 0x55, 0x46, 0x46, 
-    0x45, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x14, 0x00, 0x00, 0x86, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x42, 0x00, 0x01, 
-    0x17, 0x4A, 0x81, 0xFF, 0xF4, 0x00, 0x01, 0x05, 0x4A, 0x81, 0xFF, 0xEC, 0x00, 0x01, 0x05, 0x4A, 
-    0x00, 0x01, 0x17, 0x5A, 0x81, 0xFF, 0xF8, 0x00, 0x01, 0x05, 0x5A, 0x00, 0x01, 0x17, 0x52, 0x81, 
-    0xFF, 0xF4, 0x00, 0x01, 0x05, 0x52, 0x00, 0x01, 0x17, 0x62, 0x81, 0xFF, 0xF4, 0x00, 0x01, 0x05, 
-    0x62, 0x00, 0x01, 0x17, 0x6A, 0x81, 0xFF, 0xF8, 0x00, 0x01, 0x05, 0x6A, 0x00, 0x01, 0x17, 0x72, 
-    0x81, 0xFF, 0xB2, 0x00, 0x01, 0x05, 0x72, 0x81, 0xFF, 0xF4, 0x00, 0x01, 0x05, 0x72, 0x00, 0x01, 
-    0x17, 0x7A, 0x00, 0xF0, 0x01, 0x06, 0x07, 0x82, 0x8A, 0xE2, 0xEA, 0xA2, 0xF2, 0x30, 0xF0, 0x02, 
-    0x02, 0x01, 0x02, 0x01, 0x0A, 0x00, 0xF0, 0x01, 0x02, 0x07, 0x9A, 0x92, 0x00, 0x01, 0x17, 0xAA, 
-    0x81, 0xFF, 0xBC, 0x00, 0x01, 0x05, 0xAA, 0x00, 0x01, 0x17, 0xB2, 0x81, 0xFF, 0xBC, 0x00, 0x01, 
-    0x05, 0xB2, 0x81, 0xFF, 0xB0, 0x00, 0x01, 0x05, 0xB2, 0x00, 0x01, 0x17, 0xBA, 0x81, 0xFF, 0xBC, 
-    0x00, 0x01, 0x05, 0xBA, 0x81, 0xFF, 0xB4, 0x00, 0x01, 0x05, 0xBA, 0x00, 0x01, 0x17, 0xC2, 0x81, 
-    0xFF, 0xB0, 0x00, 0x01, 0x05, 0xC2, 0x81, 0xFF, 0xBC, 0x00, 0x01, 0x05, 0xC2, 0x81, 0xFF, 0xA8, 
-    0x00, 0x01, 0x05, 0xC2, 0x00, 0x01, 0x17, 0xCA, 0x00, 0xF0, 0x01, 0x06, 0x07, 0xD2, 0xDA, 0xE2, 
-    0xEA, 0xFA, 0xF2, 0x30, 0xF0, 0x02, 0x04, 0x01, 0x02, 0x01, 0x0A, 0x01, 0x12, 0x01, 0x1A, 0x00, 
-    0x80, 0x80, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 
-    0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x48, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x10, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 
-    0x10, 0x10, 0x20, 0x00, 0x46, 0x80, 0x81, 0x25, 0x64, 0x3A, 0x20, 0x25, 0x73, 0x0D, 0x00, 0x23, 
-    0x20, 0x45, 0x6C, 0x76, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x20, 
-    0x61, 0x6E, 0x64, 0x20, 0x77, 0x65, 0x6C, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x69, 0x76, 
-    0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x44, 0x61, 0x6E, 0x20, 0x51, 0x75, 0x61, 
-    0x79, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x4D, 0x61, 0x72, 0x73, 0x2E, 0x0D, 0x14, 0x2D, 0x69, 
-    0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x1A, 0x2D, 0x21, 0x64, 0x62, 0x20, 0x00, 0x2D, 0x79, 0x79, 
-    0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x00, 0x2D, 0x70, 0x70, 0x20, 0x15, 0x2D, 0x61, 0x75, 0x74, 
-    0x6F, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x1C, 0x2D, 0x6E, 0x6F, 0x6C, 0x69, 0x62, 0x6D, 0x61, 0x69, 
-    0x6E, 0x20, 0x00, 0x2D, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x47, 0x6C, 0x75, 0x65, 0x20, 0x16, 
-    0x2D, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x47, 0x6C, 0x75, 0x65, 0x20, 0x10, 0xF0, 0x0E, 0x02, 
-    0x2D, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x2D, 0x53, 
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x1A, 0x2D, 0x53, 0x65, 
-    0x72, 0x76, 0x65, 0x72, 0x43, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x00, 0x2D, 0x64, 0x20, 0x25, 0x73, 
-    0x20, 0x17, 0x2D, 0x72, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x25, 0x73, 0x20, 0x25, 0x73, 0x20, 
-    0x14, 0x2D, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x10, 0x3C, 0x2D, 0x70, 0x61, 0x63, 0x6B, 
-    0x61, 0x67, 0x65, 0x20, 0x00, 0x7B, 0x58, 0x7D, 0x20, 0x41, 0x72, 0x6D, 0x36, 0x63, 0x20, 0x2D, 
-    0x65, 0x20, 0x2D, 0x65, 0x6D, 0x20, 0x2D, 0x77, 0x20, 0x2D, 0x64, 0x20, 0x50, 0x52, 0x4F, 0x54, 
-    0x4F, 0x43, 0x4F, 0x4C, 0x47, 0x45, 0x4E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x3E, 0x20, 0x74, 
-    0x65, 0x6D, 0x70, 0x2E, 0x70, 0x67, 0x20, 0x10, 0x6E, 0x0D, 0x00, 0x7B, 0x58, 0x7D, 0x20, 0x50, 
-    0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 0x54, 0x6F, 0x6F, 0x6C, 0x20, 0x2D, 
-    0x64, 0x61, 0x74, 0x65, 0x20, 0x22, 0x60, 0x64, 0x61, 0x74, 0x65, 0x60, 0x22, 0x20, 0x2D, 0x74, 
-    0x72, 0x75, 0x65, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x2E, 0x70, 0x67, 0x20, 0x00, 0x20, 0x7C, 0x7C, 0x20, 0x42, 
-    0x65, 0x67, 0x69, 0x6E, 0x20, 0x3B, 0x20, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x2D, 0x69, 
-    0x20, 0x74, 0x65, 0x6D, 0x70, 0x2E, 0x70, 0x67, 0x20, 0x3B, 0x20, 0x45, 0x78, 0x69, 0x74, 0x20, 
-    0x31, 0x3B, 0x20, 0x45, 0x6E, 0x64, 0x0D, 0x1F, 0x7B, 0x58, 0x7D, 0x20, 0x44, 0x65, 0x6C, 0x65, 
-    0x74, 0x65, 0x20, 0x2D, 0x69, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x2E, 0x70, 0x67, 0x00, 0x0D, 0x00, 
-    0x31, 0x2E, 0x30, 0x64, 0x34, 0x34, 0x10, 0x80, 0x9A, 0x23, 0x20, 0x25, 0x73, 0x20, 0x28, 0x50, 
-    0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 
-    0x72, 0x29, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x23, 0x20, 
-    0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0xA9, 0x20, 0x31, 0x39, 0x39, 0x32, 
-    0x2C, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 
-    0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x20, 0x20, 0x41, 0x6C, 0x6C, 0x20, 0x52, 0x69, 0x67, 
-    0x68, 0x74, 0x73, 0x20, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2E, 0x0D, 0x00, 0x23, 
-    0x0D, 0x23, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 0x00, 0x23, 0x20, 0x73, 0x6F, 0x6D, 
-    0x65, 0x6F, 0x6E, 0x65, 0x20, 0x63, 0x6C, 0x61, 0x69, 0x6D, 0x73, 0x20, 0x69, 0x74, 0x27, 0x73, 
-    0x20, 0x25, 0x73, 0x11, 0x23, 0x0D, 0x1C, 0x23, 0x20, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x47, 0x65, 0x6E, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x0D, 0x00, 0x23, 0x0D, 0x10, 
-    0x68, 0x23, 0x09, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 0x20, 0x7B, 
-    0x2D, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x47, 0x6C, 0x75, 0x65, 0x20, 0x7C, 
-    0x20, 0x2D, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x47, 0x6C, 0x75, 0x65, 0x20, 0x7C, 0x20, 0x2D, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
-    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7C, 0x20, 0x2D, 
-    0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x6F, 
-    0x75, 0x72, 0x63, 0x65, 0x20, 0x7D, 0x20, 0xB6, 0x0D, 0x10, 0x4A, 0x23, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x2D, 0x64, 0x20, 0x3C, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x5B, 0x3D, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5D, 0x5D, 0x20, 
-    0x20, 0x23, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 
-    0x20, 0x28, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x72, 0x65, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 
-    0x69, 0x6E, 0x67, 0x29, 0x0D, 0x10, 0x80, 0xAA, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x2D, 0x69, 0x20, 0x3C, 0x64, 0x69, 0x72, 0x65, 
-    0x63, 0x74, 0x6F, 0x72, 0x79, 0x3E, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 
-    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 
-    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x0D, 0x00, 0x23, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5B, 0x2D, 0x4E, 
-    0x6F, 0x4C, 0x69, 0x62, 0x4D, 0x61, 0x69, 0x6E, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x67, 
-    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x4C, 0x69, 0x62, 
-    0x4D, 0x61, 0x69, 0x6E, 0x28, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x69, 0x6E, 0x20, 0x49, 0x6D, 0x70, 
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x6F, 0x75, 0x72, 0x63, 
-    0x65, 0x0D, 0x10, 0x81, 0x0A, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x5B, 0x2D, 0x52, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3C, 0x66, 0x72, 
-    0x6F, 0x6D, 0x3E, 0x20, 0x3C, 0x74, 0x6F, 0x3E, 0x5D, 0x20, 0x20, 0x23, 0x20, 0x72, 0x65, 0x6E, 
-    0x61, 0x6D, 0x65, 0x20, 0x3C, 0x66, 0x72, 0x6F, 0x6D, 0x3E, 0x20, 0x28, 0x61, 0x6E, 0x20, 0x69, 
-    0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x29, 0x20, 0x74, 0x6F, 0x20, 0x3C, 0x74, 0x6F, 
-    0x3E, 0x20, 0x28, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x29, 0x0D, 0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x20, 
-    0x28, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x4D, 0x55, 0x53, 0x54, 0x20, 
-    0x62, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 
-    0x20, 0x2D, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x29, 0x0D, 
-    0x00, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x5B, 0x2D, 0x70, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x77, 0x69, 0x74, 0x74, 0x79, 0x20, 0x72, 0x65, 0x70, 0x61, 0x72, 0x74, 0x65, 0x65, 0x0D, 0x10, 
-    0x42, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x5B, 0x2D, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 
-    0x65, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x64, 0x6F, 
-    0x75, 0x74, 0x0D, 0x10, 0x64, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x5B, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x5D, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x6F, 0x75, 0x74, 
-    0x70, 0x75, 0x74, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x67, 0x6C, 0x75, 0x65, 0x20, 0x73, 0x75, 0x69, 0x74, 0x61, 0x62, 0x6C, 0x65, 
-    0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x61, 
-    0x63, 0x6B, 0x61, 0x67, 0x65, 0x0D, 0x00, 0x23, 0x0D, 0x10, 0x5E, 0x23, 0x09, 0x59, 0x6F, 0x75, 
-    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61, 0x74, 
-    0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x2D, 0x49, 
-    0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x47, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x2D, 0x49, 
-    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x47, 0x6C, 0x75, 
-    0x65, 0x2C, 0x20, 0x2D, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x0D, 0x10, 0x4E, 0x23, 0x20, 0x20, 0x6F, 0x72, 
-    0x20, 0x2D, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x50, 0x72, 0x6F, 0x74, 0x6F, 
-    0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x69, 0x74, 0x63, 
-    0x68, 0x20, 0x61, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x28, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x74, 
-    0x68, 0x69, 0x73, 0x29, 0x2E, 0x0D, 0x00, 0x23, 0x0D, 0x17, 0x45, 0x6C, 0x76, 0x69, 0x73, 0x20, 
-    0x69, 0x73, 0x20, 0x64, 0x65, 0x61, 0x64, 0x21, 0x1D, 0x23, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 
-    0x6E, 0x67, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6E, 0x3E, 0x20, 0x61, 0x73, 0x20, 0x27, 0x25, 
-    0x73, 0x27, 0x0D, 0x10, 0x22, 0x23, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x27, 
-    0x25, 0x73, 0x27, 0x0D, 0x00, 0x72, 0x00, 0x43, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x6F, 0x70, 
-    0x65, 0x6E, 0x20, 0x27, 0x25, 0x73, 0x27, 0x10, 0x46, 0x3B, 0x09, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x00, 0x3B, 0x0D, 0x13, 
-    0x31, 0x2E, 0x30, 0x64, 0x34, 0x34, 0x10, 0x4E, 0x3B, 0x09, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x63, 
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x25, 0x73, 0x20, 0x62, 0x79, 0x20, 0x50, 0x72, 0x6F, 
-    0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 
-    0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x00, 0x3B, 0x09, 0x44, 0x6F, 
-    0x6E, 0x27, 0x74, 0x20, 0x65, 0x64, 0x69, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 
-    0x6C, 0x65, 0x0D, 0x00, 0x3B, 0x0D, 0x11, 0x3B, 0x0D, 0x10, 0x81, 0x00, 0x0D, 0x00, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x41, 0x52, 0x45, 0x41, 0x09, 0x7C, 0x43, 0x24, 0x24, 0x63, 0x6F, 0x64, 0x65, 
-    0x7C, 0x2C, 0x20, 0x43, 0x4F, 0x44, 0x45, 0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4F, 0x4E, 0x4C, 
-    0x59, 0x0D, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 
-    0x7C, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x49, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x42, 0x79, 
-    0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x63, 0x54, 0x31, 0x7C, 0x09, 0x09, 0x3B, 
-    0x20, 0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x2D, 0x62, 0x79, 0x2D, 
-    0x6E, 0x61, 0x6D, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 
-    0x7C, 0x46, 0x72, 0x65, 0x65, 0x49, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x5F, 0x5F, 0x46, 
-    0x50, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x7C, 0x09, 0x09, 0x3B, 0x20, 
-    0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x2D, 0x61, 
-    0x6E, 0x2D, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 
-    0x09, 0x4D, 0x41, 0x43, 0x52, 0x4F, 0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x09, 0x09, 
-    0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x09, 0x24, 0x73, 0x6C, 0x6F, 0x74, 0x6E, 0x6F, 
-    0x0D, 0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x30, 
-    0x2C, 0x23, 0x34, 0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x2D, 0x3E, 0x20, 
-    0x22, 0x72, 0x65, 0x61, 0x6C, 0x22, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0D, 0x10, 0x58, 0x09, 0x09, 
-    0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x5B, 0x52, 0x30, 0x2C, 0x23, 0x38, 
-    0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x32, 0x20, 0x2D, 0x3E, 0x20, 0x62, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 
-    0x35, 0x2C, 0x52, 0x31, 0x32, 0x2C, 0x23, 0x24, 0x73, 0x6C, 0x6F, 0x74, 0x6E, 0x6F, 0x2A, 0x34, 
-    0x09, 0x09, 0x3B, 0x20, 0x67, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x0D, 0x00, 0x09, 0x09, 
-    0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x10, 0x28, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x41, 0x43, 
-    0x52, 0x4F, 0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x09, 0x09, 0x4E, 0x65, 0x77, 0x09, 
-    0x09, 0x24, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x50, 0x72, 0x6F, 0x63, 0x0D, 
-    0x10, 0x30, 0x09, 0x09, 0x09, 0x53, 0x54, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 
-    0x7B, 0x52, 0x30, 0x2D, 0x52, 0x33, 0x2C, 0x52, 0x31, 0x34, 0x7D, 0x09, 0x09, 0x3B, 0x20, 0x73, 
-    0x61, 0x76, 0x65, 0x20, 0x4E, 0x65, 0x77, 0x28, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x61, 0x72, 0x67, 
-    0x73, 0x0D, 0x10, 0x5C, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x52, 
-    0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x70, 
-    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 
-    0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x4C, 0x09, 0x09, 0x24, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 
-    0x61, 0x6D, 0x65, 0x50, 0x72, 0x6F, 0x63, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x3D, 
-    0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x0D, 
-    0x10, 0x26, 0x09, 0x09, 0x09, 0x42, 0x4C, 0x09, 0x09, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x49, 0x6E, 
-    0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x42, 0x79, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x46, 0x50, 
-    0x43, 0x63, 0x54, 0x31, 0x09, 0x3B, 0x20, 0x0D, 0x10, 0x80, 0xD8, 0x09, 0x09, 0x09, 0x54, 0x53, 
-    0x54, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x52, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x73, 
-    0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3F, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 
-    0x09, 0x52, 0x31, 0x33, 0x2C, 0x52, 0x31, 0x33, 0x2C, 0x23, 0x34, 0x09, 0x09, 0x09, 0x09, 0x3B, 
-    0x20, 0x70, 0x6F, 0x70, 0x20, 0x28, 0x73, 0x61, 0x76, 0x65, 0x64, 0x29, 0x20, 0x73, 0x74, 0x72, 
-    0x69, 0x6E, 0x67, 0x20, 0x70, 0x61, 0x72, 0x6D, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x69, 0x73, 0x20, 
-    0x27, 0x74, 0x68, 0x69, 0x73, 0x27, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x6E, 
-    0x69, 0x6C, 0x29, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 
-    0x33, 0x21, 0x2C, 0x7B, 0x52, 0x31, 0x2D, 0x52, 0x33, 0x2C, 0x52, 0x31, 0x34, 0x7D, 0x09, 0x09, 
-    0x3B, 0x20, 0x70, 0x6F, 0x70, 0x20, 0x4E, 0x65, 0x77, 0x28, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x61, 
-    0x72, 0x67, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x45, 0x51, 0x09, 0x50, 0x43, 
-    0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
-    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 
-    0x65, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x61, 
-    0x64, 0x65, 0x0D, 0x14, 0x09, 0x09, 0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x10, 0x4C, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x4D, 0x41, 0x43, 0x52, 0x4F, 0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 
-    0x09, 0x09, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x09, 0x24, 0x73, 0x6C, 0x6F, 0x74, 0x6E, 0x6F, 
-    0x0D, 0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x30, 
-    0x2C, 0x23, 0x34, 0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x2D, 0x3E, 0x20, 
-    0x72, 0x65, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0D, 0x10, 0x50, 0x09, 0x09, 0x09, 0x53, 
-    0x54, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x30, 0x2C, 0x52, 0x31, 
-    0x34, 0x7D, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 
-    0x2C, 0x20, 0x4C, 0x4B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x52, 0x09, 0x09, 0x52, 0x31, 
-    0x34, 0x2C, 0x25, 0x25, 0x46, 0x31, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x73, 0x65, 0x74, 0x20, 
-    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x64, 0x64, 0x72, 0x0D, 0x10, 0x4E, 0x09, 0x09, 
-    0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x5B, 0x52, 0x30, 0x2C, 0x23, 0x38, 
-    0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x32, 0x20, 0x2D, 0x3E, 0x20, 0x62, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 
-    0x35, 0x2C, 0x52, 0x31, 0x32, 0x2C, 0x23, 0x24, 0x73, 0x6C, 0x6F, 0x74, 0x6E, 0x6F, 0x2A, 0x34, 
-    0x09, 0x09, 0x3B, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x74, 0x0D, 0x10, 0x36, 0x31, 0x09, 
-    0x09, 0x09, 0x4C, 0x44, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x30, 
-    0x2C, 0x52, 0x31, 0x34, 0x7D, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 
-    0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
-    0x64, 0x64, 0x72, 0x0D, 0x10, 0x42, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x46, 0x72, 0x65, 0x65, 
-    0x49, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x39, 0x54, 0x50, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x09, 0x3B, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x63, 0x61, 
-    0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x13, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x0D, 0x10, 
-    0x22, 0x09, 0x09, 0x09, 0x41, 0x52, 0x45, 0x41, 0x09, 0x7C, 0x43, 0x24, 0x24, 0x63, 0x6F, 0x64, 
-    0x65, 0x7C, 0x2C, 0x20, 0x43, 0x4F, 0x44, 0x45, 0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4F, 0x4E, 
-    0x4C, 0x59, 0x0D, 0x10, 0x4E, 0x09, 0x09, 0x09, 0x45, 0x4E, 0x44, 0x0D, 0x00, 0x3B, 0x09, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 
-    0x00, 0x3B, 0x0D, 0x13, 0x31, 0x2E, 0x30, 0x64, 0x34, 0x34, 0x10, 0x4E, 0x3B, 0x09, 0x46, 0x69, 
-    0x6C, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x25, 0x73, 0x20, 0x62, 0x79, 
-    0x20, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 
-    0x74, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x00, 
-    0x3B, 0x09, 0x44, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x65, 0x64, 0x69, 0x74, 0x20, 0x74, 0x68, 0x69, 
-    0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0D, 0x00, 0x3B, 0x0D, 0x10, 0xF0, 0x02, 0x02, 0x3B, 0x0D, 
-    0x0D, 0x0D, 0x10, 0x4E, 0x09, 0x09, 0x09, 0x41, 0x52, 0x45, 0x41, 0x09, 0x7C, 0x41, 0x41, 0x41, 
-    0x41, 0x7C, 0x2C, 0x20, 0x43, 0x4F, 0x44, 0x45, 0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4F, 0x4E, 
-    0x4C, 0x59, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x45, 0x4E, 0x54, 0x52, 0x59, 0x0D, 0x00, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x41, 0x52, 0x45, 0x41, 0x09, 0x7C, 0x43, 0x24, 0x24, 0x63, 0x6F, 0x64, 0x65, 
-    0x7C, 0x2C, 0x20, 0x43, 0x4F, 0x44, 0x45, 0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4F, 0x4E, 0x4C, 
-    0x59, 0x0D, 0x12, 0x0D, 0x00, 0x0D, 0x0D, 0x10, 0x22, 0x09, 0x09, 0x09, 0x41, 0x52, 0x45, 0x41, 
-    0x09, 0x7C, 0x43, 0x24, 0x24, 0x63, 0x6F, 0x64, 0x65, 0x7C, 0x2C, 0x20, 0x43, 0x4F, 0x44, 0x45, 
-    0x2C, 0x20, 0x52, 0x45, 0x41, 0x44, 0x4F, 0x4E, 0x4C, 0x59, 0x0D, 0x10, 0x50, 0x09, 0x09, 0x09, 
-    0x45, 0x4E, 0x44, 0x0D, 0x00, 0x54, 0x6F, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 
-    0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 
-    0x72, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 
-    0x27, 0x25, 0x73, 0x27, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 
-    0x20, 0x2D, 0x72, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x27, 0x64, 0x00, 0x2F, 0x2A, 0x10, 0x44, 0x25, 
-    0x73, 0x09, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x0D, 0x11, 0x2A, 0x2A, 0x15, 0x25, 0x73, 0x0D, 0x00, 0x31, 0x2E, 0x30, 0x64, 0x34, 
-    0x34, 0x11, 0x2A, 0x2A, 0x10, 0x34, 0x25, 0x73, 0x09, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x72, 
-    0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x25, 0x73, 0x20, 0x62, 0x79, 0x20, 0x50, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x76, 
-    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x11, 0x2A, 0x2A, 0x10, 0xF0, 0x06, 
-    0x02, 0x25, 0x73, 0x0D, 0x00, 0x2A, 0x2F, 0x25, 0x73, 0x0D, 0x00, 0x0D, 0x0D, 0x1F, 0x23, 0x69, 
-    0x66, 0x6E, 0x64, 0x65, 0x66, 0x20, 0x5F, 0x5F, 0x25, 0x73, 0x5F, 0x48, 0x0D, 0x23, 0x64, 0x65, 
-    0x66, 0x69, 0x6E, 0x65, 0x20, 0x5F, 0x5F, 0x25, 0x73, 0x5F, 0x48, 0x0D, 0x1B, 0x0D, 0x23, 0x69, 
-    0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x64, 0x65, 0x66, 0x2E, 0x68, 
-    0x3E, 0x0D, 0x0D, 0x10, 0x28, 0x23, 0x69, 0x66, 0x6E, 0x64, 0x65, 0x66, 0x20, 0x5F, 0x5F, 0x25, 
-    0x73, 0x5F, 0x48, 0x0D, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x0D, 0x23, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x0D, 0x0D, 0x00, 0x0D, 0x0D, 0x10, 0x6C, 0x0D, 
-    0x23, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x20, 0x2F, 0x2A, 0x20, 0x5F, 0x5F, 0x25, 0x73, 0x5F, 0x48, 
-    0x20, 0x2A, 0x2F, 0x0D, 0x00, 0x49, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 
-    0x66, 0x69, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 
-    0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x79, 0x6F, 
-    0x75, 0x72, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x49, 0x20, 0x64, 
-    0x69, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 
-    0x6E, 0x79, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x11, 0x2F, 0x2A, 0x10, 0x44, 
-    0x25, 0x73, 0x09, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x0D, 0x11, 0x2A, 0x2A, 0x15, 0x25, 0x73, 0x0D, 0x00, 0x31, 0x2E, 0x30, 0x64, 
-    0x34, 0x34, 0x11, 0x2A, 0x2A, 0x10, 0x34, 0x25, 0x73, 0x09, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x63, 
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x25, 0x73, 0x20, 0x62, 0x79, 0x20, 0x50, 0x72, 0x6F, 
-    0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 
-    0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x11, 0x2A, 0x2A, 0x13, 0x25, 
-    0x73, 0x0D, 0x00, 0x2A, 0x2F, 0x10, 0x42, 0x25, 0x73, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x23, 
-    0x69, 0x66, 0x6E, 0x64, 0x65, 0x66, 0x20, 0x5F, 0x5F, 0x25, 0x73, 0x5F, 0x48, 0x0D, 0x23, 0x69, 
-    0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x0D, 0x23, 0x65, 0x6E, 0x64, 
-    0x69, 0x66, 0x0D, 0x0D, 0x00, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x20, 0x3C, 0x73, 
-    0x74, 0x64, 0x6C, 0x69, 0x62, 0x2E, 0x68, 0x3E, 0x0D, 0x1A, 0x23, 0x69, 0x6E, 0x63, 0x6C, 0x75, 
-    0x64, 0x65, 0x20, 0x3C, 0x73, 0x74, 0x64, 0x61, 0x72, 0x67, 0x2E, 0x68, 0x3E, 0x0D, 0x10, 0x48, 
-    0x0D, 0x00, 0x0D, 0x00, 0x2F, 0x2A, 0x09, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x10, 0x70, 0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2A, 
-    0x09, 0x4C, 0x69, 0x62, 0x4D, 0x61, 0x69, 0x6E, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x20, 0x4D, 0x61, 
-    0x69, 0x6E, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x66, 
-    0x6F, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x0D, 0x00, 
-    0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x2A, 0x20, 0x4C, 
-    0x69, 0x62, 0x4D, 0x61, 0x69, 0x6E, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 
-    0x74, 0x6F, 0x72, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0D, 0x11, 0x7B, 0x0D, 0x10, 0xF0, 0x64, 
-    0x02, 0x09, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 
-    0x74, 0x6F, 0x72, 0x20, 0x29, 0x0D, 0x00, 0x09, 0x7B, 0x0D, 0x00, 0x09, 0x63, 0x61, 0x73, 0x65, 
-    0x20, 0x30, 0x3A, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x76, 0x6F, 0x69, 0x64, 
-    0x2A, 0x29, 0x30, 0x3B, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2F, 0x2F, 0x20, 0x6E, 0x6F, 0x20, 0x69, 
-    0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x61, 
-    0x64, 0x64, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6C, 
-    0x69, 0x6B, 0x65, 0x29, 0x0D, 0x09, 0x63, 0x61, 0x73, 0x65, 0x20, 0x31, 0x3A, 0x09, 0x72, 0x65, 
-    0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x2A, 0x29, 0x30, 0x3B, 0x09, 0x09, 
-    0x09, 0x09, 0x09, 0x2F, 0x2F, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 
-    0x30, 0x0D, 0x00, 0x09, 0x63, 0x61, 0x73, 0x65, 0x20, 0x32, 0x3A, 0x09, 0x72, 0x65, 0x74, 0x75, 
-    0x72, 0x6E, 0x20, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x2A, 0x29, 0x30, 0x3B, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x2F, 0x2F, 0x20, 0x61, 0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x79, 0x6F, 0x75, 
-    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x0D, 0x00, 0x09, 0x0D, 0x12, 0x09, 0x2F, 0x2A, 0x0D, 0x1E, 0x09, 
-    0x2A, 0x2A, 0x09, 0x59, 0x4F, 0x55, 0x20, 0x4D, 0x41, 0x49, 0x4E, 0x54, 0x41, 0x49, 0x4E, 0x20, 
-    0x54, 0x48, 0x49, 0x53, 0x3A, 0x0D, 0x00, 0x09, 0x2A, 0x2F, 0x0D, 0x10, 0x40, 0x09, 0x63, 0x61, 
-    0x73, 0x65, 0x20, 0x33, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x76, 0x6F, 
-    0x69, 0x64, 0x2A, 0x29, 0x20, 0x25, 0x64, 0x3B, 0x09, 0x09, 0x09, 0x09, 0x09, 0x2F, 0x2F, 0x20, 
-    0x23, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x65, 0x78, 0x70, 0x6F, 
-    0x72, 0x74, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0D, 0x00, 0x09, 0x0D, 0x10, 0x46, 0x09, 
-    0x63, 0x61, 0x73, 0x65, 0x20, 0x34, 0x3A, 0x09, 0x7B, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x09, 0x2F, 0x2F, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6E, 0x66, 0x6F, 
-    0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x4E, 0x74, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 
-    0x63, 0x6F, 0x6C, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x5F, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x61, 0x70, 0x3B, 0x0D, 0x1E, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x5F, 0x73, 0x74, 0x61, 
-    0x72, 0x74, 0x28, 0x61, 0x70, 0x2C, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x29, 
-    0x3B, 0x0D, 0x10, 0x3E, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x00, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 
-    0x20, 0x76, 0x61, 0x5F, 0x68, 0x61, 0x63, 0x6B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 
-    0x5F, 0x68, 0x61, 0x63, 0x6B, 0x28, 0x69, 0x6E, 0x74, 0x29, 0x3B, 0x09, 0x2F, 0x2F, 0x20, 0x43, 
-    0x46, 0x72, 0x6F, 0x6E, 0x74, 0x20, 0x62, 0x6F, 0x74, 0x63, 0x68, 0x20, 0x28, 0x41, 0x52, 0x4D, 
-    0x29, 0x0D, 0x10, 0x32, 0x23, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 
-    0x69, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x4E, 0x75, 0x6D, 0x62, 
-    0x65, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x5F, 0x61, 0x72, 0x67, 0x28, 0x61, 0x70, 0x2C, 0x20, 
-    0x69, 0x6E, 0x74, 0x29, 0x3B, 0x0D, 0x10, 0x3E, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x00, 0x09, 0x09, 
-    0x09, 0x09, 0x54, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x20, 0x2A, 0x20, 0x63, 
-    0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x73, 0x77, 0x69, 0x74, 
-    0x63, 0x68, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x4E, 0x75, 0x6D, 
-    0x62, 0x65, 0x72, 0x20, 0x29, 0x0D, 0x13, 0x09, 0x09, 0x09, 0x09, 0x7B, 0x0D, 0x10, 0x70, 0x09, 
-    0x09, 0x09, 0x09, 0x2F, 0x2A, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x2A, 0x2A, 0x09, 0x4D, 0x41, 
-    0x49, 0x4E, 0x54, 0x41, 0x49, 0x4E, 0x20, 0x45, 0x58, 0x50, 0x4F, 0x52, 0x54, 0x45, 0x44, 0x20, 
-    0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x53, 0x20, 0x48, 0x45, 0x52, 0x45, 0x3A, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x09, 0x2A, 0x2A, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x2A, 0x2F, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x63, 0x61, 0x73, 0x65, 0x20, 0x25, 0x64, 0x20, 0x3A, 0x09, 
-    0x63, 0x69, 0x20, 0x3D, 0x20, 0x25, 0x73, 0x20, 0x3A, 0x3A, 0x20, 0x43, 0x6C, 0x61, 0x73, 0x73, 
-    0x49, 0x6E, 0x66, 0x6F, 0x28, 0x29, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0D, 0x13, 
-    0x09, 0x09, 0x09, 0x09, 0x7D, 0x0D, 0x1B, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x09, 0x76, 0x61, 0x5F, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x70, 0x29, 0x3B, 0x0D, 0x10, 0x4C, 0x09, 
-    0x09, 0x09, 0x09, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
-    0x63, 0x69, 0x3B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x7D, 0x0D, 0x00, 0x09, 0x7D, 0x0D, 0x00, 0x0D, 
-    0x00, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x3B, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x09, 0x09, 0x09, 0x2F, 0x2F, 0x20, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x73, 
-    0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x0D, 0x00, 0x7D, 0x0D, 0x10, 0xF0, 0x02, 0x02, 0x0D, 
-    0x0D, 0x0D, 0x0D, 0x10, 0x5C, 0x49, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 
-    0x66, 0x69, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
-    0x73, 0x20, 0x69, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 
-    0x20, 0x73, 0x6F, 0x20, 0x49, 0x20, 0x64, 0x69, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x67, 0x65, 0x6E, 
-    0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
-    0x2E, 0x00, 0x1D, 0x09, 0x05, 0xFF, 0xFF, 0x44, 0x10, 0xFF, 0xFF, 0x44, 0x04, 0xFF, 0xFF, 0x47, 
-    0x52, 0xFF, 0xFF, 0x44, 0x02, 0xFF, 0xFF, 0x43, 0xF4, 0xFF, 0xFF, 0x47, 0x64, 0xFF, 0xFF, 0x43, 
-    0xF2, 0x00, 0x09, 0x07, 0x04, 0xFF, 0xFF, 0x43, 0xF0, 0xFF, 0xFF, 0x43, 0xEC, 0x15, 0x01, 0x8A, 
-    0xFF, 0xFF, 0x43, 0xEA, 0xFF, 0xFF, 0x43, 0xE6, 0x13, 0x01, 0xE2, 0xFF, 0xFF, 0x43, 0xE4, 0x00, 
-    0x09, 0x07, 0x01, 0xFF, 0xFF, 0x43, 0xE2, 0xFF, 0xFF, 0x43, 0xDA, 0x10, 0xF0, 0x0A, 0x13, 0x01, 
-    0xF2, 0xFF, 0xFF, 0x43, 0xD8, 0xFF, 0xFF, 0x43, 0xD2, 0x01, 0x92, 0xFF, 0xFF, 0x43, 0xD0, 0xFF, 
-    0xFF, 0x43, 0xC6, 0x01, 0x9A, 0xFF, 0xFF, 0x43, 0xC4, 0xFF, 0xFF, 0x43, 0xC0, 0x01, 0xA2, 0xFF, 
-    0xFF, 0x43, 0xBE, 0xFF, 0xFF, 0x43, 0xB4, 0x01, 0xAA, 0xFF, 0xFF, 0x43, 0xB2, 0xFF, 0xFF, 0x43, 
-    0xA6, 0x01, 0xB2, 0xFF, 0xFF, 0x43, 0xA4, 0xFF, 0xFF, 0x43, 0x98, 0x01, 0xBA, 0xFF, 0xFF, 0x43, 
-    0x96, 0xFF, 0xFF, 0x43, 0x86, 0x01, 0xBA, 0xFF, 0xFF, 0x43, 0x84, 0xFF, 0xFF, 0x43, 0x78, 0x01, 
-    0xC2, 0xFF, 0xFF, 0x43, 0x76, 0xFF, 0xFF, 0x43, 0x68, 0x01, 0xCA, 0xFF, 0xFF, 0x43, 0x66, 0xFF, 
-    0xFF, 0x43, 0x58, 0x01, 0xD2, 0xFF, 0xFF, 0x43, 0x56, 0xFF, 0xFF, 0x43, 0x48, 0x01, 0xDA, 0xFF, 
-    0xFF, 0x43, 0x46, 0xFF, 0xFF, 0x43, 0x32, 0x01, 0xC2, 0xFF, 0xFF, 0x43, 0x30, 0xFF, 0xFF, 0x43, 
-    0x1A, 0x01, 0xD2, 0xFF, 0xFF, 0x43, 0x18, 0xFF, 0xFF, 0x43, 0x02, 0x01, 0xDA, 0xFF, 0xFF, 0x43, 
-    0x00, 0xFF, 0xFF, 0x42, 0xF6, 0x01, 0xDA, 0xFF, 0xFF, 0x42, 0xF4, 0xFF, 0xFF, 0x42, 0xE8, 0x01, 
-    0xD2, 0xFF, 0xFF, 0x42, 0xE6, 0xFF, 0xFF, 0x42, 0xDA, 0x01, 0xDA, 0xFF, 0xFF, 0x42, 0xD8, 0xFF, 
-    0xFF, 0x42, 0xCE, 0x01, 0xFA, 0xFF, 0xFF, 0x42, 0xCC, 0xFF, 0xFF, 0x42, 0xC4, 0x13, 0x01, 0xEA, 
-    0xFF, 0xFF, 0x42, 0xC2, 0x00, 0x11, 0x07, 0x03, 0xFF, 0xFF, 0x42, 0xC0, 0xFF, 0xFF, 0x42, 0xBA, 
-    0xFF, 0xFF, 0x47, 0x58, 0xFF, 0xFF, 0x42, 0xB8, 0x33, 0x02, 0x02, 0xFF, 0xFF, 0x42, 0xB6, 0x40, 
-    0x26, 0xFF, 0xFF, 0x42, 0xB4, 0x30, 0x00, 0x44, 0x00, 0x73, 0x00, 0x2D, 0x62, 0x61, 0x73, 0x65, 
-    0x00, 0x6B, 0x00, 0x32, 0x00, 0x2D, 0x72, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x66, 0x00, 0x2D, 
-    0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x10, 0x7C, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 
-    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x68, 0x65, 
-    0x61, 0x64, 0x65, 0x72, 0x00, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x67, 0x6C, 0x75, 0x65, 
-    0x00, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 
-    0x00, 0x66, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x67, 0x6C, 0x75, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x63, 0x66, 0x69, 0x6C, 0x65, 0x10, 0x3E, 0x66, 0x00, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x66, 0x00, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 
-    0x67, 0x6C, 0x75, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 
-    0x65, 0x67, 0x6C, 0x75, 0x65, 0x1D, 0x66, 0x00, 0x2D, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x67, 
-    0x6C, 0x75, 0x65, 0x00, 0x66, 0x00, 0x2D, 0x6E, 0x6F, 0x6C, 0x69, 0x62, 0x6D, 0x61, 0x69, 0x6E, 
-    0x1E, 0x66, 0x00, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x66, 0x00, 0x2D, 
-    0x70, 0x70, 0x00, 0x66, 0x00, 0x2D, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x13, 0x66, 0x00, 
-    0x2D, 0x21, 0x64, 0x62, 0x18, 0x66, 0x00, 0x2D, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x00, 0x6B, 
-    0x00, 0x46, 0x00, 0x2D, 0x64, 0x12, 0x46, 0x00, 0x2D, 0x69, 0x10, 0x21, 0x6B, 0x00, 0x73, 0x00, 
-    0x2D, 0x70, 0x72, 0x65, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x00, 0x62, 0x00, 
-    0x2D, 0x65, 0x6D, 0x69, 0x74, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x00, 0x6B, 0x40, 0x09, 0x01, 
-    0xFF, 0xFF, 0x47, 0x30, 0xFF, 0xFF, 0x47, 0x2A, 0x1B, 0x01, 0x6A, 0xFF, 0xFF, 0x47, 0x28, 0xFF, 
-    0xFF, 0x47, 0x1E, 0xFF, 0xFF, 0x8B, 0xE0, 0xFF, 0xFF, 0x47, 0x1C, 0xFF, 0xFF, 0x47, 0x18, 0x10, 
-    0xF0, 0x2E, 0x02, 0x01, 0x82, 0xFF, 0xFF, 0x47, 0x16, 0xFF, 0xFF, 0x47, 0x12, 0xFF, 0xFF, 0x47, 
-    0x60, 0xFF, 0xFF, 0x47, 0x10, 0xFF, 0xFF, 0x47, 0x06, 0xFF, 0xFF, 0x47, 0x5C, 0xFF, 0xFF, 0x47, 
-    0x04, 0xFF, 0xFF, 0x46, 0xF8, 0xFF, 0xFF, 0x47, 0x54, 0xFF, 0xFF, 0x46, 0xF6, 0xFF, 0xFF, 0x46, 
-    0xEE, 0x02, 0x0A, 0xFF, 0xFF, 0x46, 0xEC, 0xFF, 0xFF, 0x46, 0xE0, 0xFF, 0xFF, 0x47, 0x52, 0xFF, 
-    0xFF, 0x46, 0xDE, 0xFF, 0xFF, 0x46, 0xD8, 0xFF, 0xFF, 0x47, 0x86, 0xFF, 0xFF, 0x46, 0xD6, 0xFF, 
-    0xFF, 0x46, 0xCE, 0xFF, 0xFF, 0x47, 0x76, 0xFF, 0xFF, 0x46, 0xCC, 0xFF, 0xFF, 0x46, 0xC4, 0x10, 
-    0xF0, 0x0A, 0x02, 0x01, 0x72, 0xFF, 0xFF, 0x46, 0xC2, 0xFF, 0xFF, 0x46, 0xBA, 0x01, 0x7A, 0xFF, 
-    0xFF, 0x46, 0xB8, 0xFF, 0xFF, 0x46, 0xA8, 0x10, 0x80, 0xA2, 0x02, 0x2A, 0xFF, 0xFF, 0x46, 0xA6, 
-    0xFF, 0xFF, 0x46, 0x98, 0xFF, 0xFF, 0x47, 0x64, 0xFF, 0xFF, 0x46, 0x96, 0xFF, 0xFF, 0x46, 0x8A, 
-    0xFF, 0xFF, 0x47, 0x50, 0xFF, 0xFF, 0x46, 0x88, 0xFF, 0xFF, 0x46, 0x78, 0xFF, 0xFF, 0x47, 0x50, 
-    0xFF, 0xFF, 0x46, 0x76, 0xFF, 0xFF, 0x46, 0x6A, 0xFF, 0xFF, 0x47, 0x48, 0xFF, 0xFF, 0x46, 0x68, 
-    0xFF, 0xFF, 0x46, 0x5A, 0xFF, 0xFF, 0x47, 0x4C, 0xFF, 0xFF, 0x46, 0x58, 0xFF, 0xFF, 0x46, 0x4A, 
-    0xFF, 0xFF, 0x47, 0x4A, 0xFF, 0xFF, 0x46, 0x48, 0xFF, 0xFF, 0x46, 0x34, 0xFF, 0xFF, 0x47, 0x48, 
-    0xFF, 0xFF, 0x46, 0x32, 0xFF, 0xFF, 0x46, 0x1C, 0xFF, 0xFF, 0x47, 0x4C, 0xFF, 0xFF, 0x46, 0x1A, 
-    0xFF, 0xFF, 0x46, 0x04, 0xFF, 0xFF, 0x47, 0x4A, 0xFF, 0xFF, 0x46, 0x02, 0xFF, 0xFF, 0x45, 0xF8, 
-    0xFF, 0xFF, 0x47, 0x48, 0xFF, 0xFF, 0x45, 0xF6, 0xFF, 0xFF, 0x45, 0xEA, 0xFF, 0xFF, 0x47, 0x4C, 
-    0xFF, 0xFF, 0x45, 0xE8, 0xFF, 0xFF, 0x45, 0xDC, 0xFF, 0xFF, 0x47, 0x4A, 0xFF, 0xFF, 0x45, 0xDA, 
-    0xFF, 0xFF, 0x45, 0xD0, 0xFF, 0xFF, 0x47, 0x46, 0xFF, 0xFF, 0x45, 0xCE, 0x00, 0x2D, 0x07, 0x03, 
-    0xFF, 0xFF, 0x45, 0xCC, 0xFF, 0xFF, 0x45, 0xC6, 0xFF, 0xFF, 0x47, 0x58, 0xFF, 0xFF, 0x45, 0xC4, 
-    0xFF, 0xFF, 0x45, 0xC0, 0xFF, 0xFF, 0x47, 0x32, 0xFF, 0xFF, 0x45, 0xBE, 0xFF, 0xFF, 0x45, 0xBA, 
-    0xFF, 0xFF, 0x47, 0x32, 0xFF, 0xFF, 0x45, 0xB8, 0xFF, 0xFF, 0x45, 0xB0, 0x13, 0x02, 0x1A, 0xFF, 
-    0xFF, 0x45, 0xAE, 0x33, 0x02, 0x22, 0xFF, 0xFF, 0x45, 0xAC, 0x48, 0xFF, 0xFF, 0x45, 0xAA, 0x30, 
-    0x00, 0x44, 0x00, 0x66, 0x00, 0x2D, 0x73, 0x74, 0x64, 0x69, 0x6E, 0x10, 0xF0, 0x04, 0x02, 0x73, 
-    0x00, 0x2D, 0x64, 0x73, 0x00, 0x2D, 0x69, 0x1A, 0x73, 0x00, 0x2D, 0x62, 0x61, 0x73, 0x65, 0x00, 
-    0x6B, 0x00, 0x62, 0x00, 0x2D, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x10, 0x7C, 0x62, 0x00, 
-    0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x00, 0x62, 0x00, 0x2D, 0x69, 
-    0x6D, 0x70, 0x6C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x62, 0x00, 0x2D, 0x69, 0x6D, 0x70, 
-    0x6C, 0x67, 0x6C, 0x75, 0x65, 0x00, 0x62, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 
-    0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x00, 0x62, 0x00, 
-    0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x68, 
-    0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x62, 0x00, 0x2D, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 
-    0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x67, 0x6C, 0x75, 0x65, 0x00, 0x62, 0x00, 0x2D, 0x73, 
-    0x65, 0x72, 0x76, 0x65, 0x72, 0x63, 0x66, 0x69, 0x6C, 0x65, 0x10, 0xF0, 0x2E, 0x02, 0x62, 0x00, 
-    0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x00, 0x62, 0x00, 
-    0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x67, 0x6C, 0x75, 0x65, 0x00, 0x62, 0x00, 0x2D, 0x69, 
-    0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x67, 0x6C, 0x75, 0x65, 0x62, 0x00, 0x2D, 0x63, 
-    0x6C, 0x69, 0x65, 0x6E, 0x74, 0x67, 0x6C, 0x75, 0x65, 0x00, 0x73, 0x00, 0x2D, 0x70, 0x72, 0x65, 
-    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x00, 0x46, 0x00, 0x2D, 0x74, 0x72, 0x75, 
-    0x65, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x66, 0x69, 0x6C, 0x65, 0x10, 0xF0, 0x08, 0x02, 0x66, 0x00, 
-    0x2D, 0x65, 0x6C, 0x76, 0x69, 0x73, 0x66, 0x00, 0x2D, 0x21, 0x65, 0x63, 0x68, 0x6F, 0x10, 0x36, 
-    0x62, 0x00, 0x2D, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x00, 0x73, 0x00, 0x2D, 0x64, 0x61, 0x74, 
-    0x65, 0x00, 0x62, 0x00, 0x2D, 0x65, 0x6D, 0x69, 0x74, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x00, 
-    0x32, 0x00, 0x2D, 0x72, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x62, 0x00, 0x2D, 0x6E, 0x6F, 0x6C, 
-    0x69, 0x62, 0x6D, 0x61, 0x69, 0x6E, 0x10, 0xF0, 0x10, 0x02, 0x62, 0x00, 0x2D, 0x61, 0x75, 0x74, 
-    0x6F, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x62, 0x00, 0x2D, 0x70, 0x66, 0x00, 0x2D, 0x70, 0x70, 0x00, 
-    0x62, 0x00, 0x2D, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x13, 0x66, 0x00, 0x2D, 0x21, 0x64, 
-    0x62, 0x10, 0x01, 0x6B, 0x00, 0x0D, 0x33, 0xFF, 0xFF, 0x47, 0x68, 0x43, 0x46, 0x72, 0x6F, 0x6E, 
-    0x74, 0x20, 0x2D, 0x65, 0x02, 0x0F, 0xFF, 0xFF, 0x47, 0x84, 0x12, 0xFF, 0xFF, 0x47, 0x8A, 0x07, 
-    0x84, 0x06, 0x69, 0x6C, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x2D, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 
-    0x10, 0x4C, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
-    0x20, 0x25, 0x64, 0x2C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x25, 0x64, 0x20, 
-    0x28, 0x25, 0x73, 0x29, 0x0D, 0x00, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 
-    0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x2C, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x69, 0x6E, 
-    0x67, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x0D, 0x16, 0x73, 
-    0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x10, 0x64, 0x79, 0x79, 0x64, 
-    0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x2C, 0x20, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 
-    0x68, 0x69, 0x66, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
-    0x20, 0x25, 0x64, 0x0D, 0x00, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x65, 0x72, 
-    0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x64, 0x69, 0x73, 
-    0x63, 0x61, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 
-    0x0D, 0x17, 0x69, 0x6C, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x2D, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 
-    0x10, 0x66, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
-    0x20, 0x25, 0x64, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 
-    0x65, 0x72, 0x79, 0x20, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x73, 0x20, 0x74, 0x6F, 0x6B, 
-    0x65, 0x6E, 0x20, 0x25, 0x64, 0x20, 0x28, 0x25, 0x73, 0x29, 0x0D, 0x00, 0x79, 0x79, 0x64, 0x65, 
-    0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x2C, 0x20, 0x72, 
-    0x65, 0x64, 0x75, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x79, 0x20, 0x72, 0x75, 0x6C, 0x65, 0x20, 
-    0x25, 0x64, 0x20, 0x28, 0x25, 0x73, 0x29, 0x0D, 0x10, 0x7C, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 
-    0x20, 0x49, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 
-    0x6E, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 
-    0x6C, 0x69, 0x7A, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x20, 0x28, 0x57, 0x68, 0x61, 0x74, 0x20, 0x69, 
-    0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 
-    0x61, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x61, 
-    0x6E, 0x79, 0x77, 0x61, 0x79, 0x3F, 0x29, 0x00, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 
-    0x66, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x25, 0x73, 
-    0x20, 0x3D, 0x20, 0x25, 0x64, 0x0D, 0x10, 0x22, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 
-    0x66, 0x20, 0x6F, 0x66, 0x20, 0x3C, 0x74, 0x79, 0x70, 0x65, 0x3E, 0x20, 0x28, 0x2A, 0x25, 0x73, 
-    0x29, 0x28, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x61, 0x73, 0x20, 0x10, 0x36, 0x0D, 0x00, 0x23, 0x20, 
-    0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x20, 0x61, 0x73, 
-    0x20, 0x00, 0x0D, 0x00, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x28, 0x3C, 
-    0x70, 0x74, 0x72, 0x3E, 0x20, 0x49, 0x44, 0x29, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x20, 0x61, 
-    0x73, 0x20, 0x10, 0x28, 0x0D, 0x00, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 
-    0x28, 0x3C, 0x70, 0x74, 0x72, 0x3E, 0x20, 0x49, 0x44, 0x20, 0x5B, 0x6E, 0x5D, 0x29, 0x20, 0x6F, 
-    0x66, 0x20, 0x25, 0x73, 0x5B, 0x25, 0x64, 0x5D, 0x20, 0x61, 0x73, 0x20, 0x10, 0x22, 0x0D, 0x00, 
-    0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x28, 0x49, 0x44, 0x20, 0x5B, 0x6E, 
-    0x5D, 0x29, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x5B, 0x25, 0x64, 0x5D, 0x20, 0x61, 0x73, 0x20, 
-    0x10, 0x7A, 0x0D, 0x00, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x00, 0x41, 0x20, 
-    0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x70, 
-    0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 
-    0x6F, 0x72, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 
-    0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x2E, 0x00, 
-    0x44, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 
-    0x73, 0x2C, 0x20, 0x70, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x2E, 0x2E, 0x10, 0x26, 0x23, 0x20, 
-    0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x74, 0x65, 
-    0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x27, 
-    0x25, 0x73, 0x27, 0x0D, 0x10, 0x58, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x69, 
-    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6D, 
-    0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 
-    0x73, 0x75, 0x62, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 
-    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 0x62, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x65, 
-    0x73, 0x20, 0x6F, 0x66, 0x20, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x10, 0x80, 
-    0xA4, 0x23, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x69, 
-    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 0x00, 0x54, 0x50, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x00, 0x41, 0x20, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 
-    0x6C, 0x79, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 
-    0x20, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x62, 0x79, 0x20, 0x74, 
-    0x68, 0x69, 0x73, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 
-    0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x2E, 0x00, 0x44, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x76, 
-    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x73, 0x2C, 0x20, 0x70, 0x6C, 0x65, 0x61, 
-    0x73, 0x65, 0x2E, 0x2E, 0x2E, 0x10, 0x80, 0xA8, 0x23, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 
-    0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 
-    0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 0x00, 0x6D, 0x6F, 
-    0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 
-    0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x73, 0x75, 0x62, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x65, 
-    0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 
-    0x62, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x54, 0x50, 0x72, 0x6F, 
-    0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x00, 0x23, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 
-    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 
-    0x6F, 0x6E, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 
-    0x10, 0x3E, 0x23, 0x20, 0x70, 0x72, 0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 
-    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x20, 0x25, 0x73, 
-    0x0D, 0x00, 0x23, 0x20, 0x70, 0x72, 0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x6F, 
-    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 0x52, 0x20, 0x25, 0x73, 0x0D, 
-    0x10, 0xF0, 0x4A, 0x02, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x50, 
-    0x53, 0x45, 0x55, 0x44, 0x4F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x20, 0x69, 0x6E, 0x6C, 0x69, 
-    0x6E, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6D, 
-    0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x20, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x53, 0x6F, 
-    0x72, 0x72, 0x79, 0x2C, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x50, 0x53, 0x45, 0x55, 0x44, 0x4F, 0x53, 
-    0x54, 0x41, 0x54, 0x49, 0x43, 0x20, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x61, 0x72, 
-    0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 
-    0x69, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x64, 0x65, 0x63, 0x6C, 
-    0x61, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x10, 0x74, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 
-    0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x64, 0x65, 0x63, 0x6C, 0x61, 
-    0x72, 0x65, 0x20, 0x27, 0x76, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6C, 0x27, 0x20, 0x6D, 0x65, 0x74, 
-    0x68, 0x6F, 0x64, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 
-    0x6F, 0x6C, 0x2E, 0x00, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x20, 
-    0x66, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x63, 0x6C, 0x61, 
-    0x73, 0x73, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x77, 
-    0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x1D, 0x4F, 
-    0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 
-    0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x10, 0x80, 0xB2, 0x4F, 0x70, 0x65, 0x72, 
-    0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 
-    0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x00, 0x4E, 0x65, 0x77, 0x28, 0x2E, 0x2E, 
-    0x2E, 0x29, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 
-    0x63, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 
-    0x65, 0x00, 0x23, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x20, 0x00, 0x0D, 0x00, 
-    0x4E, 0x65, 0x77, 0x28, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x62, 
-    0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
-    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4E, 0x65, 0x77, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x68, 
-    0x61, 0x76, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x61, 0x20, 0x63, 
-    0x68, 0x61, 0x72, 0x2A, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x10, 0x80, 
-    0xB8, 0x23, 0x20, 0x4E, 0x65, 0x77, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x20, 
-    0x00, 0x0D, 0x00, 0x59, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 
-    0x61, 0x64, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 0x20, 
-    0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 
-    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 
-    0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 
-    0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x73, 0x00, 0x23, 0x20, 0x4F, 0x70, 0x65, 
-    0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 
-    0x20, 0x20, 0x00, 0x0D, 0x00, 0x59, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 
-    0x79, 0x20, 0x61, 0x64, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 
-    0x6C, 0x65, 0x74, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 
-    0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x10, 0x28, 0x4F, 0x70, 0x65, 0x72, 0x61, 
-    0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 
-    0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 
-    0x65, 0x72, 0x73, 0x10, 0x20, 0x23, 0x20, 0x53, 0x65, 0x74, 0x48, 0x61, 0x73, 0x4F, 0x70, 0x65, 
-    0x72, 0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x6D, 0x65, 0x74, 0x68, 
-    0x6F, 0x64, 0x3A, 0x20, 0x20, 0x1D, 0x0D, 0x00, 0x23, 0x20, 0x4E, 0x4F, 0x4E, 0x56, 0x49, 0x52, 
-    0x54, 0x55, 0x41, 0x4C, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x25, 0x73, 0x0D, 
-    0x1C, 0x23, 0x20, 0x4E, 0x4F, 0x4E, 0x56, 0x49, 0x52, 0x54, 0x55, 0x41, 0x4C, 0x20, 0x6D, 0x65, 
-    0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x25, 0x73, 0x0D, 0x10, 0x81, 0x54, 0x43, 0x6F, 0x6E, 0x73, 
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x64, 0x6F, 0x65, 
-    0x73, 0x6E, 0x27, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 
-    0x63, 0x6F, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x64, 
-    0x20, 0x79, 0x6F, 0x75, 0x20, 0x66, 0x6F, 0x72, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x74, 0x79, 
-    0x70, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x72, 0x6F, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 
-    0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3F, 0x29, 0x00, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x6E, 
-    0x64, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x72, 
-    0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x20, 0x69, 0x6E, 
-    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 
-    0x20, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 0x2E, 0x00, 0x53, 0x6F, 
-    0x72, 0x72, 0x79, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 
-    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 
-    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 
-    0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 
-    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x47, 0x65, 0x6E, 
-    0x2E, 0x00, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 0x20, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x73, 
-    0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x74, 0x74, 
-    0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x64, 
-    0x65, 0x63, 0x6C, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x23, 0x20, 0x70, 0x72, 
-    0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x28, 0x29, 0x0D, 
-    0x10, 0xF0, 0x14, 0x03, 0x23, 0x20, 0x64, 0x65, 0x63, 0x6C, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6F, 
-    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x0D, 0x23, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 
-    0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x5B, 0x5D, 0x0D, 0x23, 0x20, 0x70, 0x72, 
-    0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x28, 0x29, 0x0D, 
-    0x10, 0x49, 0x5A, 0x65, 0x72, 0x6F, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x76, 0x65, 0x63, 0x74, 
-    0x6F, 0x72, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x20, 
-    0x20, 0x47, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x6F, 0x20, 
-    0x58, 0x33, 0x4A, 0x31, 0x31, 0x20, 0x2D, 0x2D, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x6F, 0x6E, 
-    0x65, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x68, 0x61, 0x73, 0x2E, 0x01, 0x03, 0x25, 0x64, 0x10, 
-    0x32, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6E, 
-    0x75, 0x6D, 0x20, 0x25, 0x73, 0x0D, 0x00, 0x54, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 
-    0x27, 0x25, 0x73, 0x27, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x66, 0x69, 
-    0x6E, 0x65, 0x64, 0x10, 0x2E, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x6F, 
-    0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x25, 0x73, 0x0D, 0x00, 0x23, 0x20, 0x74, 
-    0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 
-    0x25, 0x73, 0x0D, 0x1B, 0x23, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x6F, 0x66, 
-    0x20, 0x75, 0x6E, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x0D, 0x20, 0x26, 0x44, 0x69, 0x76, 0x69, 
-    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x79, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2E, 0x20, 0x20, 0x59, 
-    0x6F, 0x75, 0x20, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6D, 0x69, 0x6E, 
-    0x64, 0x2E, 0x10, 0x5A, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x6F, 0x20, 0x62, 0x79, 0x20, 0x7A, 0x65, 
-    0x72, 0x6F, 0x2E, 0x20, 0x20, 0x59, 0x6F, 0x75, 0x20, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x6F, 0x6E, 
-    0x65, 0x20, 0x74, 0x75, 0x72, 0x6E, 0x2E, 0x00, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x6E, 
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 
-    0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x00, 0x23, 0x20, 0x55, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 
-    0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 0x10, 0x3C, 
-    0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x72, 
-    0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x69, 
-    0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x30, 0x20, 
-    0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x0D, 0x17, 0x69, 0x6C, 0x6C, 
-    0x65, 0x67, 0x61, 0x6C, 0x2D, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x10, 0x80, 0xC2, 0x79, 0x79, 
-    0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x2C, 
-    0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x25, 0x64, 0x20, 0x28, 0x25, 0x73, 0x29, 
-    0x0D, 0x00, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 
-    0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x68, 0x69, 0x66, 
-    0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 
-    0x25, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x25, 0x64, 0x0D, 0x00, 
-    0x79, 0x61, 0x63, 0x63, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 
-    0x6C, 0x6F, 0x77, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x3B, 0x20, 0x00, 
-    0x4C, 0x69, 0x6E, 0x65, 0x20, 0x25, 0x64, 0x20, 0x23, 0x23, 0x23, 0x20, 0x25, 0x73, 0x0D, 0x00, 
-    0x46, 0x69, 0x6C, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x3B, 0x20, 0x00, 0x4C, 0x69, 0x6E, 0x65, 
-    0x20, 0x25, 0x64, 0x20, 0x23, 0x23, 0x23, 0x20, 0x77, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x3A, 
-    0x20, 0x00, 0x0D, 0x00, 0x45, 0x4F, 0x46, 0x20, 0x69, 0x6E, 0x20, 0x7B, 0x2E, 0x2E, 0x2E, 0x7D, 
-    0x17, 0x55, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x45, 0x4F, 0x46, 0x1C, 
-    0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x43, 0x54, 0x52, 0x4C, 0x2D, 0x25, 0x63, 0xA5, 0x00, 0xA5, 0x74, 
-    0x6F, 0x6B, 0x3D, 0x27, 0x25, 0x63, 0x27, 0xA5, 0x17, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x50, 0x52, 
-    0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0xA5, 0x10, 0x20, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x4D, 0x4F, 
-    0x4E, 0x49, 0x54, 0x4F, 0x52, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x50, 0x53, 0x45, 0x55, 
-    0x44, 0x4F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0xA5, 0x19, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x43, 
-    0x41, 0x50, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x49, 0x45, 0x53, 0xA5, 0x1D, 0xA5, 0x74, 0x6F, 
-    0x6B, 0x3D, 0x54, 0x59, 0x50, 0x45, 0x44, 0x45, 0x46, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 
-    0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0xA5, 0x10, 0x22, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x55, 0x4E, 
-    0x49, 0x4F, 0x4E, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x43, 0x4C, 0x41, 0x53, 0x53, 0xA5, 
-    0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x43, 0x48, 0x41, 0x52, 0xA5, 0x10, 0x20, 0xA5, 0x74, 0x6F, 
-    0x6B, 0x3D, 0x49, 0x4E, 0x54, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x53, 0x48, 0x4F, 0x52, 
-    0x54, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x4C, 0x4F, 0x4E, 0x47, 0xA5, 0x16, 0xA5, 0x74, 
-    0x6F, 0x6B, 0x3D, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0xA5, 0x17, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 
-    0x55, 0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0xA5, 0x15, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x56, 
-    0x4F, 0x49, 0x44, 0xA5, 0x1C, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0xA5, 
-    0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0xA5, 0x10, 0x2A, 0xA5, 
-    0x74, 0x6F, 0x6B, 0x3D, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 
-    0x6B, 0x3D, 0x50, 0x52, 0x4F, 0x54, 0x45, 0x43, 0x54, 0x45, 0x44, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 
-    0x6B, 0x3D, 0x45, 0x58, 0x54, 0x45, 0x52, 0x4E, 0xA5, 0x16, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x53, 
-    0x54, 0x41, 0x54, 0x49, 0x43, 0xA5, 0x15, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x45, 0x4E, 0x55, 0x4D, 
-    0xA5, 0x16, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x49, 0x4E, 0x4C, 0x49, 0x4E, 0x45, 0xA5, 0x1D, 0xA5, 
-    0x74, 0x6F, 0x6B, 0x3D, 0x56, 0x49, 0x52, 0x54, 0x55, 0x41, 0x4C, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 
-    0x6B, 0x3D, 0x46, 0x52, 0x49, 0x45, 0x4E, 0x44, 0xA5, 0x17, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x4F, 
-    0x50, 0x45, 0x52, 0x41, 0x54, 0x4F, 0x52, 0xA5, 0x1B, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x4E, 0x45, 
-    0x57, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0xA5, 0x10, 
-    0xF0, 0x0C, 0x02, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x50, 0x41, 0x53, 0x43, 0x41, 0x4C, 0xA5, 0xA5, 
-    0x74, 0x6F, 0x6B, 0x3D, 0x44, 0x4F, 0x55, 0x42, 0x4C, 0x45, 0xA5, 0x1B, 0xA5, 0x74, 0x6F, 0x6B, 
-    0x3D, 0x46, 0x4C, 0x4F, 0x41, 0x54, 0xA5, 0x00, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x22, 0x25, 0x73, 
-    0x22, 0xA5, 0x14, 0xA5, 0x74, 0x6F, 0x6B, 0x3D, 0x25, 0x64, 0xA5, 0x10, 0x22, 0x45, 0x4F, 0x46, 
-    0x20, 0x65, 0x6E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 
-    0x2F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2A, 0x2F, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x10, 
-    0x36, 0x23, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x22, 0x25, 0x73, 0x22, 0x0D, 
-    0x00, 0x23, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x28, 0x62, 0x75, 0x74, 0x20, 
-    0x69, 0x67, 0x6E, 0x6F, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x6C, 0x79, 
-    0x29, 0x20, 0x22, 0x25, 0x73, 0x22, 0x0D, 0x10, 0x38, 0x6D, 0x69, 0x73, 0x2D, 0x66, 0x6F, 0x72, 
-    0x6D, 0x65, 0x64, 0x20, 0x65, 0x6C, 0x6C, 0x69, 0x70, 0x73, 0x65, 0x73, 0x00, 0x6D, 0x69, 0x73, 
-    0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x65, 0x6C, 0x6C, 0x69, 0x70, 0x73, 0x65, 0x73, 
-    0x00, 0x42, 0x61, 0x64, 0x20, 0x6F, 0x63, 0x74, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 
-    0x72, 0x1E, 0x5F, 0x00, 0x7E, 0x28, 0x29, 0x2C, 0x3A, 0x3B, 0x7B, 0x7D, 0x2A, 0x2F, 0x26, 0x2E, 
-    0x5B, 0x5D, 0x40, 0x21, 0x25, 0x5E, 0x2D, 0x2B, 0x3D, 0x2E, 0x3C, 0x3E, 0x7C, 0x5C, 0x1B, 0x42, 
-    0x61, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x00, 0xFF, 0xFF, 0xEB, 
-    0x76, 0xFF, 0xFF, 0x5C, 0xCE, 0x10, 0xF0, 0x06, 0x23, 0x01, 0x01, 0xFF, 0xFF, 0x5C, 0xC6, 0x01, 
-    0x02, 0xFF, 0xFF, 0x5C, 0xB8, 0x01, 0x03, 0xFF, 0xFF, 0x5C, 0xAC, 0x01, 0x03, 0xFF, 0xFF, 0x5C, 
-    0x9E, 0x01, 0x04, 0xFF, 0xFF, 0x5C, 0x8E, 0x01, 0x05, 0xFF, 0xFF, 0x5C, 0x7E, 0x01, 0x05, 0xFF, 
-    0xFF, 0x5C, 0x76, 0x01, 0x08, 0xFF, 0xFF, 0x5C, 0x6E, 0x01, 0x09, 0xFF, 0xFF, 0x5C, 0x68, 0x01, 
-    0x0A, 0xFF, 0xFF, 0x5C, 0x62, 0x01, 0x0B, 0xFF, 0xFF, 0x5C, 0x5C, 0x01, 0x0C, 0xFF, 0xFF, 0x5C, 
-    0x58, 0x01, 0x0E, 0xFF, 0xFF, 0x5C, 0x52, 0x01, 0x0D, 0xFF, 0xFF, 0x5C, 0x4C, 0x01, 0x0F, 0xFF, 
-    0xFF, 0x5C, 0x44, 0x01, 0x10, 0xFF, 0xFF, 0x5C, 0x3A, 0x01, 0x11, 0xFF, 0xFF, 0x5C, 0x34, 0x01, 
-    0x12, 0xFF, 0xFF, 0x5C, 0x2E, 0x01, 0x15, 0xFF, 0xFF, 0x5C, 0x26, 0x01, 0x16, 0xFF, 0xFF, 0x5C, 
-    0x1E, 0x01, 0x17, 0xFF, 0xFF, 0x5C, 0x14, 0x01, 0x18, 0xFF, 0xFF, 0x5C, 0x0C, 0x01, 0x1B, 0xFF, 
-    0xFF, 0x5C, 0x04, 0x01, 0x1C, 0xFF, 0xFF, 0x5B, 0xFE, 0x01, 0x1D, 0xFF, 0xFF, 0x5B, 0xF6, 0x01, 
-    0x1F, 0xFF, 0xFF, 0x5B, 0xEE, 0x01, 0x29, 0xFF, 0xFF, 0x5B, 0xE6, 0x01, 0x2A, 0xFF, 0xFF, 0x5B, 
-    0xDC, 0x01, 0x2B, 0xFF, 0xFF, 0x5B, 0xD8, 0x01, 0x2C, 0xFF, 0xFF, 0x5B, 0xD0, 0x01, 0x2D, 0xFF, 
-    0xFF, 0x5B, 0xC8, 0x01, 0x2E, 0xFF, 0xFF, 0x5B, 0xC0, 0x01, 0x13, 0xFF, 0xFF, 0x5B, 0xBA, 0x01, 
-    0x14, 0xFF, 0xFF, 0x5B, 0xB0, 0x01, 0x14, 0xFF, 0xFF, 0x5B, 0xA6, 0x19, 0x01, 0x2F, 0xFF, 0xFF, 
-    0x5B, 0x9C, 0xFF, 0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0x5B, 0x90, 0xFF, 0xFF, 0xFC, 0x19, 0x4A, 0x5F, 
-    0x5F, 0x5F, 0x74, 0x6F, 0x70, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x00, 0x72, 0x65, 0x67, 0x69, 0x73, 
-    0x74, 0x65, 0x72, 0x10, 0xF0, 0x08, 0x02, 0x76, 0x6F, 0x6C, 0x61, 0x74, 0x69, 0x6C, 0x65, 0x65, 
-    0x78, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x16, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x00, 0x64, 0x6F, 
-    0x75, 0x62, 0x6C, 0x65, 0x10, 0xF0, 0x06, 0x02, 0x70, 0x61, 0x73, 0x63, 0x61, 0x6C, 0x64, 0x65, 
-    0x6C, 0x65, 0x74, 0x65, 0x16, 0x6E, 0x65, 0x77, 0x00, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 
-    0x72, 0x13, 0x66, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x17, 0x76, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6C, 
-    0x00, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x12, 0x65, 0x6E, 0x75, 0x6D, 0x10, 0xF0, 0x06, 0x02, 
-    0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6E, 0x1C, 0x70, 0x72, 0x6F, 
-    0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x00, 0x70, 
-    0x75, 0x62, 0x6C, 0x69, 0x63, 0x15, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x00, 0x76, 0x6F, 0x69, 0x64, 
-    0x14, 0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x13, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 
-    0x12, 0x6C, 0x6F, 0x6E, 0x67, 0x17, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x00, 0x69, 0x6E, 0x74, 0x00, 
-    0x63, 0x68, 0x61, 0x72, 0x19, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x00, 0x75, 0x6E, 0x69, 0x6F, 0x6E, 
-    0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x1B, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x00, 
-    0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 0x52, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x1E, 0x50, 
-    0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x00, 0x43, 
-    0x41, 0x50, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x49, 0x45, 0x53, 0x15, 0x4E, 0x4F, 0x4E, 0x56, 
-    0x49, 0x52, 0x54, 0x55, 0x41, 0x4C, 0x16, 0x50, 0x53, 0x45, 0x55, 0x44, 0x4F, 0x53, 0x54, 0x41, 
-    0x54, 0x49, 0x43, 0x18, 0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 0x52, 0x00, 0x50, 0x52, 0x4F, 0x54, 
-    0x4F, 0x43, 0x4F, 0x4C, 0x00, 0x01, 0x05, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x83, 0x34, 0xAF, 
-    0x04, 0xFF, 0xFF, 0xA9, 0x32, 0xFF, 0xFF, 0xA9, 0x28, 0xFF, 0xFF, 0xA9, 0x0E, 0xFF, 0xFF, 0xA8, 
-    0xEC, 0xFF, 0xFF, 0xA8, 0xC4, 0xFF, 0xFF, 0xA8, 0xA4, 0xFF, 0xFF, 0xA8, 0x9E, 0xFF, 0xFF, 0xA8, 
-    0x72, 0xFF, 0xFF, 0xA8, 0x4A, 0xFF, 0xFF, 0xA8, 0x30, 0xFF, 0xFF, 0xA7, 0xFE, 0xFF, 0xFF, 0xA7, 
-    0xDC, 0xFF, 0xFF, 0xA7, 0xBC, 0xFF, 0xFF, 0xA7, 0x94, 0xFF, 0xFF, 0xA7, 0x56, 0xFF, 0xFF, 0xA7, 
-    0x20, 0xFF, 0xFF, 0xA7, 0x0C, 0xFF, 0xFF, 0xA6, 0xDE, 0xFF, 0xFF, 0xA6, 0xC0, 0xFF, 0xFF, 0xA6, 
-    0xB0, 0xFF, 0xFF, 0xA6, 0x94, 0xFF, 0xFF, 0xA6, 0x70, 0xFF, 0xFF, 0xA6, 0x36, 0xFF, 0xFF, 0xA6, 
-    0x04, 0xFF, 0xFF, 0xA5, 0xFE, 0xFF, 0xFF, 0xA5, 0x92, 0xFF, 0xFF, 0xA5, 0x8C, 0xFF, 0xFF, 0xA5, 
-    0x22, 0xFF, 0xFF, 0xA4, 0xF6, 0xFF, 0xFF, 0xA4, 0xCC, 0xFF, 0xFF, 0xA4, 0x9A, 0xFF, 0xFF, 0xA4, 
-    0x58, 0xFF, 0xFF, 0xA4, 0x40, 0xFF, 0xFF, 0xA4, 0x30, 0xFF, 0xFF, 0xA4, 0x08, 0xFF, 0xFF, 0xA3, 
-    0xF8, 0xFF, 0xFF, 0xA3, 0xD2, 0xFF, 0xFF, 0xA3, 0xBE, 0xFF, 0xFF, 0xA3, 0xAC, 0xFF, 0xFF, 0xA3, 
-    0x82, 0xFF, 0xFF, 0xA3, 0x6A, 0xFF, 0xFF, 0xA3, 0x52, 0xFF, 0xFF, 0xA3, 0x38, 0xFF, 0xFF, 0xA3, 
-    0x02, 0xFF, 0xFF, 0xA2, 0xD0, 0xFF, 0xFF, 0xA2, 0xBC, 0xFF, 0xFF, 0xA2, 0xA8, 0xFF, 0xFF, 0xA2, 
-    0x9A, 0xFF, 0xFF, 0xA2, 0x90, 0xFF, 0xFF, 0xA2, 0x6A, 0xFF, 0xFF, 0xA2, 0x56, 0xFF, 0xFF, 0xA2, 
-    0x44, 0xFF, 0xFF, 0xA2, 0x32, 0xFF, 0xFF, 0xA2, 0x18, 0xFF, 0xFF, 0xA1, 0xFE, 0xFF, 0xFF, 0xA1, 
-    0xD4, 0xFF, 0xFF, 0xA1, 0xAA, 0xFF, 0xFF, 0xA1, 0x80, 0xFF, 0xFF, 0xA1, 0x56, 0xFF, 0xFF, 0xA1, 
-    0x2E, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xA0, 0x90, 0xFF, 0xFF, 0xA0, 0x38, 0xFF, 0xFF, 0x9F, 
-    0xE4, 0xFF, 0xFF, 0x9F, 0xCC, 0xFF, 0xFF, 0x9F, 0x92, 0xFF, 0xFF, 0x9F, 0x5C, 0xFF, 0xFF, 0x9F, 
-    0x12, 0xFF, 0xFF, 0x9F, 0x06, 0xFF, 0xFF, 0x9E, 0xF4, 0xFF, 0xFF, 0x9E, 0xD2, 0xFF, 0xFF, 0x9E, 
-    0xA8, 0xFF, 0xFF, 0x9E, 0x70, 0xFF, 0xFF, 0x9E, 0x38, 0xFF, 0xFF, 0x9D, 0xE8, 0xFF, 0xFF, 0x9D, 
-    0xB4, 0xFF, 0xFF, 0x9D, 0x92, 0xFF, 0xFF, 0x9D, 0x70, 0xFF, 0xFF, 0x9D, 0x36, 0xFF, 0xFF, 0x9C, 
-    0xFE, 0xFF, 0xFF, 0x9C, 0xCC, 0xFF, 0xFF, 0x9C, 0xA4, 0xFF, 0xFF, 0x9C, 0x82, 0xFF, 0xFF, 0x9C, 
-    0x64, 0xFF, 0xFF, 0x9C, 0x4E, 0xFF, 0xFF, 0x9C, 0x22, 0xFF, 0xFF, 0x9B, 0xF8, 0xFF, 0xFF, 0x9B, 
-    0xB8, 0xFF, 0xFF, 0x9B, 0x8E, 0xFF, 0xFF, 0x9B, 0x64, 0xFF, 0xFF, 0x9B, 0x42, 0xFF, 0xFF, 0x9B, 
-    0x34, 0xFF, 0xFF, 0x9B, 0x10, 0xFF, 0xFF, 0x9B, 0x04, 0xFF, 0xFF, 0x9A, 0xE8, 0xFF, 0xFF, 0x9A, 
-    0xDC, 0xFF, 0xFF, 0x9A, 0xCC, 0xFF, 0xFF, 0x9A, 0xA6, 0xFF, 0xFF, 0x9A, 0x74, 0xFF, 0xFF, 0x9A, 
-    0x40, 0xFF, 0xFF, 0x9A, 0x02, 0xFF, 0xFF, 0x99, 0xEE, 0xFF, 0xFF, 0x99, 0xD6, 0xFF, 0xFF, 0x99, 
-    0xAE, 0xFF, 0xFF, 0x99, 0x86, 0xFF, 0xFF, 0x99, 0x78, 0xFF, 0xFF, 0x99, 0x3E, 0xFF, 0xFF, 0x99, 
-    0x2A, 0xFF, 0xFF, 0x99, 0x1C, 0xFF, 0xFF, 0x99, 0x06, 0xFF, 0xFF, 0x98, 0xDC, 0xFF, 0xFF, 0x98, 
-    0xCE, 0xFF, 0xFF, 0x98, 0xBA, 0xFF, 0xFF, 0x98, 0xA6, 0xFF, 0xFF, 0x98, 0x8E, 0xFF, 0xFF, 0x98, 
-    0x7C, 0xFF, 0xFF, 0x98, 0x68, 0xFF, 0xFF, 0x98, 0x22, 0xFF, 0xFF, 0x97, 0xE2, 0xFF, 0xFF, 0x97, 
-    0xB2, 0xFF, 0xFF, 0x97, 0xA0, 0xFF, 0xFF, 0x97, 0x84, 0xFF, 0xFF, 0x97, 0x6E, 0xFF, 0xFF, 0x97, 
-    0x60, 0xFF, 0xFF, 0x97, 0x4A, 0xFF, 0xFF, 0x97, 0x3C, 0xFF, 0xFF, 0x97, 0x24, 0xFF, 0xFF, 0x97, 
-    0x12, 0xFF, 0xFF, 0x96, 0xFA, 0xFF, 0xFF, 0x96, 0xE0, 0xFF, 0xFF, 0x96, 0xCE, 0xFF, 0xFF, 0x96, 
-    0xB4, 0xFF, 0xFF, 0x96, 0x98, 0xFF, 0xFF, 0x96, 0x88, 0xFF, 0xFF, 0x96, 0x70, 0xFF, 0xFF, 0x96, 
-    0x56, 0xFF, 0xFF, 0x96, 0x40, 0xFF, 0xFF, 0x96, 0x22, 0xFF, 0xFF, 0x96, 0x02, 0xFF, 0xFF, 0x95, 
-    0xE4, 0xFF, 0xFF, 0x95, 0xC4, 0xFF, 0xFF, 0x95, 0xB2, 0xFF, 0xFF, 0x95, 0x9C, 0xFF, 0xFF, 0x95, 
-    0x84, 0xFF, 0xFF, 0x95, 0x6A, 0xFF, 0xFF, 0x95, 0x4E, 0xFF, 0xFF, 0x95, 0x30, 0xFF, 0xFF, 0x95, 
-    0x1E, 0xFF, 0xFF, 0x95, 0x0A, 0xFF, 0xFF, 0x94, 0xF2, 0xFF, 0xFF, 0x94, 0xE0, 0xFF, 0xFF, 0x94, 
-    0xC6, 0xFF, 0xFF, 0x94, 0xB0, 0xFF, 0xFF, 0x94, 0x92, 0xFF, 0xFF, 0x94, 0x74, 0xFF, 0xFF, 0x94, 
-    0x64, 0xFF, 0xFF, 0x94, 0x4A, 0xFF, 0xFF, 0x94, 0x2E, 0xFF, 0xFF, 0x94, 0x0E, 0xFF, 0xFF, 0x94, 
-    0x04, 0xFF, 0xFF, 0x93, 0xF0, 0xFF, 0xFF, 0x93, 0xD2, 0xFF, 0xFF, 0x93, 0xBA, 0xFF, 0xFF, 0x93, 
-    0x94, 0xFF, 0xFF, 0x93, 0x82, 0xFF, 0xFF, 0x93, 0x66, 0xFF, 0xFF, 0x93, 0x52, 0xFF, 0xFF, 0x93, 
-    0x42, 0xFF, 0xFF, 0x93, 0x28, 0xFF, 0xFF, 0x93, 0x18, 0xFF, 0xFF, 0x92, 0xFC, 0xFF, 0xFF, 0x92, 
-    0xEA, 0xFF, 0xFF, 0x92, 0xCC, 0xFF, 0xFF, 0x92, 0xB2, 0xFF, 0xFF, 0x92, 0x8A, 0xFF, 0xFF, 0x92, 
-    0x64, 0xFF, 0xFF, 0x92, 0x48, 0xFF, 0xFF, 0x92, 0x18, 0xFF, 0xFF, 0x91, 0xEA, 0xFF, 0xFF, 0x91, 
-    0xBA, 0xFF, 0xFF, 0x91, 0x8C, 0xFF, 0xFF, 0x91, 0x70, 0xFF, 0xFF, 0x91, 0x46, 0xFF, 0xFF, 0x91, 
-    0x1C, 0xFF, 0xFF, 0x90, 0xFA, 0xFF, 0xFF, 0x90, 0xC6, 0xFF, 0xFF, 0x90, 0x92, 0xFF, 0xFF, 0x90, 
-    0x76, 0xFF, 0xFF, 0x90, 0x44, 0xFF, 0xFF, 0x90, 0x12, 0xFF, 0xFF, 0x8F, 0xE8, 0xFF, 0xFF, 0x8F, 
-    0xD4, 0xFF, 0xFF, 0x8F, 0xBC, 0xFF, 0xFF, 0x8F, 0xA4, 0xFF, 0xFF, 0x8F, 0x8C, 0xFF, 0xFF, 0x8F, 
-    0x74, 0xFF, 0xFF, 0x8F, 0x4A, 0xFF, 0xFF, 0x8F, 0x2C, 0xFF, 0xFF, 0x8F, 0x1A, 0xFF, 0xFF, 0x8F, 
-    0x04, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 
-    0x49, 0x46, 0x49, 0x45, 0x52, 0x18, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x20, 0x3A, 0x20, 
-    0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x1E, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x20, 0x3A, 
-    0x20, 0x27, 0x28, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x20, 
-    0x27, 0x29, 0x27, 0x10, 0x40, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x20, 0x3A, 0x20, 0x27, 
-    0x28, 0x27, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x27, 0x29, 0x27, 0x20, 0x27, 0x28, 0x27, 0x20, 
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x20, 0x27, 0x29, 0x27, 0x00, 0x63, 
-    0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x3A, 0x20, 0x27, 0x7E, 0x27, 0x20, 0x63, 0x65, 
-    0x5F, 0x74, 0x65, 0x72, 0x6D, 0x10, 0xF0, 0x16, 0x03, 0x63, 0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 
-    0x79, 0x20, 0x3A, 0x20, 0x27, 0x21, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x63, 
-    0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x3A, 0x20, 0x27, 0x2B, 0x27, 0x20, 0x63, 0x65, 
-    0x5F, 0x74, 0x65, 0x72, 0x6D, 0x63, 0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x3A, 0x20, 
-    0x27, 0x2D, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x19, 0x63, 0x65, 0x5F, 0x75, 
-    0x6E, 0x61, 0x72, 0x79, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x74, 0x65, 0x72, 0x6D, 0x10, 0x28, 
-    0x63, 0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 
-    0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x27, 0x25, 0x27, 0x20, 
-    0x63, 0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x10, 0xF0, 0x30, 0x02, 0x63, 0x65, 0x5F, 0x74, 
-    0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3A, 0x20, 0x63, 
-    0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x27, 0x2F, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x74, 
-    0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x63, 0x65, 0x5F, 0x74, 
-    0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3A, 0x20, 0x63, 
-    0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x27, 0x2A, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x74, 
-    0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x10, 0x4E, 0x63, 0x65, 
-    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3A, 
-    0x20, 0x63, 0x65, 0x5F, 0x75, 0x6E, 0x61, 0x72, 0x79, 0x00, 0x63, 0x65, 0x5F, 0x70, 0x6C, 0x75, 
-    0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x74, 0x69, 0x6D, 
-    0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x27, 0x2D, 0x27, 0x20, 0x63, 
-    0x65, 0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x10, 0x32, 0x63, 0x65, 
-    0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x3A, 0x20, 0x63, 0x65, 
-    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x27, 
-    0x2B, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 
-    0x10, 0x20, 0x63, 0x65, 0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 
-    0x3A, 0x20, 0x63, 0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x5F, 0x64, 0x69, 0x76, 0x5F, 0x6D, 
-    0x6F, 0x64, 0x10, 0x6E, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x20, 0x3A, 
-    0x20, 0x63, 0x65, 0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x52, 
-    0x53, 0x48, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x00, 0x63, 0x65, 
-    0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x70, 0x6C, 
-    0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x4C, 0x53, 0x48, 0x20, 0x63, 0x65, 0x5F, 
-    0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x00, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 
-    0x73, 0x68, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x70, 0x6C, 0x75, 0x73, 0x5F, 0x6D, 0x69, 0x6E, 
-    0x75, 0x73, 0x10, 0xF0, 0x5C, 0x02, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 
-    0x74, 0x5F, 0x67, 0x65, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 
-    0x68, 0x20, 0x47, 0x45, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 
-    0x5F, 0x67, 0x65, 0x00, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 
-    0x67, 0x65, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x20, 
-    0x27, 0x3E, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 
-    0x67, 0x65, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 
-    0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x20, 0x4C, 0x45, 
-    0x20, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x00, 
-    0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x20, 0x3A, 
-    0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x20, 0x27, 0x3C, 0x27, 0x20, 
-    0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x10, 0x80, 
-    0xA0, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x20, 
-    0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x73, 0x68, 0x5F, 0x72, 0x73, 0x68, 0x00, 0x63, 0x65, 0x5F, 
-    0x65, 0x71, 0x5F, 0x6E, 0x65, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 
-    0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x20, 0x4E, 0x45, 0x20, 0x63, 0x65, 0x5F, 0x65, 0x71, 0x5F, 
-    0x6E, 0x65, 0x00, 0x63, 0x65, 0x5F, 0x65, 0x71, 0x5F, 0x6E, 0x65, 0x20, 0x3A, 0x20, 0x63, 0x65, 
-    0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 0x74, 0x5F, 0x67, 0x65, 0x20, 0x45, 0x51, 0x45, 
-    0x51, 0x20, 0x63, 0x65, 0x5F, 0x65, 0x71, 0x5F, 0x6E, 0x65, 0x00, 0x63, 0x65, 0x5F, 0x65, 0x71, 
-    0x5F, 0x6E, 0x65, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6C, 0x74, 0x5F, 0x6C, 0x65, 0x5F, 0x67, 
-    0x74, 0x5F, 0x67, 0x65, 0x00, 0x63, 0x65, 0x5F, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x20, 0x63, 0x65, 
-    0x5F, 0x65, 0x71, 0x5F, 0x6E, 0x65, 0x20, 0x27, 0x26, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x61, 0x6E, 
-    0x64, 0x10, 0x2C, 0x63, 0x65, 0x5F, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x65, 
-    0x71, 0x5F, 0x6E, 0x65, 0x00, 0x63, 0x65, 0x5F, 0x78, 0x6F, 0x72, 0x20, 0x3A, 0x20, 0x63, 0x65, 
-    0x5F, 0x61, 0x6E, 0x64, 0x20, 0x27, 0x5E, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x78, 0x6F, 0x72, 0x10, 
-    0x28, 0x63, 0x65, 0x5F, 0x78, 0x6F, 0x72, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x61, 0x6E, 0x64, 
-    0x00, 0x63, 0x65, 0x5F, 0x6F, 0x72, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x78, 0x6F, 0x72, 0x20, 
-    0x27, 0x7C, 0x27, 0x20, 0x63, 0x65, 0x5F, 0x6F, 0x72, 0x17, 0x63, 0x65, 0x5F, 0x6F, 0x72, 0x20, 
-    0x3A, 0x20, 0x63, 0x65, 0x5F, 0x78, 0x6F, 0x72, 0x19, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 
-    0x78, 0x70, 0x72, 0x20, 0x3A, 0x20, 0x63, 0x65, 0x5F, 0x6F, 0x72, 0x10, 0x2C, 0x63, 0x6F, 0x6E, 
-    0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x63, 0x6F, 
-    0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x00, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 
-    0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x10, 0x3C, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 
-    0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 
-    0x52, 0x20, 0x27, 0x3D, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 
-    0x00, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 
-    0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x10, 0x30, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 0x20, 
-    0x3A, 0x20, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x65, 0x6E, 0x75, 
-    0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x00, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 0x20, 0x3A, 0x20, 
-    0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x14, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 
-    0x20, 0x3A, 0x1F, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 0x20, 0x27, 
-    0x7B, 0x27, 0x20, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x27, 0x7D, 
-    0x27, 0x1D, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 0x20, 0x27, 0x7B, 
-    0x27, 0x20, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x32, 0x20, 0x27, 0x7D, 0x27, 0x10, 0x46, 0x65, 0x6E, 
-    0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x65, 0x6E, 
-    0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x00, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 
-    0x79, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x00, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 
-    0x73, 0x65, 0x6D, 0x69, 0x5F, 0x6F, 0x72, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 0x3A, 
-    0x20, 0x27, 0x7B, 0x27, 0x1E, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x65, 0x6D, 
-    0x69, 0x5F, 0x6F, 0x72, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x20, 0x3A, 0x20, 0x27, 0x3B, 
-    0x27, 0x1A, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 
-    0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x1C, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x62, 
-    0x72, 0x61, 0x63, 0x65, 0x73, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x27, 0x7B, 0x27, 0x18, 
-    0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x56, 0x4F, 0x49, 0x44, 
-    0x10, 0x2A, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x4C, 0x4F, 
-    0x4E, 0x47, 0x20, 0x44, 0x4F, 0x55, 0x42, 0x4C, 0x45, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 
-    0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x44, 0x4F, 0x55, 0x42, 0x4C, 0x45, 0x10, 0x80, 0x92, 0x62, 
-    0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x46, 0x4C, 0x4F, 0x41, 0x54, 
-    0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 0x4E, 0x53, 
-    0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x4C, 0x4F, 0x4E, 0x47, 0x20, 0x49, 0x4E, 0x54, 0x00, 0x62, 
-    0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x49, 0x47, 0x4E, 0x45, 
-    0x44, 0x20, 0x4C, 0x4F, 0x4E, 0x47, 0x20, 0x49, 0x4E, 0x54, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 
-    0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 
-    0x4C, 0x4F, 0x4E, 0x47, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 
-    0x20, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x4C, 0x4F, 0x4E, 0x47, 0x00, 0x62, 0x61, 0x73, 
-    0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x4C, 0x4F, 0x4E, 0x47, 0x20, 0x49, 0x4E, 
-    0x54, 0x18, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x4C, 0x4F, 
-    0x4E, 0x47, 0x1F, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 
-    0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x20, 0x49, 0x4E, 
-    0x54, 0x1E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x49, 
-    0x47, 0x4E, 0x45, 0x44, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x20, 0x49, 0x4E, 0x54, 0x1F, 0x62, 
-    0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 
-    0x20, 0x55, 0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x49, 0x4E, 0x54, 0x1E, 0x62, 0x61, 
-    0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x20, 
-    0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x49, 0x4E, 0x54, 0x10, 0x2E, 0x62, 0x61, 0x73, 0x65, 
-    0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x20, 0x49, 0x4E, 
-    0x54, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 0x4E, 
-    0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x49, 0x4E, 0x54, 0x1B, 0x62, 0x61, 0x73, 0x65, 0x5F, 
-    0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x49, 0x4E, 
-    0x54, 0x10, 0x2A, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x49, 
-    0x4E, 0x54, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 
-    0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x1C, 0x62, 0x61, 
-    0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 
-    0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x10, 0x54, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 
-    0x65, 0x20, 0x3A, 0x20, 0x53, 0x48, 0x4F, 0x52, 0x54, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 
-    0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x55, 0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x43, 
-    0x48, 0x41, 0x52, 0x00, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 
-    0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x20, 0x43, 0x48, 0x41, 0x52, 0x00, 0x62, 0x61, 0x73, 0x65, 
-    0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x43, 0x48, 0x41, 0x52, 0x10, 0x80, 0x8C, 0x70, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x20, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x00, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x3A, 
-    0x20, 0x27, 0x26, 0x27, 0x00, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x3A, 0x20, 0x70, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x27, 0x26, 0x27, 0x00, 0x70, 0x6F, 0x69, 0x6E, 0x74, 
-    0x65, 0x72, 0x20, 0x3A, 0x20, 0x27, 0x2A, 0x27, 0x00, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x20, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x27, 0x2A, 0x27, 0x00, 0x69, 
-    0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 
-    0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x00, 0x69, 0x64, 0x65, 0x6E, 0x74, 
-    0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x10, 0x80, 0xB4, 0x74, 0x79, 
-    0x70, 0x65, 0x33, 0x20, 0x3A, 0x20, 0x55, 0x4E, 0x49, 0x4F, 0x4E, 0x20, 0x69, 0x64, 0x65, 0x6E, 
-    0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 
-    0x65, 0x64, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x5F, 0x6F, 0x70, 0x74, 0x00, 0x74, 0x79, 
-    0x70, 0x65, 0x33, 0x20, 0x3A, 0x20, 0x43, 0x4C, 0x41, 0x53, 0x53, 0x20, 0x49, 0x44, 0x45, 0x4E, 
-    0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 
-    0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 
-    0x65, 0x64, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x5F, 0x6F, 0x70, 0x74, 0x00, 0x74, 0x79, 
-    0x70, 0x65, 0x33, 0x20, 0x3A, 0x20, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x20, 0x69, 0x64, 0x65, 
-    0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x75, 0x70, 0x65, 
-    0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x20, 
-    0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x5F, 0x6F, 
-    0x70, 0x74, 0x19, 0x74, 0x79, 0x70, 0x65, 0x33, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 
-    0x49, 0x46, 0x49, 0x45, 0x52, 0x10, 0x28, 0x74, 0x79, 0x70, 0x65, 0x33, 0x20, 0x3A, 0x20, 0x62, 
-    0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x00, 0x74, 0x79, 0x70, 0x65, 0x32, 0x20, 0x3A, 
-    0x20, 0x56, 0x4F, 0x4C, 0x41, 0x54, 0x49, 0x4C, 0x45, 0x20, 0x74, 0x79, 0x70, 0x65, 0x33, 0x10, 
-    0x80, 0x96, 0x74, 0x79, 0x70, 0x65, 0x32, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x33, 0x20, 
-    0x43, 0x4F, 0x4E, 0x53, 0x54, 0x00, 0x74, 0x79, 0x70, 0x65, 0x32, 0x20, 0x3A, 0x20, 0x43, 0x4F, 
-    0x4E, 0x53, 0x54, 0x20, 0x74, 0x79, 0x70, 0x65, 0x33, 0x00, 0x74, 0x79, 0x70, 0x65, 0x32, 0x20, 
-    0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x33, 0x00, 0x74, 0x79, 0x70, 0x65, 0x31, 0x20, 0x3A, 0x20, 
-    0x45, 0x4E, 0x55, 0x4D, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 
-    0x6F, 0x70, 0x74, 0x20, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x6F, 0x70, 
-    0x74, 0x00, 0x74, 0x79, 0x70, 0x65, 0x31, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x32, 0x20, 
-    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x74, 0x79, 0x70, 0x65, 0x31, 0x20, 0x3A, 0x20, 
-    0x74, 0x79, 0x70, 0x65, 0x32, 0x00, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x50, 0x41, 0x53, 
-    0x43, 0x41, 0x4C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x10, 0x38, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 
-    0x20, 0x74, 0x79, 0x70, 0x65, 0x31, 0x20, 0x27, 0x28, 0x27, 0x20, 0x27, 0x2A, 0x27, 0x20, 0x69, 
-    0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x29, 
-    0x27, 0x20, 0x27, 0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 
-    0x29, 0x27, 0x16, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x31, 0x10, 
-    0xF0, 0x26, 0x02, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 
-    0x61, 0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x27, 0x3D, 0x27, 0x20, 0x49, 
-    0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
-    0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 
-    0x20, 0x27, 0x3D, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x10, 
-    0x80, 0x9C, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 
-    0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x00, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 
-    0x73, 0x74, 0x20, 0x3A, 0x20, 0x45, 0x4C, 0x4C, 0x49, 0x50, 0x53, 0x45, 0x53, 0x00, 0x61, 0x72, 
-    0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 
-    0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
-    0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 
-    0x2C, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x61, 0x72, 0x67, 0x5F, 
-    0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 
-    0x75, 0x6C, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 
-    0x74, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x10, 0x30, 
-    0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 
-    0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 
-    0x6C, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 
-    0x10, 0x40, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 
-    0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x61, 0x72, 0x67, 0x5F, 0x76, 0x61, 
-    0x6C, 0x75, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x00, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x3A, 0x20, 0x56, 0x4F, 0x49, 0x44, 0x00, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x3A, 0x1D, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3A, 0x20, 0x27, 
-    0x40, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x10, 0x3C, 0x70, 
-    0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3A, 0x00, 0x76, 0x65, 0x63, 0x74, 0x6F, 
-    0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x27, 0x5B, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 
-    0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x5D, 0x27, 0x00, 0x76, 
-    0x65, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x10, 0x74, 0x73, 0x75, 0x70, 
-    0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x00, 0x73, 
-    0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 
-    0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 0x45, 0x20, 0x49, 0x44, 
-    0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x00, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 
-    0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 
-    0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 
-    0x52, 0x10, 0x3E, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 
-    0x73, 0x74, 0x5F, 0x32, 0x20, 0x3A, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 
-    0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x32, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x73, 0x75, 0x70, 
-    0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x10, 0x28, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 
-    0x73, 0x74, 0x5F, 0x32, 0x20, 0x3A, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 
-    0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x10, 0x80, 0x80, 0x73, 0x75, 
-    0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x6F, 0x70, 
-    0x74, 0x20, 0x3A, 0x20, 0x27, 0x3A, 0x27, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 0x6C, 0x61, 
-    0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x32, 0x00, 0x73, 0x75, 0x70, 0x65, 0x72, 0x63, 
-    0x6C, 0x61, 0x73, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x00, 
-    0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 
-    0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x27, 0x3B, 0x27, 0x00, 0x74, 0x6F, 
-    0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 
-    0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x45, 0x58, 0x54, 0x45, 0x52, 0x4E, 0x10, 0x58, 
-    0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 
-    0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x45, 0x58, 0x54, 0x45, 0x52, 0x4E, 
-    0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x00, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 
-    0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 
-    0x3A, 0x20, 0x45, 0x58, 0x54, 0x45, 0x52, 0x4E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 
-    0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x10, 0x80, 0x92, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 
-    0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 
-    0x66, 0x66, 0x20, 0x3A, 0x20, 0x45, 0x58, 0x54, 0x45, 0x52, 0x4E, 0x20, 0x53, 0x54, 0x52, 0x49, 
-    0x4E, 0x47, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 
-    0x45, 0x52, 0x00, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 
-    0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x45, 0x58, 0x54, 
-    0x45, 0x52, 0x4E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x27, 0x28, 
-    0x27, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x00, 0x74, 0x6F, 0x70, 
-    0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 
-    0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x10, 0x20, 0x74, 
-    0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 
-    0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x49, 0x4E, 0x4C, 0x49, 0x4E, 0x45, 0x10, 
-    0x32, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 
-    0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x70, 
-    0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x5F, 0x69, 0x64, 0x20, 
-    0x27, 0x28, 0x27, 0x10, 0x4E, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 
-    0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x74, 
-    0x79, 0x70, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 0x65, 
-    0x73, 0x69, 0x7A, 0x65, 0x64, 0x5F, 0x69, 0x64, 0x20, 0x27, 0x5B, 0x27, 0x20, 0x63, 0x6F, 0x6E, 
-    0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x5D, 0x27, 0x20, 
-    0x27, 0x3B, 0x27, 0x10, 0x81, 0x22, 0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 
-    0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 
-    0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 
-    0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x5F, 0x69, 0x64, 0x20, 0x27, 0x3B, 0x27, 0x00, 0x74, 0x6F, 
-    0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 
-    0x73, 0x74, 0x75, 0x66, 0x66, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x70, 0x74, 
-    0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x5F, 0x69, 
-    0x64, 0x20, 0x27, 0x28, 0x27, 0x00, 0x6F, 0x70, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
-    0x68, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x5F, 0x69, 0x64, 0x20, 0x3A, 0x20, 0x27, 0x28, 0x27, 
-    0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x29, 0x27, 0x00, 
-    0x6F, 0x70, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x69, 0x7A, 0x65, 
-    0x64, 0x5F, 0x69, 0x64, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 
-    0x52, 0x00, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x43, 0x4F, 
-    0x4E, 0x53, 0x54, 0x00, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x00, 
-    0x6D, 0x65, 0x74, 0x68, 0x5F, 0x6E, 0x6F, 0x74, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 0x20, 0x3A, 0x20, 
-    0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 
-    0x27, 0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x29, 0x27, 
-    0x20, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 
-    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x7B, 0x27, 0x10, 0x34, 0x6D, 0x65, 0x74, 0x68, 0x5F, 0x6E, 
-    0x6F, 0x74, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 0x20, 0x3A, 0x20, 0x27, 0x7E, 0x27, 0x20, 0x49, 0x44, 
-    0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x27, 0x29, 0x27, 
-    0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x3B, 0x27, 0x10, 0x50, 
-    0x6D, 0x65, 0x74, 0x68, 0x5F, 0x6E, 0x6F, 0x74, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 0x20, 0x3A, 0x20, 
-    0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x61, 
-    0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x29, 0x27, 0x20, 0x70, 0x6C, 0x61, 0x63, 
-    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x3B, 0x27, 0x00, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 
-    0x20, 0x3A, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x5F, 0x6E, 0x6F, 0x74, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 
-    0x10, 0x52, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x3A, 0x20, 0x50, 0x53, 0x45, 0x55, 0x44, 
-    0x4F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 
-    0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 
-    0x27, 0x29, 0x27, 0x20, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x69, 0x67, 
-    0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x65, 0x6D, 0x69, 0x5F, 0x6F, 0x72, 0x5F, 0x62, 0x72, 
-    0x61, 0x63, 0x65, 0x73, 0x10, 0x81, 0x1C, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x3A, 0x20, 
-    0x50, 0x53, 0x45, 0x55, 0x44, 0x4F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x20, 0x74, 0x79, 0x70, 
-    0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 
-    0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x29, 0x27, 0x20, 0x43, 0x4F, 
-    0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 
-    0x73, 0x65, 0x6D, 0x69, 0x5F, 0x6F, 0x72, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x00, 0x6D, 
-    0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x3A, 0x20, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x20, 0x74, 
-    0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 
-    0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x29, 0x27, 0x20, 
-    0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 
-    0x65, 0x6E, 0x74, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x5F, 0x73, 0x65, 0x6D, 0x69, 
-    0x5F, 0x6F, 0x72, 0x5F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x00, 0x6D, 0x65, 0x74, 0x68, 0x6F, 
-    0x64, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 
-    0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 0x74, 
-    0x20, 0x27, 0x29, 0x27, 0x20, 0x43, 0x4F, 0x4E, 0x53, 0x54, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x70, 
-    0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x3B, 0x27, 0x00, 0x66, 0x69, 0x65, 
-    0x6C, 0x64, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 
-    0x46, 0x49, 0x45, 0x52, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 
-    0x27, 0x3B, 0x27, 0x10, 0xF0, 0x28, 0x04, 0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 
-    0x3A, 0x20, 0x27, 0x28, 0x27, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x20, 0x6F, 0x70, 0x74, 
-    0x5F, 0x64, 0x6F, 0x74, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x20, 0x27, 0x29, 0x27, 0x73, 
-    0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x27, 0x28, 0x27, 0x20, 0x4E, 0x55, 
-    0x4D, 0x42, 0x45, 0x52, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x64, 0x6F, 0x74, 0x20, 0x53, 0x54, 0x52, 
-    0x49, 0x4E, 0x47, 0x20, 0x27, 0x29, 0x27, 0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 
-    0x3A, 0x20, 0x27, 0x28, 0x27, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x20, 0x6F, 0x70, 0x74, 
-    0x5F, 0x64, 0x6F, 0x74, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x20, 0x27, 0x29, 0x27, 0x73, 
-    0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x27, 0x28, 0x27, 0x20, 0x53, 0x54, 
-    0x52, 0x49, 0x4E, 0x47, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x64, 0x6F, 0x74, 0x20, 0x53, 0x54, 0x52, 
-    0x49, 0x4E, 0x47, 0x20, 0x27, 0x29, 0x27, 0x10, 0x80, 0x90, 0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 
-    0x65, 0x6D, 0x20, 0x3A, 0x20, 0x27, 0x28, 0x27, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x20, 
-    0x27, 0x29, 0x27, 0x00, 0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x27, 
-    0x28, 0x27, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x20, 0x27, 0x29, 0x27, 0x00, 0x73, 0x69, 
-    0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x00, 
-    0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 
-    0x47, 0x00, 0x73, 0x69, 0x67, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 0x20, 0x73, 0x69, 0x67, 
-    0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x00, 0x73, 0x69, 0x67, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 
-    0x20, 0x73, 0x69, 0x67, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x6F, 0x70, 0x74, 0x5F, 0x64, 0x6F, 
-    0x74, 0x20, 0x73, 0x69, 0x67, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x10, 0x2A, 0x6F, 0x70, 0x74, 0x5F, 
-    0x64, 0x6F, 0x74, 0x20, 0x3A, 0x00, 0x6F, 0x70, 0x74, 0x5F, 0x64, 0x6F, 0x74, 0x20, 0x3A, 0x20, 
-    0x27, 0x2E, 0x27, 0x00, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 
-    0x46, 0x52, 0x49, 0x45, 0x4E, 0x44, 0x10, 0x44, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x20, 0x3A, 0x20, 0x56, 0x49, 0x52, 0x54, 0x55, 0x41, 0x4C, 0x00, 0x62, 0x6F, 0x64, 0x79, 
-    0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x27, 0x7E, 0x27, 0x20, 0x49, 0x44, 0x45, 0x4E, 
-    0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x27, 0x29, 0x27, 0x20, 0x70, 
-    0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x7B, 0x27, 0x10, 0x7E, 0x62, 0x6F, 
-    0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 
-    0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x28, 0x27, 0x20, 0x61, 0x72, 0x67, 0x5F, 0x6C, 0x69, 0x73, 
-    0x74, 0x20, 0x27, 0x29, 0x27, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 
-    0x27, 0x7B, 0x27, 0x00, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 
-    0x50, 0x52, 0x4F, 0x54, 0x45, 0x43, 0x54, 0x45, 0x44, 0x20, 0x27, 0x3A, 0x27, 0x00, 0x62, 0x6F, 
-    0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x50, 0x52, 0x49, 0x56, 0x41, 0x54, 
-    0x45, 0x20, 0x27, 0x3A, 0x27, 0x00, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 
-    0x3A, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x20, 0x27, 0x3A, 0x27, 0x10, 0x4E, 0x62, 0x6F, 
-    0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x43, 0x41, 0x50, 0x41, 0x42, 0x49, 
-    0x4C, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20, 0x27, 0x28, 0x27, 0x20, 0x73, 0x69, 0x67, 0x5F, 0x62, 
-    0x6F, 0x64, 0x79, 0x20, 0x27, 0x29, 0x27, 0x00, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x20, 0x3A, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 
-    0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x10, 0x34, 0x6D, 0x6F, 
-    0x6E, 0x69, 0x74, 0x6F, 0x72, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 0x20, 0x6D, 0x6F, 0x6E, 
-    0x69, 0x74, 0x6F, 0x72, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 
-    0x6C, 0x65, 0x6D, 0x00, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x5F, 0x62, 0x6F, 0x64, 0x79, 
-    0x20, 0x3A, 0x10, 0x4E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x62, 0x6F, 0x64, 
-    0x79, 0x20, 0x3A, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x62, 0x6F, 0x64, 
-    0x79, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x00, 0x70, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x3A, 0x00, 0x70, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x6F, 0x70, 0x74, 
-    0x20, 0x3A, 0x10, 0x40, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x76, 0x65, 0x72, 
-    0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x56, 0x45, 0x52, 0x53, 0x49, 
-    0x4F, 0x4E, 0x20, 0x27, 0x28, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 
-    0x72, 0x20, 0x27, 0x2E, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 
-    0x20, 0x27, 0x29, 0x27, 0x10, 0x80, 0x86, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x5F, 
-    0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x56, 0x45, 
-    0x52, 0x53, 0x49, 0x4F, 0x4E, 0x20, 0x27, 0x28, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 
-    0x65, 0x78, 0x70, 0x72, 0x20, 0x27, 0x29, 0x27, 0x00, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x67, 0x65, 0x6E, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x20, 0x3A, 0x20, 0x4D, 0x4F, 0x4E, 0x49, 
-    0x54, 0x4F, 0x52, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 
-    0x3B, 0x27, 0x00, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x67, 0x65, 0x6E, 0x5F, 0x64, 
-    0x65, 0x63, 0x6C, 0x20, 0x3A, 0x20, 0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x20, 0x49, 
-    0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x3B, 0x27, 0x10, 0x81, 0x70, 
-    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x67, 0x65, 0x6E, 0x5F, 0x64, 0x65, 0x63, 0x6C, 
-    0x20, 0x3A, 0x20, 0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 0x52, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 
-    0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x3A, 0x27, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 
-    0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x70, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x6F, 0x70, 0x74, 
-    0x20, 0x27, 0x7B, 0x27, 0x20, 0x24, 0x24, 0x33, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 
-    0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x27, 0x7D, 0x27, 0x00, 0x24, 0x24, 0x33, 0x20, 0x3A, 0x00, 
-    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x67, 0x65, 0x6E, 0x5F, 0x64, 0x65, 0x63, 0x6C, 
-    0x20, 0x3A, 0x20, 0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x20, 0x49, 0x44, 0x45, 0x4E, 
-    0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x3A, 0x27, 0x20, 0x50, 0x55, 0x42, 0x4C, 0x49, 
-    0x43, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x70, 0x72, 0x6F, 
-    0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x5F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x6F, 0x70, 
-    0x74, 0x20, 0x27, 0x7B, 0x27, 0x20, 0x24, 0x24, 0x32, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 
-    0x6F, 0x6C, 0x5F, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x27, 0x7D, 0x27, 0x00, 0x24, 0x24, 0x32, 0x20, 
-    0x3A, 0x00, 0x61, 0x75, 0x67, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 
-    0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x5B, 0x27, 
-    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 
-    0x27, 0x5D, 0x27, 0x00, 0x61, 0x75, 0x67, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x20, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x44, 0x45, 0x4E, 
-    0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x5B, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
-    0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x5D, 0x27, 0x00, 0x61, 0x75, 
-    0x67, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x70, 0x6F, 
-    0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 
-    0x1D, 0x61, 0x75, 0x67, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 
-    0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x17, 0x74, 0x79, 0x70, 0x65, 
-    0x64, 0x65, 0x66, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x1E, 0x74, 0x79, 0x70, 0x65, 0x64, 
-    0x65, 0x66, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x61, 0x75, 0x67, 0x5F, 0x74, 0x79, 
-    0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x10, 0x80, 0xDC, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 
-    0x66, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 
-    0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x61, 0x75, 0x67, 0x5F, 0x74, 0x79, 
-    0x70, 0x65, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x00, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 
-    0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x00, 0x69, 0x64, 0x5F, 0x64, 
-    0x65, 0x63, 0x6C, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 
-    0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x5B, 0x27, 0x20, 0x63, 
-    0x6F, 0x6E, 0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x5D, 
-    0x27, 0x00, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 
-    0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x44, 
-    0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x5B, 0x27, 0x20, 0x63, 0x6F, 0x6E, 
-    0x73, 0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6F, 0x70, 0x74, 0x20, 0x27, 0x5D, 0x27, 0x00, 
-    0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 
-    0x6D, 0x20, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x49, 0x44, 0x45, 0x4E, 
-    0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x1F, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 
-    0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3A, 0x20, 0x49, 0x44, 0x45, 0x4E, 0x54, 
-    0x49, 0x46, 0x49, 0x45, 0x52, 0x10, 0x20, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 
-    0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 0x69, 
-    0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x10, 0x72, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 
-    0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x3A, 0x20, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 0x5F, 
-    0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x2C, 0x27, 0x20, 0x69, 0x64, 0x5F, 0x64, 0x65, 0x63, 0x6C, 
-    0x5F, 0x6C, 0x69, 0x73, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x00, 0x63, 0x6C, 0x61, 0x75, 0x73, 
-    0x65, 0x20, 0x3A, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x67, 0x65, 0x6E, 0x5F, 
-    0x64, 0x65, 0x63, 0x6C, 0x00, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x20, 0x3A, 0x20, 0x45, 0x58, 
-    0x54, 0x45, 0x52, 0x4E, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x20, 0x27, 0x7B, 0x27, 0x20, 
-    0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 0x27, 0x7D, 0x27, 0x10, 0x2A, 0x63, 0x6C, 0x61, 
-    0x75, 0x73, 0x65, 0x20, 0x3A, 0x20, 0x54, 0x59, 0x50, 0x45, 0x44, 0x45, 0x46, 0x20, 0x74, 0x79, 
-    0x70, 0x65, 0x20, 0x24, 0x24, 0x31, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x5F, 0x6C, 
-    0x69, 0x73, 0x74, 0x20, 0x27, 0x3B, 0x27, 0x10, 0x24, 0x24, 0x24, 0x31, 0x20, 0x3A, 0x00, 0x63, 
-    0x6C, 0x61, 0x75, 0x73, 0x65, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x64, 0x5F, 
-    0x64, 0x65, 0x63, 0x6C, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x27, 0x3B, 0x27, 0x10, 0x48, 0x63, 
-    0x6C, 0x61, 0x75, 0x73, 0x65, 0x20, 0x3A, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x49, 0x44, 0x45, 
-    0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 0x20, 0x27, 0x3D, 0x27, 0x20, 0x63, 0x6F, 0x6E, 0x73, 
-    0x74, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x00, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x20, 0x3A, 0x20, 
-    0x74, 0x6F, 0x70, 0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x5F, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 
-    0x64, 0x5F, 0x73, 0x74, 0x75, 0x66, 0x66, 0x1C, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 
-    0x3A, 0x20, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x20, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 
-    0x10, 0x20, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 0x20, 0x3A, 0x00, 0x24, 0x61, 0x63, 0x63, 
-    0x65, 0x70, 0x74, 0x20, 0x3A, 0x20, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 0x00, 0xFF, 0xFF, 
-    0xAF, 0xC4, 0x02, 0x80, 0x80, 0xFF, 0xFF, 0xAF, 0xC0, 0x64, 0xFF, 0xFF, 0xAF, 0xBC, 0xFF, 0xFF, 
-    0xAF, 0xB8, 0x20, 0x20, 0xFF, 0xFF, 0xAF, 0xB4, 0xFF, 0xFF, 0xAF, 0xB0, 0xFF, 0xFF, 0xAF, 0xAC, 
-    0xFF, 0xFF, 0xAF, 0xA8, 0xFF, 0xFF, 0xAF, 0xA4, 0xFF, 0xFF, 0xAF, 0xA0, 0xFF, 0xFF, 0xAF, 0x9C, 
-    0xFF, 0xFF, 0xAF, 0x98, 0x0A, 0x28, 0xFF, 0xFF, 0xAF, 0x94, 0xFF, 0xFF, 0xAF, 0x90, 0xFF, 0xFF, 
-    0xAF, 0x8C, 0xFF, 0xFF, 0xAF, 0x88, 0xFF, 0xFF, 0xAF, 0x84, 0x22, 0xFF, 0xFF, 0xAF, 0x80, 0x02, 
-    0x68, 0xFF, 0xFF, 0xAF, 0x7C, 0x24, 0xFF, 0xFF, 0xAF, 0x78, 0xFF, 0xFF, 0xAF, 0x74, 0x08, 0x70, 
-    0xFF, 0xFF, 0xAF, 0x70, 0xFF, 0xFF, 0xAF, 0x6C, 0xFF, 0xFF, 0xAF, 0x68, 0xFF, 0xFF, 0xAF, 0x64, 
-    0x00, 0x80, 0xC4, 0x82, 0x08, 0xFF, 0xFF, 0xAF, 0x5A, 0xFF, 0xFF, 0xAF, 0x52, 0xFF, 0xFF, 0xAF, 
-    0x44, 0xFF, 0xFF, 0xAF, 0x36, 0xFF, 0xFF, 0xAF, 0x2E, 0xFF, 0xFF, 0xAF, 0x26, 0xFF, 0xFF, 0xAF, 
-    0x1A, 0xFF, 0xFF, 0xAF, 0x12, 0xFF, 0xFF, 0xAF, 0x0A, 0xFF, 0xFF, 0xAF, 0x04, 0xFF, 0xFF, 0xAE, 
-    0xFE, 0xFF, 0xFF, 0xAE, 0xF8, 0xFF, 0xFF, 0xAE, 0xF2, 0xFF, 0xFF, 0xAE, 0xEE, 0xFF, 0xFF, 0xAE, 
-    0xE8, 0xFF, 0xFF, 0xAE, 0xE0, 0xFF, 0xFF, 0xAE, 0xD6, 0xFF, 0xFF, 0xAE, 0xD0, 0xFF, 0xFF, 0xAE, 
-    0xC8, 0xFF, 0xFF, 0xAE, 0xC2, 0xFF, 0xFF, 0xAE, 0xBC, 0xFF, 0xFF, 0xAE, 0xB4, 0xFF, 0xFF, 0xAE, 
-    0xAC, 0xFF, 0xFF, 0xAE, 0xA2, 0xFF, 0xFF, 0xAE, 0x9A, 0xFF, 0xFF, 0xAE, 0x90, 0xFF, 0xFF, 0xAE, 
-    0x88, 0xFF, 0xFF, 0xAE, 0x80, 0xFF, 0xFF, 0xAE, 0x7A, 0xFF, 0xFF, 0xAE, 0x72, 0xFF, 0xFF, 0xAE, 
-    0x6A, 0xFF, 0xFF, 0xAE, 0x64, 0xFF, 0xFF, 0xAE, 0x60, 0xFF, 0xFF, 0xAE, 0x5C, 0xFF, 0xFF, 0xAE, 
-    0x58, 0xFF, 0xFF, 0xAE, 0x54, 0xFF, 0xFF, 0xAE, 0x50, 0xFF, 0xFF, 0xAE, 0x48, 0xFF, 0xFF, 0xAE, 
-    0x42, 0xFF, 0xFF, 0xAE, 0x3C, 0xFF, 0xFF, 0xAE, 0x34, 0xFF, 0xFF, 0xAE, 0x2C, 0xFF, 0xFF, 0xAE, 
-    0x22, 0xFF, 0xFF, 0xAE, 0x1E, 0xFF, 0xFF, 0xAE, 0x16, 0xFF, 0xFF, 0xAE, 0x0E, 0xFF, 0xFF, 0xAE, 
-    0x04, 0x56, 0x4F, 0x4C, 0x41, 0x54, 0x49, 0x4C, 0x45, 0x10, 0xF0, 0x06, 0x02, 0x50, 0x41, 0x53, 
-    0x43, 0x41, 0x4C, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x16, 0x4E, 0x45, 0x57, 0x00, 0x4F, 0x50, 
-    0x45, 0x52, 0x41, 0x54, 0x4F, 0x52, 0x13, 0x46, 0x52, 0x49, 0x45, 0x4E, 0x44, 0x16, 0x56, 0x49, 
-    0x52, 0x54, 0x55, 0x41, 0x4C, 0x00, 0x43, 0x4C, 0x43, 0x4C, 0x12, 0x4F, 0x52, 0x4F, 0x52, 0x13, 
-    0x41, 0x4E, 0x44, 0x41, 0x4E, 0x44, 0x15, 0x52, 0x53, 0x48, 0x00, 0x4C, 0x53, 0x48, 0x00, 0x47, 
-    0x45, 0x10, 0xF0, 0x02, 0x02, 0x4C, 0x45, 0x4E, 0x45, 0x12, 0x45, 0x51, 0x45, 0x51, 0x10, 0xF0, 
-    0x06, 0x02, 0x49, 0x4E, 0x4C, 0x49, 0x4E, 0x45, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x12, 0x45, 
-    0x4E, 0x55, 0x4D, 0x10, 0xF0, 0x06, 0x02, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x45, 0x58, 0x54, 
-    0x45, 0x52, 0x4E, 0x14, 0x45, 0x4C, 0x4C, 0x49, 0x50, 0x53, 0x45, 0x53, 0x13, 0x4F, 0x53, 0x54, 
-    0x59, 0x50, 0x45, 0x1C, 0x50, 0x52, 0x4F, 0x54, 0x45, 0x43, 0x54, 0x45, 0x44, 0x00, 0x50, 0x52, 
-    0x49, 0x56, 0x41, 0x54, 0x45, 0x00, 0x50, 0x55, 0x42, 0x4C, 0x49, 0x43, 0x19, 0x43, 0x4F, 0x4E, 
-    0x53, 0x54, 0x00, 0x46, 0x4C, 0x4F, 0x41, 0x54, 0x00, 0x44, 0x4F, 0x55, 0x42, 0x4C, 0x45, 0x12, 
-    0x56, 0x4F, 0x49, 0x44, 0x14, 0x55, 0x4E, 0x53, 0x49, 0x47, 0x4E, 0x45, 0x44, 0x13, 0x53, 0x49, 
-    0x47, 0x4E, 0x45, 0x44, 0x12, 0x4C, 0x4F, 0x4E, 0x47, 0x17, 0x49, 0x4E, 0x54, 0x00, 0x53, 0x48, 
-    0x4F, 0x52, 0x54, 0x00, 0x43, 0x48, 0x41, 0x52, 0x10, 0xF0, 0x12, 0x02, 0x43, 0x4C, 0x41, 0x53, 
-    0x53, 0x00, 0x55, 0x4E, 0x49, 0x4F, 0x4E, 0x00, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x54, 0x59, 
-    0x50, 0x45, 0x44, 0x45, 0x46, 0x00, 0x49, 0x44, 0x45, 0x4E, 0x54, 0x49, 0x46, 0x49, 0x45, 0x52, 
-    0x13, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x1A, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x00, 
-    0x43, 0x41, 0x50, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x49, 0x45, 0x53, 0x16, 0x50, 0x53, 0x45, 
-    0x55, 0x44, 0x4F, 0x53, 0x54, 0x41, 0x54, 0x49, 0x43, 0x18, 0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 
-    0x52, 0x00, 0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x10, 0x6B, 0x27, 0x7E, 0x27, 0x00, 
-    0x27, 0x7D, 0x27, 0x00, 0x27, 0x7C, 0x27, 0x00, 0x27, 0x7B, 0x27, 0x00, 0x27, 0x5E, 0x27, 0x00, 
-    0x27, 0x5D, 0x27, 0x00, 0x27, 0x5B, 0x27, 0x00, 0x27, 0x40, 0x27, 0x00, 0x27, 0x3E, 0x27, 0x00, 
-    0x27, 0x3D, 0x27, 0x00, 0x27, 0x3C, 0x27, 0x00, 0x27, 0x3B, 0x27, 0x00, 0x27, 0x3A, 0x27, 0x00, 
-    0x27, 0x2F, 0x27, 0x00, 0x27, 0x2E, 0x27, 0x00, 0x27, 0x2D, 0x27, 0x00, 0x27, 0x2C, 0x27, 0x00, 
-    0x27, 0x2B, 0x27, 0x00, 0x27, 0x2A, 0x27, 0x00, 0x27, 0x29, 0x27, 0x00, 0x27, 0x28, 0x27, 0x00, 
-    0x27, 0x26, 0x27, 0x00, 0x27, 0x25, 0x27, 0x00, 0x27, 0x21, 0x27, 0x00, 0x65, 0x6E, 0x64, 0x2D, 
-    0x6F, 0x66, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x10, 0x01, 0x21, 0x00, 0x05, 0x03, 0x3D, 0x00, 0x28, 
-    0x00, 0x7D, 0x00, 0x3F, 0x03, 0x28, 0x00, 0x28, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x3C, 
-    0x00, 0x2D, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x28, 0x01, 0x07, 0x00, 0x06, 0x00, 0x2B, 0x00, 0x3D, 
-    0x00, 0x2D, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x26, 0x00, 0x2A, 0x00, 0x2A, 0x00, 0x2A, 
-    0x00, 0x2A, 0x00, 0x6C, 0x00, 0x29, 0x00, 0x14, 0x00, 0x26, 0x00, 0x2C, 0x00, 0x28, 0x00, 0x3B, 
-    0x00, 0x2A, 0x00, 0x2C, 0x00, 0x07, 0x03, 0x26, 0x00, 0x2C, 0x00, 0x28, 0x00, 0x29, 0x00, 0xF0, 
-    0x6F, 0x02, 0x03, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x26, 0x00, 0x5B, 0x00, 0x28, 
-    0x00, 0x29, 0x00, 0x2A, 0x00, 0x11, 0x00, 0x2C, 0x01, 0x07, 0x00, 0x3B, 0x00, 0x1D, 0x00, 0x2C, 
-    0x00, 0x17, 0x00, 0x3B, 0x00, 0x3C, 0x01, 0x07, 0x00, 0x3E, 0x01, 0x06, 0x00, 0x3B, 0x01, 0x06, 
-    0x00, 0x3B, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x40, 0x00, 0x3D, 0x00, 0x26, 0x00, 0x98, 0x00, 0x5D, 
-    0x01, 0x07, 0x00, 0x2A, 0x00, 0x28, 0x00, 0x28, 0x00, 0x3B, 0x00, 0x9F, 0x00, 0x26, 0x01, 0x07, 
-    0x00, 0x28, 0x00, 0x29, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x2C, 0x01, 0x1E, 0x00, 0x2E, 0x01, 0x1E, 
-    0x00, 0x3A, 0x00, 0x3B, 0x00, 0x7E, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x28, 
-    0x00, 0x7B, 0x7E, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x26, 0x00, 0x3E, 0x00, 0x28, 0x00, 0x29, 0x00, 
-    0x2A, 0x00, 0x51, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x26, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 
-    0x2A, 0x00, 0x2C, 0x00, 0x7D, 0x00, 0x28, 0x00, 0x7B, 0x00, 0x7D, 0x00, 0xC9, 0x00, 0x70, 0x00, 
-    0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x5B, 0x00, 0x7B, 0x00, 0x7D, 0x00, 0x7B, 0x00, 
-    0x3B, 0x00, 0x7B, 0x00, 0x3D, 0x01, 0x37, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x26, 0x00, 0x7D, 0x00, 
-    0x28, 0x00, 0x29, 0x01, 0x07, 0x00, 0x7B, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x2E, 0x01, 0x0E, 0x01, 
-    0x06, 0x00, 0x7B, 0x00, 0x7B, 0x00, 0x26, 0x01, 0x13, 0x01, 0x47, 0x00, 0x26, 0x00, 0x2A, 0x01, 
-    0x4A, 0x00, 0x80, 0xF9, 0x03, 0x2A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3E, 0x00, 0x7D, 
-    0x01, 0x52, 0x01, 0x55, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x01, 0x1E, 0x00, 0x5B, 0x00, 0x26, 
-    0x01, 0x1E, 0x00, 0x28, 0x01, 0x5E, 0x00, 0x2A, 0x00, 0x3B, 0x00, 0x2C, 0x01, 0x59, 0x00, 0x26, 
-    0x00, 0x28, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2C, 0x00, 0x2C, 0x01, 0x61, 0x00, 0x2B, 
-    0x01, 0x15, 0x00, 0x2D, 0x00, 0xA2, 0x01, 0x07, 0x00, 0x3B, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x26, 
-    0x00, 0x7B, 0x00, 0x28, 0x00, 0x29, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x2E, 
-    0x01, 0x07, 0x00, 0x29, 0x01, 0x16, 0x01, 0x17, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x2E, 0x00, 0x26, 
-    0x00, 0x2C, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x3B, 0x00, 0x2C, 0x00, 0x28, 0x01, 0x0E, 
-    0x01, 0x2B, 0x01, 0x10, 0x01, 0x11, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x01, 0x07, 0x00, 0x3B, 
-    0x01, 0x06, 0x00, 0x2C, 0x01, 0x07, 0x01, 0x06, 0x00, 0x3B, 0x00, 0x26, 0x00, 0x3D, 0x00, 0x28, 
-    0x00, 0x29, 0x00, 0x2A, 0x01, 0x07, 0x00, 0x2C, 0x00, 0x29, 0x01, 0x22, 0x01, 0x23, 0x00, 0x7B, 
-    0x00, 0x3B, 0x00, 0x2E, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x1E, 0x00, 0x5D, 0x00, 0x5E, 
-    0x01, 0x1E, 0x01, 0x1E, 0x00, 0x3B, 0x01, 0x1E, 0x00, 0x3D, 0x01, 0x07, 0x01, 0x01, 0x01, 0x02, 
-    0x01, 0x15, 0x01, 0x1E, 0x01, 0x15, 0x01, 0x15, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 
-    0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 
-    0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x3A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x10, 0x80, 
-    0x8C, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x15, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x21, 0x01, 
-    0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x00, 0xB4, 0x00, 
-    0xB5, 0x01, 0x01, 0x01, 0x02, 0x01, 0x08, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x0E, 0x01, 0x07, 0x01, 
-    0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 
-    0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x1B, 0x01, 0x1C, 0x00, 
-    0x28, 0x00, 0x2C, 0x01, 0x1F, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x07, 0x01, 0x1F, 0x01, 
-    0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x07, 0x00, 0x2C, 0x00, 
-    0x3B, 0x00, 0x28, 0x00, 0x29, 0x00, 0x3B, 0x01, 0x15, 0x00, 0x2C, 0x01, 0x2E, 0x01, 0x2F, 0x00, 
-    0x2C, 0x01, 0x0E, 0x00, 0x53, 0x01, 0x15, 0x01, 0x15, 0x00, 0x56, 0x00, 0x3B, 0x00, 0x6B, 0x03, 
-    0x29, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x02, 0x00, 0x3B, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3B, 0x01, 
-    0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 
-    0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x0E, 0x01, 
-    0x07, 0x01, 0x20, 0x01, 0x21, 0x00, 0x2C, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x00, 0x2C, 0x01, 
-    0x1F, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x00, 0x26, 0x01, 0x15, 0x00, 0x28, 0x00, 
-    0x29, 0x01, 0x07, 0x00, 0x3B, 0x00, 0x2C, 0x01, 0x0E, 0x00, 0x2E, 0x00, 0x3B, 0x01, 0x2E, 0x01, 
-    0x2F, 0x01, 0x07, 0x01, 0x0E, 0x00, 0x25, 0x00, 0x29, 0x00, 0x7D, 0x10, 0x52, 0x01, 0x15, 0x00, 
-    0x2A, 0x00, 0x2E, 0x00, 0x3B, 0x01, 0x01, 0x01, 0x02, 0x00, 0x2F, 0x01, 0x07, 0x01, 0x15, 0x00, 
-    0x28, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 
-    0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 
-    0x7B, 0x01, 0x07, 0x01, 0x24, 0x01, 0x25, 0x00, 0x29, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x00, 
-    0x2A, 0x01, 0x1F, 0x01, 0x20, 0x01, 0x21, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x28, 0x00, 0x29, 0x10, 
-    0x72, 0x01, 0x16, 0x00, 0x2C, 0x01, 0x16, 0x00, 0x2E, 0x00, 0xBA, 0x00, 0xBB, 0x01, 0x07, 0x01, 
-    0x2E, 0x01, 0x2F, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x26, 0x01, 0x07, 0x00, 0x28, 0x00, 0x29, 0x00, 
-    0x2A, 0x00, 0x3B, 0x00, 0x2C, 0x01, 0x30, 0x01, 0x31, 0x01, 0x15, 0x01, 0x0C, 0x01, 0x0D, 0x01, 
-    0x0E, 0x01, 0x0F, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 
-    0x0F, 0x00, 0x3B, 0x01, 0x07, 0x00, 0x3D, 0x00, 0xB6, 0x00, 0xB7, 0x00, 0xB8, 0x00, 0xB9, 0x00, 
-    0x28, 0x00, 0x29, 0x01, 0x07, 0x00, 0x5B, 0x00, 0x2C, 0x01, 0x07, 0x00, 0x2E, 0x00, 0x87, 0x00, 
-    0x88, 0x00, 0x89, 0x00, 0x8A, 0x00, 0x5D, 0x00, 0x5E, 0x01, 0x07, 0x00, 0xBE, 0x00, 0xBF, 0x00, 
-    0x28, 0x00, 0x29, 0x00, 0x81, 0x09, 0x03, 0x3B, 0x00, 0x2C, 0x00, 0x5B, 0x01, 0x07, 0x01, 0x07, 
-    0x00, 0x2C, 0x00, 0x26, 0x00, 0x7D, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x3D, 0x00, 0x2C, 
-    0x00, 0x7C, 0x00, 0x5E, 0x00, 0x26, 0x00, 0x3B, 0x00, 0x5D, 0x00, 0x3D, 0x00, 0x5D, 0x00, 0x5B, 
-    0x00, 0x29, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x01, 0x05, 0x00, 0x5B, 0x00, 0x3B, 0x00, 0x29, 
-    0x00, 0x3D, 0x01, 0x01, 0x01, 0x02, 0x00, 0x29, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x3B, 0x00, 0x28, 
-    0x01, 0x08, 0x00, 0x7B, 0x00, 0x28, 0x00, 0x29, 0x00, 0x28, 0x00, 0x7B, 0x00, 0x2C, 0x00, 0x7B, 
-    0x00, 0x2E, 0x00, 0x5D, 0x00, 0x28, 0x00, 0x5D, 0x00, 0x29, 0x00, 0x29, 0x00, 0x3D, 0x00, 0x28, 
-    0x01, 0x07, 0x00, 0x2C, 0x00, 0x2C, 0x01, 0x1B, 0x01, 0x1C, 0x00, 0x3B, 0x00, 0x29, 0x01, 0x1F, 
-    0x00, 0x28, 0x00, 0x3A, 0x00, 0x3A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x26, 0x00, 0x28, 
-    0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x26, 0x00, 0x2C, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 
-    0x00, 0x3A, 0x00, 0x2C, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x26, 0x00, 0x21, 
-    0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x3B, 0x00, 0x2C, 0x00, 0x3D, 0x00, 0x28, 0x00, 0x5D, 
-    0x00, 0x3B, 0x00, 0x2B, 0x00, 0x3D, 0x00, 0x2D, 0x00, 0x28, 0x00, 0x28, 0x00, 0x3B, 0x00, 0x29, 
-    0x01, 0x01, 0x01, 0x02, 0x00, 0x28, 0x00, 0x3B, 0x00, 0x29, 0x00, 0x3D, 0x01, 0x07, 0x01, 0x08, 
-    0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 
-    0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x7B, 0x00, 0x29, 0x00, 0x7D, 
-    0x00, 0x40, 0x00, 0x5D, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x00, 0x29, 0x01, 0x1F, 0x00, 0x28, 
-    0x10, 0x81, 0x1E, 0x01, 0x15, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 
-    0x29, 0x00, 0x7D, 0x00, 0x5D, 0x00, 0x29, 0x00, 0x29, 0x00, 0x7B, 0x01, 0x2E, 0x01, 0x2F, 0x00, 
-    0x29, 0x00, 0x29, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0xB1, 0x00, 0xB3, 0x00, 0xC0, 0x00, 0x9E, 0x01, 
-    0x01, 0x01, 0x02, 0x00, 0x12, 0x00, 0xB2, 0x00, 0xF4, 0x00, 0x1B, 0x01, 0x07, 0x01, 0x08, 0x01, 
-    0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 
-    0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x7E, 0x01, 0x07, 0x00, 0x6F, 0x00, 
-    0xFA, 0x01, 0x34, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x00, 0xA2, 0x01, 0x1F, 0x00, 0x2B, 0xFF, 
-    0xFF, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x15, 0xFF, 0xFF, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0xFF, 0xFF, 0x01, 
-    0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 
-    0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x26, 0x01, 
-    0x07, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0xFF, 0xFF, 0x01, 
-    0x1F, 0xFF, 0xFF, 0x00, 0x26, 0x01, 0x07, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0xFF, 0xFF, 0x00, 
-    0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0xFF, 0x00, 0x3D, 0x01, 0x2E, 0x01, 
-    0x2F, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 
-    0xFF, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 
-    0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 
-    0x15, 0x10, 0x89, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x01, 0x1B, 0x01, 0x1C, 
-    0x01, 0x1D, 0xFF, 0xFF, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x12, 0xFF, 0xFF, 0x01, 0x07, 0xFF, 0xFF, 0x00, 0x16, 
-    0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0xFF, 0xFF, 0x00, 0x7B, 0xFF, 0xFF, 0x01, 0x15, 0x00, 0x65, 
-    0x01, 0x07, 0xFF, 0xFF, 0x00, 0x21, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0xFF, 0xFF, 
-    0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 
-    0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0x01, 0x1D, 0x01, 0x1E, 0x00, 0x7B, 0xFF, 0xFF, 
-    0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x07, 
-    0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 
-    0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x00, 0x5D, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0xA7, 0xFF, 0xFF, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0xFF, 0xFF, 0x01, 0x1F, 
-    0x00, 0x25, 0x00, 0x26, 0xFF, 0xFF, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0xFF, 0xFF, 
-    0x00, 0x2D, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x25, 0x00, 0x26, 0x01, 0x2E, 0x01, 0x2F, 
-    0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0xFF, 0xFF, 0x00, 0x2F, 0x00, 0x3C, 
-    0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xFF, 0x00, 0x7D, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x86, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xFF, 0x00, 0x26, 
-    0xFF, 0xFF, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x26, 0x00, 0x2C, 0x00, 0x28, 0x00, 0x29, 
-    0x00, 0x2A, 0x00, 0x26, 0x00, 0x2C, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x2A, 0x00, 0xE4, 0x00, 0x2C, 
-    0xFF, 0xFF, 0x00, 0x5E, 0xFF, 0xFF, 0x00, 0xE9, 0x00, 0x3B, 0xFF, 0xFF, 0x00, 0x3D, 0xFF, 0xFF, 
-    0x01, 0x07, 0x00, 0x3B, 0xFF, 0xFF, 0x00, 0x3D, 0xFF, 0xFF, 0x00, 0x5E, 0x00, 0x3B, 0x00, 0xF5, 
-    0x00, 0x3D, 0xFF, 0xFF, 0x00, 0xF8, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x15, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 
-    0xFF, 0xFF, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0x00, 0x7C, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 
-    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 
-    0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x01, 0x1D, 0x01, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x01, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0xFF, 0xFF, 0x01, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2F, 
-    0x00, 0x7D, 0x00, 0x7E, 0x00, 0xF9, 0x00, 0xFA, 0x01, 0x42, 0xFF, 0xFF, 0x01, 0x36, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x01, 0x07, 0x01, 0x03, 0x01, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0xFF, 0xFF, 0x01, 0x09, 
-    0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 
-    0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x1C, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x29, 
-    0x01, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x06, 0x01, 0x07, 
-    0xFF, 0xFF, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 
-    0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 
-    0x01, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x20, 
-    0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x03, 0x01, 0x04, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x07, 0x01, 0x15, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 
-    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 
-    0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x1C, 
-    0x01, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x29, 0x01, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x07, 0xFF, 0xFF, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 
-    0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 
-    0x01, 0x14, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x1A, 0xFF, 0xFF, 
-    0x01, 0x07, 0x01, 0x1D, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 
-    0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0xFF, 0xFF, 0x01, 0x07, 0x01, 0x1D, 0x01, 0x09, 
-    0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 
-    0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 
-    0x01, 0x2F, 0xFF, 0xFF, 0x01, 0x07, 0x01, 0x1D, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 
-    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x2E, 0x01, 0x2F, 0x00, 0x8A, 0x00, 0xBB, 
-    0x00, 0xF5, 0x00, 0x86, 0x00, 0xCD, 0x00, 0x01, 0x01, 0x25, 0x00, 0x86, 0x00, 0x8A, 0x00, 0x30, 
-    0x00, 0x88, 0x00, 0xB8, 0x00, 0x89, 0x00, 0xB9, 0x00, 0x4C, 0x00, 0x86, 0x00, 0x24, 0x00, 0x2A, 
-    0x00, 0x88, 0x00, 0x65, 0x00, 0x89, 0x00, 0x6A, 0x00, 0x43, 0x00, 0x6A, 0x00, 0x6A, 0x00, 0x69, 
-    0x00, 0x42, 0x00, 0x69, 0x00, 0x69, 0x00, 0x99, 0x00, 0x66, 0x00, 0x3D, 0x00, 0x43, 0x00, 0x66, 
-    0x00, 0x19, 0x01, 0x50, 0x00, 0x42, 0x00, 0xA9, 0x00, 0x52, 0x00, 0xBB, 0x00, 0x9F, 0x00, 0xBB, 
-    0x00, 0xBB, 0x00, 0xB8, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x78, 0x00, 0x66, 
-    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x39, 0x00, 0x78, 0x00, 0x25, 0x01, 0x53, 0x00, 0x49, 
-    0x00, 0xA2, 0x00, 0x3F, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x28, 0x00, 0xBB, 0x01, 0x30, 0x00, 0x44, 
-    0x01, 0x4B, 0x01, 0x56, 0x00, 0x78, 0x00, 0x78, 0x00, 0x44, 0x00, 0x78, 0x00, 0x43, 0x00, 0xC2, 
-    0x00, 0x7E, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x6D, 0x00, 0x52, 0x01, 0x62, 0x00, 0xC8, 0x00, 0xB8, 
-    0x00, 0x40, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x5D, 0x00, 0x44, 0x00, 0xB8, 0x01, 0x31, 0x00, 0xB8, 
-    0x01, 0x4C, 0x00, 0x4E, 0x00, 0x4D, 0x00, 0x87, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x6B, 0x00, 0x52, 
-    0x00, 0x48, 0x01, 0x51, 0x00, 0xB5, 0x00, 0x87, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x96, 0x00, 0xB8, 
-    0x00, 0x96, 0x00, 0x60, 0x00, 0x96, 0x00, 0x74, 0x00, 0x96, 0x00, 0x78, 0x00, 0x73, 0x00, 0x78, 
-    0x00, 0x78, 0x00, 0x78, 0x00, 0x73, 0x00, 0x78, 0x00, 0xA8, 0x01, 0x2C, 0x01, 0x54, 0x00, 0x9F, 
-    0x00, 0xE8, 0x00, 0x9C, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x96, 0x00, 0x6C, 0x00, 0x44, 
-    0x00, 0x01, 0x01, 0x57, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x01, 0x45, 0x00, 0xB8, 0x00, 0xB8, 
-    0x00, 0xB5, 0x00, 0xA2, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0x81, 0x01, 0x63, 0x00, 0xB5, 0x01, 0x4D, 
-    0x00, 0xB5, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x5D, 0x00, 0x44, 0x00, 0x43, 0x00, 0x30, 0x01, 0x55, 
-    0x00, 0x74, 0x00, 0x42, 0x01, 0x59, 0x00, 0xB0, 0x00, 0x74, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0x6F, 
-    0x00, 0xB5, 0x00, 0x52, 0x01, 0x5E, 0x01, 0x5F, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x01, 0x4E, 
-    0x01, 0x2B, 0x00, 0x74, 0x00, 0x30, 0x00, 0x46, 0x01, 0x61, 0x00, 0x74, 0x00, 0x6E, 0x00, 0x74, 
-    0x01, 0x60, 0x00, 0x82, 0x00, 0x46, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x0C, 0x00, 0x82, 
-    0x01, 0x64, 0x00, 0xBC, 0x00, 0x4A, 0x00, 0xBD, 0x00, 0x74, 0x00, 0x77, 0x00, 0x74, 0x00, 0xB5, 
-    0x00, 0xB5, 0x00, 0xB0, 0x00, 0x78, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x0C, 0x00, 0x82, 0x00, 0xB0, 
-    0x00, 0x82, 0x00, 0xB0, 0x00, 0xF4, 0x00, 0xF7, 0x00, 0x78, 0x00, 0x79, 0x00, 0x50, 0x00, 0x4F, 
-    0x00, 0xF8, 0x00, 0x6F, 0x00, 0xA2, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0xB0, 0x00, 0x6F, 
-    0x00, 0x4B, 0x00, 0x2C, 0x01, 0x38, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 
-    0x00, 0x84, 0x00, 0xA1, 0x01, 0x23, 0x00, 0x10, 0x00, 0x84, 0x00, 0x30, 0x00, 0x6F, 0x00, 0x8D, 
-    0x00, 0x6F, 0x00, 0x8D, 0x00, 0x8D, 0x00, 0x8D, 0x00, 0xFD, 0x00, 0x8D, 0x01, 0x32, 0x00, 0xB6, 
-    0x00, 0xB7, 0x00, 0x54, 0x00, 0x10, 0x01, 0x33, 0x00, 0x67, 0x00, 0x73, 0x00, 0xA0, 0x00, 0x85, 
-    0x00, 0xB0, 0x00, 0xB0, 0x01, 0x24, 0x00, 0x85, 0x00, 0x8D, 0x00, 0x30, 0x00, 0x8D, 0x00, 0x41, 
-    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x68, 0x00, 0x85, 0x00, 0x68, 0x00, 0x68, 0x00, 0xBB, 0x00, 0xBB, 
-    0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 
-    0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x52, 0x00, 0xB0, 0x00, 0xB0, 
-    0x00, 0xB0, 0x00, 0x51, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x78, 0x00, 0xBB, 0x00, 0xBB, 
-    0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x52, 0x00, 0x52, 0x00, 0x9A, 
-    0x00, 0xD4, 0x00, 0xD5, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x52, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x57, 
-    0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 
-    0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x52, 
-    0x00, 0x52, 0x00, 0x51, 0x00, 0x13, 0x00, 0x52, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x96, 
-    0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x73, 
-    0x00, 0x0D, 0x00, 0x13, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x51, 0x00, 0x96, 0x00, 0x6C, 0x00, 0xB8, 
-    0x00, 0xB8, 0x00, 0x14, 0x00, 0x58, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x73, 0x00, 0x7D, 0x00, 0x0D, 
-    0x00, 0xAD, 0x01, 0x3D, 0x00, 0x59, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0x6C, 0x01, 0x33, 0x00, 0x6C, 
-    0x00, 0x14, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 
-    0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 
-    0x00, 0x5A, 0x00, 0x74, 0x00, 0xB4, 0x00, 0xB5, 0x00, 0x0C, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 
-    0x00, 0x15, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xB5, 0x00, 0xAD, 0x00, 0x74, 
-    0x00, 0xAD, 0x00, 0xAD, 0x00, 0x74, 0x00, 0x0C, 0x00, 0xAD, 0x00, 0x5B, 0x00, 0xAD, 0x00, 0x15, 
-    0x00, 0xB5, 0x00, 0xB5, 0x00, 0x82, 0x00, 0x5C, 0x00, 0xC0, 0x01, 0x3F, 0x00, 0x51, 0x00, 0xAB, 
-    0x00, 0x74, 0x00, 0xBE, 0x01, 0x33, 0x00, 0xAD, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xBF, 0x00, 0x5F, 
-    0x00, 0x82, 0x00, 0x60, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 
-    0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 
-    0x00, 0xB0, 0x00, 0x61, 0x00, 0x6F, 0x00, 0xBA, 0x00, 0xBB, 0x00, 0x64, 0x00, 0xB0, 0x00, 0xB0, 
-    0x00, 0xB0, 0x00, 0x70, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAB, 
-    0x00, 0xAB, 0x00, 0xA9, 0x00, 0x71, 0x00, 0xAB, 0x00, 0x72, 0x00, 0xAB, 0x00, 0xDA, 0x00, 0xDB, 
-    0x00, 0x8D, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0x54, 0x00, 0x7F, 0x00, 0x54, 
-    0x00, 0x54, 0x00, 0x54, 0x00, 0xAB, 0x00, 0x54, 0x01, 0x3E, 0x01, 0x40, 0x00, 0x8D, 0x00, 0x31, 
-    0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0x35, 0x00, 0x36, 
-    0x00, 0x37, 0x00, 0x38, 0x00, 0x54, 0x00, 0x80, 0x00, 0x54, 0x00, 0xD6, 0x00, 0xD7, 0x00, 0xD8, 
-    0x00, 0xD9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0x81, 0x00, 0x98, 0x00, 0xA9, 0x00, 0x9D, 0x00, 0xA9, 
-    0x00, 0xAD, 0x00, 0xAE, 0x00, 0xAF, 0x00, 0xB0, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0x9E, 0x00, 0xDE, 
-    0x00, 0xDF, 0x00, 0x6D, 0x00, 0x6D, 0x00, 0xA7, 0x00, 0xA9, 0x00, 0x6D, 0x00, 0x9F, 0x00, 0xA3, 
-    0x00, 0xA4, 0x00, 0xA5, 0x00, 0x98, 0x00, 0xA6, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0xA7, 
-    0x00, 0x98, 0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB3, 0x00, 0x6D, 0x00, 0xC1, 0x00, 0x6D, 0x00, 0xC3, 
-    0x00, 0x66, 0x00, 0xC4, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xC5, 0x00, 0xC9, 0x00, 0x98, 
-    0x00, 0xCF, 0x00, 0x98, 0x00, 0x51, 0x00, 0x51, 0x00, 0xD0, 0x00, 0xE1, 0x00, 0xA9, 0x00, 0xE2, 
-    0x00, 0xE3, 0x00, 0x51, 0x00, 0x54, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xA7, 
-    0x00, 0xE6, 0x00, 0xA7, 0x00, 0xE7, 0x00, 0xE9, 0x00, 0xF1, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0xF5, 
-    0x01, 0x18, 0x00, 0x6C, 0x00, 0xFF, 0x01, 0x13, 0x00, 0x51, 0x00, 0x51, 0x00, 0xA7, 0x01, 0x15, 
-    0x00, 0x51, 0x01, 0x19, 0x01, 0x1A, 0x01, 0x1B, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0x83, 
-    0x01, 0x21, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x8F, 0x00, 0x83, 0x00, 0x8F, 0x00, 0x8F, 
-    0x00, 0x8F, 0x01, 0x1C, 0x00, 0x8F, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x22, 0x01, 0x29, 0x00, 0x9B, 
-    0x00, 0x8A, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x83, 0x00, 0x9B, 0x00, 0x83, 0x00, 0x86, 
-    0x00, 0xA7, 0x00, 0x8F, 0x00, 0x88, 0x00, 0x8F, 0x00, 0x89, 0x01, 0x2A, 0x01, 0x2F, 0x01, 0x3A, 
-    0x01, 0x35, 0x00, 0xAD, 0x00, 0xAD, 0x01, 0x36, 0x00, 0x9B, 0x01, 0x37, 0x00, 0x9B, 0x00, 0xAD, 
-    0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 
-    0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xA7, 0x01, 0x3B, 
-    0x00, 0xA7, 0x01, 0x42, 0x01, 0x46, 0x00, 0xAD, 0x00, 0xAD, 0x00, 0xAD, 0x01, 0x47, 0x00, 0xAD, 
-    0x00, 0x19, 0x00, 0x01, 0x01, 0x48, 0x01, 0x4A, 0x01, 0x52, 0x01, 0x5A, 0x01, 0x5B, 0x01, 0x5C, 
-    0x01, 0x5D, 0x00, 0x01, 0x00, 0xA4, 0x00, 0x78, 0x00, 0x5F, 0x00, 0x20, 0x00, 0xAD, 0x00, 0xAD, 
-    0x00, 0x61, 0x00, 0x62, 0x00, 0x5B, 0x00, 0x18, 0x00, 0xD1, 0x00, 0xD3, 0x00, 0xE0, 0x00, 0xC7, 
-    0x00, 0xAB, 0x00, 0xAB, 0x00, 0x3C, 0x00, 0xD2, 0x00, 0xFC, 0x00, 0x45, 0x00, 0xAB, 0x00, 0xAB, 
-    0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 
-    0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0x87, 0x00, 0x54, 0x00, 0x9B, 
-    0x01, 0x12, 0x01, 0x41, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xAB, 0x00, 0xCA, 0x00, 0xAB, 0x00, 0x56, 
-    0x00, 0x01, 0x03, 0xCB, 0x00, 0x01, 0x05, 0x54, 0x00, 0x01, 0x03, 0xCE, 0x00, 0x03, 0x07, 0xA9, 
-    0x00, 0xA9, 0x00, 0x03, 0x03, 0xAB, 0x00, 0xAB, 0x00, 0x2D, 0x03, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 
-    0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 
-    0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0x55, 0x00, 0x6D, 0x00, 0x55, 0x00, 0x55, 
-    0x00, 0x55, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0x01, 0x03, 0xA9, 0x00, 0x09, 0x03, 0x84, 
-    0x00, 0x98, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x01, 0x03, 0x84, 0x00, 0x01, 0x07, 0x55, 
-    0x00, 0x07, 0x03, 0x55, 0x00, 0xA9, 0x00, 0xA9, 0x00, 0x98, 0x00, 0x01, 0x0B, 0x84, 0x00, 0x01, 
-    0x03, 0x84, 0x00, 0x03, 0x05, 0xA7, 0x00, 0xA7, 0x00, 0x1F, 0x09, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 
-    0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 
-    0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0xA7, 0x00, 0x1B, 0x00, 0x07, 0x07, 0x27, 0x00, 0xA7, 
-    0x00, 0xA7, 0x00, 0xA7, 0x00, 0x01, 0x03, 0xA7, 0x00, 0x01, 0x0B, 0x83, 0x00, 0x01, 0x05, 0x3B, 
-    0x00, 0xF0, 0x01, 0x02, 0x03, 0x8F, 0x3E, 0x00, 0x03, 0x03, 0xA7, 0x00, 0xA7, 0x00, 0x01, 0x03, 
-    0x55, 0x00, 0x05, 0x03, 0x83, 0x00, 0x8B, 0x00, 0x9B, 0x00, 0x03, 0x03, 0x1B, 0x00, 0x8F, 0x00, 
-    0x01, 0x05, 0xAA, 0x00, 0x19, 0x03, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 
-    0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 
-    0x07, 0x0D, 0x5E, 0x00, 0x14, 0x00, 0x85, 0x00, 0x5D, 0x00, 0x01, 0x03, 0xAB, 0x00, 0x03, 0x11, 
-    0x01, 0x00, 0x02, 0x00, 0x23, 0x05, 0x16, 0x00, 0x17, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 
-    0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 
-    0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x1B, 0x00, 0x01, 0x05, 0xCC, 0x00, 0xF0, 0x05, 
-    0x02, 0x03, 0x12, 0x00, 0x13, 0x00, 0x14, 0x15, 0x00, 0xC7, 0x00, 0x74, 0x00, 0x07, 0x03, 0x74, 
-    0x00, 0x74, 0x00, 0x74, 0x00, 0xC7, 0x00, 0xF0, 0x01, 0x02, 0x03, 0xC7, 0xC7, 0x00, 0x11, 0x03, 
-    0xC7, 0x00, 0xC7, 0x00, 0x16, 0x00, 0x17, 0x00, 0x68, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0x68, 0x00, 
-    0xC7, 0x00, 0x03, 0x03, 0xC7, 0x00, 0xC7, 0x00, 0x01, 0x03, 0xC7, 0x12, 0x01, 0x0A, 0x01, 0x0B, 
-    0x00, 0x01, 0x05, 0xAC, 0x00, 0x01, 0x07, 0xC7, 0x00, 0xF0, 0x01, 0x02, 0x03, 0xC7, 0x78, 0x00, 
-    0x13, 0x03, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x90, 0x00, 0x78, 0x00, 0x90, 0x00, 0x90, 0x00, 
-    0x90, 0x00, 0x69, 0x00, 0x90, 0x00, 0x07, 0x03, 0x69, 0x00, 0x69, 0x00, 0xEE, 0x00, 0x69, 0x00, 
-    0x01, 0x03, 0xC7, 0x00, 0x03, 0x03, 0xF2, 0x00, 0x78, 0x00, 0x01, 0x03, 0x78, 0x00, 0x03, 0x03, 
-    0x55, 0x00, 0x90, 0x00, 0x01, 0x03, 0x90, 0x00, 0x07, 0x03, 0xC7, 0x00, 0x69, 0x00, 0xFE, 0x00, 
-    0x69, 0x10, 0xF0, 0x01, 0x02, 0x01, 0x84, 0x00, 0x01, 0x05, 0x55, 0x00, 0x01, 0x11, 0xC7, 0x00, 
-    0x01, 0x03, 0x84, 0x51, 0x01, 0x14, 0x00, 0x1D, 0x05, 0x26, 0x00, 0xC7, 0x00, 0x05, 0x00, 0x06, 
-    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 
-    0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x21, 0x01, 0x20, 0x00, 0x03, 0x09, 0x14, 0x01, 0x28, 0x00, 
-    0x01, 0x05, 0x78, 0x41, 0x01, 0x2E, 0x00, 0x03, 0x0F, 0x16, 0x00, 0x17, 0x11, 0x01, 0x39, 0x26, 
-    0x01, 0x3C, 0x01, 0x11, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x4F, 0x11, 0x01, 0x44, 0x31, 
-    0x01, 0x17, 0x53, 0x01, 0x1D, 0x01, 0x01, 0x01, 0x02, 0x21, 0x01, 0x03, 0x00, 0x1F, 0x03, 0x05, 
-    0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 
-    0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x32, 0x01, 
-    0x07, 0x00, 0x14, 0xB2, 0x01, 0x08, 0x01, 0x09, 0x00, 0x07, 0x07, 0x16, 0x00, 0x17, 0x00, 0x3A, 
-    0x00, 0x26, 0x00, 0x19, 0x03, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 
-    0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x01, 
-    0x0F, 0x14, 0x00, 0x01, 0x15, 0x74, 0x00, 0x03, 0x0B, 0x16, 0x00, 0x17, 0x00, 0x0B, 0x07, 0xC7, 
-    0x00, 0xC7, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0x0D, 0x0D, 0xC7, 0x00, 0xC7, 
-    0x00, 0xC7, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0x90, 0x00, 0x01, 0x09, 0x69, 0x32, 0x01, 
-    0x01, 0x01, 0x02, 0x20, 0x24, 0x01, 0x03, 0x00, 0x90, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 
-    0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 
-    0x10, 0x00, 0x11, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x32, 0x01, 0x07, 0x00, 0x14, 0xB2, 0x01, 
-    0x08, 0x01, 0x09, 0x00, 0x05, 0x07, 0x16, 0x00, 0x17, 0x00, 0x26, 0x00, 0x19, 0x03, 0x05, 0x00, 
-    0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 
-    0xEA, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x01, 0x09, 0xEB, 0x00, 0x1D, 0x03, 0x26, 0x00, 
-    0x14, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 
-    0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x03, 0x07, 0x16, 0x00, 
-    0x17, 0x1F, 0x01, 0x16, 0x00, 0x14, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 
-    0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 
-    0x00, 0x03, 0x07, 0x16, 0x00, 0x17, 0x00, 0x1B, 0x03, 0x26, 0x00, 0x14, 0x00, 0x05, 0x00, 0x06, 
-    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 
-    0x00, 0x0F, 0x00, 0x10, 0x00, 0x1D, 0x09, 0x16, 0x00, 0x17, 0xFF, 0xED, 0x02, 0xCC, 0xFF, 0xB1, 
-    0x01, 0xE5, 0x01, 0xEB, 0x01, 0xE4, 0x00, 0x76, 0x01, 0x31, 0x01, 0x0E, 0x01, 0x11, 0x01, 0x3B, 
-    0x01, 0xD8, 0x01, 0x6B, 0x15, 0xFF, 0x52, 0x01, 0xFB, 0xFF, 0x50, 0x02, 0xDA, 0x03, 0x13, 0x00, 
-    0x0B, 0x05, 0x24, 0x02, 0x8A, 0x00, 0x1C, 0x00, 0x0B, 0x02, 0x84, 0x01, 0xAA, 0x62, 0x02, 0x42, 
-    0x02, 0x15, 0x41, 0x01, 0xB8, 0x00, 0x05, 0x07, 0xA6, 0x01, 0x7F, 0xFF, 0x59, 0x10, 0xF0, 0x02, 
-    0x03, 0x02, 0x8E, 0x02, 0x16, 0x01, 0x0A, 0x22, 0x02, 0x17, 0x02, 0x83, 0x00, 0x01, 0x05, 0x85, 
-    0x00, 0x03, 0x03, 0x0A, 0x00, 0x49, 0x00, 0x01, 0x05, 0x8D, 0x00, 0x01, 0x03, 0xC3, 0x00, 0x01, 
-    0x0D, 0x26, 0x11, 0x03, 0x7B, 0x00, 0x07, 0x0D, 0xB9, 0x03, 0x85, 0x01, 0x2C, 0x00, 0xAD, 0x00, 
-    0x01, 0x05, 0x05, 0x73, 0x01, 0xA9, 0x01, 0xDE, 0x01, 0xA9, 0x61, 0x02, 0x1B, 0x10, 0xF0, 0x02, 
-    0x04, 0x02, 0x20, 0x02, 0xBE, 0x03, 0x80, 0x01, 0x1B, 0x00, 0x03, 0x03, 0x4A, 0x02, 0x2B, 0x00, 
-    0x01, 0x07, 0x8C, 0x70, 0xF0, 0x02, 0x02, 0x01, 0xD3, 0x01, 0x18, 0x11, 0x01, 0xDE, 0x21, 0x01, 
-    0xDE, 0x61, 0x02, 0x0E, 0x31, 0xFF, 0xFC, 0x42, 0x02, 0x2F, 0x01, 0x26, 0x41, 0x02, 0x2F, 0x00, 
-    0x03, 0x05, 0xB9, 0x02, 0x64, 0x21, 0x01, 0x2F, 0x61, 0x02, 0xB3, 0x00, 0x01, 0x0D, 0x0E, 0xB8, 
-    0x01, 0xFD, 0x01, 0xC3, 0x01, 0x99, 0x01, 0x62, 0x00, 0x9D, 0x00, 0x64, 0x00, 0x2B, 0x00, 0x01, 
-    0x31, 0x02, 0x2F, 0x11, 0x01, 0x52, 0x24, 0x02, 0x14, 0x02, 0x14, 0x02, 0x2F, 0x01, 0x56, 0x91, 
-    0x03, 0x55, 0x01, 0x3C, 0x02, 0x2F, 0x01, 0x32, 0x02, 0x65, 0x00, 0x01, 0x0D, 0x42, 0x21, 0xFF, 
-    0xF5, 0x61, 0xFF, 0xF5, 0x11, 0x02, 0x69, 0x52, 0x02, 0x6A, 0x03, 0x61, 0x11, 0x02, 0x65, 0x00, 
-    0x01, 0x07, 0x74, 0xF1, 0x02, 0x65, 0x00, 0x01, 0x05, 0x74, 0x21, 0x02, 0x65, 0x51, 0x02, 0x59, 
-    0x11, 0x02, 0x65, 0x41, 0xFF, 0xE1, 0x42, 0x02, 0x2F, 0x02, 0x65, 0x23, 0x02, 0x65, 0xFF, 0x8E, 
-    0xFF, 0x8E, 0x00, 0x05, 0x07, 0x1A, 0x02, 0x65, 0x00, 0x1A, 0x00, 0x01, 0x07, 0x1B, 0x00, 0x01, 
-    0x17, 0x06, 0x00, 0x01, 0x05, 0x1B, 0x00, 0x01, 0x0F, 0x06, 0x00, 0x01, 0x05, 0x1A, 0x00, 0x01, 
-    0x11, 0x1A, 0x63, 0x02, 0x5A, 0xFF, 0x09, 0xFF, 0x30, 0x14, 0x03, 0xCB, 0xFF, 0x37, 0xFF, 0x37, 
-    0xFF, 0x44, 0x11, 0xFF, 0xCD, 0x13, 0xFF, 0x85, 0x00, 0xCD, 0x00, 0xD4, 0x32, 0x03, 0xF5, 0x03, 
-    0x42, 0x11, 0xFF, 0x37, 0x12, 0x03, 0xCB, 0x03, 0xF5, 0x11, 0xFF, 0x4B, 0x14, 0xFF, 0xFA, 0x00, 
-    0x3A, 0x00, 0x71, 0xFF, 0xA7, 0x00, 0x03, 0x03, 0xB2, 0x02, 0x5A, 0x00, 0x03, 0x05, 0x21, 0x00, 
-    0x96, 0x00, 0x05, 0x07, 0xDD, 0x00, 0x78, 0x00, 0xDD, 0x00, 0x03, 0x03, 0x23, 0x00, 0x4E, 0x00, 
-    0x01, 0x07, 0x56, 0x00, 0xF0, 0x01, 0x03, 0x03, 0x6C, 0x81, 0x87, 0x14, 0x02, 0xD5, 0x00, 0x9A, 
-    0x01, 0x7B, 0x01, 0x38, 0x22, 0x01, 0x8E, 0xFF, 0xD6, 0x23, 0xFF, 0xEF, 0x00, 0x25, 0x00, 0x75, 
-    0x12, 0x01, 0x91, 0xFF, 0xF2, 0x00, 0x01, 0x09, 0xAE, 0x00, 0x07, 0x03, 0xB0, 0xFF, 0xF0, 0xFF, 
-    0xB8, 0x00, 0x78, 0x00, 0x01, 0x05, 0x78, 0x62, 0x02, 0x5A, 0x00, 0xC9, 0x00, 0x03, 0x03, 0xDE, 
-    0x00, 0xE6, 0x33, 0xFF, 0xDF, 0xFF, 0xDF, 0x01, 0x93, 0x41, 0xFF, 0xDF, 0x00, 0x0D, 0x05, 0x22, 
-    0xFF, 0x37, 0x00, 0xE9, 0x00, 0xF1, 0x01, 0xA5, 0xFF, 0xF1, 0x00, 0xA8, 0x00, 0x05, 0x05, 0xFA, 
-    0x00, 0xFB, 0x01, 0xD7, 0x31, 0x01, 0x88, 0x22, 0x01, 0xCC, 0xFF, 0xF9, 0x35, 0x02, 0x31, 0xFF, 
-    0xDB, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0xDB, 0x28, 0x01, 0x8F, 0x01, 0xAE, 0x01, 0xE7, 0x00, 0x5C, 
-    0xFF, 0xCF, 0x00, 0x91, 0x00, 0x90, 0x01, 0x71, 0x24, 0x01, 0xB2, 0xFF, 0xDF, 0x01, 0xB4, 0x01, 
-    0xB7, 0x15, 0x01, 0xEA, 0x01, 0x12, 0x01, 0x12, 0xFF, 0xDF, 0x01, 0xBD, 0x11, 0xFF, 0xF0, 0x21, 
-    0xFF, 0xB8, 0x10, 0xF0, 0x02, 0x02, 0xFF, 0xDF, 0xFF, 0x87, 0x12, 0x01, 0xF1, 0x01, 0xF5, 0x40, 
-    0x20, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
-    0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0xFF, 
-    0xDF, 0x18, 0x01, 0xC2, 0x01, 0xE6, 0x01, 0xFA, 0x01, 0xFF, 0x01, 0xAD, 0x01, 0xAF, 0x01, 0xCF, 
-    0xFF, 0xDF, 0x61, 0x02, 0x05, 0x02, 0x24, 0x03, 0xB6, 0xFF, 0xDF, 0x32, 0x01, 0xD1, 0xFF, 0xDF, 
-    0x23, 0x02, 0x06, 0xFF, 0xC5, 0x00, 0xA4, 0x31, 0x02, 0x07, 0x10, 0xF0, 0x06, 0x02, 0x01, 0xF4, 
-    0xFF, 0xE7, 0x02, 0x08, 0xFF, 0xDF, 0x03, 0x18, 0x03, 0x8D, 0x11, 0x02, 0x09, 0x29, 0x03, 0xB6, 
-    0x02, 0x10, 0x03, 0xE0, 0x02, 0x0A, 0x02, 0x13, 0x02, 0x02, 0x02, 0x03, 0x02, 0x11, 0x03, 0xCB, 
-    0x32, 0x01, 0x46, 0x01, 0x47, 0x61, 0x03, 0xB6, 0x24, 0x02, 0x1A, 0x01, 0x48, 0xFF, 0xDE, 0x03, 
-    0xB6, 0x33, 0x01, 0x49, 0x02, 0x37, 0x00, 0x4F, 0x12, 0x03, 0xB6, 0x02, 0x38, 0x22, 0xFF, 0x3A, 
-    0x00, 0xC7, 0x1A, 0x02, 0x39, 0x02, 0x3D, 0x02, 0x3E, 0xFF, 0xDF, 0x03, 0xB6, 0x02, 0x26, 0x02, 
-    0x50, 0x03, 0xB6, 0x01, 0x3A, 0x01, 0x6E, 0x26, 0xFF, 0xDE, 0x02, 0x3B, 0x03, 0xB6, 0x02, 0x3B, 
-    0x02, 0x1F, 0x02, 0x57, 0x12, 0x01, 0x6F, 0x02, 0x5C, 0x10, 0xF0, 0x02, 0x02, 0xFF, 0x3C, 0xFF, 
-    0x8B, 0x14, 0xFF, 0xDF, 0xFF, 0xE8, 0x02, 0x5D, 0xFF, 0xFD, 0x11, 0x01, 0x6F, 0x00, 0x0B, 0x03, 
-    0x08, 0x01, 0x6F, 0x02, 0x5E, 0x02, 0x5F, 0x02, 0x60, 0x02, 0x61, 0x31, 0x01, 0x6F, 0x21, 0x02, 
-    0x3B, 0x00, 0x01, 0x07, 0x08, 0x42, 0x02, 0x3B, 0x00, 0x14, 0x00, 0x01, 0x03, 0x08, 0x00, 0x6D, 
-    0x07, 0x1A, 0x00, 0x96, 0x00, 0x97, 0x00, 0x8C, 0x00, 0x8D, 0x00, 0x8E, 0x00, 0x8F, 0x00, 0x90, 
-    0x00, 0x91, 0x00, 0x92, 0x00, 0x93, 0x00, 0x94, 0x00, 0x95, 0x01, 0x2D, 0x01, 0x49, 0x00, 0xC6, 
-    0x01, 0x43, 0x00, 0xEC, 0x00, 0xED, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x44, 
-    0x00, 0x29, 0x00, 0x20, 0x00, 0xF6, 0x00, 0x21, 0x00, 0x22, 0x00, 0x46, 0x00, 0x75, 0x00, 0x51, 
-    0x00, 0x23, 0x00, 0x47, 0x00, 0x76, 0x00, 0xF9, 0x00, 0xEF, 0x00, 0xFA, 0x00, 0xF0, 0x01, 0x0D, 
-    0x01, 0x0E, 0x01, 0x0F, 0x01, 0x26, 0x01, 0x34, 0x01, 0x27, 0x01, 0x58, 0x01, 0x10, 0x00, 0x53, 
-    0x00, 0x7A, 0x00, 0x7B, 0x00, 0x62, 0x00, 0x55, 0x00, 0x63, 0x00, 0x82, 0x00, 0x83, 0x00, 0x01, 
-    0x11, 0x7F, 0x00, 0x01, 0x03, 0x85, 0x00, 0x05, 0x07, 0x96, 0x00, 0x94, 0x00, 0x93, 0x00, 0x01, 
-    0x05, 0x4D, 0x00, 0x01, 0x03, 0x4C, 0x00, 0x01, 0x05, 0x53, 0x00, 0x01, 0x0D, 0x73, 0x00, 0x03, 
-    0x05, 0x03, 0x00, 0x09, 0x00, 0x05, 0x05, 0x74, 0x00, 0x06, 0x00, 0x79, 0x00, 0x01, 0x07, 0x88, 
-    0x00, 0x05, 0x05, 0x8E, 0x00, 0x95, 0x00, 0x80, 0x00, 0xF0, 0x01, 0x04, 0x03, 0x86, 0x81, 0x87, 
-    0x70, 0x00, 0x03, 0x09, 0x6B, 0x00, 0x72, 0x00, 0x03, 0x05, 0x7B, 0x00, 0x7D, 0x00, 0x01, 0x07, 
-    0x0B, 0x00, 0x07, 0x05, 0x71, 0x00, 0x4B, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x01, 0x03, 0x1D, 0x00, 
-    0x03, 0x09, 0x97, 0x00, 0x77, 0x00, 0x0B, 0x03, 0x89, 0x00, 0x8A, 0x00, 0x8B, 0x00, 0x91, 0x00, 
-    0x8C, 0x00, 0x92, 0x00, 0x01, 0x05, 0x50, 0x00, 0x05, 0x05, 0x6E, 0x00, 0x9C, 0x00, 0x47, 0x00, 
-    0x07, 0x07, 0x7E, 0x00, 0x7A, 0x00, 0x7C, 0x00, 0x49, 0x00, 0x03, 0x03, 0x48, 0x00, 0x05, 0x00, 
-    0x03, 0x0F, 0x12, 0x00, 0x5A, 0x00, 0x05, 0x07, 0x56, 0x00, 0x75, 0x00, 0x76, 0x00, 0x03, 0x03, 
-    0x4F, 0x00, 0x4E, 0x00, 0x05, 0x05, 0xA0, 0x00, 0xC7, 0x00, 0xC6, 0x00, 0x03, 0x0B, 0x04, 0x00, 
-    0xA6, 0x00, 0x03, 0x11, 0xBF, 0x00, 0xA5, 0x00, 0x01, 0x09, 0x0A, 0x00, 0x01, 0x0B, 0x07, 0x00, 
-    0x03, 0x03, 0x58, 0x00, 0x59, 0x00, 0xF0, 0x01, 0x02, 0x03, 0x08, 0x9D, 0x00, 0x07, 0x09, 0xC3, 
-    0x00, 0xC1, 0x00, 0xC0, 0x00, 0xC2, 0x00, 0x01, 0x21, 0x0F, 0x00, 0x0B, 0x11, 0x11, 0x00, 0x57, 
-    0x00, 0xA3, 0x00, 0x9E, 0x00, 0xA1, 0x00, 0xC5, 0x00, 0x23, 0x03, 0xA8, 0x00, 0xAA, 0x00, 0xAC, 
-    0x00, 0xAE, 0x00, 0xAF, 0x00, 0xB2, 0x00, 0xB4, 0x00, 0xB1, 0x00, 0xB3, 0x00, 0xB6, 0x00, 0xB7, 
-    0x00, 0xB9, 0x00, 0xBA, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x0E, 0x00, 0x4A, 0x00, 0x05, 
-    0x05, 0x18, 0x00, 0x1A, 0x00, 0x17, 0x00, 0x01, 0x07, 0x65, 0x00, 0x05, 0x07, 0x21, 0x00, 0x23, 
-    0x00, 0x16, 0x00, 0x01, 0x03, 0x6A, 0x00, 0xF0, 0x01, 0x02, 0x07, 0x1E, 0xC4, 0x00, 0x01, 0x05, 
-    0x67, 0x00, 0x05, 0x13, 0x2D, 0x00, 0x2E, 0x00, 0x19, 0x00, 0x0B, 0x05, 0x22, 0x00, 0x25, 0x00, 
-    0x26, 0x00, 0x40, 0x00, 0x1B, 0x00, 0x24, 0x00, 0x03, 0x03, 0x63, 0x00, 0x1F, 0x00, 0x05, 0x09, 
-    0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x01, 0x07, 0x64, 0x00, 0x03, 0x05, 0x33, 0x00, 0x34, 0x00, 
-    0x01, 0x05, 0x32, 0x00, 0x03, 0x15, 0x27, 0x00, 0x2F, 0x00, 0x01, 0x0D, 0x3B, 0x00, 0x01, 0x05, 
-    0x35, 0x00, 0xF0, 0x01, 0x02, 0x03, 0x36, 0x31, 0x00, 0x01, 0x09, 0x5C, 0x00, 0x01, 0x03, 0x45, 
-    0x00, 0x05, 0x0D, 0x5E, 0x00, 0x41, 0x00, 0x2B, 0x00, 0x03, 0x03, 0x42, 0x00, 0x2C, 0x00, 0x05, 
-    0x03, 0x99, 0x00, 0x9A, 0x00, 0x3F, 0x00, 0x07, 0x03, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 
-    0x00, 0x01, 0x05, 0x3E, 0x00, 0xF0, 0x07, 0x02, 0x03, 0x3C, 0x00, 0x43, 0x00, 0x3D, 0x00, 0x02, 
-    0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x11, 0x03, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 
-    0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x00, 
-    0x01, 0x00, 0x07, 0x03, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x03, 0x0A, 0x00, 
-    0x09, 0x03, 0x0A, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x05, 0x02, 0x00, 
-    0x17, 0x03, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 
-    0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x25, 0x03, 0x03, 0x00, 0x01, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 
-    0x04, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 
-    0x08, 0x00, 0x1D, 0x03, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 
-    0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 
-    0x01, 0x00, 0x0B, 0x03, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 
-    0xF0, 0x01, 0x02, 0x03, 0x03, 0x02, 0x00, 0x0B, 0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 
-    0x00, 0x05, 0x00, 0x01, 0x00, 0x21, 0x03, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x3D, 0x03, 0x01, 0x00, 0x02, 0x00, 0x01, 
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x01, 0x00, 0x05, 
-    0x03, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x03, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 
-    0x00, 0x47, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 
-    0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x81, 0x89, 0x05, 0x1B, 0x00, 
-    0x1B, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x1D, 0x00, 0x1D, 0x00, 
-    0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 
-    0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x24, 0x00, 0x20, 0x00, 0x26, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x23, 0x00, 0x23, 0x00, 0x25, 0x00, 
-    0x25, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 
-    0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2A, 0x00, 0x2A, 0x00, 0x2C, 0x00, 
-    0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x2C, 0x00, 0x29, 0x00, 
-    0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 
-    0x0E, 0x00, 0x0E, 0x00, 0x19, 0x00, 0x19, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 
-    0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 
-    0x2F, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x00, 0x0D, 0x00, 
-    0x0D, 0x00, 0x10, 0x00, 0x10, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 0x11, 0x00, 
-    0x11, 0x00, 0x11, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 
-    0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x15, 0x00, 
-    0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x18, 0x00, 0x18, 0x00, 0x17, 0x00, 0x17, 0x00, 
-    0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 
-    0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x33, 0x00, 0x33, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x32, 0x00, 
-    0x32, 0x00, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x36, 0x00, 
-    0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 
-    0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 
-    0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0A, 0x00, 
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x00, 
-    0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x61, 0x23, 0x20, 0x11, 0x23, 0x20, 0x10, 0x80, 0xB2, 
-    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2C, 
-    0x20, 0x67, 0x6F, 0x74, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 
-    0x64, 0x00, 0x25, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6E, 
-    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x25, 0x73, 0x20, 0x72, 0x65, 0x71, 
-    0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 
-    0x74, 0x00, 0x25, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6E, 
-    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x25, 0x73, 0x20, 0x72, 0x65, 0x71, 
-    0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
-    0x6E, 0x74, 0x73, 0x00, 0x25, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 
-    0x74, 0x77, 0x6F, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x55, 0x6E, 
-    0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x27, 0x25, 
-    0x73, 0x27, 0x10, 0x2E, 0x42, 0x61, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
-    0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x27, 0x25, 0x73, 0x27, 0x00, 
-    0x4F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x28, 0x25, 
-    0x73, 0x29, 0x10, 0x11, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 
-    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00, 0x34, 0x88, 0x05, 0x23, 0x20, 0x48, 0x6F, 0x6C, 0x79, 0x20, 
-    0x73, 0x6D, 0x6F, 0x6B, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x79, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 
-    0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x21, 0x20, 0x20, 0x49, 0x27, 0x6D, 0x20, 0x74, 0x6F, 0x74, 
-    0x61, 0x6C, 0x6C, 0x79, 0x20, 0x77, 0x65, 0x64, 0x67, 0x65, 0x64, 0x2E, 0x0D, 0x10, 0x01, 0x53, 
-    0x00, 0x01, 0x03, 0x43, 0x0D, 0x03, 0x25, 0x73, 0x5F, 0x5F, 0x25, 0x64, 0x25, 0x73, 0x25, 0x73, 
-    0x25, 0x73, 0x46, 0x00, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x25, 0x64, 0x25, 0x73, 0x53, 0x46, 
-    0x16, 0x5F, 0x5F, 0x64, 0x6C, 0x5F, 0x5F, 0x25, 0x64, 0x25, 0x73, 0x53, 0x46, 0x10, 0x01, 0x43, 
-    0x02, 0x03, 0x25, 0x73, 0x50, 0x46, 0x1F, 0x54, 0x25, 0x64, 0x00, 0x4E, 0x25, 0x64, 0x25, 0x73, 
-    0x00, 0x4E, 0x25, 0x64, 0x25, 0x73, 0x00, 0x76, 0x00, 0x5F, 0x00, 0x4E, 0x65, 0x77, 0x00, 0x44, 
-    0x65, 0x6C, 0x65, 0x74, 0x65, 0x1D, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 
-    0x77, 0x00, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 
-    0x10, 0x62, 0x25, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4E, 0x65, 0x77, 0x09, 0x09, 0x09, 0x61, 
-    0x73, 0x63, 0x69, 0x7A, 0x5F, 0x5F, 0x25, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x69, 0x73, 
-    0x70, 0x61, 0x74, 0x63, 0x68, 0x09, 0x25, 0x64, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x65, 0x6C, 
-    0x65, 0x74, 0x65, 0x09, 0x25, 0x64, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x69, 0x73, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x09, 0x25, 0x64, 0x0D, 0x00, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x2A, 0x20, 0x25, 
-    0x73, 0x20, 0x3A, 0x3A, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x6E, 0x65, 
-    0x77, 0x20, 0x28, 0x20, 0x13, 0x20, 0x29, 0x0D, 0x00, 0x7B, 0x0D, 0x10, 0x28, 0x09, 0x2F, 0x2F, 
-    0xA5, 0xA5, 0xA5, 0xA5, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 
-    0x6E, 0x65, 0x77, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x72, 
-    0x65, 0x0D, 0x00, 0x7D, 0x0D, 0x10, 0x24, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x25, 0x73, 0x20, 0x3A, 
-    0x3A, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 
-    0x65, 0x20, 0x28, 0x20, 0x00, 0x20, 0x29, 0x0D, 0x00, 0x7B, 0x0D, 0x10, 0x28, 0x09, 0x2F, 0x2F, 
-    0xA5, 0xA5, 0xA5, 0xA5, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 
-    0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 
-    0x68, 0x65, 0x72, 0x65, 0x0D, 0x11, 0x7D, 0x0D, 0x16, 0x20, 0x25, 0x73, 0x20, 0x3A, 0x3A, 0x20, 
-    0x25, 0x73, 0x20, 0x28, 0x20, 0x13, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x2F, 0x20, 0x29, 0x25, 
-    0x73, 0x0D, 0x7B, 0x0D, 0x00, 0x09, 0x00, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x00, 0x3A, 
-    0x3A, 0x25, 0x73, 0x20, 0x28, 0x20, 0x00, 0x20, 0x29, 0x3B, 0x0D, 0x10, 0x2E, 0x09, 0x2F, 0x2F, 
-    0xA5, 0xA5, 0xA5, 0xA5, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 
-    0x63, 0x6F, 0x64, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 
-    0x25, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0D, 0x00, 0x7D, 0x0D, 0x1C, 0x76, 0x6F, 0x69, 0x64, 
-    0x20, 0x2A, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x6E, 0x65, 0x77, 0x20, 
-    0x28, 0x00, 0x29, 0x3B, 0x1B, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 
-    0x6F, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x28, 0x20, 0x1C, 0x20, 0x29, 0x3B, 0x00, 
-    0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x00, 0x20, 0x25, 0x73, 0x20, 0x28, 0x00, 0x20, 0x63, 
-    0x6F, 0x6E, 0x73, 0x74, 0x22, 0x29, 0x25, 0x73, 0x3B, 0x12, 0x76, 0x6F, 0x69, 0x64, 0x11, 0x2C, 
-    0x20, 0x13, 0x20, 0x3D, 0x20, 0x25, 0x73, 0x20, 0x10, 0x44, 0x2F, 0x2A, 0x09, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x10, 0x20, 
-    0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2A, 0x09, 0x25, 0x73, 0x2C, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 
-    0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x0D, 
-    0x10, 0x2A, 0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x4D, 0x4F, 0x4E, 0x49, 0x54, 0x4F, 
-    0x52, 0x20, 0x25, 0x73, 0x20, 0x3A, 0x20, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x20, 0x25, 0x73, 
-    0x20, 0x0D, 0x7B, 0x0D, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x3A, 0x0D, 0x10, 0x7C, 0x09, 0x50, 
-    0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x5F, 0x49, 0x4D, 0x50, 0x4C, 0x5F, 0x48, 0x45, 0x41, 
-    0x44, 0x45, 0x52, 0x5F, 0x4D, 0x41, 0x43, 0x52, 0x4F, 0x28, 0x25, 0x73, 0x29, 0x3B, 0x09, 0x09, 
-    0x09, 0x2F, 0x2F, 0x20, 0x6D, 0x61, 0x67, 0x69, 0x63, 0x20, 0x73, 0x74, 0x75, 0x66, 0x66, 0x2C, 
-    0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x0D, 0x00, 0x09, 0x00, 
-    0x0D, 0x00, 0x7D, 0x3B, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x41, 0x43, 0x52, 0x4F, 
-    0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x09, 0x09, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 
-    0x72, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x24, 0x6D, 0x61, 0x78, 0x4D, 0x65, 0x74, 0x68, 0x73, 
-    0x2C, 0x20, 0x24, 0x6D, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0D, 0x10, 0x80, 0xCE, 0x09, 0x09, 0x09, 
-    0x54, 0x53, 0x54, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x52, 0x31, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 
-    0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2D, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x73, 0x65, 0x6C, 
-    0x65, 0x63, 0x74, 0x6F, 0x72, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x4D, 0x49, 0x09, 0x09, 0x25, 
-    0x25, 0x46, 0x31, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x43, 0x4D, 0x50, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x23, 0x24, 0x6D, 0x61, 0x78, 0x4D, 0x65, 0x74, 
-    0x68, 0x73, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x47, 0x45, 0x09, 
-    0x09, 0x25, 0x25, 0x46, 0x31, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x53, 0x54, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x32, 0x2C, 0x52, 
-    0x31, 0x34, 0x7D, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x72, 0x65, 0x73, 
-    0x75, 0x6C, 0x74, 0x2D, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x4C, 0x4B, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x30, 0x2C, 
-    0x23, 0x34, 0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x2D, 0x3E, 0x20, 0x74, 
-    0x72, 0x75, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x0D, 0x10, 0x76, 0x09, 0x09, 0x09, 
-    0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x50, 0x43, 0x2C, 0x23, 0x24, 0x6D, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x2D, 0x2E, 0x2D, 0x38, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x32, 0x20, 
-    0x2D, 0x3E, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x62, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x52, 0x31, 0x32, 
-    0x2C, 0x52, 0x31, 0x2C, 0x4C, 0x53, 0x4C, 0x20, 0x23, 0x33, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 
-    0x32, 0x20, 0x2D, 0x3E, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x27, 0x73, 0x20, 0x3C, 0x61, 
-    0x72, 0x67, 0x63, 0x6F, 0x70, 0x79, 0x2F, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x3E, 0x20, 0x70, 0x61, 
-    0x69, 0x72, 0x0D, 0x10, 0x36, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x31, 0x34, 
-    0x2C, 0x50, 0x43, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x61, 0x72, 0x72, 0x61, 0x6E, 0x67, 
-    0x65, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x74, 0x20, 0x4C, 
-    0x44, 0x4D, 0x45, 0x41, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x0D, 0x10, 0x54, 0x3B, 0x09, 0x09, 
-    0x2D, 0x2D, 0x2D, 0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x70, 0x75, 0x74, 0x20, 0x61, 0x6E, 
-    0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x32, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x72, 0x67, 0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20, 
-    0x74, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 
-    0x0D, 0x10, 0x4E, 0x3B, 0x09, 0x09, 0x2D, 0x2D, 0x2D, 0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 
-    0x70, 0x75, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x65, 0x72, 
-    0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 0x33, 0x2C, 0x52, 
-    0x31, 0x33, 0x2C, 0x23, 0x38, 0x2A, 0x34, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x61, 0x73, 0x73, 0x75, 
-    0x6D, 0x65, 0x73, 0x20, 0x38, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x61, 0x72, 0x67, 0x73, 
-    0x0D, 0x10, 0x36, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x4D, 0x49, 0x41, 0x09, 0x52, 0x31, 0x33, 0x21, 
-    0x2C, 0x7B, 0x52, 0x32, 0x2C, 0x52, 0x31, 0x34, 0x7D, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 
-    0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2D, 0x70, 0x6F, 0x69, 
-    0x6E, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x4C, 0x4B, 0x0D, 0x10, 0x80, 0x90, 0x09, 0x09, 0x09, 0x53, 
-    0x54, 0x52, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x32, 0x5D, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x23, 0x30, 0x09, 0x09, 0x09, 
-    0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 
-    0x73, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 
-    0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
-    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x0D, 0x00, 0x0D, 0x00, 
-    0x31, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x23, 0x2D, 0x31, 0x09, 
-    0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x0D, 0x1B, 0x09, 0x09, 0x09, 
-    0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x0D, 0x14, 0x09, 0x09, 0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x10, 0x2C, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x20, 
-    0x25, 0x64, 0x2C, 0x5F, 0x5F, 0x6D, 0x62, 0x74, 0x5F, 0x5F, 0x25, 0x73, 0x0D, 0x00, 0x0D, 0x00, 
-    0x5F, 0x5F, 0x6D, 0x62, 0x74, 0x5F, 0x5F, 0x25, 0x73, 0x0D, 0x1C, 0x09, 0x09, 0x09, 0x42, 0x09, 
-    0x09, 0x7C, 0x61, 0x72, 0x67, 0x63, 0x6F, 0x70, 0x79, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
-    0x74, 0x7C, 0x0D, 0x1F, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x25, 0x73, 0x7C, 0x0D, 0x00, 
-    0x0D, 0x00, 0x61, 0x72, 0x67, 0x63, 0x6F, 0x70, 0x79, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
-    0x74, 0x0D, 0x10, 0x80, 0x9A, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x33, 0x2C, 
-    0x23, 0x38, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x28, 0xA5, 0x61, 0x73, 0x73, 0x75, 0x6D, 
-    0x65, 0x20, 0x38, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 
-    0x63, 0x6B, 0x29, 0x0D, 0x00, 0x0D, 0x00, 0x43, 0x6F, 0x70, 0x79, 0x4E, 0x41, 0x72, 0x67, 0x73, 
-    0x09, 0x53, 0x55, 0x42, 0x09, 0x09, 0x52, 0x31, 0x33, 0x2C, 0x52, 0x31, 0x33, 0x2C, 0x52, 0x33, 
-    0x2C, 0x4C, 0x53, 0x4C, 0x20, 0x23, 0x32, 0x09, 0x09, 0x3B, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 
-    0x72, 0x6F, 0x6F, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x61, 
-    0x72, 0x67, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x32, 0x2C, 
-    0x52, 0x32, 0x2C, 0x23, 0x31, 0x36, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x32, 0x20, 0x2D, 
-    0x3E, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x61, 0x72, 0x67, 0x73, 0x0D, 0x10, 
-    0x6E, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x25, 0x25, 0x46, 0x32, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x0D, 0x00, 0x31, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x5B, 
-    0x52, 0x32, 0x2C, 0x52, 0x33, 0x2C, 0x4C, 0x53, 0x4C, 0x20, 0x23, 0x32, 0x5D, 0x09, 0x09, 0x3B, 
-    0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 
-    0x74, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x53, 0x54, 0x52, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x5B, 0x52, 
-    0x31, 0x33, 0x2C, 0x52, 0x33, 0x2C, 0x4C, 0x53, 0x4C, 0x20, 0x23, 0x32, 0x5D, 0x09, 0x09, 0x3B, 
-    0x20, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x0D, 0x10, 
-    0x80, 0x94, 0x32, 0x09, 0x09, 0x09, 0x53, 0x55, 0x42, 0x53, 0x09, 0x52, 0x33, 0x2C, 0x52, 0x33, 
-    0x2C, 0x23, 0x31, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6C, 0x6F, 
-    0x77, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x50, 0x4C, 0x09, 0x09, 
-    0x25, 0x25, 0x42, 0x31, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x53, 
-    0x55, 0x42, 0x09, 0x09, 0x52, 0x32, 0x2C, 0x52, 0x32, 0x2C, 0x23, 0x31, 0x32, 0x09, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x52, 0x32, 0x20, 0x2D, 0x3E, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 
-    0x72, 0x20, 0x61, 0x72, 0x67, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x4D, 0x49, 0x41, 
-    0x09, 0x52, 0x32, 0x2C, 0x7B, 0x52, 0x31, 0x2C, 0x52, 0x32, 0x2C, 0x52, 0x33, 0x7D, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 
-    0x20, 0x61, 0x72, 0x67, 0x73, 0x0D, 0x10, 0x30, 0x09, 0x09, 0x09, 0x41, 0x44, 0x44, 0x09, 0x09, 
-    0x50, 0x43, 0x2C, 0x52, 0x31, 0x32, 0x2C, 0x23, 0x34, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x6A, 
-    0x75, 0x6D, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 
-    0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x0D, 0x10, 0x20, 0x0D, 0x00, 0x3B, 0x2B, 0x0D, 0x00, 
-    0x3B, 0x20, 0x20, 0x43, 0x68, 0x65, 0x65, 0x7A, 0x79, 0x20, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 
-    0x72, 0x20, 0x47, 0x6C, 0x75, 0x65, 0x0D, 0x00, 0x3B, 0x0D, 0x10, 0x74, 0x3B, 0x09, 0x41, 0x72, 
-    0x67, 0x20, 0x70, 0x75, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 
-    0x20, 0x6F, 0x70, 0x74, 0x69, 0x6D, 0x69, 0x7A, 0x65, 0x64, 0x2E, 0x20, 0x20, 0x4E, 0x6F, 0x6E, 
-    0x2D, 0x33, 0x32, 0x2D, 0x62, 0x69, 0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
-    0x73, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 
-    0x20, 0x6E, 0x6F, 0x74, 0x0D, 0x00, 0x3B, 0x09, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 
-    0x64, 0x2E, 0x20, 0x20, 0x5B, 0x41, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 
-    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x41, 0x6C, 0x70, 0x68, 0x61, 0x5D, 0x2E, 0x0D, 
-    0x11, 0x3B, 0x0D, 0x10, 0x3C, 0x3B, 0x2D, 0x0D, 0x00, 0x0D, 0x00, 0x6B, 0x52, 0x65, 0x73, 0x65, 
-    0x72, 0x76, 0x65, 0x64, 0x09, 0x45, 0x51, 0x55, 0x09, 0x09, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x2C, 0x20, 0x7A, 0x65, 0x72, 
-    0x6F, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
-    0x0D, 0x10, 0x26, 0x6B, 0x54, 0x68, 0x69, 0x73, 0x50, 0x74, 0x72, 0x09, 0x45, 0x51, 0x55, 0x09, 
-    0x09, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x2D, 0x3E, 0x20, 0x74, 0x72, 0x75, 
-    0x65, 0x20, 0x22, 0x74, 0x68, 0x69, 0x73, 0x22, 0x0D, 0x10, 0x2A, 0x6B, 0x42, 0x54, 0x61, 0x62, 
-    0x6C, 0x65, 0x50, 0x74, 0x72, 0x09, 0x45, 0x51, 0x55, 0x09, 0x09, 0x38, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x09, 0x3B, 0x20, 0x2D, 0x3E, 0x20, 0x42, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 
-    0x20, 0x75, 0x73, 0x65, 0x0D, 0x10, 0x80, 0xEE, 0x6B, 0x4F, 0x62, 0x6A, 0x49, 0x44, 0x09, 0x09, 
-    0x45, 0x51, 0x55, 0x09, 0x09, 0x31, 0x32, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x6B, 
-    0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x2C, 
-    0x20, 0x6F, 0x72, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x6B, 0x4D, 
-    0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x53, 0x57, 
-    0x49, 0x09, 0x45, 0x51, 0x55, 0x09, 0x32, 0x37, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 
-    0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x52, 
-    0x4F, 0x4D, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 0x7C, 0x44, 
-    0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x5F, 0x5F, 0x39, 
-    0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x7C, 0x0D, 0x00, 0x0D, 0x00, 
-    0x3B, 0x09, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x0D, 0x00, 0x3B, 0x0D, 0x1C, 0x3B, 0x09, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 
-    0x20, 0x67, 0x6C, 0x75, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x0D, 0x11, 
-    0x3B, 0x0D, 0x1D, 0x3B, 0x09, 0x4F, 0x6E, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x3A, 0x09, 0x52, 
-    0x30, 0x09, 0x09, 0x2D, 0x3E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x0D, 0x1B, 0x3B, 0x09, 
-    0x09, 0x09, 0x09, 0x52, 0x31, 0x32, 0x09, 0x09, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 
-    0x74, 0x6F, 0x72, 0x0D, 0x1F, 0x3B, 0x09, 0x09, 0x09, 0x09, 0x53, 0x50, 0x09, 0x09, 0x2D, 0x3E, 
-    0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 
-    0x74, 0x73, 0x0D, 0x11, 0x3B, 0x0D, 0x18, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x44, 0x69, 
-    0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x0D, 0x10, 0x2C, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 
-    0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x30, 0x2C, 0x23, 0x6B, 0x4F, 0x62, 0x6A, 0x49, 0x44, 0x5D, 
-    0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x3D, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 
-    0x72, 0x20, 0x49, 0x44, 0x0D, 0x10, 0x2A, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 
-    0x31, 0x2C, 0x52, 0x31, 0x32, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x20, 0x3D, 
-    0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 
-    0x0D, 0x10, 0x80, 0xC8, 0x09, 0x09, 0x09, 0x53, 0x55, 0x42, 0x09, 0x09, 0x52, 0x31, 0x33, 0x2C, 
-    0x52, 0x31, 0x33, 0x2C, 0x23, 0x34, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x6D, 0x61, 0x6B, 0x65, 
-    0x20, 0x72, 0x6F, 0x6F, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 
-    0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x32, 0x2C, 0x52, 0x31, 0x33, 
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x32, 0x20, 0x2D, 0x3E, 0x20, 0x72, 0x65, 0x73, 
-    0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x61, 0x72, 0x67, 
-    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x53, 0x57, 0x49, 0x09, 0x09, 
-    0x6B, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 
-    0x53, 0x57, 0x49, 0x09, 0x09, 0x3B, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 
-    0x74, 0x6F, 0x72, 0x20, 0x28, 0x53, 0x57, 0x49, 0x20, 0x32, 0x37, 0x29, 0x0D, 0x00, 0x09, 0x09, 
-    0x09, 0x54, 0x53, 0x54, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x52, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x64, 0x69, 0x64, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x63, 0x61, 
-    0x6C, 0x6C, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x65, 0x64, 0x3F, 0x0D, 0x10, 0x80, 0xA0, 0x09, 
-    0x09, 0x09, 0x42, 0x4E, 0x45, 0x09, 0x09, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x43, 0x61, 
-    0x6C, 0x6C, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x09, 0x3B, 0x20, 0x6E, 0x6F, 
-    0x2C, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 
-    0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4C, 0x44, 0x52, 0x09, 
-    0x09, 0x52, 0x30, 0x2C, 0x5B, 0x52, 0x31, 0x33, 0x5D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 
-    0x30, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 
-    0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x41, 0x44, 0x44, 0x09, 0x09, 0x52, 0x31, 0x33, 0x2C, 0x52, 0x31, 0x33, 0x2C, 0x23, 0x31, 0x36, 
-    0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x75, 0x70, 0x20, 0x73, 
-    0x74, 0x75, 0x66, 0x66, 0x20, 0x77, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x0D, 0x10, 
-    0x30, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 
-    0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x6F, 0x6F, 0x67, 0x69, 
-    0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 
-    0x0D, 0x10, 0x4A, 0x0D, 0x00, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x43, 0x61, 0x6C, 0x6C, 
-    0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 
-    0x56, 0x09, 0x09, 0x52, 0x31, 0x2C, 0x23, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x54, 
-    0x68, 0x72, 0x6F, 0x77, 0x28, 0x22, 0x65, 0x76, 0x74, 0x2E, 0x65, 0x78, 0x2E, 0x6D, 0x6F, 0x6E, 
-    0x63, 0x61, 0x6C, 0x6C, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0D, 0x10, 0x50, 0x09, 
-    0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x32, 0x2C, 0x23, 0x30, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 0x2C, 
-    0x50, 0x43, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x3B, 0x09, 0x09, 0x2D, 0x2D, 
-    0x2D, 0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x70, 0x75, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x74, 
-    0x68, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x65, 0x72, 0x65, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x10, 
-    0x38, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x0D, 0x00, 0x3B, 0x09, 0x09, 0x2D, 0x2D, 0x2D, 0x20, 0x64, 0x6F, 0x6E, 0x27, 
-    0x74, 0x20, 0x70, 0x75, 0x74, 0x20, 0x61, 0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x68, 
-    0x65, 0x72, 0x65, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x10, 0x78, 0x09, 0x09, 0x09, 0x44, 0x43, 
-    0x42, 0x09, 0x09, 0x22, 0x65, 0x76, 0x74, 0x2E, 0x65, 0x78, 0x2E, 0x6D, 0x6F, 0x6E, 0x63, 0x61, 
-    0x6C, 0x6C, 0x22, 0x2C, 0x30, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x4C, 
-    0x49, 0x47, 0x4E, 0x09, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x0D, 0x00, 0x0D, 
-    0x00, 0x3B, 0x2B, 0x0D, 0x00, 0x3B, 0x20, 0x20, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 
-    0x72, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 
-    0x63, 0x68, 0x20, 0x28, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x67, 0x65, 0x61, 
-    0x6C, 0x65, 0x64, 0x20, 0x67, 0x6C, 0x75, 0x65, 0x20, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x29, 0x0D, 
-    0x00, 0x3B, 0x0D, 0x10, 0x2C, 0x3B, 0x2D, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x41, 0x43, 0x52, 
-    0x4F, 0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x09, 0x09, 0x43, 0x61, 0x6C, 0x6C, 0x4D, 
-    0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x24, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 
-    0x0D, 0x10, 0x2E, 0x09, 0x09, 0x09, 0x53, 0x54, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 
-    0x2C, 0x7B, 0x52, 0x31, 0x2D, 0x52, 0x33, 0x7D, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x70, 0x75, 0x73, 
-    0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x72, 0x65, 0x67, 0x20, 0x61, 0x72, 0x67, 0x73, 
-    0x0D, 0x10, 0x2A, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x23, 
-    0x24, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 
-    0x32, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x0D, 0x10, 0x26, 0x09, 
-    0x09, 0x09, 0x42, 0x09, 0x09, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x44, 0x69, 0x73, 0x70, 
-    0x61, 0x74, 0x63, 0x68, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x67, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x70, 
-    0x61, 0x74, 0x63, 0x68, 0x0D, 0x14, 0x09, 0x09, 0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x10, 0x26, 
-    0x0D, 0x00, 0x3B, 0x2B, 0x0D, 0x00, 0x3B, 0x20, 0x20, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x74, 
-    0x6F, 0x20, 0x6D, 0x75, 0x72, 0x64, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 
-    0x6F, 0x72, 0x0D, 0x00, 0x3B, 0x0D, 0x10, 0x2E, 0x3B, 0x2D, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 
-    0x41, 0x43, 0x52, 0x4F, 0x0D, 0x00, 0x24, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x09, 0x09, 0x44, 0x65, 
-    0x6C, 0x65, 0x74, 0x65, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x09, 0x24, 0x73, 0x65, 0x6C, 
-    0x65, 0x63, 0x74, 0x6F, 0x72, 0x0D, 0x10, 0x50, 0x09, 0x09, 0x09, 0x53, 0x54, 0x4D, 0x46, 0x44, 
-    0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x31, 0x34, 0x7D, 0x09, 0x09, 0x09, 0x09, 0x3B, 
-    0x20, 0x70, 0x75, 0x73, 0x68, 0x20, 0x4C, 0x4B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x53, 0x54, 0x4D, 
-    0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x31, 0x2D, 0x52, 0x33, 0x7D, 0x09, 
-    0x09, 0x09, 0x3B, 0x20, 0x70, 0x75, 0x73, 0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x72, 
-    0x65, 0x67, 0x20, 0x61, 0x72, 0x67, 0x73, 0x0D, 0x10, 0x2A, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 
-    0x09, 0x09, 0x52, 0x31, 0x32, 0x2C, 0x23, 0x24, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 
-    0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x31, 0x32, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 
-    0x74, 0x6F, 0x72, 0x0D, 0x10, 0x4C, 0x09, 0x09, 0x09, 0x42, 0x4C, 0x09, 0x09, 0x4D, 0x6F, 0x6E, 
-    0x69, 0x74, 0x6F, 0x72, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x09, 0x09, 0x09, 0x3B, 
-    0x20, 0x67, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x0D, 0x00, 0x09, 0x09, 
-    0x09, 0x4C, 0x44, 0x4D, 0x46, 0x44, 0x09, 0x52, 0x31, 0x33, 0x21, 0x2C, 0x7B, 0x52, 0x31, 0x34, 
-    0x7D, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x4C, 
-    0x4B, 0x0D, 0x10, 0x4A, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x44, 0x65, 0x73, 0x74, 0x72, 0x6F, 
-    0x79, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x09, 0x3B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 
-    0x20, 0x6D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x69, 0x6E, 0x67, 0x20, 
-    0x62, 0x61, 0x63, 0x6B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x45, 0x4E, 0x44, 0x0D, 0x10, 0x52, 
-    0x0D, 0x00, 0x3B, 0x20, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x00, 0x0D, 0x00, 0x61, 0x73, 0x63, 0x69, 0x7A, 0x5F, 0x5F, 0x25, 
-    0x73, 0x0D, 0x10, 0x24, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x50, 
-    0x43, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x2D, 0x3E, 0x20, 0x61, 0x73, 0x63, 
-    0x69, 0x7A, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x0D, 0x1E, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 
-    0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x62, 0x65, 0x67, 
-    0x6F, 0x6E, 0x65, 0x21, 0x0D, 0x10, 0x56, 0x09, 0x09, 0x09, 0x44, 0x43, 0x42, 0x09, 0x09, 0x22, 
-    0x25, 0x73, 0x22, 0x2C, 0x30, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x4C, 0x49, 0x47, 0x4E, 0x09, 
-    0x34, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x45, 0x58, 0x50, 0x4F, 0x52, 0x54, 0x09, 0x7C, 
-    0x25, 0x73, 0x7C, 0x0D, 0x00, 0x25, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4E, 0x65, 0x77, 0x09, 
-    0x09, 0x09, 0x61, 0x73, 0x63, 0x69, 0x7A, 0x5F, 0x5F, 0x25, 0x73, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x4D, 0x4F, 0x56, 0x09, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x0D, 0x1A, 0x09, 0x09, 
-    0x09, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x20, 0x25, 
-    0x64, 0x0D, 0x19, 0x09, 0x09, 0x09, 0x43, 0x61, 0x6C, 0x6C, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 
-    0x72, 0x20, 0x25, 0x64, 0x0D, 0x10, 0x01, 0x0D, 0x01, 0x0F, 0x04, 0x6A, 0x30, 0xF0, 0x02, 0x0A, 
-    0x04, 0xD2, 0x04, 0x72, 0x04, 0x7A, 0x04, 0x9A, 0x04, 0xAA, 0x04, 0xA2, 0x04, 0xB2, 0x04, 0xBA, 
-    0x04, 0x92, 0x04, 0x82, 0xA3, 0x20, 0x3D, 0x20, 0x25, 0x73, 0x20, 0x10, 0x44, 0x2F, 0x2A, 0x09, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x0D, 0x10, 0x20, 0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2A, 0x09, 0x25, 0x73, 0x2C, 0x20, 0x69, 0x6D, 
-    0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 
-    0x25, 0x73, 0x0D, 0x10, 0x80, 0xB8, 0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x50, 0x52, 
-    0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x20, 0x25, 0x73, 0x20, 0x3A, 0x20, 0x70, 0x75, 0x62, 0x6C, 
-    0x69, 0x63, 0x20, 0x25, 0x73, 0x20, 0x0D, 0x7B, 0x0D, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x3A, 
-    0x0D, 0x00, 0x09, 0x50, 0x52, 0x4F, 0x54, 0x4F, 0x43, 0x4F, 0x4C, 0x5F, 0x49, 0x4D, 0x50, 0x4C, 
-    0x5F, 0x48, 0x45, 0x41, 0x44, 0x45, 0x52, 0x5F, 0x4D, 0x41, 0x43, 0x52, 0x4F, 0x28, 0x25, 0x73, 
-    0x29, 0x3B, 0x09, 0x09, 0x09, 0x2F, 0x2F, 0x20, 0x6D, 0x61, 0x67, 0x69, 0x63, 0x20, 0x73, 0x74, 
-    0x75, 0x66, 0x66, 0x2C, 0x20, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
-    0x0D, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x7D, 0x3B, 0x0D, 0x00, 0x2F, 0x2A, 0x09, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x18, 0x2A, 
-    0x2A, 0x0D, 0x00, 0x2A, 0x2A, 0x09, 0x25, 0x73, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x20, 0x0D, 0x10, 
-    0x4E, 0x2A, 0x2A, 0x0D, 0x00, 0x2A, 0x2F, 0x0D, 0x00, 0x0D, 0x00, 0x50, 0x52, 0x4F, 0x54, 0x4F, 
-    0x43, 0x4F, 0x4C, 0x5F, 0x49, 0x4D, 0x50, 0x4C, 0x5F, 0x53, 0x4F, 0x55, 0x52, 0x43, 0x45, 0x5F, 
-    0x4D, 0x41, 0x43, 0x52, 0x4F, 0x28, 0x25, 0x73, 0x29, 0x09, 0x09, 0x09, 0x2F, 0x2A, 0x20, 0x6D, 
-    0x61, 0x67, 0x69, 0x63, 0x20, 0x73, 0x74, 0x75, 0x66, 0x66, 0x2C, 0x20, 0x64, 0x6F, 0x20, 0x6E, 
-    0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x2A, 0x2F, 0x0D, 0x00, 0x0D, 0x0D, 0x11, 
-    0x0D, 0x0D, 0x10, 0x7E, 0x3B, 0x20, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x45, 0x58, 0x50, 
-    0x4F, 0x52, 0x54, 0x09, 0x7C, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 
-    0x25, 0x73, 0x53, 0x46, 0x76, 0x7C, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 
-    0x54, 0x09, 0x7C, 0x53, 0x69, 0x7A, 0x65, 0x6F, 0x66, 0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 0x76, 
-    0x7C, 0x0D, 0x10, 0x74, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 0x7C, 0x4F, 
-    0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 
-    0x76, 0x7C, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x49, 0x4D, 0x50, 0x4F, 0x52, 0x54, 0x09, 
-    0x7C, 0x25, 0x73, 0x7C, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x3B, 0x20, 0x54, 0x43, 0x6C, 0x61, 
-    0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 0x3A, 0x0D, 0x00, 0x0D, 0x00, 
-    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x5F, 0x5F, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 
-    0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 0x76, 0x0D, 0x10, 0x80, 0xCC, 0x09, 0x09, 0x09, 0x44, 0x43, 
-    0x44, 0x09, 0x09, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x28, 0x72, 0x65, 
-    0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6E, 0x6F, 0x77, 0x29, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x7C, 0x5F, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 
-    0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x20, 0x2D, 0x20, 0x2E, 0x09, 0x09, 0x3B, 
-    0x20, 0x53, 0x52, 0x4F, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
-    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 
-    0x44, 0x43, 0x44, 0x09, 0x09, 0x7C, 0x5F, 0x5F, 0x70, 0x72, 0x6F, 0x74, 0x6E, 0x61, 0x6D, 0x65, 
-    0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x20, 0x2D, 0x20, 0x2E, 0x09, 0x09, 0x3B, 0x20, 0x53, 0x52, 0x4F, 
-    0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 
-    0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x7C, 0x5F, 0x5F, 0x63, 0x61, 
-    0x70, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x20, 0x2D, 0x20, 0x2E, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 
-    0x53, 0x52, 0x4F, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 
-    0x79, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x0D, 0x10, 0x81, 0x08, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 
-    0x09, 0x09, 0x7C, 0x5F, 0x5F, 0x62, 0x74, 0x62, 0x6C, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x20, 0x2D, 
-    0x20, 0x2E, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x53, 0x52, 0x4F, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x74, 
-    0x61, 0x62, 0x6C, 0x65, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x7C, 0x5F, 
-    0x5F, 0x6D, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x20, 0x2D, 0x20, 0x2E, 
-    0x09, 0x09, 0x09, 0x3B, 0x20, 0x53, 0x52, 0x4F, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x6F, 0x6E, 0x69, 
-    0x74, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x53, 0x69, 0x7A, 0x65, 0x6F, 0x66, 0x5F, 0x5F, 0x25, 
-    0x73, 0x53, 0x46, 0x76, 0x7C, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 
-    0x68, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x6F, 0x66, 0x20, 0x67, 0x6C, 0x75, 0x65, 
-    0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 
-    0x72, 0x4E, 0x65, 0x77, 0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 0x76, 0x7C, 0x09, 0x3B, 0x20, 0x7A, 
-    0x65, 0x72, 0x6F, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 
-    0x6F, 0x20, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x0D, 0x00, 
-    0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x30, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x3B, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 
-    0x68, 0x20, 0x74, 0x6F, 0x20, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 
-    0x64, 0x0D, 0x10, 0x80, 0xA6, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x4F, 0x70, 0x65, 0x72, 
-    0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 
-    0x76, 0x7C, 0x09, 0x3B, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 
-    0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x6D, 0x65, 0x74, 
-    0x68, 0x6F, 0x64, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x30, 0x09, 0x09, 
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2C, 0x20, 0x6F, 0x72, 0x20, 
-    0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x6D, 
-    0x65, 0x74, 0x68, 0x6F, 0x64, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x4E, 0x65, 
-    0x77, 0x5F, 0x5F, 0x25, 0x73, 0x46, 0x76, 0x7C, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 
-    0x72, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 
-    0x20, 0x4E, 0x65, 0x77, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x29, 0x0D, 0x10, 0x6A, 0x09, 0x09, 0x09, 
-    0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 
-    0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 
-    0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x4E, 0x65, 0x77, 0x28, 0x76, 0x6F, 0x69, 0x64, 
-    0x29, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 
-    0x5F, 0x5F, 0x25, 0x73, 0x46, 0x76, 0x7C, 0x09, 0x09, 0x3B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
-    0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 0x20, 0x74, 0x6F, 0x20, 
-    0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x0D, 0x10, 0x38, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 
-    0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x72, 
-    0x65, 0x74, 0x75, 0x72, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 
-    0x20, 0x74, 0x6F, 0x20, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x29, 
-    0x0D, 0x10, 0x42, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x26, 0x25, 0x30, 0x38, 0x6C, 
-    0x58, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 
-    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 
-    0x09, 0x26, 0x25, 0x30, 0x38, 0x6C, 0x58, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x66, 
-    0x6C, 0x61, 0x67, 0x73, 0x0D, 0x10, 0x44, 0x09, 0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x30, 
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x28, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 
-    0x65, 0x64, 0x29, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 
-    0x6E, 0x5F, 0x5F, 0x6E, 0x69, 0x6C, 0x5F, 0x5F, 0x25, 0x73, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 
-    0x28, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x29, 0x0D, 0x10, 0x4E, 0x0D, 0x00, 0x43, 
-    0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x25, 0x73, 0x53, 0x46, 0x76, 0x0D, 
-    0x00, 0x09, 0x09, 0x09, 0x41, 0x44, 0x52, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x6C, 0x6F, 0x63, 0x61, 
-    0x6C, 0x5F, 0x5F, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x25, 0x73, 
-    0x53, 0x46, 0x76, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 
-    0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x0D, 0x19, 0x0D, 0x00, 0x72, 0x65, 
-    0x74, 0x75, 0x72, 0x6E, 0x5F, 0x5F, 0x6E, 0x69, 0x6C, 0x5F, 0x5F, 0x25, 0x73, 0x0D, 0x10, 0x2C, 
-    0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 0x2C, 0x23, 0x30, 0x09, 0x09, 0x09, 
-    0x09, 0x09, 0x09, 0x3B, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x50, 0x43, 
-    0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x0D, 0x1F, 0x0D, 0x00, 0x7C, 
-    0x5F, 0x5F, 0x69, 0x6D, 0x70, 0x6C, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x09, 
-    0x44, 0x43, 0x42, 0x09, 0x22, 0x25, 0x73, 0x22, 0x2C, 0x30, 0x0D, 0x1E, 0x7C, 0x5F, 0x5F, 0x70, 
-    0x72, 0x6F, 0x74, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x09, 0x44, 0x43, 0x42, 
-    0x09, 0x22, 0x25, 0x73, 0x22, 0x2C, 0x30, 0x0D, 0x16, 0x7C, 0x5F, 0x5F, 0x63, 0x61, 0x70, 0x5F, 
-    0x5F, 0x25, 0x73, 0x7C, 0x0D, 0x10, 0x32, 0x09, 0x09, 0x09, 0x44, 0x43, 0x42, 0x20, 0x30, 0x0D, 
-    0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x4C, 0x49, 0x47, 0x4E, 0x09, 0x34, 0x0D, 0x00, 0x0D, 
-    0x00, 0x7C, 0x5F, 0x5F, 0x62, 0x74, 0x62, 0x6C, 0x5F, 0x5F, 0x25, 0x73, 0x7C, 0x0D, 0x00, 0x09, 
-    0x09, 0x09, 0x44, 0x43, 0x44, 0x09, 0x09, 0x30, 0x0D, 0x10, 0x80, 0x98, 0x09, 0x09, 0x09, 0x42, 
-    0x09, 0x09, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x5F, 0x5F, 0x25, 0x73, 0x53, 
-    0x46, 0x76, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x42, 0x09, 0x09, 0x7C, 0x25, 0x73, 0x7C, 0x0D, 0x00, 
-    0x0D, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x5F, 0x5F, 0x25, 0x64, 0x25, 0x73, 
-    0x0D, 0x00, 0x3B, 0x20, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 
-    0x2D, 0x2D, 0x2D, 0x2D, 0x0D, 0x00, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x45, 0x58, 0x50, 0x4F, 0x52, 
-    0x54, 0x09, 0x7C, 0x25, 0x73, 0x7C, 0x0D, 0x00, 0x0D, 0x00, 0x61, 0x73, 0x63, 0x69, 0x7A, 0x5F, 
-    0x5F, 0x25, 0x73, 0x0D, 0x10, 0x24, 0x09, 0x09, 0x09, 0x4D, 0x4F, 0x56, 0x09, 0x09, 0x52, 0x30, 
-    0x2C, 0x50, 0x43, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x52, 0x30, 0x20, 0x2D, 0x3E, 0x20, 0x61, 
-    0x73, 0x63, 0x69, 0x7A, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x0D, 0x1E, 0x09, 0x09, 0x09, 0x4D, 0x4F, 
-    0x56, 0x09, 0x09, 0x50, 0x43, 0x2C, 0x52, 0x31, 0x34, 0x09, 0x09, 0x09, 0x09, 0x3B, 0x20, 0x62, 
-    0x65, 0x67, 0x6F, 0x6E, 0x65, 0x21, 0x0D, 0x10, 0x56, 0x09, 0x09, 0x09, 0x44, 0x43, 0x42, 0x09, 
-    0x09, 0x22, 0x25, 0x73, 0x22, 0x2C, 0x30, 0x0D, 0x00, 0x09, 0x09, 0x09, 0x41, 0x4C, 0x49, 0x47, 
-    0x4E, 0x09, 0x34, 0x0D, 0x00, 0x0D, 0x00, 0x23, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x74, 
-    0x68, 0x6F, 0x64, 0x20, 0x00, 0x20, 0x69, 0x73, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 
-    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 
-    0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x25, 0x73, 0x0D, 0x12, 
-    0xFF, 0xFF, 0xF4, 0x6C, 0x71, 0x04, 0xCA, 0x30, 0xF0, 0x02, 0x0A, 0x04, 0xD2, 0x04, 0xDA, 0x04, 
-    0xE2, 0x04, 0x9A, 0x04, 0xAA, 0x04, 0xA2, 0x04, 0xB2, 0x04, 0xBA, 0x04, 0x92, 0x04, 0x82, 0x72, 
-    0x20, 0x25, 0x73, 0x20, 0x11, 0x28, 0x2A, 0x12, 0x5B, 0x25, 0x64, 0x5D, 0x10, 0xF0, 0x02, 0x02, 
-    0x5B, 0x5D, 0x29, 0x28, 0x10, 0x22, 0x29, 0x00, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x00, 
-    0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x00, 0x76, 0x6F, 0x6C, 0x61, 0x74, 0x69, 
-    0x6C, 0x65, 0x20, 0x00, 0x63, 0x68, 0x61, 0x72, 0x1C, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x00, 0x69, 
-    0x6E, 0x74, 0x00, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x00, 0x6C, 0x6F, 0x6E, 
-    0x67, 0x12, 0x76, 0x6F, 0x69, 0x64, 0x11, 0x25, 0x73, 0x16, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x00, 
-    0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x10, 0x22, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x64, 0x6F, 0x75, 
-    0x62, 0x6C, 0x65, 0x00, 0x2A, 0x00, 0x26, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x25, 
-    0x73, 0x00, 0x75, 0x6E, 0x69, 0x6F, 0x6E, 0x20, 0x25, 0x73, 0x10, 0xF0, 0x08, 0x02, 0x63, 0x6C, 
-    0x61, 0x73, 0x73, 0x20, 0x25, 0x73, 0x2E, 0x2E, 0x2E, 0x00, 0x5B, 0x25, 0x64, 0x5D, 0x11, 0x5B, 
-    0x5D, 0x12, 0x28, 0x2A, 0x29, 0x28, 0x10, 0x70, 0x29, 0x00, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
-    0x20, 0x00, 0x43, 0x00, 0x53, 0x00, 0x55, 0x00, 0x63, 0x00, 0x73, 0x00, 0x69, 0x00, 0x73, 0x00, 
-    0x6C, 0x00, 0x66, 0x00, 0x64, 0x00, 0x72, 0x00, 0x76, 0x00, 0x50, 0x00, 0x52, 0x00, 0x65, 0x00, 
-    0x50, 0x00, 0x23, 0x20, 0x57, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x69, 0x6E, 0x74, 
-    0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C, 0x20, 0x74, 0x79, 0x70, 
-    0x65, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x7A, 0x65, 
-    0x72, 0x6F, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x5B, 0x63, 0x61, 0x6C, 0x6C, 0x20, 
-    0x6C, 0x61, 0x6E, 0x64, 0x6F, 0x6E, 0x5D, 0x0D, 0x10, 0xF0, 0x02, 0x02, 0x25, 0x64, 0x2E, 0x68, 
-    0x13, 0x47, 0x6C, 0x75, 0x65, 0x2E, 0x61, 0x15, 0x2E, 0x69, 0x6D, 0x70, 0x6C, 0x2E, 0x68, 0x00, 
-    0x2E, 0x63, 0x13, 0x47, 0x6C, 0x75, 0x65, 0x2E, 0x61, 0x10, 0x40, 0x49, 0x6E, 0x74, 0x65, 0x72, 
-    0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28, 0x62, 0x6F, 0x67, 0x75, 0x73, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6B, 0x69, 0x6E, 0x64, 0x20, 0x25, 0x64, 0x29, 0x00, 0x23, 
-    0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x0D, 0x10, 0x20, 0x77, 0x00, 0x43, 
-    0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x75, 0x74, 
-    0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x10, 0x46, 0x49, 
-    0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x28, 0x73, 
-    0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x6A, 0x75, 0x6D, 0x70, 0x65, 0x64, 0x20, 
-    0x74, 0x68, 0x65, 0x20, 0x67, 0x75, 0x6E, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 
-    0x74, 0x6F, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x69, 0x6E, 
-    0x64, 0x20, 0x25, 0x64, 0x29, 0x14, 0x47, 0x25, 0x30, 0x34, 0x64, 0x00, 0x2C, 0x20, 0x11, 0x25, 
-    0x73, 0x12, 0x20, 0x25, 0x73, 0x20, 0x10, 0xF0, 0x1A, 0x02, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 
-    0x20, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x53, 0x74, 
-    0x72, 0x69, 0x6E, 0x67, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x72, 0x65, 0x20, 
-    0x69, 0x6E, 0x20, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x53, 0x74, 0x72, 0x43, 0x61, 0x74, 0x00, 0x17, 
-    0x84, 0x32, 0x09, 0x09, 0x09, 0x44, 0x43, 0x42, 0x09, 0x22, 0x25, 0x73, 0x22, 0x2C, 0x30, 0x00, 
-    0x2C, 0x22, 0x25, 0x73, 0x22, 0x00, 0x2C, 0x30, 0x0D, 0x40, 0x3D, 0x0A, 0xFF, 0xFF, 0x28, 0xB8, 
-    0xFF, 0xFF, 0x28, 0xD0, 0xFF, 0xFF, 0x28, 0xE8, 0xFF, 0xFF, 0x29, 0x00, 0xFF, 0xFF, 0x29, 0x48, 
-    0xFF, 0xFF, 0x29, 0x60, 0xFF, 0xFF, 0x29, 0x18, 0xFF, 0xFF, 0x29, 0x30, 0xFF, 0xFF, 0x29, 0x78, 
-    0xFF, 0xFF, 0x29, 0x90, 0xFF, 0xFF, 0x29, 0xC0, 0xFF, 0xFF, 0x29, 0xA8, 0xFF, 0xFF, 0x29, 0xD8, 
-    0xFF, 0xFF, 0x29, 0xF0, 0xFF, 0xFF, 0x2A, 0x08, 0x20, 0x3C, 0xFF, 0xFF, 0x2A, 0x20, 0xFF, 0xFF, 
-    0x2A, 0x88, 0xFF, 0xFF, 0x2A, 0xA0, 0xFF, 0xFF, 0x2A, 0xB8, 0xFF, 0xFF, 0x2A, 0xD0, 0xFF, 0xFF, 
-    0x2A, 0xE8, 0xFF, 0xFF, 0x2B, 0x00, 0xFF, 0xFF, 0x2B, 0x18, 0xFF, 0xFF, 0x2B, 0x30, 0xFF, 0xFF, 
-    0x2B, 0x48, 0xFF, 0xFF, 0x2B, 0x60, 0xFF, 0xFF, 0x2B, 0x78, 0xFF, 0xFF, 0x2B, 0x90, 0xFF, 0xFF, 
-    0x2B, 0xA8, 0xFF, 0xFF, 0x2C, 0x11, 0x02, 0x24, 0xFF, 0xFF, 0xFD, 0xC4, 0x00, 0x01, 0x13, 0x01, 
-    0x00, 0x03, 0x15, 0x02, 0x00, 0x01, 0x00, 0x03, 0x13, 0x42, 0x00, 0x02, 0x02, 0x81, 0x80, 0x46, 
-    0x53, 0x59, 0x53, 0x10, 0xF0, 0x02, 0x04, 0x03, 0x8A, 0x03, 0x92, 0x03, 0x9A, 0x03, 0xA2, 0x13, 
-    0x03, 0xAA, 0x43, 0x4F, 0x4E, 0x53, 0x10, 0xF0, 0x02, 0x04, 0x03, 0x5A, 0x03, 0x62, 0x03, 0x6A, 
-    0x03, 0x72, 0x13, 0x03, 0x7A, 0x53, 0x59, 0x53, 0x54, 0x10, 0xF0, 0x02, 0x05, 0x03, 0xB2, 0x03, 
-    0xBA, 0x03, 0xC2, 0x03, 0xCA, 0x03, 0xD2, 0x01, 0x32, 0x01, 0x4A, 0x10, 0xF0, 0x02, 0x20, 0x01, 
-    0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 
-    0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0x01, 0x4A, 0xFF, 0xFF, 0x04, 
-    0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 
-    0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x12, 0x00, 
-    0x03, 0x07, 0x01, 0x53, 0x48, 0x20, 0x09, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x0E, 0x81, 
-    0x02, 0x07, 0xFF, 0xFF, 0xFF, 0x12, 0x10, 0x00, 0x06, 0x00, 0x0C, 0x0F, 0x00, 0x04, 0x0A, 0x00, 
-    0x0C, 0x0D, 0x00, 0x04, 0x0A, 0x8A, 0xA2, 0x00, 0x02, 0x06, 0x06, 0x00, 0x02, 0x06, 0x06, 0x00, 
-    0x02, 0x3C, 0x06, 0x02, 0x02, 0x02, 0x04, 0x02, 0x06, 0x80, 0xB5, 0x00, 0x02, 0x4E, 0x06, 0x00, 
-    0x02, 0x0C, 0x04, 0x02, 0x06, 0x80, 0xDF, 0x0E, 0x03, 0x89, 0x67, 0x02, 0x00, 0x04, 0x25, 0x98, 
-    0x32, 0x00, 0x02, 0x80, 0xC7, 0x8D, 0x22, 0x42, 0x08, 0x02, 0x04, 0x00, 0x02, 0x07, 0x16, 0x00, 
-    0x02, 0x04, 0x04, 0x36, 0x04, 0x02, 0x3A, 0x02, 0x02, 0x02, 0x81, 0x06, 0x00, 0x02, 0x2E, 0x9E, 
-    0xC1, 0x00, 0x04, 0x0A, 0x84, 0x4B, 0x08, 0x00, 0x04, 0x0A, 0x83, 0x50, 0x00, 0x02, 0x0E, 0x04, 
-    0x00, 0x02, 0x0E, 0x14, 0x80, 0xE5, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 
-    0x04, 0x1A, 0x00, 0x02, 0x0F, 0x04, 0x00, 0x02, 0x0F, 0x09, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xD6, 0x6D, 0x70, 0x77, 0x64, 0x00, 0x00, 0x33, 0x66, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x04, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x14, 0x29, 0x40, 
-    0x00, 0x18, 0x28, 0xB9, 0xFF, 0xFF, 0x47, 0x42, 0x29, 0x79, 0xFF, 0xFF, 0x47, 0x3A, 0x00, 0x1C, 
-    0x29, 0x40, 0x00, 0x20, 0x29, 0x40, 0x00, 0x28, 0x29, 0x40, 0x00, 0x2C, 0x29, 0x40, 0x00, 0x24, 
-    0x29, 0x40, 0x00, 0x30, 0x29, 0x40, 0x00, 0x34, 0x29, 0x40, 0x00, 0x38, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x49, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x3C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x3A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x34, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x00, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x04, 0x29, 0x6E, 0x00, 0x10, 0x00, 0x08, 0x29, 0x6E, 
-    0x00, 0x14, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x18, 0x00, 0x14, 0x70, 0x00, 0x29, 0x40, 0x00, 0x18, 
-    0x29, 0x6E, 0x00, 0x1C, 0x00, 0x20, 0x29, 0x6E, 0x00, 0x20, 0x00, 0x24, 0x58, 0x4F, 0x20, 0x0C, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2B, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 
-    0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x50, 0x35, 0x54, 0x54, 0x79, 
-    0x70, 0x65, 0x50, 0x63, 0x50, 0x31, 0x30, 0x54, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 
-    0x72, 0x69, 0x4E, 0x32, 0x34, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x48, 0x79, 
-    0xFF, 0xFF, 0xD9, 0xFE, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xFA, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x49, 0x73, 0x4E, 0x65, 0x77, 0x5F, 0x5F, 0x39, 0x54, 
-    0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x03, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x02, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 
-    0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x49, 0x73, 0x44, 0x65, 0x6C, 
-    0x65, 0x74, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x0A, 
-    0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 
-    0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9B, 0x49, 0x73, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x4E, 0x65, 0x77, 
-    0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x16, 0x20, 0x6E, 0x00, 0x08, 
-    0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x49, 
-    0x73, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 
-    0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0xF6, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x66, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x18, 
-    0x72, 0x01, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x24, 0x20, 0x54, 0x22, 0x48, 0x22, 0x69, 0x00, 0x34, 
-    0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x54, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 
-    0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x04, 0x70, 0x01, 0x60, 0x34, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x18, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x24, 0x20, 0x54, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x54, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x49, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 
-    0x6C, 0x74, 0x4E, 0x65, 0x77, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x12, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x18, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x04, 0x70, 0x01, 0x60, 0x02, 
-    0x70, 0x00, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x49, 0x73, 0x44, 0x65, 0x66, 
-    0x61, 0x75, 0x6C, 0x74, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 
-    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x28, 0x6B, 0x00, 0x0C, 0x60, 0x06, 0x52, 0x87, 
-    0x28, 0x6C, 0x00, 0x04, 0x20, 0x0C, 0x66, 0xF6, 0x20, 0x07, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x43, 0x6F, 
-    0x75, 0x6E, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x2E, 0x2E, 0x00, 0x10, 
-    0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x18, 0x66, 0x00, 0x00, 0xCC, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x82, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x00, 0x00, 0xBC, 
-    0x2F, 0x2C, 0x00, 0x34, 0x2F, 0x2C, 0x00, 0x28, 0x2F, 0x2C, 0x00, 0x08, 0x20, 0x54, 0x2F, 0x10, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x42, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDA, 0x26, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0xF6, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x2C, 0x67, 0x28, 0x20, 0x54, 0x2F, 0x10, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDA, 0x2A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x07, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDA, 0x3E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x18, 
-    0x60, 0x38, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x16, 
-    0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x4E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x14, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x5C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x43, 0x6C, 0x69, 0x65, 0x6E, 
-    0x74, 0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x18, 0x67, 0x00, 0x00, 0xEE, 
-    0x53, 0x80, 0x67, 0x08, 0x53, 0x80, 0x67, 0x74, 0x60, 0x00, 0x02, 0x00, 0x20, 0x54, 0x2F, 0x10, 
-    0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x6C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x08, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x8A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x8E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0x92, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0xB8, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x40, 0x60, 0x00, 0x01, 0x90, 0x20, 0x54, 0x2F, 0x10, 
-    0x48, 0x79, 0xFF, 0xFF, 0xDA, 0xBC, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x08, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0xDA, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0xDE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDA, 0xE2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x40, 0x60, 0x00, 0x01, 0x20, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x26, 0x6C, 0x00, 0x04, 0x0C, 0x93, 0x00, 0x03, 0x00, 0x00, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 
-    0x20, 0x2B, 0x00, 0x10, 0x60, 0x02, 0x20, 0x0B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 
-    0x2F, 0x2C, 0x00, 0x08, 0x20, 0x54, 0x2F, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x10, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x47, 0x5C, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x08, 0x28, 
-    0x4A, 0xAC, 0x00, 0x28, 0x67, 0x0A, 0x41, 0xF9, 0xFF, 0xFF, 0xDB, 0x1E, 0x20, 0x08, 0x60, 0x08, 
-    0x41, 0xF9, 0xFF, 0xFF, 0xDB, 0x26, 0x20, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x28, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x5C, 
-    0x4F, 0xEF, 0x00, 0x38, 0x67, 0x6A, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x30, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x20, 0x6C, 0x00, 0x04, 0x70, 0x01, 0xB0, 0x90, 0x50, 0x4F, 
-    0x67, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x32, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x3A, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x92, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x42, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x60, 0x18, 
-    0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x48, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x74, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 
-    0x72, 0x43, 0x6F, 0x64, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x11, 0x18, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x18, 0x67, 0x00, 
-    0x00, 0x86, 0x53, 0x80, 0x67, 0x08, 0x53, 0x80, 0x67, 0x40, 0x60, 0x00, 0x01, 0x16, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDB, 0x78, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x07, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x08, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x8E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x00, 0x00, 0xDA, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0x92, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x07, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x08, 0x28, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDB, 0xAA, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x24, 0x60, 0x00, 0x00, 0x9E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x82, 0x4A, 0x80, 
-    0x58, 0x4F, 0x67, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0xAE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x0C, 0x26, 0x6C, 0x00, 0x04, 0x0C, 0x93, 
-    0x00, 0x03, 0x00, 0x00, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2B, 0x00, 0x10, 0x60, 0x02, 
-    0x20, 0x0B, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDB, 0xB6, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2E, 
-    0x00, 0x14, 0x2F, 0x07, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x08, 0x28, 0x4A, 0xAC, 0x00, 0x28, 0x67, 0x0A, 0x41, 0xF9, 0xFF, 0xFF, 0xDB, 0xBC, 
-    0x20, 0x08, 0x60, 0x08, 0x41, 0xF9, 0xFF, 0xFF, 0xDB, 0xC4, 0x20, 0x08, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xDB, 0xC6, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x34, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x50, 0x72, 0x69, 
-    0x6E, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x50, 
-    0x34, 0x46, 0x49, 0x4C, 0x45, 0x69, 0x54, 0x32, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x07, 0x18, 0x2A, 0x2E, 0x00, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6C, 
-    0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF6, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x0E, 
-    0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 0x20, 0x0B, 0x67, 0x04, 0x26, 0x6B, 0x00, 0x04, 0x20, 0x0B, 
-    0x66, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0xCC, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x60, 0x5E, 0x7E, 0x01, 0x60, 0x56, 0x4A, 0x87, 0x67, 0x04, 0x7E, 0x00, 
-    0x60, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0xD2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x82, 0x4A, 0x85, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x1E, 0x4A, 0xAB, 
-    0x00, 0x0C, 0x67, 0x18, 0x2F, 0x2B, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xDB, 0xD6, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x6B, 0x00, 0x04, 
-    0x20, 0x0B, 0x66, 0xA6, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x26, 
-    0x50, 0x72, 0x69, 0x6E, 0x74, 0x50, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x73, 0x5F, 
-    0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x50, 0x34, 0x46, 0x49, 
-    0x4C, 0x45, 0x69, 0x4E, 0x32, 0x32, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 
-    0x26, 0x6E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x18, 0x67, 0x00, 0x00, 0x8E, 
-    0x53, 0x80, 0x67, 0x08, 0x53, 0x80, 0x67, 0x44, 0x60, 0x00, 0x01, 0xA6, 0x20, 0x54, 0x2F, 0x10, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x4A, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0x01, 0x66, 0x20, 0x54, 0x2F, 0x10, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x52, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x00, 0x01, 0x26, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF6, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x64, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x5E, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x28, 0x2F, 0x2C, 0x00, 0x08, 0x20, 0x54, 0x2F, 0x10, 
-    0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x42, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x67, 0x0A, 0x20, 0x6C, 0x00, 0x0C, 0x20, 0x68, 0x00, 0x04, 0x60, 0x04, 0x30, 0x7C, 0x00, 0x00, 
-    0x2F, 0x08, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x00, 0x00, 0xB4, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x01, 0x82, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x5C, 0x70, 0x01, 0x2F, 0x00, 
-    0x2F, 0x2C, 0x00, 0x28, 0x2F, 0x2C, 0x00, 0x08, 0x20, 0x54, 0x2F, 0x10, 0x2F, 0x39, 0xFF, 0xFF, 
-    0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x42, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0A, 0x20, 0x6C, 
-    0x00, 0x0C, 0x20, 0x68, 0x00, 0x04, 0x60, 0x04, 0x30, 0x7C, 0x00, 0x00, 0x2F, 0x08, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x24, 0x60, 0x48, 0x2F, 0x2C, 0x00, 0x34, 0x2F, 0x2C, 0x00, 0x28, 
-    0x2F, 0x2C, 0x00, 0x08, 0x20, 0x54, 0x2F, 0x10, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x42, 0x2F, 0x2C, 0x00, 0x0C, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x62, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x36, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 
-    0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x4F, 0xEF, 0x00, 0x24, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x28, 0x41, 0x70, 0x70, 0x65, 
-    0x6E, 0x64, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x64, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x50, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x50, 0x63, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0x90, 0x66, 0x04, 
-    0x20, 0x8C, 0x60, 0x16, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x50, 0x60, 0x04, 0x26, 0x6B, 0x00, 0x10, 
-    0x4A, 0xAB, 0x00, 0x10, 0x66, 0xF6, 0x27, 0x4C, 0x00, 0x10, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x5F, 0x5F, 
-    0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 0x50, 0x50, 0x39, 0x54, 0x46, 
-    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x21, 0x6E, 0x00, 0x0C, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x52, 0x65, 0x6E, 
-    0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x46, 
-    0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x6E, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x08, 0x2F, 0x2C, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x18, 0x20, 0x6E, 
-    0x00, 0x0C, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x2E, 0xCC, 
-    0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xFA, 0x2D, 0x6C, 0x00, 0x0C, 
-    0xFF, 0xFC, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0xF6, 0x4A, 0x80, 0x58, 0x4F, 0x67, 0x00, 0x00, 0xBE, 0x20, 0x54, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x54, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x2D, 0x43, 0xFF, 0xF8, 0x22, 0x6E, 
-    0x00, 0x0C, 0x20, 0x51, 0x22, 0x48, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 
-    0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 
-    0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x20, 0x2E, 0xFF, 0xF8, 0xB6, 0x00, 0x50, 0x4F, 0x67, 0x66, 
-    0x20, 0x54, 0x22, 0x48, 0x22, 0x69, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x54, 
-    0x20, 0x68, 0x00, 0x34, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x12, 
-    0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x40, 0x20, 0x6E, 0xFF, 0xFC, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0xFC, 
-    0x60, 0x34, 0x20, 0x0B, 0x67, 0x30, 0x26, 0x6B, 0x00, 0x04, 0x60, 0x2A, 0x2F, 0x2B, 0x00, 0x08, 
-    0x20, 0x6E, 0xFF, 0xFC, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x2E, 0xCC, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x04, 0x70, 0x00, 0x60, 0x2C, 0x20, 0x6E, 0xFF, 0xFC, 0x2D, 0x68, 0x00, 0x04, 
-    0xFF, 0xFC, 0x26, 0x6B, 0x00, 0x04, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x04, 0x20, 0x0B, 0x66, 0xCC, 
-    0x76, 0x00, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x06, 0x20, 0x0B, 0x66, 0x02, 0x76, 0x01, 0x48, 0x83, 
-    0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x5F, 
-    0x5F, 0x65, 0x71, 0x5F, 0x5F, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x43, 
-    0x46, 0x52, 0x43, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDB, 0xDE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDC, 0x24, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2C, 0x00, 0x04, 
-    0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x12, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDC, 0x28, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDC, 0x46, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xDC, 0x4A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2C, 0x00, 0x04, 
-    0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0x4E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0x72, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x26, 0x6C, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x4C, 0x60, 0x40, 0x4A, 0xAB, 
-    0x00, 0x30, 0x66, 0x36, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xB2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xC8, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xB4, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x26, 0x6B, 0x00, 0x10, 0x20, 0x0B, 
-    0x66, 0xBC, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xB6, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 
-    0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x48, 0x65, 0x61, 0x64, 0x65, 
-    0x72, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x46, 0x50, 0x34, 0x46, 
-    0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFC, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x7E, 0x00, 0x26, 0x6C, 0x00, 0x0C, 0x60, 0x06, 0x52, 0x87, 0x26, 0x6B, 0x00, 0x10, 
-    0x20, 0x0B, 0x66, 0xF6, 0x4A, 0xB9, 0xFF, 0xFF, 0xEB, 0xE2, 0x66, 0x00, 0x01, 0x9E, 0x70, 0x01, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xEB, 0xE2, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xBA, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xBC, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xC6, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDC, 0xF0, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0x1A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0x30, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0x4C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0x60, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0x94, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0xC0, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDD, 0xF4, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDE, 0x38, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDE, 0x70, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDE, 0x90, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDE, 0xC6, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDE, 0xE6, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0x16, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0x4E, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0x72, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0x96, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0xC0, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0xC2, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0xE0, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xDF, 0xF8, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x02, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0xC8, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x1C, 0xE6, 0x2F, 0x14, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x04, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x22, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE0, 0x24, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x26, 0x6C, 0x00, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x2C, 0x60, 0x48, 0x4A, 0xAB, 0x00, 0x38, 0x67, 0x3E, 0x42, 0x2E, 0xFC, 0x00, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x09, 0x06, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x30, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x4A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x24, 0x26, 0x6B, 0x00, 0x10, 0x20, 0x0B, 
-    0x66, 0xB4, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x56, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4A, 0xB9, 0xFF, 0xFF, 0xEB, 0xE6, 0x50, 0x4F, 0x66, 0x00, 0x00, 0xEE, 0x70, 0x01, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xEB, 0xE6, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x58, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x6A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x9A, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0x9C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE0, 0xDA, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0x18, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0x48, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0x76, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0x9C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0xB0, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE1, 0xDC, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x3E, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x70, 0x4C, 0xEE, 0x18, 0x80, 0xFB, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 
-    0x72, 0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 
-    0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFB, 0xFC, 0x48, 0xE7, 
-    0x01, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xB9, 0xFF, 0xFF, 0xEB, 0xDE, 
-    0x66, 0x00, 0x04, 0x1A, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 0xEB, 0xDE, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE2, 0x40, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x44, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x5C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x60, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xAA, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xD6, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xDA, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE2, 0xDE, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE2, 0xE0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x18, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x40, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x6C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x9E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0xA0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE3, 0xA2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE3, 0xBE, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE3, 0xC0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0xE8, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x12, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x14, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x58, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x5C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x76, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE4, 0x7A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE4, 0x96, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xAE, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xCE, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xD2, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xE4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0x12, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE5, 0x3E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE5, 0x6C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE5, 0xA2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0xD8, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x42, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x76, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xAA, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xDC, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE6, 0xDE, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE6, 0xF4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x28, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x3E, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x54, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x7A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x8E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xB4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE7, 0xD4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE7, 0xE8, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xEA, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xEE, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x2A, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x2E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x32, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x3C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE8, 0x5C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE8, 0x8C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xB8, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xE0, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xEA, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xEC, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xF0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x0E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE9, 0x12, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE9, 0x16, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x20, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x42, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x64, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x94, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0xC0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE9, 0xE8, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEA, 0x0E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEA, 0x50, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0x5A, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x02, 0x50, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEA, 0x5C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xA0, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xA2, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xAE, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xD4, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xF2, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x02, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x0E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x7E, 0x00, 0x2D, 0x6C, 0x00, 0x0C, 0xFB, 0xFC, 0x4F, 0xEF, 0x00, 0x48, 0x60, 0x00, 0x00, 0xBA, 
-    0x42, 0x2E, 0xFC, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x2F, 0x0C, 0x2F, 0x2E, 
-    0xFB, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0x06, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEB, 0x10, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEB, 0x20, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2E, 0xFB, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF6, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x2C, 0x67, 0x24, 0x2F, 0x14, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x24, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEB, 0x38, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x14, 
-    0x60, 0x3A, 0x2F, 0x2E, 0xFB, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x3A, 0x4A, 0x80, 0x58, 0x4F, 
-    0x67, 0x16, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x4A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x14, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x60, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x52, 0x87, 0x20, 0x6E, 
-    0xFB, 0xFC, 0x2D, 0x68, 0x00, 0x10, 0xFB, 0xFC, 0x4A, 0xAE, 0xFB, 0xFC, 0x66, 0x00, 0xFF, 0x42, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x74, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFB, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x50, 0x72, 0x69, 0x6E, 
-    0x74, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x38, 0x54, 0x4D, 
-    0x6F, 0x6E, 0x69, 0x74, 0x6F, 0x72, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x28, 0x80, 0x29, 0x40, 
-    0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0x47, 0x8C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x9A, 0x29, 0x40, 0x00, 0x20, 0x70, 0x00, 0x29, 0x40, 0x00, 0x24, 
-    0x29, 0x40, 0x00, 0x28, 0x29, 0x40, 0x00, 0x2C, 0x29, 0x40, 0x00, 0x30, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x49, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 
-    0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x38, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x3A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x3E, 0x29, 0x79, 0xFF, 0xFF, 0xF4, 0x68, 
-    0x00, 0x34, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x34, 0xD0, 0xE9, 0x00, 0x58, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x5C, 0x4E, 0x91, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x04, 0x28, 0xAE, 0x00, 0x0C, 
-    0x29, 0x6E, 0x00, 0x10, 0x00, 0x18, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0xD4, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x18, 0xB4, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9E, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 
-    0x63, 0x6F, 0x6C, 0x46, 0x50, 0x63, 0x50, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x28, 0xAE, 0x00, 0x0C, 0x26, 0x6C, 0x00, 0x0C, 0x60, 0x26, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x2B, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x0E, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x0B, 0x68, 0x50, 0x4F, 0x26, 0x6B, 0x00, 0x10, 
-    0x20, 0x0B, 0x66, 0xD6, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x52, 
-    0x65, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 
-    0x6C, 0x46, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 0x00, 0x14, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0x90, 0x66, 0x04, 
-    0x20, 0x8C, 0x60, 0x16, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x50, 0x60, 0x04, 0x26, 0x6B, 0x00, 0x14, 
-    0x4A, 0xAB, 0x00, 0x14, 0x66, 0xF6, 0x27, 0x4C, 0x00, 0x14, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x5F, 0x5F, 
-    0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x50, 0x50, 0x39, 0x54, 0x50, 
-    0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x48, 0x68, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x0B, 0x04, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x41, 0x64, 0x64, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 
-    0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x50, 0x39, 0x54, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x27, 0x6C, 0x00, 0x0C, 0x00, 0x10, 0x29, 0x4B, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x5F, 0x5F, 0x39, 
-    0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x50, 0x39, 0x54, 0x46, 0x75, 0x6E, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 
-    0x48, 0x68, 0x00, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x7A, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x98, 0x41, 0x64, 0x64, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 
-    0x6F, 0x6C, 0x46, 0x50, 0x36, 0x54, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x03, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0xA8, 0x00, 0x18, 0x56, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x49, 
-    0x73, 0x49, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
-    0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x18, 0x67, 0x06, 
-    0x20, 0x2C, 0x00, 0x18, 0x60, 0x02, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x97, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 
-    0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 
-    0x76, 0x01, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x80, 0x67, 0x2A, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x80, 
-    0x4A, 0x10, 0x67, 0x20, 0x2F, 0x03, 0x2F, 0x39, 0xFF, 0xFF, 0x47, 0x80, 0x20, 0x6E, 0x00, 0x08, 
-    0x2F, 0x28, 0x00, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xFA, 0x50, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 
-    0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x97, 0x49, 0x73, 0x55, 0x73, 0x65, 0x72, 0x44, 0x65, 0x66, 0x5F, 0x5F, 0x39, 0x54, 
-    0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0xF2, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x38, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x12, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x3C, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x5A, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x5E, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEC, 0x62, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x86, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x7E, 0x01, 0x26, 0x6C, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x4C, 0x60, 0x40, 0x4A, 0xAB, 0x00, 0x30, 
-    0x66, 0x36, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xC6, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x06, 0xC8, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xC8, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x20, 0x26, 0x6B, 0x00, 0x10, 0x20, 0x0B, 0x66, 0xBC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xCA, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x24, 0x50, 0x72, 
-    0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5F, 
-    0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x50, 0x34, 0x46, 0x49, 
-    0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFC, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x7E, 0x00, 0x42, 0x2E, 0xFC, 0x00, 0x2F, 0x14, 0x48, 0x6E, 0xFC, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0x8A, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xCE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x14, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x18, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x26, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x2A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x2E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x30, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x72, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x26, 0x6C, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x50, 0x60, 0x32, 
-    0x4A, 0xAB, 0x00, 0x30, 0x66, 0x28, 0x4A, 0x87, 0x67, 0x04, 0x7E, 0x00, 0x60, 0x12, 0x48, 0x79, 
-    0xFF, 0xFF, 0xED, 0x76, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x7A, 0x50, 0x4F, 0x26, 0x6B, 
-    0x00, 0x10, 0x20, 0x0B, 0x66, 0xCA, 0x4C, 0xEE, 0x18, 0x80, 0xFB, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x24, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x53, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 
-    0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFB, 0xFC, 0x48, 0xE7, 0x01, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x42, 0x2E, 0xFB, 0xFC, 0x2F, 0x14, 0x48, 0x6E, 0xFB, 0xFC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x8A, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x7A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0xBE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0xC0, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 
-    0xED, 0xDE, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4A, 0xAC, 0x00, 0x24, 
-    0x4F, 0xEF, 0x00, 0x30, 0x67, 0x18, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0xFA, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEE, 0x1A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x26, 0x6C, 
-    0x00, 0x0C, 0x50, 0x4F, 0x60, 0x46, 0x4A, 0xAB, 0x00, 0x38, 0x67, 0x3C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x01, 0x82, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x2E, 0x42, 0x2E, 0xFB, 0xFC, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFB, 0xFC, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0x06, 
-    0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x1C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x1C, 0x26, 0x6B, 0x00, 0x10, 0x20, 0x0B, 0x66, 0xB6, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x2C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x42, 0x2E, 0xFB, 0xFC, 0x2F, 0x14, 0x48, 0x6E, 0xFB, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x8A, 
-    0x7E, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x2E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x30, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x54, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x56, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x70, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEE, 0x96, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 
-    0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0xD2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x3E, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEF, 0x6A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 
-    0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xA4, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4A, 0xAC, 0x00, 0x24, 0x4F, 0xEF, 0x00, 0x88, 0x67, 0x1A, 0x48, 0x6E, 0xFB, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xD6, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x14, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x28, 0x67, 0x1A, 0x48, 0x6E, 
-    0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x48, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x88, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x2C, 0x67, 0x1A, 
-    0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0xBA, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0xF0, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x30, 
-    0x67, 0x1A, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0x26, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x12, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF1, 0x5C, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x2F, 0x2C, 
-    0x00, 0x1C, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0x96, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xBC, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xDA, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xF8, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x20, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF2, 0x22, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x34, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x58, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x70, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x72, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x84, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x9A, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xB2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xB4, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x34, 
-    0xD0, 0xE9, 0x00, 0x48, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x4C, 0x4E, 0x91, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x20, 0x40, 0x58, 0x8F, 0x2F, 0x10, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF2, 0xD2, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xF0, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4A, 0xAC, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0xAC, 0x67, 0x10, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2C, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xA2, 0x50, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xFE, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x0A, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x16, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF3, 0x18, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF3, 0x26, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x6E, 
-    0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x32, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x26, 0x6C, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x40, 0x60, 0x46, 0x4A, 0xAB, 0x00, 0x38, 
-    0x67, 0x3C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x82, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x2E, 
-    0x42, 0x2E, 0xFB, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFB, 0xFC, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x09, 0x06, 0x48, 0x6E, 0xFB, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x4A, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x1C, 0x26, 0x6B, 
-    0x00, 0x10, 0x20, 0x0B, 0x66, 0xB6, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x56, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x0A, 
-    0x58, 0x8F, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x58, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x18, 0x4C, 0xEE, 0x18, 0x80, 0xFB, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x22, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x53, 0x65, 0x72, 0x76, 0x65, 0x72, 0x47, 
-    0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 
-    0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0xFC, 0x00, 0x48, 0xE7, 0x01, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x42, 0x2E, 0xFC, 0x00, 0x2F, 0x14, 0x48, 0x6E, 0xFC, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x8A, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0x68, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xAC, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x26, 0x6C, 0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x32, 
-    0x42, 0x2E, 0xFC, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFC, 0x00, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x09, 0x06, 0x48, 0x6E, 0xFC, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xAE, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x1C, 0x26, 0x6B, 
-    0x00, 0x10, 0x20, 0x0B, 0x66, 0xCA, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xBE, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xC0, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xCC, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF3, 0xF2, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0x20, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0x2C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x7E, 0x02, 0x26, 0x6C, 0x00, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x40, 0x60, 0x18, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x62, 0x52, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x6B, 0x00, 0x10, 0x20, 0x0B, 
-    0x66, 0xE4, 0x4C, 0xEE, 0x18, 0x80, 0xFB, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x50, 0x72, 
-    0x69, 0x6E, 0x74, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x47, 0x6C, 0x75, 0x65, 0x5F, 0x5F, 0x39, 
-    0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x34, 0xD0, 0xE9, 
-    0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 
-    0x67, 0x00, 0x01, 0x2C, 0x20, 0x6C, 0x00, 0x18, 0x2D, 0x68, 0x00, 0x0C, 0xFF, 0xF4, 0x60, 0x00, 
-    0x00, 0xD4, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF0, 0x42, 0x07, 0x26, 0x6C, 0x00, 0x0C, 0x60, 0x68, 
-    0x2D, 0x6B, 0x00, 0x10, 0xFF, 0xEC, 0x2F, 0x0B, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 
-    0x0B, 0x92, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x48, 0x7E, 0x01, 0x4A, 0xAE, 0xFF, 0xF0, 0x67, 0x0C, 
-    0x20, 0x6E, 0xFF, 0xF0, 0x21, 0x6B, 0x00, 0x10, 0x00, 0x10, 0x60, 0x06, 0x29, 0x6B, 0x00, 0x10, 
-    0x00, 0x0C, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x21, 0x4B, 0x00, 0x10, 
-    0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x08, 0x2D, 0x4B, 0xFF, 0xF8, 0x2D, 0x4B, 0xFF, 0xFC, 0x2D, 0x4B, 
-    0xFF, 0xFC, 0x70, 0x00, 0x27, 0x40, 0x00, 0x10, 0x72, 0x01, 0x27, 0x41, 0x00, 0x38, 0x60, 0x0C, 
-    0x2D, 0x4B, 0xFF, 0xF0, 0x26, 0x6E, 0xFF, 0xEC, 0x20, 0x0B, 0x66, 0x94, 0x4A, 0x07, 0x66, 0x4A, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF4, 0x2E, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 
-    0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xC8, 0x2F, 0x14, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF4, 0x3C, 0x48, 0x79, 0xFF, 0xFF, 0xFC, 0x38, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x70, 0x01, 
-    0x23, 0xC0, 0xFF, 0xFF, 0x47, 0x72, 0x4F, 0xEF, 0x00, 0x24, 0x20, 0x6E, 0xFF, 0xF4, 0x2D, 0x68, 
-    0x00, 0x10, 0xFF, 0xF4, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x00, 0xFF, 0x28, 0x60, 0x34, 0x20, 0x6C, 
-    0x00, 0x0C, 0x26, 0x68, 0x00, 0x10, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x0A, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x21, 0x6C, 0x00, 0x0C, 0x00, 0x10, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x0C, 0x2D, 0x6C, 0x00, 0x0C, 
-    0xFF, 0xF8, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 0x29, 0x4B, 
-    0x00, 0x0C, 0x4A, 0xAC, 0x00, 0x0C, 0x66, 0xC6, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x80, 0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x25, 0x52, 0x65, 0x6F, 0x72, 0x64, 0x65, 
-    0x72, 0x41, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 
-    0x65, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x76, 0x01, 0x4A, 0xB9, 0xFF, 0xFF, 0x47, 0x80, 
-    0x67, 0x2A, 0x20, 0x79, 0xFF, 0xFF, 0x47, 0x80, 0x4A, 0x10, 0x67, 0x20, 0x2F, 0x03, 0x2F, 0x39, 
-    0xFF, 0xFF, 0x47, 0x80, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x20, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xFA, 0x50, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 
-    0x20, 0x03, 0x26, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x43, 0x61, 0x6E, 0x45, 0x6D, 
-    0x69, 0x74, 0x5F, 0x5F, 0x39, 0x54, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x28, 0x80, 
-    0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 
-    0x29, 0x40, 0x00, 0x14, 0x29, 0x40, 0x00, 0x18, 0x29, 0x40, 0x00, 0x1C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x49, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 
-    0x65, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x3A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2C, 0x28, 0x93, 0x29, 0x6B, 
-    0x00, 0x04, 0x00, 0x04, 0x29, 0x6B, 0x00, 0x08, 0x00, 0x08, 0x29, 0x6B, 0x00, 0x0C, 0x00, 0x0C, 
-    0x29, 0x6B, 0x00, 0x10, 0x00, 0x10, 0x29, 0x6B, 0x00, 0x14, 0x00, 0x14, 0x29, 0x6B, 0x00, 0x18, 
-    0x00, 0x18, 0x29, 0x6B, 0x00, 0x1C, 0x00, 0x1C, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 
-    0x65, 0x46, 0x50, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x0C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x26, 0x7A, 0x4A, 0xAE, 0x00, 0x10, 0x67, 0x06, 0x20, 0x2E, 0x00, 0x10, 
-    0x60, 0x08, 0x41, 0xF9, 0xFF, 0xFF, 0xF4, 0xD8, 0x20, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF4, 0xDA, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x2F, 0x0C, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x26, 0xFE, 0x4F, 0xEF, 0x00, 0x1C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 
-    0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x14, 0x04, 0x80, 
-    0x00, 0x03, 0x00, 0x00, 0x67, 0x0A, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x12, 0x60, 0x30, 
-    0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x60, 0x2C, 
-    0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF4, 0xE0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x0C, 
-    0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x4C, 0x48, 0x53, 0x5F, 
-    0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x14, 0x04, 0x80, 0x00, 0x03, 0x00, 0x00, 0x67, 0x0A, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 
-    0x67, 0x32, 0x60, 0x60, 0x4A, 0xAC, 0x00, 0x14, 0x67, 0x18, 0x2F, 0x2C, 0x00, 0x14, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF4, 0xE4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0x42, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0xEA, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x60, 0x30, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0xEE, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x18, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0x92, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0xF2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x1C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x50, 
-    0x72, 0x69, 0x6E, 0x74, 0x52, 0x48, 0x53, 0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x46, 
-    0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 
-    0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x00, 0xC0, 0x94, 
-    0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF4, 0xF4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x20, 0x3C, 0x00, 0x20, 0x00, 0x00, 0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF4, 0xFC, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x20, 0x3C, 0x00, 0x80, 
-    0x00, 0x00, 0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x06, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x20, 0x3C, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x94, 0x04, 0x80, 
-    0x80, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x28, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x67, 0x00, 
-    0x02, 0x4E, 0x53, 0x80, 0x67, 0x00, 0x01, 0x04, 0x59, 0x80, 0x67, 0x00, 0x02, 0x2E, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x1B, 0x67, 0x00, 0x00, 0x90, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 
-    0x00, 0xAE, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x00, 0xCC, 0x04, 0x80, 0x00, 0x00, 
-    0x00, 0x10, 0x67, 0x00, 0x01, 0x04, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x01, 0x0E, 
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x01, 0x18, 0x04, 0x80, 0x00, 0x00, 0x7F, 0x90, 
-    0x67, 0x68, 0x04, 0x80, 0x00, 0x00, 0x00, 0x30, 0x67, 0x00, 0x00, 0x88, 0x04, 0x80, 0x00, 0x00, 
-    0x7F, 0xD0, 0x67, 0x00, 0x01, 0x10, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x00, 0x01, 0x42, 
-    0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x00, 0x02, 0x02, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 
-    0x67, 0x00, 0x02, 0x36, 0x04, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x67, 0x00, 0x01, 0x60, 0x04, 0x80, 
-    0x01, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x70, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x67, 0x00, 
-    0x01, 0x80, 0x60, 0x00, 0x02, 0x50, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x10, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x3C, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x16, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x28, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF5, 0x1C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 
-    0x02, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x20, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x50, 0x4F, 0x60, 0x00, 0x02, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x2A, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x30, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xD8, 0x2F, 0x2C, 
-    0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x36, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x01, 0xBE, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x3A, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xAA, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0x40, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x96, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x48, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x82, 0x4A, 0xAC, 0x00, 0x10, 0x67, 0x0E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 
-    0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0x54, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x46, 
-    0x4A, 0xAC, 0x00, 0x10, 0x67, 0x0E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 
-    0x27, 0xA6, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x56, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x0A, 0x2F, 0x2C, 0x00, 0x04, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x58, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x00, 0x00, 0xF0, 0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x62, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xD6, 
-    0x2F, 0x2C, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x6C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0xBC, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x76, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA8, 0x4A, 0xAC, 
-    0x00, 0x10, 0x67, 0x0E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 
-    0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x00, 0x00, 0x8C, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x50, 0x4F, 0x60, 0x7A, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 
-    0x4E, 0xB9, 0x00, 0x00, 0x27, 0xA6, 0x4A, 0xAC, 0x00, 0x14, 0x50, 0x4F, 0x67, 0x18, 0x2F, 0x2C, 
-    0x00, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x7A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x4E, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x80, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x60, 0x3C, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 
-    0x00, 0x00, 0x27, 0xA6, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x84, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x18, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0x92, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x8A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 
-    0x4F, 0xEF, 0x00, 0x24, 0x20, 0x3C, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF5, 0x8C, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0x22, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x5F, 0x5F, 
-    0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x3C, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x94, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x20, 0x3C, 0x00, 0x10, 0x00, 0x00, 
-    0xC0, 0x94, 0x67, 0x16, 0x70, 0x20, 0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x96, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x20, 0x3C, 0x00, 0x20, 0x00, 0x00, 
-    0xC0, 0x94, 0x67, 0x10, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x98, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x50, 0x4F, 0x20, 0x3C, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x94, 0x04, 0x80, 0x80, 0x00, 
-    0x00, 0x00, 0x67, 0x00, 0x01, 0x64, 0x04, 0x80, 0x80, 0x00, 0x00, 0x00, 0x67, 0x00, 0x02, 0x32, 
-    0x53, 0x80, 0x67, 0x00, 0x01, 0x40, 0x59, 0x80, 0x67, 0x00, 0x02, 0x12, 0x04, 0x80, 0x00, 0x00, 
-    0x00, 0x1B, 0x67, 0x00, 0x00, 0x90, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x00, 0xAE, 
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x00, 0xCC, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 
-    0x67, 0x00, 0x00, 0xD6, 0x04, 0x80, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x00, 0xE0, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x10, 0x67, 0x00, 0x00, 0xEA, 0x04, 0x80, 0x00, 0x00, 0x7F, 0x90, 0x67, 0x68, 
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x30, 0x67, 0x00, 0x00, 0x88, 0x04, 0x80, 0x00, 0x00, 0x7F, 0xD0, 
-    0x67, 0x00, 0x01, 0x08, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x00, 0x01, 0x3C, 0x04, 0x80, 
-    0x00, 0x01, 0x00, 0x00, 0x67, 0x00, 0x01, 0xE6, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x67, 0x00, 
-    0x01, 0xFC, 0x04, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x67, 0x00, 0x01, 0x5C, 0x04, 0x80, 0x01, 0x00, 
-    0x00, 0x00, 0x67, 0x00, 0x01, 0x64, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0x6C, 
-    0x60, 0x00, 0x02, 0x36, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x9A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x22, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0x9C, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0x9E, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xFA, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xA0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0xE6, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xA2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xD2, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xA4, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xBE, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0xA6, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xAA, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xA8, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 
-    0x60, 0x00, 0x01, 0x96, 0x48, 0x79, 0xFF, 0xFF, 0xF5, 0xAA, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x82, 0x2F, 0x2C, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x8A, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x70, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0E, 
-    0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x2B, 0x4E, 0x50, 0x4F, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF5, 0xAC, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x4A, 0xAC, 0x00, 0x10, 
-    0x50, 0x4F, 0x67, 0x00, 0x01, 0x44, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 
-    0x2B, 0x4E, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x32, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x2B, 0x4E, 0x50, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0xAE, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x4A, 0xAC, 0x00, 0x10, 0x50, 0x4F, 
-    0x67, 0x00, 0x01, 0x06, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x2B, 0x4E, 
-    0x50, 0x4F, 0x60, 0x00, 0x00, 0xF4, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0x8A, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xE2, 0x2F, 0x2C, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x8A, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD0, 0x2F, 0x2C, 0x00, 0x08, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x8A, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xBE, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0xB0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xAA, 
-    0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0E, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x2B, 0x4E, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x10, 0x67, 0x00, 0x00, 0x8E, 0x2F, 0x0B, 0x2F, 0x2C, 
-    0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x2B, 0x4E, 0x50, 0x4F, 0x60, 0x7C, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF5, 0xB2, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x10, 
-    0x4E, 0xB9, 0x00, 0x00, 0x2B, 0x4E, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x5C, 0x48, 0x6E, 0xFF, 0xEC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x32, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x5A, 0x2F, 0x2C, 0x00, 0x18, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x02, 0x62, 0x2F, 0x2C, 0x00, 0x10, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x6A, 
-    0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x72, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0xEA, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0x3A, 0x4F, 0xEF, 0x00, 0x2C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xE4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x98, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x4D, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x64, 
-    0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x14, 
-    0xB0, 0x90, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x0A, 0x4A, 0xAC, 0x00, 0x0C, 0x66, 0x0A, 
-    0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 0x00, 0x0C, 0x67, 0x34, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x0A, 
-    0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 0x00, 0x0C, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xE4, 
-    0x20, 0x6E, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x0C, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x2E, 0xCC, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xC6, 0x4A, 0xAC, 
-    0x00, 0x10, 0x66, 0x0A, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 0x00, 0x10, 0x67, 0x34, 0x4A, 0xAC, 
-    0x00, 0x10, 0x67, 0x0A, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 0x00, 0x10, 0x66, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x00, 0xA0, 0x20, 0x6E, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x10, 0x2F, 0x2C, 0x00, 0x10, 
-    0x4E, 0xB9, 0x00, 0x00, 0x2E, 0xCC, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 
-    0x00, 0x82, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xA8, 0x00, 0x14, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x6E, 0x4A, 0xAC, 0x00, 0x18, 0x66, 0x0A, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 
-    0x00, 0x18, 0x67, 0x5C, 0x4A, 0xAC, 0x00, 0x18, 0x67, 0x0A, 0x20, 0x6E, 0x00, 0x0C, 0x4A, 0xA8, 
-    0x00, 0x18, 0x66, 0x04, 0x70, 0x00, 0x60, 0x4A, 0x2D, 0x6C, 0x00, 0x18, 0xFF, 0xFC, 0x20, 0x6E, 
-    0x00, 0x0C, 0x26, 0x68, 0x00, 0x18, 0x60, 0x20, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x28, 0x00, 0x08, 
-    0xB0, 0xAB, 0x00, 0x08, 0x67, 0x04, 0x70, 0x00, 0x60, 0x28, 0x20, 0x6E, 0xFF, 0xFC, 0x2D, 0x68, 
-    0x00, 0x04, 0xFF, 0xFC, 0x26, 0x6B, 0x00, 0x04, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x04, 0x20, 0x0B, 
-    0x66, 0xD6, 0x4A, 0xAE, 0xFF, 0xFC, 0x66, 0x04, 0x20, 0x0B, 0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x01, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x65, 
-    0x71, 0x5F, 0x5F, 0x35, 0x54, 0x54, 0x79, 0x70, 0x65, 0x43, 0x46, 0x52, 0x43, 0x35, 0x54, 0x54, 
-    0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x25, 0x03, 0x2A, 0x41, 0x07, 0x1B, 0x07, 0x1D, 0x07, 0x1F, 
-    0x07, 0x80, 0xDE, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x04, 0x0D, 0x04, 0x04, 0x04, 0x0E, 0x04, 
-    0x07, 0x04, 0x30, 0x05, 0x0D, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x09, 0x05, 0x0D, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x1D, 0x05, 0x06, 0x0C, 0x05, 0x05, 0x05, 0x03, 0x06, 0x05, 
-    0x09, 0x05, 0x06, 0x05, 0x09, 0x03, 0x05, 0x08, 0x05, 0x05, 0x05, 0x2E, 0x05, 0x0D, 0x05, 0x07, 
-    0x05, 0x0D, 0x05, 0x0E, 0x05, 0x18, 0x05, 0x11, 0x05, 0x05, 0x05, 0x35, 0x05, 0x0B, 0x05, 0x0A, 
-    0x0C, 0x05, 0x37, 0x03, 0x05, 0x03, 0x03, 0x03, 0x06, 0x09, 0x03, 0x05, 0x03, 0x03, 0x03, 0x06, 
-    0x19, 0x03, 0x0E, 0x03, 0x03, 0x03, 0x06, 0x16, 0x03, 0x0E, 0x03, 0x03, 0x03, 0x06, 0x0E, 0x03, 
-    0x05, 0x03, 0x03, 0x03, 0x06, 0x73, 0x80, 0xB0, 0x05, 0x03, 0x05, 0x06, 0x05, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x06, 0x05, 0x04, 0x05, 0x0B, 0x05, 0x0C, 0x05, 0x09, 0x05, 0x2C, 0x06, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 
-    0x0D, 0x05, 0x03, 0x05, 0x04, 0x05, 0x16, 0x05, 0x05, 0x05, 0x09, 0x05, 0x03, 0x07, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x25, 0x06, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 
-    0x19, 0x04, 0x05, 0x04, 0x0D, 0x04, 0x03, 0x04, 0x0F, 0x04, 0x07, 0x04, 0x0F, 0x04, 0x29, 0x03, 
-    0x26, 0x07, 0x16, 0x2E, 0x80, 0x9B, 0x55, 0x04, 0x06, 0x07, 0x22, 0x05, 0x03, 0x05, 0x06, 0x05, 
-    0x05, 0x03, 0x05, 0x03, 0x05, 0x06, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x0C, 0x05, 0x09, 0x05, 0x29, 
-    0x03, 0x05, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x04, 0x05, 0x03, 0x05, 
-    0x0F, 0x05, 0x33, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0A, 0x05, 0x05, 0x05, 0x1E, 
-    0x05, 0x09, 0x05, 0x08, 0x04, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0A, 0x05, 0x06, 0x05, 0x09, 0x05, 
-    0x06, 0x05, 0x09, 0x05, 0x06, 0x05, 0x09, 0x05, 0x06, 0x05, 0x06, 0x05, 0x04, 0x05, 0x03, 0x05, 
-    0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 
-    0x03, 0x05, 0x03, 0x05, 0x06, 0x05, 0x14, 0x05, 0x05, 0x05, 0x0C, 0x04, 0x05, 0x03, 0x05, 0x03, 
-    0x05, 0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 0x05, 0x05, 0x1F, 0x05, 0x09, 0x05, 0x05, 0x05, 0x05, 
-    0x29, 0x03, 0x05, 0x03, 0x05, 0x15, 0x05, 0x09, 0x05, 0x04, 0x05, 0x03, 0x05, 0x03, 0x05, 0x04, 
-    0x05, 0x03, 0x05, 0x03, 0x05, 0x80, 0x8E, 0x03, 0x03, 0x07, 0x09, 0x03, 0x03, 0x04, 0x4D, 0x04, 
-    0x06, 0x07, 0x49, 0x42, 0x05, 0x04, 0x3C, 0x04, 0x35, 0x04, 0x06, 0x04, 0x05, 0x04, 0x08, 0x03, 
-    0x04, 0x24, 0x04, 0x09, 0x04, 0x09, 0x04, 0x64, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 
-    0x04, 0x06, 0x04, 0x08, 0x04, 0x07, 0x04, 0x06, 0x04, 0x06, 0x04, 0x1A, 0x04, 0x1A, 0x04, 0x08, 
-    0x04, 0x09, 0x04, 0x09, 0x04, 0x07, 0x04, 0x28, 0x04, 0x06, 0x04, 0x0B, 0x04, 0x08, 0x03, 0x04, 
-    0x0A, 0x04, 0x22, 0x04, 0x0C, 0x04, 0x09, 0x04, 0x64, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 
-    0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x09, 0x10, 0x04, 0x1B, 0x04, 0x14, 
-    0x09, 0x09, 0x06, 0x04, 0x1C, 0x04, 0x0E, 0x07, 0x07, 0x07, 0x05, 0x06, 0x07, 0x00, 0x00, 0x5A, 
-    0x80, 0xD0, 0x07, 0x1A, 0x32, 0x07, 0x51, 0x2D, 0x1C, 0x55, 0x38, 0x36, 0x18, 0x80, 0xA1, 0x1E, 
-    0x10, 0x1E, 0x15, 0x3B, 0x80, 0xB5, 0x39, 0x80, 0xD5, 0x11, 0x56, 0x80, 0x94, 0x81, 0x18, 0x2E, 
-    0x83, 0x1B, 0x17, 0x1B, 0x80, 0x9C, 0x33, 0x53, 0x81, 0x22, 0x80, 0x9C, 0x74, 0x0E, 0x81, 0xE5, 
-    0x0E, 0x70, 0x57, 0x4F, 0x44, 0x80, 0xEE, 0x17, 0x2C, 0x08, 0x0F, 0x81, 0x66, 0x0A, 0x14, 0x0A, 
-    0x45, 0x0B, 0x08, 0x1F, 0x81, 0x34, 0x13, 0x0C, 0x13, 0x31, 0x0B, 0x0F, 0x6E, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x28, 0x31, 
-    0x2E, 0x30, 0x2C, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x41, 0x70, 
-    0x70, 0x6C, 0x65, 0x20, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x49, 0x6E, 
-    0x63, 0x2E, 0x20, 0x31, 0x39, 0x39, 0x38, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x80, 0x00, 0x00, 
-    0x00, 0x03, 0x31, 0x2E, 0x30, 0x0F, 0x4E, 0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x44, 0x44, 0x4B, 
-    0x73, 0x20, 0x31, 0x2E, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x9A, 0x45, 0x00, 0x01, 0x99, 
-    0x45, 0x00, 0x00, 0x01, 0x04, 0x02, 0x75, 0x81, 0x0C, 0x2A, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x00, 
-    0xBE, 0x00, 0x01, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x09, 0x00, 0x12, 0x76, 0x65, 0x72, 0x73, 0x00, 
-    0x01, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0C, 0x02, 0x75, 0x7A, 0xF8, 0x00, 0x01, 0x00, 0x11, 0x20, 
-    0x00, 0x0C, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x16, 0x20, 0x00, 0xAF, 0xE0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1E, 0x20, 0x00, 0xB7, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x24, 0x20, 0x00, 0xD0, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2A, 0x20, 
-    0x00, 0xD2, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x31, 0x20, 0x00, 0xDC, 0x0C, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x39, 0x20, 0x00, 0xDC, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x00, 0x41, 0x20, 0x01, 0x65, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x20, 
-    0x01, 0x98, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x01, 0x99, 0x27, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x33, 0x32, 0x2D, 0x62, 0x69, 0x74, 0x20, 0x62, 0x6F, 0x6F, 0x74, 0x73, 
-    0x74, 0x72, 0x61, 0x70, 0x04, 0x4D, 0x61, 0x69, 0x6E, 0x07, 0x53, 0x54, 0x44, 0x43, 0x4C, 0x49, 
-    0x42, 0x05, 0x53, 0x54, 0x44, 0x49, 0x4F, 0x05, 0x53, 0x41, 0x44, 0x45, 0x56, 0x06, 0x49, 0x4E, 
-    0x54, 0x45, 0x4E, 0x56, 0x07, 0x53, 0x41, 0x4E, 0x45, 0x4C, 0x49, 0x42, 0x07, 0x25, 0x41, 0x35, 
-    0x49, 0x6E, 0x69, 0x74, 0x04, 0x53, 0x45, 0x47, 0x32, 
-};
-
-unsigned char *gAppResource = rsrc;
-unsigned int gAppResourceSize = sizeof(rsrc);
+MOS_INCBIN("rsrc_protocolgentool.bin")
+unsigned int gAppResourceCompressed = 1;
 
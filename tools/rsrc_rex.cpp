@@ -1,4794 +1,6 @@
 
 #include "rsrc.h"
 
-unsigned char rsrc[] = {
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x29, 0xA1, 0x00, 0x01, 0x28, 0xA1, 0x00, 0x00, 0x01, 0x67, 
-    0xFF, 0xEE, 0xFF, 0xEA, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x95, 0x50, 
-    0x41, 0x52, 0x53, 0x45, 0x5F, 0x45, 0x4E, 0x55, 0x4D, 0x5F, 0x44, 0x45, 0x46, 0x49, 0x4E, 0x49, 
-    0x03, 0x52, 0x65, 0x78, 0x64, 0x65, 0x72, 0x70, 0x65, 0x20, 0x4E, 0x61, 0x76, 0x69, 0x67, 0x61, 
-    0x74, 0x6F, 0x72, 0xAA, 0x20, 0x33, 0x2E, 0x30, 0x32, 0x54, 0x6F, 0x6F, 0x6C, 0x73, 0x61, 0x6E, 
-    0x00, 0x00, 0x4D, 0x50, 0x53, 0x54, 0x4D, 0x50, 0x53, 0x20, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xB1, 0x00, 0xAB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2B, 0x08, 0x4E, 0xBA, 
-    0x07, 0x5E, 0x4C, 0xDF, 0x18, 0x00, 0x4E, 0x5E, 0x4E, 0x74, 0x00, 0x04, 0x8D, 0x4D, 0x41, 0x4B, 
-    0x45, 0x5F, 0x45, 0x4E, 0x55, 0x4D, 0x5F, 0x54, 0x41, 0x47, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xD4, 
-    0x48, 0xE7, 0x03, 0x18, 0x42, 0x2E, 0xFF, 0xF2, 0x4E, 0xAD, 0x04, 0x0A, 0x4A, 0x2D, 0xC8, 0x19, 
-    0x66, 0x52, 0x48, 0x6E, 0xFF, 0xF4, 0x4E, 0xBA, 0x07, 0x94, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x08, 
-    0x2F, 0x0E, 0x4E, 0xBA, 0xFF, 0x72, 0x60, 0x36, 0x20, 0x6E, 0xFF, 0xF4, 0x70, 0x04, 0xB0, 0x28, 
-    0x00, 0x18, 0x57, 0xC0, 0x4A, 0x00, 0x67, 0x1E, 0x20, 0x68, 0x00, 0x08, 0x72, 0x04, 0xB2, 0x28, 
-    0x00, 0x13, 0x57, 0xC1, 0xC0, 0x01, 0x67, 0x0E, 0x20, 0x6E, 0xFF, 0xF4, 0x22, 0x6E, 0x00, 0x08, 
-    0x22, 0xA8, 0x00, 0x08, 0x60, 0x08, 0x3F, 0x3C, 0x00, 0xC8, 0x4E, 0xAD, 0x03, 0x3A, 0x4E, 0xAD, 
-    0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x00, 0x04, 0x70, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3F, 0x3C, 0x00, 0x0B, 0xA9, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x79, 0x36, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x07, 0xDE, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x08, 0x12, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x10, 0x38, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x13, 0x66, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x13, 0xF6, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x14, 0x66, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x14, 0xDC, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x16, 0x4C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x17, 0xAC, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x18, 0xE8, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1B, 0x18, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1C, 0x84, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x1E, 0x5C, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x20, 0x88, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x22, 0x40, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x22, 0xB0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x39, 0xD2, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x3A, 0x24, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x3E, 0xC0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x4A, 0x4E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x54, 0x8E, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x63, 0x5C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x6B, 0xF4, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x6C, 0x3E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x6C, 0x88, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x73, 0x5E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x73, 0x84, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x73, 0xA8, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x73, 0xCC, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x74, 0x1C, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x74, 0xAA, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x76, 0x0A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x78, 0xB4, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x79, 0xA8, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x79, 0xD6, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x90, 0x06, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x90, 0xC2, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x91, 0x58, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x91, 0xCA, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x99, 0xCC, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x9A, 0x72, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x9A, 0xFC, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x9C, 0x5C, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0x9D, 0x46, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0x9F, 0x44, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xA0, 0x6A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xA1, 0xA4, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xA2, 0x3A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xA2, 0xD6, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xA4, 0x62, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xA5, 0x30, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xA6, 0x3A, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xA8, 0x6A, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xA9, 0x4E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xA9, 0xD0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xAA, 0x1E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xAB, 0xC0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xAC, 0x6E, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xAD, 0xA0, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xAE, 0xB6, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xAF, 0x54, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xAF, 0xEE, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xB0, 0xCA, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xB1, 0x34, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xB1, 0x58, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xB1, 0x78, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xB1, 0xC4, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xB1, 0xF0, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xB3, 0x1A, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xB4, 0x38, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xB6, 0x74, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xB9, 0x98, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xBC, 0x2A, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xBF, 0x46, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xC0, 0x34, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xC3, 0x74, 0x00, 0x01, 0xA9, 0xF0, 0x00, 0x00, 0xC3, 0xCE, 0x00, 0x01, 0xA9, 0xF0, 
-    0x00, 0x00, 0xC4, 0x6A, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x52, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x8C, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0xDA, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x02, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x18, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x2C, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x02, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x52, 0x00, 0x02, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x66, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x10, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x05, 0x5A, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x07, 0x18, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x07, 0x34, 0x00, 0x03, 0xA9, 0xF0, 
-    0x00, 0x00, 0x09, 0xBE, 0x00, 0x03, 0xA9, 0xF0, 0x00, 0x00, 0x0A, 0x44, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x04, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x04, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x05, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x8A, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x01, 0x20, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x02, 0x5C, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x04, 0xD2, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x05, 0xEC, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x06, 0x42, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x06, 0xA2, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x08, 0xDE, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x09, 0x0A, 0x00, 0x06, 0xA9, 0xF0, 0x00, 0x00, 0x09, 0x22, 0x00, 0x06, 0xA9, 0xF0, 
-    0x00, 0x00, 0x09, 0x3E, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x08, 0xD4, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x0C, 0x08, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x0C, 0x88, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x19, 0x54, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x1A, 0xC6, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x1B, 0xEA, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x22, 0x54, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x22, 0x76, 0x00, 0x07, 0xA9, 0xF0, 0x00, 0x00, 0x23, 0xB2, 0x00, 0x07, 0xA9, 0xF0, 
-    0x00, 0x00, 0x24, 0x5E, 0x00, 0x09, 0xA9, 0xF0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0A, 0xA9, 0xF0, 
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x07, 0x5A, 0x00, 0x00, 0x00, 0x01, 0x70, 0x30, 0xA3, 0x1E, 
-    0x4A, 0x40, 0x66, 0x72, 0x30, 0x38, 0x09, 0x34, 0x2B, 0x88, 0x00, 0x0C, 0x4A, 0x78, 0x02, 0x8E, 
-    0x6D, 0x2E, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0x22, 0x48, 0x30, 0x3C, 0xA0, 0x90, 0xA3, 0x46, 
-    0xB3, 0xC8, 0x67, 0x1C, 0x9E, 0xFC, 0x00, 0x10, 0x41, 0xD7, 0x70, 0x02, 0xA0, 0x90, 0x0C, 0x68, 
-    0x00, 0x01, 0x00, 0x06, 0x56, 0xC0, 0x41, 0xFA, 0x00, 0x52, 0x10, 0x80, 0x4F, 0xEF, 0x00, 0x10, 
-    0x61, 0x00, 0x01, 0xBC, 0x61, 0x00, 0x00, 0xF4, 0x61, 0x00, 0x01, 0x46, 0x41, 0xFA, 0x00, 0x24, 
-    0x20, 0x97, 0x20, 0x4D, 0xD0, 0xF8, 0x09, 0x34, 0x4E, 0xA8, 0x00, 0x12, 0x61, 0x00, 0x01, 0xEC, 
-    0x20, 0x4D, 0xD0, 0xF8, 0x09, 0x34, 0x20, 0x68, 0x00, 0x0C, 0xA0, 0x1F, 0x20, 0x7A, 0x00, 0x04, 
-    0x4E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x75, 0x80, 0x0E, 0x33, 0x32, 0x5F, 0x62, 0x69, 0x74, 
-    0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3A, 0x00, 0x00, 
-    0xFF, 0xFA, 0x67, 0x1E, 0x0C, 0x38, 0x00, 0x00, 0x01, 0x2F, 0x67, 0x16, 0x30, 0x3C, 0xA1, 0x98, 
-    0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x04, 0x70, 0x01, 
-    0xA1, 0x98, 0x4E, 0x75, 0x80, 0x0B, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x5F, 0x63, 0x61, 0x63, 0x68, 
-    0x65, 0x00, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0B, 0x70, 0x72, 
-    0x65, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 
-    0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0C, 0x70, 0x6F, 0x73, 0x74, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 0x53, 
-    0x65, 0x67, 0x00, 0x00, 0x20, 0x5F, 0x58, 0x4F, 0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0D, 0x70, 0x72, 
-    0x65, 0x5F, 0x55, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x20, 0x5F, 
-    0x58, 0x4F, 0x42, 0x57, 0x4E, 0xD0, 0x80, 0x0D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x68, 0x61, 
-    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x9C, 0x00, 0x02, 0xFF, 0xB4, 
-    0x00, 0x03, 0xFF, 0xCC, 0x00, 0x04, 0xFF, 0xE6, 0x00, 0x00, 0x48, 0xE7, 0x80, 0xE0, 0x22, 0x4D, 
-    0xD2, 0xF8, 0x09, 0x34, 0x22, 0x69, 0x00, 0x0C, 0x45, 0xFA, 0xFF, 0xDE, 0x30, 0x1A, 0x67, 0x0A, 
-    0x30, 0x5A, 0x41, 0xFB, 0x80, 0xD4, 0x61, 0x1A, 0x60, 0xF2, 0x4C, 0xDF, 0x07, 0x01, 0x4E, 0x75, 
-    0x80, 0x0D, 0x73, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x00, 
-    0x00, 0x00, 0xD0, 0x40, 0xD0, 0x40, 0x2F, 0x31, 0x00, 0x00, 0x23, 0x88, 0x00, 0x00, 0x20, 0x5F, 
-    0x4E, 0x75, 0x80, 0x0A, 0x73, 0x65, 0x74, 0x5F, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x00, 0x00, 
-    0x48, 0xE7, 0x80, 0xC0, 0x42, 0x40, 0x61, 0x00, 0x04, 0xD0, 0xB0, 0xFC, 0x00, 0x00, 0x66, 0x02, 
-    0xA9, 0xFF, 0x59, 0x8F, 0x2F, 0x08, 0xA9, 0xA5, 0x20, 0x5F, 0xD0, 0xF8, 0x09, 0x34, 0x90, 0xFC, 
-    0x00, 0x10, 0x43, 0xFA, 0x00, 0x46, 0x22, 0x88, 0x4C, 0xDF, 0x03, 0x01, 0x4E, 0x75, 0x80, 0x0E, 
-    0x73, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x6A, 0x74, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x00, 0x00, 
-    0x01, 0xF3, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF2, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xF0, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF1, 0x03, 0x72, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3C, 
-    0xA8, 0x8F, 0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x06, 
-    0x43, 0xFA, 0xFF, 0xCE, 0x60, 0x04, 0x43, 0xFA, 0xFF, 0xB8, 0x30, 0x11, 0x67, 0x16, 0xA7, 0x46, 
-    0x23, 0x48, 0x00, 0x04, 0x30, 0x69, 0x00, 0x02, 0x41, 0xFB, 0x80, 0xA6, 0x30, 0x11, 0xA6, 0x47, 
-    0x50, 0x49, 0x60, 0xE6, 0x4E, 0x75, 0x80, 0x0F, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 
-    0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x00, 0x00, 0x00, 0x48, 0xE7, 0x00, 0xC0, 0x30, 0x3C, 
-    0xA8, 0x8F, 0xA3, 0x46, 0x22, 0x48, 0x30, 0x3C, 0xA8, 0x9F, 0xA7, 0x46, 0xB3, 0xC8, 0x67, 0x06, 
-    0x43, 0xFA, 0xFF, 0x7E, 0x60, 0x04, 0x43, 0xFA, 0xFF, 0x68, 0x30, 0x11, 0x67, 0x0A, 0x20, 0x69, 
-    0x00, 0x04, 0xA6, 0x47, 0x50, 0x49, 0x60, 0xF2, 0x4C, 0xDF, 0x03, 0x00, 0x4E, 0x75, 0x80, 0x11, 
-    0x75, 0x6E, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x5F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 
-    0x73, 0x00, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x46, 0x61, 0xB0, 0x4E, 0x75, 0x80, 0x0C, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x5F, 0x4C, 0x61, 0x75, 0x6E, 0x63, 0x68, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x26, 
-    0x61, 0x98, 0x4E, 0x75, 0x80, 0x0B, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x43, 0x68, 0x61, 0x69, 
-    0x6E, 0x00, 0x00, 0x00, 0x2F, 0x3A, 0xFF, 0x2E, 0x61, 0x80, 0x4E, 0x75, 0x80, 0x11, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x5F, 0x45, 0x78, 0x69, 0x74, 0x54, 0x6F, 0x53, 0x68, 0x65, 0x6C, 0x6C, 0x00, 
-    0x00, 0x00, 0x48, 0xE7, 0xF0, 0xC0, 0x20, 0x4D, 0xD0, 0xF8, 0x09, 0x34, 0x0C, 0x68, 0xFF, 0xFF, 
-    0x00, 0x0A, 0x66, 0x00, 0x01, 0x4E, 0x76, 0x00, 0x22, 0x6F, 0x00, 0x18, 0xB3, 0xCD, 0x6D, 0x0C, 
-    0x41, 0xFA, 0xFE, 0xF8, 0x20, 0x50, 0xD1, 0xCD, 0xB3, 0xC8, 0x6F, 0x02, 0x76, 0x01, 0x4A, 0x03, 
-    0x66, 0x0E, 0x30, 0x3C, 0x00, 0x01, 0x41, 0xEF, 0x00, 0x18, 0x61, 0x00, 0x01, 0x42, 0x60, 0x14, 
-    0x30, 0x2F, 0x00, 0x1C, 0x61, 0x00, 0x03, 0x6E, 0x22, 0x50, 0x0C, 0x51, 0xFF, 0xFF, 0x66, 0x00, 
-    0x01, 0x12, 0x60, 0x16, 0x22, 0x6F, 0x00, 0x18, 0x30, 0x29, 0xFF, 0xFC, 0x61, 0x00, 0x03, 0x56, 
-    0x22, 0x50, 0x0C, 0x51, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0xEE, 0xA0, 0x69, 0x08, 0x00, 0x00, 0x07, 
-    0x66, 0x08, 0x4A, 0x38, 0x0B, 0xB2, 0x67, 0x02, 0xA0, 0x64, 0xA0, 0x29, 0x20, 0x10, 0xA0, 0x55, 
-    0x20, 0x40, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x28, 0x00, 0x08, 0x67, 0x1E, 0xD3, 0xE8, 
-    0x00, 0x04, 0x0C, 0x69, 0x4E, 0xF9, 0x00, 0x02, 0x67, 0x00, 0x00, 0x94, 0xD1, 0xA9, 0x00, 0x04, 
-    0x33, 0x7C, 0x4E, 0xF9, 0x00, 0x02, 0x50, 0x49, 0x53, 0x81, 0x66, 0xF0, 0x22, 0x4D, 0xD2, 0xF8, 
-    0x09, 0x34, 0x22, 0x28, 0x00, 0x10, 0x67, 0x1C, 0xD3, 0xE8, 0x00, 0x0C, 0x0C, 0x69, 0x4E, 0xF9, 
-    0x00, 0x02, 0x67, 0x6A, 0xD1, 0xA9, 0x00, 0x04, 0x33, 0x7C, 0x4E, 0xF9, 0x00, 0x02, 0x50, 0x49, 
-    0x53, 0x81, 0x66, 0xF0, 0x22, 0x0D, 0x92, 0xA8, 0x00, 0x18, 0x67, 0x18, 0x4A, 0xA8, 0x00, 0x14, 
-    0x67, 0x12, 0x21, 0x4D, 0x00, 0x18, 0x2F, 0x08, 0x22, 0x48, 0xD1, 0xE8, 0x00, 0x14, 0x61, 0x00, 
-    0x03, 0x4E, 0x20, 0x5F, 0x22, 0x08, 0x92, 0xA8, 0x00, 0x20, 0x67, 0x24, 0x4A, 0xA8, 0x00, 0x20, 
-    0x66, 0x06, 0x06, 0x81, 0x00, 0x00, 0x00, 0x28, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x12, 0x21, 0x48, 
-    0x00, 0x20, 0x2F, 0x08, 0x22, 0x48, 0xD1, 0xE8, 0x00, 0x1C, 0x61, 0x00, 0x03, 0x22, 0x20, 0x5F, 
-    0x4A, 0x03, 0x66, 0x0A, 0x30, 0x3C, 0x00, 0x02, 0x41, 0xEF, 0x00, 0x18, 0x61, 0x50, 0x4E, 0xBA, 
-    0xFC, 0x7C, 0x4A, 0x03, 0x67, 0x10, 0x4C, 0xDF, 0x03, 0x0F, 0x5D, 0x97, 0x2F, 0x57, 0x00, 0x02, 
-    0x4F, 0xEF, 0x00, 0x02, 0x60, 0x06, 0x4C, 0xDF, 0x03, 0x0F, 0x55, 0x97, 0x4A, 0x38, 0x01, 0x2D, 
-    0x67, 0x02, 0xA9, 0xFF, 0x4E, 0x75, 0x30, 0x3C, 0x00, 0x02, 0x20, 0x4F, 0x41, 0xE8, 0x00, 0x18, 
-    0x61, 0x1C, 0x4C, 0xDF, 0x03, 0x0F, 0x2F, 0x3A, 0xFD, 0x9C, 0x4E, 0x75, 0x80, 0x0D, 0x70, 0x61, 
-    0x74, 0x63, 0x68, 0x5F, 0x4C, 0x6F, 0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x48, 0xE7, 
-    0xF0, 0xC0, 0x4C, 0xEF, 0x03, 0x0F, 0x00, 0x1C, 0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 0x7F, 0xFF, 
-    0x00, 0x0A, 0x22, 0x4F, 0x41, 0xEF, 0x00, 0x68, 0x20, 0x50, 0x42, 0x40, 0x61, 0x60, 0x43, 0xE9, 
-    0x00, 0x58, 0x20, 0x11, 0x61, 0x28, 0x55, 0x4F, 0x48, 0x6F, 0x00, 0x02, 0x4E, 0x90, 0x4F, 0xEF, 
-    0x00, 0x5A, 0x4C, 0xDF, 0x03, 0x0F, 0x4E, 0x75, 0x80, 0x11, 0x63, 0x61, 0x6C, 0x6C, 0x5F, 0x75, 
-    0x73, 0x65, 0x72, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x00, 0x00, 0x00, 0x2F, 0x09, 
-    0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x69, 0x00, 0x0C, 0xD0, 0x40, 0xD0, 0x40, 0x41, 0xF1, 
-    0x00, 0x00, 0x20, 0x50, 0x22, 0x5F, 0x4E, 0x75, 0x80, 0x12, 0x73, 0x65, 0x74, 0x5F, 0x76, 0x65, 
-    0x63, 0x74, 0x6F, 0x72, 0x5F, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x00, 0x00, 0x48, 0xE7, 
-    0x80, 0x80, 0x32, 0xBC, 0xFF, 0xFF, 0x42, 0xA9, 0x00, 0x54, 0x33, 0x40, 0x00, 0x52, 0x23, 0x48, 
-    0x00, 0x02, 0x58, 0xA9, 0x00, 0x02, 0x20, 0x50, 0x55, 0x48, 0x23, 0x48, 0x00, 0x06, 0x33, 0x68, 
-    0xFF, 0xFE, 0x00, 0x46, 0x23, 0x7C, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x48, 0x30, 0x28, 0xFF, 0xFE, 
-    0x61, 0x00, 0x01, 0x56, 0x42, 0x69, 0x00, 0x50, 0x4A, 0x90, 0x67, 0x06, 0x13, 0x7C, 0x00, 0xFF, 
-    0x00, 0x50, 0x59, 0x8F, 0x2F, 0x08, 0xA9, 0xA5, 0x23, 0x5F, 0x00, 0x4C, 0x4C, 0xDF, 0x01, 0x01, 
-    0x4E, 0x75, 0x80, 0x0B, 0x66, 0x69, 0x6C, 0x6C, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 
-    0x00, 0x00, 0x48, 0xE7, 0xE0, 0xC0, 0x20, 0x6F, 0x00, 0x18, 0x0C, 0x50, 0x4E, 0xF9, 0x66, 0x00, 
-    0x00, 0xFA, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x0C, 0x69, 0xFF, 0xFF, 0x00, 0x0A, 0x66, 0x00, 
-    0x00, 0xEA, 0x30, 0x28, 0xFF, 0xFE, 0x61, 0x00, 0x01, 0x00, 0x2F, 0x08, 0x20, 0x50, 0x0C, 0x50, 
-    0xFF, 0xFF, 0x20, 0x5F, 0x66, 0x00, 0x00, 0xD4, 0x48, 0xE7, 0x00, 0xC0, 0x4C, 0xEF, 0x03, 0x07, 
-    0x00, 0x08, 0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 0x7F, 0xFF, 0x00, 0x0A, 0x3E, 0xBC, 0xFF, 0xFF, 
-    0x42, 0xAF, 0x00, 0x54, 0x42, 0x6F, 0x00, 0x52, 0x20, 0x4F, 0x41, 0xE8, 0x00, 0x58, 0x22, 0x50, 
-    0x41, 0xE8, 0x00, 0x1C, 0x2F, 0x48, 0x00, 0x02, 0x20, 0x68, 0x00, 0x04, 0x2F, 0x48, 0x00, 0x06, 
-    0x3F, 0x68, 0xFF, 0xFE, 0x00, 0x46, 0x2F, 0x7C, 0x43, 0x4F, 0x44, 0x45, 0x00, 0x48, 0x42, 0x6F, 
-    0x00, 0x50, 0x4A, 0x91, 0x67, 0x06, 0x1F, 0x7C, 0x00, 0xFF, 0x00, 0x50, 0x59, 0x8F, 0x2F, 0x09, 
-    0xA9, 0xA5, 0x2F, 0x5F, 0x00, 0x4C, 0x30, 0x3C, 0x00, 0x03, 0x61, 0x00, 0xFE, 0xD2, 0x55, 0x4F, 
-    0x48, 0x6F, 0x00, 0x02, 0x4E, 0x90, 0x54, 0x4F, 0xDE, 0xFC, 0x00, 0x58, 0x4C, 0xDF, 0x03, 0x00, 
-    0xA0, 0x2A, 0x20, 0x10, 0xA0, 0x55, 0x20, 0x40, 0x22, 0x28, 0x00, 0x08, 0x67, 0x16, 0xD3, 0xE8, 
-    0x00, 0x04, 0x20, 0x08, 0x91, 0xA9, 0x00, 0x04, 0x33, 0x7C, 0xA9, 0xF0, 0x00, 0x02, 0x50, 0x49, 
-    0x53, 0x81, 0x66, 0xF0, 0x22, 0x4D, 0xD2, 0xF8, 0x09, 0x34, 0x22, 0x28, 0x00, 0x10, 0x67, 0x18, 
-    0xD3, 0xE8, 0x00, 0x0C, 0x20, 0x08, 0x91, 0xA9, 0x00, 0x04, 0x33, 0x7C, 0xA9, 0xF0, 0x00, 0x02, 
-    0x50, 0x49, 0x53, 0x81, 0x66, 0xF0, 0x60, 0x06, 0x22, 0x28, 0x00, 0x08, 0x67, 0x0C, 0x61, 0x00, 
-    0xFA, 0x4C, 0x4C, 0xDF, 0x03, 0x07, 0x2E, 0x9F, 0x4E, 0x75, 0x4C, 0xDF, 0x03, 0x07, 0x2F, 0x3A, 
-    0xFB, 0x9C, 0x4E, 0x75, 0x80, 0x0F, 0x70, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x55, 0x6E, 0x6C, 0x6F, 
-    0x61, 0x64, 0x53, 0x65, 0x67, 0x00, 0x00, 0x00, 0x51, 0xF8, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 
-    0x43, 0x4F, 0x44, 0x45, 0x3F, 0x00, 0xA9, 0xA0, 0x30, 0x38, 0x0A, 0x60, 0x20, 0x5F, 0x50, 0xF8, 
-    0x0A, 0x5E, 0x4E, 0x75, 0x80, 0x0B, 0x67, 0x65, 0x74, 0x5F, 0x72, 0x65, 0x73, 0x5F, 0x68, 0x64, 
-    0x6C, 0x00, 0x00, 0x00, 0x50, 0xF8, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 
-    0x3F, 0x00, 0xA9, 0xA0, 0x20, 0x5F, 0x4A, 0x78, 0x0A, 0x60, 0x67, 0x62, 0x4C, 0xEF, 0x03, 0x0F, 
-    0x00, 0x04, 0x9E, 0xFC, 0x00, 0x58, 0x48, 0xEF, 0x7F, 0xFF, 0x00, 0x0A, 0x22, 0x4F, 0x30, 0x38, 
-    0x0A, 0x60, 0x41, 0xEF, 0x00, 0x74, 0x61, 0x00, 0xFE, 0x16, 0x30, 0x3C, 0x00, 0x04, 0x61, 0x00, 
-    0xFD, 0xDE, 0x55, 0x4F, 0x48, 0x6F, 0x00, 0x02, 0x4E, 0x90, 0x30, 0x1F, 0x0C, 0x40, 0x00, 0x01, 
-    0x66, 0x10, 0x2F, 0x6F, 0x00, 0x06, 0x00, 0x74, 0x4F, 0xEF, 0x00, 0x5C, 0x4C, 0xDF, 0x03, 0x0F, 
-    0x60, 0x1C, 0x0C, 0x40, 0x00, 0x02, 0x66, 0x0C, 0x4F, 0xEF, 0x00, 0x5C, 0x4C, 0xDF, 0x03, 0x0F, 
-    0x58, 0x4F, 0x60, 0x0A, 0x61, 0x00, 0xFB, 0x44, 0x70, 0x0F, 0xA9, 0xC9, 0xA9, 0xFF, 0x4E, 0x75, 
-    0x80, 0x09, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x00, 0x00, 0x00, 0x70, 0x00, 
-    0x10, 0x18, 0x67, 0x0A, 0x6A, 0x12, 0x08, 0x80, 0x00, 0x07, 0x61, 0x14, 0x60, 0x0A, 0x61, 0x10, 
-    0x67, 0x12, 0x61, 0x0C, 0x61, 0x0A, 0x61, 0x08, 0xD0, 0x80, 0xD3, 0xC0, 0xD3, 0x91, 0x60, 0xDE, 
-    0xE1, 0x88, 0x10, 0x18, 0x4E, 0x75, 0x80, 0x08, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 
-    0x00, 0x00, 0x00, 0x00, 0xCA, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xD4, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC7, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x10, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2C, 0x20, 0x3C, 
-    0x00, 0x00, 0x02, 0x00, 0xA1, 0x22, 0x28, 0x88, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x42, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x29, 0x7C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 
-    0x6E, 0x6B, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2E, 0x2E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x07, 0xD0, 0xAC, 0x00, 0x08, 0xB0, 0xAC, 0x00, 0x04, 
-    0x6F, 0x52, 0x20, 0x07, 0xD0, 0xAC, 0x00, 0x08, 0x90, 0xAC, 0x00, 0x04, 0x22, 0x3C, 0x00, 0x00, 
-    0x02, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x52, 0x80, 0x22, 0x00, 0xC0, 0xFC, 0x02, 0x00, 
-    0x48, 0x41, 0xC2, 0xFC, 0x02, 0x00, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x2C, 0x00, 0x20, 0x54, 
-    0x20, 0x06, 0xD0, 0xAC, 0x00, 0x04, 0xA0, 0x24, 0x55, 0x8F, 0x3E, 0xB8, 0x02, 0x20, 0x4A, 0x5F, 
-    0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x50, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 
-    0xDD, 0xAC, 0x00, 0x04, 0xDF, 0xAC, 0x00, 0x08, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x91, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 
-    0x6E, 0x6B, 0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x2C, 0x2C, 0x00, 0x08, 0x2F, 0x07, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x68, 0x20, 0x0B, 0x50, 0x4F, 0x67, 0x10, 0x20, 0x4B, 
-    0x22, 0x54, 0x20, 0x06, 0xD0, 0x91, 0x22, 0x40, 0x20, 0x07, 0xA0, 0x2E, 0x60, 0x18, 0x2F, 0x07, 
-    0x70, 0x00, 0x2F, 0x00, 0x20, 0x54, 0x22, 0x06, 0xD2, 0x90, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0xF2, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x93, 0x41, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 
-    0x46, 0x50, 0x76, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x5E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x62, 0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 0x66, 0x12, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE2, 0x62, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x70, 0x02, 0x2F, 0x00, 
-    0x72, 0x00, 0x2F, 0x01, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x6A, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x72, 0x2E, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x6A, 0x2C, 0x2C, 0x00, 0x08, 0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x68, 0x20, 0x54, 0xA0, 0x29, 0x2F, 0x0B, 0x2F, 0x07, 0x70, 0x01, 0x2F, 0x00, 0x20, 0x54, 
-    0x22, 0x06, 0xD2, 0x90, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x22, 0xBE, 0x80, 0x4F, 0xEF, 
-    0x00, 0x34, 0x67, 0x12, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x76, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x20, 0x54, 0xA0, 0x2A, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x5A, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x41, 
-    0x70, 0x70, 0x65, 0x6E, 0x64, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 
-    0x6E, 0x6B, 0x46, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 
-    0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x08, 0x22, 0x06, 0x4E, 0xB9, 
-    0x00, 0x00, 0x73, 0xA4, 0x2E, 0x00, 0x67, 0x16, 0x20, 0x06, 0x90, 0x87, 0x2F, 0x00, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 
-    0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x52, 0x6F, 0x75, 0x6E, 0x64, 0x55, 0x70, 
-    0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x46, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 
-    0x4A, 0x80, 0x66, 0x04, 0x20, 0x54, 0xA0, 0x29, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8F, 0x4C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x53, 0xAC, 0x00, 0x0C, 
-    0x4A, 0xAC, 0x00, 0x0C, 0x66, 0x04, 0x20, 0x54, 0xA0, 0x2A, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x91, 0x55, 0x6E, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 
-    0x6E, 0x6B, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 
-    0x00, 0x08, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0xA0, 0x29, 0x20, 0x6E, 0x00, 0x0C, 0x2E, 0x28, 
-    0x00, 0x08, 0x20, 0x6B, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x00, 
-    0x00, 0x90, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x10, 0x90, 0xAC, 0x00, 0x0C, 0xB0, 0x87, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x20, 0x2F, 0x07, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0x2F, 0x10, 
-    0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xEA, 0xDF, 0xAC, 0x00, 0x0C, 0x20, 0x07, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x24, 0x2F, 0x07, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0x2F, 0x10, 
-    0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0xBE, 0x80, 0x56, 0xC3, 0x44, 0x03, 
-    0x67, 0x28, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x00, 0x20, 0x6E, 0x00, 0x0C, 0x20, 0x50, 0xA0, 0x2A, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x88, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x5F, 0x5F, 0x6C, 0x73, 0x5F, 0x5F, 0x46, 0x52, 0x37, 
-    0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x52, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x18, 0x3A, 0x2E, 0x00, 0x12, 0x3E, 0x2E, 
-    0x00, 0x16, 0x28, 0x6E, 0x00, 0x08, 0x2C, 0x2E, 0x00, 0x18, 0x3F, 0x07, 0xA9, 0x98, 0x59, 0x8F, 
-    0x2F, 0x06, 0x70, 0x00, 0x3F, 0x00, 0xA8, 0x1F, 0x26, 0x5F, 0x20, 0x0B, 0x67, 0x08, 0x55, 0x8F, 
-    0xA9, 0xAF, 0x4A, 0x5F, 0x67, 0x1E, 0x3F, 0x05, 0xA9, 0x98, 0x3F, 0x07, 0xA9, 0x9A, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x06, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0x8A, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x59, 0x8F, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x79, 0xBC, 0x2C, 0x1F, 
-    0x55, 0x8F, 0xA9, 0xAF, 0x4A, 0x5F, 0x67, 0x1A, 0x3F, 0x05, 0xA9, 0x98, 0x3F, 0x07, 0xA9, 0x9A, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x50, 0x4F, 0x2E, 0x2C, 0x00, 0x08, 0x2F, 0x06, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x68, 
-    0x20, 0x54, 0xA0, 0x29, 0x20, 0x4B, 0xA0, 0x29, 0x20, 0x53, 0x22, 0x54, 0x20, 0x07, 0xD0, 0x91, 
-    0x22, 0x40, 0x20, 0x06, 0xA0, 0x2E, 0x20, 0x4B, 0xA0, 0x2A, 0x20, 0x54, 0xA0, 0x2A, 0x50, 0x4F, 
-    0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x41, 0x70, 0x70, 0x65, 0x6E, 
-    0x64, 0x52, 0x73, 0x72, 0x63, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x46, 0x50, 
-    0x63, 0x73, 0x54, 0x32, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 
-    0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x10, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x14, 0x28, 0x93, 
-    0x29, 0x6B, 0x00, 0x04, 0x00, 0x04, 0x29, 0x6B, 0x00, 0x08, 0x00, 0x08, 0x29, 0x6B, 0x00, 0x0C, 
-    0x00, 0x0C, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x20, 
-    0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x50, 
-    0x6F, 0x73, 0x46, 0x52, 0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x50, 0x6F, 0x73, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x79, 
-    0xFF, 0xFF, 0xE3, 0xC8, 0x60, 0x38, 0x2F, 0x0B, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x04, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x04, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x70, 0x01, 0x58, 0x4F, 0x60, 0x08, 0x28, 0x54, 0x20, 0x0C, 
-    0x66, 0xC4, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x28, 
-    0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x5F, 0x5F, 0x31, 0x34, 
-    0x54, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x53, 0x46, 
-    0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x79, 0xFF, 0xFF, 0xE3, 0xC8, 0x60, 0x2C, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xDC, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x04, 
-    0xD0, 0xE9, 0x00, 0x20, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x24, 0x4E, 0x91, 0x28, 0x54, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x0C, 0x66, 0xD0, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x24, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x65, 0x6C, 
-    0x70, 0x5F, 0x5F, 0x31, 0x34, 0x54, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 
-    0x6C, 0x65, 0x72, 0x53, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0C, 0x29, 0x79, 0xFF, 0xFF, 0xE3, 0x60, 0x00, 0x04, 
-    0x70, 0x00, 0x28, 0x80, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x5F, 
-    0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x34, 0x54, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 
-    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x28, 0xB9, 0xFF, 0xFF, 0xE3, 0xC8, 0x23, 0xCC, 0xFF, 0xFF, 0xE3, 0xC8, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 
-    0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x5F, 0x31, 0x34, 0x54, 0x43, 0x6C, 0x61, 
-    0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x10, 0x18, 0x70, 0x00, 0x28, 0x40, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xFC, 
-    0x26, 0x6E, 0x00, 0x10, 0x76, 0x01, 0x22, 0x0C, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x14, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x28, 0x40, 0x20, 0x0C, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x28, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0x1A, 0x28, 0x40, 
-    0x29, 0x79, 0xFF, 0xFF, 0xE3, 0x64, 0x00, 0x04, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x29, 0x6E, 
-    0x00, 0x0C, 0x00, 0x0C, 0x29, 0x4B, 0x00, 0x10, 0x20, 0x0B, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x2D, 0x4C, 0xFF, 0xF8, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0x6C, 0x58, 0x4F, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2A, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 
-    0x65, 0x72, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x4E, 0x61, 0x6D, 0x65, 0x64, 0x43, 0x6C, 0x61, 0x75, 
-    0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x53, 0x46, 0x50, 0x63, 0x50, 0x46, 0x76, 
-    0x5F, 0x76, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x03, 0x20, 0x6E, 0x00, 0x0C, 
-    0x2F, 0x28, 0x00, 0x12, 0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x39, 0x00, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x26, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x29, 0x43, 0x61, 0x6E, 0x48, 0x61, 0x6E, 0x64, 0x6C, 
-    0x65, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x4E, 0x61, 0x6D, 0x65, 0x64, 0x43, 0x6C, 0x61, 0x75, 0x73, 
-    0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x46, 0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 
-    0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x22, 0x68, 0x00, 0x0C, 
-    0x4E, 0x91, 0x4E, 0x5E, 0x4E, 0x75, 0x9F, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x5F, 0x31, 
-    0x39, 0x54, 0x4E, 0x61, 0x6D, 0x65, 0x64, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 
-    0x64, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 
-    0x26, 0x6E, 0x00, 0x08, 0x2F, 0x2B, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 
-    0x00, 0x00, 0x86, 0xD6, 0x4A, 0xAB, 0x00, 0x10, 0x50, 0x4F, 0x67, 0x22, 0x2F, 0x2B, 0x00, 0x10, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xE2, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x4F, 0x49, 0xF9, 
-    0xFF, 0xFF, 0xFE, 0xEC, 0x76, 0x01, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 0x70, 0x0D, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x86, 
-    0x20, 0x6C, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 
-    0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x0D, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0xBC, 0x00, 0x0D, 
-    0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x0D, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 0x72, 0xFF, 
-    0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x00, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 
-    0x50, 0x72, 0x69, 0x6E, 0x74, 0x48, 0x65, 0x6C, 0x70, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x4E, 0x61, 
-    0x6D, 0x65, 0x64, 0x43, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x66, 0x12, 0x70, 0x14, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x18, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 
-    0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 0x20, 0x4C, 0x58, 0x88, 0x28, 0x80, 0x20, 0x0C, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x54, 
-    0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x69, 0x73, 0x74, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x56, 0x20, 0x6E, 0x00, 0x08, 
-    0x26, 0x50, 0x60, 0x2E, 0x28, 0x4B, 0x26, 0x54, 0x20, 0x0C, 0x67, 0x24, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x20, 0x0C, 0x67, 0x0E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x7F, 0x8C, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x20, 0x0B, 0x66, 0xCE, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x16, 0x20, 0x2E, 0x00, 0x0C, 
-    0x08, 0x00, 0x00, 0x00, 0x67, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x69, 0x73, 0x74, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x66, 0x12, 0x70, 0x22, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x1A, 0x70, 0x00, 0x29, 0x40, 0x00, 0x0A, 0x29, 0x40, 0x00, 0x0E, 0x29, 0x40, 
-    0x00, 0x12, 0x29, 0x40, 0x00, 0x16, 0x20, 0x4C, 0x50, 0x88, 0x29, 0x40, 0x00, 0x04, 0x20, 0x0C, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 
-    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x8A, 
-    0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 
-    0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x06, 0x2F, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x36, 0x02, 0x47, 0xEE, 0xFF, 0xE8, 0x2D, 0x53, 0xFF, 0xD6, 0x2D, 0x6B, 0x00, 0x04, 
-    0xFF, 0xDA, 0x2D, 0x6B, 0x00, 0x08, 0xFF, 0xDE, 0x2D, 0x6B, 0x00, 0x0C, 0xFF, 0xE2, 0x41, 0xEE, 
-    0xFF, 0xD6, 0x20, 0x4C, 0x58, 0x88, 0x43, 0xEE, 0xFF, 0xD6, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 
-    0x20, 0xD9, 0x4F, 0xEF, 0x00, 0x10, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x07, 
-    0x2F, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x46, 0x47, 0xEC, 0x00, 0x04, 0x41, 0xEE, 0xFF, 0xE8, 0x2D, 0x48, 0xFF, 0xCE, 
-    0x2D, 0x50, 0xFF, 0xAC, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0xB0, 0x2D, 0x68, 0x00, 0x08, 0xFF, 0xB4, 
-    0x2D, 0x68, 0x00, 0x0C, 0xFF, 0xB8, 0x41, 0xEE, 0xFF, 0xAC, 0x41, 0xEE, 0xFF, 0xAC, 0x2D, 0x48, 
-    0xFF, 0xD2, 0x27, 0x68, 0x00, 0x0C, 0x00, 0x0C, 0x20, 0x4C, 0x58, 0x88, 0x22, 0x4B, 0x20, 0xD9, 
-    0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x60, 0x00, 0x00, 0xD4, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xBE, 
-    0x2D, 0x40, 0xFF, 0xC2, 0x2D, 0x40, 0xFF, 0xC6, 0x2D, 0x40, 0xFF, 0xCA, 0x41, 0xEE, 0xFF, 0xBC, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xBC, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x36, 0x02, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x9C, 0x2D, 0x40, 0xFF, 0xA0, 0x2D, 0x40, 
-    0xFF, 0xA4, 0x2D, 0x40, 0xFF, 0xA8, 0x41, 0xEE, 0xFF, 0x9A, 0x48, 0x6E, 0xFF, 0x9A, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x18, 0x67, 0x0C, 
-    0x70, 0x00, 0x10, 0x2E, 0xFF, 0x9A, 0x0C, 0x00, 0x00, 0x04, 0x65, 0x36, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE2, 0xE4, 0x41, 0xEE, 0xFF, 0x9C, 0x2D, 0x48, 0xFF, 0xB8, 0x2D, 0x50, 0xFF, 0x8A, 0x2D, 0x68, 
-    0x00, 0x04, 0xFF, 0x8E, 0x2D, 0x68, 0x00, 0x08, 0xFF, 0x92, 0x2D, 0x68, 0x00, 0x0C, 0xFF, 0x96, 
-    0x41, 0xEE, 0xFF, 0x8A, 0x41, 0xEE, 0xFF, 0x8A, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 
-    0x50, 0x4F, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0xF6, 0x2D, 0x40, 0xFF, 0xB4, 
-    0x20, 0x40, 0x20, 0x94, 0x20, 0x6E, 0xFF, 0xB4, 0x21, 0x6E, 0xFF, 0xCE, 0x00, 0x04, 0x20, 0x6E, 
-    0xFF, 0xB4, 0x50, 0x88, 0x43, 0xEE, 0xFF, 0x9A, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0xD9, 0x28, 0xAE, 0xFF, 0xB4, 0x58, 0x4F, 0x60, 0x00, 0xFE, 0xCC, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0x82, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x52, 0x65, 0x61, 0x64, 0x4F, 0x70, 0x74, 0x69, 
-    0x6F, 0x6E, 0x73, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x69, 
-    0x73, 0x74, 0x46, 0x50, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xE6, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x1C, 0x2E, 0x2E, 0x00, 0x18, 0x26, 0x6E, 
-    0x00, 0x10, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0xF4, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x67, 0x44, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xE6, 0x0C, 0x40, 0x00, 0x01, 0x66, 0x26, 
-    0x26, 0xAE, 0xFF, 0xFC, 0xBE, 0x93, 0x6E, 0x04, 0xBC, 0x93, 0x6C, 0x16, 0x2F, 0x06, 0x2F, 0x07, 
-    0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xE2, 0xF6, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x4F, 0xEF, 
-    0x00, 0x10, 0x70, 0x01, 0x60, 0x2C, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x1E, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x60, 0x16, 0x4A, 0xAE, 0x00, 0x14, 0x66, 0x10, 0x2F, 0x0C, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE3, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x7C, 0x00, 
-    0x20, 0x06, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xD6, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x47, 0x65, 
-    0x74, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 
-    0x6F, 0x6E, 0x4C, 0x69, 0x73, 0x74, 0x46, 0x50, 0x63, 0x50, 0x6C, 0x69, 0x6C, 0x54, 0x34, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x54, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x7A, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2B, 0x00, 0x04, 
-    0x4E, 0xB9, 0x00, 0x00, 0x39, 0x00, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x60, 0x20, 0x6E, 0x00, 0x10, 
-    0x22, 0x4B, 0x50, 0x89, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x2D, 0x4B, 
-    0xFF, 0xF8, 0x26, 0x53, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x8B, 
-    0x60, 0x02, 0x28, 0x8B, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x2C, 0x20, 0x6E, 0xFF, 0xF8, 0x2F, 0x28, 
-    0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x10, 0x2F, 0x2E, 
-    0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x01, 0x60, 0x0C, 0x2D, 0x4B, 0xFF, 0xFC, 
-    0x26, 0x53, 0x20, 0x0B, 0x66, 0x82, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x24, 0x46, 0x69, 0x6E, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x5F, 
-    0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x69, 0x73, 0x74, 0x46, 0x50, 0x63, 
-    0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0x94, 0x67, 0x52, 0x26, 0x54, 0x20, 0x6E, 0x00, 0x0C, 
-    0x20, 0xAB, 0x00, 0x04, 0x70, 0x00, 0x27, 0x40, 0x00, 0x04, 0x20, 0x6E, 0x00, 0x10, 0x22, 0x4B, 
-    0x50, 0x89, 0x72, 0x05, 0x20, 0xD9, 0x51, 0xC9, 0xFF, 0xFC, 0x30, 0xD9, 0x28, 0x93, 0x22, 0x0B, 
-    0x67, 0x24, 0x2F, 0x2B, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x20, 0x0B, 0x67, 0x0E, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x25, 0x4E, 0x65, 0x78, 0x74, 0x4F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 
-    0x69, 0x73, 0x74, 0x46, 0x52, 0x50, 0x63, 0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE2, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x41, 0xEE, 0xFF, 0xE6, 0x60, 0x36, 0x2F, 0x2E, 0xFF, 0xE2, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x4A, 0x94, 0x50, 0x4F, 0x67, 0x14, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE3, 0x5C, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x4F, 
-    0x2F, 0x2E, 0xFF, 0xE2, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xE2, 0x58, 0x4F, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x48, 0x6E, 0xFF, 0xE2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x0D, 0xBC, 0x4A, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x66, 0xB2, 0x47, 0xF9, 0xFF, 0xFF, 0xFE, 0xEC, 0x76, 0x01, 0x20, 0x6B, 0x00, 0x04, 
-    0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x14, 0x70, 0x0D, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x00, 0x00, 0x86, 0x20, 0x6B, 0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x0D, 0x2F, 0x00, 
-    0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 
-    0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 
-    0x00, 0x0C, 0x10, 0xBC, 0x00, 0x0D, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x0D, 0x72, 0x00, 
-    0x12, 0x00, 0x20, 0x01, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xD6, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9F, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x4C, 0x65, 0x66, 0x74, 0x6F, 0x76, 
-    0x65, 0x72, 0x73, 0x5F, 0x5F, 0x31, 0x31, 0x54, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x69, 
-    0x73, 0x74, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x32, 0x29, 0x79, 0xFF, 0xFF, 0xE3, 0x64, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x26, 
-    0x20, 0x0C, 0x67, 0x0C, 0x29, 0x79, 0xFF, 0xFF, 0xE3, 0x60, 0x00, 0x04, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x00, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x5F, 
-    0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x4E, 0x61, 0x6D, 0x65, 0x64, 0x43, 0x6C, 0x61, 
-    0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x20, 0x29, 0x79, 0xFF, 0xFF, 
-    0xE3, 0x60, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x14, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 
-    0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x34, 0x54, 0x43, 0x6C, 
-    0x61, 0x75, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x21, 0x40, 0x00, 0x02, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x90, 0x52, 0x65, 0x73, 0x65, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x52, 0x43, 0x31, 
-    0x36, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x18, 0x2A, 0x2E, 
-    0x00, 0x10, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x60, 0x4E, 0x7E, 0x00, 0x1E, 0x1C, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xAB, 0x00, 0x02, 0xB1, 0x87, 0x70, 0x0F, 0xC0, 0x87, 
-    0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xE3, 0xEC, 0x7C, 0x00, 0x3C, 0x30, 0x00, 0x00, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0xF0, 0xC0, 0x87, 0xE8, 0x88, 0xD0, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 0xE3, 0xCC, 
-    0x72, 0x00, 0x32, 0x30, 0x00, 0x00, 0xB3, 0x86, 0x20, 0x2B, 0x00, 0x02, 0xE0, 0x88, 0x22, 0x06, 
-    0xB3, 0x80, 0x27, 0x40, 0x00, 0x02, 0x20, 0x05, 0x53, 0x85, 0x4A, 0x85, 0x66, 0xAE, 0x4C, 0xEE, 
-    0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 
-    0x43, 0x52, 0x43, 0x5F, 0x5F, 0x36, 0x54, 0x43, 0x52, 0x43, 0x31, 0x36, 0x46, 0x50, 0x55, 0x63, 
-    0x55, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x2C, 
-    0x00, 0x04, 0x38, 0x80, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x47, 0x65, 0x74, 
-    0x5F, 0x5F, 0x36, 0x54, 0x43, 0x52, 0x43, 0x31, 0x36, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xDA, 0x48, 0xE7, 0x10, 0x08, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x00, 0x01, 0xA0, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xE6, 0x0C, 0x40, 0x00, 0x02, 0x66, 0x00, 
-    0x01, 0x80, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x5C, 0x66, 0x42, 0x70, 0x00, 0x28, 0x40, 0x76, 0x01, 
-    0x22, 0x0C, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x14, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x58, 0x8F, 0x26, 0x1F, 0x28, 0x40, 0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x70, 0x0C, 0x29, 0x40, 0x00, 0x10, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xCC, 0xFF, 0xFF, 0xF1, 0x5C, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0xF1, 0x70, 0x66, 0x00, 0x00, 0xEA, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x70, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x6C, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x68, 0x50, 0x4F, 0x66, 0x00, 
-    0x00, 0xBE, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0xF1, 0x64, 0x48, 0x79, 0x00, 0x00, 0x01, 0x0A, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x64, 0x2F, 0x3C, 
-    0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x68, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xF1, 0x68, 0x2F, 0x3C, 0x70, 0x74, 0x70, 0x74, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 
-    0x48, 0x78, 0x04, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x68, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0xF1, 0x60, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x60, 0x4F, 0xEF, 0x00, 0x30, 0x67, 0x30, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x60, 0x2F, 0x3C, 0x67, 0x6C, 0x70, 0x74, 
-    0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x04, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xF1, 0x60, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x0E, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x2D, 0x6E, 
-    0x00, 0x08, 0xFF, 0xDA, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xDE, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x40, 0xFF, 0xE2, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xE2, 
-    0x4E, 0xB9, 0x00, 0x00, 0x64, 0xDC, 0x70, 0x0C, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xDA, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xF1, 0x5C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x18, 0x60, 0x12, 
-    0x48, 0x6E, 0xFF, 0xE6, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x35, 0x9C, 
-    0x50, 0x4F, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xD2, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x54, 0x72, 0x79, 
-    0x50, 0x61, 0x74, 0x63, 0x68, 0x49, 0x6E, 0x66, 0x6F, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 
-    0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 
-    0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 0xF3, 0x28, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x30, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 
-    0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 
-    0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x4A, 0xAE, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x10, 0x6D, 0x08, 
-    0x70, 0x04, 0xB0, 0xAE, 0xFF, 0xFC, 0x6C, 0x12, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE4, 0x48, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 
-    0xF3, 0x28, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x52, 0x4F, 0x4D, 0x45, 0x78, 0x74, 0x49, 0x44, 0x48, 
-    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 
-    0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 0xF3, 0x2C, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x70, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 
-    0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 
-    0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0x2C, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x52, 0x4F, 0x4D, 0x45, 0x78, 0x74, 0x53, 0x74, 0x61, 0x72, 0x74, 0x48, 0x61, 
-    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xBC, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0x8A, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xBC, 0x72, 0x00, 
-    0x2D, 0x41, 0xFF, 0xE8, 0x2D, 0x41, 0xFF, 0xEC, 0x2D, 0x41, 0xFF, 0xF0, 0x2D, 0x41, 0xFF, 0xF4, 
-    0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x23, 0xEE, 0xFF, 0xFC, 
-    0xFF, 0xFF, 0xF3, 0x1C, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x4D, 0x61, 0x6E, 0x75, 0x66, 0x61, 0x63, 
-    0x74, 0x75, 0x72, 0x65, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xB8, 0x67, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE4, 0xA6, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x01, 0x23, 0xC0, 
-    0xFF, 0xFF, 0xEA, 0xB8, 0x72, 0x00, 0x2D, 0x41, 0xFF, 0xE8, 0x2D, 0x41, 0xFF, 0xEC, 0x2D, 0x41, 
-    0xFF, 0xF0, 0x2D, 0x41, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 
-    0x36, 0x02, 0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0x20, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x56, 
-    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xDA, 0x48, 0xE7, 0x13, 0x08, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 
-    0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x02, 0x2F, 0x01, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xCC, 
-    0x4F, 0xEF, 0x00, 0x10, 0x66, 0x2C, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xCC, 0x48, 0x79, 0x00, 0x00, 0x00, 0xEA, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xEA, 0xCC, 0x2F, 0x3C, 0x70, 0x6B, 0x67, 0x6C, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 
-    0x00, 0x10, 0x28, 0x79, 0xFF, 0xFF, 0xEA, 0xCC, 0x2E, 0x2C, 0x00, 0x08, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x68, 0x2F, 0x07, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEA, 0xCC, 0x48, 0x6E, 0xFF, 0xDA, 0x4E, 0xB9, 0x00, 0x00, 0x5F, 0xCA, 0x41, 0xEE, 
-    0xFF, 0xDA, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x60, 0x24, 0x4A, 0x80, 
-    0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x2C, 0x03, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x12, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xB8, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x50, 0x4F, 0x2F, 0x07, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x11, 0x40, 
-    0x50, 0x4F, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xCA, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x50, 0x61, 0x63, 
-    0x6B, 0x61, 0x67, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xCC, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xC4, 0x67, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE4, 0xD4, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 
-    0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x02, 0x2F, 0x01, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xC8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xCE, 
-    0x2D, 0x40, 0xFF, 0xD2, 0x2D, 0x40, 0xFF, 0xD6, 0x2D, 0x40, 0xFF, 0xDA, 0x41, 0xEE, 0xFF, 0xCC, 
-    0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xCC, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 
-    0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x24, 0x67, 0x64, 0x0C, 0xAE, 
-    0x00, 0x00, 0x10, 0x00, 0xFF, 0xE2, 0x66, 0x1E, 0x48, 0x79, 0x00, 0x00, 0x01, 0x02, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEA, 0xC8, 0x2F, 0x3C, 0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x58, 0x0C, 0xAE, 0x00, 0x00, 0x04, 0x00, 0xFF, 0xE2, 0x66, 0x1E, 
-    0x48, 0x79, 0x00, 0x00, 0x01, 0x0A, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC8, 0x2F, 0x3C, 0x70, 0x61, 
-    0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x30, 0x2F, 0x2E, 
-    0xFF, 0xE2, 0x48, 0x79, 0xFF, 0xFF, 0xE4, 0xEA, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 
-    0x60, 0x1C, 0x48, 0x79, 0x00, 0x00, 0x01, 0x12, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC8, 0x2F, 0x3C, 
-    0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xC4, 0x2F, 0x2E, 
-    0xFF, 0xF8, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC4, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x68, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC4, 0x2F, 0x3C, 0x64, 0x69, 0x61, 0x67, 0x4E, 0xB9, 
-    0x00, 0x00, 0x58, 0xC8, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x44, 0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 
-    0x74, 0x69, 0x63, 0x73, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xBC, 0x48, 0xE7, 0x01, 0x08, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 
-    0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xBE, 0x2D, 0x40, 
-    0xFF, 0xC2, 0x2D, 0x40, 0xFF, 0xC6, 0x2D, 0x40, 0xFF, 0xCA, 0x41, 0xEE, 0xFF, 0xBC, 0x48, 0x6E, 
-    0xFF, 0xBC, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x4A, 0x80, 
-    0x4F, 0xEF, 0x00, 0x18, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0x1C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6D, 0xB0, 0x58, 0x4F, 0x1E, 0x2E, 0xFF, 0xBC, 0x70, 0x00, 0x10, 0x07, 0x0C, 0x40, 0x00, 0x02, 
-    0x67, 0x18, 0x70, 0x00, 0x10, 0x07, 0x0C, 0x40, 0x00, 0x03, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE5, 0x40, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x48, 0x6E, 0xFF, 0xD6, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x59, 0x1C, 0x4A, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x28, 0x6E, 
-    0xFF, 0xDA, 0x60, 0x20, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 
-    0x4F, 0xEF, 0x00, 0x10, 0x2E, 0x2C, 0x00, 0x08, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xBC, 0x0C, 0x40, 
-    0x00, 0x02, 0x66, 0x10, 0x2F, 0x2E, 0xFF, 0xCE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x01, 0x68, 
-    0x50, 0x4F, 0x60, 0x20, 0x70, 0x00, 0x10, 0x2E, 0xFF, 0xBC, 0x0C, 0x40, 0x00, 0x03, 0x66, 0x14, 
-    0x2F, 0x2E, 0xFF, 0xD2, 0x2F, 0x2E, 0xFF, 0xCE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x11, 0x40, 0x50, 0x4F, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xB4, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 
-    0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFE, 0xA8, 0x48, 0xE7, 0x0F, 0x18, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 
-    0x00, 0x00, 0x36, 0x02, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0xCE, 0x2D, 0x40, 0xFE, 0xD2, 0x2D, 0x40, 
-    0xFE, 0xD6, 0x2D, 0x40, 0xFE, 0xDA, 0x41, 0xEE, 0xFE, 0xCC, 0x48, 0x6E, 0xFE, 0xCC, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x18, 
-    0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0x64, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 
-    0x1C, 0x2E, 0xFE, 0xCC, 0x70, 0x00, 0x10, 0x06, 0x0C, 0x40, 0x00, 0x02, 0x67, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE5, 0x76, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x2C, 0x2E, 0xFE, 0xE2, 
-    0x0C, 0x86, 0x00, 0x00, 0x00, 0xFE, 0x6F, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0x92, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x20, 0x6E, 0xFE, 0xDE, 0x43, 0xEE, 0xFE, 0xE7, 0x20, 0x06, 
-    0xA0, 0x2E, 0x1D, 0x46, 0xFE, 0xE6, 0x28, 0x2E, 0xFF, 0xFC, 0x55, 0x8F, 0xA9, 0x94, 0x3C, 0x1F, 
-    0x70, 0x00, 0x1F, 0x00, 0xA9, 0x9B, 0x55, 0x8F, 0x48, 0x6E, 0xFE, 0xE6, 0xA9, 0x97, 0x3A, 0x1F, 
-    0x0C, 0x45, 0xFF, 0xFF, 0x66, 0x1C, 0x70, 0x01, 0x1F, 0x00, 0xA9, 0x9B, 0x3F, 0x06, 0xA9, 0x98, 
-    0x2F, 0x2E, 0xFE, 0xDE, 0x48, 0x79, 0xFF, 0xFF, 0xE5, 0xB2, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x50, 0x4F, 0x70, 0x01, 0x1F, 0x00, 0xA9, 0x9B, 0x0C, 0x84, 0x2D, 0x41, 0x4C, 0x4C, 0x67, 0x5E, 
-    0x48, 0x6E, 0xFE, 0xBC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x59, 0x1C, 0x4A, 0x80, 
-    0x50, 0x4F, 0x67, 0x06, 0x26, 0x6E, 0xFE, 0xC0, 0x60, 0x20, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x10, 0x28, 0x2B, 0x00, 0x08, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x48, 0xC5, 0x2F, 0x05, 0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x2E, 0xFE, 0xDE, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0xE4, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x00, 0x00, 0xAA, 0x3F, 0x05, 
-    0xA9, 0x98, 0x55, 0x8F, 0xA8, 0x1C, 0x30, 0x1F, 0x48, 0xC0, 0x28, 0x00, 0x70, 0x01, 0xB0, 0x84, 
-    0x6F, 0x1A, 0x3F, 0x06, 0xA9, 0x98, 0x3F, 0x05, 0xA9, 0x9A, 0x2F, 0x2E, 0xFE, 0xDE, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE5, 0xD6, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x7E, 0x01, 0x60, 0x72, 
-    0x48, 0x6E, 0xFE, 0xC8, 0x3F, 0x07, 0xA8, 0x0F, 0x0C, 0xAE, 0x76, 0x65, 0x72, 0x73, 0xFE, 0xC8, 
-    0x67, 0x5C, 0x48, 0x6E, 0xFE, 0xA8, 0x2F, 0x2E, 0xFE, 0xC8, 0x4E, 0xB9, 0x00, 0x00, 0x59, 0x1C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x67, 0x06, 0x28, 0x6E, 0xFE, 0xAC, 0x60, 0x20, 0x70, 0x00, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x2F, 0x2E, 
-    0xFE, 0xC8, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x10, 0x2D, 0x6C, 0x00, 0x08, 
-    0xFE, 0xB8, 0x2F, 0x2E, 0xFE, 0xC8, 0x48, 0xC5, 0x2F, 0x05, 0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x2E, 
-    0xFE, 0xDE, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xE4, 0x4F, 0xEF, 0x00, 0x14, 0x20, 0x07, 
-    0x52, 0x87, 0xB8, 0x87, 0x6C, 0x8A, 0x3F, 0x06, 0xA9, 0x98, 0x3F, 0x05, 0xA9, 0x9A, 0x4C, 0xEE, 
-    0x18, 0xF0, 0xFE, 0x90, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x52, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 
-    0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xD4, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xD8, 0x66, 0x4E, 0x70, 0x00, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xD8, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD8, 0x2F, 0x3C, 0x72, 0x6F, 0x6D, 0x20, 0x4E, 0xB9, 
-    0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xEA, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x79, 0xFF, 0xFF, 0xEA, 0xD8, 0x20, 0x54, 
-    0x20, 0x10, 0x20, 0x40, 0x70, 0x01, 0x20, 0x80, 0x4F, 0xEF, 0x00, 0x1C, 0x48, 0x6E, 0xFF, 0xE4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x09, 0x16, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x48, 0x6E, 0xFF, 0xE4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x0A, 0x4E, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 
-    0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x06, 
-    0x48, 0x6E, 0xFF, 0xE4, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 
-    0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE6, 0x0C, 0x48, 0x6E, 0xFF, 0xE4, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x4A, 0xAE, 
-    0xFF, 0xE4, 0x4F, 0xEF, 0x00, 0x3C, 0x67, 0x50, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x14, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x48, 0x6E, 0xFF, 0xE4, 0x4E, 0xB9, 
-    0x00, 0x00, 0x0E, 0x54, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x2E, 0x49, 0xEE, 0xFF, 0xE8, 0x2D, 0x54, 
-    0xFF, 0xD4, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xD8, 0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xDC, 0x2D, 0x6C, 
-    0x00, 0x0C, 0xFF, 0xE0, 0x41, 0xEE, 0xFF, 0xD4, 0x41, 0xEE, 0xFF, 0xD4, 0x2F, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x14, 0x70, 0x08, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF8, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x26, 0x79, 0xFF, 0xFF, 
-    0xEA, 0xD8, 0x20, 0x53, 0x20, 0x10, 0x20, 0x40, 0x52, 0xA8, 0x00, 0x04, 0x70, 0x02, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xE4, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0x70, 0x4F, 0xEF, 0x00, 0x14, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xCC, 0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x52, 0x4F, 0x4D, 0x48, 0x61, 0x6E, 0x64, 
-    0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xC8, 0x48, 0xE7, 
-    0x00, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xD4, 0x66, 0x4E, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xD4, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEA, 0xD4, 0x2F, 0x3C, 0x72, 0x61, 0x6D, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 
-    0x48, 0x78, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD4, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x28, 0x79, 0xFF, 0xFF, 0xEA, 0xD4, 0x20, 0x54, 0x20, 0x10, 0x20, 0x40, 
-    0x70, 0x01, 0x20, 0x80, 0x4F, 0xEF, 0x00, 0x1C, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x09, 0x16, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x0A, 0x4E, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEC, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x3E, 0x48, 0x6E, 0xFF, 0xD8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 
-    0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x44, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 
-    0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF4, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE6, 0x4C, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 
-    0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x50, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x5A, 0x48, 0x6E, 0xFF, 0xD8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x4A, 0xAE, 0xFF, 0xD8, 0x4F, 0xEF, 0x00, 0x84, 0x67, 0x50, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x64, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x86, 0xD6, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0E, 0x54, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE6, 0x7E, 0x49, 0xEE, 0xFF, 0xDC, 0x2D, 0x54, 0xFF, 0xC8, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xCC, 
-    0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xD0, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xD4, 0x41, 0xEE, 0xFF, 0xC8, 
-    0x41, 0xEE, 0xFF, 0xC8, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x14, 
-    0x70, 0x14, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEC, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD4, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x26, 0x79, 0xFF, 0xFF, 0xEA, 0xD4, 0x20, 0x53, 0x20, 0x10, 0x20, 0x40, 
-    0x52, 0xA8, 0x00, 0x04, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x09, 0x70, 0x4F, 0xEF, 0x00, 0x14, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xC0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8E, 0x52, 0x41, 0x4D, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xC8, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xD0, 
-    0x66, 0x4E, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 
-    0xEA, 0xD0, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD0, 0x2F, 0x3C, 0x66, 0x6C, 
-    0x73, 0x68, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD0, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x79, 0xFF, 0xFF, 
-    0xEA, 0xD0, 0x20, 0x54, 0x20, 0x10, 0x20, 0x40, 0x70, 0x01, 0x20, 0x80, 0x4F, 0xEF, 0x00, 0x1C, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0x16, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 
-    0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0A, 0x4E, 0x48, 0x78, 0x00, 0xFF, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0x8E, 0x48, 0x6E, 
-    0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x1D, 0x6E, 0xFF, 0xFF, 0xFF, 0xEC, 0x48, 0x78, 
-    0x00, 0xFF, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE6, 0x9C, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x1D, 0x6E, 0xFF, 0xFF, 
-    0xFF, 0xED, 0x48, 0x78, 0x00, 0xFF, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xA8, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 
-    0x1D, 0x6E, 0xFF, 0xFF, 0xFF, 0xEE, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x01, 
-    0x48, 0x6E, 0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xBC, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x0C, 0x20, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 0x70, 0x00, 
-    0x1D, 0x40, 0xFF, 0xEF, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xC6, 0x48, 0x6E, 
-    0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 
-    0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE6, 0xCC, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 
-    0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF8, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xD6, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 
-    0x4A, 0xAE, 0xFF, 0xD8, 0x4F, 0xEF, 0x00, 0xB4, 0x67, 0x50, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xDC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x48, 0x6E, 0xFF, 0xD8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x0E, 0x54, 0x48, 0x79, 0xFF, 0xFF, 0xE6, 0xF6, 0x49, 0xEE, 0xFF, 0xDC, 
-    0x2D, 0x54, 0xFF, 0xC8, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xCC, 0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xD0, 
-    0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xD4, 0x41, 0xEE, 0xFF, 0xC8, 0x41, 0xEE, 0xFF, 0xC8, 0x2F, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x14, 0x70, 0x10, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xEC, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xD0, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x26, 0x79, 
-    0xFF, 0xFF, 0xEA, 0xD0, 0x20, 0x53, 0x20, 0x10, 0x20, 0x40, 0x52, 0xA8, 0x00, 0x04, 0x70, 0x02, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x09, 0x70, 0x4F, 0xEF, 0x00, 0x14, 
-    0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xC0, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x46, 0x6C, 0x61, 0x73, 0x68, 
-    0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xCC, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 0xEA, 0xC0, 0x66, 0x4E, 0x70, 0x00, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xEA, 0xC0, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC0, 0x2F, 0x3C, 0x72, 0x61, 0x6C, 0x63, 0x4E, 0xB9, 
-    0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x00, 0x08, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xEA, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x28, 0x79, 0xFF, 0xFF, 0xEA, 0xC0, 0x20, 0x54, 
-    0x20, 0x10, 0x20, 0x40, 0x70, 0x01, 0x20, 0x80, 0x4F, 0xEF, 0x00, 0x1C, 0x48, 0x6E, 0xFF, 0xDC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x09, 0x16, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x48, 0x6E, 0xFF, 0xDC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x0A, 0x4E, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 
-    0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x06, 
-    0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 
-    0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF4, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE7, 0x0A, 0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 0x0C, 0x20, 0x2F, 0x3C, 
-    0x7F, 0xFF, 0xFF, 0xFF, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xFC, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x0E, 0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x0C, 0x20, 0x22, 0x2E, 0xFF, 0xFC, 0x20, 0x01, 0xC2, 0xFC, 0x04, 0x00, 0x48, 0x40, 0xC0, 0xFC, 
-    0x04, 0x00, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x20, 0x01, 0x72, 0x64, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x5C, 0x2D, 0x40, 0xFF, 0xF8, 0x4A, 0xAE, 0xFF, 0xDC, 0x4F, 0xEF, 0x00, 0x54, 0x67, 0x50, 
-    0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x16, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x86, 0xD6, 0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 0x0E, 0x54, 0x48, 0x79, 0xFF, 0xFF, 
-    0xE7, 0x30, 0x49, 0xEE, 0xFF, 0xE0, 0x2D, 0x54, 0xFF, 0xCC, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xD0, 
-    0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xD4, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xD8, 0x41, 0xEE, 0xFF, 0xCC, 
-    0x41, 0xEE, 0xFF, 0xCC, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x14, 
-    0x70, 0x0C, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF0, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xC0, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x26, 0x79, 0xFF, 0xFF, 0xEA, 0xC0, 0x20, 0x53, 0x20, 0x10, 0x20, 0x40, 
-    0x52, 0xA8, 0x00, 0x04, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xDC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x09, 0x70, 0x4F, 0xEF, 0x00, 0x14, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xC4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x93, 0x52, 0x41, 0x4D, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 
-    0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x58, 
-    0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x40, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 
-    0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 0x72, 0x01, 
-    0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 0x23, 0xEE, 
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF1, 0x58, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x50, 0x61, 0x74, 0x63, 0x68, 
-    0x54, 0x61, 0x62, 0x6C, 0x65, 0x41, 0x64, 0x64, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 
-    0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE6, 0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 
-    0xF1, 0x54, 0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x60, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 0xFF, 0xF0, 
-    0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x72, 0x01, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x02, 
-    0x23, 0xEE, 0xFF, 0xFC, 0xFF, 0xFF, 0xF1, 0x54, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x50, 0x68, 0x79, 
-    0x73, 0x53, 0x74, 0x61, 0x72, 0x74, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x5F, 0x5F, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 0x23, 0xC0, 0xFF, 0xFF, 0xF3, 0x2C, 
-    0x23, 0xC0, 0xFF, 0xFF, 0xF3, 0x28, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x82, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0x62, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0x98, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE7, 0x9C, 0x48, 0x79, 0x00, 0x00, 0x00, 0x6A, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xBA, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xC0, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0xCA, 0x48, 0x79, 0xFF, 0xFF, 0xE7, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE7, 0xEA, 0x48, 0x79, 0x00, 0x00, 0x00, 0x72, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x02, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x10, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0x7A, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE8, 0x28, 0x48, 0x79, 0x00, 0x00, 0x00, 0x82, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x4E, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x56, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0x8A, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0x84, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE8, 0x90, 0x48, 0x79, 0x00, 0x00, 0x00, 0xA2, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xBA, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xE8, 0xBE, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0xAA, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0x12, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE9, 0x16, 0x48, 0x79, 0x00, 0x00, 0x00, 0xB2, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0xA2, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0xA8, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0xBA, 0x48, 0x79, 0xFF, 0xFF, 0xE9, 0xD4, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xE9, 0xE2, 0x48, 0x79, 0x00, 0x00, 0x00, 0x92, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0x20, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0x26, 0x48, 0x79, 0x00, 0x00, 
-    0x00, 0x9A, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0x74, 0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEA, 0x7E, 0x48, 0x79, 0x00, 0x00, 0x00, 0xC2, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xA8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x06, 0xB0, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x49, 0x6E, 0x69, 0x74, 0x48, 
-    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x20, 0x2C, 
-    0x00, 0x0C, 0x90, 0xAC, 0x00, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xDC, 0x2F, 0x2C, 
-    0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xE0, 0x4A, 0x94, 0x67, 0x04, 0x20, 0x14, 0x60, 0x08, 
-    0x41, 0xF9, 0xFF, 0xFF, 0xEA, 0xEC, 0x20, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xF6, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xD0, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 
-    0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x8C, 0xD0, 0x20, 0x0B, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x5F, 0x5F, 0x6C, 0x73, 0x5F, 0x5F, 0x46, 
-    0x52, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x52, 0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x50, 0x6F, 0x73, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x32, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x3A, 0x28, 0xAE, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x10, 
-    0x00, 0x04, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 
-    0x48, 0x79, 0x00, 0x00, 0x00, 0xD2, 0x70, 0x1A, 0x2F, 0x00, 0x72, 0x01, 0x2F, 0x01, 0x48, 0x6C, 
-    0x00, 0x18, 0x4E, 0xB9, 0x00, 0x00, 0x80, 0x04, 0x70, 0x00, 0x29, 0x40, 0x00, 0x14, 0x4F, 0xEF, 
-    0x00, 0x10, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 0x52, 0x37, 0x69, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x3A, 0x20, 0x0C, 0x67, 0x36, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 
-    0x48, 0x79, 0x00, 0x00, 0x00, 0xDA, 0x72, 0x1A, 0x2F, 0x01, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6C, 
-    0x00, 0x18, 0x4E, 0xB9, 0x00, 0x00, 0x80, 0xB8, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 
-    0x4F, 0xEF, 0x00, 0x18, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x36, 
-    0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x03, 0x00, 0x1E, 0x2E, 0x00, 0x0B, 0x0C, 0x07, 0x00, 0x30, 0x6D, 0x10, 0x0C, 0x07, 0x00, 0x39, 
-    0x6E, 0x0A, 0x48, 0x87, 0x3C, 0x07, 0x9C, 0x7C, 0x00, 0x30, 0x60, 0x2A, 0x0C, 0x07, 0x00, 0x41, 
-    0x6D, 0x10, 0x0C, 0x07, 0x00, 0x46, 0x6E, 0x0A, 0x48, 0x87, 0x3C, 0x07, 0x9C, 0x7C, 0x00, 0x37, 
-    0x60, 0x14, 0x0C, 0x07, 0x00, 0x61, 0x6D, 0x0E, 0x0C, 0x07, 0x00, 0x66, 0x6E, 0x08, 0x48, 0x87, 
-    0x3C, 0x07, 0x9C, 0x7C, 0x00, 0x57, 0x10, 0x06, 0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x48, 0x65, 0x78, 0x44, 0x69, 0x67, 0x69, 0x74, 0x5F, 0x5F, 0x46, 0x63, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x0B, 
-    0x66, 0x12, 0x70, 0x1A, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x26, 0x40, 0x20, 0x0B, 
-    0x58, 0x4F, 0x67, 0x62, 0x16, 0xAE, 0x00, 0x0F, 0x49, 0xEB, 0x00, 0x02, 0x76, 0x01, 0x20, 0x0C, 
-    0x66, 0x18, 0x2F, 0x03, 0x70, 0x10, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 
-    0x26, 0x1F, 0x28, 0x40, 0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x28, 0x20, 0x6E, 
-    0x00, 0x10, 0x28, 0x90, 0x20, 0x6E, 0x00, 0x10, 0x29, 0x68, 0x00, 0x04, 0x00, 0x04, 0x20, 0x6E, 
-    0x00, 0x10, 0x29, 0x68, 0x00, 0x08, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0x00, 0x0C, 
-    0x29, 0x48, 0x00, 0x0C, 0x60, 0x04, 0x30, 0x7C, 0x00, 0x00, 0x27, 0x6E, 0x00, 0x14, 0x00, 0x12, 
-    0x27, 0x6E, 0x00, 0x18, 0x00, 0x16, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x23, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 
-    0x6E, 0x46, 0x34, 0x4B, 0x69, 0x6E, 0x64, 0x52, 0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 0x72, 0x63, 
-    0x65, 0x50, 0x6F, 0x73, 0x50, 0x63, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x1A, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x20, 0x18, 0xAE, 0x00, 0x0F, 0x2F, 0x2E, 
-    0x00, 0x10, 0x48, 0x6C, 0x00, 0x02, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xBA, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x12, 0x29, 0x6E, 0x00, 0x14, 0x00, 0x16, 0x50, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x54, 0x6F, 
-    0x6B, 0x65, 0x6E, 0x46, 0x34, 0x4B, 0x69, 0x6E, 0x64, 0x52, 0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x50, 0x6F, 0x73, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x1C, 0x48, 0xE7, 
-    0x1F, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x20, 0x3F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0xC5, 0x88, 
-    0x4A, 0xAC, 0x00, 0x14, 0x6F, 0x32, 0x53, 0xAC, 0x00, 0x14, 0x20, 0x2C, 0x00, 0x14, 0x22, 0x00, 
-    0xC0, 0xFC, 0x00, 0x1A, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x1A, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 
-    0x20, 0x6E, 0x00, 0x0C, 0x43, 0xF4, 0x08, 0x18, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0xD9, 0x70, 0x01, 0x60, 0x00, 0x0D, 0x9C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0xE0, 
-    0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 
-    0x58, 0x4F, 0x67, 0x3C, 0x1D, 0x7C, 0x00, 0x05, 0xFF, 0x5C, 0x48, 0x6C, 0x00, 0x04, 0x48, 0x6E, 
-    0xFF, 0x5E, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xBA, 0x41, 0xEE, 0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x43, 0xEE, 0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x47, 0xEC, 
-    0x00, 0x04, 0x27, 0x6B, 0x00, 0x0C, 0x00, 0x08, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x0D, 0x44, 
-    0x47, 0xEC, 0x00, 0x04, 0x27, 0x6B, 0x00, 0x0C, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x36, 0x96, 0x1E, 0x00, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 0x72, 0x03, 
-    0xC2, 0x30, 0x00, 0x00, 0x58, 0x4F, 0x67, 0x00, 0x02, 0xF2, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x76, 0x4E, 0xB9, 0x00, 0x00, 0xAC, 0xE0, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xBE, 0x4A, 0xA8, 
-    0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 
-    0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xBA, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA4, 0x20, 0x6E, 0xFF, 0xBE, 0x20, 0x68, 0x00, 0x08, 
-    0x2D, 0x48, 0xFF, 0xFC, 0x22, 0x48, 0x20, 0x28, 0x00, 0x0C, 0xB0, 0xA9, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x2E, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 0x72, 0x00, 
-    0x12, 0x00, 0x2F, 0x01, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x1E, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x68, 0x00, 0x0C, 0x52, 0xA8, 0x00, 0x0C, 0x12, 0x87, 
-    0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBA, 0x20, 0x08, 0x7A, 0x01, 0x50, 0x4F, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 
-    0xFB, 0x5E, 0x72, 0x07, 0xC2, 0x30, 0x00, 0x00, 0x58, 0x4F, 0x66, 0x14, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xCE, 
-    0x76, 0x01, 0x20, 0x6E, 0xFF, 0xBE, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x6E, 
-    0xFF, 0xBA, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 
-    0x20, 0x6E, 0xFF, 0xBE, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 
-    0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 
-    0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 
-    0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xBE, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 
-    0xFF, 0xBA, 0x20, 0x08, 0x20, 0x05, 0x52, 0x85, 0x60, 0x00, 0xFF, 0x04, 0x76, 0x01, 0x20, 0x6E, 
-    0xFF, 0xBE, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xBA, 0x4E, 0xB9, 0x00, 0x00, 
-    0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x6E, 0xFF, 0xBE, 0x20, 0x68, 
-    0x00, 0x08, 0x2D, 0x48, 0xFF, 0xFC, 0x22, 0x48, 0x20, 0x28, 0x00, 0x0C, 0xB0, 0xA9, 0x00, 0x10, 
-    0x54, 0xC3, 0x44, 0x03, 0x67, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x14, 
-    0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1C, 0x20, 0x6E, 0xFF, 0xFC, 0x22, 0x68, 0x00, 0x0C, 
-    0x52, 0xA8, 0x00, 0x0C, 0x42, 0x11, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x72, 0x00, 
-    0x12, 0x00, 0x20, 0x01, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 
-    0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xBE, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBA, 0x20, 0x08, 0x2F, 0x05, 
-    0x48, 0x6E, 0xFF, 0x76, 0x4E, 0xB9, 0x00, 0x00, 0xAE, 0x60, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x6C, 
-    0x00, 0x04, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x5C, 0x4E, 0xB9, 0x00, 0x00, 0x26, 0x64, 
-    0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0xD9, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x76, 0x4E, 0xB9, 0x00, 0x00, 0xAD, 0x78, 
-    0x70, 0x01, 0x4F, 0xEF, 0x00, 0x1C, 0x60, 0x00, 0x0A, 0x2A, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 
-    0xFF, 0xFF, 0xFB, 0x5E, 0x72, 0x04, 0xC2, 0x30, 0x00, 0x00, 0x66, 0x08, 0x0C, 0x07, 0x00, 0x2D, 
-    0x66, 0x00, 0x01, 0x28, 0x78, 0x00, 0x7A, 0x00, 0x7C, 0x00, 0x0C, 0x07, 0x00, 0x2D, 0x66, 0x0E, 
-    0x78, 0x01, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x58, 0x4F, 0x0C, 0x07, 
-    0x00, 0x30, 0x66, 0x00, 0x00, 0xC2, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 
-    0x0C, 0x07, 0x00, 0x78, 0x58, 0x4F, 0x66, 0x00, 0x00, 0xAE, 0x7A, 0x01, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x9C, 0x4A, 0x85, 0x67, 0x4E, 
-    0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 0x10, 0x30, 0x00, 0x00, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0x80, 0xC2, 0x00, 0x67, 0x24, 0x20, 0x06, 0xE9, 0x88, 0x2D, 0x40, 0xFF, 0x20, 
-    0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0xFC, 0x72, 0x00, 0x12, 0x00, 
-    0x20, 0x2E, 0xFF, 0x20, 0xD2, 0x80, 0x2C, 0x01, 0x58, 0x4F, 0x60, 0x4E, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 0x50, 0x4F, 0x60, 0x5C, 0x70, 0x00, 
-    0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 0x72, 0x04, 0xC2, 0x30, 0x00, 0x00, 0x67, 0x18, 
-    0x22, 0x06, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0x48, 0x87, 0x48, 0xC7, 0xD2, 0x87, 
-    0x70, 0x30, 0x92, 0x80, 0x2C, 0x01, 0x60, 0x12, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 0x50, 0x4F, 0x60, 0x20, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x36, 0x96, 0x1E, 0x00, 0x58, 0x4F, 0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x00, 0xFF, 0x54, 0x2F, 0x06, 0x48, 0x6C, 0x00, 0x04, 
-    0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x5C, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x1C, 0x20, 0x6E, 
-    0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 
-    0x70, 0x01, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x08, 0xEA, 0x0C, 0x07, 0x00, 0x22, 0x66, 0x00, 
-    0x04, 0xE2, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAC, 0xE0, 
-    0x42, 0x05, 0x7C, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x04, 0x90, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x36, 0x96, 0x1E, 0x00, 0x70, 0x00, 0x10, 0x05, 0x0C, 0x40, 0x00, 0x01, 0x58, 0x4F, 0x66, 0x00, 
-    0x02, 0x80, 0x10, 0x07, 0x04, 0x00, 0x00, 0x22, 0x67, 0x18, 0x04, 0x00, 0x00, 0x3A, 0x67, 0x12, 
-    0x04, 0x00, 0x00, 0x12, 0x67, 0x00, 0x00, 0xD4, 0x5D, 0x00, 0x67, 0x00, 0x01, 0x88, 0x60, 0x00, 
-    0x02, 0x3C, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 
-    0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 
-    0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 
-    0x02, 0x26, 0x20, 0x6E, 0xFF, 0xC2, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 
-    0xC0, 0x07, 0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 
-    0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 
-    0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 
-    0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x60, 0x00, 0x01, 0x8E, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 
-    0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x16, 0x70, 0x0D, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x01, 0x60, 0x20, 0x6E, 0xFF, 0xC2, 0x26, 0x68, 0x00, 0x08, 
-    0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x0D, 
-    0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 
-    0x52, 0xAB, 0x00, 0x0C, 0x10, 0xBC, 0x00, 0x0D, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x0D, 
-    0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 
-    0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 
-    0x60, 0x00, 0x00, 0xD4, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 0x70, 0x09, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 
-    0x00, 0xA6, 0x20, 0x6E, 0xFF, 0xC2, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x09, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0xBC, 
-    0x00, 0x09, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x09, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x60, 0x1A, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xEA, 0xFE, 0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x42, 0x05, 0x20, 0x06, 0x52, 0x86, 0x60, 0x00, 0x01, 0xFA, 
-    0x0C, 0x07, 0x00, 0x22, 0x66, 0x00, 0x01, 0x10, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 
-    0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x16, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x6E, 0xFF, 0xC2, 0x20, 0x68, 0x00, 0x08, 0x2D, 0x48, 
-    0xFF, 0x58, 0x22, 0x48, 0x20, 0x28, 0x00, 0x0C, 0xB0, 0xA9, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x22, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x6E, 0xFF, 0x58, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x1C, 0x20, 0x6E, 0xFF, 0x58, 0x22, 0x68, 0x00, 0x0C, 0x52, 0xA8, 0x00, 0x0C, 
-    0x42, 0x11, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 0x2F, 0x06, 0x48, 0x6E, 0xFF, 0x7A, 
-    0x4E, 0xB9, 0x00, 0x00, 0xAE, 0x60, 0x58, 0x8F, 0x2F, 0x00, 0x48, 0x6C, 0x00, 0x04, 0x70, 0x02, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x26, 0x64, 0x20, 0x6E, 0x00, 0x0C, 
-    0x43, 0xEE, 0xFF, 0x3E, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x70, 0x02, 
-    0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAD, 0x78, 0x70, 0x01, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x60, 0x00, 0x05, 0x1E, 0x0C, 0x07, 0x00, 0x5C, 0x66, 0x06, 0x7A, 0x01, 0x60, 0x00, 
-    0x00, 0xD8, 0x76, 0x01, 0x20, 0x6E, 0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 
-    0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 
-    0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 
-    0x00, 0xA4, 0x20, 0x6E, 0xFF, 0xC2, 0x20, 0x68, 0x00, 0x08, 0x2D, 0x48, 0xFF, 0x58, 0x22, 0x48, 
-    0x20, 0x28, 0x00, 0x0C, 0xB0, 0xA9, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x2E, 0x48, 0x87, 
-    0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x22, 0x69, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x6E, 0xFF, 0x58, 0x20, 0x68, 0x00, 0x24, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1E, 0x20, 0x6E, 0xFF, 0x58, 
-    0x22, 0x68, 0x00, 0x0C, 0x52, 0xA8, 0x00, 0x0C, 0x12, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x28, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 
-    0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 
-    0xFF, 0xBE, 0x20, 0x08, 0x20, 0x06, 0x52, 0x86, 0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x00, 0xFB, 0x60, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEB, 0x16, 0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x70, 0x02, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAD, 0x78, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 
-    0x04, 0x00, 0x0C, 0x07, 0x00, 0x27, 0x66, 0x00, 0x00, 0xA2, 0x7C, 0x00, 0x7A, 0x00, 0x60, 0x70, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x27, 0x58, 0x4F, 
-    0x66, 0x30, 0x2F, 0x06, 0x48, 0x6C, 0x00, 0x04, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x3E, 
-    0x4E, 0xB9, 0x00, 0x00, 0x27, 0x1C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x3E, 0x70, 0x05, 
-    0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x70, 0x01, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 
-    0x03, 0xB2, 0x52, 0x85, 0x70, 0x04, 0xB0, 0x85, 0x6C, 0x14, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x2C, 
-    0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x50, 0x4F, 0x60, 0x12, 0x0C, 0x07, 
-    0x00, 0xFF, 0x67, 0x0C, 0x20, 0x06, 0xE1, 0x88, 0x48, 0x87, 0x48, 0xC7, 0xD0, 0x87, 0x2C, 0x00, 
-    0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 
-    0x67, 0x00, 0xFF, 0x7E, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x58, 0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0x2C, 0x50, 0x4F, 0x60, 0x00, 0x03, 0x58, 0x0C, 0x07, 0x00, 0x3C, 0x66, 0x00, 
-    0x02, 0x84, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAC, 0xE0, 
-    0x78, 0x00, 0x7A, 0x00, 0x42, 0x06, 0x50, 0x4F, 0x60, 0x00, 0x02, 0x42, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 
-    0x10, 0x30, 0x00, 0x00, 0x48, 0x80, 0x32, 0x3C, 0x00, 0x80, 0xC2, 0x00, 0x58, 0x4F, 0x67, 0x00, 
-    0x01, 0x04, 0x70, 0x00, 0x10, 0x06, 0xE9, 0x88, 0x2D, 0x40, 0xFF, 0x1C, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0xFC, 0x72, 0x00, 0x12, 0x00, 0x20, 0x2E, 0xFF, 0x1C, 
-    0x82, 0x80, 0x1C, 0x01, 0x4A, 0x85, 0x58, 0x4F, 0x67, 0x00, 0x00, 0xCA, 0x76, 0x01, 0x20, 0x6E, 
-    0xFF, 0xC2, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x18, 0x70, 0x00, 0x10, 0x06, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xBE, 0x4E, 0xB9, 
-    0x00, 0x00, 0x8E, 0xD8, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x6E, 0xFF, 0xC2, 
-    0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x2A, 0x70, 0x00, 0x10, 0x06, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 
-    0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 
-    0x52, 0xAB, 0x00, 0x0C, 0x10, 0x86, 0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 
-    0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 
-    0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xC2, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xC2, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xBE, 0x20, 0x08, 
-    0x20, 0x04, 0x52, 0x84, 0x4A, 0x85, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x2A, 0x03, 
-    0x60, 0x00, 0x01, 0x1A, 0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 0x72, 0x08, 
-    0xC2, 0x30, 0x00, 0x00, 0x66, 0x0E, 0x0C, 0x07, 0x00, 0x2F, 0x67, 0x08, 0x0C, 0x07, 0x00, 0x3E, 
-    0x66, 0x00, 0x00, 0xCA, 0x4A, 0x85, 0x67, 0x4E, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 0x20, 0x4C, 0x58, 0x88, 0x2D, 0x48, 0xFF, 0x3A, 0x2D, 0x50, 
-    0xFF, 0x2A, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0x2E, 0x2D, 0x68, 0x00, 0x08, 0xFF, 0x32, 0x2D, 0x68, 
-    0x00, 0x0C, 0xFF, 0x36, 0x41, 0xEE, 0xFF, 0x2A, 0x20, 0x2E, 0xFF, 0x36, 0x53, 0x80, 0x2D, 0x40, 
-    0xFF, 0x32, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0x76, 0x48, 0x6E, 0xFF, 0x2A, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6E, 0x72, 0x4F, 0xEF, 0x00, 0x10, 0x0C, 0x07, 0x00, 0x2F, 0x66, 0x1E, 0x48, 0x87, 0x48, 0xC7, 
-    0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x37, 0xE0, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x84, 0x0C, 0x07, 0x00, 0x3E, 0x66, 0x7C, 
-    0x2F, 0x04, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAE, 0x60, 0x58, 0x8F, 0x2F, 0x00, 
-    0x48, 0x6C, 0x00, 0x04, 0x70, 0x03, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x24, 0x4E, 0xB9, 0x00, 0x00, 
-    0x26, 0x64, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x24, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x30, 0xD9, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 
-    0xAD, 0x78, 0x70, 0x01, 0x4F, 0xEF, 0x00, 0x1C, 0x60, 0x00, 0x01, 0x28, 0x20, 0x4C, 0x58, 0x88, 
-    0x2D, 0x48, 0xFF, 0x58, 0x20, 0x28, 0x00, 0x0C, 0x53, 0x80, 0x20, 0x6E, 0xFF, 0x58, 0x21, 0x40, 
-    0x00, 0x08, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0xA0, 0x48, 0x6C, 
-    0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x54, 0x20, 0x68, 
-    0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x00, 0xFD, 0xAE, 
-    0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x7A, 0x4E, 0xB9, 0x00, 0x00, 0xAD, 0x78, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0xCE, 0x0C, 0x07, 0x00, 0x7B, 0x66, 0x32, 0x1D, 0x7C, 0x00, 0x06, 0xFF, 0x5C, 
-    0x48, 0x6C, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0x5E, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xBA, 0x41, 0xEE, 
-    0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x30, 0xD9, 0x70, 0x01, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x98, 0x0C, 0x07, 0x00, 0x7D, 
-    0x66, 0x30, 0x1D, 0x7C, 0x00, 0x07, 0xFF, 0x5C, 0x48, 0x6C, 0x00, 0x04, 0x48, 0x6E, 0xFF, 0x5E, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0xBA, 0x41, 0xEE, 0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 
-    0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x70, 0x01, 0x50, 0x4F, 
-    0x60, 0x60, 0x0C, 0x07, 0x00, 0x3D, 0x66, 0x30, 0x1D, 0x7C, 0x00, 0x08, 0xFF, 0x5C, 0x48, 0x6C, 
-    0x00, 0x04, 0x48, 0x6E, 0xFF, 0x5E, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0xBA, 0x41, 0xEE, 0xFF, 0x5C, 
-    0x20, 0x6E, 0x00, 0x0C, 0x43, 0xEE, 0xFF, 0x5C, 0x70, 0x05, 0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 
-    0x30, 0xD9, 0x70, 0x01, 0x50, 0x4F, 0x60, 0x2A, 0x47, 0xEC, 0x00, 0x04, 0x20, 0x2B, 0x00, 0x0C, 
-    0x53, 0x80, 0x27, 0x40, 0x00, 0x08, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEB, 0xC0, 0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x70, 0x00, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x47, 0x65, 0x74, 
-    0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 0x52, 
-    0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x70, 0x01, 0xB0, 0xAC, 0x00, 0x14, 0x6F, 0x2C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x20, 0x2C, 0x00, 0x14, 0x52, 0xAC, 0x00, 0x14, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x1A, 0x48, 0x41, 
-    0xC2, 0xFC, 0x00, 0x1A, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x43, 0xF4, 0x08, 0x18, 0x70, 0x05, 
-    0x22, 0xD8, 0x51, 0xC8, 0xFF, 0xFC, 0x32, 0xD8, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9C, 0x55, 0x6E, 0x67, 0x65, 0x74, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x5F, 0x5F, 0x36, 0x54, 0x4C, 
-    0x65, 0x78, 0x65, 0x72, 0x46, 0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x1C, 0x2E, 0x00, 0x0F, 0x26, 0x6E, 0x00, 0x10, 
-    0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x2E, 0x00, 
-    0x50, 0x4F, 0x67, 0x08, 0xBC, 0x13, 0x66, 0x04, 0x70, 0x01, 0x60, 0x40, 0x4A, 0xAE, 0x00, 0x14, 
-    0x67, 0x14, 0x4A, 0x87, 0x67, 0x0C, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x35, 0x9C, 
-    0x50, 0x4F, 0x70, 0x00, 0x60, 0x26, 0x70, 0x00, 0x10, 0x06, 0xE5, 0x40, 0x20, 0x7C, 0xFF, 0xFF, 
-    0xEC, 0x0E, 0x2F, 0x30, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEB, 0xD4, 0x48, 0x6C, 0x00, 0x04, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xC0, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x47, 0x65, 0x74, 0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 
-    0x78, 0x65, 0x72, 0x46, 0x34, 0x4B, 0x69, 0x6E, 0x64, 0x52, 0x36, 0x54, 0x54, 0x6F, 0x6B, 0x65, 
-    0x6E, 0x69, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF6, 0x48, 0xE7, 0x10, 0x18, 0x20, 0x6E, 0x00, 0x08, 
-    0x26, 0x50, 0x76, 0x00, 0x20, 0x6B, 0x00, 0x08, 0x20, 0x3C, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0xA8, 
-    0x00, 0x10, 0x66, 0x28, 0x2D, 0x68, 0x00, 0x08, 0xFF, 0xFC, 0x2D, 0x43, 0xFF, 0xF6, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x22, 0x48, 0x20, 0x28, 0x00, 0x14, 0xB0, 0xA9, 0x00, 0x18, 0x55, 0xC3, 0x44, 0x03, 
-    0x20, 0x03, 0x26, 0x2E, 0xFF, 0xF6, 0x4A, 0x00, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x60, 
-    0x70, 0x01, 0x26, 0x80, 0x20, 0x6B, 0x00, 0x08, 0x28, 0x68, 0x00, 0x08, 0x76, 0x00, 0x22, 0x2C, 
-    0x00, 0x14, 0xB2, 0xAC, 0x00, 0x18, 0x65, 0x22, 0x2F, 0x03, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x58, 0x8F, 
-    0x26, 0x1F, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x04, 0x70, 0xFF, 
-    0x60, 0x16, 0x20, 0x6C, 0x00, 0x14, 0x52, 0xAC, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x48, 0x81, 0x30, 0x01, 0x1D, 0x40, 0xFF, 0xFB, 0x20, 0x0B, 0x60, 0x10, 
-    0x48, 0x6E, 0xFF, 0xFB, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x84, 0x1A, 0x4A, 0x80, 0x50, 0x4F, 
-    0x70, 0x0D, 0xB0, 0x2E, 0xFF, 0xFB, 0x66, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xA8, 0x00, 0x08, 
-    0x70, 0xFF, 0xB0, 0x2E, 0xFF, 0xFB, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xA8, 0x00, 0x10, 
-    0x10, 0x2E, 0xFF, 0xFB, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xEA, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x47, 
-    0x65, 0x74, 0x43, 0x68, 0x61, 0x72, 0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x1E, 0x2E, 0x00, 0x0F, 
-    0x28, 0x6E, 0x00, 0x08, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 
-    0x83, 0x46, 0x0C, 0x07, 0x00, 0xFF, 0x67, 0x04, 0x53, 0xAC, 0x00, 0x10, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x55, 0x6E, 0x67, 0x65, 0x74, 0x43, 0x68, 0x61, 0x72, 
-    0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x60, 0x00, 0x00, 0xD8, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2F, 0x58, 0x4F, 0x66, 0x00, 
-    0x00, 0xA0, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2F, 
-    0x58, 0x4F, 0x66, 0x1E, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 0x1E, 0x00, 0x58, 0x4F, 
-    0x0C, 0x07, 0x00, 0xFF, 0x67, 0x00, 0x00, 0x9E, 0x0C, 0x07, 0x00, 0x0D, 0x66, 0xE6, 0x60, 0x00, 
-    0x00, 0x94, 0x0C, 0x07, 0x00, 0x2A, 0x66, 0x46, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x36, 0x96, 
-    0x1E, 0x00, 0x0C, 0x07, 0x00, 0x2A, 0x58, 0x4F, 0x66, 0x18, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x36, 0x96, 0x1E, 0x00, 0x58, 0x4F, 0x0C, 0x07, 0x00, 0x2A, 0x67, 0xEE, 0x0C, 0x07, 0x00, 0x2F, 
-    0x67, 0x06, 0x0C, 0x07, 0x00, 0xFF, 0x66, 0xD0, 0x0C, 0x07, 0x00, 0xFF, 0x66, 0x56, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEB, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x60, 0x46, 0x47, 0xEC, 
-    0x00, 0x04, 0x20, 0x2B, 0x00, 0x0C, 0x53, 0x80, 0x27, 0x40, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEB, 0xFC, 0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0x2C, 0x50, 0x4F, 0x60, 0x24, 
-    0x70, 0x00, 0x10, 0x07, 0x20, 0x79, 0xFF, 0xFF, 0xFB, 0x5E, 0x72, 0x08, 0xC2, 0x30, 0x00, 0x00, 
-    0x66, 0x12, 0x48, 0x87, 0x48, 0xC7, 0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x37, 0x96, 
-    0x50, 0x4F, 0x60, 0x14, 0x20, 0x54, 0x20, 0x68, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 
-    0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x00, 0xFF, 0x18, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x98, 0x45, 0x61, 0x74, 0x57, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 
-    0x5F, 0x5F, 0x36, 0x54, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x60, 0x04, 
-    0x52, 0x4B, 0x52, 0x4C, 0x4A, 0x13, 0x67, 0x2E, 0x4A, 0x14, 0x67, 0x2A, 0x10, 0x13, 0x48, 0x80, 
-    0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xC2, 0x2D, 0x40, 0xFF, 0xFC, 0x10, 0x14, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xC2, 0x22, 0x2E, 0xFF, 0xFC, 
-    0xB0, 0x81, 0x50, 0x4F, 0x67, 0xCA, 0x4A, 0x13, 0x66, 0x0C, 0x4A, 0x14, 0x66, 0x04, 0x70, 0x00, 
-    0x60, 0x3C, 0x70, 0xFF, 0x60, 0x38, 0x4A, 0x14, 0x66, 0x04, 0x70, 0x01, 0x60, 0x30, 0x10, 0x13, 
-    0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xC2, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xC2, 0x22, 0x2E, 
-    0xFF, 0xF8, 0xB0, 0x81, 0x50, 0x4F, 0x6F, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x01, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x73, 0x79, 0x6D, 0x63, 0x6D, 0x70, 0x5F, 
-    0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x1A, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x16, 0x70, 0x00, 0x29, 0x40, 0x00, 0x02, 0x29, 0x40, 
-    0x00, 0x06, 0x29, 0x40, 0x00, 0x0A, 0x29, 0x40, 0x00, 0x0E, 0x20, 0x4C, 0x54, 0x88, 0x20, 0x0C, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x36, 
-    0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x18, 0x20, 0x0C, 0x67, 0x14, 0x20, 0x2E, 0x00, 0x0C, 
-    0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x36, 
-    0x54, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x50, 0x48, 0xE7, 
-    0x1F, 0x18, 0x28, 0x2E, 0x00, 0x0C, 0x4A, 0xB9, 0xFF, 0xFF, 0xED, 0x42, 0x66, 0x42, 0x70, 0x00, 
-    0x26, 0x40, 0x76, 0x01, 0x22, 0x0B, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x14, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x14, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x70, 0x04, 
-    0x27, 0x40, 0x00, 0x10, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xCB, 0xFF, 0xFF, 0xED, 0x42, 
-    0x20, 0x6E, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x72, 0x02, 0x2D, 0x41, 0xFF, 0xF8, 
-    0x41, 0xEE, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x60, 0x00, 0x03, 0xA6, 0x26, 0x6E, 
-    0x00, 0x08, 0x41, 0xEE, 0xFF, 0xE0, 0x2D, 0x48, 0xFF, 0xE8, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x2B, 
-    0x00, 0x04, 0x2F, 0x13, 0x4E, 0xB9, 0x00, 0x00, 0x52, 0x6A, 0x2D, 0x40, 0xFF, 0xEC, 0x76, 0x01, 
-    0x4A, 0xAE, 0xFF, 0xE8, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 
-    0x20, 0x6E, 0xFF, 0xE8, 0x20, 0x93, 0x20, 0x6E, 0xFF, 0xE8, 0x20, 0x2E, 0xFF, 0xEC, 0x21, 0x40, 
-    0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xF4, 0x43, 0xEE, 0xFF, 0xE0, 0x20, 0xD9, 
-    0x20, 0xD9, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x74, 0x72, 0x02, 0x2D, 0x41, 0xFF, 0x78, 0x41, 0xEE, 
-    0xFF, 0x74, 0x41, 0xEE, 0xFF, 0xF4, 0x2D, 0x48, 0xFF, 0xD4, 0x41, 0xEE, 0xFF, 0x90, 0x2D, 0x48, 
-    0xFF, 0xD8, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x76, 0x20, 0x6E, 0xFF, 0xD4, 
-    0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xA4, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xD8, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x18, 0x20, 0x6E, 0xFF, 0xD4, 0x22, 0x6E, 0xFF, 0xD8, 0x22, 0x90, 0x20, 0x6E, 0xFF, 0xD8, 
-    0x20, 0x2E, 0xFF, 0xA4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0x90, 
-    0x2D, 0x48, 0xFF, 0xDC, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x4F, 0x6A, 
-    0x2D, 0x40, 0xFF, 0x8C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x12, 0x52, 0x80, 0x58, 0x8F, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xDA, 0x2D, 0x40, 0xFF, 0x88, 0x2F, 0x2E, 0xFF, 0x8C, 
-    0x2F, 0x2E, 0xFF, 0x88, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x0A, 0x41, 0xEE, 0xFF, 0xF4, 0x2D, 0x48, 
-    0xFF, 0x9C, 0x41, 0xEE, 0xFF, 0x6C, 0x2D, 0x48, 0xFF, 0xA0, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEC, 0x7C, 0x20, 0x6E, 0xFF, 0x9C, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 
-    0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xA4, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xA0, 0x66, 0x16, 
-    0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 
-    0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x20, 0x6E, 0xFF, 0x9C, 0x22, 0x6E, 
-    0xFF, 0xA0, 0x22, 0x90, 0x20, 0x6E, 0xFF, 0xA0, 0x20, 0x2E, 0xFF, 0xA4, 0x21, 0x40, 0x00, 0x04, 
-    0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0x6C, 0x2D, 0x48, 0xFF, 0xA8, 0x20, 0x28, 0x00, 0x04, 
-    0xE4, 0x80, 0x2D, 0x40, 0xFF, 0x7C, 0x41, 0xEE, 0xFF, 0xF4, 0x2D, 0x48, 0xFF, 0xAC, 0x41, 0xEE, 
-    0xFF, 0x64, 0x2D, 0x48, 0xFF, 0xB0, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x82, 
-    0x20, 0x6E, 0xFF, 0xAC, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 
-    0x2D, 0x40, 0xFF, 0xA4, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xB0, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x20, 0x6E, 0xFF, 0xAC, 0x22, 0x6E, 0xFF, 0xB0, 0x22, 0x90, 
-    0x20, 0x6E, 0xFF, 0xB0, 0x20, 0x2E, 0xFF, 0xA4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 
-    0x41, 0xEE, 0xFF, 0x64, 0x2D, 0x48, 0xFF, 0xB4, 0x20, 0x28, 0x00, 0x04, 0xE4, 0x80, 0x2D, 0x40, 
-    0xFF, 0x80, 0x41, 0xEE, 0xFF, 0xF4, 0x2D, 0x48, 0xFF, 0xB8, 0x41, 0xEE, 0xFF, 0x5C, 0x2D, 0x48, 
-    0xFF, 0xBC, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x88, 0x20, 0x6E, 0xFF, 0xB8, 
-    0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xA4, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xBC, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x18, 0x20, 0x6E, 0xFF, 0xB8, 0x22, 0x6E, 0xFF, 0xBC, 0x22, 0x90, 0x20, 0x6E, 0xFF, 0xBC, 
-    0x20, 0x2E, 0xFF, 0xA4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0x74, 
-    0x43, 0xEE, 0xFF, 0x5C, 0x20, 0xD9, 0x20, 0xD9, 0x41, 0xEE, 0xFF, 0x74, 0x2D, 0x48, 0xFF, 0xC0, 
-    0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 0x2A, 0x00, 0x2D, 0x79, 
-    0xFF, 0xFF, 0xED, 0x42, 0xFF, 0xC4, 0x20, 0x6E, 0xFF, 0xC4, 0x22, 0x48, 0x20, 0x28, 0x00, 0x08, 
-    0x22, 0x29, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x2D, 0x40, 0xFF, 0x84, 0x20, 0x05, 
-    0xE5, 0x80, 0x2F, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x42, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x42, 0xFF, 0xC8, 0x20, 0x6E, 0xFF, 0xC8, 
-    0x20, 0x50, 0x22, 0x6E, 0xFF, 0xC8, 0x20, 0x29, 0x00, 0x10, 0x22, 0x2E, 0xFF, 0x84, 0x2D, 0x48, 
-    0xFF, 0x50, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0x50, 0xD0, 0x90, 0x2D, 0x40, 
-    0xFF, 0x98, 0x7E, 0x00, 0x4F, 0xEF, 0x00, 0x74, 0x60, 0x74, 0x49, 0xEE, 0xFF, 0x74, 0x41, 0xEE, 
-    0xFF, 0x54, 0x2D, 0x48, 0xFF, 0xCC, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 
-    0x00, 0x00, 0x52, 0x6A, 0x2C, 0x00, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xCC, 0x66, 0x16, 0x2F, 0x03, 
-    0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x12, 0x20, 0x6E, 0xFF, 0xCC, 0x20, 0x94, 0x20, 0x6E, 
-    0xFF, 0xCC, 0x21, 0x46, 0x00, 0x04, 0x20, 0x06, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0x54, 
-    0x2D, 0x48, 0xFF, 0xD0, 0x20, 0x04, 0xD0, 0xA8, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0x98, 0x22, 0x07, 
-    0xE5, 0x81, 0x21, 0x80, 0x18, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x07, 0x52, 0x87, 0xBA, 0x87, 
-    0x6E, 0x88, 0x70, 0x18, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x74, 0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x4A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xFC, 0x52, 0xAE, 
-    0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0xB0, 0xAE, 0xFF, 0xF0, 0x6D, 0x00, 0xFC, 0x52, 0x4C, 0xEE, 
-    0x18, 0xF8, 0xFF, 0x34, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 
-    0x45, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x5F, 0x5F, 0x46, 0x37, 0x50, 0x61, 0x72, 0x74, 0x52, 
-    0x65, 0x66, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x07, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x03, 0xC0, 0x93, 0x72, 0x03, 0xB2, 0x80, 0x66, 0x00, 
-    0x00, 0x98, 0x2E, 0x13, 0xE4, 0x8F, 0x70, 0x0C, 0x2C, 0x07, 0xE0, 0xA6, 0x70, 0x02, 0xB0, 0x86, 
-    0x6E, 0x00, 0x00, 0x86, 0x02, 0x87, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x06, 0x55, 0x80, 0x20, 0x6C, 
-    0x00, 0x08, 0xE5, 0x80, 0x2A, 0x30, 0x08, 0x00, 0x4A, 0xAC, 0x00, 0x10, 0x67, 0x34, 0x70, 0xFF, 
-    0xB0, 0x85, 0x66, 0x64, 0x20, 0x06, 0x55, 0x80, 0x20, 0x6C, 0x00, 0x0C, 0xE5, 0x80, 0x2D, 0x70, 
-    0x08, 0x00, 0xFF, 0xFC, 0x20, 0x2C, 0x00, 0x04, 0xD0, 0xBC, 0x00, 0x00, 0x10, 0x00, 0x20, 0x6E, 
-    0xFF, 0xFC, 0x22, 0x10, 0xD2, 0x80, 0xD2, 0x87, 0xE5, 0x89, 0x70, 0x03, 0x80, 0x81, 0x26, 0x80, 
-    0x60, 0x36, 0x70, 0xFF, 0xB0, 0x85, 0x66, 0x20, 0x20, 0x06, 0x55, 0x80, 0x20, 0x6C, 0x00, 0x0C, 
-    0xE5, 0x80, 0x2D, 0x70, 0x08, 0x00, 0xFF, 0xFC, 0x20, 0x6E, 0xFF, 0xFC, 0xBE, 0x90, 0x6D, 0x18, 
-    0x20, 0x07, 0x52, 0x80, 0x20, 0x80, 0x60, 0x10, 0x20, 0x05, 0xD0, 0xAC, 0x00, 0x04, 0xD0, 0x87, 
-    0xE5, 0x88, 0x72, 0x03, 0x82, 0x80, 0x26, 0x81, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xE8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x25, 0x53, 0x63, 0x61, 0x6E, 0x52, 0x65, 0x66, 0x5F, 0x5F, 0x32, 0x33, 0x54, 
-    0x52, 0x65, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x53, 
-    0x63, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x46, 0x50, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEC, 
-    0x48, 0xE7, 0x10, 0x08, 0x49, 0xEE, 0xFF, 0xEC, 0x76, 0x01, 0x20, 0x0C, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x04, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x28, 0x40, 
-    0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0E, 0x28, 0xB9, 0xFF, 0xFF, 0xED, 0x06, 
-    0x20, 0x39, 0xFF, 0xFF, 0xED, 0x06, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x0A, 
-    0xFF, 0xEC, 0x20, 0x39, 0xFF, 0xFF, 0xF3, 0x28, 0xD0, 0x80, 0x54, 0x80, 0x72, 0x0C, 0xE3, 0xA8, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xF4, 0x2D, 0x6E, 0x00, 0x14, 0xFF, 0xF8, 
-    0x2D, 0x6E, 0x00, 0x18, 0xFF, 0xFC, 0x41, 0xEE, 0xFF, 0xEC, 0x20, 0x6E, 0x00, 0x10, 0x2F, 0x28, 
-    0x00, 0x04, 0x48, 0x6E, 0xFF, 0xEC, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x53, 0x10, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x44, 
-    0x52, 0x65, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x5F, 
-    0x5F, 0x46, 0x52, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 
-    0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x50, 0x6C, 0x37, 0x50, 0x61, 0x72, 0x74, 0x52, 
-    0x65, 0x66, 0x50, 0x50, 0x31, 0x33, 0x50, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x49, 0x6D, 0x70, 
-    0x6F, 0x72, 0x74, 0x69, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x62, 0x48, 0xE7, 0x1F, 0x18, 0x20, 0x6E, 
-    0x00, 0x0C, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 0x2D, 0x40, 
-    0xFF, 0xF0, 0xE5, 0x80, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x20, 0x2E, 0xFF, 0xF0, 0xE5, 0x80, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x7A, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 
-    0x03, 0x46, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xC0, 0x41, 0xEE, 0xFF, 0x90, 0x2D, 0x48, 0xFF, 0xC4, 
-    0x2F, 0x05, 0x20, 0x6E, 0xFF, 0xC0, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 
-    0x52, 0x6A, 0x2D, 0x40, 0xFF, 0xC8, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xC4, 0x66, 0x16, 0x2F, 0x03, 
-    0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x20, 0x6E, 0xFF, 0xC0, 0x22, 0x6E, 0xFF, 0xC4, 
-    0x22, 0x90, 0x20, 0x6E, 0xFF, 0xC4, 0x20, 0x2E, 0xFF, 0xC8, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 
-    0x70, 0x00, 0x41, 0xEE, 0xFF, 0x90, 0x2D, 0x48, 0xFF, 0xCC, 0x41, 0xEE, 0xFF, 0x9C, 0x2D, 0x48, 
-    0xFF, 0xD0, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x90, 0x20, 0x6E, 0xFF, 0xCC, 
-    0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xD4, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xD0, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x18, 0x20, 0x6E, 0xFF, 0xCC, 0x22, 0x6E, 0xFF, 0xD0, 0x22, 0x90, 0x20, 0x6E, 0xFF, 0xD0, 
-    0x20, 0x2E, 0xFF, 0xD4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0x9C, 
-    0x2D, 0x48, 0xFF, 0xD8, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x4F, 0x6A, 
-    0x2D, 0x40, 0xFF, 0x98, 0x47, 0xEE, 0xFF, 0x90, 0x41, 0xEE, 0xFF, 0xA4, 0x2D, 0x48, 0xFF, 0xDC, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x96, 0x2F, 0x2B, 0x00, 0x04, 0x2F, 0x13, 
-    0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xD4, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xDC, 
-    0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 
-    0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 0x20, 0x6E, 0xFF, 0xDC, 
-    0x20, 0x93, 0x20, 0x6E, 0xFF, 0xDC, 0x20, 0x2E, 0xFF, 0xD4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 
-    0x70, 0x00, 0x41, 0xEE, 0xFF, 0xA4, 0x2D, 0x48, 0xFF, 0xE0, 0x28, 0x28, 0x00, 0x04, 0xE4, 0x84, 
-    0x49, 0xEE, 0xFF, 0x90, 0x41, 0xEE, 0xFF, 0xB0, 0x2D, 0x48, 0xFF, 0xE4, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x79, 0xFF, 0xFF, 0xEC, 0x9C, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 
-    0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xD4, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xE4, 0x66, 0x16, 0x2F, 0x03, 
-    0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 0x20, 0x6E, 0xFF, 0xE4, 0x20, 0x94, 0x20, 0x6E, 
-    0xFF, 0xE4, 0x20, 0x2E, 0xFF, 0xD4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 
-    0xFF, 0xB0, 0x2D, 0x48, 0xFF, 0xE8, 0x20, 0x28, 0x00, 0x04, 0xE4, 0x80, 0x2D, 0x40, 0xFF, 0xAC, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xB8, 0x7C, 0xFF, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x4A, 0xFF, 0xEC, 
-    0x20, 0x6E, 0xFF, 0xEC, 0x22, 0x48, 0x20, 0x28, 0x00, 0x08, 0x22, 0x29, 0x00, 0x10, 0x4E, 0xB9, 
-    0x00, 0x00, 0x73, 0x5C, 0x2D, 0x40, 0xFF, 0xBC, 0x7E, 0x00, 0x4F, 0xEF, 0x00, 0x44, 0x60, 0x60, 
-    0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x4A, 0xFF, 0x88, 0x20, 0x6E, 0xFF, 0x88, 0x20, 0x50, 0x22, 0x6E, 
-    0xFF, 0x88, 0x20, 0x29, 0x00, 0x10, 0x22, 0x07, 0x2D, 0x48, 0xFF, 0x62, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x36, 0x20, 0x6E, 0xFF, 0x62, 0xD0, 0x90, 0x2D, 0x40, 0xFF, 0x84, 0x2F, 0x2E, 0xFF, 0x98, 
-    0x20, 0x6E, 0xFF, 0x84, 0x2F, 0x28, 0x00, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x39, 0x00, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x18, 0x20, 0x6E, 0xFF, 0x84, 0xB8, 0xA8, 0x00, 0x08, 0x66, 0x0E, 0xBC, 0xA8, 
-    0x00, 0x0C, 0x6C, 0x08, 0x2C, 0x28, 0x00, 0x0C, 0x2D, 0x48, 0xFF, 0xB8, 0x20, 0x07, 0x52, 0x87, 
-    0xBE, 0xAE, 0xFF, 0xBC, 0x6D, 0x9A, 0xBC, 0xAE, 0xFF, 0xAC, 0x6D, 0x16, 0x20, 0x6E, 0xFF, 0xB8, 
-    0x22, 0x6E, 0xFF, 0xF4, 0x20, 0x05, 0xE5, 0x80, 0x23, 0xA8, 0x00, 0x10, 0x08, 0x00, 0x60, 0x00, 
-    0x00, 0xD2, 0x70, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x2D, 0x40, 0xFF, 0x72, 
-    0x20, 0x40, 0x70, 0x00, 0x20, 0x80, 0x4A, 0xB9, 0xFF, 0xFF, 0xED, 0x3E, 0x58, 0x4F, 0x66, 0x28, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xED, 0x3E, 
-    0x70, 0x04, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x3E, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x10, 0x2D, 0x44, 0xFF, 0x76, 0x2D, 0x6E, 0xFF, 0xAC, 
-    0xFF, 0x7A, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x3E, 0xFF, 0x88, 0x20, 0x6E, 0xFF, 0x88, 0x22, 0x6E, 
-    0xFF, 0x72, 0x23, 0x68, 0x00, 0x08, 0x00, 0x08, 0x48, 0x78, 0x00, 0x10, 0x48, 0x6E, 0xFF, 0x76, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x2E, 0xFF, 0x98, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x12, 0x52, 0x80, 0x58, 0x8F, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0x98, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x70, 0x04, 0x2F, 0x00, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x3A, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x20, 0x05, 0xE5, 0x80, 0x72, 0xFF, 0x21, 0x81, 0x08, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x05, 
-    0xE5, 0x80, 0x21, 0xAE, 0xFF, 0x72, 0x08, 0x00, 0x70, 0x01, 0x2D, 0x40, 0xFF, 0xFC, 0x4F, 0xEF, 
-    0x00, 0x20, 0x20, 0x05, 0x52, 0x85, 0xBA, 0xAE, 0xFF, 0xF0, 0x6D, 0x00, 0xFC, 0xB6, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF8, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x50, 0xFF, 0xE8, 0x2D, 0x68, 
-    0x00, 0x04, 0xFF, 0xEC, 0x41, 0xEE, 0xFF, 0xE8, 0x2F, 0x08, 0x2F, 0x2E, 0xFF, 0xF4, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x3F, 0x7E, 0x4A, 0xAE, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x14, 
-    0x67, 0x00, 0x00, 0xAA, 0x7C, 0x00, 0x78, 0x00, 0x60, 0x44, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x04, 
-    0xE5, 0x80, 0x72, 0xFF, 0xB2, 0xB0, 0x08, 0x00, 0x66, 0x30, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x04, 
-    0xE5, 0x80, 0x28, 0x70, 0x08, 0x00, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x3E, 0xFF, 0x66, 0x20, 0x6E, 
-    0xFF, 0x66, 0x20, 0x50, 0x20, 0x2C, 0x00, 0x08, 0xD0, 0x90, 0x26, 0x40, 0x27, 0x46, 0x00, 0x08, 
-    0x27, 0x54, 0x00, 0x0C, 0x28, 0x86, 0xDC, 0xAB, 0x00, 0x0C, 0x20, 0x04, 0x52, 0x84, 0xB8, 0xAE, 
-    0xFF, 0xF0, 0x6D, 0xB6, 0x2D, 0x79, 0xFF, 0xFF, 0xED, 0x3E, 0xFF, 0x8C, 0x20, 0x6E, 0xFF, 0x8C, 
-    0x20, 0x50, 0x20, 0x10, 0x20, 0x40, 0x20, 0x86, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x50, 0xFF, 0x6A, 0x2D, 0x68, 0x00, 0x04, 0xFF, 0x6E, 0x41, 0xEE, 
-    0xFF, 0x6A, 0x2F, 0x08, 0x2F, 0x2E, 0xFF, 0xF4, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x3F, 0x7E, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x3E, 0x2F, 0x3C, 0x66, 0x69, 
-    0x6D, 0x70, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x20, 0x2F, 0x2E, 0xFF, 0xF4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x7A, 0x00, 0x58, 0x4F, 0x60, 0x28, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x20, 0x05, 0xE5, 0x80, 0x72, 0xFF, 0xB2, 0xB0, 0x08, 0x00, 0x66, 0x14, 0x20, 0x6E, 0xFF, 0xF8, 
-    0x20, 0x05, 0xE5, 0x80, 0x2F, 0x30, 0x08, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 
-    0x20, 0x05, 0x52, 0x85, 0xBA, 0xAE, 0xFF, 0xF0, 0x6D, 0xD2, 0x2F, 0x2E, 0xFF, 0xF8, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0x8C, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x46, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x2F, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x73, 
-    0x5F, 0x5F, 0x46, 0x52, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 
-    0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x37, 0x50, 0x61, 0x72, 0x74, 0x52, 0x65, 
-    0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xAC, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x79, 0xFF, 0xFF, 
-    0xED, 0x4A, 0x20, 0x2B, 0x00, 0x08, 0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x67, 0x00, 0x02, 0x46, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF0, 0x22, 0x39, 
-    0xFF, 0xFF, 0xF3, 0x28, 0xD2, 0x81, 0x54, 0x81, 0x74, 0x0C, 0x28, 0x01, 0xE5, 0xAC, 0x20, 0x6E, 
-    0x00, 0x0C, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 0x2D, 0x40, 
-    0xFF, 0xF4, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 0x50, 0x4F, 0x60, 0x00, 0x01, 0xF2, 0x2D, 0x6E, 
-    0x00, 0x0C, 0xFF, 0xDC, 0x41, 0xEE, 0xFF, 0xD0, 0x2D, 0x48, 0xFF, 0xE0, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x20, 0x6E, 0xFF, 0xDC, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x52, 0x6A, 
-    0x2D, 0x40, 0xFF, 0xE4, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xE0, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x18, 0x20, 0x6E, 0xFF, 0xDC, 0x22, 0x6E, 0xFF, 0xE0, 0x22, 0x90, 
-    0x20, 0x6E, 0xFF, 0xE0, 0x20, 0x2E, 0xFF, 0xE4, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 
-    0x41, 0xEE, 0xFF, 0xD0, 0x26, 0x48, 0x41, 0xEE, 0xFF, 0xC8, 0x2D, 0x48, 0xFF, 0xE8, 0x70, 0x00, 
-    0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xA2, 0x2F, 0x2B, 0x00, 0x04, 0x2F, 0x13, 0x4E, 0xB9, 
-    0x00, 0x00, 0x51, 0xAE, 0x2D, 0x40, 0xFF, 0xEC, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xE8, 0x66, 0x16, 
-    0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 
-    0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 0x20, 0x6E, 0xFF, 0xE8, 0x20, 0x93, 
-    0x20, 0x6E, 0xFF, 0xE8, 0x20, 0x2E, 0xFF, 0xEC, 0x21, 0x40, 0x00, 0x04, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xD8, 0x4F, 0xEF, 0x00, 0x1C, 0x60, 0x00, 0x01, 0x0E, 0x2D, 0x79, 
-    0xFF, 0xFF, 0xED, 0x4A, 0xFF, 0xC4, 0x20, 0x6E, 0xFF, 0xC4, 0x20, 0x50, 0x22, 0x6E, 0xFF, 0xC4, 
-    0x20, 0x29, 0x00, 0x10, 0x22, 0x2E, 0xFF, 0xD8, 0x2D, 0x48, 0xFF, 0xAC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x36, 0x20, 0x6E, 0xFF, 0xAC, 0xD0, 0x90, 0x2D, 0x40, 0xFF, 0xC0, 0x48, 0x6E, 0xFF, 0xC8, 
-    0x20, 0x6E, 0xFF, 0xC0, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0x3E, 0x4A, 0x80, 0x50, 0x4F, 
-    0x67, 0x00, 0x00, 0xC0, 0x4A, 0xAE, 0xFF, 0xF0, 0x66, 0x12, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x55, 0x44, 0x70, 0x01, 0x2D, 0x40, 0xFF, 0xF0, 0x58, 0x4F, 0x2F, 0x2E, 0xFF, 0xCC, 
-    0x2F, 0x2E, 0xFF, 0xC8, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 0x2A, 0x00, 0x7E, 0x00, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0x8A, 0x20, 0x6E, 0xFF, 0xC0, 0x20, 0x28, 0x00, 0x10, 0xD0, 0x84, 0xD0, 0x87, 
-    0xE5, 0x88, 0x72, 0x03, 0x82, 0x80, 0x2F, 0x01, 0x49, 0xEE, 0xFF, 0xC8, 0x41, 0xEE, 0xFF, 0xB0, 
-    0x2D, 0x48, 0xFF, 0xB8, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 
-    0x52, 0x6A, 0x2C, 0x00, 0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xB8, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 
-    0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x12, 0x20, 0x6E, 0xFF, 0xB8, 0x20, 0x94, 0x20, 0x6E, 0xFF, 0xB8, 
-    0x21, 0x46, 0x00, 0x04, 0x20, 0x06, 0x60, 0x02, 0x70, 0x00, 0x41, 0xEE, 0xFF, 0xB0, 0x2D, 0x48, 
-    0xFF, 0xBC, 0x4F, 0xEF, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x04, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x55, 0xA2, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x07, 0x52, 0x87, 0xBA, 0x87, 0x6E, 0x00, 
-    0xFF, 0x74, 0x20, 0x2E, 0xFF, 0xD8, 0x52, 0xAE, 0xFF, 0xD8, 0x20, 0x2E, 0xFF, 0xD8, 0xB0, 0xAE, 
-    0xFF, 0xFC, 0x6D, 0x00, 0xFE, 0xEA, 0x20, 0x2E, 0xFF, 0xF8, 0x52, 0xAE, 0xFF, 0xF8, 0x20, 0x2E, 
-    0xFF, 0xF8, 0xB0, 0xAE, 0xFF, 0xF4, 0x6D, 0x00, 0xFE, 0x06, 0x4A, 0xAE, 0xFF, 0xF0, 0x67, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x56, 0x38, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0xF8, 
-    0xFF, 0x90, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x30, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
-    0x45, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x5F, 0x5F, 0x46, 0x52, 0x31, 0x39, 0x54, 0x46, 0x72, 
-    0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 
-    0x37, 0x50, 0x61, 0x72, 0x74, 0x52, 0x65, 0x66, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xDC, 0x48, 0xE7, 
-    0x13, 0x18, 0x70, 0x20, 0x3F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0xC5, 0x88, 0x2C, 0x2E, 0x00, 0x14, 
-    0x52, 0x86, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xF8, 0x2D, 0x46, 0xFF, 0xFC, 0x41, 0xEE, 0xFF, 0xF8, 
-    0x41, 0xEE, 0xFF, 0xF8, 0x28, 0x48, 0x47, 0xEE, 0xFF, 0xF0, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2C, 
-    0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x52, 0x6A, 0x2E, 0x00, 0x76, 0x01, 0x20, 0x0B, 
-    0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 
-    0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x26, 0x94, 0x27, 0x47, 
-    0x00, 0x04, 0x20, 0x07, 0x60, 0x02, 0x70, 0x00, 0x20, 0x2E, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x10, 0x53, 0x80, 0x67, 0x00, 0x00, 0x88, 0x53, 0x80, 0x67, 0x00, 0x00, 0xFC, 0x60, 0x00, 
-    0x01, 0x6E, 0x49, 0xEE, 0xFF, 0xF0, 0x47, 0xEE, 0xFF, 0xE8, 0x48, 0x6E, 0xFF, 0xE4, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEC, 0xAA, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 
-    0x2E, 0x00, 0x76, 0x01, 0x20, 0x0B, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x0A, 0x26, 0x94, 0x27, 0x47, 0x00, 0x04, 0x20, 0x07, 0x60, 0x02, 0x70, 0x00, 0x70, 0x02, 
-    0xB0, 0xAE, 0xFF, 0xEC, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x00, 0x01, 0x14, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2D, 0x6E, 0xFF, 0xE8, 0xFF, 0xDC, 0x2D, 0x6E, 0xFF, 0xEC, 0xFF, 0xE0, 0x41, 0xEE, 0xFF, 0xDC, 
-    0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x3A, 0x3C, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xF2, 0x49, 0xEE, 
-    0xFF, 0xF0, 0x47, 0xEE, 0xFF, 0xE8, 0x48, 0x6E, 0xFF, 0xE4, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xB8, 
-    0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2E, 0x00, 0x76, 0x01, 
-    0x20, 0x0B, 0x66, 0x16, 0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x26, 0x94, 
-    0x27, 0x47, 0x00, 0x04, 0x20, 0x07, 0x60, 0x02, 0x70, 0x00, 0x70, 0x02, 0xB0, 0xAE, 0xFF, 0xEC, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x00, 0x00, 0x98, 0x2D, 0x6E, 0xFF, 0xE8, 0xFF, 0xDC, 0x2D, 0x6E, 
-    0xFF, 0xEC, 0xFF, 0xE0, 0x41, 0xEE, 0xFF, 0xDC, 0x2F, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x40, 0x58, 0x50, 0x4F, 0x60, 0x76, 0x47, 0xEE, 0xFF, 0xF0, 0x49, 0xEE, 0xFF, 0xE8, 
-    0x48, 0x6E, 0xFF, 0xE4, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xC6, 0x2F, 0x2B, 0x00, 0x04, 0x2F, 0x13, 
-    0x4E, 0xB9, 0x00, 0x00, 0x51, 0xAE, 0x2C, 0x00, 0x76, 0x01, 0x20, 0x0C, 0x66, 0x16, 0x2F, 0x03, 
-    0x70, 0x08, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x4A, 0x80, 
-    0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x28, 0x93, 0x29, 0x46, 0x00, 0x04, 0x20, 0x06, 
-    0x60, 0x02, 0x70, 0x00, 0x70, 0x02, 0xB0, 0xAE, 0xFF, 0xEC, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x1E, 
-    0x2D, 0x6E, 0xFF, 0xE8, 0xFF, 0xDC, 0x2D, 0x6E, 0xFF, 0xEC, 0xFF, 0xE0, 0x41, 0xEE, 0xFF, 0xDC, 
-    0x2F, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x45, 0x56, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x18, 0xC8, 0xFF, 0xC8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x28, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 
-    0x73, 0x50, 0x61, 0x72, 0x74, 0x5F, 0x5F, 0x46, 0x69, 0x52, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 
-    0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x6C, 
-    0x54, 0x33, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xC4, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x70, 0xFF, 0xB0, 0xAE, 0x00, 0x0C, 0x66, 0x00, 0x02, 0x62, 0x70, 0x00, 0x28, 0x40, 0x76, 0x01, 
-    0x22, 0x0C, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x14, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x58, 0x8F, 0x26, 0x1F, 0x28, 0x40, 0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x70, 0x18, 0x29, 0x40, 0x00, 0x10, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x23, 0xCC, 0xFF, 0xFF, 0xED, 0x4A, 0x28, 0x79, 0xFF, 0xFF, 
-    0xEA, 0xCC, 0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xF8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x00, 
-    0x00, 0xEA, 0x7A, 0x00, 0x60, 0x00, 0x00, 0xD4, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x6E, 0xFF, 0xE0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x5F, 0xCA, 0x48, 0x6E, 0xFF, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x60, 0xF8, 
-    0x28, 0x00, 0x7E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x00, 0x9C, 0x2F, 0x07, 0x48, 0x6E, 
-    0xFF, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0x28, 0x72, 0x0F, 0xC2, 0x80, 0x70, 0x01, 0xB0, 0x81, 
-    0x50, 0x4F, 0x66, 0x7E, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x90, 
-    0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0x8E, 0x2C, 0x00, 0x2F, 0x06, 
-    0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0xEA, 0x50, 0x8F, 0x2F, 0x00, 
-    0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xE0, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0x32, 0x50, 0x8F, 0x2F, 0x00, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x4D, 0xFC, 0x28, 0x40, 0x20, 0x0C, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xD4, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x2F, 0x06, 0x2F, 0x05, 0x2F, 0x0C, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x47, 0xFC, 0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xC4, 0x4F, 0xEF, 
-    0x00, 0x14, 0x20, 0x07, 0x52, 0x87, 0xB8, 0x87, 0x6E, 0x00, 0xFF, 0x62, 0x48, 0x6E, 0xFF, 0xE0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x60, 0xC2, 0xDA, 0x80, 0x58, 0x4F, 0xBA, 0xAE, 0xFF, 0xF8, 0x6D, 0x00, 
-    0xFF, 0x28, 0x20, 0x2E, 0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x70, 0x02, 0xB0, 0xAE, 0xFF, 0xFC, 
-    0x6C, 0x00, 0xFF, 0x10, 0x4A, 0xB9, 0xFF, 0xFF, 0xED, 0x42, 0x67, 0x00, 0x02, 0x46, 0x4A, 0xB9, 
-    0xFF, 0xFF, 0xF1, 0x68, 0x66, 0x00, 0x00, 0xBE, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x64, 0x48, 0x79, 0x00, 0x00, 0x01, 0x0A, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xF1, 0x64, 0x2F, 0x3C, 0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x68, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x68, 0x2F, 0x3C, 0x70, 0x74, 0x70, 0x74, 
-    0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x04, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xF1, 0x68, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x60, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x60, 
-    0x4F, 0xEF, 0x00, 0x30, 0x67, 0x30, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x60, 
-    0x2F, 0x3C, 0x67, 0x6C, 0x70, 0x74, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x48, 0x78, 0x04, 0x00, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x60, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x4F, 0xEF, 0x00, 0x18, 0x60, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEC, 0xE2, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x23, 0xC0, 
-    0xFF, 0xFF, 0xED, 0x46, 0x48, 0x79, 0x00, 0x00, 0x01, 0x02, 0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x46, 
-    0x2F, 0x3C, 0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xED, 0x42, 0x2F, 0x3C, 0x66, 0x65, 0x78, 0x70, 0x4E, 0xB9, 0x00, 0x00, 
-    0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x1C, 0x60, 0x00, 0x01, 0x3A, 0x28, 0x79, 0xFF, 0xFF, 0xEA, 0xCC, 
-    0x2E, 0x2C, 0x00, 0x08, 0x7A, 0x00, 0x60, 0x00, 0x00, 0xCE, 0x2F, 0x05, 0x2F, 0x0B, 0x48, 0x6E, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x5F, 0xCA, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x60, 0xF8, 0x2C, 0x00, 0x78, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0x00, 0x96, 0x2F, 0x04, 
-    0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0x28, 0x72, 0x0F, 0xC2, 0x80, 0x70, 0x01, 
-    0xB0, 0x81, 0x50, 0x4F, 0x66, 0x78, 0x70, 0x20, 0x3F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0xC5, 0x88, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x90, 0x2F, 0x04, 0x48, 0x6E, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0x8E, 0x50, 0x8F, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x6E, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0xEA, 0x50, 0x8F, 0x2F, 0x00, 0x2F, 0x04, 0x48, 0x6E, 
-    0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0x32, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xC8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x4D, 0xFC, 0x20, 0x2E, 0x00, 0x0C, 0xD0, 0xB9, 0xFF, 0xFF, 0xF3, 0x2C, 
-    0xD0, 0x85, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xC8, 0x4E, 0xB9, 0x00, 0x00, 0x54, 0xAE, 0x2F, 0x39, 
-    0xFF, 0xFF, 0xEA, 0xCC, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xC4, 0x4F, 0xEF, 0x00, 0x20, 0x20, 0x04, 
-    0x52, 0x84, 0xBC, 0x84, 0x6E, 0x00, 0xFF, 0x68, 0x48, 0x6E, 0xFF, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x60, 0xC2, 0xDA, 0x80, 0x58, 0x4F, 0xBE, 0x85, 0x6E, 0x00, 0xFF, 0x30, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0xED, 0x42, 0x67, 0x4E, 0x26, 0x79, 0xFF, 0xFF, 0xED, 0x42, 0x20, 0x2B, 0x00, 0x08, 0x22, 0x2B, 
-    0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x2A, 0x00, 0x78, 0x00, 0x60, 0x30, 0x26, 0x79, 
-    0xFF, 0xFF, 0xED, 0x42, 0x20, 0x53, 0x20, 0x2B, 0x00, 0x10, 0x22, 0x04, 0x2D, 0x48, 0xFF, 0xC4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xC4, 0xD0, 0x90, 0x20, 0x40, 0x20, 0x2E, 
-    0x00, 0x0C, 0xD0, 0xB9, 0xFF, 0xFF, 0xF3, 0x2C, 0xD1, 0x90, 0x20, 0x04, 0x52, 0x84, 0xBA, 0x84, 
-    0x6E, 0xCC, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xA8, 0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x50, 0x72, 0x6F, 
-    0x63, 0x65, 0x73, 0x73, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x5F, 0x5F, 0x46, 0x50, 
-    0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x10, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x18, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x3C, 0x28, 0xAE, 0x00, 0x0C, 
-    0x29, 0x6E, 0x00, 0x10, 0x00, 0x04, 0x29, 0x6E, 0x00, 0x14, 0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x0C, 0x20, 0x54, 0x72, 0x01, 0xC2, 0xA8, 0x00, 0x04, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x72, 0x08, 0x60, 0x02, 0x72, 0x04, 0x48, 0x81, 0x48, 0xC1, 0x29, 0x41, 0x00, 0x10, 0x20, 0x01, 
-    0x53, 0x80, 0x46, 0x80, 0x29, 0x40, 0x00, 0x14, 0x20, 0x0C, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 
-    0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 
-    0x72, 0x46, 0x50, 0x63, 0x6C, 0x54, 0x32, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x08, 0x07, 0x00, 0x00, 0x67, 0x0C, 
-    0x20, 0x07, 0xD0, 0x94, 0x53, 0x80, 0x90, 0xAC, 0x00, 0x08, 0x60, 0x12, 0x2F, 0x07, 0x48, 0x79, 
-    0xFF, 0xFF, 0xED, 0x4E, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x70, 0x00, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
-    0x50, 0x74, 0x72, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 
-    0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x28, 0x40, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x94, 
-    0x72, 0x01, 0xC2, 0x80, 0x50, 0x4F, 0x66, 0x0A, 0x0C, 0xAC, 0x00, 0x05, 0x55, 0x52, 0x00, 0x08, 
-    0x67, 0x10, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x50, 0x4F, 0x41, 0xEC, 0x00, 0x0C, 0x20, 0x08, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x22, 0x53, 0x79, 0x6D, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x5F, 0x31, 
-    0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 
-    0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0xF0, 0x28, 0x40, 0x20, 0x4C, 
-    0x58, 0x88, 0x20, 0x08, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x53, 0x79, 
-    0x6D, 0x62, 0x6F, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 
-    0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 
-    0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0xF0, 0x28, 0x40, 0x2F, 0x2E, 0x00, 0x10, 
-    0x48, 0x6C, 0x00, 0x04, 0x4E, 0xB9, 0x00, 0x00, 0x39, 0x00, 0x4A, 0x80, 0x57, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x22, 0x53, 0x79, 0x6D, 0x54, 0x65, 0x73, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 
-    0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 
-    0x46, 0x6C, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x20, 0x40, 0x20, 0x10, 0xE0, 0x88, 0x41, 0xF8, 
-    0x00, 0x0C, 0x90, 0x88, 0xE4, 0x88, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x24, 0x41, 0x72, 0x72, 0x61, 
-    0x79, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 
-    0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x07, 0x18, 0x26, 0x6E, 0x00, 0x14, 0x28, 0x6E, 
-    0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x7E, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x70, 0x02, 0xB0, 0xA8, 0x00, 0x0C, 0x50, 0x4F, 
-    0x67, 0x20, 0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x28, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x50, 0x64, 0x2E, 0x00, 0x4A, 0x93, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x04, 0x20, 0x07, 
-    0x60, 0x5A, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x10, 0xE0, 0x88, 0x72, 0x10, 0x90, 0x81, 0xE4, 0x88, 
-    0x2A, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x41, 0xE8, 0x00, 0x10, 0x2D, 0x48, 0xFF, 0xFC, 0x60, 0x2E, 
-    0x20, 0x2E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0x40, 0x2C, 0x10, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2F, 0x06, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4F, 0xB6, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x67, 0x08, 0x70, 0x01, 0x26, 0x80, 0x20, 0x07, 0x60, 0x12, 0x20, 0x07, 0x52, 0x87, 0x20, 0x05, 
-    0x53, 0x85, 0x4A, 0x80, 0x66, 0xCA, 0x70, 0x00, 0x26, 0x80, 0x20, 0x07, 0x4C, 0xEE, 0x18, 0xE0, 
-    0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x28, 0x46, 0x69, 0x6E, 0x64, 0x4F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x31, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 
-    0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x50, 0x63, 0x50, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x2F, 0x07, 0x48, 0x6E, 0xFF, 0xFC, 0x2F, 0x2E, 0x00, 0x10, 
-    0x20, 0x6E, 0x00, 0x0C, 0x2F, 0x28, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x50, 0x64, 0x2E, 0x00, 0x4A, 0xAE, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x04, 0x20, 0x07, 
-    0x60, 0x02, 0x70, 0xFF, 0x2E, 0x2E, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2B, 0x46, 0x69, 
-    0x6E, 0x64, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 
-    0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 
-    0x50, 0x35, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x01, 0x18, 0x2E, 0x2E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x14, 0x28, 0x6E, 0x00, 0x08, 
-    0x2F, 0x07, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x40, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x90, 0x72, 0x03, 0xC2, 0x80, 0x70, 0x03, 0xB0, 0x81, 
-    0x50, 0x4F, 0x67, 0x10, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0x94, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6D, 0xB0, 0x50, 0x4F, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x51, 0x44, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x0C, 
-    0x20, 0x0B, 0x67, 0x04, 0x70, 0x00, 0x26, 0x80, 0x70, 0x02, 0x60, 0x14, 0x20, 0x0B, 0x67, 0x04, 
-    0x70, 0x01, 0x26, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x07, 0xE5, 0x80, 0x20, 0x30, 0x08, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x29, 0x47, 0x65, 0x74, 0x46, 
-    0x72, 0x61, 0x6D, 0x65, 0x53, 0x6C, 0x6F, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 
-    0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 
-    0x6C, 0x50, 0x63, 0x50, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 
-    0x2C, 0x2E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x06, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x26, 0x40, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x93, 
-    0x72, 0x03, 0xC2, 0x80, 0x70, 0x01, 0xB0, 0x81, 0x50, 0x4F, 0x67, 0x10, 0x2F, 0x06, 0x48, 0x79, 
-    0xFF, 0xFF, 0xED, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x4A, 0x87, 0x6D, 0x10, 
-    0x2F, 0x06, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x50, 0x18, 0xB0, 0x87, 0x50, 0x4F, 0x6E, 0x10, 
-    0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 0xED, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 
-    0x20, 0x07, 0xE5, 0x80, 0x20, 0x33, 0x08, 0x0C, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x27, 0x47, 0x65, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x53, 0x6C, 0x6F, 0x74, 
-    0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 
-    0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF4, 0x48, 0xE7, 0x17, 0x18, 0x2A, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2D, 0x54, 0xFF, 0xF4, 0x20, 0x2C, 0x00, 0x04, 0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x70, 0x02, 0xB0, 0x85, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 0x60, 0x0E, 0x2F, 0x05, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x4A, 0x80, 0x50, 0x4F, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x60, 0x00, 0x00, 0xCA, 0x20, 0x2E, 0xFF, 0xF4, 0xB0, 0xAE, 0xFF, 0xFC, 0x67, 0x00, 0x00, 0x8A, 
-    0x20, 0x6E, 0xFF, 0xF4, 0x48, 0x68, 0x00, 0x08, 0x20, 0x4B, 0x22, 0x53, 0xD0, 0xE9, 0x00, 0x08, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x90, 0x08, 0x00, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x5A, 0x20, 0x10, 
-    0xE0, 0x88, 0x41, 0xF8, 0x00, 0x0C, 0x90, 0x88, 0xE4, 0x88, 0x2C, 0x00, 0x20, 0x6E, 0xFF, 0xF4, 
-    0x20, 0x06, 0xE5, 0x80, 0x41, 0xF0, 0x08, 0x0C, 0xB1, 0xEE, 0xFF, 0xF8, 0x63, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEE, 0x02, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x7E, 0x00, 0x60, 0x24, 
-    0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x07, 0xE5, 0x80, 0x48, 0x70, 0x08, 0x0C, 0x20, 0x4B, 0x22, 0x53, 
-    0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x50, 0x4F, 
-    0x20, 0x07, 0x52, 0x87, 0xBC, 0x87, 0x6E, 0xD8, 0x20, 0x6E, 0xFF, 0xF4, 0x20, 0x10, 0xE0, 0x88, 
-    0x22, 0x2C, 0x00, 0x10, 0xD2, 0x80, 0x53, 0x81, 0x2A, 0x2C, 0x00, 0x14, 0xCA, 0x81, 0x4A, 0x85, 
-    0x67, 0x0C, 0x20, 0x05, 0xD0, 0xAE, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xF4, 0x60, 0x0E, 0x48, 0x79, 
-    0xFF, 0xFF, 0xEE, 0x1A, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x20, 0x2E, 0xFF, 0xF4, 
-    0xB0, 0xAE, 0xFF, 0xF8, 0x65, 0x00, 0xFF, 0x2E, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xDC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x2E, 0x53, 0x63, 0x61, 0x6E, 0x52, 0x65, 0x66, 0x73, 0x5F, 0x5F, 0x31, 0x39, 
-    0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 
-    0x73, 0x6F, 0x72, 0x46, 0x52, 0x31, 0x30, 0x52, 0x65, 0x66, 0x53, 0x63, 0x61, 0x6E, 0x6E, 0x65, 
-    0x72, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0x03, 
-    0xC0, 0x94, 0x72, 0x01, 0xB2, 0x80, 0x66, 0x0A, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x28, 0x00, 0x04, 
-    0xD1, 0x94, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x53, 0x63, 0x61, 0x6E, 0x52, 
-    0x65, 0x66, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x52, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x53, 
-    0x63, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x46, 0x50, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 
-    0x48, 0xE7, 0x10, 0x08, 0x49, 0xEE, 0xFF, 0xF8, 0x76, 0x01, 0x20, 0x0C, 0x66, 0x18, 0x2F, 0x03, 
-    0x70, 0x04, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x28, 0x40, 
-    0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0E, 0x28, 0xB9, 0xFF, 0xFF, 0xEF, 0x48, 
-    0x20, 0x39, 0xFF, 0xFF, 0xEF, 0x48, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x79, 0xFF, 0xFF, 0xEF, 0x4C, 
-    0xFF, 0xF8, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 0x41, 0xEE, 0xFF, 0xF8, 0x70, 0x02, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x53, 0x10, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x21, 0x52, 0x65, 
-    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 
-    0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x67, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x32, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 
-    0x70, 0x01, 0x29, 0x40, 0x00, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2E, 
-    0x42, 0x65, 0x67, 0x69, 0x6E, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
-    0x53, 0x65, 0x74, 0x75, 0x70, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 
-    0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x5E, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x26, 0x40, 0xB7, 0xD4, 
-    0x50, 0x4F, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0x90, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x70, 0xFF, 0xB0, 0xAB, 0x00, 0x04, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0xBC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x27, 0x6E, 0x00, 0x10, 0x00, 0x04, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x29, 0x53, 0x65, 0x74, 0x52, 0x65, 0x64, 
-    0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 
-    0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 
-    0x6C, 0x54, 0x31, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x17, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEE, 0xE6, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x29, 0x40, 0x00, 0x0C, 0x2D, 0x54, 0xFF, 0xF8, 
-    0x22, 0x2C, 0x00, 0x04, 0xD2, 0x94, 0x2D, 0x41, 0xFF, 0xFC, 0x60, 0x00, 0x01, 0x3A, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x70, 0xFF, 0xB0, 0xA8, 0x00, 0x04, 0x67, 0x00, 0x00, 0xF8, 0x50, 0x88, 0x2D, 0x48, 
-    0xFF, 0xF0, 0x70, 0x03, 0xC0, 0x90, 0x72, 0x01, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x3E, 
-    0x2F, 0x10, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x2D, 0x40, 0xFF, 0xF4, 0x76, 0x00, 
-    0x20, 0x6E, 0xFF, 0xF4, 0x4A, 0xA8, 0x00, 0x04, 0x67, 0x0A, 0x70, 0xFF, 0xB0, 0xA8, 0x00, 0x04, 
-    0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x10, 0x20, 0x6E, 0xFF, 0xF4, 0x22, 0x6E, 0xFF, 0xF0, 
-    0x22, 0xA8, 0x00, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x90, 0x08, 0x00, 0x00, 0x00, 
-    0x67, 0x00, 0x00, 0x90, 0x20, 0x10, 0xE0, 0x88, 0x41, 0xF8, 0x00, 0x0C, 0x90, 0x88, 0xE4, 0x88, 
-    0x2C, 0x00, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x06, 0xE5, 0x80, 0x41, 0xF0, 0x08, 0x0C, 0xB1, 0xEE, 
-    0xFF, 0xFC, 0x63, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x18, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x7E, 0x00, 0x60, 0x58, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x07, 0xE5, 0x80, 0x41, 0xF0, 
-    0x08, 0x0C, 0x2D, 0x48, 0xFF, 0xEC, 0x70, 0x03, 0xC0, 0x90, 0x72, 0x01, 0xB2, 0x80, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x34, 0x2F, 0x10, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x26, 0x40, 
-    0x76, 0x00, 0x4A, 0xAB, 0x00, 0x04, 0x67, 0x0A, 0x70, 0xFF, 0xB0, 0xAB, 0x00, 0x04, 0x67, 0x02, 
-    0x76, 0x01, 0x4A, 0x03, 0x67, 0x0C, 0x20, 0x6E, 0xFF, 0xEC, 0x20, 0xAB, 0x00, 0x04, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x07, 0x52, 0x87, 0xBC, 0x87, 
-    0x6E, 0xA4, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x10, 0xE0, 0x88, 0x22, 0x2C, 0x00, 0x10, 0xD2, 0x80, 
-    0x53, 0x81, 0x2A, 0x2C, 0x00, 0x14, 0xCA, 0x81, 0x4A, 0x85, 0x67, 0x0C, 0x20, 0x05, 0xD0, 0xAE, 
-    0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xF8, 0x60, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x30, 0x4E, 0xB9, 
-    0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x20, 0x2E, 0xFF, 0xF8, 0xB0, 0xAE, 0xFF, 0xFC, 0x65, 0x00, 
-    0xFE, 0xBE, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x10, 0xE0, 0x88, 0x22, 0x2C, 0x00, 0x10, 0xD2, 0x80, 
-    0x53, 0x81, 0x20, 0x2C, 0x00, 0x14, 0xC0, 0x81, 0xD0, 0x94, 0x2D, 0x40, 0xFF, 0xF8, 0x60, 0x2E, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x4A, 0xA8, 0x00, 0x04, 0x67, 0x06, 0x70, 0x00, 0x21, 0x40, 0x00, 0x04, 
-    0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x10, 0xE0, 0x88, 0x22, 0x2C, 0x00, 0x10, 0xD2, 0x80, 0x53, 0x81, 
-    0x20, 0x2C, 0x00, 0x14, 0xC0, 0x81, 0xD0, 0xAE, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xF8, 0x20, 0x2E, 
-    0xFF, 0xF8, 0xB0, 0xAE, 0xFF, 0xFC, 0x65, 0xC8, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xD4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x26, 0x44, 0x6F, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x5F, 0x5F, 0x31, 0x39, 0x54, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x50, 0x61, 0x72, 0x74, 
-    0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x01, 0xC0, 0xAC, 
-    0x00, 0x04, 0x67, 0x3A, 0x70, 0x01, 0xC0, 0xAB, 0x00, 0x04, 0x67, 0x32, 0x2F, 0x2C, 0x00, 0x04, 
-    0x2F, 0x14, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x2D, 0x40, 0xFF, 0xFC, 0x2F, 0x2B, 0x00, 0x04, 
-    0x2F, 0x13, 0x4E, 0xB9, 0x00, 0x00, 0x4E, 0x8C, 0x22, 0x2E, 0xFF, 0xFC, 0xB0, 0x81, 0x57, 0xC3, 
-    0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x12, 0x20, 0x2C, 
-    0x00, 0x04, 0xB0, 0xAB, 0x00, 0x04, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 
-    0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x5F, 0x5F, 0x65, 0x71, 0x5F, 
-    0x5F, 0x37, 0x50, 0x61, 0x72, 0x74, 0x52, 0x65, 0x66, 0x46, 0x52, 0x37, 0x50, 0x61, 0x72, 0x74, 
-    0x52, 0x65, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xF0, 
-    0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xF4, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xFC, 0x70, 0x10, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xF0, 0x2F, 0x39, 0xFF, 0xFF, 0xF3, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x41, 0x64, 0x64, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 
-    0x46, 0x55, 0x6C, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x50, 0x46, 0x50, 0x36, 0x54, 
-    0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x5F, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x07, 0x18, 0x2A, 0x2E, 0x00, 0x08, 0x26, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x2B, 0x00, 0x08, 
-    0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x2C, 0x00, 0x7E, 0x00, 0x60, 0x3A, 
-    0x28, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x54, 0x20, 0x2C, 0x00, 0x10, 0x22, 0x07, 0x2D, 0x48, 
-    0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xFC, 0xD0, 0x90, 0x26, 0x40, 
-    0xBA, 0x93, 0x66, 0x12, 0x20, 0x6E, 0x00, 0x0C, 0x22, 0x4B, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 
-    0x20, 0xD9, 0x70, 0x01, 0x60, 0x0A, 0x20, 0x07, 0x52, 0x87, 0xBC, 0x87, 0x6E, 0xC2, 0x70, 0x00, 
-    0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x46, 0x69, 0x6E, 0x64, 0x42, 
-    0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 0x46, 0x55, 0x6C, 0x52, 0x35, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x26, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 
-    0x20, 0x2B, 0x00, 0x08, 0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x2C, 0x00, 
-    0x7E, 0x00, 0x60, 0x40, 0x28, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x54, 0x20, 0x2C, 0x00, 0x10, 
-    0x22, 0x07, 0x2D, 0x48, 0xFF, 0xFC, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xFC, 
-    0xD0, 0x90, 0x26, 0x40, 0x20, 0x2B, 0x00, 0x04, 0xB0, 0xAE, 0x00, 0x08, 0x66, 0x12, 0x20, 0x6E, 
-    0x00, 0x0C, 0x22, 0x4B, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x70, 0x01, 0x60, 0x0A, 
-    0x20, 0x07, 0x52, 0x87, 0xBC, 0x87, 0x6E, 0xBC, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x46, 0x69, 0x6E, 0x64, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x5F, 
-    0x46, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x52, 0x35, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xB8, 0x48, 0xE7, 0x1F, 0x18, 0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 
-    0xF3, 0x28, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x68, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 0xF3, 0x2C, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEF, 0x82, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 
-    0xF1, 0x54, 0x66, 0x0A, 0x23, 0xF9, 0xFF, 0xFF, 0xF3, 0x2C, 0xFF, 0xFF, 0xF1, 0x54, 0x7E, 0x00, 
-    0x60, 0x46, 0x28, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x54, 0x20, 0x2C, 0x00, 0x10, 0x22, 0x07, 
-    0x2D, 0x48, 0xFF, 0xC8, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xC8, 0xD0, 0x90, 
-    0x20, 0x40, 0x43, 0xEE, 0xFF, 0xF0, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x4A, 0xAE, 
-    0xFF, 0xFC, 0x67, 0x10, 0x70, 0xFF, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF4, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x90, 0x50, 0x4F, 0x20, 0x07, 0x52, 0x87, 0x26, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x2B, 
-    0x00, 0x08, 0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0xB0, 0x87, 0x6E, 0xA2, 
-    0x23, 0xFC, 0x52, 0x45, 0x78, 0x42, 0xFF, 0xFF, 0xF3, 0x0C, 0x23, 0xFC, 0x6C, 0x6F, 0x63, 0x6B, 
-    0xFF, 0xFF, 0xF3, 0x10, 0x70, 0x01, 0x23, 0xC0, 0xFF, 0xFF, 0xF3, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 
-    0xF1, 0x70, 0x67, 0x32, 0x48, 0x79, 0x00, 0x00, 0x01, 0x02, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x6C, 
-    0x2F, 0x3C, 0x70, 0x61, 0x64, 0x20, 0x4E, 0xB9, 0x00, 0x00, 0x58, 0xC8, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x70, 0x2F, 0x3C, 0x6A, 0x75, 0x6D, 0x70, 0x4E, 0xB9, 0x00, 0x00, 
-    0x58, 0xC8, 0x4F, 0xEF, 0x00, 0x18, 0x26, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x2B, 0x00, 0x08, 
-    0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x2A, 0x00, 0x22, 0x05, 0x20, 0x01, 
-    0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 
-    0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x26, 0x40, 0x20, 0x05, 0x22, 0x00, 0xC0, 0xFC, 
-    0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x91, 0xC8, 
-    0x41, 0xF0, 0x08, 0x28, 0x2C, 0x08, 0x48, 0x6E, 0xFF, 0xF2, 0x4E, 0xB9, 0x00, 0x00, 0x10, 0x62, 
-    0x41, 0xEE, 0xFF, 0xF2, 0x78, 0x00, 0x7E, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xE8, 0x28, 0x79, 
-    0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x54, 0x20, 0x2C, 0x00, 0x10, 0x22, 0x07, 0x2D, 0x48, 0xFF, 0xC4, 
-    0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xC4, 0xD0, 0x90, 0x20, 0x40, 0x43, 0xEE, 
-    0xFF, 0xDC, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x20, 0x07, 0x22, 0x00, 0xC0, 0xFC, 
-    0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x27, 0xAE, 
-    0xFF, 0xDC, 0x08, 0x00, 0x0C, 0xAE, 0x66, 0x65, 0x78, 0x70, 0xFF, 0xDC, 0x66, 0x02, 0x28, 0x06, 
-    0x20, 0x07, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 
-    0x42, 0x41, 0xD0, 0x81, 0x27, 0x86, 0x08, 0x04, 0x70, 0x04, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xE0, 
-    0x4E, 0xB9, 0x00, 0x00, 0x02, 0x3A, 0x2D, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0xFF, 0xEC, 0x20, 0x6E, 
-    0xFF, 0xEC, 0x20, 0x50, 0x22, 0x6E, 0xFF, 0xEC, 0x20, 0x29, 0x00, 0x10, 0x22, 0x07, 0x2D, 0x48, 
-    0xFF, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xC0, 0xD0, 0x90, 0x20, 0x40, 
-    0x21, 0x46, 0x00, 0x08, 0x4A, 0xAE, 0xFF, 0xE8, 0x50, 0x4F, 0x67, 0x0E, 0x2F, 0x06, 0x2F, 0x2E, 
-    0xFF, 0xE0, 0x20, 0x6E, 0xFF, 0xE8, 0x4E, 0x90, 0x50, 0x4F, 0x20, 0x6E, 0xFF, 0xE0, 0x20, 0x07, 
-    0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 
-    0xD0, 0x81, 0x27, 0xA8, 0x00, 0x08, 0x08, 0x08, 0x20, 0x6E, 0xFF, 0xE0, 0xDC, 0xA8, 0x00, 0x08, 
-    0x20, 0x07, 0x52, 0x87, 0xBA, 0x87, 0x6E, 0x00, 0xFF, 0x16, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x70, 0x67, 0x3E, 0x4E, 0xB9, 0x00, 0x00, 0x68, 0x7A, 0x28, 0x79, 
-    0xFF, 0xFF, 0xF1, 0x70, 0x20, 0x05, 0x53, 0x80, 0x22, 0x00, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x41, 
-    0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x41, 0x42, 0x41, 0xD0, 0x81, 0x27, 0xAC, 0x00, 0x08, 0x08, 0x08, 
-    0x28, 0x79, 0xFF, 0xFF, 0xF1, 0x70, 0xDC, 0xAC, 0x00, 0x08, 0x28, 0x79, 0xFF, 0xFF, 0xF1, 0x70, 
-    0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xF8, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x68, 0x67, 0x12, 0x2F, 0x04, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x66, 0xF0, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x7E, 0x00, 0x60, 0x4C, 0x28, 0x79, 0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x54, 0x20, 0x2C, 0x00, 0x10, 
-    0x22, 0x07, 0x2D, 0x48, 0xFF, 0xBC, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xBC, 
-    0xD0, 0x90, 0x20, 0x40, 0x43, 0xEE, 0xFF, 0xE0, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 
-    0x20, 0x6E, 0xFF, 0xE4, 0x2F, 0x28, 0x00, 0x08, 0x20, 0x50, 0x20, 0x10, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0xF2, 0x4E, 0xB9, 0x00, 0x00, 0x10, 0x88, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x07, 0x52, 0x87, 
-    0xBA, 0x87, 0x6E, 0xB0, 0x23, 0xC6, 0xFF, 0xFF, 0xF3, 0x24, 0x23, 0xC5, 0xFF, 0xFF, 0xF3, 0x30, 
-    0x48, 0x6E, 0xFF, 0xF2, 0x4E, 0xB9, 0x00, 0x00, 0x11, 0x16, 0x3D, 0x40, 0xFF, 0xEE, 0x41, 0xEE, 
-    0xFF, 0xEE, 0x70, 0x00, 0x30, 0x10, 0x23, 0xC0, 0xFF, 0xFF, 0xF3, 0x14, 0x41, 0xF9, 0xFF, 0xFF, 
-    0xF3, 0x0C, 0x2D, 0x48, 0xFF, 0xFC, 0x41, 0xF8, 0x00, 0x28, 0x2C, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x00, 0x00, 0x9C, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x10, 
-    0x90, 0xAC, 0x00, 0x0C, 0xB0, 0x86, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x1C, 0x2F, 0x06, 0x2F, 0x2E, 
-    0xFF, 0xFC, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x03, 0xEA, 0xDD, 0xAC, 0x00, 0x0C, 
-    0x20, 0x06, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x20, 0x2F, 0x06, 0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x44, 
-    0x4E, 0x91, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0xBC, 0x80, 0x56, 0xC3, 0x44, 0x03, 0x67, 0x34, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6E, 0x00, 0x08, 
-    0x20, 0x68, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x00, 0x01, 0x0E, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 0x22, 0x05, 0x20, 0x01, 
-    0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 
-    0x20, 0x2C, 0x00, 0x10, 0x90, 0xAC, 0x00, 0x0C, 0xB0, 0x81, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x54, 
-    0x22, 0x05, 0x20, 0x01, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x40, 
-    0x42, 0x40, 0xD2, 0x80, 0x2F, 0x01, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x03, 0xEA, 0x22, 0x05, 0x20, 0x01, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x0C, 
-    0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0xD3, 0xAC, 0x00, 0x0C, 0x22, 0x05, 0x20, 0x01, 0xC2, 0xFC, 
-    0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x32, 0x22, 0x05, 0x20, 0x01, 0xC2, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0xC0, 0xFC, 
-    0x00, 0x0C, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x2F, 0x01, 0x2F, 0x0B, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x44, 0x4E, 0x91, 
-    0x22, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x24, 0x05, 0x20, 0x02, 0xC4, 0xFC, 0x00, 0x0C, 0x48, 0x40, 
-    0xC0, 0xFC, 0x00, 0x0C, 0x48, 0x40, 0x42, 0x40, 0xD4, 0x80, 0xB4, 0x81, 0x56, 0xC3, 0x44, 0x03, 
-    0x67, 0x34, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x7E, 0x00, 
-    0x58, 0x4F, 0x60, 0x4A, 0x70, 0xE0, 0x3F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0xC5, 0x88, 0x26, 0x79, 
-    0xFF, 0xFF, 0xF3, 0x08, 0x20, 0x53, 0x20, 0x2B, 0x00, 0x10, 0x22, 0x07, 0x2D, 0x48, 0xFF, 0xB8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 0xFF, 0xB8, 0xD0, 0x90, 0x20, 0x40, 0x43, 0xEE, 
-    0xFF, 0xCC, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 0x2F, 0x2E, 0xFF, 0xD0, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0xF8, 0x50, 0x4F, 0x20, 0x07, 0x52, 0x87, 0xBA, 0x87, 
-    0x6E, 0xB2, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x9C, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x50, 0x65, 0x72, 
-    0x66, 0x6F, 0x72, 0x6D, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5F, 0x5F, 0x46, 0x52, 0x37, 0x6F, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x0C, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0A, 0x28, 0xAE, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x10, 
-    0x00, 0x04, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x22, 0x5F, 0x5F, 
-    0x63, 0x74, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 
-    0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x52, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x76, 0x01, 
-    0x2F, 0x03, 0x70, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0x9E, 0x2F, 0x03, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x62, 0x66, 0x58, 0x8F, 0x26, 0x1F, 0x20, 0x40, 0x2F, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x1A, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x1F, 0x4A, 0x80, 0x67, 0x30, 0x2F, 0x03, 
-    0x70, 0x08, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xA8, 0x2F, 0x03, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x62, 0x66, 0x58, 0x8F, 0x26, 0x1F, 0x20, 0x40, 0x2F, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x1A, 0x4F, 0xEF, 0x00, 0x0C, 0x26, 0x1F, 0x4A, 0x80, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 
-    0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9F, 0x49, 
-    0x73, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 
-    0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0x66, 0x20, 0x40, 
-    0x20, 0x28, 0x00, 0x1C, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x53, 0x69, 0x7A, 0x65, 0x5F, 0x5F, 0x31, 
-    0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 
-    0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 
-    0x00, 0x00, 0x62, 0xA2, 0x20, 0x40, 0x20, 0x28, 0x00, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x4E, 
-    0x75, 0x6D, 0x50, 0x61, 0x72, 0x74, 0x73, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 
-    0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x61, 0x8E, 0x2E, 0x00, 0xDE, 0xAC, 0x00, 0x04, 0x20, 0x54, 
-    0x20, 0x50, 0x20, 0x07, 0xD0, 0x90, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x80, 0x27, 0x55, 0x6E, 0x73, 0x61, 0x66, 0x65, 0x50, 0x61, 0x72, 0x74, 0x44, 0x61, 0x74, 0x61, 
-    0x50, 0x74, 0x72, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 
-    0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0xA2, 0x20, 0x40, 
-    0x2D, 0x48, 0xFF, 0xFC, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0xE4, 
-    0x20, 0x40, 0x22, 0x6E, 0xFF, 0xFC, 0x20, 0x10, 0xD0, 0xA9, 0x00, 0x04, 0x28, 0x6E, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x20, 0x50, 0x61, 0x72, 0x74, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 
-    0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 
-    0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0xE4, 0x20, 0x40, 0x20, 0x28, 0x00, 0x04, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x50, 0x61, 0x72, 0x74, 0x53, 0x69, 0x7A, 0x65, 0x5F, 0x5F, 0x31, 
-    0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 
-    0x72, 0x46, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x62, 0xE4, 0x20, 0x40, 0x20, 0x28, 0x00, 0x14, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9F, 0x50, 0x61, 0x72, 0x74, 0x46, 0x6C, 0x61, 0x67, 0x73, 0x5F, 0x5F, 0x31, 0x36, 
-    0x54, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 
-    0x46, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x54, 
-    0x20, 0x50, 0x20, 0x2C, 0x00, 0x04, 0xD0, 0x90, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9C, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 0x63, 0x6B, 
-    0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x54, 0x20, 0x50, 0x20, 0x2C, 
-    0x00, 0x04, 0x72, 0x28, 0xD0, 0x81, 0xD0, 0x90, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9F, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 
-    0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x76, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x54, 
-    0x20, 0x50, 0x20, 0x2C, 0x00, 0x04, 0x72, 0x34, 0xD0, 0x81, 0x26, 0x40, 0xD7, 0xD0, 0x20, 0x2E, 
-    0x00, 0x0C, 0xEB, 0x80, 0x41, 0xF3, 0x08, 0x00, 0x20, 0x08, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x50, 0x61, 0x72, 0x74, 0x5F, 0x5F, 0x31, 0x36, 0x54, 0x50, 0x61, 
-    0x63, 0x6B, 0x61, 0x67, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x46, 0x6C, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2E, 0x14, 0x2C, 0x13, 0xBC, 0x87, 0x6F, 0x04, 0x70, 0xFF, 0x60, 0x1E, 0xBC, 0x87, 
-    0x6C, 0x04, 0x70, 0x01, 0x60, 0x16, 0xB7, 0xCC, 0x67, 0x10, 0x2F, 0x07, 0x48, 0x79, 0xFF, 0xFF, 
-    0xEF, 0xB2, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xC0, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x50, 0x54, 
-    0x45, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x5F, 0x5F, 0x46, 0x50, 0x43, 0x76, 0x54, 0x31, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xD8, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6D, 0xB0, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x42, 0x61, 0x64, 0x50, 0x61, 0x74, 0x63, 0x68, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 
-    0x4A, 0x80, 0x60, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x52, 0x4A, 0x80, 0x58, 0x4F, 
-    0x2E, 0x00, 0x70, 0x0D, 0xB0, 0x87, 0x67, 0x06, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0xCC, 0x4C, 0xEE, 
-    0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x45, 0x61, 0x74, 0x4C, 0x69, 0x6E, 0x65, 
-    0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 
-    0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 
-    0x60, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x52, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 
-    0x70, 0x23, 0xB0, 0x87, 0x66, 0x0C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x63, 0xC0, 0x58, 0x4F, 
-    0x60, 0xC6, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x7A, 0x50, 0x4F, 0x4C, 0xEE, 
-    0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x53, 0x6B, 0x69, 0x70, 0x43, 0x6F, 0x6D, 
-    0x6D, 0x65, 0x6E, 0x74, 0x5F, 0x5F, 0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x10, 0xC2, 0x40, 0x67, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x63, 0x94, 0x2F, 0x0C, 0x4E, 0xB9, 
-    0x00, 0x00, 0x63, 0xC0, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x64, 0x1E, 0x50, 0x4F, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x45, 0x6E, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x5F, 0x5F, 
-    0x46, 0x50, 0x34, 0x46, 0x49, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE8, 0x48, 0xE7, 
-    0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xEE, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x62, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x66, 0x12, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xEF, 0xF0, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 
-    0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x64, 0x1E, 0x48, 0x6E, 0xFF, 0xF0, 0x48, 0x79, 0xFF, 0xFF, 
-    0xF0, 0x00, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x2A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x10, 
-    0x66, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x63, 0x94, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x64, 0x92, 
-    0x70, 0x04, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xF0, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x7E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x56, 0x48, 0x6E, 0xFF, 0xEC, 0x48, 0x6E, 0xFF, 0xE8, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x04, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x2A, 0x72, 0x02, 
-    0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x63, 0x94, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x64, 0x92, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xE8, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x70, 0x04, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEC, 0x2F, 0x0B, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x1C, 0x20, 0x07, 0x52, 0x87, 0xBE, 0xAE, 
-    0xFF, 0xF0, 0x6D, 0xA4, 0x48, 0x6E, 0xFF, 0xF4, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x2A, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 0x4E, 0xB9, 
-    0x00, 0x00, 0x63, 0x94, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x64, 0x92, 0x70, 0x04, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xF4, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x20, 0x2E, 0xFF, 0xF4, 
-    0xD0, 0x80, 0xE5, 0x80, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0xB6, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x7E, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x60, 0x4C, 0x48, 0x6E, 0xFF, 0xEC, 
-    0x48, 0x6E, 0xFF, 0xE8, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x10, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x2A, 0x72, 0x02, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x06, 0x4E, 0xB9, 0x00, 0x00, 
-    0x63, 0x94, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x64, 0x92, 0x20, 0x6E, 0xFF, 0xFC, 0x58, 0xAE, 
-    0xFF, 0xFC, 0x20, 0xAE, 0xFF, 0xE8, 0x20, 0x6E, 0xFF, 0xFC, 0x58, 0xAE, 0xFF, 0xFC, 0x20, 0xAE, 
-    0xFF, 0xEC, 0x58, 0x4F, 0x20, 0x07, 0x52, 0x87, 0xBE, 0xAE, 0xFF, 0xF4, 0x6D, 0xAE, 0x48, 0x79, 
-    0x00, 0x00, 0x00, 0xFA, 0x70, 0x08, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xF4, 0x2F, 0x2E, 0xFF, 0xF8, 
-    0x4E, 0xB9, 0x00, 0x00, 0x03, 0xFA, 0x2D, 0x6E, 0xFF, 0xF8, 0xFF, 0xFC, 0x7E, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x60, 0x24, 0x70, 0x04, 0x2F, 0x00, 0x22, 0x07, 0xD2, 0x81, 0x52, 0x81, 0x20, 0x6E, 
-    0xFF, 0xF8, 0xE5, 0x81, 0x48, 0x70, 0x18, 0x00, 0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x07, 0x52, 0x87, 0xBE, 0xAE, 0xFF, 0xF4, 0x6D, 0xD6, 0x2F, 0x2E, 
-    0xFF, 0xF8, 0x4E, 0xB9, 0x00, 0x00, 0x7F, 0x8C, 0x2F, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x5A, 
-    0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xDC, 0x4E, 0x5E, 0x4E, 0x75, 0x9E, 0x52, 0x65, 0x61, 
-    0x64, 0x50, 0x61, 0x74, 0x63, 0x68, 0x49, 0x6E, 0x66, 0x6F, 0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 
-    0x46, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x20, 0x2E, 0x00, 0x0C, 0x72, 0x04, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x5C, 0x22, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x5C, 0x28, 0x00, 
-    0x20, 0x2E, 0x00, 0x08, 0xD0, 0xB9, 0xFF, 0xFF, 0xF1, 0x54, 0x24, 0x04, 0x22, 0x02, 0xC4, 0xFC, 
-    0x10, 0x00, 0x48, 0x41, 0xC2, 0xFC, 0x10, 0x00, 0x48, 0x41, 0x42, 0x41, 0xD4, 0x81, 0xD4, 0x80, 
-    0x20, 0x3C, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x82, 0x22, 0x3C, 0x00, 0x00, 0x0A, 0xAE, 0x82, 0x80, 
-    0x2D, 0x41, 0xFF, 0xFC, 0x7A, 0x00, 0x60, 0x00, 0x00, 0x96, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x70, 
-    0x67, 0x3C, 0xB8, 0x85, 0x64, 0x06, 0x2C, 0x2E, 0xFF, 0xFC, 0x60, 0x38, 0x20, 0x2E, 0x00, 0x08, 
-    0xD0, 0xB9, 0xFF, 0xFF, 0xF1, 0x54, 0x24, 0x05, 0x22, 0x02, 0xC4, 0xFC, 0x10, 0x00, 0x48, 0x41, 
-    0xC2, 0xFC, 0x10, 0x00, 0x48, 0x41, 0x42, 0x41, 0xD4, 0x81, 0xD4, 0x80, 0x20, 0x3C, 0xFF, 0xFF, 
-    0xF0, 0x00, 0xC0, 0x82, 0x2C, 0x3C, 0x00, 0x00, 0x0A, 0xAE, 0x8C, 0x80, 0x60, 0x06, 0x2C, 0x3C, 
-    0x0B, 0xAD, 0x00, 0x00, 0x7E, 0x00, 0x74, 0x20, 0x60, 0x3C, 0x20, 0x05, 0xEB, 0x80, 0xD0, 0x87, 
-    0x26, 0x79, 0xFF, 0xFF, 0xF1, 0x68, 0x20, 0x53, 0x22, 0x10, 0x20, 0x41, 0xE5, 0x80, 0x21, 0x86, 
-    0x08, 0x00, 0x20, 0x06, 0xD0, 0xBC, 0x00, 0x40, 0x00, 0x00, 0x22, 0x05, 0xEB, 0x81, 0xD2, 0x87, 
-    0x28, 0x79, 0xFF, 0xFF, 0xF1, 0x60, 0x20, 0x54, 0x26, 0x10, 0x20, 0x43, 0xE5, 0x81, 0x21, 0x80, 
-    0x18, 0x00, 0x20, 0x07, 0x52, 0x87, 0xB4, 0x87, 0x6E, 0xC0, 0x20, 0x05, 0x52, 0x85, 0x70, 0x07, 
-    0xB0, 0x85, 0x6E, 0x00, 0xFF, 0x66, 0x4A, 0xB9, 0xFF, 0xFF, 0xED, 0x42, 0x67, 0x1C, 0x20, 0x2E, 
-    0x00, 0x10, 0xD0, 0xB9, 0xFF, 0xFF, 0xF1, 0x54, 0x22, 0x3C, 0xFF, 0xFF, 0xF0, 0x00, 0xC2, 0x80, 
-    0x2C, 0x3C, 0x00, 0x00, 0x0A, 0xAE, 0x8C, 0x81, 0x60, 0x06, 0x2C, 0x3C, 0x0B, 0xAD, 0x00, 0x00, 
-    0x2A, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x26, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x60, 0x34, 0x28, 0x79, 
-    0xFF, 0xFF, 0xF1, 0x68, 0x20, 0x54, 0x20, 0x10, 0x20, 0x40, 0x20, 0x05, 0xE5, 0x80, 0x21, 0x86, 
-    0x08, 0x00, 0x20, 0x06, 0xD0, 0xBC, 0x00, 0x40, 0x00, 0x00, 0x26, 0x79, 0xFF, 0xFF, 0xF1, 0x60, 
-    0x20, 0x53, 0x22, 0x10, 0x20, 0x41, 0x22, 0x05, 0xE5, 0x81, 0x21, 0x80, 0x18, 0x00, 0x20, 0x05, 
-    0x52, 0x85, 0xB6, 0x85, 0x6E, 0xC8, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x95, 0x42, 0x75, 0x69, 0x6C, 0x64, 0x50, 0x61, 0x67, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x5F, 
-    0x5F, 0x46, 0x6C, 0x4E, 0x32, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x9C, 0x48, 0xE7, 0x0F, 0x18, 
-    0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x5C, 0x67, 0x00, 0x02, 0xCC, 0x4A, 0xB9, 0xFF, 0xFF, 0xF1, 0x58, 
-    0x66, 0x1E, 0x20, 0x39, 0xFF, 0xFF, 0xF3, 0x28, 0x22, 0x3C, 0x00, 0x10, 0x00, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x73, 0x36, 0xD0, 0xBC, 0x01, 0xE0, 0x00, 0x00, 0x23, 0xC0, 0xFF, 0xFF, 0xF1, 0x58, 
-    0x70, 0xFF, 0xB0, 0xB9, 0xFF, 0xFF, 0xF1, 0x54, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x18, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x26, 0x79, 
-    0xFF, 0xFF, 0xF1, 0x5C, 0x20, 0x2B, 0x00, 0x08, 0x22, 0x2B, 0x00, 0x10, 0x4E, 0xB9, 0x00, 0x00, 
-    0x73, 0x5C, 0x2D, 0x40, 0xFF, 0xF8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x60, 0x00, 0x02, 0x5A, 
-    0x70, 0x20, 0x3F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0xC5, 0x88, 0x2D, 0x79, 0xFF, 0xFF, 0xF1, 0x5C, 
-    0xFF, 0xF0, 0x20, 0x6E, 0xFF, 0xF0, 0x20, 0x50, 0x22, 0x6E, 0xFF, 0xF0, 0x20, 0x29, 0x00, 0x10, 
-    0x22, 0x2E, 0xFF, 0xFC, 0x2D, 0x48, 0xFF, 0x9C, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0x36, 0x20, 0x6E, 
-    0xFF, 0x9C, 0xD0, 0x90, 0x20, 0x40, 0x43, 0xEE, 0xFF, 0xB8, 0x22, 0xD8, 0x22, 0xD8, 0x22, 0xD8, 
-    0x48, 0x6E, 0xFF, 0xC4, 0x2F, 0x2E, 0xFF, 0xB8, 0x4E, 0xB9, 0x00, 0x00, 0x59, 0xA4, 0x4A, 0x80, 
-    0x50, 0x4F, 0x66, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x3C, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 
-    0x58, 0x4F, 0x20, 0x2E, 0xFF, 0xBC, 0xD0, 0xAE, 0xFF, 0xCC, 0x2E, 0x39, 0xFF, 0xFF, 0xF3, 0x2C, 
-    0xDE, 0x80, 0x20, 0x39, 0xFF, 0xFF, 0xF1, 0x58, 0xD0, 0xAE, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xD4, 
-    0x2F, 0x2E, 0xFF, 0xC0, 0x4E, 0xB9, 0x00, 0x00, 0x02, 0x90, 0x20, 0x6E, 0xFF, 0xC0, 0x20, 0x50, 
-    0x20, 0x50, 0x2D, 0x50, 0xFF, 0xD8, 0x20, 0x6E, 0xFF, 0xC0, 0x20, 0x50, 0x26, 0x50, 0x58, 0x4B, 
-    0x20, 0x2E, 0xFF, 0xD8, 0xD0, 0x80, 0xE5, 0x80, 0xD0, 0x8B, 0x58, 0x80, 0x2D, 0x40, 0xFF, 0xDC, 
-    0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE0, 0x58, 0x4F, 0x60, 0x00, 0x00, 0xEE, 0x2C, 0x1B, 0x20, 0x1B, 
-    0x2D, 0x40, 0xFF, 0xA8, 0xE5, 0x80, 0xD0, 0xAE, 0xFF, 0xD4, 0x2D, 0x40, 0xFF, 0xAC, 0x2D, 0x47, 
-    0xFF, 0xB4, 0x20, 0x6E, 0xFF, 0xDC, 0x20, 0x2E, 0xFF, 0xA8, 0xE5, 0x80, 0x20, 0x30, 0x08, 0x00, 
-    0xD0, 0xAE, 0xFF, 0xB4, 0x2D, 0x40, 0xFF, 0xB0, 0x28, 0x06, 0xD8, 0xAE, 0xFF, 0xB4, 0x20, 0x6E, 
-    0xFF, 0xB8, 0x20, 0x50, 0x20, 0x06, 0xD0, 0xAE, 0xFF, 0xBC, 0x28, 0x40, 0xD9, 0xD0, 0x20, 0x3C, 
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x94, 0x22, 0x2E, 0xFF, 0xB0, 0x92, 0x84, 0x51, 0x81, 0xE4, 0x81, 
-    0x24, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xC4, 0x81, 0xB4, 0x80, 0x67, 0x1E, 0x20, 0x2E, 0xFF, 0xB0, 
-    0x90, 0x87, 0x2F, 0x00, 0x20, 0x04, 0x90, 0x87, 0x2F, 0x00, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0x6A, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xAC, 0x90, 0x84, 
-    0x51, 0x80, 0x2A, 0x00, 0xE4, 0x85, 0x20, 0x3C, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x85, 0x67, 0x44, 
-    0x20, 0x3C, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x85, 0x0C, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x67, 0x34, 
-    0x2F, 0x2E, 0xFF, 0xAC, 0x2F, 0x2E, 0xFF, 0xA8, 0x2F, 0x2E, 0xFF, 0xB0, 0x20, 0x07, 0xD0, 0x86, 
-    0x2F, 0x00, 0x2F, 0x06, 0x48, 0x79, 0xFF, 0xFF, 0xF0, 0xB0, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 
-    0x4E, 0xB9, 0x00, 0x00, 0x04, 0x32, 0x20, 0x2E, 0xFF, 0xE0, 0x52, 0xAE, 0xFF, 0xE0, 0x4F, 0xEF, 
-    0x00, 0x1C, 0x60, 0x14, 0x20, 0x3C, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x94, 0x22, 0x3C, 0x00, 0xFF, 
-    0xFF, 0xFF, 0xC2, 0x85, 0x82, 0x80, 0x28, 0x81, 0x20, 0x2E, 0xFF, 0xD8, 0x53, 0xAE, 0xFF, 0xD8, 
-    0x4A, 0x80, 0x66, 0x00, 0xFF, 0x08, 0x4A, 0xAE, 0xFF, 0xE0, 0x67, 0x12, 0x2F, 0x2E, 0xFF, 0xE0, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF1, 0x22, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x2D, 0x5B, 
-    0xFF, 0xE4, 0x2D, 0x6E, 0xFF, 0xD4, 0xFF, 0xE8, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xEC, 0x60, 0x50, 
-    0x20, 0x6E, 0xFF, 0xDC, 0x20, 0x2E, 0xFF, 0xEC, 0xE5, 0x80, 0x20, 0x30, 0x08, 0x00, 0xD0, 0x87, 
-    0x2D, 0x40, 0xFF, 0xA0, 0x90, 0xAE, 0xFF, 0xE8, 0x51, 0x80, 0xE4, 0x80, 0xC0, 0xBC, 0x00, 0xFF, 
-    0xFF, 0xFF, 0xD0, 0xBC, 0xEA, 0x00, 0x00, 0x00, 0x2D, 0x40, 0xFF, 0xA4, 0x70, 0x04, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0xA4, 0x2F, 0x39, 0xFF, 0xFF, 0xF1, 0x70, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 
-    0x58, 0xAE, 0xFF, 0xE8, 0x4F, 0xEF, 0x00, 0x0C, 0x20, 0x2E, 0xFF, 0xEC, 0x52, 0xAE, 0xFF, 0xEC, 
-    0x20, 0x2E, 0xFF, 0xEC, 0xB0, 0xAE, 0xFF, 0xE4, 0x6D, 0xA6, 0x2F, 0x2E, 0xFF, 0xC0, 0x4E, 0xB9, 
-    0x00, 0x00, 0x02, 0xC4, 0x20, 0x2E, 0xFF, 0xE4, 0xE5, 0x80, 0xD1, 0xAE, 0xFF, 0xF4, 0x58, 0x4F, 
-    0x20, 0x2E, 0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x20, 0x2E, 0xFF, 0xFC, 0xB0, 0xAE, 0xFF, 0xF8, 
-    0x6D, 0x00, 0xFD, 0x9E, 0x4C, 0xEE, 0x18, 0xF0, 0xFF, 0x84, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x50, 
-    0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x50, 0x61, 0x74, 0x63, 0x68, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x00, 0x2C, 0x2E, 
-    0x00, 0x10, 0x20, 0x2E, 0x00, 0x0C, 0x22, 0x06, 0x4E, 0xB9, 0x00, 0x00, 0x73, 0xA4, 0x2E, 0x00, 
-    0x67, 0x18, 0x2A, 0x06, 0x9A, 0x87, 0x2F, 0x05, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x4E, 0xB9, 0x00, 0x00, 0x00, 0xF8, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x00, 0xE0, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x5F, 0x5F, 0x46, 0x50, 0x36, 0x54, 
-    0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x54, 0x32, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x87, 0x67, 0x1C, 0x48, 0x78, 0x10, 0x00, 0x20, 0x07, 
-    0xD0, 0xB9, 0xFF, 0xFF, 0xF3, 0x2C, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 
-    0x6B, 0x78, 0x4F, 0xEF, 0x00, 0x0C, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x41, 
-    0x6C, 0x69, 0x67, 0x6E, 0x34, 0x4B, 0x5F, 0x5F, 0x46, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 
-    0x6B, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x0C, 0x70, 0xFF, 
-    0xB0, 0x87, 0x67, 0x1C, 0x48, 0x78, 0x04, 0x00, 0x20, 0x07, 0xD0, 0xB9, 0xFF, 0xFF, 0xF1, 0x54, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6B, 0x78, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x31, 0x4B, 
-    0x5F, 0x5F, 0x46, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x87, 0x67, 0x14, 0x48, 0x78, 
-    0x00, 0xB0, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6B, 0x78, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x41, 0x6C, 0x69, 0x67, 0x6E, 
-    0x42, 0x30, 0x5F, 0x5F, 0x46, 0x50, 0x36, 0x54, 0x43, 0x68, 0x75, 0x6E, 0x6B, 0x6C, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xE6, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x2D, 0x40, 
-    0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x41, 0xEE, 0xFF, 0xE6, 0x60, 0x3C, 0x48, 0x6E, 0xFF, 0xE6, 
-    0x4E, 0xB9, 0x00, 0x00, 0x05, 0x24, 0x4A, 0x80, 0x58, 0x4F, 0x66, 0x2C, 0x70, 0x00, 0x10, 0x2E, 
-    0xFF, 0xE6, 0x4A, 0x80, 0x66, 0x14, 0x2F, 0x2E, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0x74, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x60, 0x0E, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0x94, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x58, 0x4F, 0x48, 0x6E, 0xFF, 0xE6, 0x2F, 0x39, 0xFF, 0xFF, 
-    0xEC, 0x72, 0x4E, 0xB9, 0x00, 0x00, 0x27, 0x8C, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0xAE, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x95, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 
-    0x46, 0x69, 0x6C, 0x65, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xA8, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 
-    0x4E, 0xB9, 0x00, 0x00, 0x24, 0x70, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 
-    0x41, 0xEE, 0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x3A, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xB4, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x32, 0x70, 0x01, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x78, 0x8C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x46, 
-    0x61, 0x74, 0x61, 0x6C, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x5F, 0x46, 0x52, 0x31, 0x30, 0x54, 
-    0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x50, 0x6F, 0x73, 0x50, 0x63, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xF0, 0x48, 0xE7, 0x00, 0x18, 0x4A, 0xB9, 0xFF, 0xFF, 0xEC, 0x72, 0x67, 0x48, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF1, 0xB6, 0x26, 0x79, 0xFF, 0xFF, 0xEC, 0x72, 0x49, 0xEB, 0x00, 0x04, 0x2D, 0x54, 
-    0xFF, 0xF0, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF4, 0x2D, 0x6C, 0x00, 0x08, 0xFF, 0xF8, 0x2D, 0x6C, 
-    0x00, 0x0C, 0xFF, 0xFC, 0x41, 0xEE, 0xFF, 0xF0, 0x41, 0xEE, 0xFF, 0xF0, 0x2F, 0x08, 0x48, 0x79, 
-    0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x24, 0x70, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x86, 0xD6, 0x50, 0x4F, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xB8, 0x48, 0x79, 0xFF, 0xFF, 
-    0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x41, 0xEE, 0x00, 0x08, 0x26, 0x48, 0x58, 0x4B, 
-    0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x08, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x3A, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xC2, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 
-    0x00, 0x00, 0x04, 0x32, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x78, 0x8C, 0x4F, 0xEF, 
-    0x00, 0x20, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x46, 0x61, 0x74, 
-    0x61, 0x6C, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xC4, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x24, 0x70, 0x50, 0x8F, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x41, 0xEE, 0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x3A, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xD2, 0x48, 0x79, 0xFF, 0xFF, 0xFB, 0xB6, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x32, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x78, 0x8C, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x57, 0x61, 0x72, 0x6E, 0x69, 0x6E, 0x67, 0x5F, 0x5F, 0x46, 0x52, 
-    0x31, 0x30, 0x54, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x50, 0x6F, 0x73, 0x50, 0x63, 0x65, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x0C, 0x26, 0x6E, 
-    0x00, 0x08, 0x20, 0x0B, 0x67, 0x00, 0x00, 0xFC, 0x2F, 0x0B, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xD4, 
-    0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x20, 0x0C, 0x50, 0x4F, 0x67, 0x20, 0x2F, 0x0C, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF1, 0xDA, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 
-    0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x4F, 0x49, 0xF9, 0xFF, 0xFF, 
-    0xFE, 0xEC, 0x76, 0x01, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x66, 0x08, 0x4A, 0xA8, 
-    0x00, 0x1C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x14, 0x70, 0x0D, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xB9, 0x00, 0x00, 0x8E, 0x7C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x00, 0x00, 0x86, 0x20, 0x6C, 
-    0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x1E, 0x70, 0x0D, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 
-    0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x1A, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0xBC, 0x00, 0x0D, 0x30, 0x3C, 
-    0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x0D, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 0x72, 0xFF, 0xB2, 0x80, 
-    0x57, 0xC3, 0x44, 0x03, 0x67, 0x28, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 
-    0x20, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xDC, 0x48, 0x79, 0xFF, 0xFF, 0xF1, 0xF6, 0x48, 0x79, 
-    0xFF, 0xFF, 0xF2, 0x26, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x54, 0x2F, 0x39, 0xFF, 0xFF, 0xF3, 0x40, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x82, 0x48, 0x79, 0xFF, 0xFF, 0xFE, 0xEC, 0x4E, 0xB9, 0x00, 0x00, 
-    0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 
-    0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 
-    0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x86, 0xD6, 0x50, 0x8F, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x86, 0xD6, 0x4E, 0xB9, 0x00, 0x00, 0x05, 0xAC, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x78, 0x8C, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8C, 0x55, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x63, 0x54, 0x31, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0xFE, 0xC2, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x4E, 0xB9, 0x00, 0x00, 0x22, 0xF6, 0x23, 0xD3, 0xFF, 0xFF, 0xF3, 0x40, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x22, 0x07, 0x53, 0x87, 0x60, 0x00, 0x00, 0x9C, 
-    0x28, 0x53, 0x70, 0x2D, 0xB0, 0x14, 0x66, 0x62, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x8E, 0x20, 0x0C, 
-    0x52, 0x80, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x02, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x10, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 0x6E, 0xF4, 0x50, 0x4F, 0x60, 0x6A, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x94, 0x20, 0x0C, 0x52, 0x80, 0x2F, 0x00, 0x4E, 0xB9, 0x00, 0x00, 
-    0x04, 0x02, 0x4A, 0x80, 0x50, 0x4F, 0x66, 0x52, 0x4A, 0x87, 0x67, 0x0C, 0x58, 0x4B, 0x20, 0x07, 
-    0x53, 0x87, 0x2D, 0x53, 0xFF, 0xFC, 0x60, 0x42, 0x2F, 0x0C, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0x96, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6E, 0xF4, 0x50, 0x4F, 0x60, 0x30, 0x4A, 0xAE, 0xFF, 0xF8, 0x66, 0x06, 
-    0x2D, 0x4C, 0xFF, 0xF8, 0x60, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xAE, 
-    0x48, 0x6E, 0xFE, 0xC2, 0x4E, 0xB9, 0x00, 0x00, 0x04, 0x42, 0x2F, 0x0C, 0x48, 0x6E, 0xFE, 0xC2, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6E, 0xF4, 0x4F, 0xEF, 0x00, 0x14, 0x58, 0x4B, 0x20, 0x07, 0x53, 0x87, 
-    0x4A, 0x80, 0x66, 0x00, 0xFF, 0x5C, 0x4A, 0xAE, 0xFF, 0xF8, 0x67, 0x4E, 0x70, 0x01, 0x2F, 0x00, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x01, 0x4E, 0xB9, 0x00, 0x00, 0x9F, 0x9E, 
-    0x26, 0x40, 0x20, 0x0B, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x20, 0x0B, 0x72, 0x44, 0xD0, 0x81, 
-    0x60, 0x02, 0x70, 0x00, 0x28, 0x40, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 
-    0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xF8, 0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xD6, 
-    0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x60, 0x10, 0x41, 0xF9, 0xFF, 0xFF, 0xF2, 0xE6, 
-    0x2D, 0x48, 0xFF, 0xF8, 0x49, 0xF9, 0xFF, 0xFF, 0xFF, 0x70, 0x4A, 0xAE, 0xFF, 0xFC, 0x67, 0x50, 
-    0x70, 0x02, 0x2F, 0x00, 0x2F, 0x2E, 0xFF, 0xFC, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x01, 0x4E, 0xB9, 
-    0x00, 0x00, 0xA0, 0xD8, 0x2D, 0x40, 0xFF, 0xBE, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x0A, 0x20, 0x2E, 
-    0xFF, 0xBE, 0x72, 0x44, 0xD0, 0x81, 0x60, 0x02, 0x70, 0x00, 0x26, 0x40, 0x20, 0x6B, 0x00, 0x04, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0x86, 0xC0, 0xA8, 0x00, 0x0C, 0x67, 0x24, 0x2F, 0x2E, 0xFF, 0xFC, 
-    0x48, 0x79, 0xFF, 0xFF, 0xF2, 0xEE, 0x4E, 0xB9, 0x00, 0x00, 0x6D, 0xB0, 0x50, 0x4F, 0x60, 0x10, 
-    0x41, 0xF9, 0xFF, 0xFF, 0xF2, 0xFE, 0x2D, 0x48, 0xFF, 0xFC, 0x47, 0xF9, 0xFF, 0xFF, 0xFF, 0x2E, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x0C, 0x48, 0x6E, 0xFF, 0xC2, 0x4E, 0xB9, 0x00, 0x00, 0x25, 0x1A, 
-    0x41, 0xEE, 0xFF, 0xC2, 0x23, 0xC8, 0xFF, 0xFF, 0xEC, 0x72, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x76, 0x01, 0x4A, 0xAE, 0xFF, 0xF4, 0x66, 0x18, 0x2F, 0x03, 0x70, 0x14, 0x2F, 0x00, 0x4E, 0xB9, 
-    0x00, 0x00, 0x7F, 0xB6, 0x58, 0x8F, 0x26, 0x1F, 0x2D, 0x40, 0xFF, 0xF4, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x1A, 0x2F, 0x2E, 0xFF, 0xF4, 0x4E, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x40, 
-    0xFF, 0xF4, 0x20, 0x40, 0x70, 0x10, 0x21, 0x40, 0x00, 0x10, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x23, 0xEE, 0xFF, 0xF4, 0xFF, 0xFF, 0xF3, 0x08, 0x4E, 0xB9, 0x00, 0x00, 0x6C, 0xA2, 0x41, 0xF9, 
-    0xFF, 0xFF, 0xFF, 0x70, 0xB1, 0xCC, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x24, 0x20, 0x0C, 0x67, 0x1E, 
-    0x70, 0x03, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x04, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x2F, 0x0B, 0x4E, 0xB9, 0x00, 0x00, 0x5A, 0x34, 0x41, 0xF9, 0xFF, 0xFF, 0xFF, 0x2E, 0xB1, 0xCB, 
-    0x58, 0x4F, 0x67, 0x22, 0x20, 0x0B, 0x67, 0x1C, 0x70, 0x03, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x53, 
-    0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x70, 0x00, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x7E, 0x00, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xC2, 
-    0x4E, 0xB9, 0x00, 0x00, 0x25, 0x9A, 0x20, 0x07, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0x88, 0xFE, 0xB2, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6D, 0x61, 0x69, 0x6E, 0x00, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x04, 
-    0x22, 0x2F, 0x00, 0x08, 0x2F, 0x00, 0xC0, 0xC1, 0x20, 0x40, 0x20, 0x01, 0xC2, 0xDF, 0x42, 0x40, 
-    0x48, 0x40, 0x67, 0x02, 0xC0, 0xD7, 0x54, 0x8F, 0xD0, 0x41, 0x48, 0x40, 0x42, 0x40, 0xD0, 0x88, 
-    0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 
-    0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x08, 0x01, 0x4E, 0x75, 0x4E, 0xBA, 
-    0x00, 0x48, 0x20, 0x01, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 0x00, 0x08, 0x41, 0xFA, 
-    0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x06, 0x4C, 0x41, 0x00, 0x01, 
-    0x4E, 0x75, 0x4E, 0xBA, 0x00, 0x74, 0x20, 0x01, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 
-    0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 
-    0x4C, 0x41, 0x08, 0x01, 0xC3, 0x40, 0x4E, 0x75, 0x4A, 0x80, 0x6B, 0x14, 0x4A, 0x81, 0x6B, 0x06, 
-    0x4E, 0xBA, 0x00, 0x46, 0x4E, 0x75, 0x44, 0x81, 0x4E, 0xBA, 0x00, 0x3E, 0x44, 0x81, 0x4E, 0x75, 
-    0x44, 0x80, 0x4A, 0x81, 0x6B, 0x0A, 0x4E, 0xBA, 0x00, 0x30, 0x44, 0x80, 0x44, 0x81, 0x4E, 0x75, 
-    0x44, 0x81, 0x4E, 0xBA, 0x00, 0x24, 0x44, 0x80, 0x4E, 0x75, 0x22, 0x2F, 0x00, 0x04, 0x20, 0x2F, 
-    0x00, 0x08, 0x41, 0xFA, 0x00, 0x0A, 0x32, 0x7C, 0x00, 0x02, 0x4E, 0xF0, 0x92, 0xFE, 0x60, 0x08, 
-    0x4C, 0x41, 0x00, 0x01, 0xC3, 0x40, 0x4E, 0x75, 0x3F, 0x01, 0x48, 0x41, 0x4A, 0x41, 0x66, 0x1C, 
-    0x22, 0x00, 0x42, 0x41, 0x48, 0x41, 0x67, 0x0A, 0x82, 0xD7, 0x48, 0x41, 0x48, 0x40, 0x30, 0x01, 
-    0x48, 0x40, 0x80, 0xDF, 0x32, 0x00, 0x42, 0x40, 0x48, 0x40, 0x4E, 0x75, 0x48, 0x41, 0x3E, 0x82, 
-    0x2F, 0x03, 0x34, 0x00, 0x26, 0x01, 0x72, 0x01, 0x42, 0x40, 0x48, 0x40, 0x66, 0x0C, 0x48, 0x40, 
-    0x30, 0x02, 0x72, 0x00, 0x60, 0x16, 0xD2, 0x41, 0x65, 0x12, 0xD4, 0x42, 0xD1, 0x80, 0xB0, 0x83, 
-    0x65, 0xF4, 0x90, 0x83, 0xD2, 0x41, 0x08, 0xC1, 0x00, 0x00, 0x64, 0xEE, 0x26, 0x1F, 0x34, 0x1F, 
-    0x4E, 0x75, 0x22, 0x5F, 0x20, 0x57, 0x48, 0xD0, 0xDE, 0xFC, 0x70, 0x00, 0x4E, 0xD1, 0x20, 0x2F, 
-    0x00, 0x08, 0x66, 0x02, 0x70, 0x01, 0x20, 0x6F, 0x00, 0x04, 0x4C, 0xD0, 0xDE, 0xFC, 0x4E, 0xD1, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 0x2C, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xFA, 0x42, 
-    0x66, 0x08, 0x41, 0xED, 0xF9, 0xE4, 0x2B, 0x48, 0xFA, 0x42, 0x20, 0x6D, 0xFA, 0x42, 0x42, 0x68, 
-    0x00, 0x02, 0x7E, 0x01, 0x60, 0x04, 0xE2, 0x86, 0x52, 0x87, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xF6, 
-    0x20, 0x07, 0xE1, 0x48, 0x48, 0x40, 0x42, 0x40, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0xEE, 0x58, 0x4F, 
-    0x4C, 0xEE, 0x00, 0xC0, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x69, 0x67, 0x5F, 0x64, 
-    0x66, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x4A, 0x6D, 0xFA, 0x2A, 
-    0x66, 0x00, 0x00, 0xBC, 0x59, 0x8F, 0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 0x00, 0xC8, 
-    0xA8, 0x20, 0x28, 0x5F, 0x20, 0x0C, 0x67, 0x00, 0x00, 0xA6, 0x55, 0x8F, 0xA9, 0x94, 0x55, 0x8F, 
-    0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 0x66, 0x00, 0x00, 0x94, 0x41, 0xED, 0x01, 0x4A, 
-    0x22, 0x6D, 0xFA, 0x46, 0x23, 0x48, 0x00, 0x0C, 0x26, 0x54, 0x30, 0x13, 0x08, 0x00, 0x00, 0x00, 
-    0x67, 0x08, 0x3B, 0x7C, 0x00, 0x28, 0xFA, 0x28, 0x60, 0x06, 0x3B, 0x7C, 0x00, 0x04, 0xFA, 0x28, 
-    0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x84, 0x30, 0x2D, 0xFA, 0x28, 0x48, 0xC0, 0x22, 0x1F, 
-    0x92, 0x80, 0x20, 0x01, 0x72, 0x04, 0x4E, 0xBA, 0xFE, 0x12, 0x2C, 0x00, 0x70, 0x00, 0x26, 0x40, 
-    0x60, 0x36, 0x2F, 0x0C, 0xA9, 0xA2, 0x30, 0x2D, 0xFA, 0x28, 0x48, 0xC0, 0xD0, 0x94, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x30, 0x2D, 0xFA, 0x2A, 0x48, 0xC0, 0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x80, 0x30, 0x30, 
-    0x08, 0x00, 0x48, 0xC0, 0x2E, 0x00, 0x67, 0x08, 0x20, 0x0D, 0x26, 0x40, 0xD7, 0xC7, 0x4E, 0x93, 
-    0x30, 0x2D, 0xFA, 0x2A, 0x52, 0x6D, 0xFA, 0x2A, 0x30, 0x2D, 0xFA, 0x2A, 0x48, 0xC0, 0xBC, 0x80, 
-    0x6E, 0xC0, 0x20, 0x0B, 0x67, 0x04, 0x2F, 0x0B, 0xA9, 0xF1, 0x2F, 0x0C, 0xA9, 0xA3, 0x4C, 0xEE, 
-    0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x5F, 0x43, 0x70, 0x6C, 0x75, 0x73, 
-    0x49, 0x6E, 0x69, 0x74, 0x00, 0x2A, 0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 
-    0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 0x73, 0x74, 
-    0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x01, 0x18, 0x4A, 0x6D, 0xFA, 0x2A, 0x67, 0x64, 0x59, 0x8F, 
-    0x2F, 0x3C, 0x43, 0x4F, 0x44, 0x45, 0x48, 0x7A, 0x00, 0x70, 0xA9, 0xA1, 0x28, 0x5F, 0x20, 0x0C, 
-    0x67, 0x50, 0x55, 0x8F, 0xA9, 0x94, 0x55, 0x8F, 0x2F, 0x0C, 0xA9, 0xA4, 0x30, 0x1F, 0xB0, 0x5F, 
-    0x66, 0x40, 0x60, 0x34, 0x2F, 0x0C, 0xA9, 0xA2, 0x30, 0x2D, 0xFA, 0x28, 0x48, 0xC0, 0xD0, 0x94, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x53, 0x6D, 0xFA, 0x2A, 0x30, 0x2D, 0xFA, 0x2A, 0x48, 0xC0, 0x20, 0x6E, 
-    0xFF, 0xFC, 0xE5, 0x80, 0x30, 0x30, 0x08, 0x02, 0x48, 0xC0, 0x2E, 0x00, 0x20, 0x0D, 0x26, 0x40, 
-    0xD7, 0xC7, 0x4A, 0x87, 0x67, 0x02, 0x4E, 0x93, 0x4A, 0x6D, 0xFA, 0x2A, 0x6E, 0xC6, 0x2F, 0x0C, 
-    0xA9, 0xA3, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x64, 0x74, 0x6F, 
-    0x72, 0x73, 0x5F, 0x5F, 0x46, 0x76, 0x00, 0x2A, 0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 
-    0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 
-    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x73, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x13, 0x38, 0x2E, 0x2E, 0x00, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x4E, 0xAD, 0x03, 0xB2, 0x4A, 0x80, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xC8, 
-    0x20, 0x6D, 0xFA, 0x46, 0x20, 0xAE, 0x00, 0x08, 0x76, 0x01, 0x4A, 0xB8, 0x03, 0x16, 0x67, 0x2C, 
-    0x70, 0x01, 0xC0, 0xB8, 0x03, 0x16, 0x66, 0x24, 0x20, 0x78, 0x03, 0x16, 0x0C, 0x90, 0x4D, 0x50, 
-    0x47, 0x4D, 0x66, 0x18, 0x20, 0x78, 0x03, 0x16, 0x4A, 0xA8, 0x00, 0x04, 0x67, 0x0E, 0x20, 0x78, 
-    0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x4A, 0x50, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 
-    0x2B, 0x43, 0xFA, 0x2C, 0x67, 0x60, 0x41, 0xED, 0xFB, 0x00, 0x43, 0xF8, 0x09, 0x10, 0x70, 0x07, 
-    0x20, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x30, 0xD9, 0x41, 0xED, 0xFB, 0x00, 0x22, 0x6D, 0xFA, 0x36, 
-    0x22, 0x88, 0x4A, 0x87, 0x66, 0x0E, 0x59, 0x8F, 0x20, 0x6D, 0xFA, 0x36, 0x2F, 0x10, 0x4E, 0xBA, 
-    0x02, 0xDE, 0x58, 0x4F, 0x20, 0x0B, 0x67, 0x04, 0x70, 0x01, 0x26, 0x80, 0x4A, 0xAE, 0x00, 0x10, 
-    0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0xAD, 0xFA, 0x36, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x08, 
-    0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 0xFA, 0x3A, 0x4E, 0xBA, 0xFD, 0x8A, 0x70, 0x01, 0x2B, 0x40, 
-    0xFA, 0x2C, 0x60, 0x00, 0x01, 0x22, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 0x30, 0x2D, 
-    0xFA, 0x30, 0xB0, 0x50, 0x67, 0x0C, 0x2F, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x4E, 0xBA, 0x01, 0x3C, 
-    0x58, 0x4F, 0x41, 0xED, 0xFA, 0x30, 0x22, 0x78, 0x03, 0x16, 0x22, 0x69, 0x00, 0x04, 0x23, 0x48, 
-    0x00, 0x24, 0x20, 0x78, 0x03, 0x16, 0x2B, 0x68, 0x00, 0x04, 0xFA, 0x54, 0x20, 0x78, 0x03, 0x16, 
-    0x20, 0x68, 0x00, 0x04, 0x2B, 0x68, 0x00, 0x02, 0xFA, 0x32, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 
-    0x00, 0x04, 0x2B, 0x68, 0x00, 0x06, 0xFA, 0x36, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 0x00, 0x04, 
-    0x2B, 0x68, 0x00, 0x0A, 0xFA, 0x3A, 0x4A, 0x87, 0x67, 0x2C, 0x28, 0x6D, 0xFA, 0x36, 0x60, 0x0C, 
-    0x59, 0x8F, 0x2F, 0x14, 0x4E, 0xBA, 0x02, 0x02, 0x58, 0x4F, 0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 
-    0x28, 0x6D, 0xFA, 0x3A, 0x60, 0x0C, 0x59, 0x8F, 0x2F, 0x14, 0x4E, 0xBA, 0x01, 0xEC, 0x58, 0x4F, 
-    0x58, 0x4C, 0x4A, 0x94, 0x66, 0xF0, 0x20, 0x0B, 0x67, 0x04, 0x26, 0xAD, 0xFA, 0x32, 0x4A, 0xAE, 
-    0x00, 0x10, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x10, 0x20, 0xAD, 0xFA, 0x36, 0x4A, 0xAE, 0x00, 0x14, 
-    0x67, 0x08, 0x20, 0x6E, 0x00, 0x14, 0x20, 0xAD, 0xFA, 0x3A, 0x20, 0x78, 0x03, 0x16, 0x20, 0x68, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x20, 0x67, 0x54, 0x70, 0x78, 0xA1, 0x1E, 0x2B, 0x48, 0xFA, 0x50, 
-    0x66, 0x0A, 0x70, 0x02, 0x2F, 0x00, 0x4E, 0xBA, 0x00, 0x82, 0x58, 0x4F, 0x20, 0x78, 0x03, 0x16, 
-    0x20, 0x68, 0x00, 0x04, 0x26, 0x68, 0x00, 0x20, 0x7E, 0x00, 0x76, 0x05, 0x22, 0x07, 0x20, 0x01, 
-    0xC2, 0xFC, 0x00, 0x18, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x18, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 
-    0x2C, 0x01, 0x20, 0x6D, 0xFA, 0x50, 0x43, 0xF3, 0x68, 0x00, 0x45, 0xF0, 0x68, 0x00, 0x70, 0x05, 
-    0x24, 0xD9, 0x51, 0xC8, 0xFF, 0xFC, 0x52, 0x87, 0xB6, 0x87, 0x6E, 0xD0, 0x4E, 0xBA, 0xFC, 0x66, 
-    0x70, 0x00, 0x2B, 0x40, 0xFA, 0x2C, 0x4C, 0xEE, 0x1C, 0xC8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x52, 0x54, 0x49, 0x6E, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x3C, 
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xAE, 0x00, 0x08, 0x2F, 0x00, 0x4E, 0xBA, 0x00, 0x0E, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x84, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x20, 0x6D, 0xFA, 0x46, 0x49, 0xE8, 0x00, 0x8C, 0x60, 0x0A, 0x4A, 0x94, 0x67, 0x04, 0x20, 0x54, 
-    0x4E, 0x90, 0x59, 0x4C, 0x20, 0x6D, 0xFA, 0x46, 0xB1, 0xCC, 0x65, 0xEE, 0x4A, 0xAD, 0xFA, 0x54, 
-    0x67, 0x0A, 0x20, 0x6D, 0xFA, 0x54, 0x21, 0x6E, 0x00, 0x08, 0x00, 0x0E, 0x4A, 0xAD, 0xFB, 0x3A, 
-    0x66, 0x0A, 0x20, 0x6D, 0xFA, 0x46, 0x22, 0x50, 0x4E, 0x91, 0x60, 0x0E, 0x70, 0x01, 0x2F, 0x00, 
-    0x48, 0x6D, 0xFB, 0x22, 0x4E, 0xBA, 0xFB, 0x78, 0x50, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x52, 0x54, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x20, 0x57, 0x42, 0xA7, 
-    0x48, 0x6D, 0xFB, 0x5A, 0x48, 0x6D, 0xFB, 0x56, 0x48, 0x6D, 0xFB, 0x52, 0x2F, 0x08, 0x4E, 0xBA, 
-    0xFD, 0x72, 0x72, 0xFF, 0xB0, 0x41, 0x67, 0x2E, 0x58, 0x8F, 0x4F, 0xEF, 0x00, 0x10, 0x48, 0x6D, 
-    0xFB, 0x22, 0x4E, 0xBA, 0xFB, 0x2E, 0x58, 0x4F, 0x4A, 0x80, 0x66, 0x24, 0x2F, 0x2D, 0xFB, 0x5A, 
-    0x2F, 0x2D, 0xFB, 0x56, 0x2F, 0x2D, 0xFB, 0x52, 0x4E, 0xBA, 0xF7, 0x48, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x36, 0x48, 0x7A, 0x00, 0x0A, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 
-    0x4E, 0x75, 0x1B, 0x44, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 
-    0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x21, 0x20, 0x2F, 
-    0x00, 0x04, 0x67, 0x1C, 0x20, 0x40, 0x22, 0x40, 0x34, 0x3C, 0x00, 0xFF, 0x12, 0x10, 0x10, 0xC0, 
-    0x10, 0x01, 0x57, 0xCA, 0xFF, 0xF8, 0x22, 0x08, 0x20, 0x09, 0x92, 0x80, 0x53, 0x01, 0x12, 0x81, 
-    0x4E, 0x75, 0x86, 0x63, 0x32, 0x70, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x22, 0x5F, 0x20, 0x5F, 
-    0xA0, 0x21, 0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 0x22, 0x5F, 0x20, 0x5F, 0xA0, 0x25, 
-    0x2E, 0x80, 0x6A, 0x02, 0x42, 0x97, 0x4E, 0xD1, 0x20, 0x2F, 0x00, 0x04, 0x2F, 0x40, 0x00, 0x08, 
-    0x67, 0x26, 0x20, 0x40, 0x22, 0x48, 0x10, 0x19, 0x67, 0x1E, 0x12, 0x11, 0x12, 0xC0, 0x10, 0x01, 
-    0x66, 0xF8, 0x93, 0xC8, 0x20, 0x09, 0x53, 0x40, 0x0C, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 
-    0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x80, 0x22, 0x5F, 0x58, 0x4F, 0x4E, 0xD1, 0x22, 0x5F, 
-    0x20, 0x1F, 0x2E, 0x80, 0x67, 0x12, 0x20, 0x40, 0x70, 0x00, 0x10, 0x10, 0x60, 0x04, 0x10, 0xE8, 
-    0x00, 0x01, 0x51, 0xC8, 0xFF, 0xFA, 0x42, 0x10, 0x4E, 0xD1, 0x4E, 0x56, 0x00, 0x00, 0x4A, 0xAD, 
-    0xFD, 0x46, 0x66, 0x04, 0x4E, 0xBA, 0x04, 0x68, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 
-    0x2F, 0x2D, 0xFD, 0x46, 0x4E, 0xBA, 0x00, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x5F, 0x5F, 0x69, 
-    0x6E, 0x73, 0x65, 0x72, 0x74, 0x5F, 0x6E, 0x65, 0x77, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 
-    0x5F, 0x46, 0x50, 0x76, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 
-    0x2F, 0x2D, 0xFD, 0x46, 0x4E, 0xBA, 0x02, 0x54, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 0x5F, 0x72, 
-    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x6F, 0x6C, 0x64, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 
-    0x5F, 0x46, 0x50, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 
-    0x00, 0x08, 0x20, 0x0B, 0x66, 0x2A, 0x4A, 0xAD, 0xFD, 0x4A, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0E, 
-    0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x7E, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x28, 0x6D, 0xFD, 0x4A, 0x20, 0x4C, 0x2B, 0x50, 0xFD, 0x4A, 0x26, 0x4C, 0x20, 0x0B, 0x67, 0x2A, 
-    0x49, 0xD3, 0x7E, 0x20, 0x60, 0x16, 0x2D, 0x4C, 0xFF, 0xFC, 0x50, 0x4C, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x70, 0x00, 0x21, 0x40, 0x00, 0x04, 0x20, 0x6E, 0xFF, 0xFC, 0x20, 0x80, 0x20, 0x07, 0x53, 0x87, 
-    0x4A, 0x80, 0x66, 0xE2, 0x70, 0x00, 0x27, 0x40, 0x01, 0x00, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x88, 
-    0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x39, 0x5F, 
-    0x5F, 0x70, 0x6E, 0x64, 0x5F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x5F, 0x6E, 0x6F, 
-    0x64, 0x65, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE4, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x6E, 
-    0x00, 0x0C, 0x28, 0x2E, 0x00, 0x10, 0x7C, 0x1F, 0x20, 0x0C, 0x7A, 0x03, 0xCA, 0x80, 0x4A, 0x85, 
-    0x67, 0x0A, 0x70, 0x0E, 0xE1, 0x6D, 0x48, 0x45, 0x42, 0x45, 0x4A, 0x85, 0x20, 0x0C, 0xE4, 0x88, 
-    0x8A, 0x80, 0x70, 0x00, 0x28, 0x40, 0x76, 0x01, 0x22, 0x0C, 0x66, 0x3C, 0x2D, 0x43, 0xFF, 0xE4, 
-    0x4A, 0xAD, 0xFD, 0x4E, 0x57, 0xC3, 0x44, 0x03, 0x20, 0x03, 0x26, 0x2E, 0xFF, 0xE4, 0x4A, 0x00, 
-    0x67, 0x12, 0x2F, 0x03, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x03, 0x50, 0x58, 0x8F, 0x26, 0x1F, 
-    0x4A, 0x80, 0x60, 0x02, 0x70, 0x00, 0x26, 0x6D, 0xFD, 0x4E, 0x20, 0x4B, 0x2B, 0x50, 0xFD, 0x4E, 
-    0x28, 0x4B, 0x20, 0x0C, 0x66, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x28, 0x85, 0x29, 0x44, 
-    0x00, 0x04, 0x20, 0x04, 0x60, 0x02, 0x70, 0x00, 0x2D, 0x4C, 0xFF, 0xF0, 0x7E, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x49, 0xD0, 0x70, 0x00, 0x26, 0x40, 0x4A, 0x94, 0x67, 0x50, 0x4A, 0xAC, 0x00, 0x04, 
-    0x67, 0x36, 0x20, 0x54, 0xBA, 0x90, 0x66, 0x44, 0x21, 0x44, 0x00, 0x04, 0x4A, 0xAE, 0xFF, 0xF0, 
-    0x67, 0x20, 0x4A, 0xAE, 0xFF, 0xF0, 0x67, 0x12, 0x20, 0x6E, 0xFF, 0xF0, 0x20, 0xAD, 0xFD, 0x4E, 
-    0x2B, 0x6E, 0xFF, 0xF0, 0xFD, 0x4E, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 
-    0x00, 0xBA, 0x70, 0x00, 0x60, 0x00, 0x00, 0xB4, 0x26, 0x54, 0x20, 0x06, 0xC0, 0x85, 0xEE, 0xA8, 
-    0xE7, 0x80, 0x49, 0xF3, 0x08, 0x00, 0xEB, 0x8E, 0x5A, 0x87, 0x60, 0xAC, 0x4A, 0x94, 0x66, 0x18, 
-    0x70, 0x01, 0x29, 0x40, 0x00, 0x04, 0x28, 0xAE, 0xFF, 0xF0, 0x22, 0x0B, 0x67, 0x00, 0x00, 0x8C, 
-    0x52, 0xAB, 0x01, 0x00, 0x60, 0x00, 0x00, 0x84, 0x20, 0x54, 0x2D, 0x48, 0xFF, 0xF4, 0x2D, 0x50, 
-    0xFF, 0xF8, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0x5E, 0x26, 0x40, 0x2D, 0x4B, 0xFF, 0xE8, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x28, 0xAE, 0xFF, 0xE8, 0x2D, 0x46, 0xFF, 0xEC, 0x22, 0x06, 
-    0xC2, 0xAE, 0xFF, 0xF8, 0x28, 0x01, 0xEE, 0xAC, 0x22, 0x2E, 0xFF, 0xEC, 0xC2, 0x85, 0xEE, 0xA9, 
-    0x2D, 0x41, 0xFF, 0xFC, 0xB8, 0xAE, 0xFF, 0xFC, 0x58, 0x4F, 0x66, 0x14, 0x70, 0x01, 0x27, 0x40, 
-    0x01, 0x00, 0x22, 0x04, 0xE7, 0x81, 0x49, 0xF3, 0x18, 0x00, 0xEB, 0x8E, 0x5A, 0x87, 0x60, 0xB2, 
-    0x20, 0x04, 0xE7, 0x80, 0x49, 0xF3, 0x08, 0x00, 0x70, 0x01, 0x29, 0x40, 0x00, 0x04, 0x28, 0xAE, 
-    0xFF, 0xF4, 0x22, 0x2E, 0xFF, 0xFC, 0xE7, 0x81, 0x49, 0xF3, 0x18, 0x00, 0x29, 0x40, 0x00, 0x04, 
-    0x28, 0xAE, 0xFF, 0xF0, 0x72, 0x02, 0x27, 0x41, 0x01, 0x00, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xC8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x5F, 0x5F, 0x35, 0x5F, 0x5F, 
-    0x70, 0x6E, 0x64, 0x46, 0x50, 0x76, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xD8, 0x48, 0xE7, 
-    0x1F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x20, 0x0B, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x5A, 
-    0x7A, 0x1F, 0x20, 0x0B, 0x7E, 0x03, 0xCE, 0x80, 0x4A, 0x87, 0x67, 0x0A, 0x70, 0x0E, 0xE1, 0x6F, 
-    0x48, 0x47, 0x42, 0x47, 0x4A, 0x87, 0x20, 0x0B, 0xE4, 0x88, 0x8E, 0x80, 0x7C, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x47, 0xD0, 0x70, 0x00, 0x28, 0x40, 0x78, 0xFF, 0x4A, 0x93, 0x66, 0x06, 0x70, 0xFF, 
-    0x60, 0x00, 0x01, 0x26, 0x4A, 0xAB, 0x00, 0x04, 0x67, 0x0C, 0x20, 0x53, 0xBE, 0x90, 0x67, 0x24, 
-    0x70, 0xFF, 0x60, 0x00, 0x01, 0x14, 0x28, 0x53, 0x20, 0x05, 0xC0, 0x87, 0xEC, 0xA8, 0xE7, 0x80, 
-    0x47, 0xF4, 0x08, 0x00, 0x52, 0x84, 0x20, 0x04, 0xE5, 0x40, 0x2D, 0x8B, 0x00, 0xD8, 0xEB, 0x8D, 
-    0x5A, 0x86, 0x60, 0xC6, 0x20, 0x53, 0x2D, 0x48, 0xFF, 0xF4, 0x2A, 0x28, 0x00, 0x04, 0x4A, 0xAE, 
-    0xFF, 0xF4, 0x67, 0x1A, 0x4A, 0xAE, 0xFF, 0xF4, 0x67, 0x0E, 0x20, 0xAD, 0xFD, 0x4E, 0x2B, 0x6E, 
-    0xFF, 0xF4, 0xFD, 0x4E, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0x00, 0x27, 0x40, 0x00, 0x04, 0x26, 0x80, 0x72, 0xFF, 0xB2, 0x84, 0x67, 0x0C, 0x53, 0xAC, 
-    0x01, 0x00, 0x70, 0x01, 0xB0, 0xAC, 0x01, 0x00, 0x6C, 0x06, 0x20, 0x05, 0x60, 0x00, 0x00, 0xAA, 
-    0x2D, 0x4C, 0xFF, 0xF8, 0x60, 0x08, 0x20, 0x2E, 0xFF, 0xF8, 0x50, 0xAE, 0xFF, 0xF8, 0x20, 0x6E, 
-    0xFF, 0xF8, 0x4A, 0x90, 0x67, 0xF0, 0xB7, 0xEE, 0xFF, 0xF8, 0x67, 0xEA, 0x4A, 0xA8, 0x00, 0x04, 
-    0x66, 0x06, 0x20, 0x05, 0x60, 0x00, 0x00, 0x82, 0x20, 0x6E, 0xFF, 0xF8, 0x2D, 0x50, 0xFF, 0xFC, 
-    0x20, 0x0C, 0x67, 0x16, 0x20, 0x0C, 0x67, 0x0C, 0x28, 0xAD, 0xFD, 0x4A, 0x2B, 0x4C, 0xFD, 0x4A, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x20, 0x04, 0x53, 0x84, 
-    0x4A, 0x80, 0x66, 0x14, 0x20, 0x6E, 0x00, 0x08, 0x47, 0xD0, 0x70, 0x01, 0x27, 0x40, 0x00, 0x04, 
-    0x26, 0xAE, 0xFF, 0xFC, 0x20, 0x05, 0x60, 0x40, 0x4A, 0x84, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 
-    0x20, 0x6E, 0x00, 0x08, 0x20, 0x50, 0x60, 0x0A, 0x20, 0x04, 0xE5, 0x40, 0x20, 0x76, 0x00, 0xD4, 
-    0x20, 0x50, 0x28, 0x48, 0x70, 0x01, 0xB0, 0xAC, 0x01, 0x00, 0x6C, 0xA4, 0x20, 0x04, 0xE5, 0x40, 
-    0x20, 0x76, 0x00, 0xD8, 0x70, 0x01, 0x21, 0x40, 0x00, 0x04, 0x22, 0x04, 0xE5, 0x41, 0x20, 0x76, 
-    0x10, 0xD8, 0x20, 0xAE, 0xFF, 0xFC, 0x20, 0x05, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xBC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x91, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x5F, 0x35, 0x5F, 0x5F, 0x70, 0x6E, 
-    0x64, 0x46, 0x50, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x08, 0x2F, 0x00, 0x4E, 0xBA, 0x01, 0x58, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x67, 0x0A, 0x47, 0xD4, 0x70, 0x00, 0x27, 0x40, 0x00, 0x04, 0x26, 0x80, 
-    0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x35, 0x5F, 0x5F, 0x70, 0x6E, 0x64, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0xAE, 0x2B, 0x40, 0xFD, 0x46, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x95, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x5F, 0x5F, 0x35, 
-    0x5F, 0x5F, 0x70, 0x6E, 0x64, 0x53, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x18, 0x4A, 0xAE, 0x00, 0x08, 0x66, 0x10, 0x48, 0x78, 0x04, 0xB0, 0x4E, 0xBA, 0x00, 0xE6, 
-    0x2D, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x67, 0x24, 0x2E, 0x3C, 0x00, 0x00, 0x00, 0x96, 0x20, 0x6E, 
-    0x00, 0x08, 0x49, 0xD0, 0x60, 0x06, 0x26, 0x4C, 0x50, 0x4C, 0x26, 0x8C, 0x53, 0x87, 0x66, 0xF6, 
-    0x28, 0xAD, 0xFD, 0x4E, 0x20, 0x6E, 0x00, 0x08, 0x2B, 0x48, 0xFD, 0x4E, 0x20, 0x2E, 0x00, 0x08, 
-    0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 
-    0x5F, 0x31, 0x33, 0x5F, 0x5F, 0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x5F, 0x50, 0x6F, 0x6F, 0x6C, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x4A, 0xAE, 0x00, 0x08, 
-    0x66, 0x10, 0x48, 0x78, 0x0A, 0x28, 0x4E, 0xBA, 0x00, 0x7C, 0x2D, 0x40, 0x00, 0x08, 0x58, 0x4F, 
-    0x67, 0x22, 0x7E, 0x0A, 0x20, 0x6E, 0x00, 0x08, 0x49, 0xD0, 0x60, 0x08, 0x26, 0x4C, 0x49, 0xEC, 
-    0x01, 0x04, 0x26, 0x8C, 0x53, 0x87, 0x66, 0xF4, 0x28, 0xAD, 0xFD, 0x4A, 0x20, 0x6E, 0x00, 0x08, 
-    0x2B, 0x48, 0xFD, 0x4A, 0x20, 0x2E, 0x00, 0x08, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x95, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x5F, 0x5F, 0x4E, 0x6F, 0x64, 
-    0x65, 0x5F, 0x50, 0x6F, 0x6F, 0x6C, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x03, 0xE2, 0x58, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x64, 0x6C, 0x5F, 0x5F, 0x46, 
-    0x50, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x08, 
-    0x60, 0x16, 0x4A, 0xAD, 0xFD, 0x52, 0x67, 0x0C, 0x4A, 0x87, 0x67, 0x08, 0x20, 0x6D, 0xFD, 0x52, 
-    0x4E, 0x90, 0x60, 0x04, 0x70, 0x00, 0x60, 0x14, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xAD, 
-    0x03, 0xBA, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x67, 0xD8, 0x20, 0x0C, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x46, 0x55, 0x69, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x2E, 0x2E, 
-    0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x66, 0x34, 0x20, 0x06, 0x22, 0x07, 0x4E, 0xBA, 0xF3, 0x16, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x90, 0x2D, 0x40, 0x00, 0x08, 0x58, 0x4F, 0x67, 0x1E, 0x4A, 0xAD, 
-    0xFD, 0x5A, 0x67, 0x0E, 0x2F, 0x2D, 0xFD, 0x56, 0x2F, 0x2D, 0xFD, 0x5A, 0x4E, 0xBA, 0xF9, 0xDC, 
-    0x50, 0x4F, 0x2B, 0x6E, 0x00, 0x08, 0xFD, 0x5A, 0x2B, 0x46, 0xFD, 0x56, 0x4A, 0xAE, 0x00, 0x08, 
-    0x67, 0x40, 0x4A, 0xAE, 0x00, 0x14, 0x67, 0x3A, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x06, 0x22, 0x07, 
-    0x4E, 0xBA, 0xF2, 0xD2, 0xD0, 0x8C, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x6E, 0x00, 0x14, 0x60, 0x1C, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0x93, 0xD9, 0xC7, 0x4F, 0xEF, 0x00, 0x24, 0xB9, 0xEE, 0xFF, 0xFC, 
-    0x65, 0xDE, 0x20, 0x2E, 0x00, 0x08, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x93, 0x5F, 0x5F, 0x76, 0x65, 0x63, 0x5F, 0x6E, 0x65, 0x77, 0x5F, 0x5F, 0x46, 0x50, 0x76, 0x69, 
-    0x54, 0x32, 0x54, 0x31, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x2A, 0x2E, 
-    0x00, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x74, 
-    0x4A, 0xAE, 0x00, 0x14, 0x67, 0x60, 0x4A, 0x85, 0x67, 0x30, 0x20, 0x2D, 0xFD, 0x5A, 0xB0, 0xAE, 
-    0x00, 0x08, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0C, 0x70, 0x00, 0x2B, 0x40, 0xFD, 0x5A, 0x22, 0x2D, 
-    0xFD, 0x56, 0x60, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xF9, 0x5E, 0x22, 0x00, 0x58, 0x4F, 
-    0x28, 0x01, 0x70, 0xFF, 0xB0, 0x86, 0x66, 0x02, 0x2C, 0x04, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x4B, 
-    0x2D, 0x6E, 0x00, 0x14, 0xFF, 0xFC, 0x20, 0x06, 0x22, 0x07, 0x4E, 0xBA, 0xF2, 0x18, 0xD9, 0xC0, 
-    0x60, 0x10, 0x99, 0xC7, 0x70, 0x02, 0x2F, 0x00, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0xFC, 0x4E, 0x90, 
-    0x50, 0x4F, 0xB7, 0xCC, 0x65, 0xEC, 0x4A, 0x85, 0x67, 0x0A, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 
-    0xFE, 0x4A, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x99, 0x5F, 
-    0x5F, 0x76, 0x65, 0x63, 0x5F, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x5F, 0x5F, 0x46, 0x50, 0x76, 
-    0x69, 0x54, 0x32, 0x54, 0x31, 0x4E, 0x32, 0x32, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x2E, 
-    0x00, 0x0C, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x5F, 0x6E, 0x77, 0x5F, 0x5F, 0x46, 0x55, 0x69, 
-    0x50, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x20, 0x6B, 0x00, 0x08, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 
-    0x54, 0xC3, 0x44, 0x03, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x14, 
-    0x20, 0x6C, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 
-    0x10, 0x01, 0x4A, 0x80, 0x2E, 0x00, 0x60, 0x34, 0x52, 0xAC, 0x00, 0x14, 0x20, 0x2C, 0x00, 0x14, 
-    0xB0, 0xAC, 0x00, 0x18, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x34, 0xCE, 
-    0x4A, 0x80, 0x58, 0x4F, 0x60, 0x14, 0x20, 0x6C, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x2E, 0x00, 0x20, 0x6D, 0xFB, 0x5E, 
-    0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 0x66, 0xC0, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x24, 0x20, 0x6B, 
-    0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x08, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x10, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x65, 0x61, 0x74, 
-    0x77, 0x68, 0x69, 0x74, 0x65, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x6C, 0x00, 0x08, 0x26, 0x68, 0x00, 0x08, 0x20, 0x3C, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0xA8, 
-    0x00, 0x10, 0x67, 0x10, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0x36, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x67, 0x00, 0x00, 0x8E, 0x70, 0x00, 0x28, 0x80, 0x76, 0x00, 
-    0x22, 0x2B, 0x00, 0x14, 0xB2, 0xAB, 0x00, 0x18, 0x65, 0x22, 0x2F, 0x03, 0x20, 0x4B, 0x22, 0x6B, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 
-    0x58, 0x8F, 0x26, 0x1F, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x18, 0x20, 0x6B, 0x00, 0x14, 0x52, 0xAB, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 
-    0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x48, 0xC0, 0x2E, 0x00, 
-    0x70, 0xFF, 0xB0, 0x87, 0x66, 0x26, 0x20, 0x6C, 0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 
-    0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x60, 0x0A, 0x70, 0x01, 0x28, 0x80, 
-    0x20, 0x6E, 0x00, 0x0C, 0x10, 0x87, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x78, 0x67, 0x65, 0x74, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 
-    0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x1E, 0x2E, 0x00, 0x0F, 
-    0x26, 0x6E, 0x00, 0x08, 0x20, 0x6B, 0x00, 0x08, 0x4A, 0xA8, 0x00, 0x0C, 0x67, 0x06, 0x20, 0x0B, 
-    0x60, 0x00, 0x00, 0x96, 0x20, 0x6B, 0x00, 0x08, 0x28, 0x68, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x14, 
-    0xB0, 0xAC, 0x00, 0x1C, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x34, 0x53, 0xAC, 0x00, 0x14, 0x20, 0x6C, 
-    0x00, 0x14, 0xBE, 0x10, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x48, 0x87, 0x30, 0x3C, 0x00, 0xFF, 
-    0xC0, 0x07, 0x60, 0x12, 0x20, 0x6C, 0x00, 0x14, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x10, 0x01, 0x72, 0x00, 0x12, 0x00, 0x4A, 0x81, 0x60, 0x1E, 0x48, 0x87, 
-    0x48, 0xC7, 0x2F, 0x07, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x20, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x24, 0x4E, 0x91, 0x22, 0x00, 0x50, 0x4F, 0x70, 0xFF, 0xB0, 0x81, 
-    0x66, 0x24, 0x20, 0x6B, 0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6B, 
-    0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x08, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x93, 0x70, 0x75, 0x74, 0x62, 0x61, 0x63, 0x6B, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x46, 0x63, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x3C, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0xA8, 
-    0x00, 0x10, 0x67, 0x10, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x12, 0x86, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x67, 0x00, 0x00, 0x88, 0x20, 0x6C, 0x00, 0x08, 0x26, 0x68, 
-    0x00, 0x08, 0x20, 0x2B, 0x00, 0x14, 0xB0, 0xAB, 0x00, 0x18, 0x55, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x20, 0x2B, 0x00, 0x18, 0x90, 0xAB, 0x00, 0x14, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x80, 0x67, 0x60, 
-    0x70, 0x01, 0x28, 0x80, 0x20, 0x6C, 0x00, 0x08, 0x26, 0x68, 0x00, 0x08, 0x76, 0x00, 0x22, 0x2B, 
-    0x00, 0x14, 0xB2, 0xAB, 0x00, 0x18, 0x65, 0x22, 0x2F, 0x03, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x58, 0x8F, 
-    0x26, 0x1F, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x04, 0x70, 0xFF, 
-    0x60, 0x16, 0x20, 0x6B, 0x00, 0x14, 0x52, 0xAB, 0x00, 0x14, 0x10, 0x10, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x48, 0x81, 0x30, 0x01, 0x20, 0x6E, 0x00, 0x0C, 0x10, 0x80, 0x60, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x8C, 0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6D, 
-    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x46, 0x52, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x07, 0x18, 
-    0x47, 0xED, 0xFD, 0x72, 0x2E, 0x2E, 0x00, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x4A, 0x87, 0x6D, 0x44, 
-    0x20, 0x07, 0x72, 0x64, 0x4E, 0xBA, 0xEE, 0x34, 0x2A, 0x00, 0x22, 0x05, 0x20, 0x01, 0xC2, 0xFC, 
-    0x00, 0x64, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x64, 0x48, 0x40, 0x42, 0x40, 0xD2, 0x80, 0x2C, 0x07, 
-    0x9C, 0x81, 0x41, 0xED, 0xFD, 0xD6, 0x22, 0x4C, 0x53, 0x4C, 0x12, 0xB0, 0x60, 0x00, 0x20, 0x4C, 
-    0x53, 0x4C, 0x10, 0xB3, 0x60, 0x00, 0x2E, 0x05, 0x6E, 0xC6, 0x70, 0x0A, 0xB0, 0x86, 0x6F, 0x46, 
-    0x52, 0x4C, 0x60, 0x42, 0x20, 0x07, 0x72, 0x64, 0x4E, 0xBA, 0xED, 0xF0, 0x2A, 0x00, 0x22, 0x05, 
-    0x20, 0x01, 0xC2, 0xFC, 0x00, 0x64, 0x48, 0x40, 0xC0, 0xFC, 0x00, 0x64, 0x48, 0x40, 0x42, 0x40, 
-    0xD2, 0x80, 0x2C, 0x01, 0x9C, 0x87, 0x41, 0xED, 0xFD, 0xD6, 0x22, 0x4C, 0x53, 0x4C, 0x12, 0xB0, 
-    0x60, 0x00, 0x20, 0x4C, 0x53, 0x4C, 0x10, 0xB3, 0x60, 0x00, 0x2E, 0x05, 0x6D, 0xC6, 0x70, 0x0A, 
-    0xB0, 0x86, 0x6F, 0x02, 0x52, 0x4C, 0x20, 0x0C, 0x52, 0x80, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x63, 0x6F, 0x6E, 0x76, 0x31, 0x30, 0x5F, 0x5F, 0x46, 0x6C, 0x50, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x0C, 
-    0x2E, 0x2E, 0x00, 0x08, 0x20, 0x07, 0x02, 0x80, 0x00, 0x00, 0x00, 0x07, 0x72, 0x30, 0xD0, 0x01, 
-    0x20, 0x4C, 0x53, 0x4C, 0x10, 0x80, 0xE6, 0x8F, 0x4A, 0x87, 0x62, 0xE8, 0x20, 0x0C, 0x52, 0x80, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x63, 0x6F, 0x6E, 0x76, 0x38, 
-    0x5F, 0x5F, 0x46, 0x55, 0x6C, 0x50, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x03, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x08, 0x20, 0x07, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0x0F, 0x2C, 0x00, 0x70, 0x0A, 0xB0, 0x86, 0x6F, 0x14, 0x20, 0x07, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0x0F, 0x72, 0x30, 0xD0, 0x01, 0x20, 0x4C, 0x53, 0x4C, 0x10, 0x80, 0x60, 0x0C, 0x10, 0x06, 
-    0x72, 0x57, 0xD0, 0x01, 0x20, 0x4C, 0x53, 0x4C, 0x10, 0x80, 0xE8, 0x8F, 0x4A, 0x87, 0x62, 0xCA, 
-    0x20, 0x0C, 0x52, 0x80, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x63, 
-    0x6F, 0x6E, 0x76, 0x31, 0x36, 0x5F, 0x5F, 0x46, 0x55, 0x6C, 0x50, 0x63, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x28, 0x6E, 0x00, 0x0C, 0x2E, 0x2E, 0x00, 0x08, 0x20, 0x07, 
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x2C, 0x00, 0x70, 0x0A, 0xB0, 0x86, 0x6F, 0x14, 0x20, 0x07, 
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x72, 0x30, 0xD0, 0x01, 0x20, 0x4C, 0x53, 0x4C, 0x10, 0x80, 
-    0x60, 0x0C, 0x10, 0x06, 0x72, 0x37, 0xD0, 0x01, 0x20, 0x4C, 0x53, 0x4C, 0x10, 0x80, 0xE8, 0x8F, 
-    0x4A, 0x87, 0x62, 0xCA, 0x20, 0x0C, 0x52, 0x80, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8E, 0x63, 0x6F, 0x6E, 0x76, 0x31, 0x36, 0x75, 0x5F, 0x5F, 0x46, 0x55, 0x6C, 0x50, 
-    0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x08, 
-    0x20, 0x6B, 0x00, 0x04, 0x30, 0x28, 0x00, 0x30, 0x48, 0xC0, 0x28, 0x00, 0x42, 0x68, 0x00, 0x30, 
-    0x2A, 0x04, 0x20, 0x6B, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0x10, 0xD8, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x66, 0x06, 0x20, 0x0B, 0x60, 0x00, 
-    0x03, 0x06, 0x4A, 0xAE, 0x00, 0x0C, 0x66, 0x06, 0x20, 0x0B, 0x60, 0x00, 0x02, 0xFA, 0x20, 0x6B, 
-    0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 0x70, 0x02, 0xC0, 0xA8, 0x00, 0x28, 0x56, 0xC3, 0x44, 0x03, 
-    0x48, 0x83, 0x48, 0xC3, 0x28, 0x03, 0x70, 0x0A, 0xB0, 0xAD, 0xFD, 0x6E, 0x6D, 0x00, 0x00, 0xB8, 
-    0x4A, 0x85, 0x67, 0x06, 0x4A, 0x84, 0x67, 0x00, 0x00, 0xAE, 0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 
-    0x60, 0x00, 0x00, 0x8A, 0x20, 0x6E, 0xFF, 0xFC, 0x52, 0xAE, 0xFF, 0xFC, 0x10, 0x10, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 
-    0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x26, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 
-    0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x60, 0x0A, 0x20, 0x6E, 0xFF, 0xFC, 
-    0x4A, 0x10, 0x66, 0x00, 0xFF, 0x70, 0x2C, 0x2E, 0xFF, 0xFC, 0x9C, 0xAE, 0x00, 0x0C, 0x2E, 0x05, 
-    0x9E, 0x86, 0x60, 0x00, 0x01, 0x5E, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xAD, 0x04, 0x12, 0x2C, 0x00, 
-    0x2E, 0x05, 0x9E, 0x86, 0x4A, 0x87, 0x58, 0x4F, 0x6F, 0x00, 0x00, 0x9A, 0x4A, 0x84, 0x66, 0x00, 
-    0x00, 0x94, 0x60, 0x00, 0x00, 0x86, 0x20, 0x6B, 0x00, 0x04, 0x10, 0x28, 0x00, 0x2E, 0x48, 0x80, 
-    0x48, 0xC0, 0x2A, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x85, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x85, 
-    0x10, 0x05, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 
-    0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 
-    0x6E, 0x00, 0xFF, 0x74, 0x20, 0x6B, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x00, 0x00, 0x9E, 0x20, 0x68, 0x00, 0x08, 0x2D, 0x48, 0xFF, 0xF8, 0x22, 0x48, 0x20, 0x28, 
-    0x00, 0x10, 0x90, 0xA9, 0x00, 0x0C, 0xB0, 0x86, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x22, 0x2F, 0x06, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xF8, 0x2F, 0x28, 0x00, 0x0C, 0x4E, 0xAD, 0x03, 0xEA, 
-    0x20, 0x6E, 0xFF, 0xF8, 0xDD, 0xA8, 0x00, 0x0C, 0x20, 0x06, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x2A, 
-    0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x6E, 0xFF, 0xF8, 0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x40, 0x2F, 0x08, 0x20, 0x6E, 0xFF, 0xF8, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 
-    0x00, 0x44, 0x4E, 0x91, 0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0xBC, 0x80, 0x56, 0xC3, 0x44, 0x03, 
-    0x67, 0x28, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6B, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x02, 
-    0x70, 0x00, 0x4A, 0x87, 0x6F, 0x00, 0x00, 0x94, 0x60, 0x00, 0x00, 0x86, 0x20, 0x6B, 0x00, 0x04, 
-    0x10, 0x28, 0x00, 0x2E, 0x48, 0x80, 0x48, 0xC0, 0x28, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x84, 
-    0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 
-    0x52, 0xAC, 0x00, 0x0C, 0x10, 0x84, 0x10, 0x04, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 
-    0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 0x20, 0x6B, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 
-    0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 0x6E, 0x00, 0xFF, 0x74, 0x22, 0x2D, 0xFD, 0x6E, 0x20, 0x01, 
-    0xD2, 0x81, 0xD2, 0x80, 0xD2, 0x86, 0xE4, 0x81, 0x2B, 0x41, 0xFD, 0x6E, 0x20, 0x6B, 0x00, 0x04, 
-    0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0B, 0x4E, 0xBA, 0x0E, 0x5A, 0x70, 0x00, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x20, 0x0B, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xDC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x92, 0x5F, 0x5F, 0x6C, 0x73, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 
-    0x50, 0x43, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x28, 0x68, 0x00, 0x08, 0x20, 0x6E, 
-    0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x30, 0x28, 0x00, 0x30, 0x48, 0xC0, 0x2A, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x42, 0x68, 0x00, 0x30, 0x20, 0x2E, 0x00, 0x18, 0xD0, 0xAE, 
-    0x00, 0x10, 0x2C, 0x05, 0x9C, 0x80, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x2A, 0x28, 
-    0x00, 0x28, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x68, 0x00, 0x04, 0x10, 0x28, 0x00, 0x2E, 0x48, 0x80, 
-    0x48, 0xC0, 0x2E, 0x00, 0x70, 0x04, 0xC0, 0x85, 0x66, 0x62, 0x70, 0x0A, 0xC0, 0x85, 0x66, 0x00, 
-    0x00, 0xC6, 0x60, 0x58, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x87, 
-    0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x06, 0x70, 0x04, 0x60, 0x00, 0x01, 0xAC, 0x20, 0x06, 0x53, 0x86, 
-    0x4A, 0x80, 0x6E, 0xA0, 0x60, 0x60, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x28, 0x00, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0xC0, 0x84, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x84, 0x10, 0x04, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x06, 
-    0x70, 0x04, 0x60, 0x00, 0x01, 0x42, 0x4A, 0x13, 0x66, 0x9C, 0x70, 0x08, 0xC0, 0x85, 0x67, 0x00, 
-    0x00, 0xCC, 0x60, 0x58, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x87, 
-    0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x72, 0xFF, 0xB2, 0x80, 0x66, 0x06, 0x70, 0x04, 0x60, 0x00, 0x00, 0xDC, 0x20, 0x06, 0x53, 0x86, 
-    0x4A, 0x80, 0x6E, 0xA0, 0x60, 0x66, 0x20, 0x6E, 0x00, 0x14, 0x52, 0xAE, 0x00, 0x14, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2A, 0x00, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x85, 0x2F, 0x00, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 
-    0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 
-    0x10, 0x85, 0x10, 0x05, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 
-    0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x04, 0x70, 0x04, 0x60, 0x6A, 0x20, 0x6E, 0x00, 0x14, 
-    0x4A, 0x10, 0x66, 0x92, 0x60, 0x56, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 
-    0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x87, 0x2F, 0x00, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 
-    0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 
-    0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 
-    0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x04, 0x70, 0x04, 0x60, 0x0A, 0x20, 0x06, 0x53, 0x86, 
-    0x4A, 0x80, 0x6E, 0xA2, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9A, 0x64, 0x6F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5F, 0x5F, 0x46, 0x50, 0x37, 0x6F, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x50, 0x63, 0x69, 0x54, 0x32, 0x54, 0x33, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xDC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 
-    0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x0A, 0xEC, 0x4A, 0x80, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x66, 0x16, 0x20, 0x6C, 0x00, 0x04, 0x30, 0x28, 0x00, 0x30, 
-    0x48, 0xC0, 0x2E, 0x00, 0x42, 0x68, 0x00, 0x30, 0x20, 0x0C, 0x60, 0x00, 0x01, 0x50, 0x47, 0xED, 
-    0xFD, 0x5E, 0x7E, 0x00, 0x42, 0x2E, 0xFF, 0xFB, 0x20, 0x6C, 0x00, 0x04, 0x70, 0x70, 0xC0, 0xA8, 
-    0x00, 0x28, 0x04, 0x80, 0x00, 0x00, 0x00, 0x20, 0x67, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x00, 0x20, 
-    0x67, 0x36, 0x60, 0x00, 0x00, 0x94, 0x48, 0x6E, 0xFF, 0xFA, 0x2F, 0x06, 0x4E, 0xBA, 0xF8, 0x86, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xA8, 
-    0x00, 0x28, 0x50, 0x4F, 0x67, 0x00, 0x00, 0xA4, 0x4A, 0x86, 0x67, 0x00, 0x00, 0x9E, 0x47, 0xED, 
-    0xFD, 0x60, 0x7E, 0x01, 0x60, 0x00, 0x00, 0x94, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 
-    0x02, 0x00, 0xC0, 0xA8, 0x00, 0x28, 0x67, 0x28, 0x48, 0x6E, 0xFF, 0xFA, 0x2F, 0x06, 0x4E, 0xBA, 
-    0xF8, 0xEE, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 
-    0xC0, 0xA8, 0x00, 0x28, 0x50, 0x4F, 0x67, 0x62, 0x47, 0xED, 0xFD, 0x62, 0x7E, 0x02, 0x60, 0x5A, 
-    0x48, 0x6E, 0xFF, 0xFA, 0x2F, 0x06, 0x4E, 0xBA, 0xF8, 0x62, 0x2D, 0x40, 0xFF, 0xFC, 0x20, 0x6C, 
-    0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xA8, 0x00, 0x28, 0x50, 0x4F, 0x67, 0x3A, 
-    0x47, 0xED, 0xFD, 0x66, 0x7E, 0x02, 0x60, 0x32, 0x48, 0x6E, 0xFF, 0xFA, 0x2F, 0x06, 0x4E, 0xBA, 
-    0xF7, 0x38, 0x2D, 0x40, 0xFF, 0xFC, 0x4A, 0x86, 0x50, 0x4F, 0x6C, 0x08, 0x47, 0xED, 0xFD, 0x6A, 
-    0x7E, 0x01, 0x60, 0x16, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x04, 0x00, 0xC0, 0xA8, 
-    0x00, 0x28, 0x67, 0x06, 0x47, 0xED, 0xFD, 0x6C, 0x7E, 0x01, 0x41, 0xEE, 0xFF, 0xFB, 0x91, 0xEE, 
-    0xFF, 0xFC, 0x2F, 0x08, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x07, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFC, 0x26, 0x2C, 0x00, 0x4F, 0xEF, 0x00, 0x14, 0x67, 0x28, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x81, 0xA8, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 
-    0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0x86, 0x81, 0xA8, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x8D, 0xA8, 
-    0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x0A, 0x14, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xC0, 
-    0xFF, 0xCC, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x6C, 0x73, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x10, 0x2E, 0x00, 0x0F, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x05, 0xA2, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x09, 0xC2, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0C, 0x50, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x6C, 0x73, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 
-    0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x46, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x10, 0x2E, 0x00, 0x0F, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x46, 
-    0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x09, 0x66, 
-    0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0C, 0x50, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9B, 0x6C, 0x73, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x69, 0x63, 0x61, 
-    0x74, 0x65, 0x64, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x55, 0x63, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x29, 0x6E, 
-    0x00, 0x0C, 0x00, 0x08, 0x70, 0x00, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x10, 0x29, 0x40, 
-    0x00, 0x14, 0x29, 0x40, 0x00, 0x1C, 0x29, 0x40, 0x00, 0x18, 0x29, 0x40, 0x00, 0x20, 0x4A, 0xAC, 
-    0x00, 0x08, 0x66, 0x18, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x82, 0x00, 0x0C, 0x00, 0xAC, 0x00, 0x00, 
-    0x00, 0x82, 0x00, 0x10, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x82, 0x00, 0x10, 0x70, 0x11, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0xDC, 0x30, 0x2C, 0x00, 0x30, 0x48, 0xC0, 0x2E, 0x00, 0x42, 0x6C, 
-    0x00, 0x30, 0x70, 0x06, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0x16, 0x70, 0x20, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0xDA, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0x6C, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x28, 0x80, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x96, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x50, 0x39, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x00, 0x00, 0x96, 0x29, 0x6D, 0xFE, 0x3A, 
-    0x00, 0x36, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x20, 0x20, 0x6C, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 
-    0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x58, 0x4F, 0x4A, 0xAC, 0x00, 0x20, 0x67, 0x36, 0x4A, 0xAC, 
-    0x00, 0x08, 0x67, 0x28, 0x70, 0x03, 0x2F, 0x00, 0x20, 0x6C, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x58, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 
-    0x22, 0x68, 0x00, 0x5C, 0x4E, 0x91, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x10, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 
-    0xEF, 0x2A, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x12, 0x20, 0x2E, 
-    0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xEF, 0x0E, 0x58, 0x4F, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x33, 
-    0x69, 0x6F, 0x73, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x64, 0x20, 0x6C, 0x00, 0x08, 
-    0x21, 0x6D, 0xFE, 0x46, 0x00, 0x36, 0x29, 0x6D, 0xFE, 0x42, 0x00, 0x0C, 0x29, 0x6D, 0xFE, 0x3E, 
-    0x00, 0x04, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x0C, 0xD2, 0x82, 
-    0x2F, 0x01, 0x4E, 0xBA, 0x00, 0xCC, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x50, 
-    0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x14, 0xD2, 0x82, 
-    0x2F, 0x01, 0x4E, 0xBA, 0xFE, 0xE8, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 
-    0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xEE, 0x7E, 0x58, 0x4F, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 
-    0x5F, 0x38, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x67, 0x40, 0x20, 0x6C, 0x00, 0x08, 0x21, 0x6D, 0xFE, 0x4E, 0x00, 0x36, 0x29, 0x6D, 0xFE, 0x4A, 
-    0x00, 0x04, 0x20, 0x0C, 0x67, 0x2C, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 
-    0x22, 0x0C, 0x74, 0x0C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xFE, 0x72, 0x70, 0x00, 0x50, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xEE, 0x0C, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x3C, 0x20, 0x6C, 0x00, 0x04, 0x21, 0x6D, 0xFE, 0x56, 0x00, 0x36, 0x28, 0xAD, 
-    0xFE, 0x52, 0x20, 0x0C, 0x67, 0x2A, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x14, 0x70, 0x00, 0x2F, 0x00, 
-    0x22, 0x0C, 0x50, 0x81, 0x2F, 0x01, 0x4E, 0xBA, 0xFE, 0x04, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xED, 0x9E, 0x58, 0x4F, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 
-    0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x66, 0x10, 0x70, 0x46, 0x2F, 0x00, 0x4E, 0xBA, 0xED, 0x8C, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 
-    0x67, 0x34, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x0C, 
-    0x20, 0x0C, 0x72, 0x0C, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x76, 0x58, 0x4F, 0x60, 0x02, 
-    0x20, 0x0B, 0x29, 0x40, 0x00, 0x08, 0x29, 0x6D, 0xFE, 0x4A, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x08, 
-    0x21, 0x6D, 0xFE, 0x4E, 0x00, 0x36, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x42, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xED, 0x14, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2E, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x12, 0x26, 0x4C, 0x50, 0x4B, 0x20, 0x0C, 0x50, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 0x06, 0x02, 
-    0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x29, 0x40, 0x00, 0x04, 0x28, 0xAD, 0xFE, 0x52, 0x20, 0x6C, 
-    0x00, 0x04, 0x21, 0x6D, 0xFE, 0x56, 0x00, 0x36, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x04, 0xC6, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x66, 0x06, 0x20, 0x0C, 
-    0x60, 0x00, 0x00, 0xF4, 0x20, 0x6C, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x4A, 0xAB, 0x00, 0x0C, 
-    0x67, 0x0A, 0x20, 0x2B, 0x00, 0x0C, 0x90, 0xAB, 0x00, 0x08, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x80, 
-    0x67, 0x5A, 0x70, 0xFF, 0x2F, 0x00, 0x22, 0x6C, 0x00, 0x04, 0x20, 0x69, 0x00, 0x08, 0x22, 0x48, 
-    0x22, 0x69, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 
-    0x00, 0x08, 0x20, 0x68, 0x00, 0x24, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 
-    0x50, 0x4F, 0x66, 0x00, 0x00, 0xA0, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 
-    0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6C, 
-    0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x60, 0x78, 0x20, 0x6C, 0x00, 0x04, 
-    0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x14, 0xB0, 0xAB, 0x00, 0x18, 0x55, 0xC3, 0x44, 0x03, 
-    0x67, 0x0A, 0x20, 0x2B, 0x00, 0x18, 0x90, 0xAB, 0x00, 0x14, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x80, 
-    0x67, 0x52, 0x22, 0x6C, 0x00, 0x04, 0x20, 0x69, 0x00, 0x08, 0x22, 0x48, 0x22, 0x69, 0x00, 0x24, 
-    0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x68, 0x00, 0x08, 0x20, 0x68, 
-    0x00, 0x24, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x24, 
-    0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x91, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x1E, 0x2E, 0x00, 0x0F, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x14, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x03, 0x86, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x01, 0x67, 0x00, 0x00, 0x9E, 
-    0x20, 0x6C, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 0x00, 0x10, 
-    0x54, 0xC3, 0x44, 0x03, 0x67, 0x2A, 0x48, 0x87, 0x48, 0xC7, 0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x07, 
-    0x72, 0x00, 0x12, 0x00, 0x2F, 0x01, 0x20, 0x4B, 0x22, 0x6B, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x24, 
-    0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x04, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x1C, 0x67, 0x0C, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x03, 0x72, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x8F, 0x70, 0x75, 0x74, 0x5F, 0x5F, 0x37, 0x6F, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x63, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x00, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6C, 0x00, 0x24, 0xFF, 0xFC, 
-    0x29, 0x4B, 0x00, 0x24, 0x20, 0x0B, 0x67, 0x12, 0x00, 0xAC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 
-    0x00, 0xAC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x60, 0x10, 0x02, 0xAC, 0xFF, 0xFF, 0xFB, 0xFF, 
-    0x00, 0x10, 0x02, 0xAC, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x14, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 
-    0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x74, 0x69, 0x65, 0x5F, 0x5F, 0x33, 0x69, 
-    0x6F, 0x73, 0x46, 0x50, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x1E, 0x2C, 0x00, 0x2E, 0x19, 0x6E, 
-    0x00, 0x0F, 0x00, 0x2E, 0x10, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8C, 0x66, 0x69, 0x6C, 0x6C, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x63, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x30, 0x2C, 0x00, 0x2C, 
-    0x48, 0xC0, 0x2E, 0x00, 0x39, 0x6E, 0x00, 0x0E, 0x00, 0x2C, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 
-    0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x13, 0x08, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 0x2C, 0x2C, 0x00, 0x28, 0x20, 0x07, 
-    0xC0, 0xAE, 0x00, 0x0C, 0x22, 0x07, 0x46, 0x81, 0xC2, 0xAC, 0x00, 0x28, 0x82, 0x80, 0x29, 0x41, 
-    0x00, 0x28, 0x20, 0x01, 0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x00, 0xAC, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x10, 0x60, 0x08, 0x02, 0xAC, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x10, 0x20, 0x3C, 0x00, 0x00, 
-    0x60, 0x00, 0xC0, 0xAC, 0x00, 0x28, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x29, 0x43, 
-    0x00, 0x1C, 0x20, 0x06, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x8E, 0x73, 
-    0x65, 0x74, 0x66, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x6C, 0x54, 0x31, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x28, 
-    0x20, 0x2E, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x28, 0x08, 0x00, 0x00, 0x00, 0x67, 0x0A, 0x00, 0xAC, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x60, 0x08, 0x02, 0xAC, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x10, 
-    0x20, 0x3C, 0x00, 0x00, 0x60, 0x00, 0xC0, 0xAC, 0x00, 0x28, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x29, 0x43, 0x00, 0x1C, 0x20, 0x07, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8D, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x6C, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xA8, 0x00, 0x0C, 
-    0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xD2, 0x20, 0x6C, 0x00, 0x08, 0x4A, 0xA8, 0x00, 0x24, 
-    0x67, 0x60, 0x20, 0x68, 0x00, 0x24, 0x20, 0x68, 0x00, 0x04, 0x20, 0x68, 0x00, 0x08, 0x2D, 0x48, 
-    0xFF, 0xFC, 0x4A, 0xA8, 0x00, 0x0C, 0x67, 0x0C, 0x22, 0x48, 0x20, 0x28, 0x00, 0x0C, 0x90, 0xA9, 
-    0x00, 0x08, 0x60, 0x02, 0x70, 0x00, 0x4A, 0x80, 0x67, 0x38, 0x4A, 0x87, 0x67, 0x26, 0x20, 0x6C, 
-    0x00, 0x08, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x14, 0xB0, 0xAB, 0x00, 0x18, 0x55, 0xC3, 
-    0x44, 0x03, 0x67, 0x0A, 0x20, 0x2B, 0x00, 0x18, 0x90, 0xAB, 0x00, 0x14, 0x60, 0x02, 0x70, 0x00, 
-    0xBE, 0x80, 0x6F, 0x0E, 0x20, 0x6C, 0x00, 0x08, 0x2F, 0x28, 0x00, 0x24, 0x4E, 0xBA, 0xFB, 0xAA, 
-    0x58, 0x4F, 0x20, 0x6C, 0x00, 0x08, 0x4A, 0xA8, 0x00, 0x0C, 0x66, 0x18, 0x4A, 0x87, 0x66, 0x14, 
-    0x20, 0x3C, 0x00, 0x00, 0x02, 0x00, 0xC0, 0xA8, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xEA, 0x14, 0x58, 0x4F, 0x20, 0x6C, 0x00, 0x08, 0x20, 0x28, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 
-    0x67, 0x24, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0x00, 0xA8, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x10, 0x70, 0x00, 0x60, 0x12, 0x20, 0x6C, 0x00, 0x08, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 
-    0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xEC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x93, 0x64, 0x6F, 0x5F, 0x69, 0x70, 0x66, 0x78, 0x5F, 0x5F, 0x37, 0x69, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x46, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xA8, 
-    0x00, 0x0C, 0x67, 0x04, 0x70, 0x00, 0x60, 0x4C, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x24, 
-    0x67, 0x30, 0x20, 0x68, 0x00, 0x24, 0x20, 0x68, 0x00, 0x04, 0x26, 0x68, 0x00, 0x08, 0x4A, 0xAB, 
-    0x00, 0x0C, 0x67, 0x0A, 0x20, 0x2B, 0x00, 0x0C, 0x90, 0xAB, 0x00, 0x08, 0x60, 0x02, 0x70, 0x00, 
-    0x4A, 0x80, 0x67, 0x0E, 0x20, 0x6C, 0x00, 0x04, 0x2F, 0x28, 0x00, 0x24, 0x4E, 0xBA, 0xFA, 0xCA, 
-    0x58, 0x4F, 0x20, 0x6C, 0x00, 0x04, 0x4A, 0xA8, 0x00, 0x0C, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x20, 0x03, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x64, 
-    0x6F, 0x5F, 0x6F, 0x70, 0x66, 0x78, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x6C, 
-    0x00, 0x04, 0x20, 0x3C, 0x00, 0x00, 0x40, 0x00, 0xC0, 0xA8, 0x00, 0x28, 0x67, 0x0C, 0x4A, 0xAD, 
-    0xFE, 0x76, 0x67, 0x06, 0x20, 0x6D, 0xFE, 0x76, 0x4E, 0x90, 0x20, 0x6C, 0x00, 0x04, 0x20, 0x3C, 
-    0x00, 0x00, 0x20, 0x00, 0xC0, 0xA8, 0x00, 0x28, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xFA, 0x5A, 
-    0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x64, 0x6F, 0x5F, 0x6F, 0x73, 
-    0x66, 0x78, 0x5F, 0x5F, 0x37, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x3A, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xE6, 0xE0, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x14, 0x29, 0x6D, 
-    0xFE, 0x3A, 0x00, 0x36, 0x29, 0x6C, 0x00, 0x0C, 0x00, 0x32, 0x29, 0x7C, 0x00, 0x00, 0x00, 0x80, 
-    0x00, 0x0C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8C, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x33, 0x69, 0x6F, 0x73, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x70, 0x46, 0x2F, 0x00, 0x4E, 0xBA, 0xE6, 0x8E, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x46, 
-    0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x0C, 0x20, 0x0C, 
-    0x72, 0x0C, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x78, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 
-    0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xF8, 0xB8, 0x29, 0x6D, 0xFE, 0x5A, 0x00, 0x04, 0x20, 0x6C, 
-    0x00, 0x08, 0x21, 0x6D, 0xFE, 0x5E, 0x00, 0x36, 0x20, 0x6C, 0x00, 0x08, 0x22, 0x48, 0x23, 0x68, 
-    0x00, 0x32, 0x00, 0x0C, 0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x38, 0x69, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x46, 0x2F, 0x00, 0x4E, 0xBA, 0xE5, 0xF8, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x67, 0x46, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 
-    0x47, 0xEB, 0x00, 0x0C, 0x20, 0x0C, 0x72, 0x0C, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0xE2, 
-    0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xF8, 0x22, 0x29, 0x6D, 
-    0xFE, 0x5A, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x08, 0x21, 0x6D, 0xFE, 0x5E, 0x00, 0x36, 0x20, 0x6C, 
-    0x00, 0x08, 0x22, 0x48, 0x23, 0x68, 0x00, 0x32, 0x00, 0x0C, 0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x2B, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 
-    0x31, 0x38, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 
-    0x73, 0x69, 0x67, 0x6E, 0x46, 0x50, 0x31, 0x33, 0x49, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 
-    0x5F, 0x69, 0x6E, 0x69, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x4C, 0x20, 0x6C, 0x00, 0x08, 
-    0x21, 0x6D, 0xFE, 0x5E, 0x00, 0x36, 0x29, 0x6D, 0xFE, 0x5A, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x38, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xF6, 0xB6, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x0C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF5, 0x4E, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xE4, 0xE6, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x38, 0x69, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x48, 0x20, 0x6C, 0x00, 0x04, 0x21, 0x6D, 0xFE, 0x62, 0x00, 0x36, 
-    0x28, 0xAD, 0xFE, 0x66, 0x20, 0x0C, 0x67, 0x36, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xF6, 0xA0, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x50, 0x81, 
-    0x2F, 0x01, 0x4E, 0xBA, 0xF4, 0xC8, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 
-    0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xE4, 0x60, 0x58, 0x4F, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 
-    0x38, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 
-    0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2C, 0x00, 0x08, 0x4E, 0xBA, 0xF3, 0xC6, 0x20, 0x0C, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x26, 0x5F, 0x5F, 0x61, 0x73, 0x5F, 0x5F, 
-    0x31, 0x38, 0x69, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 
-    0x73, 0x69, 0x67, 0x6E, 0x46, 0x50, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x42, 0x2F, 0x00, 0x4E, 0xBA, 0xE3, 0xF8, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x67, 0x40, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x26, 0x4C, 
-    0x50, 0x4B, 0x20, 0x0C, 0x50, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0xE6, 0x58, 0x4F, 0x60, 0x02, 
-    0x20, 0x0B, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xF6, 0x9E, 0x28, 0xAD, 0xFE, 0x66, 0x20, 0x6C, 
-    0x00, 0x04, 0x21, 0x6D, 0xFE, 0x62, 0x00, 0x36, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x48, 0x23, 0x68, 
-    0x00, 0x32, 0x00, 0x0C, 0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9C, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x38, 0x6F, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x42, 0x2F, 0x00, 0x4E, 0xBA, 0xE3, 0x68, 0x28, 0x40, 
-    0x20, 0x0C, 0x58, 0x4F, 0x67, 0x40, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x26, 0x4C, 
-    0x50, 0x4B, 0x20, 0x0C, 0x50, 0x80, 0x2F, 0x00, 0x4E, 0xBA, 0xFC, 0x56, 0x58, 0x4F, 0x60, 0x02, 
-    0x20, 0x0B, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xF6, 0x0E, 0x28, 0xAD, 0xFE, 0x66, 0x20, 0x6C, 
-    0x00, 0x04, 0x21, 0x6D, 0xFE, 0x62, 0x00, 0x36, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x48, 0x23, 0x68, 
-    0x00, 0x32, 0x00, 0x0C, 0x50, 0x4F, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x2B, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x38, 0x6F, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x50, 
-    0x31, 0x33, 0x49, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xF2, 0x4C, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x80, 0x26, 0x5F, 0x5F, 0x61, 0x73, 0x5F, 0x5F, 0x31, 0x38, 0x6F, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x50, 
-    0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x52, 
-    0x29, 0x6D, 0xFE, 0x72, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0x21, 0x6D, 0xFE, 0x6E, 0x00, 0x36, 
-    0x29, 0x6D, 0xFE, 0x6A, 0x00, 0x04, 0x20, 0x0C, 0x67, 0x38, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xF3, 0x46, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 
-    0x74, 0x4E, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF2, 0x74, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xE2, 0x0C, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x31, 0x39, 0x69, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x77, 0x69, 
-    0x74, 0x68, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6E, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x70, 0x7E, 0x2F, 0x00, 0x4E, 0xBA, 0xE1, 0xEE, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x56, 
-    0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x44, 0x20, 0x0C, 
-    0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xFA, 0xD8, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 
-    0x29, 0x40, 0x00, 0x40, 0x29, 0x6D, 0xFE, 0x7A, 0x00, 0x3C, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 
-    0xFE, 0x7E, 0x00, 0x36, 0x2F, 0x0C, 0x4E, 0xBA, 0x24, 0x7E, 0x2F, 0x0C, 0x2F, 0x2C, 0x00, 0x40, 
-    0x4E, 0xBA, 0xF1, 0x20, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x00, 0x2E, 0x4F, 0xEF, 0x00, 0x18, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x98, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x66, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x2E, 
-    0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x19, 0x2A, 0x4A, 0x80, 0x56, 0xC3, 0x44, 0x03, 0x48, 0x83, 
-    0x48, 0xC3, 0x2E, 0x03, 0x67, 0x56, 0x20, 0x6C, 0x00, 0x40, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x80, 
-    0xC0, 0xA8, 0x00, 0x0C, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x40, 
-    0x00, 0x0C, 0x20, 0x6C, 0x00, 0x40, 0x20, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x00, 0x10, 
-    0x22, 0x28, 0x00, 0x0C, 0x82, 0x80, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x41, 0x00, 0x10, 0x20, 0x6C, 
-    0x00, 0x40, 0x20, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x00, 0x14, 0x22, 0x28, 0x00, 0x0C, 
-    0x82, 0x80, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x41, 0x00, 0x14, 0x60, 0x24, 0x20, 0x6C, 0x00, 0x40, 
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x20, 0x6C, 0x00, 0x40, 0x00, 0xA8, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x10, 0x20, 0x6C, 0x00, 0x40, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x6F, 
-    0x70, 0x65, 0x6E, 0x5F, 0x5F, 0x31, 0x31, 0x66, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 
-    0x73, 0x65, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x4C, 0x20, 0x6C, 
-    0x00, 0x40, 0x21, 0x6D, 0xFE, 0x7E, 0x00, 0x36, 0x29, 0x6D, 0xFE, 0x7A, 0x00, 0x3C, 0x20, 0x0C, 
-    0x67, 0x38, 0x70, 0x02, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x24, 0x00, 0x70, 0x02, 0xC0, 0x87, 
-    0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 
-    0xF0, 0x7C, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 
-    0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xE0, 0x14, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x31, 0x66, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 
-    0x48, 0x78, 0x00, 0x8A, 0x4E, 0xBA, 0xDF, 0xFE, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x5C, 
-    0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x50, 0x20, 0x0C, 
-    0x72, 0x50, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xF8, 0xE8, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 
-    0x70, 0x01, 0x80, 0xAE, 0x00, 0x14, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0B, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFD, 0xBA, 0x2F, 0x0B, 0x20, 0x0C, 0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xF2, 0x0E, 0x29, 0x6D, 0xFE, 0x82, 0x00, 0x3C, 0x29, 0x6D, 0xFE, 0x86, 0x00, 0x48, 0x20, 0x6C, 
-    0x00, 0x40, 0x21, 0x6D, 0xFE, 0x8A, 0x00, 0x36, 0x4F, 0xEF, 0x00, 0x18, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x38, 
-    0x69, 0x66, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x64, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFE, 0x8A, 0x00, 0x36, 0x29, 0x6D, 
-    0xFE, 0x86, 0x00, 0x48, 0x29, 0x6D, 0xFE, 0x82, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 
-    0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xF0, 0xB2, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFE, 0x94, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 
-    0x2F, 0x00, 0x22, 0x0C, 0x74, 0x50, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEF, 0x40, 0x70, 0x00, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xDE, 0xD6, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x38, 0x69, 0x66, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x48, 0x78, 0x00, 0x86, 0x4E, 0xBA, 
-    0xDE, 0xC4, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x5C, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x4C, 0x20, 0x0C, 0x72, 0x4C, 0xD0, 0x81, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF7, 0xAE, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x70, 0x02, 0x80, 0xAE, 0x00, 0x14, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xFC, 0x80, 0x2F, 0x0B, 
-    0x20, 0x0C, 0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xF1, 0x4C, 0x29, 0x6D, 0xFE, 0x8E, 
-    0x00, 0x3C, 0x29, 0x6D, 0xFE, 0x92, 0x00, 0x44, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFE, 0x96, 
-    0x00, 0x36, 0x4F, 0xEF, 0x00, 0x18, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x38, 0x6F, 0x66, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x64, 0x20, 0x6C, 
-    0x00, 0x40, 0x21, 0x6D, 0xFE, 0x96, 0x00, 0x36, 0x29, 0x6D, 0xFE, 0x92, 0x00, 0x44, 0x29, 0x6D, 
-    0xFE, 0x8E, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 
-    0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEF, 0xEA, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xFD, 0x5A, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x4C, 
-    0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xEE, 0x06, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xDD, 0x9C, 
-    0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x38, 0x6F, 0x66, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x67, 0x6A, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFE, 0xA6, 0x00, 0x36, 0x29, 0x6D, 
-    0xFE, 0xA2, 0x00, 0x48, 0x29, 0x6D, 0xFE, 0x9E, 0x00, 0x50, 0x29, 0x6D, 0xFE, 0x9A, 0x00, 0x3C, 
-    0x20, 0x0C, 0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 
-    0x4E, 0xBA, 0xEE, 0x46, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFC, 0xBE, 0x70, 0x02, 
-    0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x58, 0xD2, 0x82, 0x2F, 0x01, 
-    0x4E, 0xBA, 0xED, 0x6A, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 
-    0x4F, 0xEF, 0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xDD, 0x00, 0x58, 0x4F, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x37, 
-    0x66, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x12, 0x70, 0x02, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xDC, 0xF2, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x00, 0x01, 0x46, 0x48, 0x6D, 
-    0xFF, 0x70, 0x70, 0x46, 0x2F, 0x00, 0x4E, 0xBA, 0xDE, 0x92, 0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 
-    0x67, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xF6, 0x22, 0x4A, 0x80, 0x50, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x48, 0x6D, 0xFF, 0x2E, 0x70, 0x42, 0x2F, 0x00, 0x4E, 0xBA, 0xDE, 0x6C, 
-    0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 0x67, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xF8, 0x92, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x48, 0x6D, 0xFE, 0xEC, 0x70, 0x42, 
-    0x2F, 0x00, 0x4E, 0xBA, 0xDE, 0x46, 0x26, 0x40, 0x20, 0x0B, 0x50, 0x4F, 0x67, 0x10, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xF8, 0x6C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x48, 0x6D, 0xFE, 0xAA, 0x70, 0x42, 0x2F, 0x00, 0x4E, 0xBA, 0xDE, 0x20, 0x26, 0x40, 0x20, 0x0B, 
-    0x50, 0x4F, 0x67, 0x10, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xF8, 0x46, 0x4A, 0x80, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x1F, 0x78, 
-    0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x70, 0x4E, 0xBA, 0xF7, 0xDE, 0x70, 0x01, 0x2F, 0x00, 
-    0x72, 0x00, 0x2F, 0x01, 0x4E, 0xBA, 0x1F, 0x60, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x2E, 
-    0x4E, 0xBA, 0xF9, 0x40, 0x70, 0x02, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x4E, 0xBA, 0x1F, 0x48, 
-    0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xFE, 0xEC, 0x4E, 0xBA, 0xF9, 0x28, 0x70, 0x02, 0x2F, 0x00, 
-    0x72, 0x00, 0x2F, 0x01, 0x4E, 0xBA, 0x1F, 0x30, 0x50, 0x8F, 0x2F, 0x00, 0x48, 0x6D, 0xFE, 0xAA, 
-    0x4E, 0xBA, 0xF9, 0x10, 0x70, 0x01, 0x2F, 0x00, 0x72, 0xFF, 0x2F, 0x01, 0x2F, 0x2D, 0xFF, 0x78, 
-    0x4E, 0xBA, 0xF2, 0x18, 0x48, 0x78, 0x20, 0x00, 0x70, 0xFF, 0x2F, 0x00, 0x2F, 0x2D, 0xFE, 0xF0, 
-    0x4E, 0xBA, 0xF2, 0x08, 0x48, 0x6D, 0xFF, 0x2E, 0x2F, 0x2D, 0xFF, 0x78, 0x4E, 0xBA, 0xF1, 0x2C, 
-    0x48, 0x6D, 0xFF, 0x2E, 0x2F, 0x2D, 0xFE, 0xF0, 0x4E, 0xBA, 0xF1, 0x20, 0x48, 0x6D, 0xFF, 0x2E, 
-    0x2F, 0x2D, 0xFE, 0xAE, 0x4E, 0xBA, 0xF1, 0x14, 0x70, 0x01, 0x2B, 0x40, 0xFF, 0xB6, 0x4F, 0xEF, 
-    0x00, 0x50, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 
-    0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x33, 0x49, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 
-    0x69, 0x6E, 0x69, 0x74, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x20, 0x0C, 0x67, 0x32, 0x48, 0x6D, 0xFF, 0x2E, 0x4E, 0xBA, 0xEE, 0xAC, 0x48, 0x6D, 
-    0xFE, 0xEC, 0x4E, 0xBA, 0xEE, 0xA4, 0x48, 0x6D, 0xFE, 0xAA, 0x4E, 0xBA, 0xEE, 0x9C, 0x20, 0x0C, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x12, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xDB, 0x16, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x97, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x33, 0x49, 0x6F, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x3C, 0x2F, 0x00, 0x4E, 0xBA, 0xDB, 0x06, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x2A, 0x2F, 0x0C, 0x4E, 0xBA, 0x10, 0xC8, 0x28, 0x40, 
-    0x29, 0x6D, 0xFF, 0xBC, 0x00, 0x24, 0x70, 0x00, 0x29, 0x40, 0x00, 0x28, 0x29, 0x40, 0x00, 0x2C, 
-    0x29, 0x40, 0x00, 0x30, 0x72, 0x01, 0x29, 0x41, 0x00, 0x34, 0x70, 0x40, 0x29, 0x40, 0x00, 0x38, 
-    0x58, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 
-    0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE4, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x70, 0x40, 0xB0, 0xAC, 0x00, 0x38, 0x6F, 0x06, 0x70, 0x40, 0x29, 0x40, 0x00, 0x38, 
-    0x4A, 0xAC, 0x00, 0x28, 0x67, 0x10, 0x2F, 0x2C, 0x00, 0x38, 0x20, 0x6C, 0x00, 0x28, 0x4E, 0x90, 
-    0x4A, 0x80, 0x58, 0x4F, 0x60, 0x0C, 0x2F, 0x2C, 0x00, 0x38, 0x4E, 0xBA, 0xDA, 0x78, 0x4A, 0x80, 
-    0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x9A, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x34, 0x2D, 0x4B, 0xFF, 0xE4, 0x22, 0x2C, 0x00, 0x38, 0xD2, 0x8B, 0x2D, 0x41, 
-    0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xDA, 0x10, 0x70, 0x00, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 
-    0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x2D, 0x4B, 0xFF, 0xEC, 0x20, 0x2C, 
-    0x00, 0x38, 0xD0, 0x8B, 0x2D, 0x40, 0xFF, 0xF0, 0x29, 0x4B, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xEC, 
-    0x00, 0x08, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x10, 0x2D, 0x4B, 0xFF, 0xF4, 0x2D, 0x4B, 0xFF, 0xF8, 
-    0x2D, 0x4B, 0xFF, 0xFC, 0x29, 0x4B, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x18, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xD8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9C, 0x64, 0x6F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x73, 
-    0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xEC, 0x48, 0xE7, 0x1F, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x4A, 0xAC, 0x00, 0x04, 0x66, 0x40, 0x76, 0x00, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x0A, 0x30, 0x2C, 
-    0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 
-    0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x00, 0x01, 0x68, 
-    0x70, 0xFF, 0x60, 0x00, 0x01, 0xB4, 0x20, 0x2C, 0x00, 0x0C, 0x52, 0x80, 0xB0, 0xAC, 0x00, 0x10, 
-    0x64, 0x04, 0x60, 0x00, 0x01, 0x52, 0x4A, 0xAC, 0x00, 0x38, 0x67, 0x00, 0x01, 0x22, 0x4A, 0xAC, 
-    0x00, 0x34, 0x66, 0x00, 0x01, 0x1A, 0x2E, 0x2C, 0x00, 0x04, 0x2A, 0x2C, 0x00, 0x0C, 0x9A, 0x87, 
-    0x28, 0x2C, 0x00, 0x14, 0x98, 0x87, 0x20, 0x2C, 0x00, 0x20, 0xD0, 0x80, 0x2E, 0x00, 0x58, 0x87, 
-    0xBE, 0xAC, 0x00, 0x38, 0x64, 0x04, 0x2E, 0x2C, 0x00, 0x38, 0x4A, 0xAC, 0x00, 0x28, 0x67, 0x0E, 
-    0x2F, 0x07, 0x20, 0x6C, 0x00, 0x28, 0x4E, 0x90, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x07, 
-    0x4E, 0xBA, 0xD8, 0xF2, 0x4A, 0x80, 0x58, 0x4F, 0x26, 0x40, 0x20, 0x0B, 0x66, 0x06, 0x70, 0xFF, 
-    0x60, 0x00, 0x01, 0x46, 0x2F, 0x05, 0x2F, 0x2C, 0x00, 0x04, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0xEA, 
-    0x4A, 0xAC, 0x00, 0x2C, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x6C, 
-    0x00, 0x2C, 0x4E, 0x90, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xD8, 0x8C, 
-    0x58, 0x4F, 0x2D, 0x4B, 0xFF, 0xEC, 0x20, 0x0B, 0xD0, 0x87, 0x2D, 0x40, 0xFF, 0xF0, 0x76, 0x00, 
-    0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xD8, 0x64, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 
-    0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xF0, 0xB0, 0xAE, 0xFF, 0xEC, 0x52, 0xC3, 
-    0x44, 0x03, 0x67, 0x0A, 0x20, 0x2E, 0xFF, 0xF0, 0x90, 0xAE, 0xFF, 0xEC, 0x60, 0x02, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x20, 0x05, 0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x26, 0x6C, 0x00, 0x20, 0xD7, 0xEC, 0x00, 0x04, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xF4, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF8, 0x20, 0x04, 
-    0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x60, 0x28, 0x4A, 0xAC, 
-    0x00, 0x30, 0x67, 0x1E, 0x26, 0x6C, 0x00, 0x0C, 0x2D, 0x4B, 0xFF, 0xFC, 0x47, 0xEB, 0x04, 0x00, 
-    0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 
-    0x60, 0x04, 0x70, 0xFF, 0x60, 0x52, 0x70, 0xFF, 0xB0, 0x86, 0x67, 0x4C, 0x20, 0x2C, 0x00, 0x0C, 
-    0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 
-    0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 
-    0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xD0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x9A, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x31, 0x32, 0x73, 
-    0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x40, 0x4A, 0xAC, 0x00, 0x18, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x36, 
-    0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF8, 0x2D, 0x6C, 0x00, 0x18, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x0C, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 
-    0x20, 0x0B, 0xB0, 0xAC, 0x00, 0x14, 0x62, 0x04, 0x70, 0xFF, 0x60, 0x0A, 0x20, 0x6C, 0x00, 0x14, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9B, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 
-    0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0x21, 0x6E, 0x00, 0x0C, 0x00, 0x34, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x98, 0x66, 0x72, 0x65, 0x65, 0x7A, 0x65, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0xC0, 
-    0x20, 0x2C, 0x00, 0x04, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x73, 0x74, 0x72, 
-    0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 
-    0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x67, 0x52, 0x29, 0x6D, 0xFF, 0xBC, 0x00, 0x24, 0x4A, 0xAC, 0x00, 0x34, 0x66, 0x24, 0x4A, 0xAC, 
-    0x00, 0x04, 0x67, 0x1E, 0x4A, 0xAC, 0x00, 0x2C, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x20, 0x6C, 
-    0x00, 0x2C, 0x4E, 0x90, 0x58, 0x4F, 0x60, 0x0A, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xD6, 0x2C, 
-    0x58, 0x4F, 0x20, 0x0C, 0x67, 0x1E, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x0C, 0xDC, 
-    0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xD6, 0x0A, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x5F, 0x5F, 0x64, 
-    0x74, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 
-    0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x4A, 0xAE, 0x00, 0x0C, 0x66, 0x16, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x06, 0x4A, 0xAC, 0x00, 0x38, 
-    0x67, 0x0A, 0x29, 0x6E, 0x00, 0x10, 0x00, 0x38, 0x20, 0x0C, 0x60, 0x02, 0x70, 0x00, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x73, 0x65, 0x74, 0x62, 0x75, 0x66, 0x5F, 0x5F, 0x31, 
-    0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 
-    0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF4, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x14, 
-    0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x10, 0x2E, 0x00, 0x13, 0x67, 0x5C, 0x53, 0x00, 
-    0x67, 0x06, 0x53, 0x00, 0x67, 0x20, 0x60, 0x52, 0x08, 0x06, 0x00, 0x00, 0x67, 0x0C, 0x20, 0x2C, 
-    0x00, 0x14, 0x90, 0xAC, 0x00, 0x04, 0xDE, 0x80, 0x60, 0x40, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 
-    0x00, 0x04, 0xDE, 0x80, 0x60, 0x34, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 0x64, 0x16, 
-    0x20, 0x2C, 0x00, 0x18, 0xB0, 0xAC, 0x00, 0x0C, 0x63, 0x0C, 0x20, 0x2C, 0x00, 0x18, 0x90, 0xAC, 
-    0x00, 0x04, 0xDE, 0x80, 0x60, 0x14, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x64, 0x0A, 
-    0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0xDE, 0x80, 0x4A, 0x87, 0x6C, 0x04, 0x70, 0xFF, 
-    0x60, 0x60, 0xBE, 0xAC, 0x00, 0x20, 0x6D, 0x0A, 0x4A, 0xAC, 0x00, 0x30, 0x66, 0x04, 0x70, 0xFF, 
-    0x60, 0x50, 0x08, 0x06, 0x00, 0x00, 0x67, 0x24, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF4, 0x20, 0x07, 
-    0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xF8, 0x26, 0x6C, 0x00, 0x18, 0x29, 0x6E, 0xFF, 0xF4, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x70, 0x02, 0xC0, 0x86, 
-    0x67, 0x1E, 0x20, 0x07, 0xD0, 0xAC, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x10, 
-    0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 
-    0x20, 0x07, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x80, 0x23, 0x73, 0x65, 
-    0x65, 0x6B, 0x6F, 0x66, 0x66, 0x5F, 0x5F, 0x31, 0x32, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x38, 0x73, 0x65, 0x65, 0x6B, 0x5F, 0x64, 0x69, 0x72, 
-    0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x66, 0x10, 0x70, 0x7E, 0x2F, 0x00, 0x4E, 0xBA, 0xD4, 0x96, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x48, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 
-    0x26, 0x4C, 0x47, 0xEB, 0x00, 0x44, 0x20, 0x0C, 0x72, 0x44, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xED, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0B, 0x29, 0x40, 0x00, 0x40, 0x29, 0x6D, 0xFF, 0xC0, 
-    0x00, 0x3C, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFF, 0xC4, 0x00, 0x36, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xF9, 0x3A, 0x2F, 0x0C, 0x2F, 0x2C, 0x00, 0x40, 0x4E, 0xBA, 0xE3, 0xC8, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x5F, 0x5F, 0x63, 
-    0x74, 0x5F, 0x5F, 0x31, 0x33, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 
-    0x73, 0x65, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x4C, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 
-    0xFF, 0xC4, 0x00, 0x36, 0x29, 0x6D, 0xFF, 0xC0, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x38, 0x70, 0x02, 
-    0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x5E, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 0x70, 0x00, 
-    0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xE4, 0x00, 0x70, 0x00, 
-    0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xD3, 0x98, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x97, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x33, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x20, 0x6E, 
-    0x00, 0x08, 0x20, 0x08, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x72, 0x64, 0x62, 0x75, 0x66, 0x5F, 0x5F, 
-    0x31, 0x33, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x61, 0x73, 0x65, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x64, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFF, 0xD0, 
-    0x00, 0x36, 0x29, 0x6D, 0xFF, 0xCC, 0x00, 0x48, 0x29, 0x6D, 0xFF, 0xC8, 0x00, 0x3C, 0x20, 0x0C, 
-    0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 
-    0xE4, 0xAE, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x0C, 0x70, 0x02, 0xC0, 0x87, 
-    0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x50, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 
-    0xE3, 0x3C, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xD2, 0xD2, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x69, 
-    0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x10, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 
-    0x66, 0x10, 0x48, 0x78, 0x00, 0x86, 0x4E, 0xBA, 0xD2, 0xBC, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 
-    0x67, 0x50, 0x20, 0x0B, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x16, 0x26, 0x4C, 0x47, 0xEB, 0x00, 0x4C, 
-    0x20, 0x0C, 0x72, 0x4C, 0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xEB, 0xA6, 0x58, 0x4F, 0x60, 0x02, 
-    0x20, 0x0B, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0xDC, 0x2F, 0x0B, 0x20, 0x0C, 0x72, 0x44, 
-    0xD0, 0x81, 0x2F, 0x00, 0x4E, 0xBA, 0xE5, 0x50, 0x29, 0x6D, 0xFF, 0xD4, 0x00, 0x3C, 0x29, 0x6D, 
-    0xFF, 0xD8, 0x00, 0x44, 0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFF, 0xDC, 0x00, 0x36, 0x4F, 0xEF, 
-    0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 
-    0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 
-    0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x00, 0x00, 0xB2, 0x20, 0x6C, 0x00, 0x40, 
-    0x21, 0x6D, 0xFF, 0xDC, 0x00, 0x36, 0x29, 0x6D, 0xFF, 0xD8, 0x00, 0x44, 0x29, 0x6D, 0xFF, 0xD4, 
-    0x00, 0x3C, 0x20, 0x6C, 0x00, 0x40, 0x26, 0x68, 0x00, 0x08, 0x20, 0x2B, 0x00, 0x0C, 0xB0, 0xAB, 
-    0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1E, 0x70, 0x00, 0x2F, 0x00, 0x20, 0x4B, 0x22, 0x6B, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x18, 0x20, 0x6B, 0x00, 0x0C, 0x52, 0xAB, 0x00, 0x0C, 0x42, 0x10, 
-    0x30, 0x3C, 0x00, 0xFF, 0xC0, 0x3C, 0x00, 0x00, 0x72, 0x00, 0x12, 0x00, 0x20, 0x01, 0x20, 0x0C, 
-    0x67, 0x4A, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 
-    0xE3, 0xA0, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x8C, 0x70, 0x02, 0xC0, 0x87, 
-    0x67, 0x16, 0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x4C, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 
-    0xE1, 0xBC, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xD1, 0x52, 0x58, 0x4F, 0x4C, 0xEE, 0x18, 0x88, 
-    0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 
-    0x73, 0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFD, 0xB2, 0x58, 0x8F, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xFA, 0x7C, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x73, 0x74, 0x72, 0x5F, 0x5F, 0x31, 0x30, 0x6F, 0x73, 
-    0x74, 0x72, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x6A, 
-    0x20, 0x6C, 0x00, 0x40, 0x21, 0x6D, 0xFF, 0xEC, 0x00, 0x36, 0x29, 0x6D, 0xFF, 0xE8, 0x00, 0x48, 
-    0x29, 0x6D, 0xFF, 0xE4, 0x00, 0x50, 0x29, 0x6D, 0xFF, 0xE0, 0x00, 0x3C, 0x20, 0x0C, 0x67, 0x4A, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x44, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xE1, 0xCA, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0xFC, 0xBE, 0x70, 0x02, 0xC0, 0x87, 0x67, 0x16, 
-    0x70, 0x00, 0x2F, 0x00, 0x22, 0x0C, 0x74, 0x58, 0xD2, 0x82, 0x2F, 0x01, 0x4E, 0xBA, 0xE0, 0xEE, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x08, 0x07, 0x00, 0x00, 0x4F, 0xEF, 0x00, 0x10, 
-    0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xD0, 0x84, 0x58, 0x4F, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 
-    0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x48, 0x78, 0x04, 0x00, 0x4E, 0xBA, 0xD0, 0x78, 0x2D, 0x40, 
-    0xFF, 0xF8, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x54, 0x26, 0x6E, 0xFF, 0xF8, 0x20, 0x0B, 
-    0xD0, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 
-    0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xBA, 0xD0, 0x18, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x4B, 0x00, 0x04, 
-    0xB7, 0xEE, 0xFF, 0xFC, 0x55, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x2E, 0xFF, 0xFC, 0x90, 0x8B, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x38, 0xBC, 0x00, 0x01, 0x70, 0x00, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x98, 0x64, 0x6F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x65, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x08, 0x2E, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x0C, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0xC0, 0x87, 0x60, 0x00, 0x00, 0x98, 0x76, 0x00, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x0A, 0x30, 0x2C, 
-    0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 
-    0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x04, 0x70, 0xFF, 
-    0x60, 0x5A, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x62, 0x4E, 0x20, 0x2C, 0x00, 0x0C, 
-    0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 
-    0xC0, 0x87, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1E, 0x20, 0x6C, 
-    0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x87, 0x10, 0x07, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 
-    0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 0x10, 0x88, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 
-    0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x00, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x20, 0x2C, 0x00, 0x0C, 
-    0xB0, 0xAC, 0x00, 0x18, 0x63, 0x20, 0x2D, 0x6C, 0x00, 0x1C, 0xFF, 0xF8, 0x2D, 0x6C, 0x00, 0x14, 
-    0xFF, 0xFC, 0x26, 0x6C, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x20, 0x2C, 0x00, 0x18, 0xB0, 0xAC, 0x00, 0x14, 0x63, 0x04, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x97, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 
-    0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x70, 0x62, 0x61, 0x63, 0x6B, 0x66, 0x61, 0x69, 0x6C, 0x5F, 0x5F, 
-    0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x70, 0xFF, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x73, 0x79, 0x6E, 0x63, 0x5F, 0x5F, 0x39, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x2E, 0x00, 0x10, 0x70, 0x00, 0x2F, 0x00, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x30, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x34, 0x4E, 0x91, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x96, 0x73, 0x65, 0x65, 0x6B, 0x70, 0x6F, 0x73, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 
-    0x6D, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0xFF, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x9F, 0x73, 0x65, 0x65, 0x6B, 0x6F, 0x66, 0x66, 0x5F, 0x5F, 0x39, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x38, 0x73, 0x65, 0x65, 0x6B, 0x5F, 
-    0x64, 0x69, 0x72, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x17, 0x18, 0x2A, 0x2E, 
-    0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x05, 0x30, 0x2C, 0x00, 0x02, 
-    0x48, 0xC0, 0x67, 0x72, 0x60, 0x64, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x20, 0x2C, 
-    0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 
-    0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 
-    0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x0A, 
-    0x20, 0x05, 0x90, 0x87, 0x53, 0x80, 0x60, 0x00, 0x00, 0x84, 0x20, 0x07, 0x53, 0x87, 0x4A, 0x80, 
-    0x6E, 0x94, 0x20, 0x05, 0x60, 0x76, 0x2C, 0x2C, 0x00, 0x10, 0x9C, 0xAC, 0x00, 0x0C, 0x60, 0x52, 
-    0x2F, 0x06, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xAD, 0x03, 0xEA, 0xD7, 0xC6, 0xDD, 0xAC, 
-    0x00, 0x0C, 0x9E, 0x86, 0x10, 0x1B, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 
-    0x10, 0x01, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x14, 
-    0x66, 0x06, 0x20, 0x05, 0x90, 0x87, 0x60, 0x24, 0x53, 0x87, 0x2C, 0x2C, 0x00, 0x10, 0x9C, 0xAC, 
-    0x00, 0x0C, 0xBE, 0x86, 0x6E, 0xAA, 0x2F, 0x07, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x0C, 0x4E, 0xAD, 
-    0x03, 0xEA, 0xDF, 0xAC, 0x00, 0x0C, 0x20, 0x05, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xE8, 
-    0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 0x97, 0x78, 0x73, 0x70, 0x75, 0x74, 0x6E, 0x5F, 0x5F, 0x39, 
-    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x17, 0x18, 0x2A, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 
-    0x26, 0x6E, 0x00, 0x0C, 0x2C, 0x05, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x67, 0x6E, 0x60, 0x64, 
-    0x76, 0x00, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 0x65, 0x22, 0x2F, 0x03, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 
-    0x4E, 0x91, 0x58, 0x8F, 0x26, 0x1F, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x18, 0x20, 0x6C, 0x00, 0x14, 0x52, 0xAC, 0x00, 0x14, 0x10, 0x10, 
-    0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x48, 0xC0, 
-    0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 0x67, 0x04, 0x16, 0xC7, 0x60, 0x08, 0x20, 0x0B, 0x90, 0xAE, 
-    0x00, 0x0C, 0x60, 0x76, 0x20, 0x06, 0x53, 0x86, 0x4A, 0x80, 0x6E, 0x94, 0x4A, 0x86, 0x6E, 0x04, 
-    0x70, 0x00, 0x60, 0x66, 0x2E, 0x2C, 0x00, 0x18, 0x9E, 0xAC, 0x00, 0x14, 0x60, 0x42, 0x2F, 0x07, 
-    0x2F, 0x2C, 0x00, 0x14, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0xEA, 0xD7, 0xC7, 0x9C, 0x87, 0xDF, 0xAC, 
-    0x00, 0x14, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x10, 0x66, 0x08, 
-    0x20, 0x0B, 0x90, 0xAE, 0x00, 0x0C, 0x60, 0x22, 0x2E, 0x2C, 0x00, 0x18, 0x9E, 0xAC, 0x00, 0x14, 
-    0xBC, 0x87, 0x6E, 0xBA, 0x2F, 0x06, 0x2F, 0x2C, 0x00, 0x14, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0xEA, 
-    0xDD, 0xAC, 0x00, 0x14, 0x20, 0x05, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x78, 0x73, 0x67, 0x65, 0x74, 0x6E, 0x5F, 0x5F, 0x39, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xE4, 0x48, 0xE7, 0x11, 0x18, 0x2E, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x34, 0x4A, 0x87, 
-    0x6F, 0x06, 0x20, 0x0B, 0x66, 0x00, 0x00, 0x98, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xE4, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 
-    0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xCB, 0x30, 0x70, 0x00, 0x58, 0x4F, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 
-    0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 
-    0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xEC, 
-    0x2D, 0x40, 0xFF, 0xF0, 0x2D, 0x40, 0xFF, 0xF4, 0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x1C, 0x29, 0x6E, 
-    0xFF, 0xF0, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x18, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 
-    0xFF, 0xFC, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x08, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x10, 0x39, 0x7C, 0x00, 0x01, 0x00, 0x02, 0x60, 0x00, 0x00, 0x92, 0x2D, 0x4B, 
-    0xFF, 0xE4, 0x20, 0x0B, 0xD0, 0x87, 0x2D, 0x40, 0xFF, 0xE8, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 
-    0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 
-    0x4E, 0xBA, 0xCA, 0x98, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x6E, 0xFF, 0xE4, 
-    0x00, 0x04, 0x20, 0x2E, 0xFF, 0xE8, 0xB0, 0xAE, 0xFF, 0xE4, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x20, 0x2E, 0xFF, 0xE8, 0x90, 0xAE, 0xFF, 0xE4, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 
-    0x42, 0x54, 0x2D, 0x4B, 0xFF, 0xEC, 0x2D, 0x4B, 0xFF, 0xF0, 0x2D, 0x4B, 0xFF, 0xF4, 0x29, 0x4B, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x18, 0x2D, 0x4B, 
-    0xFF, 0xF8, 0x20, 0x0B, 0xD0, 0x87, 0x2D, 0x40, 0xFF, 0xFC, 0x29, 0x4B, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xF8, 0x00, 0x08, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x10, 0x42, 0x6C, 0x00, 0x02, 0x20, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xD4, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x73, 0x65, 0x74, 0x62, 0x75, 
-    0x66, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 
-    0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x12, 0x70, 0x28, 0x2F, 0x00, 0x4E, 0xBA, 0xCA, 0x1A, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x00, 0x00, 0x84, 0x29, 0x6D, 0xFF, 0xF0, 0x00, 0x24, 0x42, 0x94, 0x70, 0x00, 
-    0x26, 0x40, 0x2D, 0x40, 0xFF, 0xF0, 0x76, 0x00, 0x4A, 0x54, 0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 
-    0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xBA, 0xC9, 0xBC, 
-    0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x4B, 0x00, 0x04, 0xB7, 0xEE, 0xFF, 0xF0, 
-    0x55, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x2E, 0xFF, 0xF0, 0x90, 0x8B, 0x60, 0x02, 0x70, 0x00, 
-    0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xF8, 
-    0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x4B, 
-    0x00, 0x18, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0x08, 0xFF, 0xE4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 
-    0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x46, 0x29, 0x6D, 0xFF, 0xF0, 0x00, 0x24, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 
-    0x4E, 0x91, 0x4A, 0xAC, 0x00, 0x04, 0x58, 0x4F, 0x67, 0x0E, 0x4A, 0x54, 0x67, 0x0A, 0x2F, 0x2C, 
-    0x00, 0x04, 0x4E, 0xBA, 0xC9, 0x06, 0x58, 0x4F, 0x20, 0x0C, 0x67, 0x12, 0x20, 0x2E, 0x00, 0x0C, 
-    0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xC8, 0xF0, 0x58, 0x4F, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x92, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x39, 0x73, 0x74, 
-    0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x10, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x18, 0x67, 0x0A, 0x20, 0x2C, 
-    0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 
-    0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x1C, 0x4E, 0x91, 0x52, 0xAC, 0x00, 0x0C, 
-    0x58, 0x4F, 0x20, 0x2C, 0x00, 0x14, 0xB0, 0xAC, 0x00, 0x18, 0x54, 0xC3, 0x44, 0x03, 0x67, 0x1A, 
-    0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x18, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 
-    0x00, 0x1C, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x14, 0x20, 0x6C, 0x00, 0x14, 0x10, 0x10, 
-    0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x4C, 0xEE, 
-    0x10, 0x08, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x96, 0x78, 0x5F, 0x73, 0x6E, 0x65, 0x78, 0x74, 
-    0x63, 0x5F, 0x5F, 0x39, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x0C, 
-    0x67, 0x04, 0x70, 0x02, 0x60, 0x0C, 0x4A, 0xAC, 0x00, 0x14, 0x67, 0x04, 0x70, 0x01, 0x60, 0x02, 
-    0x70, 0x00, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x6C, 0x61, 0x73, 0x74, 0x5F, 
-    0x6F, 0x70, 0x5F, 0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x13, 0x18, 0x26, 0x6E, 0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x10, 
-    0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6D, 0xF9, 0x28, 0xFF, 0xF0, 0x70, 0x00, 0x2B, 0x40, 0xF9, 0x28, 
-    0x72, 0x08, 0xC2, 0x86, 0x67, 0x06, 0x00, 0x86, 0x00, 0x00, 0x00, 0x02, 0x4A, 0x2C, 0x00, 0x30, 
-    0x67, 0x1C, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 
-    0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0x01, 0x72, 0x7E, 0x00, 
-    0x70, 0x08, 0xC0, 0x86, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x00, 0x08, 0x70, 0x03, 0xC0, 0x86, 
-    0x53, 0x80, 0x67, 0x0E, 0x53, 0x80, 0x67, 0x22, 0x53, 0x80, 0x67, 0x00, 0x00, 0x9A, 0x60, 0x00, 
-    0x00, 0xEA, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x07, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x4A, 
-    0x29, 0x40, 0x00, 0x28, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD2, 0x00, 0x87, 0x00, 0x00, 0x03, 0x01, 
-    0x70, 0x20, 0xC0, 0x86, 0x67, 0x06, 0x02, 0x87, 0xFF, 0xFF, 0xFE, 0xFF, 0x70, 0x40, 0xC0, 0x86, 
-    0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x05, 0x00, 0x70, 0x08, 0xC0, 0x86, 0x67, 0x06, 0x00, 0x87, 
-    0x00, 0x00, 0x00, 0x08, 0x70, 0x0C, 0xC0, 0x86, 0x67, 0x06, 0x02, 0x87, 0xFF, 0xFF, 0xFD, 0xFF, 
-    0x0C, 0x87, 0x00, 0x00, 0x03, 0x01, 0x66, 0x0E, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x7A, 0x29, 0x40, 
-    0x00, 0x28, 0x58, 0x4F, 0x60, 0x0E, 0x2F, 0x07, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x4A, 0x29, 0x40, 
-    0x00, 0x28, 0x50, 0x4F, 0x4A, 0xAC, 0x00, 0x28, 0x6D, 0x70, 0x70, 0x0C, 0xC0, 0x86, 0x67, 0x6A, 
-    0x70, 0x02, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 0x03, 0x82, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x54, 0x00, 0x87, 0x00, 0x00, 0x01, 0x02, 0x70, 0x10, 0xC0, 0x86, 
-    0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x02, 0x00, 0x70, 0x08, 0xC0, 0x86, 0x67, 0x06, 0x00, 0x87, 
-    0x00, 0x00, 0x00, 0x08, 0x70, 0x20, 0xC0, 0x86, 0x67, 0x06, 0x02, 0x87, 0xFF, 0xFF, 0xFE, 0xFF, 
-    0x2F, 0x07, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0x4A, 0x29, 0x40, 0x00, 0x28, 0x50, 0x4F, 0x6D, 0x1A, 
-    0x70, 0x0C, 0xC0, 0x86, 0x67, 0x14, 0x70, 0x02, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x2C, 
-    0x00, 0x28, 0x4E, 0xAD, 0x03, 0x82, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0xAC, 0x00, 0x28, 0x6C, 0x04, 
-    0x70, 0x00, 0x60, 0x5A, 0x19, 0x7C, 0x00, 0x01, 0x00, 0x30, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 
-    0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x08, 0x29, 0x4B, 
-    0x00, 0x10, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF8, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x29, 0x46, 0x00, 0x2C, 
-    0x72, 0xFF, 0x29, 0x41, 0x00, 0x32, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x74, 0x00, 0x60, 0x02, 0x74, 0x00, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0xC8, 0xFF, 0xDC, 0x4E, 0x5E, 0x4E, 0x75, 0x93, 0x6F, 0x70, 0x65, 0x6E, 0x5F, 0x5F, 0x37, 
-    0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x50, 0x43, 0x63, 0x69, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xEE, 0x48, 0xE7, 0x13, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6D, 
-    0xF9, 0x28, 0xFF, 0xF0, 0x70, 0x00, 0x2B, 0x40, 0xF9, 0x28, 0x4A, 0x2C, 0x00, 0x30, 0x66, 0x1C, 
-    0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0xFF, 0x60, 0x00, 0x02, 0x34, 0x76, 0x00, 0x4A, 0xAC, 
-    0x00, 0x04, 0x66, 0x0A, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 
-    0x67, 0x1A, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 
-    0x22, 0x68, 0x00, 0x0C, 0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x72, 0xFF, 
-    0xB2, 0x80, 0x66, 0x1C, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 
-    0xFF, 0xF0, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xE0, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xFD, 0x4E, 0x72, 0x01, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x38, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 
-    0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x1C, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0xFF, 0x60, 0x00, 0x01, 0x9A, 0x26, 0x6C, 0x00, 0x04, 0x60, 0x00, 0x00, 0x86, 0x20, 0x2C, 
-    0x00, 0x0C, 0x90, 0x8B, 0x2F, 0x00, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 0x03, 0x62, 
-    0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x22, 0x70, 0xFF, 0x29, 0x40, 0x00, 0x32, 0x4A, 0xAD, 
-    0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x72, 0x00, 
-    0x60, 0x02, 0x72, 0x00, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x56, 0xD7, 0xC7, 0x70, 0xFF, 0xB0, 0xAC, 
-    0x00, 0x32, 0x67, 0x18, 0x4A, 0xAC, 0x00, 0x2C, 0x67, 0x12, 0x70, 0x08, 0xC0, 0xAC, 0x00, 0x2C, 
-    0x66, 0x0A, 0x4A, 0x87, 0x6D, 0x06, 0xDF, 0xAC, 0x00, 0x32, 0x60, 0x06, 0x70, 0xFF, 0x29, 0x40, 
-    0x00, 0x32, 0x4A, 0x87, 0x6C, 0x1C, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0xFF, 0x60, 0x00, 
-    0x01, 0x0E, 0x4A, 0xAC, 0x00, 0x0C, 0x67, 0x08, 0xB7, 0xEC, 0x00, 0x0C, 0x65, 0x00, 0xFF, 0x70, 
-    0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF4, 0x26, 0x6C, 0x00, 0x20, 0xD7, 0xEC, 0x00, 0x04, 0x29, 0x6E, 
-    0xFF, 0xF4, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 
-    0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x72, 0xFF, 0xB2, 0x86, 0x67, 0x00, 
-    0x00, 0xA0, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x67, 0x4A, 0x1D, 0x46, 0xFF, 0xEF, 0x70, 0xFF, 
-    0x29, 0x40, 0x00, 0x32, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xEF, 0x2F, 0x2C, 0x00, 0x28, 
-    0x4E, 0xAD, 0x03, 0x62, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0x4A, 0xAD, 
-    0xF9, 0x28, 0x67, 0xE0, 0x4A, 0xAD, 0xF9, 0x28, 0x67, 0x66, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 
-    0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 
-    0x70, 0xFF, 0x60, 0x6A, 0x20, 0x2C, 0x00, 0x0C, 0xB0, 0xAC, 0x00, 0x10, 0x54, 0xC3, 0x44, 0x03, 
-    0x67, 0x24, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 
-    0x4A, 0x80, 0x50, 0x4F, 0x60, 0x1A, 0x20, 0x6C, 0x00, 0x0C, 0x52, 0xAC, 0x00, 0x0C, 0x10, 0x86, 
-    0x10, 0x06, 0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 
-    0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 
-    0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x20, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x86, 0x4C, 0xEE, 
-    0x18, 0xC8, 0xFF, 0xDA, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 
-    0x77, 0x5F, 0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xE8, 0x48, 0xE7, 0x13, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x4A, 0x2C, 0x00, 0x30, 
-    0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x01, 0xF8, 0x76, 0x00, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x0A, 
-    0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x66, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x1A, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x08, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x0C, 
-    0x4E, 0x91, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x72, 0xFF, 0xB2, 0x80, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x01, 0xBA, 0x2F, 0x0C, 0x4E, 0xBA, 0xFA, 0xF8, 0x72, 0x02, 0xB2, 0x80, 
-    0x58, 0x4F, 0x66, 0x22, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x06, 
-    0x70, 0xFF, 0x60, 0x00, 0x01, 0x8A, 0x2D, 0x6D, 0xF9, 0x28, 0xFF, 0xF8, 0x70, 0x00, 0x2B, 0x40, 
-    0xF9, 0x28, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 
-    0xFF, 0xFC, 0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x32, 0x2C, 0x00, 0x02, 0x48, 0xC1, 0x67, 0x4C, 
-    0x70, 0xFF, 0x29, 0x40, 0x00, 0x32, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6C, 0x00, 0x3A, 0x2F, 0x2C, 
-    0x00, 0x28, 0x4E, 0xAD, 0x03, 0x5A, 0x2C, 0x00, 0x41, 0xEC, 0x00, 0x3A, 0x2D, 0x48, 0xFF, 0xF0, 
-    0x41, 0xEC, 0x00, 0x3A, 0x2D, 0x48, 0xFF, 0xF4, 0x47, 0xF4, 0x68, 0x3A, 0x29, 0x6E, 0xFF, 0xF0, 
-    0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x4A, 0x86, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x6E, 0x00, 0x00, 0xF0, 0x70, 0xFF, 0x60, 0x00, 0x01, 0x14, 0x70, 0x08, 0xB0, 0xAC, 
-    0x00, 0x20, 0x6C, 0x12, 0x20, 0x2C, 0x00, 0x04, 0x58, 0x80, 0x29, 0x40, 0x00, 0x36, 0x2E, 0x2C, 
-    0x00, 0x20, 0x59, 0x87, 0x60, 0x10, 0x20, 0x2C, 0x00, 0x04, 0x52, 0x80, 0x29, 0x40, 0x00, 0x36, 
-    0x2E, 0x2C, 0x00, 0x20, 0x53, 0x87, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x36, 0x2F, 0x2C, 0x00, 0x28, 
-    0x4E, 0xAD, 0x03, 0x5A, 0x2C, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1A, 0x70, 0x00, 0x2B, 0x40, 
-    0xF9, 0x28, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x36, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 0x03, 0x5A, 
-    0x2C, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x4A, 0x86, 0x6E, 0x08, 0x70, 0x04, 0xB0, 0xAD, 0xF9, 0x28, 
-    0x67, 0xDA, 0x70, 0xFF, 0xB0, 0xAC, 0x00, 0x32, 0x67, 0x18, 0x4A, 0xAC, 0x00, 0x2C, 0x67, 0x12, 
-    0x70, 0x08, 0xC0, 0xAC, 0x00, 0x2C, 0x66, 0x0A, 0x4A, 0x86, 0x6D, 0x06, 0xDD, 0xAC, 0x00, 0x32, 
-    0x60, 0x06, 0x70, 0xFF, 0x29, 0x40, 0x00, 0x32, 0x4A, 0x86, 0x6E, 0x36, 0x70, 0x00, 0x2D, 0x40, 
-    0xFF, 0xE8, 0x2D, 0x40, 0xFF, 0xEC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xE8, 0x00, 0x1C, 0x29, 0x6E, 
-    0xFF, 0xEC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF8, 0xF9, 0x28, 0x72, 0x00, 0x60, 0x02, 0x72, 0x00, 0x70, 0xFF, 
-    0x60, 0x4C, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xF0, 0x2D, 0x6C, 0x00, 0x36, 0xFF, 0xF4, 0x26, 0x46, 
-    0xD7, 0xEC, 0x00, 0x36, 0x29, 0x6E, 0xFF, 0xF0, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x14, 
-    0x29, 0x4B, 0x00, 0x18, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 
-    0xFF, 0xF8, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x20, 0x6C, 0x00, 0x14, 0x10, 0x10, 
-    0x48, 0x80, 0x32, 0x3C, 0x00, 0xFF, 0xC2, 0x00, 0x70, 0x00, 0x10, 0x01, 0x4A, 0x80, 0x4C, 0xEE, 
-    0x18, 0xC8, 0xFF, 0xD4, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x66, 0x6C, 
-    0x6F, 0x77, 0x5F, 0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xF0, 0x48, 0xE7, 0x13, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x28, 
-    0x4A, 0x2C, 0x00, 0x30, 0x66, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xB4, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0xF9, 0x02, 0x72, 0x02, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x1A, 0x70, 0xFF, 0x2F, 0x00, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 
-    0x4E, 0x91, 0x50, 0x4F, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0xF4, 0x2D, 0x40, 0xFF, 0xF8, 0x26, 0x40, 
-    0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xFC, 
-    0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x42, 0x2C, 0x00, 0x30, 0x72, 0xFF, 0x29, 0x41, 0x00, 0x28, 
-    0x29, 0x41, 0x00, 0x32, 0x4A, 0xAC, 0x00, 0x2C, 0x67, 0x42, 0x70, 0x00, 0x29, 0x40, 0x00, 0x2C, 
-    0x2D, 0x6D, 0xF9, 0x28, 0xFF, 0xF0, 0x2B, 0x40, 0xF9, 0x28, 0x2F, 0x07, 0x4E, 0xAD, 0x03, 0x52, 
-    0x2C, 0x00, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xF0, 
-    0xF9, 0x28, 0x70, 0x00, 0x60, 0x02, 0x70, 0x00, 0x70, 0xFF, 0xB0, 0x86, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x20, 0x0C, 0x58, 0x4F, 0x60, 0x02, 0x20, 0x0C, 0x4C, 0xEE, 
-    0x18, 0xC8, 0xFF, 0xDC, 0x4E, 0x5E, 0x4E, 0x75, 0x91, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x5F, 0x5F, 
-    0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF0, 
-    0x48, 0xE7, 0x11, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x2D, 0x6D, 0xF9, 0x28, 0xFF, 0xF0, 
-    0x70, 0x00, 0x2B, 0x40, 0xF9, 0x28, 0x2F, 0x0C, 0x4E, 0xBA, 0xF8, 0x18, 0x53, 0x80, 0x58, 0x4F, 
-    0x67, 0x06, 0x53, 0x80, 0x67, 0x2C, 0x60, 0x46, 0x70, 0x01, 0x2F, 0x00, 0x22, 0x2C, 0x00, 0x14, 
-    0x92, 0xAC, 0x00, 0x18, 0x2F, 0x01, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 0x03, 0x82, 0x29, 0x40, 
-    0x00, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x26, 0x7E, 0xFF, 0x70, 0xFF, 0x29, 0x40, 0x00, 0x32, 
-    0x60, 0x1C, 0x70, 0xFF, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 0x50, 0x4F, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0xF4, 0x26, 0x40, 0x29, 0x6E, 0xFF, 0xF4, 0x00, 0x0C, 0x29, 0x6E, 0xFF, 0xF4, 
-    0x00, 0x08, 0x29, 0x4B, 0x00, 0x10, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x26, 0x40, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x1C, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x14, 0x29, 0x4B, 0x00, 0x18, 
-    0x72, 0xFF, 0x29, 0x41, 0x00, 0x32, 0x4A, 0xAD, 0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 
-    0x2B, 0x6E, 0xFF, 0xF0, 0xF9, 0x28, 0x74, 0x00, 0x60, 0x02, 0x74, 0x00, 0x70, 0xFF, 0xB0, 0x87, 
-    0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x88, 
-    0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x73, 0x79, 0x6E, 0x63, 0x5F, 0x5F, 0x37, 0x66, 0x69, 
-    0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xE4, 0x48, 0xE7, 
-    0x1F, 0x18, 0x18, 0x2E, 0x00, 0x13, 0x2A, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6D, 
-    0xF9, 0x28, 0xFF, 0xFC, 0x70, 0x00, 0x2B, 0x40, 0xF9, 0x28, 0x72, 0xFF, 0xB2, 0xAC, 0x00, 0x32, 
-    0x66, 0x18, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 
-    0x03, 0x82, 0x29, 0x40, 0x00, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0xAC, 0x00, 0x32, 
-    0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x02, 0x06, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x66, 0x00, 
-    0x01, 0xAE, 0x70, 0x00, 0x26, 0x40, 0x2F, 0x0C, 0x4E, 0xBA, 0xF6, 0xE8, 0x53, 0x80, 0x58, 0x4F, 
-    0x67, 0x06, 0x53, 0x80, 0x67, 0x34, 0x60, 0x4A, 0x26, 0x6C, 0x00, 0x14, 0x2E, 0x2C, 0x00, 0x32, 
-    0x20, 0x2C, 0x00, 0x18, 0x2D, 0x40, 0xFF, 0xF0, 0x90, 0xAC, 0x00, 0x14, 0x2C, 0x07, 0x9C, 0x80, 
-    0x20, 0x2E, 0xFF, 0xF0, 0x90, 0xAC, 0x00, 0x36, 0x22, 0x07, 0x92, 0x80, 0x2D, 0x41, 0xFF, 0xF4, 
-    0x20, 0x07, 0x53, 0x80, 0x2D, 0x40, 0xFF, 0xF8, 0x60, 0x18, 0x26, 0x6C, 0x00, 0x0C, 0x20, 0x0B, 
-    0xD0, 0xAC, 0x00, 0x32, 0x2C, 0x00, 0x9C, 0xAC, 0x00, 0x08, 0x2D, 0x46, 0xFF, 0xF8, 0x2D, 0x46, 
-    0xFF, 0xF4, 0x10, 0x04, 0x67, 0x0A, 0x53, 0x00, 0x67, 0x0A, 0x53, 0x00, 0x67, 0x0C, 0x60, 0x0E, 
-    0x2E, 0x05, 0x60, 0x0A, 0x2E, 0x06, 0xDE, 0x85, 0x60, 0x04, 0x70, 0x00, 0x26, 0x40, 0x20, 0x0B, 
-    0x67, 0x00, 0x00, 0x8A, 0xBE, 0xAE, 0xFF, 0xF4, 0x6D, 0x00, 0x00, 0x82, 0xBE, 0xAE, 0xFF, 0xF8, 
-    0x6E, 0x7A, 0x2F, 0x0C, 0x4E, 0xBA, 0xF6, 0x5C, 0x53, 0x80, 0x58, 0x4F, 0x67, 0x06, 0x53, 0x80, 
-    0x67, 0x64, 0x60, 0x2A, 0x2D, 0x6C, 0x00, 0x1C, 0xFF, 0xE4, 0x20, 0x07, 0x90, 0x86, 0xD0, 0x8B, 
-    0x2D, 0x40, 0xFF, 0xE8, 0x2D, 0x6C, 0x00, 0x18, 0xFF, 0xEC, 0x29, 0x6E, 0xFF, 0xE4, 0x00, 0x1C, 
-    0x29, 0x6E, 0xFF, 0xE8, 0x00, 0x14, 0x29, 0x6E, 0xFF, 0xEC, 0x00, 0x18, 0x60, 0x38, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 
-    0x4E, 0x91, 0x2F, 0x2E, 0x00, 0x14, 0x70, 0x00, 0x10, 0x04, 0x2F, 0x00, 0x2F, 0x05, 0x20, 0x4C, 
-    0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x30, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x34, 
-    0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x14, 0x20, 0x07, 0x60, 0x00, 0x00, 0xF2, 0x20, 0x0B, 0x67, 0x00, 
-    0x00, 0x9E, 0xBC, 0x87, 0x6F, 0x00, 0x00, 0x98, 0x20, 0x2C, 0x00, 0x20, 0x72, 0x02, 0x4E, 0xBA, 
-    0xB1, 0xDA, 0xD0, 0x87, 0xBC, 0x80, 0x6C, 0x00, 0x00, 0x86, 0x2F, 0x0C, 0x4E, 0xBA, 0xF5, 0xC4, 
-    0x72, 0x01, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x76, 0x20, 0x2C, 0x00, 0x20, 0x72, 0x02, 0x4E, 0xBA, 
-    0xB1, 0xBA, 0x2C, 0x07, 0x9C, 0x80, 0x4A, 0x86, 0x6C, 0x02, 0x7C, 0x00, 0x20, 0x4C, 0x22, 0x6C, 
-    0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 
-    0x70, 0x00, 0x2F, 0x00, 0x2F, 0x06, 0x2F, 0x2C, 0x00, 0x28, 0x4E, 0xAD, 0x03, 0x82, 0x29, 0x40, 
-    0x00, 0x32, 0x70, 0xFF, 0x2F, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x10, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2F, 0x2E, 0x00, 0x14, 0x70, 0x00, 
-    0x10, 0x04, 0x2F, 0x00, 0x2F, 0x05, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x30, 
-    0x2F, 0x08, 0x20, 0x49, 0x22, 0x68, 0x00, 0x34, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x28, 0x4A, 0xAD, 
-    0xF9, 0x28, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x0A, 0x2B, 0x6E, 0xFF, 0xFC, 0xF9, 0x28, 0x70, 0x00, 
-    0x60, 0x02, 0x70, 0x00, 0x20, 0x4C, 0x22, 0x6C, 0x00, 0x24, 0xD0, 0xE9, 0x00, 0x28, 0x2F, 0x08, 
-    0x20, 0x49, 0x22, 0x68, 0x00, 0x2C, 0x4E, 0x91, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x18, 0x70, 0x00, 0x10, 0x04, 0x2F, 0x00, 0x2F, 0x05, 0x2F, 0x2C, 0x00, 0x28, 
-    0x4E, 0xAD, 0x03, 0x82, 0x29, 0x40, 0x00, 0x32, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0xF8, 
-    0xFF, 0xC8, 0x4E, 0x5E, 0x4E, 0x75, 0x9D, 0x73, 0x65, 0x65, 0x6B, 0x6F, 0x66, 0x66, 0x5F, 0x5F, 
-    0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x6C, 0x38, 0x73, 0x65, 0x65, 0x6B, 0x5F, 
-    0x64, 0x69, 0x72, 0x69, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x10, 0x70, 0x3C, 0x2F, 0x00, 0x4E, 0xBA, 0xBD, 0x1A, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x24, 0x2F, 0x0C, 0x4E, 0xBA, 0xF2, 0xDC, 0x28, 0x40, 0x29, 0x6D, 0xFF, 0xF4, 
-    0x00, 0x24, 0x70, 0xFF, 0x29, 0x40, 0x00, 0x28, 0x72, 0x00, 0x29, 0x41, 0x00, 0x2C, 0x42, 0x2C, 
-    0x00, 0x30, 0x29, 0x40, 0x00, 0x32, 0x58, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 
-    0x66, 0x46, 0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x20, 0x0C, 0x66, 0x10, 0x70, 0x3C, 0x2F, 0x00, 0x4E, 0xBA, 0xBC, 0xBA, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x67, 0x28, 0x2F, 0x0C, 0x4E, 0xBA, 0xF2, 0x7C, 0x28, 0x40, 0x29, 0x6D, 0xFF, 0xF4, 
-    0x00, 0x24, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x28, 0x70, 0x00, 0x29, 0x40, 0x00, 0x2C, 0x19, 0x7C, 
-    0x00, 0x01, 0x00, 0x30, 0x72, 0xFF, 0x29, 0x41, 0x00, 0x32, 0x58, 0x4F, 0x20, 0x0C, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x90, 0x5F, 0x5F, 0x63, 0x74, 0x5F, 0x5F, 0x37, 0x66, 0x69, 
-    0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x69, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x28, 0x6E, 0x00, 0x08, 0x20, 0x0C, 0x67, 0x30, 0x29, 0x6D, 0xFF, 0xF4, 0x00, 0x24, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xFA, 0xCE, 0x20, 0x0C, 0x58, 0x4F, 0x67, 0x1E, 0x70, 0x00, 0x2F, 0x00, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0xF2, 0xD8, 0x20, 0x2E, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x50, 0x4F, 0x67, 0x08, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0xBC, 0x06, 0x58, 0x4F, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x90, 0x5F, 0x5F, 0x64, 0x74, 0x5F, 0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 
-    0x76, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x10, 0x18, 0x28, 0x6E, 0x00, 0x08, 
-    0x10, 0x2C, 0x00, 0x30, 0x48, 0x80, 0x48, 0xC0, 0x67, 0x0A, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x5A, 0x70, 0x00, 0x26, 0x40, 0x2D, 0x40, 0xFF, 0xFC, 0x76, 0x00, 0x4A, 0x54, 
-    0x67, 0x08, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x02, 0x76, 0x01, 0x4A, 0x03, 0x67, 0x0E, 0x2F, 0x2C, 
-    0x00, 0x04, 0x4E, 0xBA, 0xBB, 0xA6, 0x70, 0x00, 0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x29, 0x4B, 
-    0x00, 0x04, 0xB7, 0xEE, 0xFF, 0xFC, 0x55, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x2E, 0xFF, 0xFC, 
-    0x90, 0x8B, 0x60, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x20, 0x42, 0x54, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0xEF, 0xF6, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 
-    0x18, 0x08, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x94, 0x73, 0x65, 0x74, 0x62, 0x75, 0x66, 0x5F, 
-    0x5F, 0x37, 0x66, 0x69, 0x6C, 0x65, 0x62, 0x75, 0x66, 0x46, 0x50, 0x63, 0x69, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0xAD, 0x03, 0x92, 0x4E, 0x5E, 0x4E, 0x75, 0x95, 0x5F, 0x5F, 0x70, 
-    0x75, 0x72, 0x65, 0x5F, 0x76, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6C, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 
-    0x65, 0x64, 0x00, 0x00, 0x22, 0x1F, 0x20, 0x17, 0x2E, 0x81, 0x2F, 0x0B, 0x3F, 0x03, 0x4A, 0x80, 
-    0x66, 0x00, 0x00, 0x80, 0x42, 0x38, 0x0A, 0x5E, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 
-    0x42, 0x67, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x12, 0x26, 0x40, 0x42, 0x43, 0x55, 0x4F, 0xA9, 0x94, 
-    0x55, 0x4F, 0x2F, 0x0B, 0xA9, 0xA4, 0xBF, 0x4F, 0x67, 0x3C, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 
-    0x75, 0x72, 0x3F, 0x3C, 0x00, 0x01, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x0A, 0x50, 0xF8, 0x0A, 0x5E, 
-    0x2B, 0x40, 0xFF, 0xF8, 0x60, 0x74, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x3C, 
-    0x00, 0x02, 0xA9, 0xA0, 0x20, 0x1F, 0x67, 0x08, 0x26, 0x40, 0x36, 0x3C, 0x00, 0x02, 0x60, 0x06, 
-    0x50, 0xF8, 0x0A, 0x5E, 0x60, 0x54, 0x50, 0xF8, 0x0A, 0x5E, 0x22, 0x13, 0x67, 0x04, 0x2F, 0x0B, 
-    0xA9, 0xA3, 0x59, 0x4F, 0x2F, 0x3C, 0x61, 0x63, 0x75, 0x72, 0x3F, 0x03, 0xA9, 0xA0, 0x20, 0x1F, 
-    0x67, 0x38, 0x2B, 0x40, 0xFF, 0xF8, 0x20, 0x40, 0xA0, 0x29, 0x26, 0x6D, 0xFF, 0xF8, 0x26, 0x53, 
-    0x36, 0x13, 0x6F, 0x26, 0x30, 0x03, 0xD0, 0x40, 0xD0, 0x40, 0x36, 0xC0, 0x58, 0x40, 0x36, 0xC0, 
-    0x53, 0x43, 0x59, 0x4F, 0x2F, 0x3C, 0x43, 0x55, 0x52, 0x53, 0x3F, 0x13, 0xA9, 0xA0, 0x26, 0xDF, 
-    0x57, 0xCB, 0xFF, 0xF0, 0x66, 0x04, 0x42, 0xAD, 0xFF, 0xF8, 0x36, 0x1F, 0x26, 0x5F, 0x4E, 0x75, 
-    0x20, 0x5F, 0x24, 0x1F, 0x6A, 0x0C, 0x02, 0x42, 0x00, 0x1F, 0x66, 0x04, 0x72, 0xFC, 0x60, 0x0A, 
-    0x4E, 0xD0, 0x02, 0x42, 0x00, 0x1F, 0x66, 0xF8, 0x72, 0x04, 0x2F, 0x08, 0x20, 0x2D, 0xFF, 0xF8, 
-    0x66, 0x10, 0x3F, 0x01, 0x42, 0xA7, 0x4E, 0xBA, 0xFF, 0x0C, 0x32, 0x1F, 0x20, 0x2D, 0xFF, 0xF8, 
-    0x67, 0x22, 0x22, 0x40, 0x22, 0x51, 0x34, 0x29, 0x00, 0x02, 0xD4, 0x41, 0x66, 0x04, 0x34, 0x11, 
-    0x60, 0x06, 0xB4, 0x51, 0x6F, 0x02, 0x74, 0x04, 0x33, 0x42, 0x00, 0x02, 0x22, 0x71, 0x20, 0x00, 
-    0x2F, 0x11, 0xA8, 0x51, 0x4E, 0x75, 0x24, 0x2D, 0xFF, 0xFC, 0x20, 0x5F, 0x30, 0x1F, 0x48, 0xC0, 
-    0x6E, 0x04, 0x6D, 0x0C, 0x74, 0x00, 0xD4, 0x80, 0x2B, 0x42, 0xFF, 0xFC, 0x4E, 0xFA, 0xFF, 0xA4, 
-    0xD4, 0x80, 0x2B, 0x42, 0xFF, 0xFC, 0x4E, 0xFA, 0xFF, 0x8E, 0x2B, 0x4C, 0x3D, 0x1B, 0x05, 0x09, 
-    0x0C, 0x04, 0x08, 0x14, 0x09, 0x0A, 0x80, 0x9C, 0x70, 0x18, 0x6D, 0x41, 0x04, 0x03, 0x3D, 0x1E, 
-    0x03, 0x3B, 0x80, 0x84, 0x0C, 0x03, 0x0C, 0x81, 0xA7, 0x80, 0x83, 0x0B, 0x0C, 0x80, 0xE5, 0x09, 
-    0x03, 0x09, 0x10, 0x78, 0x08, 0x2C, 0x4B, 0x0C, 0x4B, 0x11, 0x22, 0x03, 0x0A, 0x08, 0x03, 0x0B, 
-    0x03, 0x03, 0x0E, 0x05, 0x0D, 0x0B, 0x03, 0x08, 0x0D, 0x09, 0x1F, 0x0B, 0x1F, 0x04, 0x18, 0x11, 
-    0x08, 0x13, 0x04, 0x18, 0x07, 0x14, 0x04, 0x08, 0x14, 0x07, 0x14, 0x04, 0x08, 0x14, 0x07, 0x25, 
-    0x06, 0x0B, 0x03, 0x03, 0x0B, 0x07, 0x07, 0x1B, 0x08, 0x19, 0x04, 0x18, 0x0B, 0x13, 0x0F, 0x03, 
-    0x11, 0x03, 0x0E, 0x08, 0x03, 0x10, 0x05, 0x08, 0x2D, 0x13, 0x0A, 0x13, 0x6E, 0x13, 0x0A, 0x0E, 
-    0x0D, 0x26, 0x4D, 0x5C, 0x09, 0x05, 0x0D, 0x06, 0x0F, 0x12, 0x12, 0x0D, 0x03, 0x0B, 0x1E, 0x06, 
-    0x23, 0x09, 0x05, 0x0D, 0x06, 0x0F, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0D, 0x03, 0x0B, 0x1E, 0x06, 
-    0x23, 0x09, 0x05, 0x0D, 0x06, 0x0F, 0x0F, 0x12, 0x12, 0x12, 0x1A, 0x12, 0x12, 0x0D, 0x03, 0x0B, 
-    0x1E, 0x06, 0x24, 0x09, 0x05, 0x0D, 0x06, 0x0F, 0x12, 0x12, 0x12, 0x1F, 0x03, 0x0B, 0x1E, 0x06, 
-    0x23, 0x04, 0x18, 0x07, 0x16, 0x04, 0x18, 0x07, 0x14, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 
-    0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 
-    0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 
-    0x03, 0x06, 0x03, 0x03, 0x1F, 0x05, 0x07, 0x05, 0x53, 0x30, 0x81, 0x4C, 0x80, 0x82, 0x81, 0x01, 
-    0x33, 0x27, 0x81, 0x90, 0x81, 0x15, 0x3F, 0x1D, 0x23, 0x80, 0x8F, 0x2D, 0x53, 0x7A, 0x78, 0x05, 
-    0x81, 0x0C, 0x0F, 0x0C, 0x40, 0x09, 0x18, 0x09, 0x67, 0x22, 0x5E, 0x38, 0x06, 0x09, 0x0D, 0x3E, 
-    0x3E, 0x3C, 0x15, 0x06, 0x5B, 0x80, 0xB0, 0x03, 0x05, 0x04, 0x80, 0xAA, 0x3F, 0x36, 0x34, 0x14, 
-    0x4B, 0x0A, 0x07, 0x0D, 0x0F, 0x08, 0x08, 0x08, 0x4B, 0x17, 0x21, 0x53, 0x11, 0x52, 0x2E, 0x81, 
-    0x08, 0x3E, 0x3D, 0x79, 0x03, 0x2C, 0x28, 0x0F, 0x21, 0x05, 0x0A, 0x03, 0x03, 0x0E, 0x05, 0x0D, 
-    0x0B, 0x03, 0x08, 0x0D, 0x09, 0x0C, 0x03, 0x03, 0x0B, 0x0D, 0x2B, 0x25, 0x0A, 0x17, 0x04, 0x0D, 
-    0x12, 0x76, 0x3B, 0x81, 0x61, 0x5C, 0x12, 0x76, 0x30, 0x66, 0x03, 0x05, 0x34, 0x30, 0x11, 0x0B, 
-    0x2F, 0x5E, 0x4A, 0x80, 0xA6, 0x21, 0x0D, 0x35, 0x0D, 0x3C, 0x04, 0x08, 0x04, 0x08, 0x04, 0x02, 
-    0x05, 0x23, 0x0E, 0x05, 0x04, 0x03, 0x04, 0x03, 0x0B, 0x0B, 0x34, 0x3C, 0x3D, 0x07, 0x11, 0x05, 
-    0x06, 0x0F, 0x28, 0x03, 0x0E, 0x03, 0x25, 0x6B, 0x69, 0x6C, 0x0C, 0x0B, 0x0C, 0x81, 0x70, 0x1D, 
-    0x28, 0x2F, 0x11, 0x40, 0x05, 0x09, 0x0D, 0x04, 0x1E, 0x04, 0x28, 0x04, 0x2A, 0x04, 0x21, 0x09, 
-    0x25, 0x2D, 0x1B, 0x0B, 0x20, 0x10, 0x13, 0x06, 0x16, 0x0E, 0x23, 0x05, 0x04, 0x0C, 0x04, 0x04, 
-    0x0A, 0x16, 0x25, 0x0B, 0x04, 0x5C, 0x25, 0x03, 0x03, 0x20, 0x2A, 0x6E, 0x25, 0x58, 0x08, 0x09, 
-    0x1A, 0x05, 0x12, 0x03, 0x03, 0x03, 0x03, 0x20, 0x04, 0x03, 0x15, 0x0C, 0x03, 0x0D, 0x03, 0x03, 
-    0x03, 0x03, 0x1C, 0x05, 0x12, 0x03, 0x03, 0x03, 0x03, 0x27, 0x03, 0x0F, 0x03, 0x0C, 0x5B, 0x03, 
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x41, 0x10, 0x06, 0x0E, 0x06, 0x0F, 0x10, 0x05, 0x33, 0x08, 0x05, 
-    0x26, 0x08, 0x05, 0x0D, 0x27, 0x06, 0x1D, 0x00, 0x00, 0x1E, 0x10, 0x31, 0x1B, 0x25, 0x41, 0x1C, 
-    0x19, 0x28, 0x0B, 0x80, 0xE3, 0x07, 0x11, 0x08, 0x33, 0x7A, 0x33, 0x53, 0x0C, 0x17, 0x2B, 0x49, 
-    0x0F, 0x05, 0x16, 0x6A, 0x35, 0x06, 0x17, 0x1E, 0x3C, 0x24, 0x3C, 0x12, 0x24, 0x06, 0x50, 0x19, 
-    0x0B, 0x0C, 0x2D, 0x21, 0x08, 0x4A, 0x06, 0x3F, 0x0C, 0x0F, 0x19, 0x7B, 0x2B, 0x80, 0x99, 0x1A, 
-    0x0C, 0x14, 0x08, 0x0E, 0x0F, 0x05, 0x0E, 0x0A, 0x05, 0x14, 0x0A, 0x09, 0x0C, 0x09, 0x0A, 0x0B, 
-    0x23, 0x18, 0x11, 0x1F, 0x18, 0x1F, 0x1C, 0x1F, 0x1C, 0x2C, 0x0B, 0x0F, 0x0F, 0x09, 0x08, 0x11, 
-    0x08, 0x1D, 0x18, 0x05, 0x19, 0x15, 0x14, 0x0B, 0x0E, 0x07, 0x0B, 0x0B, 0x2A, 0x13, 0x0A, 0x13, 
-    0x08, 0x0B, 0x09, 0x10, 0x10, 0x07, 0x2B, 0x13, 0x0A, 0x0E, 0x0D, 0x26, 0x0F, 0x0B, 0x09, 0x10, 
-    0x1A, 0x13, 0x0B, 0x09, 0x11, 0x27, 0x0E, 0x0A, 0x0F, 0x08, 0x12, 0x12, 0x0E, 0x05, 0x18, 0x0C, 
-    0x0F, 0x1D, 0x0E, 0x0A, 0x0F, 0x08, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0E, 0x05, 0x18, 0x0C, 0x0F, 
-    0x1D, 0x0E, 0x0A, 0x0F, 0x08, 0x0F, 0x12, 0x12, 0x12, 0x1A, 0x12, 0x12, 0x0E, 0x05, 0x18, 0x0C, 
-    0x0F, 0x1E, 0x0E, 0x0A, 0x0F, 0x08, 0x12, 0x12, 0x12, 0x10, 0x10, 0x05, 0x18, 0x0C, 0x0F, 0x1E, 
-    0x18, 0x21, 0x18, 0x27, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 
-    0x0C, 0x31, 0x05, 0x05, 0x05, 0x05, 0x05, 0x23, 0x1C, 0x30, 0x0B, 0x4F, 0x11, 0x4A, 0x0D, 0x2A, 
-    0x20, 0x14, 0x1D, 0x13, 0x14, 0x5B, 0x12, 0x17, 0x65, 0x54, 0x0B, 0x10, 0x1D, 0x0A, 0x0B, 0x1C, 
-    0x0F, 0x1E, 0x06, 0x16, 0x19, 0x09, 0x2C, 0x63, 0x5D, 0x54, 0x1E, 0x54, 0x0B, 0x10, 0x1F, 0x69, 
-    0x07, 0x0F, 0x0F, 0x1A, 0x1D, 0x0E, 0x0A, 0x1A, 0x1E, 0x71, 0x1E, 0x0C, 0x04, 0x0D, 0x0B, 0x10, 
-    0x1B, 0x13, 0x10, 0x1C, 0x1B, 0x20, 0x59, 0x11, 0x13, 0x73, 0x33, 0x22, 0x0A, 0x09, 0x12, 0x09, 
-    0x14, 0x11, 0x12, 0x80, 0x80, 0x2F, 0x23, 0x0C, 0x12, 0x1D, 0x0C, 0x35, 0x0C, 0x1E, 0x2A, 0x0C, 
-    0x32, 0x0C, 0x32, 0x0C, 0x24, 0x0F, 0x0D, 0x12, 0x16, 0x0B, 0x2E, 0x80, 0xA2, 0x33, 0x37, 0x07, 
-    0x09, 0x1A, 0x0C, 0x29, 0x0C, 0x1E, 0x13, 0x0C, 0x2A, 0x0C, 0x2D, 0x17, 0x0E, 0x27, 0x0F, 0x0D, 
-    0x1C, 0x10, 0x08, 0x2E, 0x4D, 0x0B, 0x07, 0x14, 0x0B, 0x2E, 0x17, 0x19, 0x0C, 0x26, 0x0C, 0x2B, 
-    0x0D, 0x0C, 0x0B, 0x1C, 0x0B, 0x1E, 0x23, 0x29, 0x17, 0x0A, 0x29, 0x0A, 0x22, 0x12, 0x0A, 0x22, 
-    0x11, 0x0A, 0x21, 0x32, 0x0C, 0x1F, 0x05, 0x0C, 0x0C, 0x06, 0x08, 0x08, 0x07, 0x0B, 0x09, 0x06, 
-    0x0C, 0x1E, 0x0F, 0x05, 0x0E, 0x0A, 0x05, 0x14, 0x0A, 0x09, 0x06, 0x0F, 0x0B, 0x13, 0x05, 0x0C, 
-    0x0B, 0x06, 0x06, 0x08, 0x08, 0x07, 0x0C, 0x06, 0x0C, 0x13, 0x0F, 0x2F, 0x53, 0x26, 0x15, 0x26, 
-    0x27, 0x08, 0x27, 0x2B, 0x13, 0x23, 0x3C, 0x34, 0x14, 0x09, 0x41, 0x12, 0x08, 0x0A, 0x3D, 0x39, 
-    0x30, 0x58, 0x22, 0x28, 0x30, 0x07, 0x0A, 0x0B, 0x2F, 0x23, 0x3B, 0x17, 0x33, 0x62, 0x08, 0x3C, 
-    0x25, 0x0F, 0x33, 0x0F, 0x3A, 0x0C, 0x19, 0x21, 0x20, 0x0B, 0x0C, 0x0F, 0x14, 0x13, 0x30, 0x11, 
-    0x33, 0x27, 0x10, 0x16, 0x11, 0x81, 0x02, 0x0C, 0x11, 0x24, 0x33, 0x17, 0x2D, 0x1B, 0x22, 0x2B, 
-    0x09, 0x25, 0x1F, 0x80, 0x98, 0x1D, 0x5E, 0x27, 0x04, 0x04, 0x29, 0x05, 0x10, 0x04, 0x08, 0x17, 
-    0x04, 0x08, 0x08, 0x17, 0x04, 0x08, 0x08, 0x1B, 0x04, 0x33, 0x0C, 0x25, 0x06, 0x80, 0xCB, 0x11, 
-    0x0E, 0x0C, 0x12, 0x10, 0x09, 0x15, 0x56, 0x4B, 0x2A, 0x12, 0x2D, 0x0C, 0x26, 0x25, 0x21, 0x24, 
-    0x10, 0x08, 0x09, 0x1F, 0x05, 0x1B, 0x3A, 0x05, 0x0A, 0x1B, 0x1F, 0x05, 0x1B, 0x28, 0x05, 0x0D, 
-    0x05, 0x16, 0x5E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x05, 0x1A, 0x22, 0x1D, 0x18, 0x15, 0x1B, 
-    0x17, 0x1C, 0x12, 0x12, 0x0D, 0x10, 0x1D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBC, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 
-    0x63, 0x6F, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x63, 0x6F, 0x52, 0x65, 0x61, 0x64, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x63, 0x6F, 0x57, 0x72, 
-    0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x63, 0x6F, 0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x63, 0x6F, 0x45, 0x78, 0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x66, 0x73, 0x46, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x73, 0x43, 0x6C, 
-    0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x66, 0x73, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x88, 0x5F, 0x66, 0x73, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x73, 0x49, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x73, 0x79, 0x46, 0x41, 0x63, 0x63, 
-    0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x73, 0x79, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x87, 0x5F, 0x73, 0x79, 0x52, 0x65, 0x61, 0x64, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x57, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x73, 0x79, 0x49, 0x6F, 0x63, 0x74, 
-    0x6C, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 
-    0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 
-    0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 
-    0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 
-    0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 
-    0x87, 0x5F, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x66, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x28, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x01, 0x08, 0x70, 0xFF, 
-    0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x03, 0x10, 0x28, 0x40, 0x20, 0x0C, 
-    0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x42, 0x30, 0x2E, 0x00, 0x0E, 0x52, 0x40, 0x38, 0x80, 
-    0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x2F, 0x0C, 0x48, 0x78, 0x64, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x48, 0x6E, 0xFF, 0xF8, 0x4E, 0xBA, 0x07, 0x98, 0x2E, 0x00, 0x4F, 0xEF, 
-    0x00, 0x10, 0x67, 0x06, 0x42, 0x54, 0x70, 0xFF, 0x60, 0x10, 0x4A, 0xAC, 0x00, 0x04, 0x66, 0x06, 
-    0x29, 0x6E, 0xFF, 0xF8, 0x00, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x01, 0x08, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 
-    0x2F, 0x01, 0x4E, 0xBA, 0x06, 0x22, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x40, 0x48, 0x6E, 0x00, 0x08, 
-    0x4E, 0xBA, 0x02, 0x88, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x2C, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x08, 0x4E, 0x91, 0x2E, 0x00, 0x42, 0x54, 
-    0x4A, 0x87, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 
-    0x4E, 0xBA, 0x05, 0xE4, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x10, 0x80, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 
-    0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0xAC, 0x70, 0xFF, 0x50, 0x4F, 
-    0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x02, 0x12, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x01, 0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 
-    0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x05, 0x80, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 
-    0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 
-    0x00, 0x0C, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 
-    0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x05, 0x50, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 
-    0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x72, 
-    0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 0x2C, 0x2E, 
-    0x00, 0x10, 0x4A, 0xAE, 0x00, 0x08, 0x6C, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 
-    0x4E, 0xBA, 0x05, 0x14, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x62, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 
-    0x01, 0x7A, 0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4E, 0x70, 0x02, 
-    0xC0, 0x54, 0x66, 0x12, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0xE8, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x36, 0x29, 0x46, 0x00, 0x0C, 0x29, 0x6E, 0x00, 0x0C, 0x00, 0x10, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x10, 0x4E, 0x91, 0x2E, 0x00, 0x58, 0x4F, 
-    0x67, 0x14, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x04, 0xB8, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x06, 0x20, 0x06, 0x90, 0xAC, 0x00, 0x0C, 0x4C, 0xEE, 0x10, 0xC0, 
-    0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x26, 0x6E, 0x00, 0x10, 0x4A, 0xAE, 
-    0x00, 0x08, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0x78, 
-    0x70, 0xFF, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xD2, 0x48, 0x6E, 0x00, 0x08, 0x4E, 0xBA, 0x00, 0xDC, 
-    0x28, 0x40, 0x20, 0x0C, 0x58, 0x4F, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xBC, 0x20, 0x06, 
-    0x04, 0x80, 0x00, 0x00, 0x66, 0x01, 0x67, 0x32, 0x2F, 0x0B, 0x2F, 0x06, 0x2F, 0x0C, 0x20, 0x6C, 
-    0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x06, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0x94, 0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 
-    0x4E, 0xBA, 0x04, 0x24, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x7E, 0x20, 0x0B, 0x6C, 0x12, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x04, 0x0E, 0x70, 0xFF, 0x50, 0x4F, 0x60, 0x68, 
-    0x70, 0xFF, 0x90, 0x8B, 0x2D, 0x40, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xBA, 0x00, 0x6C, 
-    0x26, 0x40, 0x20, 0x0B, 0x58, 0x4F, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x4C, 0x48, 0x6E, 0x00, 0x08, 
-    0x4E, 0xBA, 0x00, 0x58, 0x28, 0x40, 0x20, 0x4B, 0x22, 0x4C, 0x70, 0x04, 0x20, 0xD9, 0x51, 0xC8, 
-    0xFF, 0xFC, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x01, 0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 
-    0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x16, 0x42, 0x53, 
-    0x30, 0x2C, 0x00, 0x02, 0x48, 0xC0, 0x2F, 0x00, 0x2F, 0x07, 0x4E, 0xBA, 0x03, 0xAA, 0x70, 0xFF, 
-    0x50, 0x4F, 0x60, 0x04, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x69, 0x6F, 0x63, 0x74, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x11, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x4A, 0x6D, 0xFA, 0x4A, 0x66, 0x04, 0x4E, 0xBA, 0x01, 0x2A, 
-    0x30, 0x2D, 0xFA, 0x4A, 0x48, 0xC0, 0x81, 0xFC, 0x00, 0x14, 0x48, 0xC0, 0x2E, 0x00, 0x53, 0x87, 
-    0x4A, 0x93, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x20, 0x13, 0x60, 0x04, 0x70, 0xFF, 0x90, 0x93, 
-    0xBE, 0x80, 0x6C, 0x14, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x16, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x48, 
-    0x70, 0x00, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xDA, 0x4A, 0x93, 0x6D, 0x2E, 0x20, 0x6D, 0xFA, 0x4C, 
-    0x20, 0x13, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x4A, 0x54, 
-    0x66, 0x00, 0x00, 0xBC, 0x70, 0x00, 0x2F, 0x00, 0x72, 0x09, 0x2F, 0x01, 0x4E, 0xBA, 0x03, 0x18, 
-    0x70, 0x00, 0x28, 0x40, 0x50, 0x4F, 0x60, 0x00, 0x00, 0xA6, 0x70, 0xFF, 0x90, 0x93, 0x20, 0x6D, 
-    0xFA, 0x4C, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0x49, 0xF0, 0x08, 0x00, 0x60, 0x08, 
-    0x4A, 0x54, 0x67, 0x18, 0x49, 0xEC, 0x00, 0x14, 0x20, 0x6D, 0xFA, 0x4C, 0x20, 0x07, 0xE5, 0x88, 
-    0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0xD1, 0xC0, 0xB1, 0xCC, 0x64, 0xE4, 0x20, 0x6D, 0xFA, 0x4C, 
-    0x20, 0x07, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 0xD1, 0xC0, 0xB1, 0xCC, 0x64, 0x4E, 
-    0x30, 0x2D, 0xFA, 0x4A, 0x48, 0xC0, 0xD0, 0xBC, 0x00, 0x00, 0x01, 0x90, 0x2F, 0x00, 0x2F, 0x2D, 
-    0xFA, 0x4C, 0x4E, 0xBA, 0x03, 0x58, 0x2D, 0x40, 0xFF, 0xFC, 0x50, 0x4F, 0x66, 0x12, 0x70, 0x00, 
-    0x2F, 0x00, 0x72, 0x18, 0x2F, 0x01, 0x4E, 0xBA, 0x02, 0x9E, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x30, 
-    0x20, 0x07, 0x52, 0x80, 0x20, 0x6E, 0xFF, 0xFC, 0xE5, 0x88, 0x22, 0x00, 0xE5, 0x88, 0xD0, 0x81, 
-    0x49, 0xF0, 0x08, 0x00, 0x06, 0x6D, 0x01, 0x90, 0xFA, 0x4A, 0x2B, 0x48, 0xFA, 0x4C, 0x20, 0x6D, 
-    0xFA, 0x4C, 0x20, 0x0C, 0x90, 0x88, 0x72, 0x14, 0x4E, 0xAD, 0x01, 0x22, 0x26, 0x80, 0x20, 0x0C, 
-    0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 0x8A, 0x5F, 0x67, 0x65, 0x74, 0x49, 
-    0x4F, 0x50, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x3B, 0x7C, 
-    0x01, 0x90, 0xFA, 0x4A, 0x48, 0x78, 0x01, 0x90, 0x70, 0x00, 0x2F, 0x00, 0x4E, 0xBA, 0x02, 0xDE, 
-    0x2B, 0x40, 0xFA, 0x4C, 0x4A, 0xAD, 0xFA, 0x54, 0x50, 0x4F, 0x67, 0x46, 0x22, 0x6D, 0xFA, 0x54, 
-    0x20, 0x69, 0x00, 0x1C, 0x22, 0x6D, 0xFA, 0x4C, 0x70, 0x3C, 0xA0, 0x2E, 0x20, 0x6D, 0xFA, 0x4C, 
-    0x49, 0xD0, 0x60, 0x20, 0x4A, 0x54, 0x67, 0x18, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x78, 0x66, 0x01, 
-    0x2F, 0x0C, 0x20, 0x6C, 0x00, 0x04, 0x22, 0x68, 0x00, 0x14, 0x4E, 0x91, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x49, 0xEC, 0x00, 0x14, 0x20, 0x6D, 0xFA, 0x4C, 0x41, 0xE8, 0x00, 0x28, 0xB1, 0xCC, 0x64, 0xD4, 
-    0x60, 0x28, 0x70, 0x00, 0x2F, 0x00, 0x48, 0x7A, 0x00, 0x54, 0x4E, 0xBA, 0xFB, 0x2A, 0x70, 0x01, 
-    0x2F, 0x00, 0x48, 0x7A, 0x00, 0x48, 0x4E, 0xBA, 0xFB, 0x1E, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x7A, 
-    0x00, 0x3C, 0x4E, 0xBA, 0xFB, 0x12, 0x4F, 0xEF, 0x00, 0x18, 0x41, 0xED, 0x03, 0x72, 0x22, 0x6D, 
-    0xFA, 0x46, 0x23, 0x48, 0x00, 0x04, 0x4A, 0xAD, 0xFA, 0x42, 0x66, 0x08, 0x41, 0xED, 0xF9, 0xE4, 
-    0x2B, 0x48, 0xFA, 0x42, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x8D, 0x5F, 0x69, 0x6E, 
-    0x69, 0x74, 0x49, 0x4F, 0x50, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x64, 0x65, 0x76, 0x3A, 
-    0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x00, 
-    0x30, 0x2D, 0xFA, 0x4A, 0x48, 0xC0, 0x81, 0xFC, 0x00, 0x14, 0x48, 0xC0, 0x2C, 0x00, 0x53, 0x86, 
-    0x7E, 0x00, 0x60, 0x0A, 0x2F, 0x07, 0x4E, 0xBA, 0xFB, 0x24, 0x58, 0x4F, 0x52, 0x87, 0xBC, 0x87, 
-    0x6C, 0xF2, 0x4A, 0xAD, 0xFA, 0x2C, 0x67, 0x04, 0x4E, 0xAD, 0x02, 0xEA, 0x4C, 0xEE, 0x00, 0xC0, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x8B, 0x5F, 0x63, 0x6F, 0x72, 0x65, 0x49, 0x4F, 0x45, 0x78, 
-    0x69, 0x74, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x07, 0x7E, 0x00, 0x30, 0x2E, 0x00, 0x0A, 
-    0x04, 0x40, 0xFF, 0x88, 0x67, 0x00, 0x01, 0x08, 0x04, 0x40, 0x00, 0x0C, 0x67, 0x00, 0x00, 0xC4, 
-    0x04, 0x40, 0x00, 0x2F, 0x67, 0x00, 0x00, 0xF0, 0x53, 0x40, 0x67, 0x00, 0x00, 0x86, 0x53, 0x40, 
-    0x67, 0x00, 0x00, 0xA8, 0x53, 0x40, 0x67, 0x00, 0x00, 0x8E, 0x53, 0x40, 0x67, 0x00, 0x00, 0xAC, 
-    0x53, 0x40, 0x67, 0x00, 0x00, 0xA2, 0x53, 0x40, 0x67, 0x00, 0x00, 0xC4, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0xAA, 0x53, 0x40, 0x67, 0x00, 0x00, 0xB4, 0x55, 0x40, 0x67, 0x00, 0x00, 0xA6, 0x53, 0x40, 
-    0x67, 0x00, 0x00, 0x94, 0x53, 0x40, 0x67, 0x00, 0x00, 0x8A, 0x53, 0x40, 0x67, 0x50, 0x53, 0x40, 
-    0x67, 0x58, 0x53, 0x40, 0x67, 0x00, 0x00, 0x9C, 0x53, 0x40, 0x67, 0x52, 0x53, 0x40, 0x67, 0x00, 
-    0x00, 0x9A, 0x53, 0x40, 0x67, 0x4C, 0x53, 0x40, 0x67, 0x7C, 0x55, 0x40, 0x67, 0x70, 0x53, 0x40, 
-    0x67, 0x30, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 0x67, 0x1C, 0x53, 0x40, 0x67, 0x40, 0x53, 0x40, 
-    0x67, 0x4C, 0x53, 0x40, 0x67, 0x14, 0x53, 0x40, 0x67, 0x10, 0x04, 0x40, 0x00, 0x21, 0x67, 0x70, 
-    0x60, 0x6E, 0x7E, 0x14, 0x60, 0x6A, 0x7E, 0x0E, 0x60, 0x66, 0x7E, 0x1C, 0x60, 0x62, 0x7E, 0x11, 
-    0x60, 0x5E, 0x7E, 0x06, 0x60, 0x5A, 0x7E, 0x14, 0x60, 0x56, 0x7E, 0x1F, 0x60, 0x52, 0x7E, 0x10, 
-    0x60, 0x4E, 0x7E, 0x02, 0x60, 0x4A, 0x7E, 0x09, 0x60, 0x46, 0x7E, 0x04, 0x60, 0x42, 0x7E, 0x05, 
-    0x60, 0x3E, 0x7E, 0x0C, 0x60, 0x3A, 0x7E, 0x06, 0x60, 0x36, 0x7E, 0x14, 0x60, 0x32, 0x7E, 0x06, 
-    0x60, 0x2E, 0x7E, 0x1A, 0x60, 0x2A, 0x7E, 0x16, 0x60, 0x26, 0x7E, 0x0D, 0x60, 0x22, 0x7E, 0x1D, 
-    0x60, 0x1E, 0x7E, 0x09, 0x60, 0x1A, 0x7E, 0x17, 0x60, 0x16, 0x7E, 0x06, 0x60, 0x12, 0x7E, 0x10, 
-    0x60, 0x0E, 0x7E, 0x1E, 0x60, 0x0A, 0x7E, 0x0D, 0x60, 0x06, 0x7E, 0x1E, 0x60, 0x02, 0x7E, 0x14, 
-    0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x6D, 0x61, 0x70, 0x4F, 
-    0x53, 0x65, 0x72, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x3E, 0x2E, 
-    0x00, 0x0E, 0x3B, 0x47, 0xF9, 0x26, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0x00, 0x08, 
-    0x60, 0x0C, 0x48, 0xC7, 0x2F, 0x07, 0x4E, 0xBA, 0xFE, 0xAC, 0x4A, 0x80, 0x58, 0x4F, 0x2B, 0x40, 
-    0xF9, 0x28, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x75, 0x65, 
-    0x72, 0x72, 0x6F, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0x78, 0x03, 0x01, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xF9, 0x02, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x63, 0x72, 0x65, 0x61, 0x74, 
-    0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 0x48, 0xE7, 0x11, 0x00, 0x2D, 0x6E, 0x00, 0x10, 0xFF, 0xF8, 
-    0x2D, 0x6E, 0x00, 0x0C, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0xF8, 0x48, 0x78, 0x66, 0x00, 0x2F, 0x2E, 
-    0x00, 0x08, 0x4E, 0xBA, 0xFA, 0xEA, 0x2E, 0x00, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 
-    0xFF, 0xFC, 0x60, 0x02, 0x70, 0xFF, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x6C, 0x73, 0x65, 0x65, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x07, 0x18, 0x2C, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0x00, 0x20, 0x0C, 
-    0x67, 0x18, 0x59, 0x8F, 0x2F, 0x0C, 0x4E, 0xAD, 0x01, 0x62, 0x2E, 0x1F, 0xBE, 0x86, 0x6F, 0x0A, 
-    0x20, 0x4C, 0x20, 0x06, 0xA0, 0x20, 0x20, 0x0C, 0x60, 0x3C, 0x20, 0x06, 0xA1, 0x1E, 0x2D, 0x48, 
-    0xFF, 0xFC, 0x4A, 0x78, 0x02, 0x20, 0x67, 0x04, 0x70, 0x00, 0x60, 0x2A, 0x20, 0x0C, 0x67, 0x0E, 
-    0x20, 0x4C, 0x22, 0x6E, 0xFF, 0xFC, 0x20, 0x07, 0xA0, 0x2E, 0x20, 0x4C, 0xA0, 0x1F, 0x2A, 0x2E, 
-    0xFF, 0xFC, 0x28, 0x45, 0xD9, 0xC7, 0x26, 0x45, 0xD7, 0xC6, 0x60, 0x02, 0x42, 0x1C, 0xB7, 0xCC, 
-    0x62, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x8F, 0x5F, 0x5F, 0x67, 0x72, 0x6F, 0x77, 0x46, 0x69, 0x6C, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x26, 0x6E, 
-    0x00, 0x0C, 0x4A, 0xAD, 0xFA, 0x50, 0x66, 0x08, 0x41, 0xED, 0xF9, 0x2C, 0x2B, 0x48, 0xFA, 0x50, 
-    0x20, 0x6D, 0xFA, 0x50, 0x49, 0xD0, 0x60, 0x0A, 0x4A, 0xAC, 0x00, 0x04, 0x67, 0x10, 0x49, 0xEC, 
-    0x00, 0x18, 0x20, 0x6D, 0xFA, 0x50, 0x41, 0xE8, 0x00, 0x78, 0xB1, 0xCC, 0x62, 0xEA, 0x2E, 0x3C, 
-    0x40, 0x00, 0x00, 0x06, 0x60, 0x16, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x06, 0x2F, 0x0B, 0x20, 0x6C, 
-    0x00, 0x04, 0x4E, 0x90, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x6C, 0x0C, 0x49, 0xEC, 0xFF, 0xE8, 
-    0x20, 0x6D, 0xFA, 0x50, 0xB1, 0xCC, 0x63, 0xDE, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x0E, 0x20, 0x6D, 
-    0xFA, 0x50, 0xB1, 0xCC, 0x62, 0x06, 0x20, 0x6E, 0x00, 0x08, 0x20, 0x8C, 0x20, 0x3C, 0x40, 0x00, 
-    0x00, 0x00, 0xC0, 0x87, 0x66, 0x04, 0x20, 0x07, 0x60, 0x1E, 0x3C, 0x07, 0x6C, 0x04, 0x7E, 0x00, 
-    0x60, 0x08, 0x02, 0x87, 0xBF, 0xFF, 0xFF, 0xFF, 0x42, 0x46, 0x48, 0xC6, 0x2F, 0x06, 0x2F, 0x07, 
-    0x4E, 0xBA, 0xFE, 0x34, 0x70, 0xFF, 0x50, 0x4F, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x88, 0x5F, 0x66, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x17, 0x18, 0x28, 0x6E, 0x00, 0x0C, 0x2A, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 
-    0xFA, 0x42, 0x66, 0x08, 0x41, 0xED, 0xF9, 0xE4, 0x2B, 0x48, 0xFA, 0x42, 0x7E, 0x00, 0x2C, 0x05, 
-    0x60, 0x16, 0x70, 0x10, 0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x16, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0xFF, 
-    0x60, 0x00, 0x00, 0xB6, 0x52, 0x87, 0xE2, 0x86, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xE4, 0x20, 0x07, 
-    0xE5, 0x40, 0x41, 0xED, 0xF9, 0xA4, 0x47, 0xF0, 0x00, 0x00, 0x20, 0x6D, 0xFA, 0x42, 0x70, 0x00, 
-    0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 0xC2, 0x80, 0x66, 0x08, 0x70, 0x03, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x60, 0x16, 0x41, 0xED, 0x01, 0x42, 0xB1, 0xD3, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x01, 
-    0x60, 0x02, 0x20, 0x13, 0x2D, 0x40, 0xFF, 0xFC, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x66, 0x0E, 
-    0x20, 0x6D, 0xFA, 0x42, 0x20, 0x05, 0x46, 0x80, 0xC1, 0x68, 0x00, 0x02, 0x60, 0x56, 0xB9, 0xFC, 
-    0x00, 0x00, 0x00, 0x05, 0x66, 0x36, 0x20, 0x6D, 0xFA, 0x42, 0x8B, 0x68, 0x00, 0x02, 0x70, 0x02, 
-    0xB0, 0x85, 0x66, 0x10, 0x20, 0x6D, 0xFA, 0x42, 0x70, 0x00, 0x30, 0x10, 0x22, 0x05, 0xC2, 0x80, 
-    0x66, 0xF2, 0x60, 0x30, 0x20, 0x6D, 0xFA, 0x42, 0x4A, 0x50, 0x67, 0x28, 0x20, 0x05, 0x46, 0x80, 
-    0xC1, 0x50, 0x2F, 0x05, 0x4E, 0xBA, 0x00, 0x36, 0x58, 0x4F, 0x60, 0x18, 0xB9, 0xFC, 0x00, 0x00, 
-    0x00, 0x01, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x41, 0xED, 0x01, 0x42, 0x20, 0x08, 0x60, 0x02, 
-    0x20, 0x0C, 0x26, 0x80, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xE8, 0xFF, 0xE4, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x07, 0x08, 0x2A, 0x2E, 0x00, 0x08, 0x4A, 0xAD, 0xFA, 0x42, 0x66, 0x08, 0x41, 0xED, 
-    0xF9, 0xE4, 0x2B, 0x48, 0xFA, 0x42, 0x7E, 0x00, 0x2C, 0x05, 0x60, 0x0E, 0x70, 0x10, 0xB0, 0x87, 
-    0x6E, 0x04, 0x70, 0xFF, 0x60, 0x4A, 0x52, 0x87, 0xE2, 0x86, 0x70, 0x01, 0xC0, 0x86, 0x67, 0xEC, 
-    0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xF9, 0xA4, 0x28, 0x70, 0x00, 0x00, 0x20, 0x0C, 0x66, 0x04, 
-    0x70, 0xFF, 0x60, 0x2C, 0x20, 0x6D, 0xFA, 0x42, 0x70, 0x00, 0x30, 0x28, 0x00, 0x02, 0x22, 0x05, 
-    0xC2, 0x80, 0x66, 0x06, 0x8B, 0x50, 0x70, 0xFF, 0x60, 0x16, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x05, 
-    0x4E, 0xBA, 0xFE, 0x9C, 0x2F, 0x05, 0x20, 0x4C, 0x4E, 0x90, 0x70, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xEE, 0x10, 0xE0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x72, 0x61, 0x69, 0x73, 0x65, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x01, 0x2F, 0x00, 0x4E, 0xBA, 0xFF, 0x70, 0x2F, 0x3C, 
-    0x01, 0x00, 0x00, 0x00, 0x4E, 0xAD, 0x01, 0x52, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x61, 0x62, 0x6F, 
-    0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x78, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x42, 0x67, 0x4C, 0xEF, 0x01, 0x03, 0x00, 0x06, 0xC1, 0x88, 0x48, 0xE7, 0xC0, 0x80, 0x48, 0x6F, 
-    0x00, 0x0C, 0x3F, 0x3C, 0x00, 0x04, 0xA9, 0xEE, 0x70, 0x00, 0x10, 0x1F, 0x20, 0x6F, 0x00, 0x10, 
-    0x30, 0x80, 0x4E, 0x75, 0x2F, 0x2F, 0x00, 0x04, 0x48, 0x6F, 0x00, 0x0C, 0x2F, 0x2F, 0x00, 0x1A, 
-    0x3F, 0x3C, 0x00, 0x0B, 0xA9, 0xEB, 0x4E, 0x75, 0x4E, 0x56, 0xFF, 0xF4, 0x2F, 0x2E, 0x00, 0x08, 
-    0x48, 0x6E, 0xFF, 0xF6, 0x3F, 0x3C, 0x00, 0x09, 0xA9, 0xEB, 0x4C, 0xEE, 0x01, 0x03, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x00, 0x00, 0x15, 0xF2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x48, 0xE7, 0x7F, 0xF8, 0x49, 0xFA, 0x01, 0xA8, 0x30, 0x2C, 0x00, 0x04, 0x53, 0x40, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x32, 0x26, 0x4D, 0x97, 0xD4, 0x2F, 0x0B, 0x2F, 0x14, 0x61, 0x00, 0x01, 0x4C, 
-    0x20, 0x2C, 0x00, 0x08, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 0x61, 0x00, 0x00, 0x2E, 0x50, 0x4F, 
-    0x20, 0x2C, 0x00, 0x0C, 0x48, 0x74, 0x08, 0x00, 0x2F, 0x0B, 0x2F, 0x0D, 0x61, 0x00, 0x00, 0xD0, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x70, 0x00, 0x4C, 0xDF, 0x1F, 0xFE, 0x4E, 0x75, 0x80, 0x09, 0x5F, 0x44, 
-    0x41, 0x54, 0x41, 0x49, 0x4E, 0x49, 0x54, 0x00, 0x00, 0x00, 0x22, 0x6F, 0x00, 0x04, 0x20, 0x6F, 
-    0x00, 0x08, 0x48, 0xE7, 0x18, 0x00, 0x76, 0x01, 0x72, 0x00, 0x12, 0x18, 0x24, 0x01, 0x02, 0x41, 
-    0x00, 0x0F, 0x66, 0x0A, 0x61, 0x00, 0x00, 0x44, 0x22, 0x00, 0x67, 0x24, 0x60, 0x02, 0xD2, 0x41, 
-    0x02, 0x42, 0x00, 0xF0, 0x66, 0x08, 0x61, 0x00, 0x00, 0x32, 0x24, 0x00, 0x60, 0x02, 0xE6, 0x4A, 
-    0xD3, 0xC2, 0x28, 0x01, 0x12, 0xD8, 0x53, 0x84, 0x66, 0xFA, 0x53, 0x83, 0x66, 0xF2, 0x60, 0xC6, 
-    0x4C, 0xDF, 0x00, 0x18, 0x4E, 0x75, 0x80, 0x10, 0x75, 0x6E, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 
-    0x73, 0x73, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 0x70, 0x00, 0x10, 0x18, 0x6A, 0x42, 
-    0x08, 0x00, 0x00, 0x06, 0x67, 0x34, 0x08, 0x00, 0x00, 0x05, 0x67, 0x20, 0x08, 0x00, 0x00, 0x04, 
-    0x67, 0x0A, 0x61, 0xE6, 0x26, 0x00, 0x61, 0xE2, 0xC1, 0x43, 0x4E, 0x75, 0x10, 0x18, 0xE1, 0x80, 
-    0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x02, 0x00, 0x00, 0x1F, 
-    0xE1, 0x80, 0x10, 0x18, 0xE1, 0x80, 0x10, 0x18, 0x4E, 0x75, 0x02, 0x00, 0x00, 0x3F, 0xE1, 0x80, 
-    0x10, 0x18, 0x4E, 0x75, 0x80, 0x06, 0x67, 0x65, 0x74, 0x5F, 0x72, 0x6C, 0x00, 0x00, 0x22, 0x2F, 
-    0x00, 0x04, 0x22, 0x6F, 0x00, 0x08, 0x20, 0x6F, 0x00, 0x0C, 0x74, 0x01, 0x70, 0x00, 0x10, 0x18, 
-    0x67, 0x0C, 0x6A, 0x26, 0x08, 0x80, 0x00, 0x07, 0xE1, 0x88, 0x10, 0x18, 0x60, 0x1C, 0x10, 0x18, 
-    0x67, 0x24, 0x6A, 0x0E, 0xE1, 0x88, 0x10, 0x18, 0xE1, 0x88, 0x10, 0x18, 0xE1, 0x88, 0x10, 0x18, 
-    0x60, 0x08, 0x24, 0x00, 0x61, 0x00, 0xFF, 0x74, 0xC1, 0x42, 0xD0, 0x80, 0xD3, 0xC0, 0xD3, 0x91, 
-    0x53, 0x82, 0x66, 0xF8, 0x60, 0xC4, 0x4E, 0x75, 0x80, 0x0E, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 
-    0x74, 0x65, 0x5F, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00, 0x00, 0x74, 0x00, 0x20, 0x5F, 0x20, 0x1F, 
-    0x22, 0x5F, 0x67, 0x28, 0x32, 0x09, 0x02, 0x41, 0x00, 0x03, 0x67, 0x08, 0x12, 0xC2, 0x53, 0x80, 
-    0x66, 0xF2, 0x60, 0x18, 0x22, 0x00, 0xE4, 0x89, 0x67, 0x06, 0x22, 0xC2, 0x53, 0x81, 0x66, 0xFA, 
-    0x02, 0x40, 0x00, 0x03, 0x60, 0x02, 0x12, 0xC2, 0x51, 0xC8, 0xFF, 0xFC, 0x4E, 0xD0, 0x80, 0x0A, 
-    0x5A, 0x45, 0x52, 0x4F, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x1D, 0xBE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0xBF, 0x00, 0x00, 
-    0x00, 0x00, 0x0F, 0x00, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 
-    0x79, 0x00, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x00, 
-    0x72, 0x62, 0x10, 0xF0, 0x12, 0x02, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x6F, 
-    0x70, 0x65, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 
-    0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x22, 0x25, 0x73, 0x22, 0x10, 0xF0, 0x2A, 0x02, 0x63, 0x6F, 
-    0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x47, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 
-    0x72, 0x63, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x25, 0x38, 0x58, 
-    0x20, 0x69, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 
-    0x20, 0x67, 0x65, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 0x73, 
-    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x23, 0x23, 
-    0x23, 0x20, 0x19, 0x20, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x20, 
-    0x76, 0x61, 0x6C, 0x75, 0x65, 0x10, 0x46, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x25, 
-    0x73, 0x22, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 
-    0x65, 0x6E, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x25, 0x6C, 0x64, 0x00, 0x6F, 
-    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 
-    0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x1E, 0x6D, 0x69, 
-    0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x6F, 
-    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x11, 0x2C, 0x20, 0x14, 0xFF, 0xFF, 
-    0xE3, 0x68, 0xFF, 0xFF, 0xE3, 0x98, 0x00, 0x01, 0x0F, 0x5A, 0x30, 0xF0, 0x02, 0x03, 0x02, 0xBA, 
-    0x02, 0xBA, 0x02, 0xBA, 0x00, 0x01, 0x17, 0x52, 0x00, 0xF0, 0x01, 0x03, 0x07, 0x3A, 0x42, 0x4A, 
-    0x70, 0x1D, 0xCC, 0x01, 0xD8, 0x01, 0x14, 0x00, 0xF0, 0x01, 0x3C, 0x00, 0x28, 0x00, 0xE4, 0x01, 
-    0xA0, 0x01, 0x6C, 0x00, 0x78, 0x00, 0xB4, 0x01, 0x50, 0x00, 0x9C, 0x01, 0x88, 0x01, 0x44, 0x00, 
-    0x80, 0x80, 0x03, 0xC0, 0xC1, 0xC1, 0x81, 0x01, 0x40, 0xC3, 0x01, 0x03, 0xC0, 0x02, 0x80, 0xC2, 
-    0x41, 0xC6, 0x01, 0x06, 0xC0, 0x07, 0x80, 0xC7, 0x41, 0x05, 0x00, 0xC5, 0xC1, 0xC4, 0x81, 0x04, 
-    0x40, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 
-    0x61, 0x74, 0x65, 0x20, 0x67, 0x47, 0x65, 0x6C, 0x61, 0x74, 0x6F, 0x50, 0x61, 0x67, 0x65, 0x54, 
-    0x61, 0x62, 0x6C, 0x65, 0x00, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x65, 0x78, 
-    0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x49, 0x44, 0x27, 0x73, 0x00, 0x65, 0x78, 0x74, 
-    0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x49, 0x44, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 
-    0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 
-    0x25, 0x6C, 0x64, 0x1C, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x61, 
-    0x72, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x1D, 0x6D, 0x75, 0x6C, 
-    0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x75, 0x66, 0x61, 0x63, 0x74, 0x75, 0x72, 
-    0x65, 0x72, 0x20, 0x69, 0x64, 0x27, 0x73, 0x10, 0x2C, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 
-    0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x22, 0x25, 0x73, 0x22, 0x20, 
-    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 
-    0x20, 0x66, 0x69, 0x6C, 0x65, 0x1A, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x64, 
-    0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69, 0x63, 0x73, 0x10, 0x30, 0x64, 0x69, 0x61, 0x67, 
-    0x6E, 0x6F, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x73, 0x69, 
-    0x7A, 0x65, 0x20, 0xD2, 0x25, 0x30, 0x34, 0x58, 0xD3, 0x20, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 
-    0x6E, 0x20, 0x28, 0x21, 0x3D, 0x20, 0x34, 0x4B, 0x2F, 0x31, 0x4B, 0x29, 0x10, 0x80, 0xE8, 0x65, 
-    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 
-    0x20, 0x6F, 0x72, 0x20, 0x72, 0x61, 0x77, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6C, 0x6F, 
-    0x63, 0x6B, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x61, 0x77, 0x20, 0x64, 0x61, 0x74, 0x61, 
-    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
-    0x64, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 
-    0x61, 0x6D, 0x65, 0x20, 0x00, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 
-    0x6F, 0x6E, 0x67, 0x20, 0x00, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x6F, 0x70, 
-    0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6B, 
-    0x20, 0x6F, 0x66, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0xD4, 0x2D, 0x41, 0x4C, 0x4C, 0xD5, 0x20, 
-    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x7A, 0x65, 0x72, 
-    0x6F, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 
-    0x69, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x16, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x6C, 0x65, 
-    0x6E, 0x67, 0x74, 0x68, 0x1C, 0x23, 0x20, 0x55, 0x6E, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 0x69, 
-    0x7A, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x1E, 0x62, 0x61, 
-    0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x73, 0x74, 
-    0x61, 0x72, 0x74, 0x00, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x16, 0x74, 0x61, 0x67, 0x00, 0x6C, 
-    0x61, 0x6E, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x10, 0x22, 0x6C, 0x61, 0x6E, 0x65, 0x63, 0x6F, 0x75, 
-    0x6E, 0x74, 0x00, 0x23, 0x20, 0x55, 0x6E, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 0x69, 0x7A, 0x65, 
-    0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x1E, 0x62, 0x61, 0x64, 0x20, 
-    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x6D, 0x61, 0x6E, 0x75, 
-    0x66, 0x61, 0x63, 0x74, 0x75, 0x72, 0x65, 0x72, 0x15, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x63, 
-    0x6F, 0x64, 0x65, 0x19, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x64, 0x65, 0x76, 0x69, 
-    0x63, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x14, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x76, 0x70, 0x70, 0x12, 
-    0x73, 0x69, 0x7A, 0x65, 0x10, 0x28, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x69, 0x7A, 0x65, 0x00, 
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x23, 0x20, 0x55, 0x6E, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 
-    0x69, 0x7A, 0x65, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x10, 0x38, 
-    0x62, 0x61, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 
-    0x6D, 0x69, 0x6E, 0x00, 0x6D, 0x61, 0x78, 0x00, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x00, 
-    0x23, 0x20, 0x55, 0x6E, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x6F, 
-    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x10, 0x2E, 0x62, 0x61, 0x64, 0x20, 0x6F, 0x70, 
-    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x00, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 
-    0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x61, 
-    0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x10, 0x36, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 
-    0x6C, 0x65, 0x20, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 
-    0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x00, 0x3C, 0x69, 0x6E, 0x74, 
-    0x3E, 0x20, 0x3A, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x64, 
-    0x11, 0x69, 0x64, 0x10, 0x42, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x3A, 0x20, 0x76, 0x69, 0x72, 
-    0x74, 0x75, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 
-    0x73, 0x73, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x3A, 
-    0x20, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 
-    0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x10, 0x2E, 0x70, 0x68, 0x79, 0x73, 0x73, 0x74, 0x61, 
-    0x72, 0x74, 0x00, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x3A, 0x20, 0x6D, 0x61, 0x6E, 0x75, 0x66, 
-    0x61, 0x63, 0x74, 0x75, 0x72, 0x65, 0x72, 0x20, 0x69, 0x64, 0x00, 0x6D, 0x61, 0x6E, 0x75, 0x66, 
-    0x61, 0x63, 0x74, 0x75, 0x72, 0x65, 0x72, 0x10, 0x3C, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x3A, 
-    0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 
-    0x00, 0x3C, 0x70, 0x6B, 0x67, 0x66, 0x69, 0x6C, 0x65, 0x3E, 0x20, 0x5B, 0x3C, 0x70, 0x74, 0x66, 
-    0x69, 0x6C, 0x65, 0x3E, 0x5D, 0x20, 0x3A, 0x20, 0x61, 0x64, 0x64, 0x20, 0x61, 0x20, 0x70, 0x61, 
-    0x63, 0x6B, 0x61, 0x67, 0x65, 0x10, 0x34, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x00, 0x3C, 
-    0x66, 0x69, 0x6C, 0x65, 0x3E, 0x20, 0x5B, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x5D, 0x3A, 0x20, 0x64, 
-    0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 
-    0x5B, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x73, 0x69, 0x7A, 0x65, 0x5D, 0x10, 0x80, 0x8C, 0x64, 0x69, 
-    0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00, 0x7B, 0x20, 0x73, 0x74, 0x61, 0x72, 
-    0x74, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3C, 
-    0x69, 0x6E, 0x74, 0x3E, 0x20, 0x7D, 0x20, 0x3A, 0x20, 0x52, 0x4F, 0x4D, 0x20, 0x63, 0x6F, 0x6E, 
-    0x66, 0x69, 0x67, 0x00, 0x52, 0x4F, 0x4D, 0x00, 0x7B, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 
-    0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3C, 0x69, 0x6E, 
-    0x74, 0x3E, 0x20, 0x74, 0x61, 0x67, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x6C, 0x61, 0x6E, 
-    0x65, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x6C, 0x61, 0x6E, 0x65, 
-    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x7D, 0x20, 0x3A, 0x20, 
-    0x52, 0x41, 0x4D, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x10, 0x80, 0xC0, 0x52, 0x41, 0x4D, 
-    0x00, 0x7B, 0x20, 0x6D, 0x61, 0x6E, 0x75, 0x66, 0x61, 0x63, 0x74, 0x75, 0x72, 0x65, 0x72, 0x20, 
-    0x3C, 0x30, 0x2D, 0x32, 0x35, 0x35, 0x3E, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x63, 0x6F, 
-    0x64, 0x65, 0x20, 0x3C, 0x30, 0x2D, 0x32, 0x35, 0x35, 0x3E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x6E, 0x61, 0x6C, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x3C, 0x30, 
-    0x2D, 0x32, 0x35, 0x35, 0x3E, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x76, 0x70, 0x70, 0x20, 0x3C, 
-    0x30, 0x2D, 0x31, 0x3E, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 
-    0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x7D, 0x20, 0x3A, 0x20, 
-    0x46, 0x6C, 0x61, 0x73, 0x68, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x00, 0x66, 0x6C, 0x61, 
-    0x73, 0x68, 0x00, 0x7B, 0x20, 0x6D, 0x69, 0x6E, 0x20, 0x30, 0x20, 0x6D, 0x61, 0x78, 0x20, 0x30, 
-    0x20, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x20, 0x30, 0x20, 0x7D, 0x20, 0x3A, 0x20, 0x52, 
-    0x41, 0x4D, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x10, 0x4A, 0x72, 
-    0x61, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x3C, 0x74, 0x61, 
-    0x67, 0x3E, 0x20, 0x7B, 0x20, 0x3C, 0x66, 0x69, 0x6C, 0x65, 0x3E, 0x20, 0x7C, 0x20, 0x3C, 0x72, 
-    0x61, 0x77, 0x3E, 0x20, 0x7D, 0x20, 0x5B, 0x3C, 0x70, 0x74, 0x66, 0x69, 0x6C, 0x65, 0x3E, 0x5D, 
-    0x20, 0x3A, 0x20, 0x61, 0x72, 0x62, 0x69, 0x74, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 
-    0x66, 0x69, 0x67, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x10, 0x52, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 
-    0x00, 0x3C, 0x74, 0x61, 0x67, 0x3E, 0x20, 0x3C, 0x66, 0x69, 0x6C, 0x65, 0x3E, 0x20, 0x3A, 0x20, 
-    0x61, 0x72, 0x62, 0x69, 0x74, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 
-    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x72, 0x65, 0x73, 0x6F, 
-    0x75, 0x72, 0x63, 0x65, 0x20, 0x28, 0x72, 0x65, 0x73, 0x54, 0x79, 0x70, 0x65, 0x3D, 0x20, 0x74, 
-    0x61, 0x67, 0x3B, 0x20, 0x72, 0x65, 0x73, 0x49, 0x44, 0x3D, 0x20, 0x30, 0x29, 0x14, 0x72, 0x65, 
-    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x10, 0x38, 0x3C, 0x69, 0x6E, 0x74, 0x3E, 0x20, 0x3A, 0x20, 
-    0x76, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x61, 
-    0x62, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 
-    0x73, 0x00, 0x70, 0x61, 0x74, 0x63, 0x68, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x61, 0x64, 0x64, 0x72, 
-    0x07, 0x26, 0x3A, 0xA4, 0x21, 0x00, 0x22, 0x3B, 0x20, 0x4C, 0x69, 0x6E, 0x65, 0x20, 0xA5, 0x21, 
-    0x18, 0x3C, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x3E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x20, 
-    0x22, 0x10, 0x58, 0x62, 0x61, 0x64, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x73, 
-    0x63, 0x61, 0x70, 0x65, 0x20, 0x27, 0x5C, 0x25, 0x63, 0x27, 0x00, 0x65, 0x6E, 0x64, 0x20, 0x6F, 
-    0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
-    0x00, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x72, 0x20, 
-    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x68, 
-    0x61, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x1E, 0x65, 0x6E, 0x64, 0x20, 
-    0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 
-    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x10, 0x28, 0x68, 0x65, 0x78, 0x20, 0x67, 0x72, 
-    0x6F, 0x75, 0x70, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x20, 
-    0x61, 0x74, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x61, 
-    0x72, 0x79, 0x1F, 0x62, 0x61, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 
-    0x20, 0x27, 0x25, 0x63, 0x27, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x61, 0x77, 0x20, 0x64, 0x61, 0x74, 
-    0x61, 0x19, 0x62, 0x61, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
-    0x27, 0x25, 0x63, 0x27, 0x10, 0x26, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x25, 
-    0x73, 0x00, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 
-    0x73, 0x69, 0x64, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x10, 0x58, 0x62, 0x61, 
-    0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x27, 0x2F, 0x27, 0x00, 
-    0xFF, 0xFF, 0xEC, 0x66, 0xFF, 0xFF, 0xEC, 0x5E, 0xFF, 0xFF, 0xEC, 0x56, 0xFF, 0xFF, 0xEC, 0x46, 
-    0xFF, 0xFF, 0xEC, 0x42, 0xFF, 0xFF, 0xEC, 0x3E, 0xFF, 0xFF, 0xEC, 0x3A, 0xFF, 0xFF, 0xEC, 0x36, 
-    0xFF, 0xFF, 0xEC, 0x32, 0x27, 0x3D, 0x27, 0x00, 0x27, 0x7D, 0x27, 0x00, 0x27, 0x7B, 0x27, 0x00, 
-    0x45, 0x4F, 0x46, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x72, 0x61, 0x77, 0x20, 0x64, 0x61, 0x74, 0x61, 
-    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x13, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x19, 0x69, 0x6E, 
-    0x74, 0x65, 0x67, 0x65, 0x72, 0x00, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 
-    0x32, 0x6E, 0x61, 0x6D, 0x65, 0x1C, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x00, 0x6D, 0x69, 0x6E, 0x6F, 
-    0x72, 0x00, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73, 0x00, 0x6E, 0x61, 0x6D, 0x65, 0x10, 0x20, 
-    0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x00, 0x6D, 0x69, 0x6E, 0x6F, 0x72, 0x00, 0x6F, 0x62, 0x6A, 0x65, 
-    0x63, 0x74, 0x73, 0x00, 0x5F, 0x45, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x10, 0xF0, 0x0C, 0x02, 0x5F, 0x49, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x54, 0x61, 0x62, 0x6C, 0x65, 
-    0x5F, 0x45, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x10, 0x3A, 0x6F, 0x75, 
-    0x74, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x00, 0x63, 0x6F, 0x75, 0x6C, 
-    0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20, 0x67, 
-    0x47, 0x65, 0x6C, 0x61, 0x74, 0x6F, 0x50, 0x61, 0x67, 0x65, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 
-    0xFF, 0xFF, 0xED, 0x0E, 0xFF, 0xFF, 0xED, 0x26, 0x71, 0x02, 0xBA, 0x00, 0x01, 0x17, 0xE2, 0xC0, 
-    0x22, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 
-    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3A, 0x20, 
-    0x25, 0x6C, 0x58, 0x10, 0x42, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 
-    0x72, 0x6F, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 
-    0x6C, 0x3A, 0x20, 0x25, 0x6C, 0x58, 0x00, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 
-    0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x66, 0x72, 0x61, 
-    0x6D, 0x65, 0x3A, 0x20, 0x25, 0x6C, 0x58, 0x10, 0x4A, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 
-    0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20, 
-    0x61, 0x72, 0x72, 0x61, 0x79, 0x3A, 0x20, 0x25, 0x6C, 0x58, 0x00, 0x49, 0x6E, 0x74, 0x65, 0x72, 
-    0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 
-    0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x73, 0x3A, 0x20, 
-    0x25, 0x6C, 0x64, 0x10, 0xF0, 0x16, 0x02, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x66, 
-    0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x70, 0x61, 0x63, 
-    0x6B, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 
-    0x74, 0x65, 0x64, 0x10, 0x5C, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 
-    0x72, 0x6F, 0x72, 0x3A, 0x20, 0x42, 0x65, 0x67, 0x69, 0x6E, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 
-    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x75, 0x70, 0x20, 0x74, 0x77, 0x69, 0x63, 0x65, 
-    0x00, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 
-    0x20, 0x42, 0x65, 0x67, 0x69, 0x6E, 0x52, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 
-    0x6E, 0x53, 0x65, 0x74, 0x75, 0x70, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 
-    0x64, 0x10, 0x80, 0x86, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 
-    0x6F, 0x72, 0x3A, 0x20, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 
-    0x70, 0x61, 0x72, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 
-    0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 
-    0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x73, 0x61, 
-    0x66, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x00, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 
-    0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x42, 0x65, 0x67, 0x69, 0x6E, 0x52, 
-    0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x65, 0x74, 0x75, 0x70, 0x20, 
-    0x6E, 0x6F, 0x74, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x10, 0xF0, 0x16, 0x02, 0x70, 0x61, 
-    0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 
-    0x70, 0x74, 0x65, 0x64, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x14, 0xFF, 0xFF, 0xED, 0x0E, 0xFF, 
-    0xFF, 0xEF, 0x50, 0x00, 0x01, 0x0F, 0xF2, 0x40, 0x34, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x73, 0x70, 
-    0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 
-    0x49, 0x44, 0x00, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 
-    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x10, 0xF0, 0x08, 
-    0x02, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x30, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 
-    0x31, 0x10, 0x3A, 0x54, 0x77, 0x6F, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x77, 
-    0x69, 0x74, 0x68, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x50, 0x54, 0x20, 0x6F, 0x66, 0x66, 0x73, 
-    0x65, 0x74, 0x20, 0x25, 0x30, 0x38, 0x6C, 0x58, 0x00, 0x62, 0x61, 0x64, 0x20, 0x70, 0x61, 0x74, 
-    0x63, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x10, 0x80, 0xC0, 
-    0x72, 0x00, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x22, 0x25, 0x73, 
-    0x22, 0x00, 0x25, 0x6C, 0x64, 0x00, 0x25, 0x6C, 0x58, 0x20, 0x25, 0x6C, 0x58, 0x00, 0x25, 0x6C, 
-    0x64, 0x00, 0x25, 0x6C, 0x58, 0x20, 0x25, 0x6C, 0x58, 0x00, 0x6E, 0x6F, 0x20, 0x70, 0x68, 0x79, 
-    0x73, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 
-    0x65, 0x73, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x00, 0x49, 0x6E, 
-    0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x63, 0x61, 
-    0x6E, 0x27, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 
-    0x6F, 0x72, 0x20, 0x50, 0x54, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x00, 0x49, 0x6E, 0x74, 0x65, 
-    0x72, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x69, 0x6E, 0x73, 0x74, 
-    0x72, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 
-    0x58, 0x20, 0x69, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x61, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 
-    0x20, 0x74, 0x6F, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 0x58, 
-    0x10, 0x70, 0x23, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 
-    0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6C, 
-    0x61, 0x72, 0x67, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x30, 
-    0x78, 0x25, 0x6C, 0x58, 0x20, 0x28, 0x76, 0x61, 0x64, 0x64, 0x72, 0x20, 0x30, 0x78, 0x25, 0x6C, 
-    0x58, 0x29, 0x3A, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x30, 
-    0x78, 0x25, 0x6C, 0x58, 0x2C, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20, 0x65, 
-    0x6E, 0x74, 0x72, 0x79, 0x20, 0x25, 0x6C, 0x64, 0x20, 0x61, 0x74, 0x20, 0x30, 0x78, 0x25, 0x6C, 
-    0x58, 0x0D, 0x10, 0x36, 0x25, 0x6C, 0x64, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x61, 
-    0x62, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x65, 
-    0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E, 0x2E, 0x2E, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x70, 0x72, 
-    0x6F, 0x63, 0x65, 0x65, 0x64, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x75, 0x6E, 0x72, 0x65, 0x63, 
-    0x6F, 0x67, 0x6E, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
-    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x22, 0x25, 0x73, 0x22, 0x1F, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
-    0x65, 0x64, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x00, 0x20, 0x23, 
-    0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x1E, 0x0D, 0x00, 0x20, 0x00, 0x23, 0x20, 0x45, 
-    0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x00, 0x0D, 0x00, 0x20, 0x23, 0x20, 0x57, 0x61, 0x72, 0x6E, 
-    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x13, 0x0D, 0x00, 0x23, 0x23, 0x23, 0x20, 0x10, 0x80, 0xA6, 0x20, 
-    0x00, 0x23, 0x23, 0x23, 0x20, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 
-    0x20, 0x63, 0x6C, 0x61, 0x75, 0x73, 0x65, 0x73, 0x3A, 0x0D, 0x00, 0x23, 0x23, 0x23, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x2D, 0x6F, 0x20, 0x3C, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x66, 0x69, 
-    0x6C, 0x65, 0x3E, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 
-    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x0D, 0x00, 0x23, 0x23, 0x23, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x2D, 0x68, 0x65, 0x6C, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 
-    0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x0D, 0x00, 0x20, 0x5B, 0x2D, 0x68, 0x65, 0x6C, 0x70, 
-    0x5D, 0x20, 0x5B, 0x2D, 0x6F, 0x20, 0x3C, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2D, 0x66, 0x69, 
-    0x6C, 0x65, 0x3E, 0x5D, 0x20, 0x5B, 0x3C, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2D, 0x66, 0x69, 
-    0x6C, 0x65, 0x3E, 0x5D, 0x0D, 0x18, 0x23, 0x23, 0x23, 0x20, 0x55, 0x73, 0x61, 0x67, 0x65, 0x3A, 
-    0x20, 0x00, 0x68, 0x65, 0x6C, 0x70, 0x1C, 0x6F, 0x00, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
-    0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x10, 
-    0x58, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6E, 
-    0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x28, 0x25, 0x73, 0x29, 
-    0x2D, 0x2D, 0x77, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x6F, 
-    0x70, 0x65, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 0x00, 0x3C, 0x73, 0x74, 0x64, 0x69, 0x6E, 0x3E, 
-    0x00, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x22, 0x25, 0x73, 0x22, 
-    0x00, 0x3C, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x3E, 0x00, 0x80, 0x80, 0x3F, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x10, 0x10, 
-    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 0x10, 0x10, 0x20, 0x01, 0x80, 0x8F, 
-    0x01, 0x6A, 0xB1, 0x01, 0x72, 0x81, 0xFF, 0xF4, 0x21, 0x01, 0x72, 0x81, 0xFF, 0xEC, 0x21, 0x01, 
-    0x72, 0xB1, 0x01, 0x82, 0x81, 0xFF, 0xF8, 0x21, 0x01, 0x82, 0xB1, 0x01, 0x7A, 0x81, 0xFF, 0xF4, 
-    0x21, 0x01, 0x7A, 0xB1, 0x01, 0x92, 0x81, 0xFF, 0xF4, 0x21, 0x01, 0x92, 0xB1, 0x01, 0x9A, 0x81, 
-    0xFF, 0xF8, 0x21, 0x01, 0x9A, 0xB1, 0x01, 0xAA, 0x81, 0xFF, 0xB2, 0x21, 0x01, 0xAA, 0x81, 0xFF, 
-    0xF4, 0x21, 0x01, 0xAA, 0xB1, 0x01, 0xB2, 0x81, 0xFF, 0xBC, 0x21, 0x01, 0xB2, 0xB1, 0x01, 0xBA, 
-    0x81, 0xFF, 0xBC, 0x21, 0x01, 0xBA, 0x81, 0xFF, 0xB0, 0x21, 0x01, 0xBA, 0xB1, 0x01, 0xC2, 0x81, 
-    0xFF, 0xBC, 0x21, 0x01, 0xC2, 0x81, 0xFF, 0xB4, 0x21, 0x01, 0xC2, 0xB1, 0x01, 0xCA, 0x81, 0xFF, 
-    0xB0, 0x21, 0x01, 0xCA, 0x81, 0xFF, 0xBC, 0x21, 0x01, 0xCA, 0x81, 0xFF, 0xA8, 0x21, 0x01, 0xCA, 
-    0xB1, 0x01, 0xE2, 0x30, 0xF0, 0x02, 0x0A, 0x01, 0xEA, 0x01, 0xF2, 0x02, 0x4A, 0x02, 0x52, 0x02, 
-    0x0A, 0x02, 0x5A, 0x02, 0x6A, 0x02, 0x72, 0x02, 0x02, 0x01, 0xFA, 0xB1, 0x02, 0x12, 0x81, 0xFF, 
-    0xBC, 0x21, 0x02, 0x12, 0xB1, 0x02, 0x1A, 0x81, 0xFF, 0xBC, 0x21, 0x02, 0x1A, 0x81, 0xFF, 0xB0, 
-    0x21, 0x02, 0x1A, 0xB1, 0x02, 0x22, 0x81, 0xFF, 0xBC, 0x21, 0x02, 0x22, 0x81, 0xFF, 0xB4, 0x21, 
-    0x02, 0x22, 0xB1, 0x02, 0x2A, 0x81, 0xFF, 0xB0, 0x21, 0x02, 0x2A, 0x81, 0xFF, 0xBC, 0x21, 0x02, 
-    0x2A, 0x81, 0xFF, 0xA8, 0x21, 0x02, 0x2A, 0xB1, 0x02, 0x32, 0x30, 0xF0, 0x02, 0x0A, 0x02, 0x3A, 
-    0x02, 0x42, 0x02, 0x4A, 0x02, 0x52, 0x02, 0x62, 0x02, 0x5A, 0x02, 0x6A, 0x02, 0x72, 0x02, 0x7A, 
-    0x02, 0x82, 0xB1, 0x02, 0x32, 0x30, 0xF0, 0x02, 0x0A, 0x02, 0x8A, 0x02, 0x92, 0x02, 0x4A, 0x02, 
-    0x9A, 0x02, 0xA2, 0x02, 0x5A, 0x02, 0x6A, 0x02, 0x72, 0x02, 0xB2, 0x02, 0xAA, 0x72, 0x46, 0x53, 
-    0x59, 0x53, 0x10, 0xF0, 0x02, 0x04, 0x02, 0xF2, 0x02, 0xFA, 0x03, 0x02, 0x03, 0x0A, 0x13, 0x03, 
-    0x12, 0x43, 0x4F, 0x4E, 0x53, 0x10, 0xF0, 0x02, 0x04, 0x02, 0xC2, 0x02, 0xCA, 0x02, 0xD2, 0x02, 
-    0xDA, 0x13, 0x02, 0xE2, 0x53, 0x59, 0x53, 0x54, 0x10, 0xF0, 0x02, 0x05, 0x03, 0x1A, 0x03, 0x22, 
-    0x03, 0x2A, 0x03, 0x32, 0x03, 0x3A, 0x01, 0x32, 0x01, 0x42, 0x10, 0xF0, 0x02, 0x20, 0x01, 0x42, 
-    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 
-    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0xFF, 0xFF, 0x03, 0x8A, 
-    0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 
-    0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 0x00, 0x03, 
-    0x07, 0x01, 0x53, 0x48, 0x20, 0x09, 0xFF, 0xFF, 0xFA, 0x64, 0xFF, 0xFF, 0xFA, 0x6C, 0x81, 0x02, 
-    0x07, 0xFF, 0xFF, 0xFA, 0x70, 0x02, 0x81, 0x14, 0xFF, 0xFF, 0xF3, 0x45, 0x02, 0x24, 0xFF, 0xFF, 
-    0xFD, 0x42, 0x00, 0x01, 0x13, 0x01, 0x00, 0x03, 0x15, 0x02, 0x00, 0x01, 0x00, 0x03, 0x13, 0x42, 
-    0x00, 0x02, 0x02, 0x81, 0x94, 0x30, 0x00, 0x30, 0x58, 0x11, 0x30, 0x78, 0x10, 0x03, 0x2D, 0x00, 
-    0x2B, 0x20, 0x81, 0x05, 0x0A, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
-    0x32, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x34, 
-    0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-    0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 
-    0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 
-    0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 
-    0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 
-    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 
-    0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 
-    0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 
-    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 
-    0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xFF, 0xFF, 0xF4, 
-    0x46, 0xFF, 0xFF, 0xF4, 0x5E, 0xFF, 0xFF, 0xF4, 0x76, 0xFF, 0xFF, 0xF4, 0x8E, 0xFF, 0xFF, 0xF4, 
-    0xD6, 0xFF, 0xFF, 0xF4, 0xEE, 0xFF, 0xFF, 0xF4, 0xA6, 0xFF, 0xFF, 0xF4, 0xBE, 0xFF, 0xFF, 0xF5, 
-    0x06, 0xFF, 0xFF, 0xF5, 0x1E, 0xFF, 0xFF, 0xF5, 0x4E, 0xFF, 0xFF, 0xF5, 0x36, 0xFF, 0xFF, 0xF5, 
-    0x66, 0xFF, 0xFF, 0xF5, 0x7E, 0xFF, 0xFF, 0xF5, 0x96, 0x20, 0x30, 0xFF, 0xFF, 0xF5, 0xAE, 0xFF, 
-    0xFF, 0xF5, 0xC6, 0xFF, 0xFF, 0xF5, 0xDE, 0xFF, 0xFF, 0xF5, 0xF6, 0xFF, 0xFF, 0xF6, 0x0E, 0xFF, 
-    0xFF, 0xF6, 0x26, 0xFF, 0xFF, 0xF6, 0x3E, 0xFF, 0xFF, 0xF6, 0x56, 0xFF, 0xFF, 0xF6, 0x6E, 0xFF, 
-    0xFF, 0xF6, 0x86, 0xFF, 0xFF, 0xF6, 0x9E, 0xFF, 0xFF, 0xF6, 0xB6, 0x00, 0x3C, 0x81, 0x12, 0xFF, 
-    0xFF, 0xF6, 0xCE, 0xFF, 0xFF, 0xF7, 0x36, 0xFF, 0xFF, 0xF7, 0x4E, 0xFF, 0xFF, 0xF7, 0x66, 0xFF, 
-    0xFF, 0xF7, 0x7E, 0xFF, 0xFF, 0xF7, 0x96, 0xFF, 0xFF, 0xF7, 0xAE, 0xFF, 0xFF, 0xF7, 0xC6, 0xFF, 
-    0xFF, 0xF7, 0xDE, 0xFF, 0xFF, 0xF7, 0xF6, 0xFF, 0xFF, 0xF8, 0x0E, 0xFF, 0xFF, 0xF8, 0x26, 0xFF, 
-    0xFF, 0xF8, 0x3E, 0xFF, 0xFF, 0xF8, 0x56, 0xFF, 0xFF, 0xF8, 0xBE, 0x10, 0x00, 0x80, 0x8F, 0x02, 
-    0x08, 0x04, 0x04, 0x04, 0x0C, 0x04, 0x04, 0x04, 0x84, 0x29, 0x00, 0x02, 0x08, 0x6C, 0x02, 0x08, 
-    0x0C, 0x81, 0x0B, 0x02, 0x08, 0x82, 0x7B, 0x00, 0x0C, 0x1B, 0x00, 0x04, 0x0A, 0x00, 0x0C, 0x0D, 
-    0x00, 0x04, 0x0A, 0x0C, 0x00, 0x04, 0x0A, 0x0B, 0x00, 0x02, 0x04, 0x04, 0x00, 0x02, 0x04, 0x04, 
-    0x00, 0x02, 0x04, 0x1A, 0x00, 0x02, 0x0F, 0x04, 0x00, 0x02, 0x0F, 0x09, 0x02, 0x06, 0x80, 0x8C, 
-    0x14, 0x81, 0x5A, 0x00, 0x02, 0x0E, 0x04, 0x00, 0x02, 0x0B, 0x80, 0x8B, 0x00, 0x02, 0x0E, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD6, 0x6D, 0x70, 0x77, 0x64, 0x00, 0x00, 0x09, 0x94, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x13, 0x08, 0x2C, 0x2E, 
-    0x00, 0x08, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x0C, 0x2F, 0x07, 0x70, 0x30, 0x2F, 0x00, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x05, 0xFC, 0xD9, 0xC7, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x1E, 0x70, 0x0F, 
-    0xC0, 0x86, 0x19, 0x00, 0x70, 0x09, 0xB0, 0x14, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x37, 
-    0x60, 0x02, 0x70, 0x30, 0xD1, 0x14, 0x20, 0x07, 0x53, 0x87, 0xE8, 0x8E, 0x4A, 0x86, 0x63, 0x04, 
-    0x4A, 0x87, 0x6E, 0xDA, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x62, 
-    0x69, 0x6E, 0x68, 0x65, 0x78, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 
-    0x2C, 0x2E, 0x00, 0x08, 0x20, 0x06, 0x22, 0x2E, 0x00, 0x0C, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 
-    0x2F, 0x06, 0x4E, 0xBA, 0x01, 0xB6, 0x2D, 0x40, 0xFF, 0xFC, 0x58, 0x4F, 0x67, 0x28, 0x28, 0x6E, 
-    0xFF, 0xFC, 0x20, 0x06, 0xE4, 0x88, 0x2E, 0x00, 0x60, 0x04, 0x70, 0x00, 0x28, 0xC0, 0x53, 0x87, 
-    0x6C, 0xF8, 0x26, 0x4C, 0x20, 0x06, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03, 0x2E, 0x00, 0x60, 0x02, 
-    0x42, 0x1B, 0x53, 0x87, 0x6C, 0xFA, 0x20, 0x2E, 0xFF, 0xFC, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x63, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x61, 0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x7A, 
-    0xB0, 0x87, 0x6D, 0x06, 0x06, 0x87, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x74, 0x6F, 0x75, 0x70, 0x70, 0x65, 0x72, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x2F, 0x07, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x41, 0xB0, 0x87, 0x6E, 0x0C, 0x70, 0x5A, 
-    0xB0, 0x87, 0x6D, 0x06, 0x04, 0x87, 0xFF, 0xFF, 0xFF, 0xE0, 0x20, 0x07, 0x2E, 0x2E, 0xFF, 0xFC, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x74, 0x6F, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x1A, 0x28, 0x6E, 0x00, 0x08, 0x1D, 0x6E, 
-    0x00, 0x25, 0xFF, 0xFC, 0x3D, 0x6E, 0x00, 0x18, 0xFF, 0xFE, 0x2F, 0x0C, 0x41, 0xEE, 0x00, 0x16, 
-    0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xFC, 0x4E, 0xAD, 0x03, 0xA2, 0x10, 0x2C, 
-    0x00, 0x05, 0x04, 0x00, 0x00, 0x30, 0x4F, 0xEF, 0x00, 0x12, 0x67, 0x36, 0x04, 0x00, 0x00, 0x0F, 
-    0x67, 0x0C, 0x04, 0x00, 0x00, 0x0A, 0x67, 0x3E, 0x5B, 0x00, 0x67, 0x3A, 0x60, 0x28, 0x70, 0x00, 
-    0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x1E, 0x2F, 0x0B, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0x00, 0x16, 
-    0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x2F, 0x0C, 0x4E, 0xBA, 0xFF, 0x94, 0x4F, 0xEF, 0x00, 0x1E, 
-    0x60, 0x30, 0x42, 0x6C, 0x00, 0x02, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x32, 0x2C, 0x00, 0x02, 
-    0x48, 0xC1, 0xD2, 0x80, 0x26, 0x81, 0x10, 0x14, 0x48, 0x80, 0x48, 0xC0, 0x20, 0x6E, 0x00, 0x1E, 
-    0x20, 0x80, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x04, 0x42, 0x34, 0x00, 0x05, 0x20, 0x4C, 0x5A, 0x88, 
-    0x20, 0x08, 0x4C, 0xEE, 0x18, 0x00, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x5F, 0x63, 0x76, 
-    0x74, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x49, 0xEE, 0xFF, 0x00, 
-    0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x06, 0xF0, 0x2F, 0x0C, 0x4E, 0xBA, 0x07, 0x02, 
-    0x2E, 0x00, 0x70, 0x08, 0x2F, 0x00, 0x22, 0x0C, 0xD2, 0x87, 0x2F, 0x01, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0xFD, 0xF4, 0x42, 0x34, 0x70, 0x08, 0x2F, 0x0C, 0x4E, 0xAD, 0x01, 0x5A, 0x2F, 0x0C, 
-    0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x4C, 0xEE, 0x10, 0x80, 0xFE, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x62, 0x61, 0x64, 0x50, 0x74, 0x72, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 
-    0x07, 0x18, 0x47, 0xED, 0xFB, 0x62, 0x2A, 0x2E, 0x00, 0x08, 0x7E, 0x00, 0x0C, 0x85, 0x00, 0x80, 
-    0x00, 0x00, 0x63, 0x06, 0x70, 0x00, 0x60, 0x00, 0x00, 0xAE, 0x70, 0x08, 0xB0, 0x85, 0x63, 0x02, 
-    0x7A, 0x08, 0x20, 0x05, 0x56, 0x80, 0x72, 0xFC, 0xC2, 0x80, 0x2A, 0x01, 0x20, 0x05, 0x53, 0x80, 
-    0x2C, 0x00, 0xE4, 0x86, 0x60, 0x02, 0x52, 0x87, 0xE2, 0x8E, 0x4A, 0x86, 0x66, 0xF8, 0x70, 0x08, 
-    0xB0, 0x87, 0x6D, 0x0A, 0x20, 0x07, 0xE5, 0x40, 0x4A, 0xB3, 0x00, 0x00, 0x66, 0x14, 0x2F, 0x05, 
-    0x2F, 0x07, 0x4E, 0xBA, 0x00, 0xBE, 0x28, 0x40, 0x20, 0x0C, 0x50, 0x4F, 0x66, 0x26, 0x70, 0x00, 
-    0x60, 0x64, 0x20, 0x07, 0xE5, 0x40, 0x28, 0x73, 0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 0x20, 0x73, 
-    0x00, 0x00, 0x20, 0x07, 0xE5, 0x40, 0x27, 0x90, 0x00, 0x00, 0x18, 0xAC, 0x00, 0x04, 0x19, 0x6C, 
-    0x00, 0x05, 0x00, 0x01, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 
-    0x10, 0x14, 0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 
-    0x00, 0x08, 0x63, 0x1C, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x40, 0x00, 0xFF, 0x67, 0x10, 
-    0x2F, 0x0C, 0x48, 0x7A, 0x00, 0x26, 0x4E, 0xBA, 0xFE, 0xEC, 0x70, 0x00, 0x50, 0x4F, 0x60, 0x06, 
-    0x20, 0x4C, 0x58, 0x88, 0x20, 0x08, 0x4C, 0xEE, 0x18, 0xE0, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x86, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x38, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 
-    0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 
-    0x2D, 0x2D, 0x20, 0x43, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 
-    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x46, 0x72, 0x65, 0x65, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x40, 
-    0x20, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x47, 0xED, 0xFB, 0x62, 0x2A, 0x2E, 
-    0x00, 0x0C, 0x2C, 0x2E, 0x00, 0x08, 0x70, 0x08, 0xB0, 0x86, 0x6C, 0x28, 0x41, 0xF8, 0x00, 0x04, 
-    0x22, 0x05, 0xD2, 0x88, 0x20, 0x01, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x00, 0xEA, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x7C, 0x00, 0xFF, 0x00, 0x01, 0x20, 0x0C, 
-    0x60, 0x00, 0x00, 0xDA, 0x20, 0x06, 0xE5, 0x40, 0x4A, 0xB3, 0x00, 0x00, 0x67, 0x10, 0x48, 0x7A, 
-    0x00, 0xE2, 0x30, 0x3C, 0xFE, 0x15, 0xA9, 0xC9, 0x70, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x70, 0x08, 
-    0xB0, 0x86, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x08, 0x60, 0x02, 0x20, 0x06, 0x28, 0x00, 
-    0x56, 0x84, 0x20, 0x06, 0x56, 0x80, 0x12, 0x04, 0x92, 0x00, 0x7E, 0x01, 0xE3, 0xAF, 0xBC, 0x84, 
-    0x6F, 0x02, 0x28, 0x06, 0x70, 0x01, 0xE9, 0xA8, 0x41, 0xF8, 0x00, 0x04, 0x2D, 0x40, 0xFF, 0xFC, 
-    0x20, 0x07, 0x22, 0x08, 0x4E, 0xAD, 0x01, 0x1A, 0x22, 0x2E, 0xFF, 0xFC, 0x2A, 0x00, 0xDA, 0x81, 
-    0x20, 0x05, 0xA1, 0x1E, 0x28, 0x48, 0x20, 0x0C, 0x66, 0x14, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x04, 
-    0x70, 0x00, 0x60, 0x68, 0x28, 0x06, 0x56, 0x84, 0x7E, 0x01, 0x4A, 0x87, 0x6E, 0xC6, 0x4A, 0x87, 
-    0x66, 0x04, 0x70, 0x00, 0x60, 0x56, 0x20, 0x06, 0xE5, 0x40, 0x27, 0x8C, 0x00, 0x00, 0x10, 0x06, 
-    0x56, 0x00, 0x72, 0x01, 0xE1, 0xA9, 0x41, 0xF8, 0x00, 0x04, 0x2A, 0x01, 0xDA, 0x88, 0x60, 0x12, 
-    0x20, 0x0C, 0xD0, 0x85, 0x28, 0x80, 0x28, 0x40, 0x19, 0x7C, 0x00, 0x55, 0x00, 0x04, 0x19, 0x46, 
-    0x00, 0x05, 0x53, 0x87, 0x6E, 0xEA, 0x70, 0x00, 0x28, 0x80, 0x22, 0x06, 0xE5, 0x41, 0x28, 0x73, 
-    0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x20, 0x73, 0x10, 0x00, 0x22, 0x06, 0xE5, 0x41, 0x27, 0x90, 
-    0x10, 0x00, 0x18, 0xBC, 0x00, 0x5A, 0x19, 0x46, 0x00, 0x01, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xF8, 
-    0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x89, 0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x4D, 0x65, 0x6D, 
-    0x00, 0x2E, 0x2B, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x6C, 0x6C, 
-    0x6F, 0x63, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20, 0x2D, 0x2D, 0x20, 0x46, 0x72, 0x65, 0x65, 
-    0x4C, 0x69, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x20, 0x0B, 0x08, 0x00, 
-    0x00, 0x00, 0x67, 0x10, 0x2F, 0x0B, 0x48, 0x7A, 0x00, 0xE0, 0x4E, 0xBA, 0xFD, 0x18, 0x50, 0x4F, 
-    0x60, 0x00, 0x00, 0x90, 0x20, 0x0B, 0x67, 0x00, 0x00, 0x8A, 0x41, 0xF8, 0x00, 0x04, 0x28, 0x4B, 
-    0x99, 0xC8, 0x70, 0x00, 0x10, 0x14, 0x0C, 0x40, 0x00, 0x5A, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x14, 
-    0x0C, 0x40, 0x00, 0x55, 0x66, 0x18, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x08, 
-    0x63, 0x1A, 0x70, 0x00, 0x10, 0x2C, 0x00, 0x01, 0x0C, 0x40, 0x00, 0xFF, 0x67, 0x0E, 0x2F, 0x0B, 
-    0x48, 0x7A, 0x00, 0x62, 0x4E, 0xBA, 0xFC, 0xCE, 0x50, 0x4F, 0x60, 0x46, 0x7E, 0x00, 0x1E, 0x2C, 
-    0x00, 0x01, 0x0C, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x66, 0x14, 0x18, 0xBC, 0x00, 0x51, 0x19, 0x7C, 
-    0x00, 0x09, 0x00, 0x01, 0x2F, 0x0C, 0x4E, 0xBA, 0x04, 0x16, 0x58, 0x4F, 0x60, 0x24, 0x19, 0x54, 
-    0x00, 0x04, 0x19, 0x6C, 0x00, 0x01, 0x00, 0x05, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xFB, 0x62, 
-    0x26, 0x70, 0x00, 0x00, 0x28, 0x8B, 0x20, 0x07, 0xE5, 0x40, 0x41, 0xED, 0xFB, 0x62, 0x21, 0x8C, 
-    0x00, 0x00, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x84, 0x66, 0x72, 0x65, 
-    0x65, 0x00, 0x00, 0x56, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x66, 
-    0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 
-    0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70, 0x74, 0x20, 0x62, 0x6C, 
-    0x6F, 0x63, 0x6B, 0x20, 0x40, 0x20, 0x00, 0x00, 0x41, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 
-    0x74, 0x6F, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x70, 
-    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x40, 0x20, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 
-    0x20, 0x08, 0x2F, 0x02, 0x22, 0x2F, 0x00, 0x10, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x11, 0x6D, 0x2E, 
-    0x24, 0x09, 0xB1, 0x02, 0xE2, 0x0A, 0x65, 0x26, 0x08, 0x00, 0x00, 0x00, 0x67, 0x04, 0x10, 0xD9, 
-    0x53, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 0x20, 0xD9, 
-    0x53, 0x82, 0x64, 0xF4, 0x02, 0x81, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xD9, 0x53, 0x81, 
-    0x64, 0xFA, 0x24, 0x1F, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x4C, 0xEF, 0x00, 0x03, 0x00, 0x08, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x13, 
-    0x6D, 0x3A, 0x74, 0x00, 0x14, 0x00, 0xE1, 0x48, 0x84, 0x40, 0x20, 0x02, 0x48, 0x42, 0x80, 0x82, 
-    0x24, 0x08, 0xE2, 0x0A, 0x64, 0x04, 0x10, 0xC0, 0x53, 0x81, 0xE2, 0x0A, 0x64, 0x04, 0x30, 0xC0, 
-    0x55, 0x81, 0x24, 0x01, 0xE8, 0x8A, 0x53, 0x82, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 
-    0x53, 0x82, 0x64, 0xF4, 0x02, 0x41, 0x00, 0x0F, 0x60, 0x02, 0x10, 0xC0, 0x51, 0xC9, 0xFF, 0xFC, 
-    0x20, 0x2F, 0x00, 0x04, 0x4E, 0x75, 0x86, 0x6D, 0x65, 0x6D, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x10, 0x28, 0x6E, 0x00, 0x08, 
-    0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x07, 0x20, 0x2E, 0x00, 0x0C, 0x22, 0x07, 0x4E, 0xAD, 0x01, 0x1A, 
-    0xD0, 0x8C, 0x2F, 0x00, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x14, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x71, 0x73, 0x6F, 0x72, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xF8, 
-    0x48, 0xE7, 0x0F, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x2E, 0x06, 0x28, 0x2E, 0x00, 0x0C, 0x98, 0xAE, 
-    0x00, 0x08, 0xBE, 0x84, 0x64, 0x00, 0x01, 0x5A, 0x20, 0x07, 0xD0, 0x80, 0x22, 0x00, 0x20, 0x04, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x00, 0x20, 0x07, 0x4E, 0xAD, 0x01, 0x1A, 0x28, 0x00, 0xD0, 0xAE, 
-    0x00, 0x08, 0x2D, 0x40, 0xFF, 0xF8, 0x2D, 0x40, 0xFF, 0xFC, 0x28, 0x6E, 0x00, 0x08, 0x26, 0x6E, 
-    0x00, 0x0C, 0x97, 0xC7, 0xB9, 0xEE, 0xFF, 0xF8, 0x64, 0x30, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x0C, 
-    0x20, 0x6E, 0x00, 0x14, 0x4E, 0x90, 0x2A, 0x00, 0x50, 0x4F, 0x66, 0x16, 0x2F, 0x06, 0x9F, 0xAE, 
-    0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x16, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x60, 0xD2, 0x4A, 0x85, 0x6C, 0x04, 0xD9, 0xC7, 0x60, 0xCA, 0xB7, 0xEE, 0xFF, 0xFC, 0x63, 0x6C, 
-    0x2F, 0x0B, 0x2F, 0x2E, 0xFF, 0xFC, 0x20, 0x6E, 0x00, 0x14, 0x4E, 0x90, 0x2A, 0x00, 0x50, 0x4F, 
-    0x66, 0x16, 0x2F, 0x06, 0x2F, 0x0B, 0xDF, 0xAE, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x4E, 0xBA, 
-    0x00, 0xE0, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0xD2, 0x4A, 0x85, 0x6F, 0x3C, 0xB9, 0xEE, 0xFF, 0xF8, 
-    0x66, 0x20, 0x2F, 0x06, 0x2F, 0x0B, 0xDF, 0xAE, 0xFF, 0xFC, 0x2F, 0x2E, 0xFF, 0xFC, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x00, 0xEE, 0xDF, 0xAE, 0xFF, 0xF8, 0x28, 0x6E, 0xFF, 0xF8, 0x4F, 0xEF, 0x00, 0x10, 
-    0x60, 0xA8, 0x2F, 0x06, 0x2F, 0x0B, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0xA6, 0x97, 0xC7, 0xD9, 0xC7, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x00, 0xFF, 0x5E, 0x97, 0xC7, 0x60, 0x8E, 0xB9, 0xEE, 0xFF, 0xF8, 
-    0x66, 0x5C, 0x20, 0x2E, 0xFF, 0xF8, 0x90, 0xAE, 0x00, 0x08, 0x22, 0x2E, 0x00, 0x0C, 0x92, 0xAE, 
-    0xFF, 0xFC, 0xB2, 0x80, 0x6E, 0x24, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x20, 0x07, 0xD0, 0xAE, 0xFF, 0xFC, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0xE2, 0x2D, 0x6E, 0xFF, 0xF8, 
-    0x00, 0x0C, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0xFE, 0xE2, 0x2F, 0x2E, 0x00, 0x14, 0x2F, 0x06, 
-    0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0xC2, 0x20, 0x07, 0xD0, 0xAE, 
-    0xFF, 0xFC, 0x2D, 0x40, 0x00, 0x08, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0xFE, 0xBE, 0x2F, 0x06, 
-    0x2F, 0x0C, 0x9F, 0xAE, 0xFF, 0xF8, 0x2F, 0x2E, 0xFF, 0xF8, 0x2F, 0x0B, 0x4E, 0xBA, 0x00, 0x52, 
-    0x9F, 0xAE, 0xFF, 0xFC, 0x26, 0x6E, 0xFF, 0xFC, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x00, 0xFE, 0xD6, 
-    0x4C, 0xEE, 0x18, 0xF0, 0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x83, 0x71, 0x73, 0x31, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x10, 0x26, 0x6E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x1E, 0x13, 0x16, 0xD4, 0x18, 0xC7, 0x53, 0x86, 0x66, 0xF6, 0x4C, 0xEE, 
-    0x18, 0xC0, 0xFF, 0xF0, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x71, 0x73, 0x65, 0x78, 0x63, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x03, 0x18, 0x2C, 0x2E, 0x00, 0x14, 0x2D, 0x6E, 0x00, 0x08, 
-    0xFF, 0xFC, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x10, 0x20, 0x6E, 0xFF, 0xFC, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x20, 0x08, 0x52, 0xAE, 0xFF, 0xFC, 0x20, 0x40, 0x10, 0x94, 
-    0x18, 0xD3, 0x16, 0xC7, 0x53, 0x86, 0x66, 0xE2, 0x4C, 0xEE, 0x18, 0xC0, 0xFF, 0xEC, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x71, 0x73, 0x74, 0x65, 0x78, 0x63, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 
-    0x00, 0x04, 0x70, 0x00, 0xB3, 0xC8, 0x67, 0x0A, 0x10, 0x18, 0xB0, 0x19, 0x66, 0x08, 0x4A, 0x00, 
-    0x66, 0xF6, 0x70, 0x00, 0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 0x90, 0x81, 0x4E, 0x75, 0x86, 0x73, 
-    0x74, 0x72, 0x63, 0x6D, 0x70, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 
-    0x10, 0xD9, 0x66, 0xFC, 0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x63, 0x70, 0x79, 0x00, 0x00, 0x00, 
-    0x20, 0x6F, 0x00, 0x04, 0x22, 0x48, 0x4A, 0x18, 0x66, 0xFC, 0x91, 0xC9, 0x20, 0x08, 0x53, 0x80, 
-    0x4E, 0x75, 0x86, 0x73, 0x74, 0x72, 0x6C, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4C, 0xEF, 0x03, 0x00, 
-    0x00, 0x04, 0x22, 0x2F, 0x00, 0x0C, 0x70, 0x00, 0x60, 0x0A, 0x10, 0x18, 0xB0, 0x19, 0x66, 0x0C, 
-    0x4A, 0x00, 0x67, 0x04, 0x53, 0x81, 0x64, 0xF2, 0x70, 0x00, 0x4E, 0x75, 0x72, 0x00, 0x12, 0x21, 
-    0x90, 0x81, 0x4E, 0x75, 0x87, 0x73, 0x74, 0x72, 0x6E, 0x63, 0x6D, 0x70, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x20, 0x6E, 0x00, 0x08, 0xA0, 0x1F, 0x30, 0x38, 0x02, 0x20, 0x48, 0xC0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x8D, 0x5F, 0x53, 0x41, 0x5F, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x50, 0x74, 0x72, 
-    0x00, 0x00, 0x00, 0x00, 0x24, 0xCE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0xFE, 0x38, 0x48, 0xE7, 0x1F, 0x38, 0x26, 0x6E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 
-    0x2D, 0x40, 0xFE, 0x46, 0x2D, 0x40, 0xFE, 0x4A, 0x2D, 0x40, 0xFE, 0x4E, 0x10, 0x1B, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x66, 0x08, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x08, 0x6A, 0x20, 0x6D, 
-    0xFB, 0x5E, 0x70, 0x08, 0xC0, 0x30, 0x68, 0x00, 0x67, 0x56, 0x20, 0x2E, 0xFE, 0x4A, 0x52, 0xAE, 
-    0xFE, 0x4A, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 
-    0x1A, 0x3C, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x08, 0xC0, 0x30, 
-    0x78, 0x00, 0x66, 0xC6, 0x20, 0x2E, 0xFE, 0x4A, 0x53, 0xAE, 0xFE, 0x4A, 0x2F, 0x0C, 0x2F, 0x07, 
-    0x4E, 0xBA, 0x23, 0xB2, 0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x66, 0x90, 0x60, 0x00, 0x07, 0xF6, 
-    0x70, 0x25, 0xB0, 0x86, 0x66, 0x0E, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x25, 
-    0xB0, 0x86, 0x66, 0x56, 0x20, 0x2E, 0xFE, 0x4A, 0x52, 0xAE, 0xFE, 0x4A, 0x53, 0x94, 0x4A, 0x94, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 
-    0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x19, 0xD2, 0x4A, 0x80, 0x58, 0x4F, 
-    0x2E, 0x00, 0xBC, 0x87, 0x67, 0x00, 0xFF, 0x46, 0x20, 0x2E, 0xFE, 0x4A, 0x53, 0xAE, 0xFE, 0x4A, 
-    0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 0x23, 0x4E, 0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x67, 0x00, 
-    0x07, 0x94, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x07, 0x9E, 0x70, 0x01, 0x2D, 0x40, 0xFE, 0x52, 
-    0x72, 0x2A, 0xB2, 0x86, 0x66, 0x10, 0x20, 0x2E, 0xFE, 0x52, 0x53, 0xAE, 0xFE, 0x52, 0x10, 0x1B, 
-    0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x7A, 0x00, 0x60, 0x1A, 0x22, 0x05, 0xD2, 0x81, 0x20, 0x01, 
-    0xE5, 0x89, 0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 0x2A, 0x01, 0x10, 0x1B, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x04, 0xC0, 0x30, 0x68, 0x00, 0x66, 0xDA, 
-    0x4A, 0x85, 0x66, 0x06, 0x2A, 0x3C, 0x7F, 0xFF, 0xFF, 0xFF, 0x2D, 0x46, 0xFE, 0x56, 0x70, 0x6C, 
-    0xB0, 0x86, 0x67, 0x18, 0x70, 0x68, 0xB0, 0xAE, 0xFE, 0x56, 0x67, 0x10, 0x70, 0x4C, 0xB0, 0xAE, 
-    0xFE, 0x56, 0x67, 0x08, 0x70, 0x4D, 0xB0, 0xAE, 0xFE, 0x56, 0x66, 0x08, 0x10, 0x1B, 0x48, 0x80, 
-    0x48, 0xC0, 0x2C, 0x00, 0x70, 0x63, 0xB0, 0x86, 0x67, 0x60, 0x70, 0x5B, 0xB0, 0x86, 0x67, 0x5A, 
-    0x70, 0x6E, 0xB0, 0x86, 0x67, 0x54, 0x20, 0x2E, 0xFE, 0x4A, 0x52, 0xAE, 0xFE, 0x4A, 0x53, 0x94, 
-    0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x18, 0xF0, 0x4A, 0x80, 
-    0x58, 0x4F, 0x2E, 0x00, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 0x66, 0xC6, 
-    0x20, 0x2E, 0xFE, 0x4A, 0x53, 0xAE, 0xFE, 0x4A, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 0x22, 0x66, 
-    0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x67, 0x00, 0x06, 0xAC, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x01, 
-    0xC0, 0x30, 0x68, 0x00, 0x67, 0x0C, 0x70, 0x50, 0xB0, 0x86, 0x67, 0x06, 0x06, 0x86, 0x00, 0x00, 
-    0x00, 0x20, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x62, 0x22, 0x06, 0x04, 0x81, 0x00, 0x00, 0x00, 0x50, 
-    0x6B, 0x00, 0x06, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x00, 0x28, 0x6E, 0x00, 0x05, 0xF6, 0xD2, 0x81, 
-    0x32, 0x3B, 0x18, 0x06, 0x4E, 0xFB, 0x10, 0x00, 0x01, 0x1E, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 
-    0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x00, 0x54, 
-    0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x05, 0xEC, 0x01, 0x2C, 
-    0x02, 0x3E, 0x04, 0xA4, 0x04, 0xA4, 0x04, 0xA4, 0x05, 0xEC, 0x02, 0x3E, 0x05, 0xEC, 0x05, 0xEC, 
-    0x05, 0xEC, 0x05, 0xEC, 0x02, 0x06, 0x02, 0x2E, 0x02, 0x3E, 0x05, 0xEC, 0x05, 0xEC, 0x01, 0x36, 
-    0x05, 0xEC, 0x02, 0x3E, 0x05, 0xEC, 0x05, 0xEC, 0x02, 0x36, 0x70, 0x5E, 0xB0, 0x13, 0x66, 0x0A, 
-    0x70, 0x01, 0x2D, 0x40, 0xFE, 0x7A, 0x52, 0x4B, 0x60, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x7A, 
-    0x48, 0x78, 0x01, 0x00, 0x4A, 0xAE, 0xFE, 0x7A, 0x57, 0xC3, 0x44, 0x03, 0x48, 0x83, 0x48, 0xC3, 
-    0x2F, 0x03, 0x48, 0x6E, 0xFE, 0x7E, 0x4E, 0xAD, 0x03, 0xF2, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 
-    0x28, 0x00, 0x70, 0x5D, 0xB0, 0x84, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x06, 0x70, 0x2D, 0xB0, 0x84, 
-    0x66, 0x72, 0x41, 0xEE, 0xFE, 0x7E, 0x11, 0xAE, 0xFE, 0x7D, 0x40, 0x00, 0x52, 0x4B, 0x60, 0x64, 
-    0x4A, 0x84, 0x66, 0x08, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x05, 0xCC, 0x70, 0x2D, 0xB0, 0x84, 
-    0x66, 0x48, 0x10, 0x13, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x76, 0x72, 0x5D, 0xB2, 0x80, 
-    0x67, 0x38, 0x10, 0x2B, 0xFF, 0xFE, 0x48, 0x80, 0x48, 0xC0, 0x2D, 0x40, 0xFE, 0x72, 0xB0, 0xAE, 
-    0xFE, 0x76, 0x6E, 0x26, 0x20, 0x2E, 0xFE, 0x76, 0x90, 0xAE, 0xFE, 0x72, 0x2F, 0x00, 0x2F, 0x2E, 
-    0xFE, 0x7A, 0x30, 0x2E, 0xFE, 0x74, 0x41, 0xEE, 0xFE, 0x7F, 0x48, 0x70, 0x00, 0x00, 0x4E, 0xAD, 
-    0x03, 0xF2, 0x52, 0x4B, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x0A, 0x41, 0xEE, 0xFE, 0x7E, 0x11, 0xAE, 
-    0xFE, 0x7D, 0x40, 0x00, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x28, 0x00, 0x70, 0x5D, 0xB0, 0x84, 
-    0x66, 0x8E, 0x60, 0x18, 0x0C, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x6F, 0x06, 0x2A, 0x3C, 0x00, 0x00, 
-    0x00, 0xFF, 0x0C, 0x85, 0x7F, 0xFF, 0xFF, 0xFF, 0x66, 0x02, 0x7A, 0x01, 0x4A, 0xAE, 0xFE, 0x52, 
-    0x67, 0x0E, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x60, 0x04, 
-    0x30, 0x7C, 0x00, 0x00, 0x2D, 0x48, 0xFE, 0x6E, 0x2D, 0x48, 0xFE, 0x6A, 0x60, 0x18, 0x4A, 0xAE, 
-    0xFE, 0x52, 0x67, 0x06, 0x20, 0x6E, 0xFE, 0x6E, 0x10, 0x87, 0x20, 0x2E, 0xFE, 0x6E, 0x52, 0xAE, 
-    0xFE, 0x6E, 0x53, 0x85, 0x67, 0x5C, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 
-    0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x16, 0xF0, 0x4A, 0x80, 
-    0x58, 0x4F, 0x2E, 0x00, 0x70, 0xFF, 0xB0, 0x87, 0x67, 0x28, 0x70, 0x73, 0xB0, 0x86, 0x67, 0x06, 
-    0x70, 0x50, 0xB0, 0x86, 0x66, 0x0C, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x08, 0xC0, 0x30, 0x78, 0x00, 
-    0x66, 0x10, 0x70, 0x5B, 0xB0, 0x86, 0x66, 0x96, 0x41, 0xEE, 0xFE, 0x7E, 0x4A, 0x30, 0x70, 0x00, 
-    0x67, 0x8C, 0x20, 0x2E, 0xFE, 0x6E, 0xB0, 0xAE, 0xFE, 0x6A, 0x67, 0x00, 0x04, 0x1E, 0x4A, 0xAE, 
-    0xFE, 0x52, 0x67, 0x1C, 0x70, 0x63, 0xB0, 0x86, 0x67, 0x06, 0x20, 0x6E, 0xFE, 0x6E, 0x42, 0x10, 
-    0x70, 0x50, 0xB0, 0x86, 0x66, 0x0A, 0x2F, 0x2E, 0xFE, 0x6A, 0x4E, 0xAD, 0x01, 0x5A, 0x58, 0x4F, 
-    0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x60, 0x00, 0x03, 0xF0, 0x70, 0x00, 0x2D, 0x40, 
-    0xFE, 0x52, 0x22, 0x2E, 0xFE, 0x4A, 0xD2, 0xAE, 0xFE, 0x46, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x20, 0x81, 0x22, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 
-    0x60, 0x00, 0x03, 0xC8, 0x70, 0x08, 0x2D, 0x40, 0xFE, 0x5A, 0x60, 0x0E, 0x70, 0x10, 0x2D, 0x40, 
-    0xFE, 0x5A, 0x60, 0x06, 0x70, 0x0A, 0x2D, 0x40, 0xFE, 0x5A, 0x70, 0x00, 0x2D, 0x40, 0xFE, 0x66, 
-    0x2D, 0x40, 0xFE, 0x5E, 0x22, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x72, 0x00, 
-    0x12, 0x10, 0x4A, 0x81, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x16, 0x12, 0x22, 0x00, 0x58, 0x4F, 
-    0x2E, 0x01, 0x70, 0x2D, 0xB0, 0x87, 0x67, 0x06, 0x70, 0x2B, 0xB0, 0x87, 0x66, 0x42, 0x70, 0x2D, 
-    0xB0, 0x87, 0x66, 0x08, 0x20, 0x2E, 0xFE, 0x5E, 0x52, 0xAE, 0xFE, 0x5E, 0x53, 0x85, 0x67, 0x00, 
-    0x03, 0x5A, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 
-    0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x15, 0xC4, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 
-    0x70, 0x78, 0xB0, 0x86, 0x67, 0x0E, 0x70, 0x69, 0xB0, 0x86, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x86, 
-    0x66, 0x00, 0x01, 0x32, 0x70, 0x30, 0xB0, 0x87, 0x66, 0x00, 0x01, 0x2A, 0x53, 0x85, 0x66, 0x0C, 
-    0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x60, 0x00, 0x01, 0x44, 0x20, 0x2E, 0xFE, 0x46, 
-    0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x15, 0x6A, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0x58, 0xB0, 0x87, 0x67, 0x06, 
-    0x70, 0x78, 0xB0, 0x87, 0x66, 0x3E, 0x53, 0x85, 0x67, 0x00, 0x02, 0xC0, 0x20, 0x2E, 0xFE, 0x46, 
-    0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 
-    0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x15, 0x2A, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 0x70, 0x10, 0x2D, 0x40, 0xFE, 0x5A, 
-    0x60, 0x00, 0x00, 0xA2, 0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x70, 0x78, 0xB0, 0x86, 
-    0x67, 0x00, 0x00, 0x92, 0x70, 0x08, 0x2D, 0x40, 0xFE, 0x5A, 0x60, 0x00, 0x00, 0x88, 0x20, 0x6D, 
-    0xFB, 0x5E, 0x70, 0x04, 0xC0, 0x30, 0x78, 0x00, 0x67, 0x04, 0x70, 0x30, 0x60, 0x12, 0x20, 0x6D, 
-    0xFB, 0x5E, 0x70, 0x01, 0xC0, 0x30, 0x78, 0x00, 0x67, 0x04, 0x70, 0x37, 0x60, 0x02, 0x70, 0x57, 
-    0x48, 0x80, 0x48, 0xC0, 0x22, 0x07, 0x92, 0x80, 0x2D, 0x41, 0xFE, 0x42, 0x20, 0x01, 0xB0, 0xAE, 
-    0xFE, 0x5A, 0x6C, 0x7A, 0x20, 0x2E, 0xFE, 0x5A, 0x22, 0x2E, 0xFE, 0x66, 0x4E, 0xAD, 0x01, 0x1A, 
-    0x22, 0x2E, 0xFE, 0x42, 0xD2, 0x80, 0x2D, 0x41, 0xFE, 0x66, 0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 
-    0xFE, 0x62, 0x53, 0x85, 0x67, 0x58, 0x20, 0x2E, 0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 
-    0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0x80, 0x4A, 0x80, 
-    0x58, 0x4F, 0x2E, 0x00, 0x20, 0x6D, 0xFB, 0x5E, 0x70, 0x04, 0xC0, 0x30, 0x78, 0x00, 0x66, 0x00, 
-    0xFF, 0x6E, 0x70, 0x10, 0xB0, 0xAE, 0xFE, 0x5A, 0x66, 0x14, 0x20, 0x6D, 0xFB, 0x5E, 0x10, 0x30, 
-    0x78, 0x00, 0x48, 0x80, 0x32, 0x3C, 0x00, 0x80, 0xC2, 0x00, 0x66, 0x00, 0xFF, 0x52, 0x4A, 0xAE, 
-    0xFE, 0x52, 0x67, 0x00, 0x01, 0xB6, 0x4A, 0xAE, 0xFE, 0x62, 0x67, 0x00, 0x01, 0xAE, 0x4A, 0xAE, 
-    0xFE, 0x5E, 0x67, 0x0A, 0x20, 0x2E, 0xFE, 0x66, 0x44, 0x80, 0x2D, 0x40, 0xFE, 0x66, 0x20, 0x2E, 
-    0xFE, 0x56, 0x04, 0x80, 0x00, 0x00, 0x00, 0x68, 0x67, 0x18, 0x59, 0x80, 0x66, 0x28, 0x58, 0xAE, 
-    0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x20, 0xAE, 0xFE, 0x66, 0x60, 0x00, 
-    0x01, 0x7A, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x30, 0xAE, 
-    0xFE, 0x68, 0x60, 0x00, 0x01, 0x66, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 
-    0xFF, 0xFC, 0x20, 0xAE, 0xFE, 0x66, 0x60, 0x00, 0x01, 0x52, 0x2D, 0x45, 0xFF, 0x88, 0x70, 0x50, 
-    0xB0, 0x85, 0x6C, 0x02, 0x7A, 0x50, 0x41, 0xEE, 0xFF, 0x90, 0x2D, 0x48, 0xFF, 0xE2, 0x20, 0x2E, 
-    0xFE, 0x46, 0x52, 0xAE, 0xFE, 0x46, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x10, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x0A, 
-    0x2F, 0x0C, 0x4E, 0xBA, 0x13, 0xA8, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 0x20, 0x2E, 0xFF, 0xE2, 
-    0x52, 0xAE, 0xFF, 0xE2, 0x20, 0x40, 0x10, 0x87, 0x20, 0x6E, 0xFF, 0xE2, 0x42, 0x10, 0x42, 0x6E, 
-    0xFF, 0x8C, 0x48, 0x6E, 0xFF, 0x8E, 0x48, 0x6E, 0xFF, 0xE6, 0x48, 0x6E, 0xFF, 0x8C, 0x48, 0x6E, 
-    0xFF, 0x90, 0x4E, 0xAD, 0x03, 0x9A, 0x53, 0x85, 0x4F, 0xEF, 0x00, 0x10, 0x67, 0x06, 0x4A, 0x6E, 
-    0xFF, 0x8E, 0x66, 0x9A, 0x4A, 0x6E, 0xFF, 0x8C, 0x67, 0x14, 0x4A, 0x85, 0x6E, 0x08, 0x70, 0x50, 
-    0xB0, 0xAE, 0xFF, 0x88, 0x6D, 0x08, 0x20, 0x2E, 0xFE, 0x62, 0x52, 0xAE, 0xFE, 0x62, 0x4A, 0xAE, 
-    0xFE, 0x62, 0x67, 0x00, 0x00, 0xB6, 0x4A, 0xAE, 0xFE, 0x52, 0x67, 0x00, 0x00, 0xAE, 0x48, 0x6E, 
-    0xFF, 0xE6, 0x4E, 0xAD, 0x03, 0xAA, 0x3D, 0x40, 0xFE, 0x38, 0x2D, 0x41, 0xFE, 0x3A, 0x2D, 0x48, 
-    0xFE, 0x3E, 0x41, 0xEE, 0xFE, 0x38, 0x43, 0xEE, 0xFF, 0x7E, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 
-    0x20, 0x2E, 0xFE, 0x56, 0x04, 0x80, 0x00, 0x00, 0x00, 0x4C, 0x58, 0x4F, 0x67, 0x26, 0x53, 0x80, 
-    0x67, 0x3C, 0x04, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x66, 0x4E, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 
-    0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0x7E, 0x2F, 0x08, 0x3F, 0x3C, 0x08, 0x10, 
-    0xA9, 0xEB, 0x60, 0x56, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 
-    0x43, 0xEE, 0xFF, 0x7E, 0x45, 0xD0, 0x24, 0xD9, 0x24, 0xD9, 0x34, 0xD9, 0x60, 0x3C, 0x58, 0xAE, 
-    0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0x7E, 0x2F, 0x08, 
-    0x3F, 0x3C, 0x30, 0x10, 0xA9, 0xEB, 0x60, 0x22, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 
-    0x20, 0x68, 0xFF, 0xFC, 0x48, 0x6E, 0xFF, 0x7E, 0x2F, 0x08, 0x3F, 0x3C, 0x10, 0x10, 0xA9, 0xEB, 
-    0x60, 0x08, 0x20, 0x2E, 0xFE, 0x4E, 0x60, 0x00, 0x00, 0x8E, 0x4A, 0xAE, 0xFE, 0x62, 0x67, 0x08, 
-    0x20, 0x2E, 0xFE, 0x52, 0xD1, 0xAE, 0xFE, 0x4E, 0x4A, 0x85, 0x6F, 0x5A, 0x70, 0x6E, 0xB0, 0x86, 
-    0x67, 0x54, 0x20, 0x2E, 0xFE, 0x46, 0x53, 0xAE, 0xFE, 0x46, 0x2F, 0x0C, 0x2F, 0x07, 0x4E, 0xBA, 
-    0x1C, 0x04, 0x72, 0xFF, 0xB2, 0x80, 0x50, 0x4F, 0x66, 0x3C, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 
-    0x2C, 0x00, 0x70, 0x25, 0xB0, 0x86, 0x66, 0x3C, 0x10, 0x1B, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 
-    0x2F, 0x06, 0x4E, 0xAD, 0x03, 0xCA, 0x72, 0x6E, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x26, 0x20, 0x2E, 
-    0xFE, 0x4A, 0xD0, 0xAE, 0xFE, 0x46, 0x58, 0xAE, 0x00, 0x10, 0x20, 0x6E, 0x00, 0x10, 0x20, 0x68, 
-    0xFF, 0xFC, 0x20, 0x80, 0x60, 0x0E, 0x4A, 0xAE, 0xFE, 0x62, 0x66, 0x00, 0xF7, 0xA0, 0x20, 0x2E, 
-    0xFE, 0x4E, 0x60, 0x12, 0x4A, 0xAE, 0xFE, 0x46, 0x56, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 
-    0xFE, 0x4E, 0x60, 0x02, 0x70, 0xFF, 0x4C, 0xEE, 0x1C, 0xF8, 0xFE, 0x18, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x87, 0x5F, 0x64, 0x6F, 0x73, 0x63, 0x61, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 
-    0x1F, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 
-    0x00, 0x14, 0x4A, 0x85, 0x63, 0x04, 0x4A, 0x84, 0x62, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x50, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x00, 0x00, 0xB8, 0x20, 0x05, 
-    0x22, 0x04, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 0x2F, 0x06, 0x2F, 0x0B, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x5A, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x08, 
-    0x00, 0x6C, 0x00, 0x10, 0x00, 0x12, 0x60, 0x72, 0x4A, 0x87, 0x6C, 0x04, 0x7E, 0x00, 0x60, 0x6A, 
-    0xBC, 0x87, 0x63, 0x66, 0x20, 0x07, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x2A, 0x2D, 0x40, 0xFF, 0xFC, 
-    0xD7, 0xC6, 0x9C, 0x87, 0x2F, 0x06, 0x2F, 0x0B, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 
-    0x4E, 0xAD, 0x03, 0x5A, 0x2E, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x66, 0x0E, 0x00, 0x6C, 0x00, 0x10, 
-    0x00, 0x12, 0x20, 0x2E, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0xD6, 0xBC, 0x87, 0x67, 0x04, 0x4A, 0x87, 
-    0x6C, 0x06, 0x20, 0x04, 0x60, 0x00, 0x00, 0xC8, 0x4A, 0xAD, 0xF9, 0x28, 0x66, 0x06, 0x4A, 0x6D, 
-    0xF9, 0x26, 0x67, 0x06, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x20, 0x07, 0x22, 0x05, 0x4E, 0xAD, 
-    0x01, 0x2A, 0xD0, 0xAE, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0xA6, 0xBC, 0x87, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x06, 0x20, 0x04, 0x60, 0x00, 0x00, 0x98, 0x20, 0x07, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x2A, 
-    0x60, 0x00, 0x00, 0x8C, 0x20, 0x04, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 0x4A, 0x94, 
-    0x6E, 0x28, 0x2F, 0x0C, 0x4E, 0xBA, 0x10, 0xF6, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x14, 
-    0x20, 0x06, 0xD0, 0x85, 0x53, 0x80, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x04, 0x92, 0x80, 
-    0x20, 0x01, 0x60, 0x5A, 0x53, 0xAC, 0x00, 0x04, 0x52, 0x94, 0xBC, 0x94, 0x55, 0xC3, 0x44, 0x03, 
-    0x67, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x14, 0x2E, 0x00, 0x2F, 0x07, 0x2F, 0x2C, 0x00, 0x04, 
-    0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0xEA, 0xD0, 0x87, 0x26, 0x40, 0x9F, 0x94, 0xDF, 0xAC, 0x00, 0x04, 
-    0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6F, 0x08, 0x2F, 0x0C, 
-    0x4E, 0xBA, 0x16, 0x02, 0x58, 0x4F, 0x9C, 0x87, 0x4A, 0x86, 0x66, 0x82, 0x20, 0x04, 0x4C, 0xEE, 
-    0x18, 0xF8, 0xFF, 0xE0, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 
-    0x4E, 0x56, 0xFF, 0xFC, 0x48, 0xE7, 0x1F, 0x18, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x14, 0x4A, 0x85, 0x63, 0x50, 0x4A, 0x84, 0x63, 0x4C, 0x76, 0x01, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x66, 0x22, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 
-    0x66, 0x10, 0x4A, 0x94, 0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 
-    0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0xD6, 0x4A, 0x80, 
-    0x58, 0x4F, 0x60, 0x02, 0x70, 0x00, 0x67, 0x06, 0x70, 0x00, 0x60, 0x00, 0x01, 0x2E, 0x20, 0x04, 
-    0x22, 0x05, 0x4E, 0xAD, 0x01, 0x1A, 0x2C, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 
-    0xC2, 0x40, 0x67, 0x00, 0x00, 0x86, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 
-    0x67, 0x30, 0x2F, 0x06, 0x2F, 0x2E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 
-    0x4E, 0xAD, 0x03, 0x62, 0x2E, 0x00, 0xBC, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x3C, 0x4A, 0xAD, 
-    0xF9, 0x28, 0x66, 0x06, 0x4A, 0x6D, 0xF9, 0x26, 0x67, 0x30, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 
-    0x60, 0x28, 0x7E, 0x00, 0x60, 0x20, 0x2F, 0x0C, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 0x12, 0x12, 0x72, 0xFF, 0xB2, 0x80, 
-    0x50, 0x4F, 0x67, 0x06, 0x52, 0x87, 0xBC, 0x87, 0x62, 0xDC, 0x4A, 0x87, 0x6C, 0x06, 0x70, 0x00, 
-    0x60, 0x00, 0x00, 0xA8, 0xBC, 0x87, 0x66, 0x06, 0x20, 0x04, 0x60, 0x00, 0x00, 0x9E, 0x20, 0x07, 
-    0x22, 0x05, 0x4E, 0xAD, 0x01, 0x2A, 0x60, 0x00, 0x00, 0x92, 0x2D, 0x6C, 0x00, 0x0C, 0xFF, 0xFC, 
-    0x60, 0x22, 0x2F, 0x0C, 0x4E, 0xBA, 0x13, 0x48, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x14, 
-    0x20, 0x06, 0xD0, 0x85, 0x53, 0x80, 0x22, 0x05, 0x4E, 0xAD, 0x01, 0x2A, 0x22, 0x04, 0x92, 0x80, 
-    0x20, 0x01, 0x60, 0x66, 0x26, 0x6C, 0x00, 0x04, 0x2E, 0x2E, 0xFF, 0xFC, 0x9E, 0x8B, 0x4A, 0x87, 
-    0x6F, 0xD0, 0xBE, 0x86, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x20, 0x06, 0x60, 0x02, 0x20, 0x07, 
-    0x2E, 0x00, 0x2F, 0x07, 0x2F, 0x2E, 0x00, 0x08, 0x2F, 0x0B, 0x4E, 0xAD, 0x03, 0xEA, 0x9F, 0x94, 
-    0xDF, 0xAC, 0x00, 0x04, 0x20, 0x2C, 0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 
-    0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x14, 0x5E, 0x58, 0x4F, 0x9C, 0x87, 0x4A, 0x86, 0x66, 0x04, 
-    0x20, 0x04, 0x60, 0x06, 0xDF, 0xAE, 0x00, 0x08, 0x60, 0x9A, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE0, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x41, 0xEE, 0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x2F, 0x0C, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xF4, 0x04, 0x2E, 0x00, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x73, 0x63, 0x61, 0x6E, 0x66, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x41, 0xEE, 
-    0x00, 0x0C, 0x26, 0x48, 0x58, 0x4B, 0x2F, 0x0C, 0x2F, 0x0B, 0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 
-    0x01, 0x1A, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 0x4C, 0xEE, 0x18, 0x80, 0xFF, 0xF4, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x66, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x10, 
-    0x2F, 0x2E, 0x00, 0x0C, 0x4E, 0xBA, 0x00, 0xD4, 0x2E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x20, 0x07, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x76, 0x66, 0x70, 0x72, 0x69, 
-    0x6E, 0x74, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xEA, 0x48, 0xE7, 0x01, 0x08, 0x2D, 0x7C, 
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x2D, 0x6E, 0x00, 0x08, 0xFF, 0xEE, 0x2D, 0x6E, 0x00, 0x08, 
-    0xFF, 0xF2, 0x3D, 0x7C, 0x00, 0x02, 0xFF, 0xFC, 0x3D, 0x7C, 0x00, 0x14, 0xFF, 0xFE, 0x41, 0xEE, 
-    0x00, 0x0C, 0x28, 0x48, 0x58, 0x4C, 0x48, 0x6E, 0xFF, 0xEA, 0x2F, 0x0C, 0x2F, 0x2E, 0x00, 0x0C, 
-    0x4E, 0xBA, 0x00, 0x68, 0x2E, 0x00, 0x20, 0x6E, 0xFF, 0xEE, 0x42, 0x10, 0x20, 0x07, 0x4C, 0xEE, 
-    0x10, 0x80, 0xFF, 0xE2, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x73, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x00, 0x2E, 0x2E, 0x00, 0x08, 0x70, 0x61, 
-    0xB0, 0x87, 0x5F, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x07, 0x72, 0x57, 0x90, 0x81, 0x60, 0x18, 
-    0x70, 0x41, 0xB0, 0x87, 0x5F, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x07, 0x72, 0x37, 0x90, 0x81, 
-    0x60, 0x06, 0x20, 0x07, 0x72, 0x30, 0x90, 0x81, 0x4C, 0xEE, 0x00, 0x88, 0xFF, 0xF8, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x85, 0x74, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0x3A, 0x48, 0xE7, 
-    0x1F, 0x18, 0x28, 0x6E, 0x00, 0x10, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x3E, 0x26, 0x6E, 0x00, 0x08, 
-    0x60, 0x08, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 
-    0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x67, 0x06, 0x70, 0x25, 0xB0, 0x86, 0x66, 0xE4, 0x2E, 0x2E, 
-    0x00, 0x08, 0x9E, 0x8B, 0x4A, 0x87, 0x67, 0x6E, 0xDF, 0xAE, 0xFF, 0x3E, 0x70, 0x01, 0xB0, 0x87, 
-    0x66, 0x2E, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 0x10, 0x13, 0x4A, 0x80, 0x60, 0x48, 0x2F, 0x0C, 
-    0x70, 0x00, 0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 0x0F, 0x64, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x36, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 0xB2, 0x80, 0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 
-    0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xAD, 0x03, 0xEA, 0xD0, 0x87, 0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 
-    0x00, 0x0C, 0x60, 0x12, 0x2F, 0x0C, 0x2F, 0x07, 0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 
-    0xFC, 0x40, 0x4F, 0xEF, 0x00, 0x10, 0x4A, 0x86, 0x66, 0x1A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x20, 0xC2, 0x40, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x0A, 0xCA, 0x20, 0x2E, 0xFF, 0x3E, 
-    0x60, 0x00, 0x0A, 0xC2, 0x42, 0xAE, 0xFF, 0x58, 0x42, 0xAE, 0xFF, 0x54, 0x42, 0x6E, 0xFF, 0x52, 
-    0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x20, 0x67, 0x26, 0x57, 0x80, 0x67, 0x2C, 0x51, 0x80, 0x67, 0x0A, 
-    0x55, 0x80, 0x67, 0x10, 0x57, 0x80, 0x67, 0x2A, 0x60, 0x32, 0x30, 0x2E, 0xFF, 0x52, 0x52, 0x6E, 
-    0xFF, 0x52, 0x60, 0xCC, 0x30, 0x2E, 0xFF, 0x54, 0x52, 0x6E, 0xFF, 0x54, 0x60, 0xC2, 0x30, 0x2E, 
-    0xFF, 0x56, 0x52, 0x6E, 0xFF, 0x56, 0x60, 0xB8, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 
-    0x60, 0xAE, 0x30, 0x2E, 0xFF, 0x5A, 0x52, 0x6E, 0xFF, 0x5A, 0x60, 0xA4, 0x70, 0x2A, 0xB0, 0x86, 
-    0x66, 0x2C, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x46, 
-    0x6C, 0x12, 0x20, 0x2E, 0xFF, 0x46, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x46, 0x30, 0x2E, 0xFF, 0x54, 
-    0x52, 0x6E, 0xFF, 0x54, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x3E, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x46, 0x60, 0x1E, 0x22, 0x2E, 0xFF, 0x46, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 
-    0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 0x92, 0x80, 0x2D, 0x41, 0xFF, 0x46, 0x20, 0x2E, 0x00, 0x08, 
-    0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 
-    0x70, 0x30, 0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 0xB0, 0x86, 0x6C, 0xCA, 0x20, 0x6E, 0x00, 0x08, 
-    0x70, 0x2E, 0xB0, 0x10, 0x67, 0x04, 0x7A, 0xFF, 0x60, 0x5A, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 
-    0x00, 0x08, 0x70, 0x2A, 0xB0, 0x10, 0x66, 0x16, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 
-    0x2A, 0x28, 0xFF, 0xFC, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x60, 0x36, 0x7A, 0x00, 
-    0x60, 0x1A, 0x22, 0x05, 0xD2, 0x81, 0x20, 0x01, 0xE5, 0x89, 0xD2, 0x80, 0xD2, 0x86, 0x70, 0x30, 
-    0x92, 0x80, 0x2A, 0x01, 0x20, 0x2E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x20, 0x6E, 0x00, 0x08, 
-    0x10, 0x10, 0x48, 0x80, 0x48, 0xC0, 0x2C, 0x00, 0x70, 0x30, 0xB0, 0x86, 0x6E, 0x06, 0x70, 0x39, 
-    0xB0, 0x86, 0x6C, 0xCE, 0x42, 0x6E, 0xFF, 0x5C, 0x20, 0x6E, 0x00, 0x08, 0x10, 0x10, 0x04, 0x00, 
-    0x00, 0x4C, 0x67, 0x1A, 0x04, 0x00, 0x00, 0x1C, 0x67, 0x06, 0x59, 0x00, 0x67, 0x08, 0x60, 0x16, 
-    0x3D, 0x7C, 0xFF, 0xFE, 0xFF, 0x5C, 0x30, 0x2E, 0xFF, 0x5C, 0x52, 0x6E, 0xFF, 0x5C, 0x20, 0x2E, 
-    0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x41, 0xFA, 0x09, 0xA0, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 
-    0xFF, 0xE4, 0x42, 0x10, 0x2D, 0x48, 0xFF, 0x66, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x2D, 0x40, 
-    0xFF, 0x4A, 0x20, 0x6E, 0x00, 0x08, 0x52, 0xAE, 0x00, 0x08, 0x12, 0x10, 0x48, 0x81, 0x48, 0xC1, 
-    0x2C, 0x01, 0x67, 0x00, 0x06, 0xC2, 0x04, 0x81, 0x00, 0x00, 0x00, 0x45, 0x67, 0x00, 0x01, 0xF2, 
-    0x55, 0x81, 0x67, 0x00, 0x05, 0x30, 0x04, 0x81, 0x00, 0x00, 0x00, 0x09, 0x67, 0x00, 0x06, 0x32, 
-    0x51, 0x81, 0x67, 0x5C, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0B, 0x67, 0x00, 0x05, 0xCA, 0x53, 0x81, 
-    0x67, 0x36, 0x53, 0x81, 0x67, 0x00, 0x01, 0xCA, 0x53, 0x81, 0x67, 0x00, 0x03, 0xBE, 0x53, 0x81, 
-    0x67, 0x00, 0x05, 0x02, 0x55, 0x81, 0x67, 0x20, 0x5B, 0x81, 0x67, 0x00, 0x06, 0x3E, 0x53, 0x81, 
-    0x67, 0x1E, 0x53, 0x81, 0x67, 0x22, 0x57, 0x81, 0x67, 0x00, 0x05, 0xBA, 0x55, 0x81, 0x67, 0x08, 
-    0x57, 0x81, 0x67, 0x1C, 0x60, 0x00, 0x05, 0x8A, 0x70, 0x0A, 0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x16, 
-    0x70, 0x08, 0x2D, 0x40, 0xFF, 0x5E, 0x60, 0x0E, 0x30, 0x2E, 0xFF, 0x58, 0x52, 0x6E, 0xFF, 0x58, 
-    0x70, 0x10, 0x2D, 0x40, 0xFF, 0x5E, 0x4A, 0x85, 0x6D, 0x04, 0x42, 0x6E, 0xFF, 0x5A, 0x4A, 0x6E, 
-    0xFF, 0x5C, 0x6F, 0x10, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0x6A, 0x60, 0x36, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 
-    0xFF, 0x6A, 0x4A, 0x6E, 0xFF, 0x5C, 0x6C, 0x22, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 0x70, 0x69, 
-    0xB0, 0x86, 0x66, 0x0C, 0x30, 0x2E, 0xFF, 0x6C, 0x48, 0xC0, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x0A, 
-    0x70, 0x00, 0x30, 0x2E, 0xFF, 0x6C, 0x2D, 0x40, 0xFF, 0x6A, 0x70, 0x64, 0xB0, 0x86, 0x67, 0x06, 
-    0x70, 0x69, 0xB0, 0x86, 0x66, 0x38, 0x4A, 0xAE, 0xFF, 0x6A, 0x6C, 0x14, 0x41, 0xFA, 0x08, 0x4E, 
-    0x2D, 0x48, 0xFF, 0x62, 0x20, 0x2E, 0xFF, 0x6A, 0x44, 0x80, 0x2D, 0x40, 0xFF, 0x6A, 0x60, 0x1E, 
-    0x4A, 0x6E, 0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x08, 0x32, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 
-    0x4A, 0x6E, 0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x08, 0x20, 0x2D, 0x48, 0xFF, 0x62, 0x76, 0x01, 
-    0x70, 0x58, 0xB0, 0x86, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x86, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 
-    0x67, 0x08, 0x41, 0xFA, 0x08, 0x32, 0x20, 0x08, 0x60, 0x06, 0x41, 0xFA, 0x08, 0x18, 0x20, 0x08, 
-    0x2D, 0x40, 0xFF, 0x84, 0x41, 0xEE, 0xFF, 0x8C, 0x26, 0x48, 0x47, 0xEB, 0x00, 0x0B, 0x2D, 0x4B, 
-    0xFF, 0x42, 0x60, 0x24, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 0x4E, 0xAD, 0x01, 0x3A, 
-    0x20, 0x6E, 0xFF, 0x84, 0x17, 0x30, 0x08, 0x00, 0x20, 0x2E, 0xFF, 0x6A, 0x22, 0x2E, 0xFF, 0x5E, 
-    0x4E, 0xAD, 0x01, 0x2A, 0x2D, 0x40, 0xFF, 0x6A, 0x4A, 0xAE, 0xFF, 0x6A, 0x66, 0xD6, 0x20, 0x2E, 
-    0xFF, 0x42, 0x90, 0x8B, 0x2D, 0x40, 0xFF, 0x6E, 0x4A, 0x6E, 0xFF, 0x58, 0x67, 0x56, 0x70, 0x6F, 
-    0xB0, 0x86, 0x66, 0x22, 0x4A, 0x85, 0x6D, 0x12, 0x20, 0x2E, 0xFF, 0x6E, 0x52, 0x80, 0xB0, 0x85, 
-    0x6F, 0x42, 0x2A, 0x2E, 0xFF, 0x6E, 0x52, 0x85, 0x60, 0x3A, 0x20, 0x2E, 0xFF, 0x6E, 0x44, 0x80, 
-    0x2A, 0x00, 0x53, 0x85, 0x60, 0x2E, 0x4A, 0xAE, 0xFF, 0x6E, 0x67, 0x28, 0x20, 0x06, 0x04, 0x80, 
-    0x00, 0x00, 0x00, 0x58, 0x67, 0x16, 0x04, 0x80, 0x00, 0x00, 0x00, 0x18, 0x67, 0x04, 0x51, 0x80, 
-    0x66, 0x12, 0x41, 0xFA, 0x07, 0x7C, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x08, 0x41, 0xFA, 0x07, 0x6E, 
-    0x2D, 0x48, 0xFF, 0x62, 0x4A, 0x85, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x05, 0x44, 0x80, 
-    0x60, 0x02, 0x20, 0x05, 0x90, 0xAE, 0xFF, 0x6E, 0x2D, 0x40, 0xFF, 0x4A, 0x60, 0x00, 0x04, 0xCE, 
-    0x4A, 0x85, 0x6C, 0x02, 0x7A, 0x06, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 
-    0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x22, 0x05, 0x52, 0x81, 
-    0x74, 0x13, 0xB4, 0x81, 0x5E, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x22, 0x05, 0x52, 0x81, 0x60, 0x02, 
-    0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 
-    0xFF, 0xE6, 0x4E, 0xAD, 0x03, 0xD2, 0x26, 0x40, 0x4F, 0xEF, 0x00, 0x1E, 0x4A, 0xAE, 0xFF, 0x80, 
-    0x67, 0x0A, 0x41, 0xFA, 0x06, 0xD8, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x1E, 0x4A, 0x6E, 0xFF, 0x52, 
-    0x67, 0x0A, 0x41, 0xFA, 0x06, 0xC6, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 0x4A, 0x6E, 0xFF, 0x56, 
-    0x67, 0x08, 0x41, 0xFA, 0x06, 0xB4, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 0xFF, 0x8C, 0x2D, 0x48, 
-    0xFF, 0x42, 0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 0x00, 0xD6, 0x70, 0x4E, 0xB0, 0x13, 0x67, 0x00, 
-    0x00, 0xCE, 0x4A, 0x13, 0x56, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x10, 0x1B, 0x60, 0x02, 0x70, 0x30, 
-    0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x4A, 0x85, 0x66, 0x06, 
-    0x4A, 0x6E, 0xFF, 0x58, 0x67, 0x0E, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 
-    0x10, 0xBC, 0x00, 0x2E, 0x2D, 0x45, 0xFF, 0x4E, 0x60, 0x10, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 
-    0xFF, 0x42, 0x20, 0x40, 0x10, 0x9B, 0x53, 0xAE, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4E, 0x6F, 0x04, 
-    0x4A, 0x13, 0x66, 0xE6, 0x2E, 0x2E, 0xFF, 0x7C, 0x53, 0x87, 0x4A, 0x87, 0x6C, 0x06, 0x20, 0x07, 
-    0x44, 0x80, 0x2E, 0x00, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x32, 0x72, 0x30, 0xD0, 0x01, 
-    0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 
-    0x01, 0x22, 0x2E, 0x00, 0x66, 0xDE, 0x41, 0xEE, 0xFF, 0xE4, 0x55, 0x48, 0xB1, 0xEE, 0xFF, 0x66, 
-    0x65, 0xD2, 0x4A, 0xAE, 0xFF, 0x7C, 0x5E, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x2B, 0x60, 0x02, 
-    0x70, 0x2D, 0x53, 0xAE, 0xFF, 0x66, 0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x70, 0x5A, 0xB0, 0x86, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x45, 0x60, 0x02, 0x70, 0x65, 0x53, 0xAE, 0xFF, 0x66, 
-    0x20, 0x6E, 0xFF, 0x66, 0x10, 0x80, 0x47, 0xEE, 0xFF, 0x8C, 0x60, 0x00, 0x03, 0x60, 0x42, 0x6E, 
-    0xFF, 0x5A, 0x70, 0x49, 0xB0, 0x13, 0x66, 0x10, 0x48, 0x7A, 0x05, 0xCE, 0x2F, 0x2E, 0xFF, 0x42, 
-    0x4E, 0xAD, 0x04, 0x0A, 0x50, 0x4F, 0x60, 0x5C, 0x48, 0x7A, 0x05, 0xB4, 0x2F, 0x2E, 0xFF, 0x42, 
-    0x4E, 0xAD, 0x04, 0x0A, 0x10, 0x2B, 0x00, 0x03, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 0x4E, 0xBA, 
-    0xF9, 0xB2, 0xE9, 0x80, 0x2E, 0x00, 0x10, 0x2B, 0x00, 0x04, 0x48, 0x80, 0x48, 0xC0, 0x2F, 0x00, 
-    0x4E, 0xBA, 0xF9, 0xA0, 0xDE, 0x80, 0x78, 0x06, 0x4F, 0xEF, 0x00, 0x10, 0x20, 0x07, 0x72, 0x0A, 
-    0x4E, 0xAD, 0x01, 0x32, 0x72, 0x30, 0xD0, 0x01, 0x22, 0x04, 0x53, 0x84, 0xD2, 0xAE, 0xFF, 0x42, 
-    0x20, 0x41, 0x10, 0x80, 0x20, 0x07, 0x72, 0x0A, 0x4E, 0xAD, 0x01, 0x22, 0x2E, 0x00, 0x70, 0x04, 
-    0xB0, 0x84, 0x6F, 0xD8, 0x26, 0x6E, 0xFF, 0x42, 0x2F, 0x0B, 0x4E, 0xAD, 0x04, 0x12, 0xD0, 0x8B, 
-    0x2D, 0x40, 0xFF, 0x42, 0x58, 0x4F, 0x60, 0x00, 0x02, 0xD4, 0x4A, 0x85, 0x6C, 0x02, 0x7A, 0x06, 
-    0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 0xFF, 0xF6, 
-    0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 
-    0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x2F, 0x05, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 0x2F, 0x20, 
-    0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x03, 0xD2, 0x26, 0x40, 0x4F, 0xEF, 0x00, 0x1E, 
-    0x4A, 0xAE, 0xFF, 0x80, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xF4, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x1E, 
-    0x4A, 0x6E, 0xFF, 0x52, 0x67, 0x0A, 0x41, 0xFA, 0x04, 0xE2, 0x2D, 0x48, 0xFF, 0x62, 0x60, 0x0E, 
-    0x4A, 0x6E, 0xFF, 0x56, 0x67, 0x08, 0x41, 0xFA, 0x04, 0xD0, 0x2D, 0x48, 0xFF, 0x62, 0x41, 0xEE, 
-    0xFF, 0x8C, 0x2D, 0x48, 0xFF, 0x42, 0x70, 0x49, 0xB0, 0x13, 0x67, 0x00, 0xFE, 0xF2, 0x70, 0x4E, 
-    0xB0, 0x13, 0x67, 0x00, 0xFE, 0xEA, 0x20, 0x6E, 0xFF, 0x62, 0x4A, 0x10, 0x57, 0xC3, 0x44, 0x03, 
-    0x67, 0x04, 0x70, 0x00, 0x60, 0x02, 0x70, 0x01, 0x48, 0x80, 0x48, 0xC0, 0x22, 0x2E, 0xFF, 0x7C, 
-    0xD2, 0x80, 0x76, 0x01, 0x4A, 0x85, 0x6E, 0x08, 0x4A, 0x6E, 0xFF, 0x58, 0x66, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x06, 0x20, 0x05, 0x52, 0x80, 0x60, 0x02, 0x70, 0x00, 0xD0, 0x81, 0x72, 0x50, 
-    0xB2, 0x80, 0x6C, 0x06, 0x7A, 0x12, 0x60, 0x00, 0xFD, 0x58, 0x2E, 0x2E, 0xFF, 0x7C, 0x76, 0x01, 
-    0x4A, 0x87, 0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 
-    0x60, 0x02, 0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 
-    0x53, 0x87, 0x6E, 0xDA, 0x4A, 0x6E, 0xFF, 0x58, 0x66, 0x04, 0x4A, 0x85, 0x6F, 0x0E, 0x20, 0x2E, 
-    0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 0x20, 0x40, 0x10, 0xBC, 0x00, 0x2E, 0x2E, 0x05, 0x60, 0x28, 
-    0x76, 0x01, 0x52, 0xAE, 0xFF, 0x7C, 0x4A, 0xAE, 0xFF, 0x7C, 0x6F, 0x06, 0x4A, 0x13, 0x67, 0x02, 
-    0x76, 0x00, 0x4A, 0x03, 0x67, 0x04, 0x70, 0x30, 0x60, 0x02, 0x10, 0x1B, 0x22, 0x2E, 0xFF, 0x42, 
-    0x52, 0xAE, 0xFF, 0x42, 0x20, 0x41, 0x10, 0x80, 0x53, 0x87, 0x6C, 0xD4, 0x47, 0xEE, 0xFF, 0x8C, 
-    0x60, 0x00, 0x01, 0x8A, 0x4A, 0x85, 0x6C, 0x04, 0x7A, 0x06, 0x60, 0x06, 0x4A, 0x85, 0x66, 0x02, 
-    0x7A, 0x01, 0x06, 0xAE, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x41, 0xE8, 
-    0xFF, 0xF6, 0x43, 0xEE, 0xFF, 0x72, 0x22, 0xD8, 0x22, 0xD8, 0x32, 0xD8, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x6E, 0xFF, 0x80, 0x48, 0x6E, 0xFF, 0x7C, 0x72, 0x13, 0xB2, 0x85, 0x5E, 0xC3, 0x44, 0x03, 
-    0x67, 0x04, 0x22, 0x05, 0x60, 0x02, 0x72, 0x13, 0x2F, 0x01, 0x41, 0xEE, 0xFF, 0x7C, 0x2F, 0x20, 
-    0x2F, 0x20, 0x3F, 0x20, 0x48, 0x6E, 0xFF, 0xE6, 0x4E, 0xAD, 0x03, 0xD2, 0x26, 0x40, 0x28, 0x05, 
-    0x4A, 0x6E, 0xFF, 0x58, 0x4F, 0xEF, 0x00, 0x1E, 0x66, 0x26, 0x2F, 0x0B, 0x4E, 0xAD, 0x04, 0x12, 
-    0x2E, 0x00, 0xB8, 0x87, 0x58, 0x4F, 0x6F, 0x06, 0x28, 0x07, 0x60, 0x02, 0x53, 0x84, 0x70, 0x01, 
-    0xB0, 0x84, 0x6E, 0x0C, 0x20, 0x04, 0x53, 0x80, 0x72, 0x30, 0xB2, 0x33, 0x08, 0x00, 0x67, 0xEC, 
-    0x70, 0xFD, 0xB0, 0xAE, 0xFF, 0x7C, 0x6E, 0x06, 0xBA, 0xAE, 0xFF, 0x7C, 0x6C, 0x08, 0x2A, 0x04, 
-    0x53, 0x85, 0x60, 0x00, 0xFC, 0x78, 0x2A, 0x04, 0x9A, 0xAE, 0xFF, 0x7C, 0x60, 0x00, 0xFE, 0x52, 
-    0x1D, 0x46, 0xFF, 0x8C, 0x60, 0x0E, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x1D, 0x68, 
-    0xFF, 0xFF, 0xFF, 0x8C, 0x47, 0xEE, 0xFF, 0x8C, 0x20, 0x0B, 0x52, 0x80, 0x2D, 0x40, 0xFF, 0x42, 
-    0x60, 0x00, 0x00, 0xBA, 0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 
-    0x2D, 0x4B, 0xFF, 0x42, 0x4A, 0x85, 0x6C, 0x10, 0x2F, 0x0B, 0x4E, 0xAD, 0x04, 0x12, 0xD1, 0xAE, 
-    0xFF, 0x42, 0x58, 0x4F, 0x60, 0x00, 0x00, 0x96, 0x20, 0x2E, 0xFF, 0x42, 0x52, 0xAE, 0xFF, 0x42, 
-    0x20, 0x40, 0x4A, 0x10, 0x67, 0x04, 0x53, 0x85, 0x6C, 0xEE, 0x53, 0xAE, 0xFF, 0x42, 0x60, 0x7C, 
-    0x58, 0xAE, 0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x26, 0x68, 0xFF, 0xFC, 0x52, 0x4B, 0x2D, 0x4B, 
-    0xFF, 0x42, 0x76, 0x01, 0x4A, 0x85, 0x6D, 0x0C, 0x70, 0x00, 0x10, 0x2B, 0xFF, 0xFF, 0xB0, 0x85, 
-    0x6D, 0x02, 0x76, 0x00, 0x4A, 0x03, 0x67, 0x0A, 0x70, 0x00, 0x10, 0x2B, 0xFF, 0xFF, 0x4A, 0x80, 
-    0x60, 0x02, 0x20, 0x05, 0xD1, 0xAE, 0xFF, 0x42, 0x60, 0x42, 0x2D, 0x4B, 0xFF, 0x42, 0x58, 0xAE, 
-    0x00, 0x0C, 0x20, 0x6E, 0x00, 0x0C, 0x2D, 0x68, 0xFF, 0xFC, 0xFF, 0x88, 0x4A, 0x6E, 0xFF, 0x5C, 
-    0x66, 0x0A, 0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x20, 0x4A, 0x6E, 0xFF, 0x5C, 
-    0x6F, 0x0A, 0x20, 0x6E, 0xFF, 0x88, 0x20, 0xAE, 0xFF, 0x3E, 0x60, 0x10, 0x20, 0x6E, 0xFF, 0x88, 
-    0x30, 0xAE, 0xFF, 0x40, 0x60, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x02, 0x5A, 0x4A, 0xAE, 0xFF, 0x4E, 
-    0x6C, 0x06, 0x70, 0x00, 0x2D, 0x40, 0xFF, 0x4E, 0x4A, 0xAE, 0xFF, 0x4A, 0x6C, 0x06, 0x70, 0x00, 
-    0x2D, 0x40, 0xFF, 0x4A, 0x2F, 0x2E, 0xFF, 0x62, 0x4E, 0xAD, 0x04, 0x12, 0x22, 0x2E, 0xFF, 0x4A, 
-    0xD2, 0x80, 0x20, 0x2E, 0xFF, 0x4E, 0xD0, 0x81, 0x2E, 0x2E, 0xFF, 0x42, 0x9E, 0x8B, 0xD0, 0x87, 
-    0x41, 0xEE, 0xFF, 0xDE, 0xD0, 0x88, 0x5C, 0x80, 0x28, 0x00, 0x98, 0xAE, 0xFF, 0x66, 0x4A, 0x6E, 
-    0xFF, 0x5A, 0x58, 0x4F, 0x67, 0x1A, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x14, 0xB8, 0xAE, 0xFF, 0x46, 
-    0x6C, 0x0E, 0x20, 0x2E, 0xFF, 0x46, 0x90, 0x84, 0xD1, 0xAE, 0xFF, 0x4A, 0x28, 0x2E, 0xFF, 0x46, 
-    0xB8, 0xAE, 0xFF, 0x46, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x06, 0x20, 0x2E, 0xFF, 0x46, 0x60, 0x02, 
-    0x20, 0x04, 0xD1, 0xAE, 0xFF, 0x3E, 0x4A, 0x6E, 0xFF, 0x54, 0x66, 0x74, 0x60, 0x2A, 0x53, 0x94, 
-    0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x10, 0xBC, 0x00, 0x20, 0x70, 0x20, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 
-    0x4E, 0xBA, 0x05, 0xFA, 0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 
-    0x6F, 0xCC, 0x60, 0x3C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x1A, 0x20, 0x6E, 
-    0xFF, 0x62, 0x52, 0xAE, 0xFF, 0x62, 0x22, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x12, 0x90, 
-    0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x18, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x62, 0x52, 0xAE, 
-    0xFF, 0x62, 0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0xB2, 0x4A, 0x80, 0x50, 0x4F, 
-    0x20, 0x6E, 0xFF, 0x62, 0x4A, 0x10, 0x66, 0xBC, 0x60, 0x2A, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 
-    0x70, 0x30, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x30, 0x2F, 0x00, 0x4E, 0xBA, 0x05, 0x7E, 
-    0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4A, 0x4A, 0xAE, 0xFF, 0x4A, 0x6C, 0xCC, 0x4A, 0x87, 
-    0x6F, 0x00, 0x00, 0x98, 0x70, 0x01, 0xB0, 0x87, 0x66, 0x2E, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 
-    0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x93, 0x70, 0x00, 
-    0x10, 0x13, 0x4A, 0x80, 0x60, 0x74, 0x2F, 0x0C, 0x70, 0x00, 0x10, 0x13, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x05, 0x3C, 0x4A, 0x80, 0x50, 0x4F, 0x60, 0x62, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x72, 0x14, 
-    0xB2, 0x80, 0x66, 0x18, 0x2F, 0x07, 0x2F, 0x0B, 0x2F, 0x2C, 0x00, 0x04, 0x4E, 0xAD, 0x03, 0xEA, 
-    0xD0, 0x87, 0x29, 0x40, 0x00, 0x04, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x3E, 0x2F, 0x0C, 0x2F, 0x07, 
-    0x70, 0x01, 0x2F, 0x00, 0x2F, 0x0B, 0x4E, 0xBA, 0xF2, 0x18, 0x4F, 0xEF, 0x00, 0x10, 0x60, 0x2A, 
-    0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 
-    0x00, 0x04, 0x10, 0xBC, 0x00, 0x30, 0x70, 0x30, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x30, 
-    0x2F, 0x00, 0x4E, 0xBA, 0x04, 0xD8, 0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x4E, 0x4A, 0xAE, 
-    0xFF, 0x4E, 0x6C, 0xCC, 0x60, 0x3C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x1A, 
-    0x20, 0x6E, 0xFF, 0x66, 0x52, 0xAE, 0xFF, 0x66, 0x22, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 
-    0x12, 0x90, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x18, 0x2F, 0x0C, 0x20, 0x6E, 0xFF, 0x66, 
-    0x52, 0xAE, 0xFF, 0x66, 0x70, 0x00, 0x10, 0x10, 0x2F, 0x00, 0x4E, 0xBA, 0x04, 0x90, 0x4A, 0x80, 
-    0x50, 0x4F, 0x20, 0x6E, 0xFF, 0x66, 0x4A, 0x10, 0x66, 0xBC, 0x60, 0x2A, 0x53, 0x94, 0x4A, 0x94, 
-    0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0xBC, 
-    0x00, 0x20, 0x70, 0x20, 0x4A, 0x80, 0x60, 0x0E, 0x2F, 0x0C, 0x70, 0x20, 0x2F, 0x00, 0x4E, 0xBA, 
-    0x04, 0x5C, 0x4A, 0x80, 0x50, 0x4F, 0x53, 0xAE, 0xFF, 0x46, 0xB8, 0xAE, 0xFF, 0x46, 0x6F, 0xCC, 
-    0x60, 0x00, 0xF4, 0x8A, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0x1E, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 
-    0x64, 0x6F, 0x70, 0x72, 0x6E, 0x74, 0x00, 0x42, 0x20, 0x00, 0x2B, 0x00, 0x2D, 0x00, 0x4E, 0x41, 
-    0x4E, 0x28, 0x30, 0x30, 0x30, 0x29, 0x00, 0x00, 0x49, 0x4E, 0x46, 0x00, 0x30, 0x58, 0x00, 0x00, 
-    0x30, 0x78, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 
-    0x63, 0x64, 0x65, 0x66, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 
-    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 
-    0x49, 0xED, 0xFB, 0x8A, 0x60, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x02, 0x86, 0x58, 0x4F, 0x49, 0xEC, 
-    0x00, 0x16, 0xB9, 0xED, 0xFB, 0x86, 0x65, 0xEE, 0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x89, 0x5F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFC, 
-    0x48, 0xE7, 0x13, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x41, 0xED, 0x04, 0x4A, 0x22, 0x6D, 0xFA, 0x46, 
-    0x23, 0x48, 0x00, 0x08, 0x2C, 0x2D, 0xF9, 0x28, 0x3E, 0x2D, 0xF9, 0x26, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x10, 0x42, 0x6C, 0x00, 0x10, 0x41, 0xED, 0xFD, 0x42, 
-    0x29, 0x48, 0x00, 0x08, 0x60, 0x00, 0x00, 0xB2, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 
-    0x66, 0x44, 0x70, 0x00, 0x29, 0x40, 0x00, 0x08, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x12, 0x74, 0x40, 
-    0xC4, 0x41, 0x67, 0x08, 0x39, 0x7C, 0x00, 0x64, 0x00, 0x10, 0x60, 0x2A, 0x48, 0x6E, 0xFF, 0xFC, 
-    0x48, 0x78, 0x66, 0x03, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x6A, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x08, 0x39, 0x6E, 0xFF, 0xFE, 0x00, 0x10, 0x60, 0x06, 
-    0x39, 0x7C, 0x04, 0x00, 0x00, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x66, 0x5C, 0x72, 0x00, 0x32, 0x2C, 
-    0x00, 0x10, 0x20, 0x01, 0xA1, 0x1E, 0x29, 0x48, 0x00, 0x08, 0x66, 0x38, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x10, 0x0C, 0x40, 0x00, 0x64, 0x63, 0x2C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x0C, 0x40, 
-    0x04, 0x00, 0x52, 0xC3, 0x44, 0x03, 0x67, 0x08, 0x20, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x60, 0x02, 
-    0x70, 0x64, 0x39, 0x40, 0x00, 0x10, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x10, 0x20, 0x01, 0xA1, 0x1E, 
-    0x29, 0x48, 0x00, 0x08, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x08, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x12, 
-    0x60, 0x06, 0x00, 0x6C, 0x00, 0x04, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0xD0, 0xAC, 
-    0x00, 0x08, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 0x70, 0x00, 0x2F, 0x00, 
-    0x48, 0x78, 0x66, 0x02, 0x72, 0x00, 0x32, 0x2C, 0x00, 0x14, 0x2F, 0x01, 0x4E, 0xAD, 0x03, 0x6A, 
-    0x4A, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x06, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x12, 0x2B, 0x46, 
-    0xF9, 0x28, 0x3B, 0x47, 0xF9, 0x26, 0x4C, 0xEE, 0x10, 0xC8, 0xFF, 0xEC, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x88, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x62, 0x75, 0x66, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x00, 0x18, 0x26, 0x6E, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 
-    0x00, 0x81, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 
-    0x00, 0xEC, 0x00, 0x6B, 0x00, 0x01, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x10, 
-    0xC2, 0x40, 0x67, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xD4, 0x4A, 0xAB, 0x00, 0x08, 0x66, 0x08, 
-    0x2F, 0x0B, 0x4E, 0xBA, 0xFE, 0x78, 0x58, 0x4F, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x32, 0x3C, 
-    0x01, 0x00, 0xC2, 0x40, 0x67, 0x3C, 0x49, 0xED, 0xFB, 0x8A, 0x60, 0x30, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x32, 0x3C, 0x01, 0x02, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x0C, 0x80, 0x00, 0x00, 
-    0x01, 0x02, 0x66, 0x14, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x3E, 0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 
-    0x66, 0x06, 0x70, 0xFF, 0x60, 0x00, 0x00, 0x86, 0x49, 0xEC, 0x00, 0x16, 0xB9, 0xED, 0xFB, 0x86, 
-    0x65, 0xCA, 0x27, 0x6B, 0x00, 0x08, 0x00, 0x04, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 0x72, 0x04, 
-    0xC2, 0x40, 0x67, 0x04, 0x70, 0x01, 0x60, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x10, 0x4A, 0x80, 
-    0x2F, 0x00, 0x2F, 0x2B, 0x00, 0x08, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 
-    0x03, 0x5A, 0x26, 0x80, 0x53, 0x93, 0x4A, 0x93, 0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x10, 0x20, 0x6B, 
-    0x00, 0x04, 0x52, 0xAB, 0x00, 0x04, 0x70, 0x00, 0x10, 0x10, 0x4A, 0x80, 0x60, 0x2E, 0x70, 0xFF, 
-    0xB0, 0x93, 0x66, 0x1C, 0x00, 0x6B, 0x00, 0x10, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2B, 0x00, 0x12, 
-    0x32, 0x3C, 0x00, 0x80, 0xC2, 0x40, 0x67, 0x0E, 0x02, 0x6B, 0xFF, 0xFE, 0x00, 0x12, 0x60, 0x06, 
-    0x00, 0x6B, 0x00, 0x20, 0x00, 0x12, 0x70, 0x00, 0x26, 0x80, 0x70, 0xFF, 0x4C, 0xEE, 0x18, 0x00, 
-    0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x69, 0x6C, 0x62, 0x75, 0x66, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x7E, 0xFF, 0x20, 0x0C, 
-    0x66, 0x04, 0x70, 0xFF, 0x60, 0x6C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x83, 
-    0xC2, 0x40, 0x67, 0x36, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x67, 0x04, 
-    0x70, 0x00, 0x60, 0x0A, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x5E, 0x4A, 0x80, 0x58, 0x4F, 0x2E, 0x00, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x52, 0x4A, 0x80, 0x58, 0x4F, 
-    0x6C, 0x08, 0x7E, 0xFF, 0x70, 0x02, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x08, 0xC2, 0x40, 0x67, 0x0C, 0x20, 0x6C, 0x00, 0x08, 0xA0, 0x1F, 0x70, 0x00, 0x29, 0x40, 
-    0x00, 0x08, 0x42, 0x6C, 0x00, 0x12, 0x70, 0x00, 0x28, 0x80, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 
-    0x20, 0x07, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x66, 0x63, 0x6C, 
-    0x6F, 0x73, 0x65, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x11, 0x18, 0x28, 0x6E, 
-    0x00, 0x08, 0x7E, 0x00, 0x20, 0x0C, 0x66, 0x3A, 0x47, 0xED, 0xFB, 0x8A, 0x60, 0x1E, 0x70, 0x00, 
-    0x30, 0x2B, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x0E, 0x2F, 0x0B, 0x4E, 0xBA, 0xFF, 0xD8, 
-    0x4A, 0x80, 0x58, 0x4F, 0x67, 0x02, 0x7E, 0x01, 0x47, 0xEB, 0x00, 0x16, 0xB7, 0xED, 0xFB, 0x86, 
-    0x65, 0xDC, 0x4A, 0x87, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x00, 0x60, 0x6A, 0x70, 0xFF, 
-    0x60, 0x66, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x66, 0x20, 0x70, 0x00, 
-    0x28, 0x80, 0x70, 0x00, 0x60, 0x52, 0x2E, 0x2C, 0x00, 0x04, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0xD0, 
-    0x72, 0xFF, 0xB2, 0x80, 0x58, 0x4F, 0x66, 0x06, 0xBE, 0xAC, 0x00, 0x04, 0x67, 0x28, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x66, 0x1C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x02, 0xC2, 0x40, 0x67, 0x10, 0x4A, 0xAC, 0x00, 0x08, 0x67, 0x0A, 0x20, 0x2C, 0x00, 0x04, 
-    0xB0, 0xAC, 0x00, 0x08, 0x62, 0xC0, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 
-    0x67, 0x04, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0x88, 0xFF, 0xF0, 0x4E, 0x5E, 
-    0x4E, 0x75, 0x86, 0x66, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x00, 0x00, 0x00, 0x4E, 0x56, 0xFF, 0xFE, 
-    0x48, 0xE7, 0x11, 0x08, 0x1E, 0x2E, 0x00, 0x0B, 0x28, 0x6E, 0x00, 0x0C, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x52, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x42, 0xB2, 0x80, 0x66, 0x4C, 
-    0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x0C, 0x64, 0x00, 0x00, 0x8E, 0x20, 0x6C, 0x00, 0x04, 
-    0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 0x10, 0x07, 0x0C, 0x40, 0x00, 0x0D, 0x67, 0x0A, 
-    0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 0x01, 0x12, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x20, 
-    0x72, 0xFF, 0xB2, 0x80, 0x57, 0xC3, 0x44, 0x03, 0x58, 0x4F, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x06, 
-    0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x60, 0x00, 0x00, 0xF0, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x72, 0x16, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x06, 0xB2, 0x80, 0x66, 0x38, 
-    0x1D, 0x47, 0xFF, 0xFF, 0x70, 0x01, 0x2F, 0x00, 0x48, 0x6E, 0xFF, 0xFF, 0x72, 0x00, 0x32, 0x2C, 
-    0x00, 0x14, 0x2F, 0x01, 0x4E, 0xAD, 0x03, 0x62, 0x72, 0x01, 0xB2, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 
-    0x66, 0x0A, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x60, 0x00, 0x00, 0xB0, 0x00, 0x6C, 0x00, 0x20, 
-    0x00, 0x12, 0x70, 0xFF, 0x60, 0x00, 0x00, 0xA4, 0x76, 0x01, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 0x66, 0x22, 0x4A, 0xAC, 
-    0x00, 0x08, 0x67, 0x1C, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x10, 0x4A, 0x94, 
-    0x66, 0x0C, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x67, 0x02, 0x76, 0x00, 
-    0x4A, 0x03, 0x67, 0x0C, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x4A, 0x4A, 0x80, 0x58, 0x4F, 0x60, 0x02, 
-    0x70, 0x00, 0x67, 0x04, 0x70, 0xFF, 0x60, 0x52, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x62, 0x72, 0xFF, 
-    0xB2, 0x80, 0x58, 0x4F, 0x67, 0x2C, 0x53, 0x94, 0x4A, 0x94, 0x5C, 0xC3, 0x44, 0x03, 0x67, 0x12, 
-    0x20, 0x6C, 0x00, 0x04, 0x52, 0xAC, 0x00, 0x04, 0x10, 0x87, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 
-    0x60, 0x10, 0x2F, 0x0C, 0x70, 0x00, 0x10, 0x07, 0x2F, 0x00, 0x4E, 0xBA, 0xFE, 0xC0, 0x4A, 0x80, 
-    0x50, 0x4F, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x20, 0xC2, 0x40, 0x67, 0x04, 0x70, 0xFF, 
-    0x60, 0x06, 0x70, 0x00, 0x10, 0x07, 0x4A, 0x80, 0x48, 0xC0, 0x4C, 0xEE, 0x10, 0x88, 0xFF, 0xF2, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 0x00, 0x4E, 0x56, 
-    0xFF, 0xFC, 0x48, 0xE7, 0x17, 0x18, 0x28, 0x6E, 0x00, 0x08, 0x2D, 0x6C, 0x00, 0x04, 0xFF, 0xFC, 
-    0x2A, 0x14, 0x26, 0x6C, 0x00, 0x08, 0x2E, 0x2C, 0x00, 0x04, 0x9E, 0x8B, 0x29, 0x4B, 0x00, 0x04, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 0xC2, 0x40, 0x67, 0x04, 0x70, 0x00, 0x60, 0x08, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x4A, 0x80, 0x72, 0x00, 0x32, 0x00, 0x28, 0x81, 0x20, 0x2C, 
-    0x00, 0x0C, 0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 
-    0x60, 0x02, 0x22, 0x14, 0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x01, 0x28, 0x58, 0x4F, 
-    0x4A, 0x87, 0x6F, 0x56, 0x2F, 0x07, 0x2F, 0x0B, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 
-    0x4E, 0xAD, 0x03, 0x62, 0x2C, 0x00, 0xBC, 0x87, 0x4F, 0xEF, 0x00, 0x0C, 0x67, 0x3C, 0x00, 0x6C, 
-    0x00, 0x20, 0x00, 0x12, 0x4A, 0x86, 0x6E, 0x0A, 0x29, 0x6E, 0xFF, 0xFC, 0x00, 0x04, 0x28, 0x85, 
-    0x60, 0x24, 0x20, 0x07, 0x90, 0x86, 0x28, 0x80, 0xD0, 0xAC, 0x00, 0x08, 0x29, 0x40, 0x00, 0x04, 
-    0x2F, 0x14, 0x20, 0x06, 0xD0, 0xAC, 0x00, 0x08, 0x2F, 0x00, 0x2F, 0x2C, 0x00, 0x08, 0x4E, 0xAD, 
-    0x03, 0x42, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x18, 0xE8, 
-    0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x78, 0x66, 0x6C, 0x73, 0x62, 0x75, 0x66, 0x00, 
-    0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x10, 0x08, 0x28, 0x6E, 0x00, 0x08, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x12, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0xB2, 0x80, 
-    0x67, 0x2E, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 0xC2, 0x40, 0x66, 0x0A, 
-    0x00, 0x6C, 0x00, 0x20, 0x00, 0x12, 0x70, 0xFF, 0x60, 0x66, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 
-    0x72, 0xEF, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x72, 0x02, 0x82, 0x40, 0x39, 0x41, 0x00, 0x12, 
-    0x4A, 0xAC, 0x00, 0x04, 0x66, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0xA2, 0x58, 0x4F, 0x20, 0x2C, 
-    0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x66, 0x36, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x44, 
-    0xC2, 0x40, 0x66, 0x2A, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x10, 0x28, 0x80, 0x20, 0x2C, 0x00, 0x0C, 
-    0x90, 0xAC, 0x00, 0x04, 0x4A, 0x94, 0x5D, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x72, 0x00, 0x60, 0x02, 
-    0x22, 0x14, 0xB2, 0x80, 0x6F, 0x08, 0x2F, 0x0C, 0x4E, 0xBA, 0x00, 0x1A, 0x58, 0x4F, 0x70, 0x00, 
-    0x4C, 0xEE, 0x10, 0x08, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x87, 0x5F, 0x77, 0x72, 0x74, 0x63, 
-    0x68, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x28, 0x6E, 0x00, 0x08, 
-    0x2E, 0x2C, 0x00, 0x0C, 0x9E, 0xAC, 0x00, 0x04, 0x4A, 0x87, 0x6C, 0x08, 0x29, 0x6C, 0x00, 0x0C, 
-    0x00, 0x04, 0x60, 0x06, 0xBE, 0x94, 0x6C, 0x02, 0x28, 0x87, 0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x62, 0x75, 0x66, 0x73, 0x79, 0x6E, 0x63, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x2F, 0x0C, 0x49, 0xED, 0xFB, 0x8A, 0x60, 0x1C, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x32, 0x3C, 0x00, 0x83, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x66, 0x04, 
-    0x20, 0x0C, 0x60, 0x0C, 0x49, 0xEC, 0x00, 0x16, 0xB9, 0xED, 0xFB, 0x86, 0x65, 0xDE, 0x70, 0x00, 
-    0x28, 0x6E, 0xFF, 0xFC, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 0x66, 0x69, 0x6E, 0x64, 0x69, 0x6F, 
-    0x70, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x1F, 0x18, 0x26, 0x6E, 0x00, 0x0C, 
-    0x28, 0x6E, 0x00, 0x10, 0x20, 0x0C, 0x66, 0x0C, 0x70, 0x17, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0x00, 
-    0x60, 0x00, 0x01, 0x62, 0x4A, 0xAE, 0x00, 0x08, 0x67, 0x08, 0x20, 0x6E, 0x00, 0x08, 0x4A, 0x10, 
-    0x66, 0x0C, 0x70, 0x16, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x00, 0x01, 0x48, 0x76, 0x01, 
-    0x70, 0x2B, 0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x2B, 
-    0xB0, 0x2B, 0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2C, 0x03, 0x76, 0x01, 
-    0x70, 0x62, 0xB0, 0x2B, 0x00, 0x01, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x62, 
-    0xB0, 0x2B, 0x00, 0x02, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x2A, 0x03, 0x76, 0x01, 
-    0x70, 0x70, 0xB0, 0x2B, 0x00, 0x01, 0x67, 0x1E, 0x4A, 0x2B, 0x00, 0x01, 0x67, 0x08, 0x70, 0x70, 
-    0xB0, 0x2B, 0x00, 0x02, 0x67, 0x10, 0x4A, 0x2B, 0x00, 0x02, 0x67, 0x08, 0x70, 0x70, 0xB0, 0x2B, 
-    0x00, 0x03, 0x67, 0x02, 0x76, 0x00, 0x48, 0x83, 0x48, 0xC3, 0x28, 0x03, 0x10, 0x13, 0x04, 0x00, 
-    0x00, 0x61, 0x67, 0x2A, 0x04, 0x00, 0x00, 0x11, 0x67, 0x44, 0x5B, 0x00, 0x66, 0x52, 0x4A, 0x86, 
-    0x67, 0x04, 0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x48, 0x80, 0x32, 0x3C, 0x02, 0x00, 0x82, 0x40, 
-    0x30, 0x3C, 0x01, 0x00, 0x80, 0x41, 0x7E, 0x00, 0x3E, 0x00, 0x4A, 0x87, 0x60, 0x3C, 0x4A, 0x86, 
-    0x67, 0x04, 0x70, 0x02, 0x60, 0x02, 0x70, 0x01, 0x72, 0x08, 0x82, 0x00, 0x70, 0x00, 0x10, 0x01, 
-    0x32, 0x3C, 0x01, 0x00, 0x82, 0x40, 0x7E, 0x00, 0x3E, 0x01, 0x4A, 0x87, 0x60, 0x1C, 0x4A, 0x86, 
-    0x67, 0x04, 0x70, 0x02, 0x60, 0x02, 0x70, 0x00, 0x48, 0x80, 0x48, 0xC0, 0x2E, 0x00, 0x60, 0x0A, 
-    0x70, 0x16, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0x00, 0x60, 0x6A, 0x4A, 0x85, 0x67, 0x06, 0x00, 0x87, 
-    0x00, 0x00, 0x08, 0x00, 0x4A, 0x84, 0x67, 0x06, 0x00, 0x87, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x07, 
-    0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xAD, 0x03, 0x4A, 0x2A, 0x00, 0x50, 0x4F, 0x6C, 0x04, 0x70, 0x00, 
-    0x60, 0x42, 0x70, 0x00, 0x28, 0x80, 0x39, 0x45, 0x00, 0x14, 0x4A, 0x86, 0x67, 0x06, 0x32, 0x3C, 
-    0x00, 0x80, 0x60, 0x14, 0x70, 0x72, 0xB0, 0x13, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 0x70, 0x01, 
-    0x60, 0x02, 0x70, 0x02, 0x48, 0x80, 0x32, 0x00, 0x70, 0x00, 0x10, 0x01, 0x39, 0x40, 0x00, 0x12, 
-    0x70, 0x00, 0x29, 0x40, 0x00, 0x04, 0x29, 0x40, 0x00, 0x0C, 0x29, 0x40, 0x00, 0x08, 0x42, 0x6C, 
-    0x00, 0x10, 0x20, 0x0C, 0x4C, 0xEE, 0x18, 0xF8, 0xFF, 0xE4, 0x4E, 0x5E, 0x4E, 0x75, 0x88, 0x5F, 
-    0x65, 0x6E, 0x64, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x4E, 0xBA, 
-    0xFE, 0x20, 0x2F, 0x00, 0x2F, 0x2E, 0x00, 0x0C, 0x2F, 0x2E, 0x00, 0x08, 0x4E, 0xBA, 0xFE, 0x56, 
-    0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x6F, 0x70, 0x65, 0x6E, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 
-    0x48, 0xE7, 0x1F, 0x08, 0x28, 0x2E, 0x00, 0x10, 0x2A, 0x2E, 0x00, 0x0C, 0x28, 0x6E, 0x00, 0x08, 
-    0x02, 0x6C, 0xFF, 0xEF, 0x00, 0x12, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x4A, 0x80, 0x08, 0x00, 
-    0x00, 0x00, 0x67, 0x00, 0x00, 0xA8, 0x70, 0x02, 0xB0, 0x84, 0x6F, 0x6A, 0x4A, 0xAC, 0x00, 0x08, 
-    0x67, 0x64, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x66, 0x58, 0x2E, 0x14, 
-    0x2C, 0x05, 0x4A, 0x84, 0x66, 0x20, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 0x2F, 0x01, 0x74, 0x00, 
-    0x34, 0x2C, 0x00, 0x14, 0x2F, 0x02, 0x4E, 0xAD, 0x03, 0x82, 0x22, 0x07, 0x92, 0x80, 0xDC, 0x81, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x02, 0x9A, 0x87, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 
-    0x00, 0x80, 0xC2, 0x40, 0x66, 0x20, 0x4A, 0x87, 0x6F, 0x1C, 0xBE, 0x86, 0x6D, 0x18, 0x20, 0x2C, 
-    0x00, 0x08, 0x90, 0xAC, 0x00, 0x04, 0xB0, 0x86, 0x6E, 0x0C, 0xDD, 0xAC, 0x00, 0x04, 0x9D, 0x94, 
-    0x70, 0x00, 0x60, 0x00, 0x00, 0x92, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x80, 
-    0xC2, 0x40, 0x67, 0x0C, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 0x02, 0x6C, 0xFF, 0xFE, 0x00, 0x12, 
-    0x2F, 0x04, 0x2F, 0x05, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x82, 
-    0x2C, 0x00, 0x70, 0x00, 0x28, 0x80, 0x4F, 0xEF, 0x00, 0x0C, 0x60, 0x4A, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 0xC2, 0x40, 0x67, 0x3C, 0x2F, 0x0C, 0x4E, 0xBA, 0xF9, 0x28, 
-    0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x80, 0xC2, 0x40, 0x58, 0x4F, 0x67, 0x10, 
-    0x70, 0x00, 0x28, 0x80, 0x02, 0x6C, 0xFF, 0xFD, 0x00, 0x12, 0x29, 0x6C, 0x00, 0x08, 0x00, 0x04, 
-    0x2F, 0x04, 0x2F, 0x05, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x14, 0x2F, 0x00, 0x4E, 0xAD, 0x03, 0x82, 
-    0x2C, 0x00, 0x4F, 0xEF, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x86, 0x57, 0xC3, 0x44, 0x03, 0x67, 0x04, 
-    0x70, 0xFF, 0x60, 0x02, 0x70, 0x00, 0x4C, 0xEE, 0x10, 0xF8, 0xFF, 0xE8, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x85, 0x66, 0x73, 0x65, 0x65, 0x6B, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x03, 0x08, 
-    0x28, 0x6E, 0x00, 0x08, 0x4A, 0x94, 0x6C, 0x04, 0x70, 0x00, 0x28, 0x80, 0x70, 0x00, 0x30, 0x2C, 
-    0x00, 0x12, 0x4A, 0x80, 0x08, 0x00, 0x00, 0x00, 0x67, 0x08, 0x20, 0x14, 0x44, 0x80, 0x2E, 0x00, 
-    0x60, 0x48, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x32, 0x3C, 0x00, 0x82, 0xC2, 0x40, 0x67, 0x30, 
-    0x7E, 0x00, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x02, 0xC2, 0x40, 0x67, 0x2C, 0x4A, 0xAC, 
-    0x00, 0x08, 0x67, 0x26, 0x70, 0x00, 0x30, 0x2C, 0x00, 0x12, 0x72, 0x04, 0xC2, 0x40, 0x70, 0x00, 
-    0x30, 0x01, 0x4A, 0x80, 0x66, 0x14, 0x2E, 0x2C, 0x00, 0x04, 0x9E, 0xAC, 0x00, 0x08, 0x60, 0x0A, 
-    0x70, 0x16, 0x2B, 0x40, 0xF9, 0x28, 0x70, 0xFF, 0x60, 0x28, 0x70, 0x01, 0x2F, 0x00, 0x72, 0x00, 
-    0x2F, 0x01, 0x74, 0x00, 0x34, 0x2C, 0x00, 0x14, 0x2F, 0x02, 0x4E, 0xAD, 0x03, 0x82, 0x2C, 0x00, 
-    0x4F, 0xEF, 0x00, 0x0C, 0x6D, 0x04, 0xDC, 0x87, 0x60, 0x06, 0x70, 0x16, 0x2B, 0x40, 0xF9, 0x28, 
-    0x20, 0x06, 0x4C, 0xEE, 0x10, 0xC0, 0xFF, 0xF4, 0x4E, 0x5E, 0x4E, 0x75, 0x85, 0x66, 0x74, 0x65, 
-    0x6C, 0x6C, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x48, 0xE7, 0x01, 0x08, 0x2E, 0x2E, 0x00, 0x08, 
-    0x28, 0x6E, 0x00, 0x0C, 0x70, 0xFF, 0xB0, 0x87, 0x66, 0x04, 0x70, 0xFF, 0x60, 0x42, 0x70, 0x00, 
-    0x30, 0x2C, 0x00, 0x12, 0x72, 0x01, 0xC2, 0x40, 0x70, 0x00, 0x30, 0x01, 0x4A, 0x80, 0x67, 0x0A, 
-    0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 0x00, 0x08, 0x62, 0x18, 0x20, 0x2C, 0x00, 0x04, 0xB0, 0xAC, 
-    0x00, 0x08, 0x66, 0x0A, 0x4A, 0x94, 0x66, 0x06, 0x52, 0xAC, 0x00, 0x04, 0x60, 0x04, 0x70, 0xFF, 
-    0x60, 0x0E, 0x53, 0xAC, 0x00, 0x04, 0x20, 0x6C, 0x00, 0x04, 0x10, 0x87, 0x52, 0x94, 0x20, 0x07, 
-    0x4C, 0xEE, 0x10, 0x80, 0xFF, 0xF8, 0x4E, 0x5E, 0x4E, 0x75, 0x86, 0x75, 0x6E, 0x67, 0x65, 0x74, 
-    0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x82, 0x04, 0x8A, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x4E, 0x56, 0x00, 0x00, 0x48, 0x6D, 0xFF, 0xBA, 0x4E, 0xAD, 0x01, 0xD2, 0x48, 0x6D, 0xFF, 0xBA, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x70, 0x4E, 0xAD, 0x01, 0x8A, 0x48, 0x6D, 0xFF, 0xBA, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x2E, 0x4E, 0xAD, 0x01, 0xA2, 0x48, 0x6D, 0xFF, 0xBA, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xFE, 0xEC, 0x4E, 0xAD, 0x01, 0xA2, 0x48, 0x6D, 0xFF, 0xBA, 
-    0x70, 0x00, 0x2F, 0x00, 0x48, 0x6D, 0xFE, 0xAA, 0x4E, 0xAD, 0x01, 0xA2, 0x4E, 0x5E, 0x4E, 0x75, 
-    0x9A, 0x5F, 0x5F, 0x73, 0x74, 0x69, 0x5F, 0x5F, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 
-    0x63, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x73, 0x5F, 0x63, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x8A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x56, 0x00, 0x00, 0x70, 0x02, 
-    0x2F, 0x00, 0x48, 0x6D, 0xFE, 0xAA, 0x4E, 0xAD, 0x01, 0x9A, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6D, 
-    0xFE, 0xEC, 0x4E, 0xAD, 0x01, 0x9A, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x2E, 0x4E, 0xAD, 
-    0x01, 0x9A, 0x70, 0x02, 0x2F, 0x00, 0x48, 0x6D, 0xFF, 0x70, 0x4E, 0xAD, 0x01, 0x92, 0x70, 0x02, 
-    0x2F, 0x00, 0x48, 0x6D, 0xFF, 0xBA, 0x4E, 0xAD, 0x01, 0xDA, 0x4E, 0x5E, 0x4E, 0x75, 0x9A, 0x5F, 
-    0x5F, 0x73, 0x74, 0x64, 0x5F, 0x5F, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x5F, 0x63, 0x73, 
-    0x74, 0x72, 0x65, 0x61, 0x6D, 0x73, 0x5F, 0x63, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-    0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 0x30, 0x28, 0x31, 0x2E, 0x30, 0x2C, 0x20, 
-    0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x65, 0x20, 
-    0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x31, 
-    0x39, 0x39, 0x38, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x31, 0x2E, 
-    0x30, 0x0F, 0x4E, 0x65, 0x77, 0x74, 0x6F, 0x6E, 0x20, 0x44, 0x44, 0x4B, 0x73, 0x20, 0x31, 0x2E, 
-    0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x29, 0xA1, 0x00, 0x01, 0x28, 0xA1, 0x00, 0x00, 0x01, 
-    0x67, 0x02, 0x75, 0x77, 0x7C, 0x2A, 0xF8, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xD6, 0x00, 0x01, 0x43, 
-    0x4F, 0x44, 0x45, 0x00, 0x0B, 0x00, 0x12, 0x76, 0x65, 0x72, 0x73, 0x00, 0x01, 0x00, 0xA2, 0x00, 
-    0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x14, 
-    0x00, 0x04, 0x84, 0x02, 0x75, 0x7A, 0xF8, 0x00, 0x01, 0x00, 0x11, 0x14, 0x00, 0x0B, 0xE2, 0x02, 
-    0x75, 0x77, 0x58, 0x00, 0x02, 0x00, 0x16, 0x20, 0x00, 0xD5, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x00, 0x1C, 0x20, 0x00, 0xD7, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x23, 0x20, 
-    0x00, 0xE2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2B, 0x20, 0x00, 0xE2, 0x94, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x33, 0x20, 0x00, 0xF8, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x00, 0x3B, 0x20, 0x01, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x41, 0x20, 
-    0x01, 0x26, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x6A, 0x20, 0x01, 0x27, 0x24, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7E, 0x20, 0x01, 0x27, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xFF, 0xFF, 0x20, 0x01, 0x28, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 
-    0x01, 0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 0x10, 0x33, 0x32, 0x2D, 0x62, 0x69, 0x74, 0x20, 0x62, 
-    0x6F, 0x6F, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x04, 0x4D, 0x61, 0x69, 0x6E, 0x05, 0x53, 0x41, 
-    0x44, 0x45, 0x56, 0x06, 0x49, 0x4E, 0x54, 0x45, 0x4E, 0x56, 0x07, 0x53, 0x41, 0x4E, 0x45, 0x4C, 
-    0x49, 0x42, 0x07, 0x25, 0x41, 0x35, 0x49, 0x6E, 0x69, 0x74, 0x07, 0x53, 0x54, 0x44, 0x43, 0x4C, 
-    0x49, 0x42, 0x05, 0x53, 0x54, 0x44, 0x49, 0x4F, 0x28, 0x25, 0x5F, 0x53, 0x74, 0x61, 0x74, 0x69, 
-    0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x44, 0x65, 
-    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x5F, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 
-    0x73, 0x13, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x43, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 
-    0x63, 0x74, 0x6F, 0x72, 0x73, 0x12, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x5F, 0x44, 0x65, 0x73, 
-    0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x73, 
-};
-
-unsigned char *gAppResource = rsrc;
-unsigned int gAppResourceSize = sizeof(rsrc);
+MOS_INCBIN("rsrc_rex.bin")
+unsigned int gAppResourceCompressed = 1;
 
@@ -23,10 +23,7 @@
 //    UInt32 CmpStringMarks(BytePtr textPtrA, BytePtr textPtrB, UInt32 lengthAB) ??
 //    int CountResources(theType: ResType) Given the type, return the number of resources of that type accessable in ALL open maps.
 //    int CurResFile() : Returns the reference number of the current resource file.
-//    Get1IxResource not documented
-//    void HNoPurge(handle h) : make a resource unpurgeable!
 //    int HomeResFile(theResource: Handle) : Given a handle, returns the refnum of the resource file that the resource lives in.
-//    void HPurge(handle h) : make a resource purgeable but don;t purge it!
 //    handle NewHandle() : allocate memory and a master pointer to it
 //    void ReleaseResource(handle) : Given handle, releases the resource and disposes of the handle.
 //    SecondsToDate
@@ -54,6 +51,7 @@
 #include "resourcefork.h"
 #include "breakpoints.h"
 #include "fileio.h"
+#include "systemram.h"
 
 // Inlcude Musahi's m68k emulator
 
@@ -114,6 +112,12 @@ uint16_t gCurrentTrap = 0;
 // every entry in this array points to an m68k code segmen ("glue") that calls a native function in host memory
 mosPtr *tncTable = 0;
 
+// a copy of tncTable for restoring a snapshot
+static mosPtr *gSavedTncTable = 0;
+
+// all glue created by createGlue(), so that snapshots can fix the host pointers
+static std::vector<mosPtr> gMosGlue;
+
 
 /**
  * Load a resource using a fourCC code.
@@ -160,7 +164,9 @@ void trapLoadResource(unsigned short )
     unsigned int ret  = mosRead32(sp); sp += 4;
     unsigned int hdl  = m68k_read_memory_32(sp); sp+=4;
 
-    hdl = 0; // we don;t support unloaded resources, so the resource should still be in memory
+    // reload the resource if it was purged
+    gMosResErr = LoadResource(hdl);
+    mosTrace("            LoadResource(0x%08X) = %d\n", hdl, gMosResErr);
 
     sp-=4; m68k_write_memory_32(sp, ret);
 
@@ -199,6 +205,60 @@ void trapGetNamedResource(unsigned short )
 }
 
 
+/**
+ * [A80D] Count the resources of a given type.
+ *
+ * sp+8.w  = return value (number of resources)
+ * sp+4.l  = rsrc
+ * sp.l    = return address
+ */
+void trapCount1Resources(unsigned short )
+{
+    unsigned int sp   = m68k_get_reg(0L, M68K_REG_SP);
+
+    unsigned int ret  = m68k_read_memory_32(sp); sp+=4;
+    unsigned int rsrc = m68k_read_memory_32(sp); sp+=4;
+
+    unsigned int n = Count1Resources(rsrc);
+    mosTrace("            Count1Resources('%c%c%c%c') = %d\n",
+             rsrc>>24, rsrc>>16, rsrc>>8, rsrc, n);
+    gMosResErr = 0;
+
+    m68k_write_memory_16(sp, n);
+    sp-=4; m68k_write_memory_32(sp, ret);
+
+    m68k_set_reg(M68K_REG_SP, sp);
+}
+
+
+/**
+ * [A80E] Load a resource using its index in the resource map.
+ *
+ * sp+10.l = return value (handle to resource)
+ * sp+6.l  = rsrc
+ * sp+4.w  = index, starting at 1
+ * sp.l    = return address
+ */
+void trapGet1IxResource(unsigned short )
+{
+    unsigned int sp    = m68k_get_reg(0L, M68K_REG_SP);
+
+    unsigned int ret   = m68k_read_memory_32(sp); sp+=4;
+    unsigned int index = m68k_read_memory_16(sp); sp+=2;
+    unsigned int rsrc  = m68k_read_memory_32(sp); sp+=4;
+
+    mosTrace("            Get1IxResource('%c%c%c%c', %d)\n",
+             rsrc>>24, rsrc>>16, rsrc>>8, rsrc, index);
+    mosHandle hdl = Get1IxResource(rsrc, index);
+    gMosResErr = hdl ? 0 : mosResNotFound;
+
+    m68k_write_memory_32(sp, hdl);
+    sp-=4; m68k_write_memory_32(sp, ret);
+
+    m68k_set_reg(M68K_REG_SP, sp);
+}
+
+
 /**
  * Size of the resource on disk.
  *
@@ -215,8 +275,9 @@ void trapSizeResource(unsigned short )
     unsigned int ret  = m68k_read_memory_32(sp); sp += 4;
     unsigned int hdl = m68k_read_memory_32(sp); sp+=4;
 
-    unsigned int ptr = m68k_read_memory_32(hdl);
-    unsigned int size = mosPtrSize(ptr);
+    // the size is taken from the file, so this also works for purged resources
+    unsigned int size = SizeResource(hdl);
+    gMosResErr = (size==0xffffffff) ? mosResNotFound : 0;
     mosTrace("            SizeResource(0x%08X) = %d\n", hdl, size);
 
     m68k_write_memory_32(sp, size);
@@ -232,9 +293,7 @@ void trapSizeResource(unsigned short )
  *
  * D0 = desired size in bytes.
  * \returns pointer to allocated area in A0
- * \returns possible error in D0
- *
- * \todo this must also set the global MemErr variable
+ * \returns possible error in D0 and MemErr
  */
 void trapNewPtrClear(unsigned short)
 {
@@ -242,9 +301,11 @@ void trapNewPtrClear(unsigned short)
 
     mosTrace("            NewPtrClear(%d)\n", size);
     unsigned int ptr = mosNewPtr(size);
+    int ret = (ptr==0 && size!=0) ? mosMemFullErr : 0;
 
+    mosSetMemError(ret);
     m68k_set_reg(M68K_REG_A0, ptr);
-    m68k_set_reg(M68K_REG_D0, 0);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
@@ -253,9 +314,7 @@ void trapNewPtrClear(unsigned short)
  *
  * D0 = desired size in bytes.
  * \returns pointer to allocated area in A0
- * \returns possible error in D0
- *
- * \todo this must also set the global MemErr variable
+ * \returns possible error in D0 and MemErr
  */
 void trapNewPtr(unsigned short)
 {
@@ -263,9 +322,11 @@ void trapNewPtr(unsigned short)
 
     mosTrace("            NewPtr(%d)\n", size);
     unsigned int ptr = mosNewPtr(size);
+    int ret = (ptr==0 && size!=0) ? mosMemFullErr : 0;
 
+    mosSetMemError(ret);
     m68k_set_reg(M68K_REG_A0, ptr);
-    m68k_set_reg(M68K_REG_D0, 0);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
@@ -274,9 +335,7 @@ void trapNewPtr(unsigned short)
  *
  * D0 = desired size in bytes.
  * \returns handle to allocated area in A0
- * \returns possible error in D0
- *
- * \todo this must also set the global MemErr variable
+ * \returns possible error in D0 and MemErr
  */
 void trapNewHandle(unsigned short)
 {
@@ -285,9 +344,11 @@ void trapNewHandle(unsigned short)
 
     mosTrace("            NewHandle(%d)\n", size);
     hdl = mosNewHandle(size);
+    int ret = (hdl==0 && size!=0) ? mosMemFullErr : 0;
 
+    mosSetMemError(ret);
     m68k_set_reg(M68K_REG_A0, hdl);
-    m68k_set_reg(M68K_REG_D0, 0);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
@@ -350,7 +411,9 @@ void trapSetHandleSize(unsigned short)
     unsigned int ret = 0;
 
     ret = mosSetHandleSize(hdl, size);
+    mosTrace("            SetHandleSize(0x%08X, %d) = %d\n", hdl, size, ret);
 
+    mosSetMemError(ret);
     m68k_set_reg(M68K_REG_D0, ret);
 }
 
@@ -416,6 +479,7 @@ void trapBlockMove(unsigned short)
         mosError("The addresses seem highly unlikely. You may have an uninitialized pointer or an uncought error\n");
         // FIXME: however, it could be copying the app name from the global variable filed
     }
+    mosMarkDirty(dst, size);
     memmove(mosToHost(dst), mosToHost(src), size);
 
     m68k_set_reg(M68K_REG_D0, 0);
@@ -466,8 +530,10 @@ void trapSetTrapAddress(unsigned short)
  * sp+4.w = resource id for 'CODE' resource
  * sp.l   = return address = address of the jump table entry plus 6
  *
+ * All other jump table entries for the same segment are resolved as well,
+ * so every segment causes only one _LoadSeg call.
+ *
  * \todo separate the interface from the code.
- * \todo actually we need to fix *all* jump table entries for this particular ID!
  */
 void trapLoadSeg(unsigned short )
 {
@@ -482,13 +548,16 @@ void trapLoadSeg(unsigned short )
     if (!hCode) {
         mosDebug("Code Resource %d not found!\n", id);
     } else {
-        unsigned int code = m68k_read_memory_32(hCode);
-        // fix the jump table entry
-        hexDump(hCode, 64);
-        unsigned int offset = m68k_read_memory_16(ret-8);
-        m68k_write_memory_16(ret-8, id);           // save the block id
-        m68k_write_memory_16(ret-6, 0x4ef9);       // 'jmp nnnnnnnn' instruction
-        m68k_write_memory_32(ret-4, code+offset+4);  // +4 -> skip the entry that gives the number of jump table entries?
+        // fix all jump table entries for this segment
+        resolveJumpTable(id, hCode);
+        if (m68k_read_memory_16(ret-6)!=0x4ef9) {
+            // the entry that called us is not in the jump table
+            unsigned int code = m68k_read_memory_32(hCode);
+            unsigned int offset = m68k_read_memory_16(ret-8);
+            m68k_write_memory_16(ret-8, id);           // save the block id
+            m68k_write_memory_16(ret-6, 0x4ef9);       // 'jmp nnnnnnnn' instruction
+            m68k_write_memory_32(ret-4, code+offset+4);  // +4 -> skip the entry that gives the number of jump table entries?
+        }
     }
 
     sp -= 4; m68k_write_memory_32(sp, ret-6);
@@ -498,7 +567,7 @@ void trapLoadSeg(unsigned short )
 
 
 /**
- * Get the state of a master pointer.
+ * [A069] Get the state of a master pointer.
  *
  * If an error occurs during an attempt to get the state flags of the specified
  * relocatable block, HGetState returns the low-order byte of the result code as
@@ -512,43 +581,92 @@ void trapLoadSeg(unsigned short )
  *
  * A0 = Handle
  * \return state in D0 (signed char!)
- *
- * \todo return the correct value!
- * \todo set MemErr
- * \todo add support for these flags (it's all already in the memory manager)
  */
 void trapHGetState(unsigned short ) {
-    m68k_set_reg(M68K_REG_D0, 0x80); // locked memory // TODO: may need more flags!
+    unsigned int hdl = m68k_get_reg(0L, M68K_REG_A0);
+
+    int state = mosHGetState(hdl);
+    mosTrace("            HGetState(0x%08X) = 0x%02X\n", hdl, state & 0xff);
+
+    mosSetMemError(state<0 ? state : 0);
+    m68k_set_reg(M68K_REG_D0, state & 0xff);
+}
+
+
+/**
+ * [A06A] Set the state of a master pointer.
+ *
+ * A0 = Handle
+ * D0 = state as returned by HGetState
+ * \return result code in D0
+ */
+void trapHSetState(unsigned short ) {
+    unsigned int hdl = m68k_get_reg(0L, M68K_REG_A0);
+    unsigned int state = m68k_get_reg(0L, M68K_REG_D0);
+
+    int ret = mosHSetState(hdl, state);
+    mosTrace("            HSetState(0x%08X, 0x%02X)\n", hdl, state & 0xff);
+
+    mosSetMemError(ret);
+    m68k_set_reg(M68K_REG_D0, ret);
+}
+
+
+/**
+ * Set or clear a state flag of a relocatable block and set D0 and MemErr.
+ */
+static void mosChangeHandleState(byte set, byte clear)
+{
+    unsigned int hdl = m68k_get_reg(0L, M68K_REG_A0);
+
+    int ret = mosHGetState(hdl);
+    if (ret>=0) {
+        ret = mosHSetState(hdl, (ret & ~clear) | set);
+    }
+
+    mosSetMemError(ret);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
 /**
- * Move handles high in memory to make room for big allocations.
+ * [A064] Move handles high in memory to make room for big allocations.
  *
- * There is no benefit to moving handles high in memory in this simulation.
+ * A0 = Handle
+ * \return result code in D0
  */
 void trapMoveHHi(unsigned short ) {
-    // nothing to do here
+    unsigned int hdl = m68k_get_reg(0L, M68K_REG_A0);
+
+    int ret = mosMoveHHi(hdl);
+    mosTrace("            MoveHHi(0x%08X) = %d\n", hdl, ret);
+
+    mosSetMemError(ret);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
 /**
- * Lock mamory in position.
+ * [A029] Lock mamory in position.
+ *
+ * Locked blocks are not moved by compaction and not purged.
  *
- * We never move memory, so there is no reason to implement this.
+ * A0 = Handle
+ * \return result code in D0
  */
 void trapHLock(unsigned short ) {
-    // nothing to do here
+    mosChangeHandleState(kMosHandleLocked, 0);
 }
 
 
 /**
  * [A02A] Unlock mamory in position.
  *
- * We never move memory, so there is no reason to implement this.
+ * A0 = Handle
+ * \return result code in D0
  */
 void trapHUnlock(unsigned short ) {
-    // nothing to do here
+    mosChangeHandleState(0, kMosHandleLocked);
 }
 
 
@@ -594,6 +712,21 @@ void trapOSDispatch(unsigned short )
 
     switch (selector)
     {
+        case 0x15: { // mfMaxMemSel
+            // Returns the size, in bytes, of the largest contiguous free block in the current heap zone.
+            // Size TempMaxMem (Size *grow);
+            unsigned int growPtr = m68k_read_memory_32(sp); sp += 4;
+
+            if (growPtr) m68k_write_memory_32(growPtr, 0);
+            m68k_write_memory_32(sp, mosMaxBlock());
+            break;
+        }
+        case 0x18: { // mfFreeMemSel
+            // Returns the total amount of free space in the current heap zone.
+            // long TempFreeMem (void);
+            m68k_write_memory_32(sp, mosFreeMem());
+            break;
+        }
         case 0x1D: { // mfTempNewHandleSel
             // Allocates a new relocatable block of temporary memory.
             // Handle TempNewHandle (Size logicalSize, OSErr *resultCode);
@@ -603,14 +736,33 @@ void trapOSDispatch(unsigned short )
             unsigned int handle = mosNewHandle(size);
             mosTrace("trapDispatch(0x1D): Allocated a master pointer at 0x%08X\n", handle);
 
-            if (resultCodePtr) m68k_write_memory_16(resultCodePtr, 0);
+            int ret = (handle==0 && size!=0) ? mosMemFullErr : 0;
+            if (resultCodePtr) m68k_write_memory_16(resultCodePtr, ret);
             m68k_write_memory_32(sp, handle);
             break;
         }
-        case 0x1E: // TempHLock - nothing to do
-            break;
-        case 0x1F: // TempHUnlock - nothing to do
+        case 0x1E:   // mfTempHLockSel
+        case 0x1F: { // mfTempHUnlockSel
+            // Lock or unlock a block of temporary memory, so it won't move.
+            // void TempHLock (Handle h, OSErr *resultCode);
+            // void TempHUnlock (Handle h, OSErr *resultCode);
+            unsigned int resultCodePtr = m68k_read_memory_32(sp); sp += 4;
+            unsigned int handle = m68k_read_memory_32(sp); sp += 4;
+
+            int ret = mosHGetState(handle);
+            if (ret>=0) {
+                byte state = (byte)ret;
+                if (selector==0x1E)
+                    state |= kMosHandleLocked;
+                else
+                    state &= ~kMosHandleLocked;
+                ret = mosHSetState(handle, state);
+            }
+            mosTrace("Temp%s(0x%08X)\n", selector==0x1E ? "HLock" : "HUnlock", handle);
+
+            if (resultCodePtr) m68k_write_memory_16(resultCodePtr, ret);
             break;
+        }
         case 0x20: { // mfTempDisposHandleSel
             // Releases a relocatable block in the temporary heap.
             // void TempDisposeHandle (Handle h, OSErr *resultCode );
@@ -691,11 +843,117 @@ void trapTickCount(unsigned short )
 /**
  * [A049] Mark a block as purgeable.
  *
- * We never purge blocks in the simulation.
+ * A0 = Handle
+ * \return result code in D0
  */
 void trapHPurge(unsigned short )
 {
-    // nothing to do here
+    mosChangeHandleState(kMosHandlePurgeable, 0);
+}
+
+
+/**
+ * [A04A] Mark a block as unpurgeable.
+ *
+ * A0 = Handle
+ * \return result code in D0
+ */
+void trapHNoPurge(unsigned short )
+{
+    mosChangeHandleState(0, kMosHandlePurgeable);
+}
+
+
+/**
+ * [A02B] Free the memory of a relocatable block, but keep its master pointer.
+ *
+ * A0 = Handle
+ * \return result code in D0
+ */
+void trapEmptyHandle(unsigned short )
+{
+    unsigned int hdl = m68k_get_reg(0L, M68K_REG_A0);
+
+    int ret = mosEmptyHandle(hdl);
+    mosTrace("            EmptyHandle(0x%08X) = %d\n", hdl, ret);
+
+    mosSetMemError(ret);
+    m68k_set_reg(M68K_REG_D0, ret);
+}
+
+
+/**
+ * [A036] Allocate another block of master pointers.
+ */
+void trapMoreMasters(unsigned short )
+{
+    mosMoreMasters();
+    mosSetMemError(0);
+}
+
+
+/**
+ * [A01C] Return the total number of free bytes in the heap.
+ *
+ * \return free bytes in D0
+ */
+void trapFreeMem(unsigned short )
+{
+    unsigned int ret = mosFreeMem();
+    mosTrace("            FreeMem() = %d\n", ret);
+
+    m68k_set_reg(M68K_REG_D0, ret);
+}
+
+
+/**
+ * [A11D] Purge and compact the heap, then return the largest free block.
+ *
+ * \return size of the largest free block in D0
+ * \return number of bytes the heap can grow in A0 (our heap never grows)
+ */
+void trapMaxMem(unsigned short )
+{
+    unsigned int ret = mosMaxMem();
+    mosTrace("            MaxMem() = %d\n", ret);
+
+    m68k_set_reg(M68K_REG_A0, 0);
+    m68k_set_reg(M68K_REG_D0, ret);
+}
+
+
+/**
+ * [A04C] Compact the heap until a free block of the given size is available.
+ *
+ * D0 = number of contiguous bytes needed
+ * \return size of the largest free block in D0
+ */
+void trapCompactMem(unsigned short )
+{
+    unsigned int needed = m68k_get_reg(0L, M68K_REG_D0);
+
+    unsigned int ret = mosCompactMem(needed);
+    mosTrace("            CompactMem(%d) = %d\n", needed, ret);
+
+    m68k_set_reg(M68K_REG_D0, ret);
+}
+
+
+/**
+ * [A04D] Purge blocks until a free block of the given size is available.
+ *
+ * D0 = number of contiguous bytes needed
+ * \return result code in D0
+ */
+void trapPurgeMem(unsigned short )
+{
+    unsigned int needed = m68k_get_reg(0L, M68K_REG_D0);
+
+    int ret = mosPurgeMem(needed);
+    mosTrace("            PurgeMem(%d) = %d\n", needed, ret);
+
+    mosSetMemError(ret);
+    m68k_set_reg(M68K_REG_D0, ret);
 }
 
 
@@ -787,10 +1045,10 @@ void trapReadXPRam(unsigned short )
  * [A00C] _GetFileInfo.
  * int mosPBGetFInfo(unsigned int paramBlock, bool async)
  */
-void trapGetFileInfo(unsigned short )
+void trapGetFileInfo(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBGetFInfo(paramBlock, async);
 
@@ -802,10 +1060,10 @@ void trapGetFileInfo(unsigned short )
  * [A00D] _SetFileInfo.
  * int mosPBSetFInfo(unsigned int paramBlock, bool async)
  */
-void trapSetFileInfo(unsigned short )
+void trapSetFileInfo(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBSetFInfo(paramBlock, async);
 
@@ -817,10 +1075,10 @@ void trapSetFileInfo(unsigned short )
  * [A008] _Create
  * FUNCTION PBCreate (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapCreate(unsigned short )
+void trapCreate(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBCreate(paramBlock, async);
 
@@ -832,10 +1090,10 @@ void trapCreate(unsigned short )
  * [A012] _SetEOF
  * FUNCTION PBSetEOF (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapSetEOF(unsigned short )
+void trapSetEOF(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBSetEOF(paramBlock, async);
 
@@ -847,10 +1105,10 @@ void trapSetEOF(unsigned short )
  * [A012] _SetEOF
  * FUNCTION PBSetEOF (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapSetFPos(unsigned short )
+void trapSetFPos(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBSetFPos(paramBlock, async);
 
@@ -862,10 +1120,10 @@ void trapSetFPos(unsigned short )
  * [A002] _Read
  * FUNCTION PBRead (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapRead(unsigned short )
+void trapRead(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBRead(paramBlock, async);
 
@@ -877,10 +1135,10 @@ void trapRead(unsigned short )
  * [A003] _Write
  * FUNCTION PBWrite (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapWrite(unsigned short )
+void trapWrite(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBWrite(paramBlock, async);
 
@@ -892,10 +1150,10 @@ void trapWrite(unsigned short )
  * [A001] _Close
  * FUNCTION PBClose (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapClose(unsigned short )
+void trapClose(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBClose(paramBlock, async);
 
@@ -907,10 +1165,10 @@ void trapClose(unsigned short )
  * [A009] _Delete
  * FUNCTION PBClose (paramBlock: ParmBlkPtr; async: BOOLEAN) : OSErr;
  */
-void trapDelete(unsigned short )
+void trapDelete(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBDelete(paramBlock, async);
 
@@ -935,10 +1193,10 @@ void trapFSDispatch(unsigned short )
 /**
  * [A200] _HOpen
  */
-void trapHOpen(unsigned short )
+void trapHOpen(unsigned short instr)
 {
     unsigned int paramBlock = m68k_get_reg(0L, M68K_REG_A0);
-    unsigned int async = 0; // If bit 10 of the instruction is set, it is async.
+    bool async = (instr & 0x0400)!=0; // bit 10 of the trap is set for async calls
 
     unsigned int ret = mosPBHOpen(paramBlock, async);
 
@@ -1034,6 +1292,56 @@ void trapDispatch(unsigned short)
 }
 
 
+// registers of the app while a completion routine runs
+static unsigned int gMosCompletionRegs[M68K_REG_SR+1];
+static bool gMosInCompletion = false;
+// the glue that a completion routine returns to
+static mosPtr tncCompletionReturn = 0;
+
+
+/**
+ * Call an I/O completion routine of the app.
+ *
+ * This is done between two instructions, much like an interrupt: all
+ * registers are saved, and restored when the routine returns. The routine
+ * gets the parameter block in A0 and the result code in D0.
+ *
+ * \return false if the previous completion routine did not return yet
+ */
+bool mosCallCompletion(mosPtr routine, mosPtr paramBlock, int result)
+{
+    if (gMosInCompletion)
+        return false;
+    gMosInCompletion = true;
+    for (int i=M68K_REG_D0; i<=M68K_REG_SR; i++)
+        gMosCompletionRegs[i] = m68k_get_reg(0L, (m68k_register_t)i);
+    unsigned int sp = gMosCompletionRegs[M68K_REG_A7] - 4;
+    m68k_write_memory_32(sp, tncCompletionReturn);
+    m68k_set_reg(M68K_REG_SP, sp);
+    m68k_set_reg(M68K_REG_A0, paramBlock);
+    m68k_set_reg(M68K_REG_D0, (unsigned int)result);
+    m68k_set_reg(M68K_REG_PC, routine);
+    return true;
+}
+
+
+/**
+ * Restore the registers of the app after a completion routine returned.
+ *
+ * The glue returns to the interrupted instruction with an rts.
+ */
+void trapCompletionReturn(unsigned short)
+{
+    m68k_set_reg(M68K_REG_SR, gMosCompletionRegs[M68K_REG_SR]);
+    for (int i=M68K_REG_D0; i<M68K_REG_A7; i++)
+        m68k_set_reg((m68k_register_t)i, gMosCompletionRegs[i]);
+    unsigned int sp = gMosCompletionRegs[M68K_REG_A7] - 4;
+    m68k_write_memory_32(sp, gMosCompletionRegs[M68K_REG_PC]);
+    m68k_set_reg(M68K_REG_SP, sp);
+    gMosInCompletion = false;
+}
+
+
 /**
  * Create jump table entry in simulator space.
  */
@@ -1048,11 +1356,85 @@ mosPtr createGlue(unsigned short index, void (*nativeCodeEntry)(uint16_t))
     if (index) {
         tncTable[index&0x0FFF] = p;
     }
+    gMosGlue.push_back(p);
 
     return p;
 }
 
 
+/**
+ * Remember the trap table, so that traps patched by the app can be reset.
+ */
+void mosSaveTrapTable()
+{
+    if (!gSavedTncTable)
+        gSavedTncTable = (mosPtr*)calloc(0x0fff, sizeof(mosPtr));
+    memcpy(gSavedTncTable, tncTable, 0x0fff*sizeof(mosPtr));
+}
+
+
+/**
+ * Undo all trap patches since the last call to mosSaveTrapTable().
+ */
+void mosRestoreTrapTable()
+{
+    if (gSavedTncTable)
+        memcpy(tncTable, gSavedTncTable, 0x0fff*sizeof(mosPtr));
+}
+
+
+/**
+ * Add the trap table and the glue to a snapshot file.
+ *
+ * \return false if the app is inside a completion routine
+ */
+bool mosSaveTrapState(MosSnapshotState &state)
+{
+    if (gMosInCompletion)
+        return false;
+    mosSnapshotWrite(state, trapDispatchTrap);
+    mosSnapshotWrite(state, trapExitApp);
+    mosSnapshotWrite(state, tncCompletionReturn);
+    for (int i=0; i<0x0fff; i++)
+        mosSnapshotWrite(state, tncTable[i]);
+    mosSnapshotWritePtr(state, (uintptr_t)trapGoNative);
+    mosSnapshotWrite(state, (uint32_t)gMosGlue.size());
+    for (mosPtr glue: gMosGlue)
+        mosSnapshotWrite(state, glue);
+    return true;
+}
+
+
+/**
+ * Read the trap table from a snapshot file.
+ *
+ * The glue in RAM was loaded with the snapshot, but the host functions it
+ * calls most likely moved since, so all native pointers are adjusted.
+ *
+ * \return false if the state is incomplete
+ */
+bool mosLoadTrapState(MosSnapshotReader &reader)
+{
+    trapDispatchTrap = mosSnapshotRead(reader);
+    trapExitApp = mosSnapshotRead(reader);
+    tncCompletionReturn = mosSnapshotRead(reader);
+    for (int i=0; i<0x0fff; i++)
+        tncTable[i] = mosSnapshotRead(reader);
+    uintptr_t delta = (uintptr_t)trapGoNative - (uintptr_t)mosSnapshotReadPtr(reader);
+    uint32_t n = mosSnapshotRead(reader);
+    if (reader.failed || n>reader.size-reader.pos)
+        return false;
+    gMosGlue.clear();
+    for (uint32_t i=0; i<n; i++) {
+        mosPtr glue = mosSnapshotRead(reader);
+        mosWriteUnsafe64(glue+4, mosReadUnsafe64(glue+4)+delta);
+        gMosGlue.push_back(glue);
+    }
+    gMosInCompletion = false;
+    return !reader.failed;
+}
+
+
 /**
  * Create a jump table for all possible trap commands.
  */
@@ -1061,6 +1443,7 @@ void mosSetupTrapTable()
     int i;
 
     mosPtr tncUnimplemented = createGlue(0, trapUninmplemented);
+    tncCompletionReturn = createGlue(0, trapCompletionReturn);
     tncTable = (mosPtr*)calloc(0x0fff, sizeof(mosPtr));
     for (i=0; i<0x0FFF; i++) {
         tncTable[i] = tncUnimplemented;
@@ -1074,7 +1457,7 @@ void mosSetupTrapTable()
     // GetApplLimit
     // SetAppleLimit
     // MaxApplZone
-    // MoreMasters
+    createGlue(0xA036, trapMoreMasters);
 
     // -- Heap Zone Access
 
@@ -1104,19 +1487,25 @@ void mosSetupTrapTable()
 
     // -- Freeing Space in the Heap
 
-    // FreeMem
-    // MaxMem
-    // CompactMem
+    createGlue(0xA01C, trapFreeMem);
+    tncTable[0x041C] = tncTable[0x001C];
+    createGlue(0xA11D, trapMaxMem);
+    tncTable[0x051D] = tncTable[0x011D];
+    createGlue(0xA04C, trapCompactMem);
+    tncTable[0x044C] = tncTable[0x004C];
     // ReservMem
-    // PurgeMem
-    // EmptyHandle
+    createGlue(0xA04D, trapPurgeMem);
+    tncTable[0x044D] = tncTable[0x004D];
+    createGlue(0xA02B, trapEmptyHandle);
 
     // -- Properties of Relocatable Blocks
 
     createGlue(0xA029, trapHLock);
     createGlue(0xA02A, trapHUnlock);
     createGlue(0xA049, trapHPurge);
-    // HNoPurge
+    createGlue(0xA04A, trapHNoPurge);
+    createGlue(0xA069, trapHGetState);
+    createGlue(0xA06A, trapHSetState);
 
     // -- Grow Zone Operations
 
@@ -1145,6 +1534,13 @@ void mosSetupTrapTable()
     createGlue(0xA012, trapSetEOF);
     createGlue(0xA044, trapSetFPos);
     createGlue(0xA060, trapFSDispatch);
+    // bit 10 is set for asynchronous calls
+    static const uint16_t asyncFileTraps[] = {
+        0x0000, 0x0200, 0x0001, 0x0002, 0x0003, 0x0008, 0x0009, 0x0209,
+        0x000C, 0x000D, 0x0012, 0x0044
+    };
+    for (uint16_t trap: asyncFileTraps)
+        tncTable[trap|0x0400] = tncTable[trap];
 
     // -- unsorted
 
@@ -1153,13 +1549,16 @@ void mosSetupTrapTable()
     tncTable[0x0346] = tncTable[0x0146];
     createGlue(0xA647, trapSetTrapAddress);
     createGlue(0xA9F0, trapLoadSeg);
-    createGlue(0xA069, trapHGetState);
     createGlue(0xA055, trapStripAddress);
     createGlue(0xA9A0, trapGetResource);
     createGlue(0xA9A2, trapLoadResource);
     createGlue(0xA9A5, trapSizeResource);
     createGlue(0xA9A1, trapGetNamedResource);
     tncTable[0x0820] = tncTable[0x09A1];
+    createGlue(0xA80D, trapCount1Resources);
+    tncTable[0x099C] = tncTable[0x080D]; // CountResources, we only have one resource file
+    createGlue(0xA80E, trapGet1IxResource);
+    tncTable[0x099D] = tncTable[0x080E]; // GetIndResource
     createGlue(0xA88F, trapOSDispatch);
     createGlue(0xA9C6, trapSecondsToDate);
     createGlue(0xA975, trapTickCount);
@@ -24,6 +24,7 @@
 #define mosrun_traps_h
 
 #include "main.h"
+#include "snapshot.h"
 
 extern uint16_t gCurrentTrap;
 extern unsigned int trapDispatchTrap;
@@ -32,8 +33,13 @@ extern unsigned int trapExitApp;
 void trapGoNative(unsigned short instr);
 void trapBreakpoint(unsigned short instr);
 void trapDispatch(unsigned short);
+bool mosCallCompletion(mosPtr routine, mosPtr paramBlock, int result);
 mosPtr createGlue(unsigned short index, mosTrap trap);
 void mosSetupTrapTable();
+void mosSaveTrapTable();
+void mosRestoreTrapTable();
+bool mosSaveTrapState(MosSnapshotState &state);
+bool mosLoadTrapState(MosSnapshotReader &reader);
 
 unsigned int mosTickCount();
 
@@ -0,0 +1,209 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+/** \file vfs.cpp
+ An in-memory file system for intermediate files.
+
+ Build chains write many temporary files that are only read again by the
+ next tool or batch job. Names that start with a prefix given by
+ ---vfs-mount are kept in host memory and never touch the disk. Files live
+ until they are deleted or mosrun quits.
+
+ Names are compared in Unix format, so ":Temp:x.o" and "Temp/x.o" refer to
+ the same file. There are no directories, every name below the prefix is
+ a file.
+ */
+
+#include "vfs.h"
+
+#include "filename.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+
+#ifndef O_ACCMODE
+#define O_ACCMODE 3
+#endif
+
+
+// prefixes of all mounted file systems in Unix format
+static std::vector<std::string> gMosVfsPrefixes;
+
+// all files in the in-memory file system, indexed by their Unix name
+static std::map<std::string, MosVfsNodeRef> gMosVfsFiles;
+
+
+/**
+ * Convert a file name into the name that we use as a key.
+ */
+static std::string mosVfsKey(const char *filename)
+{
+    std::string name(filename);
+    return std::string(mosFilenameConvertTo(name.c_str(), MOS_TYPE_UNIX));
+}
+
+
+/**
+ * Keep all files whose names start with prefix in memory.
+ *
+ * \param prefix a path in Mac or Unix format, for example ":Temp:"
+ */
+void mosVfsMount(const char *prefix)
+{
+    std::string key = mosVfsKey(prefix);
+    if (key.empty() || key[key.size()-1]!='/')
+        key += '/';
+    gMosVfsPrefixes.push_back(key);
+}
+
+
+/**
+ * Check if a file belongs to the in-memory file system.
+ */
+bool mosVfsContains(const char *filename)
+{
+    if (gMosVfsPrefixes.empty())
+        return false;
+    std::string key = mosVfsKey(filename);
+    for (const std::string &prefix: gMosVfsPrefixes) {
+        if (key.compare(0, prefix.size(), prefix)==0)
+            return true;
+    }
+    return false;
+}
+
+
+/**
+ * Open a file in the in-memory file system.
+ *
+ * \param filename name of the file
+ * \param flags Unix flags as in open(), O_CREAT, O_EXCL, and O_TRUNC are
+ *        supported
+ * \return the file, or nullptr and errno
+ */
+MosVfsNodeRef mosVfsOpen(const char *filename, int flags)
+{
+    std::string key = mosVfsKey(filename);
+    auto it = gMosVfsFiles.find(key);
+    if (it==gMosVfsFiles.end()) {
+        if ((flags&O_CREAT)==0) {
+            errno = ENOENT;
+            return nullptr;
+        }
+        MosVfsNodeRef node = std::make_shared<MosVfsNode>();
+        node->mtime = time(nullptr);
+        gMosVfsFiles[key] = node;
+        return node;
+    }
+    if ((flags&O_CREAT) && (flags&O_EXCL)) {
+        errno = EEXIST;
+        return nullptr;
+    }
+    if ((flags&O_TRUNC) && (flags&O_ACCMODE)!=O_RDONLY)
+        mosVfsTruncate(it->second, 0);
+    return it->second;
+}
+
+
+/**
+ * Delete a file from the in-memory file system.
+ *
+ * Files that are still open keep their data until they are closed.
+ *
+ * \return 0, or -1 and errno
+ */
+int mosVfsRemove(const char *filename)
+{
+    if (gMosVfsFiles.erase(mosVfsKey(filename))==0) {
+        errno = ENOENT;
+        return -1;
+    }
+    return 0;
+}
+
+
+/**
+ * Get the size and modification time of a file.
+ *
+ * \return 0, or -1 and errno
+ */
+int mosVfsStat(const char *filename, struct stat *st)
+{
+    auto it = gMosVfsFiles.find(mosVfsKey(filename));
+    if (it==gMosVfsFiles.end()) {
+        errno = ENOENT;
+        return -1;
+    }
+    memset(st, 0, sizeof(struct stat));
+    st->st_mode = S_IFREG | 0644;
+    st->st_nlink = 1;
+    st->st_size = (off_t)it->second->data.size();
+    st->st_mtime = st->st_ctime = st->st_atime = it->second->mtime;
+    return 0;
+}
+
+
+/**
+ * Read from a file.
+ *
+ * \return number of bytes read, 0 at the end of the file
+ */
+unsigned int mosVfsRead(const MosVfsNodeRef &node, unsigned int pos, void *dst, unsigned int size)
+{
+    if (pos>=node->data.size())
+        return 0;
+    unsigned int avail = (unsigned int)node->data.size()-pos;
+    if (size>avail)
+        size = avail;
+    memcpy(dst, node->data.data()+pos, size);
+    return size;
+}
+
+
+/**
+ * Write to a file, making it larger if needed.
+ *
+ * \return number of bytes written
+ */
+unsigned int mosVfsWrite(const MosVfsNodeRef &node, unsigned int pos, const void *src, unsigned int size)
+{
+    if (pos+size>node->data.size())
+        node->data.resize(pos+size);
+    memcpy(node->data.data()+pos, src, size);
+    node->mtime = time(nullptr);
+    return size;
+}
+
+
+/**
+ * Change the size of a file.
+ */
+void mosVfsTruncate(const MosVfsNodeRef &node, unsigned int size)
+{
+    node->data.resize(size);
+    node->mtime = time(nullptr);
+}
@@ -0,0 +1,59 @@
+/*
+ mosrun - the MacOS MPW runtime emulator
+ Copyright (C) 2013-2020  Matthias Melcher
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The author can be contacted at mosrun AT matthiasm DOT com.
+ The latest source code can be found at https://github.com/MatthiasWM/mosrun
+ */
+
+
+
+#ifndef __mosrun__vfs__
+#define __mosrun__vfs__
+
+
+#include <sys/stat.h>
+#include <time.h>
+
+#include <memory>
+#include <vector>
+
+
+/**
+ * A file in the in-memory file system.
+ */
+typedef struct
+{
+    std::vector<char> data;
+    time_t mtime;
+} MosVfsNode;
+
+typedef std::shared_ptr<MosVfsNode> MosVfsNodeRef;
+
+
+void mosVfsMount(const char *prefix);
+bool mosVfsContains(const char *filename);
+
+MosVfsNodeRef mosVfsOpen(const char *filename, int flags);
+int mosVfsRemove(const char *filename);
+int mosVfsStat(const char *filename, struct stat *st);
+
+unsigned int mosVfsRead(const MosVfsNodeRef &node, unsigned int pos, void *dst, unsigned int size);
+unsigned int mosVfsWrite(const MosVfsNodeRef &node, unsigned int pos, const void *src, unsigned int size);
+void mosVfsTruncate(const MosVfsNodeRef &node, unsigned int size);
+
+
+#endif /* defined(__mosrun__vfs__) */